@@ -3,11 +3,45 @@
  * @brief Car Animation Gallery - Non-face animation implementations
  *
  * 36 creative animations rendered using LVGL direct layer drawing.
- * Each animation has its own draw function called at 20 FPS.
+ * Each animation has its own draw function, ticked by the frame governor
+ * (8-25 FPS depending on render cost; the idle rate while hidden).
+ *
+ * Every animation is described by an anim_desc_t: a solid background
+ * color, an optional static background layer (gauge arcs, outlines, grids)
+ * and the area its moving content can occupy. Each tick only that area
+ * (plus last tick's, so old content is erased) is invalidated, and an
+ * animation whose picture did not change (a blinking arrow between
+ * toggles) invalidates nothing. LVGL clips the draw callback to the
+ * invalidated areas; the pixels redrawn are counted per animation
+ * (gallery_anim_get_stats()).
+ *
+ * The static background is rendered once into an RGB565 buffer on the
+ * first tick after the animation is selected and blitted afterwards, if
+ * its bounding box fits CONFIG_GALLERY_ANIM_BG_CACHE_KB and the heap can
+ * spare it; otherwise it is drawn as vectors. The buffer only exists while
+ * a non-face animation is on screen.
+ *
+ * A draw function may be called several times per tick (once per
+ * invalidated area and display stripe), so simulation state is only
+ * advanced on the first call of a tick (s_step). s_time is sampled from
+ * the governor's esp_timer-based animation clock and physics integrates
+ * over the real tick interval (s_dt), so a late tick skips frames instead
+ * of slowing the motion, at any frame rate. Each simulation lives in a
+ * step_*() function that gallery_anim_check() (CONFIG_APP_SELF_TEST)
+ * also runs at 10, 20 and 30 FPS, comparing where the motion ends up.
+ *
+ * Rain, snow, stars, firework sparks and bubbles are particle_engine
+ * systems described by an anim_particles_t: built when the animation
+ * starts, updated once per tick and drawn with one call per draw callback.
  */
 
 #include "gallery_animations.h"
+#include "frame_governor.h"
+#include "particle_engine.h"
+#include "bsp_board.h"
 #include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "sdkconfig.h"
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
@@ -22,8 +56,20 @@ static const char *TAG = "GalleryAnim";
 #define SCREEN_HEIGHT   284
 #define CENTER_X        (SCREEN_WIDTH / 2)
 #define CENTER_Y        (SCREEN_HEIGHT / 2)
-#define ANIM_FPS        20
-#define ANIM_PERIOD_MS  (1000 / ANIM_FPS)
+#define ANIM_MIN_FPS    8
+#define ANIM_MAX_FPS    25
+#define ANIM_IDLE_FPS   8               /* While hidden */
+#define NOISE_HZ        20              /* tick_noise() changes value this often */
+#define BG_NONE         0xFFFFFFFFu     /* Draw function paints its own background */
+#define BG_CACHE_BUDGET ((uint32_t)CONFIG_GALLERY_ANIM_BG_CACHE_KB * 1024)
+#define BG_CACHE_KEEP_FREE  (64 * 1024) /* Internal RAM the cache never takes from the rest */
+#define BALL_GRAVITY    500.0f          /* px/s^2 */
+#define BALL_FLOOR_Y    (SCREEN_HEIGHT - 60)
+#define BINARY_SCROLL_PX_S  20.0f
+
+#define AREA(x1, y1, x2, y2)    { (x1), (y1), (x2), (y2) }
+#define SCREEN_AREA             AREA(0, 0, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1)
+#define NO_AREA                 AREA(0, 0, 0, 0)
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846f
@@ -88,24 +134,47 @@ static const gallery_anim_info_t s_anim_info[GALLERY_ANIM_MAX] = {
  *===========================================================================*/
 
 static lv_obj_t *s_draw_obj = NULL;
-static lv_timer_t *s_anim_timer = NULL;
+static frame_gov_handle_t s_anim_timer = NULL;
 static gallery_anim_id_t s_current_anim = GALLERY_ANIM_PULSING_RINGS;
 static float s_time = 0.0f;
+static float s_prev_time = 0.0f;            /* s_time of the previous tick */
+static float s_dt = 0.0f;                   /* Seconds the current tick advances */
 static bool s_visible = false;
-
-/* Animation-specific state */
+static bool s_step_pending = true;          /* Tick not yet simulated */
+static bool s_step = false;                 /* Current draw call advances state */
+static bool s_full_redraw = true;           /* Next tick invalidates everything */
+static lv_area_t s_prev_dirty;              /* Area invalidated last tick */
+static bool s_have_prev_dirty = false;
+static gallery_anim_id_t s_bg_anim = GALLERY_ANIM_MAX;     /* Animation s_bg was built for */
+static uint32_t s_frame_px;                 /* Pixels drawn since the last tick */
+static gallery_anim_stats_t s_stats[GALLERY_ANIM_MAX];
+
+/* Pre-rendered static background of the current animation */
 static struct {
-    /* Rain/Snow particles */
-    struct { float x, y, speed; } particles[40];
-    int particle_count;
+    lv_image_dsc_t img;
+    uint8_t *data;                          /* NULL = not cached */
+    lv_area_t area;
+} s_bg;
+
+/* Particles of an animation (see anim_desc_t) */
+typedef struct {
+    const particle_emitter_t *emitter;
+    uint16_t capacity;
+    uint16_t fill;                          /* Spawned when the animation starts */
+} anim_particles_t;
+
+/* Particle system of the current animation */
+static particle_system_t s_particles;
+static gallery_anim_id_t s_particles_anim = GALLERY_ANIM_MAX;  /* Animation s_particles was built for */
 
-    /* Stars */
-    struct { float x, y, phase, speed; } stars[40];
+/* Animation-specific state */
+typedef struct {
+    /* Matrix rain streams */
+    struct { float x, y, speed; } streams[20];
+    int stream_count;
 
-    /* Fireworks */
-    struct { float x, y, vx, vy, life; } sparks[50];
+    /* Fireworks rocket (the sparks are s_particles) */
     float launch_x, launch_y, launch_vy;
-    int spark_count;
     bool launching;
 
     /* Sound waves */
@@ -118,12 +187,9 @@ static struct {
     /* Binary code */
     char binary_cols[6][10];
     float scroll_offset;
+} anim_state_t;
 
-    /* Gear display */
-    int current_gear;
-    float gear_timer;
-
-} s_state;
+static anim_state_t s_state;
 
 /*===========================================================================
  * Drawing Helpers (same as mochi_face.c)
@@ -216,14 +282,31 @@ static void fill_background(lv_layer_t *layer, uint32_t color_hex)
                      lv_color_hex(color_hex), LV_OPA_COVER);
 }
 
+static void area_add_point(lv_area_t *area, int x, int y)
+{
+    if (x < area->x1) area->x1 = x;
+    if (y < area->y1) area->y1 = y;
+    if (x > area->x2) area->x2 = x;
+    if (y > area->y2) area->y2 = y;
+}
+
+/**
+ * @brief Pseudo-random value in [0, range), the same for every draw call
+ *        of one tick (rand() would differ between display stripes)
+ */
+static int tick_noise(float t, int salt, int range)
+{
+    uint32_t h = (uint32_t)(t * NOISE_HZ + 0.5f) * 2654435761u ^ (uint32_t)salt * 40503u;
+    h ^= h >> 15;
+    return (int)(h % (uint32_t)range);
+}
+
 /*===========================================================================
  * Abstract Geometric Animations
  *===========================================================================*/
 
 static void draw_pulsing_rings(lv_layer_t *layer, float t)
 {
-    fill_background(layer, 0x0D1B2A);
-
     uint32_t colors[] = {0x00BCD4, 0x00ACC1, 0x0097A7, 0x00838F};
 
     for (int i = 0; i < 4; i++) {
@@ -238,8 +321,6 @@ static void draw_pulsing_rings(lv_layer_t *layer, float t)
 
 static void draw_spiral_galaxy(lv_layer_t *layer, float t)
 {
-    fill_background(layer, 0x0D0221);
-
     float rotation = t * 0.5f * M_PI;
 
     for (int arm = 0; arm < 3; arm++) {
@@ -264,18 +345,19 @@ static void draw_spiral_galaxy(lv_layer_t *layer, float t)
     draw_circle(layer, CENTER_X, CENTER_Y, 8, lv_color_hex(0xFFFFFF), LV_OPA_COVER);
 }
 
-static void draw_heartbeat(lv_layer_t *layer, float t)
+static void bg_heartbeat(lv_layer_t *layer)
 {
-    fill_background(layer, 0x001100);
-
-    /* Draw grid lines */
+    /* Grid lines */
     for (int x = 0; x < SCREEN_WIDTH; x += 20) {
         draw_line(layer, x, 0, x, SCREEN_HEIGHT, lv_color_hex(0x003300), 1);
     }
     for (int y = 0; y < SCREEN_HEIGHT; y += 20) {
         draw_line(layer, 0, y, SCREEN_WIDTH, y, lv_color_hex(0x003300), 1);
     }
+}
 
+static void draw_heartbeat(lv_layer_t *layer, float t)
+{
     /* EKG line */
     int prev_y = CENTER_Y;
     float sweep = fmodf(t * 0.5f, 1.0f) * SCREEN_WIDTH;
@@ -313,8 +395,6 @@ static void draw_heartbeat(lv_layer_t *layer, float t)
 
 static void draw_breathing_orb(lv_layer_t *layer, float t)
 {
-    fill_background(layer, 0x01579B);
-
     float scale = 0.7f + 0.3f * sinf(t * 2.0f * M_PI * 0.2f);
     int base_r = 60;
 
@@ -332,34 +412,43 @@ static void draw_breathing_orb(lv_layer_t *layer, float t)
                 lv_color_hex(0xB3E5FC), LV_OPA_COVER);
 }
 
-static void draw_matrix_rain(lv_layer_t *layer, float t)
+static bool dirty_breathing_orb(float prev_t, float t, lv_area_t *area)
 {
-    fill_background(layer, 0x000800);
+    float scale = 0.7f + 0.3f * sinf(t * 2.0f * M_PI * 0.2f);
+    int r = (int)(60 * scale) + 4 * 15 + 1;
+
+    lv_area_set(area, CENTER_X - r, CENTER_Y - r, CENTER_X + r, CENTER_Y + r);
+    return true;
+}
 
-    /* Initialize particles if needed */
-    if (s_state.particle_count == 0) {
-        s_state.particle_count = 20;
+static void draw_matrix_rain(lv_layer_t *layer, float t)
+{
+    /* Initialize streams if needed */
+    if (s_state.stream_count == 0) {
+        s_state.stream_count = 20;
         for (int i = 0; i < 20; i++) {
-            s_state.particles[i].x = (rand() % SCREEN_WIDTH);
-            s_state.particles[i].y = -(rand() % SCREEN_HEIGHT);
-            s_state.particles[i].speed = 100 + (rand() % 150);
+            s_state.streams[i].x = (rand() % SCREEN_WIDTH);
+            s_state.streams[i].y = -(rand() % SCREEN_HEIGHT);
+            s_state.streams[i].speed = 100 + (rand() % 150);
         }
     }
 
     /* Draw falling streams */
     for (int i = 0; i < 20; i++) {
         /* Update position */
-        s_state.particles[i].y += s_state.particles[i].speed * (1.0f / ANIM_FPS);
+        if (s_step) {
+            s_state.streams[i].y += s_state.streams[i].speed * s_dt;
 
-        if (s_state.particles[i].y > SCREEN_HEIGHT + 100) {
-            s_state.particles[i].y = -(rand() % 100);
-            s_state.particles[i].x = (rand() % SCREEN_WIDTH);
+            if (s_state.streams[i].y > SCREEN_HEIGHT + 100) {
+                s_state.streams[i].y = -(rand() % 100);
+                s_state.streams[i].x = (rand() % SCREEN_WIDTH);
+            }
         }
 
         /* Draw trail */
-        int x = (int)s_state.particles[i].x;
+        int x = (int)s_state.streams[i].x;
         for (int j = 0; j < 10; j++) {
-            int y = (int)s_state.particles[i].y - j * 12;
+            int y = (int)s_state.streams[i].y - j * 12;
             if (y >= 0 && y < SCREEN_HEIGHT) {
                 lv_opa_t opa = 255 - j * 25;
                 uint8_t green = 255 - j * 15;
@@ -370,21 +459,22 @@ static void draw_matrix_rain(lv_layer_t *layer, float t)
     }
 }
 
-static void draw_radar_sweep(lv_layer_t *layer, float t)
+static void bg_radar_sweep(lv_layer_t *layer)
 {
-    fill_background(layer, 0x001a00);
-
-    /* Draw concentric rings */
+    /* Concentric rings */
     for (int r = 30; r <= 120; r += 30) {
         draw_ring(layer, CENTER_X, CENTER_Y, r, 1, lv_color_hex(0x004400), LV_OPA_COVER);
     }
 
-    /* Draw cross hairs */
+    /* Cross hairs */
     draw_line(layer, CENTER_X - 120, CENTER_Y, CENTER_X + 120, CENTER_Y,
               lv_color_hex(0x004400), 1);
     draw_line(layer, CENTER_X, CENTER_Y - 120, CENTER_X, CENTER_Y + 120,
               lv_color_hex(0x004400), 1);
+}
 
+static void draw_radar_sweep(lv_layer_t *layer, float t)
+{
     /* Sweep line */
     float angle = fmodf(t * M_PI, 2.0f * M_PI);
     int sweep_x = CENTER_X + (int)(cosf(angle) * 120);
@@ -422,75 +512,77 @@ static void draw_radar_sweep(lv_layer_t *layer, float t)
     draw_circle(layer, CENTER_X, CENTER_Y, 3, lv_color_hex(0x00FF00), LV_OPA_COVER);
 }
 
-/*===========================================================================
- * Weather Effect Animations
- *===========================================================================*/
-
-static void draw_rain_storm(lv_layer_t *layer, float t)
+/* Sweep wedge and visible blips; the lines end at the trail points */
+static bool dirty_radar_sweep(float prev_t, float t, lv_area_t *area)
 {
-    fill_background(layer, 0x1A237E);
+    float angle = fmodf(t * M_PI, 2.0f * M_PI);
 
-    /* Initialize drops */
-    if (s_state.particle_count == 0) {
-        s_state.particle_count = 30;
-        for (int i = 0; i < 30; i++) {
-            s_state.particles[i].x = rand() % SCREEN_WIDTH;
-            s_state.particles[i].y = rand() % SCREEN_HEIGHT;
-            s_state.particles[i].speed = 300 + (rand() % 200);
-        }
+    lv_area_set(area, CENTER_X, CENTER_Y, CENTER_X, CENTER_Y);
+    for (int i = 0; i < 30; i++) {
+        float trail_angle = angle - (i * 0.03f);
+        area_add_point(area, CENTER_X + (int)(cosf(trail_angle) * 120),
+                       CENTER_Y + (int)(sinf(trail_angle) * 120));
     }
 
-    for (int i = 0; i < 30; i++) {
-        s_state.particles[i].y += s_state.particles[i].speed * (1.0f / ANIM_FPS);
+    int blip_seed = (int)(t * 3) % 5;
+    for (int i = 0; i < 3; i++) {
+        if (fmodf(t + i * 0.5f, 2.0f) >= 1.0f) continue;
+        int blip_angle = (blip_seed + i * 37) % 360;
+        int blip_r = 30 + ((blip_seed + i * 17) % 90);
+        area_add_point(area, CENTER_X + (int)(cosf(blip_angle * M_PI / 180) * blip_r),
+                       CENTER_Y + (int)(sinf(blip_angle * M_PI / 180) * blip_r));
+    }
 
-        if (s_state.particles[i].y > SCREEN_HEIGHT) {
-            /* Splash effect - draw circle at bottom */
-            int splash_x = (int)s_state.particles[i].x;
-            draw_circle(layer, splash_x, SCREEN_HEIGHT - 5, 3,
-                       lv_color_hex(0xBBDEFB), LV_OPA_50);
+    lv_area_increase(area, 5, 5);   /* Blip radius, line width */
+    return true;
+}
 
-            /* Reset drop */
-            s_state.particles[i].y = -(rand() % 50);
-            s_state.particles[i].x = rand() % SCREEN_WIDTH;
-        }
+/*===========================================================================
+ * Weather Effect Animations
+ *===========================================================================*/
 
-        /* Draw raindrop as short line */
-        int x = (int)s_state.particles[i].x;
-        int y = (int)s_state.particles[i].y;
-        draw_line(layer, x, y, x, y + 15, lv_color_hex(0x90CAF9), 2);
-    }
-}
+static const particle_emitter_t s_rain_drops = {
+    .spawn = AREA(0, -50, SCREEN_WIDTH - 1, -1),
+    .bounds = AREA(-2, -50, SCREEN_WIDTH + 1, SCREEN_HEIGHT),
+    .respawn = true,
+    .vy_min = 300, .vy_max = 500,
+    .shape = PARTICLE_SHAPE_RECT,
+    .size_min = 2, .size_max = 2, .rect_h = 15,
+    .colors = { 0x90CAF9 }, .color_count = 1,
+    .opa = LV_OPA_COVER,
+};
+static const anim_particles_t s_rain_particles = { &s_rain_drops, 30, 30 };
 
-static void draw_snowfall(lv_layer_t *layer, float t)
+static void draw_rain_storm(lv_layer_t *layer, float t)
 {
-    fill_background(layer, 0x1A237E);
-
-    /* Initialize flakes */
-    if (s_state.particle_count == 0) {
-        s_state.particle_count = 25;
-        for (int i = 0; i < 25; i++) {
-            s_state.particles[i].x = rand() % SCREEN_WIDTH;
-            s_state.particles[i].y = rand() % SCREEN_HEIGHT;
-            s_state.particles[i].speed = 30 + (rand() % 40);
+    /* Splash at the bottom while a drop re-enters at the top */
+    for (int i = 0; i < s_particles.count; i++) {
+        if (s_particles.y[i] < 0) {
+            draw_circle(layer, fx_to_int(s_particles.x[i]), SCREEN_HEIGHT - 5, 3,
+                       lv_color_hex(0xBBDEFB), LV_OPA_50);
         }
     }
 
-    for (int i = 0; i < 25; i++) {
-        /* Drift with sine wave */
-        s_state.particles[i].x += sinf(t * 2 + i) * 0.5f;
-        s_state.particles[i].y += s_state.particles[i].speed * (1.0f / ANIM_FPS);
+    particle_system_draw(&s_particles, layer);
+}
 
-        if (s_state.particles[i].y > SCREEN_HEIGHT) {
-            s_state.particles[i].y = -10;
-            s_state.particles[i].x = rand() % SCREEN_WIDTH;
-        }
-        if (s_state.particles[i].x < 0) s_state.particles[i].x = SCREEN_WIDTH;
-        if (s_state.particles[i].x > SCREEN_WIDTH) s_state.particles[i].x = 0;
+static const particle_emitter_t s_snow_flakes = {
+    .spawn = AREA(0, -10, SCREEN_WIDTH - 1, -6),
+    .bounds = AREA(-10, -10, SCREEN_WIDTH + 9, SCREEN_HEIGHT + 5),
+    .respawn = true,
+    .vy_min = 30, .vy_max = 70,
+    .shape = PARTICLE_SHAPE_DISC,
+    .size_min = 2, .size_max = 5,
+    .colors = { 0xFFFFFF }, .color_count = 1,
+    .opa = LV_OPA_COVER,
+    .freq_min_mhz = 250, .freq_max_mhz = 400,   /* Drift */
+    .wobble_px = 6,
+};
+static const anim_particles_t s_snow_particles = { &s_snow_flakes, 25, 25 };
 
-        int r = 2 + (i % 4);
-        draw_circle(layer, (int)s_state.particles[i].x, (int)s_state.particles[i].y,
-                   r, lv_color_hex(0xFFFFFF), LV_OPA_COVER);
-    }
+static void draw_snowfall(lv_layer_t *layer, float t)
+{
+    particle_system_draw(&s_particles, layer);
 
     /* Ground snow accumulation */
     draw_filled_rect(layer, 0, SCREEN_HEIGHT - 20, SCREEN_WIDTH, 20,
@@ -499,8 +591,6 @@ static void draw_snowfall(lv_layer_t *layer, float t)
 
 static void draw_sunshine(lv_layer_t *layer, float t)
 {
-    fill_background(layer, 0x87CEEB);
-
     float rotation = t * 0.5f;
 
     /* Draw rays */
@@ -520,13 +610,15 @@ static void draw_sunshine(lv_layer_t *layer, float t)
     draw_circle(layer, CENTER_X, CENTER_Y, 38, lv_color_hex(0xFFEB3B), LV_OPA_COVER);
 }
 
-static void draw_lightning(lv_layer_t *layer, float t)
+static bool lightning_flash(float t)
 {
-    /* Determine if flash is happening */
     float cycle = fmodf(t, 3.0f);
-    bool flash = (cycle < 0.1f) || (cycle > 0.15f && cycle < 0.2f);
+    return (cycle < 0.1f) || (cycle > 0.15f && cycle < 0.2f);
+}
 
-    if (flash) {
+static void draw_lightning(lv_layer_t *layer, float t)
+{
+    if (lightning_flash(t)) {
         fill_background(layer, 0xFFFFFF);
 
         /* Draw bolt */
@@ -556,32 +648,27 @@ static void draw_lightning(lv_layer_t *layer, float t)
     }
 }
 
-static void draw_starry_night(lv_layer_t *layer, float t)
+/* The whole picture changes, but only when the flash toggles */
+static bool dirty_lightning(float prev_t, float t, lv_area_t *area)
 {
-    fill_background(layer, 0x0D1B2A);
-
-    /* Initialize stars */
-    static bool initialized = false;
-    if (!initialized) {
-        for (int i = 0; i < 40; i++) {
-            s_state.stars[i].x = rand() % SCREEN_WIDTH;
-            s_state.stars[i].y = rand() % SCREEN_HEIGHT;
-            s_state.stars[i].phase = (float)(rand() % 100) / 100.0f * 2.0f * M_PI;
-            s_state.stars[i].speed = 1.0f + (float)(rand() % 30) / 10.0f;
-        }
-        initialized = true;
-    }
-
-    for (int i = 0; i < 40; i++) {
-        float twinkle = 0.5f + 0.5f * sinf(t * s_state.stars[i].speed + s_state.stars[i].phase);
-        lv_opa_t opa = (lv_opa_t)(twinkle * 255);
+    return lightning_flash(prev_t) != lightning_flash(t);
+}
 
-        int r = (i % 3) + 1;
-        lv_color_t color = (i % 5 == 0) ? lv_color_hex(0xFFEB3B) : lv_color_hex(0xFFFFFF);
+static const particle_emitter_t s_stars = {
+    .spawn = SCREEN_AREA,
+    .bounds = SCREEN_AREA,
+    .shape = PARTICLE_SHAPE_DISC,
+    .size_min = 1, .size_max = 3,
+    .colors = { 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFFFFF, 0xFFEB3B }, .color_count = 5,
+    .opa = LV_OPA_COVER,
+    .freq_min_mhz = 160, .freq_max_mhz = 640,
+    .twinkle = true,
+};
+static const anim_particles_t s_star_particles = { &s_stars, 40, 40 };
 
-        draw_circle(layer, (int)s_state.stars[i].x, (int)s_state.stars[i].y,
-                   r, color, opa);
-    }
+static void draw_starry_night(lv_layer_t *layer, float t)
+{
+    particle_system_draw(&s_particles, layer);
 
     /* Moon */
     draw_circle(layer, 50, 60, 25, lv_color_hex(0xFFFDE7), LV_OPA_COVER);
@@ -590,8 +677,6 @@ static void draw_starry_night(lv_layer_t *layer, float t)
 
 static void draw_aurora(lv_layer_t *layer, float t)
 {
-    fill_background(layer, 0x0D1B2A);
-
     uint32_t colors[] = {0x00E676, 0x00BCD4, 0xE040FB, 0xEC407A, 0x7C4DFF};
 
     for (int band = 0; band < 5; band++) {
@@ -628,8 +713,6 @@ static void draw_heart_shape(lv_layer_t *layer, int cx, int cy, int size,
 
 static void draw_floating_hearts(lv_layer_t *layer, float t)
 {
-    fill_background(layer, 0xFCE4EC);
-
     for (int i = 0; i < 8; i++) {
         float phase = fmodf(t * 0.5f + i * 0.2f, 1.0f);
         int x = 30 + (i * 30);
@@ -667,8 +750,6 @@ static void draw_star_shape(lv_layer_t *layer, int cx, int cy, int outer_r, int
 
 static void draw_star_burst(lv_layer_t *layer, float t)
 {
-    fill_background(layer, 0x1A237E);
-
     float cycle = fmodf(t, 2.0f);
 
     for (int i = 0; i < 8; i++) {
@@ -690,8 +771,6 @@ static void draw_star_burst(lv_layer_t *layer, float t)
 
 static void draw_question_mark(lv_layer_t *layer, float t)
 {
-    fill_background(layer, 0xE3F2FD);
-
     float bounce = fabsf(sinf(t * 3)) * 20;
     float wobble = sinf(t * 2) * 5;
 
@@ -711,8 +790,6 @@ static void draw_question_mark(lv_layer_t *layer, float t)
 
 static void draw_exclamation(lv_layer_t *layer, float t)
 {
-    fill_background(layer, 0xFFEBEE);
-
     float pulse = 1.0f + 0.3f * sinf(t * 8);
     float shake = sinf(t * 20) * 3;
 
@@ -728,16 +805,17 @@ static void draw_exclamation(lv_layer_t *layer, float t)
     draw_circle(layer, cx, CENTER_Y + 40, dot_r, lv_color_hex(0xF44336), LV_OPA_COVER);
 }
 
-static void draw_checkmark(lv_layer_t *layer, float t)
+static void bg_checkmark(lv_layer_t *layer)
 {
-    fill_background(layer, 0xE8F5E9);
+    /* Circle background */
+    draw_circle(layer, CENTER_X, CENTER_Y, 60, lv_color_hex(0x4CAF50), LV_OPA_COVER);
+}
 
+static void draw_checkmark(lv_layer_t *layer, float t)
+{
     /* Draw-in animation */
     float progress = fminf(fmodf(t, 2.0f), 1.0f);
 
-    /* Circle background */
-    draw_circle(layer, CENTER_X, CENTER_Y, 60, lv_color_hex(0x4CAF50), LV_OPA_COVER);
-
     /* Checkmark */
     if (progress > 0) {
         int x1 = CENTER_X - 30, y1 = CENTER_Y;
@@ -773,8 +851,6 @@ static void draw_checkmark(lv_layer_t *layer, float t)
 
 static void draw_x_mark(lv_layer_t *layer, float t)
 {
-    fill_background(layer, 0xFFEBEE);
-
     float shake = sinf(t * 15) * 5;
     int cx = CENTER_X + (int)shake;
 
@@ -793,11 +869,14 @@ static void draw_x_mark(lv_layer_t *layer, float t)
  * Tech/Digital Animations
  *===========================================================================*/
 
-static void draw_loading_spinner(lv_layer_t *layer, float t)
+static int spinner_active(float t)
 {
-    fill_background(layer, 0x263238);
+    return ((int)(t * 8)) % 8;
+}
 
-    int active = ((int)(t * 8)) % 8;
+static void draw_loading_spinner(lv_layer_t *layer, float t)
+{
+    int active = spinner_active(t);
 
     for (int i = 0; i < 8; i++) {
         float angle = i * (M_PI / 4) - M_PI/2;
@@ -811,26 +890,27 @@ static void draw_loading_spinner(lv_layer_t *layer, float t)
     }
 }
 
-static void draw_progress_bar(lv_layer_t *layer, float t)
+static bool dirty_loading_spinner(float prev_t, float t, lv_area_t *area)
 {
-    fill_background(layer, 0x37474F);
+    return spinner_active(prev_t) != spinner_active(t);
+}
 
-    float progress = fmodf(t * 0.3f, 1.0f);
+#define PROGRESS_BAR_X  30
+#define PROGRESS_BAR_Y  (CENTER_Y - 15)
+#define PROGRESS_BAR_W  (SCREEN_WIDTH - 60)
+#define PROGRESS_BAR_H  30
 
-    /* Bar outline */
-    int bar_x = 30, bar_y = CENTER_Y - 15;
-    int bar_w = SCREEN_WIDTH - 60, bar_h = 30;
+static void bg_progress_bar(lv_layer_t *layer)
+{
+    int bar_x = PROGRESS_BAR_X, bar_y = PROGRESS_BAR_Y;
+    int bar_w = PROGRESS_BAR_W, bar_h = PROGRESS_BAR_H;
 
+    /* Bar outline */
     draw_filled_rect(layer, bar_x - 2, bar_y - 2, bar_w + 4, bar_h + 4,
                     lv_color_hex(0xFFFFFF), LV_OPA_COVER);
     draw_filled_rect(layer, bar_x, bar_y, bar_w, bar_h,
                     lv_color_hex(0x263238), LV_OPA_COVER);
 
-    /* Fill */
-    int fill_w = (int)(bar_w * progress);
-    draw_filled_rect(layer, bar_x, bar_y, fill_w, bar_h,
-                    lv_color_hex(0x2196F3), LV_OPA_COVER);
-
     /* Percentage text (simplified - just draw markers) */
     for (int i = 1; i < 4; i++) {
         int mark_x = bar_x + (bar_w * i / 4);
@@ -839,12 +919,20 @@ static void draw_progress_bar(lv_layer_t *layer, float t)
     }
 }
 
-static void draw_sound_waves(lv_layer_t *layer, float t)
+static void draw_progress_bar(lv_layer_t *layer, float t)
 {
-    fill_background(layer, 0x1B5E20);
+    float progress = fmodf(t * 0.3f, 1.0f);
 
+    /* Fill */
+    int fill_w = (int)(PROGRESS_BAR_W * progress);
+    draw_filled_rect(layer, PROGRESS_BAR_X, PROGRESS_BAR_Y, fill_w, PROGRESS_BAR_H,
+                    lv_color_hex(0x2196F3), LV_OPA_COVER);
+}
+
+static void draw_sound_waves(lv_layer_t *layer, float t)
+{
     /* Update bar targets */
-    for (int i = 0; i < 12; i++) {
+    for (int i = 0; s_step && i < 12; i++) {
         if (rand() % 5 == 0) {
             s_state.bar_targets[i] = 30 + (rand() % 100);
         }
@@ -872,11 +960,14 @@ static void draw_sound_waves(lv_layer_t *layer, float t)
     }
 }
 
-static void draw_wifi_signal(lv_layer_t *layer, float t)
+static int wifi_phase(float t)
 {
-    fill_background(layer, 0x1565C0);
+    return ((int)(t * 2)) % 4;
+}
 
-    int phase = ((int)(t * 2)) % 4;
+static void draw_wifi_signal(lv_layer_t *layer, float t)
+{
+    int phase = wifi_phase(t);
 
     /* Draw arcs based on phase */
     for (int i = 0; i < 3; i++) {
@@ -895,12 +986,13 @@ static void draw_wifi_signal(lv_layer_t *layer, float t)
     draw_circle(layer, CENTER_X, CENTER_Y + 50, 8, lv_color_hex(0xFFFFFF), LV_OPA_COVER);
 }
 
-static void draw_battery_charging(lv_layer_t *layer, float t)
+static bool dirty_wifi_signal(float prev_t, float t, lv_area_t *area)
 {
-    fill_background(layer, 0x263238);
-
-    float level = fmodf(t * 0.3f, 1.0f);
+    return wifi_phase(prev_t) != wifi_phase(t);
+}
 
+static void bg_battery_charging(lv_layer_t *layer)
+{
     /* Battery outline */
     int bx = CENTER_X - 50, by = CENTER_Y - 30;
     int bw = 100, bh = 60;
@@ -911,6 +1003,13 @@ static void draw_battery_charging(lv_layer_t *layer, float t)
 
     /* Terminal */
     draw_filled_rect(layer, bx + bw, by + 15, 8, 30, lv_color_hex(0xFFFFFF), LV_OPA_COVER);
+}
+
+static void draw_battery_charging(lv_layer_t *layer, float t)
+{
+    float level = fmodf(t * 0.3f, 1.0f);
+    int bx = CENTER_X - 50, by = CENTER_Y - 30;
+    int bw = 100, bh = 60;
 
     /* Fill level */
     int fill_w = (int)((bw - 10) * level);
@@ -928,11 +1027,9 @@ static void draw_battery_charging(lv_layer_t *layer, float t)
     }
 }
 
-static void draw_binary_code(lv_layer_t *layer, float t)
+static void step_binary_code(float t, float dt)
 {
-    fill_background(layer, 0x001100);
-
-    s_state.scroll_offset = fmodf(s_state.scroll_offset + 1, 20);
+    s_state.scroll_offset = fmodf(s_state.scroll_offset + BINARY_SCROLL_PX_S * dt, 20);
 
     /* Update random digits occasionally */
     if (rand() % 3 == 0) {
@@ -940,6 +1037,13 @@ static void draw_binary_code(lv_layer_t *layer, float t)
         int row = rand() % 10;
         s_state.binary_cols[col][row] = '0' + (rand() % 2);
     }
+}
+
+static void draw_binary_code(lv_layer_t *layer, float t)
+{
+    if (s_step) {
+        step_binary_code(t, s_dt);
+    }
 
     /* Draw columns */
     for (int col = 0; col < 6; col++) {
@@ -963,25 +1067,49 @@ static void draw_binary_code(lv_layer_t *layer, float t)
  * Nature/Organic Animations
  *===========================================================================*/
 
-static void draw_bouncing_ball(lv_layer_t *layer, float t)
+/**
+ * @brief Advance the ball by @p dt
+ *
+ * Free flight is integrated exactly and each bounce happens at the moment
+ * the ball reaches the floor, not at the next tick, so the path is the
+ * same at any tick rate.
+ */
+static void step_bouncing_ball(float t, float dt)
 {
-    fill_background(layer, 0xECEFF1);
+    while (dt > 0) {
+        float y = s_state.ball_y + s_state.ball_vy * dt + 0.5f * BALL_GRAVITY * dt * dt;
+        if (y <= BALL_FLOOR_Y) {
+            s_state.ball_y = y;
+            s_state.ball_vy += BALL_GRAVITY * dt;
+            return;
+        }
 
-    /* Physics simulation */
-    s_state.ball_vy += 500 * (1.0f / ANIM_FPS);  /* Gravity */
-    s_state.ball_y += s_state.ball_vy * (1.0f / ANIM_FPS);
+        /* Time to the floor: y + vy*h + g/2*h^2 = floor */
+        float vy = s_state.ball_vy;
+        float disc = vy * vy + 2 * BALL_GRAVITY * (BALL_FLOOR_Y - s_state.ball_y);
+        float h = (disc > 0) ? (-vy + sqrtf(disc)) / BALL_GRAVITY : 0;
+        if (h > dt) h = dt;
+        if (h < 0) h = 0;
 
-    /* Bounce */
-    if (s_state.ball_y > SCREEN_HEIGHT - 60) {
-        s_state.ball_y = SCREEN_HEIGHT - 60;
-        s_state.ball_vy = -s_state.ball_vy * 0.8f;
+        /* Bounce */
+        s_state.ball_y = BALL_FLOOR_Y;
+        s_state.ball_vy = -(vy + BALL_GRAVITY * h) * 0.8f;
         if (fabsf(s_state.ball_vy) < 50) {
             s_state.ball_vy = -400;  /* Reset */
         }
+        dt -= h;
+    }
+}
+
+static void draw_bouncing_ball(lv_layer_t *layer, float t)
+{
+    /* Physics simulation */
+    if (s_step) {
+        step_bouncing_ball(t, s_dt);
     }
 
     /* Shadow */
-    float shadow_scale = 1.0f - (SCREEN_HEIGHT - 60 - s_state.ball_y) / 200.0f;
+    float shadow_scale = 1.0f - (BALL_FLOOR_Y - s_state.ball_y) / 200.0f;
     if (shadow_scale > 0) {
         int shadow_r = (int)(25 * shadow_scale);
         draw_circle(layer, CENTER_X, SCREEN_HEIGHT - 30, shadow_r,
@@ -1032,8 +1160,6 @@ static void draw_ocean_waves(lv_layer_t *layer, float t)
 
 static void draw_butterfly(lv_layer_t *layer, float t)
 {
-    fill_background(layer, 0xE8F5E9);
-
     /* Flight path */
     float path_x = CENTER_X + sinf(t * 0.7f) * 60;
     float path_y = CENTER_Y + sinf(t * 1.1f) * 40;
@@ -1065,69 +1191,87 @@ static void draw_butterfly(lv_layer_t *layer, float t)
               (int)path_x + 10, (int)path_y - 25, lv_color_hex(0x3E2723), 1);
 }
 
-static void draw_fireworks(lv_layer_t *layer, float t)
+static bool dirty_butterfly(float prev_t, float t, lv_area_t *area)
 {
-    fill_background(layer, 0x0D1B2A);
+    int x = (int)(CENTER_X + sinf(t * 0.7f) * 60);
+    int y = (int)(CENTER_Y + sinf(t * 1.1f) * 40);
+
+    /* Fully open wings reach 25 + 10 + 12 px to each side */
+    lv_area_set(area, x - 48, y - 26, x + 48, y + 28);
+    return true;
+}
 
+#define FIREWORK_SPARKS     30
+#define FIREWORK_CYCLE_S    3.0f
+#define FIREWORK_LAUNCH_VY  -300.0f         /* px/s */
+#define FIREWORK_GRAVITY    200.0f          /* px/s^2 */
+
+static const particle_emitter_t s_firework_sparks = {
+    .bounds = AREA(-5, -5, SCREEN_WIDTH + 4, SCREEN_HEIGHT + 4),
+    .radial = true,
+    .speed_min = 50, .speed_max = 200,
+    .ay = 100,                              /* Gravity */
+    .life_min_ms = 2000, .life_max_ms = 2000,
+    .shape = PARTICLE_SHAPE_DISC,
+    .size_min = 3, .size_max = 3,
+    .colors = { 0xFF5722, 0xFFEB3B, 0xE91E63, 0x00BCD4 }, .color_count = 4,
+    .opa = LV_OPA_COVER,
+    .fade = true,
+};
+static const anim_particles_t s_firework_particles = { &s_firework_sparks, 2 * FIREWORK_SPARKS, 0 };
+
+/**
+ * @brief Launch, fly and burst the rocket
+ *
+ * A rocket leaves at the start of its cycle even when the first tick of
+ * the cycle is late, flies an exact parabola and bursts at its apex.
+ */
+static void step_fireworks(float t, float dt)
+{
     /* Launch cycle */
-    float cycle = fmodf(t, 3.0f);
+    float cycle = fmodf(t, FIREWORK_CYCLE_S);
 
     if (cycle < 1.0f && !s_state.launching) {
-        /* Start new launch */
+        /* Start new launch, as of the cycle start */
         s_state.launching = true;
         s_state.launch_x = 40 + (rand() % 160);
         s_state.launch_y = SCREEN_HEIGHT;
-        s_state.launch_vy = -300;
-        s_state.spark_count = 0;
+        s_state.launch_vy = FIREWORK_LAUNCH_VY;
+        dt = cycle;
     }
 
     if (s_state.launching) {
         /* Update launch position */
-        s_state.launch_vy += 200 * (1.0f / ANIM_FPS);
-        s_state.launch_y += s_state.launch_vy * (1.0f / ANIM_FPS);
-
-        /* Draw trail */
-        draw_circle(layer, (int)s_state.launch_x, (int)s_state.launch_y, 3,
-                   lv_color_hex(0xFFFFFF), LV_OPA_COVER);
+        s_state.launch_y += s_state.launch_vy * dt + 0.5f * FIREWORK_GRAVITY * dt * dt;
+        s_state.launch_vy += FIREWORK_GRAVITY * dt;
 
-        /* Explode when velocity reverses */
+        /* Explode when velocity reverses, at the top of the arc */
         if (s_state.launch_vy > 0) {
             s_state.launching = false;
-            s_state.spark_count = 30;
-
-            /* Create sparks */
-            for (int i = 0; i < 30; i++) {
-                float angle = (float)(rand() % 360) * M_PI / 180;
-                float speed = 50 + (rand() % 150);
-                s_state.sparks[i].x = s_state.launch_x;
-                s_state.sparks[i].y = s_state.launch_y;
-                s_state.sparks[i].vx = cosf(angle) * speed;
-                s_state.sparks[i].vy = sinf(angle) * speed;
-                s_state.sparks[i].life = 1.0f;
-            }
+            s_state.launch_y -= s_state.launch_vy * s_state.launch_vy / (2 * FIREWORK_GRAVITY);
+            particle_system_emit(&s_particles, FIREWORK_SPARKS,
+                                 (int)s_state.launch_x, (int)s_state.launch_y);
         }
     }
+}
 
-    /* Update and draw sparks */
-    for (int i = 0; i < s_state.spark_count; i++) {
-        if (s_state.sparks[i].life > 0) {
-            s_state.sparks[i].x += s_state.sparks[i].vx * (1.0f / ANIM_FPS);
-            s_state.sparks[i].y += s_state.sparks[i].vy * (1.0f / ANIM_FPS);
-            s_state.sparks[i].vy += 100 * (1.0f / ANIM_FPS);  /* Gravity */
-            s_state.sparks[i].life -= 0.02f;
+static void draw_fireworks(lv_layer_t *layer, float t)
+{
+    if (s_step) {
+        step_fireworks(t, s_dt);
+    }
 
-            lv_opa_t opa = (lv_opa_t)(s_state.sparks[i].life * 255);
-            uint32_t colors[] = {0xFF5722, 0xFFEB3B, 0xE91E63, 0x00BCD4};
-            draw_circle(layer, (int)s_state.sparks[i].x, (int)s_state.sparks[i].y,
-                       3, lv_color_hex(colors[i % 4]), opa);
-        }
+    if (s_state.launching) {
+        /* Draw trail */
+        draw_circle(layer, (int)s_state.launch_x, (int)s_state.launch_y, 3,
+                   lv_color_hex(0xFFFFFF), LV_OPA_COVER);
     }
+
+    particle_system_draw(&s_particles, layer);
 }
 
-static void draw_campfire(lv_layer_t *layer, float t)
+static void bg_campfire(lv_layer_t *layer)
 {
-    fill_background(layer, 0x1A1A2E);
-
     /* Ground */
     draw_filled_rect(layer, 0, SCREEN_HEIGHT - 40, SCREEN_WIDTH, 40,
                     lv_color_hex(0x3E2723), LV_OPA_COVER);
@@ -1139,13 +1283,16 @@ static void draw_campfire(lv_layer_t *layer, float t)
                     lv_color_hex(0x5D4037), LV_OPA_COVER);
     draw_filled_rect(layer, CENTER_X - 30, SCREEN_HEIGHT - 60, 60, 12,
                     lv_color_hex(0x4E342E), LV_OPA_COVER);
+}
 
+static void draw_campfire(lv_layer_t *layer, float t)
+{
     /* Flames */
     uint32_t flame_colors[] = {0xFFEB3B, 0xFF9800, 0xFF5722, 0xF44336};
 
     for (int i = 0; i < 5; i++) {
-        float flicker = sinf(t * 10 + i * 2) * 10 + (rand() % 5);
-        int flame_h = 50 + (int)flicker + (rand() % 20);
+        float flicker = sinf(t * 10 + i * 2) * 10 + tick_noise(t, i, 5);
+        int flame_h = 50 + (int)flicker + tick_noise(t, i + 5, 20);
         int flame_x = CENTER_X - 30 + i * 15;
         int flame_y = SCREEN_HEIGHT - 60 - flame_h;
 
@@ -1168,53 +1315,47 @@ static void draw_campfire(lv_layer_t *layer, float t)
     }
 }
 
+static const particle_emitter_t s_bubbles = {
+    .spawn = AREA(0, SCREEN_HEIGHT + 10, SCREEN_WIDTH - 1, SCREEN_HEIGHT + 30),
+    .bounds = AREA(-30, 20, SCREEN_WIDTH + 29, SCREEN_HEIGHT + 120),  /* Pop near the top */
+    .respawn = true,
+    .vy_min = -100, .vy_max = -40,
+    .shape = PARTICLE_SHAPE_DISC,
+    .size_min = 8, .size_max = 24,
+    .colors = { 0x81D4FA }, .color_count = 1,
+    .opa = LV_OPA_60,
+    .highlight_opa = LV_OPA_80,
+    .freq_min_mhz = 250, .freq_max_mhz = 400,   /* Wobble */
+    .wobble_px = 4,
+};
+static const anim_particles_t s_bubble_particles = { &s_bubbles, 15, 15 };
+
 static void draw_bubbles(lv_layer_t *layer, float t)
 {
-    fill_background(layer, 0x0288D1);
-
-    /* Initialize bubbles */
-    if (s_state.particle_count == 0) {
-        s_state.particle_count = 15;
-        for (int i = 0; i < 15; i++) {
-            s_state.particles[i].x = rand() % SCREEN_WIDTH;
-            s_state.particles[i].y = SCREEN_HEIGHT + (rand() % 100);
-            s_state.particles[i].speed = 40 + (rand() % 60);
-        }
-    }
-
-    for (int i = 0; i < 15; i++) {
-        /* Wobble */
-        s_state.particles[i].x += sinf(t * 2 + i) * 0.3f;
-        s_state.particles[i].y -= s_state.particles[i].speed * (1.0f / ANIM_FPS);
-
-        /* Pop and reset at top */
-        if (s_state.particles[i].y < 20) {
-            s_state.particles[i].y = SCREEN_HEIGHT + 20;
-            s_state.particles[i].x = rand() % SCREEN_WIDTH;
-        }
-
-        int r = 8 + (i % 5) * 4;
-        int x = (int)s_state.particles[i].x;
-        int y = (int)s_state.particles[i].y;
-
-        /* Bubble body */
-        draw_circle(layer, x, y, r, lv_color_hex(0x81D4FA), LV_OPA_60);
-        /* Highlight */
-        draw_circle(layer, x - r/3, y - r/3, r/3, lv_color_hex(0xFFFFFF), LV_OPA_80);
-    }
+    particle_system_draw(&s_particles, layer);
 }
 
 /*===========================================================================
  * Dashboard/Automotive Animations
  *===========================================================================*/
 
-static void draw_speedometer(lv_layer_t *layer, float t)
+#define SPEEDO_CX   CENTER_X
+#define SPEEDO_CY   (CENTER_Y + 30)
+#define SPEEDO_R    90
+
+static void speedometer_needle(float t, int *nx, int *ny)
 {
-    fill_background(layer, 0x212121);
+    float speed = (1.0f + sinf(t * 0.5f)) * 0.5f;  /* 0-1 */
+    float needle_angle = (135 + speed * 270) * M_PI / 180;
+    *nx = SPEEDO_CX + (int)(cosf(needle_angle) * (SPEEDO_R - 30));
+    *ny = SPEEDO_CY + (int)(sinf(needle_angle) * (SPEEDO_R - 30));
+}
 
-    int gauge_cx = CENTER_X;
-    int gauge_cy = CENTER_Y + 30;
-    int gauge_r = 90;
+static void bg_speedometer(lv_layer_t *layer)
+{
+    int gauge_cx = SPEEDO_CX;
+    int gauge_cy = SPEEDO_CY;
+    int gauge_r = SPEEDO_R;
 
     /* Gauge background */
     draw_arc(layer, gauge_cx, gauge_cy, gauge_r, 135, 405, 20,
@@ -1233,50 +1374,84 @@ static void draw_speedometer(lv_layer_t *layer, float t)
         int y2 = gauge_cy + (int)(sinf(angle) * (gauge_r - 5));
         draw_line(layer, x1, y1, x2, y2, lv_color_hex(0xFFFFFF), 2);
     }
+}
 
+static void draw_speedometer(lv_layer_t *layer, float t)
+{
     /* Needle */
-    float speed = (1.0f + sinf(t * 0.5f)) * 0.5f;  /* 0-1 */
-    float needle_angle = (135 + speed * 270) * M_PI / 180;
-    int nx = gauge_cx + (int)(cosf(needle_angle) * (gauge_r - 30));
-    int ny = gauge_cy + (int)(sinf(needle_angle) * (gauge_r - 30));
+    int nx, ny;
+    speedometer_needle(t, &nx, &ny);
 
-    draw_line(layer, gauge_cx, gauge_cy, nx, ny, lv_color_hex(0xF44336), 4);
-    draw_circle(layer, gauge_cx, gauge_cy, 10, lv_color_hex(0xFFFFFF), LV_OPA_COVER);
+    draw_line(layer, SPEEDO_CX, SPEEDO_CY, nx, ny, lv_color_hex(0xF44336), 4);
+    draw_circle(layer, SPEEDO_CX, SPEEDO_CY, 10, lv_color_hex(0xFFFFFF), LV_OPA_COVER);
 }
 
-static void draw_fuel_gauge(lv_layer_t *layer, float t)
+static bool dirty_speedometer(float prev_t, float t, lv_area_t *area)
 {
-    fill_background(layer, 0x212121);
+    int nx, ny;
+    speedometer_needle(t, &nx, &ny);
 
-    int gauge_cx = CENTER_X;
-    int gauge_cy = CENTER_Y + 40;
-    int gauge_r = 70;
-
-    /* Gauge arc */
-    draw_arc(layer, gauge_cx, gauge_cy, gauge_r, 180, 360, 15,
-             lv_color_hex(0x424242), LV_OPA_COVER);
+    lv_area_set(area, SPEEDO_CX, SPEEDO_CY, SPEEDO_CX, SPEEDO_CY);
+    area_add_point(area, nx, ny);
+    lv_area_increase(area, 11, 11);     /* Hub radius */
+    return true;
+}
 
-    /* E and F labels (using circles as markers) */
-    draw_circle(layer, gauge_cx - 70, gauge_cy, 6, lv_color_hex(0xF44336), LV_OPA_COVER);
-    draw_circle(layer, gauge_cx + 70, gauge_cy, 6, lv_color_hex(0x4CAF50), LV_OPA_COVER);
+#define FUEL_CX     CENTER_X
+#define FUEL_CY     (CENTER_Y + 40)
+#define FUEL_R      70
 
+static float fuel_needle(float t, int *nx, int *ny)
+{
     /* Fuel level - oscillate */
     float level = 0.3f + 0.5f * (1.0f + sinf(t * 0.3f)) / 2.0f;
     float needle_angle = (180 + level * 180) * M_PI / 180;
 
-    int nx = gauge_cx + (int)(cosf(needle_angle) * (gauge_r - 15));
-    int ny = gauge_cy + (int)(sinf(needle_angle) * (gauge_r - 15));
+    *nx = FUEL_CX + (int)(cosf(needle_angle) * (FUEL_R - 15));
+    *ny = FUEL_CY + (int)(sinf(needle_angle) * (FUEL_R - 15));
+    return level;
+}
+
+static void bg_fuel_gauge(lv_layer_t *layer)
+{
+    /* Gauge arc */
+    draw_arc(layer, FUEL_CX, FUEL_CY, FUEL_R, 180, 360, 15,
+             lv_color_hex(0x424242), LV_OPA_COVER);
+
+    /* E and F labels (using circles as markers) */
+    draw_circle(layer, FUEL_CX - 70, FUEL_CY, 6, lv_color_hex(0xF44336), LV_OPA_COVER);
+    draw_circle(layer, FUEL_CX + 70, FUEL_CY, 6, lv_color_hex(0x4CAF50), LV_OPA_COVER);
+}
+
+static void draw_fuel_gauge(lv_layer_t *layer, float t)
+{
+    int nx, ny;
+    float level = fuel_needle(t, &nx, &ny);
 
     lv_color_t needle_color = (level < 0.2f) ? lv_color_hex(0xF44336) : lv_color_hex(0xFF9800);
-    draw_line(layer, gauge_cx, gauge_cy, nx, ny, needle_color, 4);
-    draw_circle(layer, gauge_cx, gauge_cy, 8, lv_color_hex(0xFFFFFF), LV_OPA_COVER);
+    draw_line(layer, FUEL_CX, FUEL_CY, nx, ny, needle_color, 4);
+    draw_circle(layer, FUEL_CX, FUEL_CY, 8, lv_color_hex(0xFFFFFF), LV_OPA_COVER);
 }
 
-static void draw_turn_signal(lv_layer_t *layer, float t, bool left)
+static bool dirty_fuel_gauge(float prev_t, float t, lv_area_t *area)
 {
-    fill_background(layer, 0x212121);
+    int nx, ny;
+    fuel_needle(t, &nx, &ny);
 
-    bool on = fmodf(t, 1.0f) < 0.5f;
+    lv_area_set(area, FUEL_CX, FUEL_CY, FUEL_CX, FUEL_CY);
+    area_add_point(area, nx, ny);
+    lv_area_increase(area, 9, 9);       /* Hub radius */
+    return true;
+}
+
+static bool turn_signal_on(float t)
+{
+    return fmodf(t, 1.0f) < 0.5f;
+}
+
+static void draw_turn_signal(lv_layer_t *layer, float t, bool left)
+{
+    bool on = turn_signal_on(t);
 
     int arrow_x = CENTER_X + (left ? -30 : 30);
     int dir = left ? -1 : 1;
@@ -1300,11 +1475,19 @@ static void draw_turn_right(lv_layer_t *layer, float t)
     draw_turn_signal(layer, t, false);
 }
 
-static void draw_hazard_lights(lv_layer_t *layer, float t)
+static bool dirty_turn_signal(float prev_t, float t, lv_area_t *area)
 {
-    fill_background(layer, 0x212121);
+    return turn_signal_on(prev_t) != turn_signal_on(t);
+}
+
+static bool hazard_on(float t)
+{
+    return fmodf(t, 0.6f) < 0.3f;
+}
 
-    bool on = fmodf(t, 0.6f) < 0.3f;
+static void draw_hazard_lights(lv_layer_t *layer, float t)
+{
+    bool on = hazard_on(t);
     lv_color_t color = on ? lv_color_hex(0xFF9800) : lv_color_hex(0x5D4037);
     lv_opa_t opa = on ? LV_OPA_COVER : LV_OPA_30;
 
@@ -1321,19 +1504,29 @@ static void draw_hazard_lights(lv_layer_t *layer, float t)
     draw_line(layer, ax, CENTER_Y - 20, ax, CENTER_Y + 20, color, 6);
 }
 
-static void draw_gear_display(lv_layer_t *layer, float t)
+static bool dirty_hazard_lights(float prev_t, float t, lv_area_t *area)
 {
-    fill_background(layer, 0x0D1B2A);
+    return hazard_on(prev_t) != hazard_on(t);
+}
 
-    /* Update gear periodically */
-    s_state.gear_timer += 1.0f / ANIM_FPS;
-    if (s_state.gear_timer > 2.0f) {
-        s_state.gear_timer = 0;
-        s_state.current_gear = (s_state.current_gear % 6) + 1;
-    }
+/* Neutral (0) for the first 2 s, then shifts 1-6 every 2 s */
+static int gear_at(float t)
+{
+    int shifts = (int)(t / 2.0f);
+    return (shifts == 0) ? 0 : ((shifts - 1) % 6) + 1;
+}
 
+static void bg_gear_display(lv_layer_t *layer)
+{
+    /* Rectangular approximation of the digit */
+    draw_filled_rect(layer, CENTER_X - 20, CENTER_Y - 60, 40, 80,
+                     lv_color_hex(0x1565C0), LV_OPA_COVER);
+}
+
+static void draw_gear_display(lv_layer_t *layer, float t)
+{
     /* Draw current gear number large */
-    int gear = s_state.current_gear;
+    int gear = gear_at(t);
 
     /* Gear indicator circles */
     for (int i = 1; i <= 6; i++) {
@@ -1351,9 +1544,6 @@ static void draw_gear_display(lv_layer_t *layer, float t)
     /* Simplified 7-segment display */
     lv_color_t on_color = lv_color_hex(0xFFFFFF);
 
-    /* Draw rectangular approximation of number */
-    draw_filled_rect(layer, gx - 20, gy - 40, 40, 80, lv_color_hex(0x1565C0), LV_OPA_COVER);
-
     /* Overlay with gear number pattern (simplified) */
     switch (gear) {
         case 1:
@@ -1394,62 +1584,243 @@ static void draw_gear_display(lv_layer_t *layer, float t)
     }
 }
 
+static bool dirty_gear_display(float prev_t, float t, lv_area_t *area)
+{
+    return gear_at(prev_t) != gear_at(t);
+}
+
 /*===========================================================================
- * Animation Draw Function Table
+ * Animation Descriptor Table
  *===========================================================================*/
 
 typedef void (*draw_func_t)(lv_layer_t *layer, float t);
+typedef void (*background_func_t)(lv_layer_t *layer);
 
-static const draw_func_t s_draw_funcs[GALLERY_ANIM_MAX] = {
+/**
+ * Narrows the redraw area for time t. *area arrives holding the
+ * descriptor's motion_area; return false if the picture at t is identical
+ * to the one at prev_t.
+ */
+typedef bool (*dirty_func_t)(float prev_t, float t, lv_area_t *area);
+
+typedef struct {
+    draw_func_t draw;               /* Moving content */
+    uint32_t bg_color;              /* Solid fill under everything, or BG_NONE */
+    background_func_t background;   /* Static layer over bg_color (NULL = none) */
+    lv_area_t bg_area;              /* Bounds of the static layer */
+    lv_area_t motion_area;          /* Where moving content can appear (all 0 = whole screen) */
+    dirty_func_t dirty;             /* Optional refinement of motion_area */
+    const anim_particles_t *particles;  /* Particle system (NULL = none) */
+} anim_desc_t;
+
+static const anim_desc_t s_anims[GALLERY_ANIM_MAX] = {
     /* Abstract Geometric */
-    draw_pulsing_rings,
-    draw_spiral_galaxy,
-    draw_heartbeat,
-    draw_breathing_orb,
-    draw_matrix_rain,
-    draw_radar_sweep,
+    [GALLERY_ANIM_PULSING_RINGS] = { draw_pulsing_rings, 0x0D1B2A, NULL, NO_AREA,
+        AREA(CENTER_X - 131, CENTER_Y - 131, CENTER_X + 131, CENTER_Y + 131), NULL },
+    [GALLERY_ANIM_SPIRAL_GALAXY] = { draw_spiral_galaxy, 0x0D0221, NULL, NO_AREA,
+        AREA(CENTER_X - 101, CENTER_Y - 101, CENTER_X + 101, CENTER_Y + 101), NULL },
+    [GALLERY_ANIM_HEARTBEAT] = { draw_heartbeat, 0x001100, bg_heartbeat, SCREEN_AREA,
+        NO_AREA, NULL },
+    [GALLERY_ANIM_BREATHING_ORB] = { draw_breathing_orb, 0x01579B, NULL, NO_AREA,
+        NO_AREA, dirty_breathing_orb },
+    [GALLERY_ANIM_MATRIX_RAIN] = { draw_matrix_rain, 0x000800, NULL, NO_AREA,
+        NO_AREA, NULL },
+    [GALLERY_ANIM_RADAR_SWEEP] = { draw_radar_sweep, 0x001a00, bg_radar_sweep,
+        AREA(0, CENTER_Y - 121, SCREEN_WIDTH - 1, CENTER_Y + 121),
+        NO_AREA, dirty_radar_sweep },
 
     /* Weather Effects */
-    draw_rain_storm,
-    draw_snowfall,
-    draw_sunshine,
-    draw_lightning,
-    draw_starry_night,
-    draw_aurora,
+    [GALLERY_ANIM_RAIN_STORM] = { draw_rain_storm, 0x1A237E, NULL, NO_AREA,
+        NO_AREA, NULL, &s_rain_particles },
+    [GALLERY_ANIM_SNOWFALL] = { draw_snowfall, 0x1A237E, NULL, NO_AREA,
+        NO_AREA, NULL, &s_snow_particles },
+    [GALLERY_ANIM_SUNSHINE] = { draw_sunshine, 0x87CEEB, NULL, NO_AREA,
+        AREA(CENTER_X - 103, CENTER_Y - 103, CENTER_X + 103, CENTER_Y + 103), NULL },
+    [GALLERY_ANIM_LIGHTNING] = { draw_lightning, BG_NONE, NULL, NO_AREA,
+        NO_AREA, dirty_lightning },
+    [GALLERY_ANIM_STARRY_NIGHT] = { draw_starry_night, 0x0D1B2A, NULL, NO_AREA,
+        NO_AREA, NULL, &s_star_particles },
+    [GALLERY_ANIM_AURORA] = { draw_aurora, 0x0D1B2A, NULL, NO_AREA,
+        AREA(0, 40, SCREEN_WIDTH - 1, 245), NULL },
 
     /* Emoji/Symbols */
-    draw_floating_hearts,
-    draw_star_burst,
-    draw_question_mark,
-    draw_exclamation,
-    draw_checkmark,
-    draw_x_mark,
+    [GALLERY_ANIM_FLOATING_HEARTS] = { draw_floating_hearts, 0xFCE4EC, NULL, NO_AREA,
+        NO_AREA, NULL },
+    [GALLERY_ANIM_STAR_BURST] = { draw_star_burst, 0x1A237E, NULL, NO_AREA,
+        NO_AREA, NULL },
+    [GALLERY_ANIM_QUESTION_MARK] = { draw_question_mark, 0xE3F2FD, NULL, NO_AREA,
+        AREA(CENTER_X - 31, CENTER_Y - 66, CENTER_X + 31, CENTER_Y + 52), NULL },
+    [GALLERY_ANIM_EXCLAMATION] = { draw_exclamation, 0xFFEBEE, NULL, NO_AREA,
+        AREA(CENTER_X - 14, CENTER_Y - 60, CENTER_X + 14, CENTER_Y + 51), NULL },
+    [GALLERY_ANIM_CHECKMARK] = { draw_checkmark, 0xE8F5E9, bg_checkmark,
+        AREA(CENTER_X - 61, CENTER_Y - 61, CENTER_X + 61, CENTER_Y + 61),
+        AREA(CENTER_X - 85, CENTER_Y - 85, CENTER_X + 85, CENTER_Y + 85), NULL },
+    [GALLERY_ANIM_X_MARK] = { draw_x_mark, 0xFFEBEE, NULL, NO_AREA,
+        AREA(CENTER_X - 66, CENTER_Y - 61, CENTER_X + 66, CENTER_Y + 61), NULL },
 
     /* Tech/Digital */
-    draw_loading_spinner,
-    draw_progress_bar,
-    draw_sound_waves,
-    draw_wifi_signal,
-    draw_battery_charging,
-    draw_binary_code,
+    [GALLERY_ANIM_LOADING_SPINNER] = { draw_loading_spinner, 0x263238, NULL, NO_AREA,
+        AREA(CENTER_X - 61, CENTER_Y - 61, CENTER_X + 61, CENTER_Y + 61), dirty_loading_spinner },
+    [GALLERY_ANIM_PROGRESS_BAR] = { draw_progress_bar, 0x37474F, bg_progress_bar,
+        AREA(PROGRESS_BAR_X - 2, PROGRESS_BAR_Y - 2, PROGRESS_BAR_X + PROGRESS_BAR_W + 1,
+             PROGRESS_BAR_Y + PROGRESS_BAR_H + 11),
+        AREA(PROGRESS_BAR_X, PROGRESS_BAR_Y, PROGRESS_BAR_X + PROGRESS_BAR_W - 1,
+             PROGRESS_BAR_Y + PROGRESS_BAR_H - 1), NULL },
+    [GALLERY_ANIM_SOUND_WAVES] = { draw_sound_waves, 0x1B5E20, NULL, NO_AREA,
+        AREA(0, SCREEN_HEIGHT - 181, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 46), NULL },
+    [GALLERY_ANIM_WIFI_SIGNAL] = { draw_wifi_signal, 0x1565C0, NULL, NO_AREA,
+        AREA(CENTER_X - 57, CENTER_Y - 31, CENTER_X + 57, CENTER_Y + 59), dirty_wifi_signal },
+    [GALLERY_ANIM_BATTERY_CHARGING] = { draw_battery_charging, 0x263238, bg_battery_charging,
+        AREA(CENTER_X - 50, CENTER_Y - 30, CENTER_X + 57, CENTER_Y + 29),
+        AREA(CENTER_X - 45, CENTER_Y - 25, CENTER_X + 44, CENTER_Y + 24), NULL },
+    [GALLERY_ANIM_BINARY_CODE] = { draw_binary_code, 0x001100, NULL, NO_AREA,
+        NO_AREA, NULL },
 
     /* Nature/Organic */
-    draw_bouncing_ball,
-    draw_ocean_waves,
-    draw_butterfly,
-    draw_fireworks,
-    draw_campfire,
-    draw_bubbles,
+    [GALLERY_ANIM_BOUNCING_BALL] = { draw_bouncing_ball, 0xECEFF1, NULL, NO_AREA,
+        AREA(CENTER_X - 40, 0, CENTER_X + 40, SCREEN_HEIGHT - 1), NULL },
+    [GALLERY_ANIM_OCEAN_WAVES] = { draw_ocean_waves, BG_NONE, NULL, NO_AREA,
+        AREA(0, CENTER_Y + 4, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1), NULL },
+    [GALLERY_ANIM_BUTTERFLY] = { draw_butterfly, 0xE8F5E9, NULL, NO_AREA,
+        NO_AREA, dirty_butterfly },
+    [GALLERY_ANIM_FIREWORKS] = { draw_fireworks, 0x0D1B2A, NULL, NO_AREA,
+        NO_AREA, NULL, &s_firework_particles },
+    [GALLERY_ANIM_CAMPFIRE] = { draw_campfire, 0x1A1A2E, bg_campfire,
+        AREA(0, SCREEN_HEIGHT - 60, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1),
+        AREA(CENTER_X - 42, 0, CENTER_X + 42, SCREEN_HEIGHT - 48), NULL },
+    [GALLERY_ANIM_BUBBLES] = { draw_bubbles, 0x0288D1, NULL, NO_AREA,
+        NO_AREA, NULL, &s_bubble_particles },
 
     /* Dashboard/Automotive */
-    draw_speedometer,
-    draw_fuel_gauge,
-    draw_turn_left,
-    draw_turn_right,
-    draw_hazard_lights,
-    draw_gear_display,
+    [GALLERY_ANIM_SPEEDOMETER] = { draw_speedometer, 0x212121, bg_speedometer,
+        AREA(SPEEDO_CX - SPEEDO_R, SPEEDO_CY - SPEEDO_R, SPEEDO_CX + SPEEDO_R, SPEEDO_CY + 65),
+        NO_AREA, dirty_speedometer },
+    [GALLERY_ANIM_FUEL_GAUGE] = { draw_fuel_gauge, 0x212121, bg_fuel_gauge,
+        AREA(FUEL_CX - 76, FUEL_CY - FUEL_R, FUEL_CX + 76, FUEL_CY + 7),
+        NO_AREA, dirty_fuel_gauge },
+    [GALLERY_ANIM_TURN_LEFT] = { draw_turn_left, 0x212121, NULL, NO_AREA,
+        AREA(CENTER_X - 75, CENTER_Y - 45, CENTER_X - 25, CENTER_Y + 45), dirty_turn_signal },
+    [GALLERY_ANIM_TURN_RIGHT] = { draw_turn_right, 0x212121, NULL, NO_AREA,
+        AREA(CENTER_X + 25, CENTER_Y - 45, CENTER_X + 75, CENTER_Y + 45), dirty_turn_signal },
+    [GALLERY_ANIM_HAZARD_LIGHTS] = { draw_hazard_lights, 0x212121, NULL, NO_AREA,
+        AREA(CENTER_X - 95, CENTER_Y - 34, CENTER_X + 95, CENTER_Y + 34), dirty_hazard_lights },
+    [GALLERY_ANIM_GEAR_DISPLAY] = { draw_gear_display, 0x0D1B2A, bg_gear_display,
+        AREA(CENTER_X - 20, CENTER_Y - 60, CENTER_X + 19, CENTER_Y + 19),
+        AREA(30, CENTER_Y - 55, 210, SCREEN_HEIGHT - 40), dirty_gear_display },
 };
 
+static bool area_is_set(const lv_area_t *area)
+{
+    return area->x2 != 0 || area->y2 != 0;
+}
+
+/*===========================================================================
+ * Static Background Cache
+ *===========================================================================*/
+
+static void bg_cache_free(void)
+{
+    s_bg_anim = GALLERY_ANIM_MAX;
+    if (s_bg.data == NULL) return;
+
+    lv_image_cache_drop(&s_bg.img);
+    heap_caps_free(s_bg.data);
+    memset(&s_bg, 0, sizeof(s_bg));
+}
+
+/**
+ * @brief Render the static layer of @p anim_id into an RGB565 bitmap
+ *
+ * Called outside of a display refresh. Leaves the cache empty (vector
+ * fallback) if the layer's bounding box exceeds the budget, or if taking
+ * it would leave less than BG_CACHE_KEEP_FREE of internal RAM.
+ */
+static void bg_cache_build(gallery_anim_id_t anim_id)
+{
+    const anim_desc_t *desc = &s_anims[anim_id];
+
+    bg_cache_free();
+    s_bg_anim = anim_id;
+    if (desc->background == NULL || desc->bg_color == BG_NONE) return;
+
+    lv_area_t area = desc->bg_area;     /* Declared within the screen */
+    int32_t w = lv_area_get_width(&area);
+    int32_t h = lv_area_get_height(&area);
+    uint32_t stride = (uint32_t)w * 2;
+    uint32_t bytes = stride * h;
+    if (bytes > BG_CACHE_BUDGET || lv_display_get_default() == NULL) return;
+    if (heap_caps_get_free_size(MALLOC_CAP_INTERNAL) < bytes + BG_CACHE_KEEP_FREE) {
+        ESP_LOGD(TAG, "Heap low, %ldx%ld background drawn as vectors", (long)w, (long)h);
+        return;
+    }
+
+    uint8_t *data = heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (data == NULL) {
+        ESP_LOGW(TAG, "No memory for %ldx%ld background", (long)w, (long)h);
+        return;
+    }
+
+    lv_draw_buf_t buf;
+    lv_draw_buf_init(&buf, w, h, LV_COLOR_FORMAT_RGB565, stride, data, bytes);
+
+    lv_layer_t layer;
+    memset(&layer, 0, sizeof(layer));
+    layer.draw_buf = &buf;
+    layer.color_format = LV_COLOR_FORMAT_RGB565;
+    layer.buf_area = area;
+    layer._clip_area = area;
+    layer.phy_clip_area = area;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    lv_matrix_identity(&layer.matrix);
+#endif
+
+    fill_background(&layer, desc->bg_color);
+    desc->background(&layer);
+    bsp_display_finish_layer(&layer);
+
+    s_bg.data = data;
+    s_bg.area = area;
+    s_bg.img.header.magic = LV_IMAGE_HEADER_MAGIC;
+    s_bg.img.header.cf = LV_COLOR_FORMAT_RGB565;
+    s_bg.img.header.w = w;
+    s_bg.img.header.h = h;
+    s_bg.img.header.stride = stride;
+    s_bg.img.data_size = bytes;
+    s_bg.img.data = data;
+    s_stats[anim_id].bg_cache_bytes = bytes;
+
+    ESP_LOGD(TAG, "Cached %s background %ldx%ld (%lu bytes)", s_anim_info[anim_id].name,
+             (long)w, (long)h, (unsigned long)bytes);
+}
+
+/*===========================================================================
+ * Particles
+ *===========================================================================*/
+
+static void particles_free(void)
+{
+    s_particles_anim = GALLERY_ANIM_MAX;
+    particle_system_deinit(&s_particles);
+}
+
+/**
+ * @brief Create and populate the particle system of @p anim_id, if any
+ */
+static void particles_build(gallery_anim_id_t anim_id)
+{
+    const anim_particles_t *particles = s_anims[anim_id].particles;
+
+    particles_free();
+    s_particles_anim = anim_id;
+    if (particles == NULL) return;
+
+    if (particle_system_init(&s_particles, particles->emitter, particles->capacity) != ESP_OK) {
+        ESP_LOGW(TAG, "No particles for %s", s_anim_info[anim_id].name);
+        return;
+    }
+    particle_system_fill(&s_particles, particles->fill);
+}
+
 /*===========================================================================
  * Drawing Callback
  *===========================================================================*/
@@ -1461,8 +1832,45 @@ static void draw_cb(lv_event_t *e)
     lv_layer_t *layer = lv_event_get_layer(e);
     if (layer == NULL) return;
 
-    if (s_current_anim < GALLERY_ANIM_MAX && s_draw_funcs[s_current_anim] != NULL) {
-        s_draw_funcs[s_current_anim](layer, s_time);
+    if (s_current_anim >= GALLERY_ANIM_MAX) return;
+    const anim_desc_t *desc = &s_anims[s_current_anim];
+
+    /* First draw call of this tick advances the simulations */
+    s_step = s_step_pending;
+    s_step_pending = false;
+
+    if (desc->bg_color != BG_NONE) {
+        fill_background(layer, desc->bg_color);
+    }
+    if (s_bg.data != NULL) {
+        lv_draw_image_dsc_t img_dsc;
+        lv_draw_image_dsc_init(&img_dsc);
+        img_dsc.src = &s_bg.img;
+        lv_draw_image(layer, &img_dsc, &s_bg.area);
+    } else if (desc->background != NULL) {
+        desc->background(layer);
+    }
+
+    desc->draw(layer, s_time);
+    s_frame_px += lv_area_get_size(&layer->_clip_area);
+}
+
+/**
+ * @brief Cover check for LV_EVENT_COVER_CHECK
+ *
+ * Every animation paints the whole area opaquely, so LVGL can start
+ * redrawing a dirty area at this object instead of the screen behind it.
+ */
+static void cover_cb(lv_event_t *e)
+{
+    const lv_area_t *area = lv_event_get_cover_area(e);
+    lv_area_t coords;
+    lv_obj_get_coords(s_draw_obj, &coords);
+    if (s_visible && area->x1 >= coords.x1 && area->y1 >= coords.y1 &&
+        area->x2 <= coords.x2 && area->y2 <= coords.y2) {
+        lv_event_set_cover_res(e, LV_COVER_RES_COVER);
+    } else {
+        lv_event_set_cover_res(e, LV_COVER_RES_NOT_COVER);
     }
 }
 
@@ -1470,12 +1878,74 @@ static void draw_cb(lv_event_t *e)
  * Animation Timer
  *===========================================================================*/
 
-static void anim_timer_cb(lv_timer_t *timer)
+/**
+ * @brief Close the pixel count of the frame drawn since the last tick
+ */
+static void account_frame(void)
 {
-    s_time += 1.0f / ANIM_FPS;
+    gallery_anim_stats_t *stats = &s_stats[s_current_anim];
 
-    if (s_draw_obj && s_visible) {
+    if (stats->frames > 0) {
+        stats->last_frame_px = s_frame_px;
+        if (s_frame_px > stats->max_frame_px) stats->max_frame_px = s_frame_px;
+        stats->total_px += s_frame_px;
+    }
+    s_frame_px = 0;
+}
+
+/**
+ * @brief Invalidate what changed between the previous tick and this one
+ */
+static void invalidate_tick(void)
+{
+    const anim_desc_t *desc = &s_anims[s_current_anim];
+    gallery_anim_stats_t *stats = &s_stats[s_current_anim];
+
+    lv_area_t area = desc->motion_area;
+    if (!area_is_set(&area)) {
+        area = (lv_area_t)SCREEN_AREA;
+    }
+    bool changed = (desc->dirty == NULL) || desc->dirty(s_prev_time, s_time, &area);
+
+    stats->frames++;
+    if (s_full_redraw) {
         lv_obj_invalidate(s_draw_obj);
+        s_full_redraw = false;
+        stats->full_frames++;
+    } else if (!changed) {
+        stats->static_frames++;
+        return;
+    } else {
+        /* Last tick's area erases the old content */
+        if (s_have_prev_dirty) {
+            lv_obj_invalidate_area(s_draw_obj, &s_prev_dirty);
+        }
+        lv_obj_invalidate_area(s_draw_obj, &area);
+    }
+
+    if (changed) {
+        s_prev_dirty = area;
+        s_have_prev_dirty = true;
+    }
+}
+
+static void anim_timer_cb(const anim_clock_t *clock, void *user_data)
+{
+    s_prev_time = s_time;
+    s_time = anim_clock_sec(clock);
+    s_dt = anim_clock_step_sec(clock);
+    s_step_pending = true;
+
+    if (s_draw_obj && s_visible) {
+        if (s_bg_anim != s_current_anim) {
+            bg_cache_build(s_current_anim);
+        }
+        if (s_particles_anim != s_current_anim) {
+            particles_build(s_current_anim);
+        }
+        particle_system_update(&s_particles, clock->step_us);
+        account_frame();
+        invalidate_tick();
     }
 }
 
@@ -1495,7 +1965,11 @@ int gallery_anim_init(lv_obj_t *parent)
     /* Reset state */
     memset(&s_state, 0, sizeof(s_state));
     s_time = 0;
+    s_prev_time = 0;
     s_visible = false;
+    s_step_pending = true;
+    s_full_redraw = true;
+    s_have_prev_dirty = false;
 
     /* Create drawing object */
     s_draw_obj = lv_obj_create(parent);
@@ -1507,9 +1981,15 @@ int gallery_anim_init(lv_obj_t *parent)
 
     /* Register draw callback */
     lv_obj_add_event_cb(s_draw_obj, draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_add_event_cb(s_draw_obj, cover_cb, LV_EVENT_COVER_CHECK, NULL);
 
-    /* Start animation timer */
-    s_anim_timer = lv_timer_create(anim_timer_cb, ANIM_PERIOD_MS, NULL);
+    /* Start animation timer (idle until shown) */
+    frame_gov_client_config_t cfg = FRAME_GOV_CLIENT_DEFAULT("gallery", anim_timer_cb, NULL);
+    cfg.min_fps = ANIM_MIN_FPS;
+    cfg.max_fps = ANIM_MAX_FPS;
+    cfg.idle_fps = ANIM_IDLE_FPS;
+    s_anim_timer = frame_gov_register(&cfg);
+    frame_gov_set_idle(s_anim_timer, true);
 
     /* Initially hidden */
     lv_obj_add_flag(s_draw_obj, LV_OBJ_FLAG_HIDDEN);
@@ -1523,7 +2003,7 @@ void gallery_anim_deinit(void)
     ESP_LOGI(TAG, "Deinitializing gallery animations");
 
     if (s_anim_timer) {
-        lv_timer_delete(s_anim_timer);
+        frame_gov_unregister(s_anim_timer);
         s_anim_timer = NULL;
     }
 
@@ -1532,6 +2012,8 @@ void gallery_anim_deinit(void)
         s_draw_obj = NULL;
     }
 
+    bg_cache_free();
+    particles_free();
     memset(&s_state, 0, sizeof(s_state));
     s_visible = false;
 }
@@ -1543,11 +2025,22 @@ void gallery_anim_set(gallery_anim_id_t anim_id)
         return;
     }
 
+    account_frame();
+    if (anim_id != s_current_anim) {
+        bg_cache_free();    /* The next tick renders the new one */
+    }
+    particles_free();       /* Restarted on the next tick */
+
     s_current_anim = anim_id;
     s_time = 0;  /* Reset time for new animation */
+    s_prev_time = 0;
+    frame_gov_set_time(s_anim_timer, 0);
 
     /* Reset animation-specific state */
     memset(&s_state, 0, sizeof(s_state));
+    s_step_pending = true;
+    s_full_redraw = true;
+    s_have_prev_dirty = false;
 
     ESP_LOGI(TAG, "Set animation: %s", s_anim_info[anim_id].name);
 }
@@ -1570,7 +2063,14 @@ int gallery_anim_get_count(void)
 
 void gallery_anim_set_visible(bool visible)
 {
+    if (visible && !s_visible) {
+        s_full_redraw = true;
+        s_have_prev_dirty = false;
+    } else if (!visible) {
+        bg_cache_free();    /* Rebuilt when shown again */
+    }
     s_visible = visible;
+    frame_gov_set_idle(s_anim_timer, !visible);
 
     if (s_draw_obj) {
         if (visible) {
@@ -1585,3 +2085,100 @@ bool gallery_anim_is_visible(void)
 {
     return s_visible;
 }
+
+int gallery_anim_get_stats(gallery_anim_id_t anim_id, gallery_anim_stats_t *stats)
+{
+    if (anim_id >= GALLERY_ANIM_MAX || stats == NULL) return -1;
+
+    *stats = s_stats[anim_id];
+    stats->full_frame_px = SCREEN_WIDTH * SCREEN_HEIGHT;
+    return 0;
+}
+
+void gallery_anim_reset_stats(void)
+{
+    memset(s_stats, 0, sizeof(s_stats));
+    s_frame_px = 0;
+    if (s_bg.data != NULL) {
+        s_stats[s_bg_anim].bg_cache_bytes = s_bg.img.data_size;
+    }
+}
+
+#if CONFIG_APP_SELF_TEST
+/*===========================================================================
+ * Verification (CONFIG_APP_SELF_TEST)
+ *===========================================================================*/
+
+#define CHECK_DURATION_MS   10100   /* Rocket 1.1 s into its fourth climb */
+#define CHECK_TOLERANCE_PX  0.5f
+
+typedef void (*step_func_t)(float t, float dt);
+
+/* Animations that integrate motion over s_dt, and the coordinate compared */
+static const struct {
+    gallery_anim_id_t anim;
+    step_func_t step;
+    const float *pos;
+} s_check_cases[] = {
+    { GALLERY_ANIM_BOUNCING_BALL, step_bouncing_ball, &s_state.ball_y },
+    { GALLERY_ANIM_FIREWORKS,     step_fireworks,     &s_state.launch_y },
+    { GALLERY_ANIM_BINARY_CODE,   step_binary_code,   &s_state.scroll_offset },
+};
+
+/**
+ * @brief Run one animation's step at @p fps on a simulated clock; returns the final position
+ */
+static float check_run(step_func_t step, const float *pos, uint32_t fps)
+{
+    anim_clock_sim_t sim;
+    anim_clock_t clock;
+
+    memset(&s_state, 0, sizeof(s_state));
+    anim_clock_sim_start(&sim, &clock, fps, CHECK_DURATION_MS);
+    step(anim_clock_sec(&clock), anim_clock_step_sec(&clock));
+    while (anim_clock_sim_tick(&sim, &clock)) {
+        step(anim_clock_sec(&clock), anim_clock_step_sec(&clock));
+    }
+    return *pos;
+}
+
+esp_err_t gallery_anim_check(gallery_anim_check_t *result)
+{
+    static const uint32_t rates[] = { 10, 20, 30 };
+
+    if (result == NULL) return ESP_ERR_INVALID_ARG;
+
+    /* The live state is borrowed; sparks go nowhere */
+    static particle_system_t saved_particles;
+    static anim_state_t saved_state;
+    saved_particles = s_particles;
+    saved_state = s_state;
+    memset(&s_particles, 0, sizeof(s_particles));
+
+    memset(result, 0, sizeof(*result));
+    result->worst = GALLERY_ANIM_MAX;
+    for (size_t c = 0; c < sizeof(s_check_cases) / sizeof(s_check_cases[0]); c++) {
+        float lo = INFINITY;
+        float hi = -INFINITY;
+        for (size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++) {
+            float pos = check_run(s_check_cases[c].step, s_check_cases[c].pos, rates[r]);
+            lo = fminf(lo, pos);
+            hi = fmaxf(hi, pos);
+        }
+        if (hi - lo >= result->spread_px) {
+            result->spread_px = hi - lo;
+            result->worst = s_check_cases[c].anim;
+        }
+        result->cases++;
+    }
+
+    s_state = saved_state;
+    s_particles = saved_particles;
+
+    bool ok = result->spread_px <= CHECK_TOLERANCE_PX;
+    ESP_LOGI(TAG, "%lu animations at 10/20/30 FPS: spread %.3f px (%s): %s",
+             (unsigned long)result->cases, (double)result->spread_px,
+             s_anim_info[result->worst].name, ok ? "ok" : "FAILED");
+    return ok ? ESP_OK : ESP_FAIL;
+}
+#endif /* CONFIG_APP_SELF_TEST */
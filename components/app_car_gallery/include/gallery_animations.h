@@ -14,6 +14,8 @@
 #ifndef GALLERY_ANIMATIONS_H
 #define GALLERY_ANIMATIONS_H
 
+#include "esp_err.h"
+#include "sdkconfig.h"
 #include "lvgl.h"
 
 #ifdef __cplusplus
@@ -87,6 +89,29 @@ typedef struct {
     uint32_t secondary_color;   /* Secondary color (hex) */
 } gallery_anim_info_t;
 
+/*===========================================================================
+ * Render Statistics
+ *===========================================================================*/
+
+/**
+ * @brief Redraw counters of one animation
+ *
+ * Each tick invalidates only the area the animation's moving content
+ * occupies (or nothing, if the picture did not change). Pixels are
+ * counted as LVGL redraws them, so total_px / frames against
+ * full_frame_px is the saving over redrawing the whole screen every tick.
+ */
+typedef struct {
+    uint32_t frames;            /* Ticks while visible */
+    uint32_t full_frames;       /* Ticks that redrew everything (after select/show) */
+    uint32_t static_frames;     /* Ticks with no visible change (nothing invalidated) */
+    uint32_t last_frame_px;     /* Pixels redrawn for the latest completed frame */
+    uint32_t max_frame_px;      /* Largest frame */
+    uint64_t total_px;          /* Pixels redrawn over all completed frames */
+    uint32_t full_frame_px;     /* Pixels of a whole-screen redraw, for comparison */
+    uint32_t bg_cache_bytes;    /* Pre-rendered static background, 0 if drawn as vectors */
+} gallery_anim_stats_t;
+
 /*===========================================================================
  * Public API
  *===========================================================================*/
@@ -152,6 +177,50 @@ void gallery_anim_set_visible(bool visible);
  */
 bool gallery_anim_is_visible(void);
 
+/**
+ * @brief Get the redraw counters of an animation
+ *
+ * @param anim_id Animation ID
+ * @param stats Filled with a snapshot of the counters
+ * @return 0 on success, -1 on error
+ */
+int gallery_anim_get_stats(gallery_anim_id_t anim_id, gallery_anim_stats_t *stats);
+
+/**
+ * @brief Reset the redraw counters of every animation
+ */
+void gallery_anim_reset_stats(void);
+
+#if CONFIG_APP_SELF_TEST
+/*===========================================================================
+ * Verification (CONFIG_APP_SELF_TEST)
+ *===========================================================================*/
+
+/**
+ * @brief Result of gallery_anim_check()
+ */
+typedef struct {
+    uint32_t cases;             /* Animations run */
+    float spread_px;            /* Largest final position spread between the rates */
+    gallery_anim_id_t worst;    /* Animation with that spread */
+} gallery_anim_check_t;
+
+/**
+ * @brief Check that simulated motion does not depend on the frame rate
+ *
+ * Runs the per-tick simulation of every animation that integrates motion
+ * over the tick interval (bouncing ball, fireworks rocket, binary code
+ * scroll) on simulated clocks at 10, 20 and 30 FPS with jittered and
+ * dropped ticks, over the same 10.1 s, and compares the final positions.
+ * The animation on screen keeps its state. Call from the LVGL task.
+ *
+ * @param result Largest spread and where it was found
+ * @return ESP_OK if every animation agrees within 0.5 px, ESP_FAIL
+ *         otherwise; ESP_ERR_INVALID_ARG
+ */
+esp_err_t gallery_anim_check(gallery_anim_check_t *result);
+#endif /* CONFIG_APP_SELF_TEST */
+
 #ifdef __cplusplus
 }
 #endif
@@ -13,6 +13,9 @@
  *   };
  *   mochi_configure_state(MOCHI_STATE_HAPPY, &cfg);
  *
+ *   // Or an IMA-ADPCM clip (4:1, decoded while playing)
+ *   cfg.audio.enter = (mochi_sound_asset_t)MOCHI_SOUND_EMBEDDED_ADPCM(sound_braking_adpcm);
+ *
  *   // Or with SD card assets
  *   mochi_state_config_t cfg = {
  *       .enter_sound = MOCHI_SOUND_SD("happy.mp3"),
@@ -25,6 +28,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "esp_err.h"
+#include "audio_adpcm.h"
 #include "lvgl.h"
 #include "mochi_state.h"  /* For mochi_face_params_t, enums */
 
@@ -49,6 +53,7 @@ extern "C" {
 typedef enum {
     MOCHI_ASSET_NONE = 0,    /**< No asset configured */
     MOCHI_ASSET_EMBEDDED,    /**< Asset embedded in flash */
+    MOCHI_ASSET_EMBEDDED_ADPCM, /**< IMA-ADPCM sound embedded in flash */
     MOCHI_ASSET_SDCARD       /**< Asset on SD card */
 } mochi_asset_source_t;
 
@@ -73,6 +78,7 @@ typedef struct {
     mochi_asset_source_t source;    /**< Asset source type */
     union {
         mochi_embedded_sound_t embedded;  /**< Embedded PCM data */
+        const audio_adpcm_clip_t *adpcm;  /**< Embedded IMA-ADPCM clip */
         const char *sd_path;              /**< SD card filename (e.g., "beep.mp3") */
     };
 } mochi_sound_asset_t;
@@ -165,6 +171,18 @@ typedef struct mochi_state_config_t {
     { .source = MOCHI_ASSET_EMBEDDED, \
       .embedded = { .pcm_data = (pcm), .pcm_len = (len), .sample_rate = (rate), .channels = 2 } }
 
+/**
+ * @brief Create an embedded IMA-ADPCM sound asset
+ *
+ * Roughly a quarter of the flash of MOCHI_SOUND_EMBEDDED(). The clip is
+ * decoded block by block during playback, never copied to RAM.
+ *
+ * @param clip audio_adpcm_clip_t variable name (not pointer), as produced
+ *             by components/audio_play/tools/gen_adpcm_asset.py
+ */
+#define MOCHI_SOUND_EMBEDDED_ADPCM(clip) \
+    { .source = MOCHI_ASSET_EMBEDDED_ADPCM, .adpcm = &(clip) }
+
 /**
  * @brief Create an SD card sound asset
  * @param path Filename relative to /sdcard/Sounds/ (e.g., "beep.mp3")
@@ -286,8 +304,9 @@ typedef struct mochi_state_config_t {
 /**
  * @brief Play a sound asset
  *
- * Handles both embedded PCM and SD card files transparently.
- * For embedded PCM, resamples to codec sample rate if needed.
+ * Handles embedded PCM, embedded IMA-ADPCM and SD card files transparently.
+ * Embedded clips are resampled to the codec sample rate if needed. SD files
+ * play from the decoded-clip cache once loaded; until then they stream.
  *
  * @param asset Sound asset to play
  * @param loop True to loop continuously, false for one-shot
@@ -300,6 +319,17 @@ esp_err_t mochi_play_asset_sound(const mochi_sound_asset_t *asset, bool loop);
  */
 void mochi_stop_asset_sound(void);
 
+/**
+ * @brief Keep a state's SD sounds decoded in RAM
+ *
+ * Pins the enter and loop sounds of @p cfg in the clip cache (loading them
+ * in the background if needed) and releases the previous state's pins.
+ *
+ * @param cfg State whose sounds should stay cached
+ * @return ESP_OK, ESP_ERR_INVALID_STATE if the cache is not running
+ */
+esp_err_t mochi_pin_state_sounds(const mochi_state_config_t *cfg);
+
 /**
  * @brief Create an LVGL image object from image asset
  *
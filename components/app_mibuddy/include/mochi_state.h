@@ -18,6 +18,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "esp_err.h"
+#include "sdkconfig.h"
 #include "lvgl.h"
 
 #ifdef __cplusplus
@@ -331,6 +332,112 @@ void mochi_resume(void);
  */
 void mochi_set_visible(bool visible);
 
+/*===========================================================================
+ * Public API - Render Statistics
+ *===========================================================================*/
+
+/**
+ * @brief Face sprite cache counters
+ *
+ * The body, highlight and blush are blitted from pre-rendered bitmaps
+ * when they fit CONFIG_MOCHI_FACE_SPRITE_CACHE_KB; misses are drawn as
+ * vectors.
+ */
+typedef struct {
+    uint32_t bytes;           /**< Bitmap memory in use */
+    uint32_t peak_bytes;      /**< Highest bytes seen */
+    uint32_t budget_bytes;    /**< Configured limit */
+    uint32_t count;           /**< Sprites held */
+    uint32_t hits;            /**< Parts blitted from a sprite */
+    uint32_t misses;          /**< Parts drawn as vectors (not yet stable, too big or no room) */
+    uint32_t renders;         /**< Sprites rendered */
+    uint32_t evictions;       /**< Sprites dropped to make room */
+    uint32_t render_us;       /**< Total time spent rendering sprites */
+} mochi_sprite_stats_t;
+
+/**
+ * @brief Face redraw counters
+ *
+ * Each face update invalidates only the parts that changed (body,
+ * highlight, each blush spot, each eye, mouth). Pixels are counted as
+ * LVGL redraws them, so total_px / frames against full_frame_px is the
+ * saving over redrawing the whole face every tick.
+ */
+typedef struct {
+    uint32_t frames;          /**< Face updates (animation ticks and state changes) */
+    uint32_t full_frames;     /**< Updates that redrew the whole face (first frame after create) */
+    uint32_t static_frames;   /**< Updates with no visible change (nothing invalidated) */
+    uint32_t last_frame_px;   /**< Pixels redrawn for the latest completed frame */
+    uint32_t max_frame_px;    /**< Largest frame */
+    uint64_t total_px;        /**< Pixels redrawn over all completed frames */
+    uint32_t full_frame_px;   /**< Pixels of a whole-face redraw, for comparison */
+    mochi_sprite_stats_t sprites;
+} mochi_face_stats_t;
+
+/**
+ * @brief Get face redraw counters
+ *
+ * @param stats Filled with a snapshot of the counters
+ */
+void mochi_face_get_stats(mochi_face_stats_t *stats);
+
+/**
+ * @brief Reset face redraw counters
+ */
+void mochi_face_reset_stats(void);
+
+#if CONFIG_APP_SELF_TEST
+/**
+ * @brief Result of mochi_face_benchmark()
+ */
+typedef struct {
+    uint32_t frames;          /**< Frames rendered per variant */
+    uint32_t vector_frame_us; /**< Average whole-face render, every part drawn as vectors */
+    uint32_t sprite_frame_us; /**< Same with the cached sprites blitted */
+} mochi_face_bench_t;
+
+/**
+ * @brief Time whole-face renders with and without the sprite cache
+ *
+ * Renders the current face off screen @p frames times into RGB565
+ * stripes, the way the display driver does, first with every part drawn
+ * as vectors and then with the sprites blitted. Needs a default display
+ * for LVGL's draw dispatch. Call from the LVGL task.
+ *
+ * @param frames Frames per variant
+ * @param result Averages
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, ESP_ERR_INVALID_STATE before the
+ *         first mochi_face_update(), ESP_ERR_NO_MEM
+ */
+esp_err_t mochi_face_benchmark(uint32_t frames, mochi_face_bench_t *result);
+
+/**
+ * @brief Largest deviations found by mochi_anim_check()
+ */
+typedef struct {
+    uint32_t cases;           /**< State/activity pairs run */
+    float offset_px;          /**< Face and eye offsets */
+    float rotation_deg;       /**< Face rotation */
+    float scale;              /**< Face/eye squish, eye scale, mouth opening */
+} mochi_anim_check_t;
+
+/**
+ * @brief Check that the face moves the same at any animation frame rate
+ *
+ * Runs the animation controller's own update for every activity (and the
+ * dizzy, panic and sleepy state motion) on simulated clocks at 10, 20 and
+ * 30 FPS with jittered and dropped ticks, over the same 9.1 s, and
+ * compares the final faces. Does not touch the face on screen. Call from
+ * the LVGL task.
+ *
+ * @param result Largest deviations between the rates
+ * @return ESP_OK if offsets agree within 0.01 px, rotation within
+ *         0.01 deg and the rest within 0.001; ESP_FAIL otherwise;
+ *         ESP_ERR_INVALID_ARG
+ */
+esp_err_t mochi_anim_check(mochi_anim_check_t *result);
+#endif /* CONFIG_APP_SELF_TEST */
+
 /*===========================================================================
  * Public API - Audio (Optional)
  *===========================================================================*/
@@ -40,25 +40,17 @@ extern "C" {
     extern const size_t chime_16k_mono_len;
     extern const uint32_t chime_16k_mono_sample_rate;
 
-    /* "Weee" sound for extreme roll - 16kHz */
-    extern const int16_t weee_hahaha_16k[];
-    extern const size_t weee_hahaha_16k_len;
-    extern const uint32_t weee_hahaha_16k_sample_rate;
-
-    /* Braking/caught sound - 16kHz */
-    extern const int16_t sound_braking[];
-    extern const size_t sound_braking_len;
-    extern const uint32_t sound_braking_sample_rate;
-
-    /* Face down/sleepy sound - 16kHz */
-    extern const int16_t sound_face_down[];
-    extern const size_t sound_face_down_len;
-    extern const uint32_t sound_face_down_sample_rate;
-
-    /* Low battery warning sound - 16kHz */
-    extern const int16_t sound_low_battery[];
-    extern const size_t sound_low_battery_len;
-    extern const uint32_t sound_low_battery_sample_rate;
+    /* "Weee" sound for extreme roll - 16kHz IMA-ADPCM */
+    extern const audio_adpcm_clip_t weee_hahaha_16k_adpcm;
+
+    /* Braking/caught sound - 16kHz IMA-ADPCM */
+    extern const audio_adpcm_clip_t sound_braking_adpcm;
+
+    /* Face down/sleepy sound - 16kHz IMA-ADPCM */
+    extern const audio_adpcm_clip_t sound_face_down_adpcm;
+
+    /* Low battery warning sound - 16kHz IMA-ADPCM */
+    extern const audio_adpcm_clip_t sound_low_battery_adpcm;
 }
 
 
@@ -144,6 +136,8 @@ uint32_t mibuddy_get_input_interval(void)
  * EDGE-TRIGGERED SOUNDS:
  * ============================================================================
  *   - Sound plays ONCE when entering extreme zone (not continuously)
+ *   - The normal roll zone pre-warms the codec and amp, so the sound starts
+ *     without the power-up delay
  *   - Resets when returning to normal roll zone (allows re-trigger)
  *   - Separate tracking for left/right to allow independent triggers
  */
@@ -166,7 +160,7 @@ static void default_input_mapper(
     if (input->is_braking) {
         if (!s_braking_sound_played) {
             ESP_LOGI("SOUND", ">>> Braking detected! Playing sound...");
-            mochi_sound_asset_t snd = MOCHI_SOUND_EMBEDDED(sound_braking, sound_braking_len, sound_braking_sample_rate);
+            mochi_sound_asset_t snd = MOCHI_SOUND_EMBEDDED_ADPCM(sound_braking_adpcm);
             mochi_play_asset_sound(&snd, false);
             s_braking_sound_played = true;
         }
@@ -180,7 +174,7 @@ static void default_input_mapper(
     if (input->is_face_down) {
         if (!s_face_down_sound_played) {
             ESP_LOGI("SOUND", ">>> Face down! Playing sound...");
-            mochi_sound_asset_t snd = MOCHI_SOUND_EMBEDDED(sound_face_down, sound_face_down_len, sound_face_down_sample_rate);
+            mochi_sound_asset_t snd = MOCHI_SOUND_EMBEDDED_ADPCM(sound_face_down_adpcm);
             mochi_play_asset_sound(&snd, false);
             s_face_down_sound_played = true;
         }
@@ -206,7 +200,7 @@ static void default_input_mapper(
                 /* Play sound on extreme left entry (edge trigger) */
                 if (!s_extreme_left_active) {
                     ESP_LOGI("SOUND", ">>> Extreme left roll! Playing weee...");
-                    mochi_sound_asset_t weee = MOCHI_SOUND_EMBEDDED(weee_hahaha_16k, weee_hahaha_16k_len, weee_hahaha_16k_sample_rate);
+                    mochi_sound_asset_t weee = MOCHI_SOUND_EMBEDDED_ADPCM(weee_hahaha_16k_adpcm);
                     mochi_play_asset_sound(&weee, false);
                     s_extreme_left_active = true;
                 }
@@ -214,6 +208,7 @@ static void default_input_mapper(
             } else {
                 *out_state = MOCHI_STATE_HAPPY;
                 s_extreme_left_active = false;  /* Reset when back to normal roll */
+                Audio_Prewarm(0);   /* Extreme roll (weee) likely next: start it hot */
             }
             *out_activity = MOCHI_ACTIVITY_SLIDE_LEFT;
             return;
@@ -226,7 +221,7 @@ static void default_input_mapper(
                 /* Play sound on extreme right entry (edge trigger) */
                 if (!s_extreme_right_active) {
                     ESP_LOGI("SOUND", ">>> Extreme right roll! Playing weee...");
-                    mochi_sound_asset_t weee = MOCHI_SOUND_EMBEDDED(weee_hahaha_16k, weee_hahaha_16k_len, weee_hahaha_16k_sample_rate);
+                    mochi_sound_asset_t weee = MOCHI_SOUND_EMBEDDED_ADPCM(weee_hahaha_16k_adpcm);
                     mochi_play_asset_sound(&weee, false);
                     s_extreme_right_active = true;
                 }
@@ -234,6 +229,7 @@ static void default_input_mapper(
             } else {
                 *out_state = MOCHI_STATE_HAPPY;
                 s_extreme_right_active = false;  /* Reset when back to normal roll */
+                Audio_Prewarm(0);   /* Extreme roll (weee) likely next: start it hot */
             }
             *out_activity = MOCHI_ACTIVITY_SLIDE_RIGHT;
             return;
@@ -247,7 +243,7 @@ static void default_input_mapper(
     if (input->is_low_battery) {
         if (!s_low_battery_sound_played) {
             ESP_LOGI("SOUND", ">>> Low battery! Playing warning sound...");
-            mochi_sound_asset_t snd = MOCHI_SOUND_EMBEDDED(sound_low_battery, sound_low_battery_len, sound_low_battery_sample_rate);
+            mochi_sound_asset_t snd = MOCHI_SOUND_EMBEDDED_ADPCM(sound_low_battery_adpcm);
             mochi_play_asset_sound(&snd, false);
             s_low_battery_sound_played = true;
         }
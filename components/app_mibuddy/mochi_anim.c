@@ -16,8 +16,10 @@
 
 #include "mochi_state.h"
 #include "mochi_theme.h"
+#include "frame_governor.h"
 #include "esp_log.h"
 #include <math.h>
+#include <string.h>
 
 static const char *TAG = "mochi_anim";
 
@@ -25,7 +27,11 @@ static const char *TAG = "mochi_anim";
  * Animation Parameters
  *===========================================================================*/
 
-#define ANIM_TIMER_PERIOD_MS    50  /* 20 FPS - reduced from 40 FPS to prevent watchdog timeout */
+/* Rate limits handed to the frame governor, which picks the actual rate */
+#define ANIM_MIN_FPS            10
+#define ANIM_MAX_FPS            30
+#define ANIM_IDLE_FPS           15  /* Breathing and snoring move a few pixels per second */
+#define PANIC_SPIN_DEG_PER_SEC  160.0f
 #define PI                      3.14159265358979f
 
 /* Animation frequencies in Hz */
@@ -36,6 +42,7 @@ static const char *TAG = "mochi_anim";
 #define WIGGLE_FREQ             4.0f
 #define NOD_FREQ                2.0f
 #define BLINK_INTERVAL_MS       3000
+#define BLINK_DURATION_MS       220
 #define VIBRATE_FREQ            30.0f
 
 /* Animation amplitudes */
@@ -69,8 +76,8 @@ static struct {
     mochi_activity_t current_activity;
     float intensity;
 
-    lv_timer_t *timer;
-    uint32_t frame;           /* Animation frame counter */
+    frame_gov_handle_t timer;
+    uint32_t time_ms;         /* Animation clock (ms), kept across stop/start */
     uint32_t last_blink_ms;   /* Last blink time */
     bool is_blinking;
     float blink_progress;     /* 0.0 to 1.0 */
@@ -80,7 +87,7 @@ static struct {
     .paused = false,
     .intensity = 0.7f,
     .timer = NULL,
-    .frame = 0,
+    .time_ms = 0,
     .last_blink_ms = 0,
     .is_blinking = false,
     .blink_progress = 0.0f,
@@ -158,33 +165,38 @@ static void apply_nod_animation(mochi_face_params_t *params, float t) {
 
 /**
  * @brief Apply blink animation
+ *
+ * Blinks start every BLINK_INTERVAL_MS of animation time, on the dot, and
+ * close and open over BLINK_DURATION_MS, whatever the tick rate.
  */
 static void apply_blink_animation(mochi_face_params_t *params, uint32_t now_ms) {
+    /* Clock moved back (new animation) */
+    if (now_ms < s_anim.last_blink_ms) {
+        s_anim.last_blink_ms = 0;
+        s_anim.is_blinking = false;
+    }
+
     /* Check if time to blink */
-    if (!s_anim.is_blinking && (now_ms - s_anim.last_blink_ms) >= BLINK_INTERVAL_MS) {
+    uint32_t since = now_ms - s_anim.last_blink_ms;
+    if (since >= BLINK_INTERVAL_MS) {
         s_anim.is_blinking = true;
-        s_anim.blink_progress = 0.0f;
-        s_anim.last_blink_ms = now_ms;
+        s_anim.last_blink_ms += since - since % BLINK_INTERVAL_MS;
     }
 
     /* Animate blink */
     if (s_anim.is_blinking) {
-        s_anim.blink_progress += 0.15f;  /* Speed of blink */
+        s_anim.blink_progress = (float)(now_ms - s_anim.last_blink_ms) / BLINK_DURATION_MS;
 
-        float squish;
         if (s_anim.blink_progress < 0.5f) {
             /* Closing */
-            squish = s_anim.blink_progress * 2.0f * 0.9f;
+            params->eye_squish = s_anim.blink_progress * 2.0f * 0.9f;
         } else if (s_anim.blink_progress < 1.0f) {
             /* Opening */
-            squish = (1.0f - s_anim.blink_progress) * 2.0f * 0.9f;
+            params->eye_squish = (1.0f - s_anim.blink_progress) * 2.0f * 0.9f;
         } else {
             /* Done */
-            squish = 0.0f;
             s_anim.is_blinking = false;
         }
-
-        params->eye_squish = squish;
     }
 }
 
@@ -276,7 +288,7 @@ static void apply_state_animation(mochi_face_params_t *params, float t) {
 
         case MOCHI_STATE_PANIC:
             /* Panic rotation */
-            params->face_rotation = fmodf(s_anim.frame * 8.0f * s_anim.intensity, 360.0f);
+            params->face_rotation = fmodf(t * PANIC_SPIN_DEG_PER_SEC * s_anim.intensity, 360.0f);
             break;
 
         case MOCHI_STATE_SLEEPY:
@@ -289,22 +301,26 @@ static void apply_state_animation(mochi_face_params_t *params, float t) {
     }
 }
 
-/*===========================================================================
- * Timer Callback
- *===========================================================================*/
-
-static void anim_timer_cb(lv_timer_t *timer) {
-    if (s_anim.paused) return;
-
-    s_anim.frame++;
-    float t = (float)s_anim.frame * ANIM_TIMER_PERIOD_MS / 1000.0f;
-    uint32_t now_ms = s_anim.frame * ANIM_TIMER_PERIOD_MS;
+/**
+ * @brief Slow, small motion that looks the same at a lower frame rate
+ */
+static bool anim_is_idle(mochi_state_t state, mochi_activity_t activity) {
+    if (state == MOCHI_STATE_DIZZY || state == MOCHI_STATE_PANIC) return false;
 
-    /* Get base parameters and copy to working set */
-    const mochi_face_params_t *base = mochi_get_base_params();
-    mochi_face_params_t *params = mochi_get_current_params();
+    return activity == MOCHI_ACTIVITY_IDLE || activity == MOCHI_ACTIVITY_SNORE;
+}
 
-    if (base == NULL || params == NULL) return;
+/**
+ * @brief Animated face at the clock's time: @p base plus state and activity motion
+ *
+ * Every offset, angle and squish is a function of the animation time (the
+ * blink also of the time the latest one started), so the face at a given
+ * time does not depend on how many ticks led up to it.
+ */
+static void anim_compute(const anim_clock_t *clock, const mochi_face_params_t *base,
+                         mochi_face_params_t *params) {
+    float t = anim_clock_sec(clock);
+    uint32_t now_ms = anim_clock_ms(clock);
 
     /* Start with base params */
     memcpy(params, base, sizeof(mochi_face_params_t));
@@ -358,6 +374,24 @@ static void anim_timer_cb(lv_timer_t *timer) {
             apply_idle_animation(params, t);
             break;
     }
+}
+
+/*===========================================================================
+ * Timer Callback
+ *===========================================================================*/
+
+static void anim_timer_cb(const anim_clock_t *clock, void *user_data) {
+    if (s_anim.paused) return;
+
+    s_anim.time_ms = anim_clock_ms(clock);
+
+    /* Get base parameters and compute the working set from them */
+    const mochi_face_params_t *base = mochi_get_base_params();
+    mochi_face_params_t *params = mochi_get_current_params();
+
+    if (base == NULL || params == NULL) return;
+
+    anim_compute(clock, base, params);
 
     /* Request face redraw */
     mochi_request_redraw();
@@ -378,7 +412,7 @@ void mochi_anim_init(void) {
 
     ESP_LOGI(TAG, "Initializing animation controller");
 
-    s_anim.frame = 0;
+    s_anim.time_ms = 0;
     s_anim.last_blink_ms = 0;
     s_anim.is_blinking = false;
     s_anim.running = false;
@@ -403,25 +437,31 @@ void mochi_anim_start(mochi_state_t state, mochi_activity_t activity) {
     s_anim.current_state = state;
     s_anim.current_activity = activity;
 
-    /* Create timer if not exists */
+    /* Register with the frame governor if not yet */
     if (s_anim.timer == NULL) {
-        s_anim.timer = lv_timer_create(anim_timer_cb, ANIM_TIMER_PERIOD_MS, NULL);
+        frame_gov_client_config_t cfg = FRAME_GOV_CLIENT_DEFAULT("mochi_anim", anim_timer_cb, NULL);
+        cfg.min_fps = ANIM_MIN_FPS;
+        cfg.max_fps = ANIM_MAX_FPS;
+        cfg.idle_fps = ANIM_IDLE_FPS;
+        s_anim.timer = frame_gov_register(&cfg);
         if (s_anim.timer == NULL) {
             ESP_LOGE(TAG, "Failed to create animation timer");
             return;
         }
+        frame_gov_set_time(s_anim.timer, s_anim.time_ms);
     }
 
     s_anim.running = true;
     s_anim.paused = false;
-    lv_timer_resume(s_anim.timer);
+    frame_gov_set_idle(s_anim.timer, anim_is_idle(state, activity));
+    frame_gov_resume(s_anim.timer);
 
     ESP_LOGI(TAG, "Animation started: state=%d, activity=%d", state, activity);
 }
 
 void mochi_anim_stop(void) {
     if (s_anim.timer != NULL) {
-        lv_timer_delete(s_anim.timer);
+        frame_gov_unregister(s_anim.timer);
         s_anim.timer = NULL;
     }
     s_anim.running = false;
@@ -432,7 +472,7 @@ void mochi_anim_pause(void) {
 
     s_anim.paused = true;
     if (s_anim.timer != NULL) {
-        lv_timer_pause(s_anim.timer);
+        frame_gov_pause(s_anim.timer);
     }
 }
 
@@ -441,7 +481,7 @@ void mochi_anim_resume(void) {
 
     s_anim.paused = false;
     if (s_anim.timer != NULL) {
-        lv_timer_resume(s_anim.timer);
+        frame_gov_resume(s_anim.timer);
     }
 }
 
@@ -450,3 +490,116 @@ void mochi_anim_set_intensity(float intensity) {
     if (intensity > 1.0f) intensity = 1.0f;
     s_anim.intensity = intensity;
 }
+
+#if CONFIG_APP_SELF_TEST
+/*===========================================================================
+ * Verification (CONFIG_APP_SELF_TEST)
+ *===========================================================================*/
+
+#define CHECK_DURATION_MS       9100    /* Ends 100 ms into a blink */
+#define CHECK_OFFSET_PX         0.01f
+#define CHECK_ROTATION_DEG      0.01f
+#define CHECK_SCALE             0.001f
+
+static const uint32_t s_check_rates[] = { 10, 20, 30 };
+
+static const struct {
+    mochi_state_t state;
+    mochi_activity_t activity;
+} s_check_cases[] = {
+    { MOCHI_STATE_HAPPY,   MOCHI_ACTIVITY_IDLE },
+    { MOCHI_STATE_HAPPY,   MOCHI_ACTIVITY_SHAKE },
+    { MOCHI_STATE_EXCITED, MOCHI_ACTIVITY_BOUNCE },
+    { MOCHI_STATE_HAPPY,   MOCHI_ACTIVITY_SPIN },
+    { MOCHI_STATE_HAPPY,   MOCHI_ACTIVITY_WIGGLE },
+    { MOCHI_STATE_COOL,    MOCHI_ACTIVITY_NOD },
+    { MOCHI_STATE_HAPPY,   MOCHI_ACTIVITY_BLINK },
+    { MOCHI_STATE_SLEEPY,  MOCHI_ACTIVITY_SNORE },
+    { MOCHI_STATE_PANIC,   MOCHI_ACTIVITY_VIBRATE },
+    { MOCHI_STATE_DIZZY,   MOCHI_ACTIVITY_IDLE },
+    { MOCHI_STATE_WORRIED, MOCHI_ACTIVITY_SLIDE_LEFT },
+    { MOCHI_STATE_WORRIED, MOCHI_ACTIVITY_SLIDE_RIGHT },
+    { MOCHI_STATE_SHOCKED, MOCHI_ACTIVITY_SLIDE_UP },
+    { MOCHI_STATE_SHOCKED, MOCHI_ACTIVITY_SLIDE_DOWN },
+};
+
+static void check_max(float *max, float a, float b) {
+    float d = fabsf(a - b);
+    if (d > *max) *max = d;
+}
+
+/**
+ * @brief Run one case at @p fps through anim_compute(); returns the final face
+ */
+static void check_run(mochi_state_t state, mochi_activity_t activity, uint32_t fps,
+                      const mochi_face_params_t *base, mochi_face_params_t *params) {
+    anim_clock_sim_t sim;
+    anim_clock_t clock;
+
+    s_anim.current_state = state;
+    s_anim.current_activity = activity;
+    s_anim.last_blink_ms = 0;
+    s_anim.is_blinking = false;
+    s_anim.blink_progress = 0.0f;
+
+    anim_clock_sim_start(&sim, &clock, fps, CHECK_DURATION_MS);
+    anim_compute(&clock, base, params);
+    while (anim_clock_sim_tick(&sim, &clock)) {
+        anim_compute(&clock, base, params);
+    }
+}
+
+esp_err_t mochi_anim_check(mochi_anim_check_t *result) {
+    if (result == NULL) return ESP_ERR_INVALID_ARG;
+
+    const mochi_face_params_t *live = mochi_get_base_params();
+    mochi_face_params_t base = {
+        .eye_scale = 1.0f,
+        .pupil_size = 1.0f,
+        .mouth_open = 0.2f,
+    };
+    if (live != NULL) base = *live;
+
+    /* The animation state is borrowed; the live face is not touched */
+    mochi_state_t state = s_anim.current_state;
+    mochi_activity_t activity = s_anim.current_activity;
+    uint32_t last_blink_ms = s_anim.last_blink_ms;
+    bool is_blinking = s_anim.is_blinking;
+    float blink_progress = s_anim.blink_progress;
+
+    memset(result, 0, sizeof(*result));
+    for (size_t c = 0; c < sizeof(s_check_cases) / sizeof(s_check_cases[0]); c++) {
+        mochi_face_params_t ref;
+        check_run(s_check_cases[c].state, s_check_cases[c].activity, s_check_rates[0], &base, &ref);
+
+        for (size_t r = 1; r < sizeof(s_check_rates) / sizeof(s_check_rates[0]); r++) {
+            mochi_face_params_t p;
+            check_run(s_check_cases[c].state, s_check_cases[c].activity, s_check_rates[r], &base, &p);
+
+            check_max(&result->offset_px, p.face_offset_x, ref.face_offset_x);
+            check_max(&result->offset_px, p.face_offset_y, ref.face_offset_y);
+            check_max(&result->offset_px, p.eye_offset_x, ref.eye_offset_x);
+            check_max(&result->offset_px, p.eye_offset_y, ref.eye_offset_y);
+            check_max(&result->rotation_deg, p.face_rotation, ref.face_rotation);
+            check_max(&result->scale, p.face_squish, ref.face_squish);
+            check_max(&result->scale, p.eye_squish, ref.eye_squish);
+            check_max(&result->scale, p.eye_scale, ref.eye_scale);
+            check_max(&result->scale, p.mouth_open, ref.mouth_open);
+        }
+        result->cases++;
+    }
+
+    s_anim.current_state = state;
+    s_anim.current_activity = activity;
+    s_anim.last_blink_ms = last_blink_ms;
+    s_anim.is_blinking = is_blinking;
+    s_anim.blink_progress = blink_progress;
+
+    bool ok = result->offset_px <= CHECK_OFFSET_PX && result->rotation_deg <= CHECK_ROTATION_DEG &&
+              result->scale <= CHECK_SCALE;
+    ESP_LOGI(TAG, "%lu cases at 10/20/30 FPS: offset %.4f px, rotation %.4f deg, scale %.5f: %s",
+             (unsigned long)result->cases, (double)result->offset_px, (double)result->rotation_deg,
+             (double)result->scale, ok ? "ok" : "FAILED");
+    return ok ? ESP_OK : ESP_FAIL;
+}
+#endif /* CONFIG_APP_SELF_TEST */
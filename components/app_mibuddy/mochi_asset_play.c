@@ -4,10 +4,16 @@
  *
  * Handles playing sounds and displaying images from either
  * embedded flash or SD card storage.
+ *
+ * SD sounds are played from the decoded-clip cache (audio_clip_cache.h)
+ * when possible. The first play of a file streams it from the card while
+ * the cache loads it in the background; the sounds of the current state
+ * are pinned so repeated state changes never touch the card.
  */
 
 #include "mochi_assets.h"
 #include "audio_driver.h"
+#include "audio_clip_cache.h"
 #include "bsp_board.h"
 #include "esp_log.h"
 #include <string.h>
@@ -19,6 +25,19 @@ static const char *TAG = "mochi_asset";
  * Sound Asset Playback
  *===========================================================================*/
 
+/**
+ * @brief Absolute filesystem path of an SD sound asset
+ */
+static void sd_sound_path(const mochi_sound_asset_t *asset, char *buf, size_t size)
+{
+    if (asset->sd_path[0] == '/') {
+        snprintf(buf, size, "%s", asset->sd_path);
+    } else {
+        /* Relative to Sounds folder */
+        snprintf(buf, size, MOCHI_SD_SOUNDS_PATH "%s", asset->sd_path);
+    }
+}
+
 esp_err_t mochi_play_asset_sound(const mochi_sound_asset_t *asset, bool loop)
 {
     if (!asset || asset->source == MOCHI_ASSET_NONE) {
@@ -33,19 +52,40 @@ esp_err_t mochi_play_asset_sound(const mochi_sound_asset_t *asset, bool loop)
             return ESP_ERR_INVALID_ARG;
         }
 
-        ESP_LOGI(TAG, "Playing embedded PCM: data=%p, len=%zu, rate=%lu, ch=%d",
+        ESP_LOGD(TAG, "Playing embedded PCM: data=%p, len=%zu, rate=%lu, ch=%d",
                  (void*)asset->embedded.pcm_data,
                  asset->embedded.pcm_len,
                  (unsigned long)asset->embedded.sample_rate,
                  asset->embedded.channels);
 
-        esp_err_t ret = Audio_Play_PCM(asset->embedded.pcm_data,
-                                       asset->embedded.pcm_len,
-                                       asset->embedded.sample_rate,
-                                       asset->embedded.channels,
-                                       loop);
-        ESP_LOGI(TAG, "Audio_Play_PCM returned: %d (%s)", ret, esp_err_to_name(ret));
-        return ret;
+        /* Queued on the mixer task - returns immediately */
+        audio_voice_t voice = Audio_Play_PCM(asset->embedded.pcm_data,
+                                             asset->embedded.pcm_len,
+                                             asset->embedded.sample_rate,
+                                             asset->embedded.channels,
+                                             loop);
+        if (voice == AUDIO_VOICE_INVALID) {
+            ESP_LOGW(TAG, "Audio_Play_PCM: clip not queued");
+            return ESP_FAIL;
+        }
+        return ESP_OK;
+    }
+    else if (asset->source == MOCHI_ASSET_EMBEDDED_ADPCM) {
+        if (!asset->adpcm) {
+            ESP_LOGW(TAG, "ADPCM sound has no clip");
+            return ESP_ERR_INVALID_ARG;
+        }
+
+        ESP_LOGD(TAG, "Playing embedded ADPCM: %zu samples, %zu bytes, rate=%lu",
+                 asset->adpcm->samples, asset->adpcm->data_len,
+                 (unsigned long)asset->adpcm->sample_rate);
+
+        /* Decoded incrementally by the mixer task */
+        if (Audio_Play_ADPCM(asset->adpcm, loop) == AUDIO_VOICE_INVALID) {
+            ESP_LOGW(TAG, "Audio_Play_ADPCM: clip not queued");
+            return ESP_FAIL;
+        }
+        return ESP_OK;
     }
     else if (asset->source == MOCHI_ASSET_SDCARD) {
         /* Play from SD card */
@@ -54,18 +94,21 @@ esp_err_t mochi_play_asset_sound(const mochi_sound_asset_t *asset, bool loop)
             return ESP_ERR_INVALID_ARG;
         }
 
-        /* Build full path - file:// URL needs 3 slashes for absolute paths */
-        char full_path[128];
-        if (asset->sd_path[0] == '/') {
-            /* Already absolute path */
-            snprintf(full_path, sizeof(full_path), "file://%s", asset->sd_path);
-        } else {
-            /* Relative to Sounds folder */
-            snprintf(full_path, sizeof(full_path), "file://" MOCHI_SD_SOUNDS_PATH "%s", asset->sd_path);
+        char path[AUDIO_CLIP_CACHE_PATH_MAX];
+        sd_sound_path(asset, path, sizeof(path));
+
+        /* Decoded copy in RAM: a mixer voice, no SD access (loops too) */
+        if (audio_clip_cache_play(path, loop, NULL) == ESP_OK) {
+            ESP_LOGD(TAG, "Playing cached SD sound: %s", path);
+            return ESP_OK;
         }
 
-        ESP_LOGD(TAG, "Playing SD sound: %s", full_path);
-        return Audio_Play_Music(full_path);
+        /* Miss - stream it this time, the cache is loading it meanwhile.
+         * file:// URL needs 3 slashes for absolute paths */
+        char url[AUDIO_CLIP_CACHE_PATH_MAX + 8];
+        snprintf(url, sizeof(url), "file://%s", path);
+        ESP_LOGD(TAG, "Playing SD sound: %s", url);
+        return Audio_Play_Music(url);
     }
 
     return ESP_ERR_INVALID_ARG;
@@ -73,9 +116,27 @@ esp_err_t mochi_play_asset_sound(const mochi_sound_asset_t *asset, bool loop)
 
 void mochi_stop_asset_sound(void)
 {
+    Audio_Stop_All_Voices();
     Audio_Stop_Play();
 }
 
+esp_err_t mochi_pin_state_sounds(const mochi_state_config_t *cfg)
+{
+    const mochi_sound_asset_t *sounds[] = { &cfg->audio.enter, &cfg->audio.loop };
+    char paths[2][AUDIO_CLIP_CACHE_PATH_MAX];
+    const char *pins[2];
+    size_t n = 0;
+
+    for (size_t i = 0; i < 2; i++) {
+        if (sounds[i]->source == MOCHI_ASSET_SDCARD && sounds[i]->sd_path) {
+            sd_sound_path(sounds[i], paths[n], sizeof(paths[n]));
+            pins[n] = paths[n];
+            n++;
+        }
+    }
+    return audio_clip_cache_set_pinned(pins, n);
+}
+
 /*===========================================================================
  * Image Asset Display
  *===========================================================================*/
@@ -10,12 +10,36 @@
  *
  * This approach uses no separate buffer - draws directly to display's
  * render layer, allowing full-screen rendering without memory constraints.
+ *
+ * Dirty rectangles: every part (body, blush, each eye, mouth) is drawn
+ * through a face_canvas_t. With no layer attached the same code only
+ * measures - it grows the part's bounding box and hashes every primitive
+ * it would draw. On each update the parts whose hash changed invalidate
+ * their old and new bounds, so a blink redraws two eye boxes instead of
+ * the whole 240x284 face. LVGL clips the full draw callback to those
+ * areas, and the pixels actually redrawn are counted per frame
+ * (mochi_face_get_stats()).
+ *
+ * Sprites: the body, highlight and blush spots only change with the
+ * expression, theme or squish. Once such a part has looked the same for
+ * two updates it is rendered into a bitmap (mochi_sprite_cache.c) and
+ * blitted from then on, instead of re-rasterizing its anti-aliased
+ * LV_RADIUS_CIRCLE rectangles every frame. With CONFIG_APP_SELF_TEST,
+ * mochi_face_benchmark() times both paths.
  */
 
 #include "mochi_state.h"
 #include "mochi_theme.h"
+#include "mochi_sprite_cache.h"
 #include "esp_log.h"
 #include <math.h>
+#include <string.h>
+
+#if CONFIG_APP_SELF_TEST
+#include "bsp_board.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#endif
 
 static const char *TAG = "mochi_face";
 
@@ -55,6 +79,62 @@ static const char *TAG = "mochi_face";
 #define BLUSH_RX        SCALE(18)
 #define BLUSH_RY        SCALE(10)
 
+/* Anti-aliasing bleeds up to one pixel past a shape's area */
+#define AA_MARGIN       1
+
+#if CONFIG_APP_SELF_TEST
+/* mochi_face_benchmark() render stripe, like the display's partial buffers */
+#define BENCH_STRIPE_ROWS   (CANVAS_HEIGHT / 10)
+#endif
+
+/*===========================================================================
+ * Face Parts
+ *===========================================================================*/
+
+/**
+ * @brief Independently invalidated parts of the face
+ */
+typedef enum {
+    FACE_PART_BODY = 0,     /**< Shadow and face */
+    FACE_PART_HIGHLIGHT,
+    FACE_PART_BLUSH_LEFT,
+    FACE_PART_BLUSH_RIGHT,
+    FACE_PART_EYE_LEFT,
+    FACE_PART_EYE_RIGHT,
+    FACE_PART_MOUTH,
+    FACE_PART_COUNT
+} face_part_t;
+
+/**
+ * @brief Draw target: a layer, or (layer == NULL) a measurement
+ *
+ * Measuring grows @c bounds by every primitive's area and folds its
+ * geometry, color and opacity into @c hash.
+ */
+typedef struct {
+    lv_layer_t *layer;
+    lv_area_t bounds;
+    bool empty;             /**< Nothing measured yet */
+    uint32_t hash;
+} face_canvas_t;
+
+/**
+ * @brief A part's extent and content as of the last update
+ */
+typedef struct {
+    lv_area_t bounds;
+    bool empty;
+    uint32_t hash;
+} face_part_state_t;
+
+/**
+ * @brief A part's pre-rendered bitmap for the current update
+ */
+typedef struct {
+    const lv_image_dsc_t *img;  /**< NULL = draw the part as vectors */
+    lv_area_t area;             /**< Sprite position at zero face offset */
+} face_sprite_t;
+
 /*===========================================================================
  * Static Variables
  *===========================================================================*/
@@ -66,6 +146,16 @@ static bool s_visible = true;
 static mochi_face_params_t s_cached_params;
 static const mochi_theme_t *s_cached_theme = NULL;
 
+/* Dirty-rectangle tracking */
+static face_part_state_t s_parts[FACE_PART_COUNT];
+static bool s_full_redraw = true;           /* Next update invalidates everything */
+static uint32_t s_frame_px;                 /* Pixels drawn since the last update */
+static mochi_face_stats_t s_stats;
+
+/* Sprite cache */
+static face_sprite_t s_sprites[FACE_PART_COUNT];
+static int s_offset_x, s_offset_y;         /* Face offset the parts are drawn at */
+
 /* Forward declaration of draw callback */
 static void face_draw_cb(lv_event_t *e);
 
@@ -73,24 +163,52 @@ static void face_draw_cb(lv_event_t *e);
  * Drawing Helper Functions
  *===========================================================================*/
 
+static inline uint32_t hash_mix(uint32_t h, int32_t v) {
+    return (h ^ (uint32_t)v) * 16777619u;   /* FNV-1a step */
+}
+
+/**
+ * @brief Draw (or measure) a primitive covering @p area
+ */
+static void canvas_add(face_canvas_t *c, const lv_area_t *area, lv_color_t color, lv_opa_t opa) {
+    c->hash = hash_mix(c->hash, area->x1);
+    c->hash = hash_mix(c->hash, area->y1);
+    c->hash = hash_mix(c->hash, area->x2);
+    c->hash = hash_mix(c->hash, area->y2);
+    c->hash = hash_mix(c->hash, (int32_t)lv_color_to_u32(color));
+    c->hash = hash_mix(c->hash, opa);
+
+    if (c->empty) {
+        c->bounds = *area;
+        c->empty = false;
+    } else {
+        if (area->x1 < c->bounds.x1) c->bounds.x1 = area->x1;
+        if (area->y1 < c->bounds.y1) c->bounds.y1 = area->y1;
+        if (area->x2 > c->bounds.x2) c->bounds.x2 = area->x2;
+        if (area->y2 > c->bounds.y2) c->bounds.y2 = area->y2;
+    }
+}
+
 /**
  * @brief Draw a filled ellipse
  */
-static void draw_ellipse(lv_layer_t *layer, int cx, int cy, int rx, int ry, lv_color_t color, lv_opa_t opa) {
-    lv_draw_arc_dsc_t arc_dsc;
-    lv_draw_arc_dsc_init(&arc_dsc);
-    arc_dsc.color = color;
-    arc_dsc.opa = opa;
-    arc_dsc.width = rx;  /* Use width as radius for filled effect */
-    arc_dsc.center.x = cx;
-    arc_dsc.center.y = cy;
-    arc_dsc.start_angle = 0;
-    arc_dsc.end_angle = 360;
-
-    /* For filled ellipse, draw multiple arcs with decreasing radius */
-    /* This is a workaround since LVGL doesn't have direct filled ellipse */
-
-    /* Use filled rectangle with rounded corners for approximate ellipse */
+static void draw_ellipse(face_canvas_t *c, int cx, int cy, int rx, int ry, lv_color_t color, lv_opa_t opa) {
+    lv_area_t area = {
+        .x1 = cx - rx,
+        .y1 = cy - ry,
+        .x2 = cx + rx,
+        .y2 = cy + ry,
+    };
+
+    if (c->layer == NULL) {
+        lv_area_t outer = { area.x1 - AA_MARGIN, area.y1 - AA_MARGIN,
+                            area.x2 + AA_MARGIN, area.y2 + AA_MARGIN };
+        canvas_add(c, &outer, color, opa);
+        return;
+    }
+
+    /* Use filled rectangle with rounded corners for approximate ellipse
+     * (LVGL has no direct filled ellipse) */
     lv_draw_rect_dsc_t rect_dsc;
     lv_draw_rect_dsc_init(&rect_dsc);
     rect_dsc.bg_color = color;
@@ -98,26 +216,33 @@ static void draw_ellipse(lv_layer_t *layer, int cx, int cy, int rx, int ry, lv_c
     rect_dsc.radius = LV_RADIUS_CIRCLE;
     rect_dsc.border_width = 0;
 
-    lv_area_t area = {
-        .x1 = cx - rx,
-        .y1 = cy - ry,
-        .x2 = cx + rx,
-        .y2 = cy + ry,
-    };
-    lv_draw_rect(layer, &rect_dsc, &area);
+    lv_draw_rect(c->layer, &rect_dsc, &area);
 }
 
 /**
  * @brief Draw a filled circle
  */
-static void draw_circle(lv_layer_t *layer, int cx, int cy, int r, lv_color_t color, lv_opa_t opa) {
-    draw_ellipse(layer, cx, cy, r, r, color, opa);
+static void draw_circle(face_canvas_t *c, int cx, int cy, int r, lv_color_t color, lv_opa_t opa) {
+    draw_ellipse(c, cx, cy, r, r, color, opa);
 }
 
 /**
  * @brief Draw a line
  */
-static void draw_line(lv_layer_t *layer, int x1, int y1, int x2, int y2, lv_color_t color, int width) {
+static void draw_line(face_canvas_t *c, int x1, int y1, int x2, int y2, lv_color_t color, int width) {
+    if (c->layer == NULL) {
+        /* Round caps reach half the width past each end point */
+        int ext = width / 2 + 1 + AA_MARGIN;
+        lv_area_t outer = {
+            .x1 = LV_MIN(x1, x2) - ext,
+            .y1 = LV_MIN(y1, y2) - ext,
+            .x2 = LV_MAX(x1, x2) + ext,
+            .y2 = LV_MAX(y1, y2) + ext,
+        };
+        canvas_add(c, &outer, color, LV_OPA_COVER);
+        return;
+    }
+
     lv_draw_line_dsc_t line_dsc;
     lv_draw_line_dsc_init(&line_dsc);
     line_dsc.color = color;
@@ -130,7 +255,7 @@ static void draw_line(lv_layer_t *layer, int x1, int y1, int x2, int y2, lv_colo
     line_dsc.p2.x = x2;
     line_dsc.p2.y = y2;
 
-    lv_draw_line(layer, &line_dsc);
+    lv_draw_line(c->layer, &line_dsc);
 }
 
 /*===========================================================================
@@ -157,7 +282,7 @@ static void draw_background(lv_layer_t *layer, const mochi_theme_t *theme) {
 /**
  * @brief Draw the main face shape
  */
-static void draw_face(lv_layer_t *layer, const mochi_face_params_t *p, const mochi_theme_t *theme) {
+static void draw_body(face_canvas_t *c, const mochi_face_params_t *p, const mochi_theme_t *theme) {
     int cx = FACE_CENTER_X + (int)p->face_offset_x;
     int cy = FACE_CENTER_Y + (int)p->face_offset_y;
 
@@ -168,43 +293,51 @@ static void draw_face(lv_layer_t *layer, const mochi_face_params_t *p, const moc
     int ry = (int)(FACE_RADIUS_Y * scale_y);
 
     /* Face shadow */
-    draw_ellipse(layer, cx + 3, cy + 5, rx + 3, ry + 3, theme->face_shadow, LV_OPA_30);
+    draw_ellipse(c, cx + 3, cy + 5, rx + 3, ry + 3, theme->face_shadow, LV_OPA_30);
 
     /* Main face */
-    draw_ellipse(layer, cx, cy, rx, ry, theme->face, LV_OPA_COVER);
+    draw_ellipse(c, cx, cy, rx, ry, theme->face, LV_OPA_COVER);
+}
+
+/**
+ * @brief Draw the face highlight (top-left, not squished)
+ */
+static void draw_highlight(face_canvas_t *c, const mochi_face_params_t *p, const mochi_theme_t *theme) {
+    int cx = FACE_CENTER_X + (int)p->face_offset_x;
+    int cy = FACE_CENTER_Y + (int)p->face_offset_y;
 
-    /* Face highlight (top-left) */
-    draw_ellipse(layer, cx - 15, cy - 35, 40, 20, theme->face_highlight, LV_OPA_50);
+    draw_ellipse(c, cx - 15, cy - 35, 40, 20, theme->face_highlight, LV_OPA_50);
 }
 
 /**
- * @brief Draw the blush circles
+ * @brief Draw one blush spot - layered for soft effect
  */
-static void draw_blush(lv_layer_t *layer, const mochi_face_params_t *p, const mochi_theme_t *theme) {
+static void draw_blush_side(face_canvas_t *c, bool is_right, const mochi_face_params_t *p, const mochi_theme_t *theme) {
     if (!p->show_blush) return;
 
     int cx = FACE_CENTER_X + (int)p->face_offset_x;
     int cy = FACE_CENTER_Y + (int)p->face_offset_y + BLUSH_Y;
 
-    /* Left blush - layered for soft effect */
     for (int i = 0; i < 3; i++) {
-        draw_ellipse(layer, cx - BLUSH_X + i, cy,
+        int x = is_right ? cx + BLUSH_X - i : cx - BLUSH_X + i;
+        draw_ellipse(c, x, cy,
                      BLUSH_RX - i * 3, BLUSH_RY - i * 2,
                      theme->blush, LV_OPA_60 - i * 10);
     }
+}
 
-    /* Right blush */
-    for (int i = 0; i < 3; i++) {
-        draw_ellipse(layer, cx + BLUSH_X - i, cy,
-                     BLUSH_RX - i * 3, BLUSH_RY - i * 2,
-                     theme->blush, LV_OPA_60 - i * 10);
-    }
+static void draw_blush_left(face_canvas_t *c, const mochi_face_params_t *p, const mochi_theme_t *theme) {
+    draw_blush_side(c, false, p, theme);
+}
+
+static void draw_blush_right(face_canvas_t *c, const mochi_face_params_t *p, const mochi_theme_t *theme) {
+    draw_blush_side(c, true, p, theme);
 }
 
 /**
  * @brief Draw a single eye
  */
-static void draw_eye(lv_layer_t *layer, int cx, int cy, bool is_right,
+static void draw_eye(face_canvas_t *c, int cx, int cy, bool is_right,
                      const mochi_face_params_t *p, const mochi_theme_t *theme) {
     /* Apply offsets */
     int ex = cx + (int)p->eye_offset_x;
@@ -220,13 +353,13 @@ static void draw_eye(lv_layer_t *layer, int cx, int cy, bool is_right,
     if (eye_h < 4) eye_h = 4;
 
     /* Eye background */
-    draw_ellipse(layer, ex, ey, eye_w, eye_h, theme->eye, LV_OPA_COVER);
+    draw_ellipse(c, ex, ey, eye_w, eye_h, theme->eye, LV_OPA_COVER);
 
     /* Pupil (if eyes not too squished) */
     if (eye_h > 8) {
         int pupil_offset_x = (int)(p->eye_offset_x * 0.15f);
         int pupil_offset_y = (int)(p->eye_offset_y * 0.1f);
-        draw_ellipse(layer, ex + pupil_offset_x, ey + 2 + pupil_offset_y,
+        draw_ellipse(c, ex + pupil_offset_x, ey + 2 + pupil_offset_y,
                      pupil_w, pupil_h, theme->pupil, LV_OPA_COVER);
     }
 
@@ -235,7 +368,7 @@ static void draw_eye(lv_layer_t *layer, int cx, int cy, bool is_right,
         int hl_x = is_right ? ex - 7 : ex - 7;
         int hl_y = ey - 10;
         int hl_r = (int)(7 * p->eye_scale);
-        draw_circle(layer, hl_x + (int)(p->eye_offset_x * 0.5f),
+        draw_circle(c, hl_x + (int)(p->eye_offset_x * 0.5f),
                     hl_y + (int)(p->eye_offset_y * 0.3f),
                     hl_r, lv_color_white(), LV_OPA_COVER);
     }
@@ -245,30 +378,34 @@ static void draw_eye(lv_layer_t *layer, int cx, int cy, bool is_right,
         int sp_x = is_right ? ex + 5 : ex + 5;
         int sp_y = ey + 5;
         int sp_r = (int)(3 * p->eye_scale);
-        draw_circle(layer, sp_x + (int)(p->eye_offset_x * 0.3f),
+        draw_circle(c, sp_x + (int)(p->eye_offset_x * 0.3f),
                     sp_y + (int)(p->eye_offset_y * 0.2f),
                     sp_r, theme->accent, LV_OPA_80);
     }
 }
 
 /**
- * @brief Draw both eyes
+ * @brief Draw one eye (positioned relative to the face center)
  */
-static void draw_eyes(lv_layer_t *layer, const mochi_face_params_t *p, const mochi_theme_t *theme) {
+static void draw_eye_part(face_canvas_t *c, bool is_right, const mochi_face_params_t *p, const mochi_theme_t *theme) {
     int cx = FACE_CENTER_X + (int)p->face_offset_x;
     int cy = FACE_CENTER_Y + (int)p->face_offset_y + EYE_Y;
 
-    /* Left eye */
-    draw_eye(layer, cx + LEFT_EYE_X, cy, false, p, theme);
+    draw_eye(c, cx + (is_right ? RIGHT_EYE_X : LEFT_EYE_X), cy, is_right, p, theme);
+}
 
-    /* Right eye */
-    draw_eye(layer, cx + RIGHT_EYE_X, cy, true, p, theme);
+static void draw_eye_left(face_canvas_t *c, const mochi_face_params_t *p, const mochi_theme_t *theme) {
+    draw_eye_part(c, false, p, theme);
+}
+
+static void draw_eye_right(face_canvas_t *c, const mochi_face_params_t *p, const mochi_theme_t *theme) {
+    draw_eye_part(c, true, p, theme);
 }
 
 /**
  * @brief Draw the mouth
  */
-static void draw_mouth(lv_layer_t *layer, const mochi_face_params_t *p, const mochi_theme_t *theme) {
+static void draw_mouth(face_canvas_t *c, const mochi_face_params_t *p, const mochi_theme_t *theme) {
     int cx = FACE_CENTER_X + (int)p->face_offset_x;
     int cy = FACE_CENTER_Y + (int)p->face_offset_y + MOUTH_Y;
     float open = p->mouth_open;
@@ -278,51 +415,180 @@ static void draw_mouth(lv_layer_t *layer, const mochi_face_params_t *p, const mo
     switch (p->mouth_type) {
         case MOCHI_MOUTH_SMILE:
             /* Curved smile - draw as two lines meeting at center */
-            draw_line(layer, cx - SCALE(20), cy, cx, cy + (int)(SCALE(12) * open), theme->mouth, lw);
-            draw_line(layer, cx, cy + (int)(SCALE(12) * open), cx + SCALE(20), cy, theme->mouth, lw);
+            draw_line(c, cx - SCALE(20), cy, cx, cy + (int)(SCALE(12) * open), theme->mouth, lw);
+            draw_line(c, cx, cy + (int)(SCALE(12) * open), cx + SCALE(20), cy, theme->mouth, lw);
             break;
 
         case MOCHI_MOUTH_OPEN_SMILE:
             /* Open mouth */
-            draw_ellipse(layer, cx, cy + SCALE(5), (int)(SCALE(18) * open), (int)(SCALE(15) * open),
+            draw_ellipse(c, cx, cy + SCALE(5), (int)(SCALE(18) * open), (int)(SCALE(15) * open),
                          theme->mouth, LV_OPA_COVER);
             break;
 
         case MOCHI_MOUTH_SMALL_O:
             /* Small O shape */
-            draw_ellipse(layer, cx, cy, (int)(SCALE(10) * open), (int)(SCALE(12) * open),
+            draw_ellipse(c, cx, cy, (int)(SCALE(10) * open), (int)(SCALE(12) * open),
                          theme->mouth, LV_OPA_COVER);
             break;
 
         case MOCHI_MOUTH_SMIRK:
             /* Angled smirk */
-            draw_line(layer, cx - SCALE(15), cy + SCALE(5), cx + SCALE(20), cy - SCALE(8), theme->mouth, lw);
+            draw_line(c, cx - SCALE(15), cy + SCALE(5), cx + SCALE(20), cy - SCALE(8), theme->mouth, lw);
             break;
 
         case MOCHI_MOUTH_FLAT:
             /* Horizontal line */
-            draw_line(layer, cx - SCALE(18), cy, cx + SCALE(18), cy, theme->mouth, lw + 1);
+            draw_line(c, cx - SCALE(18), cy, cx + SCALE(18), cy, theme->mouth, lw + 1);
             break;
 
         case MOCHI_MOUTH_WAVY:
             /* Wavy line */
-            draw_line(layer, cx - SCALE(20), cy, cx - SCALE(7), cy + SCALE(8), theme->mouth, lw);
-            draw_line(layer, cx - SCALE(7), cy + SCALE(8), cx + SCALE(7), cy, theme->mouth, lw);
-            draw_line(layer, cx + SCALE(7), cy, cx + SCALE(20), cy + SCALE(8), theme->mouth, lw);
+            draw_line(c, cx - SCALE(20), cy, cx - SCALE(7), cy + SCALE(8), theme->mouth, lw);
+            draw_line(c, cx - SCALE(7), cy + SCALE(8), cx + SCALE(7), cy, theme->mouth, lw);
+            draw_line(c, cx + SCALE(7), cy, cx + SCALE(20), cy + SCALE(8), theme->mouth, lw);
             break;
 
         case MOCHI_MOUTH_SCREAM:
             /* Large O scream */
-            draw_ellipse(layer, cx, cy + SCALE(5), SCALE(22), SCALE(25), theme->mouth, LV_OPA_COVER);
+            draw_ellipse(c, cx, cy + SCALE(5), SCALE(22), SCALE(25), theme->mouth, LV_OPA_COVER);
             break;
 
         default:
             /* Default to simple smile */
-            draw_line(layer, cx - SCALE(15), cy, cx + SCALE(15), cy + SCALE(10), theme->mouth, lw);
+            draw_line(c, cx - SCALE(15), cy, cx + SCALE(15), cy + SCALE(10), theme->mouth, lw);
             break;
     }
 }
 
+/*===========================================================================
+ * Dirty Rectangles
+ *===========================================================================*/
+
+typedef void (*face_part_fn)(face_canvas_t *c, const mochi_face_params_t *p, const mochi_theme_t *theme);
+
+/* Back to front */
+static const face_part_fn s_part_fns[FACE_PART_COUNT] = {
+    [FACE_PART_BODY]        = draw_body,
+    [FACE_PART_HIGHLIGHT]   = draw_highlight,
+    [FACE_PART_BLUSH_LEFT]  = draw_blush_left,
+    [FACE_PART_BLUSH_RIGHT] = draw_blush_right,
+    [FACE_PART_EYE_LEFT]    = draw_eye_left,
+    [FACE_PART_EYE_RIGHT]   = draw_eye_right,
+    [FACE_PART_MOUTH]       = draw_mouth,
+};
+
+/* Parts that only change with the expression, theme or squish */
+static const bool s_part_cacheable[FACE_PART_COUNT] = {
+    [FACE_PART_BODY]        = true,
+    [FACE_PART_HIGHLIGHT]   = true,
+    [FACE_PART_BLUSH_LEFT]  = true,
+    [FACE_PART_BLUSH_RIGHT] = true,
+};
+
+typedef struct {
+    face_part_t part;
+    const mochi_face_params_t *params;
+} sprite_ctx_t;
+
+static void render_sprite_cb(lv_layer_t *layer, void *ctx) {
+    const sprite_ctx_t *sc = ctx;
+    face_canvas_t canvas = { .layer = layer };
+    s_part_fns[sc->part](&canvas, sc->params, s_cached_theme);
+}
+
+/**
+ * @brief Invalidate the parts that look different from the last update
+ *
+ * Parts are measured at zero face offset: every part moves rigidly with
+ * the face offset, so the same measurement gives the sprite key and,
+ * shifted, the on-screen bounds. A changed part invalidates where it was
+ * and where it is now; LVGL merges overlapping areas. Parts that did not
+ * change cost nothing. Cacheable parts then look up their sprite.
+ */
+static void invalidate_changed_parts(void) {
+    bool changed = false;
+    mochi_face_params_t p0 = s_cached_params;
+    p0.face_offset_x = 0.0f;
+    p0.face_offset_y = 0.0f;
+    s_offset_x = (int)s_cached_params.face_offset_x;
+    s_offset_y = (int)s_cached_params.face_offset_y;
+
+    mochi_sprite_cache_tick();
+
+    for (int i = 0; i < FACE_PART_COUNT; i++) {
+        face_canvas_t m = { .layer = NULL, .empty = true, .hash = 2166136261u };
+        s_part_fns[i](&m, &p0, s_cached_theme);
+
+        s_sprites[i].img = NULL;
+        if (s_part_cacheable[i] && !m.empty) {
+            mochi_sprite_key_t key = {
+                .hash = m.hash,
+                .w = (uint16_t)lv_area_get_width(&m.bounds),
+                .h = (uint16_t)lv_area_get_height(&m.bounds),
+                .part = (uint8_t)i,
+            };
+            sprite_ctx_t ctx = { .part = (face_part_t)i, .params = &p0 };
+            s_sprites[i].img = mochi_sprite_cache_get(&key, &m.bounds, render_sprite_cb, &ctx);
+            s_sprites[i].area = m.bounds;
+        }
+
+        lv_area_move(&m.bounds, s_offset_x, s_offset_y);
+        m.hash = hash_mix(hash_mix(m.hash, s_offset_x), s_offset_y);
+
+        face_part_state_t *st = &s_parts[i];
+        if (!s_full_redraw && (m.hash != st->hash || m.empty != st->empty)) {
+            if (!st->empty) lv_obj_invalidate_area(s_face_obj, &st->bounds);
+            if (!m.empty) lv_obj_invalidate_area(s_face_obj, &m.bounds);
+            changed = true;
+        }
+        st->bounds = m.bounds;
+        st->empty = m.empty;
+        st->hash = m.hash;
+    }
+
+    if (s_full_redraw) {
+        lv_obj_invalidate(s_face_obj);
+        s_full_redraw = false;
+        s_stats.full_frames++;
+    } else if (!changed) {
+        s_stats.static_frames++;
+    }
+}
+
+/**
+ * @brief Close the pixel count of the frame drawn since the last update
+ */
+static void account_frame(void) {
+    if (s_stats.frames > 0) {
+        s_stats.last_frame_px = s_frame_px;
+        if (s_frame_px > s_stats.max_frame_px) s_stats.max_frame_px = s_frame_px;
+        s_stats.total_px += s_frame_px;
+    }
+    s_frame_px = 0;
+    s_stats.frames++;
+}
+
+/**
+ * @brief Draw every part, blitting the resolved sprites if @p use_sprites
+ */
+static void draw_parts(lv_layer_t *layer, bool use_sprites) {
+    face_canvas_t canvas = { .layer = layer };
+
+    for (int i = 0; i < FACE_PART_COUNT; i++) {
+        if (use_sprites && s_sprites[i].img != NULL) {
+            lv_draw_image_dsc_t img_dsc;
+            lv_draw_image_dsc_init(&img_dsc);
+            img_dsc.src = s_sprites[i].img;
+
+            lv_area_t area = s_sprites[i].area;
+            lv_area_move(&area, s_offset_x, s_offset_y);
+            lv_draw_image(layer, &img_dsc, &area);
+        } else {
+            s_part_fns[i](&canvas, &s_cached_params, s_cached_theme);
+        }
+    }
+}
+
 /*===========================================================================
  * Draw Event Callback - Direct Layer Drawing
  *===========================================================================*/
@@ -331,7 +597,9 @@ static void draw_mouth(lv_layer_t *layer, const mochi_face_params_t *p, const mo
  * @brief Draw callback for LV_EVENT_DRAW_MAIN
  *
  * This draws directly to the display's render layer - no separate buffer needed!
- * Called automatically by LVGL when the object needs to be redrawn.
+ * Called automatically by LVGL when the object needs to be redrawn, once
+ * per invalidated area (and render-buffer stripe); draw tasks outside the
+ * clip area are dropped by LVGL.
  */
 static void face_draw_cb(lv_event_t *e) {
     if (s_cached_theme == NULL) return;
@@ -342,10 +610,28 @@ static void face_draw_cb(lv_event_t *e) {
 
     /* Draw all face elements directly to the display layer */
     draw_background(layer, s_cached_theme);
-    draw_face(layer, &s_cached_params, s_cached_theme);
-    draw_blush(layer, &s_cached_params, s_cached_theme);
-    draw_eyes(layer, &s_cached_params, s_cached_theme);
-    draw_mouth(layer, &s_cached_params, s_cached_theme);
+    draw_parts(layer, true);
+
+    /* The clip area is the part of this object being redrawn */
+    s_frame_px += lv_area_get_size(&layer->_clip_area);
+}
+
+/**
+ * @brief Cover check for LV_EVENT_COVER_CHECK
+ *
+ * The white background is opaque, so LVGL can start redrawing a dirty
+ * area at this object instead of painting the screen behind it first.
+ */
+static void face_cover_cb(lv_event_t *e) {
+    const lv_area_t *area = lv_event_get_cover_area(e);
+    lv_area_t coords;
+    lv_obj_get_coords(s_face_obj, &coords);
+    if (area->x1 >= coords.x1 && area->y1 >= coords.y1 &&
+        area->x2 <= coords.x2 && area->y2 <= coords.y2) {
+        lv_event_set_cover_res(e, LV_COVER_RES_COVER);
+    } else {
+        lv_event_set_cover_res(e, LV_COVER_RES_NOT_COVER);
+    }
 }
 
 /*===========================================================================
@@ -374,8 +660,10 @@ void mochi_face_create(lv_obj_t *parent) {
     /* Register draw callback - this is where the magic happens!
      * LVGL will call face_draw_cb with the display's layer when redrawing */
     lv_obj_add_event_cb(s_face_obj, face_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_add_event_cb(s_face_obj, face_cover_cb, LV_EVENT_COVER_CHECK, NULL);
 
     s_visible = true;
+    s_full_redraw = true;   /* First update paints everything */
 
     ESP_LOGI(TAG, "Face created successfully - full screen rendering enabled!");
 }
@@ -388,18 +676,99 @@ void mochi_face_destroy(void) {
     lv_obj_delete(s_face_obj);
     s_face_obj = NULL;
     s_cached_theme = NULL;
+
+    memset(s_sprites, 0, sizeof(s_sprites));
+    mochi_sprite_cache_clear();
 }
 
 void mochi_face_update(const mochi_face_params_t *params, const mochi_theme_t *theme) {
     if (s_face_obj == NULL || params == NULL || theme == NULL) return;
 
+    account_frame();
+
     /* Cache params for redraw - will be used in face_draw_cb */
     memcpy(&s_cached_params, params, sizeof(mochi_face_params_t));
     s_cached_theme = theme;
 
-    /* Invalidate triggers LV_EVENT_DRAW_MAIN -> face_draw_cb */
-    lv_obj_invalidate(s_face_obj);
+    /* Invalidate only what moved - triggers LV_EVENT_DRAW_MAIN -> face_draw_cb */
+    invalidate_changed_parts();
+}
+
+void mochi_face_get_stats(mochi_face_stats_t *stats) {
+    if (stats == NULL) return;
+
+    *stats = s_stats;
+    stats->full_frame_px = CANVAS_WIDTH * CANVAS_HEIGHT;
+    mochi_sprite_cache_get_stats(&stats->sprites);
+}
+
+void mochi_face_reset_stats(void) {
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_frame_px = 0;
+    mochi_sprite_cache_reset_stats();
+}
+
+#if CONFIG_APP_SELF_TEST
+esp_err_t mochi_face_benchmark(uint32_t frames, mochi_face_bench_t *result) {
+    if (frames == 0 || result == NULL) return ESP_ERR_INVALID_ARG;
+    if (s_face_obj == NULL || s_cached_theme == NULL || lv_display_get_default() == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    /* Two updates make the current sprites stable enough to be rendered */
+    mochi_face_stats_t saved = s_stats;
+    for (int i = 0; i < 2; i++) {
+        invalidate_changed_parts();
+    }
+    s_stats = saved;
+
+    uint32_t stride = CANVAS_WIDTH * sizeof(uint16_t);
+    uint32_t size = stride * BENCH_STRIPE_ROWS;
+    uint8_t *stripe = heap_caps_malloc(size, MALLOC_CAP_8BIT);
+    if (stripe == NULL) return ESP_ERR_NO_MEM;
+
+    lv_draw_buf_t buf;
+    lv_draw_buf_init(&buf, CANVAS_WIDTH, BENCH_STRIPE_ROWS, LV_COLOR_FORMAT_RGB565, stride, stripe, size);
+
+    uint32_t elapsed_us[2];
+    for (int use_sprites = 0; use_sprites < 2; use_sprites++) {
+        int64_t start = esp_timer_get_time();
+
+        for (uint32_t f = 0; f < frames; f++) {
+            for (int32_t y0 = 0; y0 < CANVAS_HEIGHT; y0 += BENCH_STRIPE_ROWS) {
+                lv_layer_t layer;
+                memset(&layer, 0, sizeof(layer));
+                layer.draw_buf = &buf;
+                layer.color_format = LV_COLOR_FORMAT_RGB565;
+                layer.buf_area = (lv_area_t){ 0, y0, CANVAS_WIDTH - 1, y0 + BENCH_STRIPE_ROWS - 1 };
+                layer._clip_area = (lv_area_t){ 0, y0, CANVAS_WIDTH - 1,
+                                                LV_MIN(y0 + BENCH_STRIPE_ROWS, CANVAS_HEIGHT) - 1 };
+                layer.phy_clip_area = layer._clip_area;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+                lv_matrix_identity(&layer.matrix);
+#endif
+
+                draw_background(&layer, s_cached_theme);
+                draw_parts(&layer, use_sprites);
+                bsp_display_finish_layer(&layer);
+            }
+        }
+
+        elapsed_us[use_sprites] = (uint32_t)(esp_timer_get_time() - start);
+    }
+
+    heap_caps_free(stripe);
+
+    result->frames = frames;
+    result->vector_frame_us = elapsed_us[0] / frames;
+    result->sprite_frame_us = elapsed_us[1] / frames;
+
+    ESP_LOGI(TAG, "Benchmark: %lu frames, vectors %lu us/frame, sprites %lu us/frame",
+             (unsigned long)frames, (unsigned long)result->vector_frame_us,
+             (unsigned long)result->sprite_frame_us);
+    return ESP_OK;
 }
+#endif /* CONFIG_APP_SELF_TEST */
 
 void mochi_face_set_visible(bool visible) {
     if (s_face_obj == NULL) return;
@@ -13,6 +13,7 @@
 
 #include "mochi_state.h"
 #include "mochi_theme.h"
+#include "frame_governor.h"
 #include "esp_log.h"
 #include <math.h>
 
@@ -23,7 +24,10 @@ static const char *TAG = "mochi_particles";
  *===========================================================================*/
 
 #define PI                      3.14159265358979f
-#define PARTICLE_TIMER_MS       50  /* 20 FPS - matches face animation */
+#define PARTICLE_MIN_FPS        8
+#define PARTICLE_MAX_FPS        20  /* Matches the face animation's usual rate */
+#define PARTICLE_IDLE_FPS       10  /* Drifting zzz */
+#define SWEAT_SPEED_MS_PER_PX   25  /* Sweat drops fall 40 px/s */
 #define DISPLAY_WIDTH           240
 #define DISPLAY_HEIGHT          284
 #define CENTER_X                120
@@ -44,18 +48,18 @@ static struct {
     lv_obj_t *container;
     lv_obj_t *particles[8];  /* Up to 8 particle objects */
     lv_obj_t *labels[3];     /* For ZZZ text */
-    lv_timer_t *timer;
+    frame_gov_handle_t timer;
 
     mochi_particle_type_t current_type;
     const mochi_theme_t *theme;
-    uint32_t frame;
+    uint32_t time_ms;           /* Particle clock (ms), sampled from the governor */
     int particle_count;
 } s_particles = {
     .container = NULL,
     .timer = NULL,
     .current_type = MOCHI_PARTICLE_NONE,
     .theme = NULL,
-    .frame = 0,
+    .time_ms = 0,
     .particle_count = 0,
 };
 
@@ -172,8 +176,8 @@ static void create_zzz_particles(void) {
  * Particle Update Functions
  *===========================================================================*/
 
-static void update_float_particles(uint32_t frame) {
-    float t = frame * PARTICLE_TIMER_MS / 1000.0f;
+static void update_float_particles(uint32_t time_ms) {
+    float t = time_ms / 1000.0f;
 
     for (int i = 0; i < FLOAT_COUNT && s_particles.particles[i] != NULL; i++) {
         int x = (int)(CENTER_X + sinf(t * 0.02f + i * 1.5f) * 100 - 50);
@@ -188,8 +192,8 @@ static void update_float_particles(uint32_t frame) {
     }
 }
 
-static void update_burst_particles(uint32_t frame) {
-    float t = frame * PARTICLE_TIMER_MS / 1000.0f;
+static void update_burst_particles(uint32_t time_ms) {
+    float t = time_ms / 1000.0f;
 
     for (int i = 0; i < BURST_COUNT && s_particles.particles[i] != NULL; i++) {
         float angle = ((float)i / BURST_COUNT) * 2 * PI + t * 0.1f;
@@ -201,8 +205,8 @@ static void update_burst_particles(uint32_t frame) {
     }
 }
 
-static void update_sweat_particles(uint32_t frame) {
-    int sweat_y = (frame * 2) % 60;
+static void update_sweat_particles(uint32_t time_ms) {
+    int sweat_y = (time_ms / SWEAT_SPEED_MS_PER_PX) % 60;
 
     if (s_particles.particles[0] != NULL) {
         lv_obj_set_pos(s_particles.particles[0], CENTER_X - 75, 60 + sweat_y);
@@ -212,8 +216,8 @@ static void update_sweat_particles(uint32_t frame) {
     }
 }
 
-static void update_sparkle_particles(uint32_t frame) {
-    float t = frame * PARTICLE_TIMER_MS / 1000.0f;
+static void update_sparkle_particles(uint32_t time_ms) {
+    float t = time_ms / 1000.0f;
 
     for (int i = 0; i < SPARKLE_COUNT && s_particles.particles[i] != NULL; i++) {
         int x = (int)(80 + i * 45 + sinf(t * 0.1f + i) * 10);
@@ -228,8 +232,8 @@ static void update_sparkle_particles(uint32_t frame) {
     }
 }
 
-static void update_spiral_particles(uint32_t frame) {
-    float t = frame * PARTICLE_TIMER_MS / 1000.0f;
+static void update_spiral_particles(uint32_t time_ms) {
+    float t = time_ms / 1000.0f;
 
     for (int i = 0; i < SPIRAL_COUNT && s_particles.particles[i] != NULL; i++) {
         float angle = t * 0.15f + i * 2;
@@ -240,8 +244,8 @@ static void update_spiral_particles(uint32_t frame) {
     }
 }
 
-static void update_zzz_particles(uint32_t frame) {
-    float t = frame * PARTICLE_TIMER_MS / 1000.0f;
+static void update_zzz_particles(uint32_t time_ms) {
+    float t = time_ms / 1000.0f;
     float offset = sinf(t * 0.05f) * 5;
 
     int base_x = CENTER_X + 55;
@@ -260,27 +264,27 @@ static void update_zzz_particles(uint32_t frame) {
  * Timer Callback
  *===========================================================================*/
 
-static void particles_timer_cb(lv_timer_t *timer) {
-    s_particles.frame++;
+static void particles_timer_cb(const anim_clock_t *clock, void *user_data) {
+    s_particles.time_ms = anim_clock_ms(clock);
 
     switch (s_particles.current_type) {
         case MOCHI_PARTICLE_FLOAT:
-            update_float_particles(s_particles.frame);
+            update_float_particles(s_particles.time_ms);
             break;
         case MOCHI_PARTICLE_BURST:
-            update_burst_particles(s_particles.frame);
+            update_burst_particles(s_particles.time_ms);
             break;
         case MOCHI_PARTICLE_SWEAT:
-            update_sweat_particles(s_particles.frame);
+            update_sweat_particles(s_particles.time_ms);
             break;
         case MOCHI_PARTICLE_SPARKLE:
-            update_sparkle_particles(s_particles.frame);
+            update_sparkle_particles(s_particles.time_ms);
             break;
         case MOCHI_PARTICLE_SPIRAL:
-            update_spiral_particles(s_particles.frame);
+            update_spiral_particles(s_particles.time_ms);
             break;
         case MOCHI_PARTICLE_ZZZ:
-            update_zzz_particles(s_particles.frame);
+            update_zzz_particles(s_particles.time_ms);
             break;
         default:
             break;
@@ -317,17 +321,21 @@ void mochi_particles_create(lv_obj_t *parent) {
         s_particles.labels[i] = NULL;
     }
 
-    s_particles.frame = 0;
+    s_particles.time_ms = 0;
     s_particles.current_type = MOCHI_PARTICLE_NONE;
 
-    /* Create timer for particle animation */
-    s_particles.timer = lv_timer_create(particles_timer_cb, PARTICLE_TIMER_MS, NULL);
-    lv_timer_pause(s_particles.timer);
+    /* Register particle animation with the frame governor */
+    frame_gov_client_config_t cfg = FRAME_GOV_CLIENT_DEFAULT("mochi_particles", particles_timer_cb, NULL);
+    cfg.min_fps = PARTICLE_MIN_FPS;
+    cfg.max_fps = PARTICLE_MAX_FPS;
+    cfg.idle_fps = PARTICLE_IDLE_FPS;
+    s_particles.timer = frame_gov_register(&cfg);
+    frame_gov_pause(s_particles.timer);
 }
 
 void mochi_particles_destroy(void) {
     if (s_particles.timer != NULL) {
-        lv_timer_delete(s_particles.timer);
+        frame_gov_unregister(s_particles.timer);
         s_particles.timer = NULL;
     }
 
@@ -351,45 +359,48 @@ void mochi_particles_set_type(mochi_particle_type_t type, const mochi_theme_t *t
 
     s_particles.current_type = type;
     s_particles.theme = theme;
-    s_particles.frame = 0;
+    s_particles.time_ms = 0;
+    frame_gov_set_time(s_particles.timer, 0);
 
     /* Clear existing particles */
     clear_particles();
+    frame_gov_set_idle(s_particles.timer, type == MOCHI_PARTICLE_ZZZ);
 
     /* Create new particles based on type */
     switch (type) {
         case MOCHI_PARTICLE_FLOAT:
             create_float_particles();
-            lv_timer_resume(s_particles.timer);
+            frame_gov_resume(s_particles.timer);
             break;
         case MOCHI_PARTICLE_BURST:
             create_burst_particles();
-            lv_timer_resume(s_particles.timer);
+            frame_gov_resume(s_particles.timer);
             break;
         case MOCHI_PARTICLE_SWEAT:
             create_sweat_particles();
-            lv_timer_resume(s_particles.timer);
+            frame_gov_resume(s_particles.timer);
             break;
         case MOCHI_PARTICLE_SPARKLE:
             create_sparkle_particles();
-            lv_timer_resume(s_particles.timer);
+            frame_gov_resume(s_particles.timer);
             break;
         case MOCHI_PARTICLE_SPIRAL:
             create_spiral_particles();
-            lv_timer_resume(s_particles.timer);
+            frame_gov_resume(s_particles.timer);
             break;
         case MOCHI_PARTICLE_ZZZ:
             create_zzz_particles();
-            lv_timer_resume(s_particles.timer);
+            frame_gov_resume(s_particles.timer);
             break;
         case MOCHI_PARTICLE_NONE:
         default:
-            lv_timer_pause(s_particles.timer);
+            frame_gov_pause(s_particles.timer);
             break;
     }
 }
 
 void mochi_particles_update(int frame) {
-    /* Called externally if needed - currently handled by timer */
-    s_particles.frame = frame;
+    /* Called externally if needed - currently handled by timer; @p frame counts 20 FPS frames */
+    s_particles.time_ms = (uint32_t)frame * 50;
+    frame_gov_set_time(s_particles.timer, s_particles.time_ms);
 }
@@ -0,0 +1,277 @@
+/**
+ * @file mochi_sprite_cache.c
+ * @brief Pre-rendered face-part bitmaps
+ *
+ * A sprite is rendered in horizontal stripes into a small ARGB8888 scratch
+ * layer (the software renderer cannot target RGB565A8) and each stripe is
+ * packed into the sprite's RGB565 and A8 planes. At 3 bytes per pixel the
+ * highlight and both blush spots take about 14 KB; a body (shadow + face)
+ * is about 56 KB per squish size.
+ */
+
+#include "mochi_sprite_cache.h"
+#include "bsp_board.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "sdkconfig.h"
+#include <string.h>
+
+static const char *TAG = "mochi_sprite";
+
+/*===========================================================================
+ * Constants
+ *===========================================================================*/
+
+#define SPRITE_SLOTS        8
+#define SPRITE_PENDING      8
+#define SPRITE_KEEP_TICKS   30      /* ~1.5 s at 20 FPS before a sprite may be evicted */
+#define SPRITE_STRIPE_ROWS  16      /* Scratch layer height */
+#define SPRITE_BUDGET       ((uint32_t)CONFIG_MOCHI_FACE_SPRITE_CACHE_KB * 1024)
+
+/*===========================================================================
+ * Types
+ *===========================================================================*/
+
+typedef struct {
+    mochi_sprite_key_t key;
+    lv_image_dsc_t img;
+    uint8_t *data;              /* NULL = free slot */
+    uint32_t bytes;
+    uint32_t last_tick;
+} sprite_entry_t;
+
+typedef struct {
+    mochi_sprite_key_t key;
+    uint32_t tick;
+    bool valid;
+} sprite_pending_t;
+
+/*===========================================================================
+ * Static Variables
+ *===========================================================================*/
+
+static sprite_entry_t s_entries[SPRITE_SLOTS];
+static sprite_pending_t s_pending[SPRITE_PENDING];  /* Keys missed recently */
+static uint32_t s_tick;
+static mochi_sprite_stats_t s_stats;
+
+/*===========================================================================
+ * Helpers
+ *===========================================================================*/
+
+static bool key_equal(const mochi_sprite_key_t *a, const mochi_sprite_key_t *b) {
+    return a->hash == b->hash && a->w == b->w && a->h == b->h && a->part == b->part;
+}
+
+static bool entry_idle(const sprite_entry_t *e) {
+    return s_tick - e->last_tick >= SPRITE_KEEP_TICKS;
+}
+
+static void entry_free(sprite_entry_t *e) {
+    lv_image_cache_drop(&e->img);
+    heap_caps_free(e->data);
+    s_stats.bytes -= e->bytes;
+    s_stats.count--;
+    memset(e, 0, sizeof(*e));
+}
+
+/**
+ * @brief Remember a miss; true if the same key also missed last frame
+ */
+static bool pending_is_stable(const mochi_sprite_key_t *key) {
+    sprite_pending_t *slot = &s_pending[0];
+
+    for (int i = 0; i < SPRITE_PENDING; i++) {
+        sprite_pending_t *p = &s_pending[i];
+        if (p->valid && key_equal(&p->key, key)) {
+            bool stable = (s_tick - p->tick == 1);
+            p->tick = s_tick;
+            if (stable) p->valid = false;
+            return stable;
+        }
+        if (!p->valid || (slot->valid && p->tick < slot->tick)) slot = p;
+    }
+
+    slot->key = *key;
+    slot->tick = s_tick;
+    slot->valid = true;
+    return false;
+}
+
+/**
+ * @brief Evict idle sprites (LRU first) until @p bytes fit; returns a free slot
+ *
+ * Nothing is evicted unless the request can be satisfied.
+ */
+static sprite_entry_t *make_room(uint32_t bytes) {
+    uint32_t reclaimable = 0;
+    bool have_slot = false;
+
+    for (int i = 0; i < SPRITE_SLOTS; i++) {
+        sprite_entry_t *e = &s_entries[i];
+        if (e->data == NULL) {
+            have_slot = true;
+        } else if (entry_idle(e)) {
+            reclaimable += e->bytes;
+            have_slot = true;
+        }
+    }
+    if (!have_slot || s_stats.bytes - reclaimable + bytes > SPRITE_BUDGET) return NULL;
+
+    for (;;) {
+        sprite_entry_t *free_slot = NULL;
+        sprite_entry_t *lru = NULL;
+        for (int i = 0; i < SPRITE_SLOTS; i++) {
+            sprite_entry_t *e = &s_entries[i];
+            if (e->data == NULL) {
+                if (free_slot == NULL) free_slot = e;
+            } else if (entry_idle(e) && (lru == NULL || e->last_tick < lru->last_tick)) {
+                lru = e;
+            }
+        }
+        if (free_slot != NULL && s_stats.bytes + bytes <= SPRITE_BUDGET) return free_slot;
+        if (lru == NULL) return NULL;
+
+        entry_free(lru);
+        s_stats.evictions++;
+    }
+}
+
+/**
+ * @brief Render @p area into RGB565A8 planes at @p data
+ */
+static bool render(uint8_t *data, const lv_area_t *area, mochi_sprite_draw_fn draw, void *ctx) {
+    if (lv_display_get_default() == NULL) return false;
+
+    int32_t w = lv_area_get_width(area);
+    int32_t h = lv_area_get_height(area);
+    uint32_t stride = (uint32_t)w * sizeof(lv_color32_t);
+    uint32_t scratch_size = stride * SPRITE_STRIPE_ROWS;
+    uint8_t *scratch = heap_caps_malloc(scratch_size, MALLOC_CAP_8BIT);
+    if (scratch == NULL) return false;
+
+    lv_draw_buf_t buf;
+    lv_draw_buf_init(&buf, w, SPRITE_STRIPE_ROWS, LV_COLOR_FORMAT_ARGB8888, stride, scratch, scratch_size);
+
+    uint16_t *rgb = (uint16_t *)data;
+    uint8_t *alpha = data + (uint32_t)w * h * 2;
+
+    for (int32_t y0 = area->y1; y0 <= area->y2; y0 += SPRITE_STRIPE_ROWS) {
+        int32_t y1 = LV_MIN(y0 + SPRITE_STRIPE_ROWS - 1, area->y2);
+        lv_draw_buf_clear(&buf, NULL);
+
+        lv_layer_t layer;
+        memset(&layer, 0, sizeof(layer));
+        layer.draw_buf = &buf;
+        layer.color_format = LV_COLOR_FORMAT_ARGB8888;
+        layer.buf_area = (lv_area_t){ area->x1, y0, area->x2, y0 + SPRITE_STRIPE_ROWS - 1 };
+        layer._clip_area = (lv_area_t){ area->x1, y0, area->x2, y1 };
+        layer.phy_clip_area = layer._clip_area;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+        lv_matrix_identity(&layer.matrix);
+#endif
+
+        draw(&layer, ctx);
+        bsp_display_finish_layer(&layer);
+
+        /* Straight-alpha ARGB8888 -> RGB565 plane + A8 plane */
+        for (int32_t y = y0; y <= y1; y++) {
+            const lv_color32_t *src = (const lv_color32_t *)(scratch + (uint32_t)(y - y0) * stride);
+            uint32_t row = (uint32_t)(y - area->y1) * w;
+            for (int32_t x = 0; x < w; x++) {
+                rgb[row + x] = (uint16_t)(((src[x].red & 0xF8) << 8) | ((src[x].green & 0xFC) << 3) |
+                                          (src[x].blue >> 3));
+                alpha[row + x] = src[x].alpha;
+            }
+        }
+    }
+
+    heap_caps_free(scratch);
+    return true;
+}
+
+/*===========================================================================
+ * Public Functions
+ *===========================================================================*/
+
+void mochi_sprite_cache_tick(void) {
+    s_tick++;
+}
+
+const lv_image_dsc_t *mochi_sprite_cache_get(const mochi_sprite_key_t *key, const lv_area_t *area,
+                                             mochi_sprite_draw_fn draw, void *ctx) {
+    for (int i = 0; i < SPRITE_SLOTS; i++) {
+        sprite_entry_t *e = &s_entries[i];
+        if (e->data != NULL && key_equal(&e->key, key)) {
+            e->last_tick = s_tick;
+            s_stats.hits++;
+            return &e->img;
+        }
+    }
+
+    s_stats.misses++;
+    if (SPRITE_BUDGET == 0 || !pending_is_stable(key)) return NULL;
+
+    uint32_t bytes = (uint32_t)key->w * key->h * 3;
+    sprite_entry_t *e = make_room(bytes);
+    if (e == NULL) return NULL;
+
+    uint8_t *data = heap_caps_malloc(bytes, MALLOC_CAP_8BIT);
+    if (data == NULL) {
+        ESP_LOGW(TAG, "No memory for %ux%u sprite", key->w, key->h);
+        return NULL;
+    }
+
+    int64_t start = esp_timer_get_time();
+    if (!render(data, area, draw, ctx)) {
+        heap_caps_free(data);
+        return NULL;
+    }
+    s_stats.render_us += (uint32_t)(esp_timer_get_time() - start);
+    s_stats.renders++;
+
+    e->key = *key;
+    e->data = data;
+    e->bytes = bytes;
+    e->last_tick = s_tick;
+    e->img.header.magic = LV_IMAGE_HEADER_MAGIC;
+    e->img.header.cf = LV_COLOR_FORMAT_RGB565A8;
+    e->img.header.w = key->w;
+    e->img.header.h = key->h;
+    e->img.header.stride = key->w * 2;     /* RGB565 plane; the A8 plane uses half */
+    e->img.data_size = bytes;
+    e->img.data = data;
+
+    s_stats.bytes += bytes;
+    s_stats.count++;
+    if (s_stats.bytes > s_stats.peak_bytes) s_stats.peak_bytes = s_stats.bytes;
+
+    ESP_LOGD(TAG, "Rendered part %u sprite %ux%u (%lu/%lu bytes)", key->part, key->w, key->h,
+             (unsigned long)s_stats.bytes, (unsigned long)SPRITE_BUDGET);
+    return &e->img;
+}
+
+void mochi_sprite_cache_clear(void) {
+    for (int i = 0; i < SPRITE_SLOTS; i++) {
+        if (s_entries[i].data != NULL) entry_free(&s_entries[i]);
+    }
+    memset(s_pending, 0, sizeof(s_pending));
+}
+
+void mochi_sprite_cache_get_stats(mochi_sprite_stats_t *stats) {
+    if (stats == NULL) return;
+
+    *stats = s_stats;
+    stats->budget_bytes = SPRITE_BUDGET;
+}
+
+void mochi_sprite_cache_reset_stats(void) {
+    uint32_t bytes = s_stats.bytes;
+    uint32_t count = s_stats.count;
+
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.bytes = bytes;
+    s_stats.peak_bytes = bytes;
+    s_stats.count = count;
+}
@@ -0,0 +1,86 @@
+/**
+ * @file mochi_sprite_cache.h
+ * @brief Pre-rendered face-part bitmaps (internal to app_mibuddy)
+ *
+ * Anti-aliased LV_RADIUS_CIRCLE rectangles are the most expensive thing
+ * the LVGL software renderer draws, and its circle cache only holds
+ * CONFIG_LV_DRAW_SW_CIRCLE_CACHE_SIZE radii. Face parts that look the same
+ * from frame to frame are rendered once into an RGB565A8 bitmap and
+ * blitted afterwards.
+ *
+ * Sprites are keyed by what they contain (part, size and a hash of every
+ * primitive's geometry, color and opacity), so a new expression or theme
+ * simply yields new keys. Memory is bounded by
+ * CONFIG_MOCHI_FACE_SPRITE_CACHE_KB; least recently used sprites are
+ * evicted, but only once they have been idle for a while, so a working
+ * set larger than the budget falls back to vector drawing instead of
+ * re-rendering every frame.
+ *
+ * All functions must be called from the LVGL task (or with the LVGL lock
+ * held), outside of a display refresh.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "lvgl.h"
+#include "mochi_state.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Sprite identity
+ */
+typedef struct {
+    uint32_t hash;      /**< Hash of the primitives (geometry, color, opacity) */
+    uint16_t w;
+    uint16_t h;
+    uint8_t part;       /**< Caller-defined part id */
+} mochi_sprite_key_t;
+
+/**
+ * @brief Draws a sprite's content into @p layer (absolute coordinates)
+ */
+typedef void (*mochi_sprite_draw_fn)(lv_layer_t *layer, void *ctx);
+
+/**
+ * @brief Start a new frame
+ *
+ * Sprites not looked up for a number of frames become evictable. A key
+ * missed in two consecutive frames gets rendered, so one-frame shapes
+ * (a squash mid-bounce) never cost a render.
+ */
+void mochi_sprite_cache_tick(void);
+
+/**
+ * @brief Look up a sprite, rendering it if it is stable and fits
+ *
+ * @param key Sprite identity (w/h must match @p area)
+ * @param area Absolute area @p draw paints into
+ * @param draw Renders the content on a miss
+ * @param ctx Passed to @p draw
+ * @return The sprite, or NULL to draw the part as vectors this frame
+ */
+const lv_image_dsc_t *mochi_sprite_cache_get(const mochi_sprite_key_t *key, const lv_area_t *area,
+                                             mochi_sprite_draw_fn draw, void *ctx);
+
+/**
+ * @brief Free every sprite (counters are kept)
+ */
+void mochi_sprite_cache_clear(void);
+
+/**
+ * @brief Snapshot the cache counters
+ */
+void mochi_sprite_cache_get_stats(mochi_sprite_stats_t *stats);
+
+/**
+ * @brief Clear the cache counters
+ */
+void mochi_sprite_cache_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -277,6 +277,12 @@ static void log_sound_asset(const char *label, const mochi_sound_asset_t *asset)
                  asset->embedded.pcm_len,
                  (unsigned long)asset->embedded.sample_rate,
                  asset->embedded.channels);
+    } else if (asset->source == MOCHI_ASSET_EMBEDDED_ADPCM && asset->adpcm) {
+        ESP_LOGI(TAG, "  %s: Embedded ADPCM (%zu samples @ %lu Hz, %zu bytes)",
+                 label,
+                 asset->adpcm->samples,
+                 (unsigned long)asset->adpcm->sample_rate,
+                 asset->adpcm->data_len);
     } else if (asset->source == MOCHI_ASSET_SDCARD) {
         ESP_LOGI(TAG, "  %s: SD Card [%s]", label, asset->sd_path ? asset->sd_path : "null");
     }
@@ -339,7 +345,10 @@ static void apply_state_assets(mochi_state_t state) {
     /* Stop any previously playing audio before starting new sounds */
     mochi_stop_asset_sound();
 
-    /* Play enter sound if configured (one-shot, blocks until complete for embedded PCM) */
+    /* Keep this state's SD sounds decoded in RAM; the last state's become evictable */
+    mochi_pin_state_sounds(cfg);
+
+    /* Play enter sound if configured (one-shot, queued on the mixer for embedded PCM) */
     if (cfg->audio.enter.source != MOCHI_ASSET_NONE) {
         /* Silently try to play - file may not exist */
         mochi_play_asset_sound(&cfg->audio.enter, false);
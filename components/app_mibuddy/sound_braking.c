@@ -1,3363 +1,1092 @@
 /**
  * @file sound_braking.c
- * @brief Embedded audio - "Braking/caught sound"
+ * @brief Embedded audio - "Braking/caught sound" (IMA-ADPCM)
  *
- * Converted from is_braking.mp3
+ * Generated by tools/gen_adpcm_asset.py from the 16-bit PCM array in
+ * 37a0295:components/app_mibuddy/sound_braking.c (converted from is_braking.mp3)
  * Sample rate: 16000 Hz
  * Channels: 1 (mono)
- * Bits: 16-bit signed PCM
+ * Format: IMA-ADPCM, 256-byte blocks
  * Duration: ~2.1 seconds
+ * Size: 16953 bytes (16-bit PCM: 66874 bytes)
+ * SNR vs source: 24.2 dB
+ *
+ * Command (in components/audio_play):
+ *   python3 tools/gen_adpcm_asset.py 37a0295:components/app_mibuddy/sound_braking.c sound_braking \
+ *       --brief 'Braking/caught sound' > ../app_mibuddy/sound_braking.c
  */
 
 #include <stddef.h>
 #include <stdint.h>
+#include "audio_adpcm.h"
 
-const int16_t sound_braking[] = {
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, -1, 0, 0, 0, -1, 0, 0, -1, -1,
-    0, 0, 0, -1, 0, 0, 0, -1, -1, -1,
-    -1, 0, 0, -1, -1, -2, 0, 0, -1, 0,
-    0, 0, -2, -1, -1, -1, -1, -2, 0, 0,
-    -1, 0, 0, 0, -1, -2, 0, -1, 0, 0,
-    0, 0, -1, 0, 0, 0, 0, 0, 0, -1,
-    -1, -1, 0, -1, 0, -1, -1, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-    -1, -1, 0, -1, -2, -1, -2, -1, -2, -2,
-    -1, -3, -1, -1, -1, 0, 0, 0, 1, 0,
-    0, 0, 0, 1, 0, 0, -1, 1, 0, 0,
-    -1, -2, -2, -2, 0, -1, 0, 0, 1, 1,
-    1, 4, 2, 2, 2, 3, 3, 2, 2, 4,
-    6, 8, 6, 3, 5, 6, 3, 1, 2, 2,
-    1, 1, 1, 2, 0, 0, 0, 0, 0, -1,
-    0, -1, 1, -1, 0, 3, 3, 2, 0, 1,
-    1, 0, 0, 3, 2, 3, 4, 7, 5, 4,
-    6, 5, 5, 1, 3, 3, 4, 2, 0, 2,
-    1, 3, 2, 2, 1, 0, 1, 0, 1, 2,
-    1, 2, 0, 1, 1, -1, 0, 1, 0, 0,
-    2, 3, 5, 2, 2, 0, 1, 3, 1, 0,
-    -1, 2, 2, 1, -1, 2, 1, 0, 1, 2,
-    3, 1, 2, 3, 4, 3, 7, 4, 3, 3,
-    5, 3, 2, 6, 5, 5, 2, 5, 2, 6,
-    3, 3, 2, 2, 7, 3, 4, 2, 5, 2,
-    4, 4, 3, 3, 3, 5, 4, 5, 6, 8,
-    6, 7, 4, 2, 6, 5, 3, 3, 1, 1,
-    6, 6, 5, 3, 6, 8, 4, 3, 4, 3,
-    1, 4, 4, 5, 6, 4, 5, 3, 5, 4,
-    4, 8, 8, 6, 3, 6, 5, 5, 4, 2,
-    5, 6, 5, 5, 8, 8, 7, 5, 6, 8,
-    6, 2, 3, 3, 2, 4, 6, 4, 5, 3,
-    2, 4, 2, 3, 3, 6, 5, 4, 5, 5,
-    3, 5, 6, 3, 7, 5, 4, 4, 5, 3,
-    5, 4, 4, 8, 5, 4, 5, 4, 4, 5,
-    6, 8, 7, 6, 5, 5, 3, 3, 5, 3,
-    5, 5, 3, 5, 5, 3, 3, 7, 5, 6,
-    6, 7, 6, 3, 4, 5, 4, 5, 5, 5,
-    5, 1, 2, 4, 4, 5, 5, 1, 2, 1,
-    -2, -1, -2, -4, -6, -4, -4, -4, -3, -1,
-    0, -2, -2, -3, -3, -2, -4, -1, 2, 3,
-    3, 2, 0, -1, -4, -3, -4, -2, 0, 0,
-    -1, -4, -3, -6, -8, -6, -5, -3, -2, 0,
-    0, -6, -5, -3, -7, -5, -4, 0, 1, -1,
-    0, 0, -4, -1, -2, -5, -2, -1, -2, 0,
-    0, -1, -1, -3, 0, 0, 0, -1, -1, 1,
-    2, 2, 0, 0, 2, 1, 1, 0, -3, -2,
-    0, 0, -1, -2, 0, 2, 5, 3, 0, 0,
-    2, 3, 2, 0, 0, 1, 2, 0, 0, 0,
-    -1, 5, 5, -1, 2, 2, 0, 2, 1, 0,
-    -1, -3, -1, 0, -1, -1, 1, 2, 1, 5,
-    3, 0, 0, -1, -1, 1, 2, 3, 1, 1,
-    1, -3, -3, -3, -3, 0, 6, 4, 0, -4,
-    -3, 0, 0, 2, 0, 0, 1, -1, 0, 2,
-    0, 2, 2, 2, 0, -2, -4, -6, -4, 0,
-    5, 4, 2, 1, 5, 0, -5, 1, 0, -4,
-    -1, 0, 0, -3, -4, 3, 1, -5, -6, -6,
-    -3, -5, -4, -2, -5, 1, 8, 0, -3, 0,
-    2, 0, -3, -5, 1, 2, -1, 0, -8, -6,
-    -4, -6, -7, 2, 0, -2, -1, 7, 8, 1,
-    10, 8, 8, 12, 7, 5, 11, 12, 15, 11,
-    19, 14, 3, -8, -5, 8, 9, 16, 21, 33,
-    27, 25, 16, -4, -22, -27, -32, -26, -23, -30,
-    -28, -19, -5, -7, -24, -20, -5, -17, -7, -13,
-    -19, -3, 5, -7, -17, -14, -19, -13, -27, -33,
-    -24, -26, -7, -2, -20, -44, -54, -50, -64, -67,
-    -78, -82, -63, -81, -100, -141, -174, -107, 29, 144,
-    176, 207, 181, 142, 170, 167, 152, 108, 18, -19,
-    -94, -194, -212, -242, -207, -98, 36, 132, 171, 208,
-    196, 109, 57, 42, 37, -33, -41, 0, -94, -80,
-    -61, -172, -253, -283, -243, -104, -31, -28, -43, -98,
-    -215, -359, -504, -610, -561, -399, -140, 183, 399, 461,
-    465, 396, 231, 19, -152, -288, -300, -128, 8, 76,
-    91, 80, 41, -81, -145, -103, -29, -1, 43, 228,
-    423, 483, 452, 350, 240, 120, 42, 22, 43, 123,
-    218, 241, 156, 46, -139, -355, -482, -523, -446, -191,
-    81, 332, 547, 651, 672, 591, 379, 113, -121, -283,
-    -323, -278, -211, -139, -53, -16, -87, -287, -560, -828,
-    -982, -1014, -960, -704, -271, 189, 535, 743, 857, 892,
-    887, 687, 227, -256, -625, -893, -1007, -932, -823, -694,
-    -412, -91, 151, 266, 221, 78, -18, 3, -15, -157,
-    -314, -430, -490, -320, 36, 157, 93, 212, 443, 627,
-    715, 515, 79, -148, -72, -30, -143, -262, -362, -368,
-    -308, -461, -879, -1020, -575, 250, 1022, 1315, 1092, 852,
-    955, 1010, 588, 12, -318, -440, -266, -27, -82, -313,
-    -226, 140, 503, 632, 375, 193, 448, 709, 702, 451,
-    143, 74, 254, 684, 961, 685, 227, 287, 417, 128,
-    -53, -19, -10, -71, -533, -964, -712, -208, 20, 23,
-    -29, -200, -183, -252, -911, -1376, -789, 421, 1188, 983,
-    695, 693, 501, 260, 84, -187, -549, -778, -799, -536,
-    -333, -715, -1108, -797, -209, 516, 781, 130, -443, 52,
-    1130, 1361, 323, -559, -213, 517, 462, -225, -677, -819,
-    -613, -61, 226, -250, -487, 348, 1456, 1505, 633, -89,
-    -386, -827, -1382, -1806, -2021, -1694, -645, 828, 1921, 2590,
-    2853, 2264, 1093, 103, -969, -2333, -3334, -3074, -1905, -912,
-    -446, 167, 991, 1626, 1879, 1164, -185, -894, -622, 48,
-    411, 134, -132, 61, 736, 866, -351, -1530, -1300, -417,
-    272, 445, 273, 262, 360, 395, 210, -591, -1343, -970,
-    -107, 193, -174, -384, -7, 324, 311, -74, -1031, -1599,
-    -1300, -515, 715, 1637, 1571, 1189, 872, 441, -161, -1192,
-    -1866, -1337, -313, 554, 1054, 1166, 1237, 1117, 1112, 1079,
-    272, -228, 208, 770, 1158, 1016, 314, -234, -304, -31,
-    -79, -431, -498, -391, 9, 630, 591, 179, 414, 692,
-    161, -712, -834, 544, 2440, 3173, 2319, 325, -1095, -1095,
-    -999, -1676, -2991, -3133, -422, 2661, 3253, 1687, -193, -49,
-    1516, 676, -2291, -3382, -1637, 929, 2214, 1918, 956, -96,
-    245, 1498, 38, -2869, -2552, 395, 2370, 2507, 1619, 0,
-    -1261, -1196, -1644, -3508, -4449, -3195, -947, 1166, 3142, 4313,
-    3754, 2140, 737, -280, -1966, -4424, -5783, -4403, -808, 2364,
-    3469, 2764, 1210, 972, 1878, 757, -2431, -4616, -3518, 42,
-    2066, 713, -1559, -1845, 144, 1342, -166, -2041, -1549, 1113,
-    3278, 3376, 2260, 903, -136, -588, -1546, -3987, -5355, -3295,
-    -192, 1249, 1681, 2405, 2815, 2517, 1558, -319, -1830, -2404,
-    -2027, -325, 1204, 1873, 1704, 586, -610, -1543, -2037, -2153,
-    -1816, -611, 966, 2145, 2503, 1951, 691, -844, -2178, -3056,
-    -2840, -1523, -106, 1022, 2243, 3359, 3409, 2238, 493, -865,
-    -1366, -1672, -2276, -2650, -1812, -199, 341, -449, -970, 58,
-    2904, 5811, 5510, 2265, 2, 371, 921, -1554, -6222, -8226,
-    -5215, -290, 1811, 528, 32, 3050, 6351, 5245, 997, -2156,
-    -2750, -1203, 894, 230, -2706, -2102, 2312, 3596, 674, -1680,
-    -1554, 629, 3639, 4647, 2035, -673, -268, 542, -1379, -4551,
-    -5973, -4498, -826, 2534, 3140, 2702, 3479, 3971, 2787, 490,
-    -1799, -3682, -4524, -3209, -581, 1554, 2269, 1998, 2234, 3057,
-    2863, 973, -1685, -3343, -2679, -510, 433, -955, -1945, -117,
-    2085, 1371, -787, -1544, -732, 920, 3267, 4259, 2217, 111,
-    301, 77, -2428, -4648, -4668, -3262, -979, 1817, 3495, 3645,
-    3755, 3698, 2300, -272, -3031, -3758, -1981, -550, -138, 92,
-    30, 181, 786, 587, -910, -2057, -1741, -301, 1419, 2473,
-    2184, 770, -219, 150, -57, -2068, -3668, -2559, -203, 816,
-    969, 1694, 3153, 4251, 3829, 1778, -978, -3222, -3911, -3839,
-    -4391, -4346, -2015, 701, 890, 24, 1816, 6311, 9011, 6423,
-    1293, -1339, -1465, -1998, -4835, -8871, -9346, -4734, 124, 1354,
-    1038, 2679, 5795, 6924, 4657, 644, -2501, -2716, -987, -1385,
-    -4864, -6068, -2332, 937, 681, 745, 1841, 2809, 4991, 6213,
-    2811, -1852, -2917, -2784, -4033, -4723, -3809, -1571, 1385, 3309,
-    3551, 2489, 1095, -90, -988, -778, -763, -2244, -3019, -2081,
-    -654, 1489, 2933, 1428, -863, -396, 1406, 1103, -526, -1706,
-    -1872, -242, 991, -969, -3234, -2507, -428, -68, -613, 334,
-    2275, 4103, 5330, 4601, 1450, -1595, -2616, -3442, -5540, -6212,
-    -4087, -813, 2854, 5533, 5430, 3216, 822, -164, -380, -1566,
-    -2194, -805, 1414, 2579, 2043, 588, -1333, -2298, -1619, -1691,
-    -2837, -2628, -1169, 365, 1615, 2226, 1512, 155, -237, -319,
-    -1231, -1717, -850, 207, 757, 1427, 2189, 1437, -117, -622,
-    -383, -769, -2337, -2980, -1449, 7, 330, -421, -2437, -3212,
-    -460, 4305, 6912, 5533, 3292, 3022, 3530, 2249, -2534, -9114,
-    -11607, -7809, -2067, 174, -697, 1507, 7122, 8648, 4289, -220,
-    -1823, -1930, -1057, -116, -1985, -3701, -884, 2574, 1608, -1074,
-    -573, 1991, 2723, 1329, -935, -2633, -1845, 65, 794, 166,
-    -329, 1299, 3673, 3316, 765, -1219, -1439, -207, 1114, 1501,
-    445, -1612, -2776, -1674, 236, 1818, 3177, 3197, 2150, 1898,
-    2358, 1405, -1825, -4866, -4724, -1936, 716, 912, -446, -559,
-    1098, 2415, 1943, 846, 795, 1632, 1746, 1111, 23, -1620,
-    -2570, -2484, -2393, -1999, -662, 1497, 2939, 2449, 1416, 759,
-    441, 58, -901, -1655, -1290, -13, 1212, 653, -1446, -2386,
-    -1264, 150, -194, -1076, -412, 574, 767, 1437, 2171, 1222,
-    -513, -1260, -1806, -2569, -2354, -1572, -363, 1308, 2727, 3679,
-    3719, 1906, -897, -3078, -4490, -5345, -5329, -3656, -561, 2021,
-    2731, 1784, 1397, 4373, 7650, 6021, 932, -1943, -350, 1350,
-    -1365, -6366, -8125, -4540, 1090, 3193, 1165, 688, 4884, 8717,
-    6513, 308, -4351, -5533, -3823, -850, -969, -3584, -1589, 4918,
-    7255, 3507, 171, -107, -120, -843, -2285, -4524, -4345, -1310,
-    1082, 1500, 524, 383, 2388, 3801, 3452, 2495, 1541, 773,
-    -548, -1981, -3130, -4905, -6291, -5649, -3275, 1012, 5774, 7175,
-    5486, 4681, 5655, 4899, 433, -4918, -7584, -6546, -3332, -1905,
-    -3140, -2765, 1404, 5363, 4788, 1429, -845, -1129, -471, -159,
-    -1044, -2251, -1513, 1741, 3333, 1165, -830, -1354, -2320, -2763,
-    -1916, -1557, -1490, -285, 1785, 2716, 1098, -1083, -1125, -433,
-    -476, -371, -479, -398, 1194, 3712, 4093, 986, -2069, -2384,
-    -1557, -986, -1371, -2043, -862, 1608, 2765, 1199, -786, -913,
-    -525, -865, -1192, -1121, -597, 513, 1215, -7, -2082, -3135,
-    -3157, -979, 3298, 6190, 5931, 4844, 3619, 1386, -839, -3684,
-    -7623, -9799, -8325, -3668, 1622, 4356, 5524, 6716, 7294, 5682,
-    701, -4560, -5785, -4246, -3477, -3175, -1438, 1591, 4648, 6300,
-    4697, 882, -1413, -999, -1275, -3310, -3903, -2883, -1533, -589,
-    -1478, -2593, -766, 3812, 7814, 6598, 1958, -36, 516, 86,
-    -2790, -6998, -9489, -7572, -3126, -153, 1000, 2842, 5866, 7627,
-    6407, 3468, 985, -507, -1952, -4121, -5479, -4480, -1674, 726,
-    349, -1197, -1278, -698, -148, 254, 677, 2576, 5163, 6378,
-    5668, 3070, -1361, -5434, -6855, -6598, -5189, -1725, 2579, 5671,
-    6814, 5636, 3096, 201, -3220, -6959, -8600, -5930, -898, 2266,
-    2320, 2096, 3705, 6004, 5011, -328, -4946, -3821, 1011, 2333,
-    -887, -2549, -841, 435, -107, -1273, -2570, -2349, 401, 2980,
-    3065, 1858, 2240, 3426, 1524, -3278, -6928, -7190, -4281, 352,
-    3611, 4559, 6023, 8025, 6629, 1695, -3975, -8376, -10003, -8664,
-    -4941, -629, 2733, 4929, 5909, 5914, 4680, 1542, -2262, -4432,
-    -3619, -1106, -178, -624, -221, 435, 469, 179, -434, -1822,
-    -2075, 595, 3171, 3544, 1961, 33, -1954, -4957, -5781, -2305,
-    3177, 6834, 6878, 6110, 6965, 6143, 1000, -6611, -11589, -10701,
-    -6162, -2472, -1847, 1102, 7546, 10620, 8029, 3018, -812, -1514,
-    -440, -627, -4074, -6511, -2478, 2425, 2748, -57, -3576, -3668,
-    447, 2816, 1419, -119, 1012, 3452, 2806, -2105, -7388, -7158,
-    -542, 5880, 5543, 2054, 2031, 3962, 3171, -1757, -8622, -11765,
-    -8494, -4341, -2180, -31, 4603, 10008, 11174, 8524, 4180, 896,
-    -152, -2077, -5670, -7757, -6031, -2820, -483, 867, 135, -1281,
-    45, 2454, 2529, 606, 284, 2654, 3269, 868, -1479, -3029,
-    -3010, 781, 3836, 2409, 1007, 1640, 2240, 1640, -686, -4138,
-    -6847, -7906, -6216, -1522, 3402, 6010, 6084, 4645, 4322, 4405,
-    2104, -1213, -3759, -4637, -3299, -1539, -1371, -1978, -2562, -1557,
-    894, 1700, 789, 563, 2678, 4196, 2472, -878, -3598, -4172,
-    -1268, 4374, 6701, 4385, 2428, 2819, 3912, 1546, -5517, -11257,
-    -10749, -5920, -1628, -1089, -397, 4962, 10956, 11202, 6211, 1086,
-    -1399, -934, 459, -1373, -6591, -8371, -3402, 1800, 678, -2741,
-    -2299, 1134, 4651, 4906, 1720, -494, 194, -134, -2803, -3200,
-    1211, 5483, 4793, 1987, 745, -262, -2717, -6752, -11050, -11196,
-    -7212, -2625, 3, 2385, 7867, 12920, 12336, 6697, 1260, -1410,
-    -2379, -3433, -6694, -10737, -9875, -2818, 1829, -9, -1641, 534,
-    4354, 6261, 4763, 2321, 1571, 2704, 2674, -1922, -7232, -6288,
-    -153, 3473, 1162, -2344, -2651, -752, 627, -255, -2846, -4225,
-    -2700, 1268, 4556, 4829, 4350, 4334, 2321, -388, -194, 707,
-    -47, -2362, -4118, -3492, -2504, -2675, -3299, -3588, -1476, 2073,
-    3774, 4067, 4518, 5325, 4306, 1849, -844, -4398, -7071, -6034,
-    -2024, 1582, 3922, 5073, 4822, 4209, 3245, 1465, -1706, -4970,
-    -6695, -6527, -3665, 399, 3975, 4358, 1417, -296, 1391, 4215,
-    3748, -560, -3378, -2658, -2442, -3835, -4219, -3174, -1700, 656,
-    2920, 3883, 4944, 6529, 5640, 597, -4777, -6111, -3454, 1294,
-    5098, 4274, 1766, 2679, 4550, 1788, -5278, -9745, -7322, -2143,
-    367, -932, -1386, 2422, 7555, 9438, 5901, 1110, -860, 93,
-    1985, -618, -6537, -7502, -3483, 343, 1799, 904, -241, 1050,
-    2757, 2673, 906, -1509, -3168, -3437, -144, 5694, 6824, 1386,
-    -368, 3782, 3750, -3015, -9029, -9852, -6049, -6, 3472, 2467,
-    581, 2381, 7441, 10956, 7789, 162, -3655, -1738, 413, -1700,
-    -6607, -9857, -8305, -2270, 2636, 993, -881, 4357, 10311, 10078,
-    5943, 1781, -2037, -4882, -4959, -5800, -7450, -4109, 1247, 2977,
-    2283, 1174, -139, -1522, -2055, -1960, -1724, -1074, -85, 1649,
-    4747, 7605, 6555, 2269, -824, -310, -1060, -5467, -9112, -9140,
-    -5721, -2012, -396, 185, 693, 1679, 5014, 8109, 6624, 2117,
-    -12, 152, -873, -2249, -2491, -2289, -1660, 1037, 2938, 1021,
-    -578, 614, 1436, 13, -1925, -2703, -1699, -70, -170, -1170,
-    5, 3225, 4397, 2090, -913, -2756, -2942, -3140, -5114, -5480,
-    -2157, 1134, 2686, 3879, 4104, 2494, 1812, 2712, 748, -4521,
-    -6120, -2608, 2215, 6057, 5434, 2676, 3438, 4759, 49, -8060,
-    -12283, -10308, -4990, 376, 1665, 328, 3579, 10156, 12608, 8071,
-    1547, -1993, -3582, -5269, -7703, -10303, -10054, -5448, 1472, 7045,
-    8373, 5404, 1783, 729, -242, -3401, -6630, -7693, -4860, 2058,
-    8597, 9515, 6705, 5209, 4386, 1430, -4703, -11286, -13870, -10474,
-    -3833, -153, 682, 2335, 5304, 9299, 11800, 9700, 3229, -2108,
-    -1315, -740, -4872, -9477, -10001, -4763, 2855, 6396, 2807, -259,
-    2457, 4373, 1130, -4059, -8009, -7225, -489, 7297, 10136, 8634,
-    7019, 5021, 1321, -3766, -8541, -11195, -10462, -5555, 645, 4034,
-    4789, 5981, 9256, 10778, 6533, -71, -4023, -5230, -4980, -4674,
-    -6075, -6829, -3175, 2564, 5064, 3246, -847, -3074, -1522, 1189,
-    2249, 1502, 1395, 3230, 4412, 2048, -3291, -7180, -7213, -6497,
-    -5910, -4676, -3003, 1551, 10101, 15299, 11765, 4779, 1365, -212,
-    -3783, -7917, -10770, -10176, -5419, 568, 4409, 8086, 11039, 9015,
-    4528, 778, -3194, -7311, -9936, -10320, -8435, -3950, 1518, 4811,
-    5454, 4209, 2155, -232, -2360, -1569, 3851, 9217, 9086, 5552,
-    3018, 1743, -919, -5501, -8411, -7672, -4104, 51, 1048, 379,
-    486, 1340, 2149, 914, -2695, -5048, -2498, 2017, 1725, -1922,
-    -3646, -2535, 1094, 4011, 2809, 315, 1182, 2281, 798, -2209,
-    -4978, -4376, 849, 6384, 6422, 2654, 1352, 2484, 628, -5697,
-    -11381, -11486, -7728, -2331, 1221, 650, 1558, 5776, 10172, 12708,
-    11695, 7704, 2249, -1497, -3958, -6709, -8183, -10549, -10748, -4733,
-    1376, 2857, 1929, 2394, 3909, 2769, -1066, -4659, -4660, -223,
-    5505, 8663, 7956, 5405, 2747, 833, -1973, -7298, -11935, -10863,
-    -4502, 1582, 4041, 3901, 2964, 4662, 7640, 5842, 37, -5253,
-    -6325, -3750, -670, -1248, -4725, -2727, 4692, 8036, 4365, -2748,
-    -6199, -2907, 1099, 2625, 3678, 6467, 8308, 5915, 1305, -4019,
-    -8521, -9888, -10233, -9657, -6337, -809, 6068, 11695, 13406, 10407,
-    6137, 3463, -998, -6973, -9239, -8178, -6616, -3555, 1695, 6735,
-    8884, 8033, 4827, -170, -3705, -5080, -7285, -9797, -9466, -5916,
-    675, 5387, 3084, 131, -232, -680, -11, 4254, 8411, 7002,
-    3492, 2468, 1282, -1488, -5488, -10040, -10352, -5608, 859, 4963,
-    4823, 2208, 1425, 3299, 2812, -861, -4562, -4231, 1214, 5748,
-    4924, 1774, -775, -1637, -1178, -1545, -3721, -3785, 527, 3738,
-    3214, -740, -4174, -2139, 2986, 5771, 3070, -1018, -457, 2956,
-    3197, -1914, -8444, -10015, -5520, 1329, 4085, -499, -3443, 1004,
-    7217, 8796, 5080, 249, -243, 2323, 1662, -2488, -8152, -11306,
-    -8894, -2917, 962, 583, 346, 2985, 6627, 6841, 1258, -4800,
-    -5128, -1710, 2812, 4663, 3550, 3524, 2969, 594, -2469, -5382,
-    -7398, -7237, -4057, 793, 3463, 3544, 3291, 4509, 6998, 6187,
-    1382, -3760, -6445, -5265, -1471, -1819, -5647, -4717, 986, 5517,
-    4797, 38, -3244, 28, 6519, 8729, 5210, 779, -1483, -3378,
-    -6663, -9673, -9633, -8155, -5077, 301, 5526, 9358, 11519, 11916,
-    9859, 5887, 151, -6605, -10910, -10238, -7540, -5134, -2658, 649,
-    5406, 9458, 11932, 10581, 4235, -1872, -3574, -3609, -4963, -6715,
-    -6418, -2978, 1083, 2838, 1291, -489, -536, -981, -3262, -4908,
-    -1597, 5448, 9435, 7372, 3229, -467, -2453, -3107, -4765, -7718,
-    -7619, -859, 6679, 7858, 3334, -845, -871, 432, -1469, -5016,
-    -5957, -2501, 2883, 4692, 1563, -2148, -1228, 2020, 1905, -1094,
-    -2759, -451, 2930, 2089, -3095, -6580, -4951, 937, 6495, 6461,
-    3713, 2844, 2939, 1578, -2898, -8608, -10463, -6851, 344, 4757,
-    3328, 933, 893, 4357, 7592, 6484, 3424, 1403, 413, -2216,
-    -6152, -7970, -8358, -7887, -4507, 122, 4208, 5660, 4628, 4866,
-    4026, -598, -4866, -4654, -557, 4046, 4478, 1414, -138, 959,
-    754, -3607, -7606, -7251, -3200, 1590, 2888, -359, -2350, 1845,
-    7028, 5915, 416, -2667, -1505, 1951, 2280, -2283, -6022, -5372,
-    -1600, 2771, 4950, 3545, 1640, 1551, 2554, 939, -4193, -6672,
-    -3480, 2073, 5237, 5193, 4469, 3666, 2296, 51, -5011, -9632,
-    -8729, -4203, 603, 2790, 3135, 2855, 4530, 8361, 7444, 960,
-    -4914, -6532, -2814, 2827, 2514, -2529, -3534, 2413, 7609, 6165,
-    204, -3984, -2572, -153, -1298, -6452, -9604, -5498, 2969, 9879,
-    10246, 4736, 591, 1108, 583, -5277, -11807, -11333, -5318, 1412,
-    5062, 3740, 1687, 3677, 8699, 9753, 4206, -2990, -5381, -2077,
-    1719, 563, -4763, -6059, -347, 5362, 5352, 507, -3751, -1868,
-    2447, 2963, 578, -1737, -1368, 112, -532, -3462, -4387, -1757,
-    763, 915, -331, -562, 915, 3595, 3946, 193, -3659, -2852,
-    -243, -82, -728, -156, 466, 960, 1426, 573, 613, 734,
-    -205, -1515, -3704, -4920, -4539, -3538, -2026, -831, -775, -777,
-    1061, 5470, 9056, 8229, 4029, 1311, 1561, 537, -3253, -8433,
-    -10562, -6988, -1470, 1561, 655, -805, 2693, 8792, 9721, 4861,
-    -920, -3235, -504, 1233, -3624, -8157, -5377, 1418, 6792, 7264,
-    3345, 595, 2296, 4228, 921, -5312, -8067, -5291, -410, 2524,
-    2711, 1993, 2128, 2875, 2160, -1844, -5519, -5421, -2911, 228,
-    1153, -863, -2168, -1078, 1923, 5535, 5653, 2295, -272, 728,
-    2750, 1752, -3422, -8478, -7098, -1175, 3065, 2623, 64, 108,
-    2942, 3043, -1931, -7749, -8281, -3707, 2381, 6079, 5430, 3979,
-    4041, 3587, -1803, -10072, -13475, -10705, -5645, -1066, 1061, 2329,
-    4732, 8916, 12527, 11149, 6370, 1248, -3172, -5437, -6351, -8125,
-    -8103, -3718, 1589, 5639, 8396, 7403, 3467, 1188, -594, -4299,
-    -7611, -7549, -4776, -620, 3661, 6754, 8135, 7621, 5304, 748,
-    -3232, -5895, -8432, -7950, -2228, 3513, 4284, 2328, 3837, 7955,
-    8403, 3972, -2525, -6675, -6697, -3870, -1927, -2658, -3445, -312,
-    5182, 7163, 4130, 143, -2286, -3668, -4792, -5807, -4311, 1185,
-    7600, 9389, 7226, 5011, 2746, -1613, -8322, -13541, -13189, -9377,
-    -5272, -1419, 2867, 7782, 11813, 13541, 10846, 5147, 97, -3268,
-    -6521, -10120, -11590, -7847, -2890, 1281, 6726, 9877, 8646, 6569,
-    4074, -1743, -7468, -9598, -8177, -4705, 625, 5763, 7612, 5798,
-    4114, 3280, -662, -6118, -9793, -9719, -4940, 429, 976, -429,
-    -120, 2772, 7262, 7916, 2998, -1812, -865, 3110, 3025, -2547,
-    -7458, -6812, -1783, 2799, 1934, -1652, -1200, 3475, 6119, 4113,
-    -681, -3917, -2097, 3489, 7929, 7535, 3991, 325, -1700, -3081,
-    -5467, -7962, -7955, -4910, -14, 4104, 4755, 2535, 1477, 4634,
-    8605, 6831, 895, -2583, -2149, -1563, -3389, -7364, -9354, -4955,
-    2630, 6673, 4269, -296, -389, 4006, 3994, -2291, -8204, -7714,
-    -2697, 791, 1654, 2386, 4901, 6582, 5412, 1755, -1875, -3635,
-    -3198, -2614, -1971, -540, 1623, 4009, 5136, 5305, 4349, 3111,
-    250, -3769, -5632, -4574, -2410, -952, -417, 761, 2793, 3565,
-    1961, -2058, -5411, -6031, -4787, -1922, 3337, 9014, 10731, 8662,
-    7235, 5974, 346, -7551, -12864, -14205, -11158, -6249, -1982, 2288,
-    7618, 12681, 13459, 8239, 1006, -3280, -3377, -1290, -2283, -7253,
-    -8235, -941, 6834, 8503, 5394, 2369, 3064, 3913, -212, -7379,
-    -10953, -8158, -1572, 3644, 5125, 3946, 2044, 2994, 3652, -1965,
-    -9538, -12419, -9551, -3144, 570, 506, 1132, 3569, 5971, 5238,
-    2816, 668, -1001, -970, 538, 344, -2150, -3442, -2814, -3209,
-    -2809, 413, 1952, 662, 0, 592, -773, -1909, 743, 4922,
-    7464, 7367, 5502, 3205, -344, -4889, -8598, -10400, -8605, -2877,
-    2834, 4904, 4569, 4033, 5726, 7578, 4148, -2181, -5773, -5817,
-    -3554, -3343, -5651, -4884, 759, 6301, 6945, 3603, 1090, 2007,
-    3227, 1696, -3081, -7493, -6007, 639, 5025, 3390, 24, 537,
-    3144, 2641, -2512, -8931, -10007, -4002, 3531, 5342, 1947, -936,
-    -89, 3905, 5136, 1073, -2927, -2323, 1774, 3149, -309, -3890,
-    -5124, -4222, -1971, 340, 989, 295, 777, 560, -886, -550,
-    2412, 5727, 4488, 1058, 1025, 1518, -1210, -6003, -9473, -9314,
-    -5796, -54, 4338, 5523, 6405, 7659, 7186, 4046, 321, -1914,
-    -2560, -1345, -1023, -2499, -2349, -673, 1245, 3388, 4206, 4240,
-    4666, 4698, 3454, 189, -4283, -8503, -9503, -6058, -196, 5542,
-    8929, 9991, 9249, 6388, 1917, -3677, -7830, -8469, -6721, -2816,
-    508, 135, -1278, 740, 6292, 9178, 4927, -1498, -3893, -2710,
-    -1372, -3103, -6833, -5207, 2163, 7532, 6704, 1365, -1185, 2438,
-    3798, -2143, -8674, -9014, -3104, 2953, 2324, -3545, -5456, -161,
-    5664, 3874, -4765, -9687, -4823, 3388, 6469, 3667, -348, -1396,
-    736, 2498, 28, -5600, -8374, -5220, 53, 2305, 857, -288,
-    752, 1756, 1283, -700, -3048, -3271, -243, 4161, 7081, 7522,
-    5439, 2322, -641, -4541, -8230, -9123, -6246, -1970, 1425, 6178,
-    10866, 11071, 7593, 2701, -2900, -8306, -9900, -7056, -3276, 1179,
-    4669, 5214, 5288, 5175, 2539, -2499, -5643, -5828, -5665, -3168,
-    1372, 4560, 6015, 5394, 2572, -987, -3182, -4011, -4810, -4175,
-    -750, 5125, 9972, 9301, 4204, -209, -1619, -3947, -8732, -10276,
-    -6423, 24, 5190, 5883, 3759, 3125, 5056, 4453, -1258, -6510,
-    -7196, -4636, -1680, -1060, -1919, -179, 4806, 8154, 7552, 4390,
-    136, -1417, -477, -2208, -6653, -9174, -6499, -406, 4361, 6448,
-    6192, 4921, 4278, 1665, -4235, -9731, -11969, -9595, -3888, 987,
-    3430, 3958, 4653, 8532, 11868, 9469, 3409, -1977, -4670, -6037,
-    -6853, -6849, -6963, -3531, 4398, 9265, 7185, 1554, -1104, 204,
-    235, -2242, -4731, -3378, 1909, 5822, 7096, 6255, 3470, 435,
-    -2802, -6009, -8011, -7825, -4655, 347, 3816, 3940, 2897, 2586,
-    3265, 3799, 1932, -1581, -5275, -7180, -5276, -2460, -1731, -1940,
-    -510, 2357, 3618, 2512, 108, -1270, -873, -1095, -1737, -1676,
-    1205, 6824, 8026, 4950, 3138, -348, -6383, -10163, -10706, -9331,
-    -6189, -1413, 3811, 8072, 10162, 9437, 7334, 4535, 12, -4825,
-    -7206, -6593, -5321, -4670, -2068, 2569, 6669, 9244, 8343, 4214,
-    332, -1487, -1775, -3471, -7218, -9038, -6212, 485, 6536, 7173,
-    4191, 2783, 2760, -74, -5659, -9994, -10498, -8004, -4070, 906,
-    4113, 3811, 4085, 6791, 8880, 7367, 1782, -3459, -4512, -3963,
-    -4253, -4900, -4852, -1323, 4254, 5736, 1475, -3850, -4829, -2036,
-    551, 1449, 934, 2389, 5353, 3139, -4157, -9097, -7567, -3289,
-    -650, 449, 2300, 7396, 11814, 9380, 2165, -4105, -6330, -6144,
-    -4235, -1063, 608, 2937, 5836, 6081, 3773, -663, -2974, -1933,
-    -2166, -3986, -4893, -2822, 152, 1605, 1617, -188, -1439, -2480,
-    -5248, -5321, -72, 6190, 8311, 8122, 7825, 4819, -536, -7046,
-    -11739, -11160, -7930, -4160, 342, 5423, 9290, 9275, 6876, 3058,
-    -1604, -4460, -4581, -3222, -3474, -4317, -1354, 3464, 6382, 6100,
-    3625, 2440, 3314, 3133, -1407, -7923, -9684, -5601, 1254, 7294,
-    7914, 4834, 3654, 4441, 2514, -4032, -10451, -11011, -5184, 2476,
-    5184, 2086, -881, 1254, 6821, 8939, 5183, 131, -1453, 570,
-    1344, -2623, -8197, -9221, -3298, 4137, 6239, 2270, -1948, -1734,
-    -9, -1433, -5469, -7688, -4824, 1841, 8531, 9625, 4473, 562,
-    1272, 3115, 816, -6191, -11233, -10516, -5976, -1431, -1105, -2142,
-    1328, 8349, 12308, 8619, 1497, -3477, -5335, -2807, -935, -5105,
-    -6532, -268, 6174, 8479, 5392, -463, -656, 3951, 5321, 954,
-    -5125, -6230, -3381, -3471, -6326, -7556, -5173, -491, 3245, 4471,
-    4025, 4524, 6324, 5839, 1855, -1879, -4088, -6098, -6311, -4120,
-    -1691, 353, 3636, 7841, 8675, 6399, 4705, 2325, -1556, -5289,
-    -7203, -6583, -4791, -3053, -1360, 671, 2596, 2243, 81, -1074,
-    -1204, 308, 4977, 8681, 8062, 4921, 880, -2444, -5498, -8287,
-    -7834, -4005, 1380, 6137, 8337, 8489, 6417, 2845, -1639, -7026,
-    -10557, -10933, -8630, -4106, 1945, 9030, 13608, 12899, 9911, 6874,
-    2591, -2893, -7679, -9364, -6981, -3949, -2358, -2724, -5148, -4467,
-    -371, 2767, 5394, 6569, 6631, 6799, 4029, -988, -5797, -9960,
-    -11673, -9892, -5990, -2007, 2489, 8901, 13831, 13548, 9149, 3768,
-    -459, -4976, -9405, -11152, -11272, -8373, -2007, 3504, 6497, 5278,
-    1253, -107, 348, 314, 1728, 4661, 6435, 5335, 1979, -1018,
-    -2813, -5142, -8618, -11021, -8494, -1470, 5020, 7940, 6628, 2757,
-    588, 19, -3520, -8864, -10286, -6699, -838, 3850, 4875, 3282,
-    3036, 4830, 4003, 48, -2484, -1599, 600, 556, -2968, -5620,
-    -1975, 5303, 8987, 7092, 3989, 4877, 6891, 3976, -3024, -9681,
-    -12041, -9429, -4985, -2503, -1091, 2886, 9475, 14441, 13388, 8002,
-    2184, -4198, -8941, -10216, -10488, -8825, -3016, 3393, 7394, 9924,
-    9925, 7452, 2750, -3811, -8230, -8668, -6853, -3271, 1965, 6295,
-    6295, 3542, 1441, -354, -3204, -6718, -9605, -9111, -3586, 3140,
-    7133, 6931, 3510, 1179, 1075, 149, -2751, -5618, -5378, -734,
-    4804, 5737, 4066, 3018, 1858, -423, -4655, -7411, -3657, 4209,
-    8866, 7298, 3179, -227, -2266, -3757, -7087, -10587, -10618, -5621,
-    787, 4918, 7715, 10157, 10740, 8192, 4075, 743, -3041, -7270,
-    -8733, -7730, -5778, -3044, 1295, 6237, 8576, 7135, 4657, 2432,
-    -1707, -6376, -8519, -9627, -9927, -6702, -414, 5205, 7389, 7085,
-    4892, 2394, 1441, 1302, 2773, 4064, 2055, -1327, -3736, -6220,
-    -8627, -8869, -5366, 986, 6250, 8003, 7708, 5779, 2586, -910,
-    -5473, -9448, -10446, -8903, -5129, 279, 5275, 8480, 8963, 6968,
-    4657, 3382, 1454, -1159, -3751, -6620, -8399, -7913, -7056, -5067,
-    -709, 5014, 9636, 11074, 9487, 7224, 5690, 1194, -6848, -13133,
-    -14908, -12717, -6822, -2727, -776, 2970, 9164, 14350, 14271, 9755,
-    4140, -1904, -5942, -6265, -6757, -8089, -6988, -2127, 2881, 6143,
-    5672, 3192, 1909, 176, -2034, -1316, 1617, 4336, 4221, 338,
-    -3364, -4799, -3764, -2433, -2919, -3385, -918, 2839, 5031, 3998,
-    -169, -5126, -7369, -5148, -993, 647, 1301, 5229, 9395, 9609,
-    6430, 1686, -3570, -7618, -9177, -8559, -6527, -3084, 1677, 6088,
-    7489, 5241, 154, -2828, -276, 3007, 3022, 791, 618, 3547,
-    1866, -5245, -9898, -10020, -7553, -5164, -2605, 671, 5474, 11997,
-    14857, 10639, 2969, -3111, -6471, -7208, -6379, -6978, -5989, -287,
-    6012, 9079, 6869, 3137, 2398, 1076, -3920, -7798, -6577, -1877,
-    3739, 6831, 5971, 1095, -3270, -3197, -3399, -4487, -3729, -316,
-    5878, 9640, 8559, 3897, -3246, -8059, -8719, -6371, -2128, 2498,
-    6402, 9060, 9047, 5878, 1595, -3224, -8009, -9940, -7848, -4679,
-    -2994, -996, 1997, 2070, 296, 1524, 4657, 5881, 5664, 4691,
-    1936, 401, 521, -2955, -8992, -11852, -9593, -4968, -1161, 1374,
-    1998, 3959, 9231, 11097, 6677, 2056, -719, -3750, -4040, -2188,
-    -3577, -4101, 1415, 7592, 8426, 4633, -870, -3857, -2887, -2599,
-    -3509, -2031, 3508, 8437, 6600, 1447, -2091, -3160, -2342, -3332,
-    -6143, -5325, 1627, 7759, 6799, 3582, 2492, 1044, -3739, -8782,
-    -9272, -7402, -4795, -1067, 1415, 4377, 7885, 7157, 1306, -4921,
-    -6638, -5242, -3833, -2405, -416, 3691, 7598, 7485, 3584, -1923,
-    -4292, -3735, -3382, -2683, -2845, -2088, 1529, 2470, -192, -1870,
-    -1351, 151, 1474, 1542, 883, 2534, 4940, 3220, -620, -1563,
-    982, 3736, 2705, -2121, -6336, -6420, -2661, 600, 1293, 3261,
-    6756, 6557, 1830, -4039, -7693, -6374, -97, 5178, 4000, 1634,
-    2694, 3728, 942, -5630, -9826, -7526, -3297, 241, 2459, 3632,
-    6201, 7978, 4974, -1002, -5274, -7019, -6880, -3702, -350, 872,
-    4101, 8346, 9280, 5842, 235, -3017, -3246, -3133, -2537, -196,
-    2828, 2928, 542, -1244, -4118, -8265, -9266, -7164, -3884, 1821,
-    6616, 7253, 6323, 5282, 2007, -4531, -10398, -10461, -6175, -1140,
-    3514, 6714, 6784, 4585, 2984, -701, -8071, -11509, -8859, -5573,
-    -1967, 2274, 5502, 6196, 5519, 3931, -747, -2442, 2917, 7274,
-    6965, 5436, 5196, 4848, 1047, -5519, -10206, -9276, -5957, -4192,
-    -3432, -58, 6313, 10762, 10318, 4961, -1117, -3777, -5046, -4370,
-    -2760, -2482, 727, 7039, 10823, 8717, 3022, -2586, -4955, -3960,
-    -2643, -3286, -4249, -276, 6455, 6119, -903, -6989, -7423, -4343,
-    -1779, -160, 381, 2420, 5101, 5342, 3496, -1364, -7696, -9948,
-    -6118, 182, 2679, 2143, 1674, 1456, 2290, 3212, 270, -6397,
-    -9620, -4837, 2248, 3946, 871, -1540, -207, 1214, -1925, -6559,
-    -6070, -528, 5480, 7765, 6992, 4997, 1884, -1472, -5560, -9514,
-    -9460, -6060, -1934, 2614, 6844, 10111, 10408, 7609, 3022, -2040,
-    -4129, -2755, -1712, -2418, -3877, -2979, 246, 3089, 4054, 3173,
-    3275, 5070, 5369, 1951, -3235, -6588, -7069, -5796, -3985, -2886,
-    -1793, 662, 3872, 4029, 1592, 1488, 5080, 8209, 6934, 2821,
-    -1707, -6113, -9399, -11155, -10862, -8264, -2957, 4606, 9419, 9172,
-    6763, 4281, 91, -5386, -9109, -9837, -7170, -2632, 674, 2758,
-    4450, 5254, 3866, -271, -3024, 657, 6896, 8020, 5125, 2842,
-    2144, 753, -3578, -9288, -11463, -8671, -4727, -1467, 2673, 6436,
-    6429, 3570, 137, -4970, -7713, -4152, 203, 2185, 3478, 5214,
-    5418, 1938, -3163, -7079, -6876, -2804, 1109, 2624, 2640, 4469,
-    6070, 3428, -1608, -5975, -5608, 577, 6363, 6338, 3860, 3965,
-    3662, -936, -6866, -10065, -9646, -4743, 1544, 3620, 3943, 5778,
-    7388, 6681, 2727, -676, -1335, -396, 858, -837, -3538, -2882,
-    -1129, -668, -941, -1292, 1752, 7496, 9062, 5776, 2304, -242,
-    -2373, -3788, -4682, -6205, -6081, -1608, 3531, 4235, 368, -2524,
-    -1228, 2474, 5056, 4494, 2976, 2509, -318, -5415, -7670, -6375,
-    -5117, -5342, -3406, 3075, 8909, 9083, 5870, 2216, -125, -2377,
-    -5908, -9566, -9883, -6262, -1775, 3271, 8205, 9659, 7512, 4057,
-    907, -2135, -5722, -7221, -7080, -6439, -4255, -640, 2306, 4084,
-    4824, 4059, 2670, 1359, -135, 264, 3458, 6381, 6052, 568,
-    -6480, -10416, -11432, -10418, -6837, -2410, 2437, 8820, 13756, 13794,
-    8934, 1554, -4405, -7684, -9972, -10699, -9114, -4913, 1834, 9031,
-    11839, 7965, 3002, 2060, 1268, -3305, -7691, -9639, -9683, -5944,
-    69, 3273, 2364, 2014, 5196, 6486, 4284, 2996, 1655, -665,
-    -1131, -900, -3647, -5910, -2908, 2527, 5079, 3690, 2336, 3250,
-    3950, 2869, -211, -4637, -7502, -6356, -1638, 2243, 2436, 888,
-    721, 2795, 4027, 3787, 4993, 5961, 3980, 1403, -756, -5365,
-    -11140, -12044, -7563, -2725, -674, 550, 3952, 7864, 10023, 8617,
-    2839, -2910, -4685, -3977, -4147, -6182, -7634, -5831, -592, 5618,
-    10543, 11743, 7658, 2293, -1868, -5275, -7357, -7751, -5857, -2926,
-    662, 5335, 7181, 5265, 2457, -552, -3501, -6104, -6679, -4848,
-    -681, 5643, 8944, 6486, 2111, -1571, -5085, -7825, -7305, -5176,
-    -2952, 2304, 8582, 10353, 6987, 2554, -1925, -7413, -9871, -7717,
-    -4699, -939, 5054, 11201, 12158, 6468, 142, -3063, -5849, -9895,
-    -12094, -10195, -5147, 1102, 7077, 11557, 11058, 5315, 1101, -484,
-    -2688, -4427, -5189, -4544, -2709, -1518, -890, 93, 2866, 6038,
-    6758, 6250, 5745, 5045, 3399, 207, -3588, -7281, -9049, -6201,
-    -119, 4972, 5711, 2758, -691, -3551, -5820, -5666, -1313, 3856,
-    5730, 6788, 7623, 3821, -2295, -6588, -8812, -8799, -6660, -1899,
-    4414, 8474, 8967, 6246, 1343, -1765, -2653, -4136, -5508, -4944,
-    -2544, 464, 2218, 3304, 4747, 5544, 5128, 3334, 798, -1260,
-    -3194, -5477, -6883, -6560, -4862, -2336, 1060, 4919, 8007, 8960,
-    7712, 4790, -643, -7135, -9809, -7374, -1162, 5544, 7721, 5846,
-    2920, 921, -1334, -6880, -11997, -11656, -5832, 3009, 7957, 7078,
-    4598, 1285, -2222, -6251, -9580, -7820, -1990, 3927, 8114, 9426,
-    8464, 6253, 2011, -4685, -10122, -10437, -7274, -2235, 3788, 8929,
-    11400, 9288, 4845, 477, -4358, -8121, -9481, -8712, -3840, 4351,
-    10101, 10121, 6398, 2424, -811, -2644, -1847, -951, -1782, 259,
-    4698, 5869, 3104, -1936, -5541, -4758, -1475, 887, 68, -582,
-    1786, 2399, -724, -3763, -3089, 688, 3331, 3149, 355, -3028,
-    -4035, -4985, -7052, -7865, -4944, 1244, 5881, 6883, 5339, 3274,
-    1454, -1979, -5523, -6184, -4162, 1101, 4756, 2905, 2072, 4970,
-    5350, -221, -7868, -12277, -11070, -6731, -2244, 1038, 3112, 6546,
-    10875, 10517, 4669, -1270, -4156, -4384, -3762, -4452, -5235, -1165,
-    5428, 7054, 4108, 989, 978, 3684, 4206, 1459, -949, -769,
-    -223, -2289, -5720, -7694, -5577, 27, 3485, 3415, 2467, 1645,
-    1482, 1360, 1778, 2574, 1382, 192, 1057, -472, -4984, -5973,
-    -4275, -5571, -6347, -1635, 4345, 6691, 6668, 5845, 4429, 2242,
-    -1367, -5651, -8713, -9284, -6535, -1651, 4448, 10522, 11969, 8987,
-    5172, 1557, -2790, -7169, -8487, -6142, -2648, 692, 3882, 6956,
-    6950, 2147, -1488, -1809, -2719, -4386, -2382, 4024, 9226, 8664,
-    3673, -1673, -5607, -9056, -10386, -8113, -5080, -1206, 5204, 10155,
-    9298, 5310, 1890, -961, -4400, -7902, -9593, -8608, -4535, 2220,
-    6887, 6226, 3688, 2684, 1063, -4008, -8515, -9405, -8041, -5040,
-    -1260, 3022, 6195, 5731, 5113, 5275, 2254, -2134, -5166, -6977,
-    -7339, -6438, -5524, -2864, 3821, 10062, 10570, 6621, 1975, -2057,
-    -5810, -7368, -5588, -4210, -2670, 2523, 7190, 6702, 3739, 1375,
-    -2075, -5987, -6529, -4376, -1612, 3867, 10297, 11529, 7391, 2164,
-    -2385, -6581, -8648, -7578, -6048, -4235, 227, 4014, 4223, 4226,
-    5231, 4637, 2769, 1318, -893, -4070, -5911, -5706, -3698, 621,
-    6210, 10404, 10598, 7479, 3742, -781, -7197, -12720, -14079, -10635,
-    -5100, -130, 5369, 10869, 12890, 9878, 3634, -2514, -5606, -6406,
-    -6453, -5053, -381, 6415, 10997, 10108, 4310, -1979, -5508, -5445,
-    -3274, -1995, -1058, 2573, 7030, 7839, 4264, 875, -342, -3209,
-    -7276, -8163, -3875, 3844, 10051, 10997, 7041, 2448, -477, -4359,
-    -8286, -10213, -10345, -6515, 649, 6386, 8039, 6042, 4190, 3274,
-    -549, -6100, -9412, -9811, -8202, -6174, -4736, -1360, 5219, 11889,
-    14925, 13117, 8803, 3801, -2826, -9118, -10720, -9717, -8693, -4786,
-    1638, 5798, 6567, 6736, 6278, 2092, -4404, -6558, -3273, 868,
-    2804, 2237, 680, -999, -3161, -5317, -6077, -4389, -399, 3702,
-    5904, 6077, 5101, 3568, 1315, -2237, -6222, -7393, -4432, 124,
-    4111, 6258, 5157, 1913, -92, -131, -717, -3192, -5813, -7279,
-    -7142, -3441, 237, -667, -2400, -1210, 2112, 5598, 7649, 7669,
-    4658, 357, -3112, -7845, -10864, -7018, 1151, 6954, 7930, 6437,
-    4367, 3046, 1908, -1270, -6626, -9721, -5196, 2030, 3320, 1100,
-    174, 556, 829, 601, 1673, 3336, 5066, 7091, 5921, 655,
-    -4945, -7739, -8346, -8102, -6085, -1970, 4458, 10892, 12533, 9515,
-    4827, 283, -3438, -7269, -10163, -9398, -3909, 2445, 3640, 538,
-    -2356, -1921, 2000, 6317, 8175, 6755, 5068, 4498, 1724, -3426,
-    -8046, -10434, -9802, -6250, -544, 5068, 9140, 10775, 8311, 2427,
-    -4241, -7718, -6389, -2268, 1132, 1500, 1429, 2544, 3406, 1903,
-    -2709, -5936, -5080, -2382, -50, 854, 2062, 2770, 582, -1996,
-    -2848, -730, 3466, 6114, 5767, 3340, 2040, 1533, -1966, -6625,
-    -8390, -7832, -6887, -5123, -2653, -809, 2463, 7636, 9690, 7953,
-    5912, 4148, 1843, -1204, -4849, -8066, -9343, -8841, -6699, -1592,
-    5609, 9375, 6994, 4236, 3664, 486, -4780, -7361, -7828, -7560,
-    -4138, 1272, 3827, 3952, 2562, 64, 229, 3302, 5874, 3521,
-    -756, 234, 909, -4201, -9424, -9929, -6286, -1857, 1708, 3574,
-    3788, 4632, 4435, 1196, -2971, -4491, -1967, 1035, 2319, 1658,
-    -546, -1136, 1344, 5076, 6495, 4406, 3158, 4008, 1375, -5278,
-    -10315, -11419, -8866, -3682, 1436, 5266, 7475, 8133, 8070, 4633,
-    -2022, -5595, -3403, 1591, 4306, 1753, -2632, -3781, -2186, -956,
-    -467, -3, 1449, 4479, 6269, 6235, 4906, 1014, -2129, -3797,
-    -5410, -5637, -5086, -1891, 4144, 8502, 8287, 4446, 2053, 1303,
-    -1657, -6138, -9989, -9825, -4961, 441, 3446, 4005, 4437, 5065,
-    4528, 1786, -1867, -1756, 900, 736, -2070, -4354, -4834, -2904,
-    1155, 3567, 2056, 317, 1026, 2093, 1445, -583, -3101, -5983,
-    -7026, -4465, -1292, 294, 569, -611, -1960, -1158, 2976, 8006,
-    8947, 6493, 4350, 1710, -3327, -8549, -10750, -10518, -7166, -1321,
-    2721, 4925, 6989, 7514, 3568, -2893, -6906, -8147, -6150, -2384,
-    -1593, -1893, 1051, 6897, 11397, 10125, 4918, 1601, 1535, -230,
-    -6018, -11046, -11459, -7531, -299, 5858, 5008, 1124, 1714, 4756,
-    4669, 398, -3827, -3208, 2623, 8347, 7050, 123, -4136, -3895,
-    -3991, -4562, -2628, 643, 2994, 4570, 6043, 5793, 2504, -1027,
-    -2394, -3365, -5958, -7387, -3884, 2489, 6762, 6708, 5231, 4979,
-    4313, 1374, -4208, -9360, -11319, -9286, -3476, 1179, 4465, 9277,
-    10846, 7257, 2807, -1284, -5774, -8572, -7791, -5323, -1751, 4538,
-    10388, 10349, 5694, 1333, -2769, -8158, -11586, -10267, -5971, 537,
-    7059, 9125, 7810, 4651, -281, -4106, -5398, -4928, -2845, 1591,
-    5855, 6365, 4933, 2726, -1349, -5027, -6317, -6982, -6385, -1169,
-    4573, 4892, 2843, 2181, 919, -2573, -6000, -7004, -5602, -2714,
-    534, 1583, 541, 2914, 7850, 9282, 6687, 2500, 216, -817,
-    -4468, -8632, -10339, -9142, -4166, 1967, 4792, 5309, 5796, 4531,
-    1491, -2082, -5538, -4808, 1962, 9092, 9762, 4039, -2765, -6885,
-    -8123, -8412, -8511, -6404, 20, 7801, 12552, 13105, 8419, 1505,
-    -3230, -6400, -8700, -8972, -6269, -1154, 4662, 8267, 7180, 4183,
-    1528, -2732, -6770, -7819, -7083, -4323, 1092, 5305, 6107, 6273,
-    5356, 791, -4130, -4957, -3793, -3022, -1412, 282, 2071, 6519,
-    11192, 9735, 3503, -1765, -5831, -9009, -9544, -6927, -2916, 1043,
-    4850, 7281, 7966, 6150, 1278, -4127, -8513, -9517, -5578, -448,
-    2875, 5431, 8004, 7153, 2303, -2994, -7955, -10016, -6859, -712,
-    4162, 5415, 5575, 5813, 4183, -405, -6142, -9006, -7808, -4120,
-    -1012, -949, -1234, 2413, 9733, 13939, 10118, 3991, 1436, -581,
-    -5478, -10232, -11287, -7265, 1425, 8332, 7964, 4577, 3425, 1680,
-    -3750, -8533, -8138, -4127, 1346, 7476, 10512, 7701, 1569, -3270,
-    -5885, -8389, -9064, -6156, -1580, 4359, 9755, 10384, 7045, 2879,
-    -1797, -6363, -9329, -10756, -8401, -1468, 5247, 8677, 8086, 5360,
-    1883, -3769, -8280, -9245, -7641, -2621, 3411, 6902, 8013, 7567,
-    5712, 2279, -1552, -4352, -7037, -9095, -7610, -2344, 4085, 9057,
-    10592, 9258, 6808, 2341, -4900, -11187, -12480, -9520, -4859, -600,
-    2764, 6263, 9093, 8635, 3276, -4202, -8915, -9606, -6391, 462,
-    5748, 6159, 5581, 4340, 347, -4573, -8545, -9748, -7110, -1257,
-    4875, 7514, 7564, 6381, 3762, 83, -4240, -7081, -7480, -5403,
-    -3151, -2689, 290, 6183, 11005, 12120, 8585, 3945, 361, -3416,
-    -7589, -9525, -6867, -2586, 515, 2408, 3742, 5268, 4734, 1851,
-    -1632, -4719, -3631, 672, 2645, 3068, 3919, 1974, -2966, -5946,
-    -6403, -6662, -3828, 1928, 4310, 4541, 6381, 6997, 4829, 1316,
-    -2593, -6518, -8586, -5984, 66, 5862, 8611, 7539, 6044, 4671,
-    -736, -7684, -10810, -11528, -10061, -4407, 1139, 4003, 7463, 10746,
-    9653, 5189, 1614, -1513, -5036, -5437, -2392, -675, -962, 1167,
-    5108, 5125, 467, -4084, -5764, -5752, -4510, -1357, 1232, 2703,
-    6073, 8586, 6058, 1192, -2629, -5395, -7470, -8676, -7383, -1180,
-    7994, 13167, 11365, 6518, 2075, -2487, -8347, -12681, -12294, -7346,
-    -574, 4206, 7420, 9383, 8092, 5267, 1625, -3566, -8030, -8290,
-    -4607, -2815, -2310, 2205, 7414, 8444, 5564, 2020, 84, -1142,
-    -1954, -2617, -4134, -4513, -1513, 2203, 3488, 2624, 68, -2565,
-    -2293, -158, 1313, 2775, 4607, 5839, 5894, 3055, -2808, -7747,
-    -10314, -12371, -12702, -8602, -1233, 6398, 11991, 13220, 11400, 8535,
-    2879, -4780, -10654, -12709, -10773, -5185, 2734, 9150, 11356, 10210,
-    7379, 3396, -2756, -9376, -12744, -11615, -6320, -76, 4110, 6439,
-    6981, 6564, 5255, 1145, -4406, -6642, -2528, 4243, 5958, 3301,
-    3267, 4183, 76, -6471, -10027, -10524, -8365, -3544, 618, 3496,
-    6779, 8422, 7856, 4918, -1503, -8161, -11843, -10963, -5142, 2386,
-    7721, 9216, 9617, 10401, 6565, -2692, -10224, -12752, -12594, -8960,
-    -2101, 3135, 5499, 6235, 6483, 6031, 1957, -3189, -4748, -3919,
-    -2605, -1008, 708, 1910, 3257, 5156, 4847, 2414, 311, -1953,
-    -3605, -2490, -1141, -2382, -2010, 2005, 4342, 3411, 997, -2692,
-    -5632, -5987, -3664, 1506, 7066, 9195, 9461, 10784, 9192, 1037,
-    -9051, -14263, -13295, -9648, -6038, -2276, 3143, 9555, 12764, 10177,
-    3406, -3511, -7064, -7766, -7321, -6334, -4250, 1937, 10437, 13333,
-    8927, 3561, 1563, 671, -2975, -8073, -9857, -6695, -1188, 3126,
-    4012, 2277, 1388, 2243, 1562, -2430, -6870, -7861, -3927, 3626,
-    9661, 9772, 7091, 5726, 2997, -4295, -12004, -14088, -11732, -7093,
-    124, 5802, 8360, 10432, 10392, 6597, 85, -6503, -10308, -10850,
-    -7071, -401, 5080, 8447, 9409, 8415, 5424, -751, -7177, -10543,
-    -9813, -5404, -536, 2401, 4239, 6853, 8800, 6930, 2269, -2888,
-    -6963, -7646, -4791, -835, 2970, 6429, 7383, 6330, 5852, 2223,
-    -6000, -11132, -9423, -4377, 884, 3681, 3744, 4580, 5900, 4253,
-    -643, -6080, -8194, -6033, -1753, 2661, 5002, 5845, 8034, 9321,
-    4689, -4335, -11315, -12430, -8015, -2119, 1322, 2291, 3517, 6882,
-    7937, 3223, -2400, -6167, -8576, -8237, -5389, -1530, 3427, 9168,
-    12095, 9990, 5733, 1559, -3013, -7770, -10408, -9087, -4392, 1385,
-    4768, 4667, 3312, 2225, 772, -2730, -7135, -8937, -7322, -3299,
-    2903, 9282, 11544, 9998, 8238, 4250, -3826, -10521, -11781, -9512,
-    -5265, 0, 4123, 6397, 7114, 5857, 1318, -4523, -7017, -7518,
-    -8057, -6098, -1139, 5555, 10931, 11394, 8432, 5272, 1420, -3814,
-    -7501, -8594, -7433, -2335, 2811, 2975, 1852, 3515, 4806, 2535,
-    -909, -3496, -4846, -3690, -1556, -44, 2077, 4605, 5864, 4445,
-    958, -1724, -3361, -4102, -1648, 1624, 2623, 3363, 3732, 2698,
-    698, -2567, -5729, -7859, -8800, -6799, -1369, 4277, 6821, 7673,
-    8284, 6897, 2545, -3674, -8511, -9944, -8202, -3959, 175, 2669,
-    5186, 8177, 8556, 4913, 134, -3708, -5951, -6800, -6731, -4666,
-    -447, 5034, 9150, 9356, 6579, 2084, -1628, -3052, -4739, -6407,
-    -5096, -773, 3718, 5884, 5534, 3578, 1188, -1847, -5689, -7484,
-    -6275, -3094, 2756, 7910, 7740, 5765, 4844, 694, -6212, -9461,
-    -8289, -5205, 80, 5065, 6576, 6562, 6405, 4689, -120, -6602,
-    -10197, -10038, -8242, -4989, 554, 7378, 11239, 10325, 7601, 4745,
-    747, -3821, -6924, -8774, -7879, -2910, 625, 1013, 3210, 6471,
-    6671, 4328, 1154, -3055, -6399, -6317, -4000, -1842, -167, 2690,
-    6658, 8474, 5963, 1110, -1738, -1709, -763, -265, -2133, -4330,
-    -2180, 1742, 1258, -3353, -6410, -5224, -2887, -1850, -638, 2381,
-    6452, 8840, 8108, 5417, 1290, -3546, -7535, -9858, -9535, -6369,
-    -1733, 1409, 2785, 5951, 8482, 6308, 1980, -1859, -4678, -6918,
-    -7990, -5943, -1372, 4134, 7756, 7275, 5028, 3143, 1374, -769,
-    -3782, -6919, -7355, -3928, 616, 3498, 3570, 2171, 1717, 1478,
-    -99, -3231, -5788, -4539, 59, 5901, 9384, 6490, 1167, -520,
-    -1624, -5981, -9397, -7958, -2765, 3636, 7603, 7455, 5564, 4223,
-    2796, -1059, -6278, -8716, -7862, -5895, -3245, 1084, 6963, 10470,
-    9087, 6993, 6472, 3894, -1901, -6933, -7794, -5306, -1380, 1622,
-    1879, 2449, 4075, 3153, 452, -2115, -4351, -4650, -2392, 617,
-    2802, 4492, 5458, 4307, 2181, 805, -1244, -3732, -3608, -1527,
-    -60, 5, -954, -916, -113, -1080, -2991, -2920, -1476, -1983,
-    -2370, 1050, 4856, 5374, 4069, 3665, 3637, 1113, -3240, -6817,
-    -8628, -7485, -2557, 2442, 3084, 2764, 4632, 5109, 2342, -2404,
-    -5922, -5785, -4630, -3762, -860, 3959, 7470, 7317, 5058, 3605,
-    2186, -1232, -4699, -6466, -7164, -4987, 5, 3023, 2801, 2745,
-    3343, 1598, -1998, -3881, -4036, -3661, -438, 5761, 8506, 4621,
-    888, 778, -1682, -7103, -9943, -9584, -5994, 1640, 7656, 7068,
-    4850, 4939, 3042, -1492, -5550, -8126, -7070, -3916, -2507, -327,
-    5214, 9216, 6710, 2822, 2742, 1908, -1785, -5239, -7157, -5731,
-    -406, 3675, 2521, 535, 1738, 2859, 939, -2449, -4383, -4187,
-    -2921, -704, 2447, 5494, 6670, 6248, 5951, 4031, -757, -4808,
-    -5613, -4244, -1641, 409, 285, 1132, 3807, 2951, -1466, -3829,
-    -3675, -3897, -3424, 8, 4564, 7086, 7188, 6112, 4634, 2144,
-    -2229, -6487, -8160, -7954, -5206, 45, 2609, 2069, 3456, 5748,
-    4487, 345, -2434, -3276, -4507, -4751, -2678, -419, 1713, 4262,
-    5628, 5043, 3793, 2406, -151, -3414, -5639, -5571, -2581, 494,
-    1129, 1881, 2860, 1728, 637, 39, -3116, -6184, -4546, -346,
-    3123, 6039, 7431, 6057, 3836, 1150, -4236, -9164, -8628, -4588,
-    -648, 1812, 3294, 5689, 6925, 4358, -222, -3511, -3824, -3860,
-    -5094, -5006, -2484, 3394, 9355, 8522, 3989, 3406, 3899, -474,
-    -6095, -8276, -8116, -4599, 1175, 3093, 1937, 2663, 3953, 2444,
-    -724, -3767, -6904, -7530, -2916, 3684, 7153, 6606, 5815, 6913,
-    5468, -1240, -7282, -8776, -8136, -4202, 1883, 3312, 2531, 5596,
-    7574, 2775, -3815, -5937, -6130, -6437, -3461, 1750, 5268, 6066,
-    5171, 4580, 2780, -2082, -6078, -6903, -7057, -5919, -899, 4006,
-    3854, 2999, 5199, 5303, 1187, -2138, -3456, -5832, -7013, -3611,
-    176, 1298, 2672, 4684, 5368, 3414, -1442, -4923, -4361, -3066,
-    -1234, 1512, 1898, 1904, 4521, 5570, 1347, -4644, -6471, -4909,
-    -4202, -3043, 713, 4992, 7005, 7095, 6727, 3273, -3030, -5851,
-    -5586, -6539, -5902, -2211, 325, 1434, 3752, 5449, 3761, 774,
-    -214, -318, -2010, -4072, -3595, -103, 3526, 4284, 3015, 2441,
-    1935, -892, -4144, -5426, -5859, -4270, -579, 1318, 2184, 4058,
-    4275, 1785, -887, -2752, -5246, -7011, -4268, 1635, 4861, 3957,
-    3590, 5108, 4400, 718, -3401, -6639, -7601, -4701, -97, 1263,
-    870, 3333, 6004, 5608, 2734, -1554, -4414, -4895, -4793, -2804,
-    1259, 3638, 4767, 7187, 7856, 4006, -1804, -6073, -8170, -8176,
-    -4396, 549, 2029, 2623, 5232, 7514, 6069, 403, -4607, -5970,
-    -5307, -2616, 955, 2452, 2771, 4226, 5490, 3969, -405, -5418,
-    -7446, -5166, -1557, 836, 1734, 2392, 4049, 4984, 3113, -996,
-    -4442, -4637, -3969, -5031, -4321, -1, 4316, 6855, 7736, 6331,
-    3520, 222, -3693, -7238, -8937, -7482, -3361, -3, 1747, 4394,
-    6914, 6114, 2770, 21, -1594, -3549, -4925, -3597, -227, 3358,
-    5645, 5700, 4670, 3160, 118, -3025, -3777, -2706, -1229, 147,
-    1351, 2532, 1943, -1207, -4063, -4574, -3168, -2216, -2740, -1736,
-    2264, 7234, 8945, 5607, 3013, 3113, 242, -5202, -7865, -7253,
-    -5153, -782, 3694, 4002, 3445, 5168, 4815, 821, -3464, -5511,
-    -5315, -4494, -2360, 2000, 5106, 5231, 5294, 5193, 2504, -1764,
-    -5019, -6392, -6612, -4841, -824, 1764, 2499, 4211, 5385, 3803,
-    939, -1418, -3498, -4927, -4264, -2072, 558, 2786, 3119, 2513,
-    2462, 807, -2957, -4852, -4356, -3489, -491, 3198, 3442, 2976,
-    3823, 2309, -1102, -3197, -4974, -6765, -5334, 410, 5616, 5028,
-    2876, 5487, 7605, 2950, -3843, -6919, -7365, -6108, -1875, 956,
-    347, 2802, 7707, 7718, 3283, -593, -2412, -3117, -3258, -2525,
-    323, 3948, 4331, 3181, 4415, 4754, 647, -4047, -5144, -4196,
-    -2072, 1261, 2026, 719, 1919, 3679, 1398, -3519, -6089, -5538,
-    -5038, -4409, -411, 5390, 6795, 4704, 5585, 6622, 1765, -4808,
-    -7573, -7680, -5046, -509, 107, -475, 4317, 8548, 6397, 1303,
-    -3335, -5708, -4890, -2968, -3212, -3144, 2126, 7421, 6182, 1912,
-    -979, -2095, -2849, -4319, -4415, -1712, 2040, 4136, 3014, 1037,
-    164, -1668, -3772, -3596, -2620, -2045, -1151, -802, -759, 1317,
-    4586, 5154, 2882, 1633, 1531, -466, -2769, -2845, -2456, -2192,
-    -983, 624, 1407, 485, -616, -194, 228, -991, -3227, -3897,
-    -1204, 3425, 6573, 5569, 2992, 3222, 3362, -768, -5547, -7167,
-    -5914, -852, 4002, 2277, -84, 2799, 4566, 1859, -881, -1855,
-    -3229, -3896, -1296, 1863, 3370, 3446, 2362, 3141, 4726, 2188,
-    -2480, -4726, -4359, -2120, 1288, 2939, 1807, 1064, 1665, 1375,
-    -493, -2487, -4009, -5719, -5274, -880, 3098, 3255, 2452, 3555,
-    4434, 2166, -2619, -6594, -6341, -1900, 2983, 3934, 1094, -84,
-    1614, 1570, -2148, -6181, -6093, -2803, -887, -1239, -709, 2821,
-    6307, 5602, 2206, 414, 399, -790, -3223, -4596, -3773, -1452,
-    546, 1483, 1804, 1931, 1436, 100, -292, 126, -669, -1856,
-    -1874, -931, 602, 2738, 3620, 2072, 1869, 3474, 2294, -290,
-    -581, -292, -1027, -1240, -923, -1653, -2808, -3645, -3983, -2338,
-    220, 263, -1258, 538, 5419, 7213, 4321, 1672, 2024, 1380,
-    -2870, -6132, -6962, -6471, -1853, 2895, 1103, -1276, 2472, 5865,
-    3401, 71, -1538, -3542, -4237, -1607, 1262, 1665, 2179, 4306,
-    5490, 4098, 505, -2932, -4483, -4938, -3663, -1063, 186, 1278,
-    3521, 3875, 1488, -990, -2039, -2492, -3832, -4970, -3088, 1925,
-    5773, 5140, 3136, 2579, 1065, -2882, -6532, -6984, -4509, 126,
-    4526, 4508, 2932, 3941, 3220, -1183, -4485, -4860, -3980, -2884,
-    -1659, 388, 3684, 6780, 6517, 3071, 910, 163, -1984, -4098,
-    -4394, -2568, 775, 2684, 2644, 2700, 2001, 198, -450, 28,
-    -499, -2781, -4913, -4060, -13, 4031, 4358, 1626, 792, 3304,
-    3612, -940, -4445, -3884, -1516, 1021, 844, -1086, -793, 666,
-    1325, 1144, 727, -92, -2306, -3434, -473, 3554, 2985, -539,
-    -41, 3274, 2519, -1576, -4357, -5804, -4608, 1232, 4768, 916,
-    -1764, 2164, 4586, 1669, -1361, -3672, -5825, -4894, -273, 4321,
-    4048, 1208, 2432, 5378, 3665, -1749, -6185, -7564, -5464, -548,
-    2628, 916, -353, 2743, 5326, 3371, -1281, -4289, -4025, -3268,
-    -2984, -1164, 2440, 4838, 4721, 4825, 4119, -83, -4315, -5821,
-    -6376, -4795, 978, 5313, 3877, 2892, 5357, 4714, -212, -3117,
-    -3491, -4698, -5618, -3674, 910, 4493, 4661, 3247, 2315, 1654,
-    -796, -3937, -4758, -3769, -1083, 2196, 3044, 3044, 4056, 3387,
-    352, -1983, -2890, -4183, -5844, -5725, -1756, 4086, 6179, 4269,
-    3871, 4869, 3161, -478, -3782, -5610, -3874, 728, 2898, 792,
-    -131, 2545, 3713, 748, -2505, -3591, -3899, -2784, 1529, 6486,
-    6742, 3295, 3081, 4574, 978, -5321, -8557, -9017, -7278, -1817,
-    3063, 3105, 2741, 4934, 6239, 3429, -1787, -4843, -5490, -5120,
-    -2018, 2563, 3943, 3095, 4225, 4947, 1114, -4416, -6657, -6258,
-    -5114, -1647, 2015, 2115, 1307, 2558, 3867, 2685, -176, -2373,
-    -3493, -4072, -3506, -989, 2559, 4634, 4306, 3404, 2806, 283,
-    -4495, -7270, -6191, -3588, 548, 4790, 4986, 3551, 4162, 4110,
-    907, -3829, -6877, -7099, -5741, -2935, 1977, 7000, 8164, 6059,
-    4800, 3150, -1740, -6536, -8333, -7861, -3896, 1702, 3979, 4083,
-    4979, 5284, 2832, -1790, -5790, -7003, -5859, -3569, 1361, 7036,
-    6903, 4107, 5262, 5104, -1297, -7415, -8219, -7173, -5392, -655,
-    3803, 4831, 4755, 4684, 3104, -112, -3815, -6328, -6444, -4049,
-    1040, 6228, 7164, 4956, 3969, 2416, -3308, -8763, -9798, -9071,
-    -6027, 672, 5844, 6661, 6666, 7116, 5104, 187, -4637, -7303,
-    -7511, -5311, -1566, 2988, 7056, 7712, 5696, 4104, 1025, -4492,
-    -8005, -7913, -5807, -1092, 4163, 5529, 5066, 5946, 5695, 2458,
-    -1860, -5883, -8769, -8141, -3995, 726, 4444, 6304, 6398, 5973,
-    4407, -57, -5446, -7116, -4606, -177, 3090, 2630, 1636, 3580,
-    4610, 936, -3724, -5433, -5780, -4907, -1841, 2368, 6376, 7958,
-    7359, 6550, 3968, -2075, -8031, -9765, -8786, -6163, -731, 3290,
-    3847, 5535, 8185, 6653, 1286, -3464, -6376, -7380, -5050, -988,
-    2258, 4787, 6299, 6483, 5295, 1325, -4784, -8782, -8889, -7226,
-    -4110, 409, 3510, 5309, 7358, 7539, 4234, -282, -3804, -6262,
-    -7034, -5016, -383, 4504, 6936, 7066, 5897, 3361, -1437, -7684,
-    -10764, -9627, -5923, -365, 3037, 3682, 5618, 7487, 5402, 619,
-    -3129, -5536, -6644, -5007, -2764, -204, 5302, 9950, 8788, 4809,
-    1509, -2788, -7516, -8385, -5868, -2709, 1177, 4650, 6377, 6754,
-    5135, 1152, -3043, -5731, -7313, -7280, -3827, 2475, 8025, 8882,
-    6558, 5475, 4142, -1211, -7492, -9949, -8981, -4127, 3411, 6372,
-    4311, 4115, 5957, 3889, -2675, -7422, -8509, -7539, -3585, 2487,
-    7463, 8271, 5889, 5289, 4698, -1132, -7869, -9337, -8333, -6325,
-    -871, 4018, 4529, 4269, 5741, 5552, 1675, -2835, -5889, -6808,
-    -3899, 1473, 5170, 4736, 2775, 3067, 2829, -2202, -8662, -10229,
-    -7552, -4301, 432, 5155, 5748, 5546, 7679, 7638, 2410, -3958,
-    -6741, -7287, -7559, -5582, -1685, 2076, 5329, 7028, 6200, 3404,
-    -500, -5120, -8149, -7809, -5340, -1322, 2332, 3651, 5406, 7420,
-    6246, 2805, -541, -4152, -7281, -7111, -4709, -1682, 2875, 6228,
-    6174, 5529, 4959, 1630, -3617, -5651, -4110, -1726, 461, 942,
-    1196, 2874, 3179, 1250, -1548, -4307, -5486, -4116, -808, 3094,
-    6160, 6478, 5346, 5735, 4254, -1861, -6936, -8224, -8401, -6416,
-    -1598, 2116, 3446, 4906, 6564, 5406, 1354, -2416, -5358, -7060,
-    -4943, 686, 5769, 6856, 5160, 4546, 4423, 648, -5912, -9832,
-    -9766, -6752, -1087, 3716, 5146, 5321, 5882, 5635, 2867, -1419,
-    -4846, -6695, -5529, -1152, 3388, 5675, 5059, 3328, 2946, 1391,
-    -3991, -8610, -8678, -6596, -3013, 1698, 3525, 3940, 6679, 7781,
-    3733, -1472, -4196, -5860, -6635, -4660, -1290, 3384, 8334, 8917,
-    6565, 4672, 1384, -4410, -8900, -8447, -5432, -2120, 1226, 2518,
-    3610, 5770, 5264, 1580, -2570, -5243, -6190, -6043, -4132, 335,
-    5458, 7211, 6088, 5630, 4015, -558, -4780, -6450, -6439, -4157,
-    90, 1893, 1101, 2665, 4962, 3198, -586, -3239, -5058, -4939,
-    -1572, 2428, 4049, 3823, 4234, 5531, 4256, -962, -5522, -7059,
-    -7156, -4701, -545, 1153, 1497, 3493, 5651, 4992, 1392, -2242,
-    -4370, -4913, -2732, 1971, 5696, 5799, 4057, 3573, 3235, -845,
-    -7354, -10216, -8671, -5105, 134, 3973, 4807, 5748, 6572, 5507,
-    2576, -1910, -5536, -6851, -5683, -2032, 1981, 4930, 6143, 5277,
-    4566, 3327, -1652, -7474, -8484, -5714, -2918, -385, 1319, 2745,
-    5229, 5652, 3016, 108, -2737, -5104, -5486, -4024, -1699, 2361,
-    6519, 6270, 4108, 4010, 1779, -3935, -7403, -7173, -5399, -1847,
-    1341, 1506, 2367, 4905, 4370, 647, -2879, -5183, -5702, -3792,
-    -294, 3529, 6286, 6009, 4325, 3751, 1153, -4462, -7685, -7156,
-    -5875, -2984, 1254, 2886, 2745, 4823, 6618, 3761, -1526, -5013,
-    -6193, -5626, -3050, 1172, 4873, 6179, 5708, 4358, 2133, -1451,
-    -5853, -8408, -8108, -5433, -278, 3664, 4192, 4761, 6105, 5349,
-    1915, -2420, -5774, -7095, -5359, -1051, 3101, 5508, 5687, 4393,
-    3462, 1296, -3838, -7632, -7018, -4252, -795, 2473, 3891, 5006,
-    6353, 5264, 1549, -2617, -5589, -6542, -5342, -2839, 260, 4295,
-    7453, 7007, 4829, 2844, -159, -4030, -6371, -6045, -3729, -572,
-    1712, 2768, 4029, 4665, 3662, 1185, -2779, -5892, -5921, -3845,
-    -356, 4592, 7050, 5433, 4726, 4890, 946, -4911, -7867, -7992,
-    -6103, -1923, 1436, 1910, 3359, 6254, 6228, 2875, -1472, -5371,
-    -7258, -5961, -2162, 2584, 6489, 6996, 5739, 4788, 1944, -2683,
-    -6503, -8716, -8525, -5497, -1149, 2490, 5257, 7031, 6603, 4741,
-    1170, -4240, -7685, -7568, -5980, -2995, 2211, 6773, 7078, 5483,
-    3772, 360, -3981, -7522, -8452, -6088, -2806, -203, 2188, 5465,
-    8156, 6698, 1987, -3147, -6024, -5820, -5133, -4853, -3144, 2059,
-    8278, 9296, 5976, 2561, -207, -2751, -5544, -7084, -5815, -2509,
-    916, 3493, 5890, 6505, 3661, -303, -4135, -6694, -6716, -4994,
-    -2959, 299, 6384, 10122, 7778, 4934, 3310, -531, -5288, -7427,
-    -6479, -4351, -1243, 1784, 3161, 4310, 4891, 2931, -1191, -5646,
-    -6967, -5464, -3239, 1192, 5738, 6020, 4604, 5570, 5314, 419,
-    -4795, -7080, -8224, -7317, -3001, 1051, 2400, 4458, 7109, 6385,
-    2922, -1453, -5581, -6988, -5406, -1609, 2460, 4340, 4843, 5356,
-    5446, 3040, -1855, -5915, -7569, -7322, -4604, -424, 3443, 6027,
-    6480, 5189, 2427, -2549, -6862, -6873, -5361, -4466, -1417, 3803,
-    8122, 9429, 7213, 3699, 981, -2203, -6395, -8653, -7857, -4968,
-    -244, 4483, 6490, 5725, 3850, 1558, -1516, -4011, -4247, -4161,
-    -5319, -5060, -521, 5415, 6825, 4194, 3457, 4728, 3132, -1072,
-    -4247, -5337, -3296, 302, 1891, 1958, 782, -1324, -1531, -1055,
-    -2995, -4722, -3907, -1888, 2454, 8437, 8708, 3894, 2964, 4525,
-    1424, -4899, -8926, -9644, -7342, -2152, 1639, 2094, 3157, 5859,
-    6535, 3001, -2016, -4381, -4106, -3055, -680, 3236, 6099, 5875,
-    5509, 5928, 3204, -2078, -5962, -8660, -9766, -6145, -241, 2761,
-    3130, 3654, 5285, 5830, 1971, -3525, -5387, -4730, -4420, -3057,
-    610, 3953, 5047, 5636, 5793, 3467, -868, -5179, -7735, -6631,
-    -2108, 1540, 2024, 2885, 4825, 4299, 1714, -839, -3146, -3577,
-    -2427, -2965, -3818, -316, 5937, 7647, 4369, 2723, 3270, 1151,
-    -3124, -6391, -7108, -3605, 1181, 2749, 2552, 2457, 2204, 3084,
-    3131, -854, -5562, -6798, -4372, 714, 5348, 5198, 3623, 6203,
-    8066, 3528, -3761, -8756, -9865, -6771, -2525, -1207, -704, 2968,
-    7320, 8186, 5306, 454, -3559, -5430, -4926, -1816, 1756, 3272,
-    3831, 5919, 7703, 5333, -397, -5730, -9000, -9176, -5483, -1723,
-    -1119, 559, 4727, 7274, 7241, 4391, -850, -4495, -4388, -2362,
-    -1710, -1729, 1002, 4170, 4926, 5157, 3824, -1544, -7046, -8123,
-    -5816, -2778, -1488, -784, 3080, 6745, 5994, 3516, 1295, -1555,
-    -4088, -5395, -7024, -8519, -5055, 2488, 6942, 7082, 7236, 7787,
-    4045, -2986, -7009, -6688, -4397, -2481, -1052, 1689, 4146, 4113,
-    3741, 3103, -905, -5811, -6705, -4588, -1006, 3346, 5117, 6115,
-    8945, 9265, 3662, -5041, -10902, -11218, -7301, -2903, -1794, -561,
-    4681, 8365, 6793, 3600, 59, -4491, -6898, -4852, -1219, 1622,
-    3401, 4846, 7124, 8192, 4615, -3195, -10104, -12335, -10694, -6423,
-    -2973, -1725, 2183, 7853, 10462, 9222, 4346, -1572, -4688, -4633,
-    -3724, -3184, -993, 2910, 4852, 5553, 6577, 2988, -5441, -10104,
-    -8859, -5387, -1461, 21, 1466, 6104, 9061, 7576, 3826, -707,
-    -4394, -5334, -4800, -5572, -5334, -212, 6003, 8676, 9128, 7838,
-    3046, -3019, -6118, -6470, -5318, -3881, -2582, 1110, 5244, 5349,
-    3672, 3287, 1792, -1446, -3746, -5297, -6109, -3477, 1085, 3835,
-    5039, 6715, 7704, 4158, -2363, -6713, -7434, -5243, -3764, -4566,
-    -2424, 2795, 5788, 6381, 5299, 1293, -3207, -4696, -3203, -395,
-    882, 720, 2761, 6324, 7009, 2214, -5262, -9455, -8992, -6141,
-    -3381, -3044, -1842, 3180, 7996, 9335, 6479, 334, -4793, -5717,
-    -4410, -3207, -2206, -564, 3112, 7795, 9449, 4995, -2731, -7001,
-    -6443, -4879, -4092, -3727, -1854, 2163, 5220, 5856, 3881, -131,
-    -2923, -3769, -4787, -4940, -2475, 1089, 3695, 5050, 5874, 4835,
-    532, -4261, -6672, -6655, -4722, -3052, -2046, 1901, 6856, 7100,
-    4643, 3347, 1498, -1766, -4825, -5567, -2672, 1089, 2216, 2747,
-    5102, 6599, 5098, 1339, -2982, -5256, -3787, -893, -634, -1680,
-    872, 4236, 3959, 2934, 1586, -1572, -3438, -2983, -1852, 1326,
-    4927, 5849, 6651, 7002, 3682, -1237, -5151, -8286, -9141, -5954,
-    -2007, -843, 756, 4775, 6722, 4888, 2159, -640, -4023, -5729,
-    -4487, -1266, 3047, 5350, 4768, 5141, 5683, 1440, -5385, -9178,
-    -9641, -6498, -1795, -1400, -1592, 3066, 6265, 4263, 1599, -444,
-    -2457, -2799, -2154, -1557, 631, 3913, 5231, 3976, 2060, -244,
-    -3600, -5872, -5073, -2604, 253, 2456, 3026, 3888, 4532, 1703,
-    -2487, -4116, -4205, -4455, -4941, -4889, -1392, 4760, 7466, 5449,
-    3349, 2634, 1793, -720, -4307, -5872, -4084, -242, 1762, 1094,
-    1350, 2319, 1489, 173, -882, -3268, -5078, -3453, 356, 4590,
-    7638, 7672, 6693, 5629, 2078, -3731, -7827, -8544, -6896, -2887,
-    722, 2402, 4698, 5834, 3769, 1205, -1226, -3808, -5028, -4044,
-    -1503, 2509, 6752, 7686, 5348, 3174, 1336, -2843, -6775, -7787,
-    -7703, -4367, 1533, 3833, 4026, 5035, 4241, 2013, -247, -3131,
-    -4833, -3793, -1575, 969, 4153, 6594, 5843, 2943, 1437, -669,
-    -5287, -7935, -7706, -5444, -53, 4937, 6170, 6188, 6242, 4026,
-    257, -3121, -5260, -5720, -5588, -5277, -1931, 4517, 6991, 3791,
-    3034, 4248, 616, -4587, -7124, -6745, -2264, 3060, 3173, 1295,
-    2956, 4076, 1034, -3299, -6143, -6961, -6172, -3904, 421, 5848,
-    9428, 9164, 7566, 5510, 708, -5728, -10268, -10263, -6402, -1794,
-    574, 1987, 5016, 6555, 3860, 12, -2986, -5235, -5503, -3003,
-    905, 4659, 7537, 7689, 5576, 2810, -1247, -6235, -9994, -10714,
-    -7775, -2906, 1025, 3482, 5519, 6659, 5862, 2954, -1582, -5125,
-    -5879, -4400, -1938, 190, 2882, 5912, 5689, 2589, -714, -4063,
-    -6541, -6965, -5647, -2395, 2270, 5630, 7326, 8272, 7200, 3861,
-    -161, -4664, -7863, -7911, -6651, -4958, -742, 5401, 8383, 7732,
-    6307, 3590, -493, -3952, -6037, -5964, -2890, 908, 2676, 4445,
-    6589, 4979, 824, -2801, -5735, -7459, -6962, -3857, 1491, 6560,
-    8613, 8426, 7326, 3847, -1970, -7424, -10554, -9786, -5669, -553,
-    2773, 5504, 8868, 8327, 3856, -495, -4515, -7277, -6625, -3788,
-    -115, 4242, 6840, 6072, 4722, 2929, -1817, -7230, -9146, -7843,
-    -4993, -659, 2330, 3313, 5359, 6526, 4855, 1992, -1646, -4414,
-    -4265, -2543, -871, 1579, 3713, 3152, 1644, 976, -1420, -5507,
-    -6844, -5603, -3337, 745, 2999, 2543, 5104, 8335, 6465, 1974,
-    -1990, -6157, -8769, -7035, -3070, 974, 4363, 6033, 6347, 6367,
-    4156, -1890, -7094, -8163, -6344, -2321, 731, 1306, 3514, 7009,
-    6974, 2763, -3009, -8065, -9564, -6587, -1784, 1601, 3457, 6171,
-    8662, 8065, 3929, -3046, -9436, -10758, -8235, -5038, -2067, 1309,
-    5896, 9341, 9009, 5609, 595, -4691, -7775, -7102, -3540, 722,
-    4332, 6248, 6493, 5436, 1882, -3708, -8513, -10844, -9218, -3665,
-    1184, 3564, 6807, 10015, 9222, 5788, 1421, -3959, -7712, -6548,
-    -2456, 971, 3841, 5458, 5467, 4672, 1580, -4390, -8648, -8905,
-    -7280, -3759, 1402, 4648, 6469, 9453, 9933, 6478, 1962, -3014,
-    -7290, -8430, -7319, -4823, -385, 4177, 6463, 7516, 7632, 3779,
-    -2293, -6410, -8081, -6687, -1669, 2056, 1885, 3273, 6319, 5496,
-    988, -4195, -7958, -8966, -6300, -1059, 4013, 7933, 9483, 9194,
-    7581, 3082, -3699, -10213, -12231, -8944, -4192, 69, 4054, 7599,
-    8767, 7698, 5000, -855, -7284, -9863, -7450, -1654, 4180, 7139,
-    7297, 6708, 5520, 1315, -5610, -11698, -12756, -8858, -3823, 186,
-    3576, 7480, 8777, 7619, 5962, 1004, -5526, -7490, -4447, -35,
-    2924, 3165, 2937, 3611, 2758, -1468, -6767, -10090, -10341, -6849,
-    -835, 3777, 6628, 9367, 9870, 7998, 5010, -140, -6454, -10019,
-    -9269, -5744, -1910, 1108, 4065, 7003, 8826, 7893, 3851, -1937,
-    -6688, -7232, -3865, -808, 633, 2779, 5668, 6881, 5177, 791,
-    -4443, -6964, -5561, -2445, 424, 3089, 5727, 7702, 7074, 3532,
-    -1386, -7107, -11025, -10032, -5320, -1176, 1983, 6233, 9029, 8363,
-    4960, -1044, -7500, -9716, -7312, -3461, 803, 4802, 7127, 7290,
-    5335, 931, -5311, -10797, -12335, -10503, -7009, -2009, 3624, 8134,
-    9753, 9511, 6644, 710, -4097, -5816, -5561, -3883, 269, 4405,
-    5546, 5343, 3529, -1026, -6466, -9738, -9714, -7427, -3123, 1979,
-    7075, 11194, 11719, 8522, 4029, -499, -5786, -9455, -8917, -5650,
-    -427, 5201, 8350, 9534, 8504, 4366, -1861, -8127, -10775, -9007,
-    -5069, -1659, 1746, 7348, 10801, 8699, 4801, 566, -5332, -8830,
-    -7313, -3964, -33, 4526, 8793, 10291, 7802, 2851, -3770, -9873,
-    -11963, -10205, -6531, -1903, 3086, 8150, 10629, 8647, 3660, -2797,
-    -7955, -9549, -7169, -1632, 3244, 6309, 9539, 10720, 6927, 273,
-    -6526, -12178, -13433, -10986, -7359, -2162, 4309, 9708, 11251, 9971,
-    5906, -1243, -6894, -7985, -5872, -1974, 2405, 5517, 7380, 7898,
-    4934, -1278, -7775, -11711, -11859, -9382, -5172, -136, 5647, 10897,
-    12220, 10097, 5988, -759, -7465, -9917, -8120, -4269, -197, 3530,
-    7598, 10471, 9065, 3480, -4492, -11498, -13167, -9705, -4854, -1010,
-    3770, 10200, 13709, 11782, 5729, -2129, -8166, -9828, -8323, -5257,
-    -1666, 3534, 10771, 13829, 11074, 5777, -1808, -9514, -13264, -11853,
-    -8729, -4693, 2641, 10132, 12652, 10730, 5877, -1400, -7022, -8736,
-    -7780, -4263, 1436, 7827, 12211, 11746, 7065, 751, -5865, -12129,
-    -15354, -13527, -9182, -4148, 3633, 11112, 12929, 10433, 5802, -141,
-    -5616, -7834, -6473, -3217, 1029, 5244, 8008, 7125, 2388, -3854,
-    -9592, -13142, -12965, -9922, -5441, 150, 7463, 13598, 14167, 10942,
-    5582, -1128, -7006, -10617, -11159, -8062, -1548, 5171, 9276, 10547,
-    8233, 3027, -2923, -7764, -10260, -9859, -6226, -691, 5994, 11586,
-    13281, 11138, 5690, -1345, -7203, -10906, -12339, -10224, -3274, 6349,
-    13017, 14326, 12060, 7081, 176, -7024, -12632, -14692, -12432, -6788,
-    315, 7839, 13280, 13179, 8931, 3549, -2991, -9053, -12148, -10893,
-    -4439, 4177, 10051, 11864, 10368, 6120, 326, -6521, -12755, -14934,
-    -11920, -6337, 213, 7255, 11728, 12193, 9727, 4629, -2307, -7989,
-    -9615, -5803, -150, 3352, 6834, 9561, 7037, 1277, -3999, -9382,
-    -12501, -11178, -7391, -2502, 4516, 10913, 12932, 11563, 7991, 2323,
-    -3974, -8308, -9244, -7275, -4007, 116, 5430, 8441, 6340, 2175,
-    -3022, -7539, -9401, -9237, -6218, -957, 4874, 9593, 11780, 11423,
-    8390, 2669, -3528, -9244, -12266, -9773, -4650, 70, 4629, 9022,
-    10280, 6698, 1354, -4202, -9375, -9944, -6195, -2813, 176, 5058,
-    9194, 9240, 6405, 1801, -3993, -8144, -8157, -5674, -3175, 606,
-    6735, 10884, 9753, 5569, 691, -4938, -9091, -9264, -7729, -5865,
-    -1193, 5124, 7269, 6037, 4570, 1180, -3013, -4711, -3271, -1488,
-    -249, 3594, 7497, 6471, 2620, -1053, -4950, -8329, -9092, -6847,
-    -3965, -459, 3947, 5871, 6324, 5700, 1641, -2952, -5351, -4311,
-    -660, 2484, 4592, 5293, 4720, 2631, -1776, -6905, -10670, -10738,
-    -7732, -4214, -388, 3576, 6758, 9353, 9986, 6759, 1572, -2334,
-    -3116, -1553, -222, -495, -86, 2117, 3313, 1525, -1946, -5321,
-    -6425, -4931, -2770, -771, 809, 3638, 7560, 9086, 6823, 3066,
-    -200, -2491, -4071, -5207, -5878, -3973, 1837, 7226, 8402, 6426,
-    3331, 433, -2757, -6478, -7579, -6369, -3692, 475, 4095, 6360,
-    5804, 3591, 1396, -2138, -5792, -7327, -6261, -1555, 4794, 8510,
-    7954, 5581, 3417, -1119, -7601, -11059, -10000, -6721, -3140, 647,
-    5101, 7220, 5841, 2632, -1690, -5573, -6953, -5302, -1575, 2941,
-    6187, 7460, 7181, 4657, 27, -5043, -9559, -10821, -8117, -4655,
-    -684, 4728, 8624, 8652, 6584, 2766, -3088, -7035, -6317, -3137,
-    683, 4169, 5592, 6090, 6011, 2435, -3235, -7944, -10588, -10103,
-    -7659, -3855, 1352, 6783, 10602, 11443, 9858, 5400, -1615, -6326,
-    -5651, -2996, -1680, -932, 1798, 6073, 6937, 3392, -1382, -5490,
-    -7360, -7313, -5659, -2822, 765, 6058, 11379, 12790, 9852, 4917,
-    -779, -5585, -7923, -7583, -4952, -1105, 4355, 10030, 10767, 6071,
-    134, -4333, -8409, -10818, -9160, -5576, -1155, 5344, 11209, 11951,
-    8143, 2327, -4112, -9534, -11185, -8216, -3535, 976, 6055, 9345,
-    8391, 4613, -580, -6651, -10649, -9885, -6963, -3894, 429, 6244,
-    9837, 8788, 5079, -842, -7133, -9428, -7704, -4495, -459, 4107,
-    8046, 9448, 7934, 3642, -3118, -9706, -12658, -11642, -8305, -4740,
-    -320, 6307, 10857, 11403, 8899, 4223, -812, -4914, -6824, -6161,
-    -3607, 500, 4406, 6738, 7203, 3849, -1901, -6552, -9947, -10769,
-    -8163, -5044, -1202, 4863, 10683, 12305, 10199, 6084, 92, -4277,
-    -4522, -2966, -1388, 1365, 5097, 7729, 7246, 3362, -2459, -7864,
-    -10384, -10017, -7993, -5105, -417, 6095, 10505, 11310, 8761, 3152,
-    -1578, -2958, -2623, -2320, -868, 2319, 4709, 4893, 3066, -1656,
-    -6934, -8929, -8865, -7537, -4874, -1040, 3579, 6251, 7273, 6594,
-    2572, -1955, -3933, -2230, 1194, 3224, 4314, 5229, 4258, 1380,
-    -2326, -7129, -10574, -10296, -7746, -4741, -489, 4155, 6435, 7114,
-    6931, 4597, 850, -2731, -3883, -1766, 1029, 2435, 2702, 2879,
-    2170, 126, -3431, -7550, -9422, -8673, -6437, -2718, 1934, 5997,
-    8570, 9343, 8120, 4202, -1294, -4681, -4899, -3127, -700, 11,
-    1841, 5518, 6311, 3989, -450, -5725, -8748, -7660, -5504, -4121,
-    49, 6526, 10304, 10145, 7414, 2418, -2379, -4262, -3954, -3040,
-    -2449, 200, 5230, 7781, 6433, 2428, -2224, -6120, -8135, -8256,
-    -7266, -4078, 1376, 6941, 8977, 7694, 4312, -979, -4653, -4853,
-    -3258, -1865, -16, 3592, 6821, 6343, 1553, -3856, -8243, -10960,
-    -10556, -8484, -5457, -1194, 4393, 8818, 9885, 7839, 2816, -2363,
-    -4428, -2994, -200, 1744, 3339, 5567, 6012, 2083, -3353, -7928,
-    -11299, -11671, -9630, -6510, -2261, 3413, 8571, 10484, 9337, 6033,
-    1515, -3030, -5401, -3678, 582, 3711, 5016, 6578, 6455, 2645,
-    -2422, -7493, -10518, -9457, -6668, -4635, -1888, 3198, 7587, 8572,
-    7229, 4429, -533, -5009, -5257, -1975, 2230, 4889, 6692, 8695,
-    7770, 2879, -3572, -8852, -10888, -9196, -6054, -4106, -690, 5149,
-    8667, 8014, 5403, 1456, -2954, -5529, -5716, -2895, 1597, 5515,
-    8526, 8937, 5664, 297, -4979, -9208, -10970, -9000, -6042, -3499,
-    679, 6008, 8801, 7394, 4600, 1843, -1876, -4993, -5641, -3888,
-    1225, 6811, 7995, 6599, 4113, -579, -6244, -10357, -11214, -8877,
-    -4686, -1013, 2926, 7684, 8795, 7059, 4613, -482, -5038, -5604,
-    -3702, -777, 2824, 6091, 7436, 5123, 439, -3705, -7399, -9762,
-    -9418, -7311, -4232, 63, 5140, 7765, 7480, 6139, 2839, -1432,
-    -3163, -908, 1169, 1409, 4509, 8037, 5452, 43, -2843, -4876,
-    -7109, -8870, -9474, -6879, -1640, 2673, 4158, 5338, 6321, 4651,
-    2064, 1163, 2747, 3131, 1884, 4335, 6821, 3848, -677, -3187,
-    -5710, -8635, -10079, -9487, -6044, -1270, 1154, 2994, 6987, 8882,
-    6274, 2275, -305, -49, 791, 649, 2349, 4672, 3844, 931,
-    -1856, -4781, -8103, -10890, -11428, -8110, -2895, 1005, 4849, 9947,
-    12125, 9445, 5095, 566, -3577, -5835, -4547, -589, 1463, 1363,
-    1910, 884, -2822, -6483, -7938, -7025, -4608, -1607, 1517, 6470,
-    10800, 10288, 7217, 3651, 32, -3122, -6563, -8387, -7322, -5536,
-    -2723, 1877, 4773, 4270, 2746, 1451, 901, 987, -96, -2085,
-    -2524, -1073, 846, 1983, 1575, 635, -173, -1382, -2646, -4633,
-    -7664, -8506, -5120, -375, 3748, 8040, 11248, 10951, 7450, 3201,
-    -455, -4051, -7743, -9318, -6810, -2731, -245, 1461, 3235, 3473,
-    442, -4191, -6332, -5151, -2003, 2347, 6789, 9929, 10778, 8634,
-    3615, -2096, -6330, -8442, -8122, -6149, -2753, 2169, 5774, 6831,
-    6214, 3044, -2111, -5202, -3935, -1420, 788, 3184, 4367, 4138,
-    2111, -1430, -4861, -7710, -8952, -7699, -3993, 18, 2801, 5529,
-    7017, 6345, 4357, 930, -2956, -4466, -2609, 370, 2848, 4257,
-    4015, 1168, -3473, -7097, -9169, -9501, -7850, -5259, -1613, 3024,
-    7101, 9351, 9656, 8068, 4710, 326, -3808, -5371, -3781, -1086,
-    1585, 3905, 4270, 2064, -912, -4193, -6910, -7350, -5933, -3158,
-    498, 4939, 8936, 10222, 9031, 6515, 3269, -1731, -7182, -8436,
-    -5824, -2222, 1669, 5228, 6758, 5173, 1336, -3928, -7962, -8842,
-    -7632, -4467, -176, 4326, 8000, 8980, 7915, 5868, 1887, -3866,
-    -7878, -8327, -7059, -3668, 1637, 5337, 6341, 5703, 3258, -1154,
-    -5476, -7749, -7860, -6034, -2664, 1431, 5196, 7513, 7313, 5283,
-    2785, -494, -4231, -6661, -6175, -3320, 136, 3638, 5585, 5238,
-    3809, 7, -5303, -7608, -6820, -5506, -3522, 112, 4663, 7118,
-    6594, 5776, 4827, 1986, -2116, -5086, -6259, -6381, -4079, 271,
-    3595, 5168, 5440, 4021, 395, -2952, -3193, -2816, -2437, -231,
-    2322, 4697, 6094, 5020, 3450, 2542, 189, -4267, -7863, -7549,
-    -4083, -763, 1137, 3314, 5436, 4786, 2055, 12, -1099, -1536,
-    -692, 634, 2008, 3516, 3533, 2308, 1268, -85, -2130, -4646,
-    -5494, -3072, -501, 510, 2611, 5012, 3673, 756, -272, -1921,
-    -3641, -3512, -2924, -158, 3256, 3333, 3248, 3440, 271, -3490,
-    -4544, -3380, -805, 755, 1344, 4067, 6031, 3278, -722, -3094,
-    -5257, -6497, -6180, -5483, -2933, 1352, 4493, 6381, 7037, 4906,
-    318, -4111, -5507, -3158, -231, 1137, 3516, 6117, 5256, 2127,
-    -1336, -5704, -10244, -12029, -10379, -6994, -2718, 2204, 8128, 12120,
-    11378, 8630, 4461, -1073, -5344, -7764, -7377, -3828, -218, 1787,
-    3377, 3644, 1174, -2972, -7548, -9611, -7548, -4699, -1680, 4254,
-    10661, 13007, 12314, 10197, 5602, -841, -7114, -10976, -11428, -9674,
-    -6092, -423, 4837, 6367, 5322, 3944, 889, -2427, -1954, -23,
-    785, 3145, 5548, 6203, 6657, 4486, -530, -4850, -7692, -9633,
-    -10353, -8710, -4882, 423, 4813, 6943, 10010, 10800, 5508, 95,
-    -2181, -3510, -4895, -4691, -1468, 2492, 4609, 4073, 2668, 1954,
-    -996, -6309, -8817, -6933, -3916, -818, 4137, 9472, 11429, 9562,
-    5430, -65, -5473, -9361, -10469, -7420, -2219, 1549, 4497, 7542,
-    7675, 4243, -20, -4359, -7667, -7687, -4572, 212, 4772, 6796,
-    6339, 4579, 1000, -3138, -6407, -9172, -8389, -3980, -438, 3498,
-    8746, 10301, 7148, 3871, 1263, -3155, -7827, -9394, -6787, -2447,
-    167, 1543, 3594, 5175, 2787, -1862, -2695, -1339, -1307, -507,
-    1284, 3261, 5105, 4909, 3087, 1360, -776, -3146, -4890, -6971,
-    -7161, -2806, 837, 1642, 4250, 6681, 5030, 1577, -525, -1008,
-    -1378, -1935, -1829, -35, 2358, 2360, 1771, 2082, 456, -2156,
-    -4219, -6210, -5792, -2063, 1384, 2708, 4775, 7784, 7095, 2260,
-    -1687, -2504, -3174, -4605, -3631, -384, 2972, 5205, 4422, 2724,
-    2238, -474, -4556, -5945, -6396, -6535, -3998, -405, 2747, 5521,
-    6051, 4374, 1308, -2113, -2680, -2047, -2667, -921, 2564, 3730,
-    4002, 4003, 2313, 582, -1420, -5146, -8030, -8754, -8795, -7103,
-    -2382, 2298, 4615, 6558, 7008, 4082, 1939, 1928, 1060, -61,
-    78, 1216, 1977, 1036, -54, -194, -1346, -3917, -5996, -7369,
-    -7858, -5341, -1066, 1651, 3842, 7290, 9537, 7619, 4300, 3389,
-    2730, 630, -1359, -2305, -1713, -1076, -1836, -1869, -292, -560,
-    -3683, -5620, -5288, -4123, -1445, 2149, 5704, 8914, 10273, 9371,
-    6581, 2652, -946, -3902, -5572, -5291, -3861, -1240, 1956, 3682,
-    3817, 2613, -435, -3925, -6336, -7613, -6760, -3010, 2207, 6435,
-    8060, 8012, 6499, 1921, -3403, -5803, -5949, -5829, -5438, -2900,
-    2113, 5655, 5316, 3946, 2812, -462, -5052, -7279, -7206, -6301,
-    -2783, 2702, 6216, 7809, 8230, 5301, -111, -3928, -5267, -6408,
-    -6854, -4586, -509, 3355, 5209, 5490, 6096, 4399, -1169, -5197,
-    -5986, -7832, -9165, -5426, 1136, 6036, 8426, 9643, 9217, 5160,
-    188, -2138, -3816, -6328, -7324, -4814, -776, 1823, 4067, 5825,
-    4132, 29, -3748, -6801, -8120, -6229, -1984, 2651, 6804, 10859,
-    13408, 10636, 4247, -162, -3358, -7607, -10389, -8973, -4182, 141,
-    2398, 4389, 5330, 2573, -2689, -6900, -8457, -6777, -2438, 2506,
-    7732, 12238, 13226, 10359, 4594, -2086, -7018, -10590, -12293, -9693,
-    -4704, -286, 3440, 5572, 5677, 4373, 555, -4377, -6916, -7472,
-    -5899, -702, 4634, 7259, 8849, 8674, 4553, -791, -4023, -6547,
-    -8179, -6864, -4195, -435, 3830, 4927, 4162, 3798, 1906, -1355,
-    -4130, -5792, -6194, -4725, -338, 4467, 5885, 6746, 8891, 6257,
-    -137, -2543, -3155, -5502, -5890, -3176, 285, 2386, 2951, 3606,
-    3361, 837, -1848, -2824, -3751, -6191, -6631, -1893, 3640, 5249,
-    5821, 7944, 7554, 3462, 418, -644, -2195, -3933, -4322, -3189,
-    -1927, -749, 1243, 1797, 61, -740, -712, -2270, -4172, -2962,
-    983, 3309, 4443, 7151, 8096, 4814, 895, -864, -1948, -4636,
-    -8023, -7588, -2697, 224, 1334, 5389, 7298, 4026, 434, -2125,
-    -4537, -6701, -6688, -3683, -122, 3963, 7297, 7045, 4859, 1434,
-    -3558, -6729, -6501, -5660, -4313, -626, 3396, 6554, 8292, 6649,
-    3670, 324, -4852, -9424, -11324, -10505, -7189, -2361, 3477, 7975,
-    8536, 7143, 5053, 490, -3860, -4180, -3255, -2621, 486, 4349,
-    6001, 6024, 3895, 87, -3028, -6123, -8984, -9168, -7328, -5120,
-    -2425, 1371, 5861, 8713, 7868, 5051, 3894, 2875, 62, -468,
-    1405, 2100, 1722, 629, -310, -778, -2085, -3554, -4424, -4516,
-    -3288, -1817, -1770, -1966, -908, 425, 2457, 4120, 3853, 4770,
-    5702, 4225, 3550, 3011, 848, -627, -1487, -2811, -3225, -2753,
-    -2873, -2748, -2107, -1964, -1951, -2052, -1256, 496, 439, -28,
-    2399, 5423, 5275, 3571, 3191, 2656, 1161, -521, -2461, -3002,
-    -2329, -2727, -2609, -555, 381, -516, -402, -266, -1849, -3283,
-    -2704, -8, 1517, 1096, 2848, 4243, 1521, -569, 244, 595,
-    -446, -1583, -1227, 825, 1358, 131, 483, 1137, 245, -1239,
-    -2664, -2276, -1467, -3660, -5612, -4093, -1940, -371, 1121, 2181,
-    4813, 7311, 5507, 3330, 3666, 2403, -1452, -4607, -4816, -3197,
-    -2169, -1578, 713, 3263, 1981, -766, -1577, -3120, -6440, -8720,
-    -6807, -1988, 1357, 4604, 10390, 14699, 12806, 7654, 3836, -517,
-    -5698, -8466, -8245, -5755, -2361, 897, 3358, 3642, 2172, 171,
-    -2949, -7193, -8776, -5654, -1541, 1733, 6306, 11529, 13456, 11293,
-    7127, 1123, -4929, -8196, -9307, -8405, -4560, 224, 3143, 4963,
-    6231, 4351, -609, -5453, -7448, -6461, -4935, -2061, 3222, 7534,
-    8990, 8162, 5316, 1103, -3235, -6697, -9061, -8959, -5525, -749,
-    3590, 6248, 6673, 5712, 3168, -1421, -6389, -8781, -8344, -7164,
-    -3784, 2067, 5845, 6874, 7101, 4817, 183, -2909, -3865, -4797,
-    -4557, -1699, 2138, 5016, 5722, 5028, 5027, 4269, 387, -4325,
-    -6915, -7925, -8985, -9124, -5299, 733, 4077, 5747, 7872, 8292,
-    5965, 2928, 301, -2068, -2888, -2444, -1859, 579, 3662, 4838,
-    4398, 2450, -332, -3818, -7952, -10636, -10872, -8806, -4185, 2122,
-    6209, 6730, 8337, 10405, 7887, 2662, -529, -799, -565, -1996,
-    -2768, -212, 2616, 2072, -134, -1526, -2944, -5877, -9510, -11219,
-    -8867, -3560, 1191, 4618, 8431, 12490, 13004, 8086, 3673, 2218,
-    -802, -4327, -5428, -3980, -1278, -729, -1351, -156, 238, -2020,
-    -4124, -5551, -7622, -7145, -2918, 1543, 5472, 9030, 11811, 12501,
-    8816, 3701, 204, -3417, -7258, -9998, -9288, -4280, -875, -493,
-    2055, 3956, 1679, -693, -2115, -4307, -5502, -4601, -2233, 1804,
-    6547, 9523, 9335, 6803, 4756, 2140, -4035, -8649, -7653, -4893,
-    -2293, 235, 3047, 5616, 4857, 2061, -440, -4264, -7834, -8202,
-    -6659, -4748, -2339, 547, 3203, 5236, 6670, 6988, 5861, 4266,
-    3682, 3584, 2209, 707, 478, 390, -925, -3224, -4241, -5249,
-    -8008, -9024, -8203, -6595, -3170, -545, 1365, 4017, 5468, 5813,
-    6660, 7598, 7668, 7592, 7136, 5418, 3346, 814, -1586, -4298,
-    -7997, -9181, -8531, -8746, -7706, -4925, -1803, 816, 1916, 1959,
-    2749, 3805, 4031, 4997, 5700, 5419, 5831, 4555, 1411, 217,
-    375, -1361, -4518, -5144, -3244, -2308, -2330, -1191, 613, 636,
-    -468, -888, -1441, -2059, -2628, -2588, -13, 3407, 4902, 4276,
-    2853, 2762, 2611, 230, -1017, 135, 657, 438, 606, 830,
-    775, -148, -2809, -5233, -5354, -5361, -4922, -2615, -1070, -567,
-    -35, 639, 1803, 1925, 1419, 2139, 4418, 6302, 5084, 3843,
-    4039, 1632, -2582, -5142, -5763, -5338, -4776, -4241, -2889, -462,
-    1148, 952, -63, -2231, -4335, -3944, -2310, -822, 1292, 5429,
-    10005, 9837, 6710, 5520, 3791, -61, -4496, -7229, -5804, -4175,
-    -4560, -2488, 1881, 3605, 2375, 951, -1820, -5542, -7009, -5809,
-    -2665, -201, 1507, 5686, 9523, 10012, 9198, 7416, 3778, -830,
-    -4588, -6254, -6255, -5644, -4036, -1012, 1470, 2274, 1347, -1383,
-    -4413, -6306, -6687, -4815, -298, 3697, 5242, 6983, 8789, 8883,
-    7019, 2988, -1475, -3761, -4768, -6213, -4996, -1222, -190, -289,
-    1101, 735, -1400, -2456, -3159, -5042, -5969, -4130, -1030, 2092,
-    3999, 5620, 8053, 8206, 5600, 3358, 2219, -117, -3207, -4101,
-    -3448, -2780, -2090, -1836, -1065, 154, -276, -1580, -1928, -2481,
-    -4471, -5824, -5402, -4109, -800, 3859, 7393, 10372, 12149, 11051,
-    8698, 5358, 862, -3386, -7192, -8796, -7064, -4702, -3459, -986,
-    1598, 500, -2108, -4180, -6524, -7939, -7765, -5179, 163, 6010,
-    10797, 14292, 15652, 13266, 8211, 2888, -2514, -6861, -8820, -9028,
-    -6996, -2562, 1746, 2358, 606, -751, -3023, -6293, -9226, -9553,
-    -6442, -1911, 3326, 8628, 12446, 13210, 10948, 6688, 1165, -3810,
-    -6917, -7931, -6178, -2278, 1078, 3154, 4537, 3985, 1018, -1905,
-    -4656, -7581, -8171, -6922, -5772, -3536, 690, 4672, 6211, 5352,
-    4440, 4683, 3219, 300, -20, 1401, 2298, 2878, 2967, 2749,
-    2676, 1287, -1740, -4010, -5617, -7408, -7943, -7071, -6394, -5601,
-    -3257, 259, 3838, 5808, 7141, 10708, 13025, 10480, 7446, 6174,
-    3395, -810, -3820, -4813, -4564, -4428, -4805, -3931, -2451, -3152,
-    -4587, -5598, -7001, -6556, -3219, 420, 3426, 6627, 10595, 13492,
-    12574, 9021, 5854, 2310, -3288, -7930, -8166, -5954, -4310, -3082,
-    -1915, -446, -411, -3181, -5966, -6891, -6873, -5436, -1123, 3564,
-    6639, 8997, 9438, 7596, 5401, 2953, -738, -3979, -4511, -3491,
-    -2355, -1001, 328, 1105, -262, -2518, -3428, -4953, -6687, -6921,
-    -5800, -3908, -1322, 2617, 5586, 6456, 7122, 6969, 5957, 3804,
-    942, -97, 473, 949, -391, -1441, -118, 50, -2025, -3389,
-    -3842, -4100, -4058, -4201, -4299, -3583, -2283, -1413, -34, 2776,
-    5633, 7631, 8450, 8201, 8258, 7753, 4717, 1408, -720, -2930,
-    -5222, -6226, -5670, -5161, -3639, -1323, -1012, -1714, -2052, -2846,
-    -4332, -5488, -4213, -446, 4444, 8365, 10596, 12473, 12041, 8326,
-    3928, -404, -4836, -7503, -7517, -6030, -3696, -811, 441, 6,
-    -1143, -3812, -5898, -6529, -6969, -4968, 277, 5221, 8402, 11009,
-    11972, 9811, 5537, 259, -4220, -5881, -6240, -5568, -2132, 1224,
-    2359, 2552, 1962, -355, -3788, -6101, -7233, -7925, -6428, -3268,
-    -529, 2420, 5839, 7340, 5953, 5100, 5237, 3419, 1001, -148,
-    -1261, -1457, -795, -978, -1110, -986, -1889, -2902, -2331, -2337,
-    -4507, -5435, -4266, -4162, -4578, -3162, 306, 3552, 4589, 6607,
-    10836, 12336, 9139, 4938, 2701, 249, -4319, -8180, -8247, -5452,
-    -3743, -3697, -2382, -356, 309, -234, -2095, -4770, -5457, -2990,
-    482, 3189, 6180, 10818, 13921, 12585, 8682, 4976, 1542, -3496,
-    -9098, -10954, -8487, -5327, -3245, -1044, 1133, 1166, -408, -2948,
-    -5707, -6245, -4166, -169, 4058, 7498, 11412, 13323, 10457, 5424,
-    1188, -2739, -6195, -7709, -7408, -4456, -532, 833, 1279, 1329,
-    -1345, -4647, -6637, -8786, -9567, -6567, -2264, 2506, 8103, 10796,
-    10215, 9623, 7787, 3303, -1350, -4392, -5631, -5139, -3685, -1881,
-    494, 1822, 928, -634, -1675, -3117, -5044, -6237, -6566, -5437,
-    -2990, -483, 2223, 5275, 7957, 9227, 9209, 8181, 5820, 3681,
-    1288, -2210, -3987, -4249, -5097, -4903, -3024, -2253, -2979, -2729,
-    -2149, -3323, -4852, -5280, -4328, -2601, -1762, 892, 6906, 11827,
-    13105, 13153, 13125, 10569, 5309, -182, -4358, -6976, -8893, -9567,
-    -7640, -4645, -2341, -1006, -1824, -3992, -4816, -5220, -6247, -5146,
-    -224, 6142, 11093, 13571, 14640, 14219, 10120, 3600, -1916, -5929,
-    -8746, -9197, -6697, -3124, -458, 1525, 1930, -631, -4546, -6928,
-    -7888, -8239, -6599, -2495, 2754, 8157, 11233, 11536, 10825, 7738,
-    2121, -2672, -4596, -5660, -6001, -4042, -1423, 492, 2019, 1863,
-    -74, -1929, -3727, -5448, -5696, -4628, -3126, -1823, 88, 3101,
-    4493, 4374, 4905, 5282, 4525, 4165, 3962, 1984, 401, 185,
-    -1275, -2435, -2263, -3024, -4087, -4092, -3700, -3593, -3697, -3537,
-    -2888, -1840, -949, -541, 1128, 4625, 7362, 7462, 8057, 10765,
-    9925, 4459, 1399, 908, -1839, -6029, -8428, -7523, -5393, -5014,
-    -5249, -3450, -1309, -1494, -2619, -2435, -1275, -113, 1405, 4286,
-    7006, 8526, 10086, 9767, 6418, 3987, 2580, -1483, -5883, -7604,
-    -7144, -6296, -6126, -4438, -1606, -1416, -3069, -3550, -3528, -4144,
-    -3807, -1087, 3425, 7349, 9124, 9860, 9258, 6816, 4420, 1224,
-    -3831, -6517, -5960, -4800, -2993, -1416, 391, 2575, 1269, -2375,
-    -3882, -4733, -6968, -7588, -5074, -838, 4684, 8236, 8543, 8802,
-    7855, 4581, 546, -3337, -4520, -3484, -3040, -1930, 706, 2180,
-    2151, 1707, -500, -2981, -4216, -6146, -7972, -7923, -6500, -3412,
-    865, 4636, 8139, 10237, 9708, 8426, 6417, 3110, 256, -1280,
-    -2036, -2274, -2444, -1991, -518, -1088, -4022, -5346, -5521, -7232,
-    -9058, -8208, -5029, -1405, 1537, 4140, 7645, 11085, 12376, 11317,
-    9639, 8182, 5627, 1379, -2280, -3232, -3261, -5163, -7171, -7283,
-    -6559, -6427, -7142, -7534, -6707, -5016, -3611, -1793, 1507, 4958,
-    8316, 11145, 11920, 11604, 10156, 6761, 2147, -2089, -4417, -4810,
-    -5583, -6571, -4981, -2708, -2567, -3447, -4910, -6451, -5748, -4404,
-    -3992, -1515, 2920, 6702, 9549, 10779, 10437, 8549, 4366, -378,
-    -3152, -4780, -6019, -5435, -2891, 446, 1894, 854, 234, -241,
-    -2493, -4861, -5701, -6015, -6423, -5160, -1280, 3537, 6739, 7965,
-    8312, 6957, 4311, 1661, -1035, -2424, -2571, -2070, -74, 1703,
-    1825, 1556, 1234, -339, -3100, -5974, -8037, -8434, -7778, -6869,
-    -4365, 94, 4171, 7061, 9111, 9820, 9403, 7901, 5549, 3335,
-    1952, 918, -502, -1618, -2044, -2130, -2305, -3433, -5520, -7535,
-    -8256, -7894, -7159, -4861, -1108, 1620, 3609, 6324, 8673, 10140,
-    10113, 8510, 7485, 6250, 3361, 840, -1395, -4138, -5861, -6989,
-    -8363, -8160, -6548, -5282, -4008, -2965, -2188, -1245, -1618, -2148,
-    238, 3949, 5972, 7371, 9760, 10614, 8530, 5541, 2102, -1982,
-    -4995, -6537, -6697, -5151, -3744, -2608, -393, 523, -1333, -3182,
-    -4167, -5719, -6772, -5516, -1486, 3975, 8054, 10527, 11200, 9579,
-    6686, 2420, -1953, -5074, -6951, -5785, -2112, 360, 1533, 3279,
-    3101, -719, -4434, -6412, -7799, -8678, -7938, -4187, 801, 5074,
-    8815, 10051, 8535, 7297, 5404, 1347, -1714, -1884, -711, 523,
-    1428, 2733, 3879, 2443, -1136, -4311, -6772, -9091, -10198, -8375,
-    -4511, -1412, 1437, 4833, 6138, 5667, 6431, 6677, 5222, 5209,
-    6069, 5684, 4782, 3410, 2240, 759, -2807, -6119, -7557, -8818,
-    -9691, -8960, -7444, -5287, -2390, -736, 200, 2347, 4417, 6288,
-    7701, 7355, 8121, 9909, 8009, 4965, 4267, 1804, -2934, -6599,
-    -8994, -10089, -10016, -9069, -6455, -3934, -3063, -1437, 184, -823,
-    -913, 1819, 4871, 7361, 8615, 10231, 12015, 9628, 5516, 2743,
-    -2259, -7589, -9491, -10343, -10013, -7211, -4615, -2655, -459, 563,
-    302, -732, -2479, -2696, -813, 1351, 4780, 8702, 10112, 9921,
-    8761, 5896, 1658, -3639, -7753, -8956, -8432, -7051, -4471, -866,
-    1947, 2850, 2550, 1096, -1390, -3725, -4874, -5145, -4256, -1047,
-    2571, 4995, 7129, 7931, 7089, 5032, 1395, -1433, -2118, -2558,
-    -3296, -3087, -1433, 489, 465, -1146, -1836, -2582, -4560, -5800,
-    -6187, -5429, -2861, -420, 1530, 4130, 6507, 7435, 7268, 6658,
-    6120, 5258, 3117, 1054, -61, -1165, -2073, -3586, -5544, -6378,
-    -6737, -7234, -7501, -7152, -5680, -3508, -1270, 728, 2398, 4289,
-    6917, 9616, 10560, 10085, 10149, 9393, 5875, 1908, -1124, -4604,
-    -8008, -10377, -11295, -10032, -7987, -6458, -4777, -2862, -1001, 335,
-    392, 344, 2219, 5077, 7402, 9260, 10521, 11237, 10183, 6985,
-    3753, -558, -5739, -8484, -9672, -10062, -8686, -6655, -3921, -1192,
-    -248, 780, 1828, 148, -1901, -1752, -1001, 909, 4446, 6792,
-    7772, 8382, 7731, 6164, 3251, -1192, -4066, -4500, -4360, -4339,
-    -3479, -1116, 190, -1254, -2768, -2755, -2900, -4412, -5694, -4770,
-    -2354, -118, 1727, 4105, 6399, 7456, 7782, 7566, 6171, 4122,
-    2673, 1535, 77, -775, -1375, -2287, -2680, -3554, -5444, -6700,
-    -7266, -8308, -8233, -6082, -3782, -1228, 1551, 3691, 5844, 7153,
-    8329, 10049, 9396, 7502, 7084, 6149, 3575, 1284, -562, -2809,
-    -5210, -8319, -10601, -10554, -10955, -11128, -8621, -5363, -2120, 1280,
-    3675, 4735, 4959, 5576, 7265, 8498, 8202, 8279, 9597, 9317,
-    6398, 2992, -280, -4173, -8213, -11395, -12775, -12325, -11442, -9536,
-    -5983, -2881, -446, 2208, 3698, 3663, 4037, 5795, 7146, 7155,
-    8048, 10264, 10335, 7591, 5316, 2425, -2930, -7356, -9187, -9505,
-    -8855, -7975, -6077, -3406, -2349, -2267, -1295, -703, -1431, -1203,
-    512, 1847, 3257, 5752, 7663, 8082, 8615, 9033, 6952, 2941,
-    109, -751, -1875, -4561, -6435, -5465, -4103, -4951, -5595, -4222,
-    -3757, -4703, -4097, -2251, -1405, -1082, 293, 2264, 3574, 4984,
-    7406, 8800, 7732, 7048, 8074, 7010, 2735, -641, -1736, -3292,
-    -6287, -8532, -8718, -8564, -8933, -8015, -5575, -3787, -2964, -819,
-    2269, 3841, 4855, 6273, 7087, 7574, 8123, 8562, 7838, 5621,
-    4263, 3311, 596, -2317, -4803, -8046, -10627, -11645, -11793, -9763,
-    -6348, -4029, -999, 2835, 4856, 5921, 6137, 5373, 5319, 5561,
-    6150, 6538, 5250, 4887, 5297, 2655, -503, -1780, -4291, -7193,
-    -7855, -7557, -6434, -4755, -3842, -1999, 320, 712, 450, 250,
-    -273, 149, 1416, 2713, 4488, 6248, 6924, 6921, 6246, 4162,
-    1666, -705, -2973, -3489, -2929, -3598, -3948, -2357, -1524, -2758,
-    -3673, -3576, -3794, -4920, -5419, -2920, 801, 2841, 3871, 4757,
-    5685, 6115, 5717, 5500, 4505, 2632, 2372, 2613, 995, -1147,
-    -2573, -3518, -4308, -5848, -7052, -6616, -6565, -6454, -4404, -2290,
-    -843, 538, 1510, 2846, 4243, 4816, 5336, 5539, 5521, 6734,
-    7491, 5788, 3417, 1331, -1329, -4394, -7026, -8305, -8589, -8683,
-    -7779, -5976, -4948, -3953, -1628, -52, 481, 2348, 4174, 4891,
-    5892, 6164, 6174, 7767, 7672, 4232, 2246, 1921, -921, -4384,
-    -5762, -6281, -6070, -5352, -4883, -3656, -2308, -2665, -2584, -246,
-    1222, 1076, 1769, 2637, 2824, 2675, 2323, 3221, 4204, 2937,
-    2757, 4840, 3978, 904, 738, 1604, 240, -1808, -2847, -2938,
-    -3168, -4442, -5455, -4829, -3666, -3075, -2070, -288, 482, 88,
-    375, 725, 493, 1836, 4480, 5921, 6324, 7059, 7991, 7627,
-    4811, 920, -1701, -3763, -6463, -8185, -8557, -7996, -6218, -4856,
-    -3783, -1704, -408, -290, 104, 438, 1112, 3332, 5183, 5594,
-    6964, 8272, 7466, 6253, 4637, 1809, -922, -3168, -5092, -5893,
-    -5658, -5778, -5877, -5184, -4765, -4578, -4277, -3919, -2728, -981,
-    845, 2871, 5053, 6951, 7329, 6359, 5025, 3167, 1432, 292,
-    -554, 117, 1612, 882, -380, -128, -1498, -4194, -5977, -7973,
-    -8413, -6626, -5420, -3184, 528, 2605, 4060, 5416, 4497, 2792,
-    1994, 1292, 1326, 2212, 2894, 4358, 6453, 6270, 3647, 1453,
-    -135, -2904, -6109, -7926, -7684, -6106, -5178, -4502, -2252, -377,
-    -389, -203, 351, 476, 1139, 2069, 3165, 4976, 6100, 6686,
-    7729, 6895, 3566, 1037, -185, -2322, -4022, -3731, -3863, -4570,
-    -4089, -3431, -3253, -3532, -4234, -3994, -2678, -1091, 1351, 4123,
-    5266, 5437, 5939, 5948, 5214, 3135, -155, -1744, -1264, -751,
-    -493, 180, 1089, 896, -555, -2096, -3258, -4605, -6492, -7161,
-    -5574, -3093, -566, 1657, 3464, 4703, 4875, 4373, 3467, 1693,
-    -487, -1547, -1386, -994, 444, 2846, 3715, 3063, 3144, 2807,
-    -57, -3005, -4085, -4808, -5575, -6119, -5387, -2350, 23, 495,
-    1888, 3470, 3427, 2938, 2104, 1178, 771, -280, -442, 1960,
-    3798, 3566, 3623, 4311, 3328, 535, -1355, -1989, -3625, -5787,
-    -6274, -5179, -3546, -2400, -1916, -440, 1454, 2023, 2046, 1941,
-    1706, 1776, 2149, 2854, 3322, 3555, 3930, 3754, 2994, 2400,
-    1696, 36, -1877, -3189, -3769, -3161, -2782, -3316, -3004, -1947,
-    -1132, -637, -175, 201, 589, 1602, 2116, 1946, 1961, 1222,
-    607, 994, 931, 594, 1125, 2169, 2563, 2152, 1491, 1318,
-    1314, -599, -2826, -2717, -2716, -3845, -3901, -2917, -1882, -743,
-    -171, -589, -569, -25, 96, 524, 1297, 1773, 2223, 2702,
-    2822, 2616, 2536, 2106, 1073, 496, 151, -630, -1368, -2433,
-    -3570, -3600, -3610, -3826, -3163, -3342, -3591, -1693, -485, -284,
-    1236, 2194, 2307, 3128, 3331, 2804, 1994, 16, -948, 327,
-    894, 406, 527, 1041, 1161, 170, -875, -1238, -2633, -4425,
-    -4825, -4089, -2899, -2575, -2556, -494, 1823, 2136, 2327, 2725,
-    2233, 1895, 1769, 1788, 2289, 1753, 1075, 1851, 1832, 1071,
-    1265, 458, -1402, -2163, -2137, -1933, -2135, -2886, -2680, -2005,
-    -2296, -2146, -1215, -924, -638, 60, 1108, 2694, 2975, 2049,
-    2259, 2824, 2836, 2690, 1961, 1326, 1134, -110, -1880, -1965,
-    -1241, -1495, -1864, -1320, -642, -1437, -2720, -2534, -2648, -3563,
-    -2932, -941, 1021, 2760, 4345, 5181, 4986, 3986, 2212, 404,
-    -1331, -2734, -2687, -1961, -1470, -1238, -752, 673, 1393, 301,
-    -709, -733, -1816, -3475, -2525, -809, -385, 740, 2217, 3083,
-    3045, 1651, 380, -356, -1497, -2205, -1521, -883, -923, -482,
-    239, 807, 822, 562, 827, 439, -111, 713, 1289, 1061,
-    1325, 1537, 829, -327, -1553, -2403, -2741, -3448, -3327, -1703,
-    -525, 87, 593, 747, 1045, 1164, 412, -2, 801, 968,
-    633, 1674, 3154, 4019, 3676, 2385, 1400, 48, -2091, -3852,
-    -4206, -3543, -3152, -2359, -493, 623, -72, -760, -407, -764,
-    -820, 726, 1370, 1363, 2130, 2719, 2638, 2122, 1618, 1123,
-    687, 235, -521, -626, -608, -1329, -1458, -944, -702, -1004,
-    -1199, -782, -532, -484, -402, -178, 97, -120, -127, 29,
-    18, 346, 596, 1261, 2454, 2953, 2449, 1961, 2108, 1328,
-    -490, -1792, -2566, -2724, -2221, -1528, -861, -79, 903, 661,
-    -400, -258, 27, -673, -1110, -445, 445, 1056, 1627, 1753,
-    1141, 150, -585, -1076, -1455, -901, -219, -228, 584, 1719,
-    2023, 2220, 1960, 1326, 1615, 1565, 297, -215, -291, -1438,
-    -2225, -2033, -2272, -2415, -2418, -2718, -1759, -262, -46, -9,
-    827, 1583, 1725, 1556, 1421, 1701, 2078, 1960, 2499, 3624,
-    3719, 2752, 1113, -139, -953, -2665, -4699, -5296, -3884, -2854,
-    -2986, -1687, -7, -215, -719, -391, -228, 59, 1054, 1754,
-    2330, 3190, 3505, 3306, 2298, 948, 676, 132, -1452, -1906,
-    -863, -27, 472, 865, 698, 340, -511, -2081, -3408, -3951,
-    -4033, -3458, -2315, -1536, -64, 2420, 3241, 2138, 1718, 2017,
-    1633, 1281, 1612, 2065, 2851, 3220, 2635, 2248, 1033, -1159,
-    -3004, -4420, -4659, -3952, -3768, -3004, -881, -135, -350, 790,
-    1685, 1167, 585, 715, 1691, 2302, 1791, 1973, 3076, 3112,
-    1937, 1284, 909, -438, -2554, -4073, -4219, -3564, -2436, -1209,
-    165, 1665, 2780, 3542, 3306, 1766, 466, -267, -1463, -2347,
-    -2061, -1415, -1155, -921, 0, 1532, 1666, 240, 166, 762,
-    -410, -1438, -609, 223, 422, 821, 1542, 2487, 2758, 2092,
-    1587, 1337, 220, -1728, -2774, -2622, -2629, -3182, -3310, -2232,
-    -689, -31, -119, 294, 1100, 1191, 968, 1025, 782, 474,
-    113, -575, -662, -103, 161, 220, 584, 1028, 1363, 979,
-    20, -388, -460, -839, -1316, -1642, -1697, -738, 4, -791,
-    -1128, -741, -1527, -2343, -1751, -731, -179, 360, 1470, 2497,
-    2829, 2246, 1731, 1753, 1010, 17, -196, -68, -356, -1137,
-    -1675, -1333, -796, -1365, -1876, -1090, -1153, -2091, -1586, -481,
-    208, 1229, 2302, 2656, 2631, 2243, 1435, 473, -483, -626,
-    -227, -249, -126, 343, 447, 41, -392, -552, -802, -1014,
-    -624, -140, -439, -86, 1316, 1145, 124, 256, 63, -1179,
-    -2033, -1862, -945, -143, 234, 1058, 2276, 2890, 2677, 2035,
-    1178, 475, -250, -1270, -1798, -1185, -690, -601, 534, 1493,
-    664, -325, -440, -1428, -2737, -2357, -1424, -1011, -155, 1383,
-    2303, 2153, 1861, 1403, 482, 43, 153, 155, 248, 460,
-    273, -121, -457, -1314, -1981, -1722, -1080, -405, 100, 697,
-    1563, 2055, 1653, 1112, 782, 41, -388, -774, -1316, -571,
-    248, 281, 613, 393, -187, 54, -43, -991, -1294, -599,
-    -281, -273, 122, 900, 1874, 2089, 1600, 1244, 1062, 292,
-    -1522, -2647, -1546, -354, -592, -420, 743, 1107, 190, 239,
-    983, 519, -35, 151, 539, 840, 651, 147, -43, 11,
-    -193, -759, -846, -680, -794, -1004, -992, -458, -339, -429,
-    -114, 407, 1168, 1491, 1383, 1517, 1313, 432, 88, 439,
-    153, -619, -916, -730, -231, -569, -1221, -841, -875, -1094,
-    -517, -334, -744, -607, -112, 156, 708, 1299, 1383, 1333,
-    1398, 1608, 1569, 594, -550, -975, -1112, -1437, -1629, -1305,
-    -1049, -1004, -821, -638, -482, -660, -1052, -524, 269, 391,
-    753, 1191, 1370, 1423, 945, 0, -759, -637, -247, -75,
-    361, 771, 863, 647, 441, 374, -316, -1470, -2057, -2052,
-    -2161, -1892, -483, 589, 924, 1569, 1770, 1103, -10, -829,
-    -1064, -1273, -1105, -40, 1417, 2242, 2426, 2434, 2084, 925,
-    -696, -1797, -2533, -3394, -3584, -2428, -865, -48, 281, 1416,
-    2452, 1842, 1100, 1388, 1192, 186, -41, 355, 618, 629,
-    349, -81, -404, -700, -1358, -1839, -1980, -1688, -1066, -772,
-    -611, -359, -26, 201, 269, 775, 1682, 1985, 1893, 2321,
-    2852, 2496, 2026, 1775, 276, -1515, -2276, -2667, -2848, -2269,
-    -1553, -1325, -864, -506, -443, -402, -695, -940, -699, -207,
-    578, 1557, 2091, 2535, 2988, 3196, 3260, 2612, 1030, -304,
-    -973, -1531, -1885, -2104, -1952, -1738, -1600, -1180, -958, -1471,
-    -2147, -1571, -238, 694, 1438, 2500, 3123, 2711, 1860, 1104,
-    620, -195, -1143, -1047, 203, 1193, 1058, 404, 150, 47,
-    -818, -1815, -1995, -1715, -2033, -1980, -585, 649, 760, 734,
-    1243, 1213, 964, 869, 357, 81, 193, 347, 753, 1052,
-    952, 819, 163, -598, -753, -1121, -1953, -2382, -2201, -1616,
-    -294, 730, 677, 675, 1295, 1250, 497, 406, 828, 1449,
-    1724, 1545, 1438, 1181, 539, -410, -1299, -1776, -1960, -2071,
-    -1835, -1279, -978, -1072, -948, -705, -579, -230, -69, 251,
-    1175, 2369, 3299, 3523, 3176, 2326, 1123, -243, -1162, -1210,
-    -882, -1162, -1540, -840, -439, -1432, -2160, -1885, -2125, -2612,
-    -2334, -1525, -149, 1208, 1647, 2007, 2687, 2632, 2357, 2165,
-    1643, 1090, 726, 804, 1138, 953, 322, -110, -800, -1668,
-    -2201, -2613, -2839, -2701, -2040, -878, 91, 436, 677, 898,
-    599, 41, -254, -336, -182, 225, 807, 1705, 2490, 2718,
-    2444, 1871, 1055, -132, -1185, -1782, -2048, -2419, -2513, -1479,
-    -538, -459, -51, 615, 745, 612, 486, 464, 290, -95,
-    -219, 4, 25, -373, -686, -740, -307, 395, 893, 1260,
-    1350, 1200, 1022, 673, -177, -1118, -1511, -1539, -1444, -996,
-    -261, 370, 737, 1007, 1421, 1440, 953, 464, 76, 10,
-    108, -136, -682, -1193, -1444, -1624, -1801, -1378, -307, 442,
-    763, 1419, 2232, 2369, 2050, 1647, 998, 488, -311, -992,
-    -480, -123, -741, -678, 474, 618, -352, -417, -10, -200,
-    -427, -519, -416, -313, -603, -683, -553, -630, -832, -765,
-    -200, 352, 745, 1447, 2073, 1544, 896, 1098, 715, -645,
-    -1504, -1274, -774, -609, -550, -303, 30, -361, -1286, -1163,
-    -384, -401, -968, -762, 94, 267, -156, -338, -386, -382,
-    -377, -307, 117, 691, 946, 966, 1349, 1768, 1422, 788,
-    494, -82, -981, -1480, -1521, -1711, -1795, -1096, -290, 176,
-    457, 757, 1061, 969, 775, 624, 71, -401, -640, -847,
-    -751, -969, -1168, -1050, -901, -701, -315, 510, 1316, 1938,
-    2095, 2072, 2089, 1293, 111, -570, -1119, -1300, -1054, -660,
-    -43, 78, -77, 231, 404, 84, -238, -544, -627, -325,
-    -489, -754, -286, -208, -449, -20, 479, 571, 994, 1608,
-    2010, 2481, 2412, 1696, 682, -374, -1065, -1630, -2389, -2598,
-    -2225, -2068, -1497, -454, 281, 693, 941, 1003, 861, 761,
-    1114, 1538, 1355, 964, 747, 541, 52, -587, -1193, -1439,
-    -1287, -1151, -623, 289, 715, 1008, 1430, 1249, 634, -127,
-    -839, -1285, -1438, -1305, -1078, -1103, -825, -170, 32, 55,
-    344, 629, 862, 1222, 1255, 1173, 1494, 1517, 858, 137,
-    -289, -490, -968, -1387, -1003, -359, -157, -65, 298, 442,
-    228, -67, -217, -465, -768, -775, -822, -836, -499, -187,
-    -266, -391, -354, -125, 47, 265, 658, 1006, 1500, 1881,
-    1773, 1121, 538, 42, -649, -1290, -1507, -963, -502, -487,
-    92, 808, 734, 389, 47, -532, -1156, -1367, -1060, -600,
-    -622, -844, -592, -417, -882, -822, -194, 104, 314, 635,
-    1297, 1987, 2315, 2304, 2205, 2041, 1364, 314, -189, -469,
-    -1048, -1375, -1530, -1412, -1308, -1578, -1757, -1689, -1561, -1614,
-    -1307, -143, 1118, 1995, 2692, 3119, 3132, 2349, 978, -305,
-    -1456, -2441, -2714, -2219, -1534, -908, -354, 217, 779, 1040,
-    701, 548, 819, 924, 1258, 2010, 2476, 2359, 1664, 734,
-    -207, -1400, -2364, -2754, -2621, -2007, -1160, -451, -12, 307,
-    396, 390, 799, 874, 673, 1213, 1769, 1140, 152, -158,
-    -859, -1849, -2292, -2328, -1794, -756, 254, 1067, 1681, 2024,
-    2031, 1628, 1270, 727, 40, 83, 359, 31, -131, -8,
-    -702, -1572, -2046, -2471, -2760, -2611, -2115, -1219, -78, 708,
-    1492, 2385, 3076, 3562, 3574, 3185, 2492, 1158, -449, -1972,
-    -3256, -4006, -4019, -3528, -2573, -1443, -546, 488, 1380, 1653,
-    1823, 2288, 2512, 2166, 1576, 1238, 887, 129, -550, -873,
-    -1351, -1983, -2205, -2012, -1435, -994, -656, 154, 858, 1248,
-    1775, 2392, 2545, 2375, 2148, 1743, 1191, 90, -1517, -2922,
-    -3890, -4562, -4782, -4182, -3084, -1632, 97, 1463, 2764, 3690,
-    3829, 3858, 3492, 2738, 2005, 1203, 432, -265, -739, -1183,
-    -1855, -2482, -2796, -2921, -2886, -2562, -2051, -1206, -41, 1029,
-    1848, 2374, 2930, 3518, 3162, 2229, 1478, 331, -1486, -3085,
-    -3980, -4476, -4572, -4279, -3109, -1323, 292, 1645, 2782, 3857,
-    4234, 3810, 3279, 2706, 1732, 712, 110, -476, -1160, -1652,
-    -2126, -2587, -2896, -3201, -3059, -2452, -1785, -953, 239, 1371,
-    2087, 2718, 3249, 3514, 3366, 2627, 1579, 413, -839, -2023,
-    -2912, -3322, -3383, -3246, -2742, -1602, -517, 341, 1721, 3186,
-    3932, 3883, 3592, 3173, 2070, 480, -680, -1172, -1657, -1966,
-    -1708, -1538, -1516, -1299, -1160, -1075, -843, -477, 49, 958,
-    1961, 2853, 3776, 4027, 3499, 2765, 1508, -423, -2321, -3895,
-    -5118, -5530, -4821, -3549, -1995, -170, 1510, 2649, 3353, 3801,
-    3654, 3193, 2867, 2439, 1837, 1516, 1224, 532, -275, -1227,
-    -2385, -3468, -4013, -3775, -3208, -2512, -1454, -129, 855, 1404,
-    2063, 2558, 2380, 2154, 1987, 1636, 1377, 759, -294, -1089,
-    -1775, -2728, -3335, -3317, -2876, -1764, 17, 1602, 2695, 3492,
-    3852, 3681, 3067, 2000, 644, -263, -733, -1262, -1613, -1679,
-    -1857, -2118, -2205, -2184, -2334, -2453, -1847, -934, 53, 1384,
-    2478, 3158, 3560, 3481, 2673, 1586, 415, -906, -2231, -3075,
-    -3176, -2853, -2497, -2336, -1761, -777, 64, 762, 1436, 2003,
-    2546, 3002, 2968, 2564, 2030, 1215, 253, -710, -1564, -2128,
-    -2769, -3394, -3550, -3282, -2561, -1802, -1140, -311, 494, 1324,
-    2245, 2793, 2880, 3003, 3052, 2418, 1400, 607, -389, -1676,
-    -2675, -3200, -3582, -3645, -3297, -2500, -1248, -32, 1197, 2304,
-    2792, 2673, 2588, 2468, 1975, 1308, 721, 517, 98, -700,
-    -1191, -1595, -1990, -1998, -1952, -1967, -1647, -1084, -558, 179,
-    1194, 1791, 2111, 2185, 1889, 1690, 1346, 550, -276, -816,
-    -1475, -2116, -2350, -2245, -1668, -862, -131, 943, 2145, 2765,
-    2767, 2483, 2018, 1395, 816, 244, -228, -488, -464, -576,
-    -1335, -2076, -2574, -2902, -2955, -2563, -1649, -560, 595, 1590,
-    2414, 2909, 2872, 2603, 2227, 1800, 1558, 1377, 901, 308,
-    -164, -949, -2002, -2785, -3463, -3680, -3118, -2168, -629, 1041,
-    2249, 3131, 3475, 2905, 2057, 1404, 523, -209, -541, -575,
-    -484, -530, -667, -1056, -1563, -2023, -2357, -2309, -1925, -1246,
-    -527, 376, 1555, 2358, 2567, 2572, 2532, 2130, 1415, 655,
-    -19, -330, -721, -1300, -1492, -1603, -1670, -1500, -1088, -225,
-    751, 1347, 1641, 1718, 1670, 1461, 1018, 341, -417, -921,
-    -1065, -1062, -1012, -852, -834, -906, -929, -901, -723, -545,
-    -230, 256, 745, 1420, 2007, 2241, 2201, 1993, 1412, 740,
-    -107, -1084, -1619, -2286, -2821, -2646, -2230, -1705, -1005, -143,
-    935, 1798, 2245, 2385, 2108, 1676, 1490, 1363, 946, 430,
-    83, -402, -1090, -1793, -2431, -3024, -3207, -2866, -2226, -1186,
-    -123, 792, 1694, 2378, 2687, 2723, 2522, 2125, 1519, 909,
-    453, -107, -557, -838, -1472, -2137, -2558, -2822, -2776, -2342,
-    -1489, -376, 526, 1121, 1640, 1950, 1931, 1721, 1679, 1568,
-    1105, 517, -35, -779, -1419, -1759, -2077, -2103, -1870, -1332,
-    -515, 80, 577, 1149, 1473, 1498, 1424, 1193, 919, 450,
-    22, 43, -123, -371, -470, -748, -1200, -1290, -1174, -1111,
-    -891, -371, 441, 995, 1298, 1542, 1506, 1208, 815, 303,
-    -77, -298, -655, -969, -1127, -1117, -957, -936, -1031, -1022,
-    -683, -201, 439, 1193, 1949, 2616, 2938, 3061, 2796, 1997,
-    766, -494, -1393, -1997, -2343, -2416, -2338, -2134, -1672, -1010,
-    -597, -392, -115, 142, 319, 587, 1003, 1416, 1790, 2111,
-    2268, 2019, 1334, 330, -834, -1774, -2420, -2953, -2906, -2278,
-    -1485, -523, 445, 1089, 1457, 1558, 1558, 1661, 1703, 1612,
-    1361, 856, 426, 237, -169, -561, -1045, -1723, -2140, -2198,
-    -1840, -1380, -971, -344, 399, 943, 1162, 1284, 1277, 1187,
-    1100, 989, 848, 413, -128, -482, -709, -813, -926, -953,
-    -607, -329, -201, 54, 359, 509, 640, 853, 1104, 1338,
-    1293, 846, 115, -457, -805, -1157, -1297, -1267, -1235, -906,
-    -239, 353, 640, 753, 870, 985, 837, 631, 506, 329,
-    120, -22, -259, -616, -1020, -1428, -1574, -1511, -1179, -698,
-    -132, 355, 737, 1036, 1083, 1177, 1280, 1451, 1656, 1625,
-    1402, 823, -18, -991, -1749, -2235, -2479, -2341, -1858, -1196,
-    -488, 298, 824, 1076, 1083, 874, 670, 680, 803, 983,
-    1107, 1111, 1090, 699, -23, -830, -1701, -2409, -2616, -2137,
-    -1315, -431, 324, 948, 1434, 1438, 1125, 602, 357, 406,
-    518, 902, 1270, 1264, 1027, 582, -271, -1095, -1695, -2107,
-    -2001, -1664, -1362, -535, 436, 1011, 1262, 1138, 894, 652,
-    383, 161, 147, 294, 267, 159, -24, -502, -1041, -1286,
-    -1244, -824, -99, 463, 781, 990, 966, 716, 305, -77,
-    -85, 0, -57, -48, -7, -196, -521, -905, -1332, -1483,
-    -1458, -1233, -500, 305, 980, 1610, 1983, 2004, 1797, 1251,
-    684, 481, 199, -138, -442, -789, -1084, -1454, -1968, -2312,
-    -2300, -1811, -1049, -83, 1131, 2141, 2518, 2441, 2241, 1684,
-    947, 441, 300, 419, 405, 223, 180, -186, -1021, -1863,
-    -2417, -2629, -2589, -2193, -1261, 40, 1108, 1677, 2073, 2394,
-    2120, 1449, 966, 553, 259, 423, 390, 168, 113, -384,
-    -1150, -1828, -2497, -2752, -2365, -1684, -419, 923, 1674, 2092,
-    2203, 1824, 989, 131, -763, -1267, -1121, -840, -491, 17,
-    284, 37, -435, -931, -1307, -1450, -1350, -944, -22, 1030,
-    1824, 2253, 2200, 1798, 925, -256, -1057, -1433, -1570, -1307,
-    -703, -137, 214, 418, 313, 88, -320, -631, -352, 248,
-    777, 1214, 1769, 2054, 1763, 1027, -126, -1325, -2124, -2683,
-    -2536, -1811, -1157, -222, 702, 936, 840, 782, 461, 65,
-    -101, 2, 393, 882, 1235, 1493, 1588, 1257, 625, 140,
-    -383, -1147, -1449, -1347, -1116, -658, -243, 124, 416, 277,
-    15, 81, 142, 204, 607, 1007, 1103, 1111, 830, 169,
-    -500, -1042, -1411, -1580, -1560, -1312, -856, -406, -190, -33,
-    244, 395, 457, 505, 358, 205, 282, 361, 390, 507,
-    653, 867, 812, 339, -135, -579, -1012, -1196, -1074, -817,
-    -563, -220, 162, 348, 340, 179, 127, 289, 295, 223,
-    452, 761, 791, 691, 500, 84, -449, -803, -959, -1106,
-    -1124, -864, -455, -84, 141, 307, 360, 162, 25, -75,
-    -117, 158, 521, 919, 1447, 1741, 1507, 894, 170, -683,
-    -1597, -2041, -1947, -1554, -899, -105, 438, 634, 662, 300,
-    -254, -473, -497, -481, -196, 421, 891, 948, 914, 685,
-    40, -871, -1495, -1683, -1830, -1725, -1024, -78, 588, 1048,
-    1321, 1100, 611, 59, -586, -762, -613, -512, -27, 745,
-    1114, 1018, 902, 559, -204, -888, -1163, -1114, -859, -570,
-    -25, 640, 922, 973, 962, 682, 288, 133, 100, 149,
-    319, 415, 386, 273, -134, -721, -1167, -1396, -1657, -1672,
-    -1174, -521, 225, 763, 1169, 1581, 1686, 1603, 1462, 1250,
-    1245, 1169, 970, 898, 694, 381, -91, -766, -1424, -1951,
-    -2483, -2605, -2102, -1486, -799, 163, 972, 1402, 1603, 1589,
-    1387, 1138, 952, 672, 616, 614, 364, 49, -286, -722,
-    -1235, -1703, -1896, -1655, -1283, -804, 65, 1014, 1363, 1520,
-    1594, 1327, 1028, 770, 585, 752, 1001, 931, 901, 746,
-    115, -797, -1485, -1931, -2302, -2292, -1649, -537, 543, 1391,
-    2114, 2166, 1524, 966, 343, -236, -387, -223, -18, 343,
-    616, 553, 259, -390, -1127, -1863, -2354, -2244, -1613, -689,
-    378, 1443, 2292, 2671, 2718, 2460, 1862, 1259, 665, 297,
-    438, 510, 178, 45, -134, -746, -1371, -1889, -2336, -2465,
-    -2214, -1738, -1007, -130, 572, 1062, 1357, 1322, 1096, 822,
-    541, 244, 54, 48, 108, -81, -555, -855, -1266, -2003,
-    -2474, -2584, -2568, -2125, -1221, -350, 384, 1115, 1746, 2044,
-    2027, 1941, 1630, 1219, 1001, 653, 105, -147, -261, -603,
-    -883, -1102, -1438, -1725, -1723, -1613, -1456, -1048, -378, 250,
-    712, 1294, 1788, 1791, 1635, 1594, 1399, 1064, 816, 576,
-    102, -236, -487, -1024, -1588, -1774, -1836, -1971, -1567, -942,
-    -461, 46, 389, 737, 1097, 1196, 1306, 1442, 1590, 1668,
-    1479, 1115, 773, 396, -230, -693, -967, -1200, -1362, -1277,
-    -1127, -1133, -1037, -798, -417, -165, -147, -10, 344, 527,
-    575, 708, 848, 752, 368, 41, -89, -386, -679, -704,
-    -854, -1003, -1088, -1054, -891, -718, -388, -37, 184, 361,
-    513, 756, 1089, 1251, 1116, 907, 731, 465, 234, -107,
-    -410, -551, -699, -839, -939, -1075, -1213, -1181, -1102, -759,
-    -250, 238, 831, 1351, 1555, 1529, 1564, 1399, 902, 311,
-    -170, -479, -707, -803, -929, -1171, -1367, -1506, -1533, -1472,
-    -1298, -787, 78, 942, 1722, 2288, 2392, 2239, 1895, 1290,
-    511, 93, 24, 45, 333, 537, 566, 494, 20, -790,
-    -1562, -2124, -2363, -2157, -1589, -779, 185, 1042, 1753, 2105,
-    1791, 1213, 787, 545, 220, -122, -152, -60, 46, 77,
-    -187, -479, -591, -809, -1300, -1626, -1568, -1184, -515, 176,
-    740, 1242, 1713, 1816, 1649, 1301, 906, 782, 676, 603,
-    366, -54, -246, -410, -722, -1092, -1352, -1453, -1447, -1235,
-    -851, -500, -263, 265, 730, 565, 403, 348, 218, 165,
-    81, 29, 20, -80, -105, -23, -136, -374, -496, -544,
-    -585, -692, -725, -702, -511, -180, -125, 101, 572, 857,
-    996, 1008, 1037, 1214, 1127, 776, 551, 299, 51, 25,
-    -93, -330, -425, -534, -706, -951, -1156, -1168, -1010, -715,
-    -353, 58, 569, 943, 1214, 1283, 1003, 829, 560, 107,
-    -145, -276, -529, -442, -172, -264, -294, -344, -672, -805,
-    -721, -772, -630, -305, 159, 801, 1315, 1610, 1781, 1690,
-    1350, 1009, 539, -113, -590, -687, -786, -801, -574, -449,
-    -504, -511, -463, -463, -554, -496, -245, 45, 369, 680,
-    1025, 1068, 887, 533, 142, -47, -162, -191, -147, -5,
-    52, -122, -375, -619, -944, -1117, -996, -749, -439, 56,
-    719, 1173, 1299, 1473, 1339, 644, 89, -83, -110, -120,
-    73, 380, 454, 253, -12, -391, -884, -1247, -1407, -1404,
-    -1298, -945, -383, 35, 345, 700, 797, 707, 580, 418,
-    272, 182, 299, 571, 775, 708, 419, 113, -206, -713,
-    -1227, -1404, -1277, -1010, -577, -54, 527, 904, 1021, 1151,
-    1081, 785, 533, 378, 275, 418, 633, 714, 644, 280,
-    -138, -588, -1179, -1607, -1843, -1931, -1783, -1339, -572, 165,
-    767, 1298, 1478, 1321, 1075, 750, 309, -2, -107, -165,
-    -146, -124, -255, -454, -628, -910, -1221, -1322, -1172, -830,
-    -316, 387, 1222, 1946, 2335, 2481, 2364, 1804, 927, 201,
-    -534, -1230, -1462, -1423, -1208, -963, -772, -623, -613, -794,
-    -953, -982, -819, -454, 167, 848, 1396, 1883, 2015, 1864,
-    1495, 676, -343, -949, -1369, -1720, -1702, -1348, -926, -560,
-    -172, 3, -6, -97, -150, -132, 42, 389, 896, 1306,
-    1470, 1529, 1387, 846, 51, -484, -909, -1225, -1222, -898,
-    -556, -294, -78, 63, -33, -320, -545, -746, -697, -576,
-    -383, -27, 310, 565, 744, 741, 558, 222, -42, -33,
-    -111, -104, 197, 426, 448, 525, 362, -42, -421, -771,
-    -822, -651, -396, -16, 468, 739, 740, 834, 904, 707,
-    590, 608, 554, 621, 841, 917, 719, 379, -123, -618,
-    -1163, -1795, -2025, -1969, -1754, -1381, -1086, -821, -448, -99,
-    243, 578, 845, 1287, 1652, 1731, 1767, 1719, 1384, 890,
-    347, -263, -943, -1406, -1588, -1600, -1414, -1320, -1061, -576,
-    -264, -86, 239, 665, 1023, 1461, 1895, 2154, 2184, 1968,
-    1579, 1037, 219, -480, -969, -1450, -1755, -1829, -1832, -1796,
-    -1577, -1337, -1104, -866, -526, -79, 446, 951, 1378, 1746,
-    1887, 1789, 1530, 1081, 541, 86, -305, -589, -812, -830,
-    -662, -539, -508, -524, -548, -533, -562, -510, -81, 448,
-    921, 1396, 1739, 1754, 1464, 1048, 574, 51, -394, -589,
-    -574, -506, -432, -348, -386, -535, -800, -1150, -1404, -1424,
-    -1134, -737, -304, 159, 580, 887, 991, 877, 794, 713,
-    531, 501, 532, 451, 340, 155, -46, -281, -756, -1183,
-    -1364, -1312, -993, -422, 167, 702, 1192, 1461, 1373, 1165,
-    890, 551, 322, 199, 110, 46, 101, 41, -228, -592,
-    -911, -1409, -1867, -1957, -1762, -1410, -904, -164, 541, 1070,
-    1317, 1308, 1170, 869, 460, 286, 161, 70, 97, -55,
-    -165, -164, -284, -616, -774, -777, -837, -782, -474, 2,
-    404, 626, 737, 814, 659, 352, 125, 5, -71, 32,
-    142, -1, -180, -209, -396, -742, -898, -989, -910, -652,
-    -431, -108, 168, 308, 425, 355, 201, 46, -47, 33,
-    250, 293, 230, 212, 82, -97, -234, -413, -458, -403,
-    -325, -87, 144, 422, 611, 644, 675, 713, 715, 785,
-    779, 766, 786, 634, 288, -13, -378, -943, -1336, -1398,
-    -1216, -978, -511, 10, 229, 262, 395, 354, 248, 70,
-    -76, 169, 475, 681, 859, 946, 637, 174, -246, -605,
-    -933, -1135, -1079, -725, -268, 107, 502, 648, 551, 392,
-    374, 207, -2, 85, 307, 491, 629, 641, 428, 202,
-    -159, -501, -821, -1082, -1075, -901, -636, -206, 49, 0,
-    -94, -159, -307, -608, -628, -322, 28, 373, 775, 1057,
-    951, 590, 166, -298, -662, -953, -983, -712, -297, 148,
-    402, 498, 593, 500, 233, 74, 117, 260, 407, 764,
-    1065, 1095, 1022, 852, 366, -298, -881, -1314, -1568, -1509,
-    -1295, -986, -512, -125, 105, 208, 258, 304, 342, 369,
-    543, 768, 889, 910, 923, 596, -27, -569, -1008, -1321,
-    -1499, -1345, -921, -442, -34, 425, 714, 717, 583, 474,
-    459, 490, 620, 757, 876, 808, 657, 338, -136, -661,
-    -1064, -1276, -1332, -1163, -822, -334, 62, 376, 505, 447,
-    324, 230, 79, -45, -40, 66, 277, 419, 358, 86,
-    -220, -527, -817, -924, -798, -526, -154, 334, 745, 980,
-    1147, 1038, 678, 355, 115, -46, -3, 99, 234, 357,
-    368, 252, -2, -351, -616, -657, -595, -374, -169, -11,
-    245, 480, 474, 204, -164, -428, -587, -667, -583, -311,
-    8, 248, 438, 407, 209, -76, -363, -474, -455, -332,
-    -103, 160, 451, 570, 445, 278, 89, -104, -265, -274,
-    -144, 187, 574, 793, 788, 669, 526, 250, -188, -571,
-    -687, -753, -709, -657, -596, -551, -493, -401, -337, -310,
-    -319, -130, 99, 287, 459, 560, 647, 861, 908, 718,
-    343, -17, -201, -465, -760, -964, -921, -726, -619, -462,
-    -128, 192, 355, 546, 770, 944, 1091, 1140, 1145, 1078,
-    918, 618, 293, -43, -469, -813, -978, -1065, -1096, -1082,
-    -932, -650, -393, -152, 86, 333, 396, 431, 468, 348,
-    286, 336, 315, 205, 57, -163, -272, -403, -644, -903,
-    -974, -853, -709, -431, -8, 438, 775, 1053, 1185, 1151,
-    925, 612, 286, 8, -279, -394, -404, -418, -290, -235,
-    -154, -98, -242, -382, -316, -197, -64, 92, 303, 455,
-    612, 600, 435, 223, -35, -371, -660, -759, -866, -823,
-    -636, -329, -48, 189, 298, 414, 622, 656, 548, 573,
-    698, 647, 502, 375, 229, 27, -181, -354, -418, -466,
-    -390, -249, -167, 121, 340, 354, 387, 396, 236, 81,
-    161, 235, 282, 371, 303, 136, 33, -245, -685, -938,
-    -960, -953, -829, -425, 51, 328, 501, 595, 480, 301,
-    108, -59, -199, -260, -157, -107, 14, 142, 47, -107,
-    -190, -245, -334, -316, -246, 13, 304, 494, 600, 673,
-    629, 359, 67, -149, -329, -429, -391, -283, -116, -112,
-    -203, -275, -360, -513, -606, -537, -327, -150, 127, 502,
-    760, 928, 928, 759, 567, 339, 35, -181, -185, -87,
-    -103, -84, -158, -241, -341, -416, -368, -258, -54, 55,
-    151, 238, 228, 195, 127, 127, 189, 179, 225, 355,
-    419, 285, 97, -64, -275, -475, -570, -487, -312, -129,
-    97, 301, 359, 247, 47, -112, -212, -305, -305, -164,
-    46, 191, 297, 363, 285, 116, -55, -209, -280, -237,
-    -158, 0, 265, 413, 365, 323, 121, -102, -223, -381,
-    -441, -373, -271, -121, -11, 3, -76, -59, -65, -235,
-    -322, -308, -292, -367, -327, -245, -236, -345, -337, -204,
-    -124, -14, 117, 255, 467, 630, 656, 622, 520, 322,
-    80, -7, -107, -210, -130, -26, 58, 272, 261, 39,
-    -121, -320, -454, -424, -374, -233, 2, 223, 362, 372,
-    206, -87, -260, -396, -539, -543, -409, -291, -126, 111,
-    300, 372, 371, 214, 50, 43, 69, 104, 135, 222,
-    303, 248, 66, -44, -197, -373, -406, -357, -151, 75,
-    172, 265, 357, 284, 112, 3, -62, -48, 89, 297,
-    375, 345, 334, 210, -52, -349, -615, -845, -931, -806,
-    -551, -260, -92, -5, 135, 227, 240, 180, 93, 78,
-    220, 369, 377, 338, 344, 207, -34, -232, -362, -422,
-    -428, -328, -147, 94, 211, 233, 229, 181, 58, 31,
-    112, 134, 163, 249, 293, 272, 157, 10, -180, -478,
-    -640, -706, -635, -477, -323, -134, 14, 128, 198, 89,
-    -51, -53, -84, -69, 43, 253, 478, 512, 480, 473,
-    351, 68, -162, -264, -223, -103, 46, 198, 243, 206,
-    49, -107, -212, -324, -333, -169, 58, 326, 576, 673,
-    664, 530, 431, 326, 142, 35, 121, 328, 402, 456,
-    431, 173, -286, -743, -1127, -1437, -1501, -1285, -949, -519,
-    -41, 301, 526, 626, 621, 514, 446, 433, 484, 578,
-    702, 780, 769, 611, 275, -156, -614, -981, -1168, -1184,
-    -1113, -779, -320, 77, 311, 390, 362, 367, 319, 248,
-    262, 322, 396, 506, 576, 484, 308, 47, -198, -466,
-    -631, -570, -360, -267, -162, 1, 103, 43, -106, -160,
-    -172, -130, -78, 112, 345, 455, 560, 569, 412, 276,
-    145, 19, 10, 81, 171, 254, 257, 223, 96, -14,
-    -164, -314, -350, -306, -250, -177, -64, -40, -71, -143,
-    -222, -313, -291, -218, -36, 261, 551, 706, 712, 617,
-    401, 164, -117, -412, -537, -446, -341, -251, -126, -56,
-    -53, -23, -62, -162, -175, -50, 65, 178, 381, 519,
-    529, 521, 425, 175, -92, -317, -421, -375, -259, -119,
-    -32, 19, 101, 84, -64, -208, -336, -338, -245, -164,
-    37, 198, 301, 353, 306, 124, -83, -316, -444, -408,
-    -289, -109, 104, 345, 487, 556, 487, 353, 162, 0,
-    -158, -298, -395, -398, -305, -276, -318, -226, -131, -173,
-    -102, 3, 113, 147, 160, 275, 275, 246, 251, 142,
-    93, 83, 28, -27, -53, -111, -257, -422, -472, -459,
-    -427, -389, -282, -62, 155, 314, 380, 335, 222, 131,
-    62, 65, 15, -14, -3, 13, -9, -107, -287, -458,
-    -535, -603, -584, -432, -237, -31, 190, 257, 257, 216,
-    114, -93, -245, -336, -398, -364, -242, -85, 33, 89,
-    -28, -89, -155, -291, -447, -497, -355, -172, 18, 216,
-    376, 493, 503, 374, 192, -72, -232, -289, -294, -210,
-    -18, 208, 289, 292, 276, 187, -4, -182, -296, -366,
-    -283, -99, 20, 143, 242, 206, 52, -106, -188, -263,
-    -361, -277, -133, -42, 101, 273, 373, 348, 272, 227,
-    160, 38, -72, -80, -28, -68, -45, -17, 5, 52,
-    86, 34, -17, 14, 78, 102, 182, 301, 444, 563,
-    586, 616, 473, 324, 212, 34, -190, -290, -351, -321,
-    -270, -195, -33, 26, 47, 2, -67, -97, -115, -168,
-    -107, -26, 18, 12, 30, 119, 122, 29, -59, 7,
-    88, 32, 40, 160, 193, 146, 192, 266, 313, 324,
-    319, 281, 173, 80, -38, -188, -312, -301, -300, -301,
-    -233, -171, -60, 12, 43, 114, 159, 232, 255, 211,
-    188, 156, 119, 73, 4, -54, -92, -218, -332, -328,
-    -299, -290, -160, 46, 212, 334, 390, 370, 303, 199,
-    39, -48, -36, 23, 137, 180, 223, 221, 57, -128,
-    -319, -449, -524, -510, -301, -60, 197, 404, 474, 443,
-    369, 272, 111, 3, 21, 60, 71, 169, 234, 115,
-    -93, -253, -421, -591, -647, -547, -440, -274, 14, 257,
-    463, 544, 527, 489, 362, 231, 275, 323, 375, 475,
-    527, 513, 377, 245, 137, -37, -243, -341, -348, -312,
-    -230, -202, -282, -379, -375, -244, -164, -191, -147, -29,
-    110, 242, 383, 415, 316, 206, 43, -67, -108, -136,
-    -160, -89, 33, 8, -60, -90, -154, -273, -416, -479,
-    -422, -259, -93, 33, 179, 314, 341, 215, 173, 253,
-    281, 252, 271, 381, 443, 446, 429, 318, 87, -159,
-    -320, -383, -319, -138, 80, 239, 324, 349, 219, -29,
-    -247, -400, -495, -477, -325, -90, 138, 314, 389, 304,
-    176, 39, -132, -325, -388, -199, 54, 202, 319, 414,
-    383, 258, 49, -226, -429, -528, -597, -529, -314, -70,
-    103, 166, 167, 117, -13, -118, -141, -168, -107, 59,
-    191, 244, 200, 79, -84, -267, -408, -475, -489, -436,
-    -361, -256, -106, 10, 27, -36, -96, -147, -168, -129,
-    -42, 31, 167, 261, 283, 237, 102, -64, -256, -320,
-    -301, -221, -99, 19, 145, 253, 278, 209, 108, 18,
-    -53, -109, -131, -109, -76, -70, -23, 0, 3, 0,
-    -25, -29, -11, 56, 45, 25, 43, 29, 31, 7,
-    -23, 1, 35, 38, 75, 116, 115, 91, 41, -31,
-    -72, -102, -93, -9, 75, 107, 153, 212, 172, 124,
-    58, -60, -145, -203, -223, -203, -171, -136, -65, 56,
-    76, 40, 46, 51, 39, -2, -25, -21, -1, 24,
-    16, 31, 84, 93, 70, 38, 16, -19, -49, -90,
-    -117, -81, -28, -14, -31, -19, -12, -22, -61, -91,
-    -96, -92, -42, -2, 27, 62, 69, 93, 99, 85,
-    40, -7, 3, 6, 0, -10, -6, 15, 29, 22,
-    -23, -62, -82, -109, -126, -127, -120, -98, -46, -1,
-    49, 90, 109, 125, 133, 153, 146, 125, 97, 79,
-    76, 54, 24, -11, -29, -23, -23, -31, -35, -14,
-    12, 24, 35, 40, 38, 38, 33, 28, 35, 33,
-    27, 43, 62, 69, 58, 32, 9, -5, -23, -38,
-    -45, -30, 10, 23, 15, 6, -8, 2, 5, -11,
-    -10, -16, -30, -28, -12, -3, -1, -1, 5, 5,
-    7, 2, -4, -3, -6, -18, -29, -26, -25, -19,
-    -13, -10, 0, 6, -7, -35, -40, -47, -48, -35,
-    -24, -28, -33, -27, -18, -8, -15, -18, -19, -25,
-    -20, -10, -3, -2, 8, 11, 1, 10, 5, -18,
-    -43, -42, -23, -4, 0, 2, 14, -1, -13, -21,
-    -30, -34, -30, -25, -11, -10, -21, -29, -33, -23,
-    -28, -32, -17, -4, -8, -8, -3, -15, -15, -8,
-    -6, -1, 0, 1, -7, -23, -38, -39, -32, -25,
-    -21, -20, -16, -22, -25, -30, -35, -40, -49, -34,
-    -19, -19, -24, -30, -23, -23, -32, -26, -12, -16,
-    -6, 1, -1, 3, 0, 2, 0, 0, -4, 2,
-    2, -1, 4, 0, 0, 1, 6, 18, 24, 10,
-    -2, -7, -8, -3, 5, 19, 12, 13, 20, 16,
-    1, -3, -5, -11, -4, 4, 6, -2, 6, 1,
-    -9, -12, -19, -21, -7, 2, -8, 0, 13, 15,
-    20, 10, -1, -11, -7, 1, 0, 9, 3, -2,
-    -4, -5, 0, -4, -17, -7, -7, -15, -13, -15,
-    -10, -11, -8, -4, 1, 0, 1, 6, 1, 0,
-    2, 2, 8, 10, 12, 14, 9, 15, 18, 13,
-    11, 7, 11, 17, 14, 24, 17, 7, 17, 21,
-    22, 25, 28, 28, 27, 31, 35, 32, 30, 31,
-    32, 37, 36, 33, 37, 31, 33, 34, 29, 28,
-    31, 32, 33, 27, 28, 35, 31, 31, 48, 53,
-    48, 61, 55, 54, 45, 34, 32, 25, 28, 38,
-    54, 59, 56, 42, 31, 26, 24, 16, 14, 19,
-    32, 35, 44, 48, 41, 40, 32, 28, 23, 24,
-    20, 30, 37, 39, 37, 37, 34, 22, 17, 13,
-    11, 8, 18, 18, 16, 20, 16, 16, 14, 14,
-    4, 3, 4, 5, 9, 15, 22, 24, 26, 18,
-    17, 10, 8, 12, 6, 9, 19, 18, 13, 20,
-    24, 21, 16, 9, 8, 12, 14, 13, 15, 15,
-    14, 17, 16, 13, 8, 8, 15, 17, 22, 20,
-    18, 17, 11, 15, 19, 20, 19, 22, 23, 17,
-    14, 11, 9, 12, 14, 21, 25, 21, 13, 8,
-    6, 6, 8, 9, 14, 21, 24, 19, 17, 11,
-    4, 6, 9, 13, 11, 12, 16, 13, 13, 10,
-    9, 6, 0, -1, -1, -1, 2, 2, -1, 2,
-    6, 6, 0, -5, -8, -10, -8, 1, -1, -1,
-    -2, -4, -3, -1, -1, -8, -7, -6, -9, -8,
-    -7, -8, -2, -2, 0, 2, 1, -1, -2, -1,
-    1, 0, 0, 2, 1, 2, -1, 4, 8, 8,
-    4, 1, -3, -4, -3, 0, 7, 10, 11, 4,
-    0, -1, 0, 2, 0, 1, 1, 2, 2, 5,
-    5, 7, 3, 0, 3, 5, 1, -4, 0, 0,
-    3, 1, 3, 5, 4, 4, -2, -5, -5, -4,
-    -2, 0, 1, 4, 6, 4, 0, -6, -5, -6,
-    -9, -5, -2, -1, -3, -2, 2, 0, -3, -6,
-    -9, -10, -7, -8, -7, -7, -3, -5, -5, -3,
-    -6, -5, -10, -6, -3, -2, -5, -4, -5, -5,
-    -5, -11, -6, -7, -8, -10, -6, -8, -7, -5,
-    -7, -7, -5, -6, -5, -5, -10, -5, -9, -9,
-    -7, -2, -3, -8, -10, -16, -13, -15, -15, -13,
-    -11, -11, -10, -9, -7, -10, -15, -14, -15, -19,
-    -14, -13, -13, -11, -11, -10, -14, -14, -13, -17,
-    -18, -19, -20, -18, -13, -12, -14, -12, -14, -15,
-    -19, -19, -20, -20, -21, -17, -17, -13, -14, -16,
-    -15, -17, -20, -21, -19, -23, -21, -19, -14, -17,
-    -15, -14, -14, -17, -19, -22, -21, -21, -21, -20,
-    -22, -19, -19, -16, -18, -18, -21, -23, -22, -24,
-    -24, -23, -21, -19, -21, -22, -22, -25, -26, -25,
-    -26, -27, -25, -24, -22, -22, -24, -25, -26, -29,
-    -27, -27, -26, -25, -24, -25, -27, -27, -30, -27,
-    -29, -31, -29, -28, -27, -26, -26, -25, -22, -25,
-    -25, -24, -29, -31, -31, -33, -31, -31, -31, -26,
-    -29, -30, -31, -30, -34, -36, -34, -36, -32, -32,
-    -29, -27, -28, -29, -30, -33, -36, -38, -37, -33,
-    -32, -33, -30, -27, -29, -33, -32, -34, -37, -36,
-    -35, -37, -37, -34, -35, -33, -34, -34, -35, -36,
-    -34, -37, -38, -36, -38, -38, -37, -38, -35, -40,
-    -40, -40, -41, -39, -41, -40, -36, -36, -36, -36,
-    -35, -38, -40, -42, -41, -40, -43, -41, -42, -44,
-    -42, -42, -42, -42, -47, -42, -44, -45, -42, -44,
-    -42, -42, -42, -45, -43, -46, -44, -45, -46, -45,
-    -45, -47, -48, -45, -44, -44, -47, -44, -47, -45,
-    -46, -45, -43, -46, -46, -43, -42, -45, -45, -47,
-    -44, -48, -46, -44, -43, -45, -45, -45, -46, -49,
-    -48, -47, -47, -49, -48, -44, -47, -45, -49, -50,
-    -48, -50, -51, -52, -51, -50, -50, -48, -46, -48,
-    -51, -50, -50, -51, -50, -50, -50, -48, -48, -49,
-    -50, -51, -50, -53, -54, -51, -51, -52, -54, -52,
-    -55, -54, -51, -54, -54, -57, -56, -55, -53, -56,
-    -54, -50, -54, -55, -51, -53, -53, -53, -55, -53,
-    -55, -54, -54, -54, -53, -56, -53, -51, -57, -55,
-    -57, -57, -55, -55, -57, -57, -56, -59, -57, -58,
-    -57, -57, -56, -55, -54, -57, -57, -57, -57, -56,
-    -57, -57, -56, -57, -59, -57, -58, -57, -54, -54,
-    -57, -57, -57, -57, -58, -60, -61, -60, -59, -60,
-    -59, -60, -58, -56, -57, -57, -56, -57, -59, -59,
-    -61, -56, -57, -59, -60, -58, -56, -59, -58, -59,
-    -57, -57, -55, -55, -53, -53, -53, -52, -52, -52,
-    -53, -56, -56, -54, -54, -53, -55, -55, -55, -55,
-    -55, -53, -55, -51, -50, -51, -49, -48, -46, -48,
-    -47, -53, -50, -50, -53, -51, -53, -51, -50, -50,
-    -49, -50, -52, -52, -55, -52, -49, -53, -51, -52,
-    -52, -53, -55, -56, -56, -56, -56, -51, -53, -55,
-    -49, -50, -52, -55, -55, -53, -55, -54, -51, -51,
-    -55, -53, -50, -50, -51, -52, -53, -51, -52, -52,
-    -53, -54, -53, -51, -49, -50, -49, -51, -52, -51,
-    -52, -53, -52, -54, -50, -52, -53, -51, -51, -49,
-    -51, -49, -53, -52, -52, -54, -54, -50, -52, -54,
-    -51, -52, -52, -51, -50, -52, -48, -52, -52, -50,
-    -51, -51, -47, -47, -49, -49, -51, -49, -50, -51,
-    -47, -48, -47, -45, -47, -47, -48, -47, -46, -47,
-    -48, -48, -48, -50, -47, -47, -46, -46, -49, -48,
-    -49, -51, -51, -50, -50, -51, -52, -55, -56, -54,
-    -54, -54, -56, -56, -52, -53, -52, -52, -51, -51,
-    -53, -53, -52, -54, -55, -55, -55, -54, -54, -52,
-    -56, -56, -58, -58, -59, -60, -57, -56, -57, -56,
-    -57, -58, -59, -59, -59, -60, -61, -57, -55, -55,
-    -54, -55, -56, -54, -55, -57, -57, -59, -54, -57,
-    -57, -53, -56, -58, -58, -56, -57, -58, -57, -56,
-    -55, -57, -57, -57, -56, -55, -58, -59, -57, -57,
-    -57, -54, -53, -52, -50, -51, -53, -51, -51, -52,
-    -52, -53, -51, -53, -53, -52, -53, -53, -53, -53,
-    -54, -51, -50, -52, -50, -49, -50, -51, -49, -49,
-    -49, -48, -48, -49, -50, -50, -49, -46, -46, -46,
-    -47, -47, -47, -47, -50, -51, -49, -51, -51, -51,
-    -50, -48, -50, -49, -48, -45, -44, -45, -48, -50,
-    -48, -50, -49, -49, -52, -50, -51, -49, -49, -48,
-    -50, -49, -49, -50, -44, -47, -46, -47, -48, -49,
-    -50, -52, -53, -52, -53, -49, -49, -47, -47, -47,
-    -44, -48, -49, -52, -48, -50, -49, -48, -47, -45,
-    -49, -48, -48, -48, -48, -50, -49, -47, -48, -47,
-    -47, -49, -47, -50, -50, -48, -52, -52, -48, -46,
-    -46, -45, -47, -47, -44, -48, -47, -47, -50, -46,
-    -45, -47, -47, -46, -48, -48, -45, -48, -47, -48,
-    -49, -45, -46, -46, -47, -48, -49, -50, -50, -50,
-    -50, -51, -53, -51, -50, -49, -47, -51, -50, -49,
-    -51, -51, -52, -50, -51, -53, -52, -48, -47, -48,
-    -47, -46, -44, -46, -47, -48, -46, -44, -47, -45,
-    -48, -49, -44, -46, -48, -48, -46, -48, -49, -48,
-    -50, -48, -49, -50, -48, -49, -47, -49, -52, -50,
-    -49, -51, -48, -46, -51, -50, -49, -48, -50, -51,
-    -51, -50, -51, -52, -50, -51, -48, -48, -50, -47,
-    -45, -47, -50, -47, -49, -50, -49, -47, -47, -45,
-    -46, -49, -48, -50, -47, -49, -47, -47, -47, -48,
-    -51, -49, -53, -52, -49, -51, -50, -49, -50, -49,
-    -48, -50, -51, -52, -51, -51, -52, -50, -48, -49,
-    -50, -49, -49, -50, -48, -49, -51, -48, -49, -50,
-    -50, -50, -48, -51, -50, -49, -48, -50, -50, -49,
-    -50, -48, -50, -50, -48, -49, -52, -49, -50, -49,
-    -49, -49, -50, -52, -51, -51, -46, -50, -49, -46,
-    -45, -45, -46, -45, -48, -48, -46, -47, -44, -44,
-    -47, -48, -48, -47, -49, -49, -49, -50, -51, -48,
-    -49, -49, -48, -50, -50, -49, -50, -50, -49, -48,
-    -50, -49, -47, -48, -47, -51, -49, -46, -48, -49,
-    -47, -45, -47, -46, -47, -48, -47, -48, -47, -46,
-    -45, -46, -48, -45, -44, -45, -49, -48, -50, -48,
-    -49, -49, -47, -49, -48, -47, -45, -48, -47, -48,
-    -49, -48, -48, -46, -44, -43, -42, -45, -45, -45,
-    -46, -45, -47, -49, -45, -47, -46, -45, -46, -43,
-    -46, -45, -47, -44, -45, -46, -48, -46, -47, -46,
-    -46, -47, -47, -47, -46, -47, -46, -48, -45, -47,
-    -46, -43, -44, -44, -47, -48, -45, -44, -46, -44,
-    -42, -42, -45, -44, -43, -45, -44, -44, -43, -44,
-    -45, -45, -46, -45, -45, -45, -45, -45, -48, -45,
-    -45, -43, -38, -44, -44, -45, -44, -43, -42, -42,
-    -45, -43, -41, -44, -45, -42, -43, -41, -41, -41,
-    -41, -42, -44, -43, -43, -42, -42, -42, -42, -43,
-    -41, -42, -40, -39, -38, -42, -44, -42, -44, -41,
-    -43, -42, -41, -43, -43, -43, -41, -41, -43, -43,
-    -45, -43, -42, -42, -41, -40, -43, -42, -46, -47,
-    -46, -45, -41, -43, -39, -40, -39, -39, -40, -41,
-    -38, -45, -44, -41, -40, -40, -43, -41, -39, -38,
-    -37, -39, -39, -39, -43, -41, -39, -40, -41, -39,
-    -40, -40, -42, -43, -41, -41, -42, -42, -41, -38,
-    -40, -41, -41, -44, -43, -42, -38, -41, -41, -41,
-    -38, -41, -42, -42, -42, -43, -44, -42, -43, -38,
-    -44, -44, -42, -41, -43, -43, -40, -41, -41, -42,
-    -42, -38, -41, -39, -41, -38, -38, -42, -39, -38,
-    -38, -38, -40, -41, -40, -41, -40, -39, -37, -40,
-    -42, -40, -39, -45, -43, -44, -43, -40, -46, -42,
-    -43, -40, -42, -45, -43, -44, -42, -43, -44, -42,
-    -45, -43, -42, -43, -44, -46, -43, -42, -45, -42,
-    -40, -42, -41, -40, -41, -43, -44, -43, -44, -42,
-    -38, -39, -38, -39, -40, -41, -42, -42, -42, -40,
-    -43, -41, -40, -41, -41, -40, -40, -42, -39, -41,
-    -42, -42, -38, -43, -44, -41, -45, -43, -43, -39,
-    -39, -41, -43, -42, -42, -41, -40, -41, -38, -42,
-    -42, -40, -41, -38, -37, -35, -38, -38, -38, -39,
-    -41, -44, -40, -40, -42, -44, -45, -41, -39, -42,
-    -42, -43, -42, -42, -42, -42, -40, -45, -43, -40,
-    -42, -38, -42, -38, -40, -41, -41, -42, -42, -44,
-    -43, -40, -37, -38, -38, -40, -39, -40, -41, -42,
-    -41, -38, -42, -42, -40, -38, -36, -39, -37, -42,
-    -41, -39, -40, -40, -40, -39, -39, -41, -41, -37,
-    -39, -41, -39, -38, -39, -37, -39, -39, -41, -39,
-    -40, -41, -38, -42, -41, -38, -40, -43, -42, -38,
-    -39, -39, -38, -41, -38, -36, -37, -38, -34, -37,
-    -39, -39, -39, -41, -37, -38, -42, -40, -41, -37,
-    -38, -37, -39, -39, -40, -39, -39, -39, -37, -38,
-    -40, -39, -39, -36, -37, -41, -38, -37, -34, -38,
-    -40, -41, -37, -37, -38, -35, -34, -35, -36, -36,
-    -33, -34, -36, -36, -38, -39, -36, -37, -35, -33,
-    -36, -34, -37, -36, -41, -36, -38, -35, -37, -37,
-    -33, -35, -33, -38, -35, -38, -36, -36, -38, -34,
-    -36, -35, -31, -36, -35, -37, -35, -38, -37, -37,
-    -35, -34, -34, -36, -36, -35, -37, -35, -38, -36,
-    -36, -34, -34, -35, -31, -32, -36, -33, -34, -37,
-    -36, -35, -38, -35, -35, -32, -34, -38, -33, -36,
-    -34, -37, -35, -32, -32, -32, -32, -32, -33, -33,
-    -33, -33, -33, -37, -36, -32, -33, -35, -34, -34,
-    -34, -32, -34, -31, -32, -33, -33, -33, -34, -36,
-    -33, -33, -34, -32, -34, -38, -35, -35, -37, -36,
-    -38, -36, -31, -32, -33, -30, -32, -33, -33, -29,
-    -32, -34, -32, -34, -33, -36, -34, -32, -32, -34,
-    -33, -31, -33, -33, -33, -35, -31, -30, -35, -33,
-    -35, -36, -38, -38, -33, -37, -38, -34, -36, -35,
-    -34, -33, -32, -33, -32, -32, -32, -31, -31, -34,
-    -35, -33, -34, -31, -36, -33, -35, -32, -29, -35,
-    -34, -36, -33, -37, -35, -34, -37, -33, -36, -34,
-    -33, -38, -35, -32, -35, -34, -36, -35, -35, -35,
-    -32, -33, -33, -31, -36, -34, -34, -34, -32, -32,
-    -34, -33, -34, -36, -32, -32, -31, -32, -32, -32,
-    -35, -34, -34, -34, -34, -36, -33, -33, -32, -37,
-    -36, -33, -35, -34, -37, -37, -37, -36, -35, -33,
-    -30, -29, -34, -33, -32, -35, -34, -35, -34, -34,
-    -33, -32, -35, -34, -34, -36, -36, -34, -37, -36,
-    -34, -35, -30, -33, -32, -34, -36, -37, -33, -34,
-    -34, -31, -35, -33, -35, -37, -36, -31, -34, -37,
-    -36, -34, -36, -35, -34, -34, -31, -32, -35, -34,
-    -32, -33, -32, -32, -31, -32, -30, -32, -32, -31,
-    -38, -36, -33, -34, -31, -34, -38, -35, -34, -37,
-    -33, -33, -36, -35, -33, -33, -33, -33, -32, -34,
-    -35, -34, -37, -36, -34, -31, -38, -37, -35, -35,
-    -32, -32, -31, -33, -34, -34, -33, -33, -32, -36,
-    -33, -34, -37, -34, -31, -32, -33, -33, -35, -33,
-    -34, -33, -34, -34, -35, -33, -31, -33, -33, -34,
-    -35, -35, -34, -33, -32, -35, -33, -33, -36, -33,
-    -35, -36, -36, -35, -32, -33, -34, -31, -31, -32,
-    -33, -33, -31, -34, -34, -36, -37, -34, -36, -32,
-    -33, -36, -34, -33, -34, -31, -35, -31, -33, -37,
-    -35, -34, -36, -40, -37, -36, -36, -36, -34, -37,
-    -34, -38, -36, -37, -37, -34, -35, -35, -35, -34,
-    -36, -36, -36, -33, -31, -32, -33, -33, -33, -34,
-    -34, -36, -38, -34, -38, -33, -34, -35, -32, -34,
-    -35, -34, -32, -33, -36, -36, -32, -29, -29, -30,
-    -29, -34, -33, -33, -33, -37, -35, -32, -36, -33,
-    -33, -31, -31, -35, -32, -31, -34, -32, -33, -32,
-    -33, -33, -35, -32, -35, -35, -34, -35, -31, -34,
-    -34, -38, -38, -36, -37, -34, -34, -37, -34, -37,
-    -36, -34, -34, -32, -32, -30, -34, -35, -33, -33,
-    -33, -34, -29, -30, -32, -32, -32, -31, -35, -36,
-    -36, -35, -36, -36, -34, -35, -34, -34, -34, -35,
-    -36, -37, -36, -35, -36, -37, -32, -33, -36, -34,
-    -34, -33, -33, -35, -36, -34, -35, -38, -39, -37,
-    -35, -36, -38, -37, -35, -33, -35, -33, -33, -37,
-    -37, -36, -35, -30, -34, -34, -31, -36, -32, -34,
-    -34, -37, -35, -33, -34, -36, -37, -35, -37, -33,
-    -36, -37, -35, -37, -35, -38, -35, -34, -37, -34,
-    -38, -33, -33, -37, -36, -35, -34, -35, -36, -33,
-    -32, -35, -35, -33, -33, -35, -33, -33, -35, -34,
-    -33, -32, -33, -36, -33, -35, -34, -32, -32, -30,
-    -31, -33, -31, -33, -32, -32, -36, -33, -36, -34,
-    -32, -34, -34, -38, -34, -35, -38, -35, -35, -34,
-    -36, -36, -37, -36, -38, -36, -38, -37, -34, -37,
-    -36, -37, -37, -34, -34, -35, -33, -33, -32, -33,
-    -34, -36, -32, -35, -36, -34, -34, -31, -34, -34,
-    -34, -32, -34, -34, -34, -36, -33, -32, -34, -31,
-    -33, -34, -34, -36, -35, -32, -32, -34, -33, -32,
-    -33, -31, -32, -35, -33, -32, -31, -34, -33, -30,
-    -29, -32, -30, -33, -33, -30, -34, -32, -30, -30,
-    -33, -33, -33, -31, -30, -29, -31, -30, -32, -33,
-    -31, -34, -31, -30, -28, -31, -30, -31, -29, -31,
-    -35, -30, -31, -31, -33, -33, -27, -32, -31, -31,
-    -31, -30, -31, -30, -32, -34, -31, -31, -32, -34,
-    -34, -28, -31, -29, -34, -27, -29, -34, -34, -33,
-    -33, -33, -31, -35, -31, -32, -33, -34, -32, -34,
-    -33, -31, -30, -33, -31, -30, -32, -33, -31, -29,
-    -32, -31, -26, -28, -30, -30, -31, -28, -31, -32,
-    -32, -29, -30, -30, -32, -31, -32, -33, -31, -32,
-    -33, -29, -31, -34, -27, -30, -29, -32, -30, -28,
-    -31, -27, -27, -28, -27, -30, -28, -25, -29, -29,
-    -28, -26, -27, -27, -24, -29, -29, -27, -28, -24,
-    -25, -28, -25, -24, -28, -28, -28, -28, -27, -27,
-    -24, -27, -26, -27, -28, -26, -30, -27, -29, -27,
-    -27, -26, -21, -26, -25, -27, -28, -28, -31, -25,
-    -27, -30, -27, -30, -29, -27, -27, -26, -29, -27,
-    -29, -29, -27, -30, -28, -30, -31, -30, -33, -32,
-    -35, -33, -34, -36, -31, -31, -29, -32, -30, -29,
-    -31, -30, -32, -34, -34, -31, -31, -31, -31, -28,
-    -28, -29, -30, -31, -29, -28, -30, -32, -30, -29,
-    -29, -31, -25, -29, -29, -27, -27, -29, -29, -26,
-    -30, -30, -29, -27, -29, -29, -29, -28, -29, -29,
-    -32, -29, -26, -29, -26, -28, -29, -32, -29, -31,
-    -31, -30, -28, -29, -28, -25, -26, -26, -27, -28,
-    -30, -28, -28, -30, -31, -28, -28, -27, -27, -30,
-    -29, -29, -31, -27, -30, -30, -31, -31, -31, -31,
-    -29, -34, -27, -30, -28, -32, -30, -28, -29, -29,
-    -30, -29, -28, -27, -30, -28, -29, -30, -31, -33,
-    -30, -31, -30, -27, -29, -29, -26, -29, -31, -30,
-    -29, -30, -30, -27, -26, -28, -28, -31, -25, -25,
-    -29, -28, -28, -27, -30, -27, -28, -28, -26, -25,
-    -27, -30, -27, -26, -30, -27, -26, -29, -26, -30,
-    -28, -28, -29, -26, -31, -28, -28, -30, -29, -32,
-    -31, -28, -27, -30, -27, -26, -30, -28, -28, -27,
-    -26, -29, -27, -28, -28, -29, -28, -29, -31, -30,
-    -30, -30, -27, -31, -29, -25, -26, -27, -28, -27,
-    -28, -25, -27, -27, -29, -28, -27, -30, -28, -28,
-    -27, -28, -30, -28, -30, -26, -28, -30, -26, -29,
-    -27, -25, -28, -29, -29, -29, -29, -29, -27, -28,
-    -28, -29, -29, -29, -27, -26, -27, -28, -27, -26,
-    -27, -28, -29, -27, -27, -27, -26, -24, -25, -26,
-    -22, -25, -28, -26, -29, -25, -24, -27, -25, -24,
-    -28, -24, -25, -24, -23, -27, -24, -26, -27, -26,
-    -23, -24, -24, -24, -25, -25, -26, -27, -28, -25,
-    -26, -27, -25, -22, -20, -23, -24, -26, -27, -22,
-    -23, -24, -24, -25, -26, -23, -29, -27, -27, -29,
-    -26, -29, -28, -28, -27, -25, -25, -25, -23, -26,
-    -26, -27, -27, -27, -29, -28, -30, -28, -27, -24,
-    -25, -26, -26, -30, -27, -24, -31, -27, -24, -26,
-    -23, -24, -27, -23, -26, -23, -27, -28, -22, -28,
-    -22, -26, -21, -21, -26, -23, -23, -26, -25, -26,
-    -25, -24, -25, -22, -24, -23, -23, -24, -27, -26,
-    -26, -27, -26, -24, -25, -24, -25, -22, -22, -24,
-    -24, -24, -25, -23, -24, -27, -25, -27, -24, -24,
-    -23, -27, -24, -24, -26, -25, -26, -24, -23, -23,
-    -23, -21, -22, -22, -23, -23, -23, -23, -23, -24,
-    -23, -23, -25, -25, -25, -26, -23, -24, -26, -27,
-    -27, -24, -24, -25, -20, -21, -25, -22, -21, -28,
-    -25, -24, -25, -23, -24, -23, -23, -23, -27, -27,
-    -27, -25, -26, -24, -23, -24, -23, -23, -22, -26,
-    -26, -23, -23, -21, -20, -20, -22, -21, -21, -21,
-    -19, -22, -19, -21, -24, -23, -24, -25, -25, -25,
-    -25, -26, -24, -21, -24, -20, -18, -24, -25, -24,
-    -24, -23, -21, -24, -27, -27, -26, -26, -26, -23,
-    -28, -26, -24, -23, -24, -25, -24, -26, -26, -25,
-    -25, -27, -25, -22, -24, -24, -23, -26, -24, -24,
-    -25, -26, -25, -25, -23, -18, -21, -21, -24, -23,
-    -22, -25, -22, -26, -25, -22, -22, -20, -24, -23,
-    -26, -22, -20, -22, -20, -21, -22, -21, -20, -22,
-    -21, -23, -23, -23, -25, -26, -27, -23, -24, -23,
-    -20, -23, -22, -21, -24, -22, -25, -25, -27, -25,
-    -21, -27, -26, -23, -24, -23, -22, -20, -20, -20,
-    -21, -22, -23, -23, -22, -19, -23, -23, -21, -26,
-    -25, -26, -23, -21, -20, -17, -18, -20, -23, -24,
-    -20, -23, -24, -20, -24, -22, -21, -23, -22, -22,
-    -26, -25, -28, -24, -25, -28, -27, -30, -28, -28,
-    -26, -24, -24, -27, -27, -24, -25, -26, -22, -21,
-    -21, -20, -21, -24, -22, -22, -20, -21, -24, -23,
-    -24, -20, -22, -22, -20, -22, -23, -20, -23, -24,
-    -23, -25, -21, -23, -22, -20, -21, -21, -22, -23,
-    -23, -23, -24, -25, -23, -22, -22, -23, -25, -24,
-    -26, -22, -23, -24, -24, -21, -23, -26, -22, -25,
-    -22, -26, -27, -24, -23, -23, -21, -21, -24, -25,
-    -22, -23, -22, -25, -22, -22, -24, -21, -22, -20,
-    -20, -21, -24, -25, -24, -22, -23, -25, -25, -25,
-    -24, -23, -24, -26, -26, -27, -24, -23, -21, -20,
-    -23, -24, -24, -26, -27, -25, -25, -22, -24, -26,
-    -24, -26, -26, -23, -23, -24, -26, -28, -21, -23,
-    -24, -24, -24, -27, -24, -19, -22, -23, -24, -24,
-    -23, -24, -21, -19, -23, -22, -25, -22, -24, -25,
-    -25, -26, -24, -25, -25, -23, -25, -24, -21, -23,
-    -23, -23, -23, -24, -24, -25, -22, -23, -22, -24,
-    -23, -22, -25, -23, -24, -24, -22, -22, -20, -21,
-    -26, -24, -23, -24, -23, -22, -22, -22, -24, -25,
-    -21, -23, -25, -24, -23, -27, -26, -24, -25, -25,
-    -26, -26, -25, -24, -23, -24, -24, -22, -26, -24,
-    -24, -27, -24, -26, -25, -28, -26, -23, -24, -21,
-    -22, -23, -24, -27, -24, -22, -22, -22, -21, -20,
-    -21, -22, -22, -25, -25, -23, -25, -24, -24, -24,
-    -20, -21, -24, -23, -23, -25, -26, -25, -24, -22,
-    -25, -20, -22, -24, -24, -24, -24, -24, -22, -22,
-    -22, -26, -23, -24, -22, -24, -27, -26, -23, -24,
-    -23, -22, -26, -26, -23, -24, -25, -21, -22, -22,
-    -25, -24, -26, -24, -22, -23, -21, -22, -25, -24,
-    -24, -21, -26, -26, -23, -25, -23, -22, -20, -20,
-    -20, -26, -22, -24, -26, -23, -21, -23, -25, -23,
-    -23, -23, -23, -22, -26, -22, -22, -22, -22, -23,
-    -24, -24, -23, -25, -23, -27, -26, -27, -27, -25,
-    -23, -23, -24, -22, -24, -23, -22, -24, -23, -25,
-    -25, -25, -30, -26, -26, -25, -21, -24, -22, -20,
-    -22, -22, -23, -25, -27, -24, -22, -26, -25, -22,
-    -24, -26, -26, -28, -29, -28, -26, -26, -25, -24,
-    -23, -25, -23, -23, -24, -22, -27, -23, -27, -26,
-    -23, -24, -22, -26, -24, -26, -25, -25, -26, -22,
-    -23, -24, -25, -28, -26, -26, -27, -26, -27, -25,
-    -26, -26, -21, -23, -22, -25, -25, -23, -24, -25,
-    -22, -22, -24, -23, -25, -20, -21, -20, -19, -20,
-    -22, -26, -22, -26, -24, -20, -21, -21, -19, -20,
-    -24, -24, -25, -27, -26, -22, -22, -21, -22, -21,
-    -23, -22, -21, -26, -22, -21, -23, -22, -21, -22,
-    -24, -21, -21, -21, -22, -25, -22, -21, -24, -24,
-    -20, -22, -21, -21, -23, -24, -22, -25, -25, -22,
-    -25, -21, -21, -20, -23, -23, -23, -23, -19, -21,
-    -20, -20, -22, -25, -23, -21, -22, -22, -23, -23,
-    -22, -20, -20, -23, -22, -23, -25, -22, -22, -20,
-    -22, -21, -23, -25, -25, -24, -22, -20, -21, -21,
-    -22, -27, -22, -22, -23, -22, -22, -23, -24, -27,
-    -26, -23, -24, -27, -25, -20, -24, -24, -23, -21,
-    -21, -23, -23, -21, -20, -19, -22, -19, -24, -23,
-    -20, -25, -18, -21, -20, -23, -21, -20, -23, -20,
-    -18, -19, -21, -23, -23, -20, -19, -19, -19, -19,
-    -20, -21, -20, -18, -18, -20, -20, -19, -19, -20,
-    -19, -16, -16, -20, -19, -16, -19, -19, -20, -19,
-    -14, -17, -21, -23, -20, -21, -20, -17, -18, -15,
-    -18, -17, -18, -19, -20, -20, -20, -20, -21, -19,
-    -17, -21, -17, -18, -16, -17, -19, -17, -18, -18,
-    -19, -16, -19, -20, -18, -19, -20, -20, -21, -20,
-    -17, -19, -15, -18, -20, -18, -21, -20, -21, -19,
-    -18, -19, -21, -22, -19, -18, -19, -20, -18, -19,
-    -15, -19, -18, -15, -17, -16, -20, -20, -19, -18,
-    -22, -20, -18, -19, -19, -20, -20, -20, -16, -19,
-    -17, -18, -21, -19, -22, -21, -21, -20, -17, -17,
-    -20, -22, -19, -20, -20, -20, -19, -19, -19, -18,
-    -18, -17, -16, -18, -18, -18, -17, -13, -20, -19,
-    -18, -20, -14, -15, -14, -13, -19, -20, -21, -19,
-    -19, -20, -19, -19, -16, -20, -17, -15, -15, -16,
-    -20, -17, -19, -18, -18, -18, -18, -16, -17, -20,
-    -16, -15, -17, -17, -18, -18, -18, -18, -17, -17,
-    -18, -20, -17, -19, -18, -18, -19, -18, -20, -18,
-    -18, -18, -19, -19, -20, -19, -20, -20, -20, -17,
-    -19, -20, -18, -22, -17, -18, -20, -18, -17, -19,
-    -21, -20, -17, -18, -17, -18, -19, -21, -25, -23,
-    -20, -20, -21, -16, -17, -16, -16, -17, -18, -20,
-    -18, -19, -20, -19, -16, -18, -21, -19, -20, -18,
-    -20, -21, -23, -21, -21, -24, -22, -22, -18, -20,
-    -19, -21, -22, -21, -21, -22, -22, -19, -18, -20,
-    -17, -19, -17, -18, -20, -22, -24, -17, -19, -20,
-    -21, -21, -20, -18, -19, -17, -18, -15, -17, -18,
-    -16, -21, -19, -19, -18, -15, -18, -18, -19, -20,
-    -18, -21, -24, -22, -20, -21, -22, -21, -22, -22,
-    -22, -22, -19, -19, -21, -21, -20, -19, -21, -18,
-    -21, -23, -22, -22, -22, -19, -18, -16, -19, -20,
-    -19, -20, -21, -22, -23, -24, -19, -21, -20, -20,
-    -19, -18, -18, -19, -21, -18, -18, -18, -19, -20,
-    -20, -17, -23, -19, -19, -21, -21, -21, -19, -20,
-    -17, -22, -21, -20, -21, -22, -17, -20, -21, -20,
-    -19, -20, -20, -18, -18, -17, -20, -19, -21, -16,
-    -18, -21, -23, -21, -20, -22, -17, -19, -20, -18,
-    -17, -21, -15, -19, -17, -15, -19, -22, -26, -22,
-    -19, -19, -18, -21, -21, -18, -18, -20, -20, -18,
-    -21, -20, -22, -23, -20, -18, -21, -22, -24, -21,
-    -22, -20, -20, -21, -21, -23, -22, -21, -18, -20,
-    -17, -17, -17, -19, -17, -21, -18, -18, -20, -22,
-    -23, -24, -22, -20, -22, -21, -25, -21, -25, -20,
-    -23, -23, -21, -18, -21, -23, -22, -20, -21, -25,
-    -22, -25, -20, -20, -22, -23, -23, -22, -22, -23,
-    -22, -23, -22, -19, -24, -22, -22, -23, -19, -22,
-    -23, -21, -22, -21, -22, -23, -21, -23, -20, -21,
-    -22, -19, -21, -20, -21, -21, -21, -19, -19, -19,
-    -19, -18, -20, -18, -20, -23, -22, -23, -21, -19,
-    -19, -19, -18, -21, -19, -22, -18, -20, -21, -19,
-    -18, -18, -21, -19, -19, -17, -20, -20, -17, -19,
-    -20, -23, -20, -18, -22, -16, -16, -16, -18, -18,
-    -18, -19, -19, -20, -19, -16, -16, -17, -17, -18,
-    -14, -17, -17, -18, -18, -19, -18, -21, -18, -17,
-    -19, -17, -18, -20, -19, -20, -20, -14, -19, -19,
-    -16, -14, -18, -18, -17, -16, -15, -18, -19, -18,
-    -19, -17, -17, -23, -18, -18, -22, -21, -21, -21,
-    -22, -26, -21, -21, -22, -16, -21, -20, -20, -20,
-    -22, -24, -18, -20, -17, -19, -20, -17, -19, -17,
-    -19, -18, -18, -19, -17, -17, -16, -18, -16, -16,
-    -18, -17, -18, -17, -15, -17, -18, -16, -15, -12,
-    -13, -15, -17, -18, -16, -18, -19, -16, -17, -19,
-    -19, -19, -18, -17, -16, -16, -18, -21, -19, -19,
-    -19, -18, -19, -17, -17, -17, -16, -19, -20, -17,
-    -17, -19, -20, -19, -18, -14, -16, -17, -14, -15,
-    -18, -16, -19, -19, -15, -18, -15, -18, -17, -15,
-    -19, -16, -15, -15, -17, -15, -15, -14, -16, -17,
-    -16, -16, -15, -17, -15, -15, -18, -18, -17, -17,
-    -17, -20, -15, -15, -17, -15, -17, -14, -16, -18,
-    -15, -15, -14, -14, -14, -16, -17, -16, -18, -15,
-    -18, -15, -14, -18, -17, -19, -14, -18, -17, -18,
-    -19, -15, -12, -12, -13, -11, -15, -14, -15, -14,
-    -13, -13, -14, -14, -15, -17, -14, -16, -16, -15,
-    -17, -18, -16, -16, -14, -16, -18, -15, -20, -20,
-    -15, -17, -17, -14, -17, -16, -16, -18, -17, -21,
-    -15, -14, -14, -18, -17, -15, -18, -19, -18, -15,
-    -18, -18, -18, -18, -18, -18, -16, -19, -22, -17,
-    -20, -15, -18, -17, -16, -17, -14, -21, -16, -16,
-    -14, -21, -19, -19, -18, -14, -15, -15, -17, -15,
-    -19, -18, -16, -18, -16, -21, -19, -18, -20, -18,
-    -20, -15, -18, -17, -17, -17, -16, -17, -17, -17,
-    -17, -20, -17, -15, -14, -14, -16, -12, -13, -17,
-    -18, -18, -19, -18, -17, -20, -17, -18, -16, -17,
-    -16, -15, -18, -17, -18, -16, -15, -20, -19, -20,
-    -18, -19, -23, -16, -21, -19, -18, -18, -19, -19,
-    -18, -19, -15, -17, -18, -20, -16, -18, -21, -19,
-    -20, -16, -19, -20, -19, -21, -17, -20, -18, -17,
-    -21, -22, -19, -16, -14, -16, -16, -14, -18, -15,
-    -14, -17, -16, -16, -20, -17, -16, -16, -13, -12,
-    -13, -16, -14, -15, -16, -16, -17, -17, -15, -17,
-    -15, -14, -14, -15, -18, -16, -16, -14, -11, -14,
-    -13, -14, -13, -14, -20, -18, -20, -18, -17, -18,
-    -16, -15, -17, -19, -17, -19, -17, -20, -19, -18,
-    -18, -20, -20, -13, -16, -19, -18, -17, -15, -17,
-    -16, -18, -20, -18, -19, -19, -17, -16, -18, -14,
-    -19, -20, -16, -19, -17, -19, -18, -18, -19, -18,
-    -16, -17, -18, -19, -20, -18, -18, -20, -22, -18,
-    -17, -16, -17, -19, -17, -19, -18, -16, -18, -17,
-    -14, -17, -17, -17, -18, -15, -17, -18, -17, -16,
-    -16, -16, -16, -14, -18, -18, -16, -19, -15, -16,
-    -17, -16, -17, -17, -17, -16, -16, -17, -13, -15,
-    -14, -18, -15, -14, -16, -16, -17, -16, -18, -15,
-    -16, -14, -15, -16, -19, -16, -15, -14, -17, -14,
-    -13, -18, -17, -17, -14, -15, -16, -17, -16, -17,
-    -14, -19, -20, -15, -18, -19, -18, -21, -22, -20,
-    -19, -18, -16, -16, -16, -16, -18, -20, -19, -17,
-    -17, -16, -16, -18, -19, -16, -16, -17, -17, -20,
-    -18, -18, -17, -17, -14, -19, -18, -17, -19, -18,
-    -18, -16, -14, -15, -15, -14, -17, -15, -16, -18,
-    -18, -17, -16, -15, -15, -16, -16, -15, -15, -14,
-    -15, -17, -18, -17, -14, -15, -15, -13, -13, -13,
-    -17, -21, -14, -15, -18, -16, -16, -16, -16, -16,
-    -16, -19, -19, -18, -18, -19, -19, -18, -21, -18,
-    -18, -15, -16, -18, -17, -14, -17, -17, -16, -18,
-    -14, -15, -17, -17, -16, -16, -13, -17, -15, -17,
-    -20, -18, -17, -17, -14, -15, -14, -17, -20, -19,
-    -20, -19, -18, -14, -14, -16, -21, -16, -16, -19,
-    -18, -17, -18, -20, -19, -20, -18, -17, -14, -16,
-    -20, -17, -18, -21, -18, -15, -18, -19, -18, -16,
-    -14, -17, -15, -14, -14, -16, -15, -16, -15, -15,
-    -15, -15, -14, -15, -15, -13, -18, -17, -20, -18,
-    -17, -16, -16, -17, -16, -17, -19, -19, -19, -19,
-    -17, -20, -19, -16, -16, -15, -18, -17, -15, -14,
-    -19, -17, -16, -18, -15, -17, -17, -16, -16, -16,
-    -16, -19, -20, -18, -18, -17, -16, -17, -17, -18,
-    -21, -14, -20, -17, -16, -22, -19, -20, -19, -19,
-    -19, -18, -17, -16, -17, -18, -19, -19, -19, -22,
-    -17, -15, -18, -18, -19, -20, -18, -20, -19, -16,
-    -19, -18, -18, -17, -17, -16, -17, -18, -19, -20,
-    -23, -20, -19, -16, -17, -19, -17, -20, -18, -18,
-    -18, -20, -17, -17, -16, -17, -16, -18, -20, -14,
-    -16, -16, -16, -19, -19, -13, -15, -16, -12, -16,
-    -18, -19, -21, -17, -18, -21, -19, -16, -14, -15,
-    -16, -16, -16, -18, -18, -17, -16, -18, -16, -16,
-    -16, -18, -14, -18, -15, -14, -19, -12, -16, -17,
-    -16, -14, -17, -14, -12, -14, -17, -16, -13, -16,
-    -16, -16, -14, -17, -14, -15, -16, -16, -18, -15,
-    -18, -17, -15, -15, -16, -14, -15, -17, -14, -13,
-    -15, -19, -17, -16, -14, -15, -16, -14, -16, -12,
-    -13, -14, -14, -12, -12, -17, -15, -15, -14, -16,
-    -13, -14, -12, -14, -17, -18, -18, -17, -17, -15,
-    -17, -12, -18, -14, -18, -17, -14, -16, -15, -18,
-    -12, -12, -12, -16, -15, -15, -14, -16, -16, -13,
-    -12, -15, -15, -17, -18, -17, -15, -15, -18, -16,
-    -18, -20, -20, -19, -17, -18, -19, -15, -15, -15,
-    -19, -17, -15, -17, -20, -19, -18, -20, -16, -18,
-    -19, -22, -19, -17, -19, -20, -21, -20, -21, -19,
-    -21, -17, -18, -21, -19, -21, -19, -20, -20, -20,
-    -21, -20, -18, -16, -17, -18, -19, -17, -18, -17,
-    -14, -19, -19, -16, -20, -20, -18, -17, -17, -21,
-    -19, -20, -17, -18, -20, -16, -20, -16, -16, -15,
-    -20, -21, -16, -21, -19, -15, -19, -21, -19, -20,
-    -18, -20, -19, -19, -21, -21, -19, -19, -18, -16,
-    -18, -20, -20, -21, -16, -16, -17, -18, -17, -17,
-    -20, -18, -17, -18, -20, -17, -18, -19, -19, -20,
-    -16, -20, -19, -16, -21, -19, -19, -21, -19, -18,
-    -17, -14, -17, -21, -20, -17, -16, -19, -17, -18,
-    -19, -18, -13, -15, -15, -16, -17, -15, -18, -17,
-    -17, -16, -18, -16, -17, -17, -16, -16, -13, -15,
-    -14, -14, -15, -15, -13, -15, -14, -12, -14, -12,
-    -13, -11, -13, -14, -16, -18, -14, -14, -12, -14,
-    -12, -15, -13, -12, -15, -17, -17, -16, -14, -13,
-    -14, -12, -18, -15, -15, -15, -13, -15, -14, -13,
-    -13, -15, -14, -16, -14, -12, -15, -14, -14, -12,
-    -13, -16, -14, -14, -19, -14, -11, -14, -15, -17,
-    -16, -14, -15, -15, -13, -13, -13, -12, -12, -14,
-    -18, -16, -16, -16, -13, -12, -12, -15, -14, -15,
-    -15, -13, -16, -13, -13, -14, -13, -14, -13, -14,
-    -17, -16, -15, -15, -19, -16, -17, -18, -15, -16,
-    -14, -13, -14, -17, -16, -18, -19, -19, -16, -18,
-    -15, -14, -17, -16, -15, -15, -16, -17, -19, -18,
-    -21, -21, -20, -21, -22, -23, -23, -21, -20, -21,
-    -23, -22, -24, -20, -21, -21, -18, -22, -18, -19,
-    -17, -18, -17, -19, -18, -19, -18, -18, -20, -21,
-    -24, -20, -19, -19, -24, -18, -19, -21, -20, -20,
-    -18, -18, -16, -17, -18, -17, -18, -18, -18, -20,
-    -19, -21, -20, -19, -20, -21, -18, -19, -20, -21,
-    -20, -18, -22, -21, -23, -24, -22, -20, -25, -23,
-    -21, -20, -19, -22, -21, -23, -21, -18, -20, -25,
-    -21, -21, -22, -20, -19, -19, -22, -21, -19, -20,
-    -21, -22, -24, -21, -17, -20, -21, -20, -21, -20,
-    -24, -21, -19, -18, -20, -17, -16, -16, -17, -22,
-    -20, -20, -17, -18, -16, -17, -19, -18, -18, -16,
-    -13, -18, -17, -19, -17, -15, -19, -18, -19, -15,
-    -16, -14, -13, -12, -14, -19, -20, -16, -19, -18,
-    -17, -14, -14, -15, -15, -20, -19, -18, -15, -18,
-    -19, -19, -18, -18, -18, -15, -16, -18, -17, -16,
-    -16, -20, -19, -17, -16, -17, -19, -17, -17, -14,
-    -17, -15, -16, -17, -15, -16, -15, -14, -13, -12,
-    -13, -13, -14, -14, -15, -17, -14, -17, -18, -16,
-    -14, -15, -13, -13, -14, -15, -15, -16, -16, -17,
-    -17, -18, -18, -13, -15, -15, -14, -15, -17, -17,
-    -14, -12, -16, -17, -13, -15, -14, -14, -14, -14,
-    -17, -16, -18, -17, -19, -18, -17, -17, -20, -17,
-    -14, -17, -16, -15, -15, -16, -14, -15, -18, -22,
-    -16, -14, -17, -15, -17, -19, -17, -17, -18, -14,
-    -16, -18, -17, -15, -15, -15, -12, -14, -16, -16,
-    -17, -16, -16, -14, -15, -15, -17, -19, -18, -15,
-    -12, -12, -14, -12, -14, -18, -17, -14, -12, -14,
-    -9, -12, -12, -13, -13, -14, -16, -14, -15, -15,
-    -15, -12, -15, -13, -11, -12, -15, -12, -15, -16,
-    -9, -13, -16, -15, -10, -15, -14, -9, -12, -13,
-    -13, -13, -16, -16, -16, -14, -14, -15, -12, -15,
-    -17, -16, -15, -17, -16, -14, -14, -15, -17, -20,
-    -15, -14, -17, -13, -15, -16, -17, -15, -10, -16,
-    -14, -11, -11, -18, -17, -14, -18, -16, -15, -12,
-    -14, -16, -14, -17, -17, -14, -17, -12, -14, -14,
-    -12, -12, -16, -16, -10, -13, -14, -15, -14, -15,
-    -14, -15, -15, -14, -12, -12, -14, -15, -15, -17,
-    -16, -10, -14, -18, -11, -15, -11, -14, -17, -10,
-    -12, -12, -12, -15, -16, -14, -10, -10, -14, -16,
-    -16, -15, -14, -14, -15, -15, -17, -18, -14, -11,
-    -15, -14, -14, -17, -17, -14, -18, -19, -14, -18,
-    -14, -15, -13, -17, -17, -15, -15, -13, -14, -15,
-    -14, -12, -13, -12, -14, -14, -16, -12, -12, -16,
-    -14, -12, -13, -10, -13, -15, -12, -15, -16, -14,
-    -15, -16, -16, -15, -13, -19, -14, -14, -14, -15,
-    -17, -15, -13, -13, -14, -11, -13, -16, -15, -13,
-    -17, -18, -14, -12, -15, -15, -14, -12, -11, -13,
-    -14, -11, -12, -16, -10, -11, -14, -15, -13, -11,
-    -13, -12, -15, -15, -15, -16, -13, -15, -15, -14,
-    -14, -15, -12, -15, -14, -13, -14, -14, -11, -11,
-    -10, -12, -16, -14, -17, -13, -12, -13, -14, -15,
-    -15, -17, -18, -16, -15, -13, -14, -15, -16, -14,
-    -15, -16, -13, -10, -7, -12, -9, -13, -12, -13,
-    -11, -11, -15, -15, -15, -10, -10, -11, -17, -13,
-    -10, -14, -14, -15, -13, -13, -14, -13, -11, -11,
-    -11, -12, -13, -13, -15, -12, -13, -15, -13, -13,
-    -11, -13, -13, -12, -15, -15, -17, -13, -15, -17,
-    -17, -16, -16, -15, -11, -13, -13, -15, -11, -12,
-    -15, -13, -11, -13, -11, -13, -11, -11, -17, -13,
-    -15, -15, -15, -14, -16, -15, -10, -12, -14, -12,
-    -13, -15, -14, -16, -15, -13, -14, -13, -12, -14,
-    -14, -14, -14, -15, -16, -15, -11, -14, -13, -13,
-    -14, -14, -16, -11, -15, -13, -13, -15, -12, -10,
-    -10, -13, -11, -11, -14, -13, -16, -12, -12, -14,
-    -14, -11, -13, -15, -14, -14, -14, -14, -12, -15,
-    -14, -12, -12, -12, -11, -12, -12, -15, -16, -14,
-    -11, -11, -11, -16, -15, -11, -12, -11, -12, -11,
-    -13, -14, -16, -15, -13, -12, -10, -10, -12, -10,
-    -8, -10, -13, -14, -15, -13, -11, -14, -13, -13,
-    -10, -11, -10, -14, -16, -13, -14, -16, -15, -15,
-    -13, -13, -16, -14, -14, -13, -16, -13, -15, -18,
-    -11, -13, -18, -14, -13, -12, -13, -11, -12, -17,
-    -14, -13, -16, -14, -10, -12, -11, -14, -15, -14,
-    -13, -13, -15, -16, -14, -13, -14, -12, -14, -16,
-    -11, -8, -14, -15, -15, -15, -12, -9, -11, -13,
-    -14, -13, -11, -15, -14, -11, -12, -12, -13, -13,
-    -9, -9, -8, -11, -13, -10, -12, -10, -13, -11,
-    -7, -11, -12, -13, -12, -10, -17, -14, -13, -12,
-    -8, -11, -9, -11, -10, -13, -10, -11, -15, -14,
-    -13, -12, -8, -11, -12, -13, -12, -10, -13, -11,
-    -14, -10, -13, -14, -11, -12, -12, -12, -13, -14,
-    -15, -11, -10, -11, -12, -15, -11, -14, -10, -9,
-    -9, -10, -13, -12, -11, -11, -12, -12, -12, -11,
-    -13, -10, -12, -12, -14, -11, -13, -17, -14, -10,
-    -10, -13, -14, -13, -12, -13, -13, -14, -11, -10,
-    -12, -13, -11, -13, -11, -12, -14, -14, -13, -12,
-    -11, -10, -10, -10, -13, -10, -11, -13, -12, -10,
-    -11, -11, -12, -11, -7, -9, -8, -12, -11, -10,
-    -12, -10, -12, -12, -11, -8, -10, -13, -13, -13,
-    -14, -13, -13, -15, -13, -12, -13, -13, -14, -14,
-    -10, -10, -12, -13, -15, -10, -9, -13, -12, -14,
-    -12, -9, -11, -13, -12, -12, -11, -11, -9, -10,
-    -10, -4, -10, -10, -8, -10, -10, -7, -9, -11,
-    -9, -10, -8, -9, -9, -7, -7, -10, -13, -14,
-    -12, -12, -11, -8, -13, -11, -15, -9, -10, -15,
-    -11, -14, -14, -16, -13, -10, -14, -10, -11, -16,
-    -15, -11, -12, -12, -12, -13, -10, -14, -13, -13,
-    -11, -12, -11, -13, -14, -11, -14, -10, -11, -13,
-    -12, -8, -13, -12, -11, -12, -12, -15, -12, -14,
-    -11, -13, -12, -10, -13, -9, -8, -9, -9, -9,
-    -14, -10, -6, -8, -9, -9, -10, -13, -14, -13,
-    -12, -12, -12, -9, -11, -7, -9, -10, -8, -13,
-    -12, -13, -12, -9, -13, -12, -9, -12, -13, -10,
-    -12, -9, -10, -12, -12, -11, -8, -11, -10, -9,
-    -10, -11, -12, -8, -13, -12, -9, -16, -14, -11,
-    -12, -11, -11, -11, -12, -13, -13, -12, -15, -9,
-    -12, -13, -10, -10, -11, -12, -12, -15, -10, -11,
-    -11, -12, -12, -14, -14, -11, -11, -13, -10, -10,
-    -13, -13, -13, -13, -13, -12, -11, -10, -12, -9,
-    -10, -6, -10, -10, -11, -10, -9, -12, -8, -8,
-    -9, -11, -10, -10, -9, -6, -7, -9, -8, -11,
-    -12, -10, -8, -12, -9, -10, -11, -10, -9, -11,
-    -10, -8, -14, -10, -10, -14, -10, -11, -7, -9,
-    -8, -10, -12, -10, -12, -9, -15, -12, -11, -14,
-    -12, -11, -13, -13, -11, -15, -16, -11, -12, -13,
-    -9, -12, -11, -11, -8, -9, -11, -9, -11, -11,
-    -8, -12, -11, -12, -11, -11, -12, -10, -11, -10,
-    -12, -9, -13, -11, -11, -12, -12, -11, -11, -10,
-    -14, -11, -12, -13, -8, -14, -10, -11, -12, -14,
-    -14, -13, -13, -10, -9, -12, -12, -11, -13, -10,
-    -8, -11, -16, -11, -15, -9, -10, -12, -11, -12,
-    -11, -11, -9, -10, -9, -12, -13, -13, -12, -16,
-    -12, -12, -13, -8, -12, -11, -8, -11, -9, -9,
-    -11, -11, -13, -13, -12, -11, -12, -10, -9, -7,
-    -11, -9, -6, -8, -7, -11, -11, -9, -9, -8,
-    -9, -8, -6, -10, -12, -10, -8, -11, -9, -11,
-    -10, -9, -9, -11, -13, -10, -9, -12, -11, -11,
-    -10, -9, -9, -9, -11, -8, -10, -9, -8, -8,
-    -8, -6, -6, -9, -12, -9, -11, -13, -11, -11,
-    -12, -13, -10, -11, -9, -8, -10, -11, -12, -14,
-    -10, -10, -9, -10, -10, -9, -8, -6, -10, -11,
-    -11, -10, -11, -12, -10, -8, -11, -9, -11, -11,
-    -11, -12, -12, -15, -12, -9, -10, -9, -8, -11,
-    -9, -8, -7, -12, -11, -11, -13, -8, -9, -9,
-    -9, -10, -12, -10, -9, -11, -12, -10, -8, -9,
-    -10, -10, -12, -11, -8, -9, -11, -11, -9, -10,
-    -11, -5, -10, -7, -6, -8, -7, -8, -7, -7,
-    -8, -8, -4, -6, -7, -6, -10, -6, -6, -10,
-    -7, -13, -10, -7, -9, -8, -11, -10, -8, -14,
-    -10, -10, -9, -11, -13, -9, -7, -7, -10, -9,
-    -8, -9, -11, -6, -11, -9, -9, -8, -8, -11,
-    -7, -7, -9, -7, -7, -7, -7, -13, -4, -9,
-    -7, -10, -10, -7, -6, -8, -13, -6, -8, -6,
-    -4, -7, -6, -6, -8, -5, -8, -5, -5, -11,
-    -8, -8, -7, -4, -6, -5, -8, -5, -8, -8,
-    -5, -5, -5, -12, -4, -6, -9, -6, -10, -9,
-    -10, -10, -9, -9, -7, -6, -7, -8, -5, -5,
-    -5, -4, -7, -9, -9, -10, -9, -8, -10, -10,
-    -10, -10, -8, -9, -9, -10, -10, -10, -8, -7,
-    -4, -6, -6, -5, -6, -5, -9, -6, -9, -7,
-    -6, -4, -9, -8, -3, -6, -5, -11, -8, -8,
-    -8, -9, -5, -6, -6, -3, -8, -6, -2, -3,
-    -7, -5, -4, -3, -3, -7, -6, -4, -5, -5,
-    -8, -6, -7, -8, -9, -8, -7, -6, -7, -7,
-    -8, -8, -3, -8, -7, -4, -6, -5, -3, -2,
-    -2, -5, -3, -4, -6, -8, -8, -3, -7, -8,
-    -8, -4, -5, -7, -6, -6, -6, -9, -6, -5,
-    -4, -3, -4, -5, -9, -8, -11, -8, -7, -9,
-    -8, -10, -11, -9, -8, -9, -6, -7, -8, -8,
-    -6, -6, -7, -8, -7, -6, -10, -7, -12, -9,
-    -7, -7, -7, -10, -7, -7, -7, -9, -8, -5,
-    -6, -9, -9, -6, -7, -11, -7, -6, -8, -5,
-    -8, -9, -9, -12, -13, -11, -10, -10, -9, -5,
-    -8, -9, -10, -10, -9, -7, -6, -10, -9, -11,
-    -7, -8, -9, -7, -6, -8, -7, -4, -7, -7,
-    -8, -7, -8, -6, -8, -8, -5, -7, -3, -6,
-    -7, -5, -5, -4, -6, -7, -6, -2, -5, -6,
-    -6, -9, -8, -9, -10, -9, -7, -4, -7, -7,
-    -5, -7, -5, -7, -8, -6, -4, -6, -8, -3,
-    -6, -5, -6, -5, -4, -9, -6, -5, -9, -4,
-    -6, -9, -7, -11, -10, -10, -11, -9, -9, -10,
-    -9, -7, -8, -12, -8, -8, -10, -10, -9, -10,
-    -14, -10, -9, -7, -8, -8, -10, -9, -9, -8,
-    -9, -12, -7, -6, -6, -6, -4, -8, -6, -7,
-    -10, -7, -8, -5, -1, -5, -7, -8, -8, -9,
-    -7, -5, -9, -8, -9, -6, -6, -7, -9, -9,
-    -10, -13, -6, -8, -6, -7, -5, -6, -6, -4,
-    -5, -3, -11, -8, -7, -7, -6, -9, -6, -8,
-    -9, -4, -6, -6, -7, -8, -4, -5, -4, -5,
-    -5, -6, -4, -3, -6, -2, -4, -8, -6, -6,
-    -6, -3, -3, -4, -4, -5, -7, -8, -5, -5,
-    -5, -5, -6, -5, -6, -7, -3, -7, -5, -5,
-    -8, -5, -8, -3, -6, -6, -4, -5, -6, -6,
-    -5, -8, -6, -7, -5, -8, -7, -7, -8, -7,
-    -7, -6, -4, -7, -8, -8, -9, -8, -6, -6,
-    -7, -5, -5, -7, -8, -7, -6, -8, -9, -8,
-    -8, -7, -7, -7, -7, -9, -10, -9, -10, -11,
-    -11, -7, -6, -8, -5, -7, -9, -8, -11, -10,
-    -7, -10, -11, -7, -7, -7, -7, -9, -10, -9,
-    -8, -8, -12, -8, -5, -9, -3, -7, -5, -4,
-    -5, -8, -9, -1, -7, -6, -4, -6, -6, -3,
-    -5, -6, -1, -6, -7, -7, -10, -9, -7, -6,
-    -5, -4, -5, -3, -4, -5, -5, -10, -7, -7,
-    -5, -5, -4, -5, -8, -5, -6, -8, -7, -9,
-    -6, -6, -5, -6, -10, -6, -10, -11, -10, -10,
-    -10, -9, -8, -9, -9, -11, -7, -4, -9, -9,
-    -8, -10, -11, -13, -12, -9, -11, -12, -9, -9,
-    -10, -12, -8, -11, -10, -9, -12, -10, -10, -6,
-    -8, -10, -8, -9, -10, -12, -12, -9, -8, -10,
-    -11, -9, -11, -10, -12, -11, -8, -11, -8, -3,
-    -7, -9, -4, -8, -10, -12, -10, -10, -14, -11,
-    -8, -12, -9, -8, -11, -7, -10, -10, -10, -12,
-    -10, -7, -5, -10, -9, -8, -10, -8, -7, -9,
-    -9, -6, -9, -6, -6, -6, -5, -8, -8, -7,
-    -8, -8, -10, -9, -10, -8, -10, -13, -10, -8,
-    -7, -8, -7, -9, -7, -10, -7, -6, -6, -4,
-    -8, -8, -10, -6, -9, -12, -10, -12, -9, -10,
-    -8, -8, -9, -10, -9, -7, -10, -9, -8, -7,
-    -6, -7, -7, -6, -7, -5, -7, -5, -6, -7,
-    -8, -8, -5, -11, -6, -8, -9, -3, -10, -11,
-    -7, -6, -10, -8, -8, -9, -9, -8, -5, -9,
-    -6, -9, -8, -4, -6, -8, -6, -6, -7, -4,
-    -5, -6, -7, -10, -10, -9, -6, -6, -7, -7,
-    -12, -10, -8, -11, -10, -12, -8, -6, -12, -9,
-    -8, -9, -8, -9, -9, -10, -11, -10, -10, -8,
-    -6, -8, -9, -10, -8, -7, -9, -11, -7, -6,
-    -8, -8, -7, -8, -8, -6, -9, -8, -8, -8,
-    -8, -9, -8, -6, -8, -8, -9, -8, -6, -10,
-    -8, -6, -11, -8, -8, -11, -7, -9, -7, -8,
-    -7, -6, -9, -8, -6, -10, -8, -9, -10, -8,
-    -12, -7, -10, -10, -11, -14, -7, -8, -8, -5,
-    -7, -9, -8, -7, -9, -6, -8, -10, -8, -10,
-    -6, -8, -8, -8, -9, -7, -12, -9, -10, -6,
-    -7, -8, -7, -8, -6, -8, -9, -9, -6, -7,
-    -7, -6, -5, -7, -6, -8, -7, -6, -8, -8,
-    -8, -7, -6, -6, -7, -6, -9, -8, -5, -6,
-    -7, -7, -7, -7, -8, -10, -8, -6, -6, -8,
-    -6, -5, -8, -7, -7, -9, -5, -6, -7, -8,
-    -7, -9, -9, -7, -9, -10, -13, -8, -10, -11,
-    -9, -12, -8, -6, -9, -13, -11, -10, -10, -9,
-    -9, -7, -6, -6, -8, -3, -3, -6, -8, -9,
-    -9, -8, -7, -6, -4, -5, -2, -6, -3, 0,
-    0, 0, 1, 0, -1, 0, 0, 1, 0, 0,
-    1, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-    -1, 0, 0, 0, 0, 0, 0, -1, 0, 0,
-    0, 0, 0, 0, -1, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -1, 0, -1, -1, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -1, 0, 0, 0, 0, 0,
-    0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0
+static const uint8_t sound_braking_data[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0x01, 0x90, 0x01, 0x09, 0x01, 0x90, 0x01, 0x90, 0x00, 0x10, 0x90, 0x90,
+    0x11, 0x19, 0x00, 0x09, 0x00, 0x90, 0x11, 0x19, 0x00, 0x99, 0x01, 0x01, 0x00, 0x19, 0x00, 0x00,
+    0x90, 0x00, 0x91, 0x91, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x91, 0x19, 0x19, 0x09,
+    0xff, 0xff, 0x00, 0x00, 0x19, 0x00, 0x01, 0x10, 0x09, 0x00, 0x91, 0x90, 0x01, 0x90, 0x09, 0x10,
+    0x10, 0x10, 0x00, 0x92, 0x09, 0x01, 0x09, 0x21, 0x91, 0x1a, 0x91, 0x1a, 0x90, 0x00, 0x91, 0x09,
+    0x00, 0x19, 0x19, 0x19, 0x02, 0x99, 0x00, 0x09, 0x92, 0x11, 0x92, 0x19, 0x09, 0x1b, 0x11, 0xa9,
+    0x01, 0x01, 0x90, 0x19, 0x19, 0x91, 0x91, 0x00, 0x09, 0x91, 0x10, 0x21, 0x0a, 0x09, 0x91, 0x99,
+    0x02, 0x99, 0x01, 0x19, 0x11, 0x09, 0x11, 0x39, 0x9a, 0x10, 0x99, 0x93, 0xa0, 0xa2, 0xa3, 0x90,
+    0x30, 0x1a, 0x19, 0x19, 0x90, 0x00, 0x01, 0x11, 0x91, 0xa1, 0x29, 0x99, 0x99, 0x39, 0x91, 0x19,
+    0xb2, 0x19, 0x99, 0x11, 0x11, 0x09, 0x19, 0x09, 0x03, 0xb9, 0x92, 0x90, 0x19, 0x01, 0x20, 0x90,
+    0x09, 0x91, 0x1b, 0x90, 0x21, 0x09, 0x99, 0x91, 0x00, 0x92, 0x19, 0x90, 0x11, 0x3a, 0x99, 0x19,
+    0x19, 0x09, 0xa3, 0x19, 0x09, 0x11, 0x01, 0x99, 0x90, 0x19, 0x19, 0x91, 0x01, 0x99, 0x93, 0x00,
+    0x91, 0x1a, 0x91, 0x01, 0x00, 0x1b, 0x11, 0x01, 0x1b, 0xa9, 0x91, 0xa9, 0x11, 0x10, 0x11, 0x09,
+    0x09, 0x91, 0x31, 0x01, 0x99, 0xb9, 0x91, 0x21, 0x90, 0x1a, 0x9a, 0x11, 0x11, 0x02, 0x9b, 0xa1,
+    0x11, 0x13, 0x19, 0xb0, 0x92, 0x2a, 0x91, 0x11, 0x09, 0x19, 0x01, 0x09, 0x11, 0x91, 0x19, 0x00,
+    0xa9, 0x11, 0x91, 0x19, 0x22, 0xb9, 0x10, 0x01, 0x99, 0x11, 0x99, 0x90, 0x13, 0x1b, 0x91, 0x91,
+    0x99, 0x19, 0x91, 0x10, 0x01, 0x93, 0x0b, 0x09, 0x11, 0x91, 0x00, 0x0b, 0x00, 0x32, 0xb0, 0x1b,
+    0x02, 0x91, 0x10, 0x09, 0x91, 0x11, 0x90, 0x9a, 0x1a, 0x33, 0x91, 0x29, 0xbb, 0x93, 0x2b, 0x01,
+    0x9a, 0x94, 0x9a, 0x20, 0x09, 0x91, 0x53, 0x9b, 0x11, 0xaa, 0x39, 0x91, 0xd0, 0x01, 0x09, 0x95,
+    0xfe, 0xff, 0x03, 0x00, 0x30, 0xd1, 0x83, 0x10, 0xab, 0x23, 0xb2, 0xa5, 0xbc, 0x51, 0x20, 0x51,
+    0x99, 0xfa, 0x9a, 0x19, 0xa1, 0x31, 0x84, 0x0d, 0xa3, 0xa3, 0x6a, 0xa1, 0x1a, 0x2a, 0x9d, 0x82,
+    0x16, 0xcc, 0x19, 0x8b, 0x9a, 0xb5, 0xfb, 0x5c, 0x37, 0x00, 0x98, 0x81, 0xa8, 0x9d, 0xdb, 0x98,
+    0x51, 0x24, 0x10, 0xb8, 0x8a, 0xc0, 0x28, 0x0d, 0xd1, 0x9a, 0x61, 0x01, 0xa8, 0xdb, 0xbb, 0x51,
+    0x46, 0x02, 0x88, 0xca, 0x9a, 0x38, 0x12, 0x80, 0xc8, 0x09, 0x12, 0x71, 0x14, 0xa8, 0xba, 0x99,
+    0x21, 0x04, 0xcb, 0xbe, 0x8b, 0x71, 0x33, 0x23, 0x98, 0xdc, 0xaa, 0x08, 0x11, 0x01, 0xe9, 0xbc,
+    0x9a, 0x51, 0x36, 0x13, 0x01, 0xa8, 0xbf, 0x9b, 0x09, 0x11, 0x34, 0x13, 0xa8, 0x89, 0xc0, 0xab,
+    0x59, 0x16, 0x18, 0x32, 0xb1, 0xbf, 0x01, 0xa9, 0x09, 0xa0, 0xaf, 0x74, 0x23, 0x99, 0x00, 0xdb,
+    0x99, 0x21, 0x99, 0x40, 0x13, 0x9b, 0x33, 0xd0, 0x9b, 0x73, 0xa2, 0x0c, 0xa0, 0x0a, 0x80, 0xbf,
+    0x42, 0x01, 0x99, 0x80, 0xbf, 0x73, 0x83, 0x09, 0x99, 0xa8, 0x9a, 0x28, 0xc2, 0x2b, 0x37, 0xc2,
+    0x3b, 0x16, 0xbc, 0x31, 0xb8, 0x9a, 0x41, 0xb1, 0x79, 0x03, 0xbb, 0xaa, 0xab, 0x3a, 0x77, 0x12,
+    0x90, 0xbb, 0xeb, 0x1a, 0x32, 0x21, 0x23, 0xc1, 0xad, 0x21, 0x80, 0x09, 0x04, 0xbe, 0x30, 0x12,
+    0x09, 0x80, 0xe8, 0x1b, 0x05, 0x89, 0x21, 0xa8, 0x9f, 0x30, 0x35, 0x98, 0x99, 0xdb, 0x1a, 0x25,
+    0x01, 0x80, 0x08, 0x9d, 0x21, 0x82, 0xad, 0x00, 0xa0, 0x08, 0x63, 0xa8, 0x21, 0xdc, 0x68, 0x15,
+    0xd9, 0x0a, 0x90, 0x8b, 0x47, 0x90, 0x8a, 0x92, 0x9d, 0x42, 0x81, 0x99, 0x20, 0xfb, 0x30, 0x83,
+    0xa9, 0x8a, 0xd8, 0x29, 0x44, 0x13, 0xb8, 0xab, 0xcd, 0x2a, 0x27, 0x81, 0x8a, 0x91, 0xad, 0x41,
+    0x12, 0x08, 0x40, 0x00, 0xb9, 0x38, 0xb2, 0x1b, 0x36, 0x98, 0xaa, 0xa9, 0xae, 0x63, 0x01, 0x01,
+    0xa8, 0xab, 0x09, 0x34, 0x82, 0xcb, 0x9a, 0x18, 0x54, 0x12, 0xc9, 0xcb, 0x09, 0x43, 0x32, 0x03,
+    0xdc, 0x9a, 0x98, 0x29, 0x16, 0x9a, 0x73, 0x84, 0xbb, 0x00, 0xfc, 0x29, 0x14, 0x09, 0x32, 0xd9,
+    0x8a, 0x21, 0xb9, 0x70, 0xa1, 0x8a, 0x33, 0xc1, 0x0b, 0xb1, 0xad, 0x52, 0x13, 0x08, 0x90, 0xbc,
+    0x9b, 0x62, 0x12, 0x08, 0x81, 0xdc, 0x1a, 0x13, 0xaa, 0x44, 0xb9, 0x19, 0x44, 0xb1, 0x0c, 0xc8,
+    0x8b, 0x52, 0x33, 0x08, 0xb0, 0xce, 0x28, 0x01, 0x00, 0x00, 0xb8, 0x0b, 0x45, 0x82, 0x9c, 0x80,
+    0xbd, 0x52, 0x01, 0x31, 0x92, 0xdd, 0x8b, 0x90, 0x40, 0x04, 0x39, 0x27, 0xda, 0x89, 0xa8, 0x8c,
+    0x44, 0x80, 0x21, 0xa1, 0xbc, 0x10, 0xc8, 0x49, 0x83, 0x10, 0x31, 0xe2, 0x9d, 0x90, 0x18, 0x42,
+    0x02, 0xa9, 0x9a, 0x80, 0xab, 0x43, 0x26, 0xca, 0x30, 0xb9, 0x8a, 0x25, 0xcc, 0x31, 0x90, 0x42,
+    0x23, 0xf9, 0x8c, 0xa9, 0x38, 0x54, 0x82, 0xaa, 0x89, 0x99, 0x52, 0x81, 0xbb, 0x19, 0xb8, 0x41,
+    0x24, 0x91, 0x8c, 0xa8, 0x3a, 0x14, 0x32, 0xfb, 0x09, 0xd8, 0x49, 0x02, 0xd9, 0x59, 0x16, 0xa8,
+    0x00, 0xda, 0x9e, 0x32, 0x81, 0x51, 0xa0, 0x9b, 0x00, 0xa1, 0x4a, 0x83, 0x0c, 0x13, 0xba, 0x1b,
+    0x14, 0x99, 0x54, 0xc8, 0x8a, 0x12, 0xa1, 0x9d, 0x41, 0x22, 0xa8, 0x18, 0xfa, 0x8d, 0x33, 0xa0,
+    0x38, 0x92, 0x0a, 0x01, 0xc9, 0x9d, 0x08, 0x41, 0x25, 0x99, 0x99, 0xb8, 0x1a, 0x35, 0xf9, 0x19,
+    0x93, 0x19, 0x02, 0x32, 0xdc, 0x99, 0x0a, 0x42, 0x25, 0x02, 0xdd, 0xaa, 0x09, 0x63, 0x12, 0x89,
+    0x35, 0xf9, 0x1a, 0xa1, 0x9c, 0x62, 0x80, 0x28, 0x93, 0xae, 0x08, 0x82, 0x19, 0x17, 0xaa, 0x80,
+    0xb5, 0xfc, 0x44, 0x00, 0x99, 0x38, 0x03, 0x89, 0x23, 0xa8, 0xa9, 0xbc, 0xdb, 0x1a, 0x75, 0x04,
+    0x89, 0x91, 0xcc, 0x1a, 0x12, 0x09, 0x35, 0xb8, 0x0b, 0x00, 0xa9, 0x71, 0xa1, 0x8a, 0x89, 0x01,
+    0x20, 0x16, 0xbb, 0x18, 0x00, 0x88, 0x56, 0xd0, 0x0b, 0x10, 0x89, 0x42, 0xb2, 0x0c, 0x80, 0x09,
+    0x31, 0xc2, 0x9e, 0x48, 0x27, 0x88, 0xa9, 0xcb, 0xac, 0x52, 0x14, 0x10, 0x90, 0xcd, 0x18, 0x80,
+    0x22, 0x13, 0xd9, 0x0a, 0xa8, 0x18, 0x12, 0xaa, 0x75, 0x93, 0x9c, 0x80, 0xda, 0x2a, 0x24, 0x10,
+    0x23, 0xc9, 0x9b, 0xaa, 0x1a, 0x35, 0xa8, 0x18, 0x01, 0x61, 0x14, 0xd8, 0xbd, 0x88, 0x32, 0x35,
+    0x90, 0xba, 0xbd, 0x3a, 0x26, 0x80, 0x21, 0xe9, 0x0b, 0x14, 0xaa, 0x12, 0x99, 0x09, 0x34, 0xa0,
+    0x21, 0xfc, 0x0c, 0x41, 0x02, 0x21, 0xe9, 0xbb, 0x19, 0x43, 0x13, 0x81, 0xc9, 0xac, 0x21, 0x81,
+    0x10, 0x88, 0xb9, 0x78, 0x04, 0xaa, 0xdb, 0x48, 0x25, 0x80, 0x80, 0xde, 0x0a, 0x13, 0x20, 0x15,
+    0xb9, 0x8a, 0x80, 0xab, 0x45, 0x98, 0x8b, 0x24, 0x99, 0x21, 0xf8, 0x0c, 0x34, 0x98, 0x18, 0xd8,
+    0x9c, 0x31, 0x11, 0x34, 0xa1, 0xac, 0x99, 0xab, 0x41, 0x13, 0x99, 0x51, 0xa8, 0x48, 0xb0, 0xac,
+    0x60, 0x93, 0x1a, 0x80, 0xdc, 0x9a, 0x62, 0x23, 0x98, 0x08, 0xda, 0x8a, 0x21, 0x88, 0x29, 0x14,
+    0x89, 0x25, 0xeb, 0x9a, 0x54, 0xa2, 0x09, 0xa0, 0xcf, 0x20, 0x02, 0x40, 0x84, 0xba, 0x0a, 0x91,
+    0x9d, 0x53, 0xa8, 0x20, 0x02, 0xab, 0x81, 0x8c, 0x36, 0xb8, 0x98, 0xdb, 0x8c, 0x53, 0x11, 0x34,
+    0xc8, 0xab, 0x88, 0xcb, 0x70, 0x92, 0x18, 0x02, 0xa8, 0x18, 0xe8, 0x0b, 0x25, 0xa9, 0x18, 0x91,
+    0xaa, 0x62, 0x02, 0x08, 0xca, 0x10, 0xb9, 0x1b, 0x81, 0x89, 0x66, 0x01, 0x10, 0xc9, 0xdb, 0x1a,
+    0x18, 0xf8, 0x40, 0x00, 0x24, 0x00, 0x99, 0xda, 0xab, 0x40, 0x25, 0xa0, 0x2a, 0x83, 0xaf, 0x00,
+    0x89, 0x21, 0x33, 0x22, 0xa3, 0xff, 0x2a, 0x23, 0xa8, 0x11, 0xfb, 0x1c, 0x13, 0x88, 0x43, 0xb1,
+    0x9c, 0x20, 0xeb, 0x28, 0x13, 0x89, 0x11, 0xb0, 0xbb, 0x78, 0x06, 0x9b, 0x03, 0xaf, 0x28, 0x23,
+    0x99, 0x51, 0xa2, 0x9e, 0x10, 0xb9, 0x09, 0x35, 0x99, 0x44, 0xa8, 0xba, 0x0a, 0xa8, 0x54, 0x80,
+    0x98, 0x98, 0x00, 0x10, 0x53, 0x94, 0xad, 0x80, 0xbc, 0x48, 0x13, 0x00, 0x41, 0x93, 0x9e, 0x88,
+    0x89, 0x00, 0x24, 0xab, 0x12, 0xca, 0x19, 0x84, 0x3a, 0x17, 0xca, 0x8a, 0xa8, 0x68, 0x13, 0x01,
+    0x9a, 0xc2, 0xaf, 0x43, 0x83, 0x0a, 0xe1, 0xad, 0x21, 0x04, 0x18, 0x15, 0xbb, 0x9a, 0xa8, 0x8a,
+    0x46, 0x03, 0xaa, 0x98, 0xba, 0x39, 0x57, 0x90, 0x88, 0xca, 0xab, 0x52, 0x02, 0x20, 0x23, 0xea,
+    0x0b, 0xb0, 0x8c, 0x54, 0x91, 0x2a, 0x90, 0xac, 0x50, 0x14, 0x89, 0xa9, 0xcb, 0x09, 0x34, 0x12,
+    0x30, 0xd1, 0x9d, 0x09, 0x90, 0x38, 0x16, 0xa9, 0x1a, 0x12, 0x88, 0x22, 0xfc, 0x8a, 0x00, 0x11,
+    0x75, 0x91, 0xaa, 0xa8, 0x9a, 0x30, 0x26, 0x21, 0xb9, 0xcb, 0xab, 0x28, 0x45, 0x02, 0x99, 0xaa,
+    0x61, 0x84, 0x9a, 0xa9, 0xac, 0x31, 0x04, 0x08, 0x10, 0xda, 0x2a, 0x86, 0x9a, 0x40, 0x92, 0x1a,
+    0xa1, 0xcc, 0x51, 0x04, 0x8b, 0x90, 0xbe, 0x38, 0x33, 0x18, 0x44, 0x92, 0xeb, 0x9a, 0x99, 0x8a,
+    0x27, 0x81, 0x00, 0xb8, 0x8b, 0x45, 0x82, 0xaa, 0xb9, 0xae, 0x40, 0x14, 0x88, 0x21, 0xe9, 0x8a,
+    0x21, 0xb8, 0x71, 0xa2, 0x9c, 0x21, 0x01, 0x12, 0xca, 0xad, 0x88, 0x20, 0x45, 0x03, 0xb9, 0xc9,
+    0x9c, 0x10, 0x42, 0x04, 0x98, 0xac, 0xa8, 0x0a, 0x54, 0xa3, 0x89, 0x08, 0x44, 0xa9, 0x89, 0xcb,
+    0xc8, 0xd8, 0x42, 0x00, 0x58, 0x24, 0xa0, 0x18, 0xb8, 0x0c, 0x35, 0xb8, 0x8a, 0x80, 0x0b, 0x27,
+    0xb8, 0x2c, 0x24, 0xba, 0x30, 0xf0, 0x8c, 0x42, 0xa1, 0x3a, 0x05, 0xaa, 0x18, 0xb8, 0x9e, 0x41,
+    0x82, 0x28, 0x83, 0xcd, 0x28, 0x13, 0x09, 0xb8, 0xcb, 0x0a, 0x54, 0x82, 0x00, 0x93, 0xce, 0x09,
+    0x83, 0x0b, 0x27, 0xb8, 0x2a, 0x16, 0xaa, 0x99, 0xba, 0x10, 0x73, 0x23, 0x01, 0xba, 0xce, 0x89,
+    0x12, 0x21, 0x34, 0x91, 0xcd, 0x88, 0x98, 0x38, 0x14, 0xa9, 0x80, 0x9b, 0x74, 0x93, 0xab, 0x99,
+    0xb9, 0x70, 0x06, 0x9a, 0x18, 0xa9, 0x28, 0x14, 0xba, 0x31, 0xb8, 0x3a, 0x85, 0x9f, 0x40, 0x83,
+    0x89, 0x98, 0xdc, 0x28, 0x34, 0x99, 0x38, 0x82, 0xbb, 0xb9, 0x9f, 0x08, 0x34, 0x14, 0x09, 0xd9,
+    0x0b, 0x34, 0xb0, 0x19, 0xe8, 0x0b, 0x34, 0xb1, 0x49, 0x85, 0x9c, 0x20, 0xc0, 0x0a, 0x33, 0x92,
+    0x8a, 0xb2, 0xbf, 0x53, 0x02, 0x89, 0xa9, 0xbe, 0x40, 0x13, 0x80, 0x42, 0xe9, 0x9b, 0x52, 0xb8,
+    0x48, 0x93, 0xbb, 0x20, 0xe8, 0x3a, 0x36, 0xb0, 0x0a, 0xd8, 0x0b, 0x53, 0x81, 0x19, 0x04, 0xdb,
+    0x19, 0x82, 0x9b, 0x35, 0xb8, 0x1b, 0x04, 0x9a, 0x10, 0xb9, 0x49, 0x03, 0x8a, 0x53, 0xe0, 0x0b,
+    0x03, 0x09, 0x11, 0x90, 0x08, 0xda, 0xac, 0x20, 0x33, 0x00, 0x76, 0x84, 0x9c, 0x90, 0xdb, 0x29,
+    0x15, 0x98, 0x53, 0xb0, 0x9c, 0x02, 0xcb, 0x52, 0x83, 0x9a, 0x20, 0xeb, 0x19, 0x23, 0x90, 0x00,
+    0xd8, 0x8b, 0x33, 0xa1, 0x1a, 0x46, 0xc0, 0x09, 0x92, 0xbe, 0x50, 0x82, 0x89, 0x83, 0xcd, 0x38,
+    0x24, 0x98, 0x80, 0xdd, 0x19, 0x22, 0x11, 0x41, 0x92, 0xdb, 0x9b, 0x98, 0x58, 0x33, 0x82, 0xac,
+    0xb9, 0x0c, 0x52, 0x23, 0x81, 0xea, 0xaa, 0x0a, 0x36, 0x90, 0x31, 0xd0, 0xac, 0x28, 0x81, 0x38,
+    0x3e, 0x14, 0x40, 0x00, 0xc2, 0x9c, 0x99, 0x29, 0x47, 0x80, 0xa9, 0xdb, 0x0b, 0x32, 0x43, 0x24,
+    0xa1, 0xad, 0xaa, 0x9b, 0x34, 0x34, 0x82, 0xaa, 0xce, 0x08, 0x32, 0x14, 0x99, 0xc8, 0xac, 0x30,
+    0x05, 0x09, 0x32, 0xd0, 0x1b, 0x83, 0xae, 0x30, 0x83, 0x0b, 0x15, 0xc9, 0x1a, 0x25, 0xb0, 0xaa,
+    0xa9, 0x8b, 0x55, 0x02, 0x99, 0x53, 0xd9, 0x0a, 0x90, 0xab, 0x55, 0x92, 0x0b, 0x83, 0xbd, 0x30,
+    0x02, 0x21, 0x91, 0xcc, 0x09, 0x00, 0x32, 0x23, 0xa0, 0xfb, 0x9d, 0x20, 0x02, 0x31, 0xb1, 0xbf,
+    0x19, 0x54, 0x04, 0x89, 0xc9, 0xbd, 0x28, 0x32, 0x53, 0x02, 0xdb, 0x8a, 0x81, 0x8c, 0x45, 0x90,
+    0x09, 0xb0, 0xac, 0x51, 0x02, 0x98, 0x01, 0xcd, 0x19, 0x23, 0x00, 0x22, 0xa9, 0x9b, 0x28, 0xc8,
+    0x1a, 0x19, 0x27, 0x8a, 0xa0, 0x59, 0x25, 0xa0, 0xcb, 0xbd, 0x29, 0x45, 0x81, 0x18, 0xb1, 0xae,
+    0x10, 0xa0, 0x60, 0x03, 0xaa, 0x01, 0xd9, 0x1b, 0x26, 0xa9, 0x20, 0xd8, 0x8c, 0x34, 0x90, 0x1a,
+    0x12, 0xac, 0x30, 0xb1, 0x8d, 0x20, 0x02, 0x08, 0xa8, 0x70, 0x93, 0x0c, 0xc0, 0xbc, 0x30, 0x36,
+    0x00, 0x81, 0xcb, 0x8a, 0x01, 0x0a, 0x33, 0x14, 0x18, 0xa8, 0xef, 0x8b, 0x62, 0x13, 0x80, 0xc9,
+    0xac, 0x18, 0x23, 0xa0, 0x72, 0xa1, 0x9c, 0x10, 0xb9, 0x71, 0x02, 0xab, 0x03, 0xbd, 0x48, 0x83,
+    0x8c, 0x33, 0xf8, 0x2a, 0x23, 0xb9, 0x18, 0xa1, 0xad, 0x52, 0x91, 0x08, 0x81, 0xaa, 0x48, 0x25,
+    0x98, 0xbb, 0xbd, 0x38, 0x34, 0x35, 0xa8, 0xdc, 0x9a, 0x22, 0x33, 0x00, 0xb8, 0xaf, 0x80, 0x42,
+    0x12, 0xb8, 0xbb, 0x98, 0x60, 0x36, 0xc8, 0x8a, 0xba, 0x39, 0x27, 0x90, 0x18, 0xc8, 0x8c, 0x12,
+    0x80, 0x51, 0x82, 0xca, 0x19, 0xca, 0x2a, 0x27, 0x00, 0x89, 0xd9, 0x9b, 0x51, 0x12, 0x00, 0x23,
+    0xfd, 0x24, 0x42, 0x00, 0xae, 0x99, 0x88, 0x30, 0x27, 0xb8, 0x09, 0x98, 0x1a, 0x26, 0x80, 0xaa,
+    0xcb, 0x89, 0x44, 0x83, 0x88, 0x00, 0xda, 0x9c, 0x31, 0x81, 0x41, 0x91, 0xab, 0x00, 0x0a, 0x77,
+    0x90, 0xa9, 0xad, 0x18, 0x32, 0x25, 0x92, 0xa9, 0xbd, 0x09, 0x10, 0x62, 0x13, 0xc8, 0x9b, 0xa0,
+    0x9c, 0x72, 0x03, 0x99, 0xa0, 0xbd, 0x28, 0x53, 0x01, 0x28, 0x92, 0xbe, 0x09, 0x90, 0x40, 0x05,
+    0xca, 0x18, 0x02, 0x18, 0xa4, 0xaf, 0x20, 0x11, 0x41, 0xa3, 0xbe, 0x88, 0x21, 0x21, 0x02, 0xdb,
+    0x1a, 0x98, 0x29, 0x15, 0xa8, 0x99, 0x8c, 0x57, 0x00, 0x98, 0xcc, 0x0a, 0x22, 0x33, 0x03, 0xca,
+    0xac, 0x18, 0x88, 0x73, 0x01, 0x8a, 0x80, 0xdd, 0x28, 0x34, 0xa0, 0x08, 0xf9, 0x8a, 0x43, 0x91,
+    0x1a, 0x14, 0xca, 0x18, 0xb0, 0x8d, 0x34, 0xa1, 0x0b, 0x91, 0x9c, 0x72, 0x03, 0xab, 0x10, 0xf9,
+    0x0a, 0x22, 0x80, 0x62, 0xa2, 0xac, 0x18, 0xa0, 0x59, 0x04, 0xb9, 0x38, 0xb1, 0x8e, 0x01, 0x9a,
+    0x42, 0x03, 0x18, 0x81, 0xbd, 0xaa, 0x38, 0x33, 0x46, 0x90, 0xaa, 0xbd, 0x09, 0x12, 0x32, 0x83,
+    0xac, 0x20, 0x57, 0xa8, 0xbb, 0xab, 0x50, 0x35, 0x81, 0xb9, 0xbd, 0x8b, 0x52, 0x44, 0x82, 0x9a,
+    0xcb, 0x8b, 0x21, 0x01, 0x0b, 0x26, 0x12, 0x08, 0xfb, 0xab, 0x19, 0x43, 0x63, 0x02, 0xbb, 0xcb,
+    0x8b, 0x28, 0x27, 0x81, 0x9a, 0x00, 0x21, 0x92, 0xbc, 0xba, 0xad, 0x72, 0x14, 0xa8, 0x09, 0xcb,
+    0x39, 0x34, 0x91, 0x18, 0xd8, 0x1a, 0x82, 0xac, 0x73, 0x93, 0x1a, 0xa1, 0xbf, 0x19, 0x13, 0x31,
+    0x26, 0xb8, 0xcc, 0x8a, 0x00, 0x44, 0x11, 0xa0, 0xcb, 0x8b, 0x31, 0x25, 0xa0, 0xa9, 0xca, 0x0a,
+    0x46, 0x82, 0x9a, 0x88, 0xba, 0x60, 0x13, 0x99, 0xa9, 0xad, 0x73, 0x93, 0xaa, 0x89, 0xbb, 0x50,
+    0x13, 0x03, 0x44, 0x00, 0x23, 0x02, 0xdb, 0xba, 0x8d, 0x10, 0x52, 0x13, 0xa8, 0xda, 0xab, 0x88,
+    0x73, 0x04, 0x90, 0x8a, 0x00, 0x91, 0xac, 0xaa, 0x48, 0x37, 0x80, 0xb8, 0xca, 0x8b, 0x31, 0x36,
+    0x02, 0x9a, 0xa9, 0xbb, 0xac, 0x10, 0x73, 0x25, 0x91, 0x99, 0xec, 0x9a, 0x31, 0x12, 0x53, 0x83,
+    0xcb, 0x9c, 0x88, 0x19, 0x34, 0x82, 0x8a, 0xaa, 0x40, 0x03, 0xbe, 0x19, 0x81, 0x38, 0x26, 0xc9,
+    0x9d, 0x31, 0x01, 0x34, 0xb0, 0xcd, 0x9a, 0x20, 0x43, 0x04, 0xc9, 0x2a, 0x02, 0x8a, 0x93, 0xdf,
+    0x18, 0x21, 0x32, 0x15, 0xda, 0x9b, 0x08, 0x18, 0x44, 0x92, 0x8b, 0xd8, 0x0a, 0x34, 0x82, 0xbc,
+    0x80, 0x19, 0x73, 0x82, 0xdb, 0x8a, 0x21, 0x24, 0x01, 0xbb, 0xbd, 0x19, 0x13, 0x42, 0x98, 0x41,
+    0x81, 0xc9, 0x89, 0xed, 0x19, 0x23, 0x02, 0x62, 0xb1, 0x9c, 0x0a, 0x91, 0x68, 0x04, 0xca, 0x09,
+    0x80, 0x41, 0x93, 0xac, 0x08, 0xa9, 0x70, 0x84, 0x89, 0xb9, 0x0c, 0x20, 0x23, 0x33, 0xf8, 0x9c,
+    0x01, 0x11, 0x33, 0xc0, 0x9d, 0x80, 0x00, 0x40, 0xa0, 0x09, 0x21, 0x90, 0x53, 0xfa, 0x28, 0x92,
+    0xbd, 0x48, 0x02, 0x32, 0xe8, 0x9c, 0x40, 0x93, 0x19, 0xa0, 0xaf, 0x21, 0x12, 0x21, 0xb1, 0xbe,
+    0x88, 0x23, 0x41, 0x13, 0xdc, 0x0a, 0x08, 0x32, 0xb0, 0xca, 0x8d, 0x31, 0x27, 0x80, 0xa9, 0xbd,
+    0x38, 0x24, 0x02, 0x9a, 0xfb, 0x1a, 0x22, 0x23, 0x80, 0xe9, 0x49, 0x83, 0x89, 0xc0, 0xbd, 0x20,
+    0x11, 0x63, 0x82, 0xdb, 0x89, 0x10, 0x38, 0x16, 0xc8, 0x9a, 0x00, 0x88, 0x73, 0xb8, 0x8b, 0x12,
+    0x01, 0x32, 0xb0, 0xcf, 0x29, 0x14, 0x08, 0x08, 0xb1, 0xaf, 0x43, 0xa1, 0x19, 0xa0, 0x0c, 0x44,
+    0x81, 0xa9, 0xbb, 0x0c, 0x42, 0x34, 0x02, 0xcb, 0x9c, 0x10, 0x99, 0x41, 0x12, 0x88, 0x03, 0xcf,
+    0x44, 0xe6, 0x45, 0x00, 0x18, 0x01, 0x31, 0x03, 0x8b, 0x36, 0xd9, 0xcb, 0x9b, 0x30, 0x65, 0x82,
+    0x99, 0xca, 0x0a, 0x31, 0x13, 0x02, 0xe9, 0x3a, 0x06, 0x99, 0x98, 0xeb, 0x18, 0x22, 0x23, 0xb0,
+    0xeb, 0x3a, 0x23, 0x20, 0xd0, 0xbc, 0x30, 0x14, 0x28, 0xb1, 0xaf, 0x58, 0x83, 0x09, 0xc8, 0x9c,
+    0x30, 0x14, 0x10, 0x81, 0xbc, 0x18, 0xa1, 0x1c, 0x11, 0x98, 0x66, 0x90, 0x9b, 0x8a, 0x99, 0x78,
+    0x03, 0xab, 0x31, 0x83, 0x8a, 0xed, 0x19, 0x00, 0x61, 0x03, 0xaa, 0xaa, 0xcb, 0x48, 0x53, 0x03,
+    0xb9, 0xba, 0x9c, 0x00, 0x43, 0x23, 0x91, 0xaa, 0x1b, 0x37, 0xf8, 0xac, 0x08, 0x32, 0x54, 0x82,
+    0xda, 0x9a, 0x89, 0x30, 0x45, 0xa1, 0x8a, 0xb8, 0x8c, 0x28, 0x25, 0x88, 0x12, 0x9a, 0xb9, 0x08,
+    0xbc, 0x74, 0x81, 0x09, 0x80, 0xdb, 0x1a, 0x34, 0x98, 0x20, 0x81, 0x21, 0xbc, 0xec, 0x8c, 0x42,
+    0x01, 0x33, 0x91, 0xce, 0x08, 0x98, 0x18, 0x54, 0x02, 0xba, 0xbb, 0x89, 0x41, 0x53, 0x91, 0xba,
+    0xbb, 0x28, 0x57, 0x91, 0xba, 0xaa, 0x20, 0x62, 0x14, 0xba, 0xcb, 0x2a, 0x32, 0x36, 0xc1, 0xab,
+    0xba, 0x19, 0x45, 0x14, 0xb0, 0x8b, 0x9a, 0x08, 0x12, 0x10, 0x35, 0x91, 0x98, 0xfa, 0xcb, 0x29,
+    0x27, 0x90, 0xaa, 0x89, 0x44, 0x01, 0xb0, 0xbd, 0x09, 0x41, 0x25, 0x98, 0xab, 0x98, 0x09, 0x42,
+    0x12, 0x11, 0xb8, 0xad, 0xcb, 0x09, 0x52, 0x44, 0x02, 0xc8, 0xdc, 0x19, 0x34, 0x91, 0x9a, 0xe9,
+    0x0a, 0x63, 0x82, 0x99, 0xaa, 0x0a, 0x35, 0x03, 0xa8, 0xfb, 0x8a, 0x31, 0x34, 0x91, 0xbb, 0xad,
+    0x08, 0x54, 0x83, 0xaa, 0x9a, 0x10, 0x29, 0x06, 0xd9, 0x09, 0x21, 0x88, 0x02, 0xbc, 0x41, 0x02,
+    0xdb, 0x98, 0x9a, 0x74, 0x02, 0x98, 0xb9, 0x8b, 0x62, 0x92, 0x38, 0xe8, 0x9d, 0x20, 0x22, 0x21,
+    0x7b, 0x2a, 0x43, 0x00, 0xd8, 0x9c, 0x80, 0x88, 0x44, 0xa1, 0x0a, 0x02, 0xab, 0x18, 0xeb, 0x29,
+    0x26, 0x88, 0x88, 0x08, 0x91, 0x1a, 0xfa, 0x2a, 0x99, 0x37, 0x82, 0x98, 0xca, 0xac, 0x38, 0x54,
+    0x13, 0xaa, 0xcb, 0x9b, 0x32, 0x34, 0x02, 0xae, 0x88, 0x19, 0x37, 0xb8, 0xac, 0x99, 0x31, 0x63,
+    0x83, 0xab, 0xba, 0xab, 0x51, 0x26, 0x98, 0x98, 0xbc, 0x18, 0x42, 0x33, 0x88, 0xb8, 0xaf, 0x89,
+    0x01, 0x73, 0x04, 0xaa, 0xab, 0x29, 0x20, 0x45, 0xa8, 0xb9, 0x9b, 0x33, 0x47, 0xa0, 0xbb, 0x9b,
+    0x20, 0x61, 0x02, 0x18, 0xa8, 0xb9, 0x9d, 0x28, 0x46, 0x83, 0xba, 0xdc, 0x9a, 0x42, 0x42, 0x12,
+    0xd9, 0xaa, 0x08, 0x31, 0x35, 0xb9, 0x9d, 0x18, 0x10, 0x42, 0xb1, 0x9b, 0xdb, 0x48, 0x26, 0xa0,
+    0x9a, 0xbb, 0x09, 0x73, 0x13, 0x99, 0xb8, 0xad, 0x00, 0x12, 0x73, 0x23, 0xb9, 0xeb, 0x8b, 0x00,
+    0x43, 0x03, 0x88, 0xfb, 0x18, 0x12, 0x98, 0xa9, 0x8a, 0x52, 0x14, 0x90, 0xa9, 0xbd, 0x28, 0x35,
+    0x81, 0xab, 0x88, 0xdb, 0x09, 0x35, 0x99, 0x41, 0x14, 0xb0, 0xbd, 0xac, 0x73, 0x02, 0x98, 0x88,
+    0xda, 0x29, 0x05, 0x98, 0x00, 0x18, 0x11, 0x92, 0xbf, 0x8a, 0x10, 0x64, 0x03, 0xb9, 0xbb, 0xba,
+    0x70, 0x03, 0x9a, 0x30, 0x14, 0x99, 0xa9, 0xaf, 0x09, 0x52, 0x23, 0xa1, 0xbd, 0x0a, 0x33, 0x08,
+    0x01, 0xf9, 0x0a, 0x22, 0x10, 0xb1, 0x9b, 0x73, 0x83, 0xaa, 0xd8, 0x9d, 0x10, 0x21, 0x42, 0x15,
+    0x99, 0xa9, 0xbc, 0x9b, 0x30, 0x57, 0x92, 0x0a, 0xca, 0x89, 0x38, 0x15, 0x90, 0x0a, 0x23, 0xea,
+    0x10, 0xbd, 0x38, 0x33, 0x82, 0x81, 0xcd, 0x29, 0x13, 0xb8, 0x48, 0x15, 0x9a, 0xb0, 0xdf, 0x18,
+    0x33, 0x12, 0x81, 0xfb, 0x1a, 0x13, 0xc9, 0x18, 0x00, 0x20, 0x23, 0xa0, 0xaf, 0x9a, 0x18, 0x74,
+    0x36, 0x21, 0x48, 0x00, 0x98, 0x8a, 0xba, 0x8b, 0x36, 0x02, 0x18, 0xb8, 0x0d, 0x82, 0xab, 0x28,
+    0x17, 0xa8, 0x01, 0xa8, 0xbc, 0x39, 0x25, 0xa0, 0x19, 0x47, 0x90, 0xaa, 0xbd, 0x0a, 0x63, 0x12,
+    0x01, 0xeb, 0x8a, 0x21, 0x80, 0x63, 0x82, 0x9c, 0x98, 0xbc, 0x20, 0x36, 0xa8, 0x10, 0xb0, 0x0c,
+    0x35, 0xc9, 0x8a, 0x80, 0x31, 0x12, 0x82, 0xbd, 0x8a, 0x9c, 0x74, 0x82, 0x88, 0xa8, 0xad, 0x19,
+    0x34, 0x41, 0xb1, 0xbb, 0xac, 0x20, 0x54, 0x03, 0xbb, 0xbc, 0x1b, 0x54, 0x13, 0x99, 0xac, 0x09,
+    0x42, 0x03, 0xa9, 0xad, 0x89, 0x60, 0x03, 0x89, 0xb9, 0x9c, 0x31, 0x14, 0x39, 0x16, 0xca, 0x89,
+    0xbc, 0x19, 0x45, 0x01, 0x80, 0xbb, 0x0b, 0x57, 0xb0, 0xaa, 0x09, 0x18, 0x36, 0x02, 0xda, 0x9a,
+    0x89, 0x32, 0x25, 0xa8, 0xba, 0x8c, 0x20, 0x26, 0x00, 0xb9, 0x8d, 0x01, 0x11, 0x51, 0x83, 0xbe,
+    0x9a, 0x28, 0x33, 0x14, 0xa1, 0xcd, 0x8b, 0x43, 0x22, 0x92, 0xbd, 0x9c, 0x52, 0x02, 0x00, 0xc9,
+    0x9c, 0x30, 0x82, 0x48, 0x26, 0xba, 0x9a, 0xcb, 0x38, 0x27, 0xa0, 0x88, 0xbb, 0x38, 0x45, 0x91,
+    0xac, 0x99, 0x28, 0x63, 0x02, 0xaa, 0xcb, 0x8a, 0x61, 0x14, 0x98, 0xba, 0x8b, 0x41, 0x24, 0x81,
+    0xb9, 0xac, 0xaa, 0x71, 0x33, 0x91, 0xc9, 0xae, 0x18, 0x22, 0x32, 0x82, 0xdd, 0x8a, 0x51, 0x82,
+    0x90, 0xba, 0x8b, 0x52, 0x14, 0x80, 0xba, 0xac, 0x10, 0x02, 0x64, 0x12, 0xbb, 0xbb, 0x9c, 0x42,
+    0x22, 0x11, 0xc8, 0xcb, 0x41, 0x02, 0xa0, 0x9f, 0x88, 0x52, 0x01, 0x01, 0xba, 0xbc, 0x2a, 0x37,
+    0x82, 0x99, 0xcd, 0x89, 0x40, 0x13, 0x32, 0xc9, 0xba, 0x8b, 0x14, 0x28, 0x85, 0xbc, 0x09, 0x40,
+    0x12, 0x24, 0xdb, 0xab, 0x99, 0x71, 0x16, 0xa8, 0xa9, 0xab, 0x30, 0x25, 0x02, 0xa8, 0xcb, 0x8b,
+    0x01, 0xee, 0x42, 0x00, 0x01, 0x45, 0x90, 0x9b, 0x89, 0x99, 0x48, 0x05, 0xa8, 0x0b, 0x13, 0x23,
+    0x83, 0xef, 0x9b, 0x0a, 0x73, 0x24, 0x90, 0xb9, 0xad, 0x08, 0x53, 0x12, 0x98, 0xcb, 0xab, 0x40,
+    0x24, 0x81, 0x90, 0xdb, 0x29, 0x06, 0x09, 0xb0, 0xac, 0x10, 0x33, 0x33, 0x81, 0xfc, 0xab, 0x40,
+    0x24, 0x81, 0xa0, 0xaf, 0x09, 0x31, 0x13, 0x00, 0xc8, 0x9b, 0x10, 0x21, 0x21, 0x83, 0xbd, 0xab,
+    0x22, 0x0a, 0x47, 0xb8, 0xbc, 0x38, 0x37, 0x01, 0x91, 0xdf, 0x0a, 0x21, 0x31, 0x23, 0xda, 0xab,
+    0x08, 0x10, 0x46, 0xa1, 0x9a, 0xa8, 0x9c, 0x42, 0x03, 0x89, 0x80, 0xbd, 0x38, 0x37, 0xa0, 0xa8,
+    0xcd, 0x08, 0x42, 0x13, 0x00, 0xda, 0xab, 0x28, 0x35, 0x01, 0xa8, 0xbd, 0x0a, 0x43, 0x12, 0x21,
+    0xda, 0xac, 0x28, 0x33, 0x04, 0x98, 0xfb, 0x0c, 0x32, 0x82, 0x10, 0xd9, 0x8c, 0x30, 0x23, 0x20,
+    0xd1, 0xbf, 0x28, 0x13, 0x01, 0x12, 0xbd, 0xaa, 0x20, 0x44, 0x14, 0xa9, 0xcb, 0xab, 0x41, 0x24,
+    0x88, 0x99, 0xdb, 0x19, 0x44, 0x14, 0x89, 0xeb, 0x9a, 0x21, 0x33, 0x11, 0xd9, 0x9c, 0x08, 0x41,
+    0x34, 0xa0, 0xba, 0xad, 0x08, 0x44, 0x88, 0x01, 0xb9, 0xaa, 0x22, 0x32, 0x15, 0xda, 0xaa, 0x38,
+    0x05, 0x01, 0xb9, 0xcd, 0x99, 0x72, 0x13, 0x00, 0xc8, 0xad, 0x08, 0x33, 0x21, 0x03, 0xdc, 0xaa,
+    0x08, 0x42, 0x25, 0xa0, 0xcb, 0x98, 0x1a, 0x35, 0x82, 0xaa, 0xbc, 0x1a, 0x74, 0x02, 0x89, 0xeb,
+    0x09, 0x31, 0x04, 0x80, 0xc9, 0xac, 0x10, 0x42, 0x15, 0x98, 0xb9, 0xab, 0x1a, 0x35, 0x28, 0x03,
+    0xcb, 0xbc, 0x20, 0x22, 0x54, 0xa1, 0x9d, 0x08, 0x90, 0x2a, 0x85, 0xac, 0x20, 0x11, 0x44, 0x82,
+    0xdb, 0xac, 0x0a, 0x43, 0x03, 0x33, 0xea, 0xab, 0x99, 0x52, 0x25, 0xa8, 0x99, 0xb9, 0x8b, 0x54,
+    0xaa, 0x0d, 0x44, 0x00, 0x90, 0x88, 0xc9, 0x1a, 0x55, 0xa2, 0x9b, 0xc9, 0x1a, 0x54, 0x82, 0x89,
+    0xb9, 0xac, 0x20, 0x52, 0x24, 0xa8, 0xb0, 0xcd, 0x28, 0x22, 0x00, 0x91, 0xbb, 0x8b, 0x44, 0x23,
+    0xa1, 0x9c, 0xbc, 0x30, 0x02, 0x0a, 0xb2, 0x0e, 0x82, 0x79, 0x06, 0x89, 0xb0, 0xbc, 0x1a, 0x36,
+    0x00, 0x01, 0xeb, 0x0a, 0x10, 0x62, 0x82, 0x99, 0xb9, 0x9c, 0x29, 0x17, 0x80, 0x90, 0xab, 0x00,
+    0x74, 0xa1, 0x8a, 0xd9, 0x09, 0x62, 0x82, 0x88, 0xa9, 0xab, 0x30, 0x22, 0x27, 0xb9, 0x80, 0xbc,
+    0x19, 0x26, 0x98, 0x10, 0xba, 0x8a, 0x32, 0x36, 0x81, 0xb8, 0xbf, 0x08, 0x23, 0x18, 0x94, 0x9e,
+    0x88, 0x31, 0x16, 0x90, 0xa9, 0xbd, 0x09, 0x53, 0x82, 0x21, 0xd9, 0x9a, 0x88, 0x32, 0x43, 0x81,
+    0xaa, 0xcd, 0x0b, 0x34, 0x01, 0x91, 0x9a, 0xbf, 0x52, 0x23, 0x91, 0xbb, 0xcf, 0x20, 0x13, 0x21,
+    0xb1, 0xbd, 0x80, 0x09, 0x73, 0x85, 0x8a, 0xb0, 0x9c, 0x20, 0x05, 0x08, 0x91, 0xbb, 0x8b, 0x56,
+    0x01, 0x08, 0xd9, 0x8c, 0x20, 0x04, 0x28, 0xb0, 0x9d, 0x08, 0x42, 0x02, 0x88, 0xda, 0x8b, 0x18,
+    0x45, 0x88, 0x01, 0xac, 0x99, 0x39, 0x05, 0x21, 0xa0, 0xae, 0x00, 0x32, 0x80, 0x14, 0xce, 0x19,
+    0x00, 0x53, 0x81, 0xa8, 0x9f, 0x80, 0x20, 0x11, 0x12, 0xba, 0x09, 0xcb, 0x51, 0x04, 0x89, 0xb8,
+    0x9d, 0x28, 0x24, 0x21, 0xc0, 0xbb, 0xac, 0x74, 0x92, 0x00, 0xb8, 0xac, 0x39, 0x15, 0x28, 0x82,
+    0xeb, 0x8a, 0x20, 0x24, 0x30, 0xd0, 0xad, 0x0a, 0x43, 0x01, 0x22, 0xf9, 0x8b, 0x20, 0x12, 0x10,
+    0xa2, 0xbf, 0x19, 0x33, 0x00, 0x22, 0xfb, 0x8b, 0x91, 0x60, 0x23, 0x90, 0xcb, 0xcb, 0x19, 0x34,
+    0x31, 0x93, 0xad, 0xaa, 0x19, 0x36, 0x02, 0xa9, 0xcc, 0x08, 0x12, 0x12, 0xe8, 0x8b, 0x11, 0x18,
+    0xd8, 0x08, 0x3a, 0x00, 0x37, 0x9c, 0xb8, 0x9e, 0x10, 0x24, 0x80, 0x82, 0xbd, 0x09, 0x20, 0x25,
+    0x00, 0xb8, 0xae, 0x09, 0x41, 0x12, 0x11, 0xca, 0xba, 0x1a, 0x44, 0x02, 0x88, 0xfb, 0x09, 0x30,
+    0x05, 0x18, 0xda, 0xa9, 0x19, 0x37, 0xa0, 0x22, 0xcd, 0x8a, 0x31, 0x82, 0x52, 0xc0, 0x9a, 0x88,
+    0x30, 0x04, 0x29, 0xf0, 0x8b, 0x20, 0x03, 0x19, 0xc3, 0xae, 0x00, 0x50, 0x14, 0x1a, 0xc0, 0x9d,
+    0x28, 0x12, 0x59, 0x92, 0xac, 0x1a, 0x81, 0x50, 0x84, 0xab, 0x98, 0x09, 0x53, 0x81, 0x9a, 0xba,
+    0x10, 0x21, 0x00, 0x56, 0xa0, 0x0a, 0xcb, 0x08, 0x21, 0x13, 0xba, 0x11, 0xfc, 0x59, 0x25, 0xa9,
+    0x00, 0xcd, 0x19, 0x34, 0x99, 0x12, 0xba, 0xa9, 0x59, 0x14, 0x98, 0x21, 0xec, 0x89, 0x32, 0x92,
+    0x19, 0xb8, 0xac, 0x0b, 0x57, 0x80, 0x10, 0xdb, 0x0b, 0x44, 0xa0, 0x18, 0xb8, 0x0d, 0x22, 0x08,
+    0x34, 0xc8, 0x0a, 0xb9, 0x1a, 0x34, 0x01, 0x90, 0x8b, 0xa0, 0x0c, 0x62, 0x14, 0x0b, 0xb3, 0x8f,
+    0x80, 0x08, 0xb9, 0x99, 0x55, 0xa0, 0x72, 0xa2, 0x0b, 0xe8, 0x8a, 0x40, 0x94, 0x39, 0xa2, 0xab,
+    0x9a, 0x44, 0x00, 0x13, 0xea, 0x8c, 0x19, 0x13, 0x41, 0xb0, 0x9c, 0xa8, 0x39, 0x57, 0x98, 0x98,
+    0xcb, 0x28, 0x35, 0x98, 0x91, 0xbc, 0x18, 0x20, 0x53, 0x83, 0xac, 0xa9, 0x8b, 0x63, 0x82, 0x90,
+    0x9a, 0x80, 0xae, 0x70, 0x03, 0x8b, 0x83, 0xae, 0x20, 0x82, 0x0a, 0x02, 0x90, 0xd9, 0x6a, 0x84,
+    0x0b, 0x83, 0xae, 0x08, 0x26, 0xaa, 0x13, 0xba, 0xaa, 0x70, 0x83, 0x1a, 0xa3, 0xbe, 0x29, 0x24,
+    0x99, 0x33, 0xea, 0x0a, 0x00, 0x51, 0x01, 0x88, 0xbd, 0x89, 0x71, 0x82, 0x29, 0xc8, 0x8a, 0x89,
+    0x61, 0x02, 0x89, 0xa9, 0x8c, 0x31, 0x04, 0x10, 0xd9, 0x9a, 0xa9, 0x78, 0x15, 0x89, 0x91, 0xac,
+    0x16, 0xea, 0x43, 0x00, 0x41, 0x91, 0x28, 0xc1, 0x8b, 0x18, 0x46, 0xb0, 0x10, 0xdc, 0x0a, 0x50,
+    0x82, 0x10, 0xa0, 0xac, 0x08, 0x52, 0x81, 0x10, 0xcd, 0x09, 0x30, 0x03, 0x29, 0x91, 0xad, 0x99,
+    0x41, 0x15, 0x88, 0xc8, 0xad, 0x21, 0x34, 0x90, 0x80, 0xdc, 0x8a, 0x31, 0x45, 0x90, 0xa8, 0xbc,
+    0x89, 0x54, 0x81, 0x81, 0xd9, 0x8a, 0x20, 0x44, 0xa0, 0x00, 0xbe, 0x08, 0x31, 0x04, 0x80, 0xb9,
+    0xac, 0x20, 0x36, 0xa1, 0x98, 0xbf, 0x08, 0x52, 0x03, 0x08, 0xc9, 0xab, 0x28, 0x34, 0x04, 0xa9,
+    0xfa, 0x89, 0x31, 0x04, 0x00, 0xb8, 0xbc, 0x0a, 0x54, 0x12, 0x88, 0xc9, 0x8d, 0x31, 0x82, 0x18,
+    0xd1, 0xab, 0x00, 0x44, 0x13, 0x98, 0xfb, 0x8c, 0x10, 0x33, 0x20, 0x92, 0xaf, 0x8a, 0x31, 0x23,
+    0x82, 0xe9, 0xad, 0x00, 0x42, 0x12, 0x01, 0xdb, 0x9b, 0x29, 0x45, 0x01, 0xa9, 0xdc, 0x09, 0x42,
+    0x82, 0x21, 0xca, 0x9b, 0x19, 0x23, 0x37, 0xb8, 0xbb, 0x8d, 0x31, 0x33, 0x02, 0xea, 0xab, 0x0a,
+    0x74, 0x02, 0x89, 0xb9, 0x9e, 0x21, 0x15, 0x89, 0x91, 0xbc, 0x08, 0x53, 0x03, 0x0a, 0xd9, 0x8c,
+    0x10, 0x43, 0x80, 0x81, 0xdb, 0x8a, 0x52, 0x82, 0x09, 0xd8, 0x9c, 0x22, 0x43, 0x80, 0x01, 0xcd,
+    0x0a, 0x18, 0x33, 0x23, 0xb9, 0xce, 0x0a, 0x42, 0x12, 0x21, 0xc9, 0xcb, 0x0b, 0x42, 0x34, 0x88,
+    0xc8, 0x9d, 0x11, 0x02, 0x10, 0xa0, 0xbd, 0x29, 0x45, 0x02, 0x09, 0xfa, 0x9b, 0x28, 0x34, 0x10,
+    0x92, 0xbd, 0xaa, 0x72, 0x03, 0x89, 0xc0, 0x9d, 0x28, 0x43, 0x00, 0x80, 0xca, 0x9b, 0x41, 0x24,
+    0x99, 0x98, 0xaf, 0x18, 0x43, 0x81, 0x12, 0xcc, 0x8a, 0x29, 0x53, 0x04, 0x9a, 0xea, 0x0a, 0x22,
+    0x02, 0x21, 0xd8, 0xab, 0x09, 0x62, 0x04, 0x88, 0xc9, 0x9b, 0x20, 0x24, 0x29, 0xa2, 0xbd, 0x89,
+    0xdc, 0xf9, 0x3e, 0x00, 0x15, 0x00, 0xa1, 0xbf, 0x09, 0x51, 0x00, 0x12, 0xc8, 0xab, 0x28, 0x27,
+    0x90, 0x88, 0xec, 0x19, 0x31, 0x03, 0x10, 0xb9, 0xae, 0x19, 0x43, 0x12, 0x98, 0xf9, 0x9b, 0x22,
+    0x22, 0x31, 0xc0, 0xcb, 0x8a, 0x31, 0x37, 0x98, 0xa8, 0xaf, 0x10, 0x32, 0x18, 0x82, 0xbd, 0x8a,
+    0x42, 0x34, 0xa8, 0xb8, 0xbf, 0x10, 0x42, 0x01, 0x21, 0xfb, 0x8a, 0x10, 0x34, 0x80, 0xa9, 0xcc,
+    0x0a, 0x62, 0x02, 0x10, 0xb9, 0xad, 0x29, 0x34, 0x02, 0x99, 0xfb, 0x0b, 0x32, 0x04, 0x11, 0xc9,
+    0xac, 0x19, 0x42, 0x24, 0x98, 0xca, 0x9c, 0x20, 0x23, 0x21, 0xa1, 0xdd, 0x0b, 0x42, 0x15, 0x89,
+    0xc0, 0x9d, 0x18, 0x33, 0x10, 0x83, 0xdc, 0x9b, 0x41, 0x24, 0x90, 0xb8, 0xad, 0x0a, 0x52, 0x23,
+    0x81, 0xca, 0xad, 0x18, 0x53, 0x83, 0xa8, 0xdb, 0x8a, 0x31, 0x33, 0x34, 0xea, 0x9c, 0x08, 0x20,
+    0x45, 0xa0, 0x9a, 0xba, 0x19, 0x34, 0x33, 0xc0, 0xbd, 0x0a, 0x21, 0x55, 0x92, 0x9a, 0xdb, 0x09,
+    0x22, 0x23, 0x10, 0xeb, 0x9c, 0x21, 0x44, 0x90, 0x80, 0xdc, 0x89, 0x30, 0x04, 0x21, 0xb8, 0xbd,
+    0x29, 0x53, 0x01, 0x80, 0xea, 0x8b, 0x28, 0x25, 0x02, 0xb9, 0xbd, 0x18, 0x31, 0x36, 0xa1, 0xab,
+    0xcc, 0x09, 0x43, 0x14, 0x98, 0xba, 0x0b, 0x98, 0x70, 0x15, 0x8a, 0x91, 0xac, 0x18, 0x14, 0x98,
+    0x0a, 0xb0, 0x1a, 0x73, 0x07, 0x8a, 0xa0, 0xbc, 0x28, 0x24, 0x10, 0x02, 0xcc, 0x0a, 0x21, 0x24,
+    0x80, 0xc0, 0xae, 0x99, 0x53, 0x82, 0x10, 0xc1, 0x8d, 0x08, 0x31, 0x03, 0x00, 0xeb, 0xbb, 0x51,
+    0x83, 0x11, 0xa8, 0xac, 0x18, 0x98, 0x66, 0xa1, 0x09, 0xc9, 0x8a, 0x43, 0x01, 0x88, 0x81, 0xce,
+    0x18, 0x25, 0x88, 0x21, 0xec, 0x8a, 0x22, 0x00, 0x42, 0xa0, 0xac, 0x09, 0x42, 0x10, 0x21, 0xfb,
+    0x9e, 0xe9, 0x46, 0x00, 0x0a, 0x32, 0x20, 0x24, 0xb0, 0xaf, 0x10, 0x80, 0x33, 0x00, 0xfa, 0x8c,
+    0x21, 0x00, 0x24, 0xa8, 0xba, 0xaa, 0xaa, 0x76, 0x02, 0x08, 0xda, 0x0a, 0x11, 0x20, 0x02, 0x98,
+    0xcd, 0x29, 0x43, 0x11, 0x02, 0xdf, 0x0a, 0x21, 0x10, 0x33, 0xb9, 0xeb, 0x19, 0x23, 0x11, 0x12,
+    0xfc, 0x9c, 0x20, 0x02, 0x43, 0x81, 0xbc, 0x8a, 0x01, 0x42, 0x11, 0xc0, 0xbf, 0x11, 0x12, 0x31,
+    0x93, 0xcc, 0x8b, 0x80, 0x78, 0x23, 0x88, 0xcc, 0x89, 0x10, 0x40, 0x83, 0x89, 0xc9, 0x9a, 0x39,
+    0x27, 0x10, 0xc1, 0xad, 0x18, 0x80, 0x52, 0x02, 0xb9, 0x8d, 0x20, 0x01, 0x51, 0xc0, 0x9e, 0x18,
+    0x82, 0x31, 0x14, 0xda, 0x8b, 0x01, 0x20, 0x53, 0xc1, 0xad, 0x10, 0x00, 0x31, 0x02, 0xca, 0x8b,
+    0x89, 0x44, 0x12, 0x91, 0xce, 0x89, 0x21, 0x40, 0x85, 0x89, 0xaa, 0x9b, 0x34, 0x11, 0x13, 0xea,
+    0xac, 0x31, 0x88, 0x53, 0x98, 0xc9, 0x0a, 0x51, 0x13, 0x01, 0xdd, 0xba, 0x38, 0x04, 0x41, 0xa2,
+    0xba, 0x9c, 0x40, 0x24, 0x08, 0xd0, 0x9e, 0x18, 0x03, 0x48, 0x92, 0xaa, 0x0a, 0x00, 0x63, 0x91,
+    0xba, 0xac, 0x30, 0x34, 0x10, 0xd1, 0x9d, 0x88, 0x08, 0x55, 0x92, 0x8a, 0xa8, 0x9c, 0x41, 0x92,
+    0x10, 0x99, 0xca, 0x2a, 0x37, 0x83, 0x98, 0xdd, 0x8a, 0x40, 0x12, 0x11, 0xaa, 0xcb, 0x19, 0x63,
+    0x04, 0x9a, 0xc9, 0x9b, 0x30, 0x17, 0x00, 0xa8, 0xb9, 0x1a, 0x43, 0x33, 0xd8, 0xa9, 0x9f, 0x28,
+    0x34, 0x81, 0xa0, 0xbc, 0x8a, 0x00, 0x75, 0xa1, 0x18, 0xbb, 0x0a, 0x44, 0x90, 0x01, 0xda, 0x8a,
+    0x20, 0x45, 0x82, 0x99, 0xdc, 0x8a, 0x23, 0x12, 0x12, 0xda, 0xaa, 0x38, 0x44, 0x02, 0xba, 0xcd,
+    0x8a, 0x42, 0x23, 0x11, 0xb9, 0xae, 0x19, 0x23, 0x33, 0xd0, 0xbc, 0x8a, 0x42, 0x25, 0x11, 0xc9,
+    0x5f, 0xff, 0x42, 0x00, 0xac, 0x18, 0x51, 0x15, 0x88, 0xba, 0x9b, 0x30, 0x24, 0x31, 0xfa, 0xaa,
+    0x09, 0x63, 0x13, 0x88, 0xeb, 0xab, 0x21, 0x15, 0x22, 0xc8, 0xab, 0x1b, 0x42, 0x24, 0x89, 0xda,
+    0x9c, 0x11, 0x24, 0x10, 0x91, 0xdb, 0x0a, 0x21, 0x23, 0xa8, 0xd9, 0x9d, 0x21, 0x15, 0x20, 0xa3,
+    0xbe, 0xab, 0x51, 0x23, 0x01, 0xb0, 0xbf, 0x19, 0x33, 0x20, 0x04, 0xcd, 0x9b, 0x42, 0x12, 0x22,
+    0xc8, 0xaf, 0x19, 0x12, 0x42, 0x82, 0xda, 0xaa, 0x20, 0x24, 0x01, 0xb9, 0xbe, 0x19, 0x34, 0x22,
+    0x93, 0xeb, 0xbb, 0x31, 0x33, 0x02, 0xd9, 0xaf, 0x00, 0x42, 0x12, 0x82, 0xda, 0xbb, 0x19, 0x52,
+    0x23, 0x00, 0xec, 0x8a, 0x40, 0x01, 0x20, 0xc8, 0xac, 0x28, 0x34, 0x13, 0x98, 0xdd, 0x9b, 0x32,
+    0x33, 0x13, 0xb9, 0xcf, 0x19, 0x43, 0x01, 0x98, 0xeb, 0x8b, 0x32, 0x33, 0x13, 0xa9, 0xde, 0x29,
+    0x22, 0x80, 0x80, 0xcd, 0x0a, 0x52, 0x22, 0x01, 0xa9, 0xbe, 0x0a, 0x32, 0x33, 0x23, 0xe9, 0xad,
+    0x28, 0x02, 0x32, 0xa1, 0xce, 0x19, 0x22, 0x22, 0x82, 0xcd, 0x9d, 0x20, 0x23, 0x33, 0xb9, 0xcf,
+    0x08, 0x32, 0x22, 0x98, 0xcd, 0x8b, 0x21, 0x44, 0x12, 0xa8, 0xad, 0x09, 0x40, 0x12, 0x98, 0xbd,
+    0x0b, 0x42, 0x34, 0x03, 0xda, 0xcb, 0x0a, 0x43, 0x33, 0x80, 0xec, 0x9a, 0x20, 0x32, 0x24, 0xb9,
+    0xcc, 0x1a, 0x32, 0x34, 0xa1, 0xcd, 0x8c, 0x20, 0x33, 0x23, 0xd9, 0xbc, 0x29, 0x34, 0x21, 0xb1,
+    0xbf, 0x8b, 0x31, 0x63, 0x02, 0xa8, 0xad, 0x08, 0x32, 0x22, 0xb0, 0xbf, 0x8a, 0x22, 0x35, 0x03,
+    0xb9, 0xbe, 0x1a, 0x23, 0x43, 0x92, 0xdd, 0x8b, 0x31, 0x32, 0x15, 0xc8, 0xac, 0x08, 0x21, 0x44,
+    0x91, 0xdb, 0x9b, 0x10, 0x53, 0x13, 0xb9, 0xbc, 0x09, 0x43, 0x34, 0xb8, 0xbd, 0x9c, 0x21, 0x53,
+    0x68, 0x2b, 0x49, 0x00, 0x80, 0xbb, 0x9c, 0x11, 0x24, 0x92, 0xcc, 0xab, 0x20, 0x63, 0x43, 0xa0,
+    0xcb, 0xaa, 0x28, 0x44, 0x02, 0xb9, 0xbc, 0x89, 0x53, 0x34, 0x90, 0xdb, 0xab, 0x18, 0x55, 0x02,
+    0xa9, 0xcb, 0x9a, 0x31, 0x35, 0x03, 0xbb, 0xbd, 0x1a, 0x54, 0x02, 0xa8, 0xcb, 0x9b, 0x32, 0x45,
+    0x01, 0xb9, 0xac, 0x29, 0x24, 0x21, 0xca, 0xbc, 0x09, 0x43, 0x35, 0x80, 0xca, 0xbb, 0x18, 0x33,
+    0x25, 0xb9, 0xbd, 0x09, 0x52, 0x24, 0x81, 0xca, 0xbc, 0x19, 0x24, 0x33, 0xb0, 0xcc, 0x8b, 0x32,
+    0x52, 0x83, 0xca, 0xbc, 0x20, 0x41, 0x24, 0xb8, 0xbc, 0x8b, 0x11, 0x46, 0x80, 0xa8, 0x9b, 0x20,
+    0x41, 0x84, 0xac, 0xbb, 0x39, 0x53, 0x14, 0x80, 0xcc, 0x09, 0x23, 0x12, 0xa9, 0xbf, 0x0b, 0x32,
+    0x25, 0x23, 0xb0, 0xaf, 0x18, 0x81, 0x20, 0x90, 0xbd, 0x29, 0x32, 0x42, 0x15, 0xca, 0xab, 0x99,
+    0x28, 0x57, 0x80, 0xaa, 0xba, 0x18, 0x52, 0x23, 0xa8, 0xdb, 0x9b, 0x51, 0x16, 0x98, 0xa9, 0xad,
+    0x11, 0x23, 0x14, 0xa9, 0xbc, 0x29, 0x53, 0x12, 0xa8, 0xcd, 0x9a, 0x32, 0x53, 0x83, 0xc9, 0xac,
+    0x20, 0x33, 0x01, 0xc8, 0xaf, 0x09, 0x31, 0x34, 0x03, 0xc9, 0xae, 0x10, 0x01, 0x41, 0xa0, 0xbc,
+    0x09, 0x21, 0x54, 0x13, 0xca, 0xac, 0x0a, 0x32, 0x35, 0xb0, 0xad, 0xaa, 0x31, 0x54, 0x83, 0xba,
+    0xbd, 0x18, 0x43, 0x23, 0xb9, 0xdc, 0x0a, 0x22, 0x43, 0x93, 0xdb, 0x9c, 0x21, 0x32, 0x04, 0xb9,
+    0xbe, 0x1a, 0x22, 0x73, 0x01, 0xa9, 0xab, 0x1a, 0x42, 0x13, 0xb0, 0xaf, 0x8a, 0x21, 0x44, 0x04,
+    0xa9, 0xac, 0x18, 0x21, 0x23, 0xc8, 0xbe, 0x09, 0x21, 0x54, 0x02, 0xc9, 0x9a, 0x80, 0x31, 0x02,
+    0xea, 0x9c, 0x00, 0x32, 0x25, 0x80, 0xbc, 0x19, 0x23, 0x11, 0xd9, 0xcc, 0x0b, 0x32, 0x35, 0x02,
+    0x13, 0x1b, 0x41, 0x00, 0xca, 0x9b, 0x32, 0x02, 0x90, 0xec, 0xab, 0x30, 0x45, 0x23, 0x90, 0xdc,
+    0x8a, 0x21, 0x20, 0x04, 0xda, 0x9c, 0x10, 0x41, 0x15, 0xa0, 0xbb, 0x89, 0x01, 0x73, 0x81, 0xcb,
+    0x9a, 0x08, 0x63, 0x04, 0xa8, 0xbb, 0x10, 0x11, 0x25, 0xd8, 0xbb, 0x0a, 0x31, 0x36, 0x04, 0xc9,
+    0x9b, 0x21, 0x21, 0x02, 0xdd, 0xab, 0x28, 0x52, 0x43, 0x81, 0xbb, 0xac, 0x32, 0x13, 0x82, 0xdd,
+    0x9c, 0x20, 0x21, 0x25, 0x80, 0xda, 0x8a, 0x42, 0x11, 0x81, 0xcd, 0x9b, 0x21, 0x31, 0x26, 0xa8,
+    0xca, 0x89, 0x42, 0x23, 0xb0, 0xbe, 0x9b, 0x31, 0x52, 0x14, 0xa8, 0xba, 0x9b, 0x72, 0x13, 0xa9,
+    0xcc, 0x8a, 0x31, 0x43, 0x04, 0x99, 0xbd, 0x10, 0x32, 0x13, 0xeb, 0xbb, 0x89, 0x42, 0x44, 0x82,
+    0xb9, 0x9c, 0x22, 0x48, 0xa3, 0x9f, 0x99, 0x89, 0x52, 0x03, 0x01, 0xa9, 0x29, 0xa0, 0x44, 0xcc,
+    0xaa, 0x9b, 0x41, 0x25, 0x31, 0xb2, 0xad, 0x10, 0x28, 0x93, 0xbd, 0xdb, 0x8a, 0x73, 0x22, 0x23,
+    0xca, 0xcb, 0x19, 0x13, 0x00, 0xd9, 0x9b, 0x30, 0x34, 0x36, 0xa8, 0xcb, 0xba, 0x1a, 0x32, 0x27,
+    0x98, 0x89, 0x90, 0x8b, 0x42, 0x81, 0x9a, 0xba, 0xdd, 0x59, 0x34, 0x33, 0xc8, 0xcb, 0xbb, 0x29,
+    0x25, 0x21, 0xb8, 0x9e, 0x30, 0x34, 0x13, 0xeb, 0xac, 0x09, 0x31, 0x34, 0x80, 0xeb, 0x09, 0x12,
+    0x12, 0xa8, 0xbd, 0x9b, 0x52, 0x33, 0x22, 0xa9, 0xbe, 0x19, 0x24, 0x81, 0xfb, 0x9a, 0x18, 0x42,
+    0x34, 0x01, 0xb9, 0xae, 0x19, 0x22, 0x12, 0xdb, 0xbb, 0x28, 0x44, 0x25, 0x91, 0xba, 0xcd, 0x18,
+    0x32, 0x23, 0xca, 0xbd, 0x18, 0x42, 0x24, 0x80, 0xba, 0xaf, 0x00, 0x42, 0x02, 0xa8, 0xdb, 0x89,
+    0x22, 0x34, 0x82, 0xaa, 0xbd, 0x0a, 0x53, 0x13, 0xa0, 0xdd, 0x09, 0x11, 0x53, 0x81, 0x88, 0xcb,
+    0x22, 0xec, 0x42, 0x00, 0x09, 0x52, 0x13, 0x98, 0xbc, 0x08, 0x30, 0x34, 0xa2, 0x9a, 0xde, 0x0b,
+    0x43, 0x21, 0x82, 0xac, 0x89, 0x21, 0x32, 0xa8, 0xbb, 0xbf, 0x5a, 0x13, 0x42, 0xc9, 0xa9, 0x8a,
+    0x51, 0x85, 0x00, 0xcc, 0x08, 0x13, 0x40, 0xb2, 0x9e, 0x9a, 0x10, 0x53, 0x13, 0xb1, 0xbe, 0x29,
+    0x13, 0x33, 0xd9, 0xcc, 0x9b, 0x31, 0x45, 0x33, 0x99, 0xcc, 0x9b, 0x30, 0x13, 0x02, 0xfb, 0x9b,
+    0x22, 0x63, 0x14, 0x98, 0xdb, 0xab, 0x18, 0x43, 0x04, 0x98, 0xaa, 0x20, 0x30, 0x03, 0xc1, 0xbf,
+    0x9a, 0x18, 0x54, 0x12, 0x12, 0xbd, 0x99, 0x09, 0x43, 0x82, 0x8a, 0xec, 0x19, 0x22, 0x35, 0x91,
+    0xbc, 0xac, 0x29, 0x25, 0x21, 0xa8, 0xbc, 0x0b, 0x53, 0x23, 0xa8, 0xdb, 0xab, 0x50, 0x33, 0x14,
+    0xba, 0xcb, 0x9c, 0x32, 0x13, 0x22, 0xfb, 0x19, 0x00, 0x22, 0x82, 0xab, 0xcc, 0xba, 0x78, 0x13,
+    0x22, 0xd9, 0x99, 0x90, 0x20, 0x04, 0x09, 0xea, 0xaa, 0x60, 0x12, 0x32, 0xf8, 0x8a, 0x98, 0x40,
+    0x22, 0xa8, 0xc8, 0x9c, 0x88, 0x53, 0x23, 0x90, 0xcc, 0x08, 0x28, 0x14, 0x00, 0xab, 0xdc, 0x8b,
+    0x28, 0x37, 0x12, 0xb0, 0x8a, 0xa8, 0x20, 0xa1, 0x8a, 0xfb, 0xab, 0x59, 0x26, 0x31, 0xa2, 0x8c,
+    0xa9, 0x9a, 0x10, 0x89, 0x84, 0xaf, 0x10, 0x44, 0x33, 0x91, 0xeb, 0xab, 0x0a, 0x32, 0x24, 0xa0,
+    0xdc, 0x9a, 0x41, 0x35, 0x81, 0xc9, 0x9d, 0x80, 0x20, 0x25, 0x98, 0xb8, 0x9d, 0x00, 0x53, 0x12,
+    0xa0, 0xae, 0x88, 0x18, 0x24, 0x82, 0xa1, 0xaf, 0x98, 0x28, 0x27, 0x00, 0xb0, 0x9b, 0xa9, 0x39,
+    0x25, 0x21, 0xda, 0xab, 0x19, 0x36, 0x33, 0xb2, 0xaf, 0xb9, 0x09, 0x34, 0x11, 0xb1, 0xbd, 0x19,
+    0x44, 0x24, 0xa0, 0xcc, 0xaa, 0x18, 0x24, 0x22, 0x98, 0xeb, 0x89, 0x41, 0x14, 0x00, 0xdb, 0x99,
+    0x0d, 0xe0, 0x45, 0x00, 0x20, 0x43, 0x80, 0x98, 0xac, 0x89, 0x61, 0x13, 0x11, 0xfa, 0x0a, 0x0a,
+    0x31, 0x02, 0x81, 0xbc, 0x89, 0x8c, 0x37, 0x01, 0x82, 0xbc, 0xa8, 0x8a, 0x12, 0x42, 0xa0, 0x0a,
+    0xdb, 0x72, 0x12, 0x12, 0xcc, 0x99, 0xcb, 0x50, 0x12, 0x23, 0xbc, 0xaa, 0x0b, 0x44, 0x34, 0xa8,
+    0xcc, 0x8a, 0x11, 0x34, 0x23, 0xca, 0xfb, 0x9a, 0x20, 0x44, 0x02, 0x98, 0xbc, 0x18, 0x30, 0x14,
+    0xb0, 0xbc, 0xbb, 0x28, 0x34, 0x36, 0x93, 0x9b, 0xb9, 0x39, 0x81, 0xab, 0xc9, 0xbb, 0x40, 0x04,
+    0x39, 0x64, 0x82, 0x21, 0xab, 0xf8, 0x8a, 0x9a, 0x81, 0x10, 0x00, 0x38, 0x07, 0x69, 0x84, 0x8a,
+    0xa8, 0xcb, 0x18, 0x09, 0x15, 0x09, 0xb8, 0x1c, 0x17, 0x28, 0xc2, 0x1b, 0x90, 0x0a, 0x05, 0x1a,
+    0xa1, 0xbc, 0x11, 0xbe, 0x43, 0x22, 0x62, 0xa3, 0x0b, 0xfa, 0x8b, 0x02, 0x31, 0x94, 0x9c, 0xca,
+    0x2b, 0x27, 0x43, 0x93, 0xbc, 0xcb, 0x89, 0x32, 0x23, 0x90, 0xdb, 0x9d, 0x33, 0x53, 0x14, 0xb9,
+    0xbd, 0x8a, 0x30, 0x24, 0x11, 0xda, 0x9c, 0x01, 0x43, 0x13, 0xb8, 0xcc, 0xaa, 0x30, 0x35, 0x02,
+    0xa9, 0xbe, 0x0a, 0x31, 0x27, 0x80, 0xb9, 0x8b, 0x09, 0x34, 0x13, 0x09, 0xf9, 0x9c, 0x89, 0x48,
+    0x25, 0x10, 0x90, 0xab, 0x8b, 0x00, 0x44, 0x81, 0xbb, 0xce, 0x89, 0x51, 0x24, 0x10, 0xa1, 0x9d,
+    0x08, 0x99, 0x33, 0xa9, 0xaa, 0xcd, 0x3a, 0x36, 0x32, 0x04, 0xbc, 0xa9, 0x8b, 0x31, 0x80, 0x11,
+    0xad, 0xba, 0x70, 0x25, 0x22, 0xb0, 0xad, 0xbb, 0x0a, 0x26, 0x10, 0x91, 0x9b, 0x9a, 0x40, 0x36,
+    0x02, 0xab, 0xfa, 0x0c, 0x12, 0x21, 0x82, 0xab, 0xbd, 0x28, 0x31, 0x34, 0x12, 0x90, 0x8b, 0xb8,
+    0x8c, 0xb8, 0x9f, 0xc9, 0x19, 0x62, 0x22, 0x23, 0x10, 0x01, 0x88, 0xbd, 0xbd, 0xcc, 0x09, 0x18,
+    0xc3, 0xec, 0x3d, 0x00, 0x34, 0x82, 0x11, 0x20, 0x92, 0xc1, 0xaf, 0xa0, 0x8d, 0x02, 0x10, 0x03,
+    0x9a, 0x99, 0x0a, 0x77, 0x81, 0x89, 0xb0, 0x2a, 0x80, 0x00, 0xb0, 0xcf, 0x08, 0x40, 0x11, 0x10,
+    0x02, 0x29, 0x36, 0xaa, 0xe0, 0x9e, 0x88, 0x01, 0x31, 0x82, 0xc9, 0x0c, 0x23, 0x73, 0x85, 0x8a,
+    0xb9, 0x9d, 0x10, 0x28, 0x15, 0x99, 0xca, 0x19, 0x33, 0x62, 0x03, 0xa8, 0xbd, 0x9c, 0x00, 0x41,
+    0x02, 0xb9, 0x9c, 0x39, 0x36, 0x21, 0x82, 0xea, 0x9c, 0x98, 0x31, 0x81, 0x82, 0xab, 0xc9, 0x39,
+    0x37, 0x12, 0x03, 0xbc, 0xb9, 0x8e, 0x00, 0x81, 0x21, 0xb8, 0x98, 0xae, 0x21, 0x57, 0x22, 0x91,
+    0xba, 0xbe, 0x9a, 0x21, 0x31, 0x93, 0xac, 0x9c, 0x30, 0x57, 0x22, 0x90, 0xdb, 0xab, 0x89, 0x42,
+    0x03, 0x9a, 0xca, 0x8a, 0x63, 0x34, 0x03, 0xca, 0xbc, 0x8a, 0x41, 0x12, 0x81, 0xbb, 0xbc, 0x18,
+    0x32, 0x37, 0x92, 0x09, 0xc9, 0x18, 0x11, 0x88, 0xb0, 0xbf, 0xaa, 0x19, 0x21, 0x65, 0x23, 0x41,
+    0xb2, 0x9b, 0xdc, 0x8b, 0x80, 0x00, 0x92, 0x9a, 0x0b, 0x57, 0x32, 0x24, 0xc8, 0xba, 0xae, 0x18,
+    0x11, 0x20, 0xb8, 0x8c, 0x28, 0x46, 0x12, 0x90, 0xba, 0xbc, 0x18, 0x11, 0x12, 0xda, 0xa9, 0x8b,
+    0x42, 0x55, 0x03, 0x81, 0xb9, 0x9d, 0x01, 0x9a, 0x02, 0x9d, 0x89, 0x80, 0x28, 0x33, 0x65, 0x24,
+    0x00, 0x88, 0xbe, 0xaa, 0x9b, 0x10, 0x52, 0x90, 0x98, 0xab, 0x73, 0x37, 0x11, 0xb8, 0xcc, 0x9b,
+    0x18, 0x32, 0x92, 0xc9, 0x8b, 0x38, 0x67, 0x11, 0x91, 0xbc, 0x9a, 0x08, 0x43, 0x00, 0xb8, 0xac,
+    0x99, 0x52, 0x33, 0x15, 0x99, 0xa0, 0x9c, 0x89, 0x81, 0x08, 0xaa, 0x01, 0xaf, 0x02, 0x38, 0x57,
+    0x20, 0x14, 0xcb, 0x9a, 0xad, 0x28, 0x01, 0x21, 0x91, 0xcb, 0x49, 0x25, 0x53, 0x92, 0xcb, 0xda,
+    0x76, 0xdc, 0x46, 0x00, 0x29, 0x12, 0x22, 0xa8, 0xcb, 0x38, 0x36, 0x43, 0xa1, 0xbd, 0xab, 0x09,
+    0x43, 0x01, 0xc0, 0xab, 0x9b, 0x55, 0x53, 0x81, 0x98, 0xcb, 0x9a, 0x10, 0x22, 0x92, 0xaa, 0xda,
+    0x89, 0x51, 0x43, 0x24, 0x01, 0xc9, 0xba, 0xad, 0x90, 0x20, 0x91, 0x10, 0xca, 0x18, 0x15, 0x75,
+    0x13, 0x80, 0xda, 0xac, 0x99, 0x18, 0x32, 0x91, 0x8b, 0x99, 0x72, 0x37, 0x10, 0xb8, 0xad, 0xaa,
+    0x28, 0x23, 0x01, 0xea, 0x99, 0x10, 0x54, 0x23, 0x90, 0xea, 0x9a, 0x88, 0x21, 0x12, 0xa8, 0xba,
+    0x8b, 0x32, 0x44, 0x15, 0x00, 0x90, 0x88, 0xad, 0xa8, 0x0b, 0xb9, 0x18, 0x80, 0x40, 0x34, 0x71,
+    0x27, 0x00, 0x93, 0xaf, 0xa8, 0x9c, 0x20, 0x80, 0x22, 0x98, 0x20, 0x32, 0x47, 0x11, 0xc8, 0xaa,
+    0xcd, 0x09, 0x00, 0x32, 0xa8, 0x08, 0x09, 0x57, 0x13, 0x80, 0xbb, 0xdc, 0x0a, 0x11, 0x22, 0x92,
+    0x9e, 0xa9, 0x38, 0x56, 0x01, 0x80, 0xbb, 0x9c, 0x01, 0x31, 0x01, 0xb9, 0x9d, 0xbb, 0x20, 0x47,
+    0x33, 0x82, 0xb9, 0xad, 0x8a, 0x88, 0x30, 0xe9, 0x89, 0xab, 0x61, 0x24, 0x33, 0x05, 0x98, 0xba,
+    0xbd, 0x09, 0xba, 0x18, 0x90, 0x29, 0x34, 0x74, 0x33, 0x03, 0xa0, 0xce, 0xab, 0x90, 0x18, 0x03,
+    0xaa, 0x2b, 0x03, 0x67, 0x23, 0x00, 0xda, 0xac, 0x98, 0x20, 0x14, 0x89, 0xb8, 0x9b, 0x98, 0x73,
+    0x26, 0x00, 0xa9, 0xba, 0x89, 0x30, 0x03, 0x88, 0xec, 0xbb, 0x18, 0x51, 0x36, 0x12, 0x81, 0xba,
+    0xab, 0xb9, 0x9a, 0x80, 0xdc, 0x8c, 0x10, 0x64, 0x22, 0x23, 0x02, 0x9b, 0xfa, 0xaa, 0x9c, 0x99,
+    0x20, 0x21, 0x22, 0x81, 0x79, 0x16, 0x21, 0xb1, 0xdb, 0xac, 0x0a, 0x21, 0x31, 0xb1, 0x9c, 0x9b,
+    0x72, 0x27, 0x01, 0xa9, 0xcb, 0x9a, 0x31, 0x13, 0x82, 0xbe, 0x9a, 0x19, 0x55, 0x23, 0x91, 0xa9,
+    0x43, 0x05, 0x3f, 0x00, 0x0c, 0x11, 0x20, 0xb2, 0xbf, 0xaa, 0x29, 0x26, 0x33, 0x81, 0x00, 0x0a,
+    0x81, 0xca, 0xba, 0xdf, 0x99, 0x08, 0x22, 0x24, 0x31, 0x33, 0x93, 0x42, 0xdc, 0xc8, 0xad, 0x9a,
+    0x10, 0x42, 0x20, 0x92, 0x58, 0x43, 0x11, 0xb2, 0xaf, 0xbc, 0x99, 0x30, 0x23, 0x12, 0x98, 0x8b,
+    0x44, 0x36, 0x01, 0xc9, 0xcd, 0x8a, 0x18, 0x42, 0x02, 0x98, 0xab, 0x8a, 0x62, 0x24, 0x02, 0xa9,
+    0xbd, 0x88, 0x09, 0x42, 0xa8, 0x99, 0xac, 0x29, 0x36, 0x43, 0x13, 0x98, 0x99, 0xbd, 0xaa, 0xc9,
+    0xab, 0x98, 0x19, 0x55, 0x24, 0x32, 0x35, 0x91, 0x90, 0xbf, 0xcb, 0xab, 0x29, 0x22, 0x33, 0x33,
+    0x80, 0x65, 0x22, 0x11, 0xe9, 0xdb, 0x9c, 0x88, 0x11, 0x32, 0x11, 0xa1, 0x0c, 0x31, 0x27, 0x10,
+    0x99, 0xcd, 0x8a, 0x08, 0x31, 0xa1, 0x8a, 0xb8, 0x2b, 0x47, 0x32, 0x13, 0x80, 0xcb, 0xab, 0xab,
+    0xaa, 0xb9, 0xbf, 0xa9, 0x60, 0x34, 0x24, 0x13, 0x32, 0xc9, 0xa8, 0xbd, 0xcb, 0xdb, 0x0b, 0x88,
+    0x44, 0x34, 0x02, 0x10, 0x22, 0x09, 0x83, 0xdf, 0xca, 0xba, 0x09, 0x21, 0x25, 0x32, 0x82, 0x30,
+    0x82, 0x52, 0xd0, 0xbb, 0xbf, 0x89, 0x00, 0x32, 0x01, 0x11, 0x09, 0x43, 0x63, 0x02, 0x01, 0xfc,
+    0x8a, 0xb8, 0x1a, 0x92, 0x29, 0xa1, 0x51, 0x01, 0x43, 0x23, 0x26, 0x8a, 0x91, 0xdf, 0x98, 0xaa,
+    0x80, 0x18, 0x33, 0x41, 0x25, 0x20, 0x01, 0x01, 0xd9, 0x9a, 0xbe, 0xcb, 0x9a, 0x38, 0x25, 0x44,
+    0x11, 0x88, 0x08, 0x01, 0x9a, 0xe1, 0x9c, 0xcb, 0x08, 0x21, 0x31, 0x05, 0x88, 0x19, 0x32, 0x35,
+    0x81, 0xd9, 0xad, 0x9b, 0x91, 0x38, 0xb2, 0x0b, 0xc8, 0x79, 0x17, 0x10, 0x00, 0x08, 0xb9, 0x08,
+    0xbc, 0xab, 0xc9, 0x0a, 0x00, 0x46, 0x22, 0x21, 0x13, 0x01, 0x40, 0xe2, 0xbc, 0xcc, 0x9b, 0x08,
+    0x9d, 0xe1, 0x3c, 0x00, 0x13, 0x52, 0x02, 0x43, 0x11, 0x00, 0x83, 0xcf, 0xb8, 0x9c, 0x09, 0x01,
+    0x22, 0x08, 0x26, 0x18, 0x01, 0x88, 0x32, 0x8c, 0x96, 0x8e, 0xa1, 0xaa, 0x80, 0xab, 0x41, 0x21,
+    0x15, 0x08, 0x80, 0x74, 0x02, 0x10, 0xd8, 0xad, 0xba, 0x8a, 0x21, 0x13, 0x15, 0x00, 0x11, 0x35,
+    0x20, 0xa3, 0xda, 0xbe, 0xaa, 0x09, 0x88, 0x02, 0x10, 0x40, 0x45, 0x33, 0x04, 0xb9, 0xcb, 0xaa,
+    0x41, 0xb9, 0xb0, 0xbf, 0x9b, 0x14, 0x64, 0x11, 0x91, 0x99, 0x09, 0x11, 0x53, 0xc8, 0xbb, 0xdc,
+    0x89, 0x12, 0x40, 0x02, 0x18, 0x10, 0x22, 0x25, 0x21, 0xfa, 0x9c, 0xab, 0x00, 0x09, 0x82, 0xa8,
+    0x41, 0x55, 0x23, 0x18, 0x98, 0xdd, 0x09, 0x00, 0x20, 0xb8, 0xac, 0xda, 0x39, 0x35, 0x33, 0x02,
+    0xa9, 0xdc, 0x09, 0x20, 0x15, 0x88, 0xe8, 0x8c, 0x89, 0x08, 0x25, 0x11, 0x82, 0x98, 0x8a, 0x8b,
+    0x37, 0x88, 0x91, 0xaf, 0xa8, 0x8b, 0x31, 0x03, 0x44, 0x81, 0x88, 0x10, 0x21, 0x10, 0xc8, 0xba,
+    0xdf, 0x9a, 0x11, 0x09, 0x23, 0x12, 0x21, 0x15, 0x08, 0xbb, 0x01, 0x3a, 0x27, 0xb9, 0x09, 0xff,
+    0x88, 0x89, 0x22, 0x12, 0x09, 0x02, 0x31, 0x32, 0x12, 0x99, 0xfb, 0x9c, 0xbb, 0xbe, 0x08, 0x28,
+    0x98, 0x57, 0x20, 0x02, 0x02, 0xb9, 0xaf, 0x03, 0x88, 0x82, 0xcb, 0xd8, 0x9c, 0x22, 0x81, 0x37,
+    0x00, 0x80, 0x09, 0x18, 0xb9, 0x84, 0x1b, 0xfc, 0x09, 0x90, 0x09, 0x92, 0x40, 0x01, 0x53, 0x05,
+    0x0a, 0x82, 0xa8, 0x8b, 0xcf, 0x28, 0x89, 0x21, 0xcb, 0x80, 0x2b, 0x57, 0x32, 0x81, 0xca, 0xcb,
+    0x8a, 0x02, 0x11, 0x14, 0xba, 0xc8, 0x2d, 0x13, 0x53, 0x01, 0xac, 0xaa, 0x2a, 0x82, 0x32, 0x02,
+    0x19, 0xcb, 0x26, 0x19, 0xc1, 0xbe, 0x9a, 0x0a, 0x27, 0x11, 0x00, 0xa0, 0x39, 0x90, 0x46, 0x82,
+    0x51, 0x09, 0x35, 0x00, 0xcb, 0xaf, 0x18, 0x10, 0x24, 0x99, 0x90, 0x50, 0x81, 0x12, 0x98, 0x9a,
+    0xaa, 0x8c, 0xb8, 0x49, 0xa1, 0x39, 0x02, 0x20, 0xa3, 0x28, 0x60, 0x72, 0x17, 0x99, 0xb0, 0xbf,
+    0x89, 0x21, 0x22, 0x94, 0x0b, 0xb1, 0x4a, 0x24, 0x02, 0xeb, 0x9a, 0x29, 0x83, 0x45, 0x01, 0xa9,
+    0x81, 0x9f, 0xb8, 0x0b, 0x88, 0x98, 0x56, 0x00, 0x22, 0x80, 0x19, 0x82, 0x73, 0xb0, 0xbe, 0xd9,
+    0x9b, 0x23, 0x48, 0x84, 0x09, 0x10, 0x23, 0x32, 0x81, 0xce, 0xa8, 0x8d, 0x22, 0x11, 0xa8, 0xfb,
+    0x9b, 0x10, 0x33, 0x75, 0xa1, 0x08, 0x88, 0x10, 0x11, 0x99, 0xed, 0xaa, 0x18, 0x10, 0x06, 0x10,
+    0x92, 0x09, 0x22, 0x09, 0x04, 0xac, 0xd9, 0xae, 0x00, 0x32, 0x33, 0x33, 0xe9, 0xaa, 0xab, 0x20,
+    0x11, 0x64, 0xc0, 0x10, 0xab, 0x22, 0x10, 0x43, 0xb1, 0x8a, 0xdf, 0x89, 0x90, 0x38, 0x15, 0x18,
+    0x02, 0x09, 0x99, 0xc9, 0x38, 0x01, 0x32, 0xb2, 0xbf, 0x98, 0xab, 0x78, 0xb3, 0x19, 0xbc, 0x62,
+    0x21, 0x34, 0xa1, 0x0a, 0xcc, 0x08, 0xc9, 0x19, 0xb2, 0x5b, 0xc8, 0x42, 0x42, 0x13, 0xa0, 0xdb,
+    0x8b, 0x81, 0x21, 0xa0, 0x9b, 0xaa, 0x44, 0x3a, 0x27, 0x0d, 0xd8, 0x0a, 0x23, 0x41, 0x14, 0xa8,
+    0xbb, 0xdb, 0x29, 0x01, 0x36, 0xbb, 0xc8, 0x0c, 0x13, 0x73, 0x81, 0x88, 0x9b, 0x00, 0x18, 0x99,
+    0xea, 0x0a, 0x33, 0x43, 0x24, 0xaa, 0xca, 0xaa, 0x5b, 0x03, 0x92, 0x1c, 0xf8, 0x28, 0x00, 0x32,
+    0x06, 0x99, 0xb9, 0xcf, 0x32, 0x09, 0x04, 0x0a, 0xa2, 0x09, 0x21, 0xb9, 0x09, 0xd9, 0x08, 0x98,
+    0x58, 0x91, 0x43, 0x16, 0x08, 0xd9, 0x19, 0xc9, 0x19, 0xa2, 0x2c, 0x98, 0x14, 0x1b, 0x14, 0x44,
+    0x80, 0x10, 0xf8, 0x9d, 0x90, 0x08, 0x01, 0x10, 0x91, 0x4b, 0x06, 0x21, 0x00, 0xeb, 0x0b, 0x02,
+    0x69, 0x01, 0x2f, 0x00, 0x02, 0x99, 0xf8, 0x9d, 0x08, 0x60, 0x12, 0x11, 0xda, 0x8a, 0x08, 0x54,
+    0x01, 0x90, 0xeb, 0x9a, 0x8a, 0x53, 0x02, 0x23, 0xb9, 0x81, 0x8d, 0x01, 0x90, 0x9a, 0xca, 0x8b,
+    0x42, 0x11, 0x22, 0x02, 0x56, 0x81, 0x32, 0xba, 0xf9, 0xaf, 0x89, 0x21, 0x10, 0x01, 0x90, 0x19,
+    0x62, 0x23, 0x22, 0x01, 0xfc, 0x9c, 0x99, 0x08, 0x00, 0x02, 0xca, 0x73, 0x12, 0x23, 0xb9, 0xab,
+    0xcc, 0x40, 0x83, 0x9a, 0xd0, 0x8b, 0x90, 0x70, 0x84, 0x10, 0x88, 0xa8, 0x08, 0x20, 0x81, 0xe8,
+    0x9b, 0xd9, 0x1a, 0x72, 0x83, 0x10, 0xb0, 0x28, 0x13, 0x98, 0xda, 0xbe, 0x99, 0x18, 0x13, 0x18,
+    0x11, 0x14, 0x72, 0x27, 0x90, 0xca, 0xbb, 0x10, 0x99, 0x13, 0xbd, 0x91, 0x1a, 0x65, 0x13, 0x20,
+    0x90, 0xb8, 0xaa, 0x20, 0xd9, 0xca, 0x9d, 0x99, 0x30, 0x27, 0x01, 0x80, 0x9a, 0x08, 0x42, 0x35,
+    0x80, 0xdb, 0xbc, 0x9a, 0x89, 0x35, 0x20, 0x12, 0x89, 0x98, 0x9a, 0x82, 0xbc, 0x58, 0x26, 0x01,
+    0x98, 0xfa, 0x8c, 0x08, 0x41, 0x12, 0x21, 0xb8, 0xab, 0x19, 0xea, 0x9b, 0x99, 0x73, 0x15, 0x32,
+    0x90, 0xca, 0xca, 0x2a, 0xb1, 0x70, 0xb0, 0x28, 0x89, 0x08, 0xa0, 0x18, 0xa9, 0x71, 0x33, 0x35,
+    0xcb, 0xa1, 0xbf, 0x20, 0x00, 0x11, 0xea, 0x30, 0xa8, 0x41, 0xa1, 0x89, 0x80, 0x40, 0x14, 0x30,
+    0xb3, 0x9e, 0xcc, 0x8a, 0x88, 0x44, 0x11, 0x12, 0x98, 0xc9, 0xab, 0x09, 0xa9, 0x11, 0x63, 0x47,
+    0x11, 0x08, 0xdc, 0x9a, 0x08, 0x22, 0x80, 0x11, 0xaa, 0x8b, 0xa3, 0x7b, 0x90, 0x43, 0x40, 0x24,
+    0x82, 0xdd, 0xbb, 0xba, 0x29, 0x40, 0x26, 0x11, 0x88, 0x28, 0x92, 0xaa, 0xd9, 0xcc, 0x08, 0x30,
+    0x17, 0x20, 0xa9, 0xbc, 0x99, 0x20, 0x28, 0x15, 0x28, 0x12, 0x03, 0x38, 0xf0, 0x9e, 0xa9, 0x19,
+    0x99, 0xfe, 0x2e, 0x00, 0x01, 0x12, 0xb9, 0xb9, 0x8c, 0x08, 0x35, 0x99, 0x30, 0x33, 0x37, 0x35,
+    0xd9, 0xbb, 0xad, 0x39, 0x02, 0x44, 0x98, 0xca, 0x9b, 0x32, 0xa8, 0x13, 0x0d, 0x25, 0x21, 0x45,
+    0x01, 0x89, 0xdd, 0x89, 0x9a, 0x09, 0xa1, 0x09, 0x81, 0x73, 0x37, 0x11, 0xb0, 0xbd, 0xbb, 0x29,
+    0x23, 0x33, 0x23, 0x9b, 0x03, 0x74, 0x81, 0xdb, 0xdb, 0x9b, 0x20, 0x24, 0x11, 0x00, 0x02, 0x49,
+    0xc3, 0x8e, 0xca, 0x89, 0x42, 0x33, 0x13, 0x98, 0xca, 0x0c, 0x91, 0x09, 0xcd, 0x9a, 0x1a, 0x63,
+    0x24, 0x33, 0x23, 0xa8, 0xfc, 0xac, 0x9b, 0x18, 0x43, 0x32, 0x13, 0x20, 0x90, 0x9c, 0xca, 0xab,
+    0xcb, 0x19, 0x24, 0x52, 0x23, 0x33, 0x91, 0xba, 0xfd, 0xbd, 0xaa, 0x28, 0x44, 0x24, 0x23, 0x08,
+    0xa9, 0xbb, 0xbb, 0xab, 0xad, 0x8a, 0x20, 0x73, 0x44, 0x21, 0x21, 0xc9, 0xda, 0xcc, 0x89, 0x08,
+    0x53, 0x33, 0x22, 0x91, 0xa9, 0xbc, 0xab, 0xab, 0xba, 0xa9, 0x60, 0x53, 0x44, 0x21, 0x01, 0xa8,
+    0xcd, 0xbb, 0x9b, 0x00, 0x62, 0x23, 0x35, 0x82, 0x98, 0xcd, 0x9a, 0x89, 0x00, 0x10, 0x00, 0x21,
+    0x73, 0x33, 0x14, 0xba, 0xde, 0xbb, 0x9a, 0x32, 0x45, 0x22, 0x02, 0x98, 0x98, 0x9a, 0xc9, 0xcb,
+    0xcc, 0x19, 0x21, 0x44, 0x22, 0x21, 0x89, 0xa8, 0xb9, 0xbf, 0xba, 0x8a, 0x62, 0x26, 0x22, 0x80,
+    0xb9, 0xad, 0x99, 0x88, 0x89, 0x88, 0x88, 0x54, 0x63, 0x22, 0x81, 0xcb, 0xdb, 0xab, 0x00, 0x01,
+    0x52, 0x22, 0x23, 0x22, 0xa8, 0xfb, 0xbb, 0xac, 0xaa, 0x18, 0x34, 0x53, 0x33, 0x24, 0x00, 0xc0,
+    0xad, 0xdb, 0xaa, 0x88, 0x31, 0x36, 0x33, 0x82, 0x88, 0xca, 0x9a, 0xda, 0x9a, 0x8a, 0x00, 0x42,
+    0x44, 0x24, 0x01, 0x99, 0xe9, 0xab, 0xbb, 0x19, 0x73, 0x42, 0x14, 0x88, 0xa9, 0xab, 0x9a, 0x90,
+    0xc9, 0xfa, 0x2c, 0x00, 0x9e, 0x0a, 0x61, 0x34, 0x23, 0x82, 0x99, 0x9a, 0xc9, 0xbb, 0xce, 0xab,
+    0x39, 0x55, 0x24, 0x11, 0xa9, 0xba, 0x9b, 0x00, 0x88, 0xbb, 0xac, 0x30, 0x36, 0x55, 0x02, 0x08,
+    0xaa, 0xac, 0x99, 0x9b, 0x88, 0x31, 0x47, 0x12, 0x80, 0xa9, 0xcc, 0x8a, 0x80, 0x01, 0x88, 0x10,
+    0x32, 0x37, 0x34, 0x81, 0xc9, 0xcd, 0xab, 0xab, 0x20, 0x44, 0x63, 0x12, 0x80, 0x8a, 0xa9, 0xba,
+    0xeb, 0xbb, 0x9b, 0x52, 0x45, 0x32, 0x12, 0x88, 0xba, 0xac, 0xab, 0xca, 0xac, 0x09, 0x72, 0x24,
+    0x12, 0x81, 0x88, 0xb8, 0xbc, 0xbc, 0x9a, 0x18, 0x64, 0x22, 0x12, 0x80, 0xa9, 0xac, 0x98, 0x8a,
+    0xdb, 0x08, 0x20, 0x47, 0x13, 0x81, 0xba, 0xac, 0xb9, 0xaa, 0x20, 0x98, 0x60, 0x45, 0x34, 0x14,
+    0x90, 0xcd, 0xac, 0x8a, 0x08, 0x20, 0x23, 0x21, 0x11, 0x43, 0x33, 0x13, 0xfa, 0xbf, 0xab, 0x0a,
+    0x33, 0x36, 0x12, 0x08, 0x00, 0xa8, 0xcb, 0xb8, 0xdb, 0xac, 0x10, 0x33, 0x45, 0x12, 0x00, 0x88,
+    0x99, 0xcc, 0xaa, 0x98, 0x48, 0x12, 0x33, 0x12, 0x34, 0x83, 0xff, 0x9a, 0x89, 0x08, 0x52, 0x13,
+    0x10, 0x90, 0x99, 0xaa, 0xba, 0xbe, 0x9c, 0x30, 0x36, 0x33, 0x02, 0x10, 0x22, 0xb8, 0xff, 0xac,
+    0x8a, 0x20, 0x43, 0x33, 0x81, 0x99, 0x00, 0x12, 0x88, 0xfd, 0xbc, 0x8b, 0x42, 0x34, 0x22, 0xa0,
+    0x9b, 0x10, 0x33, 0xb0, 0xee, 0xbb, 0x0a, 0x22, 0x46, 0x02, 0x98, 0xa8, 0x09, 0x81, 0x99, 0xcd,
+    0x89, 0x63, 0x13, 0x81, 0xaa, 0x8b, 0x91, 0x00, 0xea, 0xcb, 0x09, 0x72, 0x34, 0x13, 0x90, 0xbc,
+    0x99, 0xba, 0xba, 0xdc, 0x0a, 0x44, 0x45, 0x13, 0x98, 0xba, 0x9a, 0x81, 0x89, 0xfb, 0xac, 0x09,
+    0x52, 0x35, 0x11, 0x80, 0xab, 0x9a, 0x81, 0x89, 0xdd, 0xba, 0x29, 0x64, 0x14, 0x01, 0xb9, 0xbb,
+    0x0d, 0xfb, 0x31, 0x00, 0x10, 0x32, 0x91, 0xbc, 0x8b, 0x40, 0x47, 0x22, 0xa8, 0xeb, 0x9a, 0x08,
+    0x23, 0x02, 0x98, 0xab, 0x62, 0x23, 0x14, 0xd9, 0xbe, 0x9a, 0x30, 0x42, 0x04, 0x88, 0x99, 0x19,
+    0x32, 0x22, 0xb0, 0xaf, 0xcb, 0x09, 0x31, 0x32, 0x93, 0x0b, 0x01, 0x37, 0x80, 0xfa, 0xbb, 0x9a,
+    0x10, 0x34, 0x12, 0x22, 0x00, 0xaa, 0x21, 0x20, 0x44, 0xf8, 0xbd, 0x9a, 0x20, 0x42, 0x23, 0xa8,
+    0x28, 0x90, 0x45, 0x90, 0xeb, 0xac, 0x99, 0x20, 0x34, 0x22, 0xa0, 0x9a, 0x69, 0x34, 0x25, 0xda,
+    0xbc, 0x9d, 0x10, 0x43, 0x02, 0xa0, 0x9b, 0x08, 0x62, 0x02, 0xa0, 0xdd, 0x9a, 0x08, 0x44, 0x13,
+    0x91, 0xba, 0x8d, 0x00, 0x53, 0x82, 0xa9, 0xbd, 0x09, 0x21, 0x44, 0x01, 0x98, 0x9b, 0x08, 0x12,
+    0xa8, 0xde, 0x9b, 0x89, 0x54, 0x24, 0x21, 0x80, 0x99, 0x90, 0x89, 0xcb, 0xdd, 0xbb, 0x8b, 0x53,
+    0x44, 0x23, 0x00, 0x99, 0xa9, 0x88, 0xba, 0xcc, 0xbc, 0x19, 0x34, 0x47, 0x00, 0x80, 0x99, 0x19,
+    0x81, 0x98, 0xde, 0x9b, 0x89, 0x54, 0x33, 0x02, 0xab, 0xac, 0x08, 0x21, 0x82, 0xeb, 0xbc, 0x1b,
+    0x73, 0x43, 0x12, 0x88, 0xab, 0xab, 0x01, 0x9a, 0xf9, 0xba, 0x8a, 0x31, 0x46, 0x22, 0x01, 0xa9,
+    0xa9, 0x89, 0xa0, 0xad, 0xdc, 0x9a, 0x30, 0x37, 0x32, 0x13, 0x88, 0xaa, 0xba, 0xad, 0xa8, 0xab,
+    0xbb, 0x18, 0x73, 0x45, 0x22, 0x83, 0x88, 0xaa, 0xab, 0xae, 0xd9, 0x8b, 0x98, 0x63, 0x32, 0x31,
+    0x02, 0x11, 0x11, 0xdb, 0xcb, 0xae, 0x99, 0x09, 0x01, 0x30, 0x24, 0x10, 0x15, 0x10, 0x92, 0xae,
+    0xb9, 0x8b, 0xa9, 0x09, 0x33, 0x47, 0x12, 0x22, 0x15, 0xa9, 0xba, 0xeb, 0xaa, 0x99, 0xa9, 0x1a,
+    0x71, 0x35, 0x34, 0x01, 0xa0, 0xdc, 0x9b, 0x99, 0xa8, 0x9a, 0x18, 0x72, 0x37, 0x23, 0x90, 0xc9,
+    0xff, 0x01, 0x30, 0x00, 0x8a, 0x20, 0x81, 0xc8, 0xbf, 0x8a, 0x30, 0x45, 0x23, 0x91, 0xba, 0xa9,
+    0x8a, 0x11, 0xb8, 0xab, 0xfb, 0x0b, 0x73, 0x24, 0x22, 0x80, 0xab, 0x89, 0xa9, 0x9d, 0xb9, 0xac,
+    0x09, 0x52, 0x23, 0x26, 0x98, 0x98, 0x88, 0x09, 0x89, 0xa1, 0x9d, 0x89, 0x8a, 0x50, 0x06, 0x62,
+    0x11, 0x00, 0x91, 0xac, 0xba, 0x98, 0x9c, 0xa9, 0xad, 0x28, 0x45, 0x53, 0x13, 0xa0, 0xb9, 0xad,
+    0xa9, 0x31, 0x89, 0xe9, 0x19, 0x18, 0x45, 0x26, 0x11, 0xa9, 0xca, 0xac, 0x89, 0x10, 0x81, 0x08,
+    0x90, 0x41, 0x44, 0x33, 0xa0, 0xcd, 0x99, 0x00, 0x01, 0xca, 0xcb, 0x1a, 0x34, 0x47, 0x02, 0x91,
+    0xad, 0x89, 0x10, 0x02, 0xb9, 0xcd, 0x9a, 0x00, 0x44, 0x23, 0x03, 0x99, 0xa9, 0x29, 0x25, 0xc9,
+    0xcb, 0xbe, 0x19, 0x42, 0x53, 0x02, 0x81, 0xab, 0x89, 0x31, 0x80, 0xbf, 0xcc, 0x9b, 0x18, 0x54,
+    0x24, 0x12, 0x99, 0xba, 0x9a, 0x08, 0x90, 0xbb, 0xbd, 0x29, 0x65, 0x44, 0x13, 0x91, 0xeb, 0xba,
+    0x9b, 0x10, 0x11, 0x81, 0xa9, 0x10, 0x56, 0x24, 0x02, 0xa8, 0xbf, 0xaa, 0x09, 0x31, 0x32, 0x81,
+    0x98, 0x20, 0x55, 0x03, 0x80, 0xce, 0xaa, 0x0a, 0x22, 0x12, 0x81, 0xbb, 0x1b, 0x41, 0x36, 0x12,
+    0xa0, 0xad, 0x88, 0x48, 0x03, 0xa0, 0xbf, 0x8b, 0x22, 0x55, 0x01, 0x00, 0x8a, 0x88, 0x31, 0xb0,
+    0xee, 0xbb, 0x9d, 0x10, 0x22, 0x42, 0x32, 0x32, 0x34, 0x01, 0xd8, 0xcc, 0xbc, 0x9a, 0x18, 0x21,
+    0x15, 0x31, 0x24, 0x43, 0x02, 0xca, 0xec, 0xaa, 0x9a, 0x88, 0x20, 0x21, 0x42, 0x34, 0x34, 0x12,
+    0xa8, 0xcd, 0xab, 0x9a, 0x18, 0x01, 0x80, 0x88, 0x71, 0x36, 0x22, 0xa0, 0xbc, 0xbc, 0x09, 0x00,
+    0x80, 0xc9, 0xac, 0x38, 0x36, 0x43, 0x02, 0x98, 0xa8, 0x08, 0x99, 0xbc, 0xfc, 0x8b, 0x38, 0x36,
+    0xbe, 0x02, 0x2e, 0x00, 0x13, 0x98, 0xbb, 0x9a, 0x89, 0x80, 0xce, 0xda, 0x8b, 0x31, 0x55, 0x23,
+    0x01, 0xa9, 0x9b, 0x89, 0xa0, 0x89, 0xea, 0x89, 0x08, 0x55, 0x13, 0x01, 0xc9, 0x9a, 0x18, 0xa1,
+    0x8b, 0xec, 0x99, 0x31, 0x53, 0x13, 0x81, 0xba, 0x19, 0x05, 0x88, 0xcb, 0xca, 0x08, 0x52, 0x34,
+    0x03, 0x00, 0x10, 0x80, 0xe0, 0xaf, 0xcc, 0x8b, 0x12, 0x35, 0x82, 0x81, 0xa8, 0x3a, 0x25, 0x12,
+    0xcd, 0xcb, 0x9a, 0x30, 0x35, 0x13, 0x99, 0xa8, 0x1b, 0x24, 0x02, 0xbc, 0xaf, 0xab, 0x28, 0x63,
+    0x82, 0x98, 0xc9, 0x48, 0x43, 0x33, 0xc9, 0xcc, 0xaa, 0x38, 0x53, 0x02, 0x91, 0x9b, 0x20, 0x62,
+    0x03, 0xa9, 0xcf, 0xbb, 0x09, 0x31, 0x34, 0x12, 0x00, 0x00, 0x42, 0x01, 0xe0, 0xbf, 0x9a, 0x19,
+    0x43, 0x43, 0x01, 0x99, 0x00, 0x11, 0x92, 0xfa, 0xcc, 0x9a, 0x18, 0x53, 0x22, 0x81, 0x99, 0x99,
+    0x18, 0x24, 0xc9, 0xbd, 0x8b, 0x41, 0x54, 0x22, 0x91, 0xbb, 0xab, 0x10, 0x23, 0xa8, 0xcf, 0x8a,
+    0x30, 0x32, 0x34, 0xd0, 0xbc, 0x89, 0x40, 0x24, 0x82, 0xcb, 0x9b, 0x10, 0x44, 0x13, 0xb9, 0xbb,
+    0x8b, 0x73, 0x16, 0x90, 0xa9, 0xae, 0x89, 0x00, 0x01, 0x10, 0x01, 0x48, 0x24, 0x13, 0x51, 0xb0,
+    0xbe, 0xba, 0xac, 0x20, 0x22, 0x36, 0x21, 0x23, 0x03, 0xa0, 0xfb, 0xbc, 0xad, 0x99, 0x80, 0x32,
+    0x24, 0x43, 0x00, 0x90, 0x19, 0xb8, 0xfb, 0x99, 0xbc, 0x19, 0x53, 0x36, 0x32, 0x81, 0xcb, 0xbb,
+    0x9c, 0x80, 0x11, 0x01, 0xba, 0x31, 0x44, 0x34, 0x83, 0xcc, 0xcc, 0x9b, 0x09, 0x53, 0x33, 0x12,
+    0x04, 0x0a, 0x82, 0xcb, 0xcb, 0xbc, 0x98, 0x41, 0x61, 0x02, 0x00, 0xab, 0x11, 0x21, 0xe9, 0xea,
+    0xad, 0x08, 0x51, 0x14, 0x11, 0xa9, 0xa9, 0x8a, 0x11, 0x22, 0xba, 0x9b, 0x1b, 0x72, 0x27, 0x11,
+    0x75, 0x02, 0x26, 0x00, 0xdb, 0x9a, 0x09, 0x31, 0x98, 0xa9, 0xac, 0x52, 0x53, 0x25, 0x01, 0xaa,
+    0xdb, 0x0a, 0x00, 0x88, 0xaa, 0x19, 0x63, 0x12, 0x82, 0xa8, 0x10, 0x28, 0x16, 0xeb, 0xcb, 0x9b,
+    0x41, 0x43, 0x13, 0xca, 0x9b, 0x0a, 0x63, 0x22, 0x90, 0xbc, 0x9b, 0x20, 0x65, 0x81, 0xb8, 0x9c,
+    0x9a, 0x21, 0x33, 0xa8, 0x81, 0xaf, 0x00, 0x09, 0x83, 0x0c, 0x15, 0x43, 0x53, 0x03, 0xa9, 0xcd,
+    0x99, 0x2a, 0x12, 0x86, 0xbb, 0xbb, 0x10, 0x54, 0x14, 0xa0, 0x9e, 0xa9, 0x10, 0x32, 0x34, 0x81,
+    0xcb, 0x00, 0x10, 0x22, 0xfa, 0xb9, 0x8c, 0x41, 0x14, 0x11, 0xb9, 0x9b, 0x40, 0x15, 0x88, 0xfa,
+    0xcb, 0x9a, 0x32, 0x15, 0x11, 0x01, 0xa8, 0x48, 0x02, 0x88, 0xdc, 0xab, 0x89, 0x52, 0x24, 0x08,
+    0xa9, 0x18, 0x01, 0x13, 0xd8, 0xcd, 0xad, 0x18, 0x22, 0x24, 0x12, 0xbb, 0x90, 0x31, 0x47, 0x80,
+    0xa0, 0xbe, 0x19, 0x21, 0x13, 0xc9, 0xab, 0x0b, 0x55, 0x43, 0x01, 0xaa, 0xc9, 0x2a, 0x14, 0x80,
+    0xee, 0xbb, 0x8b, 0x42, 0x44, 0x12, 0x81, 0x98, 0x00, 0x11, 0x01, 0xfb, 0xbd, 0xab, 0x00, 0x44,
+    0x23, 0x81, 0x88, 0x09, 0x11, 0x12, 0xda, 0xbd, 0x9c, 0x30, 0x11, 0x23, 0xb9, 0x0a, 0x11, 0x57,
+    0x11, 0xa0, 0xab, 0x8b, 0x22, 0x03, 0xda, 0xeb, 0x8b, 0x11, 0x32, 0x80, 0xcb, 0x1b, 0x73, 0x37,
+    0x02, 0xc9, 0xcb, 0x9b, 0x11, 0x21, 0x01, 0x80, 0x8b, 0x44, 0x62, 0x02, 0xa8, 0xbe, 0xab, 0x21,
+    0x13, 0x21, 0xd8, 0xbb, 0x38, 0x73, 0x13, 0x91, 0xcc, 0xac, 0x20, 0x34, 0x24, 0x80, 0xcb, 0xba,
+    0xab, 0x38, 0x90, 0x24, 0x39, 0x44, 0x00, 0x04, 0x09, 0x9c, 0xa8, 0x9a, 0xfb, 0x8d, 0x00, 0x30,
+    0x36, 0x13, 0xa9, 0xaa, 0xa0, 0x08, 0x90, 0xfd, 0x9b, 0x09, 0x44, 0x43, 0x01, 0xa9, 0xad, 0x99,
+    0x94, 0xfe, 0x21, 0x00, 0x42, 0x12, 0x9b, 0xca, 0x8c, 0x43, 0x34, 0x33, 0xb8, 0xdd, 0x8a, 0x18,
+    0x34, 0x82, 0xa8, 0xbd, 0xa9, 0x52, 0x22, 0x81, 0xbc, 0x9a, 0x3b, 0x34, 0x44, 0x82, 0x9a, 0xc9,
+    0x8b, 0x91, 0x11, 0x30, 0xc2, 0x1a, 0x14, 0x55, 0x34, 0x00, 0xcc, 0xca, 0xac, 0x08, 0x11, 0x14,
+    0x90, 0x99, 0xa8, 0x42, 0x01, 0x40, 0xc0, 0x2b, 0xa4, 0x50, 0xa1, 0x32, 0x02, 0xa8, 0xbf, 0xcc,
+    0x0b, 0x80, 0x22, 0x25, 0x20, 0x32, 0xa0, 0x99, 0xbb, 0xae, 0xfa, 0x0b, 0x00, 0x55, 0x23, 0x81,
+    0xaa, 0xad, 0x10, 0x13, 0x82, 0xbf, 0xac, 0x89, 0x45, 0x33, 0x91, 0x99, 0xac, 0x10, 0x20, 0xc2,
+    0xae, 0xbb, 0x29, 0x43, 0x27, 0x03, 0x90, 0xaa, 0x01, 0x31, 0x01, 0xae, 0xcb, 0xac, 0x00, 0x02,
+    0xba, 0x50, 0x92, 0x41, 0x34, 0x13, 0xcb, 0xbc, 0x98, 0x28, 0x85, 0x8a, 0xda, 0xab, 0x61, 0x33,
+    0x33, 0xb0, 0x29, 0x91, 0x61, 0x82, 0xd8, 0xce, 0x8a, 0x30, 0x34, 0x01, 0xeb, 0xaa, 0x0a, 0x53,
+    0x33, 0xa1, 0xba, 0xbd, 0x49, 0x24, 0x12, 0xa8, 0xdd, 0x8a, 0x19, 0x43, 0x12, 0x88, 0xab, 0x88,
+    0x61, 0x12, 0xb8, 0xbd, 0x9b, 0x18, 0x32, 0x26, 0x90, 0x9a, 0x18, 0x24, 0x25, 0x90, 0xdc, 0xab,
+    0x11, 0x24, 0x33, 0xb1, 0xcb, 0xaa, 0x08, 0x01, 0x13, 0x80, 0x0a, 0x71, 0x90, 0x91, 0xa0, 0x2b,
+    0x04, 0x34, 0xa0, 0xcf, 0xa9, 0x51, 0x13, 0x32, 0xba, 0xed, 0x9a, 0x19, 0x20, 0x73, 0x90, 0x00,
+    0x98, 0x09, 0x20, 0x19, 0x14, 0xaa, 0xba, 0xdb, 0x3a, 0x15, 0x09, 0x91, 0xbc, 0x08, 0x36, 0x22,
+    0x30, 0xa0, 0xbe, 0x00, 0x98, 0x30, 0x92, 0xcf, 0xa9, 0x09, 0x20, 0x27, 0x33, 0x11, 0x20, 0xa9,
+    0x9c, 0xb8, 0xbd, 0x1a, 0x98, 0x48, 0x23, 0x12, 0x08, 0x9a, 0x92, 0x7a, 0x14, 0xda, 0xab, 0xab,
+    0xd3, 0xff, 0x0a, 0x00, 0x73, 0x92, 0xa8, 0x11, 0x0b, 0xba, 0x51, 0x11, 0x18, 0x10, 0xaa, 0x90,
+    0xbf, 0x01, 0x22, 0x41, 0xd2, 0x9f, 0x88, 0x22, 0x99, 0x22, 0xa3, 0x99, 0x2a, 0x26, 0x30, 0xd2,
+    0x93, 0xdf, 0x20, 0x02, 0x20, 0xab, 0xaa, 0x19, 0x52, 0xb0, 0x9b, 0xa4, 0x69, 0x93, 0x10, 0x0c,
+    0x02, 0x02, 0xc0, 0xbe, 0x28, 0x12, 0x10, 0x9a, 0xbb, 0xcc, 0x36, 0x98, 0x29, 0xb0, 0x71, 0x29,
+    0x92, 0x91, 0x91, 0xa0, 0x04, 0x3a, 0x99, 0x31, 0x27, 0xbc, 0x09, 0x31, 0xa5, 0x21, 0xe9, 0x88,
+    0x19, 0x03, 0x3b, 0xca, 0xb9, 0x79, 0xb3, 0x42, 0x11, 0xcb, 0x1b, 0x03, 0xa3, 0xab, 0x39, 0xfa,
+    0x82, 0x1b, 0x29, 0x29, 0x32, 0x10, 0xb3, 0x19, 0x31, 0x13, 0xb2, 0x33, 0xab, 0x3b, 0x93, 0xa6,
+    0x3b, 0x02, 0x21, 0x90, 0x33, 0x9a, 0x10, 0x03, 0x3a, 0x0b, 0xb1, 0x19, 0x11, 0x0b, 0xa4, 0x70,
+    0x92, 0x94, 0xb8, 0x9b, 0x2b, 0x64, 0x91, 0xbb, 0x9a, 0x8b, 0x72, 0x21, 0xa1, 0xb8, 0xaa, 0xa1,
+    0x26, 0x80, 0xa0, 0x9d, 0x8a, 0x59, 0x98, 0xa2, 0xa0, 0xe0, 0x08, 0x10, 0x33, 0x21, 0x8d, 0x8b,
+    0xc2, 0x51, 0xa8, 0x13, 0xb9, 0x8d, 0x11, 0x18, 0x91, 0x92, 0xba, 0x49, 0x21, 0x9a, 0xc9, 0x12,
+    0x91, 0x12, 0xbb, 0x9b, 0x21, 0x24, 0xda, 0x8a, 0x00, 0x31, 0x15, 0x8a, 0xbb, 0x20, 0x93, 0x30,
+    0x0a, 0x9a, 0xba, 0x0a, 0x20, 0xa0, 0x32, 0xb0, 0x9c, 0x29, 0x85, 0x90, 0x18, 0x11, 0x0c, 0xa0,
+    0x11, 0x39, 0x21, 0x01, 0x99, 0x10, 0x00, 0x01, 0xa1, 0x33, 0xb1, 0xba, 0x19, 0x42, 0x01, 0xac,
+    0x00, 0x91, 0x01, 0x01, 0x02, 0xa1, 0x2a, 0xa1, 0x2b, 0x20, 0x19, 0x01, 0xb0, 0x9b, 0x11, 0x12,
+    0x12, 0xb9, 0x9b, 0xa9, 0x23, 0x91, 0x30, 0xb9, 0xaa, 0x29, 0x19, 0x30, 0x99, 0x91, 0xb0, 0x22,
+    0xfe, 0xff, 0x00, 0x00, 0x1a, 0x09, 0xb0, 0x92, 0x99, 0x92, 0x10, 0x09, 0x01, 0x01, 0x3b, 0x0b,
+    0x31, 0xb1, 0xba, 0x91, 0x19, 0x02, 0x11, 0x91, 0x9b, 0xb9, 0x13, 0x11, 0x11, 0x0b, 0xb1, 0x99,
+    0x19, 0x23, 0x19, 0x99, 0x9b, 0x09, 0x39, 0x30, 0x99, 0x90, 0x9b, 0xa1, 0x21, 0x93, 0x11, 0xa0,
+    0xb9, 0x01, 0x10, 0x19, 0x21, 0x99, 0x9a, 0x90, 0x19, 0x21, 0x99, 0xa9, 0x19, 0x99, 0x11, 0x02,
+    0x99, 0xb9, 0x11, 0x11, 0x91, 0x99, 0x2a, 0xa9, 0x11, 0x11, 0x11, 0xa2, 0x10, 0xab, 0x90, 0x01,
+    0x30, 0x99, 0x09, 0x9b, 0x91, 0x02, 0x12, 0x90, 0xa9, 0x9a, 0x30, 0x91, 0x22, 0xb9, 0x90, 0x1b,
+    0x91, 0x29, 0x19, 0x00, 0x99, 0x91, 0x19, 0x99, 0x91, 0xb2, 0x09, 0x19, 0x19, 0x03, 0x00, 0xa1,
+    0xa9, 0x11, 0x1a, 0x90, 0x01, 0x00, 0x3b, 0x99, 0x91, 0x11, 0xa0, 0x91, 0x91, 0x19, 0x90, 0x19,
+    0x11, 0x2a, 0x1a, 0x10, 0x91, 0x29, 0xa1, 0x90, 0xa1, 0x21, 0x91, 0x09, 0xa9, 0x11, 0x90, 0x30,
+    0x1a, 0x9a, 0x91, 0x99, 0x11, 0x10, 0x92, 0x1b, 0x90, 0x01, 0x10, 0x91, 0x99, 0xa1, 0x29, 0x90,
+    0x19, 0x1a, 0xa2, 0xa0, 0x11, 0x91, 0x31, 0x9b, 0x93, 0x09, 0x19, 0x09, 0x00, 0xa1, 0x12, 0x1b,
+    0x99, 0x11, 0x99, 0xa1, 0x01, 0x01, 0x11, 0xa1, 0x00, 0x10, 0x09, 0x91, 0x19, 0x19, 0x02, 0x0a,
+    0x00, 0x99, 0x09, 0x91, 0x91, 0x21, 0x09, 0x91, 0x99, 0x39, 0x99, 0x19, 0x91, 0x90, 0x11, 0x11,
+    0x11, 0x10, 0x00, 0xa9, 0x10, 0x11, 0x99, 0x00, 0x10, 0x39, 0x91, 0x11, 0x92, 0xb0, 0x01, 0x1a,
+    0x19, 0x11, 0x91, 0x99, 0x2a, 0xb2, 0x01, 0x90, 0x99, 0x09, 0x30, 0x99, 0x03, 0xb9, 0x10, 0x19,
+    0x02, 0x1b, 0x03, 0x99, 0x19, 0x00, 0x99, 0x11, 0x92, 0x91, 0x09, 0x99, 0x91, 0x92, 0x19, 0x10,
+    0xcd, 0xff, 0x00, 0x00, 0xa1, 0x01, 0x99, 0x93, 0x2a, 0x09, 0x11, 0x29, 0x0b, 0x01, 0x30, 0x90,
+    0x99, 0x91, 0x39, 0x19, 0x91, 0x90, 0x11, 0x99, 0x00, 0x19, 0x11, 0xa0, 0x91, 0x99, 0x01, 0x99,
+    0x9a, 0x11, 0x90, 0x39, 0x19, 0x10, 0x90, 0x19, 0x99, 0x09, 0x01, 0xa1, 0x90, 0x99, 0x29, 0x91,
+    0x91, 0x99, 0x00, 0x99, 0x13, 0x11, 0x99, 0x01, 0x99, 0x39, 0x0a, 0xa3, 0x99, 0x01, 0x19, 0x11,
+    0x99, 0x10, 0xa1, 0x19, 0x01, 0x12, 0x11, 0x90, 0x01, 0x09, 0x19, 0x09, 0x91, 0x00, 0x90, 0x12,
+    0x19, 0x91, 0x19, 0x01, 0x01, 0x99, 0x10, 0x02, 0x90, 0x00, 0xa0, 0x19, 0x09, 0x10, 0x91, 0x11,
+    0x12, 0xa9, 0x19, 0x09, 0xa0, 0x01, 0x11, 0x91, 0x00, 0x39, 0x19, 0x99, 0x99, 0x99, 0x90, 0x03,
+    0x11, 0x20, 0x9b, 0x3a, 0x09, 0x11, 0xa1, 0x01, 0x00, 0x09, 0x01, 0x01, 0x19, 0x0a, 0xa1, 0x30,
+    0x11, 0x91, 0x29, 0x1b, 0xa0, 0x13, 0x99, 0x91, 0x29, 0x1a, 0x99, 0x93, 0x90, 0x99, 0x09, 0x00,
+    0x99, 0x11, 0x11, 0x1a, 0x91, 0x99, 0x01, 0x09, 0x13, 0x19, 0x11, 0x99, 0x19, 0xa2, 0x91, 0x39,
+    0xa9, 0x10, 0x99, 0x91, 0x91, 0x19, 0x10, 0xa9, 0x11, 0x29, 0xb1, 0x11, 0x91, 0x99, 0x91, 0x19,
+    0x20, 0x90, 0x21, 0xb9, 0x92, 0x09, 0x11, 0x01, 0x1a, 0x19, 0x19, 0x01, 0xa9, 0xa1, 0x21, 0x09,
+    0x91, 0x11, 0x99, 0x09, 0x90, 0x21, 0x99, 0x01, 0x19, 0x90, 0x01, 0x09, 0x10, 0x09, 0x11, 0x99,
+    0x91, 0x91, 0x10, 0xa0, 0x92, 0x01, 0x90, 0x09, 0x30, 0x1a, 0x12, 0x90, 0xa1, 0x10, 0x20, 0xa0,
+    0x09, 0x91, 0x09, 0x99, 0x92, 0x10, 0x99, 0x91, 0x10, 0x91, 0x10, 0x10, 0x1b, 0x93, 0x19, 0x91,
+    0x91, 0x19, 0x19, 0x11, 0x99, 0x11, 0xb0, 0x91, 0x91, 0x10, 0x19, 0x11, 0x09, 0x99, 0x01, 0x21,
+    0xd5, 0xff, 0x00, 0x00, 0xa1, 0x00, 0x19, 0xa9, 0x93, 0x10, 0x29, 0x1a, 0x19, 0x90, 0x19, 0x19,
+    0x90, 0x00, 0x91, 0x91, 0x91, 0x21, 0x09, 0x9a, 0x12, 0x19, 0x11, 0x1a, 0x91, 0x00, 0x91, 0x09,
+    0x19, 0x00, 0x00, 0x2a, 0x10, 0xb3, 0x90, 0x11, 0x01, 0x1a, 0xa2, 0x29, 0x19, 0x01, 0x90, 0x09,
+    0x10, 0x00, 0x90, 0x01, 0x11, 0xa1, 0x19, 0x19, 0x19, 0x91, 0x09, 0x11, 0x99, 0x19, 0x01, 0x11,
+    0x1a, 0x9b, 0x11, 0x93, 0x92, 0x01, 0x99, 0xc2, 0x10, 0x01, 0x1a, 0x12, 0x91, 0x09, 0x1b, 0x92,
+    0x19, 0x00, 0x99, 0x01, 0x09, 0x21, 0x99, 0xa9, 0x11, 0xa3, 0x00, 0xa2, 0x09, 0x90, 0x19, 0x30,
+    0x9b, 0x11, 0x09, 0x92, 0x90, 0x30, 0x1a, 0x29, 0xb0, 0x12, 0x00, 0x99, 0x90, 0x11, 0x91, 0x1a,
+    0xb1, 0x91, 0x21, 0x1b, 0x20, 0xb9, 0x01, 0x01, 0x19, 0x19, 0x91, 0x99, 0x11, 0x19, 0x92, 0x10,
+    0x99, 0x09, 0x19, 0x03, 0x91, 0x99, 0x09, 0x10, 0x19, 0x91, 0x10, 0x90, 0x91, 0x09, 0xb3, 0x19,
+    0x1a, 0x31, 0x90, 0x1a, 0x10, 0x91, 0xb2, 0x10, 0x20, 0x11, 0x99, 0x90, 0xb9, 0x03, 0xa9, 0x39,
+    0x91, 0x99, 0x01, 0x00, 0xb1, 0x31, 0x29, 0x3b, 0x99, 0x99, 0x90, 0x20, 0x92, 0x90, 0x90, 0x99,
+    0x21, 0x0b, 0x21, 0x91, 0xb1, 0x10, 0x00, 0x10, 0x90, 0x39, 0xa9, 0x11, 0x10, 0x09, 0x19, 0x99,
+    0xb2, 0x21, 0xb9, 0x31, 0x09, 0xa1, 0x12, 0x90, 0xa3, 0x99, 0x90, 0x92, 0x1b, 0x30, 0x19, 0x99,
+    0x19, 0x00, 0x01, 0x09, 0x20, 0xb9, 0x12, 0xb2, 0x99, 0x02, 0x29, 0x91, 0x09, 0x92, 0x99, 0x99,
+    0x01, 0x21, 0x1a, 0x09, 0x3b, 0x19, 0x09, 0x93, 0xb1, 0x91, 0x01, 0x29, 0x09, 0xb3, 0x90, 0xa1,
+    0x01, 0x11, 0x91, 0x19, 0x19, 0x1a, 0x11, 0x91, 0x93, 0x2b, 0xa9, 0x11, 0x2a, 0x20, 0xb9, 0xa3,
+    0xde, 0xff, 0x00, 0x00, 0x1a, 0x03, 0x00, 0x90, 0x00, 0x00, 0x1b, 0x93, 0x09, 0x00, 0x91, 0x92,
+    0x09, 0x90, 0x19, 0x91, 0x91, 0x2b, 0x90, 0x90, 0x31, 0x90, 0x92, 0x99, 0xa3, 0x19, 0x09, 0x1a,
+    0x02, 0x09, 0x91, 0x00, 0x29, 0xb1, 0x91, 0xa9, 0x30, 0x9a, 0x93, 0x10, 0x11, 0x19, 0x00, 0x01,
+    0x9a, 0x01, 0xb2, 0x91, 0x22, 0x9b, 0x19, 0x1a, 0x91, 0xa2, 0x11, 0x2b, 0xa2, 0x91, 0x00, 0x20,
+    0x09, 0xb1, 0x11, 0x10, 0x91, 0x90, 0x29, 0x10, 0x09, 0xa0, 0x01, 0x00, 0x19, 0x11, 0x0b, 0x92,
+    0xa0, 0x00, 0x11, 0x31, 0xb1, 0x10, 0x1a, 0x19, 0x10, 0xa1, 0x01, 0x99, 0x91, 0x10, 0x30, 0x09,
+    0xa9, 0x39, 0x09, 0xb2, 0x91, 0x09, 0x93, 0x1b, 0x91, 0x11, 0x20, 0xa9, 0x11, 0x10, 0x10, 0x19,
+    0x09, 0xc1, 0x11, 0x19, 0xb9, 0x11, 0x29, 0xa0, 0x11, 0x01, 0x10, 0x99, 0xa0, 0x11, 0xc3, 0x10,
+    0x29, 0x10, 0x99, 0x19, 0x10, 0x2b, 0xa9, 0x22, 0x99, 0x90, 0x91, 0x91, 0x90, 0x21, 0x99, 0x99,
+    0x10, 0x11, 0x1a, 0xa1, 0x92, 0x99, 0x21, 0x99, 0x02, 0x99, 0x10, 0x99, 0x99, 0x91, 0x93, 0x1a,
+    0x01, 0xb2, 0x93, 0x1b, 0x91, 0x1b, 0x11, 0x10, 0x19, 0x1a, 0x00, 0x92, 0x00, 0x91, 0x09, 0x12,
+    0x90, 0x00, 0x09, 0xa9, 0xb3, 0x03, 0x29, 0x99, 0x10, 0xa0, 0x30, 0x02, 0x19, 0x0b, 0x00, 0x1b,
+    0xb3, 0x02, 0x11, 0x2b, 0xa1, 0x01, 0x91, 0x90, 0x91, 0x19, 0x39, 0x0a, 0x0b, 0x01, 0x02, 0x2a,
+    0x1a, 0x11, 0x11, 0xa1, 0x19, 0x01, 0x39, 0x90, 0x09, 0xb1, 0x09, 0x91, 0x10, 0x10, 0x00, 0x99,
+    0x19, 0x91, 0x39, 0xa0, 0x11, 0x01, 0x99, 0x91, 0x9a, 0x21, 0x99, 0x10, 0x92, 0x01, 0x0b, 0x11,
+    0xa3, 0x20, 0x2b, 0x99, 0x1a, 0x92, 0x99, 0x91, 0xa2, 0x19, 0x19, 0x19, 0x91, 0xa1, 0x13, 0x1b,
+    0xdd, 0xff, 0x00, 0x00, 0x91, 0x29, 0xa1, 0x10, 0x91, 0x01, 0x09, 0x11, 0xa9, 0x92, 0x10, 0x11,
+    0x90, 0x91, 0x00, 0x2b, 0x1a, 0x92, 0xb9, 0x93, 0x2a, 0x10, 0x99, 0x19, 0x19, 0x09, 0xa2, 0x91,
+    0x20, 0x90, 0x11, 0x91, 0x99, 0xa2, 0x19, 0x21, 0x0a, 0x10, 0x09, 0x90, 0x11, 0x29, 0x99, 0x99,
+    0x20, 0x90, 0x10, 0x19, 0xa0, 0x11, 0x91, 0x20, 0xa1, 0x91, 0x29, 0x1b, 0x02, 0x0a, 0x10, 0x11,
+    0x19, 0x99, 0xa1, 0x12, 0x91, 0x90, 0x91, 0x3b, 0x00, 0x99, 0xa3, 0x01, 0x10, 0x19, 0xa9, 0x02,
+    0x99, 0x39, 0x19, 0x4b, 0xa9, 0x11, 0x00, 0xa1, 0x93, 0x99, 0x91, 0x11, 0x91, 0x11, 0x99, 0x11,
+    0x09, 0x93, 0x99, 0x29, 0x9a, 0x20, 0x09, 0x09, 0x99, 0x01, 0x39, 0xb9, 0x94, 0xa0, 0x21, 0x3a,
+    0x90, 0xa1, 0x31, 0x0b, 0x11, 0x00, 0xb2, 0x19, 0x30, 0xa9, 0x12, 0x0b, 0x00, 0x01, 0xa2, 0x91,
+    0x19, 0x2a, 0x19, 0x10, 0xb3, 0x91, 0x99, 0x3a, 0xa0, 0xa2, 0x11, 0x11, 0x1a, 0x09, 0x91, 0x91,
+    0x09, 0x1a, 0x1a, 0x90, 0x03, 0x91, 0x11, 0x09, 0xa9, 0x20, 0x00, 0x20, 0x90, 0x99, 0x11, 0x99,
+    0x11, 0x90, 0xa3, 0x10, 0x91, 0x29, 0x0b, 0x11, 0x09, 0x10, 0x09, 0x2a, 0xa2, 0x92, 0xb9, 0x92,
+    0x19, 0x01, 0x21, 0x09, 0x99, 0x19, 0x90, 0x19, 0x11, 0xa0, 0x01, 0x29, 0x0a, 0x09, 0x00, 0xb1,
+    0x94, 0xb1, 0x11, 0x00, 0x19, 0x11, 0x1a, 0x90, 0x99, 0x01, 0x21, 0x99, 0xa2, 0x09, 0x91, 0x20,
+    0x91, 0xa9, 0x13, 0x1a, 0x10, 0x2a, 0x09, 0x11, 0xa9, 0x12, 0x2b, 0xa1, 0xb2, 0x11, 0x29, 0x1b,
+    0x91, 0xa0, 0x21, 0xa1, 0x12, 0x1b, 0x11, 0xa1, 0x01, 0x90, 0x91, 0x09, 0x00, 0xb2, 0x31, 0x90,
+    0x19, 0x29, 0x99, 0x09, 0xa1, 0x11, 0x91, 0x19, 0x29, 0xa9, 0xa3, 0x21, 0x9a, 0x00, 0x00, 0x01,
+    0xe4, 0xff, 0x00, 0x00, 0x09, 0x10, 0x01, 0x19, 0x91, 0x99, 0x11, 0x10, 0x01, 0x39, 0xaa, 0x91,
+    0x12, 0x1a, 0xa1, 0x93, 0x11, 0x2b, 0x99, 0x20, 0x09, 0x90, 0x90, 0x99, 0x92, 0x19, 0x13, 0x99,
+    0x9a, 0x03, 0x09, 0x99, 0xb2, 0x00, 0x19, 0x09, 0x10, 0x11, 0x10, 0x99, 0x09, 0x90, 0x90, 0x11,
+    0x92, 0x09, 0x2b, 0xc2, 0x12, 0x2a, 0xa9, 0xa3, 0xb2, 0x39, 0x3b, 0x39, 0xb0, 0x11, 0x1a, 0x19,
+    0x91, 0x92, 0x00, 0xa9, 0x01, 0x19, 0x01, 0x91, 0x02, 0x99, 0x90, 0x01, 0x1a, 0x29, 0x10, 0x2b,
+    0x90, 0x90, 0x11, 0x01, 0x01, 0x90, 0x00, 0x00, 0x19, 0x90, 0x09, 0x29, 0x99, 0x99, 0x02, 0x39,
+    0xb0, 0x12, 0x1c, 0x90, 0x01, 0x01, 0xb0, 0x00, 0x01, 0x11, 0x10, 0x10, 0x0b, 0x02, 0x11, 0x91,
+    0x00, 0x10, 0x19, 0xa9, 0x91, 0x09, 0x00, 0x19, 0xa3, 0x13, 0x9b, 0x00, 0x11, 0xb9, 0x10, 0x00,
+    0xb2, 0x11, 0x01, 0x19, 0x99, 0x01, 0x19, 0x92, 0x19, 0x1a, 0x91, 0x19, 0x10, 0x93, 0xa0, 0x11,
+    0x2a, 0x1b, 0x02, 0xa1, 0xa1, 0x13, 0x19, 0x90, 0x11, 0x09, 0x99, 0x90, 0x99, 0x92, 0x21, 0x1a,
+    0xa1, 0x91, 0x99, 0x31, 0x9b, 0x92, 0x11, 0x11, 0x90, 0x99, 0x10, 0xb2, 0x10, 0x1b, 0x29, 0x11,
+    0x93, 0xb9, 0x39, 0x9a, 0xb3, 0x11, 0x19, 0xb0, 0xa1, 0x93, 0x1a, 0x1a, 0x11, 0x02, 0x0a, 0x92,
+    0x39, 0x01, 0x91, 0x1a, 0x11, 0xa0, 0x91, 0x93, 0x19, 0x99, 0xa2, 0x19, 0x29, 0x09, 0x01, 0x90,
+    0x09, 0x90, 0x19, 0x11, 0x99, 0x90, 0x92, 0x09, 0x92, 0x3b, 0x2a, 0x9b, 0x12, 0x10, 0xa1, 0x29,
+    0x19, 0x2a, 0x90, 0x01, 0x11, 0xa9, 0x19, 0x01, 0x99, 0x10, 0x91, 0x99, 0x29, 0x11, 0x91, 0x99,
+    0x99, 0x01, 0x92, 0x1a, 0x09, 0x02, 0x99, 0x4a, 0x09, 0x09, 0x2a, 0x93, 0x99, 0x19, 0x29, 0xa1,
+    0xea, 0xff, 0x00, 0x00, 0x2a, 0x99, 0x99, 0x01, 0x10, 0x19, 0x92, 0x09, 0x90, 0x90, 0x92, 0x91,
+    0x10, 0x1a, 0x00, 0x11, 0x01, 0x1b, 0x91, 0x11, 0x00, 0x99, 0x92, 0x1a, 0xb1, 0x11, 0x00, 0x09,
+    0x11, 0x91, 0x10, 0x1a, 0xa1, 0x92, 0xa0, 0x31, 0x29, 0x99, 0xa9, 0x12, 0x01, 0x11, 0x99, 0xa0,
+    0x10, 0x19, 0x00, 0x93, 0x1a, 0x90, 0x09, 0x11, 0x39, 0xa9, 0x00, 0x00, 0x11, 0xb0, 0x92, 0x91,
+    0x1a, 0x92, 0x11, 0x0b, 0x92, 0x39, 0x09, 0x1a, 0x19, 0x01, 0x01, 0x1a, 0x20, 0x9b, 0x92, 0x11,
+    0x11, 0xb0, 0x91, 0x19, 0x92, 0x1a, 0x01, 0x10, 0x3b, 0x00, 0x90, 0x09, 0x91, 0xb1, 0x91, 0x10,
+    0x02, 0x19, 0x19, 0x91, 0x90, 0x09, 0x2b, 0x10, 0xa3, 0x21, 0x99, 0x99, 0x2a, 0xa1, 0x21, 0xa9,
+    0x90, 0x09, 0x11, 0x11, 0x91, 0x01, 0x19, 0x3b, 0x1b, 0x92, 0xa1, 0x91, 0x01, 0x39, 0x99, 0xa9,
+    0x11, 0x19, 0x19, 0x00, 0x93, 0xa1, 0x10, 0x90, 0x02, 0x09, 0x39, 0x19, 0x91, 0xb9, 0xb2, 0x31,
+    0x00, 0x01, 0x0b, 0x99, 0x30, 0x10, 0x19, 0x09, 0xb1, 0x12, 0x09, 0x91, 0x19, 0x01, 0xa9, 0x12,
+    0x0a, 0x93, 0x00, 0x99, 0xa1, 0x20, 0x3a, 0x10, 0x0a, 0x00, 0x93, 0x00, 0xb9, 0x21, 0x09, 0x09,
+    0x11, 0xa1, 0x91, 0x19, 0x11, 0x19, 0xa9, 0x10, 0x21, 0x09, 0xb9, 0x03, 0x19, 0x90, 0xa9, 0x21,
+    0xa9, 0x31, 0x99, 0x11, 0x91, 0x19, 0x11, 0x19, 0x1b, 0xb2, 0x93, 0xa1, 0x11, 0x19, 0x92, 0xa9,
+    0x20, 0x01, 0x00, 0x99, 0x11, 0x91, 0x19, 0x90, 0x21, 0xb0, 0x21, 0x0a, 0x19, 0x93, 0xab, 0x92,
+    0x21, 0x29, 0x1a, 0x99, 0x09, 0x00, 0x19, 0xb2, 0x93, 0x01, 0x19, 0x09, 0x29, 0x9a, 0x01, 0x09,
+    0x19, 0x92, 0xa2, 0x19, 0x1a, 0x19, 0x01, 0x99, 0x11, 0x90, 0x01, 0xb3, 0x21, 0x09, 0x0b, 0x11,
+    0xea, 0xff, 0x00, 0x00, 0x21, 0x09, 0x09, 0x30, 0x1a, 0xa0, 0x91, 0x00, 0x21, 0xa0, 0x19, 0x00,
+    0x10, 0x00, 0x01, 0x11, 0x99, 0x10, 0xc3, 0x00, 0x39, 0x10, 0xb1, 0x9a, 0x11, 0x19, 0x20, 0x2b,
+    0x11, 0xb9, 0x92, 0x00, 0x00, 0x01, 0x3a, 0x91, 0x99, 0x00, 0x10, 0x90, 0x19, 0x19, 0x90, 0x91,
+    0x01, 0x90, 0x90, 0x91, 0x00, 0x92, 0x19, 0x3b, 0x90, 0x11, 0xa9, 0x21, 0x19, 0x99, 0xb9, 0x21,
+    0x90, 0x03, 0x01, 0x99, 0x19, 0x99, 0x21, 0xb9, 0x01, 0x91, 0x99, 0x01, 0x1a, 0x31, 0x09, 0x99,
+    0x00, 0x09, 0x12, 0x19, 0x19, 0x90, 0x9a, 0x03, 0x99, 0x10, 0x01, 0x01, 0x92, 0x19, 0x1b, 0x10,
+    0xa2, 0x90, 0x19, 0xb9, 0x21, 0x99, 0x91, 0x00, 0x20, 0x90, 0x19, 0x91, 0x91, 0x1a, 0x00, 0x12,
+    0x91, 0x09, 0x99, 0x99, 0x39, 0x19, 0x10, 0x01, 0x99, 0x11, 0x90, 0x09, 0xb2, 0x11, 0x99, 0x10,
+    0x20, 0x0b, 0x91, 0x39, 0x99, 0x10, 0x09, 0x11, 0xa1, 0x91, 0x93, 0x9b, 0x11, 0x39, 0x99, 0x11,
+    0x3b, 0x19, 0xa1, 0xba, 0x23, 0x10, 0x0a, 0x02, 0x99, 0x91, 0x90, 0x19, 0xa2, 0x99, 0x01, 0x11,
+    0x09, 0x09, 0x21, 0x19, 0x01, 0x19, 0x2b, 0x90, 0x9a, 0x19, 0x92, 0xb0, 0xb3, 0x93, 0x19, 0xa3,
+    0x09, 0x01, 0x2b, 0x3a, 0x91, 0x99, 0x01, 0x19, 0x19, 0xb2, 0x01, 0x39, 0x9a, 0x01, 0x91, 0x19,
+    0x29, 0x99, 0x92, 0x90, 0x00, 0x11, 0x00, 0x91, 0x91, 0x1b, 0x19, 0x02, 0x10, 0x1a, 0x29, 0x99,
+    0x11, 0xa0, 0x11, 0x91, 0x29, 0x99, 0x2b, 0xa1, 0x13, 0x91, 0x09, 0x09, 0x19, 0x02, 0x09, 0x39,
+    0x0a, 0x09, 0x19, 0x2a, 0x91, 0x91, 0x09, 0x09, 0xa3, 0x20, 0xa1, 0x10, 0x11, 0x9a, 0x91, 0x11,
+    0x2b, 0xb0, 0x01, 0x90, 0x3b, 0x91, 0xa3, 0x01, 0x90, 0x3a, 0x20, 0x99, 0x91, 0x91, 0x01, 0x19,
+    0xef, 0xff, 0x00, 0x00, 0x91, 0x01, 0x09, 0x19, 0x91, 0x19, 0x31, 0x99, 0x9a, 0x91, 0x29, 0x99,
+    0x09, 0x11, 0x01, 0xb9, 0x11, 0x10, 0x19, 0x01, 0xa1, 0x29, 0x90, 0x09, 0x31, 0x99, 0x01, 0x1a,
+    0x99, 0xa3, 0xa2, 0x11, 0x2a, 0x01, 0x19, 0x10, 0x99, 0x00, 0x91, 0x01, 0x0a, 0x01, 0xa0, 0x13,
+    0x19, 0x19, 0x99, 0x11, 0x01, 0x90, 0x09, 0x19, 0x19, 0xa1, 0x91, 0xb3, 0x91, 0x39, 0x02, 0x19,
+    0x1a, 0x19, 0x01, 0x09, 0x99, 0x91, 0x10, 0x99, 0x01, 0x91, 0x19, 0x0b, 0x93, 0x20, 0x1a, 0x90,
+    0xb0, 0x23, 0xb0, 0x11, 0x99, 0x20, 0x0a, 0x00, 0x00, 0x91, 0x3b, 0x39, 0x1a, 0x91, 0xc2, 0x02,
+    0xc1, 0x81, 0x31, 0x09, 0x19, 0x1b, 0x91, 0xb1, 0x11, 0x19, 0x39, 0x09, 0x00, 0x91, 0x00, 0xa0,
+    0x12, 0x11, 0x29, 0xb9, 0x09, 0x19, 0xa1, 0x92, 0x01, 0x11, 0x1a, 0x19, 0xb1, 0x91, 0x01, 0x4b,
+    0x1a, 0x00, 0x09, 0x91, 0x93, 0xa9, 0x93, 0x1b, 0x30, 0x9a, 0x91, 0xa2, 0x11, 0x9a, 0x22, 0x91,
+    0x10, 0x2a, 0xa1, 0x01, 0x2b, 0x01, 0x12, 0xa9, 0x01, 0x09, 0x09, 0x91, 0x11, 0x91, 0x1a, 0x11,
+    0xa3, 0x91, 0x91, 0x0b, 0x19, 0x91, 0x11, 0x99, 0x91, 0xa1, 0x11, 0x90, 0x49, 0x99, 0x11, 0x91,
+    0x91, 0x1a, 0x00, 0x11, 0x39, 0x9b, 0xa2, 0x91, 0x01, 0x19, 0x01, 0x99, 0x19, 0x91, 0x3a, 0x11,
+    0x99, 0x91, 0x10, 0x19, 0xa2, 0x00, 0x29, 0x99, 0x10, 0x00, 0x10, 0x0a, 0x91, 0x92, 0x19, 0x09,
+    0x10, 0x90, 0x93, 0xb0, 0x12, 0x99, 0x19, 0x19, 0x10, 0x90, 0x2a, 0x11, 0x2a, 0xb1, 0x00, 0x92,
+    0x99, 0x91, 0xb2, 0x39, 0x9a, 0xa1, 0x19, 0x11, 0x02, 0x00, 0xa9, 0x11, 0x11, 0x90, 0x19, 0x91,
+    0xa0, 0x11, 0x01, 0xb2, 0x10, 0x09, 0x10, 0x92, 0x10, 0x1a, 0x90, 0x19, 0x11, 0x90, 0x10, 0x10,
+    0xf1, 0xff, 0x00, 0x00, 0x99, 0x20, 0x09, 0x11, 0xb0, 0x4b, 0x98, 0x11, 0x00, 0x00, 0x0a, 0x01,
+    0x09, 0xa1, 0x02, 0x92, 0x09, 0xa2, 0x10, 0x29, 0x99, 0x19, 0x20, 0x1b, 0xa9, 0x11, 0x21, 0x19,
+    0xaa, 0x91, 0x11, 0x03, 0xb9, 0x02, 0x1a, 0x91, 0x09, 0x19, 0x31, 0xb9, 0x01, 0x2a, 0xa2, 0x19,
+    0x21, 0x1a, 0x11, 0x09, 0x19, 0x00, 0x10, 0x09, 0xb1, 0xa1, 0x11, 0x11, 0x19, 0x99, 0x09, 0x10,
+    0x09, 0x02, 0xa1, 0x11, 0xb1, 0x11, 0x29, 0x99, 0x01, 0x00, 0x9a, 0x11, 0x11, 0x09, 0xa9, 0xb4,
+    0x02, 0x1b, 0x19, 0x00, 0x11, 0x91, 0x99, 0x00, 0x3a, 0xa2, 0x90, 0x19, 0x19, 0xa2, 0x01, 0x01,
+    0x91, 0x99, 0xa9, 0x12, 0x92, 0x19, 0x1a, 0x01, 0x19, 0x11, 0x19, 0xa9, 0x03, 0x00, 0x0a, 0x03,
+    0x39, 0x9b, 0xa9, 0x93, 0x1a, 0x13, 0x90, 0x00, 0x99, 0x11, 0x19, 0x00, 0x29, 0x2b, 0xb1, 0x93,
+    0x09, 0x91, 0x21, 0xb9, 0x21, 0x0a, 0x10, 0x19, 0x90, 0x90, 0x91, 0x10, 0x91, 0x01, 0x19, 0x91,
+    0x1b, 0x21, 0x99, 0x91, 0x93, 0x09, 0x11, 0x1b, 0x10, 0x19, 0x10, 0xa9, 0x09, 0x01, 0x91, 0xb3,
+    0xb2, 0x21, 0x09, 0x3a, 0x11, 0x1b, 0x10, 0x99, 0x12, 0x0a, 0x99, 0x10, 0xa1, 0x91, 0x99, 0x11,
+    0x90, 0x03, 0xb0, 0x21, 0xb9, 0x11, 0x29, 0x99, 0x2b, 0x91, 0x99, 0x91, 0x91, 0x93, 0x1a, 0x19,
+    0x00, 0x90, 0x11, 0x92, 0x99, 0x01, 0x21, 0x9b, 0xb2, 0x10, 0x11, 0x1b, 0x20, 0x99, 0xb2, 0x03,
+    0xb1, 0x39, 0x1b, 0xb3, 0x19, 0x19, 0x19, 0x90, 0x19, 0x11, 0x91, 0x99, 0x39, 0x91, 0x19, 0xa0,
+    0x11, 0x90, 0x01, 0x09, 0x39, 0x1b, 0xb2, 0x01, 0x19, 0x11, 0xa2, 0x1b, 0x12, 0x1a, 0x90, 0x31,
+    0x09, 0x99, 0x91, 0x00, 0x91, 0x91, 0x10, 0x20, 0x09, 0x90, 0x10, 0x19, 0x91, 0x01, 0x91, 0x99,
+    0xee, 0xff, 0x00, 0x00, 0x03, 0x91, 0x91, 0x11, 0x9a, 0x19, 0x11, 0x10, 0x1b, 0x01, 0x91, 0x11,
+    0x90, 0x90, 0x11, 0x09, 0x10, 0xa0, 0x11, 0x3b, 0xa2, 0x99, 0x10, 0x00, 0x11, 0x10, 0x90, 0x1b,
+    0x00, 0x12, 0xa0, 0x91, 0x10, 0x19, 0x91, 0x91, 0x91, 0x1a, 0x01, 0x2b, 0x99, 0x92, 0x11, 0xa0,
+    0x91, 0x99, 0x92, 0x11, 0x09, 0x01, 0x99, 0x09, 0x0a, 0x91, 0x99, 0x10, 0x01, 0x09, 0x29, 0x09,
+    0xb2, 0x93, 0x01, 0x91, 0x90, 0x01, 0x99, 0x3b, 0x01, 0x3b, 0x90, 0x00, 0x11, 0x01, 0x19, 0x09,
+    0x90, 0x90, 0x10, 0x99, 0x92, 0x99, 0x11, 0x1a, 0x99, 0x11, 0x1b, 0x12, 0xa1, 0x91, 0x21, 0xb9,
+    0x11, 0x19, 0x11, 0x1a, 0x01, 0x99, 0x19, 0x93, 0x09, 0x19, 0x2b, 0x11, 0x29, 0x01, 0xb9, 0x01,
+    0x92, 0x01, 0x09, 0x10, 0xb3, 0x90, 0x11, 0x1a, 0x39, 0x19, 0x11, 0xb9, 0x29, 0x1a, 0x21, 0x90,
+    0xb0, 0x10, 0xa2, 0x09, 0x01, 0x20, 0x99, 0x10, 0xb0, 0x11, 0x01, 0x19, 0x20, 0x1a, 0x90, 0x01,
+    0x11, 0x11, 0x09, 0x09, 0x99, 0x91, 0x19, 0x01, 0x11, 0x99, 0x90, 0x90, 0x90, 0x30, 0x09, 0x91,
+    0x99, 0x12, 0x9a, 0x93, 0x00, 0x00, 0x1a, 0x09, 0x09, 0x01, 0x2a, 0xa2, 0x11, 0x90, 0x01, 0xba,
+    0x33, 0x1a, 0x99, 0x01, 0x39, 0xa9, 0x11, 0x01, 0x92, 0x0a, 0x19, 0x10, 0x00, 0xa9, 0x21, 0x02,
+    0x19, 0xb9, 0x20, 0x91, 0x93, 0x99, 0x90, 0x19, 0x09, 0x20, 0x1a, 0x92, 0x2a, 0x9a, 0xa4, 0x19,
+    0xa3, 0x31, 0x99, 0x09, 0x0a, 0x10, 0x91, 0xa2, 0x09, 0x91, 0x10, 0x91, 0xb9, 0x13, 0x29, 0x99,
+    0x19, 0xb3, 0x21, 0xc0, 0x10, 0x1b, 0x31, 0xa9, 0x91, 0x29, 0x3a, 0x09, 0x11, 0x0b, 0x93, 0x99,
+    0x91, 0x91, 0x10, 0x11, 0x99, 0x99, 0x30, 0xb9, 0x93, 0xa2, 0x4a, 0x09, 0xa0, 0x19, 0x13, 0x9b,
+    0xf0, 0xff, 0x00, 0x00, 0x11, 0x90, 0x90, 0x29, 0xb2, 0x01, 0x0a, 0xb2, 0x39, 0x3a, 0x19, 0x0a,
+    0x11, 0x01, 0x19, 0x01, 0x91, 0x99, 0x02, 0x1b, 0x92, 0xa2, 0x19, 0x99, 0x91, 0x09, 0x11, 0x3b,
+    0x00, 0x99, 0x11, 0x91, 0x92, 0x1b, 0xa1, 0x39, 0x91, 0x19, 0x11, 0x99, 0x92, 0x3b, 0xa1, 0x19,
+    0x92, 0xa0, 0x00, 0x29, 0x99, 0x01, 0x29, 0x1a, 0x91, 0x20, 0x10, 0xb9, 0xa1, 0x13, 0x99, 0x09,
+    0x99, 0x11, 0x01, 0x99, 0x01, 0x29, 0x22, 0x1b, 0x1a, 0x19, 0xb1, 0x00, 0x13, 0xb9, 0x31, 0x0b,
+    0x19, 0x91, 0x11, 0x01, 0x99, 0x90, 0x01, 0x19, 0x10, 0x09, 0xa1, 0x90, 0x92, 0x0a, 0x01, 0x31,
+    0x99, 0x29, 0xa9, 0x21, 0x19, 0x19, 0xb0, 0x91, 0x00, 0x91, 0x30, 0x99, 0x91, 0x09, 0x09, 0x01,
+    0x11, 0x99, 0x00, 0x99, 0x31, 0x1a, 0x90, 0x90, 0xb3, 0x11, 0x19, 0x02, 0x1a, 0xa1, 0xa1, 0x03,
+    0x99, 0x92, 0x1a, 0x00, 0x10, 0x09, 0x11, 0x10, 0x09, 0x9a, 0x31, 0x00, 0x0b, 0x93, 0x91, 0x91,
+    0xa9, 0x11, 0x21, 0x90, 0x11, 0xa9, 0x99, 0x21, 0x1a, 0x20, 0x19, 0x9b, 0x01, 0x09, 0x10, 0xa1,
+    0x11, 0xa1, 0x92, 0x4b, 0xa9, 0x13, 0x01, 0x01, 0x1b, 0x91, 0x31, 0x09, 0x9a, 0x11, 0x90, 0x19,
+    0x91, 0x91, 0x39, 0xb2, 0x0a, 0x20, 0x92, 0x9a, 0x11, 0x1a, 0x92, 0x90, 0x30, 0x10, 0x9a, 0x91,
+    0x91, 0x31, 0x9b, 0x19, 0xb1, 0x11, 0x31, 0x1a, 0x19, 0x2a, 0xb9, 0x11, 0x31, 0x9a, 0x19, 0x91,
+    0xa1, 0xa3, 0x29, 0x09, 0x90, 0x99, 0x13, 0x99, 0x3a, 0x3a, 0x01, 0xa9, 0x11, 0x90, 0x00, 0x91,
+    0x91, 0x90, 0x91, 0x2b, 0x03, 0x9a, 0x11, 0x09, 0x29, 0x91, 0x19, 0x19, 0x99, 0x19, 0x11, 0x01,
+    0xa0, 0x92, 0x09, 0x01, 0x90, 0x31, 0x09, 0x1b, 0x91, 0x91, 0x19, 0x92, 0x0b, 0x90, 0x01, 0x19,
+    0xf4, 0xff, 0x00, 0x00, 0x09, 0x09, 0x03, 0x99, 0x3a, 0xa1, 0x91, 0x21, 0xa9, 0x01, 0x01, 0x01,
+    0x30, 0x0b, 0x91, 0x20, 0xa9, 0x01, 0x01, 0x10, 0xa1, 0x9a, 0x11, 0x21, 0x1b, 0x3b, 0xb1, 0xa2,
+    0x90, 0x31, 0x3b, 0xb9, 0x30, 0x09, 0x90, 0xb2, 0x01, 0x01, 0x91, 0x19, 0x29, 0x99, 0x30, 0x0b,
+    0x91, 0xa0, 0x92, 0x91, 0x11, 0x29, 0x91, 0x00, 0x2b, 0x93, 0x99, 0xa9, 0x19, 0x01, 0x20, 0x29,
+    0x99, 0xb1, 0x90, 0x21, 0x1b, 0xa2, 0x29, 0x19, 0x90, 0x19, 0xa2, 0x11, 0x99, 0x39, 0x0b, 0xc2,
+    0x11, 0x09, 0x00, 0x99, 0x10, 0x3a, 0x99, 0x02, 0x99, 0xa0, 0x03, 0x90, 0x90, 0x29, 0x90, 0x11,
+    0x0a, 0x00, 0x10, 0x11, 0x19, 0x30, 0x0b, 0x19, 0xa1, 0x03, 0x99, 0x00, 0x21, 0x99, 0xa0, 0x19,
+    0xb2, 0x92, 0x19, 0x91, 0x10, 0x2b, 0xb0, 0x93, 0x93, 0x90, 0x1a, 0x29, 0x1b, 0xa1, 0x11, 0x09,
+    0xa1, 0x39, 0x90, 0xa3, 0x01, 0x92, 0x19, 0x99, 0xb2, 0x91, 0x01, 0x19, 0x10, 0x19, 0x1a, 0x91,
+    0x10, 0x10, 0x2b, 0x99, 0xb3, 0x92, 0x99, 0x19, 0x20, 0xa1, 0x10, 0x19, 0xa2, 0x3b, 0x3b, 0x91,
+    0x90, 0x01, 0x01, 0xa1, 0x09, 0xb1, 0x03, 0x39, 0x1a, 0xa2, 0x11, 0x99, 0x99, 0x11, 0x19, 0x21,
+    0x1b, 0x93, 0xb0, 0x10, 0x11, 0x19, 0xa1, 0x19, 0x91, 0x91, 0x10, 0x90, 0x2a, 0xa1, 0x01, 0x11,
+    0x00, 0x19, 0x19, 0x01, 0x10, 0xa1, 0x2a, 0xa9, 0x11, 0x99, 0x92, 0x11, 0x99, 0x99, 0x02, 0x91,
+    0x10, 0x11, 0x9a, 0x10, 0x99, 0x21, 0x1a, 0x09, 0x90, 0xa0, 0x22, 0x19, 0xa1, 0x11, 0xb1, 0x01,
+    0x39, 0x09, 0x90, 0x19, 0x91, 0x19, 0x01, 0x09, 0x09, 0x92, 0x99, 0x01, 0x39, 0x2a, 0x91, 0x90,
+    0x01, 0x09, 0x93, 0x09, 0x3b, 0xb0, 0xb2, 0x21, 0x09, 0x1a, 0xb1, 0x02, 0x91, 0x3a, 0x11, 0x1a,
+    0xf8, 0xff, 0x00, 0x00, 0x99, 0xb3, 0x01, 0x01, 0x3a, 0x90, 0x01, 0x00, 0x4b, 0x1a, 0x0b, 0x12,
+    0xb9, 0x93, 0x21, 0x1a, 0x90, 0x91, 0x11, 0x1b, 0x10, 0x92, 0xa0, 0xa2, 0x20, 0x00, 0x3c, 0xa8,
+    0xb2, 0x91, 0x10, 0x10, 0x01, 0x29, 0x00, 0xa1, 0x99, 0x19, 0x91, 0x09, 0x10, 0x00, 0x09, 0x10,
+    0x31, 0x99, 0x91, 0xb1, 0xa2, 0x11, 0xb2, 0x30, 0x09, 0x1b, 0x00, 0x39, 0x09, 0xb2, 0x31, 0xb9,
+    0x11, 0x11, 0x1b, 0x01, 0xa0, 0x01, 0x99, 0x11, 0x91, 0x90, 0x30, 0x1b, 0x92, 0x10, 0x11, 0x1a,
+    0x90, 0x0a, 0xa3, 0x09, 0x93, 0x09, 0x00, 0x2a, 0x11, 0x91, 0xb9, 0xa1, 0x12, 0x09, 0x99, 0x11,
+    0x29, 0x99, 0x10, 0x91, 0x19, 0xb1, 0xb2, 0x21, 0x00, 0x2a, 0x00, 0x09, 0x92, 0x0a, 0x92, 0x3b,
+    0x91, 0x91, 0x99, 0x9a, 0x11, 0x11, 0xa3, 0x99, 0x10, 0x11, 0x1a, 0x29, 0x99, 0x11, 0x19, 0xa2,
+    0x90, 0x91, 0x91, 0x20, 0x29, 0x9a, 0x11, 0x91, 0x09, 0xa3, 0x09, 0x1a, 0x99, 0x11, 0xa3, 0x10,
+    0x19, 0x99, 0x21, 0xa9, 0x93, 0x90, 0x11, 0x1b, 0xa1, 0x93, 0x1a, 0x1a, 0x90, 0x11, 0x19, 0x01,
+    0x3b, 0x90, 0x19, 0xb9, 0x13, 0x01, 0x90, 0x00, 0x91, 0x3a, 0x11, 0x10, 0x1a, 0xa0, 0x92, 0x32,
+    0x9b, 0x99, 0x19, 0xb2, 0x91, 0x02, 0x99, 0x99, 0x4a, 0x19, 0x19, 0x00, 0x01, 0xc1, 0x01, 0x10,
+    0x2a, 0x99, 0x93, 0x99, 0x39, 0x19, 0x09, 0x19, 0x91, 0x92, 0x1b, 0x00, 0x02, 0x09, 0x99, 0x19,
+    0x01, 0x90, 0x91, 0x39, 0x1b, 0xa1, 0xa2, 0x93, 0x19, 0x90, 0x10, 0x1a, 0x10, 0x09, 0x90, 0x01,
+    0x11, 0x99, 0x99, 0x11, 0x91, 0x11, 0x99, 0x10, 0x99, 0x00, 0x01, 0x00, 0x99, 0x90, 0x09, 0x13,
+    0x19, 0x99, 0xa0, 0x21, 0x9a, 0x03, 0x00, 0x99, 0x10, 0xb0, 0x23, 0x3b, 0x19, 0x91, 0x9a, 0xa5,
+    0xfa, 0xff, 0x03, 0x00, 0x91, 0x10, 0x99, 0xb3, 0x09, 0x1a, 0x11, 0x11, 0x10, 0x90, 0xb0, 0x11,
+    0x11, 0x91, 0x2a, 0x99, 0x90, 0x11, 0x91, 0x3b, 0x9b, 0x01, 0x10, 0x91, 0x90, 0x22, 0x9b, 0x91,
+    0xa9, 0x21, 0x99, 0x11, 0x99, 0xa2, 0x11, 0x1a, 0x31, 0xa9, 0x01, 0x99, 0x29, 0x91, 0x19, 0x09,
+    0x09, 0xa2, 0x32, 0x9a, 0xb3, 0xa9, 0x11, 0x2b, 0xb2, 0x12, 0x3a, 0x0a, 0x90, 0x21, 0xb1, 0x11,
+    0x19, 0x91, 0x29, 0x2a, 0x00, 0xa1, 0x10, 0x09, 0x09, 0x19, 0xa9, 0x12, 0x01, 0x91, 0xa1, 0x12,
+    0x10, 0x0a, 0x29, 0xaa, 0x91, 0x92, 0x11, 0x99, 0x11, 0x09, 0x11, 0x91, 0x10, 0x19, 0x19, 0x90,
+    0x09, 0xb2, 0x92, 0x39, 0xab, 0x13, 0x1b, 0x91, 0x10, 0xb2, 0xa2, 0x31, 0xa9, 0x11, 0x29, 0x99,
+    0xa9, 0x10, 0x02, 0x09, 0x1b, 0x91, 0x90, 0x12, 0x1b, 0x01, 0x91, 0x90, 0x19, 0x10, 0x92, 0x99,
+    0x11, 0xa9, 0x13, 0x99, 0x91, 0x10, 0x09, 0x00, 0x90, 0x11, 0x09, 0x19, 0xa1, 0x21, 0x1b, 0xa1,
+    0x93, 0x91, 0x11, 0x1a, 0xa1, 0x01, 0x19, 0x3a, 0x99, 0xa9, 0x84, 0x10, 0x99, 0x10, 0x19, 0x99,
+    0x91, 0x92, 0x09, 0x19, 0x2b, 0x39, 0x99, 0x91, 0x91, 0x09, 0x92, 0x10, 0x91, 0x90, 0x10, 0x99,
+    0x10, 0x01, 0x19, 0x1a, 0x92, 0x09, 0x00, 0x99, 0x11, 0x91, 0x11, 0x1a, 0x90, 0x92, 0x99, 0x91,
+    0x19, 0x99, 0x3a, 0x99, 0x91, 0x12, 0xb9, 0x11, 0x10, 0x10, 0x11, 0x39, 0xa0, 0x99, 0x19, 0x11,
+    0x01, 0xb2, 0x22, 0x00, 0x91, 0x19, 0x10, 0x09, 0x91, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00,
+    0x90, 0x01, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x91, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
-const size_t sound_braking_len = 33437;
-const uint32_t sound_braking_sample_rate = 16000;
+const audio_adpcm_clip_t sound_braking_adpcm = {
+    .data = sound_braking_data,
+    .data_len = sizeof(sound_braking_data),
+    .samples = 33437,
+    .sample_rate = 16000,
+    .block_align = 256,
+};
@@ -1,3586 +1,1163 @@
 /**
  * @file sound_face_down.c
- * @brief Embedded audio - "Face down/sleepy sound"
+ * @brief Embedded audio - "Face down/sleepy sound" (IMA-ADPCM)
  *
- * Converted from is_face_down.mp3
+ * Generated by tools/gen_adpcm_asset.py from the 16-bit PCM array in
+ * 37a0295:components/app_mibuddy/sound_face_down.c (converted from is_face_down.mp3)
  * Sample rate: 16000 Hz
  * Channels: 1 (mono)
- * Bits: 16-bit signed PCM
+ * Format: IMA-ADPCM, 256-byte blocks
  * Duration: ~2.2 seconds
+ * Size: 18082 bytes (16-bit PCM: 71332 bytes)
+ * SNR vs source: 28.8 dB
+ *
+ * Command (in components/audio_play):
+ *   python3 tools/gen_adpcm_asset.py 37a0295:components/app_mibuddy/sound_face_down.c sound_face_down \
+ *       --brief 'Face down/sleepy sound' > ../app_mibuddy/sound_face_down.c
  */
 
 #include <stddef.h>
 #include <stdint.h>
+#include "audio_adpcm.h"
 
-const int16_t sound_face_down[] = {
-    -58, -120, -104, -76, -103, -102, -56, -51, -53, -63,
-    -51, -36, -23, -34, -41, -22, -21, -13, -28, 7,
-    -5, -24, -1, -7, -17, -30, -8, -14, -16, -24,
-    -45, -8, -11, -40, -54, -41, -28, -69, -68, -67,
-    -52, -61, -90, -79, -71, -63, -87, -108, -91, -92,
-    -103, -92, -90, -100, -84, -94, -93, -73, -88, -87,
-    -85, -73, -96, -77, -49, -54, -51, -69, -31, -31,
-    -46, -30, -52, -10, -7, -43, -17, 6, 18, -4,
-    -5, -2, 9, 14, 0, -10, 4, 11, 0, 12,
-    17, 8, 4, -12, -5, -12, -9, -3, -29, -18,
-    -19, -27, -9, -10, -50, -32, -29, -48, -45, -55,
-    -41, -23, -41, -51, -50, -23, -22, -51, -62, -40,
-    -31, -40, -30, -29, -20, -10, -26, -30, 16, -3,
-    -27, -14, -12, 4, 18, 9, 20, 13, 17, 18,
-    20, 27, 16, 7, 26, 30, 9, 18, 47, 46,
-    9, 18, 6, 24, 34, -20, 1, 30, 2, 7,
-    -2, 21, 19, -17, -27, -9, -1, -3, -24, -37,
-    0, -14, -17, 0, -9, -31, -28, -21, -28, -19,
-    -10, -23, 10, -13, -23, 3, 16, 3, -23, -10,
-    6, 11, -9, 10, 29, 21, 28, -3, 17, 55,
-    11, -1, 4, 32, 18, 44, 19, 15, 42, 4,
-    22, 20, 13, 9, -5, 1, 5, 6, 11, 22,
-    -12, -19, 0, -36, 1, -24, -39, -24, -9, -28,
-    -43, -7, -29, -23, -39, -72, -33, -26, -34, -52,
-    -49, -16, -18, -37, -33, -11, -51, -32, -47, -40,
-    6, -18, -36, -19, -5, -13, -4, 3, -31, -13,
-    -30, -10, 9, -20, 7, -1, 7, -2, -30, -13,
-    18, -22, -47, -16, -15, -3, -10, -45, -11, -15,
-    -39, -64, -31, -25, -61, -61, -67, -33, -33, -51,
-    -59, -68, -69, -60, -75, -57, -56, -92, -70, -34,
-    -79, -54, -44, -63, -53, -78, -78, -40, -44, -63,
-    -60, -39, -17, -46, -51, -35, -16, -48, -53, -46,
-    -26, 0, -25, -49, -9, -10, -21, -10, -25, -44,
-    -22, -36, -26, 0, -22, -18, -31, -24, -36, -32,
-    -27, -39, -55, -61, -35, -28, -52, -36, -67, -45,
-    -36, -84, -74, -41, -50, -66, -62, -72, -26, -35,
-    -65, -51, -58, -39, -39, -56, -19, -29, -37, -45,
-    -14, -14, -1, -11, -38, -8, -17, -4, 7, -1,
-    -16, -10, 16, 5, 19, -7, -3, 30, -16, 1,
-    -7, 22, 25, -2, -7, 23, 35, -7, 7, -1,
-    1, 14, -23, 2, 28, 20, -10, -12, 1, 1,
-    12, -28, 0, -21, -21, 20, 2, 5, -4, -20,
-    -5, 8, -6, -11, 25, 6, 4, 18, 27, 48,
-    20, 10, 31, 58, 42, 43, 40, 62, 82, 42,
-    48, 78, 67, 83, 56, 55, 77, 80, 68, 76,
-    76, 48, 71, 71, 77, 81, 68, 62, 64, 63,
-    68, 73, 72, 61, 58, 60, 105, 79, 50, 65,
-    65, 75, 76, 57, 62, 96, 76, 61, 72, 78,
-    76, 67, 54, 74, 82, 73, 78, 90, 84, 91,
-    66, 76, 97, 93, 95, 102, 90, 106, 125, 108,
-    133, 103, 90, 125, 138, 127, 121, 122, 127, 137,
-    123, 109, 133, 119, 116, 107, 124, 139, 116, 94,
-    107, 121, 100, 108, 89, 106, 130, 99, 99, 107,
-    99, 108, 107, 104, 99, 113, 103, 132, 128, 104,
-    109, 114, 123, 115, 119, 123, 129, 120, 114, 136,
-    130, 126, 110, 93, 151, 136, 117, 121, 132, 138,
-    136, 122, 110, 145, 137, 126, 144, 136, 147, 140,
-    142, 144, 138, 130, 128, 153, 133, 153, 130, 130,
-    135, 105, 125, 129, 102, 92, 102, 110, 123, 116,
-    65, 94, 108, 92, 88, 84, 106, 99, 103, 87,
-    111, 109, 104, 106, 101, 133, 123, 107, 136, 132,
-    123, 120, 110, 97, 118, 106, 101, 112, 80, 86,
-    106, 114, 105, 98, 99, 131, 143, 134, 120, 135,
-    123, 119, 105, 120, 142, 114, 120, 146, 146, 150,
-    129, 102, 118, 118, 82, 71, 78, 65, 61, 35,
-    29, 17, 24, 25, 48, 54, 74, 99, 117, 143,
-    132, 104, 100, 106, 71, 74, 80, 87, 97, 67,
-    93, 129, 112, 85, 51, 64, 68, 60, 7, 21,
-    29, 19, 14, 18, 30, 40, 64, 64, 117, 132,
-    153, 192, 207, 227, 217, 201, 187, 153, 105, 71,
-    48, 17, 31, -5, 27, 50, 33, 26, 28, 24,
-    -37, -49, -90, -85, -39, -44, -16, 32, 58, 75,
-    93, 159, 173, 152, 170, 212, 217, 253, 237, 178,
-    153, 94, -4, -28, -55, -96, -94, -77, -52, -54,
-    -5, -16, -1, -40, -84, -94, -78, -2, -1, 28,
-    105, 129, 155, 181, 181, 199, 224, 159, 152, 215,
-    233, 215, 184, 165, 70, 16, -47, -107, -145, -158,
-    -167, -144, -65, -40, -8, 49, 70, 1, -27, -7,
-    -26, 21, 45, 72, 117, 167, 191, 170, 197, 137,
-    57, 29, 16, 1, 27, 49, 60, 56, 22, -40,
-    -87, -82, -132, -192, -142, -57, 3, 90, 176, 211,
-    240, 189, 127, 136, 142, 142, 139, 209, 192, 198,
-    190, 168, 100, -50, -128, -201, -197, -147, -134, -76,
-    10, -13, -63, -72, -108, -143, -155, -173, -137, -23,
-    133, 242, 340, 402, 392, 314, 301, 277, 226, 234,
-    236, 232, 225, 244, 181, 170, 62, -141, -249, -331,
-    -335, -327, -272, -176, -140, -108, -91, -94, -113, -146,
-    -221, -224, -159, -87, 64, 289, 432, 479, 528, 512,
-    504, 490, 427, 358, 343, 349, 311, 308, 316, 278,
-    127, -27, -179, -315, -305, -354, -323, -265, -243, -243,
-    -230, -187, -257, -338, -382, -382, -336, -205, -28, 194,
-    393, 482, 507, 565, 601, 551, 511, 492, 435, 429,
-    456, 479, 457, 402, 257, 104, -32, -172, -266, -301,
-    -274, -356, -348, -351, -355, -324, -398, -497, -537, -512,
-    -474, -360, -152, 56, 214, 346, 457, 533, 583, 586,
-    539, 501, 481, 415, 426, 544, 507, 416, 352, 277,
-    166, 58, -74, -168, -217, -328, -386, -426, -403, -425,
-    -500, -532, -623, -622, -539, -426, -301, -152, -27, 51,
-    207, 296, 304, 353, 375, 343, 376, 392, 466, 573,
-    587, 521, 422, 388, 354, 232, 127, 61, -80, -181,
-    -183, -272, -337, -434, -589, -664, -752, -810, -770, -560,
-    -456, -399, -318, -213, -90, -43, -4, 2, 25, 107,
-    169, 278, 508, 629, 688, 707, 648, 587, 557, 474,
-    350, 198, 5, -166, -198, -215, -365, -584, -737, -867,
-    -979, -999, -990, -882, -763, -697, -699, -526, -309, -237,
-    -84, 65, 87, 162, 404, 643, 766, 891, 997, 937,
-    878, 795, 617, 538, 421, 103, -189, -355, -460, -577,
-    -752, -1009, -1307, -1517, -1554, -1539, -1447, -1257, -1176, -1005,
-    -736, -544, -303, -13, 168, 317, 484, 572, 807, 1166,
-    1400, 1480, 1515, 1585, 1471, 1169, 981, 691, 250, -108,
-    -554, -958, -1173, -1402, -1647, -1879, -2190, -2435, -2487, -2373,
-    -2191, -2015, -1793, -1459, -1034, -513, -12, 433, 905, 1288,
-    1546, 1794, 2033, 2137, 2295, 2358, 2211, 2144, 2009, 1654,
-    1279, 832, 250, -381, -1014, -1595, -2261, -2840, -3151, -3447,
-    -3713, -3812, -3847, -3579, -3138, -2843, -2361, -1695, -1108, -423,
-    331, 1007, 1683, 2286, 2879, 3349, 3615, 3816, 3833, 3759,
-    3815, 3567, 3108, 2772, 2123, 1319, 613, -269, -1233, -2198,
-    -3303, -4314, -5114, -5561, -5819, -6084, -6039, -5724, -5318, -4544,
-    -3581, -2720, -1724, -735, 171, 1238, 2357, 3329, 4373, 5327,
-    5904, 6189, 6359, 6440, 6320, 5888, 5305, 4499, 3404, 2445,
-    1425, 195, -1076, -2684, -4477, -6022, -7485, -8514, -9071, -9525,
-    -9603, -9266, -8503, -6992, -5247, -3615, -2028, -751, 574, 2010,
-    3381, 4974, 6508, 7742, 8972, 9797, 10288, 10752, 10598, 9737,
-    8422, 6609, 4703, 2838, 997, -668, -2654, -4922, -7056, -9099,
-    -10833, -12110, -13153, -13806, -14094, -13783, -12318, -9927, -7052, -4039,
-    -1476, 621, 2702, 4754, 6730, 8605, 10219, 11507, 12585, 13565,
-    14418, 14784, 14334, 12973, 10538, 7470, 4515, 1724, -859, -3273,
-    -5954, -8659, -11015, -12984, -14386, -15459, -16398, -16975, -17143, -16384,
-    -14127, -10585, -6243, -2176, 1094, 3934, 6233, 8230, 10420, 12103,
-    13016, 13706, 14391, 15307, 16185, 16635, 16138, 13914, 10315, 6195,
-    1835, -1820, -4566, -7276, -9951, -12198, -13774, -14557, -14904, -15083,
-    -15539, -16564, -17067, -16351, -14242, -10254, -4979, 97, 4256, 7434,
-    10041, 12140, 13597, 14391, 14031, 12800, 12127, 12525, 13427, 14405,
-    14668, 13261, 9899, 5515, 1141, -2904, -6452, -9332, -11977, -14346,
-    -15349, -14646, -13248, -11986, -11372, -11960, -13132, -13495, -12223, -9515,
-    -5659, -965, 3302, 6300, 9086, 11872, 13680, 14355, 13670, 11607,
-    9408, 8572, 9419, 10628, 11223, 11176, 9446, 6092, 2790, -251,
-    -3387, -6308, -9151, -11731, -13439, -13382, -11459, -9562, -8774, -8885,
-    -10094, -11302, -10977, -9378, -6848, -3642, -280, 2828, 5277, 7745,
-    10432, 11801, 11565, 10277, 8153, 6862, 7524, 9166, 10538, 10829,
-    10099, 8419, 5655, 2879, 481, -2392, -5351, -7889, -10051, -10944,
-    -10034, -8394, -7564, -8196, -9607, -11113, -12253, -11932, -10062, -7759,
-    -4861, -1160, 2108, 4838, 7537, 9614, 10358, 9619, 8123, 6970,
-    6806, 8455, 10997, 12136, 12306, 12016, 10214, 7431, 4387, 931,
-    -2547, -5855, -8426, -9906, -10395, -9292, -7793, -7999, -9274, -10923,
-    -12792, -13677, -13386, -12104, -9555, -6011, -1581, 2902, 6163, 8795,
-    10648, 10835, 9984, 8638, 7407, 7626, 9248, 11354, 12920, 13324,
-    13110, 11726, 8467, 4570, 544, -3738, -7194, -9678, -11474, -11796,
-    -10638, -9227, -8852, -9844, -11269, -12790, -14080, -13825, -12174, -9655,
-    -5453, -598, 3445, 7121, 10057, 11872, 12577, 11763, 10270, 8977,
-    8491, 9787, 11498, 12542, 13389, 12788, 10587, 7584, 3443, -758,
-    -4386, -7963, -10858, -12978, -13716, -12423, -10991, -10308, -10384, -11806,
-    -13131, -13379, -12674, -10346, -6862, -2925, 1127, 4269, 7177, 10273,
-    12331, 13345, 12951, 11064, 9690, 9786, 10962, 12399, 12849, 12396,
-    10798, 7738, 4530, 1205, -2444, -5442, -8398, -11451, -13315, -13487,
-    -12212, -10842, -10632, -11317, -12764, -13748, -12804, -10708, -7715, -3706,
-    23, 2949, 5533, 7988, 10424, 12226, 12780, 11873, 9945, 9077,
-    10249, 11783, 12786, 13038, 11472, 8517, 5460, 2315, -1017, -4130,
-    -6708, -9304, -12037, -12992, -11778, -10461, -9607, -9475, -11132, -13162,
-    -13318, -11600, -9092, -6070, -2245, 1295, 3655, 6184, 8971, 10539,
-    11375, 11585, 10180, 8301, 8233, 10125, 11901, 12331, 11948, 10395,
-    7410, 4601, 2067, -1381, -4670, -6875, -9014, -11087, -11573, -10260,
-    -9022, -8923, -9474, -10987, -12936, -12823, -10662, -8330, -5699, -2305,
-    807, 3332, 5982, 8402, 9616, 9952, 10008, 9131, 7923, 8550,
-    10603, 11919, 12229, 11655, 9759, 7236, 4860, 2249, -1115, -4289,
-    -6232, -7979, -9614, -9636, -8861, -8802, -9152, -9970, -11526, -13024,
-    -12965, -11042, -8884, -6255, -2358, 828, 3110, 5833, 7798, 8440,
-    8711, 8827, 8536, 7893, 8666, 11060, 12385, 12687, 12636, 10729,
-    7831, 5245, 2090, -1314, -4142, -5984, -7166, -8672, -9100, -8202,
-    -8355, -9147, -9981, -11909, -13545, -13694, -12486, -10134, -7125, -3053,
-    1000, 3450, 5771, 7900, 8357, 8539, 8920, 8310, 7538, 8232,
-    10359, 12278, 13297, 13702, 12138, 8877, 5903, 2748, -1224, -4198,
-    -5677, -7218, -8857, -9022, -8268, -8178, -8362, -9011, -11028, -13467,
-    -14327, -13329, -11483, -8617, -4294, -258, 2480, 5301, 7888, 8839,
-    9061, 9333, 8825, 7459, 7133, 9263, 11654, 12819, 13971, 13356,
-    9894, 6818, 4204, 472, -3085, -5382, -6867, -8573, -9596, -8365,
-    -7500, -8151, -8157, -9590, -12735, -14182, -13911, -12449, -9863, -6647,
-    -2532, 890, 3582, 7191, 9240, 9305, 9610, 9037, 7561, 6919,
-    7666, 9999, 12221, 13145, 13444, 11441, 7950, 5730, 2907, -982,
-    -3896, -6262, -7921, -8533, -8184, -6940, -6774, -7504, -8213, -10791,
-    -13547, -13876, -13248, -11609, -8785, -5621, -1905, 1820, 5373, 8359,
-    8849, 8486, 8462, 7398, 6556, 6640, 7564, 9784, 11996, 13239,
-    13092, 10471, 7495, 5231, 2016, -1473, -4153, -6215, -7098, -6987,
-    -6140, -5119, -5551, -6369, -7570, -11009, -13929, -14290, -13895, -12214,
-    -9245, -5880, -1955, 1880, 5534, 8161, 7874, 7094, 6978, 5712,
-    5101, 5609, 6503, 9089, 11953, 13634, 14179, 11927, 8873, 6664,
-    3274, -286, -2970, -5234, -6008, -5928, -5462, -4221, -4501, -5743,
-    -6937, -10558, -14328, -15480, -15728, -14365, -11429, -8235, -3892, 253,
-    3931, 7496, 8083, 7163, 6931, 5835, 5190, 5581, 6327, 8982,
-    11949, 14032, 15903, 14775, 11521, 9068, 5676, 1870, -1147, -4008,
-    -5791, -6796, -6987, -5654, -5594, -6750, -7556, -10560, -14721, -17047,
-    -17728, -16387, -13419, -10159, -5826, -1622, 2587, 7433, 9530, 9233,
-    8894, 7658, 6523, 6306, 6891, 9136, 11572, 14098, 16504, 15996,
-    13565, 10936, 7193, 3533, -39, -4045, -7088, -8921, -9234, -8214,
-    -7878, -7861, -8282, -10560, -13382, -16207, -17716, -16245, -13559, -10668,
-    -6752, -2698, 2028, 7123, 10260, 11414, 10782, 9008, 7870, 6942,
-    6740, 8483, 10211, 12214, 14656, 15017, 13873, 11610, 7984, 4696,
-    766, -3791, -6971, -9334, -10241, -9306, -8830, -8477, -8184, -9401,
-    -11211, -13625, -15746, -15207, -13354, -11008, -7193, -3373, 767, 5833,
-    9330, 10802, 10687, 9208, 7951, 6942, 6143, 6934, 8280, 10030,
-    13294, 14997, 14196, 12509, 9087, 5053, 1821, -1886, -5376, -8273,
-    -10173, -9778, -9047, -8324, -6869, -7350, -9514, -11656, -14493, -15768,
-    -14008, -11366, -8376, -5075, -1664, 2986, 7313, 9916, 10946, 9750,
-    7693, 6501, 5461, 5484, 7382, 9622, 12560, 15051, 14952, 13473,
-    10967, 7168, 4058, 484, -4150, -7688, -10007, -10455, -9116, -7958,
-    -6858, -6664, -8332, -10627, -13542, -15601, -14599, -12346, -10392, -7667,
-    -4428, -149, 5449, 9774, 11064, 10188, 8318, 6831, 6070, 6082,
-    7521, 9409, 11396, 13987, 15295, 14326, 12625, 9853, 5774, 1470,
-    -3125, -7075, -9317, -10186, -9468, -8441, -8097, -7476, -7443, -9333,
-    -11926, -14047, -14879, -13739, -11654, -9246, -5937, -1898, 3239, 8286,
-    10299, 10206, 9482, 7915, 7014, 6677, 6597, 7997, 10035, 12451,
-    14679, 14792, 13420, 11194, 7207, 2898, -1326, -5472, -8051, -9355,
-    -9753, -8967, -8051, -7180, -6489, -7218, -9385, -12364, -14587, -14473,
-    -12778, -10787, -7978, -4277, 72, 5089, 9254, 10628, 10004, 8698,
-    7351, 6068, 5318, 6218, 8096, 10287, 12845, 14693, 14597, 12871,
-    10072, 6292, 1585, -2749, -5943, -8178, -9218, -8991, -7964, -6801,
-    -5960, -5515, -6701, -10021, -13221, -14583, -14302, -12798, -10587, -7889,
-    -4159, 449, 5530, 9286, 10124, 9222, 7987, 6365, 5380, 5779,
-    7001, 8992, 11107, 12994, 14566, 14174, 12437, 10374, 6301, 1492,
-    -2123, -5071, -6499, -7057, -7595, -7449, -7911, -8048, -7567, -9249,
-    -12163, -14184, -15369, -14582, -12192, -9489, -6125, -2641, 805, 4521,
-    6801, 7535, 8211, 8274, 7658, 7464, 7815, 9567, 12332, 14304,
-    15604, 15044, 12322, 9964, 7763, 4554, 1590, -1425, -4115, -5935,
-    -7443, -7858, -8223, -9222, -9532, -10762, -13559, -15477, -15915, -14691,
-    -12090, -9637, -7331, -4606, -1404, 2503, 5681, 7201, 7848, 8151,
-    8113, 8164, 8442, 9724, 12114, 14149, 15287, 15003, 13049, 10576,
-    8552, 6310, 3172, -452, -3632, -6122, -7482, -7599, -7564, -7802,
-    -8289, -9544, -11395, -13557, -14565, -13725, -12540, -11318, -9895, -8164,
-    -4436, 820, 5150, 7821, 8192, 7398, 7188, 7341, 7858, 8532,
-    8818, 9876, 11489, 12463, 13526, 13887, 12273, 9759, 6106, 1693,
-    -1574, -3631, -4701, -5535, -7345, -8275, -8256, -8584, -8094, -8735,
-    -11372, -13232, -14235, -14171, -12259, -10067, -6955, -3276, -490, 2501,
-    4791, 5838, 7317, 7845, 7176, 6759, 6552, 7989, 11392, 14228,
-    15776, 15810, 13675, 11241, 9080, 6632, 3882, 500, -2969, -5364,
-    -6945, -7005, -5932, -6174, -7459, -9505, -12541, -14590, -15067, -14779,
-    -14041, -13422, -12095, -9144, -4960, 26, 4122, 5861, 6393, 6286,
-    6396, 7455, 8724, 9793, 11229, 12911, 14742, 16523, 17058, 15830,
-    13052, 9354, 5445, 1711, -1594, -4066, -5969, -7173, -7298, -7329,
-    -7680, -8319, -9963, -12110, -14152, -15726, -16505, -16328, -14978, -12325,
-    -8606, -3624, 1473, 5080, 7302, 8091, 8120, 8271, 8551, 8733,
-    8716, 9390, 11768, 14829, 17211, 18296, 16777, 12994, 9050, 5376,
-    1731, -1979, -5298, -7822, -9171, -8805, -7066, -6051, -6583, -7833,
-    -10479, -13744, -15637, -16229, -16497, -15723, -13495, -10175, -5414, 635,
-    5851, 8384, 9018, 8747, 7819, 7277, 7961, 8765, 9158, 11244,
-    14375, 16277, 17709, 17669, 14608, 10537, 6427, 2015, -2142, -5507,
-    -6832, -7404, -7766, -6479, -5991, -7271, -8055, -9891, -13042, -15330,
-    -17032, -17861, -17296, -14992, -10560, -5452, -402, 4406, 6820, 7403,
-    8274, 8683, 8640, 9124, 9194, 9251, 11301, 14631, 17565, 19021,
-    17832, 14614, 10359, 6365, 3341, -167, -3860, -5996, -7879, -8835,
-    -7486, -6601, -6807, -7747, -10318, -13703, -16252, -17469, -17129, -16610,
-    -15385, -12022, -8273, -3103, 3295, 7187, 8806, 9778, 9387, 9210,
-    9931, 10220, 10758, 11266, 13177, 16096, 17029, 17047, 16068, 12335,
-    8425, 5206, 326, -3825, -6209, -8014, -9027, -8847, -7766, -7269,
-    -7814, -8913, -11107, -14582, -16244, -16487, -17556, -17323, -14738, -11323,
-    -5900, 1541, 6955, 9578, 10574, 10907, 11043, 10845, 10952, 10363,
-    9134, 10244, 13475, 15623, 17412, 18128, 15662, 11623, 7314, 2547,
-    -2151, -5421, -7527, -9431, -11065, -10412, -8503, -7688, -7223, -8511,
-    -12637, -16082, -17397, -18487, -18670, -16975, -13622, -8756, -2426, 4487,
-    9105, 11100, 12795, 13462, 12241, 11269, 10521, 9366, 10120, 13316,
-    16241, 17586, 17948, 16487, 13012, 8758, 4575, -209, -5188, -8256,
-    -10091, -11694, -10815, -8176, -7320, -7693, -9478, -13251, -16667, -17981,
-    -18077, -18550, -18208, -15108, -10067, -3436, 4689, 10300, 12020, 12725,
-    12897, 12077, 11370, 11207, 10333, 9609, 11359, 14578, 16937, 18344,
-    17945, 14383, 9213, 4223, -222, -4569, -7700, -9396, -11167, -11767,
-    -9740, -7629, -7120, -7908, -11009, -15055, -17648, -18174, -17684, -17223,
-    -15159, -10792, -5583, 1100, 7953, 11408, 12533, 12921, 11925, 10696,
-    10104, 9978, 9775, 10302, 12978, 15723, 16877, 17205, 15435, 11007,
-    6434, 2190, -2371, -6371, -8808, -9996, -10569, -9624, -7567, -6821,
-    -7707, -9700, -12861, -16158, -17574, -17521, -17585, -16709, -13462, -8677,
-    -2542, 4581, 9555, 11465, 11602, 11178, 10747, 10448, 10687, 10482,
-    9529, 10771, 14104, 16433, 18034, 17670, 13806, 8953, 4396, 79,
-    -3845, -7012, -8811, -10247, -11291, -9769, -7853, -7535, -7865, -10549,
-    -14681, -17491, -18243, -17652, -16765, -15137, -11540, -6960, -800, 6560,
-    10960, 12597, 12813, 11925, 11128, 10875, 10957, 10602, 10052, 11721,
-    14546, 15822, 16916, 16096, 12067, 7663, 3069, -1881, -6170, -9008,
-    -10327, -11543, -12011, -9771, -8210, -7950, -7711, -10420, -14483, -16495,
-    -17123, -17073, -16277, -14304, -9955, -4714, 2188, 9536, 12639, 13269,
-    13496, 12274, 10989, 10515, 9406, 8263, 8261, 10753, 14155, 15763,
-    16652, 15458, 11200, 6332, 1653, -3673, -7913, -10222, -11883, -12795,
-    -11668, -8565, -6191, -5126, -6343, -10046, -13954, -16143, -16670, -17147,
-    -16875, -14265, -9641, -3310, 5084, 11194, 13524, 14156, 12974, 11413,
-    9992, 8639, 7662, 6492, 6952, 10925, 14159, 16485, 18476, 15749,
-    10732, 5738, 9, -4817, -8486, -11226, -12476, -13255, -11090, -6566,
-    -4778, -3992, -5635, -10952, -14853, -16727, -18029, -17880, -16875, -13998,
-    -8512, -1677, 6932, 12832, 14351, 14391, 12625, 10094, 8907, 7937,
-    6562, 6265, 8188, 12150, 15476, 17829, 18374, 15099, 9961, 4534,
-    -1357, -6986, -10672, -12319, -13269, -12500, -8941, -5704, -4079, -3854,
-    -7072, -11787, -15477, -17523, -18267, -18694, -17128, -12435, -6180, 2415,
-    10551, 13616, 14292, 13450, 11405, 10115, 8400, 6362, 5138, 5273,
-    9205, 14146, 17103, 19324, 17848, 12879, 7877, 2060, -3871, -8399,
-    -11720, -13237, -13564, -11294, -6421, -3295, -2150, -3512, -8597, -13706,
-    -16554, -17987, -18848, -18941, -16354, -11020, -3357, 6372, 12754, 14476,
-    14043, 11976, 9906, 8294, 6491, 5021, 4188, 6198, 11484, 15759,
-    19289, 20442, 17008, 11887, 5904, -560, -5876, -10157, -12597, -13266,
-    -12875, -8835, -4279, -2089, -1595, -5119, -11203, -15818, -18345, -19565,
-    -19966, -19058, -14811, -8259, 720, 9877, 13899, 14254, 13142, 11041,
-    8911, 7305, 5649, 4520, 5350, 9550, 14713, 18353, 20863, 19816,
-    15464, 9526, 2949, -3419, -8738, -12050, -13335, -13624, -11318, -6463,
-    -3219, -1703, -3411, -8568, -13951, -17575, -19191, -20176, -20464, -17681,
-    -11835, -3855, 6231, 12734, 14326, 14021, 12201, 10212, 8505, 6793,
-    5334, 4830, 7078, 12226, 16587, 20021, 21276, 17844, 12140, 5497,
-    -1127, -6585, -10510, -12897, -13899, -13299, -9414, -4632, -1829, -1387,
-    -4994, -10808, -15799, -18550, -19802, -20416, -19181, -14941, -8483, 566,
-    9410, 13696, 14658, 13593, 11401, 9051, 7033, 5615, 4580, 5285,
-    9482, 14227, 17763, 20681, 19744, 15345, 9579, 2933, -3386, -8629,
-    -11920, -13184, -13489, -11075, -6189, -2988, -1231, -2554, -7633, -13097,
-    -17131, -19442, -20625, -20850, -18215, -12700, -5069, 4800, 11557, 13800,
-    13951, 12333, 10269, 8562, 6660, 5093, 4561, 6717, 11954, 16329,
-    19840, 21351, 18354, 13040, 6896, 153, -5839, -10012, -12637, -13611,
-    -13051, -9297, -4673, -2035, -1382, -4690, -10715, -15865, -18797, -20768,
-    -21465, -20451, -16624, -9845, -342, 8897, 13479, 14634, 13883, 12026,
-    9931, 8137, 6065, 4421, 5112, 9305, 14246, 18091, 21153, 20257,
-    15856, 10098, 3438, -3302, -8516, -11853, -13587, -14226, -12092, -6945,
-    -3321, -1215, -2215, -7750, -13865, -17699, -19992, -21187, -21168, -18796,
-    -13082, -4929, 5417, 12549, 14719, 14903, 13446, 11009, 8844, 6741,
-    4607, 4244, 6936, 11921, 16103, 19608, 21085, 18258, 12869, 6436,
-    -579, -6896, -10926, -13110, -14175, -13356, -8972, -4358, -1512, -908,
-    -4731, -10915, -16058, -19125, -21019, -22037, -20860, -15987, -8682, 1416,
-    10521, 14186, 14979, 14072, 12026, 9797, 7382, 4947, 3581, 4709,
-    9481, 14698, 18481, 21432, 20090, 14948, 8999, 2349, -4182, -8841,
-    -11983, -13835, -14334, -11419, -5976, -2348, -649, -2569, -8731, -14919,
-    -18469, -20706, -21876, -21510, -18225, -12124, -3068, 7301, 13334, 15229,
-    14948, 13147, 10574, 8117, 5935, 4236, 4441, 8063, 13165, 17061,
-    20563, 21033, 17209, 11633, 5042, -1839, -7470, -11445, -13657, -14636,
-    -13093, -8025, -3810, -1556, -1945, -6701, -12888, -17210, -20011, -21701,
-    -22231, -20052, -14332, -6012, 4367, 12120, 15127, 15339, 14248, 12059,
-    9482, 7125, 4727, 3887, 6213, 11073, 15819, 19705, 21268, 18636,
-    13236, 6818, 370, -5532, -10098, -13240, -15180, -14749, -10389, -5301,
-    -1957, -1238, -4840, -10745, -15824, -19040, -20897, -22004, -20953, -16409,
-    -9195, 915, 10109, 14840, 16026, 15025, 12889, 10262, 7672, 5268,
-    3909, 5107, 9384, 14345, 18417, 21067, 19913, 15288, 9249, 2583,
-    -3733, -8881, -12579, -14863, -15216, -11932, -6808, -2882, -1138, -3277,
-    -8667, -14158, -18194, -20719, -22256, -21999, -18400, -11854, -2054, 7744,
-    13721, 15851, 15278, 13535, 11281, 8567, 5739, 3745, 4251, 8177,
-    13305, 17901, 21034, 20575, 16815, 11216, 4493, -1926, -7323, -11702,
-    -14638, -15750, -13318, -8263, -3788, -1203, -2472, -7468, -12961, -17173,
-    -20136, -21927, -22441, -19943, -14282, -4877, 5463, 12459, 15677, 15748,
-    14406, 12160, 9602, 6723, 4181, 3944, 7264, 12051, 16660, 20468,
-    20825, 17810, 12584, 6050, -491, -6168, -10656, -14002, -16067, -14480,
-    -9613, -5191, -1808, -1973, -6356, -11517, -15859, -19095, -21133, -22308,
-    -20430, -15452, -7132, 3466, 11068, 14937, 15945, 14839, 12718, 10390,
-    7400, 4664, 3812, 6227, 11044, 15509, 19504, 20675, 18026, 13363,
-    7318, 850, -4922, -9744, -13600, -15974, -15221, -10489, -5768, -2392,
-    -1747, -5498, -10516, -14634, -17906, -20303, -22065, -21170, -16793, -9251,
-    1471, 9814, 14072, 15518, 14850, 13112, 11082, 8482, 5518, 3961,
-    5362, 9922, 14458, 18681, 20869, 18629, 13961, 8236, 2035, -3703,
-    -8348, -12410, -15350, -15733, -11784, -6758, -3266, -1898, -4783, -9963,
-    -14318, -17369, -19845, -21690, -21272, -17523, -10706, -503, 8336, 13188,
-    15120, 15083, 13870, 11569, 8979, 6176, 4368, 5507, 9874, 14208,
-    18168, 20735, 18953, 14616, 9057, 3146, -2686, -7760, -12002, -15263,
-    -16104, -12563, -7211, -3912, -2400, -4766, -9720, -13865, -16761, -19114,
-    -21360, -21622, -18245, -11798, -1797, 7715, 12723, 14708, 14796, 13833,
-    12048, 9749, 6962, 4841, 5201, 9100, 13840, 17797, 20755, 19340,
-    14809, 9182, 3259, -2174, -7229, -11424, -14648, -15997, -13194, -7793,
-    -4141, -2354, -4105, -9098, -13604, -16846, -18895, -20745, -21360, -18398,
-    -12284, -3012, 6783, 12524, 14447, 14619, 13646, 11913, 9658, 6989,
-    4919, 4974, 8656, 13663, 17735, 20577, 19529, 15125, 9458, 3751,
-    -1611, -6829, -11158, -14257, -15482, -13106, -7813, -3828, -2154, -3657,
-    -8578, -13427, -16825, -18696, -20403, -21535, -19009, -13157, -3939, 6129,
-    12351, 14348, 14212, 13278, 11714, 9781, 7291, 5185, 4912, 8024,
-    13166, 17529, 20873, 20364, 15854, 9867, 3788, -1385, -6264, -10406,
-    -13614, -15307, -13411, -8278, -4032, -2097, -3309, -8147, -13319, -16887,
-    -18861, -20377, -21459, -19293, -13686, -4975, 5217, 11893, 14211, 14305,
-    13218, 11650, 9700, 7368, 5486, 5006, 7882, 13056, 17327, 20787,
-    20864, 16401, 10452, 4311, -1133, -5858, -10032, -13242, -14927, -13570,
-    -8576, -4020, -2101, -3029, -7700, -13125, -16796, -18828, -20199, -21447,
-    -19745, -14390, -5919, 4281, 11506, 14028, 13960, 13023, 11377, 9765,
-    7650, 5745, 5068, 7415, 12614, 17256, 20885, 21442, 17343, 11204,
-    4997, -556, -5317, -9374, -12421, -14480, -13732, -9120, -4404, -2028,
-    -2577, -7056, -12848, -16778, -18800, -19960, -21250, -20188, -15366, -7391,
-    2845, 10708, 13775, 13851, 12983, 11281, 9582, 7844, 6124, 5414,
-    7172, 12105, 16937, 20774, 21998, 18248, 11979, 5587, 71, -4727,
-    -8786, -11883, -14120, -13877, -9703, -4808, -2198, -2384, -6474, -12334,
-    -16794, -18978, -19948, -21117, -20335, -15883, -8519, 1514, 10003, 13730,
-    14143, 13134, 11307, 9429, 7772, 6281, 5638, 6748, 11335, 16421,
-    20458, 22505, 19410, 13061, 6470, 663, -4244, -8573, -11977, -14116,
-    -14356, -10494, -5173, -2310, -2151, -5476, -11280, -16062, -18550, -19772,
-    -21087, -20828, -16945, -9956, -218, 8851, 13662, 14280, 13349, 11675,
-    9622, 7951, 6540, 5670, 6095, 10215, 15505, 19781, 22578, 20421,
-    14392, 7622, 1595, -3509, -7976, -11446, -13655, -14418, -11487, -6084,
-    -2666, -1905, -4454, -10135, -15471, -18415, -19818, -21103, -21277, -17929,
-    -11390, -2081, 7451, 13114, 14379, 13667, 12221, 9979, 8234, 6648,
-    5462, 5746, 9117, 14696, 19306, 22470, 21373, 15912, 9077, 2915,
-    -2387, -7391, -11263, -13718, -14963, -12658, -7137, -3090, -1579, -3521,
-    -8806, -14408, -17848, -19365, -20780, -21816, -19430, -13440, -4631, 5490,
-    12462, 14599, 14227, 12943, 10768, 8871, 7188, 5871, 5461, 7810,
-    13217, 18045, 21713, 22032, 17465, 10846, 4628, -909, -6030, -10230,
-    -13124, -14638, -13530, -8718, -4160, -2311, -3262, -7523, -13154, -17045,
-    -18736, -20257, -21674, -20000, -14902, -6797, 3192, 11016, 14221, 14173,
-    13268, 11503, 9583, 8030, 6491, 5511, 6926, 12081, 17205, 21059,
-    22245, 18581, 12292, 5876, 524, -4753, -9364, -12541, -14417, -14219,
-    -9932, -4897, -2514, -2804, -6445, -11995, -16260, -18391, -19746, -21368,
-    -20916, -16331, -8942, 746, 9553, 13933, 14432, 13743, 12227, 10268,
-    8741, 6993, 5738, 6320, 10620, 16284, 20401, 22343, 19983, 14121,
-    7665, 2195, -3224, -8112, -11787, -14117, -14621, -11390, -6208, -3076,
-    -2845, -5767, -10683, -15397, -17756, -19024, -21039, -21234, -17608, -10805,
-    -1467, 7614, 13050, 14322, 13863, 12830, 11191, 9534, 7925, 6478,
-    6140, 9621, 15305, 19591, 22172, 20495, 15162, 8800, 3208, -1819,
-    -6801, -10821, -13568, -14634, -12467, -7279, -3574, -2919, -5152, -10048,
-    -14866, -17455, -18745, -20181, -20973, -18442, -12358, -3700, 5707, 12298,
-    14394, 14049, 13091, 11363, 9829, 8492, 6912, 6384, 8806, 13948,
-    18723, 21724, 21212, 16854, 10549, 4669, -622, -5842, -10064, -13035,
-    -14505, -13225, -8682, -4634, -3064, -4613, -8683, -13362, -16756, -18272,
-    -19796, -21234, -19478, -14172, -6144, 3439, 10888, 14059, 14251, 13523,
-    12265, 10866, 9271, 7534, 6344, 7482, 12353, 17452, 20891, 21543,
-    17922, 12009, 6072, 950, -4068, -8641, -12208, -14311, -14170, -10370,
-    -5635, -3462, -4269, -7630, -12353, -16031, -17639, -19138, -20620, -19931,
-    -15793, -8512, 525, 8895, 13393, 14134, 13656, 12629, 11167, 9832,
-    8372, 6616, 6923, 10817, 15898, 20028, 21621, 19113, 13666, 7408,
-    2347, -2609, -7392, -11193, -13833, -14622, -11715, -6792, -3819, -3638,
-    -6371, -10854, -15100, -17406, -18675, -20295, -20463, -17215, -11151, -2458,
-    6508, 12474, 14401, 14204, 13200, 11806, 10460, 8865, 7282, 6583,
-    9145, 14078, 18376, 20894, 19962, 15371, 9389, 4149, -754, -5573,
-    -9849, -13060, -14691, -13118, -8681, -4953, -3821, -5618, -9263, -13618,
-    -16390, -17765, -19363, -20372, -18577, -13592, -5757, 3438, 10658, 13902,
-    14192, 13597, 12600, 11361, 9922, 8241, 6773, 8022, 12205, 16703,
-    20046, 20449, 17017, 11284, 5660, 784, -3848, -8288, -11898, -14187,
-    -14167, -10412, -6242, -4142, -4753, -7907, -12209, -15768, -17545, -18930,
-    -20105, -19373, -15399, -8549, 309, 8605, 13405, 14588, 14240, 13261,
-    11941, 10384, 8726, 7202, 7296, 10652, 15250, 19036, 20654, 18608,
-    13428, 7618, 2429, -2440, -7038, -11182, -13900, -14582, -12062, -7643,
-    -4713, -4356, -6517, -10323, -14340, -16873, -18310, -19887, -20060, -17136,
-    -11321, -2920, 5989, 12207, 14583, 14670, 14044, 12842, 11422, 9571,
-    7669, 6696, 8849, 13520, 17877, 20546, 19739, 15172, 9226, 4138,
-    -591, -5187, -9749, -13409, -15162, -13612, -9180, -5242, -3773, -5313,
-    -8895, -13301, -16352, -17657, -18988, -19958, -18296, -13991, -6521, 3048,
-    10681, 14664, 15136, 14196, 12778, 11551, 10250, 8736, 7181, 7693,
-    11444, 15776, 19697, 20691, 17452, 11690, 5739, 505, -4008, -8427,
-    -12130, -14375, -14503, -11001, -6615, -4052, -3875, -6635, -11215, -15175,
-    -17647, -19071, -20023, -19362, -15700, -9465, -751, 7980, 13565, 15440,
-    15180, 13831, 12060, 10584, 8718, 7099, 6810, 9559, 14350, 18367,
-    20294, 18846, 13962, 8267, 3253, -1853, -6784, -11103, -13917, -14791,
-    -12431, -8076, -4766, -3797, -5635, -9248, -13538, -16406, -17836, -19519,
-    -20172, -17718, -12628, -4524, 4887, 11718, 14811, 14924, 14101, 12857,
-    11523, 9845, 8089, 6387, 7697, 12555, 16746, 19852, 19930, 15818,
-    10347, 5314, 307, -4553, -9224, -12693, -14424, -13803, -10046, -5911,
-    -4111, -4553, -7496, -12232, -15582, -17425, -18675, -19820, -18920, -14909,
-    -8371, 940, 9285, 13898, 14712, 14425, 13373, 11953, 11002, 8947,
-    7150, 6963, 10591, 15279, 18613, 20012, 17770, 12657, 7281, 2556,
-    -2675, -7541, -11291, -13680, -14299, -11746, -7593, -4746, -4281, -6279,
-    -10174, -14265, -16792, -17865, -19565, -19985, -16923, -11612, -3110, 6085,
-    12261, 14391, 14499, 14049, 13040, 12161, 10245, 8237, 6492, 8507,
-    13494, 17247, 19843, 18967, 14656, 9073, 4321, -241, -5018, -9439,
-    -12599, -14381, -13782, -9598, -5674, -4327, -5136, -8664, -13102, -16253,
-    -17433, -18397, -19662, -18191, -14125, -7316, 2051, 10233, 14084, 14753,
-    14355, 13155, 12370, 11167, 9558, 7671, 7345, 11373, 15534, 18416,
-    19558, 16973, 11224, 6225, 1649, -3398, -7801, -11380, -13335, -14148,
-    -11429, -7157, -4833, -4788, -6710, -10821, -15277, -17262, -18177, -19700,
-    -19161, -15786, -10210, -1838, 6984, 12795, 14455, 14553, 14138, 13076,
-    11810, 10210, 8239, 6652, 9349, 14078, 17284, 19418, 18276, 13449,
-    8054, 3924, -735, -5566, -9979, -12842, -14544, -13153, -8765, -5424,
-    -4416, -5532, -9015, -13661, -16431, -17491, -18330, -19586, -17971, -13650,
-    -6578, 3150, 11016, 14249, 14503, 14327, 13389, 12761, 11632, 9384,
-    7437, 7141, 11194, 15586, 18394, 19416, 16098, 10235, 5709, 1842,
-    -2851, -7369, -11341, -14029, -14425, -11459, -7151, -4387, -4613, -6739,
-    -11467, -15865, -17272, -17400, -18874, -18928, -16420, -11355, -1937, 7391,
-    13417, 14993, 14470, 13960, 13089, 12466, 11226, 8816, 6776, 8812,
-    12992, 16279, 19447, 18166, 13403, 8307, 3926, -381, -4935, -9025,
-    -12284, -14841, -13841, -9313, -5953, -4398, -5091, -9320, -14208, -16718,
-    -17104, -17924, -19310, -18114, -14849, -7556, 2825, 11293, 14418, 14841,
-    14573, 13616, 13419, 12671, 10380, 7608, 7176, 10586, 14509, 18047,
-    19548, 16274, 10703, 6123, 1960, -2586, -6674, -10463, -13961, -14980,
-    -11834, -7914, -4908, -4418, -7149, -11969, -15823, -16993, -17427, -19292,
-    -19272, -17119, -11876, -1811, 7639, 13108, 14882, 14831, 14172, 14073,
-    13564, 11613, 8601, 6542, 8832, 12954, 16536, 19687, 17969, 12956,
-    8381, 3979, -378, -4327, -8797, -12800, -15423, -13778, -8989, -5327,
-    -3884, -5498, -9991, -14609, -16330, -17052, -18659, -19864, -18989, -15118,
-    -6326, 4133, 11879, 14521, 14325, 14183, 13966, 13954, 12826, 9453,
-    6632, 7099, 10742, 15287, 19427, 19829, 15801, 10032, 4840, 1504,
-    -2446, -6497, -11219, -15555, -15178, -10624, -6053, -2843, -3330, -7706,
-    -12668, -16314, -17305, -17608, -19692, -19745, -17845, -11640, -170, 9481,
-    14370, 15367, 14292, 13152, 13303, 12643, 10823, 7881, 5962, 8542,
-    12818, 17460, 21085, 18770, 13030, 7233, 2399, -1292, -4707, -8994,
-    -13394, -15522, -13020, -7618, -3325, -1868, -4299, -9770, -14791, -17230,
-    -18127, -19239, -20178, -19060, -15291, -5976, 5033, 12681, 15410, 14756,
-    13491, 12715, 12822, 11550, 8741, 6242, 6791, 10398, 15176, 20159,
-    20808, 16524, 10244, 4441, 496, -2733, -6326, -11008, -15017, -14863,
-    -10145, -5049, -1230, -1424, -6271, -12524, -17011, -18614, -18762, -19612,
-    -19739, -17886, -12540, -1585, 8787, 14743, 16373, 14910, 12778, 11626,
-    11243, 10191, 8284, 6441, 8114, 12157, 16449, 20618, 19938, 14823,
-    8632, 3213, -1319, -5207, -8628, -12055, -14214, -12764, -8032, -3737,
-    -1756, -3393, -8317, -14007, -17583, -18864, -20058, -20975, -19421, -15812,
-    -7654, 3180, 11291, 15239, 15107, 14010, 13120, 12738, 11540, 9038,
-    6434, 6416, 10197, 14534, 19173, 20875, 17501, 11873, 5911, 1728,
-    -1833, -5527, -9911, -14137, -15109, -11109, -5917, -2148, -1581, -5931,
-    -11890, -16773, -18729, -18739, -19788, -20255, -18699, -14047, -3434, 7544,
-    14173, 16098, 15002, 13133, 12259, 12321, 11285, 8995, 6510, 7689,
-    11263, 15807, 20703, 20490, 15632, 9493, 3966, -414, -3818, -7417,
-    -11489, -14811, -14012, -9251, -4751, -1654, -3087, -8148, -14155, -18049,
-    -19164, -19915, -20631, -19648, -17081, -9639, 1984, 10900, 15433, 15847,
-    14477, 13368, 13276, 12227, 9773, 6888, 6471, 9671, 13515, 18513,
-    21148, 18304, 12904, 7058, 2384, -1380, -5212, -9533, -14100, -15899,
-    -11999, -7062, -2978, -1712, -5362, -11359, -16693, -18617, -18875, -19971,
-    -20617, -19358, -14897, -4151, 7255, 14091, 16166, 15245, 13765, 13264,
-    12996, 11601, 8841, 6063, 7159, 10821, 15676, 20609, 20464, 15976,
-    9945, 4479, 536, -3104, -7164, -11727, -15455, -14808, -10064, -5159,
-    -1630, -2886, -8109, -14233, -18212, -19075, -19391, -20224, -19840, -17785,
-    -10118, 1657, 10984, 15874, 16268, 14624, 13371, 13387, 12305, 10012,
-    7031, 6282, 8937, 12743, 18245, 21019, 18418, 13310, 7395, 2267,
-    -1636, -5038, -9344, -13960, -15705, -12319, -7649, -3052, -1398, -5145,
-    -11454, -16618, -18687, -19024, -19796, -20274, -19412, -14893, -3849, 7186,
-    13938, 15972, 15300, 13850, 13490, 13088, 10972, 7966, 5651, 7152,
-    10755, 15812, 20484, 20154, 15838, 10049, 4792, 697, -2688, -6904,
-    -11847, -15636, -14650, -9759, -4613, -1214, -2882, -8440, -14881, -18283,
-    -18748, -19086, -20221, -20445, -18609, -10393, 1792, 11401, 16096, 16035,
-    14253, 12863, 12781, 12074, 9948, 6907, 5932, 8329, 12567, 18335,
-    21421, 19176, 13750, 7460, 2329, -1365, -4573, -8806, -13547, -15591,
-    -12684, -7884, -2891, -1528, -5221, -11509, -16979, -19212, -19619, -20256,
-    -20657, -19800, -14863, -4113, 6611, 13665, 15869, 15345, 14329, 13828,
-    12968, 10580, 7664, 6096, 7784, 11241, 16030, 20246, 19887, 16235,
-    10759, 5430, 1264, -2471, -7110, -12256, -15813, -14344, -9863, -4980,
-    -1846, -3961, -9452, -15312, -18255, -18762, -19344, -20650, -21043, -18859,
-    -9582, 2626, 11625, 15754, 15830, 14451, 13546, 13756, 12653, 9950,
-    6755, 6236, 8645, 12927, 18937, 21249, 18524, 13319, 7187, 2096,
-    -1312, -4602, -9419, -14456, -16154, -12900, -7924, -2904, -2010, -6191,
-    -12354, -17132, -19027, -19503, -20315, -20554, -19836, -13880, -2609, 7710,
-    14325, 16273, 15912, 14748, 14329, 13087, 10241, 7117, 6036, 7822,
-    11024, 16131, 20102, 19401, 15698, 10119, 4661, 677, -2941, -7720,
-    -13111, -16385, -14310, -9653, -4447, -1714, -4414, -10033, -15402, -18001,
-    -18532, -19459, -20757, -21206, -17997, -7646, 3901, 12166, 15751, 15929,
-    14757, 14252, 14020, 12175, 8969, 6140, 6304, 8739, 13456, 19286,
-    20841, 17849, 12581, 6518, 1891, -1206, -4858, -10117, -15377, -16003,
-    -12262, -7063, -2241, -2609, -7400, -13412, -17410, -18797, -19374, -20428,
-    -20753, -19722, -12365, -903, 8559, 14437, 16276, 15831, 14787, 14251,
-    12433, 9660, 6845, 6525, 8400, 11715, 17303, 20512, 19002, 14883,
-    9113, 3806, 220, -3404, -8373, -13934, -16236, -13198, -8639, -3540,
-    -2020, -5742, -11577, -16191, -18400, -19041, -20345, -21416, -21219, -16190,
-    -4828, 5573, 12752, 15630, 15786, 14809, 14497, 13483, 10931, 7811,
-    6204, 7491, 10033, 15394, 20336, 20284, 16934, 11414, 5486, 1217,
-    -1944, -6073, -11713, -16142, -15078, -10813, -5625, -1801, -3608, -9203,
-    -14706, -18252, -19396, -20227, -21312, -21308, -18694, -9303, 1538, 9914,
-    14639, 16124, 15815, 15083, 14029, 11393, 8506, 6644, 7654, 9806,
-    13691, 18820, 20356, 18131, 13779, 8192, 3182, -687, -5148, -10438,
-    -15467, -15785, -11982, -7556, -3199, -3525, -7887, -13236, -16980, -18633,
-    -19784, -21423, -21972, -20458, -12718, -1237, 7726, 13445, 15562, 15834,
-    15740, 15330, 13129, 10017, 7037, 6952, 9159, 12126, 17412, 20344,
-    18663, 14847, 9291, 3698, -104, -3779, -8711, -14287, -16816, -13736,
-    -9288, -4511, -2675, -5937, -11388, -15672, -17943, -19115, -20448, -21126,
-    -20414, -15256, -4408, 5523, 12016, 14877, 15632, 15557, 15290, 13457,
-    10280, 6994, 6118, 8279, 10988, 15748, 19465, 18664, 15081, 10251,
-    5207, 1183, -2372, -7158, -12663, -16412, -13975, -9434, -4781, -1867,
-    -4361, -9652, -14538, -17092, -17988, -19335, -21183, -21155, -18188, -8428,
-    2785, 10103, 13865, 14346, 13905, 14058, 13582, 11260, 8219, 5863,
-    6700, 9568, 13923, 19342, 20420, 17395, 12656, 6958, 2215, -608,
-    -4441, -9740, -14781, -15288, -11195, -6348, -1994, -2556, -7444, -13410,
-    -17324, -19108, -20128, -21422, -21810, -20514, -13108, -1764, 7273, 13025,
-    14718, 14574, 14304, 13893, 12118, 9361, 6779, 7120, 9688, 13262,
-    18944, 21447, 19373, 15144, 9114, 3551, -306, -4184, -9029, -14246,
-    -16404, -12986, -8781, -4102, -2561, -6277, -11963, -16738, -19393, -20531,
-    -21559, -21728, -20279, -14923, -4202, 5730, 12314, 15449, 16132, 15529,
-    14853, 12735, 9815, 7417, 6708, 9104, 12201, 16661, 19777, 18720,
-    15195, 10051, 4604, -83, -4032, -8809, -13497, -16071, -13567, -9103,
-    -4519, -2144, -4665, -9340, -14180, -17052, -18551, -20358, -21448, -20622,
-    -16738, -6822, 3483, 10546, 14193, 14557, 14144, 14082, 12748, 10014,
-    7193, 5087, 6808, 9998, 14621, 19342, 19489, 16739, 12128, 6524,
-    1966, -1339, -5623, -10187, -14271, -14052, -9952, -5665, -2009, -2952,
-    -7697, -12998, -16963, -19297, -20947, -22339, -21989, -19132, -11229, -960,
-    6867, 11560, 13721, 14518, 14703, 13991, 11254, 8151, 6370, 7751,
-    11093, 15197, 19588, 20504, 18036, 13878, 9168, 4503, 444, -4425,
-    -9972, -14958, -15663, -11734, -7476, -3793, -4212, -8588, -13492, -16990,
-    -18752, -19790, -22026, -22348, -20588, -13763, -2284, 6814, 12375, 14553,
-    14937, 15096, 15556, 13719, 10863, 8071, 6977, 9640, 12949, 17725,
-    20164, 17870, 13535, 8345, 3249, -460, -4060, -9133, -13651, -16114,
-    -13338, -8756, -4513, -2928, -6017, -10980, -14794, -17200, -18371, -19748,
-    -20667, -19675, -14689, -4562, 4804, 10941, 13354, 13658, 13764, 14323,
-    13338, 10090, 6819, 5327, 7307, 10952, 15824, 19467, 17923, 14198,
-    9437, 5026, 1884, -1166, -5816, -11211, -14734, -12926, -8324, -3862,
-    -1375, -3963, -9456, -13909, -16750, -17912, -18991, -21407, -21788, -19371,
-    -10180, 973, 8420, 11794, 12217, 11881, 12869, 13910, 11932, 9134,
-    6507, 6787, 10083, 14921, 20655, 21498, 17731, 12263, 7222, 3240,
-    711, -2982, -8808, -13922, -15343, -11476, -6880, -2747, -3143, -8132,
-    -14138, -17993, -19664, -20009, -21206, -22047, -21036, -14834, -3033, 6596,
-    12481, 14177, 13636, 13675, 14596, 14062, 11496, 8552, 7425, 9639,
-    13262, 18741, 21718, 18951, 13897, 8059, 3215, -145, -3291, -8238,
-    -13475, -16488, -13800, -9290, -4806, -2674, -5946, -11737, -16322, -18829,
-    -19088, -19314, -20572, -20219, -16603, -6114, 4914, 12010, 14540, 14261,
-    13695, 14288, 14516, 12076, 8905, 6733, 7672, 10810, 15560, 20066,
-    19099, 14692, 9215, 4343, 556, -2073, -5996, -11421, -15330, -14598,
-    -10171, -5534, -1743, -3350, -8623, -13905, -16552, -17732, -17941, -19644,
-    -20652, -19218, -11448, 588, 8945, 13548, 13384, 12206, 12393, 13858,
-    12965, 9748, 6498, 5392, 7829, 12384, 18844, 20708, 17113, 12175,
-    6593, 2306, 328, -2506, -7612, -13059, -15549, -11986, -7123, -1959,
-    -683, -5264, -11808, -16281, -18449, -18767, -19390, -20953, -21316, -17705,
-    -6372, 4370, 11513, 13872, 12751, 11930, 12964, 13438, 11432, 8194,
-    5947, 7289, 10401, 16319, 21245, 20384, 15992, 10473, 5368, 1856,
-    -774, -5166, -10561, -15345, -14369, -9882, -5161, -1276, -3384, -9120,
-    -15261, -18385, -19271, -19924, -21397, -22155, -20801, -12122, 296, 9343,
-    13911, 14103, 13350, 13628, 14926, 13952, 10434, 6751, 6692, 9140,
-    13681, 20252, 22243, 18502, 13080, 7311, 2710, 244, -2671, -8473,
-    -14320, -16330, -12835, -7863, -2616, -1638, -6392, -12523, -17157, -18762,
-    -19050, -19988, -21369, -21790, -17292, -4873, 6116, 12895, 15151, 13570,
-    12729, 13905, 13890, 11315, 7633, 5293, 6323, 9775, 16395, 20967,
-    19253, 15103, 9648, 4378, 1158, -1241, -6041, -12026, -16151, -14653,
-    -9968, -4298, -387, -3421, -9346, -14860, -17378, -18421, -18703, -20358,
-    -22179, -21457, -11928, 937, 9681, 14292, 13844, 12253, 12624, 14287,
-    13083, 10128, 6437, 5455, 7729, 13569, 20335, 21654, 18454, 12858,
-    6947, 2068, -372, -2852, -8141, -13742, -16382, -13160, -7921, -2057,
-    -513, -5630, -12566, -17222, -19089, -19188, -20291, -21972, -22695, -17832,
-    -5321, 5822, 13891, 15818, 14268, 12946, 14343, 14584, 11605, 8784,
-    6816, 8028, 11043, 17428, 22235, 20924, 16622, 10273, 3995, 674,
-    -1384, -6102, -11938, -16349, -15075, -10320, -4378, -416, -3388, -9779,
-    -16078, -18948, -19956, -19428, -20393, -22703, -21022, -10917, 1480, 10361,
-    14766, 13989, 12427, 11944, 13354, 12371, 8697, 6097, 6179, 8509,
-    13648, 19954, 21318, 18221, 12474, 6081, 866, -2279, -4259, -10069,
-    -15985, -16482, -12424, -6821, -1275, -865, -6462, -13053, -17567, -19161,
-    -19371, -20408, -21656, -22055, -15602, -1864, 8337, 14410, 15513, 12116,
-    6487, 5527, 9522, 12010, 11681, 7482, 5647, 7516, 14170, 21473,
-    23302, 20852, 13952, 5820, -1198, -2690, -1792, -3911, -8013, -11769,
-    -11008, -5974, 674, 3758, -1195, -10836, -17932, -21097, -19292, -15337,
-    -14218, -16422, -18368, -15797, -5883, 6632, 13404, 13422, 8487, 4525,
-    6379, 11071, 13718, 11291, 6876, 6339, 9463, 16982, 22749, 22735,
-    17793, 9725, 2315, -2152, -1197, -443, -3450, -8565, -11513, -9446,
-    -3706, 2244, 2129, -5947, -15062, -20178, -20513, -16377, -13120, -13950,
-    -17322, -18077, -13153, -2630, 8117, 12300, 10084, 5285, 3868, 7575,
-    12531, 14576, 11073, 6776, 7064, 11882, 19288, 23327, 21808, 14453,
-    6214, 712, -1245, -24, -480, -4323, -9733, -11563, -7944, -1944,
-    2066, -493, -9654, -17409, -20361, -18244, -14103, -12376, -14256, -17345,
-    -16381, -10556, -381, 8221, 10548, 7674, 4156, 4728, 9049, 14224,
-    15290, 10403, 6128, 7740, 13210, 19953, 23356, 19402, 10842, 3777,
-    534, -259, 527, -378, -4722, -9837, -10371, -5818, -1291, 1332,
-    -2544, -11333, -17636, -19015, -16093, -12828, -11986, -13966, -16126, -15083,
-    -9680, -989, 6229, 7975, 5981, 4303, 5288, 9871, 15103, 15313,
-    10131, 6561, 8493, 13401, 19305, 21743, 17027, 9030, 3720, 1571,
-    445, 679, -44, -4220, -8895, -8967, -5694, -2015, 409, -3369,
-    -10892, -16452, -17562, -15005, -12156, -11432, -13285, -15652, -14945, -10324,
-    -3252, 3639, 6173, 5441, 4615, 6017, 10553, 15615, 15964, 11474,
-    7520, 8146, 12731, 17828, 20030, 16388, 9563, 4803, 2231, 1130,
-    1591, 683, -3318, -8083, -9554, -7392, -3530, -892, -3466, -10699,
-    -16493, -17533, -15088, -11978, -11221, -13390, -15979, -15391, -11302, -4984,
-    1773, 5746, 5966, 5603, 6913, 10594, 15085, 16692, 13142, 8248,
-    7452, 10528, 15593, 18714, 17113, 11288, 5410, 2627, 1838, 2149,
-    1591, -2077, -7608, -10341, -8616, -4337, -1147, -2580, -8581, -14410,
-    -16252, -14057, -11175, -11230, -13301, -15873, -15941, -12690, -6704, 873,
-    5661, 6955, 6778, 7222, 9868, 14481, 16617, 12974, 7718, 5596,
-    7916, 13146, 18221, 18164, 12722, 6970, 3420, 2194, 2781, 2366,
-    -1986, -7954, -11085, -9505, -5139, -805, -1125, -6830, -12365, -14342,
-    -13842, -12207, -11734, -13864, -16153, -16340, -13502, -8108, -395, 6049,
-    7839, 7704, 8033, 9636, 13500, 16065, 13335, 7293, 4264, 6788,
-    12243, 17967, 19667, 14596, 7947, 4347, 2943, 2546, 1564, -2120,
-    -7892, -11097, -10068, -6080, -1785, -447, -4528, -10760, -13811, -13999,
-    -12842, -12187, -13692, -15945, -16211, -13532, -8469, -2128, 4464, 7807,
-    8010, 8132, 8918, 11426, 14044, 13049, 8191, 4157, 5204, 10326,
-    16084, 19190, 15832, 9119, 4913, 3077, 2135, 1389, -1191, -6127,
-    -9786, -9925, -6724, -2311, 236, -2037, -8122, -12350, -13506, -12683,
-    -11515, -12552, -14697, -15464, -13127, -8788, -3872, 1588, 5779, 7163,
-    7482, 8063, 9150, 11546, 12541, 10059, 5861, 4571, 8251, 13898,
-    17831, 17234, 11799, 6281, 4114, 2963, 1936, -113, -3813, -7655,
-    -9255, -7197, -3780, -1398, -1730, -5931, -10933, -12909, -12600, -12149,
-    -12644, -13759, -13973, -12478, -9226, -5549, -2118, 1866, 5359, 7125,
-    7774, 8283, 9325, 11065, 11352, 9108, 6404, 7101, 10819, 14340,
-    15896, 13717, 8769, 5139, 3638, 1858, 53, -2162, -5182, -7749,
-    -7669, -6072, -4650, -3345, -4101, -7337, -10333, -11675, -12215, -12223,
-    -11706, -10806, -10223, -9066, -7161, -5283, -1936, 2939, 6182, 7169,
-    7001, 7041, 8701, 10858, 11184, 8648, 5757, 6488, 9723, 12496,
-    13934, 11425, 7045, 4233, 2230, 641, -437, -1952, -4420, -7155,
-    -7826, -6368, -4339, -2265, -3043, -6722, -9986, -11230, -10978, -9729,
-    -8666, -8748, -9489, -9214, -7574, -5436, -1451, 3036, 5160, 5661,
-    6099, 6959, 9114, 11168, 10726, 7159, 4323, 6391, 10077, 12876,
-    13634, 9908, 5477, 4268, 3410, 2006, 393, -2104, -5271, -7596,
-    -7140, -5719, -3865, -2039, -3623, -7351, -9321, -9350, -8863, -8457,
-    -8690, -9616, -10158, -9076, -7081, -5243, -1998, 2112, 4752, 6144,
-    7310, 8319, 9628, 10219, 8538, 5244, 4117, 6960, 10040, 11668,
-    11320, 7930, 5189, 4974, 3864, 1194, -1768, -4279, -6329, -7111,
-    -6354, -5329, -3771, -2094, -2843, -5159, -6825, -7693, -8066, -8513,
-    -9316, -10072, -9517, -7710, -6165, -4966, -2111, 1630, 4813, 7152,
-    7899, 7579, 7403, 7347, 6680, 4942, 4846, 7073, 8464, 9680,
-    9969, 8133, 6562, 5328, 2529, -678, -2483, -3387, -4333, -5066,
-    -5019, -4643, -2878, -177, -554, -3464, -5832, -7628, -8718, -9202,
-    -9668, -9439, -8580, -7118, -5911, -5844, -3766, 764, 4545, 6595,
-    6694, 5342, 5057, 6507, 7551, 6397, 5016, 6084, 7556, 9269,
-    11011, 9783, 7035, 4948, 2104, -842, -1878, -2001, -2820, -4040,
-    -4646, -4321, -2314, 618, 735, -2757, -6024, -8277, -9812, -9549,
-    -8989, -8706, -7864, -6977, -6412, -6104, -3688, 904, 4203, 5505,
-    5000, 3750, 3952, 6146, 7416, 6119, 4417, 4986, 6901, 9176,
-    11202, 9781, 6202, 3585, 1292, -864, -1098, -933, -2083, -3912,
-    -4545, -3446, -1333, 1170, 848, -2879, -6272, -7578, -7872, -7750,
-    -7923, -7955, -7678, -6939, -6076, -6364, -5408, -1747, 1976, 3977,
-    3842, 2698, 3055, 4958, 6789, 6186, 3698, 3392, 5456, 8105,
-    10525, 10160, 7134, 4716, 3237, 1884, 1148, 462, -867, -2810,
-    -3762, -2675, -1090, 765, 1254, -1336, -4077, -5882, -7061, -7496,
-    -8205, -8510, -8608, -8360, -7722, -7758, -6580, -2782, 1025, 2917,
-    3062, 2308, 2551, 4494, 6359, 6002, 3929, 3571, 5920, 8461,
-    10854, 11266, 8388, 5875, 4629, 2579, 836, 31, -1155, -2871,
-    -3342, -2437, -1530, 282, 1502, -437, -3795, -5391, -6365, -7397,
-    -7872, -8314, -9076, -8555, -6511, -6045, -6298, -4935, -2254, 135,
-    1960, 2742, 2409, 2657, 4591, 6142, 5498, 4607, 5096, 5736,
-    7012, 9304, 8807, 6653, 5399, 3809, 1516, 629, 728, -387,
-    -1395, -1517, -1821, -1489, 284, 1167, -480, -3119, -5278, -7160,
-    -7836, -7747, -8000, -8178, -8158, -8031, -8136, -7395, -4843, -1774,
-    477, 1064, 836, 1576, 3805, 6768, 7827, 5844, 3942, 4587,
-    6776, 9715, 10945, 8652, 5598, 3953, 3468, 3183, 2554, 1233,
-    -690, -2141, -2309, -1401, 99, 1179, 92, -3062, -6345, -8019,
-    -7486, -6800, -7168, -7672, -8327, -7884, -6180, -5790, -6056, -5272,
-    -3348, -870, 1116, 3021, 4865, 6488, 7998, 7710, 5315, 4135,
-    5149, 6363, 7198, 7113, 5703, 4786, 5214, 5405, 4055, 2034,
-    272, -1364, -2312, -2254, -1893, -1383, -450, -768, -2522, -4075,
-    -4940, -5500, -6034, -6924, -7732, -8100, -7999, -7800, -8614, -8506,
-    -6185, -2521, 1111, 3070, 3617, 4350, 5272, 5991, 5425, 3120,
-    2085, 3770, 6297, 8575, 9555, 8127, 6737, 5975, 4841, 3183,
-    1180, -434, -2052, -3047, -2054, -624, 541, 1576, -63, -2844,
-    -4851, -6251, -6667, -7217, -8315, -8793, -8417, -7229, -6292, -6832,
-    -7004, -5936, -3136, 668, 2908, 3662, 4008, 4169, 5073, 5732,
-    4808, 4829, 6252, 7303, 8399, 8544, 7250, 6258, 5467, 4116,
-    2003, 302, -316, -1079, -1731, -1419, -1108, -249, 958, 447,
-    -1419, -3416, -5024, -6379, -7344, -7860, -7595, -7066, -6392, -6449,
-    -7783, -7849, -5762, -2344, 1044, 2573, 2103, 1936, 3127, 5047,
-    5793, 4224, 3225, 4485, 6659, 9075, 9186, 6738, 4949, 3761,
-    3053, 2379, 1163, 313, -519, -1147, -887, -232, 966, 2045,
-    943, -1801, -4014, -5648, -6543, -6614, -7036, -7140, -6777, -6133,
-    -6150, -7674, -8430, -8269, -6292, -2128, 730, 2009, 3442, 4302,
-    4992, 5946, 5124, 4088, 4650, 5714, 6355, 6151, 5494, 5476,
-    5894, 5989, 4866, 2276, 1070, 661, -323, -396, -325, -265,
-    791, 1228, 217, -1399, -3300, -5258, -7204, -8283, -8024, -7260,
-    -6537, -7049, -9306, -10049, -8192, -4462, 580, 3151, 2282, 1587,
-    1763, 3349, 6199, 6268, 3899, 2494, 3518, 6562, 9662, 10311,
-    8250, 4856, 2337, 1786, 1563, 1811, 1486, -617, -2104, -1587,
-    1048, 4369, 5115, 2099, -2980, -6944, -7572, -6266, -5607, -6115,
-    -7820, -8682, -7778, -6796, -5974, -5880, -6297, -4374, -799, 1285,
-    2908, 3213, 2599, 3260, 3764, 3732, 3449, 3815, 5582, 6562,
-    6275, 5997, 4990, 4329, 4291, 2622, 758, 496, 907, 1272,
-    1367, 1649, 1949, 2223, 2245, 499, -2703, -4866, -6244, -7152,
-    -6761, -6747, -6895, -6831, -7318, -7716, -7829, -7603, -5535, -2941,
-    -1177, 536, 1273, 2188, 4237, 5394, 4992, 4025, 4043, 5167,
-    6312, 6788, 5625, 4249, 4406, 5056, 4704, 3978, 3215, 2566,
-    2201, 1940, 1721, 1563, 1652, 944, -875, -3066, -4068, -4835,
-    -5618, -6075, -7116, -7169, -6205, -6179, -7464, -9352, -10284, -8217,
-    -3975, 36, 2091, 2194, 2156, 3490, 5484, 5933, 4244, 2501,
-    2230, 3526, 5508, 6636, 6400, 5897, 5490, 4767, 3940, 3014,
-    2415, 1450, 115, -671, -172, 1389, 2783, 2289, -225, -2656,
-    -4228, -4844, -5370, -6552, -7450, -7659, -7121, -6847, -7736, -8338,
-    -7667, -5011, -1635, 418, 1096, 1184, 1904, 3375, 4074, 3345,
-    1971, 1676, 3287, 5184, 6435, 6404, 6001, 5892, 5776, 4870,
-    3319, 2421, 1607, 881, 586, 693, 1356, 2512, 2809, 1078,
-    -1279, -2797, -4108, -5158, -6221, -7647, -7756, -6245, -5413, -6134,
-    -7979, -9222, -8001, -4646, -1110, 290, 360, 624, 1972, 4099,
-    5046, 3821, 2240, 2035, 3367, 5458, 6896, 6933, 6040, 5407,
-    4814, 4087, 3623, 3357, 2184, 509, -276, -170, 1271, 3031,
-    2545, 73, -2397, -3609, -3995, -4184, -4917, -6296, -6548, -5640,
-    -5144, -6223, -7641, -8334, -7133, -3926, -937, 603, 986, 1527,
-    2568, 3492, 3643, 2581, 1555, 2262, 3743, 5079, 6020, 6055,
-    5575, 5266, 4793, 3618, 2762, 2220, 830, -426, -605, 409,
-    2214, 3417, 2705, 323, -1448, -2176, -2916, -4042, -5560, -6843,
-    -6497, -5280, -5115, -6627, -8705, -9214, -7377, -3591, -732, 13,
-    -161, -59, 1287, 2710, 3058, 1958, 963, 1954, 3812, 5937,
-    7281, 6972, 6086, 4931, 4024, 3455, 2972, 2261, 1020, -197,
-    -224, 1356, 3574, 4738, 3633, 991, -1273, -2591, -3366, -4118,
-    -5430, -6347, -6184, -5358, -5456, -6932, -8238, -8461, -6510, -3200,
-    -994, -634, -438, 632, 2132, 3729, 3660, 2116, 1351, 2471,
-    4679, 6133, 6578, 5734, 4564, 4536, 4553, 4005, 3307, 1944,
-    179, -559, 370, 2262, 4051, 4746, 3186, 614, -874, -1773,
-    -2672, -3751, -5397, -6542, -6215, -5289, -5599, -7387, -9237, -9636,
-    -7421, -3813, -1386, -953, -1179, -250, 1366, 2549, 2739, 1467,
-    815, 1942, 3773, 5143, 5876, 6187, 5449, 5047, 4771, 3753,
-    3318, 2919, 1806, 1077, 1788, 3308, 4715, 5303, 3769, 959,
-    -1014, -2052, -2992, -4188, -5784, -7020, -6706, -5688, -6046, -8115,
-    -10158, -10342, -7710, -3764, -1337, -1103, -1471, -632, 1396, 3193,
-    3520, 2138, 1164, 2114, 3787, 5845, 7298, 7074, 6383, 5797,
-    5152, 4541, 4338, 3714, 2072, 883, 1086, 2447, 4370, 5721,
-    4483, 1566, -842, -2731, -3699, -4621, -6042, -7284, -7680, -7041,
-    -7180, -8373, -9242, -9200, -7459, -4314, -2202, -1578, -1042, -208,
-    1119, 2324, 2493, 1870, 1444, 2697, 4604, 5877, 7293, 7403,
-    6555, 6398, 5858, 4859, 4000, 3126, 1951, 1320, 2265, 3749,
-    4889, 5477, 4195, 1275, -692, -2138, -3990, -5316, -6902, -8031,
-    -7642, -6902, -7380, -9147, -10387, -10108, -7950, -4522, -2178, -1809,
-    -1618, -537, 964, 2620, 3220, 2340, 1604, 2234, 4272, 6122,
-    7561, 8312, 7375, 6486, 5863, 4694, 4092, 3796, 2645, 1486,
-    1615, 2768, 4207, 5483, 4814, 1793, -1084, -2988, -4814, -5800,
-    -6350, -7615, -7777, -7378, -8002, -8934, -9624, -9546, -8070, -5237,
-    -3129, -2308, -1325, 163, 1536, 2615, 3113, 2003, 1491, 3066,
-    5108, 7197, 8458, 8280, 7276, 6375, 6133, 5464, 4565, 3863,
-    2268, 1340, 2206, 3566, 5156, 6050, 4522, 1368, -1324, -2974,
-    -4025, -5010, -6294, -7963, -8636, -7898, -7682, -8621, -9765, -10380,
-    -9356, -6178, -2858, -1114, -426, -133, 488, 1663, 2765, 3045,
-    2444, 3049, 4559, 5825, 7496, 8251, 7970, 7351, 6257, 4904,
-    3853, 3542, 2938, 2085, 1970, 2499, 3676, 5149, 4954, 2463,
-    -450, -2861, -4740, -5849, -6634, -7717, -8398, -8286, -8487, -9407,
-    -10229, -10041, -8472, -5570, -2913, -1951, -1554, -575, 1003, 2581,
-    2974, 2174, 1550, 2798, 5526, 7550, 8608, 8372, 7183, 6606,
-    6190, 5480, 4465, 3403, 2552, 2039, 2669, 4072, 5390, 5999,
-    4889, 1831, -1137, -2834, -4302, -5302, -6529, -8319, -8881, -8288,
-    -7738, -8544, -10060, -10636, -9768, -6671, -3062, -1378, -762, -104,
-    737, 2176, 3317, 3121, 2754, 3263, 4580, 6059, 7208, 7786,
-    7461, 6990, 6618, 5553, 4665, 4462, 3715, 2913, 2813, 3148,
-    4131, 5217, 4883, 2768, -137, -2436, -4039, -5537, -6617, -8034,
-    -9055, -8706, -8814, -9832, -10843, -10959, -9445, -6336, -3267, -1835,
-    -1431, -762, 790, 2260, 3068, 2884, 1925, 2701, 4938, 6799,
-    8375, 8735, 7846, 7066, 6386, 5519, 4673, 4194, 3724, 2881,
-    2787, 3852, 5129, 6221, 5698, 2546, -976, -3388, -4768, -5591,
-    -7015, -8791, -9857, -9464, -8547, -8956, -10165, -10902, -10173, -7145,
-    -3518, -1673, -1273, -808, 460, 2298, 3573, 3532, 2734, 3055,
-    4875, 6476, 7647, 8098, 7443, 7011, 6856, 6176, 5456, 5201,
-    4667, 3680, 3224, 3535, 4345, 5451, 5449, 2834, -446, -2821,
-    -4479, -5424, -6712, -8349, -9432, -9266, -8590, -9157, -10575, -11235,
-    -10336, -7292, -3664, -1987, -1705, -1059, 346, 2286, 3730, 3527,
-    2542, 2577, 4531, 6766, 8163, 9050, 8277, 7211, 7070, 6417,
-    5742, 5452, 4622, 3283, 2719, 3358, 4780, 6137, 5806, 2824,
-    -1168, -3581, -4836, -5897, -6937, -8999, -10449, -9772, -8750, -8587,
-    -9814, -10992, -10390, -7976, -4259, -1751, -1505, -1003, 325, 1878,
-    3834, 4205, 3062, 2698, 3775, 5812, 7369, 8261, 8160, 6817,
-    6219, 6104, 5676, 5943, 5632, 3885, 2706, 2859, 4037, 5730,
-    5961, 3484, -239, -3077, -4140, -4831, -6090, -7692, -9704, -9749,
-    -8607, -8585, -9501, -10928, -11062, -8901, -5236, -2191, -1215, -949,
-    75, 1492, 3014, 3938, 3075, 2333, 3512, 5175, 7194, 9028,
-    8919, 7830, 6918, 6430, 6159, 6062, 5860, 4223, 2551, 2642,
-    3931, 5733, 6602, 4197, -95, -3227, -4906, -5466, -6267, -8089,
-    -9858, -10279, -9015, -8015, -8897, -10159, -10722, -9442, -5751, -2367,
-    -875, -417, 221, 1429, 3064, 4242, 4051, 2895, 2987, 4434,
-    5862, 7803, 8555, 7564, 6700, 5987, 5387, 5580, 5828, 4606,
-    2789, 2092, 2838, 4552, 5929, 4911, 1459, -1820, -3649, -4693,
-    -5408, -6719, -8812, -9770, -9270, -8513, -8754, -9739, -10245, -9369,
-    -6733, -3660, -1749, -1149, -399, 787, 1936, 3079, 3219, 2465,
-    2964, 4575, 6176, 7884, 8763, 8137, 7187, 6710, 6155, 5825,
-    5733, 4877, 3569, 3216, 3920, 4836, 5656, 4700, 1492, -1693,
-    -3901, -5431, -6472, -7742, -9128, -9369, -8574, -7600, -7852, -9430,
-    -10571, -10214, -7742, -4198, -1938, -1201, -415, 1040, 3011, 4745,
-    4948, 3423, 2178, 2843, 4727, 6726, 8082, 7558, 6177, 6112,
-    6513, 6920, 7270, 5797, 3261, 1867, 2081, 3706, 5337, 5022,
-    2405, -822, -2831, -3560, -4215, -5548, -7806, -9762, -9686, -8507,
-    -7984, -8808, -10504, -10911, -8882, -5263, -1793, -451, -408, 62,
-    999, 2600, 3809, 3034, 1860, 2091, 3608, 6171, 8603, 9278,
-    8392, 7356, 6792, 6516, 6609, 6111, 4113, 2330, 2253, 3430,
-    5185, 5969, 3951, 393, -2803, -4801, -5592, -6529, -8191, -9844,
-    -10308, -9175, -7784, -7670, -8689, -9562, -8869, -6238, -2958, -873,
-    -272, 5, 1005, 2693, 4097, 4185, 2923, 2264, 3222, 4930,
-    7071, 8184, 7400, 6484, 6171, 6122, 6421, 6229, 4869, 3226,
-    2513, 3156, 4561, 5537, 4483, 1498, -1592, -3795, -4902, -5459,
-    -6721, -8386, -9288, -8937, -7745, -7262, -8197, -9561, -9760, -8000,
-    -4763, -1862, -636, -360, 245, 1483, 2977, 3765, 2803, 1744,
-    2382, 4054, 6485, 8379, 8404, 7642, 7169, 7056, 6979, 6717,
-    5572, 3697, 2713, 3100, 4117, 5198, 4809, 2274, -840, -3470,
-    -5213, -6016, -7159, -8665, -9247, -8857, -7551, -6676, -7545, -9196,
-    -9972, -8593, -5488, -2476, -962, -645, -45, 1488, 3539, 4714,
-    3814, 1822, 1259, 2554, 4708, 6973, 7653, 6832, 6526, 6952,
-    7390, 7579, 6546, 4279, 2490, 2227, 3183, 4631, 5120, 3565,
-    750, -1762, -3235, -4026, -5013, -6996, -8889, -9324, -8443, -6992,
-    -6942, -8645, -10222, -9994, -7204, -3451, -1148, -930, -1331, -763,
-    1102, 3192, 3739, 2198, 826, 1678, 4070, 7187, 9356, 8893,
-    7670, 7172, 7019, 7417, 7123, 5545, 3373, 2101, 2735, 4220,
-    5556, 5095, 2267, -1080, -3693, -5138, -5595, -6825, -8760, -9724,
-    -9177, -7275, -5806, -6657, -8751, -10104, -9210, -5695, -2273, -787,
-    -825, -871, 575, 2890, 4549, 3943, 1903, 978, 2119, 4729,
-    7564, 8593, 7705, 7069, 6691, 6711, 7227, 6527, 4462, 2603,
-    1895, 2776, 4607, 5669, 4493, 1338, -1758, -3801, -4671, -5332,
-    -7014, -8977, -9481, -8350, -6478, -5775, -7542, -9580, -10023, -8100,
-    -4677, -2360, -1837, -1998, -1305, 857, 3269, 4006, 2856, 1754,
-    2102, 3907, 6646, 8575, 8510, 7688, 7224, 7026, 7376, 7656,
-    6463, 4546, 3085, 2808, 3882, 5113, 4713, 1953, -1373, -3856,
-    -5053, -5174, -6177, -8206, -9406, -8942, -7013, -5635, -6758, -9394,
-    -11178, -10205, -6657, -3031, -1208, -1085, -1037, 694, 3269, 4753,
-    4082, 1856, 825, 1776, 4316, 7417, 8703, 8265, 7694, 7328,
-    7401, 7949, 7279, 5043, 2679, 1459, 2075, 3958, 5307, 4304,
-    1313, -1717, -3483, -3949, -4314, -6264, -8709, -9754, -8977, -6960,
-    -6030, -7677, -10208, -11003, -9045, -5042, -1897, -1075, -1489, -1559,
-    100, 2537, 3786, 2959, 1378, 1387, 3195, 6165, 9067, 9841,
-    9085, 8042, 7135, 7238, 7374, 6422, 4549, 2671, 2100, 3285,
-    5126, 5723, 3735, 78, -3103, -4994, -5465, -6332, -8370, -9755,
-    -9812, -8199, -5964, -6119, -8430, -10348, -10430, -7801, -4114, -1858,
-    -1500, -1552, -208, 2215, 4196, 4621, 2962, 1491, 2326, 4263,
-    6897, 8687, 8395, 7654, 7228, 7281, 7724, 7449, 5924, 3699,
-    1873, 1977, 3476, 4710, 4467, 2068, -1135, -3314, -4123, -4604,
-    -6166, -8430, -9413, -8757, -6923, -5792, -7390, -9940, -11034, -9634,
-    -5974, -2533, -1677, -2130, -1757, -71, 2416, 3949, 3296, 1310,
-    888, 3019, 5911, 8575, 9557, 8367, 7310, 7149, 7501, 8103,
-    7388, 5309, 3013, 1947, 2994, 4919, 5830, 4225, 653, -2873,
-    -4742, -4900, -5354, -7280, -9175, -9812, -8361, -5875, -5673, -8174,
-    -11098, -11877, -9420, -5140, -1810, -1230, -1726, -579, 1758, 4151,
-    5251, 3286, 764, 808, 2827, 5964, 8825, 9268, 8241, 7535,
-    7605, 8290, 8335, 7058, 4216, 1153, 533, 2168, 4519, 5663,
-    3668, 141, -2655, -3989, -3901, -4971, -7657, -9771, -10267, -8400,
-    -6129, -6576, -8869, -10799, -10540, -7135, -3321, -1472, -1653, -2215,
-    -1175, 1055, 3079, 3707, 2299, 839, 1950, 4651, 7885, 10238,
-    9773, 8119, 7202, 7033, 7819, 8066, 6160, 3479, 1189, 1439,
-    4056, 6003, 5886, 2816, -1418, -4092, -5052, -5388, -6616, -8926,
-    -10125, -9400, -7266, -5501, -6814, -9624, -11083, -9955, -6314, -2845,
-    -1703, -1940, -1697, 76, 2913, 4782, 4477, 2239, 746, 2159,
-    5020, 8123, 9723, 8386, 6751, 6645, 7366, 8350, 7922, 5306,
-    2077, 363, 1665, 4530, 6286, 5423, 1702, -2027, -3776, -4237,
-    -4265, -5913, -8608, -9717, -8849, -6507, -5315, -7653, -10942, -12262,
-    -10101, -5389, -2343, -1835, -2703, -2800, -18, 3334, 4738, 3812,
-    1024, -316, 2142, 6003, 9470, 10636, 8918, 7587, 7706, 8744,
-    9755, 8515, 5148, 1654, -37, 2012, 5423, 6685, 5083, 590,
-    -3369, -4597, -4575, -4819, -7189, -10385, -11367, -9855, -6987, -6002,
-    -8705, -11884, -12191, -8500, -3405, -675, -942, -2277, -1859, 1328,
-    4855, 5771, 4024, 1127, 88, 2792, 7198, 10435, 10660, 8389,
-    6456, 6406, 7833, 8768, 6971, 3095, -659, -1233, 2070, 6107,
-    7494, 4610, -279, -3628, -4442, -3675, -3933, -7036, -10032, -10671,
-    -8735, -5448, -5139, -8215, -11632, -11830, -7567, -3035, -992, -1637,
-    -3684, -2868, 933, 4133, 5298, 3433, 124, -513, 2628, 7389,
-    10782, 10605, 8110, 6155, 6532, 8879, 9904, 8042, 3880, -125,
-    54, 3900, 7513, 8043, 4115, -1523, -4655, -4992, -4037, -4593,
-    -7937, -10992, -11620, -9461, -6362, -6418, -9591, -12808, -12359, -7316,
-    -2623, -562, -1194, -2971, -1592, 2580, 5854, 6320, 3865, 357,
-    -272, 3253, 8356, 11373, 10624, 7916, 5880, 6596, 9072, 9588,
-    6813, 2292, -1258, -569, 3549, 7037, 6930, 2704, -2269, -4754,
-    -4592, -3569, -4331, -7693, -10712, -11139, -8880, -5925, -6148, -9507,
-    -12738, -11383, -5918, -1571, 79, -1357, -3346, -1454, 2879, 5725,
-    5395, 2341, -825, -851, 3526, 9068, 11510, 10475, 7747, 5939,
-    7077, 9402, 9520, 6465, 1755, -1055, 294, 4408, 7927, 7110,
-    2203, -2526, -4688, -4566, -3576, -4990, -9044, -12009, -11937, -9076,
-    -6271, -6538, -9841, -12983, -10434, -4568, -1096, 448, -1473, -3517,
-    -464, 3836, 6134, 5435, 2302, -533, -308, 4317, 9685, 11269,
-    9771, 6939, 4843, 6447, 9117, 9023, 5810, 970, -1505, 709,
-    5238, 8306, 6585, 1071, -3200, -4610, -3833, -2792, -4681, -8827,
-    -11441, -10823, -7872, -5440, -6339, -10366, -13299, -10037, -4314, -890,
-    149, -2380, -3928, -678, 3771, 5830, 4423, 1188, -1797, -1258,
-    4463, 9923, 11493, 10044, 6703, 4975, 7176, 10459, 10509, 6428,
-    1100, -1157, 1017, 6061, 9357, 6481, 687, -3735, -5210, -3587,
-    -2595, -5453, -10087, -13078, -12153, -8377, -5857, -6373, -11142, -14174,
-    -9548, -3841, 183, 1491, -2229, -3697, -74, 4345, 6960, 5090,
-    1447, -1471, -1499, 4837, 10763, 11815, 10348, 6156, 3592, 6391,
-    9921, 10292, 6255, 115, -2200, 0, 5553, 9748, 6425, 229,
-    -4111, -5690, -3425, -1677, -4454, -9209, -12602, -12075, -7769, -4694,
-    -5207, -10268, -14055, -9546, -3614, 567, 2053, -2353, -4736, -1161,
-    3218, 5835, 4565, 920, -2214, -2401, 4060, 10483, 11824, 10529,
-    6213, 3505, 6358, 10596, 11516, 7656, 1333, -1667, 446, 6214,
-    10514, 7134, 537, -4521, -6363, -3870, -2088, -4721, -9705, -13783,
-    -13109, -8711, -5643, -5714, -11171, -14360, -9467, -4039, 1036, 2372,
-    -1956, -3302, -442, 3446, 6090, 4776, 2080, -1336, -1864, 5086,
-    10563, 12267, 11620, 6283, 3546, 5924, 9633, 11087, 6674, 471,
-    -2266, -610, 5647, 9653, 6069, 118, -4986, -6852, -4058, -2334,
-    -4801, -9137, -13013, -12188, -7936, -5137, -4921, -10361, -12945, -7857,
-    -3573, 1191, 2224, -2362, -3085, -306, 2854, 5102, 3760, 1117,
-    -1654, -1824, 4586, 9621, 11204, 10984, 6107, 3717, 6589, 10134,
-    11233, 7025, 1023, -1160, 493, 6255, 10064, 5793, -20, -4636,
-    -6468, -3859, -2732, -5602, -9883, -13274, -12304, -8370, -6070, -6391,
-    -11562, -12800, -7276, -3391, 1124, 1606, -2434, -2195, 847, 3695,
-    5029, 3469, 1333, -1063, -414, 6070, 10217, 11625, 10808, 6160,
-    4653, 6977, 9992, 10128, 5237, 137, -1549, 340, 6025, 8542,
-    4025, -1055, -4985, -5890, -3659, -3380, -6041, -10070, -12650, -10947,
-    -7487, -5582, -6437, -11082, -11117, -5822, -1912, 2025, 972, -2943,
-    -2070, 896, 3655, 4368, 2232, 1, -1962, -231, 6520, 10032,
-    10914, 9694, 5308, 4907, 7601, 10181, 9796, 4794, 314, -638,
-    2063, 7552, 8992, 4092, -961, -4659, -5342, -3309, -3738, -7252,
-    -11016, -13036, -10903, -7049, -5915, -7579, -12379, -11656, -5696, -2074,
-    1253, -498, -3990, -1956, 1711, 4528, 5208, 2803, 426, -1171,
-    1170, 7976, 10751, 11346, 9699, 5317, 5406, 8604, 11142, 10013,
-    4446, -570, -1410, 1589, 7079, 7735, 2050, -2825, -5925, -5417,
-    -2830, -3690, -7580, -11676, -13116, -10356, -6748, -5462, -7730, -12536,
-    -10621, -4633, -742, 2692, 265, -3352, -1656, 1865, 4781, 4765,
-    2272, -267, -2289, 1049, 8216, 10930, 11659, 9224, 4641, 5123,
-    8303, 10713, 9060, 3351, -979, -1526, 2165, 8039, 8365, 2734,
-    -2171, -5392, -4809, -2678, -4133, -7784, -12133, -13194, -10015, -6671,
-    -5056, -7678, -12326, -10276, -4947, -1020, 2120, -1011, -4249, -2036,
-    1514, 4663, 4829, 2535, -3, -1860, 1881, 8766, 11008, 11715,
-    8761, 4161, 5481, 8960, 11249, 9394, 3821, -666, -1416, 2530,
-    8123, 7528, 1882, -2801, -6087, -4838, -2342, -3862, -7891, -12066,
-    -12680, -9845, -6613, -4840, -7916, -13184, -10950, -5390, -1186, 2469,
-    -524, -3966, -2057, 1841, 5215, 4753, 2259, -435, -2850, 1203,
-    8913, 11360, 12049, 9387, 4844, 5837, 9323, 11782, 9325, 3179,
-    -1094, -1986, 2038, 8373, 8203, 2487, -2412, -5583, -4358, -2274,
-    -3802, -8073, -13088, -13726, -10400, -6826, -4733, -7295, -12725, -11234,
-    -5322, -1028, 2538, -425, -4322, -2827, 907, 5106, 5233, 2889,
-    270, -2363, 987, 8538, 11606, 12006, 9398, 4271, 4635, 8881,
-    11766, 9937, 3900, -1207, -2184, 1689, 8233, 8987, 2783, -2504,
-    -5657, -4685, -1672, -2567, -6890, -12042, -13355, -10279, -6567, -4415,
-    -6428, -12576, -13062, -6907, -2136, 2117, 515, -4432, -3945, -356,
-    4277, 5376, 2843, -176, -3118, -827, 7422, 12102, 12343, 10445,
-    5373, 4954, 9495, 12501, 11187, 5267, -524, -1908, 1437, 8106,
-    10212, 4164, -1725, -5337, -5219, -1916, -2278, -6714, -12509, -14753,
-    -11992, -7798, -4752, -6098, -12417, -14425, -8343, -2795, 1781, 1406,
-    -3999, -4580, -823, 4377, 6289, 4109, 1134, -2375, -1399, 6569,
-    12305, 12741, 11253, 6359, 4315, 8639, 12404, 11595, 5699, -875,
-    -2878, -263, 6703, 10434, 5037, -1473, -4959, -5134, -1811, -1239,
-    -5619, -11463, -14698, -12159, -7749, -4888, -4967, -10844, -14391, -9054,
-    -3231, 1172, 1842, -3570, -5259, -2334, 2559, 5823, 3833, 965,
-    -2063, -2498, 4484, 11539, 12565, 11551, 7014, 4120, 8345, 12044,
-    12679, 7866, 416, -1668, 315, 6175, 11009, 6727, -198, -4263,
-    -5403, -2119, -1312, -5304, -10595, -15039, -13511, -8772, -5787, -5406,
-    -10337, -15281, -11050, -4515, 258, 2376, -2835, -5327, -2408, 2118,
-    6165, 5176, 1779, -1322, -2540, 2928, 11087, 12839, 12071, 8423,
-    4183, 7573, 11714, 12490, 8721, 942, -2618, -956, 4321, 10174,
-    7900, 588, -3597, -4964, -2574, -446, -3720, -9425, -14280, -14016,
-    -9384, -5506, -4878, -8657, -14439, -12689, -4827, -250, 2306, -1171,
-    -5925, -4175, 316, 4837, 5368, 1946, -1590, -3152, 325, 9422,
-    13409, 12091, 9648, 4736, 6228, 11632, 13241, 10701, 3298, -2011,
-    -614, 4069, 9913, 10354, 2536, -3183, -4659, -3795, -818, -3020,
-    -9029, -14328, -15805, -11439, -6607, -5596, -8094, -14314, -14964, -6450,
-    -1191, 2034, 382, -5466, -4621, 41, 4914, 6965, 3987, 303,
-    -2001, -461, 8606, 14066, 12753, 10830, 5535, 5069, 10579, 12906,
-    11393, 4223, -2447, -2035, 1734, 7822, 10163, 2824, -3669, -5138,
-    -4705, -1453, -2155, -7773, -13454, -15817, -12035, -6711, -5205, -6526,
-    -12513, -14700, -6101, -654, 2647, 2316, -4330, -4750, -661, 3630,
-    6642, 4074, 267, -2042, -1911, 6768, 13178, 12265, 11021, 5403,
-    3719, 8990, 11771, 11473, 5324, -1876, -1816, 1669, 7657, 11226,
-    4364, -2465, -4475, -4915, -1467, -1457, -6899, -12438, -15424, -12256,
-    -6912, -5325, -6259, -12396, -15363, -7119, -1787, 1909, 2497, -4147,
-    -4951, -1088, 3282, 6576, 4318, 635, -2041, -2371, 5950, 13034,
-    12738, 11525, 6224, 3923, 8618, 11920, 11755, 5493, -1657, -2014,
-    1084, 7006, 11040, 5081, -1934, -4202, -4667, -1795, -1708, -6565,
-    -12430, -15695, -12502, -7625, -5455, -5949, -11796, -14918, -7351, -1399,
-    2250, 2522, -3805, -5135, -1684, 3449, 6533, 4045, 800, -2027,
-    -2437, 5494, 12705, 12630, 11098, 6177, 3965, 7929, 11742, 12333,
-    5987, -1068, -1737, 1108, 7096, 11135, 5411, -1855, -4562, -4636,
-    -1669, -1709, -6321, -12344, -15819, -12679, -7598, -5643, -6508, -12190,
-    -15207, -7243, -1352, 2167, 2661, -3620, -4657, -1081, 3608, 6579,
-    4271, 953, -1687, -2345, 5496, 12749, 12465, 11257, 6230, 3597,
-    7651, 11402, 11845, 5649, -1552, -2038, 1067, 6829, 10914, 5034,
-    -2064, -4355, -4633, -1659, -1673, -6161, -11718, -14943, -11863, -7014,
-    -5406, -6350, -11664, -14663, -6887, -1209, 1965, 2539, -3667, -4822,
-    -1270, 3149, 5715, 3355, -52, -2527, -2658, 4989, 12237, 11974,
-    10770, 6259, 3953, 8374, 11935, 12057, 6148, -659, -936, 2404,
-    7768, 11496, 5822, -1414, -3656, -4436, -1994, -2102, -6767, -12284,
-    -15550, -12734, -8059, -6428, -7404, -12682, -15511, -7608, -1936, 1243,
-    1809, -4132, -4503, -478, 3927, 6436, 3995, 877, -1270, -1078,
-    6764, 13232, 12615, 11500, 6790, 4959, 9101, 11633, 11622, 5560,
-    -1057, -1038, 1640, 6908, 10265, 4074, -2480, -4940, -5719, -2815,
-    -3353, -7562, -12515, -15574, -12084, -7565, -5955, -6777, -12645, -13908,
-    -5584, -1015, 2617, 2049, -4167, -3295, 517, 4372, 6116, 3023,
-    260, -2023, -1021, 7376, 12154, 11739, 10973, 5484, 4760, 9105,
-    11133, 11283, 4622, -1340, -700, 2331, 8604, 10968, 3877, -2037,
-    -4676, -4934, -1643, -3335, -7984, -13184, -15713, -11290, -7232, -6033,
-    -7719, -14207, -13780, -5581, -1634, 2466, 504, -5459, -3428, 529,
-    4736, 6257, 3028, 493, -1726, 284, 9057, 12629, 12474, 11032,
-    5004, 5400, 9746, 11843, 11220, 4140, -1120, -390, 2658, 8993,
-    9890, 2292, -2944, -5842, -5378, -2190, -4008, -8574, -13567, -15255,
-    -10646, -6870, -5735, -7844, -14611, -12836, -4951, -749, 3474, 289,
-    -5096, -2699, 1390, 5501, 6264, 2272, -675, -2943, 249, 9429,
-    12412, 12252, 9977, 4428, 5988, 10304, 11830, 10097, 2577, -1816,
-    -451, 3326, 10030, 9949, 2507, -2218, -5013, -4155, -1425, -4227,
-    -8973, -13958, -15217, -10132, -6839, -5569, -8296, -15176, -12191, -4603,
-    -705, 3277, -1273, -6237, -2977, 1097, 5832, 5896, 1762, -607,
-    -2589, 1738, 10769, 12379, 11894, 9137, 3841, 6519, 10517, 12231,
-    10095, 2355, -1086, 312, 4265, 10773, 9242, 1283, -3175, -6058,
-    -4269, -1347, -4560, -9409, -14422, -14747, -9148, -6200, -5597, -9352,
-    -16152, -11652, -4030, -275, 3364, -1893, -6048, -2242, 2244, 6611,
-    5559, 990, -1311, -3081, 2384, 11406, 12036, 11630, 8470, 3945,
-    7338, 11191, 12461, 9137, 1380, -1230, 461, 4934, 11253, 8597,
-    936, -3282, -5757, -3398, -1144, -4863, -9821, -14677, -14206, -8668,
-    -6342, -5981, -10350, -16346, -11102, -3830, -84, 2834, -2771, -6208,
-    -2071, 2475, 6594, 4857, 509, -1658, -3073, 3346, 11861, 12079,
-    11582, 7916, 4113, 8232, 11887, 12950, 8976, 1289, -674, 1362,
-    6242, 12035, 8331, 618, -3260, -5657, -3072, -1491, -5905, -10693,
-    -15204, -14336, -8729, -6834, -6666, -11320, -17210, -11214, -4423, -495,
-    2448, -3644, -6219, -1714, 2622, 7081, 5054, 455, -1225, -2777,
-    4828, 13230, 12809, 12655, 8064, 4773, 9270, 12341, 13094, 8798,
-    849, -607, 1360, 6089, 11911, 7299, -162, -4220, -6785, -3812,
-    -2241, -6216, -10967, -15725, -14626, -8968, -6762, -6292, -11441, -17049,
-    -10855, -4031, 294, 3166, -2793, -5220, -1167, 3185, 7427, 5104,
-    963, -1423, -2910, 4537, 12313, 12378, 12106, 7673, 4466, 8453,
-    11667, 12742, 8354, 954, -1056, 976, 6274, 11738, 7872, 387,
-    -3686, -5899, -3210, -1589, -5355, -10766, -15056, -13882, -8874, -6374,
-    -6877, -12048, -17075, -10803, -3979, -202, 2048, -3644, -5867, -1796,
-    2940, 6176, 3942, 258, -2032, -2371, 5278, 12730, 12847, 12429,
-    8170, 5577, 9323, 12537, 13181, 8450, 1779, -159, 2127, 7233,
-    11813, 7380, -155, -4177, -6041, -3483, -2368, -6344, -12074, -15706,
-    -14293, -9460, -7065, -7988, -13518, -17855, -10695, -3948, 432, 2417,
-    -3731, -5149, -524, 4495, 7634, 4791, 579, -1985, -2159, 6371,
-    13679, 13249, 12810, 7671, 5533, 9862, 12414, 13074, 7251, 171,
-    -959, 1104, 6907, 11620, 6124, -976, -4883, -6631, -2947, -2522,
-    -6482, -11946, -16277, -13718, -8982, -6732, -7192, -13475, -16928, -9234,
-    -3120, 1829, 3016, -3831, -4289, -522, 4308, 7455, 4052, 466,
-    -2361, -2337, 6433, 12957, 12772, 12174, 6488, 4964, 9171, 11956,
-    12978, 6874, 306, -700, 1571, 7682, 11893, 6288, -618, -4358,
-    -5674, -2236, -2310, -6530, -11844, -15800, -13389, -8999, -7334, -8379,
-    -14175, -16761, -8871, -2894, 1362, 1992, -4600, -4273, -196, 4261,
-    6813, 3028, -350, -2464, -1420, 7612, 13944, 13145, 12066, 6826,
-    5785, 10321, 12762, 12806, 6286, 182, 52, 3110, 9022, 12080,
-    5442, -1752, -5184, -6078, -2665, -3460, -8147, -13441, -16577, -13302,
-    -8724, -7418, -9325, -15572, -16993, -8083, -2239, 2196, 1533, -5014,
-    -3473, 1218, 6294, 7941, 3542, -8, -2411, -634, 9013, 14288,
-    13256, 11743, 6303, 6394, 10998, 13185, 12524, 4828, -1213, -692,
-    2232, 8840, 11088, 3750, -2441, -5877, -5523, -2007, -3935, -8573,
-    -14155, -17227, -12989, -8940, -7812, -9411, -16204, -14363, -5578, -1120,
-    4099, 762, -4840, -2215, 1650, 6291, 6457, 2274, 33, -2294,
-    1171, 11153, 13391, 12884, 10640, 4982, 6769, 10448, 12517, 10902,
-    3143, -321, 814, 3781, 10413, 9751, 1946, -2883, -6075, -4739,
-    -2478, -5402, -9579, -14481, -15643, -11183, -8832, -8239, -11397, -17157,
-    -11764, -4840, -519, 3932, -1518, -4478, -556, 3187, 6481, 4985,
-    1135, -953, -2323, 3849, 12402, 12690, 12938, 9520, 5431, 8693,
-    11559, 12674, 8501, 1566, 278, 1760, 5911, 11285, 7697, 620,
-    -3063, -5607, -4094, -4021, -7676, -12020, -15738, -14572, -10577, -9269,
-    -9237, -13752, -16341, -8475, -3873, 882, 2353, -3804, -3267, 1109,
-    5241, 6869, 3988, 1127, -628, -355, 7786, 12731, 11650, 12249,
-    7575, 6419, 10159, 12113, 12157, 5741, 925, 1106, 2333, 7458,
-    9888, 3701, -1356, -4205, -5529, -3734, -5646, -8923, -13101, -15693,
-    -12446, -10100, -9552, -10042, -15707, -14004, -5376, -2112, 3106, 1002,
-    -4297, -1060, 2615, 6515, 6337, 1895, 8, -1603, 1009, 10427,
-    12105, 11268, 10971, 5537, 7524, 10863, 11919, 10610, 2869, 281,
-    1703, 3814, 9614, 9122, 1737, -1614, -4221, -4545, -3063, -6602,
-    -10087, -14003, -15438, -11157, -9759, -9857, -11343, -16807, -11270, -3448,
-    -1142, 3175, -1837, -5061, 98, 3264, 6236, 4945, 143, -498,
-    -1027, 3763, 12716, 11493, 11495, 9918, 5155, 9441, 11549, 11945,
-    9393, 1979, 1238, 3294, 5861, 10701, 7161, -279, -2479, -5235,
-    -4551, -4444, -8794, -11710, -14920, -14488, -10296, -10219, -10774, -13535,
-    -16464, -8009, -2742, -159, 2038, -3670, -3079, 2258, 5126, 6462,
-    3754, -117, -232, 385, 6940, 13113, 10685, 11125, 8218, 6240,
-    10778, 11889, 11247, 6333, 767, 1655, 4242, 7384, 9665, 4049,
-    -1895, -3088, -4556, -4027, -5824, -10351, -13039, -14599, -12538, -9280,
-    -10324, -11878, -15525, -13902, -4726, -1555, 1253, -280, -4880, -1233,
-    4065, 6051, 5320, 1666, -1147, -678, 2072, 10014, 12399, 10245,
-    10251, 6557, 8121, 12123, 12262, 10057, 3406, 471, 2970, 5833,
-    9570, 8250, 1320, -2285, -3472, -3229, -3678, -7857, -11905, -14479,
-    -14306, -10800, -9534, -10862, -13740, -16812, -9792, -3150, -535, 1651,
-    -3518, -4674, 392, 5119, 6180, 3781, 849, -1003, -338, 5458,
-    12123, 11495, 10765, 8654, 5947, 9632, 12730, 12473, 7836, 1767,
-    1381, 4087, 7888, 10455, 5576, -986, -3221, -3779, -3053, -4750,
-    -9388, -13033, -14650, -12925, -9669, -10042, -11626, -15582, -15934, -6800,
-    -2676, 558, 668, -4641, -2793, 2483, 6010, 5444, 2530, -250,
-    -1229, 476, 7867, 12423, 10776, 11172, 7765, 7063, 11389, 12884,
-    11393, 5374, 939, 2393, 5212, 9215, 9838, 3035, -1565, -2928,
-    -3434, -3176, -6692, -11210, -14141, -14744, -11631, -9659, -10922, -12697,
-    -16852, -12750, -4150, -1878, 1333, -1914, -5183, -1069, 3937, 6568,
-    4288, 1455, -433, -696, 3183, 10656, 11831, 10475, 10212, 6615,
-    8545, 12307, 13017, 9439, 3048, 1390, 3402, 6977, 10216, 7487,
-    324, -2437, -3142, -3022, -3714, -8265, -12455, -14740, -13399, -10098,
-    -9491, -11293, -14630, -17156, -9578, -2602, -520, 1116, -4092, -4706,
-    645, 5437, 6375, 2896, 69, -1395, -333, 5609, 12045, 11104,
-    10516, 9056, 6420, 10366, 13241, 12849, 7426, 1587, 1903, 4634,
-    8990, 10997, 5424, -1098, -2676, -3132, -2381, -4513, -9871, -13779,
-    -15434, -12639, -9404, -10028, -11961, -16650, -16435, -6844, -2191, 596,
-    -335, -5847, -3698, 1818, 6324, 6032, 2019, -343, -1362, 996,
-    8470, 12626, 10988, 10654, 7689, 7427, 11815, 13876, 12487, 5360,
-    1163, 2449, 5692, 10372, 9936, 2794, -2200, -3325, -2988, -2443,
-    -6174, -11212, -14791, -15194, -11842, -9343, -10431, -13125, -17695, -14128,
-    -4696, -1435, 1727, -1759, -6018, -1959, 3224, 6738, 4957, 1097,
-    -1118, -1487, 2629, 10440, 12304, 10837, 10209, 6554, 8519, 12665,
-    13875, 10930, 3547, 1159, 2981, 7109, 11551, 8801, 1012, -2394,
-    -3274, -2639, -2434, -7050, -12189, -15399, -14612, -11141, -9458, -10683,
-    -14208, -18598, -12311, -3526, -838, 1835, -3456, -6100, -1307, 3990,
-    7034, 3845, 289, -1528, -1340, 4384, 12064, 12346, 11063, 9727,
-    6776, 10022, 13356, 14169, 9537, 2339, 1306, 3505, 8431, 11928,
-    7731, -70, -3133, -3628, -2682, -3289, -8447, -13265, -16176, -14709,
-    -10679, -9398, -10869, -15138, -18552, -10448, -2973, 15, 1751, -4738,
-    -5319, 106, 5145, 7369, 3606, 189, -1536, -949, 6010, 12460,
-    11143, 10898, 8762, 6530, 11018, 13650, 13849, 8512, 2074, 1843,
-    3754, 8872, 11658, 5600, -1247, -3264, -3672, -1963, -3049, -8452,
-    -13276, -16034, -13919, -10301, -10226, -11678, -16778, -18787, -8453, -2205,
-    971, 1374, -5329, -4309, 926, 5445, 6286, 1949, -979, -1826,
-    -538, 7587, 13063, 11408, 11793, 8681, 7587, 11945, 13729, 13078,
-    7143, 1585, 2201, 4919, 10003, 11854, 4540, -1803, -3455, -3816,
-    -2197, -4627, -10164, -14406, -16243, -13340, -9849, -10350, -12068, -17359,
-    -17919, -7033, -2147, 1294, 416, -5875, -2961, 2305, 6632, 6459,
-    1863, -841, -1645, 141, 8508, 12545, 10902, 11505, 7676, 8070,
-    12411, 13767, 12484, 5968, 1361, 1815, 4977, 10242, 10861, 3453,
-    -1841, -3245, -3166, -1482, -4577, -9980, -14606, -15957, -12847, -9876,
-    -9967, -12308, -17922, -17307, -6222, -1607, 1736, -289, -6586, -3189,
-    2140, 6623, 5821, 1304, -1314, -2108, 506, 8986, 12723, 11233,
-    11507, 7638, 8796, 13095, 14282, 12886, 5930, 1648, 2296, 5702,
-    10969, 10753, 3070, -2286, -3738, -3247, -1471, -5238, -10962, -15840,
-    -16886, -13162, -10310, -10165, -12796, -18631, -16881, -5590, -1084, 2450,
-    -440, -6492, -2722, 2383, 7430, 6404, 1866, -435, -1566, 1408,
-    9765, 13126, 11394, 10781, 6901, 8258, 12591, 14312, 12686, 5244,
-    1418, 2021, 5523, 10598, 9957, 2348, -3477, -4388, -3437, -1380,
-    -4435, -10422, -15466, -16411, -12540, -9430, -9811, -12968, -18824, -16483,
-    -4793, -283, 2817, -723, -6437, -2303, 2799, 7476, 5752, 387,
-    -1711, -2181, 1178, 10066, 13241, 11548, 10891, 7214, 9188, 12981,
-    14352, 12662, 4501, 1014, 2423, 5879, 11285, 10216, 2603, -2808,
-    -4328, -2818, -1356, -5709, -11698, -16687, -17373, -12642, -9631, -10467,
-    -13946, -19352, -14112, -3417, 126, 3008, -2487, -6653, -1401, 3987,
-    7671, 5064, 444, -791, -936, 3200, 11696, 12386, 11514, 10358,
-    6421, 9339, 12659, 14091, 11423, 3371, 651, 2729, 6356, 11488,
-    8772, 492, -3258, -4075, -1756, -1190, -6635, -12556, -16651, -16072,
-    -10946, -9234, -11341, -14790, -19493, -11794, -2128, 783, 3283, -3574,
-    -5928, -338, 4490, 7333, 4071, -601, -1658, -1601, 3994, 12565,
-    12115, 11913, 9462, 6248, 10214, 13427, 14589, 9966, 2173, 439,
-    3352, 7882, 12209, 7749, -373, -3291, -3241, -950, -1757, -7649,
-    -13973, -16984, -15765, -10722, -9389, -12278, -15411, -19320, -10759, -1497,
-    1263, 3135, -3937, -5478, 421, 5007, 7457, 4528, -732, -1748,
-    -1236, 4788, 13342, 11990, 11688, 8806, 5915, 10539, 13603, 13958,
-    8791, 1756, 494, 3669, 8412, 11982, 6824, -786, -3260, -3102,
-    -1079, -2419, -7771, -13990, -16513, -14239, -10085, -8907, -11959, -15890,
-    -19240, -10741, -1474, 969, 2033, -4321, -4892, 998, 6047, 7687,
-    3728, -1035, -2565, -1377, 4437, 12276, 11763, 11396, 9284, 7383,
-    11674, 14472, 14758, 8971, 2023, 743, 3369, 8006, 11477, 6419,
-    -604, -2535, -2462, -309, -2276, -8301, -14333, -17213, -14747, -11110,
-    -10635, -12512, -16403, -18724, -9054, -1307, 1356, 2193, -4350, -4043,
-    645, 5450, 7346, 2658, -655, -1314, -848, 6050, 13196, 12046,
-    12164, 9229, 7713, 11088, 13113, 14051, 7723, 1730, 1253, 3398,
-    8196, 11463, 6334, -314, -2445, -2471, -780, -3454, -8860, -14063,
-    -16314, -14128, -10356, -10312, -12432, -14806, -17636, -8277, -1677, 58,
-    1917, -4681, -3693, 1191, 4710, 6653, 2373, -1114, -900, -985,
-    5717, 12933, 10694, 11903, 9252, 7999, 12295, 13162, 13831, 7907,
-    2069, 2659, 4326, 8102, 11220, 5812, -89, -1279, -2023, -387,
-    -3289, -9215, -13452, -16372, -14001, -10537, -11280, -12919, -15877, -18133,
-    -9105, -2386, -123, 1296, -5338, -3728, 1600, 4673, 6878, 1754,
-    -1587, -1248, -904, 6481, 13006, 11129, 12543, 10080, 8569, 13376,
-    13891, 13604, 7427, 1414, 2302, 3627, 8197, 11552, 5559, -395,
-    -1279, -2043, -449, -3048, -9639, -14247, -17546, -14033, -9680, -10637,
-    -11642, -14879, -18619, -10361, -1827, -143, 1043, -5194, -5702, 848,
-    4828, 8099, 3331, -2495, -1625, -1393, 4335, 12483, 10848, 10796,
-    9505, 7375, 13046, 14629, 14161, 9621, 1541, 1327, 3847, 7624,
-    11762, 7509, -58, -1152, -1097, 518, -113, -7437, -13064, -16514,
-    -14874, -10337, -9322, -11738, -14399, -18668, -14879, -3235, -881, 739,
-    -3512, -8564, -2153, 3164, 6853, 5159, -2178, -4157, -1862, 1896,
-    11541, 13714, 10675, 11219, 7937, 11997, 16847, 15500, 12013, 3810,
-    88, 3370, 7378, 11468, 10655, 1842, -1652, -821, -142, 1000,
-    -5083, -12666, -16694, -16667, -12243, -8684, -10249, -13380, -17235, -17876,
-    -7036, -282, 487, -999, -8185, -6097, 1809, 5921, 6761, 773,
-    -4900, -2951, 54, 7885, 14916, 11693, 10761, 9127, 9411, 15534,
-    16616, 13673, 6552, -208, 1310, 6512, 10783, 12821, 6404, -1082,
-    -616, 930, 1940, -1551, -9771, -15507, -16725, -13043, -8249, -7958,
-    -11857, -15003, -18292, -13819, -3163, -895, -1617, -6366, -9809, -2970,
-    3413, 6764, 4488, -3529, -5377, -2064, 2849, 12037, 13839, 10636,
-    10355, 9185, 14219, 18596, 16601, 11650, 3150, -212, 4197, 8735,
-    11859, 9822, 1923, -1079, 472, 2430, 1513, -5172, -13189, -16970,
-    -15863, -11008, -7679, -10183, -13831, -16869, -17068, -9548, -1532, -1194,
-    -3364, -8486, -8515, -900, 4165, 6342, 1183, -5477, -4621, -486,
-    6292, 14181, 12695, 10046, 10140, 10281, 16156, 17654, 13972, 8010,
-    622, 1191, 6296, 9592, 11944, 7446, 862, 177, 918, 2576,
-    119, -8381, -14566, -16665, -13645, -8213, -7107, -10084, -14825, -16545,
-    -15005, -8676, -2213, -3605, -6413, -9867, -7944, 207, 4650, 5300,
-    -137, -6313, -4012, 1049, 7703, 13892, 11089, 9702, 10431, 12061,
-    18227, 17238, 12366, 6815, 1237, 2800, 7011, 9558, 10328, 5867,
-    1573, 971, 1270, 2409, -1607, -9490, -14857, -15330, -12479, -8552,
-    -7324, -10591, -14147, -15055, -13876, -8769, -3649, -5523, -7497, -10414,
-    -7506, 634, 3452, 4595, -586, -5543, -2422, 2362, 7753, 12536,
-    10336, 9316, 11209, 12689, 17429, 15640, 11323, 7630, 2885, 4111,
-    7217, 8879, 9713, 6688, 2615, 1954, 1749, 1394, -2063, -9049,
-    -12668, -13061, -11304, -8068, -7619, -10217, -12835, -13961, -13783, -10756,
-    -7079, -7448, -8794, -9350, -6763, -1438, 1782, 3462, 307, -4121,
-    -1830, 1160, 4922, 11332, 10683, 9841, 12334, 12675, 15860, 15871,
-    12576, 9742, 4395, 3750, 6912, 7764, 10489, 9321, 4449, 3420,
-    1788, 1125, -956, -7009, -10709, -12960, -12460, -8070, -7394, -8571,
-    -10757, -14068, -14159, -13499, -10709, -8924, -10079, -9798, -8033, -4613,
-    118, 3391, 2496, -1553, -2640, -689, 2620, 8746, 10978, 10205,
-    10795, 12014, 15161, 16990, 15437, 12207, 6641, 3421, 5175, 7227,
-    10018, 10517, 7113, 3743, 1823, 2198, 2031, -2840, -9171, -12672,
-    -13710, -10003, -6311, -7201, -10034, -13565, -14413, -14258, -12664, -9686,
-    -10234, -11660, -10228, -7448, -3157, 2152, 3598, 472, -3211, -2170,
-    1091, 6203, 10567, 9494, 8517, 9412, 13963, 17621, 16999, 14131,
-    9110, 5503, 5336, 7735, 9993, 10858, 8905, 5461, 2885, 2893,
-    4131, 778, -5611, -10824, -12644, -10837, -7082, -6259, -9823, -13264,
-    -15666, -14992, -13528, -12260, -11436, -12905, -11969, -8656, -4967, -977,
-    1790, 959, -1992, -2807, -667, 3398, 8230, 9363, 8440, 10006,
-    12596, 16726, 17567, 14473, 10775, 7535, 6696, 7230, 9399, 10276,
-    9630, 8207, 6236, 4718, 3408, 1630, -3364, -7750, -10257, -10912,
-    -8565, -7442, -8318, -10379, -13301, -14199, -13565, -15066, -14652, -13554,
-    -12665, -8616, -6718, -4250, -1536, 262, 1716, -1494, -2248, -596,
-    2054, 7364, 8938, 10198, 12170, 13046, 15758, 15730, 13286, 11789,
-    8755, 6686, 7172, 8624, 10907, 11580, 10345, 7122, 3118, 2045,
-    562, -3025, -6888, -11055, -11824, -9460, -7320, -7239, -10301, -13363,
-    -15109, -16074, -16694, -15238, -12843, -11355, -9266, -8154, -4888, -219,
-    2728, 1827, -2744, -4231, -1326, 4562, 8744, 10141, 9798, 9947,
-    13816, 16796, 17115, 14277, 10420, 7790, 6010, 8241, 10951, 11641,
-    11664, 8853, 5196, 3544, 3390, 1158, -4027, -9974, -12477, -10313,
-    -7155, -5360, -8259, -12500, -14364, -14124, -14795, -16484, -15300, -14510,
-    -12485, -8846, -6653, -3412, -232, 1225, -694, -3626, -2855, 188,
-    4632, 7064, 7865, 9030, 11375, 15961, 17746, 15771, 12282, 10628,
-    9440, 8577, 10066, 10350, 10750, 11666, 10298, 6741, 4328, 2400,
-    -841, -5191, -9750, -10302, -8915, -7583, -7065, -9710, -12503, -13201,
-    -13510, -16143, -18558, -17422, -15223, -11740, -8037, -6736, -4742, -1707,
-    1156, 562, -2095, -2822, -1284, 3653, 6085, 9027, 11067, 11782,
-    16484, 17390, 15647, 13907, 12518, 10348, 8624, 8991, 9872, 11597,
-    12200, 10591, 5858, 2872, 1564, -508, -3776, -8720, -9996, -9840,
-    -8862, -7037, -9041, -11766, -13367, -14528, -17385, -19010, -16496, -14339,
-    -11744, -9577, -8794, -5756, -1053, 1896, 429, -3574, -4413, -1610,
-    4063, 7884, 9556, 10567, 11147, 15880, 18380, 17288, 15341, 12921,
-    10168, 8711, 9962, 11235, 12879, 12250, 8823, 4627, 2959, 2855,
-    1042, -3172, -9393, -11159, -9616, -7755, -6305, -8963, -13013, -15340,
-    -15691, -17098, -18310, -16697, -15367, -13269, -10207, -7932, -4921, -982,
-    615, -1292, -4064, -4048, -167, 5178, 7684, 9076, 10125, 12285,
-    17424, 18735, 17310, 14189, 11829, 11004, 9694, 10539, 11163, 11442,
-    11183, 8816, 5708, 4094, 2335, -39, -3921, -8798, -9331, -8016,
-    -6785, -6321, -9344, -12414, -14382, -14952, -16362, -19768, -19276, -16607,
-    -12912, -9093, -7198, -5864, -3224, -164, -767, -2710, -3949, -2362,
-    2048, 6076, 9583, 11793, 13580, 16073, 18197, 17841, 15416, 13354,
-    11200, 9510, 9538, 10122, 10905, 11589, 10445, 7268, 4048, 2223,
-    718, -2305, -5856, -8691, -8996, -7615, -7294, -8167, -10996, -13852,
-    -15462, -16890, -19291, -19764, -17087, -14510, -10813, -7696, -6118, -4128,
-    -1118, -172, -2129, -3131, -3147, 682, 5571, 9171, 12378, 13381,
-    15918, 18085, 17811, 16118, 13705, 12123, 10164, 8833, 9511, 10243,
-    11032, 11135, 7772, 4190, 2518, 1103, -812, -4063, -7736, -8904,
-    -8119, -7105, -7237, -9900, -12689, -15454, -16746, -19060, -21157, -18072,
-    -15427, -11911, -8636, -7403, -4592, -1434, 704, -890, -3656, -3875,
-    -1135, 4063, 8387, 11187, 13203, 14548, 17280, 19051, 17359, 15371,
-    13158, 10264, 8575, 8311, 9227, 10799, 11264, 9227, 5425, 3192,
-    2575, 1770, -1063, -6303, -9212, -9142, -7682, -6258, -8422, -12549,
-    -15950, -17433, -17640, -19752, -19182, -16945, -14717, -10238, -7786, -5498,
-    -2753, -458, -75, -2407, -4017, -2176, 2898, 7074, 9825, 11793,
-    13274, 16436, 20034, 18900, 15493, 13058, 10490, 9184, 8534, 8796,
-    9687, 10517, 10274, 7594, 5161, 3729, 2926, 820, -4545, -8623,
-    -9138, -7402, -5851, -7009, -11084, -15273, -16014, -15651, -18018, -20606,
-    -20005, -17162, -12225, -7993, -5891, -4373, -2168, 411, -447, -2365,
-    -2957, -1727, 2545, 6469, 9870, 13137, 15018, 18149, 19599, 17188,
-    15118, 12931, 10302, 8458, 6782, 7124, 9350, 11302, 11115, 8208,
-    5752, 4279, 3226, 447, -4844, -8614, -9692, -9031, -7881, -8947,
-    -11951, -14808, -16093, -16490, -19252, -20427, -18046, -15172, -10860, -7707,
-    -7113, -4289, -890, 710, -103, -3011, -3071, -610, 4651, 9319,
-    11206, 13202, 14786, 17403, 19228, 17453, 14193, 11020, 8167, 6969,
-    7070, 8743, 10904, 11503, 10108, 7664, 6154, 4806, 2924, -1432,
-    -7617, -9797, -9005, -7944, -6883, -9398, -12824, -14646, -15614, -16056,
-    -19604, -21481, -18162, -15046, -10134, -6666, -6755, -3366, -577, 783,
-    19, -3450, -3080, -657, 3766, 9354, 11390, 13613, 16240, 17585,
-    19571, 17587, 13779, 11328, 7671, 6481, 7256, 8440, 11488, 12026,
-    10365, 8579, 6067, 5068, 2878, -2572, -7912, -10576, -10391, -8349,
-    -7762, -10094, -13074, -15022, -15293, -15734, -19297, -20719, -17910, -14899,
-    -9326, -6707, -6355, -3081, -516, 1229, -57, -2874, -2385, -136,
-    4509, 9889, 11015, 13351, 15722, 16762, 19033, 16251, 12908, 10945,
-    7698, 7294, 7769, 8809, 11714, 12372, 10537, 8539, 6057, 4603,
-    2239, -2963, -7269, -9726, -9134, -7522, -7980, -10040, -12898, -14852,
-    -15624, -17012, -21093, -21553, -17948, -13655, -8486, -6894, -6276, -3310,
-    342, 1672, -480, -3362, -3239, -514, 4656, 10103, 12031, 14196,
-    15827, 17391, 18732, 16663, 13907, 10564, 7077, 6148, 7192, 9007,
-    12133, 12896, 10118, 8064, 6158, 4533, 2128, -2735, -7718, -10092,
-    -9427, -8407, -8037, -10193, -12578, -14532, -16190, -16699, -20125, -20090,
-    -16035, -12935, -8842, -7042, -6263, -2383, 709, 1016, -1108, -4343,
-    -2812, 465, 4657, 10307, 10844, 12486, 15285, 16080, 17987, 16099,
-    12699, 10124, 7104, 7345, 9112, 10609, 13238, 12973, 9929, 8410,
-    6898, 4984, 2074, -3127, -7628, -8849, -8173, -7616, -8315, -10941,
-    -13151, -15080, -16899, -17579, -21179, -20999, -15488, -12896, -8600, -6332,
-    -6288, -2177, 422, 558, -1486, -4215, -2445, 10, 3959, 10323,
-    11470, 13301, 15604, 15454, 17567, 16585, 13815, 10697, 6579, 6693,
-    8909, 11107, 13809, 13229, 9826, 8037, 7198, 5528, 2210, -2968,
-    -7630, -9395, -8526, -8039, -8126, -10063, -12619, -14293, -16470, -16782,
-    -19606, -19544, -15004, -13694, -9566, -6972, -6600, -2228, 144, -471,
-    -1995, -4107, -2386, 52, 2666, 8448, 9792, 11889, 15137, 15046,
-    17341, 16827, 14271, 11707, 8067, 8054, 10114, 11774, 13753, 13297,
-    9794, 8357, 7377, 5048, 1844, -3303, -7022, -8288, -8351, -8432,
-    -8722, -10402, -12281, -14025, -17092, -17995, -20748, -19698, -14813, -13550,
-    -9131, -7050, -6141, -1387, 930, 237, -1789, -4175, -2898, -610,
-    2333, 8756, 10307, 12364, 15431, 15578, 18381, 18265, 15213, 11460,
-    7107, 7141, 9765, 11362, 13249, 12349, 9070, 8174, 7385, 5396,
-    1903, -3251, -7023, -8863, -8484, -7685, -7973, -9370, -12027, -14254,
-    -16575, -17329, -19334, -19354, -15437, -13597, -9553, -6970, -5785, -1831,
-    213, -434, -2861, -4866, -3513, -1186, 1675, 7238, 9575, 12279,
-    15779, 16124, 18408, 17819, 15252, 12118, 7680, 7551, 9290, 10699,
-    12962, 12298, 9485, 8611, 7328, 5489, 1893, -3034, -5814, -7615,
-    -7994, -7905, -8886, -9867, -11410, -13858, -16380, -17943, -20180, -19325,
-    -14735, -12286, -8412, -7051, -6631, -2526, 21, 629, -2321, -5332,
-    -4387, -2067, 2064, 8989, 11150, 12900, 15885, 15359, 18316, 18512,
-    15390, 11805, 6203, 5606, 8383, 10387, 13551, 12989, 8842, 7870,
-    7124, 6058, 3378, -2485, -6689, -8953, -8676, -7293, -8014, -9134,
-    -11702, -14150, -16160, -17057, -18552, -18964, -15123, -13825, -9800, -6855,
-    -6282, -2536, -788, -920, -2766, -4359, -3212, -792, 1575, 7571,
-    10720, 12836, 16833, 15977, 17363, 17532, 14595, 11688, 7275, 6304,
-    8512, 10163, 12377, 12674, 9722, 8465, 7396, 4807, 2031, -2439,
-    -6124, -7578, -8583, -8231, -8157, -9101, -10686, -13203, -16459, -17906,
-    -19395, -18911, -14128, -13076, -9388, -6751, -6250, -1305, 119, -238,
-    -2307, -4828, -3268, -711, 1773, 7989, 10865, 12482, 16510, 15469,
-    17089, 17495, 13992, 10614, 5642, 5025, 8337, 10721, 12791, 12399,
-    8659, 8218, 7658, 5232, 2343, -3186, -6659, -8058, -7903, -6701,
-    -7047, -8664, -10594, -13011, -15942, -17071, -19516, -19735, -15127, -13126,
-    -9211, -6058, -5376, -1177, 458, -493, -2015, -4493, -3621, -1165,
-    224, 6114, 10694, 12638, 16572, 15742, 15820, 17125, 14542, 10995,
-    6297, 4017, 7078, 10321, 12577, 13169, 9488, 8287, 8021, 5412,
-    2451, -1814, -5644, -7443, -7928, -7756, -6747, -7720, -9456, -12045,
-    -16185, -17449, -18697, -19774, -15625, -12831, -10442, -6260, -5424, -1838,
-    1104, -177, -1596, -4350, -4744, -1967, -537, 4131, 9951, 11988,
-    15718, 16040, 15493, 17562, 15536, 11690, 6816, 3414, 5969, 10140,
-    12385, 12827, 10107, 8342, 8764, 6992, 3317, -986, -5150, -6821,
-    -7617, -8141, -7720, -8343, -9114, -11146, -15113, -17341, -18394, -19663,
-    -15776, -13238, -11568, -7152, -6268, -2189, 540, -330, -1572, -4257,
-    -4344, -2257, -702, 2608, 8668, 12150, 15591, 16327, 15540, 16826,
-    15912, 13336, 7642, 3423, 5113, 9322, 12445, 13117, 10891, 8707,
-    8812, 7400, 4028, -390, -4526, -6235, -7564, -8037, -7359, -7428,
-    -7940, -9980, -13491, -16760, -18191, -19082, -17883, -14755, -12549, -8536,
-    -5907, -3560, -230, 283, -1149, -3206, -4943, -4464, -1756, 620,
-    6054, 10963, 14105, 17240, 16343, 16444, 16532, 13387, 9537, 5023,
-    3322, 7406, 10713, 12151, 12700, 9995, 9554, 8776, 5090, 1567,
-    -2644, -5477, -6559, -8277, -7832, -6700, -7663, -8045, -11209, -15437,
-    -16839, -18627, -19018, -16449, -14544, -10649, -7110, -5670, -1578, -99,
-    -308, -737, -4230, -5074, -2604, -480, 3797, 8683, 12001, 15383,
-    16557, 16840, 16626, 14566, 11502, 6992, 3978, 5562, 8909, 11667,
-    12902, 11266, 9687, 9090, 7529, 3882, -486, -3900, -6144, -6833,
-    -6811, -6885, -7402, -8138, -9953, -13253, -16275, -17955, -19828, -20374,
-    -16483, -13008, -9587, -5302, -4038, -2108, -729, -672, -1654, -4310,
-    -3950, -1984, 90, 5335, 11653, 14862, 16973, 17198, 15100, 14271,
-    13755, 11282, 6613, 3718, 5093, 9135, 13121, 15225, 13307, 9128,
-    7656, 6150, 2462, -956, -4671, -7319, -7544, -7790, -6978, -7605,
-    -8996, -9651, -13928, -17401, -19492, -21770, -20160, -15313, -11591, -8793,
-    -6479, -4386, -576, 705, 204, -2649, -5524, -3728, -1292, 2175,
-    7031, 12109, 15009, 16919, 16764, 14923, 14669, 12926, 10157, 5682,
-    3470, 6310, 10859, 14600, 14988, 11766, 9033, 8709, 6400, 2589,
-    -2342, -6613, -7546, -7221, -6965, -7216, -8541, -9640, -10914, -13326,
-    -15859, -19017, -21985, -21071, -15899, -11366, -6834, -5733, -5469, -1969,
-    -780, 252, -1998, -4874, -3572, -2098, 1318, 6990, 10838, 14737,
-    17081, 14943, 14426, 13407, 12351, 11599, 7040, 4654, 6304, 10177,
-    14655, 15168, 12359, 9839, 7743, 6240, 3399, -1936, -4854, -6480,
-    -7827, -6807, -7460, -8253, -8582, -10706, -12511, -15374, -18826, -19560,
-    -20640, -18089, -12058, -9542, -5826, -4489, -4153, -1761, -1374, -1578,
-    -3647, -4575, -1929, 759, 4476, 9772, 11527, 14319, 16606, 15276,
-    14948, 12701, 11273, 9557, 6950, 7425, 9081, 11648, 14665, 13911,
-    10108, 8068, 6416, 4579, 1224, -3696, -6806, -8174, -7119, -5752,
-    -7793, -10097, -10862, -12015, -12774, -15117, -18439, -21058, -21400, -15745,
-    -10436, -7686, -5006, -4999, -4174, -1445, -579, -1262, -3272, -3117,
-    -938, 739, 6360, 10688, 12365, 15012, 15039, 15398, 15407, 13604,
-    12222, 8274, 5832, 7847, 9659, 12850, 14258, 10966, 8219, 6962,
-    6463, 4500, -826, -5162, -7349, -8437, -6309, -5965, -8801, -10307,
-    -11687, -12418, -11890, -14285, -17573, -20449, -22168, -15033, -9476, -7200,
-    -3318, -5386, -3883, 48, 478, 348, -2691, -3814, -932, 1109,
-    6220, 10728, 10001, 13917, 15120, 14787, 16548, 12895, 11294, 8582,
-    5778, 8476, 9788, 10521, 12356, 9508, 7370, 8253, 6113, 4335,
-    -241, -5634, -6680, -7489, -5904, -5219, -9270, -11466, -11858, -12203,
-    -10052, -12066, -17197, -19428, -21836, -16221, -8474, -6530, -3338, -5101,
-    -5621, -595, 921, 1263, -1223, -5084, -2969, 194, 5226, 11146,
-    10660, 11494, 13131, 12886, 16145, 16272, 13463, 10845, 5538, 5916,
-    10112, 11413, 13049, 10099, 4932, 5394, 6431, 5367, 2631, -3938,
-    -7592, -7446, -7013, -4078, -6303, -11340, -12249, -14055, -12150, -9615,
-    -13543, -16737, -21178, -19603, -9787, -5947, -2317, -2949, -7740, -4517,
-    -925, 1172, 510, -4284, -4319, -1713, 2918, 10946, 11666, 10432,
-    11695, 11489, 15015, 16536, 15550, 12626, 6846, 6292, 8922, 10952,
-    12555, 11153, 6684, 3942, 4404, 4945, 3498, -655, -4897, -7462,
-    -7328, -4442, -4108, -8328, -11778, -12900, -12939, -9828, -10982, -14751,
-    -19191, -20922, -11812, -7001, -4288, -2647, -7176, -5635, -1766, -183,
-    139, -3951, -5003, -1858, 269, 7972, 11417, 9289, 10965, 9809,
-    12727, 16351, 15039, 14080, 8062, 5091, 9138, 11112, 12909, 12300,
-    7021, 4327, 4448, 5791, 5856, 1481, -2833, -5671, -6549, -4135,
-    -1956, -4521, -8772, -12176, -14011, -11454, -9663, -11505, -16010, -21514,
-    -19630, -10499, -5420, -2442, -4119, -8859, -5938, -2035, 705, -175,
-    -4871, -4865, -1601, 2459, 9304, 11443, 10111, 10735, 9846, 12231,
-    14918, 15385, 14302, 8730, 5955, 8780, 11817, 14313, 13775, 7189,
-    2732, 3436, 5246, 5956, 1954, -3768, -6502, -6238, -3542, -1109,
-    -4504, -9684, -12883, -14704, -12010, -10082, -12653, -16770, -21375, -19377,
-    -10099, -5028, -1915, -3276, -8133, -5446, -2328, -56, 215, -4277,
-    -4906, -2015, 1956, 9940, 12673, 10937, 10596, 8713, 12459, 16091,
-    16179, 14684, 8186, 6615, 10501, 13453, 15510, 12643, 6455, 3061,
-    3224, 4931, 4337, 179, -4124, -6333, -5837, -3391, -1990, -5330,
-    -10420, -13190, -14314, -12068, -10870, -13805, -17468, -20991, -18062, -8390,
-    -3950, -1372, -3347, -8068, -4641, -2521, -172, -1239, -6178, -4845,
-    -1690, 2939, 10413, 12146, 10703, 11198, 8876, 12182, 15814, 16174,
-    15785, 8807, 7165, 11233, 14576, 16643, 13091, 5693, 2069, 2951,
-    4366, 4320, -544, -4630, -5490, -5641, -3195, -2107, -5799, -10121,
-    -13499, -15599, -13284, -11431, -12555, -15260, -19949, -17752, -8458, -3513,
-    -638, -3041, -8987, -6838, -4202, -1190, -1152, -5532, -4080, -1161,
-    2686, 10406, 12838, 11387, 11795, 9087, 10675, 15077, 16757, 17141,
-    10871, 7750, 11452, 14133, 16801, 14120, 5942, 1468, 1701, 3475,
-    3640, -468, -4404, -5946, -6215, -4496, -3754, -6831, -10138, -13058,
-    -15764, -13404, -11964, -11435, -12704, -17634, -17748, -11011, -4734, -1158,
-    -2115, -8475, -8063, -5211, -699, 948, -3671, -3400, -1858, 2395,
-    9450, 13180, 12206, 11225, 9476, 10372, 15119, 17055, 17792, 12160,
-    7962, 10680, 13252, 15682, 14201, 7681, 1699, 959, 2085, 2544,
-    -357, -4876, -7204, -8463, -6400, -3972, -4961, -8321, -11247, -14080,
-    -12773, -9748, -9368, -11153, -16678, -19339, -14372, -6142, -1884, -1446,
-    -6981, -8883, -4522, -849, 1893, -2092, -4874, -2944, 934, 7028,
-    12436, 12405, 11267, 11276, 10311, 14372, 17154, 17522, 14867, 8752,
-    9098, 12251, 14350, 15167, 10317, 2058, -165, 393, 1069, 99,
-    -5464, -8331, -9589, -7723, -4027, -3592, -6342, -8773, -11764, -12196,
-    -9008, -8876, -9804, -14985, -19296, -17341, -9744, -2844, -1003, -3644,
-    -8013, -5891, -1898, 1964, 783, -3758, -4206, -1587, 3986, 10065,
-    13096, 12067, 11524, 10820, 12954, 17251, 18992, 17614, 11489, 8090,
-    9672, 12838, 14198, 11797, 4440, -1882, -1440, -97, 467, -2785,
-    -7316, -9998, -9010, -5399, -2835, -3852, -7764, -10265, -12620, -9991,
-    -8418, -9639, -13025, -18704, -18614, -12992, -4596, -864, -1624, -5082,
-    -5988, -2072, 1472, 2362, -1674, -4553, -3178, 1637, 7568, 12562,
-    12934, 11033, 11529, 12407, 16932, 19009, 17195, 13070, 7285, 8029,
-    11320, 12049, 11321, 5710, -915, -1201, -440, 857, -648, -5685,
-    -7950, -8545, -5695, -2421, -2744, -6145, -9606, -11992, -11130, -8756,
-    -9396, -11472, -16394, -18845, -15361, -7815, -1865, -921, -3012, -5892,
-    -3968, -545, 2222, 587, -3727, -3618, -901, 4635, 10457, 13200,
-    12247, 11485, 12439, 15174, 18178, 18310, 15545, 9434, 6757, 8428,
-    10319, 10828, 8104, 2412, -1453, -621, 1201, 1468, -1844, -6186,
-    -8627, -7682, -4616, -2973, -4976, -8886, -11218, -11945, -9685, -8326,
-    -9968, -13592, -17987, -18021, -11296, -4019, -1257, -1345, -5068, -5123,
-    -1096, 1699, 2342, -2236, -4663, -1677, 2252, 8032, 12739, 11911,
-    11527, 12881, 15406, 18067, 17538, 15754, 10419, 6524, 7756, 9414,
-    9996, 8969, 4818, 643, 521, 2151, 2711, -1093, -5571, -8460,
-    -8758, -5667, -3665, -4454, -8175, -10105, -10557, -9071, -7761, -9452,
-    -12702, -17283, -17587, -13758, -7106, -2425, -1572, -3346, -4708, -2646,
-    517, 2627, -943, -3529, -3344, -79, 6114, 10565, 12622, 11263,
-    11573, 14377, 16908, 17173, 16436, 11940, 7221, 7639, 8155, 9763,
-    9506, 6783, 3256, 731, 1664, 2979, 1229, -3024, -6536, -9401,
-    -7565, -3997, -3706, -6114, -9433, -10849, -10027, -7859, -8254, -10559,
-    -15129, -17649, -15470, -11067, -5025, -2191, -3074, -4519, -3833, -1223,
-    2124, 1301, -2102, -2886, -1597, 3241, 8113, 10616, 11350, 11335,
-    13664, 16705, 16921, 16850, 14539, 9729, 8581, 7915, 8507, 9410,
-    7966, 5805, 2467, 1893, 3392, 2740, -869, -4672, -8375, -8712,
-    -5977, -5283, -6564, -9435, -10235, -10149, -8489, -7990, -10068, -13083,
-    -17088, -16516, -14463, -9873, -4233, -3481, -3803, -3530, -2283, 1276,
-    2508, -647, -2600, -2839, 586, 5858, 8353, 10800, 11407, 13400,
-    17115, 17206, 16997, 15511, 11822, 9498, 7827, 7487, 8593, 8668,
-    8222, 5630, 3318, 3910, 3765, 1208, -2660, -6482, -9018, -7310,
-    -5549, -6433, -7960, -9911, -9951, -8982, -8999, -9232, -11830, -15780,
-    -16041, -16404, -13655, -7072, -4955, -3233, -3321, -4272, -706, 977,
-    796, -602, -3325, -1234, 3064, 6177, 9799, 11197, 12643, 16287,
-    17080, 16864, 16161, 13267, 11173, 8663, 6651, 7398, 7964, 8605,
-    8047, 5047, 3980, 4272, 2599, -529, -4251, -7746, -7789, -5946,
-    -6309, -7726, -9163, -9992, -8951, -8818, -9664, -10868, -14073, -15414,
-    -15499, -15880, -12121, -7454, -5379, -3136, -3667, -3338, -535, 12,
-    161, -1656, -2073, 1018, 3867, 6679, 10111, 12815, 16005, 18284,
-    16835, 15995, 14837, 13419, 11625, 8169, 6769, 7271, 9117, 10157,
-    8952, 6284, 4388, 3136, 492, -2709, -6311, -8221, -8089, -7159,
-    -7364, -8072, -8883, -9344, -9904, -11028, -11043, -13343, -14511, -15642,
-    -16963, -14416, -10610, -6170, -3572, -3388, -3404, -2723, -1622, 147,
-    -580, -1427, -46, 1465, 5448, 8216, 12092, 15885, 16284, 16780,
-    14926, 13893, 14774, 13418, 10521, 8410, 7289, 9100, 10793, 9928,
-    8439, 4875, 3008, 1203, -1681, -3757, -6119, -7277, -7460, -7910,
-    -8020, -7882, -8679, -9564, -11527, -12384, -12461, -12787, -12933, -15089,
-    -15585, -14255, -10786, -6017, -4247, -3549, -3737, -3915, -1595, 503,
-    228, 330, 517, 1566, 4913, 8587, 13410, 15871, 16587, 15842,
-    14221, 14836, 15497, 14716, 10853, 8265, 7201, 8034, 10429, 10114,
-    7964, 4754, 1991, 219, -1575, -4003, -5816, -8494, -9903, -8894,
-    -8659, -7712, -8060, -10327, -11765, -12529, -11953, -11447, -13340, -15480,
-    -16525, -15603, -11209, -6673, -4052, -2932, -3677, -3446, -1037, 451,
-    882, -254, -2023, 152, 4353, 10046, 15139, 16669, 16542, 15514,
-    15132, 15856, 15664, 12431, 9455, 7374, 7126, 9789, 11159, 10796,
-    8440, 4846, 1824, -177, -1681, -3284, -6729, -9685, -9768, -8706,
-    -6619, -6146, -8335, -10862, -12000, -11507, -10795, -12011, -13555, -15552,
-    -16288, -14329, -12341, -8065, -5401, -4171, -3508, -4525, -1656, 822,
-    882, 17, -1585, -470, 5413, 10851, 14621, 16473, 14938, 16263,
-    16141, 16413, 16070, 12780, 10459, 7939, 8004, 9223, 10729, 10532,
-    8377, 4631, 1688, 893, -333, -2349, -5862, -8996, -9624, -7242,
-    -6157, -6022, -8084, -10704, -10370, -10616, -9449, -9957, -11869, -13068,
-    -14574, -14412, -13056, -10916, -8132, -6149, -5560, -3914, -2695, -1030,
-    336, -801, -975, -53, 3448, 7781, 11915, 14812, 15570, 16916,
-    16734, 17327, 16832, 14478, 12669, 9826, 8615, 9067, 9374, 9693,
-    9410, 6495, 4024, 1436, -418, -1426, -4879, -7054, -9025, -9053,
-    -6922, -6232, -7556, -8439, -9370, -9494, -8360, -9563, -9907, -10889,
-    -12309, -12744, -13710, -13998, -11175, -9283, -7660, -5207, -5876, -3548,
-    -2512, -2594, -882, -1703, 901, 4413, 6459, 11368, 13820, 15300,
-    18124, 17242, 17107, 16850, 13909, 13288, 11197, 9165, 9414, 8524,
-    8763, 8709, 6380, 3668, 916, -1575, -2876, -5062, -7218, -8703,
-    -9128, -8298, -7278, -7542, -8297, -7999, -8516, -6890, -7366, -8830,
-    -9657, -12264, -12907, -13693, -14505, -13086, -10523, -8829, -6271, -6436,
-    -5893, -4233, -3901, -1598, -2232, -1138, 2091, 5240, 10303, 13362,
-    15143, 17589, 17636, 17859, 16903, 13788, 13077, 11479, 9896, 9594,
-    8959, 9633, 9779, 7589, 4809, 965, -1927, -3074, -5649, -7904,
-    -8807, -9150, -7346, -5552, -5232, -5682, -6326, -6486, -6346, -7039,
-    -9470, -10617, -12402, -13044, -11764, -12681, -12794, -11326, -10478, -9099,
-    -7395, -8206, -7050, -5738, -4771, -1802, -1407, 1433, 5591, 8686,
-    13024, 15010, 16432, 17802, 17712, 17195, 15007, 13530, 13340, 12460,
-    12103, 10988, 9351, 8865, 7334, 5175, 1996, -2196, -3794, -5507,
-    -6570, -6343, -6972, -5742, -4397, -4058, -4098, -5005, -5092, -5155,
-    -6212, -7863, -9323, -9996, -10516, -10526, -11704, -13711, -14034, -12737,
-    -11630, -10089, -9411, -9593, -7529, -5979, -3405, -1579, -760, 2966,
-    6122, 10042, 13931, 15864, 17577, 18099, 18465, 18232, 16151, 15189,
-    13926, 12052, 11285, 9813, 8807, 7978, 6003, 3560, 140, -2984,
-    -3743, -4994, -6534, -6796, -6430, -5139, -3610, -3081, -3870, -4751,
-    -5178, -4930, -5787, -7911, -8922, -10511, -11460, -11147, -12855, -14505,
-    -14415, -13248, -11755, -10365, -10187, -9339, -8418, -7085, -3616, -2483,
-    -158, 3721, 6644, 11056, 14519, 16536, 18257, 18129, 17953, 17027,
-    15098, 14939, 13491, 11859, 10992, 9635, 9068, 7832, 4904, 2109,
-    -1061, -3606, -4439, -5954, -6183, -5729, -4815, -3493, -2987, -3200,
-    -3451, -4330, -4705, -5107, -7350, -8287, -9824, -10366, -10246, -11846,
-    -13140, -14929, -15483, -13256, -12420, -11791, -10991, -11617, -8893, -5717,
-    -3739, -1001, 567, 3956, 8299, 11455, 15722, 17657, 17888, 18610,
-    17039, 15812, 16157, 14829, 13159, 11106, 8686, 8352, 7715, 6417,
-    4324, 318, -2331, -2929, -3971, -4329, -4304, -4837, -3841, -2848,
-    -1810, -1171, -1803, -2847, -3891, -5722, -6376, -6858, -8972, -9903,
-    -12009, -13221, -14097, -15245, -15187, -14447, -14264, -12377, -10782, -10473,
-    -7111, -5834, -3460, -906, 1297, 6172, 9861, 13246, 16781, 17222,
-    17700, 19465, 17398, 16393, 14411, 11866, 11701, 9833, 9229, 8370,
-    6252, 5334, 4058, 944, -435, -1794, -3964, -4326, -4683, -3670,
-    -2122, -1040, -304, -566, -1572, -1865, -2232, -4661, -6031, -8391,
-    -10295, -11094, -12516, -13156, -14984, -15915, -15997, -14378, -13499, -10725,
-    -10218, -10746, -7735, -6020, -1791, 730, 3526, 6530, 10076, 13727,
-    17170, 18123, 17545, 18663, 15537, 15123, 13765, 12158, 11657, 9729,
-    8467, 7137, 6597, 5514, 4250, -50, -1972, -3013, -3679, -2346,
-    -2504, -2332, -1450, 179, 465, 745, -1302, -2679, -3866, -6113,
-    -6193, -8496, -10221, -11494, -12894, -14060, -15066, -16431, -16059, -14725,
-    -14173, -10811, -11285, -8873, -5914, -4175, 3, 1256, 4026, 7219,
-    10689, 13717, 17165, 16042, 17008, 17816, 14683, 15593, 12505, 11375,
-    10808, 8565, 7432, 6509, 5003, 4972, 3603, -756, -418, -1910,
-    -1586, -470, -1989, -2024, -1004, 236, 749, -77, -3172, -3118,
-    -4348, -5554, -6380, -9436, -11111, -12428, -13347, -15303, -16144, -16954,
-    -15366, -13909, -12040, -9348, -9159, -6299, -4782, -2027, -483, 1394,
-    4456, 7308, 11370, 14444, 17072, 16019, 17787, 16236, 14715, 14445,
-    11254, 10533, 8272, 7371, 7010, 6583, 6081, 6267, 3512, 938,
-    448, -1712, -949, -1903, -2662, -2629, -1438, 505, 951, 87,
-    -2343, -2964, -4617, -5951, -7721, -10568, -13042, -13512, -14345, -15494,
-    -15334, -15525, -12824, -11321, -9382, -8440, -8356, -6370, -4065, -1476,
-    -218, 2707, 5363, 9348, 13003, 16239, 17049, 16544, 17442, 14786,
-    14011, 12012, 10650, 9699, 7796, 7329, 6720, 6872, 6829, 6066,
-    1876, -92, -853, -1422, -1107, -2195, -2447, -2072, -44, 792,
-    404, -1254, -2668, -3594, -5569, -7476, -9199, -11218, -12889, -12897,
-    -15018, -15364, -14690, -13693, -11424, -10327, -8909, -8256, -6961, -4954,
-    -1949, -740, 1100, 3595, 6322, 10528, 13666, 16234, 15613, 16870,
-    16226, 14410, 13632, 10636, 9998, 8595, 6990, 6597, 6255, 6391,
-    7154, 4409, 1522, 655, -936, -520, -1730, -3041, -3186, -2436,
-    -988, -762, -1305, -2030, -2813, -4642, -6386, -8316, -9759, -11878,
-    -13303, -14759, -15859, -14419, -13047, -11092, -9911, -8260, -7669, -6612,
-    -4609, -3050, -1480, -1163, 446, 3371, 8421, 12875, 16234, 15375,
-    15224, 16850, 15072, 15393, 12148, 8821, 7665, 6354, 6967, 7665,
-    7543, 7717, 6256, 2035, 1702, 504, -762, -1889, -4879, -5267,
-    -3971, -975, 97, -762, -2414, -2940, -3594, -5291, -6879, -9748,
-    -12174, -13525, -13765, -14738, -13780, -12212, -10694, -9276, -8537, -7160,
-    -7484, -5920, -4497, -3654, -2335, -588, 2720, 7073, 11311, 15014,
-    16417, 14892, 16256, 15166, 14110, 13302, 9720, 8423, 7041, 7192,
-    8409, 8800, 8057, 7209, 3750, 1130, 660, -1172, -1981, -4096,
-    -4832, -4263, -2132, -61, -473, -1520, -3549, -4151, -5211, -6996,
-    -8645, -10843, -12906, -12777, -12963, -13625, -12288, -11646, -9720, -8841,
-    -8422, -7789, -7317, -5639, -4015, -2199, -795, 2204, 5820, 9233,
-    12456, 14849, 14908, 15269, 15222, 13792, 13758, 11309, 10272, 9400,
-    7876, 8549, 8470, 8070, 7342, 4936, 1947, 529, -898, -1450,
-    -2909, -3996, -3681, -3364, -1928, -1910, -2179, -3237, -4135, -4496,
-    -6512, -7994, -9393, -11177, -11835, -12720, -13809, -13551, -12885, -10429,
-    -8793, -8345, -7454, -7721, -5958, -4181, -2768, -1103, 17, 2527,
-    7041, 10535, 14239, 15507, 14120, 15654, 14561, 14622, 13527, 10239,
-    9656, 8101, 7864, 8608, 8279, 7350, 6211, 2983, 774, -131,
-    -1190, -2122, -4288, -4757, -4418, -2450, -1616, -2072, -2716, -4464,
-    -3948, -5157, -7500, -8677, -10975, -11787, -11876, -13749, -13971, -12899,
-    -11045, -8270, -8071, -7864, -7351, -6708, -4670, -3413, -2501, -1215,
-    1232, 5078, 9402, 13270, 15771, 15117, 15121, 14746, 14449, 14440,
-    11317, 9713, 7311, 6670, 8115, 8409, 8361, 6641, 3749, 1646,
-    1020, -220, -1393, -3960, -5361, -4973, -4139, -1967, -1794, -2301,
-    -3309, -4168, -4661, -5711, -7287, -9578, -11852, -13154, -13441, -14285,
-    -13510, -11590, -9272, -7157, -6420, -6436, -6388, -5312, -4389, -3024,
-    -2171, -299, 3368, 7441, 12649, 15973, 16394, 16082, 15529, 14154,
-    13495, 11481, 8898, 7317, 5956, 6788, 8198, 9001, 8653, 6458,
-    2875, 1082, -177, -2023, -3175, -5344, -5775, -4776, -3267, -1164,
-    -875, -1628, -2935, -4429, -5708, -7122, -9109, -11193, -12843, -13887,
-    -14639, -14388, -11566, -8695, -6888, -6098, -7127, -6961, -5350, -4529,
-    -3050, -2810, -1784, 2207, 6190, 11727, 15766, 16184, 15882, 14959,
-    13912, 13694, 12051, 9096, 7100, 5653, 6218, 8229, 9379, 8816,
-    6665, 3352, 1541, 721, -1432, -2889, -4976, -6161, -4814, -3437,
-    -1692, -699, -1641, -2865, -4140, -4969, -5861, -8186, -10842, -13118,
-    -14513, -14692, -14520, -12489, -9889, -7857, -5844, -6500, -6247, -4667,
-    -4924, -3677, -3108, -2723, 998, 4384, 9897, 15077, 16094, 16581,
-    15605, 13976, 13730, 12256, 9012, 6820, 5125, 5459, 7593, 8952,
-    9186, 7700, 4442, 2039, 873, -1568, -2953, -4864, -6538, -5417,
-    -3790, -2089, -529, -814, -2361, -3646, -5107, -5753, -7924, -10669,
-    -12894, -14602, -14972, -14860, -12211, -9888, -7673, -5764, -6802, -6387,
-    -5134, -4799, -3360, -3289, -2926, 702, 4142, 9611, 14864, 15925,
-    16175, 14626, 13353, 13534, 12372, 9624, 7407, 5720, 5890, 8109,
-    9031, 9297, 7229, 3840, 1434, -49, -1471, -2794, -4371, -5696,
-    -4780, -3254, -1607, -946, -1472, -2852, -4253, -5161, -6309, -7676,
-    -10096, -12448, -13768, -14152, -14135, -12513, -10644, -8530, -6390, -6987,
-    -5807, -4965, -4469, -2915, -2796, -1466, 675, 3778, 8517, 12702,
-    15023, 15859, 14350, 13558, 13520, 12822, 11289, 8045, 6577, 5998,
-    6829, 8128, 7776, 6098, 3763, 1430, -102, -532, -2169, -3221,
-    -4444, -4492, -3088, -2676, -2112, -2189, -3275, -4325, -4666, -6137,
-    -7619, -9479, -12310, -13568, -14376, -14330, -12524, -10820, -8798, -6064,
-    -6119, -5357, -3987, -4353, -2796, -2700, -1946, 496, 3264, 7903,
-    12633, 14880, 15495, 14927, 13250, 13745, 12758, 10060, 7532, 5497,
-    5230, 6393, 7232, 7031, 6228, 3382, 1596, 27, -1303, -1471,
-    -3207, -4900, -4941, -4090, -2998, -1861, -2537, -3375, -4489, -5571,
-    -5926, -7996, -10090, -12777, -14425, -14480, -13305, -10978, -9582, -7384,
-    -6264, -5758, -4823, -4434, -3902, -3614, -3440, -1980, 1161, 5246,
-    10057, 12992, 14481, 14531, 13607, 13085, 12188, 10757, 8249, 6392,
-    5701, 6258, 7311, 7757, 6835, 4837, 2432, 339, -519, -1661,
-    -2577, -3840, -4978, -3829, -2401, -2208, -2480, -3760, -4548, -4508,
-    -5847, -6947, -8971, -11316, -12343, -13375, -13247, -11105, -9719, -8809,
-    -7050, -7140, -5196, -3702, -4105, -3466, -4365, -2878, 782, 3235,
-    7268, 10676, 11791, 14258, 14046, 12864, 12940, 10865, 9823, 8097,
-    5731, 6391, 7243, 7230, 7257, 5103, 2894, 2113, 80, -775,
-    -1957, -3810, -3551, -3857, -3185, -2306, -2765, -3298, -4184, -4608,
-    -5084, -5925, -7403, -9399, -11424, -12576, -12965, -11505, -9519, -8444,
-    -7115, -6963, -5478, -3488, -3487, -3359, -3714, -3962, -1271, 1885,
-    5463, 9702, 11916, 13576, 13919, 13290, 13369, 12501, 10332, 8031,
-    6435, 5925, 6984, 7842, 7057, 5954, 3965, 2079, 854, -784,
-    -1785, -2646, -3808, -3969, -3267, -2498, -2135, -2772, -4471, -5376,
-    -5014, -5465, -6083, -7700, -10218, -10992, -11507, -10990, -9053, -8825,
-    -7696, -6641, -6861, -4730, -3372, -3268, -2891, -3479, -2411, 562,
-    3893, 8618, 11296, 12303, 13542, 13281, 13794, 13516, 11582, 9192,
-    6736, 6159, 6756, 7355, 7283, 6286, 4580, 2875, 1500, -89,
-    -1233, -2492, -4060, -4403, -4188, -3200, -2480, -3483, -4388, -5115,
-    -5451, -4725, -5451, -7085, -8447, -10495, -10830, -10684, -10184, -8500,
-    -8113, -7494, -6374, -5428, -3940, -3260, -3534, -3182, -2741, -975,
-    2633, 5777, 9848, 12611, 13361, 13837, 13063, 13070, 12627, 10045,
-    7574, 6165, 5738, 7021, 7711, 6812, 5883, 3999, 2009, 308,
-    -1984, -2872, -3473, -4982, -5166, -4382, -3451, -2308, -2813, -4838,
-    -5534, -5619, -5849, -6142, -7923, -9741, -10431, -11437, -10054, -7983,
-    -7684, -6252, -6878, -7384, -5060, -3844, -3009, -3065, -3826, -2132,
-    985, 4884, 9540, 11646, 12465, 13077, 12576, 12968, 12955, 11287,
-    8688, 6527, 5940, 7202, 8391, 8024, 6454, 3903, 2044, 681,
-    -1088, -2463, -3884, -5359, -5175, -4279, -2805, -2147, -3339, -4459,
-    -6040, -6151, -5301, -6662, -7732, -9076, -10196, -9610, -9668, -8113,
-    -7110, -7442, -6608, -6893, -6270, -4246, -3856, -3565, -3063, -2201,
-    821, 3795, 7032, 10799, 11992, 12852, 13500, 12272, 12669, 12281,
-    9755, 8379, 7067, 6961, 8097, 7416, 6872, 5729, 2860, 1699,
-    -240, -2502, -2652, -3616, -4755, -4543, -4141, -3268, -2594, -4242,
-    -5257, -5857, -6524, -5350, -6561, -8198, -8689, -9713, -9782, -8873,
-    -8132, -7147, -6032, -6806, -6184, -5370, -4080, -2100, -2669, -2400,
-    -797, 1739, 6094, 9615, 11516, 12817, 12896, 13478, 13371, 12360,
-    11227, 8746, 7304, 6852, 6892, 7719, 7345, 6545, 5083, 2711,
-    1218, -473, -2196, -3538, -5048, -5645, -4773, -3787, -3500, -3723,
-    -4466, -4802, -4555, -5019, -6065, -7272, -8797, -9484, -9916, -10411,
-    -8585, -7327, -6672, -5306, -5857, -4958, -3618, -3572, -2851, -2876,
-    -1804, 942, 3668, 7228, 10734, 12935, 13579, 13598, 12683, 11979,
-    11892, 9457, 7540, 6691, 6520, 8200, 8399, 7137, 6138, 3843,
-    1948, 436, -2544, -3694, -4523, -5589, -4933, -4301, -3347, -2819,
-    -3815, -4788, -5158, -5154, -5229, -6510, -8392, -9775, -9811, -9321,
-    -8995, -7857, -7554, -6486, -5180, -5266, -4132, -3806, -3343, -2448,
-    -2073, -300, 2003, 5373, 8658, 11206, 12653, 13075, 13704, 13007,
-    11911, 10685, 8539, 7501, 7491, 6878, 7231, 7040, 6204, 5594,
-    2876, 679, -1020, -2913, -3666, -4882, -5853, -5357, -4158, -3506,
-    -3961, -4459, -4936, -4885, -4494, -6027, -7465, -8498, -10140, -9494,
-    -9906, -9457, -6589, -6778, -5526, -4759, -5372, -3442, -3199, -3641,
-    -2949, -2297, 135, 4218, 6718, 9587, 12663, 12915, 14000, 13728,
-    11543, 11371, 9500, 7642, 7822, 6867, 7345, 8516, 6819, 6179,
-    4625, 1252, 336, -2238, -4261, -4222, -5727, -5379, -4454, -4654,
-    -4092, -4439, -5454, -5252, -5218, -5912, -6254, -7667, -9012, -9088,
-    -9434, -9484, -8035, -7408, -6552, -5135, -5958, -4582, -3535, -3353,
-    -1850, -2048, -1040, 1879, 4716, 7725, 10818, 11510, 12502, 13572,
-    12522, 12408, 11187, 9171, 8740, 7732, 6876, 7895, 7180, 6493,
-    5892, 2479, 1044, -260, -2396, -3162, -5350, -6558, -5728, -5625,
-    -5229, -5352, -6195, -5426, -4627, -4533, -5343, -6724, -8030, -9549,
-    -9880, -10696, -9844, -7823, -7185, -5198, -4893, -4322, -2228, -2392,
-    -2384, -2266, -2428, -16, 2993, 5286, 8755, 10834, 12624, 14383,
-    13623, 13037, 11925, 10349, 9142, 8026, 7046, 7073, 7821, 7299,
-    6986, 4794, 2411, 1090, -1544, -3215, -4879, -6827, -6803, -6553,
-    -6581, -5464, -5645, -5396, -4567, -5385, -5301, -6172, -8333, -9711,
-    -11296, -11674, -9822, -8024, -6580, -4787, -4584, -3488, -2050, -2564,
-    -2071, -2830, -3246, -1054, 1322, 4953, 9013, 10573, 12265, 13953,
-    13814, 14577, 13136, 10208, 9154, 7830, 7928, 8817, 8019, 7896,
-    7352, 5339, 3992, 2003, -882, -2405, -4912, -7073, -6821, -7013,
-    -6136, -5976, -7153, -6684, -5897, -5274, -4941, -6840, -9032, -9930,
-    -10816, -10489, -9908, -9004, -7016, -5309, -3795, -2993, -2532, -2076,
-    -2022, -2247, -2369, -1103, 1534, 4751, 7766, 10148, 11848, 13713,
-    14697, 14204, 13199, 11205, 10128, 9342, 8493, 8290, 8168, 8442,
-    7866, 6392, 4172, 2093, 419, -1795, -4114, -6444, -7705, -7570,
-    -7170, -7458, -7525, -7465, -6789, -5652, -6272, -6863, -8341, -9750,
-    -10484, -11295, -10984, -9175, -6708, -5070, -3432, -3417, -2327, -1032,
-    -1056, -994, -1960, -1126, 1707, 4879, 7733, 10377, 11624, 13326,
-    14717, 14184, 13679, 12108, 10787, 9745, 8656, 8541, 9132, 9009,
-    8490, 6793, 3968, 2686, 904, -1391, -3828, -6899, -8185, -8054,
-    -7860, -7532, -7865, -8264, -7264, -6792, -6794, -7035, -8919, -10398,
-    -11741, -12166, -11137, -8766, -6454, -5027, -3594, -3035, -951, -91,
-    -551, -957, -2093, -590, 2831, 5263, 8307, 10657, 11488, 14438,
-    15034, 14734, 14513, 11809, 10862, 9728, 8656, 9583, 9496, 8896,
-    8761, 6441, 4656, 3610, 636, -1636, -4794, -7680, -8263, -8404,
-    -8073, -7961, -8471, -8376, -7424, -7230, -7285, -8423, -10531, -11659,
-    -12506, -12179, -10980, -8551, -6463, -4535, -2403, -1931, -573, -574,
-    -1112, -867, -1184, 426, 3268, 5517, 9218, 11987, 12605, 14996,
-    14803, 14483, 14629, 11990, 11027, 9748, 9078, 10013, 9362, 9042,
-    8907, 6373, 4720, 2869, -422, -2085, -4798, -7455, -8732, -9422,
-    -8774, -8393, -8632, -8651, -8485, -8529, -8424, -9125, -10998, -11853,
-    -12547, -12626, -10904, -8357, -5926, -3754, -2433, -1950, -740, -418,
-    146, -295, -938, 1054, 3496, 6910, 10573, 12226, 12875, 14670,
-    15120, 15317, 14916, 12100, 10784, 9758, 9512, 10231, 9307, 8744,
-    8253, 5925, 4367, 2632, -638, -2424, -5418, -8637, -9601, -9977,
-    -9100, -8981, -9789, -9740, -9135, -8304, -8304, -9847, -12196, -13076,
-    -12651, -12304, -10232, -8165, -6418, -3284, -2012, -873, 414, 72,
-    154, -554, -671, 2300, 5083, 8090, 11154, 11693, 13946, 16093,
-    16168, 15701, 13519, 11516, 10781, 10293, 9888, 9514, 8885, 8969,
-    8135, 5815, 4231, 1775, -1288, -3557, -7202, -9948, -10214, -10242,
-    -9827, -9905, -10359, -9023, -8742, -8616, -9157, -12042, -13023, -13396,
-    -13523, -12329, -9869, -7806, -4698, -2244, -1052, 714, 172, 878,
-    68, -1086, 771, 2822, 5753, 9989, 12507, 13449, 15971, 16112,
-    16428, 15985, 12936, 11748, 9758, 9530, 10690, 9884, 9961, 9389,
-    7325, 5927, 4016, 358, -2274, -5673, -8948, -10263, -11324, -10332,
-    -10244, -9997, -9661, -9439, -9061, -9268, -10217, -13010, -14262, -14270,
-    -13737, -11552, -8537, -6887, -3734, -1192, -118, 1436, 567, 377,
-    -248, -882, 1310, 3883, 7043, 11475, 13611, 14477, 16756, 16860,
-    16712, 15788, 12155, 10714, 9940, 9967, 11328, 10243, 9598, 9248,
-    7267, 5956, 3453, -1074, -3740, -7066, -10154, -10595, -11895, -10671,
-    -10134, -10241, -9134, -9827, -9153, -9247, -11439, -13869, -14903, -14791,
-    -12791, -9603, -7411, -5025, -2913, 43, 1500, 1511, 1414, -134,
-    -644, 441, 2550, 5494, 9518, 12782, 14492, 15691, 16624, 17126,
-    16378, 14367, 11571, 9680, 10100, 11289, 11810, 11048, 9455, 8376,
-    6840, 4693, 1631, -2602, -5980, -8452, -10694, -10931, -10862, -10619,
-    -10037, -10598, -10611, -10246, -10522, -10827, -13247, -15743, -14683, -14004,
-    -11196, -7749, -6950, -4264, -1444, 91, 1626, 855, 39, 264,
-    -375, 2233, 5024, 7133, 11887, 13848, 14712, 16888, 16501, 16214,
-    15438, 12307, 11543, 10898, 10986, 12734, 11485, 10882, 10448, 7954,
-    6298, 3302, -1028, -3523, -6725, -9111, -9879, -11081, -10295, -10021,
-    -10290, -9606, -10622, -11065, -11152, -12867, -14225, -14787, -14889, -13079,
-    -10262, -7457, -4455, -2990, -818, 472, 510, 1255, 306, -318,
-    562, 2588, 6057, 9679, 12440, 14421, 15329, 15938, 16910, 15502,
-    13860, 12176, 10140, 10577, 11307, 11872, 11819, 10601, 9086, 7265,
-    4427, 2025, -1563, -5664, -8169, -10455, -10868, -10042, -10397, -10504,
-    -10561, -11216, -10510, -11053, -12271, -13700, -15309, -15007, -13850, -12122,
-    -8753, -6401, -4357, -1454, -501, 909, 1447, 970, 641, 253,
-    1974, 4709, 7751, 11278, 13323, 14615, 15938, 16231, 16312, 14749,
-    13106, 12007, 10792, 11233, 11706, 11753, 11659, 10239, 8182, 5821,
-    2912, 595, -2851, -6353, -8663, -10471, -10455, -9926, -10583, -10867,
-    -11259, -11691, -11595, -12402, -13418, -14638, -15160, -14692, -13482, -11329,
-    -7756, -5529, -3908, -1664, -731, 697, 1258, 796, 403, 851,
-    3508, 6562, 8979, 11677, 13389, 14545, 15684, 15797, 14805, 13564,
-    12506, 11442, 11193, 11029, 11539, 11675, 10547, 9321, 7099, 4605,
-    2198, -983, -4419, -7141, -9382, -9845, -10148, -10743, -10082, -11047,
-    -11115, -11370, -12717, -12862, -14219, -14959, -15091, -14924, -12648, -9366,
-    -6802, -4516, -2899, -1745, 551, 1094, 1376, 863, 164, 2695,
-    5165, 8119, 11000, 12449, 13913, 15173, 15522, 15257, 14117, 12710,
-    11757, 10811, 11032, 11585, 11483, 11166, 9819, 7625, 5605, 3357,
-    390, -2607, -6080, -8556, -9599, -10188, -10167, -10659, -11196, -11483,
-    -11750, -12573, -12956, -14353, -15575, -15604, -15663, -13975, -11869, -8789,
-    -6297, -4049, -1850, -584, 391, 516, 1466, 881, 1428, 4246,
-    5854, 9611, 12579, 13678, 15488, 15055, 15471, 15421, 13033, 12606,
-    11457, 10310, 11364, 11339, 11285, 11151, 9064, 7459, 4503, 1594,
-    -146, -3949, -7220, -9465, -10861, -10771, -10184, -10433, -11162, -11638,
-    -12112, -12139, -13308, -15239, -16174, -17087, -16053, -13570, -11151, -7840,
-    -5245, -2790, -571, 276, 972, 1566, 1009, 865, 2206, 4118,
-    7810, 11612, 13295, 14723, 15263, 16098, 16609, 14663, 12771, 10649,
-    9999, 11014, 11203, 10972, 10569, 9702, 8637, 6837, 3599, 853,
-    -2473, -5656, -8388, -10671, -10736, -10705, -10343, -10846, -11691, -11471,
-    -11993, -12611, -14379, -16876, -17414, -16637, -15134, -12476, -9593, -7043,
-    -3891, -1519, 186, 888, 740, 1568, 565, 1370, 4202, 6386,
-    10537, 12918, 14089, 15723, 16073, 16705, 15544, 12518, 11256, 10651,
-    10608, 11517, 11226, 10704, 10627, 9630, 7956, 4910, 1250, -1282,
-    -4378, -7391, -9116, -10540, -10657, -9967, -10035, -10530, -11171, -11930,
-    -12840, -14569, -16388, -17308, -17660, -16531, -14253, -11048, -7622, -4782,
-    -2033, -935, 58, 706, 799, 770, 530, 2689, 5131, 8990,
-    12714, 14410, 16207, 16490, 16771, 16021, 13858, 12278, 10707, 10003,
-    10432, 11015, 11500, 11737, 10559, 8609, 6001, 3274, 506, -3270,
-    -6458, -9338, -10587, -10072, -9894, -9646, -10184, -11011, -11133, -12316,
-    -13555, -15402, -17878, -18062, -17344, -15402, -11999, -9040, -6427, -3690,
-    -1709, -108, 649, 259, 482, 131, 1913, 4951, 7866, 11349,
-    13329, 15596, 16396, 16769, 16646, 14312, 12764, 11529, 10893, 11115,
-    11269, 11646, 11666, 10777, 9257, 6753, 3611, 939, -2219, -5326,
-    -7877, -9438, -9466, -9713, -9790, -9921, -11082, -11681, -12513, -14253,
-    -15498, -16948, -17575, -17094, -15865, -13291, -9800, -7103, -4858, -2733,
-    -2145, -500, 254, 204, 607, 1100, 3878, 7485, 10878, 13244,
-    15037, 15488, 16313, 16679, 14850, 13731, 11741, 11085, 11639, 11569,
-    12268, 12078, 11066, 9938, 7291, 4443, 1931, -1482, -4227, -7143,
-    -9241, -9441, -9568, -9546, -9885, -10949, -11570, -12272, -13836, -15053,
-    -16695, -17678, -17191, -16524, -14491, -11078, -7951, -5437, -3250, -2534,
-    -1119, 267, 370, 829, 572, 2621, 6404, 9677, 12629, 14156,
-    15098, 16076, 16530, 15603, 14049, 12345, 11592, 11571, 11476, 11892,
-    11740, 11313, 10028, 7684, 4990, 2280, -308, -3188, -6184, -8587,
-    -9424, -9254, -9350, -9902, -11005, -12256, -12422, -13517, -14922, -16274,
-    -17886, -17254, -16144, -14517, -11400, -8855, -6730, -4147, -3094, -1504,
-    19, -175, 607, 688, 2622, 6765, 9724, 11848, 13462, 14605,
-    15979, 16825, 15456, 13593, 12085, 11902, 12617, 12258, 11813, 11774,
-    11261, 10517, 8427, 4854, 2234, -633, -3304, -5390, -8144, -9069,
-    -8996, -9611, -9499, -10349, -11642, -12017, -14121, -15620, -16301, -17764,
-    -16979, -16410, -15703, -11975, -8818, -6260, -3837, -3462, -2330, -538,
-    -174, 610, 632, 1658, 5826, 9180, 11776, 14234, 14972, 15913,
-    16832, 15613, 14165, 12745, 11694, 12072, 11620, 11494, 12271, 11491,
-    10626, 8561, 4948, 2909, 186, -3000, -5606, -8737, -9576, -9137,
-    -9681, -9288, -10385, -11787, -11473, -13334, -14564, -15652, -17896, -17765,
-    -17047, -15461, -11525, -8960, -6929, -4362, -3392, -1095, 242, -467,
-    -220, 104, 2031, 5910, 8875, 11126, 13659, 15117, 16468, 16937,
-    15754, 14601, 12910, 11858, 11945, 11717, 12093, 12301, 11246, 10191,
-    8405, 5738, 3372, -50, -3321, -5837, -8264, -8854, -9558, -10143,
-    -10024, -10825, -11336, -11697, -13400, -14732, -15860, -17432, -17343, -16787,
-    -15226, -11887, -9205, -6965, -4399, -3122, -1114, 374, -463, 9,
-    753, 2496, 6259, 8882, 10930, 13613, 15135, 16653, 16889, 15320,
-    14720, 13114, 12244, 12406, 11785, 12353, 12454, 11474, 10363, 8036,
-    5489, 2954, -466, -3349, -5874, -8058, -8803, -9474, -9948, -9961,
-    -10822, -11843, -12717, -14117, -15218, -16264, -17536, -17381, -16492, -14911,
-    -11329, -8732, -6731, -4012, -3259, -1635, -108, -440, 638, 1026,
-    2861, 6886, 9488, 12410, 14554, 15275, 16763, 16643, 15401, 14525,
-    12493, 12109, 12025, 11731, 12740, 12450, 11961, 10594, 7849, 5336,
-    2256, -986, -4007, -7306, -8945, -9233, -9534, -9330, -9592, -10651,
-    -11652, -12553, -13806, -15373, -17268, -18426, -18260, -16910, -13866, -10528,
-    -8499, -6027, -3476, -1997, -487, -246, -709, -303, 952, 3768,
-    6910, 9911, 13222, 14986, 16379, 17338, 16904, 15951, 14063, 12423,
-    11407, 11299, 12201, 12399, 11850, 11511, 10120, 8065, 5389, 1682,
-    -1798, -5014, -7340, -9065, -10028, -10104, -9891, -9721, -10471, -11477,
-    -12684, -14279, -15333, -17031, -18317, -17720, -16754, -13869, -10293, -8094,
-    -5366, -3348, -2016, -622, -588, -305, 250, 1225, 4270, 7275,
-    10476, 13845, 15557, 16612, 16823, 16478, 15746, 14016, 12688, 11665,
-    11352, 12361, 13023, 12560, 11426, 9671, 7229, 4386, 1075, -2321,
-    -5560, -8212, -9503, -9785, -9775, -9285, -9530, -11099, -11920, -12959,
-    -14303, -15498, -17656, -18587, -17900, -16031, -12431, -9686, -7559, -5020,
-    -3421, -1538, -386, -592, -727, -667, 1409, 4663, 7953, 11435,
-    13397, 15247, 16875, 17183, 16958, 15069, 13000, 12067, 11353, 11770,
-    12408, 12390, 12296, 11230, 9729, 7495, 4155, 845, -3016, -6306,
-    -8532, -9697, -9627, -9918, -9908, -9838, -10683, -11347, -12455, -14418,
-    -15993, -17576, -18096, -17195, -15680, -12535, -9491, -7066, -4369, -2617,
-    -1625, -678, -516, -773, 92, 1831, 4465, 8046, 11375, 13876,
-    15575, 16500, 16854, 16218, 14772, 13394, 11767, 11215, 11649, 11847,
-    12465, 12079, 11122, 9643, 6663, 3822, 424, -3210, -5856, -8683,
-    -9929, -9765, -10259, -9563, -9653, -11009, -11456, -12749, -14190, -15609,
-    -17484, -17969, -17483, -15678, -12021, -9300, -7181, -4435, -2605, -1281,
-    -339, -476, -971, -255, 2114, 4934, 8092, 11497, 13965, 15703,
-    16925, 17401, 16594, 14903, 13259, 11569, 11030, 11622, 12186, 12064,
-    11626, 10943, 9342, 7032, 3938, 166, -3502, -6326, -8795, -10123,
-    -10213, -10284, -10153, -10272, -10847, -11433, -12134, -13818, -15760, -17274,
-    -17863, -17056, -15660, -12657, -9433, -7180, -4067, -2003, -1425, -117,
-    93, -680, 93, 1701, 4643, 8107, 11152, 14328, 15885, 17099,
-    18109, 16875, 15115, 13596, 11731, 10973, 11084, 11544, 12037, 11592,
-    11064, 9404, 6630, 3893, 201, -3754, -6794, -9270, -10616, -10671,
-    -10654, -10350, -10240, -10819, -11195, -12373, -14088, -15343, -17313, -18007,
-    -16893, -15536, -12141, -8793, -6860, -3708, -1966, -980, 392, -525,
-    -618, 116, 1673, 5306, 8184, 11258, 14425, 15891, 17445, 18094,
-    16547, 15079, 13088, 11568, 11208, 10935, 11794, 11862, 11451, 11083,
-    9080, 6476, 3494, -386, -4019, -7095, -9598, -10440, -10726, -10763,
-    -10282, -10423, -10807, -11221, -12509, -14098, -15505, -17221, -17518, -16746,
-    -15161, -11573, -8648, -6297, -3585, -2194, -804, 255, -300, -407,
-    153, 1896, 5414, 8588, 11502, 14074, 15497, 16956, 17538, 16455,
-    14936, 12959, 11573, 11469, 11563, 12079, 12057, 11249, 10571, 8563,
-    5725, 2907, -794, -4106, -6873, -9269, -10018, -10362, -10440, -10225,
-    -11074, -11656, -11884, -13146, -14297, -15740, -17235, -16928, -16091, -14208,
-    -11268, -8952, -6533, -3990, -2541, -1320, -440, -531, 13, 1024,
-    3015, 5818, 8725, 11674, 14060, 15670, 16581, 16811, 15759, 14713,
-    13408, 12110, 11922, 11996, 12200, 12220, 11652, 10302, 8111, 5188,
-    2197, -1314, -4454, -6758, -9105, -9878, -10032, -10345, -9961, -10566,
-    -11519, -12099, -13518, -14406, -15372, -16758, -16718, -16034, -14049, -10448,
-    -8145, -6156, -4125, -2971, -994, 132, 17, 12, 702, 2875,
-    6168, 9314, 11718, 13770, 15123, 16330, 16993, 16315, 14985, 13241,
-    11932, 11768, 12110, 12419, 12199, 11025, 9680, 7777, 5122, 2492,
-    -1209, -4500, -6988, -9294, -9690, -9955, -10351, -10330, -11309, -11769,
-    -11859, -13100, -13994, -15610, -16878, -16086, -15262, -13345, -10809, -8836,
-    -6350, -3865, -2326, -994, -393, -10, 523, 1513, 3533, 5757,
-    8824, 11389, 13675, 15444, 16331, 16845, 16226, 15040, 13686, 12462,
-    12012, 12121, 11866, 11758, 11094, 9857, 8131, 5302, 2144, -1236,
-    -4200, -6735, -9129, -10288, -10821, -10843, -10318, -10828, -11524, -12297,
-    -13259, -14071, -15338, -16443, -16913, -16199, -14067, -11125, -8294, -6146,
-    -4247, -2452, -1026, 112, 308, -239, 641, 2297, 5197, 8967,
-    10923, 13422, 15290, 16082, 17340, 16373, 14673, 13267, 11548, 11484,
-    11765, 11476, 11888, 10986, 9786, 8420, 5389, 2652, -900, -4475,
-    -6998, -9542, -10292, -10248, -10662, -10392, -10968, -11593, -11656, -12665,
-    -13956, -15519, -16820, -16698, -15513, -13716, -11011, -8637, -6480, -3805,
-    -2026, -860, 137, -63, -174, 1155, 2642, 5504, 8539, 10514,
-    13325, 15045, 16271, 17060, 15833, 14571, 13069, 11755, 11900, 11499,
-    11334, 11558, 10604, 10071, 8318, 5391, 2388, -1376, -4216, -6833,
-    -9149, -9939, -10483, -10522, -10052, -10597, -10917, -11497, -12771, -14145,
-    -15645, -16354, -16356, -15232, -13632, -11251, -8315, -5794, -3396, -1899,
-    -1217, -302, -121, 79, 1391, 2629, 5542, 8445, 10736, 13638,
-    15174, 16247, 16588, 15416, 14352, 13231, 12262, 12040, 11435, 11524,
-    11708, 11186, 10249, 7802, 5103, 2095, -1090, -3707, -6660, -8706,
-    -9591, -9842, -9595, -9863, -10317, -11028, -11965, -12636, -13990, -15155,
-    -15762, -16146, -14805, -13238, -10765, -7793, -6273, -4161, -2704, -1701,
-    -70, -125, -80, 1198, 2469, 5996, 8669, 10302, 12768, 13804,
-    15361, 16022, 15074, 14111, 12753, 12190, 12371, 11703, 11744, 11355,
-    10153, 9472, 7236, 4706, 1908, -1309, -3843, -6410, -8112, -8748,
-    -9397, -9707, -10300, -10894, -11268, -11826, -12736, -14327, -15234, -15577,
-    -15052, -13809, -12781, -10892, -8298, -6260, -3923, -2563, -1978, -762,
-    -500, 528, 1727, 3173, 6090, 8066, 10413, 12800, 13849, 15191,
-    15215, 14369, 13925, 12796, 12495, 12177, 11376, 11687, 11080, 10359,
-    9406, 6807, 4544, 1491, -1483, -3736, -6405, -7983, -9010, -9644,
-    -9562, -10167, -10725, -11487, -12503, -12925, -14188, -14973, -15397, -15344,
-    -13998, -12640, -10392, -7951, -6320, -4429, -3008, -1807, -297, -230,
-    289, 1266, 3354, 6870, 8738, 10348, 11867, 13362, 15180, 15530,
-    14417, 13070, 12118, 12531, 12521, 11772, 11468, 10500, 10075, 9210,
-    7116, 4513, 1377, -1458, -3975, -6140, -7493, -8458, -9168, -9705,
-    -10346, -10546, -11071, -11724, -12859, -14404, -14899, -15075, -14334, -13263,
-    -12317, -10487, -8162, -5760, -3512, -2311, -1882, -1005, -469, 974,
-    2464, 4006, 6267, 8112, 10682, 12770, 14173, 14752, 14363, 13492,
-    13045, 12726, 12321, 11854, 10924, 11023, 10940, 10425, 9180, 6512,
-    3674, 883, -1694, -3965, -6188, -7971, -9145, -9487, -9505, -9739,
-    -10293, -11492, -12522, -13258, -13963, -14538, -15036, -15121, -14034, -12282,
-    -10015, -7484, -5789, -4008, -2623, -1578, -218, 101, 808, 2050,
-    3746, 6402, 8854, 10992, 12655, 13876, 14558, 14887, 14235, 13544,
-    12716, 11803, 11601, 11424, 11516, 11165, 10221, 8593, 6636, 4133,
-    1453, -1440, -4391, -6429, -7820, -8791, -9225, -9684, -10274, -10636,
-    -11706, -12440, -13315, -14139, -14546, -15249, -15155, -13917, -12112, -10020,
-    -7856, -6455, -4517, -2735, -1519, -320, -239, 392, 2041, 4074,
-    6556, 8726, 10300, 11921, 13578, 14565, 14730, 13822, 12966, 12420,
-    11784, 11718, 11435, 11156, 11032, 10165, 8591, 6690, 4472, 1743,
-    -1380, -4325, -6421, -7518, -8268, -9016, -9903, -10668, -10747, -11270,
-    -11980, -13051, -14355, -14862, -15024, -14673, -13633, -12238, -10736, -8509,
-    -6588, -4354, -2517, -1799, -828, -443, 703, 2519, 4373, 6146,
-    7881, 9902, 11966, 13722, 14449, 14415, 13612, 13002, 12880, 12406,
-    11866, 11460, 10988, 10834, 10551, 9252, 7142, 4667, 1863, -734,
-    -3269, -5355, -6848, -8423, -9122, -9934, -10460, -10579, -11354, -12222,
-    -13374, -14136, -14235, -14549, -14745, -14204, -13222, -11233, -8889, -7138,
-    -5412, -3968, -2457, -973, -205, 615, 1765, 3547, 5831, 7792,
-    9378, 11026, 12647, 13848, 14316, 13651, 12875, 12653, 12562, 12253,
-    11736, 11410, 11327, 10902, 9871, 7779, 5221, 2811, 97, -2356,
-    -4540, -6232, -7339, -8241, -9156, -9711, -10219, -10838, -11521, -12763,
-    -13665, -14225, -14524, -14459, -14083, -13256, -11752, -9799, -7869, -5936,
-    -4406, -3144, -2060, -1094, 153, 1642, 3028, 4736, 6389, 8317,
-    10682, 12212, 13085, 13130, 13086, 13066, 13066, 12726, 11994, 11461,
-    11460, 11973, 11372, 10347, 8044, 5657, 3797, 1264, -1037, -3493,
-    -5365, -6605, -7364, -8386, -8902, -9595, -10572, -11232, -12602, -12853,
-    -13298, -13821, -14066, -14237, -13274, -11653, -9999, -8930, -7380, -6007,
-    -4304, -2629, -1646, -425, 509, 1941, 3889, 5841, 7433, 9236,
-    10462, 11395, 12576, 12949, 13291, 12665, 12307, 12441, 12127, 12566,
-    12408, 11359, 10467, 8965, 7145, 5294, 2556, 202, -1959, -3933,
-    -4997, -6283, -7205, -7897, -9077, -9780, -10423, -11283, -11779, -12539,
-    -13535, -13916, -13572, -12861, -11671, -10944, -10184, -8595, -6917, -4971,
-    -3704, -3277, -2315, -836, 692, 2571, 3798, 5271, 7209, 8846,
-    10732, 11520, 12277, 12636, 12220, 12175, 12303, 12509, 12509, 12360,
-    11688, 11173, 10472, 9459, 7292, 4499, 2352, 35, -1551, -3311,
-    -4972, -6433, -7328, -7666, -8442, -8820, -9741, -10495, -11453, -12324,
-    -12584, -12628, -12471, -12564, -12034, -11173, -9114, -7502, -6589, -5607,
-    -4816, -2978, -1539, -635, -133, 884, 2751, 4989, 6883, 8259,
-    9686, 10576, 11960, 12509, 12347, 12323, 12149, 12348, 12171, 12143,
-    11926, 11299, 10512, 9084, 7183, 5264, 3361, 1219, -1002, -3187,
-    -4622, -5603, -6460, -7257, -8182, -8661, -9191, -9571, -10301, -11276,
-    -11737, -12140, -11964, -11778, -11436, -10599, -9687, -8377, -6867, -5609,
-    -4377, -3466, -2807, -1625, -569, 846, 1965, 3051, 5043, 6837,
-    8881, 9975, 10422, 11237, 11854, 12703, 12680, 12029, 12082, 12161,
-    11956, 11565, 10290, 9033, 7972, 6301, 4691, 2437, 306, -1331,
-    -3138, -4513, -5815, -6639, -7266, -7891, -8550, -9037, -9372, -9940,
-    -10096, -10811, -11482, -11404, -11004, -10346, -9996, -9273, -8000, -6592,
-    -4947, -3618, -3212, -2489, -1256, -214, 991, 1769, 3036, 4545,
-    5924, 8083, 9426, 10569, 11846, 12310, 12505, 12621, 12602, 12235,
-    11501, 10554, 9960, 9386, 8871, 7858, 6046, 4321, 2554, 864,
-    -1013, -2944, -4759, -6147, -7027, -7523, -7770, -8019, -8436, -8990,
-    -9179, -9528, -9916, -10430, -11074, -11216, -10615, -9615, -8528, -7451,
-    -6317, -4844, -3667, -2458, -1709, -1306, -696, -16, 1098, 2235,
-    3868, 5615, 7249, 9015, 10680, 11929, 12585, 12732, 12259, 11683,
-    11254, 11127, 10612, 9835, 9241, 8703, 8063, 6930, 5429, 3203,
-    1041, -868, -2675, -4081, -5448, -6469, -7022, -7601, -7770, -7745,
-    -8344, -8791, -9771, -10469, -10549, -10652, -10214, -10136, -9811, -8790,
-    -7301, -5920, -4943, -4382, -3605, -2659, -1805, -882, -621, 246,
-    1655, 3513, 5239, 6764, 8543, 9786, 11034, 11683, 11872, 11709,
-    11462, 11342, 10918, 10602, 10557, 10171, 9393, 8638, 7251, 5767,
-    4042, 1962, -27, -2018, -3278, -4177, -5399, -6204, -6718, -7364,
-    -7673, -8228, -8928, -9501, -10004, -10250, -10325, -10334, -9990, -9365,
-    -8855, -7883, -6948, -6039, -5097, -4410, -3672, -3014, -2276, -1347,
-    -331, 721, 2465, 4222, 5747, 7256, 8416, 9713, 10675, 11275,
-    11436, 11187, 11164, 11475, 11507, 11292, 10859, 10049, 9541, 8456,
-    6991, 5359, 3282, 1430, -418, -2014, -3166, -4121, -4988, -5826,
-    -6739, -7166, -7367, -8012, -8794, -9696, -10146, -10058, -9765, -9693,
-    -9875, -9455, -8508, -7451, -6879, -6554, -5995, -5367, -4264, -3420,
-    -2890, -1956, -725, 947, 2631, 4003, 5477, 6915, 8126, 9540,
-    10248, 10785, 11374, 11399, 11739, 11716, 11821, 11849, 11222, 10439,
-    9360, 8089, 6793, 5263, 3198, 1184, -609, -1765, -2628, -3584,
-    -4667, -5641, -6134, -6586, -6850, -7640, -8603, -9099, -9388, -9220,
-    -9198, -9415, -9221, -9003, -8390, -7568, -7459, -7121, -6649, -6080,
-    -5155, -4463, -3640, -2579, -1503, 250, 2026, 3362, 5027, 6467,
-    7849, 9071, 10123, 11003, 11379, 11680, 12044, 12267, 12187, 12342,
-    11743, 10580, 9635, 8403, 6935, 5309, 3394, 1244, -389, -1601,
-    -2161, -3075, -4169, -4818, -5741, -5980, -6319, -7123, -7963, -8751,
-    -9046, -8749, -8811, -8851, -8661, -8899, -8311, -7989, -7794, -7556,
-    -7572, -6999, -6535, -5798, -4565, -3545, -2439, -600, 900, 2796,
-    4701, 5940, 7414, 8312, 9624, 10797, 11306, 11920, 12283, 12605,
-    13049, 12947, 12236, 11222, 9771, 8590, 7104, 5284, 3687, 1966,
-    546, -414, -1312, -2190, -3016, -3984, -4971, -5734, -6297, -6809,
-    -7315, -7959, -8262, -8308, -8054, -7852, -8249, -8425, -8623, -8657,
-    -8498, -8535, -8581, -8191, -7474, -6613, -5541, -4457, -2975, -1514,
-    41, 1562, 3184, 4919, 6405, 7965, 9020, 10193, 11463, 12310,
-    12808, 12824, 12893, 12954, 12405, 11547, 10275, 8623, 7766, 6586,
-    4870, 3332, 1526, 511, -204, -1235, -2210, -3589, -4533, -4798,
-    -5359, -5908, -6462, -7192, -7369, -7523, -7619, -7633, -8249, -8580,
-    -8878, -9268, -9285, -9328, -9355, -9262, -8825, -7984, -6879, -5793,
-    -4456, -3077, -1651, 219, 1920, 3565, 5106, 6770, 8282, 9465,
-    10785, 11856, 12659, 13122, 13490, 13360, 12974, 12668, 11694, 10236,
-    8858, 7687, 6271, 4922, 3336, 1761, 776, -26, -788, -2100,
-    -3314, -4029, -4608, -4935, -5569, -6391, -6648, -6807, -6912, -6916,
-    -7559, -8127, -8548, -9321, -9825, -10216, -10297, -10119, -10166, -9530,
-    -8569, -7419, -5843, -4926, -3942, -2534, -889, 1083, 2679, 4057,
-    5854, 7735, 9598, 11366, 12242, 13000, 13696, 14061, 13949, 13392,
-    12849, 11884, 10911, 9838, 8521, 7120, 5878, 4439, 2724, 1285,
-    91, -995, -2102, -3080, -4071, -4555, -4652, -4952, -5430, -5995,
-    -6454, -6633, -6859, -7460, -8073, -8885, -9545, -9723, -9953, -10136,
-    -10161, -10282, -10122, -9516, -8508, -7350, -6617, -5664, -4307, -2733,
-    -387, 1648, 2921, 4759, 6689, 8600, 10577, 11774, 12756, 13568,
-    14127, 14605, 14445, 14011, 13681, 12650, 11236, 9852, 8309, 7181,
-    5722, 3904, 2313, 714, -191, -796, -1996, -3307, -4061, -4625,
-    -5115, -5445, -5929, -6253, -6583, -6801, -7096, -7643, -8007, -8298,
-    -9081, -10203, -10490, -10639, -10616, -10505, -10622, -10190, -9409, -8032,
-    -6741, -6119, -4974, -3054, -1416, 621, 2754, 4263, 6487, 8724,
-    10459, 12076, 13159, 14249, 14809, 14601, 14613, 14297, 13711, 13173,
-    11806, 10193, 9243, 7955, 6672, 4900, 2447, 1017, -187, -1267,
-    -2212, -3619, -4626, -4841, -5013, -5056, -5431, -6212, -6345, -6817,
-    -7243, -7426, -8084, -8588, -9189, -9838, -10089, -10233, -10364, -10531,
-    -11040, -11040, -10281, -9411, -8344, -7352, -6265, -4527, -2146, 131,
-    2046, 3969, 5740, 7763, 9855, 11461, 12731, 13638, 14566, 15234,
-    15418, 15581, 15191, 14064, 13096, 11677, 9924, 8588, 6670, 4791,
-    2913, 1224, 288, -915, -2048, -2941, -3997, -4618, -4846, -5197,
-    -5529, -6187, -6560, -6568, -6862, -6820, -7115, -8103, -8847, -9426,
-    -9814, -10318, -11013, -11737, -12295, -12033, -11235, -10364, -9766, -8872,
-    -7595, -5867, -3772, -1735, 144, 1934, 4099, 6401, 8813, 10785,
-    12638, 13976, 14613, 15584, 16133, 16234, 15870, 14821, 13522, 12150,
-    11035, 9969, 7967, 5714, 4114, 2512, 1304, 243, -1246, -2493,
-    -3424, -3674, -3881, -4667, -4943, -5133, -5594, -5860, -6074, -6575,
-    -7128, -7586, -8303, -9120, -9793, -10121, -10864, -11722, -12088, -12198,
-    -12086, -11784, -11295, -10787, -9323, -7524, -5943, -4187, -2285, 169,
-    2737, 4852, 6735, 8656, 10589, 12640, 13957, 14698, 15450, 15847,
-    16228, 15901, 14714, 13758, 12541, 11007, 9331, 7341, 5684, 4349,
-    2880, 1368, -65, -1064, -1434, -2328, -3485, -4439, -4933, -4879,
-    -5127, -5843, -6658, -6706, -6395, -6468, -7194, -8220, -8896, -9205,
-    -9770, -10744, -11826, -12488, -12282, -12231, -12127, -11518, -10881, -9445,
-    -7848, -6813, -5005, -2970, -827, 1430, 3280, 5598, 8028, 10136,
-    12274, 13460, 14198, 15737, 16165, 15983, 15581, 14576, 14142, 13276,
-    11953, 10516, 8605, 7011, 5953, 4081, 2111, 356, -1416, -2265,
-    -3133, -3944, -4550, -5276, -5455, -5231, -5373, -5523, -5889, -6705,
-    -6963, -7088, -7546, -7995, -8831, -9663, -9993, -10525, -10913, -11346,
-    -12062, -12182, -11886, -11612, -10612, -9378, -8145, -6562, -5212, -2882,
-    -265, 1751, 4029, 5897, 7667, 10480, 12878, 14257, 15145, 15421,
-    16398, 16932, 16267, 15431, 13777, 12485, 11961, 10382, 8409, 6597,
-    4855, 3694, 1940, -187, -1673, -3158, -3883, -4388, -5666, -5898,
-    -5540, -5367, -5119, -5412, -5725, -5590, -5876, -6381, -7118, -8237,
-    -8290, -8555, -9447, -10079, -10761, -10889, -10746, -11426, -12003, -11845,
-    -11390, -9707, -8421, -7561, -5578, -3099, -5, 2849, 4597, 6533,
-    8711, 10759, 13108, 14069, 14456, 15586, 16236, 16783, 16791, 15693,
-    14869, 13716, 12073, 10412, 7899, 5885, 4473, 2424, 582, -792,
-    -1937, -2302, -3093, -4140, -4734, -5319, -5095, -5054, -5752, -6053,
-    -5865, -5566, -5160, -5546, -6284, -6484, -6988, -7750, -8927, -10414,
-    -11302, -11744, -12139, -12361, -12633, -12119, -10530, -9351, -8190, -6722,
-    -5461, -3307, -955, 1068, 3443, 5487, 7903, 10677, 12833, 14855,
-    16211, 16562, 17104, 16721, 16007, 15559, 13855, 12256, 10825, 9354,
-    8307, 6924, 5283, 3719, 1700, 282, -811, -2542, -3537, -4563,
-    -5402, -5481, -5387, -4884, -4432, -4488, -4612, -4638, -4654, -4791,
-    -5748, -7021, -8131, -8960, -9416, -10227, -11402, -12117, -12204, -12093,
-    -12165, -12123, -11672, -10637, -9072, -7905, -6696, -4708, -1881, 966,
-    3190, 5190, 7606, 10342, 12768, 14441, 14837, 15368, 16139, 16334,
-    15901, 14854, 13841, 12895, 11728, 10266, 8755, 7148, 5671, 3804,
-    1611, 214, -859, -1840, -2752, -3831, -4297, -3879, -3427, -3523,
-    -4003, -4486, -4369, -4388, -4902, -5517, -6570, -7086, -7393, -8049,
-    -8616, -9491, -10741, -11499, -12160, -12700, -12691, -13107, -12894, -12017,
-    -10418, -7955, -6155, -4526, -2165, 280, 2975, 5444, 6873, 8563,
-    10293, 12235, 14302, 15141, 15632, 16155, 16089, 16041, 15348, 13760,
-    12147, 10170, 8434, 7090, 5537, 4082, 2772, 1383, 648, 54,
-    -740, -1494, -2749, -3701, -4000, -4221, -4473, -4655, -5039, -4956,
-    -4393, -4306, -4477, -5385, -6592, -7363, -8404, -9646, -10975, -12459,
-    -13115, -12887, -12788, -12146, -11631, -11061, -9407, -8060, -6566, -5065,
-    -3977, -2034, 477, 2939, 5734, 7725, 9587, 12250, 14112, 15635,
-    16143, 15516, 15347, 15022, 14566, 13863, 12191, 10929, 10139, 8937,
-    8009, 6612, 4613, 2862, 1056, -183, -920, -1800, -2678, -3636,
-    -4064, -3444, -2848, -3052, -3898, -4984, -5106, -4495, -4692, -5732,
-    -6822, -7656, -7632, -7625, -8551, -9913, -11406, -12137, -12420, -12555,
-    -12243, -12039, -11763, -10279, -8325, -6068, -3759, -2523, -1164, 822,
-    3507, 5990, 7545, 8820, 10395, 12476, 14712, 15831, 15665, 15399,
-    15034, 14728, 13928, 12462, 10671, 8995, 7853, 6755, 5636, 4435,
-    2774, 1135, 13, -932, -1654, -2588, -3767, -4448, -4534, -3911,
-    -3526, -4004, -4414, -4685, -4573, -4229, -4830, -6092, -7173, -7921,
-    -7913, -8364, -9604, -10770, -11815, -11788, -11435, -11484, -11555, -11291,
-    -10225, -8264, -6394, -4700, -3075, -1343, 942, 3072, 5315, 7106,
-    8559, 9981, 11468, 13098, 14287, 14872, 14726, 14153, 13903, 13740,
-    12743, 11164, 9082, 7559, 6644, 5566, 4260, 2255, 665, -30,
-    -586, -1042, -2060, -3197, -3507, -3650, -3514, -3468, -4112, -4543,
-    -4781, -4737, -4366, -4732, -5351, -5986, -6653, -6819, -7031, -8106,
-    -9453, -10703, -11400, -11097, -11083, -11237, -10962, -10298, -8514, -5939,
-    -4344, -2889, -1552, 29, 2678, 4466, 5902, 7155, 8047, 9960,
-    12076, 13139, 14152, 14172, 13908, 14190, 13457, 12749, 11431, 9217,
-    7583, 6326, 5308, 4647, 3092, 1362, 379, -459, -418, -875,
-    -2558, -3575, -3899, -3682, -3090, -3504, -4189, -4219, -4111, -3362,
-    -3224, -4174, -4616, -5267, -5754, -5910, -6849, -7904, -8896, -10082,
-    -10349, -10270, -10344, -10101, -10038, -9071, -7159, -5215, -3454, -2195,
-    -1184, 968, 3265, 4720, 5989, 6768, 8139, 10059, 11627, 12519,
-    12846, 12938, 13392, 13155, 12233, 11292, 9567, 8181, 6831, 5325,
-    4323, 3448, 2117, 935, 30, -625, -695, -1385, -2525, -3351,
-    -3616, -2900, -2571, -3355, -3595, -3494, -3064, -2136, -2930, -4157,
-    -4475, -5009, -4881, -5765, -7421, -8008, -8717, -8856, -8991, -9955,
-    -9773, -9280, -8936, -7705, -6932, -5475, -3553, -2285, -770, 893,
-    2849, 4779, 5723, 6450, 7591, 9063, 10656, 11064, 10875, 10827,
-    11532, 12070, 11364, 9989, 8485, 7680, 7127, 5898, 4043, 2432,
-    1321, 873, 189, -651, -1127, -1527, -1674, -1956, -2043, -1894,
-    -1884, -2313, -3048, -3220, -2964, -2613, -2860, -3859, -4149, -3709,
-    -3493, -4099, -5642, -7120, -7642, -8264, -8894, -9724, -10415, -9583,
-    -8531, -7443, -5994, -4498, -2836, -1404, -811, 355, 1838, 2966,
-    4003, 4481, 5719, 7991, 9919, 10934, 10954, 10872, 11699, 11670,
-    10545, 8705, 6996, 6414, 5758, 4800, 3661, 2946, 3032, 2674,
-    1541, 591, -297, -470, -1207, -2700, -2917, -2645, -1767, -1415,
-    -2185, -2093, -1537, -988, -1200, -2957, -3986, -3967, -4260, -4968,
-    -6451, -7422, -7216, -7372, -7888, -8886, -9178, -8250, -7525, -7082,
-    -6776, -5479, -3423, -1900, -1323, -817, 540, 2382, 3627, 4254,
-    4920, 6279, 8338, 9648, 9857, 9643, 9999, 10296, 9623, 8216,
-    6866, 6317, 6016, 5401, 4751, 3973, 3830, 3893, 2698, 1600,
-    385, -282, -263, -1466, -2198, -1954, -1714, -815, -740, -1302,
-    -1016, -1428, -1693, -2305, -4192, -4603, -4774, -5639, -5811, -6519,
-    -6737, -6469, -7328, -7958, -8277, -8693, -8065, -7980, -7895, -6294,
-    -4793, -2767, -1163, -383, 1293, 2847, 3216, 3557, 3770, 4433,
-    5963, 6606, 7238, 8319, 9462, 10714, 10515, 8969, 8436, 7779,
-    6507, 5205, 3060, 2460, 3203, 3049, 3002, 2618, 2457, 3523,
-    2777, 1146, 8, -980, -731, -1351, -2847, -2852, -2178, -1393,
-    -1092, -2227, -2931, -2714, -2982, -4299, -6512, -8265, -8507, -8351,
-    -9205, -9872, -9631, -8804, -6987, -6428, -6393, -5275, -4520, -3023,
-    -2293, -2774, -1372, 126, 1145, 2652, 2752, 4397, 6676, 7056,
-    7962, 7463, 7271, 8800, 8487, 7663, 6831, 5852, 6890, 6948,
-    5700, 5251, 4524, 4687, 4941, 3764, 2759, 2232, 1744, 1672,
-    904, 34, 223, 156, -547, -1030, -1591, -1769, -1822, -3088,
-    -4023, -4680, -5197, -5053, -6065, -7201, -7536, -7961, -7839, -8254,
-    -8991, -8925, -8930, -8354, -7199, -6435, -5230, -4367, -3456, -1827,
-    -808, 518, 1095, 1178, 2378, 3600, 4705, 5550, 5710, 6453,
-    7483, 7964, 8390, 7899, 7522, 7512, 7056, 6874, 6528, 6074,
-    5948, 5477, 4709, 4477, 4402, 3909, 3165, 2298, 1676, 1783,
-    1637, 1053, 5, -1236, -1175, -1147, -2061, -3131, -4589, -5217,
-    -4831, -5349, -6040, -6926, -7981, -7669, -7528, -8224, -8809, -9148,
-    -8713, -7940, -7603, -6923, -5681, -5009, -3775, -2644, -2383, -855,
-    284, 503, 1034, 1320, 2768, 4902, 5078, 5445, 5952, 6374,
-    8248, 8231, 7204, 6650, 6023, 7062, 7613, 6412, 6037, 5900,
-    6122, 6643, 5701, 4743, 3790, 2768, 2424, 1389, 467, 333,
-    -116, -469, -900, -1190, -1217, -1861, -2902, -4221, -5351, -5709,
-    -6029, -6792, -7656, -8330, -8047, -7136, -6917, -7304, -7788, -7871,
-    -7158, -6565, -6651, -6787, -6710, -5544, -3786, -3038, -2040, -965,
-    -5, 1896, 2710, 3258, 4177, 4193, 4912, 5369, 5138, 6090,
-    6636, 6877, 7548, 7259, 8130, 8882, 8066, 7814, 6919, 5886,
-    5772, 4868, 3672, 3031, 2340, 2608, 2839, 2097, 2013, 1714,
-    717, 126, -936, -2356, -3220, -4375, -4979, -5019, -5656, -5075,
-    -4612, -5250, -5000, -5252, -6112, -6593, -7712, -8336, -8442, -8812,
-    -8012, -7272, -6562, -4832, -3769, -3232, -2537, -2303, -1669, -1104,
-    -1425, -929, 168, 1504, 3518, 4743, 5460, 6888, 7807, 8417,
-    8367, 7121, 7054, 6985, 6509, 6726, 6171, 6375, 7400, 6816,
-    6281, 5708, 4671, 4577, 3009, 1119, 359, -250, 392, 170,
-    -1326, -1279, -922, -879, -1199, -2970, -4108, -4413, -4635, -4772,
-    -5949, -6615, -5980, -5732, -6046, -6515, -7079, -7208, -7172, -7724,
-    -8081, -7980, -7293, -5973, -5570, -5400, -3972, -2715, -1548, -865,
-    -917, 359, 1396, 2413, 3983, 3919, 4734, 6454, 6898, 7499,
-    7377, 7232, 7720, 7173, 7151, 6997, 6149, 6625, 6431, 5601,
-    5250, 4491, 4171, 3590, 2389, 1695, 1180, 862, 755, 296,
-    -90, -429, -866, -1376, -1895, -2676, -3546, -4177, -4942, -4927,
-    -4718, -5244, -5242, -5681, -6149, -5417, -6261, -7350, -7639, -8411,
-    -7556, -7309, -7463, -5978, -5598, -4142, -2169, -2602, -1404, -112,
-    -228, 915, 628, 1465, 3807, 3998, 4999, 5982, 6356, 8401,
-    8890, 7746, 7336, 6571, 7053, 7311, 5435, 4970, 5202, 5077,
-    5900, 5389, 3815, 3646, 3163, 2457, 1705, -3, -162, -223,
-    -1060, -573, -892, -1412, -864, -1989, -2983, -3297, -4468, -4641,
-    -5409, -6752, -6301, -6074, -5951, -5461, -6355, -6704, -6488, -6758,
-    -6704, -7435, -8148, -7275, -6157, -4842, -3388, -2797, -1659, 79,
-    1174, 1821, 1835, 1673, 2014, 2635, 3360, 4097, 4736, 5623,
-    6734, 7370, 7962, 8251, 7639, 6636, 5890, 5305, 4705, 4158,
-    3593, 3275, 3216, 3629, 3999, 3548, 2728, 2005, 1257, 332,
-    -397, -1336, -2544, -3204, -3270, -2911, -2648, -3034, -3531, -3569,
-    -3717, -3662, -4132, -5650, -6387, -6406, -6281, -6206, -6763, -6711,
-    -6020, -5752, -4948, -4652, -4851, -3942, -3821, -3737, -2686, -2255,
-    -1250, -480, -291, 1445, 2802, 3612, 4627, 4313, 4902, 6231,
-    6140, 6121, 5890, 5657, 6740, 6957, 6646, 6804, 6349, 6408,
-    6252, 4818, 3912, 3292, 2061, 1326, 466, 119, 614, 161,
-    -75, -14, -369, -138, -765, -2630, -3441, -3775, -4127, -4242,
-    -4974, -4838, -3935, -3386, -2755, -3088, -3968, -4259, -4993, -5945,
-    -6744, -7747, -7573, -7137, -6739, -5203, -4003, -2876, -1733, -1434,
-    -882, -636, -542, -66, -403, 99, 1712, 2879, 4522, 5756,
-    6585, 7802, 8009, 8138, 7817, 6522, 5994, 5398, 4723, 4611,
-    4156, 4289, 4364, 3652, 3536, 2855, 1713, 1254, -12, -1245,
-    -1436, -1643, -1661, -1756, -1867, -1433, -1242, -1573, -1882, -2540,
-    -3029, -2955, -3677, -4393, -4020, -3861, -3956, -4266, -5071, -5025,
-    -5152, -6051, -6464, -7648, -7729, -6176, -6091, -5656, -4626, -3765,
-    -1788, -819, -546, 510, 746, 1671, 2822, 2655, 3877, 5475,
-    6185, 6903, 7136, 8068, 9018, 8293, 7275, 6361, 5438, 5515,
-    5015, 3333, 2333, 2220, 2552, 2475, 1545, 877, 636, 178,
-    120, -116, -1019, -1121, -875, -1041, -995, -1040, -800, -720,
-    -1646, -2031, -1969, -2603, -2880, -3508, -4948, -5305, -5152, -5432,
-    -6323, -7480, -7564, -7248, -7162, -6795, -6852, -6676, -5128, -3535,
-    -2647, -1819, -820, 506, 1751, 2578, 3259, 3883, 4597, 5626,
-    6189, 6256, 7223, 7862, 7474, 7212, 6765, 6514, 6107, 4844,
-    3746, 2776, 2335, 2680, 1888, 885, 1148, 1360, 1507, 1248,
-    798, 634, 213, 345, 304, -551, -601, -345, -841, -1003,
-    -1030, -1409, -1934, -2803, -3480, -3977, -4725, -5434, -6333, -7296,
-    -7367, -7066, -7491, -7845, -7782, -7239, -6267, -5814, -5090, -4014,
-    -3165, -1703, -393, 446, 1892, 2775, 3237, 4090, 4659, 5686,
-    6213, 5896, 6378, 6659, 7047, 7540, 6683, 6014, 5718, 5013,
-    4687, 3812, 2596, 2340, 1904, 1767, 1998, 1610, 1809, 2070,
-    1764, 1678, 1478, 1306, 1161, 212, -280, -270, -811, -689,
-    -1106, -2296, -2387, -2503, -3007, -3729, -5098, -5733, -6007, -6859,
-    -7194, -7895, -8774, -8140, -7512, -7333, -6938, -6143, -4429, -3147,
-    -2446, -1155, -135, 809, 2253, 2449, 2400, 3544, 4698, 5437,
-    5383, 5653, 7011, 7583, 7598, 7404, 6232, 5845, 6043, 4942,
-    3616, 2841, 2784, 3352, 3122, 2826, 3098, 3165, 3446, 3239,
-    2049, 1343, 1146, 720, 204, -604, -594, -56, -407, -548,
-    -966, -1880, -2161, -3134, -4712, -5583, -6402, -6766, -6826, -7267,
-    -7062, -6736, -6582, -6084, -6290, -6664, -6544, -6412, -5729, -4833,
-    -4002, -2529, -762, 844, 2569, 3669, 4209, 4728, 4693, 4557,
-    4603, 4712, 5242, 5458, 5844, 7178, 7870, 8081, 8067, 7004,
-    5955, 5150, 3884, 2695, 1495, 962, 1481, 1786, 2097, 2783,
-    3169, 2923, 2465, 1623, 393, -581, -1373, -2391, -3404, -3250,
-    -2100, -1814, -2070, -2020, -2322, -2651, -3346, -4970, -6606, -7891,
-    -8355, -8301, -8743, -8334, -7121, -6269, -5503, -4686, -3769, -3209,
-    -2832, -2406, -2008, -1133, 420, 2072, 3037, 3855, 5417, 6767,
-    7375, 7644, 7254, 6832, 6739, 6629, 6621, 6137, 5895, 6053,
-    5607, 5462, 5097, 4571, 3805, 2305, 1571, 1230, 854, 839,
-    512, -61, 160, 851, 1326, 864, -89, -798, -1392, -1423,
-    -1946, -3105, -3894, -4183, -3851, -3735, -4090, -4408, -4807, -5414,
-    -6141, -6744, -7436, -7852, -8218, -8612, -8275, -6906, -5113, -3974,
-    -3206, -2039, -269, 1345, 2623, 2879, 2662, 3593, 4940, 5953,
-    6157, 6339, 7122, 7771, 8365, 8607, 8118, 7430, 7077, 6233,
-    5116, 4441, 3537, 2775, 1794, 1060, 1260, 1246, 938, 909,
-    524, 224, 668, 471, 136, -456, -968, -658, -943, -993,
-    -1046, -1731, -1910, -2175, -2986, -3578, -4526, -5604, -6119, -7184,
-    -7829, -7687, -7867, -7635, -7498, -7366, -6595, -5878, -5220, -4346,
-    -3860, -3027, -1137, 216, 2011, 3665, 4749, 6416, 7253, 7835,
-    8358, 7847, 7197, 6810, 6089, 6045, 6193, 6101, 6368, 5801,
-    5690, 5899, 4830, 3768, 2194, 245, -652, -911, -976, -747,
-    -795, -306, 1227, 2088, 2467, 1748, 271, -631, -1209, -1721,
-    -2821, -3923, -3944, -3251, -2948, -2828, -3296, -4368, -5011, -6269,
-    -7816, -8864, -9422, -9291, -9083, -8588, -7168, -4886, -3125, -2092,
-    -1772, -1269, 335, 1646, 2354, 2244, 2924, 5174, 7256, 8439,
-    8648, 8515, 8787, 9167, 8388, 6863, 5481, 4995, 4888, 4046,
-    3720, 3528, 3372, 3407, 2527, 1362, 629, 380, 150, -629,
-    -1405, -1024, -72, 507, 820, 524, 320, 315, 280, -333,
-    -1864, -2788, -3046, -3805, -4873, -5115, -5803, -6390, -6503, -7312,
-    -7625, -7804, -7603, -7272, -7822, -7600, -6478, -5662, -4597, -3553,
-    -2603, -884, 894, 2951, 4662, 5235, 6553, 7437, 7490, 7775,
-    7535, 6953, 6439, 6151, 6382, 6761, 6594, 6721, 6328, 5517,
-    5329, 4304, 2737, 1325, -48, -669, -861, -777, -91, 333,
-    594, 1338, 1691, 1673, 1150, -121, -1230, -2157, -2349, -2413,
-    -3020, -3411, -3248, -3130, -3295, -3794, -5226, -6578, -7527, -8393,
-    -8910, -9223, -8818, -7674, -6814, -5780, -4200, -3103, -2136, -1560,
-    -1532, -768, 398, 2187, 3710, 4325, 6126, 8203, 9355, 10062,
-    9404, 8385, 7736, 6809, 6149, 4799, 3915, 4653, 4747, 4717,
-    4800, 4354, 4194, 3246, 1583, 84, -1250, -1507, -1444, -2181,
-    -2093, -986, 391, 1438, 1249, 671, 172, -319, -1053, -2530,
-    -4480, -5352, -5228, -5542, -5822, -5988, -6087, -5568, -5702, -6511,
-    -6983, -7497, -7318, -7143, -7770, -6994, -5473, -3761, -1687, -898,
-    563, 2766, 4302, 5593, 5673, 5490, 6586, 7259, 7437, 7492,
-    7084, 7857, 8535, 8149, 7797, 6907, 6362, 6053, 4400, 2679,
-    1734, 1149, 899, 250, -665, -417, 154, 707, 724, -311,
-    -763, -510, -544, -1420, -2276, -2767, -2569, -2011, -2195, -2454,
-    -2802, -2928, -3042, -4438, -5835, -6605, -7486, -8012, -8589, -9057,
-    -7979, -6877, -5877, -4946, -4782, -3345, -1966, -1501, -1041, -628,
-    548, 2421, 3877, 5102, 6418, 7556, 8978, 9443, 9214, 9174,
-    8286, 7728, 6986, 6057, 5910, 5365, 4710, 4029, 3441, 3206,
-    2541, 1137, 61, -686, -918, -1053, -1704, -1846, -1755, -903,
-    -450, -1036, -1129, -1104, -1030, -1499, -2458, -3220, -3449, -3431,
-    -4236, -5204, -5942, -5841, -5668, -6427, -7315, -7539, -6934, -6250,
-    -6334, -6818, -6043, -4732, -3339, -2593, -2498, -845, 1484, 3444,
-    4550, 4985, 6262, 8159, 9151, 8660, 7848, 7337, 7984, 8153,
-    6984, 6237, 5813, 6410, 6658, 5436, 4039, 3071, 2170, 1182,
-    -263, -2085, -2356, -2094, -2046, -1658, -1581, -786, 88, -126,
-    -673, -1518, -2390, -2346, -3216, -4459, -4454, -4918, -4217, -3776,
-    -4664, -4775, -5476, -5835, -5829, -7013, -7843, -7767, -7660, -6535,
-    -5126, -4404, -3062, -1732, -52, 1646, 2182, 2876, 3683, 4362,
-    5611, 6715, 6819, 7621, 8490, 8900, 9440, 8563, 8022, 7718,
-    6565, 5655, 4388, 3153, 2865, 2338, 1273, 582, -89, 3,
-    36, -1219, -1794, -2120, -2064, -1588, -2315, -2995, -2724, -2416,
-    -2129, -2379, -3503, -3517, -3474, -3954, -4422, -5539, -5802, -5813,
-    -6172, -6300, -6705, -6560, -5967, -5768, -5649, -5011, -4012, -3059,
-    -2196, -1251, -85, 1471, 2972, 3846, 4835, 5585, 6735, 7618,
-    7532, 7918, 7732, 7763, 7980, 7332, 7112, 6523, 5886, 5465,
-    4424, 3786, 3083, 1704, 742, -27, -748, -995, -1673, -2113,
-    -2217, -2268, -1745, -1882, -2485, -2484, -2675, -2981, -3222, -4088,
-    -4433, -4793, -5438, -5299, -5764, -5774, -5500, -6054, -5657, -5611,
-    -5396, -4887, -5441, -5071, -4394, -3680, -2406, -1842, -811, 913,
-    2424, 4085, 4973, 5643, 6493, 6999, 7357, 7205, 7099, 7038,
-    6846, 6960, 6761, 6667, 6493, 5896, 5217, 4190, 3425, 2576,
-    1261, 50, -657, -1081, -1145, -1140, -1547, -1595, -1599, -1691,
-    -1779, -2833, -3584, -4100, -4846, -4781, -5116, -5617, -5394, -5380,
-    -5174, -4984, -5405, -5595, -6052, -6344, -6079, -6032, -5929, -5196,
-    -4034, -2881, -1317, 131, 1293, 2458, 3201, 4296, 4834, 5006,
-    5787, 5883, 6162, 6777, 7158, 7630, 7590, 7175, 7088, 6744,
-    6075, 5378, 4105, 2954, 2446, 1912, 1231, 481, -341, -469,
-    -304, -750, -1004, -1464, -1781, -1645, -2374, -2895, -3443, -4079,
-    -4395, -5184, -5780, -5982, -5929, -6205, -6652, -6676, -6430, -5824,
-    -5703, -6279, -5998, -5184, -4333, -3597, -3694, -2657, -774, 595,
-    2009, 2281, 3443, 5507, 6130, 6563, 6437, 6745, 7978, 8011,
-    7157, 6584, 6584, 7260, 6716, 4758, 3852, 3994, 4085, 3140,
-    1399, 639, 1168, 1529, 622, -883, -1715, -824, -381, -1959,
-    -3286, -3473, -2397, -2255, -3663, -4713, -4842, -3877, -4098, -5905,
-    -7170, -7151, -6114, -6360, -7771, -7873, -6845, -5137, -4522, -5282,
-    -4409, -2744, -1107, -304, -766, 743, 2873, 4400, 5212, 4967,
-    6154, 7881, 8451, 7774, 6859, 7085, 7756, 7620, 6297, 5253,
-    5431, 5723, 5094, 3464, 2162, 1983, 1611, 444, -975, -1775,
-    -1251, -1064, -1660, -2201, -2211, -1299, -1284, -2432, -3685, -3940,
-    -3503, -4171, -5549, -6556, -6171, -5222, -5402, -6273, -6691, -6007,
-    -5090, -5228, -6100, -6158, -4842, -3294, -2898, -3111, -1787, 657,
-    2341, 2815, 3071, 4245, 6325, 7486, 6938, 6401, 6955, 8426,
-    8701, 7150, 6153, 6460, 7153, 6730, 4747, 3199, 3430, 3628,
-    2371, 501, -896, -574, -310, -1395, -2628, -3351, -2481, -1772,
-    -2783, -3800, -4044, -3349, -3147, -4528, -5489, -5514, -5027, -4756,
-    -5505, -5792, -5308, -4462, -3978, -4773, -4930, -4423, -3941, -3532,
-    -3735, -3107, -1880, -558, 918, 1689, 2723, 4157, 5037, 5675,
-    5868, 5896, 6207, 6250, 6336, 6458, 6384, 6624, 6764, 6656,
-    6231, 5359, 4757, 3993, 2541, 1143, 153, -686, -1083, -1535,
-    -2243, -2513, -2492, -2105, -2511, -3827, -4184, -4342, -4724, -5205,
-    -6149, -5987, -5217, -4958, -4649, -4666, -4043, -2853, -3053, -3527,
-    -3813, -3481, -2302, -2545, -3115, -2423, -774, 1161, 1736, 1535,
-    2329, 3882, 4705, 4458, 3707, 3348, 4439, 5186, 4746, 4531,
-    4951, 6242, 6657, 5480, 5121, 4914, 4350, 3762, 1795, 383,
-    339, 302, -75, -1294, -1963, -1437, -1098, -1747, -2837, -3937,
-    -4638, -4305, -4735, -5578, -5852, -5909, -4693, -4003, -4231, -3671,
-    -3530, -3205, -2471, -2822, -2757, -2261, -1777, -764, -679, -288,
-    1201, 2103, 2406, 2356, 2406, 3096, 3850, 3478, 2862, 2806,
-    3238, 4337, 4139, 3265, 3495, 3865, 4182, 3775, 2590, 2489,
-    2639, 1918, 1219, 380, 403, 652, -512, -1346, -1542, -1251,
-    -1011, -2089, -3242, -3294, -2554, -2502, -3939, -5137, -4589, -3636,
-    -3733, -4468, -4519, -3429, -2186, -1691, -2253, -2091, -655, 230,
-    -82, -870, -150, 1421, 1949, 1632, 1366, 2357, 3792, 4197,
-    3261, 2384, 2998, 3794, 3430, 2158, 1335, 2001, 2749, 2400,
-    1622, 916, 1269, 1682, 798, -15, -648, -647, -237, -737,
-    -1165, -1172, -814, -673, -1301, -1904, -2044, -2091, -2519, -2996,
-    -3320, -3230, -2632, -2175, -2227, -2260, -1905, -1232, -786, -1349,
-    -1618, -1148, -793, -136, 163, 230, 901, 1804, 2623, 2713,
-    2222, 2547, 3032, 2515, 2051, 1845, 1946, 2243, 1918, 1502,
-    1442, 1557, 1686, 1147, -142, -438, 132, -73, -811, -1601,
-    -1335, -530, -667, -1034, -1575, -1668, -941, -953, -1833, -2259,
-    -1769, -1105, -1142, -1557, -1580, -1090, -565, -721, -1316, -1582,
-    -1094, -561, -634, -598, -377, 322, 1276, 1450, 1362, 1352,
-    1525, 1647, 1468, 1224, 1008, 1190, 1581, 1953, 1940, 1749,
-    2132, 2195, 1683, 877, -81, -296, -571, -1134, -1483, -1987,
-    -1434, -223, -54, -529, -953, -547, -209, -928, -1871, -2687,
-    -2598, -1854, -1436, -1360, -1243, -238, 698, 729, 474, -14,
-    -156, -375, -1099, -1228, -884, -440, 175, 634, 1147, 1847,
-    2333, 2207, 1446, 846, 735, 624, 279, 184, 571, 957,
-    1738, 2367, 2138, 1929, 1257, 433, -7, -982, -1758, -2169,
-    -2335, -1448, -696, -459, -41, -2, 231, 149, -1000, -1770,
-    -2264, -2644, -2493, -2252, -1664, -482, 470, 877, 1377, 1603,
-    1567, 939, -603, -1251, -1101, -903, -808, -1253, -426, 1596,
-    2376, 2320, 1889, 1338, 1645, 1358, 66, -1031, -1163, -81,
-    405, 105, 780, 1957, 2261, 1903, 1045, 302, 407, -307,
-    -1735, -2512, -2264, -868, -262, -914, -869, 101, 882, 638,
-    -865, -1812, -1535, -1673, -1688, -1725, -1746, -337, 713, 789,
-    1284, 1595, 1660, 1104, -271, -405, -204, -686, -812, -1015,
-    -214, 1187, 1511, 1483, 1323, 1182, 1286, 678, -682, -1136,
-    -914, -1008, -1006, -670, 451, 1360, 1242, 1188, 1162, 963,
-    686, -456, -1667, -1785, -1514, -1125, -1147, -1106, 54, 973,
-    929, 451, 242, 282, -341, -1385, -1769, -1513, -1141, -456,
-    -144, 128, 1314, 2283, 2124, 1191, 739, 889, 279, -915,
-    -1225, -839, -527, -53, 159, 425, 1205, 1590, 1083, -50,
-    -737, -367, -576, -1865, -2163, -1493, -571, 242, 191, 348,
-    770, 992, 941, 27, -797, -812, -835, -1185, -1118, -528,
-    232, 659, 428, 587, 1137, 911, 174, -473, -867, -539,
-    -198, -164, 28, 195, 1186, 1928, 1416, 1244, 1121, 647,
-    166, -324, -297, -229, -578, -440, 88, 491, 799, 495,
-    -153, -551, -582, -580, -1268, -2188, -2030, -1092, -854, -671,
-    -274, -159, 232, 236, 165, 129, -465, -529, -570, -820,
-    -192, 297, 221, 148, 196, 1108, 1516, 504, 134, 299,
-    239, 492, 402, -50, 150, 615, 1013, 990, 512, 1076,
-    1301, 386, 363, 596, 691, 571, -311, -437, 132, 273,
-    185, -613, -1359, -628, 31, -550, -1458, -1782, -985, -435,
-    -1160, -1454, -1110, -857, -351, -547, -923, -332, 152, 213,
-    -352, -630, 470, 888, 106, -272, 92, 879, 1207, 597,
-    94, 397, 1012, 1187, 326, -362, 372, 924, 565, 177,
-    150, 928, 1371, 733, 359, 415, 839, 903, -215, -653,
-    -75, 230, 104, -513, -699, -16, 275, -304, -1099, -1251,
-    -699, -728, -1628, -1865, -1215, -677, -480, -716, -790, -76,
-    404, 145, -351, -541, 49, 298, -256, -227, 319, 682,
-    686, 486, 741, 977, 791, 496, 4, 0, 546, 411,
-    -236, -262, 455, 908, 522, 171, 347, 645, 700, 257,
-    -69, 217, 467, 291, -55, -203, 205, 546, -122, -867,
-    -613, -22, -157, -898, -1101, -692, -322, -127, -532, -1113,
-    -644, -2, -391, -840, -703, -303, 72, -3, -101, 252,
-    609, 687, 403, 123, 310, 380, 166, -70, -346, -43,
-    468, 245, 36, 262, 350, 432, 416, 48, -113, -12,
-    81, 138, -35, 113, 434, 503, 681, 495, 279, 514,
-    282, -52, -98, -372, -301, -51, -165, -290, -308, 0,
-    105, -409, -620, -574, -621, -488, -578, -774, -355, 110,
-    281, 282, 34, 149, 412, 128, -311, -521, -394, -33,
-    -27, -72, 202, 326, 613, 793, 136, -181, 15, -185,
-    -388, -586, -524, 63, 274, 561, 864, 612, 881, 1025,
-    487, 134, -321, -429, -127, -298, -242, 20, 164, 721,
-    998, 496, 3, -169, -142, -442, -1257, -1472, -981, -522,
-    -71, -62, -199, 560, 1150, 631, -240, -704, -347, -41,
-    -661, -1249, -874, 320, 1057, 540, 2, 441, 1033, 887,
-    -181, -1274, -833, 176, -93, -820, -667, 422, 1423, 1095,
-    241, 102, 749, 1203, 85, -1119, -676, 230, 624, 12,
-    -724, 76, 1280, 1142, -24, -691, -142, 390, -50, -1064,
-    -1449, -422, 467, -29, -755, -307, 631, 761, 235, -476,
-    -523, 371, 440, -588, -971, -326, 309, 216, -161, -274,
-    66, 638, 580, 15, -168, 91, 194, -124, -349, -452,
-    -332, -66, -86, 132, 420, 374, 688, 982, 643, 253,
-    138, 52, -249, -484, -663, -750, -235, 505, 552, 178,
-    538, 1124, 857, 304, -481, -1065, -717, -635, -998, -1113,
-    -697, 510, 1171, 929, 767, 726, 975, 602, -683, -1349,
-    -1236, -919, -676, -862, -603, 586, 1503, 1397, 720, 272,
-    418, 319, -714, -1704, -1776, -888, 6, -82, 46, 961,
-    1693, 2024, 1324, 192, 35, 48, -554, -1377, -1596, -656,
-    219, 377, 592, 920, 1351, 1596, 799, -405, -720, -695,
-    -900, -1233, -1402, -535, 586, 864, 963, 886, 912, 1033,
-    81, -935, -1244, -1315, -954, -994, -978, 87, 869, 1074,
-    991, 538, 402, 186, -603, -1246, -1374, -878, -251, -49,
-    385, 1194, 1582, 1545, 1135, 300, -50, -148, -812, -1159,
-    -807, -168, 532, 849, 1095, 1314, 1184, 973, 150, -843,
-    -999, -1192, -1400, -1086, -718, -104, 632, 903, 891, 595,
-    183, -126, -692, -1275, -1461, -1280, -690, -117, 195, 666,
-    937, 962, 971, 231, -650, -681, -732, -940, -761, -278,
-    371, 989, 1430, 1470, 1038, 836, 677, -93, -679, -708,
-    -598, -176, 343, 593, 984, 1213, 1104, 831, 48, -819,
-    -1194, -1332, -1446, -1587, -1250, -363, 273, 696, 767, 362,
-    230, 283, -303, -1285, -1711, -1285, -673, -409, -308, 186,
-    954, 1351, 1182, 624, 170, 19, -92, -446, -841, -501,
-    302, 547, 629, 930, 1245, 1276, 891, 422, -133, -369,
-    -167, -394, -708, -539, -150, 339, 383, 78, -115, -305,
-    -363, -438, -812, -1130, -1100, -695, -230, -174, -303, -121,
-    61, 30, 1, -377, -604, -354, -334, -257, -25, 167,
-    597, 695, 652, 794, 663, 647, 412, -95, -44, 85,
-    87, 274, 150, 101, 531, 692, 427, 77, -342, -483,
-    -409, -599, -886, -1203, -880, -10, -1, -210, -83, -245,
-    29, -5, -914, -1256, -1073, -665, -410, -632, -147, 709,
-    931, 898, 529, 343, 492, 34, -614, -748, -422, 418,
-    850, 444, 759, 1764, 1849, 1055, 104, -518, -543, -692,
-    -1006, -1286, -1210, -36, 830, 470, 349, 291, -36, -371,
-    -1303, -1920, -1811, -1739, -1412, -989, -497, 445, 815, 576,
-    282, -71, -34, -233, -1093, -1290, -622, 219, 944, 1053,
-    1103, 1641, 1955, 1598, 730, -141, -210, -39, -339, -437,
-    -12, 646, 1121, 924, 748, 905, 489, -198, -914, -1521,
-    -1393, -1203, -1498, -1623, -1249, -376, -95, -666, -792, -667,
-    -715, -816, -1260, -1570, -1263, -802, -569, -548, -188, 366,
-    684, 909, 1049, 1116, 1191, 1141, 972, 857, 779, 646,
-    581, 631, 654, 922, 1193, 1160, 1107, 1110, 947, 634,
-    365, -106, -846, -1002, -788, -1016, -1193, -1186, -1062, -846,
-    -904, -1205, -1582, -1817, -1829, -1983, -1971, -1745, -1588, -1098,
-    -634, -493, -80, 169, -194, -150, 229, 230, 257, 579,
-    997, 1409, 1733, 2088, 2051, 1856, 2033, 1578, 969, 1084,
-    973, 798, 877, 865, 1297, 1543, 1149, 817, 521, 174,
-    -359, -1200, -1711, -1876, -1999, -1972, -2181, -2274, -1706, -1521,
-    -1984, -2013, -1964, -1952, -1803, -2064, -1972, -1360, -1026, -702,
-    -545, -220, 441, 386, 413, 809, 968, 1512, 1753, 1553,
-    2120, 2646, 2569, 2246, 1914, 2020, 1965, 1514, 1344, 1313,
-    1437, 1825, 1681, 1227, 1220, 1046, 244, -554, -1282, -1797,
-    -2070, -2480, -2659, -2692, -2518, -1910, -1968, -2390, -2294, -2375,
-    -2323, -2368, -2853, -2677, -2034, -1341, -727, -828, -564, 495,
-    1040, 798, 319, 661, 1708, 2089, 2005, 2113, 2509, 3483,
-    3929, 2884, 1903, 2309, 2744, 1914, 942, 1025, 1877, 2493,
-    2151, 1308, 1028, 1353, 810, -1240, -2817, -2841, -2574, -2816,
-    -3503, -3573, -2292, -1270, -1632, -2506, -2893, -2749, -2935, -3529,
-    -3915, -3579, -2295, -1074, -565, 34, 855, 1417, 1444, 969,
-    506, 544, 1182, 1671, 1865, 2587, 3570, 4402, 4911, 4203,
-    3001, 2698, 2689, 1843, 621, 502, 1393, 2022, 2335, 2120,
-    1427, 1375, 1003, -908, -2863, -3571, -3690, -3956, -4281, -4019,
-    -2987, -1808, -1464, -2184, -2815, -2764, -2951, -3735, -4400, -4290,
-    -2947, -1136, -366, 48, 1279, 2190, 2210, 1811, 996, 616,
-    1122, 1677, 1902, 2333, 3724, 4976, 4938, 4712, 4154, 3162,
-    2866, 2129, 810, 646, 1330, 1996, 2206, 1926, 1571, 1054,
-    401, -1013, -3236, -4340, -4164, -4167, -4219, -3862, -3141, -2069,
-    -1417, -2172, -3301, -3536, -3684, -4231, -4559, -4051, -2530, -831,
-    461, 1206, 1628, 2410, 2356, 1136, 427, 206, 561, 1683,
-    2357, 3075, 4585, 5996, 6330, 5393, 4240, 3207, 2045, 1333,
-    607, -52, 835, 2337, 2755, 2639, 2485, 1571, -2, -1704,
-    -3740, -5366, -5644, -5333, -4964, -3980, -2458, -1346, -1048, -1315,
-    -2466, -3817, -4260, -4827, -5415, -4681, -3264, -1328, 1065, 2343,
-    2524, 2726, 2819, 1977, 622, -19, -70, 563, 2277, 3663,
-    4660, 6259, 7044, 6264, 5198, 4019, 2269, 905, 255, -324,
-    6, 1485, 2373, 2469, 2369, 1685, 354, -1267, -3178, -5307,
-    -6401, -5908, -5249, -4467, -3162, -2285, -1452, -814, -1728, -3271,
-    -4058, -4467, -4844, -4572, -3264, -1561, 326, 2051, 2653, 2745,
-    3034, 2490, 1063, 213, 462, 1376, 2714, 3900, 4742, 6128,
-    7319, 6789, 5133, 3404, 2054, 1182, 490, -4, 102, 1321,
-    2851, 2855, 2033, 1453, 80, -1966, -3943, -5575, -6144, -5719,
-    -5003, -4220, -3133, -1609, -779, -1332, -2505, -3621, -4080, -4053,
-    -4314, -4274, -2922, -638, 1269, 2267, 2436, 2153, 2207, 2116,
-    984, 57, 707, 2317, 3470, 4224, 5650, 6817, 6839, 5895,
-    3978, 2529, 2212, 1327, -111, -435, 959, 2737, 2986, 2028,
-    1094, 529, -362, -2704, -5162, -5848, -5560, -5220, -4546, -3623,
-    -2582, -1581, -1554, -2696, -3364, -3249, -3882, -4667, -4210, -2761,
-    -1105, 223, 881, 1017, 1432, 1840, 1059, 104, 192, 673,
-    1723, 3241, 4334, 5327, 6077, 5997, 5255, 4261, 3051, 1540,
-    476, 442, 808, 1503, 2379, 2564, 2438, 2147, 953, -987,
-    -2915, -4602, -5761, -5882, -5201, -4348, -3277, -2037, -1245, -1079,
-    -1447, -2445, -3771, -4669, -4821, -4489, -3480, -1953, -564, 715,
-    1956, 2551, 2105, 998, 34, -326, -99, 699, 1659, 3032,
-    5067, 6568, 6823, 6327, 5326, 3825, 1995, 342, -419, -113,
-    758, 1447, 2141, 3254, 3704, 2748, 572, -2081, -3919, -4793,
-    -5737, -6586, -6043, -3901, -1793, -792, -472, -754, -1205, -1800,
-    -3330, -4893, -4822, -3556, -2669, -2066, -528, 1371, 2259, 1936,
-    753, -14, 555, 1053, 592, 720, 2641, 4788, 5648, 5511,
-    4788, 4050, 3492, 2264, 706, 276, 921, 1570, 2024, 2792,
-    3110, 2484, 1317, -623, -2483, -3512, -4699, -5509, -4897, -3887,
-    -3005, -1749, -811, -1150, -1905, -2394, -3459, -4036, -3514, -3778,
-    -3986, -2045, 59, 359, 212, 164, -202, -34, 200, -839,
-    -1063, 1060, 3114, 3809, 4332, 4928, 5133, 4840, 3354, 1193,
-    740, 1489, 1136, 779, 1928, 3593, 4831, 4409, 2147, 538,
-    380, -908, -3818, -5584, -5218, -3801, -2252, -1697, -1916, -845,
-    561, -347, -2313, -3106, -3358, -3530, -3213, -2936, -2220, -233,
-    1205, 686, 174, 829, 959, 187, -523, -731, 285, 2408,
-    3595, 3360, 3652, 4923, 5464, 4436, 2786, 1729, 1729, 1918,
-    1681, 1676, 2327, 3225, 3511, 2791, 1842, 1244, 166, -1948,
-    -3640, -3683, -3232, -3233, -2896, -2043, -896, 236, 477, -568,
-    -1660, -1752, -2008, -3029, -3330, -2536, -1676, -954, -108, 797,
-    1251, 1214, 864, 244, 344, 1217, 1316, 708, 1160, 2864,
-    3728, 3086, 2523, 2453, 2470, 2748, 2341, 1363, 1688, 2910,
-    2618, 1192, 761, 699, -320, -1663, -2593, -2818, -2182, -1643,
-    -2086, -2520, -1522, -451, -1360, -3046, -3547, -2802, -2065, -2242,
-    -2345, -1641, -576, 305, 29, -1287, -1720, -1185, -1339, -2063,
-    -1312, 674, 1634, 1947, 2578, 2761, 2671, 2543, 1262, -295,
-    65, 1391, 1477, 1331, 2434, 3498, 3442, 2735, 1685, 321,
-    -836, -1476, -2252, -2693, -1952, -1187, -1391, -1328, -554, -559,
-    -1770, -2599, -2559, -2452, -2141, -1819, -1838, -1443, -524, -245,
-    -945, -1376, -959, -791, -1072, -632, 489, 1277, 1454, 1436,
-    1505, 1443, 1357, 1175, 521, 299, 1669, 2827, 2467, 2663,
-    3730, 3489, 2506, 2049, 996, -282, -298, -239, -903, -458,
-    698, 499, -36, 291, 72, -1086, -2064, -2669, -2789, -2288,
-    -1994, -1860, -1018, 58, 588, 714, 304, -203, -329, -936,
-    -2029, -1865, -706, -488, -557, 504, 1712, 2431, 2833, 2006,
-    766, 1050, 1509, 351, -656, -71, 948, 1757, 2140, 1846,
-    2032, 2496, 1797, 395, -613, -1031, -1004, -1348, -1928, -1492,
-    -214, 241, -445, -860, -776, -879, -1220, -2073, -3073, -2701,
-    -1277, -833, -1304, -1161, -554, -14, 468, 226, -388, -296,
-    -88, -247, -633, -1040, -892, -339, -307, -273, 796, 1899,
-    1881, 1778, 1699, 993, 881, 942, -436, -1388, -285, 636,
-    443, 848, 1456, 1266, 1315, 998, -669, -1895, -1898, -2014,
-    -2346, -2129, -1277, -459, 130, 615, 805, 532, -244, -1181,
-    -1662, -1681, -1277, -715, -650, -373, 1006, 1847, 909, 236,
-    492, 63, -286, 140, 126, 518, 1812, 2100, 1484, 1815,
-    2489, 1804, 367, 0, 581, 879, 628, 563, 972, 1621,
-    2140, 1416, -480, -1027, 100, 91, -1174, -1269, -320, 46,
-    227, 214, -802, -1353, -735, -1001, -1876, -1140, 336, 508,
-    188, 442, 772, 947, 800, -133, -947, -549, 419, 622,
-    28, -113, 718, 1493, 1338, 952, 1012, 1005, 985, 1082,
-    302, -598, -130, 422, 137, 331, 888, 813, 650, 636,
-    -11, -869, -1252, -1605, -2336, -2512, -1479, -480, -391, -238,
-    116, 156, 244, -225, -1692, -2493, -1849, -1143, -886, -394,
-    377, 954, 1157, 844, 99, -540, -836, -1204, -1402, -729,
-    223, 665, 956, 1169, 1248, 1136, 354, -671, -888, -551,
-    -430, -575, -636, -249, 513, 839, 482, 301, 390, 71,
-    -426, -617, -819, -944, -894, -1182, -1093, 162, 786, -18,
-    -392, -36, 97, 188, -117, -731, -494, 393, 810, 642,
-    680, 1136, 1167, 407, -205, -268, -442, -671, -505, -228,
-    357, 1263, 1518, 1048, 905, 1217, 816, -287, -623, -193,
-    48, 412, 846, 606, 531, 1034, 840, 59, -42, 81,
-    -298, -389, 140, 292, -171, -462, -329, -303, -82, 623,
-    722, 574, 1122, 1136, 153, -326, -268, -717, -1160, -639,
-    39, 464, 1013, 1253, 1002, 779, 441, -331, -929, -898,
-    -276, 238, 71, 275, 1279, 1251, 379, 131, -509, -1397,
-    -638, 119, -534, -162, 966, 483, -320, 155, -11, -1143,
-    -1118, -871, -1370, -744, 225, -450, -1102, -456, -150, -479,
-    -258, 109, 527, 873, 627, 403, 29, -960, -1297, -1126,
-    -1505, -828, 605, 319, 211, 1861, 1742, -161, -459, -228,
-    -1148, -921, 93, -454, -466, 1058, 991, -363, -69, 218,
-    -1122, -1538, -732, -397, 205, 810, 515, 53, 123, 314,
-    -390, -1693, -1868, -801, -246, 78, 966, 1420, 1430, 1592,
-    981, -473, -1103, -688, -1150, -1898, -822, 662, 1134, 1633,
-    1961, 1338, 1039, 812, -581, -1797, -1676, -992, -655, -515,
-    392, 1405, 1569, 1683, 1367, 114, -533, -175, -599, -1124,
-    -335, 520, 660, 855, 1044, 581, 219, 382, -216, -1021,
-    -339, 564, 510, 316, 415, 491, 681, 554, -15, -44,
-    382, 614, 274, -367, -374, -41, -487, -1277, -1311, -520,
-    187, 610, 804, 860, 1163, 1217, 216, -1002, -845, -447,
-    -935, -1015, -300, 488, 1317, 1470, 502, -157, 184, -62,
-    -967, -1121, -525, 361, 880, 957, 987, 981, 661, -128,
-    -1241, -1774, -1201, -666, -694, -208, 597, 993, 1089, 698,
-    9, -667, -864, -809, -1176, -1300, -417, 267, 258, 600,
-    611, 8, 200, 437, -425, -1070, -761, -435, -653, -395,
-    79, 16, 520, 1351, 891, 265, 856, 695, -647, -1323,
-    -1459, -1532, -1070, -535, -230, 361, 1660, 2320, 1340, 292,
-    47, -358, -1287, -1868, -1535, -285, 790, 1264, 1617, 1370,
-    940, 712, -739, -1980, -1229, -698, -985, -68, 1489, 1712,
-    1356, 998, 189, -456, -265, -243, -851, -305, 991, 692,
-    105, 530, 141, -1011, -1465, -1141, -373, 768, 1338, 1397,
-    1691, 2035, 1715, 75, -1648, -1791, -1189, -1241, -1033, 417,
-    1897, 2365, 2377, 1607, 514, 144, -569, -2325, -2783, -883,
-    429, 279, 536, 1439, 1967, 1725, 382, -1354, -1708, -834,
-    -870, -1456, -883, 631, 1638, 1229, 588, 775, 816, -393,
-    -1480, -1540, -1093, -118, 552, 116, 466, 2132, 2356, 721,
-    -9, 72, -704, -941, -758, -1097, -502, 877, 865, 346,
-    803, 866, 127, -463, -885, -1069, -944, -875, -797, -503,
-    215, 648, 600, 445, 359, 346, -22, -889, -1386, -1138,
-    -1149, -907, -20, 485, 932, 1569, 1357, 1036, 696, -263,
-    -1039, -1200, -990, -381, 421, 961, 1588, 1945, 1622, 799,
-    -255, -1164, -1794, -2058, -1390, -536, 149, 1233, 1999, 1975,
-    1581, 800, -504, -1289, -1562, -1827, -1758, -971, -70, 198,
-    513, 1263, 1053, 123, -50, -173, -595, -558, -235, -464,
-    -206, 674, 789, 454, 763, 962, 148, -573, -522, -613,
-    -1090, -1161, -735, 131, 1082, 1795, 1754, 1553, 1776, 1293,
-    -533, -1939, -1880, -1782, -1768, -912, 368, 1478, 2406, 2422,
-    1459, 238, -629, -1684, -2811, -2914, -1700, -67, 981, 1836,
-    2540, 2597, 1914, 584, -1244, -2457, -2490, -2001, -1762, -1295,
-    -173, 913, 1178, 836, 655, 565, 707, 701, 462, 665,
-    1017, 363, -771, -1326, -1207, -1037, -1159, -780, 847, 2384,
-    2466, 2058, 1372, 483, -658, -2176, -3032, -2290, -828, 271,
-    1048, 2418, 3924, 3301, 767, -1041, -1760, -2693, -3457, -3853,
-    -2984, -469, 1543, 1699, 1609, 2314, 2317, 640, -1138, -1343,
-    -1078, -1478, -1791, -1369, -488, 616, 741, 159, 448, 1638,
-    1994, 793, 38, 353, -88, -1420, -1988, -1700, -908, 13,
-    716, 1629, 3084, 3386, 2138, 723, -401, -1428, -2561, -3488,
-    -3660, -2442, -557, 635, 1273, 2305, 2890, 2534, 1708, 258,
-    -1375, -1887, -2257, -3244, -3050, -1643, -173, 776, 1311, 1834,
-    2505, 2403, 923, -900, -1432, -944, -1067, -1920, -1561, 365,
-    1583, 1309, 659, 1081, 1790, 1150, -389, -787, 97, 218,
-    -1196, -2148, -1151, 149, -208, -1153, -345, 1710, 2542, 1240,
-    258, 653, 741, -603, -2342, -2718, -1344, -48, -617, -873,
-    1288, 2756, 1252, -346, -506, -240, -340, -962, -1535, -388,
-    1765, 2129, 1067, 687, 1086, 740, -697, -1968, -1847, -818,
-    -228, -565, -533, 364, 989, 395, -821, -1241, -307, 707,
-    105, -493, 348, 1070, 340, -1091, -2053, -1898, -1200, -885,
-    -937, -93, 1831, 2839, 1711, 26, -92, 28, -1129, -2321,
-    -1826, 1, 1879, 2740, 2477, 2497, 3244, 2474, -208, -1982,
-    -1941, -1522, -1704, -1890, -1263, 452, 1536, 807, -264, -225,
-    345, -26, -953, -972, -314, -168, -706, -1544, -1949, -2195,
-    -2525, -2536, -1769, -655, 449, 1408, 1758, 1800, 1375, 306,
-    -592, -1002, -1568, -1506, -121, 1605, 2654, 3317, 3695, 3737,
-    3206, 1695, -46, -1145, -1243, -998, -833, -274, 932, 1725,
-    1462, 1042, 916, 408, -504, -1428, -1930, -1948, -2196, -2335,
-    -2344, -2556, -2387, -1529, -996, -1136, -1351, -1457, -1477, -1652,
-    -2026, -2096, -1471, -169, 1103, 1665, 2314, 2771, 2017, 723,
-    67, -168, -332, -48, 965, 2641, 4156, 4729, 4527, 4021,
-    3247, 1647, -429, -1120, -816, -1022, -1332, -541, 1219, 2166,
-    1105, -616, -1328, -1580, -2600, -4400, -5068, -3448, -1813, -1948,
-    -2077, -1470, -1002, -1613, -3280, -3928, -2625, -1089, -495, -216,
-    667, 2465, 3059, 1129, -895, -986, -334, -53, 162, 1514,
-    4006, 6227, 7265, 6642, 5620, 5007, 3153, -114, -2082, -2363,
-    -2094, -1455, -603, 964, 3439, 4740, 3666, 1558, -401, -2264,
-    -4937, -7251, -7396, -5809, -3927, -2318, -821, 819, 1393, -567,
-    -3439, -5079, -5264, -4881, -4748, -3912, -793, 2797, 4328, 3545,
-    2138, 1997, 1822, -47, -1623, -527, 2149, 4171, 4569, 4856,
-    6389, 7201, 5396, 2492, 969, 1079, 617, -1137, -1912, -848,
-    1134, 2215, 1556, 1243, 1876, 587, -2423, -4306, -5163, -5787,
-    -6118, -5925, -4244, -1894, -1183, -1668, -1738, -1641, -2700, -4293,
-    -4431, -3466, -2679, -1623, 20, 1795, 3337, 3243, 1737, 1265,
-    1370, 697, 458, 1286, 3051, 5362, 6857, 7249, 7241, 6338,
-    4109, 1527, -471, -1874, -2701, -2317, -573, 1520, 3356, 4235,
-    3594, 2330, -4, -3539, -6063, -6869, -7166, -6839, -5340, -3033,
-    -1091, -562, -896, -1590, -2997, -4156, -4324, -4488, -4147, -2766,
-    -731, 1476, 2929, 3225, 2895, 2317, 1662, 888, 66, 655,
-    2575, 4109, 5433, 6916, 7374, 7039, 5713, 3262, 1269, 20,
-    -1003, -1545, -1234, -51, 1666, 2652, 2853, 2482, 834, -1635,
-    -3664, -5096, -6077, -6712, -6424, -4767, -3121, -2076, -1703, -1950,
-    -2243, -2664, -3589, -4122, -3892, -3431, -2515, -1036, 680, 2122,
-    2865, 3037, 2678, 1849, 1670, 1795, 1773, 2558, 3881, 5176,
-    6443, 6857, 6086, 5100, 3660, 1700, 231, -887, -1817, -1516,
-    -220, 1067, 2095, 2772, 2312, 387, -1714, -3605, -5726, -6981,
-    -6807, -6182, -4662, -2488, -1712, -1725, -1384, -2218, -3590, -3987,
-    -4130, -4070, -3365, -2183, -294, 1859, 3324, 3896, 3706, 3046,
-    2062, 1355, 1040, 710, 1604, 4354, 6284, 7099, 7914, 7113,
-    5048, 3027, 432, -1948, -2806, -2720, -1568, 328, 2172, 3339,
-    3351, 2243, -61, -3260, -5459, -6105, -6566, -6435, -5397, -3446,
-    -1384, -1021, -2147, -2926, -3552, -3907, -4031, -4408, -3372, -984,
-    840, 2260, 3792, 4268, 3857, 2694, 1022, -40, -71, 474,
-    1666, 3859, 6193, 7273, 7199, 7127, 5950, 3393, 874, -891,
-    -1598, -1597, -2091, -1585, 1033, 2669, 2434, 1744, 445, -1402,
-    -3207, -5602, -7355, -6832, -4857, -3336, -2653, -1585, -648, -1299,
-    -2899, -4026, -4472, -3461, -2127, -1927, -866, 1551, 2874, 3135,
-    3163, 2677, 2407, 2112, 1695, 1323, 1205, 2331, 3821, 4318,
-    5452, 6492, 5947, 5091, 2887, 8, -1099, -2084, -3216, -2432,
-    -667, 1358, 2741, 2698, 1838, -161, -2613, -4664, -6637, -6852,
-    -5583, -5152, -3707, -1627, -1472, -1118, -646, -1956, -2439, -1842,
-    -2003, -2098, -1701, -477, 1283, 2314, 2956, 3377, 3423, 2789,
-    750, -373, 800, 1699, 2502, 4464, 6001, 6994, 7009, 4738,
-    2161, 615, -1345, -3350, -3926, -2795, -625, 1004, 1558, 2172,
-    2787, 1570, -1656, -4964, -6100, -5915, -6427, -5980, -3356, -428,
-    1485, 1270, -125, -972, -2754, -4522, -4690, -4292, -2260, 955,
-    2579, 4036, 5635, 5134, 3087, 609, -868, -702, -494, 726,
-    3646, 5878, 7225, 7267, 5735, 3889, 665, -2761, -4113, -4422,
-    -2771, 366, 1948, 3526, 4606, 2934, 480, -2530, -5640, -6545,
-    -6063, -4864, -3164, -1054, 1552, 1194, -1430, -2263, -2997, -4280,
-    -4168, -3508, -1672, 1331, 2626, 2352, 2092, 2156, 1832, 138,
-    -848, 93, 753, 1227, 2128, 3411, 5524, 6472, 5599, 4786,
-    3340, 549, -2057, -4046, -4652, -2930, -645, 1386, 3513, 4487,
-    3552, 666, -1928, -3085, -4683, -5248, -3855, -2508, -895, -43,
-    -1221, -2158, -2254, -3116, -4033, -3114, -1533, -116, 1389, 2632,
-    3228, 2677, 1301, -503, -2163, -1838, -788, -228, 1719, 3791,
-    5334, 6645, 5863, 3838, 2481, 243, -2176, -3074, -3262, -2213,
-    -266, 1297, 2285, 2369, 2495, 2381, -140, -2142, -2247, -2276,
-    -1856, -2067, -2895, -2475, -2499, -3751, -3462, -2237, -1195, 271,
-    1276, 1597, 1934, 1322, 497, -475, -1662, -1395, -1129, -641,
-    789, 1417, 2549, 3952, 3498, 3466, 3547, 2357, 1678, 1080,
-    -56, -1099, -1977, -1673, -301, 53, 547, 1589, 1987, 2251,
-    1128, -1049, -1645, -1671, -2034, -2225, -2245, -817, -422, -2401,
-    -3488, -3347, -3019, -2006, -1319, -243, 2309, 4051, 3906, 2351,
-    604, -137, -1361, -2930, -2508, -1364, 317, 2182, 2748, 3785,
-    4413, 3154, 1776, 348, -586, -734, -1218, -345, 924, 931,
-    969, 767, 555, 5, -1843, -2518, -1420, -459, 473, 539,
-    46, -25, -1013, -3023, -4271, -4057, -2777, -1688, -695, 1371,
-    3069, 3481, 2973, 1329, -90, -378, -878, -1313, -1263, -217,
-    1936, 2834, 2487, 2418, 2334, 2026, 544, -1796, -2497, -1873,
-    -753, 537, 1327, 2826, 4123, 3192, 1238, -478, -1416, -2335,
-    -3805, -3479, -2273, -1405, -487, -996, -1425, -1143, -1621, -1391,
-    -633, -48, 340, 163, 873, 1150, 516, 764, 539, -110,
-    126, 256, 198, 353, 1044, 2360, 2479, 1504, 1320, 672,
-    -1481, -3375, -3894, -2130, 634, 2447, 4472, 5773, 5357, 3979,
-    593, -3136, -4785, -5107, -3835, -2728, -2524, -433, 1246, 385,
-    -816, -1672, -769, 562, -923, -1455, 345, 1688, 2101, 1131,
-    784, 2003, 1889, 739, -662, -1630, -374, 531, 175, 1098,
-    2065, 1847, 1221, -561, -2063, -2040, -1693, -109, 1924, 3174,
-    4545, 4213, 2195, 605, -1887, -3731, -3783, -4187, -3256, -1437,
-    -1273, -626, 328, -259, -637, -633, -212, 374, -360, -819,
-    -555, -367, 1007, 1688, 1217, 1985, 2062, 959, 107, -467,
-    309, 1031, 115, -302, -372, -895, -1483, -2895, -3006, -744,
-    1332, 2895, 4427, 5238, 4972, 3152, 868, -1018, -2738, -3657,
-    -4142, -4573, -4271, -3052, -1952, -1281, -118, 1298, 2231, 2734,
-    2495, 1710, 692, -47, -134, -642, -1057, -89, 1375, 1832,
-    1413, 887, 866, 1536, 981, -694, -915, -968, -1951, -2975,
-    -3432, -1048, 1878, 2459, 3282, 4601, 5100, 3829, 754, -1114,
-    -2037, -3272, -3635, -4043, -3624, -2240, -2420, -2006, -467, -409,
-    -71, 983, 1491, 1687, 1346, 1468, 1556, 732, 260, -255,
-    -421, 301, 316, 146, 799, 1296, 1193, 392, -1186, -2275,
-    -2358, -2688, -2674, -1348, 1144, 3508, 3826, 4134, 4832, 3151,
-    775, -1310, -3169, -3325, -3215, -3058, -2387, -2066, -1423, -728,
-    -80, 426, 20, 297, 923, 193, -618, -418, 987, 2465,
-    2332, 2003, 2502, 2291, 1084, -452, -1581, -971, 29, -457,
-    -1043, -903, -947, -1301, -1962, -1566, 676, 2549, 3435, 3929,
-    3562, 2629, 875, -1037, -1519, -2107, -3300, -3385, -2402, -1450,
-    -1585, -2449, -1811, -295, -281, -893, -291, 1387, 2233, 1178,
-    303, 958, 2238, 2847, 1539, 83, 475, 809, -90, -1480,
-    -1880, -694, -492, -1831, -2621, -2603, -1084, 564, 517, 1847,
-    4658, 5620, 4761, 2665, 3, -1643, -2652, -3718, -4561, -3719,
-    -1722, -745, -254, -313, -897, -97, 366, -606, -771, -5,
-    1111, 1930, 2013, 2433, 2888, 2494, 1771, 450, -764, -594,
-    -679, -974, -414, -378, -583, -708, -1749, -2526, -2186, -664,
-    1333, 2656, 4185, 4874, 3933, 2709, 777, -1558, -2974, -3584,
-    -2998, -2464, -2940, -2814, -2146, -1502, -841, -573, 774, 2485,
-    2007, 827, -28, 146, 1063, 754, 884, 2073, 2832, 2743,
-    1046, -1085, -2028, -2147, -2463, -3001, -2364, -1051, -99, -24,
-    -617, 278, 1772, 2489, 3180, 3568, 3122, 1787, 156, -1479,
-    -3509, -4560, -4285, -2921, -1553, -1640, -662, 1045, 996, 60,
-    -895, -557, 1266, 1687, 694, 812, 2090, 2752, 2336, 1173,
-    641, 1666, 1293, -1160, -1845, -419, -164, -1298, -2025, -1705,
-    -801, -1168, -2128, -986, 1585, 3318, 4006, 4426, 4735, 3907,
-    987, -2786, -4786, -4984, -4913, -4733, -3711, -1000, 1458, 1470,
-    691, 876, 1116, 253, -996, -952, 517, 2133, 3073, 3293,
-    2763, 2370, 2144, 301, -1839, -2398, -2451, -1848, -1452, -1744,
-    -877, -145, -937, -1590, -883, 837, 2433, 3680, 4186, 3710,
-    2899, 943, -1806, -3875, -4532, -3799, -3534, -3474, -1355, 690,
-    356, -576, -701, 20, 755, 464, 778, 2784, 3762, 2552,
-    820, 398, 1309, 947, -302, -564, 65, 1566, 1101, -1534,
-    -1706, -944, -1952, -3223, -3403, -1345, 1129, 1694, 2039, 3590,
-    5421, 5047, 2283, -34, -1614, -2957, -4316, -5788, -5007, -2143,
-    -596, -333, -332, 3, 1227, 929, -449, 365, 1465, 1622,
-    1726, 1376, 1546, 2144, 1894, 792, 137, 130, -298, -727,
-    -1583, -2407, -1668, -1497, -2147, -2040, -1362, -92, 1052, 2017,
-    3299, 3912, 3267, 1911, 697, -616, -1831, -2416, -3421, -3287,
-    -2090, -2099, -1846, -1472, -902, 713, 1215, 850, 1179, 1601,
-    1241, 321, 252, 968, 1992, 2630, 2058, 1939, 1913, 644,
-    -260, -1375, -2697, -1766, -1448, -2359, -1548, -1118, -625, 841,
-    979, 1169, 2664, 3650, 3334, 2838, 1545, -561, -1437, -2628,
-    -4086, -3598, -2804, -1971, -942, -211, 573, 849, 887, 101,
-    -671, -10, 419, 1284, 2280, 1994, 2327, 2609, 1805, 242,
-    -1007, -855, -899, -865, -1101, -1767, -1049, -1173, -1990, -1887,
-    -1474, 314, 1772, 2011, 2531, 3023, 3138, 1924, -431, -1841,
-    -2197, -2717, -3320, -3211, -1872, -417, -78, 5, 215, 31,
-    -142, -529, -765, -123, 726, 1341, 1960, 3375, 3733, 2214,
-    980, -359, -931, -724, -2365, -2976, -993, -95, -708, -1453,
-    -1823, -657, 1167, 925, 1349, 4114, 4941, 3598, 685, -2677,
-    -2920, -2306, -3002, -3042, -1428, 833, 1206, 9, -1519, -1874,
-    19, 199, -921, -142, 1112, 2603, 2465, 605, 432, 1103,
-    1380, 251, -738, 514, 1130, 343, -738, -1553, -1247, -807,
-    -1751, -2605, -1432, 227, 1236, 1836, 2176, 3014, 3485, 2388,
-    178, -1064, -1457, -2188, -2489, -2661, -1686, -673, -734, -340,
-    -780, -860, 8, 87, 336, 794, 1489, 1823, 1464, 1325,
-    818, 1136, 1671, 792, 596, 502, -758, -1662, -1767, -1500,
-    -1969, -2216, -1466, -954, 821, 1660, 1383, 3250, 4046, 2924,
-    1198, -499, -1146, -1375, -1432, -2345, -2064, -358, -436, -1034,
-    -1812, -2014, -1217, -541, 36, 224, 1372, 2339, 1685, 881,
-    448, 538, 1505, 2380, 1581, 501, -51, -706, -1573, -3089,
-    -3363, -2075, -541, -8, -1005, -502, 802, 1175, 1370, 1443,
-    2629, 3286, 1730, -20, -1346, -1878, -1847, -2507, -2464, -1580,
-    -685, -587, -1619, -1409, -733, -279, 530, 402, 944, 1833,
-    1792, 1390, 893, 1151, 1053, 1559, 1640, -86, -210, -346,
-    -1331, -2089, -3254, -2706, -990, -592, -772, 378, 2437, 3388,
-    2872, 1554, 994, 1426, 429, -1432, -1971, -1525, -1010, -995,
-    -1543, -989, 11, -502, -1283, -1412, -559, 28, -509, 529,
-    1691, 1550, 1792, 1087, 1172, 2273, 1168, 281, 709, 856,
-    198, -818, -1231, -2160, -1975, -1818, -3425, -1883, 465, 1150,
-    2809, 3020, 2734, 3180, 1824, -250, -1583, -1947, -1865, -1939,
-    -1554, -1108, -54, 487, -950, -2080, -2383, -1705, -915, -888,
-    762, 2814, 3372, 2402, 466, 349, 921, 269, -141, 73,
-    887, 1706, 337, -1991, -2400, -2557, -2739, -2238, -1528, 572,
-    2836, 3185, 2027, 1690, 1343, 266, -12, -1193, -1529, -373,
-    -173, -131, -596, -1040, -1313, -2081, -2476, -2352, -1370, -256,
-    516, 1307, 1485, 921, 589, 922, 1401, 1277, 735, 1478,
-    1912, 1208, 449, -1387, -2187, -2633, -3323, -2986, -2791, -907,
-    1598, 2652, 2419, 2308, 2965, 2102, 590, -1227, -1863, -474,
-    -520, -1420, -1066, -120, -213, -598, -1695, -2945, -1457, -175,
-    -266, 63, 1107, 2148, 1388, -32, -1054, -463, 1054, 1289,
-    1553, 2383, 2888, 2068, 228, -2072, -3424, -3092, -2754, -2062,
-    -1324, 513, 2708, 1992, 899, 1161, 1183, 935, 803, -73,
-    117, 1085, -200, -954, -799, -1230, -1387, -1631, -1802, -1651,
-    -533, -325, -769, 432, 1019, 1129, 1103, 997, 1760, 1504,
-    606, 317, 664, 1383, 1341, -5, -1193, -813, -869, -2103,
-    -2769, -2227, -488, 1348, 892, -26, 1997, 2982, 1463, 389,
-    -661, -571, 74, -831, -1330, -485, 316, 519, -257, -1662,
-    -2370, -2077, -1399, -1248, -803, 550, 1509, 2138, 1757, 657,
-    681, 1147, 1548, 1562, 814, 512, 1012, 13, -2398, -2997,
-    -2389, -1538, -537, -517, 322, 2110, 2058, 976, 953, 1226,
-    1084, 235, -1040, -1308, -430, -206, -1406, -1209, 149, 424,
-    -137, -1170, -705, 360, -17, -1187, -1614, -163, 711, 402,
-    104, 20, 1169, 2068, 1307, 922, 1835, 2203, 1596, -165,
-    -2099, -2021, -1933, -2762, -2929, -1194, 1145, 1762, 2135, 1748,
-    1347, 1755, -122, -1566, -287, 634, 626, 333, -590, -323,
-    164, -1588, -2321, -1243, -189, 204, -399, -468, 381, 868,
-    62, -287, 146, 599, 1725, 1849, 1661, 1923, 1903, 1531,
-    -48, -1661, -2464, -2086, -1523, -1986, -1677, -424, 893, 1306,
-    944, 1029, 1420, 1777, 1321, 339, -59, 340, 69, -945,
-    -1011, -917, -804, -849, -1570, -1705, -780, -331, -701, 482,
-    1667, 1445, 1449, 903, 566, 1054, 690, 377, 1080, 959,
-    -98, -986, -1472, -1376, -1615, -1556, -674, 331, 1158, 759,
-    628, 1063, 543, 47, -592, -834, -160, -192, -619, -397,
-    32, 183, 323, -12, -423, 133, 352, -364, -705, -746,
-    -774, -299, -377, -656, 70, 1030, 1644, 1575, 1478, 1507,
-    1359, 1012, -126, -902, -513, -343, -1094, -1405, -1043, -429,
-    290, 47, 123, 631, 489, 359, -333, -662, 101, 354,
-    2, 61, 153, 174, 521, -175, -490, 440, 151, -991,
-    -1639, -922, -335, -597, -481, -375, 842, 1834, 1076, 1034,
-    2238, 2596, 1867, 745, -567, -646, -1019, -2112, -2381, -1850,
-    -136, 284, -347, -121, 457, 994, 504, 72, 417, 1318,
-    1214, -454, -1021, -767, -527, -777, -1076, -260, 298, -151,
-    -935, -670, 131, 587, 490, 130, 902, 855, 15, -55,
-    182, 796, 962, 975, 992, 1149, 780, -439, -868, -1184,
-    -1270, -991, -435, 543, 924, 820, 284, 65, -160, -887,
-    -1005, -582, 406, 1093, 798, 574, 770, 399, -663, -1400,
-    -1413, 20, 786, -61, 145, 513, 258, -674, -1598, -677,
-    855, 1241, 545, 1133, 2198, 1482, 338, -573, -316, 256,
-    -654, -1558, -973, 268, 348, -623, -1402, -965, -66, -360,
-    -1122, -826, 978, 2117, 1555, 785, 472, 1086, 904, -676,
-    -1534, -1472, -866, -532, -955, -1116, -597, 352, 1049, 852,
-    509, 1174, 1889, 2159, 1724, 244, 60, 588, -331, -1778,
-    -2797, -2477, -543, 921, 938, 883, 1144, 1452, 855, -1019,
-    -1873, -1254, -77, 1121, 776, 38, 338, 825, 623, -609,
-    -1309, -755, 734, 1686, 302, -802, 250, 1223, 420, -905,
-    -936, 547, 1882, 1370, 323, 288, 778, 571, -638, -1573,
-    -1673, -1193, 232, 1294, 561, 119, 968, 963, 209, -801,
-    -1817, -875, 268, -562, -1614, -1344, -249, 518, 412, -87,
-    515, 1929, 2089, 648, -704, -290, 683, 159, -1010, -987,
-    236, 890, 121, -816, -324, 799, 607, -134, 201, 1005,
-    872, 297, 263, 610, 961, 355, -558, -511, -393, -912,
-    -1716, -1669, -637, -50, -218, -134, 728, 1769, 1684, 438,
-    151, 1140, 860, -524, -888, -230, 520, 323, -891, -890,
-    607, 777, 118, 391, 859, 1083, 978, 421, 70, 167,
-    -74, -661, -399, -52, -707, -340, 720, 644, 162, -308,
-    -215, 508, -52, -1721, -1744, -229, 502, -4, -404, 572,
-    1808, 1252, -495, -1000, -173, 106, -421, -836, -389, 862,
-    1468, 757, 741, 1277, 469, -24, -103, -1182, -1082, -288,
-    -668, -413, 253, -264, -266, 827, 687, 429, 998, 563,
-    445, 831, -411, -1583, -1243, -1020, -833, -424, -408, 127,
-    754, 446, 243, 501, 817, 1300, 1551, 886, 153, -71,
-    -518, -475, -286, -677, 35, 1273, 972, 154, 49, 2,
-    98, -294, -1283, -911, 124, 155, -381, -32, 864, 806,
-    419, 183, -32, -62, -637, -1561, -1166, -167, -275, -36,
-    277, -79, 339, 109, -466, 355, 1092, 908, 682, 580,
-    427, 420, -36, -650, -273, 247, -174, -440, 191, 463,
-    -46, -670, -725, -83, -240, -1018, -586, 832, 1316, 70,
-    -1154, -658, 632, -3, -1724, -1131, 633, 1378, 881, -285,
-    -289, 630, 266, -1369, -1800, -511, 507, 551, 357, 273,
-    929, 1982, 1329, 230, 746, 1121, 810, 586, -247, -1215,
-    -1364, -1482, -2099, -2353, -1946, -639, 1318, 2259, 1742, 1060,
-    1197, 1240, 97, -1519, -1744, -506, -127, -1174, -1869, -1193,
-    -11, 264, -545, -287, 1745, 2069, 516, 116, 329, 368,
-    265, -530, -510, 935, 943, -330, -6, 847, 583, -158,
-    -1125, -1260, -481, -1059, -2065, -1044, 693, 1286, 726, -128,
-    -35, 511, -61, -1118, -830, 379, 839, 208, -661, -628,
-    30, -378, -1477, -1255, 124, 838, 429, 343, 957, 1410,
-    1193, 386, 72, 409, 307, -32, -53, -54, -126, -242,
-    -628, -1027, -1039, -1289, -1164, -188, 292, 684, 1015, 308,
-    -86, 34, -709, -1097, -535, -349, 56, 520, -99, -361,
-    108, 23, -239, -59, 313, 407, 60, -111, 13, -96,
-    -227, -157, 278, 1183, 1634, 1422, 1317, 1032, 72, -1172,
-    -1915, -2234, -2380, -1767, -690, 288, 1322, 1715, 923, 147,
-    -24, -670, -1702, -1597, -593, 417, 1496, 1468, 323, 186,
-    219, -1014, -1790, -1402, -590, 512, 1062, 922, 1278, 1671,
-    766, -533, -553, 57, 87, -141, 130, 712, 759, 170,
-    -622, -1062, -834, -706, -1105, -1149, -454, -32, -369, -421,
-    6, 393, 580, 220, 7, 657, 806, -448, -1282, -526,
-    90, -222, -378, -118, 775, 1265, -58, -779, 277, 785,
-    307, -109, 613, 2035, 1779, 208, -410, -357, -854, -1821,
-    -2313, -1320, 367, 918, 459, 387, 952, 902, -408, -1736,
-    -1641, -549, -178, -794, -831, 601, 1754, 956, -226, -34,
-    838, 709, -303, -672, -141, 395, -33, -667, -107, 976,
-    1111, 160, -37, 1043, 1258, 144, -485, -407, -365, -540,
-    -1589, -1855, -238, 563, 181, 157, 652, 786, -182, -1453,
-    -1905, -1037, -226, -552, -456, 944, 1989, 997, -432, -601,
-    -203, 147, -30, -291, 387, 1328, 1064, 108, -186, 56,
-    297, 67, -4, 549, 685, 252, -289, -633, -686, -763,
-    -882, -201, 954, 864, 524, 651, 18, -909, -1604, -1855,
-    -1406, -590, 112, 614, 1202, 1325, 674, -159, -561, -495,
-    -210, 347, 766, 955, 1166, 939, -142, -1121, -1047, -705,
-    -144, 693, 1335, 2133, 2212, 902, -617, -1591, -2405, -2950,
-    -2352, -647, 975, 1450, 1553, 1798, 1186, -56, -1260, -1885,
-    -1713, -1433, -1079, -435, 146, 497, 664, 570, 520, 290,
-    -201, 127, 634, 619, 769, 642, 215, 172, 46, -684,
-    -986, -328, 395, 886, 970, 823, 596, -64, -822, -1521,
-    -1584, -610, 155, 423, 940, 1073, 357, -306, -804, -1299,
-    -1344, -913, -330, 35, 399, 858, 1116, 1197, 812, 138,
-    -158, -256, -715, -1055, -547, 178, 807, 1405, 1324, 598,
-    149, 414, 469, -17, -150, 138, 497, 257, -963, -2024,
-    -1954, -1212, -764, -441, 501, 1487, 1805, 1615, 630, -571,
-    -808, -1203, -1950, -1712, -1162, -459, 471, 587, 506, 1042,
-    1367, 918, 196, -286, -182, 289, 300, -49, -409, -468,
-    -58, -28, -298, -85, 645, 1552, 1590, 346, -777, -1082,
-    -1215, -1264, -1297, -876, 355, 1040, 788, 173, -371, -96,
-    265, -274, -735, -221, 435, 447, -134, -517, 176, 875,
-    659, 169, -58, 211, 209, -505, -789, -59, 888, 1195,
-    838, 604, 874, 783, -27, -896, -875, -1, -10, -918,
-    -1202, -667, -122, -311, -599, -67, 977, 1327, 521, -15,
-    364, 265, -929, -1889, -1909, -1267, -311, 158, 542, 1514,
-    2321, 2034, 536, -1028, -1417, -874, -576, -480, 17, 796,
-    1334, 536, -723, -775, -290, 94, 482, 877, 1121, 829,
-    -75, -1117, -1843, -2050, -1466, -583, 280, 1029, 1157, 1262,
-    1098, -114, -1091, -1053, -706, -330, -181, -61, 860, 1389,
-    732, 221, -93, -210, -92, -403, -369, 363, 846, 852,
-    601, 169, -184, -411, -458, -57, 454, 694, 630, 452,
-    322, -249, -1202, -1648, -1303, -544, -13, 96, 542, 1383,
-    1535, 669, -612, -1407, -1316, -1131, -1319, -984, 551, 2102,
-    2090, 951, 242, 172, -237, -1370, -2249, -1344, 725, 1559,
-    914, 537, 831, 623, -456, -1540, -1492, -111, 1081, 1045,
-    656, 822, 614, -694, -1845, -2164, -1612, -357, 431, 818,
-    1602, 1917, 990, -407, -1518, -1866, -1553, -1060, 20, 1285,
-    1867, 1860, 1116, 36, -760, -1553, -1805, -739, 533, 1059,
-    1303, 1444, 1263, 332, -874, -1189, -736, -2, 313, 40,
-    637, 1719, 1141, -415, -1085, -991, -656, -613, -893, -299,
-    1117, 1619, 657, -213, -159, -172, -874, -1522, -1222, -207,
-    665, 616, 192, 555, 970, 451, -592, -1026, -448, 21,
-    -272, -507, -169, 141, 415, 578, 383, 544, 605, 21,
-    -319, -109, -221, -584, -63, 435, 55, -293, -267, -58,
-    89, -65, -381, 190, 1049, 455, -646, -882, -178, 292,
-    -260, -651, -190, 527, 490, -363, -1032, -525, 649, 742,
-    92, 20, 729, 948, -133, -1046, -1080, -234, 650, 219,
-    -200, 827, 1724, 829, -407, -690, -388, 70, -170, -473,
-    143, 1033, 1066, 137, -296, -262, -684, -993, -680, -188,
-    388, 1094, 944, 301, -113, -780, -1081, -864, -764, -575,
-    116, 814, 644, 79, -257, -286, -122, -140, -352, -254,
-    407, 600, 153, 10, 40, 220, 314, -219, -699, -406,
-    114, 258, 263, 494, 1169, 1420, 416, -727, -1109, -1032,
-    -926, -845, -298, 886, 1739, 1316, 360, -234, -867, -1528,
-    -1537, -955, -44, 1006, 1400, 1117, 680, -197, -1113, -1327,
-    -1328, -1189, -274, 980, 1862, 2068, 1348, 368, -228, -957,
-    -1864, -1711, -375, 776, 1533, 1873, 1283, 637, 287, -885,
-    -1949, -1313, -362, 350, 1406, 1417, 741, 747, 106, -1567,
-    -2240, -1680, -948, 112, 907, 992, 1214, 1316, 442, -917,
-    -1597, -1725, -1484, -613, 181, 753, 1259, 1354, 910, -100,
-    -1185, -1324, -561, -90, 283, 935, 1361, 1723, 1115, -642,
-    -1518, -1184, -881, -633, 7, 706, 1448, 1711, 780, -241,
-    -547, -519, -646, -883, -627, 180, 918, 717, -34, -316,
-    -307, -613, -1381, -1512, -284, 968, 1064, 773, 1083, 1244,
-    525, -741, -1534, -1160, -746, -771, -255, 926, 1803, 1518,
-    581, 123, 104, -403, -986, -613, 110, 536, 625, 460,
-    476, 450, -243, -1090, -853, -49, 57, 84, 483, 634,
-    495, 24, -925, -1382, -835, -569, -812, -481, 341, 900,
-    833, 476, 310, 293, 104, -581, -1177, -790, -137, -300,
-    -516, 226, 1031, 1002, 502, 59, -58, -77, -225, -280,
-    284, 1238, 1142, 259, 116, 75, -819, -1441, -1144, -649,
-    82, 721, 816, 1228, 1434, 380, -797, -1004, -850, -808,
-    -661, -409, 328, 1139, 737, -292, -595, -273, -171, -481,
-    -661, 13, 1383, 1680, 479, -475, -406, -232, -798, -1330,
-    -770, 648, 1715, 1453, 677, 681, 900, -59, -1373, -1423,
-    -888, -404, 232, 540, 550, 742, 533, -389, -766, -580,
-    -806, -585, 313, 641, 520, 555, 120, -566, -770, -1244,
-    -1504, -498, 412, 506, 698, 841, 565, 269, -228, -748,
-    -455, -24, -108, 64, 636, 880, 512, -61, -233, 89,
-    181, -289, -370, 394, 943, 446, -357, -238, 408, 235,
-    -572, -789, -223, 406, 496, 20, -90, 522, 446, -495,
-    -848, -624, -450, -191, -77, -283, -28, 587, 523, 118,
-    -57, -196, -73, 285, 113, -395, -131, 307, 66, -94,
-    18, 139, 384, 490, 241, 111, 189, 61, 23, -103,
-    -530, -541, -180, 93, 168, 162, 294, 569, 489, -277,
-    -800, -584, -262, -323, -604, -362, 248, 527, 208, -472,
-    -733, -389, -73, -155, -4, 459, 627, 656, 253, -423,
-    -424, -135, -232, -247, 192, 562, 754, 656, 164, -108,
-    -328, -484, -156, 254, 478, 593, 632, 551, 237, -496,
-    -921, -308, 241, 121, -59, 130, 551, 338, -680, -1343,
-    -797, -89, -228, -279, 420, 1018, 643, -109, -377, -202,
-    -5, -416, -822, -184, 512, 203, -142, 157, 238, 29,
-    -169, -414, -113, 450, 401, 370, 935, 1056, 403, -49,
-    -324, -869, -1379, -1450, -847, 312, 1331, 1550, 1379, 1273,
-    601, -898, -2236, -2456, -1658, -572, 169, 773, 1695, 2165,
-    1238, -559, -1854, -1927, -1246, -574, 20, 877, 1781, 2005,
-    980, -712, -1702, -1704, -1252, -592, 145, 1066, 2260, 2768,
-    1739, 104, -1062, -1467, -1226, -1052, -903, 70, 1469, 1825,
-    976, -62, -549, -454, -619, -1066, -749, 309, 1179, 1167,
-    341, -477, -604, -674, -1243, -1405, -815, 127, 995, 1215,
-    865, 564, 489, -16, -1110, -1784, -1313, -285, 273, 542,
-    822, 1151, 1439, 689, -696, -951, -259, -22, -58, 230,
-    549, 1002, 938, -413, -1710, -1787, -1119, -438, 228, 899,
-    1580, 2264, 2007, 300, -1654, -2363, -2040, -1761, -1424, -659,
-    819, 2466, 2335, 413, -933, -884, -746, -896, -878, -224,
-    1460, 2515, 1444, -159, -731, -770, -1045, -1378, -1243, -54,
-    1704, 2369, 1742, 1072, 773, 148, -756, -1160, -1151, -785,
-    -210, -55, 135, 582, 323, -359, -160, 244, -68, -376,
-    -333, 158, 681, 159, -653, -434, 23, -600, -1721, -1935,
-    -1011, 52, 417, 722, 1459, 2058, 1750, 349, -822, -938,
-    -951, -1062, -575, 220, 737, 1089, 970, 326, -217, -663,
-    -793, -273, 509, 1084, 1355, 1370, 947, 58, -871, -1428,
-    -1539, -1252, -586, -55, 282, 694, 696, 144, -534, -942,
-    -783, -333, -234, -278, 185, 644, 310, -534, -960, -462,
-    61, -96, -244, 251, 919, 893, 181, -211, 150, 319,
-    -101, -239, 130, 563, 751, 561, 395, 600, 798, 561,
-    181, 18, 6, -90, -287, -453, -550, -416, -149, -247,
-    -425, -66, 280, 63, -66, 105, 73, -128, -492, -965,
-    -939, -640, -959, -1160, -431, 175, 121, 64, 205, 394,
-    411, 52, -114, 352, 505, -17, -241, 135, 367, -62,
-    -478, -70, 860, 1260, 750, 413, 927, 1158, 236, -671,
-    -459, 224, 527, -3, -730, -372, 304, -174, -1056, -837,
-    133, 754, 660, 135, 83, 469, 80, -1217, -2064, -1660,
-    -1107, -990, -659, -38, 572, 911, 620, -9, -74, 48,
-    -236, -7, 518, 505, 458, 451, 107, -301, -467, -543,
-    -210, 418, 670, 903, 1373, 1626, 1205, 435, 109, -95,
-    -428, -552, -544, -320, 228, 390, -169, -269, 7, -238,
-    -431, -461, -464, -143, 116, -208, -729, -749, -682, -950,
-    -1174, -879, -237, 182, 441, 315, 30, 196, 140, -231,
-    -227, -61, -94, 36, 257, 47, -76, 57, 273, 617,
-    708, 776, 1080, 1330, 1082, 380, 0, 99, 93, -319,
-    -379, 108, 184, -152, -532, -549, -129, -5, -206, -15,
-    645, 725, 84, -425, -780, -1029, -1226, -1338, -1127, -509,
-    134, 119, -99, -204, -386, -335, -159, -136, 27, 671,
-    1054, 604, 29, -274, -195, -114, -355, -241, 478, 1199,
-    1217, 889, 806, 789, 568, 79, -199, -90, 161, 285,
-    73, 18, 27, -229, -400, -400, -317, -45, 455, 490,
-    64, -121, -308, -559, -786, -1150, -1340, -944, -481, -672,
-    -618, 1, 286, 334, 271, -59, -195, 235, 512, 359,
-    380, 427, 530, 571, -103, -954, -919, -24, 574, 521,
-    733, 1626, 2439, 1988, 597, -265, 24, 352, -368, -826,
-    -79, 759, 758, 30, -625, -664, -443, -627, -676, 104,
-    830, 952, 662, 101, -550, -1251, -1794, -1862, -1205, -418,
-    -101, 325, 929, 848, -101, -862, -741, -142, 296, 148,
-    319, 1303, 1489, 259, -928, -964, -298, 56, -275, -63,
-    1658, 2818, 1984, 856, 631, 663, 78, -890, -1213, -345,
-    580, 289, -322, -198, 238, 129, -424, -682, -447, 152,
-    572, 405, 213, 255, 71, -616, -1408, -2057, -2325, -1760,
-    -949, -535, -141, 661, 1316, 1232, 733, -73, -768, -667,
-    -362, -350, -192, 248, 694, 1087, 620, -760, -1128, -409,
-    -98, 26, 573, 1414, 2303, 2401, 1162, -55, -342, -711,
-    -1197, -1233, -916, -355, 320, 664, 458, 110, -291, -626,
-    -619, -755, -1094, -754, 239, 530, -121, -566, -723, -1012,
-    -1490, -1969, -1924, -1250, -479, 100, 749, 1087, 731, 400,
-    218, -402, -1298, -1532, -801, 186, 736, 568, 527, 1155,
-    1120, -278, -1410, -1000, -75, 478, 909, 1369, 1902, 1933,
-    953, -300, -1025, -1334, -1360, -804, -161, 158, 497, 655,
-    287, -377, -891, -1155, -1031, -583, -258, 122, 558, 449,
-    -116, -690, -1217, -1723, -1916, -1675, -1021, -206, 219, 503,
-    814, 690, 179, -216, -285, -292, -294, -24, 429, 607,
-    469, 567, 586, 123, -364, -435, 100, 781, 957, 1018,
-    1546, 1752, 952, -38, -590, -605, -169, -60, -150, 361,
-    945, 710, 189, -241, -887, -999, -381, 11, 74, 152,
-    193, 253, -46, -1250, -2072, -1277, -354, -315, -286, 144,
-    733, 1020, 353, -724, -744, -117, -78, -224, 63, 599,
-    861, 525, -4, -37, 322, 369, 322, 720, 1269, 1433,
-    1182, 912, 815, 788, 428, -219, -196, 540, 789, 302,
-    97, 593, 960, 511, -362, -503, 114, 177, -403, -523,
-    118, 645, 445, -174, -570, -531, -564, -937, -1148, -888,
-    -448, -124, 213, 351, -63, -537, -548, -245, -101, -157,
-    67, 846, 1413, 878, -79, -340, -39, 148, -125, -473,
-    -67, 1134, 1805, 1245, 635, 821, 1123, 735, 8, -105,
-    634, 1296, 1002, 347, 301, 489, 173, -541, -923, -632,
-    -113, 0, -168, 111, 638, 566, -35, -373, -442, -818,
-    -1302, -1450, -1242, -700, -124, 121, 97, -190, -769, -1085,
-    -1011, -1021, -705, 197, 950, 1272, 1153, 522, 45, -70,
-    -636, -1212, -732, 212, 901, 1347, 1349, 1110, 1023, 672,
-    4, -227, -37, 404, 1302, 1835, 1362, 926, 1002, 544,
-    -659, -1667, -1767, -713, 511, 366, -415, -53, 937, 832,
-    -403, -1479, -1267, -201, -208, -1460, -1775, -624, 63, -508,
-    -1299, -1512, -1126, -686, -817, -1038, -542, 331, 878, 1068,
-    827, 203, -139, -104, -297, -725, -847, -350, 564, 1141,
-    882, 593, 1087, 1571, 1089, 189, 37, 722, 1416, 1382,
-    728, 386, 702, 705, -140, -932, -822, -65, 500, 183,
-    -450, -235, 341, 113, -562, -832, -713, -481, -563, -1208,
-    -1658, -1448, -1243, -1261, -994, -509, -344, -511, -709, -792,
-    -803, -881, -872, -412, 275, 515, 388, 387, 247, -155,
-    -328, -298, -260, 131, 772, 1110, 1217, 1195, 963, 911,
-    952, 541, 155, 479, 961, 932, 631, 493, 744, 957,
-    416, -301, -173, 178, -125, -503, -490, -430, -296, -134,
-    -216, -379, -583, -942, -1201, -1377, -1727, -1777, -1223, -620,
-    -256, -160, -486, -831, -853, -1104, -1649, -1429, -395, 338,
-    452, 348, 292, 410, 326, -340, -675, 15, 707, 812,
-    880, 1009, 1145, 1233, 782, 139, 295, 724, 634, 637,
-    1066, 1403, 1402, 1056, 596, 531, 638, 216, -360, -275,
-    106, -105, -770, -933, -404, 53, -110, -561, -616, -396,
-    -673, -1345, -1435, -918, -626, -615, -605, -736, -973, -1187,
-    -1464, -1513, -991, -354, 4, 313, 565, 607, 454, 158,
-    -18, 159, 354, 314, 400, 680, 799, 687, 591, 718,
-    851, 725, 667, 983, 1371, 1470, 1276, 963, 935, 1122,
-    892, 325, 91, 244, 315, 71, -281, -409, -237, -116,
-    -284, -440, -259, -89, -454, -927, -964, -781, -635, -655,
-    -877, -811, -492, -823, -1525, -1454, -959, -697, -379, -155,
-    -198, 99, 548, 329, -3, 186, 356, 392, 570, 558,
-    464, 656, 655, 450, 765, 1013, 583, 503, 1080, 1329,
-    1226, 1287, 1258, 1213, 1237, 722, 107, 385, 776, 340,
-    -64, 85, 169, 158, 57, -307, -249, 179, -113, -740,
-    -653, -393, -431, -412, -553, -736, -504, -499, -1101, -1397,
-    -1130, -916, -671, -198, 66, 61, 85, 44, -221, -352,
-    -169, 44, 276, 510, 578, 683, 900, 756, 426, 486,
-    537, 317, 476, 917, 1076, 1188, 1433, 1362, 1048, 814,
-    537, 384, 456, 311, 114, 483, 854, 433, -162, -289,
-    -316, -384, -383, -434, -431, -200, -174, -505, -615, -550,
-    -754, -968, -979, -1187, -1345, -996, -736, -773, -477, -202,
-    -425, -536, -433, -569, -471, -42, -87, -294, -61, 93,
-    -36, 80, 253, 221, 380, 504, 227, 236, 634, 544,
-    316, 806, 1248, 920, 497, 240, 70, 243, 386, 106,
-    150, 703, 844, 550, 287, -134, -448, -133, 88, -415,
-    -764, -438, -225, -339, -476, -724, -879, -615, -570, -992,
-    -987, -552, -402, -372, -367, -759, -974, -556, -396, -752,
-    -685, -259, -54, 58, 16, -285, -97, 599, 700, 341,
-    336, 478, 549, 650, 363, -18, 452, 1207, 1103, 642,
-    506, 423, 358, 522, 592, 498, 694, 962, 859, 524,
-    142, -178, -48, 259, -20, -495, -375, -92, -110, -202,
-    -356, -529, -399, -237, -509, -751, -583, -347, -345, -534,
-    -773, -797, -638, -717, -961, -876, -594, -529, -585, -473,
-    -188, -13, -25, -20, 147, 217, 29, -277, -387, -56,
-    341, 339, 291, 523, 630, 384, -13, -238, 154, 950,
-    1196, 936, 806, 720, 442, 88, -307, -503, -230, 111,
-    232, 253, 53, -279, -279, -179, -462, -795, -651, -255,
-    11, -95, -553, -867, -791, -770, -1033, -1170, -1007, -624,
-    -204, -209, -590, -577, -226, -309, -670, -564, -99, 302,
-    441, 149, -226, -217, -105, -153, 79, 471, 565, 643,
-    826, 701, 431, 328, 377, 715, 1134, 981, 519, 560,
-    919, 966, 581, 177, 174, 552, 785, 536, 150, 212,
-    619, 684, 291, -18, -83, -49, -10, -187, -408, -231,
-    122, 32, -370, -677, -767, -585, -372, -494, -610, -217,
-    200, 47, -266, -301, -263, -213, -204, -451, -569, 7,
-    666, 715, 503, 351, 256, 336, 307, 5, 226, 1039,
-    1333, 1018, 874, 765, 450, 169, -35, -29, 507, 1055,
-    1017, 829, 857, 741, 236, -320, -495, -197, 208, 284,
-    12, -128, 86, 90, -497, -992, -951, -732, -472, -312,
-    -425, -352, 12, -193, -930, -1314, -1302, -1148, -814, -652,
-    -703, -399, 21, -205, -711, -752, -527, -362, -232, -210,
-    -194, 147, 430, 195, -90, -47, 65, 215, 352, 202,
-    138, 596, 957, 774, 617, 687, 660, 547, 420, 222,
-    261, 541, 560, 380, 381, 415, 303, 154, -33, -197,
-    -158, -45, -122, -231, -86, 204, 262, 43, -291, -622,
-    -718, -583, -615, -758, -542, -96, 137, 92, -156, -434,
-    -419, -276, -328, -291, 119, 493, 548, 506, 414, 195,
-    -51, -281, -407, -154, 355, 696, 914, 1236, 1393, 1178,
-    798, 417, 130, 149, 396, 646, 949, 1174, 1015, 613,
-    337, 186, 10, -203, -180, 381, 1127, 1280, 817, 361,
-    180, -37, -613, -1289, -1353, -688, -89, -16, -141, -183,
-    -226, -429, -912, -1347, -1200, -694, -438, -331, -115, -74,
-    -396, -897, -1336, -1441, -1129, -802, -635, -258, 307, 486,
-    216, -121, -421, -569, -441, -313, -248, 61, 421, 507,
-    447, 228, -248, -532, -340, -45, 119, 311, 540, 719,
-    712, 301, -281, -441, -231, -170, -197, 15, 320, 349,
-    5, -479, -680, -507, -377, -509, -497, -80, 272, 102,
-    -418, -834, -822, -519, -472, -700, -593, -86, 176, -96,
-    -599, -871, -710, -380, -218, -105, 211, 544, 536, 236,
-    -60, -246, -233, 32, 362, 589, 800, 967, 904, 660,
-    421, 246, 274, 586, 866, 927, 1018, 1134, 986, 697,
-    472, 305, 343, 570, 598, 479, 596, 745, 572, 336,
-    266, 140, 6, 22, -25, -122, -13, 35, -120, -105,
-    -4, -136, -221, -211, -449, -670, -579, -511, -491, -227,
-    -4, -37, -68, -198, -601, -872, -829, -674, -341, 82,
-    239, 235, 274, 104, -313, -627, -627, -302, 192, 526,
-    618, 662, 632, 320, -167, -505, -499, -210, 95, 290,
-    545, 831, 798, 416, 20, -159, -166, -215, -371, -296,
-    77, 250, 6, -337, -570, -665, -638, -661, -733, -580,
-    -216, 10, 2, -161, -384, -501, -583, -860, -1139, -1157,
-    -1052, -876, -496, -82, 110, 120, 16, -116, -200, -321,
-    -475, -373, 66, 465, 572, 503, 306, -4, -237, -273,
-    -143, 128, 502, 899, 1355, 1655, 1387, 704, 245, 190,
-    225, 224, 296, 521, 909, 1182, 966, 496, 243, 200,
-    188, 257, 402, 564, 701, 616, 253, -61, -149, -217,
-    -347, -359, -125, 166, 164, -215, -530, -417, -136, -107,
-    -282, -303, -83, 5, -274, -519, -423, -249, -176, -69,
-    69, 171, 206, 72, -48, 114, 196, -83, -195, 147,
-    473, 530, 491, 447, 591, 784, 461, -67, 0, 342,
-    336, 278, 398, 483, 564, 474, 52, -106, 108, 23,
-    -239, -94, 185, 222, 122, -118, -285, -139, -245, -822,
-    -1073, -784, -540, -462, -350, -221, -41, -84, -659, -1182,
-    -1122, -952, -963, -736, -221, 152, 114, -361, -869, -866,
-    -629, -638, -530, -13, 411, 440, 270, 49, -61, -71,
-    -209, -258, 110, 453, 415, 383, 547, 690, 684, 466,
-    174, 155, 277, 216, 236, 540, 790, 850, 762, 463,
-    94, -181, -469, -649, -324, 339, 816, 893, 605, 142,
-    -236, -562, -966, -1083, -527, 217, 554, 589, 428, -28,
-    -636, -1137, -1360, -1032, -338, 115, 425, 897, 999, 409,
-    -331, -798, -909, -594, -130, 159, 494, 814, 724, 405,
-    216, 41, -80, 94, 370, 513, 669, 768, 650, 573,
-    617, 507, 290, 173, 36, -45, 74, 148, 169, 461,
-    785, 779, 636, 404, -37, -467, -747, -873, -625, -166,
-    101, 335, 590, 349, -368, -1004, -1276, -1136, -779, -463,
-    -30, 572, 700, 72, -732, -1275, -1500, -1360, -909, -196,
-    596, 930, 552, -41, -444, -805, -1036, -823, -168, 611,
-    1000, 664, 9, -331, -383, -352, -64, 402, 731, 840,
-    598, 76, -255, -272, -243, 20, 591, 893, 710, 289,
-    -209, -430, -206, -14, 38, 321, 612, 469, 31, -476,
-    -819, -743, -452, -187, 223, 610, 455, -110, -546, -657,
-    -584, -518, -410, 12, 554, 578, 46, -450, -642, -683,
-    -681, -505, 50, 761, 1015, 673, 286, 54, -303, -669,
-    -628, -84, 698, 1222, 1132, 729, 430, 67, -380, -432,
-    -47, 463, 915, 1046, 770, 489, 339, 39, -196, -9,
-    382, 636, 590, 265, 43, 135, 147, -119, -140, 263,
-    478, 150, -318, -447, -307, -254, -334, -169, 368, 636,
-    160, -465, -639, -661, -824, -788, -345, 241, 553, 309,
-    -185, -420, -541, -820, -851, -393, 127, 414, 433, 137,
-    -235, -428, -566, -591, -222, 303, 574, 581, 323, -113,
-    -356, -382, -455, -276, 375, 852, 686, 189, -224, -328,
-    -188, -124, -37, 432, 848, 596, 76, -186, -319, -468,
-    -517, -309, 153, 436, 161, -174, -50, 115, -53, -261,
-    -258, -101, -25, -244, -514, -456, -300, -320, -237, -30,
-    18, -46, -172, -374, -385, -175, -105, -109, 56, 176,
-    164, 110, -170, -536, -514, -234, -70, 157, 542, 820,
-    895, 714, 266, -116, -240, -293, -167, 348, 868, 935,
-    665, 368, 169, 57, 15, 152, 592, 1068, 1109, 725,
-    325, 86, -125, -270, -137, 192, 384, 317, 168, 76,
-    -5, -97, -100, 85, 313, 306, 108, -49, -199, -454,
-    -616, -555, -467, -428, -373, -326, -285, -260, -293, -235,
-    -55, -62, -248, -259, -205, -348, -493, -416, -193, -32,
-    -100, -229, -103, 46, -130, -324, -187, 88, 271, 378,
-    494, 602, 509, 135, -216, -330, -340, -226, 171, 699,
-    998, 895, 520, 124, -197, -447, -411, 11, 434, 576,
-    573, 442, 38, -454, -686, -565, -245, 4, 94, 206,
-    248, -81, -504, -523, -371, -422, -462, -341, -243, -286,
-    -511, -708, -524, -194, -186, -252, -95, -54, -258, -410,
-    -377, -211, -56, -48, -21, 170, 248, 75, -62, -4,
-    153, 290, 351, 409, 510, 540, 454, 335, 203, 139,
-    276, 521, 733, 885, 907, 754, 504, 227, 76, 243,
-    548, 659, 663, 695, 505, -36, -563, -676, -374, 65,
-    382, 587, 775, 689, 120, -509, -722, -673, -630, -512,
-    -242, 20, -19, -449, -855, -874, -740, -717, -594, -222,
-    118, 151, -28, -139, -173, -341, -569, -610, -497, -422,
-    -409, -333, -99, 180, 285, 285, 358, 384, 319, 321,
-    296, 135, 80, 213, 331, 363, 308, 253, 360, 396,
-    120, -25, 275, 559, 564, 623, 769, 662, 223, -285,
-    -524, -422, -336, -407, -196, 301, 385, -34, -324, -333,
-    -381, -500, -488, -257, -5, -105, -493, -688, -668, -827,
-    -1039, -867, -443, -192, -130, -90, -92, -197, -333, -385,
-    -340, -300, -302, -227, -6, 183, 155, 74, 173, 265,
-    192, 216, 374, 434, 477, 637, 763, 755, 597, 370,
-    372, 533, 399, 154, 363, 804, 934, 894, 973, 976,
-    681, 174, -228, -243, -74, -77, 10, 462, 748, 447,
-    -40, -306, -424, -557, -646, -451, 17, 301, 129, -152,
-    -308, -618, -1149, -1439, -1213, -754, -399, -201, -32, 111,
-    11, -326, -572, -643, -683, -610, -362, -135, -41, -18,
-    9, 50, -13, -198, -249, -63, 121, 242, 507, 835,
-    896, 739, 652, 580, 305, -81, -217, 83, 493, 585,
-    577, 850, 1046, 677, 105, -60, 71, 103, 86, 257,
-    590, 745, 384, -190, -393, -470, -867, -1054, -624, -130,
-    66, 126, 89, -55, -360, -889, -1235, -1035, -733, -647,
-    -375, 55, 60, -288, -576, -880, -1146, -1072, -774, -375,
-    171, 520, 502, 438, 204, -398, -764, -534, -245, -76,
-    336, 861, 1093, 993, 640, 272, 183, 87, -176, 20,
-    715, 1079, 1064, 1177, 1203, 809, 238, -141, -132, 155,
-    358, 479, 863, 1251, 1000, 315, -113, -329, -659, -854,
-    -640, -170, 290, 494, 430, 306, 11, -617, -1134, -1129,
-    -905, -766, -518, -131, 46, -127, -479, -821, -1021, -1080,
-    -1028, -696, -137, 225, 297, 328, 274, -54, -524, -800,
-    -768, -601, -382, 14, 512, 778, 710, 563, 509, 360,
-    30, -90, 236, 647, 785, 777, 846, 861, 551, 73,
-    -164, -140, -75, 83, 512, 1073, 1347, 1122, 692, 349,
-    -51, -621, -963, -695, -116, 235, 322, 347, 210, -248,
-    -854, -1194, -1069, -743, -442, -36, 407, 467, 0, -650,
-    -1133, -1412, -1511, -1273, -710, -134, 238, 355, 219, -78,
-    -497, -888, -886, -513, -161, 145, 542, 768, 604, 266,
-    7, -175, -283, -193, 151, 637, 962, 909, 774, 831,
-    707, 250, 1, 162, 358, 441, 538, 718, 931, 938,
-    627, 358, 327, 132, -286, -336, 32, 261, 277, 316,
-    314, 176, -145, -590, -757, -550, -390, -304, -14, 230,
-    61, -345, -669, -873, -972, -959, -868, -635, -278, -92,
-    -118, -115, -205, -506, -676, -585, -460, -307, -22, 296,
-    448, 317, 10, -230, -315, -306, -168, 195, 610, 752,
-    709, 718, 613, 286, 20, 33, 271, 502, 553, 579,
-    704, 681, 397, 131, 108, 189, 148, 109, 312, 563,
-    535, 301, 144, 112, -21, -344, -555, -474, -342, -311,
-    -242, -58, 63, -84, -379, -534, -586, -703, -752, -546,
-    -197, 13, -58, -285, -507, -754, -1010, -1036, -738, -330,
-    49, 415, 571, 319, -132, -435, -457, -303, -138, 93,
-    465, 665, 474, 171, 23, -8, -15, 60, 363, 767,
-    876, 664, 528, 579, 528, 278, 144, 296, 443, 337,
-    157, 205, 422, 424, 190, 122, 190, 45, -174, -196,
-    -73, 65, 67, -56, -52, 2, -177, -407, -413, -346,
-    -347, -301, -208, -228, -337, -402, -433, -461, -520, -633,
-    -577, -281, -129, -162, -38, 64, -130, -333, -327, -271,
-    -229, -159, -46, 159, 307, 146, -68, 56, 224, 108,
-    76, 317, 512, 559, 503, 343, 269, 262, 96, 16,
-    234, 350, 253, 348, 539, 448, 236, 127, 44, 58,
-    155, 141, 169, 271, 76, -196, -104, -24, -199, -218,
-    -62, -18, -65, -184, -288, -174, -79, -272, -384, -230,
-    -270, -536, -508, -238, -138, -155, -150, -154, -146, -282,
-    -541, -435, -27, 84, 17, 132, 153, -65, -197, -148,
-    -56, 18, 18, 44, 261, 384, 129, -42, 191, 305,
-    91, 26, 178, 279, 318, 330, 414, 623, 538, 46,
-    -186, -15, -26, -149, 91, 465, 551, 351, -7, -254,
-    -204, -211, -338, -82, 344, 319, 83, 0, -143, -353,
-    -439, -412, -225, 33, 34, -130, -128, -113, -252, -241,
-    -91, -175, -314, -213, -133, -175, -136, -65, 57, 232,
-    132, -127, -147, -159, -370, -380, -61, 228, 320, 302,
-    246, 153, -41, -308, -334, 63, 463, 507, 512, 596,
-    383, -67, -370, -430, -256, 40, 243, 406, 527, 318,
-    -73, -175, -60, -46, -33, 95, 173, 126, 34, -46,
-    -19, 31, -92, -191, -57, -13, -195, -219, 0, 157,
-    138, 35, -71, -142, -247, -387, -330, -33, 136, 88,
-    96, 103, -33, -129, -118, -74, 21, 21, -100, -94,
-    -6, -6, 17, 65, 25, -33, -47, -45, -74, -97,
-    18, 229, 311, 198, -11, -141, -156, -214, -208, 70,
-    328, 291, 124, -8, -64, -89, -169, -141, 102, 273,
-    205, 61, -15, -41, -92, -122, -17, 134, 190, 147,
-    26, -98, -154, -155, -67, 65, 102, 106, 149, 100,
-    -16, -23, 67, 115, 74, 39, 122, 211, 58, -223,
-    -256, -43, 71, 11, -23, 61, 115, -44, -245, -153,
-    90, 131, 15, -32, 0, -48, -249, -360, -205, -1,
-    65, 34, -4, -3, -51, -176, -214, -139, -14, 107,
-    40, -145, -146, -18, 60, 62, -23, -37, 26, -106,
-    -259, -85, 230, 369, 252, 71, 91, 94, -176, -343,
-    -73, 391, 613, 424, 185, 160, 22, -282, -326, -5,
-    376, 464, 234, 81, 103, 15, -114, -34, 194, 321,
-    181, -83, -201, -181, -142, -66, 36, 127, 144, -8,
-    -292, -521, -497, -187, 148, 235, 161, 79, -115, -470,
-    -702, -554, -179, 46, 33, 57, 190, 95, -263, -424,
-    -211, 46, 76, -25, 21, 158, 39, -200, -142, 122,
-    236, 127, 11, 81, 137, 1, 4, 292, 499, 411,
-    179, 75, 109, -16, -195, -37, 294, 453, 435, 341,
-    260, 106, -180, -233, 56, 262, 248, 162, 76, 26,
-    -90, -229, -142, 21, 37, 0, -91, -230, -283, -268,
-    -176, -20, 32, 15, -48, -303, -560, -535, -297, -31,
-    123, 179, 201, 5, -438, -677, -461, -79, 131, 149,
-    196, 270, 81, -303, -410, -105, 238, 314, 244, 253,
-    224, -47, -304, -136, 326, 573, 454, 252, 155, 50,
-    -123, -121, 199, 529, 573, 402, 159, -59, -191, -206,
-    -42, 214, 350, 381, 319, 66, -196, -246, -133, 27,
-    84, 42, 51, -45, -328, -442, -253, -8, 52, -104,
-    -189, -100, -172, -383, -373, -146, 72, 74, -103, -152,
-    -126, -265, -371, -250, -9, 190, 160, 1, -34, -54,
-    -118, -65, 61, 180, 248, 177, 59, -6, -28, 87,
-    260, 276, 236, 267, 241, 64, -158, -150, 171, 410,
-    349, 272, 306, 216, -84, -302, -115, 273, 373, 188,
-    113, 164, 31, -280, -382, -101, 221, 220, 27, -38,
-    -50, -209, -373, -283, 18, 226, 133, -117, -301, -419,
-    -456, -317, -48, 222, 336, 175, -115, -347, -434, -301,
-    -69, 85, 216, 283, 145, -128, -365, -342, -17, 236,
-    257, 260, 252, 110, -113, -211, 26, 368, 376, 182,
-    95, 37, -109, -248, -130, 277, 511, 355, 156, 57,
-    -71, -223, -256, -18, 310, 353, 185, 62, -71, -236,
-    -291, -161, 105, 242, 116, -42, -122, -198, -223, -142,
-    12, 140, 94, -75, -194, -258, -293, -220, -31, 174,
-    250, 119, -99, -249, -311, -287, -134, 91, 255, 285,
-    171, -22, -184, -246, -175, 0, 146, 212, 243, 158,
-    -47, -180, -126, 48, 178, 191, 210, 213, 22, -225,
-    -246, -39, 193, 256, 189, 147, 18, -247, -384, -257,
-    23, 265, 296, 214, 138, -55, -308, -395, -259, 31,
-    235, 177, 50, -51, -217, -329, -256, -37, 189, 193,
-    17, -93, -185, -276, -199, 6, 201, 267, 121, -95,
-    -268, -389, -297, -6, 223, 318, 292, 119, -112, -302,
-    -325, -127, 95, 211, 267, 197, -15, -193, -215, -96,
-    53, 137, 170, 130, -22, -157, -150, -64, 41, 153,
-    206, 132, -59, -252, -315, -238, -65, 147, 262, 188,
-    33, -101, -239, -329, -240, 5, 193, 166, 55, 18,
-    -69, -256, -289, -87, 88, 60, -53, -58, -10, -87,
-    -155, -34, 112, 125, 46, -62, -131, -151, -140, -54,
-    59, 131, 185, 127, -80, -207, -176, -133, -96, 9,
-    205, 318, 153, -95, -151, -135, -167, -121, 33, 167,
-    143, -8, -104, -114, -106, -28, 74, 74, 15, -40,
-    -122, -208, -181, 11, 189, 143, -6, -61, -127, -288,
-    -334, -115, 170, 237, 130, 69, 10, -162, -300, -222,
-    -32, 81, 102, 86, 27, -80, -152, -121, -45, 25,
-    100, 107, -18, -139, -112, -29, 17, 78, 170, 170,
-    -28, -252, -256, -138, -64, 50, 221, 263, 104, -113,
-    -206, -175, -156, -83, 95, 169, 86, -9, -80, -117,
-    -114, -69, 14, 26, -48, -52, -22, -66, -62, 30,
-    82, 36, -59, -87, -65, -125, -150, -26, 88, 92,
-    64, 48, 25, -51, -143, -128, -43, 26, 113, 146,
-    76, 6, -39, -87, -122, -99, 11, 104, 61, 7,
-    41, 28, -60, -67, 37, 120, 55, -65, -76, -55,
-    -95, -83, 29, 117, 95, 0, -93, -158, -196, -155,
-    -10, 134, 194, 156, 26, -129, -218, -206, -127, -7,
-    117, 162, 77, -80, -178, -159, -90, 14, 143, 184,
-    68, -96, -161, -112, -14, 85, 183, 207, 78, -99,
-    -192, -187, -85, 86, 242, 283, 165, -11, -133, -179,
-    -139, 25, 203, 236, 138, 7, -75, -115, -125, -25,
-    133, 183, 94, -39, -121, -124, -73, 4, 101, 156,
-    99, -30, -174, -213, -102, 13, 66, 108, 129, 48,
-    -138, -251, -158, 8, 58, 42, 78, 66, -54, -157,
-    -108, 31, 74, 39, 37, 40, -8, -65, -41, 27,
-    70, 82, 62, 16, -38, -47, 0, 39, 76, 108,
-    113, 66, 14, 21, 41, 44, 49, 67, 79, 51,
-    36, 46, 32, 9, 9, 24, 6, -7, 40, 94,
-    87, 33, 26, 46, 0, -43, -10, 47, 45, -7,
-    -11, -1, -48, -101, -67, 17, 39, 19, 2, -17,
-    -43, -55, 4, 69, 62, 30, -9, -56, -102, -98,
-    -35, 23, 54, 53, 31, -26, -86, -64, -1, 64,
-    118, 130, 97, 17, -30, -21, -1, 30, 73, 107,
-    59, -26, -37, 9, 51, 65, 111, 160, 105, 10,
-    -16, 42, 83, 70, 95, 140, 117, 16, -66, -51,
-    -10, 22, 60, 107, 123, 60, -11, -36, -7, 47,
-    68, 72, 62, 42, 3, -58, -69, -20, 34, 37,
-    4, -3, -23, -67, -84, -25, 69, 89, 62, 38,
-    2, -52, -94, -54, 18, 51, 59, 51, 22, -43,
-    -80, -45, 0, 33, 54, 88, 97, 44, 0, -7,
-    13, 42, 70, 103, 93, 46, -10, -38, -6, 48,
-    109, 122, 93, 62, 14, -26, -32, 28, 126, 171,
-    155, 97, 23, -50, -90, -34, 67, 146, 151, 85,
-    4, -77, -99, -43, 49, 128, 137, 95, 4, -92,
-    -111, -42, 74, 134, 120, 72, -16, -117, -176, -111,
-    34, 137, 157, 102, 18, -89, -179, -145, 4, 174,
-    232, 152, 29, -80, -133, -124, -30, 122, 211, 167,
-    20, -93, -119, -102, -21, 115, 246, 246, 78, -89,
-    -144, -90, 9, 129, 242, 236, 97, -92, -189, -136,
-    -28, 98, 193, 205, 112, -44, -137, -116, -8, 108,
-    164, 162, 83, -25, -103, -119, -51, 39, 109, 110,
-    39, -48, -127, -131, -53, 56, 134, 118, 53, -23,
-    -76, -76, -33, 39, 62, 44, 31, 6, -34, -71,
-    -47, 4, 22, 22, 26, 44, 24, -5, 27, 58,
-    39, 0, -6, 19, 24, 22, 24, 24, -5, -54,
-    -49, -14, 32, 78, 78, 40, -27, -72, -58, 4,
-    98, 144, 109, 9, -86, -127, -123, -53, 53, 131,
-    121, 23, -64, -132, -169, -106, 45, 194, 201, 72,
-    -72, -161, -183, -136, 19, 175, 179, 49, -111, -185,
-    -181, -133, -11, 144, 224, 140, -30, -153, -184, -119,
-    -12, 113, 214, 187, 31, -160, -243, -187, -66, 67,
-    169, 198, 90, -114, -234, -194, -54, 73, 149, 177,
-    101, -48, -183, -215, -139, -30, 80, 148, 122, -5,
-    -164, -239, -209, -76, 94, 186, 170, 42, -113, -199,
-    -198, -122, 2, 127, 161, 85, -56, -197, -243, -200,
-    -88, 79, 193, 176, 31, -143, -239, -221, -105, 57,
-    208, 242, 103, -113, -274, -278, -152, 18, 180, 242,
-    157, -45, -240, -281, -182, -19, 153, 274, 252, 48,
-    -203, -339, -276, -85, 114, 267, 261, 52, -221, -370,
-    -313, -127, 86, 238, 262, 125, -132, -324, -334, -185,
-    40, 220, 274, 163, -81, -328, -408, -253, 3, 203,
-    270, 181, -21, -273, -397, -273, 0, 220, 272, 190,
-    11, -221, -366, -298, -56, 160, 230, 176, 31, -153,
-    -308, -305, -108, 124, 257, 239, 87, -115, -263, -267,
-    -119, 96, 226, 204, 71, -115, -234, -229, -139, 15,
-    150, 181, 99, -45, -171, -211, -145, -17, 116, 166,
-    92, -27, -144, -211, -179, -60, 77, 118, 58, -20,
-    -93, -155, -160, -62, 68, 111, 55, -6, -28, -78,
-    -132, -97, -8, 55, 54, 12, -18, -61, -117, -125,
-    -46, 49, 84, 58, -7, -46, -55, -74, -63, 1,
-    62, 60, 14, -23, -48, -75, -106, -62, 52, 100,
-    62, 3, -43, -74, -89, -47, 55, 123, 83, 0,
-    -54, -92, -100, -64, 11, 90, 74, -3, -60, -93,
-    -94, -59, 6, 83, 111, 47, -40, -89, -110, -69,
-    14, 77, 112, 53, -71, -134, -120, -56, 35, 92,
-    91, 50, -33, -104, -84, -28, 29, 93, 100, 53,
-    -21, -98, -115, -66, 10, 82, 111, 52, -47, -103,
-    -100, -45, 38, 105, 124, 66, -35, -96, -77, -13,
-    40, 78, 84, 45, -28, -94, -82, -16, 33, 56,
-    61, 57, 18, -55, -82, -25, 47, 74, 65, 40,
-    8, -43, -91, -45, 46, 65, 32, -4, -14, -8,
-    -35, -40, 23, 61, 32, 8, 10, 20, 7, -32,
-    -9, 46, 35, 9, 2, 2, 9, -13, -20, 21,
-    28, 3, 6, 12, 26, 38, 0, -8, 15, 0,
-    13, 44, 40, 42, 5, -47, -21, 12, 15, 50,
-    60, 23, 3, -27, -28, 22, 28, 37, 79, 58,
-    11, -13, -28, -10, 23, 46, 82, 84, 12, -45,
-    -46, -20, 23, 56, 78, 78, 22, -42, -54, -9,
-    38, 56, 69, 75, 47, -13, -55, -26, 30, 55,
-    58, 72, 60, 4, -56, -60, 17, 80, 70, 69,
-    64, 18, -30, -52, 6, 99, 90, 40, 49, 36,
-    -15, -34, -18, 54, 100, 41, 27, 52, 2, -32,
-    -12, 34, 102, 96, 36, 36, 28, -13, 3, 41,
-    78, 106, 49, 2, 21, 13, 10, 31, 51, 83,
-    72, 17, 19, 38, 21, 31, 55, 74, 91, 47,
-    5, 27, 26, 30, 63, 62, 60, 50, 8, 11,
-    52, 53, 58, 72, 50, 51, 53, 36, 63, 79,
-    56, 61, 67, 47, 47, 53, 46, 62, 65, 49,
-    60, 46, 25, 52, 71, 74, 82, 64, 47, 49,
-    41, 53, 99, 97, 70, 58, 32, 42, 62, 53,
-    88, 113, 70, 52, 54, 47, 70, 80, 80, 127,
-    113, 50, 59, 53, 43, 91, 99, 100, 111, 51,
-    15, 41, 42, 75, 125, 94, 76, 78, 30, 37,
-    78, 92, 127, 122, 80, 79, 65, 41, 70, 105,
-    113, 125, 100, 59, 51, 50, 70, 108, 124, 124,
-    105, 58, 32, 59, 97, 108, 114, 107, 79, 49,
-    23, 40, 94, 107, 89, 90, 74, 48, 49, 51,
-    91, 149, 124, 95, 98, 64, 62, 84, 94, 150,
-    157, 74, 53, 57, 38, 80, 105, 102, 136, 81,
-    6, 39, 57, 73, 116, 96, 97, 107, 24, 2,
-    64, 82, 100, 105, 80, 97, 55, -11, 50, 113,
-    114, 119, 97, 83, 76, 23, 46, 128, 127, 103,
-    88, 49, 47, 39, 19, 72, 95, 60, 43, 21,
-    14, 33, 22, 37, 84, 73, 41, 33, 33, 53,
-    61, 59, 88, 84, 44, 28, 35, 62, 73, 60,
-    65, 56, 24, 15, 28, 58, 81, 56, 30, 32,
-    6, -5, 13, 33, 59, 38, -16, -16, -17, -37,
-    -14, 25, 53, 45, -5, -26, -2, -4, 14, 64,
-    87, 80, 28, -25, -6, 12, 14, 48, 60, 45,
-    4, -60, -66, -16, -8, -1, 24, 13, -16, -64,
-    -89, -39, -1, -11, 0, 5, -23, -60, -77, -50,
-    -2, 5, -6, -5, -12, -30, -45, -30, 9, 22,
-    5, -10, -14, -7, -28, -41, -14, -5, -33, -55,
-    -61, -49, -50, -75, -66, -49, -73, -92, -82, -66,
-    -39, -48, -59, -41, -54, -74, -57, -39, -10, 0,
-    -37, -44, -42, -72, -67, -36, -23, -3, -35, -75,
-    -65, -83, -98, -57, -36, -34, -43, -92, -109, -103,
-    -118, -97, -58, -61, -67, -97, -130, -115, -104, -91,
-    -54, -37, -40, -61, -90, -77, -58, -53, -34, -19,
-    -29, -47, -83, -87, -62, -74, -71, -58, -77, -88,
-    -105, -122, -92, -88, -103, -89, -96, -106, -96, -109,
-    -95, -66, -93, -99, -86, -98, -78, -69, -79, -46,
-    -63, -98, -75, -73, -70, -36, -49, -56, -45, -94,
-    -100, -72, -84, -61, -48, -92, -91, -107, -147, -122,
-    -104, -102, -77, -96, -123, -112, -135, -131, -84, -72,
-    -59, -51, -83, -85, -88, -97, -62, -46, -49, -43,
-    -68, -95, -90, -99, -87, -68, -76, -73, -79, -115,
-    -111, -105, -110, -89, -94, -99, -95, -116, -127, -114,
-    -118, -107, -102, -113, -99, -94, -106, -90, -81, -80,
-    -68, -82, -71, -46, -60, -61, -49, -71, -77, -86,
-    -98, -73, -72, -96, -91, -105, -133, -125, -133, -119,
-    -86, -98, -113, -110, -131, -131, -120, -115, -80, -68,
-    -97, -105, -108, -120, -108, -99, -76, -53, -73, -96,
-    -94, -103, -99, -86, -78, -58, -66, -99, -110, -110,
-    -118, -111, -112, -105, -100, -123, -144, -136, -130, -131,
-    -127, -116, -102, -104, -112, -106, -89, -88, -91, -87,
-    -72, -70, -76, -76, -75, -77, -88, -101, -97, -85,
-    -88, -91, -95, -99, -108, -123, -129, -109, -100, -104,
-    -107, -113, -123, -139, -149, -132, -110, -110, -109, -113,
-    -120, -128, -133, -121, -89, -75, -75, -74, -86, -92,
-    -96, -96, -77, -58, -67, -77, -93, -107, -115, -119,
-    -113, -96, -96, -109, -115, -125, -126, -123, -116, -103,
-    -93, -97, -97, -103, -101, -95, -93, -89, -82, -82,
-    -82, -81, -84, -77, -78, -84, -82, -79, -80, -72,
-    -75, -76, -78, -92, -101, -102, -103, -95, -90, -101,
-    -107, -117, -132, -134, -125, -112, -93, -96, -104, -103,
-    -110, -112, -99, -80, -59, -51, -66, -72, -77, -85,
-    -82, -68, -55, -45, -61, -82, -84, -90, -93, -84,
-    -71, -60, -64, -87, -93, -88, -91, -89, -77, -68,
-    -64, -81, -95, -85, -81, -82, -76, -67, -59, -59,
-    -73, -68, -53, -53, -58, -53, -47, -40, -50, -61,
-    -49, -49, -66, -77, -73, -68, -68, -83, -79, -71,
-    -83, -99, -95, -81, -67, -68, -72, -58, -59, -73,
-    -78, -61, -42, -32, -42, -39, -33, -46, -60, -49,
-    -29, -14, -19, -31, -24, -29, -45, -46, -27, -13,
-    -12, -30, -36, -33, -46, -56, -46, -31, -24, -35,
-    -50, -41, -38, -47, -43, -24, -10, -9, -21, -17,
-    -2, -6, -14, -5, 5, 6, -2, -11, 0, 1,
-    -13, -19, -13, -10, -13, -22, -15, -3, -11, -24,
-    -23, -14, -11, -10, -11, 2, 4, -11, -18, -9,
-    0, 8, 10, 19, 27, 17, 3, 8, 23, 35,
-    44, 45, 52, 46, 27, 19, 28, 37, 45, 42,
-    39, 36, 21, 5, 7, 20, 27, 30, 25, 26,
-    24, 15, 15, 30, 42, 49, 45, 40, 41, 38,
-    34, 40, 53, 58, 59, 49, 46, 48, 43, 40,
-    47, 53, 57, 53, 48, 52, 51, 44, 39, 43,
-    43, 46, 43, 45, 53, 51, 42, 41, 44, 50,
-    54, 54, 66, 73, 69, 62, 68, 74, 80, 79,
-    80, 86, 83, 68, 67, 73, 80, 83, 76, 78,
-    75, 62, 48, 55, 67, 77, 78, 74, 78, 72,
-    55, 52, 62, 73, 78, 73, 78, 81, 73, 61,
-    69, 79, 82, 79, 75, 84, 88, 77, 78, 89,
-    93, 90, 77, 78, 83, 78, 67, 76, 87, 86,
-    79, 73, 79, 81, 65, 64, 78, 85, 87, 84,
-    92, 100, 92, 76, 79, 88, 88, 89, 92, 103,
-    108, 91, 81, 89, 88, 86, 82, 89, 99, 93,
-    79, 84, 92, 88, 83, 80, 84, 85, 70, 66,
-    81, 85, 87, 83, 85, 86, 75, 61, 67, 81,
-    85, 88, 91, 94, 93, 78, 67, 78, 78, 79,
-    80, 85, 91, 85, 74, 74, 78, 72, 68, 69,
-    73, 76, 73, 68, 80, 77, 73, 70, 67, 69,
-    65, 61, 64, 73, 73, 72, 72, 70, 66, 60,
-    51, 60, 61, 64, 71, 72, 73, 68, 58, 52,
-    54, 51, 55, 60, 63, 65, 66, 55, 56, 52,
-    49, 51, 49, 52, 57, 56, 54, 58, 56, 56,
-    53, 48, 46, 50, 43, 48, 54, 56, 60, 54,
-    50, 49, 43, 35, 40, 46, 52, 54, 54, 53,
-    55, 41, 35, 38, 38, 45, 43, 47, 55, 53,
-    42, 41, 40, 40, 36, 36, 40, 50, 43, 40,
-    47, 45, 44, 36, 34, 39, 37, 30, 36, 43,
-    47, 43, 41, 39, 40, 28, 22, 32, 35, 40,
-    39, 41, 46, 40, 25, 25, 28, 29, 27, 31,
-    37, 43, 35, 26, 31, 28, 25, 21, 23, 31,
-    32, 25, 29, 33, 32, 24, 23, 23, 25, 20,
-    14, 26, 29, 28, 26, 25, 26, 21, 9, 11,
-    17, 20, 19, 24, 28, 27, 20, 9, 13, 12,
-    10, 13, 17, 23, 23, 15, 15, 14, 10, 6,
-    8, 11, 12, 14, 9, 14, 15, 10, 10, 8,
-    6, 6, 1, 4, 8, 10, 10, 11, 11, 6,
-    4, -3, 0, 2, 2, 7, 10, 9, 9, 2,
-    0, -1, -2, -1, 1, 5, 4, 8, 2, 1,
-    1, -2, -2, -1, -1, 2, 1, 1, 3, 2,
-    1, 0, -1, -4, -2, -5, -4, 0, 0, 1,
-    1, -2, -1, -5, -9, -8, -7, -3, -2, 0,
-    -1, 0, -4, -10, -8, -9, -7, -6, -5, 0,
-    -1, -5, -6, -7, -7, -10, -9, -8, -5, -6,
-    -8, -5, -5, -7, -7, -11, -8, -8, -11, -9,
-    -7, -3, -6, -5, -7, -6, -8, -12, -10, -8,
-    -8, -6, -7, -4, -5, -11
+static const uint8_t sound_face_down_data[] = {
+    0xc6, 0xff, 0x00, 0x00, 0xff, 0xb2, 0x70, 0x80, 0x08, 0x12, 0x99, 0x83, 0xb1, 0x87, 0x3a, 0x99,
+    0x4a, 0x09, 0xca, 0x87, 0x9a, 0x11, 0x0d, 0x28, 0xb9, 0x10, 0xc1, 0x3b, 0xb0, 0x03, 0x5b, 0x0a,
+    0xb4, 0x00, 0xf3, 0x52, 0x88, 0x5a, 0x90, 0xb1, 0x06, 0x2b, 0x12, 0x8a, 0x10, 0xb1, 0x4a, 0xb1,
+    0x13, 0x9a, 0x1e, 0x09, 0xf2, 0x81, 0x39, 0xf8, 0x81, 0x0a, 0x29, 0xb3, 0x0a, 0x07, 0x9c, 0x13,
+    0x19, 0x20, 0xc2, 0x79, 0xa8, 0x01, 0x32, 0x2a, 0x19, 0x08, 0xb2, 0x6c, 0xc0, 0x52, 0xd8, 0x91,
+    0x11, 0x1f, 0xa2, 0x90, 0x83, 0x9c, 0x02, 0xb0, 0x7b, 0x09, 0x91, 0x0a, 0x90, 0x12, 0x7a, 0x9a,
+    0x23, 0xda, 0x12, 0xb1, 0x33, 0x29, 0x1f, 0xc5, 0x08, 0x92, 0xb3, 0x49, 0x1c, 0x90, 0xa8, 0x01,
+    0x10, 0xf2, 0x3a, 0x3e, 0x9a, 0x21, 0xab, 0x97, 0xa0, 0x4b, 0x91, 0x0a, 0x85, 0x1a, 0xd2, 0x91,
+    0x60, 0x99, 0x11, 0x19, 0xc0, 0x91, 0x32, 0x3d, 0x19, 0xca, 0x52, 0xac, 0x83, 0x81, 0x3d, 0xb8,
+    0x4a, 0xc0, 0x88, 0x04, 0x9a, 0x09, 0xa1, 0x03, 0x1f, 0xc5, 0x02, 0x09, 0x8a, 0x85, 0x09, 0x22,
+    0x8c, 0x22, 0x8d, 0x21, 0xb3, 0x5c, 0x88, 0xa1, 0x3a, 0x2b, 0xb5, 0xa1, 0xb1, 0x11, 0xbc, 0x79,
+    0xb1, 0xd2, 0x12, 0x0f, 0x82, 0x09, 0x59, 0xa8, 0x91, 0x02, 0x5a, 0x89, 0x49, 0x10, 0xc9, 0x94,
+    0x11, 0xa8, 0x50, 0x19, 0x0b, 0xd6, 0x81, 0x02, 0x8b, 0x14, 0x1d, 0x88, 0xc1, 0x32, 0xb9, 0x18,
+    0x20, 0x2f, 0x8a, 0x95, 0x90, 0x19, 0xa2, 0x79, 0x89, 0x11, 0xc2, 0x28, 0xa3, 0x80, 0x34, 0x0f,
+    0x93, 0xb1, 0x30, 0xa0, 0x01, 0x2f, 0x00, 0xa1, 0x09, 0x18, 0x81, 0x9b, 0x70, 0xe0, 0x01, 0x01,
+    0x1b, 0xa7, 0x19, 0x81, 0xaa, 0x14, 0x19, 0x92, 0xf2, 0x31, 0x09, 0xa1, 0x53, 0x5b, 0x9c, 0x14,
+    0x7f, 0x00, 0x10, 0x00, 0x88, 0x11, 0xab, 0xa5, 0x98, 0x33, 0xbd, 0x22, 0x1c, 0x3b, 0xc6, 0x00,
+    0x08, 0x80, 0x39, 0x7a, 0xb8, 0x10, 0x91, 0x10, 0xb1, 0x7a, 0x98, 0xbb, 0x17, 0x0a, 0x11, 0xa8,
+    0x7b, 0x98, 0x82, 0x91, 0x00, 0xa9, 0x78, 0x3a, 0x0c, 0xd0, 0x02, 0x8c, 0x01, 0x92, 0x1f, 0x91,
+    0x09, 0x82, 0xb0, 0x85, 0x08, 0x79, 0x99, 0x83, 0x89, 0xb9, 0xa5, 0x28, 0x0e, 0x12, 0x99, 0x60,
+    0x91, 0x19, 0x89, 0x3b, 0xc5, 0x40, 0x08, 0xca, 0x82, 0x9d, 0xa1, 0xc8, 0x98, 0x00, 0x14, 0x43,
+    0x43, 0xc9, 0x08, 0x0d, 0x10, 0xd1, 0x33, 0xc9, 0x1c, 0x80, 0x0f, 0x91, 0x08, 0x11, 0x82, 0x17,
+    0x31, 0x20, 0x99, 0xca, 0xbd, 0xb9, 0xb1, 0x33, 0x9a, 0x80, 0xcf, 0x0b, 0x84, 0x52, 0x02, 0x62,
+    0x90, 0x31, 0x20, 0xe9, 0xb9, 0x8f, 0x99, 0x18, 0x81, 0x93, 0xb1, 0x8c, 0x71, 0x18, 0x14, 0x01,
+    0x10, 0xd1, 0x48, 0x80, 0x8a, 0x9f, 0xaa, 0x8a, 0x18, 0x15, 0x21, 0xc1, 0x19, 0x39, 0x12, 0x44,
+    0x91, 0xd2, 0x8d, 0x89, 0x11, 0x00, 0xdb, 0x0a, 0xbc, 0x63, 0x32, 0x14, 0xa1, 0x0b, 0x80, 0x50,
+    0x08, 0x99, 0xfd, 0x9b, 0x28, 0x20, 0x94, 0x8a, 0xa9, 0x98, 0x73, 0x27, 0x11, 0x98, 0x98, 0x09,
+    0x08, 0x08, 0x9b, 0xff, 0x9a, 0x80, 0x31, 0x10, 0x80, 0x98, 0x0c, 0x42, 0x56, 0x12, 0x80, 0x80,
+    0xaa, 0x08, 0x89, 0x90, 0xef, 0xaa, 0x90, 0x10, 0x81, 0x10, 0xca, 0x89, 0x72, 0x44, 0x13, 0x10,
+    0x91, 0x89, 0x0a, 0x10, 0xb9, 0xdf, 0xba, 0x9a, 0xb1, 0x80, 0x10, 0xcc, 0x19, 0x51, 0x37, 0x22,
+    0x12, 0x81, 0x89, 0xa9, 0x60, 0xa9, 0xaa, 0xbc, 0xad, 0xb9, 0x99, 0x80, 0x9c, 0x8b, 0x35, 0x45,
+    0x22, 0x14, 0x10, 0x80, 0x10, 0x52, 0xa0, 0xab, 0xe9, 0x9b, 0xad, 0xa8, 0xba, 0x9e, 0x9a, 0x61,
+    0x38, 0xfe, 0x23, 0x00, 0x11, 0x22, 0x11, 0x00, 0x23, 0x75, 0x02, 0x90, 0x89, 0xba, 0xcd, 0x8b,
+    0xb8, 0xae, 0xa9, 0x08, 0x32, 0x01, 0x46, 0x21, 0x03, 0x71, 0x22, 0x21, 0x99, 0xc9, 0xaa, 0xbf,
+    0x9a, 0xb9, 0xcc, 0x8b, 0x10, 0x04, 0x53, 0x32, 0x24, 0x31, 0x41, 0x25, 0x00, 0x91, 0xad, 0xeb,
+    0xca, 0xaa, 0xa9, 0xba, 0x8b, 0x21, 0x53, 0x54, 0x43, 0x33, 0x33, 0x22, 0x21, 0xa0, 0xa9, 0xcf,
+    0xeb, 0xbb, 0xbc, 0x9b, 0xaa, 0x88, 0x52, 0x42, 0x34, 0x44, 0x23, 0x33, 0x23, 0x81, 0x08, 0xea,
+    0xda, 0xac, 0xcc, 0xbb, 0xac, 0x99, 0x09, 0x21, 0x45, 0x33, 0x34, 0x34, 0x24, 0x23, 0x01, 0x80,
+    0xbb, 0xdd, 0xbb, 0xbd, 0xbd, 0xbb, 0x9b, 0x89, 0x31, 0x47, 0x32, 0x33, 0x43, 0x24, 0x23, 0x12,
+    0x92, 0xdb, 0xcd, 0xbb, 0xcb, 0xbc, 0xbb, 0xaa, 0x89, 0x50, 0x45, 0x24, 0x22, 0x23, 0x33, 0x22,
+    0x22, 0x91, 0xed, 0xbc, 0xbb, 0xbc, 0xcb, 0x9a, 0xa9, 0x88, 0x51, 0x46, 0x23, 0x32, 0x31, 0x12,
+    0x10, 0x12, 0x91, 0xee, 0xbc, 0xab, 0xba, 0xaa, 0x89, 0x88, 0x9a, 0x61, 0x47, 0x23, 0x22, 0x12,
+    0x00, 0x8a, 0x10, 0x02, 0xfb, 0xbe, 0xbb, 0xaa, 0x8b, 0x20, 0x02, 0xa9, 0x38, 0x67, 0x33, 0x33,
+    0x22, 0x91, 0xcb, 0x19, 0x12, 0xb8, 0xdf, 0xba, 0xab, 0xab, 0x38, 0x13, 0xb0, 0x1b, 0x55, 0x35,
+    0x33, 0x43, 0x81, 0xb9, 0x0a, 0x24, 0x90, 0xdc, 0xac, 0xac, 0xab, 0x19, 0x12, 0xb8, 0xac, 0x41,
+    0x54, 0x34, 0x32, 0x12, 0xa9, 0x8a, 0x44, 0x01, 0xb8, 0xce, 0xcb, 0xab, 0x89, 0x21, 0xa8, 0xcb,
+    0x09, 0x72, 0x44, 0x23, 0x22, 0x90, 0xa9, 0x20, 0x15, 0x81, 0xfa, 0xcb, 0xac, 0x99, 0x08, 0x02,
+    0xa9, 0xaa, 0x30, 0x66, 0x33, 0x24, 0x01, 0x99, 0x89, 0x31, 0x21, 0xd9, 0xcd, 0xbc, 0xba, 0x99,
+    0x79, 0xcf, 0x3f, 0x00, 0x11, 0xa8, 0x8a, 0x61, 0x35, 0x24, 0x33, 0x02, 0xa8, 0x0a, 0x32, 0x90,
+    0xfc, 0xac, 0xac, 0xab, 0x8a, 0x21, 0x90, 0xaa, 0x52, 0x55, 0x23, 0x23, 0x23, 0x90, 0x9b, 0x32,
+    0x03, 0xed, 0xbc, 0xcb, 0xba, 0x9b, 0x12, 0x82, 0xdb, 0x38, 0x45, 0x34, 0x32, 0x23, 0x00, 0xba,
+    0x48, 0x04, 0xb8, 0xaf, 0xcb, 0xab, 0xab, 0x18, 0x02, 0xb9, 0x0d, 0x34, 0x45, 0x23, 0x33, 0x02,
+    0xa0, 0x1a, 0x25, 0x80, 0xcd, 0xbb, 0xbe, 0xa9, 0x89, 0x81, 0x98, 0xcb, 0x40, 0x34, 0x27, 0x22,
+    0x11, 0x80, 0x88, 0x41, 0x02, 0xc8, 0xbd, 0xbc, 0x9c, 0xa9, 0x18, 0x98, 0xc9, 0x0b, 0x52, 0x45,
+    0x14, 0x22, 0x80, 0x80, 0x19, 0x24, 0x02, 0xfb, 0xbb, 0xad, 0x99, 0x0a, 0x00, 0x98, 0xbc, 0x2a,
+    0x54, 0x35, 0x23, 0x03, 0x00, 0xa8, 0x59, 0x23, 0x92, 0xbf, 0xcb, 0x9c, 0xa9, 0x18, 0x80, 0xa8,
+    0x9e, 0x10, 0x44, 0x24, 0x42, 0x01, 0x80, 0x8a, 0x40, 0x13, 0xc0, 0xad, 0xcb, 0xab, 0x8a, 0x10,
+    0x90, 0xe9, 0x8c, 0x21, 0x34, 0x35, 0x24, 0x80, 0x90, 0x09, 0x31, 0x15, 0xc8, 0xac, 0xbc, 0xab,
+    0x09, 0x11, 0x98, 0xfb, 0x8c, 0x10, 0x44, 0x43, 0x23, 0x88, 0xa8, 0x08, 0x52, 0x33, 0xc0, 0xbc,
+    0xcc, 0xaa, 0x88, 0x20, 0xa8, 0xfa, 0x9c, 0x10, 0x33, 0x36, 0x33, 0x90, 0xa0, 0x08, 0x51, 0x24,
+    0x92, 0xad, 0xbc, 0xbb, 0x8a, 0x18, 0xa0, 0xf9, 0x9d, 0x08, 0x43, 0x34, 0x43, 0x01, 0x98, 0x89,
+    0x31, 0x53, 0x93, 0xcb, 0xbd, 0xbc, 0xaa, 0x18, 0x00, 0xc9, 0xbc, 0x2a, 0x35, 0x44, 0x34, 0x12,
+    0xa8, 0x89, 0x28, 0x33, 0x05, 0xc9, 0xbd, 0xdb, 0xaa, 0x08, 0x00, 0x90, 0xcb, 0x0b, 0x53, 0x35,
+    0x44, 0x12, 0x90, 0x99, 0x19, 0x22, 0x16, 0xa8, 0xcc, 0xcb, 0xba, 0x09, 0x10, 0x81, 0xbc, 0x9c,
+    0x48, 0xc9, 0x3d, 0x00, 0x34, 0x35, 0x44, 0x01, 0xa8, 0x98, 0x38, 0x43, 0x03, 0xda, 0xbc, 0xcc,
+    0x9b, 0x18, 0x11, 0xa8, 0xdb, 0x0a, 0x24, 0x53, 0x54, 0x02, 0x98, 0x89, 0x10, 0x22, 0x14, 0xa9,
+    0xec, 0xcb, 0x9a, 0x09, 0x01, 0x00, 0xcb, 0x9a, 0x41, 0x63, 0x63, 0x12, 0x80, 0x99, 0x08, 0x31,
+    0x33, 0xa0, 0xed, 0xcb, 0xab, 0x09, 0x10, 0x10, 0xb9, 0xae, 0x28, 0x43, 0x45, 0x24, 0x91, 0x98,
+    0x89, 0x30, 0x33, 0x84, 0xcb, 0xce, 0xba, 0x99, 0x10, 0x11, 0xa0, 0xbe, 0x09, 0x32, 0x54, 0x44,
+    0x02, 0x98, 0x99, 0x10, 0x33, 0x32, 0xc8, 0xec, 0xac, 0x9a, 0x88, 0x80, 0x18, 0xdb, 0x9a, 0x40,
+    0x53, 0x24, 0x23, 0x01, 0x90, 0x00, 0x63, 0x22, 0xc9, 0xbb, 0xbd, 0xac, 0x9a, 0x89, 0x89, 0xea,
+    0x8a, 0x41, 0x33, 0x35, 0x25, 0x11, 0x08, 0x08, 0x42, 0x23, 0xc8, 0xac, 0xbc, 0xbd, 0x9a, 0x08,
+    0x88, 0xca, 0xab, 0x22, 0x33, 0x75, 0x25, 0x02, 0x09, 0x18, 0x00, 0x21, 0x22, 0xc0, 0xdd, 0xac,
+    0x99, 0xa8, 0x09, 0x08, 0xe8, 0x99, 0x38, 0x63, 0x33, 0x24, 0x20, 0x80, 0x09, 0x72, 0x13, 0xb0,
+    0xcb, 0xcb, 0xbc, 0xaa, 0x28, 0xa8, 0xdc, 0x8a, 0x10, 0x20, 0x46, 0x25, 0x01, 0x08, 0x11, 0x11,
+    0x32, 0x13, 0xeb, 0xbd, 0xbc, 0x9a, 0x89, 0x80, 0xb9, 0xbc, 0x9a, 0x38, 0x57, 0x34, 0x13, 0x00,
+    0x80, 0x00, 0x50, 0x33, 0xa1, 0xce, 0xbb, 0xac, 0x9a, 0x20, 0x91, 0xca, 0x9d, 0x89, 0x31, 0x46,
+    0x34, 0x02, 0x88, 0x08, 0x00, 0x53, 0x12, 0xc0, 0xbd, 0xbc, 0x9b, 0x08, 0x01, 0x9a, 0xeb, 0xaa,
+    0x19, 0x73, 0x35, 0x22, 0x18, 0x80, 0x00, 0x38, 0x26, 0x91, 0xeb, 0xab, 0xcb, 0x99, 0x19, 0x81,
+    0xc9, 0xbc, 0x09, 0x20, 0x46, 0x44, 0x12, 0x80, 0x18, 0x08, 0x21, 0x14, 0x98, 0xbe, 0xeb, 0x9a,
+    0xb2, 0xe0, 0x44, 0x00, 0x88, 0x01, 0x98, 0xdb, 0x89, 0x09, 0x63, 0x45, 0x13, 0x00, 0x80, 0x88,
+    0x19, 0x15, 0x02, 0xea, 0xcb, 0xab, 0xa9, 0x09, 0x12, 0xa0, 0xbf, 0x98, 0x28, 0x64, 0x34, 0x12,
+    0x01, 0x89, 0x98, 0x50, 0x12, 0x90, 0xcd, 0xcb, 0xab, 0x99, 0x30, 0x81, 0xeb, 0x9b, 0x80, 0x58,
+    0x45, 0x25, 0x00, 0x90, 0x80, 0x98, 0x32, 0x12, 0xd8, 0xbd, 0xcb, 0x9a, 0x89, 0x22, 0x80, 0xcd,
+    0x8a, 0x00, 0x63, 0x44, 0x23, 0x00, 0x89, 0x88, 0x08, 0x34, 0x01, 0xfb, 0xcb, 0xab, 0x9a, 0x18,
+    0x12, 0xb9, 0xbe, 0x89, 0x00, 0x46, 0x35, 0x13, 0x88, 0x08, 0x08, 0x19, 0x25, 0x82, 0xbe, 0xbc,
+    0xba, 0x99, 0x29, 0x02, 0xd8, 0xad, 0x08, 0x11, 0x45, 0x35, 0x03, 0x80, 0x09, 0x88, 0x28, 0x14,
+    0x91, 0xce, 0xcb, 0xab, 0x98, 0x28, 0x82, 0xc0, 0xad, 0x08, 0x30, 0x46, 0x35, 0x01, 0x80, 0x89,
+    0x98, 0x38, 0x24, 0x90, 0xce, 0xcb, 0x9a, 0x99, 0x31, 0x12, 0xe9, 0x9b, 0x89, 0x40, 0x55, 0x24,
+    0x01, 0x98, 0x89, 0x89, 0x40, 0x23, 0xc2, 0xbd, 0xbc, 0xaa, 0x89, 0x52, 0x01, 0xd9, 0x9b, 0x88,
+    0x31, 0x47, 0x24, 0x80, 0x98, 0x89, 0x88, 0x41, 0x13, 0xc1, 0xbd, 0xbc, 0x8a, 0x09, 0x24, 0x81,
+    0xdb, 0xaa, 0x88, 0x52, 0x55, 0x13, 0x80, 0x99, 0x98, 0x09, 0x63, 0x21, 0xc9, 0xdb, 0xab, 0x8a,
+    0x28, 0x24, 0x80, 0xcd, 0x89, 0x09, 0x42, 0x46, 0x02, 0x90, 0x89, 0x89, 0x29, 0x34, 0x13, 0xcc,
+    0xbc, 0xbb, 0x8a, 0x40, 0x14, 0xb0, 0xae, 0x89, 0x08, 0x44, 0x35, 0x82, 0x88, 0x99, 0x89, 0x40,
+    0x24, 0x92, 0xeb, 0xbc, 0xaa, 0x88, 0x42, 0x02, 0xc9, 0xac, 0x89, 0x38, 0x65, 0x14, 0x81, 0x98,
+    0x98, 0x09, 0x41, 0x23, 0xb1, 0xce, 0xab, 0x9a, 0x08, 0x43, 0x02, 0xcc, 0x9b, 0x89, 0x41, 0x55,
+    0xc2, 0x24, 0x4b, 0x00, 0x01, 0x88, 0x99, 0x89, 0x30, 0x25, 0x82, 0xcc, 0xbc, 0xab, 0x88, 0x42,
+    0x12, 0xd8, 0xac, 0x89, 0x28, 0x55, 0x24, 0x00, 0x98, 0x89, 0x89, 0x51, 0x32, 0xa0, 0xbd, 0xbd,
+    0x99, 0x09, 0x43, 0x01, 0xea, 0xaa, 0x88, 0x30, 0x56, 0x13, 0x00, 0x99, 0x99, 0x08, 0x53, 0x23,
+    0xc9, 0xcc, 0xbb, 0x9a, 0x28, 0x25, 0x91, 0xcc, 0x9a, 0x88, 0x52, 0x45, 0x12, 0x88, 0x89, 0x99,
+    0x28, 0x34, 0x13, 0xeb, 0xbc, 0x9c, 0x89, 0x20, 0x14, 0xa0, 0xae, 0x99, 0x08, 0x44, 0x26, 0x01,
+    0x98, 0x98, 0x99, 0x31, 0x34, 0x92, 0xbd, 0xbd, 0x9a, 0x89, 0x42, 0x12, 0xd9, 0x9c, 0x99, 0x20,
+    0x55, 0x24, 0x80, 0x98, 0x99, 0x88, 0x43, 0x32, 0xc0, 0xcc, 0xbb, 0x9a, 0x19, 0x25, 0x81, 0xeb,
+    0x9a, 0x89, 0x42, 0x46, 0x12, 0x88, 0x98, 0x99, 0x18, 0x34, 0x03, 0xda, 0xcc, 0xaa, 0x9a, 0x30,
+    0x24, 0xa0, 0xae, 0x8a, 0x19, 0x73, 0x34, 0x02, 0x98, 0xa9, 0x89, 0x40, 0x24, 0x81, 0xcc, 0xcb,
+    0x9b, 0x89, 0x42, 0x12, 0xd9, 0xbb, 0x99, 0x30, 0x57, 0x23, 0x81, 0x98, 0x9a, 0x09, 0x53, 0x23,
+    0xb8, 0xbe, 0xbc, 0x9a, 0x29, 0x34, 0x81, 0xbd, 0xab, 0x89, 0x72, 0x35, 0x13, 0x88, 0x99, 0xaa,
+    0x30, 0x44, 0x02, 0xda, 0xbc, 0xbb, 0x9a, 0x51, 0x22, 0xc0, 0xbb, 0x9b, 0x29, 0x66, 0x24, 0x01,
+    0x98, 0x99, 0x89, 0x41, 0x33, 0xa0, 0xcd, 0xcb, 0xaa, 0x09, 0x43, 0x02, 0xcb, 0xab, 0xaa, 0x51,
+    0x56, 0x13, 0x80, 0x89, 0xa9, 0x08, 0x34, 0x13, 0xca, 0xbd, 0xac, 0x9a, 0x38, 0x24, 0xa0, 0xbc,
+    0x9b, 0x0a, 0x55, 0x36, 0x01, 0x80, 0x99, 0x9a, 0x31, 0x34, 0xa2, 0xcc, 0xbc, 0xbb, 0x8a, 0x62,
+    0x11, 0xc9, 0xaa, 0xa9, 0x48, 0x65, 0x13, 0x00, 0x98, 0xa8, 0x09, 0x43, 0x23, 0xc9, 0xbd, 0xcb,
+    0x60, 0xd3, 0x47, 0x00, 0x99, 0x42, 0x02, 0xb9, 0xbc, 0x99, 0x38, 0x57, 0x14, 0x81, 0x88, 0x99,
+    0x09, 0x42, 0x13, 0xc8, 0xbc, 0xbc, 0xaa, 0x18, 0x25, 0x91, 0xbc, 0x9a, 0x8a, 0x72, 0x45, 0x02,
+    0x88, 0x88, 0x99, 0x28, 0x34, 0x82, 0xcc, 0xac, 0xab, 0x9a, 0x51, 0x12, 0xc8, 0xbb, 0x99, 0x29,
+    0x57, 0x24, 0x00, 0x89, 0x98, 0x89, 0x42, 0x23, 0xc0, 0xbd, 0xab, 0xab, 0x19, 0x35, 0x91, 0xcc,
+    0x9a, 0x98, 0x61, 0x54, 0x12, 0x88, 0x98, 0x89, 0x18, 0x34, 0x03, 0xcc, 0xbc, 0xaa, 0x9a, 0x40,
+    0x23, 0xd8, 0xac, 0x98, 0x08, 0x64, 0x34, 0x81, 0x88, 0x89, 0x89, 0x41, 0x24, 0xa0, 0xbe, 0xba,
+    0xaa, 0x09, 0x53, 0x82, 0xdb, 0x9b, 0x98, 0x50, 0x55, 0x12, 0x80, 0x89, 0x89, 0x08, 0x34, 0x13,
+    0xfa, 0xab, 0xab, 0x9b, 0x30, 0x25, 0xa8, 0xbd, 0x99, 0x09, 0x64, 0x44, 0x01, 0x98, 0x98, 0x88,
+    0x30, 0x34, 0x91, 0xbe, 0xbb, 0xbb, 0x89, 0x62, 0x02, 0xd9, 0x9b, 0x89, 0x38, 0x56, 0x14, 0x00,
+    0x89, 0x89, 0x09, 0x52, 0x22, 0xc8, 0xbc, 0xbb, 0xaa, 0x29, 0x26, 0x80, 0xcc, 0x99, 0x88, 0x51,
+    0x45, 0x02, 0x88, 0x98, 0x98, 0x28, 0x34, 0x03, 0xdc, 0xbb, 0xbb, 0x8a, 0x50, 0x13, 0xc8, 0xac,
+    0x99, 0x19, 0x65, 0x24, 0x81, 0x88, 0x89, 0x89, 0x41, 0x33, 0xb0, 0xbe, 0xac, 0x9b, 0x09, 0x43,
+    0x82, 0xeb, 0x9a, 0x98, 0x40, 0x55, 0x13, 0x80, 0x98, 0x98, 0x09, 0x44, 0x12, 0xd9, 0xcb, 0xba,
+    0x9a, 0x38, 0x24, 0xa0, 0xbd, 0x8a, 0x0a, 0x73, 0x36, 0x01, 0x80, 0x89, 0x99, 0x20, 0x26, 0x91,
+    0xdb, 0xab, 0xbb, 0x8a, 0x52, 0x02, 0xd9, 0x9b, 0x98, 0x39, 0x66, 0x23, 0x81, 0x98, 0x98, 0x09,
+    0x61, 0x22, 0xb8, 0xbd, 0xac, 0xaa, 0x08, 0x24, 0x91, 0xdb, 0x9a, 0x98, 0x61, 0x45, 0x12, 0x80,
+    0xe9, 0x2f, 0x48, 0x00, 0x98, 0x98, 0x31, 0x25, 0xb0, 0xcc, 0xbb, 0xab, 0x0a, 0x44, 0x81, 0xcb,
+    0x9b, 0x99, 0x51, 0x46, 0x23, 0x80, 0x98, 0x89, 0x09, 0x63, 0x12, 0xca, 0xbc, 0xbb, 0xaa, 0x28,
+    0x16, 0xa0, 0xcb, 0x99, 0x89, 0x73, 0x45, 0x01, 0x80, 0x98, 0x98, 0x28, 0x34, 0x81, 0xdc, 0xba,
+    0xba, 0x9a, 0x41, 0x13, 0xca, 0xac, 0x98, 0x29, 0x56, 0x34, 0x81, 0x80, 0x89, 0x99, 0x50, 0x23,
+    0xb0, 0xbe, 0xbb, 0xbb, 0x89, 0x44, 0x81, 0xcb, 0x9b, 0x99, 0x51, 0x56, 0x22, 0x80, 0x88, 0x98,
+    0x09, 0x52, 0x12, 0xd9, 0xcb, 0xba, 0x9b, 0x28, 0x24, 0xa0, 0xcc, 0x99, 0x89, 0x73, 0x35, 0x03,
+    0x80, 0x98, 0x99, 0x29, 0x35, 0x82, 0xcd, 0xba, 0xbb, 0x9b, 0x51, 0x12, 0xb9, 0xad, 0x89, 0x29,
+    0x65, 0x34, 0x01, 0x88, 0x89, 0x99, 0x40, 0x24, 0xa0, 0xcd, 0xba, 0xaa, 0x0a, 0x43, 0x02, 0xdb,
+    0x9b, 0x99, 0x50, 0x55, 0x23, 0x81, 0x98, 0x99, 0x89, 0x53, 0x13, 0xc9, 0xbd, 0xbb, 0xab, 0x28,
+    0x25, 0x90, 0xdb, 0x9a, 0x89, 0x63, 0x55, 0x02, 0x80, 0x98, 0x98, 0x08, 0x34, 0x82, 0xeb, 0xab,
+    0xac, 0x9a, 0x30, 0x14, 0xa8, 0xad, 0x99, 0x08, 0x64, 0x35, 0x01, 0x88, 0x88, 0x99, 0x38, 0x25,
+    0x90, 0xbd, 0xcb, 0xab, 0x89, 0x42, 0x02, 0xca, 0x9c, 0x99, 0x38, 0x57, 0x23, 0x01, 0x88, 0x99,
+    0x99, 0x52, 0x13, 0xc8, 0xad, 0xbb, 0xab, 0x1a, 0x44, 0x80, 0xcb, 0x8b, 0x99, 0x52, 0x56, 0x13,
+    0x08, 0x88, 0x99, 0x09, 0x43, 0x12, 0xfa, 0xba, 0xba, 0x9b, 0x28, 0x15, 0xa0, 0xbc, 0x8a, 0x09,
+    0x64, 0x45, 0x02, 0x08, 0x89, 0x98, 0x29, 0x24, 0x81, 0xbd, 0xcb, 0xbb, 0x9b, 0x51, 0x12, 0xb9,
+    0xad, 0x98, 0x29, 0x65, 0x34, 0x01, 0x88, 0x88, 0xa9, 0x30, 0x25, 0xa0, 0xae, 0xbb, 0xbb, 0x8a,
+    0x3d, 0xd3, 0x40, 0x00, 0x25, 0xa8, 0xcc, 0x88, 0x09, 0x52, 0x37, 0x12, 0x88, 0x88, 0xa8, 0x19,
+    0x34, 0x82, 0xbe, 0xbb, 0xcb, 0xaa, 0x41, 0x13, 0xc9, 0xac, 0x88, 0x19, 0x74, 0x25, 0x01, 0x88,
+    0x80, 0x9a, 0x38, 0x33, 0xc2, 0xae, 0xba, 0xbb, 0x9b, 0x53, 0x02, 0xda, 0x9b, 0xa0, 0x38, 0x67,
+    0x23, 0x00, 0x08, 0x98, 0xaa, 0x42, 0x23, 0xd9, 0xac, 0xbb, 0xcb, 0x19, 0x24, 0x91, 0xcc, 0x89,
+    0x89, 0x40, 0x57, 0x02, 0x80, 0x80, 0xa8, 0x09, 0x42, 0x83, 0xdb, 0xab, 0xbb, 0xbc, 0x40, 0x33,
+    0xd8, 0xbb, 0x88, 0x89, 0x72, 0x37, 0x01, 0x88, 0x80, 0x99, 0x19, 0x34, 0x92, 0xae, 0xab, 0xba,
+    0x9c, 0x42, 0x13, 0xda, 0x9b, 0x89, 0x19, 0x74, 0x16, 0x81, 0x88, 0x90, 0x98, 0x28, 0x24, 0xb0,
+    0xcc, 0xa9, 0xba, 0x0b, 0x44, 0x82, 0xdb, 0x9a, 0x88, 0x10, 0x75, 0x14, 0x80, 0x89, 0x80, 0x89,
+    0x30, 0x33, 0xd8, 0xbc, 0xab, 0xba, 0x1a, 0x26, 0x91, 0xeb, 0x99, 0x88, 0x21, 0x57, 0x12, 0x88,
+    0x80, 0x98, 0x0a, 0x42, 0x13, 0xdb, 0xbb, 0xab, 0xbc, 0x49, 0x24, 0xb0, 0xbd, 0x09, 0x88, 0x41,
+    0x57, 0x02, 0x98, 0x80, 0x98, 0x19, 0x32, 0x84, 0xdb, 0xbb, 0xaa, 0xbb, 0x60, 0x22, 0xd8, 0xab,
+    0x98, 0x18, 0x72, 0x27, 0x81, 0x88, 0x80, 0x99, 0x28, 0x42, 0xa1, 0xbc, 0xbb, 0xbb, 0x9d, 0x43,
+    0x12, 0xdb, 0x9b, 0x88, 0x19, 0x75, 0x15, 0x80, 0x08, 0x88, 0x99, 0x20, 0x43, 0xb8, 0xbc, 0xab,
+    0xdb, 0x0a, 0x34, 0x92, 0xcc, 0x8a, 0x88, 0x10, 0x67, 0x12, 0x80, 0x88, 0x98, 0x89, 0x22, 0x15,
+    0xc9, 0xbb, 0xaa, 0xbc, 0x39, 0x34, 0xb1, 0xbe, 0x09, 0x89, 0x41, 0x57, 0x02, 0x88, 0x08, 0x99,
+    0x19, 0x32, 0x84, 0xcb, 0xac, 0xaa, 0xac, 0x40, 0x23, 0xc9, 0x9d, 0x08, 0x09, 0x61, 0x26, 0x01,
+    0xad, 0x37, 0x4c, 0x00, 0x88, 0x90, 0x89, 0x21, 0x15, 0xb9, 0xbc, 0xaa, 0xbb, 0x3a, 0x45, 0xa0,
+    0xad, 0x89, 0x88, 0x50, 0x37, 0x02, 0x88, 0x08, 0xa9, 0x19, 0x43, 0x83, 0xdb, 0xac, 0xba, 0xbb,
+    0x41, 0x24, 0xd9, 0xab, 0x80, 0x89, 0x72, 0x27, 0x01, 0x88, 0x88, 0x99, 0x18, 0x53, 0xa1, 0xcb,
+    0xaa, 0xca, 0x8b, 0x42, 0x03, 0xeb, 0x9a, 0x90, 0x00, 0x75, 0x23, 0x80, 0x08, 0x99, 0x8a, 0x31,
+    0x34, 0xb8, 0xbe, 0xaa, 0xbc, 0x1a, 0x34, 0xa2, 0xbd, 0x89, 0x99, 0x48, 0x67, 0x02, 0x80, 0x08,
+    0x99, 0x09, 0x31, 0x14, 0xca, 0xac, 0xa9, 0xac, 0x28, 0x24, 0xc0, 0xbb, 0x89, 0x88, 0x71, 0x27,
+    0x02, 0x88, 0x90, 0x99, 0x18, 0x52, 0x92, 0xcb, 0xab, 0xcb, 0xab, 0x43, 0x13, 0xeb, 0x9a, 0x98,
+    0x88, 0x75, 0x14, 0x81, 0x08, 0x98, 0x99, 0x11, 0x34, 0xa8, 0xcc, 0xaa, 0xcb, 0x0a, 0x43, 0x82,
+    0xbd, 0x8a, 0x98, 0x20, 0x77, 0x12, 0x80, 0x88, 0x98, 0x09, 0x21, 0x14, 0xc9, 0xbb, 0xbb, 0xbd,
+    0x38, 0x43, 0xb8, 0xad, 0x89, 0x89, 0x71, 0x27, 0x01, 0x80, 0x88, 0x99, 0x18, 0x42, 0x91, 0xda,
+    0xab, 0xca, 0x9b, 0x32, 0x14, 0xda, 0xaa, 0x98, 0x08, 0x76, 0x13, 0x01, 0x08, 0x99, 0x8a, 0x21,
+    0x34, 0xb9, 0xcc, 0xab, 0xcc, 0x2a, 0x42, 0x91, 0xbc, 0x89, 0x99, 0x38, 0x77, 0x03, 0x80, 0x80,
+    0x99, 0x09, 0x32, 0x05, 0xba, 0xbc, 0xb9, 0xbc, 0x38, 0x34, 0xc8, 0x9d, 0x89, 0x09, 0x70, 0x25,
+    0x02, 0x08, 0x98, 0x99, 0x10, 0x53, 0x91, 0xcb, 0xac, 0xba, 0x9c, 0x32, 0x14, 0xdb, 0xaa, 0x88,
+    0x18, 0x75, 0x23, 0x01, 0x88, 0xa8, 0x89, 0x31, 0x34, 0xb9, 0xbe, 0xbb, 0xbc, 0x19, 0x44, 0xa1,
+    0xcb, 0x8a, 0x99, 0x50, 0x47, 0x11, 0x80, 0x90, 0xa8, 0x19, 0x42, 0x03, 0xda, 0xbb, 0xba, 0xad,
+    0x1c, 0xc9, 0x45, 0x00, 0x33, 0x82, 0xbd, 0xab, 0x99, 0x30, 0x77, 0x13, 0x00, 0x80, 0xa9, 0x19,
+    0x32, 0x14, 0xca, 0xcb, 0xbb, 0xad, 0x28, 0x33, 0xc8, 0xac, 0x99, 0x89, 0x71, 0x27, 0x02, 0x80,
+    0x90, 0x99, 0x18, 0x42, 0xa2, 0xdb, 0xab, 0xcb, 0x9b, 0x42, 0x13, 0xdb, 0xaa, 0x98, 0x08, 0x76,
+    0x23, 0x00, 0x08, 0xa8, 0x99, 0x31, 0x25, 0xb8, 0xad, 0xaa, 0xbc, 0x1b, 0x34, 0xa2, 0xbd, 0x8a,
+    0xa9, 0x38, 0x77, 0x13, 0x08, 0x00, 0x99, 0x89, 0x33, 0x06, 0xba, 0xac, 0xa9, 0xbc, 0x39, 0x43,
+    0xc8, 0xac, 0x88, 0x89, 0x61, 0x27, 0x02, 0x88, 0x00, 0xa9, 0x18, 0x43, 0xa2, 0xcc, 0xaa, 0xca,
+    0xab, 0x42, 0x13, 0xdb, 0xaa, 0x08, 0x09, 0x74, 0x16, 0x81, 0x08, 0x90, 0x99, 0x20, 0x33, 0xb9,
+    0xae, 0x9b, 0xcb, 0x0a, 0x43, 0x93, 0xbd, 0x8a, 0x98, 0x18, 0x77, 0x12, 0x80, 0x00, 0xa8, 0x89,
+    0x31, 0x15, 0xba, 0xbc, 0x99, 0xbd, 0x29, 0x34, 0xb0, 0xad, 0x89, 0x98, 0x48, 0x57, 0x02, 0x88,
+    0x00, 0x99, 0x09, 0x52, 0x82, 0xca, 0xab, 0xb9, 0xbc, 0x30, 0x25, 0xc9, 0x9c, 0x88, 0x89, 0x71,
+    0x26, 0x00, 0x08, 0x80, 0xa9, 0x10, 0x52, 0xa1, 0xcb, 0x9a, 0xca, 0x9c, 0x32, 0x04, 0xcb, 0x9a,
+    0x88, 0x89, 0x75, 0x14, 0x81, 0x08, 0x88, 0x9a, 0x20, 0x25, 0xb8, 0xcb, 0x9a, 0xdb, 0x0a, 0x43,
+    0x92, 0xad, 0x99, 0x90, 0x1a, 0x77, 0x02, 0x80, 0x18, 0x98, 0x8a, 0x41, 0x03, 0xc9, 0xbb, 0xa9,
+    0xcc, 0x29, 0x43, 0xc1, 0xbb, 0x89, 0x98, 0x69, 0x37, 0x03, 0x88, 0x00, 0x9a, 0x09, 0x53, 0x93,
+    0xdb, 0xab, 0xb9, 0xad, 0x30, 0x34, 0xda, 0x9b, 0x88, 0x98, 0x71, 0x27, 0x00, 0x88, 0x80, 0x99,
+    0x00, 0x34, 0xa0, 0xdb, 0x9b, 0xc9, 0x8b, 0x43, 0x03, 0xcc, 0x8a, 0x88, 0x89, 0x76, 0x22, 0x88,
+    0x57, 0x19, 0x4c, 0x00, 0x18, 0x81, 0x99, 0x41, 0x04, 0xc8, 0xac, 0x88, 0xa8, 0x0a, 0x63, 0xa1,
+    0xae, 0x19, 0x01, 0x89, 0x71, 0x14, 0x90, 0x09, 0x11, 0xa9, 0x28, 0x26, 0xb0, 0xbc, 0x0a, 0xa0,
+    0x9c, 0x41, 0x03, 0xce, 0x89, 0x21, 0xa8, 0x38, 0x47, 0x81, 0x8a, 0x22, 0xa0, 0x0a, 0x63, 0x92,
+    0xbc, 0x9b, 0x81, 0xcb, 0x29, 0x25, 0xe9, 0x9b, 0x21, 0x90, 0x09, 0x65, 0x12, 0x99, 0x10, 0x03,
+    0xbb, 0x51, 0x24, 0xea, 0x9a, 0x08, 0xa8, 0x8b, 0x43, 0xa1, 0xaf, 0x19, 0x02, 0x99, 0x40, 0x36,
+    0x80, 0x09, 0x33, 0xc0, 0x1a, 0x63, 0xb1, 0xad, 0x88, 0x88, 0xca, 0x20, 0x22, 0xfb, 0x8b, 0x21,
+    0x88, 0x0a, 0x45, 0x14, 0x88, 0x30, 0x04, 0xbb, 0x40, 0x14, 0xda, 0xaa, 0x08, 0xb8, 0x8d, 0x31,
+    0xa1, 0xaf, 0x19, 0x02, 0xa9, 0x40, 0x45, 0x01, 0x18, 0x32, 0xb1, 0x8d, 0x42, 0x92, 0xcc, 0x89,
+    0x88, 0xcb, 0x1a, 0x24, 0xd9, 0x8c, 0x11, 0x98, 0x0a, 0x73, 0x14, 0x81, 0x10, 0x13, 0xcb, 0x2a,
+    0x35, 0xc8, 0xab, 0x09, 0xc8, 0x9d, 0x30, 0x83, 0xbd, 0x09, 0x01, 0xba, 0x30, 0x67, 0x12, 0x08,
+    0x20, 0xa2, 0x9d, 0x31, 0x05, 0xda, 0x89, 0x88, 0xca, 0x09, 0x42, 0xb0, 0xac, 0x00, 0x90, 0x0a,
+    0x63, 0x35, 0x82, 0x00, 0x22, 0xd9, 0x1b, 0x44, 0xa2, 0xad, 0x89, 0x98, 0xac, 0x28, 0x24, 0xda,
+    0x8b, 0x10, 0x99, 0x39, 0x55, 0x33, 0x00, 0x10, 0x12, 0xeb, 0x39, 0x26, 0xc8, 0xaa, 0x88, 0xba,
+    0xab, 0x52, 0x82, 0xbd, 0x0a, 0x80, 0x89, 0x62, 0x33, 0x34, 0x02, 0x10, 0x03, 0xcc, 0x50, 0x13,
+    0xea, 0x9a, 0x99, 0xba, 0x0b, 0x12, 0xa3, 0xbf, 0x89, 0x00, 0x11, 0x32, 0x55, 0x16, 0x81, 0x10,
+    0x82, 0xca, 0x40, 0x13, 0xeb, 0x9a, 0x99, 0xb9, 0x9b, 0x32, 0x94, 0xbe, 0x09, 0x11, 0x90, 0x30,
+    0xc4, 0xea, 0x38, 0x00, 0x67, 0x01, 0x00, 0x12, 0xc8, 0x2a, 0x24, 0xd1, 0x9b, 0xa8, 0xb9, 0xad,
+    0x10, 0x23, 0xfa, 0x89, 0x00, 0x90, 0x29, 0x33, 0x47, 0x12, 0x01, 0x02, 0xda, 0x39, 0x14, 0xd0,
+    0x8a, 0xb9, 0xac, 0x9a, 0x11, 0x42, 0xc9, 0x9a, 0x89, 0xa9, 0x51, 0x23, 0x47, 0x23, 0x80, 0x80,
+    0xb9, 0x40, 0x23, 0xd0, 0xaa, 0xcd, 0x9a, 0x89, 0x18, 0x63, 0xc8, 0xaa, 0x99, 0x08, 0x31, 0x03,
+    0x76, 0x13, 0x90, 0x18, 0x91, 0x2a, 0x42, 0xb3, 0xbd, 0xbd, 0x09, 0xa9, 0x08, 0x54, 0xd0, 0xab,
+    0x09, 0x00, 0x11, 0x01, 0x66, 0x12, 0x98, 0x20, 0xa2, 0x0a, 0x34, 0xa4, 0xae, 0xaa, 0x08, 0xb9,
+    0x29, 0x54, 0xd8, 0x9b, 0x08, 0x08, 0x10, 0x81, 0x72, 0x16, 0x88, 0x28, 0x92, 0x8b, 0x34, 0x83,
+    0xbd, 0xa9, 0x99, 0xca, 0x19, 0x34, 0xd0, 0xac, 0x89, 0x89, 0x08, 0x01, 0x73, 0x17, 0x80, 0x10,
+    0x82, 0x9a, 0x34, 0x04, 0xac, 0xaa, 0x9a, 0xba, 0x29, 0x52, 0xc2, 0x9e, 0x99, 0x88, 0x09, 0x14,
+    0x28, 0x36, 0x02, 0x08, 0x24, 0x99, 0x11, 0x73, 0xb8, 0xba, 0x9c, 0xa0, 0x8a, 0x08, 0x16, 0xeb,
+    0xaa, 0x09, 0x88, 0x08, 0x28, 0x57, 0x02, 0x18, 0x53, 0xb1, 0x1a, 0x53, 0xa1, 0x9d, 0x88, 0x99,
+    0xab, 0x18, 0x14, 0xfa, 0x9c, 0x10, 0x98, 0x08, 0x03, 0x28, 0x45, 0x33, 0x33, 0x93, 0x9e, 0x21,
+    0x81, 0xab, 0x01, 0xcd, 0xac, 0x89, 0x01, 0x93, 0xae, 0x8a, 0xa9, 0x9a, 0x00, 0x0b, 0x77, 0x16,
+    0x00, 0x00, 0xa8, 0x29, 0x43, 0xa1, 0x9a, 0xba, 0xad, 0x9b, 0x32, 0x32, 0xed, 0xaa, 0x88, 0x8a,
+    0x20, 0xa3, 0x48, 0x67, 0x01, 0x00, 0x10, 0x09, 0x12, 0x02, 0xbb, 0xd9, 0xbc, 0x99, 0x09, 0x21,
+    0x94, 0xbe, 0xbb, 0x9a, 0x20, 0x82, 0x0e, 0x65, 0x23, 0x09, 0x31, 0xb1, 0x3a, 0x36, 0xc0, 0x9b,
+    0xed, 0x0b, 0x3b, 0x00, 0xa9, 0xa9, 0x09, 0x42, 0xc3, 0xaf, 0x9a, 0x88, 0x08, 0x01, 0xac, 0x60,
+    0x27, 0x10, 0x01, 0x91, 0x19, 0x11, 0x98, 0x18, 0xc0, 0x9f, 0x99, 0x80, 0x20, 0xb1, 0xcd, 0xcb,
+    0x09, 0x11, 0xe9, 0x39, 0x47, 0x81, 0x08, 0x31, 0xb0, 0x1a, 0x36, 0xa0, 0xad, 0x88, 0x80, 0xab,
+    0x51, 0x14, 0xdc, 0x9a, 0x01, 0x98, 0x19, 0x11, 0x90, 0x74, 0x11, 0x80, 0x10, 0x88, 0x40, 0x81,
+    0xa8, 0x89, 0xbd, 0x08, 0x81, 0x01, 0x01, 0xff, 0x9a, 0x09, 0x08, 0x88, 0x09, 0x60, 0x24, 0x12,
+    0x41, 0x92, 0x89, 0x33, 0xc1, 0x0b, 0x91, 0xba, 0x9b, 0x99, 0x09, 0xfe, 0x9d, 0x99, 0xa9, 0x20,
+    0xb8, 0x9f, 0x73, 0x14, 0x00, 0x11, 0xa1, 0x8b, 0x42, 0x01, 0x99, 0xa9, 0xaa, 0xdb, 0x2a, 0x44,
+    0xe9, 0xab, 0x89, 0xaa, 0x18, 0xb1, 0x29, 0x77, 0x12, 0x18, 0x11, 0xa9, 0x38, 0x15, 0x90, 0x80,
+    0xca, 0xaa, 0x8a, 0x20, 0x05, 0xdd, 0xaa, 0xa9, 0x8b, 0x14, 0xd9, 0x2a, 0x47, 0x81, 0x10, 0x12,
+    0xb9, 0x20, 0x34, 0x98, 0x9a, 0x9a, 0xc8, 0x9e, 0x30, 0x94, 0xbd, 0x8a, 0xa8, 0x8b, 0x13, 0xcc,
+    0x39, 0x57, 0x01, 0x10, 0x81, 0x99, 0x31, 0x32, 0x98, 0xa8, 0xad, 0xd9, 0x8b, 0x53, 0xa3, 0xae,
+    0x99, 0xba, 0x1b, 0x03, 0xdd, 0x38, 0x27, 0x81, 0x10, 0x02, 0x9a, 0x42, 0x24, 0xa8, 0xaa, 0x99,
+    0xca, 0x8b, 0x46, 0xa2, 0xbd, 0x8a, 0xb9, 0x89, 0x02, 0xbd, 0x58, 0x26, 0x00, 0x21, 0x82, 0x9b,
+    0x53, 0x03, 0xaa, 0x08, 0xa9, 0xbe, 0x2a, 0x26, 0xa1, 0x9e, 0x99, 0xaa, 0x0a, 0x92, 0xbd, 0x69,
+    0x34, 0x80, 0x21, 0x02, 0xaa, 0x53, 0x13, 0x90, 0x99, 0x9b, 0xda, 0x2a, 0x36, 0xc1, 0xae, 0x99,
+    0xaa, 0x1b, 0x92, 0xbe, 0x58, 0x16, 0x80, 0x11, 0x02, 0xa9, 0x32, 0x24, 0xa0, 0x99, 0x99, 0xf9,
+    0x73, 0x03, 0x3b, 0x00, 0x20, 0x24, 0xea, 0xab, 0x99, 0xba, 0x18, 0xb8, 0x8a, 0x67, 0x02, 0x10,
+    0x21, 0x90, 0x39, 0x25, 0x83, 0x89, 0xaa, 0xbb, 0xad, 0x53, 0x13, 0xfc, 0x9a, 0xaa, 0xaa, 0x10,
+    0xd8, 0x0a, 0x55, 0x02, 0x10, 0x22, 0xa1, 0x19, 0x26, 0x12, 0xa9, 0xb9, 0x99, 0xdb, 0x30, 0x25,
+    0xf9, 0x9c, 0x9a, 0xa8, 0x18, 0xa9, 0x09, 0x74, 0x02, 0x21, 0x22, 0xa0, 0x38, 0x36, 0x02, 0xaa,
+    0xa8, 0xab, 0xae, 0x42, 0x23, 0xfc, 0xaa, 0x99, 0xb9, 0x19, 0xa1, 0xab, 0x73, 0x17, 0x00, 0x10,
+    0x01, 0x08, 0x23, 0x14, 0x99, 0xba, 0x8b, 0xba, 0x28, 0x46, 0xf8, 0xbb, 0x9b, 0xa9, 0x09, 0xb8,
+    0x0a, 0x66, 0x13, 0x20, 0x32, 0x90, 0x4a, 0x36, 0x81, 0x9a, 0x98, 0xbb, 0x9a, 0x62, 0x13, 0xfb,
+    0x9e, 0x89, 0xa9, 0x19, 0x90, 0x9a, 0x71, 0x15, 0x00, 0x11, 0x82, 0x08, 0x32, 0x13, 0x99, 0xc9,
+    0x8a, 0xbb, 0x18, 0x45, 0xf8, 0xad, 0xaa, 0xa9, 0x09, 0xa8, 0x8a, 0x65, 0x14, 0x00, 0x22, 0x81,
+    0x2a, 0x35, 0x12, 0x9a, 0xaa, 0x9b, 0xc9, 0x48, 0x34, 0xf9, 0x9f, 0x89, 0xa9, 0x08, 0x91, 0x99,
+    0x61, 0x15, 0x00, 0x21, 0x81, 0x19, 0x33, 0x13, 0x9a, 0xa8, 0x9b, 0xdb, 0x09, 0x44, 0xf0, 0x9f,
+    0x99, 0x99, 0x09, 0x80, 0x9a, 0x71, 0x14, 0x00, 0x22, 0x82, 0x89, 0x44, 0x12, 0xa9, 0x98, 0x99,
+    0xda, 0x29, 0x53, 0xf9, 0xac, 0x99, 0xb8, 0x1a, 0x01, 0xba, 0x62, 0x26, 0x00, 0x21, 0x03, 0x8a,
+    0x52, 0x12, 0xb0, 0x89, 0x19, 0xf9, 0x0a, 0x42, 0xd0, 0xae, 0x98, 0x99, 0x0b, 0x01, 0xaa, 0x58,
+    0x27, 0x81, 0x21, 0x11, 0x99, 0x42, 0x43, 0x98, 0x9a, 0x88, 0xd8, 0x8b, 0x34, 0xe2, 0xbe, 0x89,
+    0xa8, 0x8a, 0x21, 0xaa, 0x39, 0x67, 0x01, 0x10, 0x11, 0xa0, 0x20, 0x43, 0xa1, 0xa9, 0x09, 0xc0,
+    0xe5, 0x0a, 0x36, 0x00, 0x2a, 0x36, 0xfa, 0x9c, 0x99, 0xa9, 0x09, 0x81, 0x9a, 0x72, 0x24, 0x01,
+    0x21, 0x02, 0x1a, 0x34, 0x24, 0xa9, 0xa9, 0x88, 0xeb, 0x18, 0x23, 0xfb, 0xaf, 0x99, 0x99, 0x18,
+    0x81, 0xab, 0x70, 0x24, 0x10, 0x22, 0x03, 0xbb, 0x52, 0x23, 0xb8, 0x18, 0x01, 0xfd, 0x09, 0x22,
+    0xd8, 0xac, 0x89, 0xba, 0x0c, 0x02, 0xc9, 0x48, 0x36, 0x81, 0x10, 0x22, 0xa9, 0x30, 0x37, 0x90,
+    0x89, 0x09, 0xd9, 0x0b, 0x42, 0xc1, 0xaf, 0x8a, 0x99, 0x8a, 0x21, 0xa0, 0x2a, 0x47, 0x12, 0x10,
+    0x22, 0xa0, 0x3a, 0x54, 0x92, 0x8a, 0x18, 0xd8, 0x9b, 0x41, 0xb2, 0xdf, 0x99, 0xa8, 0x8a, 0x10,
+    0xa1, 0x8b, 0x75, 0x12, 0x00, 0x21, 0x91, 0x1a, 0x54, 0x02, 0x99, 0x80, 0xb8, 0xad, 0x21, 0x92,
+    0xdf, 0xaa, 0xa8, 0x99, 0x20, 0xa2, 0x9c, 0x73, 0x14, 0x00, 0x32, 0xa2, 0x9b, 0x62, 0x13, 0x89,
+    0x10, 0xb0, 0xaf, 0x29, 0x12, 0xfb, 0xab, 0x99, 0xcb, 0x18, 0x83, 0xdb, 0x60, 0x24, 0x88, 0x21,
+    0x03, 0xba, 0x52, 0x25, 0x98, 0x88, 0x80, 0xdb, 0x1a, 0x32, 0xf9, 0xac, 0x8a, 0xa9, 0x1a, 0x33,
+    0xe9, 0x2a, 0x36, 0x01, 0x28, 0x24, 0xb9, 0x29, 0x36, 0x91, 0x89, 0x10, 0xda, 0x9b, 0x51, 0xa1,
+    0xbe, 0x9a, 0xa9, 0x8c, 0x32, 0xc1, 0x8c, 0x63, 0x02, 0x00, 0x43, 0x90, 0x09, 0x63, 0x02, 0x99,
+    0x18, 0xb0, 0xad, 0x28, 0x93, 0xdf, 0x9a, 0x90, 0x9b, 0x40, 0x91, 0xad, 0x51, 0x14, 0x80, 0x32,
+    0x81, 0x9c, 0x41, 0x14, 0x88, 0x88, 0x91, 0xbd, 0x1a, 0x33, 0xfa, 0x9c, 0x09, 0xbb, 0x1a, 0x14,
+    0xda, 0x39, 0x36, 0x80, 0x20, 0x23, 0xaa, 0x48, 0x36, 0x91, 0x99, 0x08, 0xca, 0x9b, 0x52, 0xc1,
+    0xbe, 0x89, 0xa9, 0x8a, 0x43, 0xc8, 0x8a, 0x45, 0x02, 0x28, 0x33, 0xb1, 0x1b, 0x55, 0x82, 0x89,
+    0x71, 0x1c, 0x3b, 0x00, 0x80, 0xdb, 0x0b, 0x23, 0xe8, 0xad, 0x88, 0xba, 0x1a, 0x14, 0xda, 0x19,
+    0x36, 0x81, 0x28, 0x24, 0xb9, 0x48, 0x34, 0xa1, 0x89, 0x11, 0xda, 0x9c, 0x31, 0xc2, 0xbe, 0x8a,
+    0xb8, 0x9a, 0x62, 0xc0, 0x8b, 0x63, 0x03, 0x08, 0x33, 0xb1, 0x0c, 0x53, 0x13, 0x8a, 0x18, 0xb0,
+    0xcf, 0x28, 0x12, 0xea, 0x9a, 0x98, 0xbb, 0x38, 0x84, 0xbc, 0x60, 0x14, 0x88, 0x31, 0x02, 0xb9,
+    0x62, 0x24, 0xa8, 0x89, 0x01, 0xeb, 0x8a, 0x24, 0xc8, 0xad, 0x88, 0xb9, 0x19, 0x33, 0xeb, 0x19,
+    0x35, 0x01, 0x38, 0x24, 0xb8, 0x2a, 0x46, 0x91, 0x0a, 0x20, 0xd9, 0xac, 0x32, 0xa3, 0xce, 0x89,
+    0xa0, 0x9b, 0x41, 0xb1, 0x9e, 0x52, 0x02, 0x88, 0x43, 0x81, 0x9c, 0x43, 0x04, 0x99, 0x10, 0xa1,
+    0xcd, 0x29, 0x13, 0xf9, 0x8b, 0x80, 0xca, 0x18, 0x13, 0xbc, 0x58, 0x24, 0x98, 0x40, 0x03, 0xc9,
+    0x28, 0x26, 0x98, 0x89, 0x11, 0xea, 0x8b, 0x53, 0xa0, 0xac, 0x19, 0xb8, 0x8c, 0x42, 0xc0, 0x0b,
+    0x44, 0x81, 0x09, 0x34, 0xa1, 0x8c, 0x63, 0x82, 0xa9, 0x20, 0xa1, 0xbe, 0x30, 0x04, 0xcc, 0x8a,
+    0x80, 0xbb, 0x28, 0x85, 0xcb, 0x60, 0x13, 0xa8, 0x41, 0x03, 0xca, 0x38, 0x16, 0x98, 0x1a, 0x02,
+    0xfb, 0x0a, 0x33, 0xc8, 0x9c, 0x18, 0xc8, 0x8a, 0x32, 0xd0, 0x1b, 0x36, 0x80, 0x2a, 0x24, 0xa8,
+    0x0c, 0x44, 0x92, 0x9a, 0x21, 0xc0, 0xad, 0x31, 0x94, 0xbc, 0x0a, 0x90, 0xad, 0x20, 0x83, 0xbc,
+    0x73, 0x12, 0xa9, 0x43, 0x92, 0xba, 0x78, 0x13, 0xa9, 0x2a, 0x02, 0xcd, 0x2a, 0x24, 0xd9, 0x9a,
+    0x10, 0xca, 0x0a, 0x33, 0xe9, 0x3a, 0x25, 0xa0, 0x28, 0x15, 0xa9, 0x0b, 0x27, 0x81, 0x8b, 0x31,
+    0xc8, 0x9d, 0x41, 0xa2, 0xbc, 0x08, 0xa1, 0xad, 0x21, 0x82, 0xad, 0x44, 0x02, 0x9a, 0x43, 0x91,
+    0xa7, 0x05, 0x42, 0x00, 0x8a, 0x37, 0x80, 0xab, 0x32, 0xc0, 0x9e, 0x41, 0xa2, 0xac, 0x18, 0xa1,
+    0xac, 0x30, 0x83, 0xae, 0x43, 0x03, 0xab, 0x53, 0x81, 0xbb, 0x70, 0x03, 0xb8, 0x29, 0x13, 0xec,
+    0x19, 0x33, 0xdb, 0x8b, 0x11, 0xca, 0x0b, 0x24, 0xd8, 0x39, 0x34, 0xb0, 0x39, 0x33, 0xc9, 0x8b,
+    0x47, 0x81, 0xab, 0x31, 0xc1, 0x9d, 0x50, 0x91, 0xbb, 0x19, 0xa1, 0xbc, 0x41, 0x82, 0x9d, 0x43,
+    0x03, 0x8c, 0x32, 0x91, 0xca, 0x70, 0x12, 0xb8, 0x3a, 0x03, 0xec, 0x19, 0x33, 0xdb, 0x9a, 0x11,
+    0xca, 0x0a, 0x23, 0xf0, 0x38, 0x42, 0xb0, 0x20, 0x12, 0xa9, 0x0b, 0x57, 0x80, 0x8b, 0x31, 0xd8,
+    0x9b, 0x51, 0xa1, 0xac, 0x18, 0xb0, 0xbb, 0x42, 0x92, 0x0e, 0x24, 0x83, 0x0c, 0x23, 0xa0, 0xab,
+    0x72, 0x05, 0xa9, 0x28, 0x82, 0xbd, 0x28, 0x05, 0xcb, 0x8a, 0x82, 0xcb, 0x19, 0x14, 0xca, 0x50,
+    0x22, 0xa9, 0x41, 0x02, 0xba, 0x39, 0x37, 0x90, 0x0c, 0x22, 0xe9, 0x8b, 0x42, 0xc0, 0x9b, 0x10,
+    0xc8, 0x9b, 0x33, 0xb2, 0x1f, 0x24, 0x92, 0x1b, 0x24, 0xa8, 0xba, 0x65, 0x01, 0xb9, 0x30, 0x91,
+    0xbe, 0x20, 0x05, 0xac, 0x0a, 0x92, 0xcb, 0x28, 0x13, 0xea, 0x41, 0x22, 0xba, 0x32, 0x84, 0xb9,
+    0x5a, 0x16, 0xa0, 0x1b, 0x13, 0xe9, 0x8b, 0x53, 0xb8, 0x9c, 0x20, 0xb9, 0x8c, 0x32, 0xb1, 0x1f,
+    0x33, 0xb3, 0x2b, 0x34, 0xa8, 0xac, 0x65, 0x00, 0xa9, 0x20, 0xa2, 0xbd, 0x38, 0x05, 0xac, 0x1a,
+    0x91, 0xdb, 0x28, 0x13, 0xea, 0x31, 0x23, 0xba, 0x41, 0x84, 0xa9, 0x4b, 0x17, 0x88, 0x0b, 0x22,
+    0xe9, 0x8a, 0x42, 0xc0, 0xaa, 0x11, 0xb8, 0x8d, 0x22, 0x91, 0x8e, 0x24, 0x82, 0x0c, 0x32, 0x90,
+    0xbb, 0x73, 0x84, 0xb8, 0x20, 0x82, 0xbe, 0x28, 0x14, 0xcb, 0x8a, 0x83, 0xcc, 0x29, 0x22, 0xe8,
+    0xa7, 0xc7, 0x48, 0x00, 0x33, 0x02, 0x8c, 0x42, 0x91, 0xba, 0x70, 0x03, 0xb8, 0x39, 0x82, 0xbe,
+    0x19, 0x25, 0xcb, 0x89, 0x02, 0xbc, 0x2a, 0x23, 0xf0, 0x29, 0x24, 0xb0, 0x29, 0x24, 0xaa, 0x8a,
+    0x47, 0x80, 0xaa, 0x23, 0xc0, 0x8d, 0x30, 0xb3, 0xad, 0x28, 0xb0, 0xbc, 0x41, 0x01, 0xbc, 0x63,
+    0x02, 0xaa, 0x32, 0x94, 0xaa, 0x69, 0x14, 0xa8, 0x2a, 0x12, 0xec, 0x09, 0x33, 0xd9, 0x8a, 0x11,
+    0xca, 0x0b, 0x33, 0xb0, 0x1f, 0x24, 0xa1, 0x1b, 0x43, 0xa0, 0x9b, 0x73, 0x83, 0xb9, 0x50, 0x90,
+    0xad, 0x30, 0x03, 0xae, 0x88, 0x92, 0xbc, 0x28, 0x04, 0xd9, 0x58, 0x12, 0xa9, 0x38, 0x23, 0xbb,
+    0x2a, 0x57, 0x98, 0x8a, 0x23, 0xe9, 0x8a, 0x32, 0xd1, 0x8b, 0x20, 0xd8, 0x9a, 0x32, 0x91, 0x9d,
+    0x26, 0x81, 0x8b, 0x32, 0xa2, 0xab, 0x78, 0x85, 0xa8, 0x28, 0x82, 0xbd, 0x28, 0x24, 0xcc, 0x88,
+    0x82, 0xcb, 0x29, 0x13, 0xd9, 0x6a, 0x12, 0xb0, 0x39, 0x32, 0xba, 0x0b, 0x57, 0x90, 0x8a, 0x22,
+    0xd8, 0x8b, 0x32, 0xd3, 0xab, 0x10, 0xc0, 0x9d, 0x31, 0x01, 0xad, 0x25, 0x82, 0x8b, 0x32, 0xa3,
+    0xac, 0x78, 0x84, 0xa8, 0x18, 0x03, 0xcd, 0x00, 0x23, 0xdb, 0x09, 0x81, 0xcb, 0x2a, 0x14, 0xc9,
+    0x59, 0x13, 0xc0, 0x28, 0x22, 0xb9, 0x8a, 0x47, 0x80, 0x9b, 0x32, 0xd8, 0x0c, 0x31, 0xc2, 0x8c,
+    0x18, 0xb0, 0xac, 0x32, 0x81, 0xad, 0x26, 0x01, 0x9b, 0x33, 0x91, 0x9c, 0x78, 0x84, 0xa8, 0x39,
+    0x01, 0xcc, 0x28, 0x23, 0xcc, 0x89, 0x81, 0xcb, 0x2a, 0x13, 0xe8, 0x59, 0x22, 0xb8, 0x38, 0x14,
+    0xaa, 0x89, 0x47, 0x88, 0x8a, 0x12, 0xd0, 0x0c, 0x21, 0xc2, 0xab, 0x28, 0xb8, 0xad, 0x42, 0x91,
+    0x9c, 0x17, 0x81, 0x0a, 0x22, 0xa0, 0x9a, 0x70, 0x84, 0xb8, 0x20, 0x01, 0xbe, 0x20, 0x23, 0xae,
+    0xbc, 0xed, 0x49, 0x00, 0x28, 0xa9, 0x9c, 0x23, 0xa1, 0x8d, 0x16, 0x92, 0x1b, 0x32, 0xb1, 0xaa,
+    0x72, 0x84, 0xb8, 0x38, 0x92, 0xbe, 0x20, 0x04, 0xbc, 0x09, 0x92, 0xbc, 0x49, 0x02, 0xe9, 0x50,
+    0x21, 0xaa, 0x21, 0x03, 0xbb, 0x4a, 0x27, 0x98, 0x1b, 0x03, 0xf9, 0x09, 0x41, 0xb8, 0x9b, 0x20,
+    0xca, 0x8c, 0x23, 0xa1, 0x1f, 0x14, 0xb2, 0x2a, 0x32, 0xb0, 0x9b, 0x75, 0x00, 0xb9, 0x31, 0x90,
+    0x9e, 0x20, 0x94, 0xac, 0x19, 0xa1, 0xcb, 0x48, 0x02, 0xeb, 0x42, 0x11, 0xaa, 0x32, 0x83, 0x9d,
+    0x49, 0x06, 0x98, 0x2a, 0x02, 0xea, 0x19, 0x32, 0xe9, 0x99, 0x11, 0xba, 0x0b, 0x24, 0xb8, 0x3d,
+    0x15, 0xb1, 0x29, 0x43, 0xb9, 0x9a, 0x47, 0x08, 0x9a, 0x22, 0xb0, 0x9e, 0x31, 0xa3, 0x9e, 0x19,
+    0xa0, 0xbb, 0x50, 0x81, 0xdb, 0x43, 0x12, 0xab, 0x24, 0x93, 0x9c, 0x68, 0x84, 0xa0, 0x3a, 0x01,
+    0xfb, 0x18, 0x31, 0xda, 0x99, 0x11, 0xbb, 0x1b, 0x15, 0xc0, 0x4b, 0x33, 0xc1, 0x29, 0x24, 0xb9,
+    0x9a, 0x47, 0x08, 0x9a, 0x12, 0xb1, 0x8f, 0x30, 0xa2, 0xac, 0x19, 0xb1, 0xbc, 0x41, 0x81, 0xbc,
+    0x35, 0x12, 0x9c, 0x33, 0xa2, 0xab, 0x78, 0x05, 0xa8, 0x29, 0x02, 0xeb, 0x08, 0x33, 0xeb, 0x99,
+    0x01, 0xca, 0x09, 0x23, 0xd9, 0x5a, 0x23, 0xb0, 0x39, 0x24, 0xba, 0x8a, 0x57, 0x08, 0x9a, 0x12,
+    0xc0, 0x8c, 0x31, 0xc3, 0x9c, 0x29, 0xb0, 0xac, 0x41, 0x81, 0x9d, 0x34, 0x02, 0x8c, 0x32, 0xa1,
+    0xba, 0x70, 0x04, 0xb8, 0x28, 0x02, 0xbd, 0x29, 0x24, 0xeb, 0x89, 0x01, 0xbb, 0x2b, 0x14, 0xd9,
+    0x59, 0x13, 0xc0, 0x20, 0x13, 0xab, 0x1a, 0x57, 0x88, 0x8a, 0x12, 0xd0, 0x0b, 0x41, 0xb1, 0x9d,
+    0x18, 0xa8, 0x9c, 0x22, 0x91, 0x8e, 0x25, 0x01, 0x0c, 0x32, 0xa0, 0xaa, 0x71, 0x83, 0xb8, 0x38,
+    0x81, 0x33, 0x44, 0x00, 0xf8, 0x0a, 0x31, 0xc1, 0xab, 0x20, 0xc9, 0x9c, 0x32, 0x90, 0x1e, 0x24,
+    0xa3, 0x1b, 0x33, 0xc0, 0xa9, 0x73, 0x83, 0xc9, 0x21, 0x91, 0xae, 0x11, 0x84, 0xac, 0x09, 0xa1,
+    0xcb, 0x38, 0x02, 0xfb, 0x33, 0x33, 0xac, 0x23, 0x93, 0x9c, 0x69, 0x85, 0x90, 0x2a, 0x01, 0xdb,
+    0x19, 0x33, 0xfa, 0x99, 0x00, 0xba, 0x0a, 0x04, 0xc0, 0x7a, 0x21, 0xa0, 0x38, 0x12, 0xaa, 0x89,
+    0x47, 0x08, 0x9a, 0x13, 0xe8, 0x0a, 0x30, 0xd2, 0x9b, 0x19, 0xb9, 0xac, 0x23, 0x80, 0x0f, 0x16,
+    0x92, 0x1a, 0x23, 0xb8, 0x9a, 0x73, 0x83, 0xc8, 0x21, 0x90, 0x9f, 0x01, 0x03, 0x9d, 0x89, 0xa0,
+    0xba, 0x49, 0x81, 0xe9, 0x63, 0x20, 0xaa, 0x23, 0x81, 0x8c, 0x48, 0x86, 0x90, 0x2a, 0x01, 0xea,
+    0x18, 0x31, 0xea, 0x89, 0x08, 0xaa, 0x0a, 0x03, 0xb8, 0x7c, 0x04, 0xb1, 0x30, 0x12, 0xca, 0x00,
+    0x36, 0x89, 0x99, 0x13, 0xe8, 0x0b, 0x22, 0xe2, 0x8b, 0x09, 0xc9, 0x9a, 0x32, 0xa9, 0x1c, 0x47,
+    0x91, 0x2a, 0x23, 0xb9, 0x0a, 0x73, 0x93, 0xb8, 0x32, 0xa0, 0xbf, 0x22, 0x82, 0xaf, 0x08, 0xa8,
+    0xab, 0x30, 0x91, 0xbc, 0x47, 0x11, 0x8b, 0x33, 0xa1, 0x9b, 0x70, 0x04, 0x98, 0x3a, 0x82, 0xcd,
+    0x28, 0x22, 0xdc, 0x88, 0x90, 0xab, 0x19, 0x83, 0xda, 0x78, 0x13, 0xb0, 0x31, 0x83, 0xbb, 0x28,
+    0x57, 0x09, 0x89, 0x12, 0xd9, 0x1b, 0x32, 0xf0, 0x8a, 0x08, 0xca, 0x89, 0x12, 0x99, 0x3c, 0x27,
+    0xa1, 0x29, 0x14, 0xa9, 0x89, 0x64, 0x80, 0xa8, 0x31, 0xb0, 0x9e, 0x21, 0xa3, 0x9f, 0x08, 0xb8,
+    0x9a, 0x30, 0xa0, 0xcb, 0x47, 0x01, 0x8a, 0x33, 0xb0, 0x9a, 0x71, 0x84, 0x98, 0x39, 0x01, 0xcd,
+    0x10, 0x13, 0xbd, 0x88, 0x90, 0xad, 0x18, 0x82, 0xd9, 0x70, 0x11, 0xa8, 0x21, 0x83, 0xaa, 0x39,
+    0x16, 0x21, 0x40, 0x00, 0x94, 0xb8, 0x50, 0x92, 0xaf, 0x10, 0x84, 0x9d, 0x09, 0xa0, 0xbb, 0x38,
+    0x82, 0xfb, 0x72, 0x10, 0x99, 0x31, 0x92, 0x9b, 0x48, 0x06, 0x88, 0x1a, 0x03, 0xfa, 0x08, 0x22,
+    0xe9, 0x89, 0x00, 0xca, 0x09, 0x12, 0xa9, 0x4c, 0x06, 0xa1, 0x29, 0x23, 0xaa, 0x0a, 0x46, 0x80,
+    0x99, 0x22, 0xc0, 0x8e, 0x21, 0xa2, 0x9e, 0x00, 0xb8, 0x9b, 0x30, 0x91, 0xad, 0x37, 0x10, 0x8b,
+    0x33, 0xb2, 0xab, 0x70, 0x85, 0x98, 0x28, 0x01, 0xcc, 0x18, 0x23, 0xbd, 0x89, 0x81, 0xad, 0x1a,
+    0x83, 0xe8, 0x68, 0x12, 0xa8, 0x20, 0x03, 0xab, 0x19, 0x47, 0x88, 0x89, 0x12, 0xd8, 0x0b, 0x32,
+    0xf2, 0x8b, 0x18, 0xc9, 0x9a, 0x22, 0x98, 0x8d, 0x27, 0x81, 0x2b, 0x32, 0xb8, 0x8a, 0x71, 0x93,
+    0xa0, 0x30, 0x91, 0xaf, 0x10, 0x04, 0xad, 0x88, 0xa1, 0xbb, 0x39, 0x02, 0xfb, 0x70, 0x11, 0xb8,
+    0x22, 0x82, 0x9b, 0x28, 0x27, 0x88, 0x1a, 0x03, 0xf9, 0x0a, 0x32, 0xd8, 0x8b, 0x00, 0xda, 0x9a,
+    0x23, 0xa8, 0x1e, 0x17, 0x91, 0x1a, 0x32, 0xa9, 0x99, 0x72, 0x92, 0xa8, 0x31, 0xa1, 0xae, 0x20,
+    0x83, 0xbe, 0x18, 0x90, 0xad, 0x28, 0x82, 0xdb, 0x71, 0x02, 0xa9, 0x22, 0x93, 0xab, 0x38, 0x27,
+    0x88, 0x1a, 0x03, 0xf9, 0x0a, 0x32, 0xe8, 0x8a, 0x10, 0xcb, 0x8a, 0x23, 0xb9, 0x3d, 0x27, 0xa0,
+    0x29, 0x23, 0xba, 0x88, 0x74, 0x80, 0xa8, 0x21, 0xa1, 0x8f, 0x10, 0xa3, 0x9d, 0x18, 0xb0, 0xac,
+    0x30, 0xa1, 0xcb, 0x56, 0x10, 0x8b, 0x22, 0xa2, 0x9b, 0x50, 0x85, 0x90, 0x29, 0x02, 0xdc, 0x18,
+    0x22, 0xfa, 0x88, 0x81, 0xcb, 0x19, 0x02, 0xa9, 0x7b, 0x14, 0xb0, 0x38, 0x12, 0xba, 0x09, 0x56,
+    0x88, 0x99, 0x13, 0xc0, 0x8c, 0x31, 0xc2, 0x9c, 0x18, 0xc8, 0x9c, 0x21, 0xa1, 0xbb, 0x57, 0x00,
+    0x1f, 0xef, 0x4b, 0x00, 0x38, 0x02, 0xba, 0x08, 0x45, 0x08, 0x99, 0x23, 0xd8, 0x8c, 0x21, 0xc3,
+    0x9c, 0x10, 0xd9, 0x9b, 0x21, 0x90, 0xab, 0x67, 0x00, 0x8a, 0x22, 0xb1, 0x89, 0x68, 0x83, 0xa0,
+    0x28, 0x11, 0xaf, 0x08, 0x23, 0xeb, 0x09, 0x90, 0xcb, 0x19, 0x83, 0xb9, 0x7a, 0x06, 0xa0, 0x20,
+    0x11, 0xab, 0x00, 0x36, 0x19, 0x8a, 0x13, 0xf0, 0x0b, 0x21, 0xc2, 0x8c, 0x08, 0xd9, 0xaa, 0x31,
+    0xa8, 0xaa, 0x67, 0x00, 0x0a, 0x12, 0xb1, 0x0a, 0x70, 0x93, 0x90, 0x38, 0x80, 0xbe, 0x10, 0x23,
+    0xbd, 0x88, 0x90, 0xae, 0x2a, 0x93, 0xb8, 0x7b, 0x05, 0xa0, 0x38, 0x13, 0xcb, 0x00, 0x54, 0x88,
+    0x98, 0x13, 0xb8, 0x8f, 0x11, 0xa2, 0x8d, 0x18, 0xd8, 0xaa, 0x21, 0xa1, 0xca, 0x73, 0x02, 0xaa,
+    0x24, 0x92, 0x8d, 0x11, 0x06, 0x09, 0x29, 0x82, 0xea, 0x19, 0x21, 0xd8, 0x09, 0x00, 0xcc, 0x89,
+    0x22, 0xa8, 0x8b, 0x47, 0x80, 0x0b, 0x24, 0xb0, 0x1b, 0x61, 0x93, 0x98, 0x40, 0x90, 0xbd, 0x30,
+    0x12, 0xdc, 0x00, 0x90, 0x9e, 0x29, 0x82, 0x9a, 0x3a, 0x17, 0xa0, 0x4a, 0x13, 0xd9, 0x18, 0x52,
+    0x91, 0x88, 0x32, 0xc9, 0x9d, 0x22, 0x91, 0x9d, 0x10, 0xd8, 0x9c, 0x20, 0x92, 0xaa, 0x78, 0x83,
+    0xb8, 0x40, 0x13, 0xbc, 0x30, 0x44, 0x98, 0x80, 0x14, 0xbb, 0x0e, 0x12, 0xa1, 0x8d, 0x10, 0xe9,
+    0x9a, 0x31, 0xa0, 0x8b, 0x60, 0x83, 0xb9, 0x62, 0x02, 0xcb, 0x31, 0x34, 0x8a, 0x10, 0x85, 0xcb,
+    0x1b, 0x13, 0xc0, 0x8b, 0x10, 0xfc, 0x8a, 0x21, 0xa0, 0x8a, 0x50, 0x94, 0x99, 0x71, 0x01, 0xba,
+    0x32, 0x33, 0x99, 0x12, 0x96, 0xbb, 0x1c, 0x12, 0xc1, 0x8b, 0x88, 0xed, 0x0a, 0x20, 0xa0, 0x9a,
+    0x40, 0x83, 0x89, 0x73, 0x13, 0xda, 0x21, 0x63, 0x88, 0x82, 0x02, 0xab, 0x8e, 0x02, 0x92, 0x8d,
+    0xfc, 0x06, 0x44, 0x00, 0x98, 0xae, 0x88, 0x03, 0xa8, 0x8b, 0x31, 0xa3, 0x30, 0x57, 0x82, 0x9b,
+    0x32, 0x17, 0x08, 0x21, 0x91, 0xfb, 0x1a, 0x21, 0xb0, 0xab, 0x80, 0xcf, 0x8a, 0x32, 0xb8, 0x9b,
+    0x20, 0x84, 0x2a, 0x45, 0x15, 0xba, 0x21, 0x35, 0x98, 0x41, 0x83, 0xeb, 0x0a, 0x21, 0xa0, 0xbb,
+    0x28, 0xfd, 0x8b, 0x30, 0xb0, 0xab, 0x11, 0x11, 0x1a, 0x37, 0x24, 0xb8, 0x39, 0x45, 0x91, 0x22,
+    0x14, 0xcb, 0x8b, 0x20, 0x91, 0xba, 0xab, 0xfc, 0xad, 0x10, 0x80, 0xba, 0x08, 0x1a, 0x11, 0x37,
+    0x32, 0x22, 0x8d, 0x41, 0x06, 0x11, 0x30, 0xb8, 0xc9, 0x0a, 0x32, 0xa1, 0xbf, 0x99, 0xbd, 0x9b,
+    0x23, 0xd0, 0x9b, 0x89, 0x41, 0x32, 0x61, 0x34, 0xc9, 0x29, 0x26, 0x81, 0x48, 0x01, 0xba, 0x9b,
+    0x42, 0x00, 0xcc, 0x89, 0xea, 0x9c, 0x21, 0xb1, 0xab, 0x80, 0x1a, 0x31, 0x27, 0x33, 0xb2, 0x1c,
+    0x54, 0x01, 0x21, 0x15, 0xb9, 0x99, 0x29, 0x00, 0xb1, 0xaf, 0xca, 0xcc, 0x18, 0x01, 0xbb, 0x88,
+    0xac, 0x31, 0x45, 0x21, 0x33, 0xc8, 0x29, 0x27, 0x21, 0x50, 0x90, 0x99, 0x9a, 0x00, 0x03, 0xfb,
+    0x9b, 0xca, 0x9d, 0x10, 0xa1, 0x9b, 0xca, 0x39, 0x43, 0x03, 0x55, 0x92, 0x9b, 0x73, 0x12, 0x00,
+    0x14, 0xa8, 0xaa, 0x19, 0x21, 0xe8, 0x9c, 0x98, 0xdd, 0x08, 0x11, 0xba, 0x8a, 0x99, 0x21, 0x63,
+    0x32, 0x15, 0xaa, 0x58, 0x24, 0x10, 0x51, 0x91, 0xaa, 0xa8, 0x11, 0x88, 0xcc, 0xaa, 0xeb, 0x8d,
+    0x01, 0xa0, 0xab, 0xa8, 0x0c, 0x63, 0x13, 0x31, 0x83, 0x9b, 0x72, 0x34, 0x21, 0x22, 0xb8, 0xbb,
+    0x8b, 0x21, 0xb1, 0xef, 0x99, 0xcb, 0x8a, 0x01, 0xc9, 0xab, 0xba, 0x59, 0x63, 0x12, 0x32, 0xa1,
+    0x0a, 0x47, 0x22, 0x21, 0x01, 0xba, 0xba, 0x1a, 0x11, 0xf0, 0x9e, 0x99, 0xcb, 0x19, 0x00, 0xac,
+    0xa2, 0xc3, 0x3f, 0x00, 0xb9, 0x5b, 0x43, 0x13, 0x43, 0x92, 0x8c, 0x73, 0x13, 0x11, 0x22, 0xaa,
+    0xda, 0x89, 0x21, 0xb0, 0xaf, 0x88, 0xeb, 0x0a, 0x10, 0xd9, 0x9a, 0xa8, 0x21, 0x63, 0x22, 0x32,
+    0xa8, 0x2a, 0x47, 0x12, 0x31, 0x93, 0xac, 0x9b, 0x08, 0x11, 0xe8, 0x9b, 0xc9, 0xaf, 0x18, 0x91,
+    0xbc, 0x09, 0xba, 0x41, 0x26, 0x12, 0x31, 0xa9, 0x18, 0x37, 0x32, 0x32, 0xb1, 0xca, 0xbb, 0x0a,
+    0x34, 0xd8, 0xab, 0xca, 0xbf, 0x08, 0x80, 0xcb, 0x89, 0x9b, 0x53, 0x25, 0x20, 0x23, 0xb9, 0x48,
+    0x37, 0x11, 0x21, 0xa1, 0xcb, 0x9b, 0x28, 0x04, 0xba, 0xab, 0xfc, 0x8e, 0x00, 0xa0, 0x9a, 0x88,
+    0xac, 0x24, 0x34, 0x38, 0x22, 0xc9, 0x20, 0x46, 0x11, 0x12, 0xa1, 0xac, 0x9b, 0x20, 0x04, 0xaa,
+    0x9c, 0xfb, 0x9d, 0x10, 0xa0, 0xaa, 0x80, 0x9d, 0x33, 0x16, 0x20, 0x12, 0xb9, 0x21, 0x47, 0x10,
+    0x11, 0xa1, 0xab, 0x8c, 0x10, 0x04, 0xaa, 0x9c, 0xfb, 0xab, 0x20, 0x99, 0x9c, 0x99, 0x8e, 0x43,
+    0x04, 0x20, 0x13, 0xba, 0x30, 0x47, 0x11, 0x10, 0xa1, 0xca, 0x8b, 0x20, 0x14, 0xbb, 0xba, 0xfc,
+    0xab, 0x10, 0xa0, 0xab, 0x8b, 0x8e, 0x25, 0x13, 0x41, 0x83, 0xba, 0x51, 0x54, 0x00, 0x02, 0x91,
+    0xbb, 0x0c, 0x12, 0x84, 0x9c, 0xa9, 0xec, 0x9a, 0x00, 0xa8, 0xab, 0x8a, 0x0e, 0x25, 0x22, 0x40,
+    0x82, 0xaa, 0x41, 0x64, 0x10, 0x81, 0x81, 0xba, 0x0d, 0x21, 0x82, 0x9c, 0xa9, 0xec, 0x9a, 0x00,
+    0x98, 0xab, 0x8a, 0x0d, 0x15, 0x33, 0x50, 0x92, 0xa9, 0x32, 0x74, 0x10, 0x02, 0x81, 0xba, 0x0c,
+    0x12, 0x93, 0x9d, 0xb9, 0xdd, 0x9a, 0x80, 0x98, 0xaa, 0x8d, 0x1b, 0x16, 0x23, 0x50, 0x92, 0xa9,
+    0x21, 0x74, 0x01, 0x02, 0x01, 0xbb, 0x8d, 0x12, 0x92, 0x9b, 0xb9, 0xde, 0x8b, 0x18, 0x98, 0xac,
+    0x41, 0xbf, 0x40, 0x00, 0xb8, 0x60, 0x31, 0x13, 0x24, 0xb8, 0x1a, 0x44, 0x16, 0x22, 0x10, 0xa8,
+    0xcc, 0x18, 0x22, 0xb9, 0xa9, 0xfb, 0x9d, 0x89, 0x90, 0x98, 0xbb, 0xbb, 0x71, 0x43, 0x01, 0x33,
+    0xb0, 0x1d, 0x52, 0x06, 0x11, 0x28, 0xa0, 0xcc, 0x28, 0x21, 0xc8, 0x88, 0xb9, 0xaf, 0x09, 0x80,
+    0xa9, 0xaa, 0xa9, 0x78, 0x40, 0x02, 0x23, 0xa8, 0x1a, 0x34, 0x37, 0x31, 0x18, 0xc0, 0xda, 0x29,
+    0x21, 0xb0, 0x9a, 0xcc, 0xad, 0x99, 0x00, 0xa9, 0xdb, 0xa9, 0x70, 0x30, 0x02, 0x05, 0xa0, 0x2a,
+    0x32, 0x27, 0x31, 0x19, 0xb0, 0xdc, 0x28, 0x12, 0xc8, 0x88, 0xba, 0xaf, 0x09, 0x80, 0xa9, 0xca,
+    0xb9, 0x70, 0x21, 0x03, 0x14, 0xa8, 0x1a, 0x13, 0x57, 0x20, 0x08, 0xa1, 0xdb, 0x29, 0x22, 0xc0,
+    0x09, 0xbb, 0xbe, 0x89, 0x10, 0xa9, 0xdc, 0x89, 0x59, 0x21, 0x04, 0x23, 0x99, 0x8b, 0x14, 0x37,
+    0x31, 0x80, 0xa1, 0xdc, 0x2a, 0x23, 0xb0, 0x0a, 0xea, 0xbc, 0x89, 0x08, 0x89, 0xfb, 0x99, 0x38,
+    0x23, 0x06, 0x23, 0x98, 0x8b, 0x23, 0x66, 0x22, 0x80, 0x80, 0xeb, 0x0a, 0x33, 0xa0, 0x8a, 0xd9,
+    0xbc, 0x9a, 0x18, 0x88, 0xfb, 0x9a, 0x19, 0x24, 0x24, 0x42, 0x90, 0xaa, 0x40, 0x73, 0x23, 0x92,
+    0x00, 0xbc, 0x9c, 0x33, 0x11, 0x8c, 0xd8, 0xcb, 0x9a, 0x09, 0x91, 0xd8, 0x9d, 0x89, 0x23, 0x44,
+    0x40, 0x81, 0xb8, 0x39, 0x63, 0x24, 0x12, 0x80, 0xca, 0xac, 0x31, 0x22, 0xaa, 0xa9, 0xcf, 0xaa,
+    0x88, 0x90, 0xa8, 0xae, 0xaa, 0x68, 0x32, 0x13, 0x22, 0x98, 0x0c, 0x33, 0x67, 0x11, 0x90, 0x88,
+    0xca, 0x1a, 0x43, 0x91, 0x9c, 0xc9, 0xba, 0x8b, 0x00, 0xa8, 0xf9, 0x9c, 0x2a, 0x34, 0x32, 0x42,
+    0x81, 0xcb, 0x31, 0x45, 0x14, 0x01, 0x89, 0xba, 0x9d, 0x42, 0x03, 0xbb, 0xb8, 0xdd, 0x8b, 0x00,
+    0xd0, 0xe3, 0x41, 0x00, 0x99, 0xb9, 0xeb, 0x0a, 0x36, 0x12, 0x30, 0x10, 0xca, 0x11, 0x55, 0x32,
+    0x91, 0x89, 0x89, 0x9f, 0x31, 0x03, 0xab, 0xaa, 0xfc, 0x99, 0x08, 0x88, 0xa8, 0xca, 0x8c, 0x28,
+    0x17, 0x12, 0x10, 0x80, 0x99, 0x43, 0x64, 0x20, 0x91, 0xa0, 0xa9, 0x0b, 0x43, 0x94, 0xac, 0xa9,
+    0xcd, 0x9a, 0x20, 0xba, 0x99, 0xc9, 0xad, 0x78, 0x13, 0x82, 0x30, 0x80, 0x0b, 0x33, 0x57, 0x20,
+    0x08, 0xa0, 0xc9, 0x2a, 0x41, 0xb1, 0xab, 0xb8, 0xdf, 0x89, 0x01, 0x9a, 0x89, 0xb0, 0xbd, 0x79,
+    0x04, 0x92, 0x21, 0x00, 0x9b, 0x33, 0x27, 0x38, 0x81, 0xc1, 0xa9, 0x3b, 0x11, 0xd3, 0x0a, 0xab,
+    0xdf, 0x88, 0x00, 0x9b, 0x88, 0xa2, 0xaf, 0x49, 0x06, 0x81, 0x38, 0x00, 0xba, 0x32, 0x55, 0x08,
+    0x81, 0x02, 0xab, 0x0e, 0x12, 0xa1, 0x0e, 0x80, 0xda, 0x0a, 0x28, 0xd9, 0x98, 0x21, 0xbb, 0x1d,
+    0x27, 0x81, 0x1a, 0x12, 0xc8, 0x20, 0x73, 0x80, 0x00, 0x11, 0xa8, 0x8e, 0x02, 0x81, 0xac, 0x00,
+    0xc9, 0xab, 0x30, 0xe0, 0x9a, 0x38, 0xd8, 0xab, 0x37, 0x11, 0x1b, 0x03, 0xc0, 0x28, 0x72, 0x82,
+    0x80, 0x32, 0x99, 0x9f, 0x12, 0x81, 0x9d, 0x00, 0xc0, 0x9b, 0x29, 0xa2, 0xae, 0x29, 0x91, 0xcd,
+    0x61, 0x12, 0xa9, 0x21, 0x82, 0x0c, 0x32, 0x16, 0x09, 0x28, 0x02, 0xe9, 0x2a, 0x22, 0xf8, 0x0a,
+    0x01, 0xcb, 0x89, 0x22, 0xdb, 0x9a, 0x12, 0xca, 0x1c, 0x27, 0x81, 0x2b, 0x11, 0xb0, 0x39, 0x74,
+    0x81, 0x98, 0x32, 0x98, 0x9d, 0x13, 0xb2, 0x9e, 0x18, 0xb8, 0x9c, 0x28, 0xb1, 0xae, 0x18, 0xb1,
+    0xdb, 0x72, 0x13, 0xb9, 0x12, 0x92, 0x1c, 0x42, 0x06, 0x08, 0x19, 0x83, 0xf0, 0x18, 0x12, 0xda,
+    0x0a, 0x81, 0xbb, 0x88, 0x03, 0xcc, 0x9b, 0x12, 0xb9, 0x1f, 0x27, 0x80, 0x1b, 0x11, 0xb0, 0x21,
+    0x7e, 0x0a, 0x41, 0x00, 0x17, 0x08, 0x1a, 0x13, 0xe0, 0x2a, 0x22, 0xfa, 0x0a, 0x00, 0xab, 0x89,
+    0x02, 0xcb, 0xbb, 0x23, 0xa0, 0x8f, 0x36, 0x92, 0x0c, 0x31, 0xc1, 0x10, 0x73, 0x81, 0x98, 0x31,
+    0x01, 0xbd, 0x22, 0x91, 0xbe, 0x08, 0xa0, 0xac, 0x18, 0x82, 0xbc, 0x1b, 0x04, 0xfa, 0x39, 0x26,
+    0xa8, 0x29, 0x13, 0xab, 0x42, 0x35, 0x80, 0x88, 0x33, 0xb0, 0x8f, 0x12, 0xc0, 0x9f, 0x00, 0xb8,
+    0x99, 0x31, 0xa0, 0xbb, 0x48, 0x90, 0xbf, 0x61, 0x13, 0xb9, 0x31, 0x93, 0x8c, 0x62, 0x23, 0x89,
+    0x28, 0x14, 0xe9, 0x09, 0x12, 0xfa, 0x8a, 0x81, 0xb9, 0x0a, 0x14, 0xc8, 0xa9, 0x22, 0xc9, 0x0e,
+    0x63, 0x81, 0x89, 0x21, 0xb1, 0x1a, 0x54, 0x83, 0x09, 0x41, 0x91, 0xcc, 0x20, 0x80, 0xcd, 0x08,
+    0x91, 0x9c, 0x28, 0x83, 0xac, 0x0a, 0x93, 0xfa, 0x3a, 0x36, 0x90, 0x1a, 0x23, 0xca, 0x20, 0x45,
+    0x81, 0x08, 0x32, 0xb0, 0xaf, 0x11, 0xa0, 0xad, 0x10, 0xb0, 0xac, 0x30, 0xa2, 0x9e, 0x18, 0x91,
+    0xdc, 0x50, 0x23, 0xa8, 0x38, 0x03, 0xad, 0x33, 0x26, 0x88, 0x21, 0x82, 0xea, 0x1b, 0x01, 0xc9,
+    0x0c, 0x01, 0xcc, 0x89, 0x22, 0xc9, 0x89, 0x11, 0xd9, 0x0d, 0x62, 0x02, 0x89, 0x21, 0xb1, 0x8a,
+    0x64, 0x12, 0x08, 0x22, 0x88, 0xcd, 0x00, 0x81, 0xbb, 0x1b, 0xa1, 0xbf, 0x2b, 0x04, 0xbb, 0x09,
+    0x83, 0xfc, 0x19, 0x63, 0x81, 0x08, 0x31, 0xb9, 0x18, 0x46, 0x01, 0x10, 0x83, 0xb0, 0x9e, 0x08,
+    0x91, 0xcb, 0x18, 0xd8, 0xbc, 0x38, 0x90, 0x8c, 0x10, 0xb1, 0xce, 0x20, 0x54, 0x80, 0x00, 0x13,
+    0xab, 0x58, 0x24, 0x02, 0x41, 0x80, 0xd9, 0x99, 0x08, 0x80, 0xac, 0x80, 0xdc, 0xbb, 0x22, 0xa9,
+    0x0b, 0x01, 0xf8, 0x8d, 0x20, 0x17, 0x00, 0x28, 0x81, 0xa9, 0x62, 0x32, 0x11, 0x13, 0x88, 0xad,
+    0xd7, 0x21, 0x3f, 0x00, 0x0a, 0x01, 0xe8, 0x09, 0xca, 0xad, 0x28, 0xa8, 0x99, 0x01, 0xaa, 0x9f,
+    0x88, 0x55, 0x11, 0x08, 0x03, 0xb0, 0x58, 0x33, 0x25, 0x23, 0x99, 0xa9, 0xfb, 0x09, 0x12, 0xc9,
+    0xaa, 0xdb, 0xac, 0x10, 0x98, 0x98, 0xa8, 0xd8, 0x9a, 0x6b, 0x35, 0x02, 0x00, 0x21, 0xa8, 0x33,
+    0x47, 0x43, 0x00, 0x8a, 0x90, 0xbc, 0x39, 0x92, 0xfb, 0x9a, 0xac, 0x9a, 0x88, 0x80, 0x99, 0x9d,
+    0x88, 0xd8, 0x28, 0x47, 0x01, 0x80, 0x22, 0x08, 0x20, 0x46, 0x24, 0x80, 0x1a, 0x90, 0xbd, 0x08,
+    0x83, 0xeb, 0xaa, 0xba, 0xda, 0x19, 0x10, 0xc8, 0x9a, 0x01, 0xbc, 0x2a, 0x77, 0x01, 0x08, 0x11,
+    0x90, 0x3a, 0x55, 0x13, 0x88, 0x08, 0xc0, 0xab, 0x48, 0x81, 0xdb, 0xab, 0xa9, 0xbd, 0x18, 0x03,
+    0xdb, 0x19, 0x90, 0xcb, 0x49, 0x72, 0x12, 0x90, 0x33, 0x98, 0x2a, 0x77, 0x11, 0x19, 0x08, 0xa8,
+    0xaa, 0x18, 0x82, 0xfb, 0x8a, 0xa9, 0xbc, 0x39, 0x01, 0xdb, 0x80, 0x92, 0xab, 0x0b, 0x63, 0x25,
+    0x20, 0x31, 0xa2, 0x28, 0x67, 0x23, 0x00, 0x00, 0xb8, 0xda, 0x09, 0x00, 0xd8, 0xbb, 0xaa, 0xae,
+    0x0a, 0x12, 0x9a, 0x0a, 0xb2, 0xb8, 0x9d, 0x8a, 0x37, 0x43, 0x49, 0x81, 0x93, 0x55, 0x51, 0x11,
+    0x82, 0x88, 0x8b, 0xbb, 0xa0, 0x00, 0xce, 0xbb, 0xba, 0xac, 0x18, 0x82, 0x0a, 0x59, 0xc8, 0xe9,
+    0x98, 0x39, 0x24, 0x84, 0x21, 0x50, 0x29, 0x35, 0x26, 0x21, 0x08, 0xb9, 0xa9, 0x8a, 0x19, 0xe0,
+    0xcc, 0x9b, 0xbb, 0x89, 0x43, 0x80, 0x89, 0xa0, 0x9f, 0x8b, 0xa2, 0x30, 0x42, 0x93, 0x43, 0x72,
+    0x41, 0x25, 0x14, 0x11, 0x88, 0xaa, 0x98, 0xa8, 0x9b, 0xcc, 0xce, 0x99, 0x09, 0x18, 0x02, 0x98,
+    0x88, 0xda, 0x9b, 0x88, 0xfb, 0x28, 0x22, 0x01, 0x25, 0x25, 0x61, 0x43, 0x13, 0x11, 0x80, 0x9b,
+    0x66, 0x36, 0x3b, 0x00, 0x9b, 0xab, 0xea, 0xcc, 0x9b, 0xa9, 0x08, 0x32, 0xa1, 0x9a, 0xb0, 0xaf,
+    0x9c, 0xb0, 0x8c, 0x33, 0x04, 0x21, 0x74, 0x22, 0x35, 0x24, 0x12, 0x80, 0xa9, 0xa8, 0xab, 0x9b,
+    0xfc, 0xbb, 0x8c, 0x8a, 0x11, 0x02, 0x88, 0x8a, 0xf9, 0xaa, 0x09, 0xac, 0x8c, 0x14, 0x11, 0x69,
+    0x24, 0x23, 0x45, 0x33, 0x02, 0xa0, 0x09, 0xba, 0xdc, 0x88, 0xba, 0xaf, 0x98, 0x08, 0x18, 0x21,
+    0x80, 0xab, 0x9d, 0xd9, 0xc9, 0x99, 0x0a, 0x01, 0x35, 0x70, 0x21, 0x33, 0x27, 0x23, 0x00, 0xa2,
+    0xb9, 0x8c, 0x9a, 0xc9, 0xa9, 0x9e, 0xaa, 0x88, 0x31, 0x12, 0xb8, 0x98, 0xbf, 0xad, 0xa9, 0xb9,
+    0x8a, 0x15, 0x05, 0x58, 0x52, 0x31, 0x33, 0x25, 0x81, 0xc1, 0x98, 0x8a, 0x9b, 0x9a, 0xba, 0xcf,
+    0x89, 0x81, 0x10, 0x03, 0xc0, 0xab, 0x8d, 0xac, 0xaa, 0xaa, 0x1b, 0x23, 0x17, 0x44, 0x62, 0x20,
+    0x33, 0x34, 0x09, 0xc1, 0xc1, 0x89, 0xaa, 0xa9, 0xb0, 0x8f, 0x0a, 0xa2, 0x28, 0x02, 0xf9, 0x98,
+    0x9a, 0xad, 0x99, 0x9b, 0x3a, 0x34, 0x06, 0x23, 0x15, 0x42, 0x53, 0x22, 0x18, 0xa9, 0xd8, 0xb8,
+    0x89, 0x88, 0xe0, 0x8b, 0x1b, 0x9a, 0x20, 0x05, 0xd9, 0xa9, 0xba, 0xbe, 0x98, 0x0a, 0x68, 0x22,
+    0x01, 0x43, 0x24, 0x34, 0x35, 0x13, 0x08, 0x9b, 0x9c, 0xba, 0x98, 0x80, 0xfa, 0x8e, 0x08, 0x89,
+    0x30, 0x91, 0xab, 0xda, 0xac, 0xbb, 0xd0, 0x18, 0x51, 0x21, 0x20, 0x54, 0x21, 0x43, 0x25, 0x82,
+    0x81, 0x9a, 0x8d, 0x9a, 0x98, 0x10, 0xbe, 0xa9, 0x90, 0x8b, 0x42, 0x90, 0xaa, 0xbe, 0xbb, 0xad,
+    0xaa, 0x33, 0x15, 0x04, 0x32, 0x24, 0x40, 0x65, 0x23, 0x88, 0xa2, 0xc0, 0x9c, 0x08, 0x80, 0xa0,
+    0x8f, 0x99, 0xc8, 0x18, 0x14, 0xa9, 0x98, 0xba, 0xbd, 0x8a, 0x19, 0x24, 0x13, 0x83, 0x34, 0x42,
+    0xb4, 0xfd, 0x38, 0x00, 0x57, 0x33, 0x91, 0x91, 0x99, 0x9e, 0x09, 0x01, 0x98, 0xaf, 0x98, 0xa9,
+    0x08, 0x43, 0xa8, 0x9b, 0xca, 0xdb, 0x0b, 0x98, 0x13, 0x15, 0x11, 0x50, 0x42, 0x52, 0x44, 0x22,
+    0x08, 0xa0, 0xc0, 0x99, 0x1a, 0x88, 0xea, 0xac, 0x99, 0x9a, 0x00, 0x03, 0xc8, 0x8a, 0xaf, 0xba,
+    0xa8, 0x0a, 0x71, 0x03, 0x81, 0x34, 0x42, 0x51, 0x36, 0x12, 0x19, 0x88, 0xd9, 0xa8, 0x18, 0xa8,
+    0xfa, 0x8a, 0x99, 0x8b, 0x30, 0x92, 0xd9, 0xb1, 0xad, 0x9c, 0xb0, 0x28, 0x54, 0x00, 0x10, 0x24,
+    0x21, 0x65, 0x43, 0x81, 0x80, 0x88, 0x9c, 0x8b, 0x02, 0xb8, 0xaf, 0x98, 0xc9, 0x09, 0x31, 0x90,
+    0x9a, 0xb9, 0xdd, 0xab, 0x98, 0x51, 0x43, 0x81, 0x20, 0x31, 0x52, 0x47, 0x14, 0x00, 0x98, 0x99,
+    0xab, 0x1a, 0x12, 0xd8, 0x9e, 0xa9, 0xa9, 0x29, 0x42, 0x90, 0xba, 0xcb, 0xbc, 0xab, 0x0a, 0x47,
+    0x12, 0x89, 0x13, 0x02, 0x73, 0x46, 0x02, 0x88, 0x89, 0xb9, 0xaa, 0x31, 0x81, 0xdd, 0x99, 0xaa,
+    0xaa, 0x22, 0x14, 0xa9, 0xab, 0xfa, 0xbc, 0x89, 0x30, 0x35, 0x82, 0x30, 0x39, 0x11, 0x77, 0x34,
+    0x00, 0x99, 0x98, 0xab, 0x0a, 0x23, 0xb0, 0xbf, 0xb9, 0xaa, 0x2b, 0x43, 0x83, 0xac, 0x9b, 0xce,
+    0xaa, 0x09, 0x25, 0x33, 0x1a, 0x02, 0x84, 0x71, 0x54, 0x13, 0x98, 0x88, 0xb9, 0xba, 0x40, 0x01,
+    0xdc, 0x9a, 0x9a, 0xaa, 0x31, 0x14, 0xb9, 0xab, 0xcb, 0xaf, 0x8a, 0x38, 0x34, 0x94, 0x12, 0x40,
+    0x38, 0x64, 0x25, 0x02, 0x89, 0x88, 0xda, 0x89, 0x20, 0xb8, 0xbc, 0x9a, 0x9b, 0x8b, 0x14, 0x81,
+    0xcb, 0xd8, 0xcb, 0x9e, 0x88, 0x32, 0x63, 0x18, 0x81, 0x83, 0x61, 0x63, 0x23, 0x80, 0x09, 0xc9,
+    0xab, 0x18, 0x81, 0xf9, 0x9a, 0x0a, 0xbb, 0x10, 0x23, 0xb9, 0xcb, 0xf9, 0xdb, 0x0a, 0x41, 0x31,
+    0x88, 0xe7, 0x3c, 0x00, 0x20, 0x10, 0x00, 0x74, 0x35, 0x12, 0x90, 0x88, 0xca, 0x9a, 0x20, 0x90,
+    0xcd, 0x9a, 0x9a, 0xaa, 0x42, 0x80, 0x9c, 0xc0, 0xda, 0xab, 0x0a, 0x25, 0x41, 0x38, 0x83, 0xa1,
+    0x74, 0x53, 0x03, 0x02, 0x89, 0x9b, 0xcb, 0x11, 0x08, 0xcd, 0xb8, 0xa9, 0x0b, 0x29, 0x92, 0xba,
+    0xa9, 0xfc, 0xbc, 0x99, 0x53, 0x21, 0x30, 0x85, 0x80, 0x68, 0x44, 0x14, 0x01, 0x88, 0xb8, 0xab,
+    0x29, 0x91, 0xeb, 0x9b, 0xab, 0xba, 0x28, 0x12, 0xfa, 0x0a, 0xa8, 0xdd, 0x89, 0x40, 0x10, 0x82,
+    0x25, 0x00, 0x29, 0x57, 0x33, 0x10, 0x18, 0xb8, 0xcc, 0x08, 0x81, 0xb9, 0xac, 0xab, 0xcb, 0x08,
+    0x22, 0xbb, 0x9b, 0xb4, 0xaf, 0x8d, 0x00, 0x04, 0x11, 0x32, 0x82, 0x10, 0x77, 0x42, 0x02, 0x90,
+    0x80, 0xac, 0x8a, 0x12, 0x9a, 0xbc, 0xdb, 0x99, 0x8a, 0x21, 0x93, 0x8f, 0x88, 0xc8, 0x9b, 0x3a,
+    0x06, 0x92, 0x48, 0x22, 0xa8, 0x55, 0x45, 0x01, 0x80, 0x80, 0xc9, 0x8a, 0x21, 0xb8, 0xad, 0xba,
+    0xaa, 0x0b, 0x42, 0xb1, 0xdb, 0x10, 0xbb, 0xbc, 0x82, 0x25, 0x28, 0x29, 0x17, 0x10, 0x71, 0x34,
+    0x14, 0x10, 0x0a, 0xc8, 0xa9, 0x10, 0x89, 0xfb, 0xb9, 0x0b, 0xaa, 0x10, 0x12, 0xad, 0x99, 0xc3,
+    0x8c, 0x0b, 0x22, 0x43, 0x2a, 0x53, 0x96, 0x21, 0x56, 0x13, 0x01, 0x80, 0x99, 0x9d, 0x88, 0x81,
+    0xb9, 0xae, 0xaa, 0xba, 0x29, 0x02, 0xa8, 0x19, 0xea, 0xdb, 0x99, 0x58, 0x12, 0x93, 0x42, 0x20,
+    0x48, 0x47, 0x34, 0x02, 0x88, 0x89, 0xbc, 0x09, 0x03, 0xab, 0xaf, 0xda, 0x99, 0x19, 0x11, 0xa1,
+    0x9a, 0x80, 0xec, 0x0a, 0x00, 0x03, 0x43, 0x38, 0x11, 0x04, 0x37, 0x27, 0x12, 0x10, 0x99, 0xba,
+    0x0a, 0x1a, 0xb8, 0xf9, 0x9e, 0x8a, 0x9a, 0x11, 0x81, 0x99, 0x10, 0xae, 0xca, 0x91, 0x71, 0x10,
+    0x69, 0xed, 0x3d, 0x00, 0x28, 0x80, 0x11, 0x57, 0x22, 0x03, 0x00, 0x8b, 0xcb, 0xa0, 0x21, 0x8c,
+    0xec, 0xb8, 0x8a, 0x1a, 0x81, 0x91, 0x0a, 0xa0, 0xe9, 0x8b, 0x88, 0x15, 0x42, 0x4a, 0x02, 0x83,
+    0x73, 0x36, 0x12, 0x11, 0x0a, 0xca, 0xa8, 0x29, 0xa9, 0xf9, 0x9c, 0x8b, 0x9c, 0x81, 0x81, 0x2a,
+    0x82, 0xda, 0xbb, 0xa9, 0x73, 0x41, 0x00, 0x84, 0x00, 0x68, 0x24, 0x24, 0x21, 0x98, 0xb9, 0xaa,
+    0x0a, 0xa2, 0xf8, 0x9d, 0x9c, 0xaa, 0x08, 0x10, 0x00, 0xb2, 0xb0, 0xbf, 0x9a, 0x44, 0x32, 0x20,
+    0x93, 0xa1, 0x79, 0x45, 0x14, 0x11, 0x00, 0xc9, 0xa9, 0x10, 0x89, 0xc9, 0xcb, 0x9d, 0xac, 0x80,
+    0x01, 0x1a, 0x11, 0xe1, 0x9b, 0x0a, 0x31, 0x35, 0x23, 0x11, 0x88, 0x58, 0x57, 0x22, 0x22, 0x81,
+    0xba, 0x9a, 0x8a, 0x08, 0xe9, 0xbd, 0xca, 0xcb, 0x09, 0x80, 0x08, 0x31, 0x9a, 0xbd, 0xaa, 0x61,
+    0x25, 0x82, 0x22, 0x80, 0x2a, 0x67, 0x22, 0x11, 0x82, 0xa9, 0xaa, 0x8a, 0x01, 0xea, 0xad, 0xba,
+    0xbd, 0x0a, 0x00, 0x98, 0x12, 0x90, 0xbe, 0x9a, 0x72, 0x23, 0x02, 0x14, 0x88, 0x4b, 0x27, 0x23,
+    0x40, 0x00, 0xc8, 0x99, 0x19, 0x98, 0xe0, 0x9a, 0xad, 0xbc, 0x08, 0x80, 0x88, 0x02, 0xa8, 0xae,
+    0x09, 0x53, 0x43, 0x03, 0x02, 0x09, 0x48, 0x27, 0x25, 0x20, 0x88, 0xc0, 0x99, 0x18, 0x89, 0xe8,
+    0xba, 0x9d, 0xcb, 0x89, 0x00, 0x08, 0x80, 0xa0, 0x9d, 0x0a, 0x64, 0x32, 0x02, 0x02, 0x91, 0x69,
+    0x44, 0x14, 0x20, 0x00, 0xd8, 0x99, 0x00, 0x89, 0xd9, 0xba, 0xad, 0xbc, 0x89, 0x81, 0x09, 0x11,
+    0xc0, 0x9e, 0x01, 0x43, 0x53, 0x11, 0x82, 0x90, 0x78, 0x33, 0x04, 0x23, 0x80, 0xbc, 0x98, 0x98,
+    0x09, 0xfa, 0xca, 0xac, 0xad, 0x80, 0x80, 0x28, 0x00, 0xe9, 0x89, 0x28, 0x34, 0x25, 0x31, 0x19,
+    0x44, 0x00, 0x3b, 0x00, 0x4a, 0x53, 0x25, 0x30, 0x08, 0xc8, 0xb9, 0x28, 0x09, 0xd9, 0xba, 0xaf,
+    0xac, 0x99, 0x01, 0x18, 0x18, 0xa8, 0x9f, 0x00, 0x53, 0x41, 0x12, 0x92, 0x98, 0x48, 0x44, 0x15,
+    0x20, 0x80, 0xc9, 0x99, 0x10, 0x99, 0xc8, 0xda, 0xae, 0xba, 0x98, 0x01, 0x10, 0x19, 0xd0, 0x9c,
+    0x30, 0x35, 0x32, 0x15, 0x80, 0x8a, 0x32, 0x47, 0x22, 0x10, 0x80, 0xdb, 0x1a, 0x01, 0xa9, 0xba,
+    0xdd, 0xad, 0x9a, 0x88, 0x00, 0x08, 0x80, 0xd9, 0x1c, 0x41, 0x14, 0x33, 0x23, 0xa9, 0x90, 0x37,
+    0x73, 0x01, 0x82, 0x98, 0x9b, 0x88, 0xa3, 0x89, 0xaf, 0xcc, 0xba, 0x8b, 0x09, 0x80, 0x91, 0x89,
+    0xad, 0x89, 0x55, 0x43, 0x31, 0x01, 0x90, 0x29, 0x74, 0x33, 0x02, 0x11, 0xba, 0xcb, 0x10, 0x81,
+    0xcb, 0xec, 0xca, 0xac, 0x8a, 0x81, 0x08, 0x19, 0xa9, 0xbc, 0x21, 0x65, 0x22, 0x13, 0x02, 0x88,
+    0x49, 0x45, 0x14, 0x21, 0x08, 0xaa, 0xaa, 0x01, 0x80, 0xec, 0xdb, 0xca, 0xbb, 0x0a, 0x80, 0x98,
+    0x88, 0xb9, 0x9c, 0x41, 0x75, 0x21, 0x11, 0x02, 0x98, 0x51, 0x24, 0x23, 0x12, 0xa0, 0xaa, 0x8b,
+    0x18, 0xc0, 0xfc, 0xbb, 0xcd, 0xaa, 0x88, 0x08, 0x89, 0xb8, 0xc0, 0x89, 0x70, 0x34, 0x22, 0x41,
+    0x00, 0x98, 0x35, 0x44, 0x11, 0x01, 0x98, 0xaa, 0x0a, 0x01, 0xd9, 0xbd, 0xcc, 0xbc, 0x9a, 0x09,
+    0x89, 0x88, 0x8a, 0xbc, 0x08, 0x45, 0x26, 0x32, 0x11, 0x10, 0x08, 0x17, 0x25, 0x11, 0x08, 0xc0,
+    0x98, 0x19, 0x80, 0xd8, 0xda, 0x9c, 0xbc, 0x9a, 0x00, 0x98, 0x98, 0xb0, 0x9d, 0x19, 0x36, 0x25,
+    0x23, 0x11, 0x80, 0x28, 0x65, 0x23, 0x01, 0x01, 0xbb, 0x9c, 0x02, 0x89, 0xba, 0xfd, 0xbb, 0xac,
+    0x0b, 0x08, 0x98, 0x90, 0xc9, 0x8e, 0x11, 0x35, 0x43, 0x22, 0x00, 0xa1, 0x61, 0x53, 0x12, 0x01,
+    0x41, 0x41, 0x3e, 0x00, 0xd9, 0x89, 0x00, 0x90, 0x98, 0xdc, 0xbc, 0xbb, 0xaa, 0x18, 0x88, 0xa9,
+    0xea, 0x9b, 0x39, 0x46, 0x34, 0x13, 0x01, 0x80, 0x58, 0x73, 0x12, 0x02, 0x88, 0xab, 0x9a, 0x10,
+    0x01, 0xeb, 0xbd, 0xeb, 0xba, 0x19, 0x08, 0x98, 0xa8, 0xca, 0x8d, 0x31, 0x36, 0x32, 0x23, 0x91,
+    0x80, 0x64, 0x43, 0x22, 0x01, 0xc8, 0x9a, 0x09, 0x10, 0xa8, 0xec, 0xbc, 0xdb, 0x9a, 0x80, 0x88,
+    0x99, 0xc9, 0xaa, 0x19, 0x72, 0x25, 0x22, 0x11, 0x01, 0x00, 0x56, 0x22, 0x02, 0x00, 0xaa, 0x9b,
+    0x81, 0x82, 0xcb, 0xcf, 0xcb, 0xba, 0x8a, 0x88, 0x98, 0xa9, 0xac, 0x9c, 0x10, 0x56, 0x23, 0x03,
+    0x22, 0x00, 0x58, 0x36, 0x22, 0x01, 0x91, 0xbb, 0x89, 0x18, 0x98, 0xed, 0xbc, 0xcb, 0xac, 0x88,
+    0x90, 0xa9, 0xa8, 0xcb, 0x1b, 0x43, 0x37, 0x42, 0x20, 0x82, 0x81, 0x74, 0x12, 0x11, 0x11, 0xb9,
+    0x8a, 0x81, 0x89, 0xa9, 0xef, 0xba, 0xba, 0x9b, 0x90, 0xa0, 0x8b, 0xae, 0xb9, 0x02, 0x72, 0x26,
+    0x01, 0x21, 0x18, 0x10, 0x37, 0x22, 0x10, 0x91, 0xba, 0x09, 0x89, 0xa2, 0xfb, 0x9f, 0xba, 0xcb,
+    0x08, 0x19, 0xaa, 0xb0, 0xba, 0x8d, 0x32, 0x47, 0x31, 0x30, 0x81, 0x18, 0x73, 0x14, 0x12, 0x11,
+    0x9a, 0xaa, 0x80, 0x00, 0xbb, 0xde, 0xdb, 0xbb, 0x9a, 0x98, 0x90, 0x89, 0xad, 0xba, 0x10, 0x74,
+    0x33, 0x23, 0x23, 0x09, 0x42, 0x37, 0x32, 0x22, 0xa8, 0xb9, 0x0a, 0x19, 0xc0, 0xfb, 0xad, 0xbc,
+    0xba, 0x98, 0x88, 0xa9, 0xba, 0xcb, 0x0b, 0x53, 0x47, 0x31, 0x20, 0x81, 0x02, 0x73, 0x33, 0x03,
+    0x02, 0xaa, 0x8c, 0x88, 0x82, 0xd9, 0xbe, 0xbc, 0xbc, 0x89, 0x08, 0xa8, 0xa9, 0xcb, 0x9c, 0x38,
+    0x47, 0x21, 0x23, 0x01, 0x08, 0x62, 0x34, 0x23, 0x12, 0x99, 0xac, 0x0a, 0x01, 0x89, 0xec, 0xcc,
+    0xfa, 0xf8, 0x41, 0x00, 0xab, 0x9a, 0x08, 0x90, 0xaa, 0x9d, 0xbb, 0x21, 0x67, 0x21, 0x02, 0x82,
+    0x10, 0x51, 0x34, 0x23, 0x01, 0x98, 0x9c, 0x8a, 0x12, 0xb9, 0xed, 0xcb, 0xbc, 0x9a, 0x08, 0x80,
+    0x9b, 0xba, 0xeb, 0x19, 0x73, 0x23, 0x23, 0x22, 0x88, 0x50, 0x45, 0x13, 0x22, 0x08, 0xcb, 0x99,
+    0x11, 0x88, 0xca, 0xce, 0xbc, 0xab, 0x89, 0x08, 0x98, 0xa9, 0xbd, 0x8b, 0x32, 0x57, 0x22, 0x12,
+    0x01, 0x18, 0x63, 0x34, 0x13, 0x01, 0xb8, 0xba, 0x19, 0x10, 0xb9, 0xef, 0xcb, 0xbb, 0x9b, 0x88,
+    0x81, 0x8b, 0xdb, 0xca, 0x19, 0x64, 0x23, 0x23, 0x12, 0x98, 0x52, 0x35, 0x24, 0x12, 0x90, 0xba,
+    0x9b, 0x21, 0x98, 0xeb, 0xcd, 0xbd, 0xaa, 0x89, 0x80, 0x90, 0x99, 0xbc, 0x8c, 0x31, 0x37, 0x43,
+    0x02, 0x82, 0x29, 0x72, 0x33, 0x14, 0x11, 0xa9, 0xbb, 0x09, 0x11, 0xa9, 0xde, 0xcc, 0xbb, 0xaa,
+    0x80, 0x00, 0x89, 0xcb, 0xda, 0x29, 0x72, 0x14, 0x13, 0x11, 0x89, 0x31, 0x27, 0x33, 0x22, 0xa0,
+    0xca, 0x8a, 0x29, 0x90, 0xe9, 0xbd, 0xbd, 0xbb, 0x88, 0x08, 0x90, 0xb8, 0xbc, 0x8c, 0x32, 0x57,
+    0x31, 0x11, 0x91, 0x00, 0x73, 0x23, 0x13, 0x02, 0xa9, 0xac, 0x08, 0x81, 0x9a, 0xcf, 0xdb, 0xab,
+    0x8b, 0x88, 0x90, 0x89, 0xab, 0xad, 0x10, 0x55, 0x33, 0x33, 0x21, 0x18, 0x62, 0x44, 0x33, 0x12,
+    0x98, 0xaa, 0x8b, 0x18, 0xa8, 0xfd, 0xbc, 0xbc, 0xba, 0x88, 0x08, 0x99, 0xc9, 0xb9, 0x0b, 0x62,
+    0x27, 0x22, 0x21, 0x01, 0x18, 0x45, 0x24, 0x12, 0x02, 0xb8, 0xab, 0x08, 0x91, 0xeb, 0xcc, 0xcc,
+    0xbb, 0x8b, 0x90, 0xa0, 0x88, 0xab, 0xbd, 0x22, 0x55, 0x42, 0x13, 0x12, 0x00, 0x52, 0x63, 0x32,
+    0x11, 0x80, 0xaa, 0x8b, 0x90, 0xa8, 0xec, 0xcd, 0xbb, 0xbb, 0x89, 0x18, 0x99, 0xba, 0xca, 0x9b,
+    0xb9, 0xc0, 0x34, 0x00, 0x57, 0x23, 0x32, 0x22, 0x88, 0x51, 0x45, 0x32, 0x11, 0xa2, 0xba, 0x8b,
+    0x80, 0xb1, 0xbd, 0xdf, 0xbb, 0xab, 0x89, 0x08, 0x98, 0xa8, 0xbc, 0x0c, 0x43, 0x36, 0x42, 0x12,
+    0x81, 0x20, 0x73, 0x23, 0x14, 0x02, 0xa9, 0xba, 0x90, 0x00, 0xab, 0xfe, 0xcb, 0xaa, 0x8b, 0x88,
+    0x80, 0x98, 0xcb, 0x9b, 0x20, 0x46, 0x34, 0x23, 0x20, 0x00, 0x32, 0x57, 0x22, 0x02, 0x90, 0xa9,
+    0x99, 0x09, 0x90, 0xfb, 0xbe, 0xbb, 0xac, 0x88, 0x08, 0x99, 0x9a, 0xbb, 0x9a, 0x45, 0x55, 0x21,
+    0x11, 0x02, 0x38, 0x72, 0x14, 0x12, 0x11, 0xa9, 0x8a, 0x98, 0x90, 0xab, 0xdf, 0xbc, 0xba, 0x9a,
+    0x88, 0x99, 0xa8, 0xda, 0x99, 0x31, 0x44, 0x26, 0x23, 0x20, 0x20, 0x33, 0x37, 0x24, 0x21, 0xa0,
+    0xa8, 0x98, 0x1a, 0xaa, 0xfc, 0xbd, 0xbb, 0xac, 0x89, 0x90, 0x99, 0x9a, 0xbb, 0x09, 0x36, 0x36,
+    0x33, 0x32, 0x03, 0x31, 0x67, 0x11, 0x12, 0x12, 0xaa, 0x1a, 0x98, 0xa9, 0xba, 0xef, 0xbb, 0xac,
+    0x99, 0x89, 0x89, 0xa8, 0xda, 0x88, 0x31, 0x62, 0x34, 0x14, 0x10, 0x21, 0x24, 0x34, 0x25, 0x02,
+    0xa8, 0x88, 0x99, 0x0a, 0x98, 0xee, 0xbc, 0xab, 0xbb, 0x8a, 0x88, 0xb9, 0xab, 0xab, 0x8a, 0x66,
+    0x34, 0x33, 0x22, 0x13, 0x41, 0x64, 0x23, 0x13, 0x01, 0x99, 0xaa, 0x98, 0x90, 0xec, 0xdc, 0xbb,
+    0xad, 0x89, 0x89, 0x98, 0x99, 0xaa, 0xa9, 0x50, 0x54, 0x23, 0x33, 0x23, 0x10, 0x36, 0x35, 0x22,
+    0x13, 0xa0, 0x9a, 0x89, 0x99, 0xc8, 0xbf, 0xcd, 0xac, 0x9a, 0x99, 0x99, 0x90, 0xaa, 0x9c, 0x00,
+    0x53, 0x63, 0x33, 0x13, 0x12, 0x52, 0x24, 0x43, 0x33, 0x01, 0x9a, 0x98, 0x9a, 0x8a, 0xf9, 0xbe,
+    0xad, 0xbb, 0xaa, 0x99, 0x89, 0xa9, 0xac, 0x90, 0x18, 0x74, 0x24, 0x22, 0x23, 0x12, 0x53, 0x34,
+    0xa2, 0x24, 0x3b, 0x00, 0x33, 0x12, 0xaa, 0x88, 0x99, 0x8a, 0xea, 0xcf, 0xcb, 0xab, 0x9b, 0xa9,
+    0x89, 0x9a, 0xac, 0x99, 0x10, 0x73, 0x34, 0x24, 0x22, 0x22, 0x34, 0x34, 0x44, 0x12, 0x80, 0x08,
+    0x99, 0x0a, 0xb2, 0xfc, 0xad, 0xcb, 0xba, 0x99, 0x99, 0xa9, 0xba, 0x99, 0x8a, 0x59, 0x36, 0x32,
+    0x34, 0x24, 0x22, 0x44, 0x33, 0x24, 0x21, 0x01, 0x99, 0x90, 0x82, 0xae, 0xcd, 0xdb, 0xbb, 0x9b,
+    0x9b, 0xba, 0xa9, 0x9b, 0xdb, 0x19, 0x53, 0x22, 0x45, 0x14, 0x11, 0x43, 0x33, 0x53, 0x33, 0x21,
+    0x80, 0x08, 0x00, 0xc8, 0xba, 0xfd, 0xad, 0xaa, 0xab, 0xaa, 0x98, 0xa9, 0xbb, 0x8b, 0x08, 0x38,
+    0x76, 0x23, 0x21, 0x25, 0x11, 0x52, 0x24, 0x32, 0x31, 0x81, 0x88, 0x80, 0x90, 0xcb, 0xcf, 0xcb,
+    0xcb, 0xab, 0xa9, 0xa9, 0x99, 0xa9, 0xab, 0x09, 0x11, 0x36, 0x36, 0x43, 0x12, 0x33, 0x35, 0x62,
+    0x33, 0x02, 0x12, 0x02, 0x0a, 0x88, 0xfa, 0xbb, 0xbd, 0xae, 0xab, 0xba, 0x99, 0x9a, 0x99, 0x8a,
+    0xcb, 0x20, 0x13, 0x55, 0x44, 0x12, 0x31, 0x33, 0x43, 0x35, 0x25, 0x31, 0x00, 0x00, 0xa9, 0xac,
+    0xa9, 0xec, 0xcb, 0xbb, 0xbc, 0x9b, 0x89, 0x99, 0x89, 0xa9, 0xca, 0x38, 0x45, 0x43, 0x34, 0x23,
+    0x20, 0x43, 0x44, 0x34, 0x34, 0x12, 0x90, 0x99, 0x99, 0xbb, 0xca, 0xdd, 0xcc, 0xab, 0xba, 0x9a,
+    0x89, 0xa0, 0xc9, 0x8a, 0x18, 0x20, 0x56, 0x23, 0x22, 0x33, 0x04, 0x63, 0x25, 0x33, 0x32, 0x11,
+    0x98, 0x98, 0x0a, 0xda, 0xeb, 0xbc, 0xbd, 0x9c, 0xa9, 0x99, 0x99, 0xa9, 0x9a, 0x89, 0x10, 0x24,
+    0x36, 0x33, 0x33, 0x43, 0x44, 0x63, 0x33, 0x24, 0x22, 0x02, 0x09, 0x00, 0xa9, 0xac, 0xdd, 0xcc,
+    0xbb, 0xab, 0xaa, 0xaa, 0x99, 0xca, 0xab, 0x20, 0x90, 0x72, 0x14, 0x11, 0x52, 0x12, 0x34, 0x45,
+    0xa3, 0x0f, 0x3b, 0x00, 0x32, 0x32, 0x12, 0x82, 0x01, 0x80, 0xdb, 0xdc, 0xbb, 0xbe, 0xab, 0xaa,
+    0xba, 0x99, 0xb9, 0xac, 0x08, 0x88, 0x20, 0x54, 0x10, 0x32, 0x26, 0x43, 0x54, 0x33, 0x24, 0x33,
+    0x22, 0x11, 0x01, 0x00, 0xfb, 0xbb, 0xcd, 0xbc, 0xab, 0xa8, 0x9b, 0x9b, 0xb9, 0xcb, 0x19, 0x88,
+    0x91, 0x24, 0x11, 0x50, 0x52, 0x26, 0x63, 0x33, 0x24, 0x22, 0x33, 0x21, 0x10, 0x82, 0xcc, 0xad,
+    0xcc, 0xbb, 0xaa, 0xab, 0xba, 0xac, 0x9a, 0xba, 0x89, 0x21, 0x9b, 0x8a, 0x82, 0x58, 0x47, 0x34,
+    0x35, 0x34, 0x34, 0x43, 0x22, 0x23, 0x81, 0x00, 0xbb, 0xcf, 0xa9, 0xbc, 0x9c, 0xa9, 0xca, 0x8a,
+    0x99, 0xb9, 0x88, 0x88, 0x9b, 0xba, 0x80, 0x08, 0x56, 0x35, 0x35, 0x44, 0x42, 0x32, 0x22, 0x33,
+    0x12, 0x81, 0x99, 0xdd, 0xbb, 0xbc, 0xbc, 0xaa, 0xca, 0xab, 0x99, 0xba, 0x89, 0x88, 0xbc, 0xea,
+    0xa9, 0x18, 0x48, 0x45, 0x24, 0x42, 0x44, 0x22, 0x43, 0x43, 0x11, 0x01, 0x98, 0xb9, 0xcb, 0xbc,
+    0xbc, 0xbc, 0xab, 0xbb, 0xab, 0x98, 0xba, 0x8b, 0xda, 0xdb, 0x9a, 0x89, 0x88, 0x50, 0x36, 0x33,
+    0x36, 0x27, 0x31, 0x33, 0x14, 0x12, 0x11, 0x89, 0xb9, 0xbe, 0xbb, 0xcc, 0xbb, 0x9a, 0xdb, 0x99,
+    0x89, 0x99, 0x99, 0xa9, 0x9a, 0xce, 0x98, 0x00, 0x28, 0x74, 0x12, 0x63, 0x42, 0x23, 0x34, 0x32,
+    0x22, 0x81, 0x88, 0xaa, 0xce, 0xb9, 0xda, 0xac, 0x9a, 0xaa, 0x8b, 0x08, 0xb9, 0xa8, 0x8a, 0xbc,
+    0xcb, 0x89, 0x98, 0x0c, 0x45, 0x34, 0x73, 0x34, 0x33, 0x34, 0x33, 0x23, 0x12, 0x10, 0xca, 0xeb,
+    0xbb, 0xbd, 0xac, 0xaa, 0xaa, 0xaa, 0x98, 0xa9, 0x0a, 0x89, 0xf9, 0xab, 0xa9, 0xcb, 0x1a, 0x44,
+    0x32, 0x56, 0x43, 0x33, 0x44, 0x23, 0x23, 0x21, 0x81, 0xb8, 0xbd, 0xba, 0xbf, 0xba, 0xaa, 0xbb,
+    0xa0, 0xf2, 0x36, 0x00, 0x98, 0x9a, 0xa8, 0x89, 0xcb, 0xda, 0xbb, 0xc9, 0x9c, 0x08, 0x31, 0x73,
+    0x27, 0x33, 0x44, 0x23, 0x43, 0x22, 0x11, 0x01, 0xb8, 0xcb, 0xcc, 0xac, 0xba, 0xbb, 0x8b, 0xcb,
+    0x9a, 0x88, 0xcb, 0x18, 0xc0, 0xac, 0xa9, 0xcc, 0x0a, 0x00, 0x42, 0x36, 0x53, 0x34, 0x34, 0x43,
+    0x33, 0x12, 0x13, 0x98, 0x9b, 0xdb, 0xdc, 0xaa, 0xcb, 0xbb, 0xaa, 0xa9, 0x8a, 0x91, 0x98, 0x8d,
+    0x99, 0xda, 0x9b, 0xaa, 0xca, 0x18, 0x71, 0x34, 0x34, 0x46, 0x32, 0x32, 0x35, 0x11, 0x10, 0x91,
+    0xca, 0x9a, 0xcc, 0xbb, 0xcb, 0xac, 0x9a, 0xb9, 0x18, 0x00, 0x99, 0x91, 0xdb, 0x8c, 0xb9, 0xbb,
+    0x08, 0xbc, 0x30, 0x77, 0x31, 0x45, 0x23, 0x32, 0x43, 0x11, 0x11, 0x01, 0xab, 0xcc, 0xeb, 0x9b,
+    0xcb, 0xa9, 0x98, 0x9a, 0x1a, 0xa8, 0x08, 0x21, 0xda, 0xa8, 0xdc, 0xac, 0x89, 0x89, 0x62, 0x23,
+    0x25, 0x44, 0x43, 0x42, 0x33, 0x22, 0x10, 0xa8, 0xc9, 0xac, 0xbb, 0xdb, 0xcb, 0xaa, 0xbb, 0xaa,
+    0x08, 0x12, 0x88, 0x80, 0xf9, 0xbc, 0x9b, 0xcb, 0x0b, 0x80, 0x38, 0x66, 0x22, 0x45, 0x24, 0x32,
+    0x34, 0x02, 0x10, 0x80, 0xab, 0xca, 0xdb, 0xbb, 0xcc, 0xaa, 0xa9, 0x9a, 0x11, 0xa8, 0x09, 0xa8,
+    0xdc, 0x8a, 0xab, 0xcd, 0xaa, 0x89, 0x19, 0x74, 0x25, 0x42, 0x43, 0x22, 0x32, 0x43, 0x01, 0x81,
+    0xa0, 0xcc, 0xac, 0xba, 0xbb, 0xab, 0xaa, 0xdb, 0x8b, 0x98, 0xa8, 0x30, 0x80, 0xcf, 0xba, 0xcc,
+    0xab, 0x81, 0x22, 0x72, 0x33, 0x24, 0x45, 0x43, 0x22, 0x24, 0x02, 0x09, 0x89, 0xca, 0xaa, 0xab,
+    0xdc, 0xcb, 0x99, 0x9a, 0x9a, 0x21, 0xb8, 0x8d, 0x82, 0xbc, 0x0b, 0xc8, 0xcd, 0x89, 0x08, 0x10,
+    0x46, 0x34, 0x22, 0x63, 0x23, 0x31, 0x43, 0x82, 0x98, 0xa8, 0xcc, 0xab, 0xba, 0xeb, 0xaa, 0xaa,
+    0xe4, 0xf5, 0x37, 0x00, 0x9b, 0x28, 0xa1, 0x9a, 0x11, 0xfc, 0x9b, 0x98, 0xbd, 0x8a, 0x81, 0x00,
+    0x66, 0x23, 0x43, 0x34, 0x33, 0x33, 0x43, 0x12, 0x98, 0x88, 0xdc, 0xbc, 0xa9, 0xdb, 0x9b, 0x98,
+    0xbb, 0x88, 0x00, 0xab, 0x09, 0xb2, 0xbd, 0x8c, 0xf9, 0xac, 0x0a, 0x80, 0x21, 0x67, 0x12, 0x22,
+    0x25, 0x21, 0x31, 0x24, 0x01, 0x19, 0xaa, 0xdc, 0xab, 0x9a, 0xcc, 0x99, 0x98, 0xac, 0x08, 0x81,
+    0x0b, 0x30, 0xd0, 0xb9, 0x8a, 0xcd, 0xcb, 0x88, 0x00, 0x40, 0x47, 0x22, 0x41, 0x14, 0x12, 0x42,
+    0x12, 0x00, 0x81, 0xbb, 0xae, 0xbb, 0xab, 0xbc, 0xaa, 0xa8, 0xad, 0x28, 0xb1, 0x09, 0x62, 0xda,
+    0xa8, 0xb0, 0x9e, 0x89, 0xb8, 0x20, 0x61, 0x42, 0x24, 0x43, 0x34, 0x11, 0x42, 0x03, 0x88, 0x22,
+    0xdb, 0x9c, 0xb9, 0xbd, 0x9a, 0xb9, 0x99, 0x98, 0x00, 0xa8, 0x8d, 0x11, 0xf9, 0x18, 0xa0, 0xbf,
+    0x99, 0xaa, 0x3a, 0x44, 0x34, 0x34, 0x31, 0x34, 0x12, 0x64, 0x22, 0x08, 0x81, 0xea, 0x9a, 0xa9,
+    0x9a, 0x88, 0xbc, 0x8a, 0xeb, 0x08, 0x12, 0x8a, 0x23, 0xf9, 0x0c, 0x99, 0xac, 0x80, 0xc9, 0x28,
+    0x13, 0x61, 0x35, 0x10, 0x53, 0x12, 0x31, 0x25, 0x80, 0x10, 0xca, 0x8c, 0x99, 0xb9, 0x08, 0xbd,
+    0xbb, 0xd0, 0x1a, 0x30, 0xa0, 0xa1, 0xc9, 0xbf, 0xa8, 0xb8, 0x18, 0xad, 0xa8, 0x03, 0x70, 0x36,
+    0x22, 0x33, 0x11, 0x20, 0x16, 0x21, 0x24, 0xc8, 0x99, 0xbc, 0x9d, 0x01, 0x98, 0x48, 0xda, 0x9a,
+    0xa0, 0x0c, 0x21, 0xc1, 0x0a, 0xd8, 0xae, 0x08, 0x9a, 0x20, 0x15, 0x20, 0x42, 0x91, 0x34, 0x43,
+    0x40, 0x05, 0x81, 0x38, 0x99, 0xab, 0x03, 0x9d, 0x0a, 0xc0, 0x9c, 0x89, 0xca, 0x00, 0xab, 0x8b,
+    0xf8, 0x9c, 0x09, 0xbc, 0xa8, 0xa1, 0x0b, 0x48, 0x26, 0x33, 0x73, 0x22, 0x01, 0x43, 0x23, 0x20,
+    0x3b, 0x1d, 0x33, 0x00, 0x12, 0xaa, 0xb0, 0xa9, 0x9b, 0xdd, 0x89, 0xca, 0xad, 0x80, 0xea, 0x0b,
+    0xb8, 0xcd, 0x19, 0xa9, 0xcb, 0x10, 0xab, 0x29, 0x14, 0x73, 0x32, 0x13, 0x26, 0x10, 0x50, 0x04,
+    0x01, 0x51, 0xa8, 0x98, 0x12, 0x9b, 0x08, 0xd2, 0xbb, 0x9c, 0xbc, 0x98, 0xa9, 0x09, 0xec, 0xcb,
+    0x98, 0xba, 0x1a, 0x04, 0xa9, 0x48, 0x02, 0x09, 0x67, 0x21, 0x22, 0x24, 0x21, 0x28, 0x92, 0x14,
+    0x31, 0x49, 0xc3, 0xc8, 0x8b, 0xcc, 0x9a, 0x10, 0x8b, 0xda, 0xca, 0xad, 0x9b, 0x98, 0x21, 0x1b,
+    0xd9, 0xda, 0x89, 0x4a, 0x22, 0x27, 0x11, 0x20, 0x81, 0x51, 0x44, 0x22, 0x23, 0x01, 0x0d, 0x98,
+    0xa0, 0x41, 0x9a, 0xcb, 0xf8, 0xab, 0x29, 0xc9, 0x18, 0x90, 0xaf, 0x88, 0xa8, 0x2a, 0x90, 0xb9,
+    0x08, 0xbb, 0x51, 0x17, 0x40, 0x43, 0x81, 0x24, 0x52, 0x28, 0x04, 0x81, 0x18, 0x89, 0xb8, 0x92,
+    0x9c, 0x9c, 0xfa, 0x99, 0x09, 0x9a, 0xa9, 0xaa, 0xcd, 0xaa, 0x18, 0x8a, 0xba, 0xc5, 0x8d, 0x2a,
+    0x81, 0x07, 0x34, 0x28, 0x84, 0x82, 0x72, 0x10, 0x02, 0x14, 0x9a, 0x19, 0xe0, 0x08, 0x18, 0xd8,
+    0x88, 0x9a, 0x8d, 0x98, 0x91, 0x19, 0xbc, 0xd8, 0xa8, 0x1c, 0x00, 0xb1, 0x19, 0x89, 0xbc, 0x54,
+    0x44, 0x21, 0x15, 0x01, 0x08, 0x22, 0x22, 0x44, 0x21, 0xa0, 0xac, 0xaa, 0xab, 0x8a, 0x33, 0xec,
+    0xba, 0xbc, 0xcc, 0x89, 0x01, 0xa9, 0x88, 0xb0, 0xdf, 0x00, 0x98, 0x20, 0x31, 0x81, 0x05, 0x50,
+    0x41, 0x02, 0x27, 0x21, 0x18, 0x84, 0x80, 0x49, 0x90, 0xa1, 0x80, 0xaf, 0xba, 0xba, 0x18, 0x99,
+    0x98, 0xd1, 0xbf, 0x98, 0xa8, 0x40, 0x21, 0xb9, 0xba, 0xbe, 0x0b, 0x12, 0x47, 0x22, 0x11, 0x00,
+    0x92, 0x72, 0x43, 0x13, 0x03, 0x80, 0x9d, 0x9a, 0xa8, 0x00, 0x8b, 0xec, 0xc9, 0x8b, 0x88, 0x88,
+    0x67, 0xfa, 0x31, 0x00, 0x90, 0xc9, 0x0a, 0xbd, 0x02, 0x98, 0x0e, 0xc8, 0xca, 0x68, 0x00, 0x23,
+    0x16, 0x30, 0x20, 0x83, 0x44, 0x12, 0x30, 0xa3, 0xad, 0x0b, 0xfa, 0x89, 0x80, 0xaa, 0xa8, 0x90,
+    0x8d, 0x81, 0x08, 0x01, 0x9f, 0xa0, 0xb9, 0x8f, 0x88, 0xca, 0x18, 0x18, 0x00, 0x47, 0x12, 0x32,
+    0x14, 0x12, 0x42, 0x01, 0x23, 0x99, 0x9a, 0xfb, 0xac, 0x19, 0xcb, 0x01, 0x80, 0x9a, 0x1a, 0xf8,
+    0x18, 0x8a, 0x98, 0xeb, 0x9b, 0xac, 0xbc, 0x18, 0xa9, 0x30, 0x17, 0x42, 0x53, 0x13, 0x24, 0x21,
+    0x32, 0x92, 0x12, 0x31, 0xbd, 0xc9, 0xd9, 0x8c, 0x89, 0x90, 0x10, 0x89, 0x99, 0xf9, 0x8a, 0x0a,
+    0xfa, 0x89, 0xb9, 0x9e, 0xa9, 0xa9, 0x2c, 0x02, 0x42, 0x27, 0x31, 0x23, 0x05, 0x38, 0x23, 0x18,
+    0x16, 0x88, 0x9b, 0xd0, 0xbb, 0x20, 0x99, 0x01, 0x91, 0xbf, 0xa8, 0xca, 0x20, 0x8a, 0xfa, 0xb8,
+    0x9f, 0x99, 0x90, 0x10, 0x10, 0x98, 0x00, 0x54, 0x62, 0x24, 0x14, 0x01, 0x80, 0x08, 0x02, 0x51,
+    0x02, 0xc0, 0xbb, 0xbd, 0x9b, 0x11, 0x31, 0x92, 0xeb, 0xad, 0xba, 0x0b, 0x05, 0x88, 0x98, 0xfb,
+    0x9d, 0x09, 0x19, 0x23, 0x22, 0x14, 0x21, 0x41, 0x36, 0x22, 0x34, 0x02, 0x99, 0x88, 0xb0, 0x19,
+    0x9b, 0xda, 0xed, 0x99, 0x09, 0xa9, 0x31, 0xa2, 0xae, 0x8a, 0xea, 0x9a, 0x01, 0x99, 0xba, 0xbc,
+    0x9c, 0xaa, 0x72, 0x17, 0x21, 0x33, 0x13, 0x39, 0x25, 0x00, 0x22, 0x12, 0xba, 0xda, 0x9d, 0xbb,
+    0xbb, 0x81, 0x89, 0x9b, 0x93, 0xcc, 0x2c, 0x8a, 0xe0, 0x98, 0xad, 0xbc, 0xca, 0x0a, 0x19, 0x10,
+    0x44, 0x42, 0x32, 0x47, 0x33, 0x32, 0x22, 0x91, 0x9b, 0x8b, 0x91, 0xc2, 0x18, 0xcf, 0xbd, 0x8a,
+    0x08, 0x10, 0x16, 0xa1, 0xac, 0x99, 0xcb, 0x20, 0x00, 0xd9, 0xca, 0xbc, 0x09, 0x11, 0x65, 0x22,
+    0x14, 0xf9, 0x3b, 0x00, 0x30, 0x13, 0x10, 0x37, 0x02, 0x08, 0x90, 0xad, 0x89, 0x8a, 0x88, 0xb8,
+    0x9e, 0x89, 0xba, 0x41, 0x12, 0x89, 0x88, 0xfc, 0x8b, 0xca, 0xa8, 0x8a, 0x9b, 0x08, 0xb2, 0x71,
+    0x34, 0x24, 0x36, 0x24, 0x21, 0x82, 0x91, 0xa9, 0x08, 0x92, 0xa0, 0x9d, 0xdd, 0xcb, 0x89, 0x20,
+    0x01, 0x13, 0xa8, 0xbf, 0x8a, 0xa8, 0x09, 0x90, 0xfa, 0x9e, 0x8a, 0x19, 0x33, 0x63, 0x22, 0x01,
+    0x42, 0x35, 0x41, 0x14, 0x91, 0xa9, 0x9a, 0x9d, 0x01, 0x08, 0x89, 0xec, 0xab, 0x88, 0x0a, 0x44,
+    0x82, 0xa9, 0xa9, 0xbf, 0x0a, 0x89, 0x88, 0x82, 0xac, 0x09, 0xb0, 0x65, 0x44, 0x21, 0x34, 0x82,
+    0x38, 0x01, 0x90, 0x32, 0xa9, 0xad, 0xf9, 0x9c, 0x89, 0xa9, 0x20, 0x01, 0x9d, 0x81, 0xbb, 0x0a,
+    0x93, 0xa9, 0x99, 0xff, 0x9b, 0xa9, 0x49, 0x33, 0x03, 0x36, 0x11, 0x31, 0x37, 0x22, 0x33, 0x81,
+    0xb8, 0xba, 0x8d, 0xaa, 0xbb, 0xc9, 0xaf, 0x8a, 0xa8, 0x08, 0x14, 0x8a, 0x80, 0xfa, 0x8a, 0xb8,
+    0xbc, 0x00, 0xdb, 0x28, 0x83, 0x5b, 0x45, 0x82, 0x45, 0x23, 0x30, 0x24, 0x99, 0x19, 0xc0, 0x8a,
+    0x11, 0xcd, 0xaa, 0xcb, 0x8d, 0x00, 0x00, 0x32, 0xa9, 0xcb, 0xc0, 0x0c, 0x29, 0xc1, 0xa8, 0x89,
+    0xae, 0x00, 0x44, 0x32, 0x35, 0x14, 0x11, 0x32, 0x03, 0x43, 0x21, 0xac, 0xd8, 0xca, 0x9b, 0xb9,
+    0xab, 0x80, 0x9f, 0x09, 0xa1, 0x1b, 0x21, 0xf9, 0x88, 0xa9, 0x8d, 0x98, 0x98, 0x30, 0x01, 0x55,
+    0x33, 0x44, 0x44, 0x21, 0x31, 0x02, 0x91, 0x00, 0x8b, 0xbc, 0xea, 0xba, 0xbd, 0xaa, 0xa9, 0x8a,
+    0x38, 0xd8, 0x90, 0xa9, 0x9e, 0xba, 0xb1, 0x10, 0x2c, 0x20, 0xc4, 0x52, 0x63, 0x41, 0x34, 0x14,
+    0x21, 0x11, 0x88, 0x98, 0x91, 0x98, 0xbc, 0xaf, 0xda, 0xaa, 0x09, 0x98, 0x08, 0x09, 0xaf, 0xa9,
+    0x53, 0xed, 0x33, 0x00, 0xa9, 0x01, 0x10, 0x9b, 0xab, 0x02, 0x71, 0x47, 0x43, 0x32, 0x31, 0x02,
+    0x83, 0x31, 0x32, 0xb8, 0xb8, 0xbf, 0xbe, 0x9a, 0xba, 0x8c, 0x90, 0xb9, 0x09, 0xbd, 0xca, 0xd9,
+    0x8a, 0xa0, 0x0a, 0x41, 0xc1, 0x51, 0x43, 0x48, 0x27, 0x02, 0x52, 0x01, 0x08, 0x03, 0xaa, 0x20,
+    0xfa, 0x0b, 0xb0, 0x9d, 0x01, 0xda, 0x19, 0xc1, 0x8b, 0x83, 0xbc, 0x38, 0xf8, 0x0b, 0x82, 0x8c,
+    0x43, 0x91, 0x52, 0x14, 0x39, 0x25, 0x81, 0x43, 0x90, 0x09, 0x81, 0xbc, 0x10, 0xfa, 0x8a, 0xb9,
+    0xbb, 0x02, 0xaa, 0x58, 0xd0, 0x8c, 0xa1, 0xac, 0x30, 0xb8, 0x29, 0x85, 0x8b, 0x46, 0x80, 0x54,
+    0x12, 0x10, 0x15, 0x98, 0x31, 0xc0, 0x1a, 0x91, 0xae, 0x80, 0xda, 0x0a, 0xa0, 0xab, 0x32, 0xbc,
+    0x39, 0xe0, 0x8a, 0x11, 0x9b, 0x52, 0xb1, 0x28, 0x22, 0x59, 0x45, 0x14, 0x42, 0x12, 0x80, 0x01,
+    0x08, 0x00, 0x81, 0xfb, 0xaa, 0xbe, 0xab, 0x99, 0x9a, 0x10, 0xfa, 0x89, 0xa9, 0x0b, 0x04, 0x82,
+    0x73, 0x98, 0x08, 0x85, 0x3a, 0x46, 0x81, 0x31, 0x82, 0x9a, 0x24, 0x89, 0x61, 0xb1, 0x99, 0xb9,
+    0xcf, 0x80, 0xb8, 0x19, 0xa0, 0xbc, 0x1a, 0xba, 0x89, 0x27, 0x18, 0x10, 0x93, 0x30, 0x73, 0x10,
+    0x26, 0x00, 0x38, 0x92, 0x0b, 0x72, 0xb8, 0x11, 0x90, 0x8e, 0xa0, 0xca, 0x00, 0xad, 0x18, 0xc0,
+    0x8c, 0x02, 0xbd, 0x31, 0xb8, 0x50, 0x23, 0x0a, 0x27, 0x99, 0x51, 0x81, 0x39, 0x14, 0xab, 0x32,
+    0xea, 0x2a, 0x92, 0xba, 0x21, 0xbd, 0x8a, 0xb2, 0x0a, 0x12, 0xbe, 0x88, 0xbb, 0x0a, 0x26, 0x08,
+    0x62, 0xb2, 0x29, 0x52, 0x01, 0x54, 0x02, 0x19, 0xb2, 0x9a, 0x20, 0xcb, 0x18, 0xe1, 0x9f, 0x92,
+    0xca, 0x31, 0xa8, 0x8a, 0x84, 0xac, 0x42, 0xa8, 0x30, 0x93, 0x9d, 0x33, 0x08, 0x72, 0x04, 0x08,
+    0xf5, 0x05, 0x30, 0x00, 0x80, 0x9a, 0x31, 0x84, 0x39, 0xd0, 0xce, 0x98, 0x9a, 0x3b, 0x07, 0x99,
+    0x12, 0xbc, 0x0b, 0x23, 0x10, 0x37, 0x90, 0x8a, 0xc9, 0x29, 0x43, 0x32, 0x25, 0xc9, 0x8a, 0x99,
+    0x39, 0x73, 0x82, 0xb9, 0xad, 0xbc, 0x99, 0x25, 0x11, 0x10, 0xf8, 0x9a, 0x09, 0x30, 0x26, 0x21,
+    0x80, 0xfa, 0x0a, 0x00, 0x39, 0x27, 0x88, 0x09, 0xd8, 0x8a, 0x13, 0x39, 0x14, 0xb9, 0x0c, 0xeb,
+    0x0a, 0x15, 0x89, 0x23, 0xd9, 0x0a, 0x88, 0x80, 0x27, 0x00, 0x01, 0xda, 0x08, 0x89, 0x38, 0x16,
+    0x88, 0x08, 0xeb, 0x19, 0x88, 0x51, 0x82, 0x80, 0x89, 0xbe, 0x08, 0x01, 0x68, 0x83, 0x99, 0xb0,
+    0x9d, 0x11, 0x13, 0x71, 0x83, 0xab, 0xa0, 0x9e, 0x11, 0x11, 0x41, 0xa1, 0xae, 0x81, 0x8d, 0x31,
+    0x02, 0x20, 0x00, 0xbe, 0x80, 0x09, 0x43, 0x92, 0x41, 0xd9, 0xaa, 0x12, 0x10, 0x71, 0xa3, 0x88,
+    0xbb, 0x0b, 0xb0, 0x61, 0x22, 0xda, 0x8a, 0xd0, 0x0d, 0x04, 0x10, 0x11, 0x08, 0xc8, 0x88, 0x49,
+    0x83, 0x08, 0x27, 0x8d, 0x80, 0x00, 0x0a, 0x23, 0xc0, 0x23, 0x8f, 0x01, 0xd9, 0x28, 0x81, 0xad,
+    0x32, 0xea, 0x28, 0xb2, 0x29, 0x21, 0xa9, 0x25, 0xb0, 0x7a, 0xb2, 0x19, 0x15, 0xab, 0x41, 0xc0,
+    0x3b, 0xa3, 0x0a, 0x25, 0xab, 0x30, 0xf0, 0x2b, 0x81, 0x9b, 0x15, 0xdb, 0x28, 0xd8, 0x28, 0x12,
+    0x89, 0x25, 0xb9, 0x48, 0xc1, 0x30, 0x82, 0x29, 0xa2, 0xeb, 0x30, 0xe8, 0x48, 0xa2, 0x09, 0x02,
+    0xbb, 0x32, 0xca, 0x49, 0xf3, 0x1c, 0x82, 0x8c, 0x21, 0xa1, 0x2d, 0xa4, 0x1a, 0x22, 0x88, 0x33,
+    0xb0, 0x2b, 0xc1, 0xcb, 0x54, 0xa9, 0x12, 0x80, 0xac, 0x11, 0xb1, 0x72, 0x10, 0xb9, 0xb3, 0x8d,
+    0x0b, 0x94, 0x0a, 0x05, 0x9e, 0x80, 0x91, 0x59, 0x23, 0xa8, 0x31, 0xdc, 0x1a, 0x84, 0x38, 0x31,
+    0x19, 0x03, 0x26, 0x00, 0xbf, 0x91, 0x99, 0x60, 0x21, 0xa2, 0x12, 0xae, 0x8b, 0x92, 0x30, 0x71,
+    0xc2, 0x9a, 0xa0, 0x8f, 0x21, 0x02, 0x69, 0xa2, 0x9c, 0x11, 0xcb, 0x62, 0xa2, 0x19, 0x82, 0xcd,
+    0x31, 0xb8, 0x50, 0x93, 0x8b, 0x23, 0xce, 0x21, 0xa1, 0x3a, 0x86, 0xab, 0x21, 0xd9, 0x49, 0x92,
+    0x2b, 0x04, 0xba, 0x40, 0xd0, 0x29, 0x82, 0x89, 0x32, 0xc8, 0x29, 0xa0, 0x9a, 0x31, 0x38, 0x85,
+    0x43, 0xdb, 0x89, 0xab, 0x8a, 0x57, 0xa0, 0x32, 0xc9, 0xad, 0x01, 0x8a, 0x73, 0x93, 0x08, 0x90,
+    0xaf, 0x00, 0x91, 0x61, 0x83, 0xaa, 0x80, 0xbd, 0x48, 0x83, 0x40, 0x12, 0xdb, 0x88, 0xca, 0x48,
+    0x03, 0x10, 0x12, 0xdd, 0x88, 0x98, 0x48, 0x04, 0x00, 0x08, 0xbd, 0x89, 0x82, 0x60, 0x03, 0xa8,
+    0x98, 0xad, 0x28, 0x13, 0x63, 0x81, 0xd9, 0x89, 0x9b, 0x32, 0x15, 0x11, 0x99, 0xce, 0x88, 0x19,
+    0x32, 0x05, 0x90, 0xaa, 0xdb, 0x08, 0x24, 0x32, 0x01, 0xf8, 0x8b, 0x98, 0x31, 0x35, 0x02, 0x9b,
+    0xf9, 0x8a, 0x30, 0x22, 0x22, 0xb8, 0xdf, 0x89, 0x88, 0x51, 0x22, 0x98, 0x09, 0xdc, 0x19, 0x13,
+    0x20, 0x16, 0xb8, 0x8a, 0xb8, 0x2a, 0x17, 0x10, 0x01, 0xba, 0x9d, 0x91, 0x1a, 0x53, 0xa0, 0x9a,
+    0x88, 0xad, 0x30, 0x05, 0x18, 0x01, 0xd8, 0x2a, 0x10, 0x32, 0x07, 0x18, 0x09, 0xfb, 0x00, 0x10,
+    0x98, 0x15, 0xba, 0x9c, 0xa1, 0xcb, 0x73, 0x91, 0x91, 0x82, 0xaf, 0x11, 0x91, 0x44, 0x81, 0x8a,
+    0xb0, 0x8d, 0x61, 0x91, 0x51, 0xb0, 0xac, 0x80, 0x9a, 0x70, 0x93, 0x88, 0x99, 0xad, 0x00, 0x21,
+    0x63, 0x91, 0x99, 0x90, 0x9d, 0x53, 0x02, 0x20, 0xa1, 0xbd, 0x08, 0x89, 0x52, 0x92, 0x08, 0xea,
+    0xbb, 0x10, 0x8a, 0x73, 0xa1, 0x08, 0x88, 0xbb, 0x43, 0x82, 0x44, 0x12, 0x01, 0x81, 0x9a, 0xa9,
+    0x45, 0x02, 0x23, 0x00, 0x10, 0x45, 0x88, 0xa8, 0xae, 0xed, 0x18, 0x99, 0x00, 0x81, 0xca, 0x89,
+    0x89, 0x23, 0x37, 0x31, 0xc2, 0x30, 0x00, 0x63, 0x23, 0x83, 0x2a, 0xce, 0x80, 0x09, 0x58, 0xb1,
+    0xba, 0xeb, 0xad, 0x88, 0x98, 0x48, 0xb1, 0x80, 0x10, 0x0a, 0x37, 0x11, 0x63, 0x08, 0x02, 0x14,
+    0x59, 0x82, 0xa9, 0x80, 0x9c, 0x18, 0x94, 0x8c, 0xf9, 0xbb, 0x9b, 0x9a, 0x28, 0x85, 0x1b, 0x08,
+    0xd9, 0x51, 0x34, 0x29, 0x26, 0xa9, 0x52, 0x81, 0x20, 0x24, 0xbd, 0x21, 0xbc, 0x30, 0xa3, 0x9c,
+    0xa1, 0xff, 0x08, 0x98, 0x20, 0x82, 0x9a, 0x80, 0x9b, 0x71, 0x13, 0x32, 0x01, 0xaa, 0x40, 0x12,
+    0x54, 0x13, 0xdb, 0x09, 0xdb, 0x38, 0x11, 0xb8, 0xa8, 0xff, 0x89, 0x88, 0x20, 0x03, 0xa9, 0x90,
+    0xbb, 0x71, 0x15, 0x30, 0x01, 0xa9, 0x29, 0x02, 0x72, 0x84, 0x98, 0x8b, 0xcb, 0x28, 0x02, 0x99,
+    0xbb, 0xff, 0x0a, 0x08, 0x10, 0x13, 0xba, 0x89, 0xaa, 0x73, 0x26, 0x01, 0x01, 0xab, 0x18, 0x24,
+    0x62, 0x03, 0xba, 0xac, 0xaa, 0x3a, 0x16, 0x88, 0xdb, 0xcc, 0x8a, 0x00, 0x42, 0x02, 0xb8, 0x9c,
+    0x99, 0x52, 0x45, 0x02, 0x08, 0xb9, 0x0a, 0x61, 0x13, 0x14, 0xa9, 0xdb, 0x9b, 0x19, 0x24, 0x80,
+    0xda, 0xdb, 0x9c, 0x10, 0x31, 0x21, 0xb2, 0xad, 0x98, 0x41, 0x35, 0x14, 0x18, 0xc9, 0x1a, 0x32,
+    0x24, 0x24, 0xc9, 0xbc, 0x99, 0x09, 0x53, 0xa0, 0xd9, 0xbc, 0x9b, 0x20, 0x32, 0x25, 0xb9, 0x9c,
+    0x80, 0x58, 0x36, 0x01, 0x88, 0xa8, 0x2b, 0x26, 0x31, 0x03, 0xfb, 0x8a, 0xb9, 0x49, 0x13, 0xab,
+    0xb9, 0xef, 0x08, 0x00, 0x21, 0x01, 0x9b, 0x90, 0x2b, 0x45, 0x13, 0x10, 0xb1, 0x8b, 0x62, 0x24,
+    0x23, 0xb8, 0xdb, 0xbc, 0x10, 0x31, 0x91, 0xe9, 0xcd, 0xaa, 0x18, 0x32, 0x23, 0x90, 0xcc, 0x8b,
+    0x77, 0xee, 0x34, 0x00, 0x63, 0x33, 0x13, 0xc9, 0x9a, 0x30, 0x54, 0x25, 0x90, 0xba, 0xad, 0x1a,
+    0x21, 0x32, 0xc1, 0xcf, 0x8a, 0x99, 0x40, 0x23, 0x80, 0x99, 0xcc, 0x20, 0x12, 0x35, 0x82, 0xab,
+    0x21, 0x0a, 0x67, 0x00, 0x99, 0xa8, 0x9b, 0x21, 0x21, 0xa1, 0xde, 0xab, 0xaa, 0x22, 0x43, 0x93,
+    0x9b, 0xac, 0x92, 0x79, 0x07, 0x88, 0x08, 0xa0, 0x58, 0x13, 0x11, 0x80, 0xcd, 0x18, 0x89, 0x43,
+    0x82, 0xae, 0xa8, 0x9e, 0x28, 0x12, 0x18, 0xa3, 0x9d, 0x88, 0x01, 0x62, 0x82, 0x19, 0xa0, 0x8a,
+    0x64, 0x82, 0x30, 0xb1, 0xad, 0x00, 0x09, 0x32, 0xb1, 0xad, 0xfc, 0x8a, 0x81, 0x11, 0x33, 0xc1,
+    0x8b, 0xc8, 0x28, 0x33, 0x34, 0x82, 0xba, 0x60, 0xa0, 0x72, 0x92, 0x89, 0x00, 0xc9, 0x60, 0xc8,
+    0x09, 0xbb, 0x8b, 0x22, 0xaa, 0x36, 0xeb, 0x29, 0x81, 0x28, 0x34, 0xd9, 0x29, 0xb8, 0x73, 0x12,
+    0x01, 0x88, 0xbd, 0x40, 0x80, 0x33, 0xa8, 0xcd, 0x9a, 0xaa, 0x33, 0x09, 0x84, 0xbd, 0x00, 0x11,
+    0x28, 0x16, 0x9b, 0x11, 0x3a, 0x37, 0x80, 0x80, 0x98, 0xab, 0x67, 0x08, 0x82, 0x9b, 0xbc, 0x08,
+    0x1a, 0x86, 0x1a, 0xd8, 0x9a, 0x18, 0x01, 0x44, 0x01, 0xa9, 0xb8, 0x0e, 0x04, 0x48, 0x23, 0xb1,
+    0x0d, 0xc2, 0x2b, 0x33, 0x91, 0x21, 0xfc, 0x9a, 0x90, 0x1a, 0x16, 0x9a, 0x80, 0xb9, 0x1d, 0x15,
+    0x09, 0x21, 0x81, 0x0b, 0x91, 0xba, 0x51, 0x80, 0x47, 0x80, 0xa8, 0x88, 0xaf, 0x23, 0x18, 0x82,
+    0x98, 0xcf, 0x08, 0x09, 0x23, 0x22, 0x91, 0xbd, 0x0a, 0x31, 0x20, 0x47, 0xaa, 0x90, 0x29, 0x28,
+    0x17, 0x1a, 0xa2, 0x8f, 0x01, 0x88, 0x21, 0xb2, 0xaf, 0x02, 0x8c, 0x03, 0x81, 0xac, 0x82, 0x2c,
+    0x07, 0x19, 0x00, 0xb8, 0x2b, 0x04, 0x8a, 0x34, 0xa8, 0x80, 0x00, 0xbf, 0x22, 0x09, 0x84, 0x09,
+    0xf5, 0xff, 0x2d, 0x00, 0x9e, 0xb9, 0x69, 0x03, 0x10, 0x00, 0xfb, 0x2b, 0x02, 0x42, 0x02, 0xc9,
+    0x9a, 0x8a, 0x44, 0x12, 0x10, 0xd9, 0x8d, 0x01, 0x88, 0x41, 0xa2, 0x19, 0xca, 0x99, 0x08, 0x1b,
+    0x67, 0x9a, 0x01, 0x90, 0x1b, 0x16, 0x08, 0x01, 0xbc, 0x88, 0x19, 0x51, 0x15, 0x8a, 0xa1, 0x9f,
+    0x02, 0x11, 0x88, 0x92, 0x8d, 0x90, 0x49, 0xa0, 0x1a, 0x28, 0x07, 0x38, 0xf8, 0x09, 0x9a, 0x32,
+    0x42, 0xa1, 0x99, 0xae, 0x38, 0x93, 0x71, 0xb0, 0xb9, 0x3c, 0xb3, 0x72, 0xa9, 0x81, 0x0d, 0x90,
+    0x32, 0xca, 0x13, 0x09, 0x32, 0x92, 0xca, 0x9f, 0xa0, 0x64, 0x88, 0x04, 0x8d, 0xa0, 0x20, 0x09,
+    0x85, 0x0b, 0xd1, 0x18, 0x21, 0x81, 0x0a, 0xb0, 0x9f, 0x23, 0x31, 0x02, 0xb0, 0xbf, 0xa1, 0x5b,
+    0x05, 0x11, 0x8a, 0xd9, 0x0b, 0x12, 0x30, 0x05, 0x90, 0xad, 0x91, 0x4a, 0x12, 0x00, 0x9a, 0xc0,
+    0x3c, 0x84, 0x08, 0x10, 0xc9, 0x20, 0xb2, 0x0e, 0xa1, 0x0e, 0x33, 0x11, 0x20, 0xf0, 0x0d, 0x90,
+    0x38, 0x43, 0xc0, 0x1a, 0xc9, 0x28, 0x24, 0x80, 0xa0, 0xec, 0x19, 0x82, 0x42, 0x01, 0xba, 0x8c,
+    0xa0, 0x69, 0x83, 0x01, 0x0b, 0xf2, 0x1a, 0x91, 0x31, 0x38, 0xa6, 0x3a, 0xf9, 0x8a, 0x18, 0x12,
+    0x73, 0xb2, 0x8b, 0xba, 0x2b, 0x27, 0x11, 0xa8, 0xf8, 0x1a, 0x81, 0x62, 0x90, 0xa8, 0x09, 0xa8,
+    0x63, 0x99, 0x91, 0x9c, 0x30, 0x15, 0x10, 0x80, 0xcf, 0x18, 0x08, 0x34, 0x81, 0xba, 0xa9, 0x9f,
+    0x24, 0x08, 0x12, 0xc8, 0x9c, 0x02, 0x2a, 0x25, 0x99, 0x00, 0xbd, 0x10, 0x23, 0x19, 0x17, 0x9c,
+    0x98, 0x09, 0x28, 0x05, 0x2a, 0xa8, 0xab, 0x08, 0x00, 0x72, 0x01, 0x89, 0xa0, 0x9f, 0x00, 0x50,
+    0x21, 0x92, 0x99, 0xbe, 0x18, 0x42, 0x32, 0x91, 0xcd, 0xab, 0x39, 0x24, 0x25, 0x90, 0xeb, 0x8a,
+    0xdd, 0xf8, 0x35, 0x00, 0x20, 0x13, 0x41, 0xd8, 0x88, 0x09, 0x91, 0x51, 0x90, 0x11, 0xbd, 0x80,
+    0x8a, 0x72, 0x23, 0x90, 0xa1, 0xef, 0x08, 0x10, 0x33, 0x02, 0xbc, 0xca, 0x8b, 0x54, 0x12, 0x01,
+    0xca, 0xbc, 0x10, 0x10, 0x34, 0x90, 0x88, 0x00, 0x19, 0xd2, 0x9e, 0x00, 0x18, 0x47, 0x88, 0xa9,
+    0xcb, 0x2a, 0x24, 0x42, 0x93, 0xaf, 0x99, 0x89, 0x61, 0x02, 0x00, 0xb0, 0x8d, 0x80, 0x18, 0x31,
+    0x90, 0x50, 0xc1, 0x09, 0xd9, 0x19, 0x22, 0x42, 0x14, 0xbc, 0xab, 0xac, 0x48, 0x25, 0x20, 0x81,
+    0xda, 0x9b, 0xb8, 0x50, 0x23, 0x12, 0x82, 0xce, 0x19, 0xa8, 0x61, 0x82, 0x1a, 0xa2, 0x8d, 0x82,
+    0xac, 0x33, 0xc8, 0x72, 0xa1, 0x09, 0xb0, 0x8d, 0x32, 0x89, 0x26, 0xba, 0x08, 0x98, 0x4a, 0x06,
+    0x99, 0x91, 0xcb, 0x30, 0x91, 0x30, 0xb3, 0x9e, 0x33, 0xaa, 0x24, 0xeb, 0x0a, 0x11, 0x48, 0x17,
+    0xba, 0x80, 0xca, 0x51, 0x13, 0x08, 0x91, 0xbf, 0x18, 0x88, 0x41, 0x92, 0x0b, 0x91, 0x8b, 0x13,
+    0xdb, 0x8a, 0x0a, 0x64, 0x33, 0x81, 0xd9, 0x9b, 0x0a, 0x37, 0x13, 0x81, 0xe9, 0x9c, 0x08, 0x10,
+    0x33, 0x99, 0xa8, 0xbd, 0x89, 0x89, 0x98, 0x71, 0x81, 0x88, 0x88, 0x8a, 0x74, 0x14, 0x11, 0xca,
+    0x8a, 0x18, 0x64, 0x03, 0x98, 0xe9, 0x9b, 0x80, 0x18, 0x16, 0xc9, 0x89, 0xca, 0x49, 0x02, 0x18,
+    0x90, 0x9d, 0x43, 0x01, 0x52, 0xc1, 0x0c, 0x00, 0x30, 0x36, 0x91, 0x99, 0xec, 0x0a, 0x18, 0x21,
+    0x24, 0xba, 0xbc, 0xbc, 0x28, 0x24, 0x33, 0xc0, 0x9e, 0x08, 0x10, 0x45, 0x81, 0x89, 0xb8, 0x2a,
+    0x35, 0x00, 0x23, 0xcd, 0x0a, 0xb9, 0x29, 0x15, 0x98, 0xb2, 0xbf, 0x98, 0x08, 0x53, 0x91, 0x80,
+    0xba, 0x28, 0x33, 0x46, 0x02, 0x9b, 0xa0, 0x28, 0x47, 0x02, 0xa0, 0xbd, 0xbb, 0x19, 0x44, 0x22,
+    0x0a, 0x0e, 0x3a, 0x00, 0xda, 0xad, 0x89, 0x20, 0x24, 0x80, 0xa9, 0x8a, 0x08, 0x45, 0x24, 0x80,
+    0x99, 0xaa, 0x62, 0x32, 0x03, 0xc8, 0xae, 0x9a, 0x19, 0x42, 0x01, 0xc8, 0xbd, 0x9a, 0x09, 0x34,
+    0x02, 0x98, 0xb9, 0x09, 0x52, 0x45, 0x22, 0x90, 0x8a, 0x80, 0x73, 0x32, 0xa1, 0xdb, 0xbc, 0xaa,
+    0x40, 0x23, 0x92, 0xbf, 0xdb, 0x09, 0x30, 0x14, 0x18, 0xba, 0x89, 0x20, 0x55, 0x33, 0x81, 0xb9,
+    0x9a, 0x38, 0x77, 0x10, 0xa9, 0xcb, 0x9b, 0x20, 0x43, 0x82, 0xda, 0xad, 0x89, 0x10, 0x43, 0x90,
+    0x99, 0x89, 0x38, 0x37, 0x23, 0x91, 0xda, 0x0a, 0x30, 0x37, 0x81, 0xa0, 0xbe, 0x8a, 0x88, 0x60,
+    0x82, 0xa9, 0xbb, 0xad, 0x30, 0x13, 0x32, 0xda, 0x9a, 0x33, 0x40, 0x17, 0x00, 0x98, 0x88, 0x89,
+    0x34, 0x32, 0x93, 0xfc, 0x9d, 0x99, 0x31, 0x33, 0xa8, 0xcd, 0xbb, 0x28, 0x31, 0x06, 0x00, 0x9a,
+    0x81, 0x18, 0x54, 0x12, 0x00, 0xf9, 0x19, 0x12, 0x24, 0x02, 0xbe, 0xba, 0x8c, 0x41, 0x12, 0x10,
+    0xfa, 0x9c, 0x80, 0x40, 0x23, 0xa8, 0xb9, 0x8b, 0x51, 0x16, 0x21, 0xb8, 0xac, 0x00, 0x62, 0x12,
+    0xa0, 0xeb, 0x9b, 0x28, 0x24, 0x12, 0xcb, 0xcc, 0x08, 0x21, 0x43, 0xc8, 0x89, 0x0a, 0x31, 0x17,
+    0x88, 0x80, 0x9b, 0x11, 0x21, 0x54, 0x91, 0xaa, 0xbf, 0x8a, 0x42, 0x32, 0x91, 0xae, 0x9a, 0x29,
+    0x32, 0xb2, 0x8a, 0xba, 0x73, 0x33, 0x12, 0xc9, 0xad, 0x20, 0x51, 0x33, 0xa3, 0xad, 0xbd, 0x09,
+    0x41, 0x12, 0x00, 0xe8, 0x8b, 0x00, 0x98, 0x00, 0x0c, 0x24, 0x14, 0x01, 0xa9, 0xbc, 0x10, 0x62,
+    0x31, 0x93, 0x00, 0xad, 0xc9, 0xab, 0x50, 0x11, 0x13, 0xc0, 0x9f, 0x90, 0x08, 0x13, 0xae, 0x00,
+    0x22, 0x73, 0x83, 0xca, 0x99, 0x0b, 0x43, 0x04, 0x12, 0xbb, 0xac, 0x98, 0x43, 0x80, 0x98, 0xfa,
+    0x2a, 0xf6, 0x39, 0x00, 0x22, 0x02, 0x89, 0xec, 0x0a, 0x32, 0x62, 0x03, 0xb9, 0x9b, 0x99, 0x40,
+    0x17, 0x88, 0x88, 0xeb, 0x19, 0x22, 0x31, 0xa4, 0xad, 0x9a, 0x0b, 0x33, 0x92, 0x09, 0x1a, 0x34,
+    0x81, 0x14, 0x1b, 0xd9, 0x01, 0x18, 0x75, 0xb0, 0x98, 0xbf, 0x39, 0x26, 0x13, 0xa8, 0xbf, 0x0a,
+    0x11, 0x30, 0xa3, 0xaa, 0x42, 0x9b, 0x25, 0xa1, 0x39, 0xc0, 0xac, 0x23, 0x38, 0x93, 0xfa, 0x0d,
+    0x30, 0x24, 0x82, 0xbc, 0xae, 0x80, 0x31, 0x28, 0x91, 0x88, 0x21, 0x9b, 0x01, 0x27, 0x39, 0xd0,
+    0xaa, 0x23, 0xab, 0xa8, 0xfc, 0x68, 0x23, 0x13, 0xd8, 0xbb, 0x9c, 0x98, 0x21, 0x13, 0x34, 0x13,
+    0xb8, 0xbc, 0xa0, 0x5a, 0x15, 0x99, 0x28, 0xf9, 0x88, 0xaa, 0x79, 0x14, 0x20, 0xa0, 0xae, 0xa8,
+    0x88, 0x30, 0x18, 0x03, 0x31, 0x02, 0x09, 0xd0, 0xa9, 0x49, 0x90, 0x24, 0xc9, 0xaf, 0x88, 0x48,
+    0x37, 0x08, 0xa1, 0xbd, 0x8a, 0x00, 0x01, 0x21, 0x12, 0x19, 0xc3, 0x0b, 0x47, 0x88, 0x80, 0xdb,
+    0x1a, 0x92, 0x09, 0x98, 0x2b, 0x77, 0x01, 0x98, 0xbb, 0x99, 0x8b, 0x33, 0xb8, 0x72, 0x90, 0x61,
+    0xa1, 0x19, 0x13, 0xbc, 0x10, 0xdb, 0x49, 0xc0, 0x89, 0x44, 0x28, 0x07, 0xa8, 0x9c, 0x99, 0x19,
+    0x23, 0x00, 0x3a, 0xc1, 0x28, 0x24, 0x10, 0xa2, 0xfb, 0x1b, 0x98, 0x82, 0x88, 0xbd, 0x71, 0x24,
+    0x12, 0xaa, 0xcd, 0x9a, 0x11, 0x09, 0x21, 0x02, 0x45, 0xb8, 0x0a, 0x93, 0x50, 0x82, 0xce, 0x89,
+    0x98, 0x32, 0x02, 0x4a, 0x24, 0x11, 0xd9, 0xbc, 0x9d, 0x38, 0x83, 0x52, 0x98, 0x0a, 0x15, 0x0a,
+    0x13, 0xc9, 0x39, 0xf9, 0x3a, 0xb0, 0x09, 0x93, 0x4c, 0x27, 0x00, 0x90, 0xdd, 0x0a, 0x08, 0x41,
+    0x83, 0x09, 0x90, 0x0b, 0x34, 0x02, 0x99, 0xf8, 0x8c, 0x18, 0x80, 0x12, 0xaa, 0x63, 0x33, 0x91,
+    0x53, 0x0b, 0x35, 0x00, 0xde, 0x9a, 0x01, 0x40, 0x83, 0x8a, 0x12, 0x08, 0x17, 0xc9, 0x18, 0xa8,
+    0x18, 0x94, 0x8f, 0x91, 0x8a, 0x44, 0x10, 0x32, 0xe9, 0xaa, 0xaa, 0x1a, 0x26, 0x80, 0x20, 0xb8,
+    0x22, 0x00, 0x08, 0x92, 0xad, 0x98, 0xca, 0x3b, 0xb0, 0x50, 0x36, 0x42, 0x91, 0xad, 0xbb, 0xb9,
+    0x40, 0x00, 0x21, 0x17, 0x08, 0x91, 0x8b, 0x53, 0xa2, 0x88, 0xbd, 0xbc, 0x12, 0x3b, 0x22, 0x07,
+    0x41, 0x82, 0xd9, 0x9d, 0xaa, 0x20, 0x32, 0x22, 0x81, 0xcb, 0x13, 0x35, 0x19, 0xc1, 0xbe, 0x80,
+    0x80, 0x3b, 0xc8, 0x20, 0x47, 0x10, 0x81, 0xfb, 0x8a, 0x89, 0x38, 0x04, 0x00, 0x88, 0x89, 0x42,
+    0x22, 0x07, 0xbb, 0x9c, 0xc0, 0x59, 0x91, 0x89, 0x62, 0x08, 0x06, 0xc9, 0x8b, 0x80, 0x38, 0x04,
+    0xaa, 0x59, 0x98, 0x21, 0x84, 0x8c, 0x11, 0xab, 0x23, 0xcb, 0x1a, 0xc1, 0x5b, 0x24, 0x01, 0x13,
+    0xec, 0x8a, 0x99, 0x20, 0x02, 0xa1, 0x30, 0x10, 0x53, 0xa1, 0xb8, 0x42, 0x9d, 0xe8, 0x8a, 0x90,
+    0x39, 0x73, 0x83, 0x16, 0xba, 0x9c, 0x88, 0x0a, 0x86, 0x99, 0x28, 0x12, 0x50, 0xa2, 0x9a, 0x40,
+    0xb3, 0x9d, 0xaa, 0x8e, 0x42, 0xa1, 0x31, 0x11, 0x58, 0xd2, 0xac, 0x88, 0x09, 0x22, 0xc0, 0x21,
+    0x31, 0x28, 0x05, 0xaa, 0x81, 0x03, 0xbf, 0xc8, 0xda, 0x51, 0x00, 0x52, 0x92, 0x9b, 0xa1, 0x9e,
+    0x01, 0x90, 0x31, 0xb9, 0x48, 0xa2, 0x54, 0x08, 0x0a, 0xb4, 0x1b, 0xa0, 0x9e, 0x0a, 0xf0, 0x53,
+    0x21, 0x80, 0xb0, 0xad, 0x88, 0x00, 0x31, 0xe2, 0x8a, 0x21, 0x50, 0x05, 0xb9, 0x18, 0x9a, 0x21,
+    0xd3, 0x8f, 0x88, 0x11, 0x44, 0x90, 0x89, 0x8a, 0x8b, 0x03, 0xa0, 0x99, 0x9d, 0x50, 0x23, 0x13,
+    0x9b, 0x31, 0xc8, 0x24, 0xbc, 0xbf, 0xa8, 0x10, 0x47, 0x01, 0x18, 0xba, 0x9d, 0x83, 0x1a, 0x02,
+    0xaa, 0xfd, 0x34, 0x00, 0xbc, 0x44, 0x08, 0x23, 0xca, 0x1b, 0x06, 0x20, 0xb1, 0xdd, 0x0a, 0x01,
+    0x42, 0x94, 0x09, 0x88, 0xa8, 0x40, 0x9c, 0x90, 0x98, 0x08, 0x05, 0x59, 0x01, 0x88, 0x93, 0x8c,
+    0x31, 0xf8, 0x0b, 0xc0, 0x2a, 0x36, 0xa8, 0x15, 0xaa, 0x0b, 0xb2, 0x39, 0x03, 0xec, 0x09, 0x02,
+    0x51, 0x22, 0xc9, 0x10, 0x01, 0x9b, 0xe2, 0x9f, 0x11, 0x82, 0x42, 0xb0, 0x00, 0xb8, 0x9c, 0x13,
+    0x0d, 0x04, 0xb9, 0x41, 0xc9, 0x48, 0x92, 0x88, 0x25, 0x9a, 0x13, 0xfa, 0x0d, 0x98, 0x48, 0x14,
+    0x90, 0x18, 0xad, 0x22, 0x88, 0x0a, 0xe1, 0x29, 0x12, 0x0a, 0x22, 0xab, 0x32, 0x07, 0x19, 0x98,
+    0xbf, 0x1a, 0x91, 0x50, 0x13, 0x09, 0x21, 0xda, 0x19, 0xc9, 0x08, 0x80, 0x8c, 0x15, 0x59, 0x83,
+    0x98, 0x19, 0x99, 0x84, 0xbe, 0x09, 0x09, 0x44, 0x93, 0x18, 0xaa, 0x9c, 0x84, 0x1a, 0x12, 0xb1,
+    0x5b, 0xd1, 0x0a, 0x38, 0xa8, 0x47, 0x82, 0x88, 0xa8, 0xaf, 0x01, 0x9a, 0x31, 0x94, 0x30, 0x89,
+    0xad, 0x05, 0x09, 0x00, 0xc1, 0x6a, 0xd8, 0x29, 0x81, 0x08, 0x26, 0x89, 0x14, 0xca, 0x8c, 0xb8,
+    0x18, 0x07, 0x09, 0x11, 0xa8, 0x41, 0xe8, 0x09, 0x91, 0x28, 0xa2, 0x1b, 0x24, 0xa8, 0x85, 0x8b,
+    0x31, 0x00, 0x00, 0xfb, 0x9c, 0x18, 0x53, 0x81, 0x9a, 0xc9, 0x28, 0x26, 0x89, 0x90, 0xae, 0x68,
+    0x91, 0x00, 0xb8, 0x3b, 0x17, 0x1a, 0xa3, 0xcb, 0x11, 0xcb, 0x52, 0xb0, 0x1a, 0x93, 0x1b, 0x47,
+    0xa8, 0x18, 0xe8, 0x09, 0x01, 0x89, 0x41, 0x82, 0x29, 0x13, 0xfa, 0x19, 0xdb, 0x1b, 0x26, 0x80,
+    0x01, 0xe9, 0x09, 0x23, 0xa8, 0x20, 0xd9, 0x19, 0x25, 0xbb, 0x33, 0xeb, 0x30, 0x94, 0x8a, 0x81,
+    0xad, 0x28, 0x34, 0x9a, 0x03, 0xcc, 0x3b, 0xa5, 0x1b, 0x33, 0xa8, 0x73, 0xc0, 0x1b, 0xa3, 0x0c,
+    0xec, 0x00, 0x35, 0x00, 0xb2, 0x2b, 0x85, 0x1b, 0x84, 0x8a, 0x21, 0xcc, 0x00, 0xca, 0x40, 0x82,
+    0x40, 0x84, 0x9c, 0x94, 0x8c, 0x21, 0xd8, 0x40, 0xa0, 0x11, 0x80, 0x9a, 0x90, 0x1b, 0xe3, 0x61,
+    0x98, 0x09, 0xa2, 0x8f, 0x23, 0x99, 0x34, 0xf9, 0x18, 0x90, 0x19, 0x14, 0x89, 0xb2, 0x8a, 0x0d,
+    0x92, 0x31, 0x8a, 0x87, 0x28, 0x8a, 0xf2, 0x1b, 0x00, 0x01, 0x32, 0x8a, 0x21, 0x14, 0xbd, 0xb9,
+    0x10, 0x7b, 0x85, 0x8b, 0x00, 0xda, 0x41, 0x98, 0x31, 0xa0, 0x99, 0xd0, 0x1c, 0x85, 0x10, 0x19,
+    0xb8, 0x35, 0x99, 0x88, 0xb8, 0x2d, 0xb3, 0x59, 0xb1, 0x8c, 0x84, 0x2d, 0x15, 0xdb, 0x31, 0xe9,
+    0x31, 0x81, 0x8b, 0x93, 0x9e, 0x33, 0x88, 0x28, 0xa5, 0x2b, 0x91, 0xc9, 0x8c, 0xa8, 0x19, 0x57,
+    0x92, 0x09, 0xb8, 0x8d, 0x03, 0xaa, 0x42, 0xb1, 0x71, 0xb1, 0x09, 0x80, 0x8a, 0x06, 0x1c, 0x81,
+    0xba, 0x20, 0xca, 0x73, 0x91, 0x89, 0xa2, 0x0b, 0x15, 0xb9, 0x38, 0xda, 0x50, 0x92, 0x28, 0x92,
+    0x8c, 0x91, 0x09, 0x88, 0xa9, 0x0c, 0x0a, 0x47, 0x11, 0xab, 0xc0, 0x3a, 0x21, 0xc4, 0x29, 0x98,
+    0x31, 0xb0, 0x2a, 0x9a, 0x71, 0x27, 0x89, 0xd9, 0x9d, 0x89, 0x42, 0x33, 0xb1, 0x9b, 0xfb, 0x30,
+    0x43, 0xc0, 0x88, 0xac, 0x31, 0x14, 0x18, 0xc2, 0x8d, 0x82, 0x18, 0x82, 0xda, 0x09, 0xa1, 0x48,
+    0xa2, 0x20, 0x13, 0xab, 0x17, 0xaf, 0x12, 0x98, 0x41, 0xe2, 0x29, 0x91, 0x39, 0x86, 0x9c, 0x98,
+    0x9a, 0x73, 0x80, 0x18, 0xc0, 0x0b, 0x03, 0x89, 0x36, 0xca, 0x20, 0xb0, 0x19, 0x92, 0x2b, 0x07,
+    0x8b, 0x04, 0xbb, 0x00, 0xe8, 0x69, 0x81, 0x18, 0xb0, 0x9c, 0x23, 0x09, 0x27, 0xca, 0x18, 0x80,
+    0x28, 0x83, 0x8d, 0x10, 0x89, 0x03, 0xca, 0x89, 0x98, 0x56, 0x88, 0xb0, 0xac, 0x29, 0x24, 0x32,
+    0x2d, 0x05, 0x2f, 0x00, 0xeb, 0x09, 0x21, 0x12, 0x90, 0xcf, 0x10, 0x31, 0x33, 0xf0, 0xac, 0x99,
+    0x51, 0x04, 0x00, 0xb9, 0x9c, 0x10, 0x20, 0x12, 0x81, 0x98, 0x2b, 0x84, 0x91, 0x8b, 0xf9, 0x4b,
+    0x24, 0x88, 0xc9, 0xcb, 0x58, 0x12, 0x02, 0xcb, 0xaa, 0x28, 0x24, 0x32, 0x11, 0xdc, 0x89, 0xab,
+    0x44, 0x33, 0xc8, 0x2b, 0xc0, 0x18, 0xa3, 0xef, 0x28, 0x11, 0x33, 0x81, 0xcd, 0x98, 0x1b, 0x32,
+    0x05, 0x28, 0xa1, 0xac, 0x30, 0xa8, 0x9a, 0x04, 0x1a, 0x47, 0xd0, 0x9b, 0x08, 0x28, 0x26, 0xa9,
+    0x09, 0xb2, 0x3a, 0x04, 0x9c, 0x53, 0xa9, 0x18, 0xd8, 0x49, 0x04, 0x89, 0x81, 0xbd, 0x40, 0xc8,
+    0x28, 0x81, 0x39, 0x16, 0xab, 0x92, 0xbe, 0x38, 0x14, 0x41, 0x82, 0xbf, 0x18, 0x00, 0x31, 0xb1,
+    0x8d, 0x11, 0x12, 0x91, 0xbe, 0x8b, 0x52, 0x32, 0x00, 0xf8, 0x8a, 0x11, 0x00, 0x24, 0xab, 0x89,
+    0x90, 0x68, 0x02, 0xb9, 0x9a, 0x38, 0x25, 0x99, 0xe8, 0xad, 0x32, 0x02, 0x63, 0xc0, 0xac, 0x00,
+    0x18, 0x37, 0xb0, 0x8a, 0xc9, 0x3a, 0x17, 0x98, 0x80, 0xca, 0x40, 0x02, 0x09, 0xd8, 0x8b, 0x41,
+    0x12, 0x12, 0xfb, 0x9a, 0x11, 0x43, 0x82, 0xca, 0xba, 0x48, 0x14, 0x01, 0xb9, 0x8e, 0x11, 0x81,
+    0x52, 0xda, 0x09, 0x00, 0x29, 0x16, 0xba, 0x80, 0xaa, 0x51, 0x83, 0x2a, 0xb2, 0x9f, 0x12, 0x89,
+    0x11, 0x11, 0x19, 0xd0, 0x1a, 0xb8, 0x44, 0xaa, 0x10, 0x91, 0x5c, 0xa5, 0x8d, 0x12, 0x9a, 0x42,
+    0xc8, 0x2b, 0x07, 0x8a, 0x12, 0xbc, 0x20, 0x94, 0x49, 0xb3, 0x8e, 0x10, 0x98, 0x42, 0xc0, 0x09,
+    0x99, 0x21, 0x43, 0xc8, 0xc9, 0x19, 0x10, 0x34, 0xb8, 0x8a, 0x81, 0x1a, 0x17, 0x9a, 0x10, 0xd0,
+    0x2b, 0x14, 0x28, 0x16, 0xbe, 0x89, 0x00, 0x73, 0x92, 0xab, 0xaa, 0x38, 0x45, 0x91, 0xc9, 0x8b,
+    0xd0, 0xfa, 0x32, 0x00, 0x40, 0x25, 0xa0, 0xab, 0xcb, 0x60, 0x22, 0xa1, 0x9a, 0xbd, 0x32, 0x43,
+    0xb0, 0xb0, 0xaf, 0x21, 0x23, 0x10, 0xc0, 0x9e, 0x08, 0x23, 0x22, 0xa0, 0xbe, 0x28, 0x12, 0x14,
+    0xa1, 0xcf, 0x01, 0x10, 0x32, 0xb0, 0x9d, 0x80, 0x19, 0x34, 0xc8, 0x09, 0xca, 0x68, 0x84, 0x18,
+    0xb0, 0xac, 0x20, 0x28, 0x26, 0xb8, 0x0a, 0xba, 0x42, 0x02, 0x09, 0xd8, 0x1d, 0x03, 0x28, 0x91,
+    0xfb, 0x2a, 0x91, 0x52, 0x82, 0x99, 0x98, 0xad, 0x41, 0x98, 0x44, 0xa0, 0x9a, 0x90, 0x58, 0x85,
+    0x9b, 0xd0, 0x1a, 0x32, 0x13, 0x12, 0xdf, 0x08, 0x08, 0x31, 0xa4, 0x8c, 0x00, 0x89, 0x64, 0xb0,
+    0x0b, 0xa0, 0x3a, 0x37, 0xb8, 0x00, 0xfb, 0x00, 0x21, 0x00, 0x80, 0x9c, 0x90, 0x51, 0x81, 0xa0,
+    0x9c, 0x9a, 0x36, 0x10, 0x90, 0xba, 0x2b, 0x83, 0x62, 0xa1, 0x9c, 0x02, 0x9b, 0x37, 0xcb, 0x30,
+    0xd8, 0x39, 0x03, 0x8b, 0x84, 0x9e, 0x10, 0x01, 0x19, 0x85, 0x9a, 0x08, 0x93, 0x1d, 0xa4, 0x08,
+    0x21, 0xa0, 0x09, 0x89, 0xfa, 0x38, 0x03, 0x28, 0x84, 0xef, 0x11, 0x98, 0x31, 0xb2, 0x9d, 0x12,
+    0x18, 0x14, 0xc0, 0x0d, 0x81, 0x38, 0x23, 0xd9, 0x9a, 0x4a, 0x13, 0x01, 0xc8, 0xbf, 0x24, 0x98,
+    0x31, 0xfa, 0x2b, 0x83, 0x48, 0xa3, 0x9c, 0x01, 0xba, 0x45, 0xa9, 0x02, 0x99, 0x2a, 0x86, 0x48,
+    0xb0, 0xab, 0xad, 0x48, 0x36, 0x80, 0xa8, 0xcf, 0x28, 0x22, 0x31, 0xb1, 0xbf, 0x10, 0x21, 0x32,
+    0xc0, 0xae, 0x10, 0x21, 0x33, 0xc2, 0xae, 0x08, 0x00, 0x43, 0xb1, 0x9b, 0x88, 0x2a, 0x36, 0xb8,
+    0x8c, 0xb0, 0x38, 0x36, 0x90, 0x89, 0xeb, 0x1a, 0x24, 0x10, 0x21, 0xfc, 0x18, 0x00, 0x10, 0x82,
+    0xaf, 0x18, 0x22, 0x22, 0x93, 0xef, 0x08, 0x00, 0x31, 0x84, 0xac, 0x08, 0x08, 0x61, 0x91, 0x8c,
+    0xfe, 0xfc, 0x3a, 0x00, 0x88, 0x38, 0x15, 0x99, 0xa8, 0x9a, 0x18, 0x03, 0x21, 0xd9, 0x20, 0xa9,
+    0x40, 0xc3, 0x1d, 0xa1, 0x8f, 0x42, 0x10, 0x12, 0xe8, 0x0b, 0x88, 0x31, 0x12, 0xb8, 0xbb, 0x59,
+    0x24, 0x01, 0xea, 0x9c, 0x18, 0x22, 0x22, 0xb8, 0xad, 0x21, 0x80, 0x34, 0xfa, 0x19, 0x82, 0x38,
+    0x84, 0xac, 0x12, 0x9b, 0x43, 0x91, 0x19, 0xa2, 0x9d, 0x88, 0x9b, 0x2a, 0x95, 0x5a, 0xa3, 0x29,
+    0xb8, 0xde, 0x20, 0x9b, 0x37, 0x88, 0x01, 0xb0, 0x59, 0xb0, 0x3a, 0xd3, 0x3b, 0x27, 0x9a, 0x12,
+    0xbe, 0x30, 0xb2, 0x1d, 0xa3, 0x1d, 0x14, 0xa0, 0x28, 0xfa, 0x1b, 0x02, 0x21, 0x23, 0xca, 0x08,
+    0x19, 0x04, 0x88, 0xcb, 0x89, 0x73, 0x11, 0x13, 0xeb, 0x99, 0x8a, 0x10, 0x14, 0x8c, 0x91, 0x89,
+    0x48, 0xb2, 0x8e, 0x90, 0x3a, 0x26, 0x81, 0x1a, 0xb8, 0x28, 0x18, 0xb4, 0x19, 0x54, 0x01, 0x33,
+    0xfb, 0x0d, 0xb0, 0x48, 0xa0, 0x0b, 0x13, 0x3a, 0x17, 0xad, 0x99, 0x89, 0x51, 0x03, 0x99, 0x09,
+    0x01, 0x72, 0xb3, 0xac, 0x01, 0x1a, 0x37, 0xa0, 0x88, 0xc9, 0x09, 0x12, 0x9a, 0xb0, 0x8a, 0x61,
+    0x05, 0xab, 0xb9, 0xda, 0x39, 0x95, 0x60, 0x01, 0xa8, 0x49, 0x81, 0x08, 0x01, 0xdf, 0x48, 0x82,
+    0x50, 0x92, 0x9e, 0x00, 0x99, 0x32, 0xb8, 0x8b, 0x91, 0x60, 0x03, 0xb9, 0xcc, 0x8a, 0x53, 0x21,
+    0x82, 0xbd, 0x30, 0x92, 0x71, 0xc0, 0x0c, 0x11, 0x19, 0x27, 0xaa, 0x08, 0xba, 0x49, 0x93, 0x0a,
+    0x92, 0x9b, 0x51, 0x92, 0x88, 0xe9, 0xac, 0x29, 0x15, 0x41, 0x82, 0xca, 0x0a, 0x81, 0x31, 0x33,
+    0xfc, 0x3b, 0x01, 0x52, 0x03, 0xbe, 0x98, 0x89, 0x21, 0x14, 0x99, 0xaa, 0x90, 0x2a, 0x37, 0xbb,
+    0xa8, 0xcb, 0x50, 0x24, 0x13, 0xaa, 0xd8, 0x9c, 0x53, 0x82, 0x28, 0xf0, 0x0b, 0x23, 0x21, 0x02,
+    0xb9, 0x03, 0x2f, 0x00, 0xaf, 0x88, 0x22, 0x11, 0xa1, 0xac, 0x09, 0x23, 0x33, 0xf8, 0xba, 0x9b,
+    0x61, 0x23, 0x12, 0xc8, 0x8a, 0x08, 0x42, 0x81, 0x00, 0xbe, 0x48, 0x05, 0x30, 0xe1, 0xbb, 0x20,
+    0x80, 0x43, 0xb9, 0xdb, 0x38, 0x03, 0x00, 0xb0, 0xff, 0x21, 0x00, 0x21, 0xb1, 0x8e, 0x02, 0x18,
+    0x12, 0xc9, 0x28, 0x80, 0x53, 0x91, 0x9a, 0xc0, 0x0d, 0x14, 0x8b, 0x23, 0xfb, 0x39, 0xb0, 0x49,
+    0x93, 0xac, 0x80, 0xaa, 0x52, 0x22, 0xc1, 0x8b, 0x13, 0x39, 0x57, 0xca, 0x19, 0xa1, 0x29, 0x27,
+    0xa9, 0x10, 0xc9, 0x38, 0x94, 0x8b, 0xa1, 0x9e, 0x21, 0x91, 0x41, 0xc8, 0x89, 0xbb, 0x29, 0x45,
+    0x81, 0xd9, 0x09, 0x28, 0x27, 0x81, 0xba, 0xb8, 0x3c, 0x35, 0x82, 0x89, 0xda, 0x19, 0x72, 0x91,
+    0x89, 0xf9, 0x8a, 0x43, 0xa8, 0x31, 0xd8, 0x0b, 0x84, 0x9b, 0x24, 0xaa, 0x19, 0x82, 0x39, 0x27,
+    0x90, 0xaa, 0x90, 0x8b, 0x64, 0x92, 0x39, 0xb2, 0x8e, 0x33, 0xc8, 0x19, 0xd0, 0x0b, 0x33, 0xc9,
+    0x40, 0xc9, 0x08, 0x91, 0xac, 0x11, 0x28, 0x14, 0x99, 0x09, 0x09, 0x47, 0x81, 0x88, 0xab, 0x00,
+    0x55, 0x02, 0x98, 0x08, 0xbc, 0x43, 0xa8, 0x29, 0xf3, 0x0d, 0x92, 0x8a, 0x10, 0x91, 0xa9, 0xac,
+    0xca, 0x68, 0x14, 0x90, 0x8a, 0xda, 0x71, 0x02, 0x88, 0x81, 0x9c, 0x43, 0x00, 0x00, 0xc1, 0x1c,
+    0x82, 0x38, 0x83, 0xdb, 0x08, 0xeb, 0x20, 0xd9, 0x28, 0x93, 0x8b, 0xb2, 0x8f, 0x13, 0x80, 0xa8,
+    0xba, 0x78, 0x14, 0x12, 0x90, 0xaa, 0x22, 0x08, 0x14, 0x99, 0x22, 0x9a, 0x47, 0xa1, 0x8b, 0xb2,
+    0xaf, 0x10, 0xbb, 0x19, 0xa2, 0x3b, 0xf4, 0x0c, 0x01, 0xa0, 0x40, 0xfb, 0x38, 0x21, 0x81, 0x43,
+    0xb9, 0x21, 0x20, 0x98, 0x03, 0x5c, 0xe3, 0x58, 0x81, 0x08, 0x08, 0xbe, 0x31, 0xbb, 0x01, 0x98,
+    0xcd, 0xfe, 0x26, 0x00, 0x70, 0xca, 0x10, 0x08, 0x99, 0x02, 0xaf, 0x11, 0x42, 0x82, 0x80, 0xaa,
+    0x32, 0x34, 0x20, 0xa4, 0x0d, 0xb0, 0x72, 0x11, 0x81, 0xbb, 0xab, 0xa1, 0x6c, 0xc3, 0x8d, 0x88,
+    0x80, 0x28, 0xc0, 0x08, 0xba, 0xb8, 0x6a, 0x83, 0x24, 0x9a, 0xa1, 0x72, 0xa0, 0x22, 0x2a, 0x82,
+    0x23, 0x8e, 0x86, 0x5a, 0xb3, 0xab, 0x19, 0xc2, 0x70, 0x90, 0xb9, 0x3b, 0xe2, 0x2a, 0x81, 0xa9,
+    0x29, 0xf1, 0x30, 0x81, 0xc0, 0x4a, 0xb1, 0x50, 0x11, 0xb8, 0x72, 0xa1, 0x18, 0x00, 0xca, 0x64,
+    0xa8, 0x88, 0x08, 0x91, 0x22, 0xc9, 0xcb, 0x31, 0xeb, 0x11, 0x90, 0x99, 0x21, 0xbc, 0x32, 0xb0,
+    0x8d, 0x92, 0x1c, 0x14, 0x29, 0x25, 0x08, 0x12, 0xdc, 0x49, 0x04, 0x18, 0xa1, 0x9e, 0x73, 0x91,
+    0x88, 0xaa, 0x9b, 0x42, 0x00, 0xba, 0x18, 0xcc, 0x51, 0x81, 0xac, 0x00, 0xaa, 0x52, 0x84, 0x0b,
+    0x83, 0x0c, 0x35, 0xb1, 0x8b, 0x81, 0x73, 0x00, 0x92, 0x9b, 0x41, 0x95, 0x0c, 0x03, 0xbc, 0x48,
+    0xa2, 0x0c, 0x04, 0xbb, 0x08, 0xa0, 0x2b, 0x86, 0xad, 0x18, 0x92, 0x59, 0x94, 0x8a, 0x00, 0xc0,
+    0x79, 0x04, 0x99, 0x08, 0xa0, 0x71, 0xa2, 0x88, 0xaa, 0x89, 0x36, 0x98, 0x90, 0xcc, 0x29, 0x03,
+    0x9a, 0x82, 0xbf, 0x10, 0x12, 0x09, 0x94, 0xaf, 0x18, 0x02, 0x38, 0xa4, 0x8c, 0x12, 0x81, 0x50,
+    0xa2, 0x0b, 0x21, 0xa2, 0x79, 0x95, 0x09, 0x90, 0xa9, 0x40, 0xb0, 0x00, 0xaa, 0xbc, 0x21, 0xaa,
+    0x74, 0xa0, 0xbd, 0x18, 0x98, 0x73, 0x81, 0xb9, 0x10, 0x08, 0x36, 0x91, 0xb8, 0xcb, 0x39, 0x37,
+    0x22, 0xa1, 0xcc, 0x0a, 0x32, 0x33, 0xfa, 0x8a, 0xaa, 0x70, 0x04, 0xaa, 0x99, 0xcc, 0x48, 0x02,
+    0x88, 0xa0, 0xcb, 0x50, 0x01, 0x01, 0xcb, 0x8b, 0x32, 0x42, 0x06, 0xa9, 0x9a, 0x11, 0x40, 0x13,
+    0xbf, 0x01, 0x27, 0x00, 0xfa, 0x19, 0x11, 0x22, 0x01, 0xed, 0x18, 0x80, 0x21, 0xb0, 0x9e, 0x11,
+    0x09, 0x24, 0xd9, 0x8a, 0x02, 0x1a, 0x26, 0xca, 0x1a, 0x13, 0x31, 0x84, 0xbb, 0x0b, 0x44, 0x23,
+    0x92, 0xbc, 0x0a, 0x26, 0x01, 0x91, 0xad, 0x0a, 0x03, 0x29, 0xc3, 0x8d, 0xaa, 0x90, 0x29, 0xc1,
+    0x20, 0x9c, 0xe8, 0x1c, 0x01, 0x34, 0x88, 0xfa, 0x0b, 0x41, 0x15, 0x08, 0xd9, 0x0a, 0x52, 0x02,
+    0x80, 0xdb, 0x8a, 0x33, 0x31, 0x84, 0xcc, 0x89, 0x98, 0x50, 0xa1, 0xbb, 0x09, 0x98, 0x73, 0x83,
+    0xaa, 0x9a, 0xbd, 0x28, 0x72, 0x23, 0x98, 0x99, 0xa9, 0x71, 0x14, 0xa8, 0xab, 0x18, 0x54, 0x43,
+    0xa2, 0xae, 0x08, 0x08, 0x32, 0xa2, 0xad, 0x08, 0x10, 0x22, 0xf9, 0x9a, 0x98, 0x20, 0x85, 0xac,
+    0x30, 0xa0, 0x38, 0xe2, 0x1a, 0x11, 0x22, 0x11, 0xbb, 0x24, 0x9f, 0x44, 0x80, 0x18, 0xc2, 0x0f,
+    0x82, 0x18, 0x10, 0xd9, 0x29, 0xa9, 0x41, 0x90, 0xab, 0xa2, 0xcf, 0x12, 0x01, 0x21, 0xf8, 0x0c,
+    0x81, 0x41, 0x83, 0xbc, 0x28, 0x18, 0x26, 0x90, 0x8a, 0x98, 0x58, 0x83, 0x28, 0x01, 0xcc, 0x10,
+    0x09, 0x25, 0x91, 0xdc, 0xaa, 0x39, 0x37, 0xa0, 0xbb, 0xca, 0x59, 0x15, 0x88, 0xca, 0x9a, 0x42,
+    0x22, 0x03, 0xdc, 0x8a, 0x31, 0x22, 0x82, 0xab, 0x9a, 0x52, 0x11, 0x91, 0x19, 0xda, 0xa9, 0x29,
+    0x01, 0x47, 0x98, 0xea, 0xab, 0x29, 0x25, 0x22, 0xfb, 0x9b, 0x20, 0x32, 0x06, 0xdb, 0x9a, 0x21,
+    0x44, 0x91, 0xab, 0x9a, 0x51, 0x24, 0xba, 0x8a, 0x20, 0x24, 0xa1, 0xad, 0x08, 0x62, 0x81, 0xcb,
+    0x29, 0x81, 0x23, 0xd9, 0xac, 0x20, 0x42, 0x93, 0xbd, 0x08, 0x10, 0x54, 0xc0, 0x9a, 0x88, 0x51,
+    0x05, 0x99, 0xa9, 0x0b, 0x45, 0x82, 0x9a, 0xca, 0x20, 0x43, 0x90, 0x9a, 0xab, 0x52, 0x82, 0x9c,
+    0x87, 0x00, 0x29, 0x00, 0xb0, 0x58, 0xb2, 0x9d, 0x01, 0x18, 0x17, 0xcb, 0x88, 0x09, 0x34, 0xa3,
+    0x9d, 0xa8, 0x48, 0x14, 0xa0, 0x9b, 0x89, 0x45, 0x01, 0xca, 0x89, 0x18, 0x27, 0xb8, 0x9a, 0x01,
+    0x51, 0xa3, 0x9d, 0x89, 0x18, 0x15, 0xb9, 0x11, 0xa9, 0x28, 0xc1, 0x1c, 0x01, 0x40, 0x80, 0xca,
+    0x48, 0x00, 0x13, 0x90, 0xdf, 0x20, 0x22, 0x34, 0xa0, 0xae, 0x89, 0x51, 0x04, 0x9a, 0x8a, 0x18,
+    0x45, 0xb0, 0xab, 0x9a, 0x41, 0x82, 0x9a, 0x99, 0x48, 0x84, 0xba, 0xdb, 0x0a, 0x02, 0x01, 0x01,
+    0x28, 0x06, 0x0d, 0xb0, 0x1a, 0x26, 0xa9, 0x23, 0xeb, 0x42, 0x22, 0x21, 0xfa, 0x8c, 0x18, 0x54,
+    0x81, 0xca, 0xa9, 0x30, 0x14, 0x90, 0xbd, 0x1a, 0x23, 0x11, 0xd0, 0x0d, 0x91, 0x00, 0x81, 0xbb,
+    0x73, 0x88, 0x02, 0xab, 0x30, 0x03, 0x50, 0xb1, 0x1b, 0x34, 0x11, 0x12, 0xcb, 0xac, 0x64, 0x13,
+    0xa0, 0xbd, 0x2a, 0x15, 0x00, 0xfb, 0x8e, 0x31, 0x11, 0x81, 0xcd, 0x88, 0x00, 0x22, 0xc8, 0x8b,
+    0x01, 0x51, 0x03, 0x9a, 0xa8, 0x8c, 0x02, 0x10, 0x45, 0x81, 0x01, 0x09, 0xc8, 0x28, 0x03, 0xa9,
+    0x14, 0xbf, 0x35, 0x18, 0x91, 0xcf, 0x1a, 0x80, 0x52, 0xb0, 0x8a, 0x98, 0x30, 0x93, 0xaf, 0x90,
+    0x2b, 0x17, 0x00, 0x90, 0x89, 0x00, 0x18, 0x34, 0x98, 0x22, 0x0a, 0x15, 0x41, 0x82, 0xcc, 0x38,
+    0xea, 0x72, 0x00, 0x80, 0xea, 0x8a, 0x01, 0x40, 0xa2, 0x9d, 0x99, 0x28, 0x25, 0xb9, 0xb9, 0x9f,
+    0x31, 0x12, 0x12, 0xc9, 0x8a, 0x19, 0x24, 0x01, 0x00, 0xc9, 0x38, 0x24, 0x45, 0x90, 0x89, 0xcd,
+    0x39, 0x14, 0x38, 0xd2, 0x9d, 0x01, 0x18, 0x23, 0xcd, 0x99, 0x9b, 0x44, 0x01, 0x98, 0xea, 0x1a,
+    0x02, 0x52, 0xa8, 0xba, 0x1a, 0x53, 0x25, 0x88, 0xe9, 0x09, 0x12, 0x52, 0x91, 0xaa, 0x98, 0x2a,
+    0xcb, 0x02, 0x27, 0x00, 0x04, 0x00, 0xdd, 0x8a, 0x22, 0x40, 0xa3, 0xaf, 0xa8, 0x29, 0x33, 0x82,
+    0xc9, 0xbe, 0x10, 0x11, 0x14, 0xb9, 0x9c, 0x08, 0x54, 0x02, 0x88, 0xda, 0x89, 0x21, 0x44, 0x81,
+    0x89, 0xb9, 0x49, 0x14, 0x00, 0xc0, 0x9e, 0x00, 0x31, 0x16, 0xa9, 0xbb, 0xad, 0x42, 0x02, 0x90,
+    0xcc, 0x0a, 0x32, 0x43, 0xc0, 0xad, 0x89, 0x41, 0x33, 0x90, 0xca, 0x0b, 0x43, 0x42, 0xa2, 0xab,
+    0x9a, 0x51, 0x25, 0x88, 0x90, 0x9e, 0x11, 0x10, 0x31, 0xc8, 0x8b, 0xfb, 0x38, 0x02, 0x08, 0xd9,
+    0x9c, 0x11, 0x31, 0xa3, 0xbe, 0x8a, 0x18, 0x44, 0x01, 0x98, 0xac, 0x21, 0x52, 0x23, 0xd9, 0x8b,
+    0x10, 0x46, 0x80, 0x90, 0xbb, 0x30, 0x04, 0x20, 0xe8, 0x0b, 0x80, 0x38, 0x85, 0xab, 0xb8, 0xaf,
+    0x11, 0x10, 0x22, 0xfa, 0x89, 0x99, 0x63, 0x81, 0xaa, 0xcb, 0x48, 0x34, 0x14, 0xda, 0x89, 0x11,
+    0x42, 0x91, 0xab, 0x08, 0x60, 0x04, 0x99, 0x90, 0x9b, 0x22, 0xc9, 0x40, 0xc0, 0x19, 0xca, 0x28,
+    0x02, 0x8b, 0xe2, 0x8c, 0x01, 0x20, 0xb8, 0x99, 0x99, 0x1d, 0x37, 0x28, 0xc2, 0x0c, 0x10, 0x21,
+    0x25, 0xcb, 0x32, 0x8b, 0x26, 0x91, 0x9b, 0xc0, 0x49, 0x92, 0x51, 0xc9, 0x99, 0x10, 0x08, 0xe3,
+    0x1c, 0xb1, 0x38, 0x80, 0xbb, 0x24, 0x9e, 0x82, 0x0e, 0x13, 0x80, 0x80, 0xeb, 0x71, 0x80, 0x01,
+    0x9b, 0x10, 0x01, 0x40, 0xd2, 0x3a, 0xc2, 0x28, 0x11, 0x10, 0x96, 0xaf, 0x81, 0x28, 0x14, 0xca,
+    0x0a, 0x98, 0x73, 0x98, 0x99, 0x8a, 0x20, 0x04, 0x8a, 0xb0, 0x40, 0xaa, 0x12, 0x18, 0x42, 0xa6,
+    0x0d, 0xb8, 0x68, 0x13, 0x98, 0xb9, 0x8d, 0x36, 0x00, 0xa0, 0xae, 0x18, 0x23, 0x11, 0xfa, 0x08,
+    0x00, 0x01, 0x98, 0x09, 0xb1, 0x4a, 0xc0, 0x58, 0x82, 0x9a, 0xaa, 0x1b, 0x37, 0x08, 0xa8, 0x0a,
+    0xb6, 0xff, 0x1e, 0x00, 0x02, 0x0c, 0x02, 0x20, 0xaa, 0x09, 0x9a, 0x77, 0xa2, 0xac, 0x98, 0x70,
+    0x83, 0xaa, 0x89, 0x09, 0x27, 0xa9, 0x98, 0x88, 0x42, 0x80, 0xbb, 0x0a, 0x53, 0x81, 0xa2, 0x8d,
+    0x13, 0x99, 0x34, 0xfe, 0x28, 0x92, 0x18, 0xb1, 0x1d, 0x04, 0x99, 0x91, 0x9d, 0x42, 0x81, 0x09,
+    0xb9, 0x39, 0x34, 0xea, 0x38, 0x01, 0x8a, 0xd2, 0x4c, 0x15, 0xa9, 0x80, 0xad, 0x64, 0x91, 0x8a,
+    0xb9, 0x58, 0x03, 0x9a, 0x88, 0x1a, 0x24, 0xea, 0x09, 0x10, 0x21, 0xb8, 0xbe, 0x50, 0x13, 0x89,
+    0xfb, 0x19, 0x23, 0x80, 0x92, 0x9f, 0x22, 0x90, 0x20, 0xd9, 0x31, 0x91, 0x1a, 0xb1, 0x78, 0x93,
+    0xab, 0xb1, 0x3c, 0x17, 0x90, 0xa9, 0x9c, 0x15, 0x90, 0x89, 0xb9, 0x32, 0x80, 0xcb, 0x09, 0x53,
+    0x81, 0xfa, 0x0c, 0x33, 0x03, 0xc0, 0xaf, 0x32, 0x02, 0x10, 0xfb, 0x28, 0x13, 0x09, 0xc8, 0x2b,
+    0x27, 0x99, 0x99, 0x0a, 0x35, 0xa0, 0xbb, 0x0a, 0x62, 0x01, 0xc8, 0x9b, 0x22, 0x81, 0xa8, 0xaf,
+    0x43, 0xa0, 0x19, 0xc9, 0x40, 0x03, 0x9b, 0xb0, 0x3b, 0x47, 0xa8, 0x88, 0x19, 0x32, 0xa2, 0x9c,
+    0x49, 0x05, 0x19, 0xd9, 0x0c, 0x35, 0x89, 0x90, 0xae, 0x52, 0x90, 0x19, 0xca, 0x49, 0x83, 0x8a,
+    0xb8, 0x2b, 0x27, 0xb9, 0xaa, 0x38, 0x45, 0xa1, 0xac, 0x19, 0x24, 0x11, 0xea, 0x0a, 0x24, 0x00,
+    0xa8, 0x9c, 0x44, 0xa0, 0x89, 0xba, 0x72, 0x93, 0x9a, 0xaa, 0x48, 0x05, 0xa9, 0xb9, 0x28, 0x16,
+    0xa9, 0x99, 0x18, 0x24, 0xb9, 0xab, 0x39, 0x37, 0xb2, 0xad, 0x09, 0x63, 0x02, 0xba, 0x9b, 0x51,
+    0x12, 0x90, 0x9e, 0x30, 0x02, 0x80, 0xdd, 0x38, 0x04, 0x98, 0xda, 0x19, 0x25, 0x90, 0xb8, 0x8d,
+    0x41, 0x82, 0xa9, 0xaa, 0x51, 0x03, 0xab, 0xaa, 0x62, 0x13, 0xdb, 0xaa, 0x71, 0x02, 0xa0, 0xac,
+    0xbb, 0xfe, 0x26, 0x00, 0x32, 0x12, 0xd9, 0x8a, 0x22, 0x02, 0xc9, 0x0b, 0x32, 0x14, 0xfa, 0x8b,
+    0x31, 0x25, 0xb9, 0xbb, 0x2a, 0x37, 0xa8, 0x98, 0x8d, 0x24, 0xa8, 0x00, 0xa9, 0x34, 0xa0, 0xbb,
+    0x08, 0x44, 0x22, 0xfa, 0x0b, 0x01, 0x63, 0xb2, 0x8e, 0x80, 0x20, 0x83, 0x9c, 0x08, 0x31, 0xa0,
+    0xba, 0x1c, 0x47, 0xa9, 0x99, 0x9b, 0x56, 0x90, 0x98, 0xaa, 0x41, 0x01, 0x98, 0xaa, 0x21, 0x33,
+    0xe8, 0x0b, 0x13, 0x43, 0xf8, 0x0d, 0x11, 0x31, 0xc1, 0x9c, 0x00, 0x41, 0x91, 0x9a, 0x09, 0x31,
+    0xc0, 0x10, 0x8a, 0x16, 0xc9, 0x08, 0x8a, 0x45, 0x88, 0x98, 0xca, 0x30, 0x43, 0xb1, 0xab, 0xab,
+    0x72, 0x94, 0x1a, 0xb8, 0x58, 0xb3, 0x8c, 0x90, 0x50, 0x83, 0xbc, 0xaa, 0x72, 0x23, 0xc9, 0x9c,
+    0x28, 0x43, 0xa1, 0xad, 0x20, 0x42, 0xb1, 0x9d, 0x30, 0x32, 0xd1, 0x9d, 0x10, 0x34, 0xb1, 0xbc,
+    0x08, 0x35, 0xa0, 0xab, 0x09, 0x73, 0xa1, 0xab, 0x10, 0x42, 0xa1, 0xdc, 0x28, 0x13, 0x01, 0xfa,
+    0x2b, 0x04, 0x00, 0xb8, 0x1b, 0x06, 0x88, 0x90, 0x1a, 0x22, 0x90, 0xca, 0x38, 0x32, 0x02, 0xdc,
+    0x10, 0x00, 0x11, 0x9b, 0xa1, 0x8b, 0xc3, 0x7a, 0x85, 0x8b, 0xb1, 0x2c, 0x85, 0x8b, 0xc1, 0x2b,
+    0x07, 0x98, 0x98, 0x38, 0x85, 0xa9, 0xcb, 0x40, 0x23, 0x98, 0xbd, 0x41, 0x24, 0xa0, 0xac, 0x00,
+    0x32, 0xc3, 0x8e, 0x12, 0x21, 0xb3, 0x9f, 0x12, 0x18, 0x93, 0xbf, 0x10, 0x21, 0x03, 0xcc, 0x29,
+    0x12, 0x80, 0xba, 0x8e, 0x42, 0xa0, 0x98, 0x9c, 0x45, 0x91, 0xa9, 0xab, 0x62, 0x01, 0x98, 0xac,
+    0x32, 0x12, 0x13, 0xbe, 0x10, 0x22, 0x83, 0xce, 0x29, 0x53, 0x90, 0xba, 0x8b, 0x56, 0x81, 0xca,
+    0xaa, 0x53, 0x02, 0xca, 0x8b, 0x52, 0x02, 0xc9, 0x8c, 0x42, 0x82, 0xba, 0x9d, 0x52, 0x12, 0xba,
+    0xa7, 0xff, 0x1b, 0x00, 0x1b, 0x37, 0x91, 0xac, 0x09, 0x62, 0x81, 0xac, 0x08, 0x42, 0x83, 0xcc,
+    0x19, 0x32, 0x83, 0xcd, 0x1a, 0x33, 0x02, 0xeb, 0x0a, 0x33, 0x01, 0xcb, 0x8b, 0x43, 0x02, 0xdb,
+    0x8a, 0x53, 0x82, 0xba, 0x8a, 0x43, 0x91, 0xa8, 0xab, 0x61, 0x00, 0x10, 0xaa, 0x33, 0xda, 0x28,
+    0x81, 0x08, 0xdd, 0x20, 0x44, 0xa8, 0xad, 0x40, 0x15, 0xc9, 0x9b, 0x38, 0x26, 0xb8, 0x9c, 0x29,
+    0x36, 0xb0, 0xad, 0x18, 0x35, 0xb8, 0x9c, 0x10, 0x53, 0xa1, 0xac, 0x29, 0x33, 0x94, 0xdc, 0x09,
+    0x33, 0x02, 0xfb, 0x1a, 0x32, 0x01, 0xd9, 0x8b, 0x32, 0x23, 0xd9, 0xac, 0x31, 0x16, 0xa8, 0x9c,
+    0x28, 0x33, 0xb1, 0xbd, 0x19, 0x73, 0x82, 0xcb, 0x0a, 0x43, 0x03, 0xeb, 0x0b, 0x42, 0x12, 0xd9,
+    0x8b, 0x41, 0x23, 0xc9, 0x9d, 0x30, 0x33, 0xd8, 0xac, 0x31, 0x33, 0xb0, 0xaf, 0x28, 0x24, 0x90,
+    0xcc, 0x18, 0x24, 0x91, 0xdb, 0x19, 0x34, 0x90, 0xcb, 0x1a, 0x34, 0x91, 0xca, 0x8a, 0x44, 0x82,
+    0xbb, 0x8b, 0x44, 0x82, 0xda, 0x89, 0x32, 0x03, 0xca, 0x9b, 0x42, 0x04, 0xb9, 0x9c, 0x40, 0x13,
+    0xaa, 0xab, 0x58, 0x05, 0x99, 0xa8, 0x2a, 0x33, 0xa0, 0xba, 0x8d, 0x45, 0x91, 0xaa, 0x98, 0x41,
+    0x03, 0xbb, 0xaa, 0x5b, 0x27, 0xa9, 0x9a, 0x39, 0x27, 0xb9, 0xaa, 0x28, 0x35, 0xb9, 0xab, 0x38,
+    0x45, 0xb1, 0x9d, 0x29, 0x24, 0xa1, 0xaf, 0x20, 0x23, 0xa0, 0xbc, 0x21, 0x43, 0xa0, 0xbd, 0x28,
+    0x34, 0xb1, 0xae, 0x20, 0x24, 0xa0, 0xad, 0x21, 0x22, 0xb0, 0xbd, 0x31, 0x13, 0x00, 0xdc, 0x39,
+    0x14, 0x98, 0xca, 0x2a, 0x07, 0xa8, 0x08, 0x89, 0x24, 0xa9, 0x10, 0xc9, 0x42, 0xa8, 0x88, 0xb1,
+    0x79, 0xa0, 0x00, 0x12, 0x8d, 0x91, 0x41, 0x08, 0xcd, 0x31, 0x30, 0xc0, 0xb9, 0x68, 0x00, 0x94,
+    0x0b, 0x00, 0x14, 0x00, 0x99, 0x31, 0x52, 0xe8, 0x0b, 0x31, 0x12, 0xe0, 0x9b, 0x43, 0x10, 0xa0,
+    0xae, 0x32, 0x01, 0x91, 0xcd, 0x58, 0x82, 0x80, 0xbb, 0x59, 0x85, 0x0a, 0xb8, 0x08, 0x16, 0x8a,
+    0xb1, 0x1a, 0x44, 0xb8, 0x88, 0x1b, 0x34, 0xe2, 0x0a, 0x08, 0x21, 0x93, 0x0f, 0x90, 0x21, 0x11,
+    0xcc, 0x01, 0x30, 0x08, 0xf9, 0x30, 0x08, 0xa1, 0x00, 0x4a, 0xb2, 0x10, 0x0c, 0x90, 0x04, 0x2b,
+    0xeb, 0x24, 0x10, 0xbb, 0xa0, 0x73, 0xb2, 0xca, 0x31, 0x7a, 0xc2, 0x09, 0x39, 0x00, 0x96, 0x0d,
+    0x88, 0x04, 0x18, 0xad, 0x01, 0x42, 0x9a, 0xc0, 0x30, 0x41, 0xc8, 0x88, 0x2a, 0x04, 0xa1, 0x8d,
+    0x28, 0x14, 0x98, 0xae, 0x32, 0x01, 0xb9, 0xac, 0x71, 0x91, 0x98, 0x0a, 0x50, 0x95, 0x0a, 0x8a,
+    0x02, 0x06, 0x9d, 0x90, 0x13, 0x38, 0xdd, 0x11, 0x20, 0x09, 0xf0, 0x28, 0x10, 0x90, 0xb0, 0x3d,
+    0x04, 0x98, 0x88, 0x1d, 0x05, 0x89, 0x8a, 0x98, 0x14, 0x9a, 0x8a, 0x91, 0x72, 0xa8, 0x09, 0x02,
+    0x48, 0xd8, 0x09, 0x13, 0x1a, 0xe9, 0x18, 0x33, 0xac, 0xc0, 0x29, 0x43, 0xfb, 0x08, 0x19, 0x24,
+    0xc9, 0x19, 0x10, 0x16, 0xc8, 0x1b, 0x01, 0x03, 0xd9, 0x8d, 0x03, 0x20, 0xb9, 0x9d, 0x24, 0x08,
+    0xa0, 0xac, 0x53, 0x80, 0x88, 0x9a, 0x52, 0x91, 0x8a, 0xc1, 0x49, 0xb0, 0x9b, 0x82, 0x1e, 0xb2,
+    0x1b, 0x63, 0x99, 0xa3, 0x3c, 0x62, 0xb0, 0x09, 0x0d, 0x04, 0xb2, 0x0d, 0x99, 0x24, 0x90, 0x9e,
+    0x90, 0x42, 0x88, 0xcb, 0x11, 0x51, 0x81, 0xba, 0x22, 0x30, 0xa3, 0xfb, 0x39, 0x09, 0xc2, 0xb9,
+    0x6b, 0x90, 0x91, 0x19, 0x3a, 0xb7, 0x18, 0x39, 0x91, 0x97, 0x2c, 0x08, 0x94, 0x18, 0x8f, 0x92,
+    0x12, 0x8c, 0xc9, 0x12, 0x30, 0xbb, 0xb1, 0x70, 0x12, 0xb0, 0x98, 0x79, 0x81, 0xa0, 0x0b, 0x19,
+    0xbc, 0xff, 0x0b, 0x00, 0x09, 0xf9, 0x18, 0x39, 0x98, 0xd1, 0x29, 0x28, 0xa0, 0x14, 0x4b, 0x02,
+    0xc3, 0x72, 0x89, 0xb1, 0xa9, 0x6a, 0xb8, 0xa0, 0x1e, 0x29, 0x94, 0x0a, 0x8b, 0x12, 0x27, 0x8c,
+    0x98, 0x11, 0x53, 0xab, 0x98, 0x30, 0x42, 0xf9, 0x89, 0x08, 0x00, 0xd1, 0x1a, 0x00, 0x20, 0x83,
+    0x1a, 0x07, 0x19, 0x03, 0x89, 0x90, 0xcc, 0x41, 0x89, 0x99, 0xeb, 0x59, 0x81, 0x99, 0xca, 0x4a,
+    0x04, 0x88, 0x9a, 0x39, 0x47, 0x08, 0x9a, 0x08, 0x34, 0xaa, 0xcb, 0x99, 0x52, 0xb8, 0xa9, 0x18,
+    0x52, 0x93, 0xa8, 0x21, 0x21, 0x04, 0x18, 0x4a, 0xb8, 0x22, 0x59, 0x89, 0xe9, 0x8a, 0x38, 0xc1,
+    0xca, 0x9c, 0x43, 0x85, 0x89, 0x89, 0x73, 0x13, 0x9b, 0xa8, 0x41, 0x23, 0xdc, 0x98, 0x28, 0x23,
+    0xf9, 0x19, 0x08, 0x13, 0xd1, 0x3b, 0x80, 0x22, 0x03, 0x1e, 0x84, 0x29, 0x21, 0xdb, 0x03, 0xad,
+    0x10, 0xc0, 0x21, 0xcc, 0x31, 0x03, 0x59, 0xc8, 0x49, 0x14, 0x09, 0xb1, 0x3b, 0x36, 0xb9, 0xa2,
+    0x8c, 0x35, 0xc8, 0x08, 0xab, 0x43, 0xb1, 0x2c, 0xa0, 0x71, 0x02, 0x1b, 0x93, 0x3a, 0x13, 0xbc,
+    0x04, 0x9d, 0x11, 0xb8, 0x52, 0xcb, 0x30, 0x01, 0x69, 0xc0, 0x29, 0x22, 0x30, 0xb4, 0x1d, 0x43,
+    0x02, 0xa2, 0x9f, 0x21, 0x81, 0x89, 0xbd, 0x30, 0x12, 0x0a, 0xc9, 0x70, 0x12, 0x98, 0x98, 0x29,
+    0x16, 0xb8, 0x19, 0x9a, 0x24, 0xa1, 0x3b, 0xc9, 0x2a, 0x29, 0x1a, 0x85, 0x9b, 0x32, 0x13, 0x27,
+    0xb9, 0x22, 0x82, 0x30, 0xf9, 0x29, 0x02, 0x1a, 0xea, 0x1b, 0x34, 0x90, 0xa1, 0x9f, 0x23, 0x91,
+    0x11, 0xdb, 0x32, 0x91, 0x49, 0xc1, 0x40, 0x91, 0x0d, 0x91, 0x3c, 0x03, 0xbb, 0x13, 0x9f, 0x14,
+    0x80, 0x22, 0xeb, 0x11, 0x00, 0x31, 0xf3, 0x1a, 0x90, 0x29, 0x93, 0x1f, 0x92, 0x99, 0x01, 0x8e,
+    0x51, 0x00, 0x08, 0x00, 0x01, 0x09, 0xc0, 0x1c, 0x14, 0x10, 0x91, 0xbd, 0x03, 0x00, 0x22, 0xfb,
+    0x18, 0x9a, 0x11, 0x91, 0x7b, 0x98, 0x99, 0x91, 0x1a, 0x05, 0x08, 0xb9, 0xfb, 0x02, 0x20, 0x01,
+    0xcb, 0x1a, 0x3a, 0x33, 0x12, 0x0f, 0x99, 0x80, 0x21, 0x98, 0x92, 0xa9, 0xab, 0xc3, 0x32, 0x31,
+    0xbb, 0xba, 0x1e, 0x22, 0x81, 0x18, 0xaf, 0x01, 0x92, 0x32, 0xe9, 0x88, 0xa0, 0x20, 0xa5, 0x39,
+    0x09, 0x9d, 0x92, 0x4b, 0x23, 0xab, 0x09, 0x9f, 0x12, 0x01, 0x20, 0xfb, 0x08, 0x80, 0x31, 0xc2,
+    0x2b, 0xa9, 0x1b, 0x15, 0x2b, 0x91, 0x8d, 0x00, 0xba, 0x16, 0x98, 0x08, 0xfa, 0x10, 0x81, 0x12,
+    0xb8, 0x1f, 0x89, 0x11, 0x02, 0x0c, 0x99, 0x1b, 0x13, 0xb1, 0x13, 0x0b, 0xa9, 0xb0, 0x31, 0x02,
+    0x01, 0xab, 0x1c, 0x91, 0x33, 0x09, 0x9c, 0x90, 0x10, 0x03, 0xb3, 0x0a, 0x0a, 0x01, 0x92, 0x10,
+    0x90, 0x99, 0x1a, 0x09, 0x03, 0x01, 0x1a, 0xbb, 0x11, 0x13, 0x01, 0xb1, 0x0b, 0x19, 0x11, 0x13,
+    0x9b, 0x09, 0x1a, 0x21, 0x99, 0x11, 0x99, 0x2b, 0xa0, 0x21, 0xa3, 0x91, 0x90, 0x1b, 0x11, 0x01,
+    0x92, 0x0b,
 };
 
-const size_t sound_face_down_len = 35666;
-const uint32_t sound_face_down_sample_rate = 16000;
+const audio_adpcm_clip_t sound_face_down_adpcm = {
+    .data = sound_face_down_data,
+    .data_len = sizeof(sound_face_down_data),
+    .samples = 35666,
+    .sample_rate = 16000,
+    .block_align = 256,
+};
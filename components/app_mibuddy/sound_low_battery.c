@@ -1,2778 +1,907 @@
 /**
  * @file sound_low_battery.c
- * @brief Embedded audio - "Low battery warning sound"
+ * @brief Embedded audio - "Low battery warning sound" (IMA-ADPCM)
  *
- * Converted from is_low_battery.mp3
+ * Generated by tools/gen_adpcm_asset.py from the 16-bit PCM array in
+ * 37a0295:components/app_mibuddy/sound_low_battery.c (converted from is_low_battery.mp3)
  * Sample rate: 16000 Hz
  * Channels: 1 (mono)
- * Bits: 16-bit signed PCM
+ * Format: IMA-ADPCM, 256-byte blocks
  * Duration: ~1.7 seconds
+ * Size: 13986 bytes (16-bit PCM: 55172 bytes)
+ * SNR vs source: 24.6 dB
+ *
+ * Command (in components/audio_play):
+ *   python3 tools/gen_adpcm_asset.py 37a0295:components/app_mibuddy/sound_low_battery.c sound_low_battery \
+ *       --brief 'Low battery warning sound' > ../app_mibuddy/sound_low_battery.c
  */
 
 #include <stddef.h>
 #include <stdint.h>
+#include "audio_adpcm.h"
 
-const int16_t sound_low_battery[] = {
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
-    0, 0, 0, 0, 0, 0, 0, 0, -1, -2,
-    -2, -3, -3, -2, -1, 0, 0, 0, 0, 0,
-    1, 1, 1, 1, 2, 2, 2, 1, 0, 0,
-    0, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
-    0, 0, -1, -1, -2, -1, -1, -1, 0, 0,
-    -1, -1, -1, -2, -2, -1, 0, 0, 1, 1,
-    1, 1, 0, 0, 0, 0, 0, 1, 1, 1,
-    0, -1, -2, -4, -4, -3, -1, 1, 4, 7,
-    8, 9, 8, 7, 6, 6, 6, 5, 4, 1,
-    -2, -8, -13, -18, -20, -20, -17, -13, -7, -2,
-    1, 4, 5, 6, 7, 9, 10, 12, 13, 12,
-    8, 3, -2, -7, -11, -11, -8, -4, 0, 4,
-    7, 7, 6, 4, 3, 3, 5, 7, 8, 8,
-    5, 0, -5, -10, -14, -15, -14, -11, -8, -6,
-    -5, -6, -8, -10, -9, -6, -1, 5, 12, 18,
-    20, 19, 16, 12, 9, 6, 4, 3, 1, -1,
-    -6, -13, -19, -23, -24, -21, -14, -4, 6, 16,
-    22, 26, 26, 23, 19, 16, 14, 10, 4, -2,
-    -11, -22, -33, -42, -47, -45, -36, -26, -15, -4,
-    5, 13, 18, 21, 24, 28, 34, 39, 41, 38,
-    32, 25, 13, 0, -9, -15, -18, -19, -17, -18,
-    -22, -29, -35, -40, -39, -32, -23, -11, 1, 13,
-    21, 24, 24, 23, 25, 28, 30, 29, 27, 20,
-    8, -7, -22, -35, -44, -46, -41, -31, -18, -7,
-    2, 9, 10, 10, 16, 24, 32, 40, 43, 40,
-    35, 25, 7, -10, -19, -22, -23, -19, -18, -23,
-    -30, -34, -43, -50, -46, -39, -37, -28, -7, 10,
-    15, 16, 20, 25, 31, 38, 44, 50, 63, 77,
-    72, 44, 15, -3, -19, -35, -45, -48, -44, -32,
-    -21, -25, -35, -29, -15, -11, -6, 14, 35, 41,
-    46, 48, 31, 2, -23, -46, -62, -55, -37, -31,
-    -30, -23, -19, -22, -27, -30, -18, 17, 51, 59,
-    58, 58, 48, 27, 11, 4, 4, 8, 8, 12,
-    21, 17, 0, -10, -24, -55, -73, -62, -48, -38,
-    -25, -28, -42, -37, -25, -28, -20, 6, 28, 52,
-    76, 51, -11, -47, -54, -70, -62, -14, 8, -16,
-    -13, 40, 69, 42, 16, 24, 45, 65, 72, 40,
-    -11, -7, 40, 18, -87, -150, -116, -60, -34, -28,
-    -41, -51, -9, 34, -9, -60, 15, 118, 88, 12,
-    5, -15, -79, -62, 12, 19, 10, 44, 30, -9,
-    36, 72, -5, -70, -53, -53, -66, -46, -55, -68,
-    -5, 33, -42, -115, -125, -147, -150, -75, 17, 66,
-    72, 44, 27, 20, -44, -89, 6, 77, -55, -200,
-    -152, -20, 39, 1, -99, -140, -74, -76, -195, -210,
-    -76, 19, 72, 155, 144, 16, -33, -19, -130, -253,
-    -154, 18, 25, 12, 164, 288, 215, 114, 78, 19,
-    10, 129, 221, 271, 395, 402, 143, -62, -66, -175,
-    -397, -405, -215, -23, 170, 278, 165, -13, -117, -239,
-    -336, -250, -55, 86, 129, 121, 173, 246, 77, -285,
-    -409, -235, -132, -171, -157, -83, -11, 70, 83, -46,
-    -225, -270, -66, 228, 291, 168, 172, 223, 102, -6,
-    11, -57, -158, -88, -22, -68, 0, 152, 160, 154,
-    291, 365, 225, 5, -118, -73, 46, 93, 76, 15,
-    -127, -166, -3, -41, -418, -563, -269, -27, -32, -39,
-    25, 127, 184, -17, -358, -423, -268, -191, -65, 211,
-    410, 465, 350, -67, -428, -274, -52, -269, -418, -86,
-    229, 245, 259, 286, 169, 74, 89, 121, 259, 451,
-    402, 264, 415, 551, 222, -185, -179, -27, -32, 8,
-    121, 88, 73, 249, 256, -81, -283, -87, 110, 34,
-    -85, 27, 314, 423, 156, -117, 53, 415, 424, 136,
-    -34, 3, 60, 19, -10, 166, 417, 381, 173, 206,
-    367, 348, 315, 382, 308, 159, 172, 147, -45, -122,
-    -105, -250, -359, -223, -89, -55, 33, 50, -94, -115,
-    46, 107, 52, 33, -21, -105, -64, 14, -19, -1,
-    178, 200, -127, -349, -76, 173, -209, -701, -483, 60,
-    138, -2, 111, 122, -201, -312, 1, 192, -18, -285,
-    -293, -79, 103, -31, -412, -501, -22, 493, 466, 103,
-    -131, -231, -283, -212, -152, -180, -28, 239, 224, 109,
-    194, 87, -316, -480, -528, -892, -1029, -567, -251, -321,
-    -121, 263, 223, -76, -184, -137, -135, -214, -178, 135,
-    364, 224, 129, 156, -97, -254, 18, -68, -643, -804,
-    -754, -1012, -811, -32, 311, 376, 646, 493, 159, 451,
-    481, -209, -376, -126, -159, 462, 999, -24, 1435, 9141,
-    16408, 15196, 9864, 9553, 14766, 20088, 22239, 21806, 22508, 26941,
-    30611, 25915, 12838, -65, -5214, -3079, -11, -192, -1152, 1556,
-    7992, 14061, 15402, 10920, 4906, 3687, 8542, 14801, 17851, 17509,
-    17583, 21400, 25935, 23371, 11431, -2197, -8513, -6398, -1756, -120,
-    -940, 771, 7134, 13972, 15613, 11032, 4842, 3306, 8451, 15775,
-    19265, 18369, 18128, 22077, 26406, 23424, 11485, -1741, -7911, -6717,
-    -3854, -3260, -3526, -901, 5314, 11232, 12455, 8360, 2360, -416,
-    3102, 10314, 14986, 14807, 14288, 17941, 22775, 20739, 8945, -5283,
-    -12009, -9552, -4690, -3405, -4816, -3970, 1534, 8325, 10539, 6023,
-    -1280, -4894, -1639, 5353, 9927, 10000, 9760, 13308, 17968, 16366,
-    5271, -9385, -18141, -17997, -14009, -11400, -9950, -6729, -1166, 3854,
-    4926, 1540, -3436, -5952, -3375, 2990, 8086, 9055, 9457, 13010,
-    16300, 13178, 3147, -8508, -15673, -15594, -11441, -9176, -9769, -8345,
-    -2177, 5104, 7929, 4419, -1720, -3941, 755, 8411, 12779, 12409,
-    11633, 14670, 19222, 17700, 6529, -8042, -16345, -15622, -11264, -9219,
-    -9584, -7831, -1280, 6736, 9844, 5333, -2607, -6484, -2649, 5159,
-    10129, 10100, 9679, 13740, 19697, 18798, 6589, -10205, -20136, -19149,
-    -13424, -10760, -11847, -11082, -4696, 3956, 7882, 3908, -4129, -8854,
-    -6023, 1443, 6778, 7124, 6316, 9083, 14079, 14264, 4613, -11040,
-    -22570, -23822, -18420, -14053, -13262, -12185, -7155, 25, 3923, 1440,
-    -4809, -8801, -6498, 525, 6709, 8356, 7583, 9104, 13201, 14019,
-    6278, -7473, -18413, -20482, -16114, -12033, -10949, -9496, -4085, 3419,
-    7236, 4247, -2265, -5798, -3000, 3464, 8281, 9335, 9548, 12375,
-    16206, 14987, 5228, -8760, -18352, -19283, -15275, -12514, -12308, -10787,
-    -5012, 2568, 6283, 3142, -3919, -8490, -6432, 417, 6281, 7649,
-    7108, 9704, 15418, 17326, 9130, -6379, -18903, -21265, -16316, -11960,
-    -11393, -10852, -6256, 865, 5070, 3026, -3363, -9009, -9677, -4842,
-    2038, 6442, 7302, 8157, 12211, 16620, 14146, 1708, -14383, -23855,
-    -22814, -16726, -12945, -12587, -11178, -5673, 1381, 4577, 1173, -6199,
-    -11507, -10143, -2925, 4516, 7342, 6636, 7646, 12378, 15665, 10498,
-    -3272, -17594, -24068, -21724, -16281, -13099, -12319, -10463, -5357, 1000,
-    3997, 835, -6050, -10299, -7466, 216, 6152, 6959, 6189, 9022,
-    14514, 15700, 7876, -5302, -15436, -17891, -15119, -12214, -11237, -10380,
-    -7202, -1674, 3385, 4372, 180, -5837, -8025, -3855, 3070, 6834,
-    6074, 5380, 8913, 14115, 13849, 4763, -8225, -16703, -17061, -13050,
-    -10634, -11560, -12372, -9097, -2229, 3140, 2233, -4269, -10234, -9795,
-    -3177, 3697, 5727, 4066, 4186, 8675, 13263, 11037, 334, -12652,
-    -19656, -18268, -13499, -11620, -13341, -13761, -8769, -468, 4468, 1726,
-    -5934, -11161, -9058, -1592, 4965, 6651, 5521, 6582, 11281, 14885,
-    11193, -231, -12573, -18195, -16018, -11590, -10117, -10887, -9283, -3197,
-    4033, 7062, 3834, -2682, -7176, -6111, -242, 6149, 9078, 8750,
-    9098, 12380, 14917, 10320, -2371, -15743, -21101, -17678, -12649, -11979,
-    -13690, -11539, -3720, 4419, 6284, 914, -6455, -9544, -6162, 697,
-    5961, 7186, 6845, 9258, 14511, 16533, 9186, -5690, -18451, -21189,
-    -15841, -11056, -11712, -13867, -10741, -1721, 6411, 6808, -301, -7995,
-    -9350, -3566, 4009, 7603, 6862, 6740, 11063, 16741, 15944, 4824,
-    -11109, -21798, -22553, -17808, -14882, -15629, -15515, -10164, -1123, 5404,
-    4788, -1523, -7305, -7112, -1037, 5715, 8277, 7228, 7545, 12002,
-    16564, 13967, 2119, -12454, -20645, -19666, -14806, -12556, -13479, -12718,
-    -6760, 1762, 6492, 4010, -2519, -6399, -3827, 2806, 7950, 8944,
-    8518, 10882, 15813, 17856, 12077, -52, -11480, -16276, -14774, -11888,
-    -11192, -11531, -9325, -3348, 3286, 5838, 2623, -2905, -5051, -1263,
-    5433, 9797, 10030, 9390, 11738, 16098, 16818, 9643, -3078, -14092,
-    -18016, -15802, -12519, -11611, -11962, -10200, -5002, 1207, 4375, 2393,
-    -2867, -6619, -4886, 1861, 8835, 11532, 10348, 9814, 12717, 15808,
-    12734, 1535, -12026, -19742, -19002, -14459, -12021, -12667, -12699, -8940,
-    -2477, 2567, 3027, -650, -4862, -5522, -1163, 5721, 10754, 11832,
-    11094, 12075, 14915, 15307, 9017, -2749, -13507, -17521, -15040, -10996,
-    -9273, -9286, -7860, -3354, 2367, 5487, 3602, -1885, -6364, -5538,
-    714, 7902, 11167, 10325, 9796, 12875, 16861, 15271, 5173, -8690,
-    -18014, -18908, -14903, -12083, -12518, -13154, -10170, -3452, 2900, 4091,
-    -781, -7222, -8973, -3749, 4687, 10397, 11177, 10383, 12504, 17193,
-    18710, 12021, -1152, -13359, -18464, -16897, -13709, -12476, -12268, -10158,
-    -5120, 889, 4439, 2943, -2942, -8643, -8905, -2841, 4982, 9308,
-    9572, 9791, 13092, 17148, 16043, 6900, -6274, -16063, -18457, -15696,
-    -12836, -12356, -12330, -9500, -3478, 2417, 4126, 396, -5923, -9676,
-    -7327, -72, 7156, 10377, 10202, 10588, 13846, 17089, 14501, 3894,
-    -9745, -18435, -18684, -13965, -10244, -9964, -10344, -7174, -168, 5928,
-    6000, -113, -7277, -9543, -4963, 3119, 9173, 10535, 9716, 11287,
-    16121, 19115, 13809, 69, -14030, -19765, -16578, -11481, -10247, -11567,
-    -10124, -3615, 4238, 7322, 3421, -3503, -7368, -5507, -42, 4947,
-    7049, 7354, 9052, 13429, 17267, 15223, 5253, -8427, -18210, -19719,
-    -15690, -12399, -12421, -12513, -8676, -1522, 4060, 3766, -1830, -7593,
-    -8537, -4086, 2298, 6707, 7823, 7837, 10375, 15741, 18590, 12923,
-    -362, -13180, -18091, -15131, -10483, -9325, -10838, -10394, -5646, 818,
-    4381, 2606, -2796, -6962, -5613, 922, 7996, 11456, 11528, 11881,
-    15211, 19364, 18270, 8487, -5551, -15205, -16457, -12873, -10161, -10186,
-    -10555, -8328, -3386, 1407, 2780, -351, -5828, -8974, -5968, 1838,
-    8477, 10053, 9235, 11160, 16317, 19382, 14717, 2483, -10604, -17118,
-    -15716, -11356, -9218, -9853, -9877, -6071, 872, 6178, 5420, -697,
-    -6855, -7974, -3032, 4635, 10099, 11241, 10765, 12729, 17341, 20199,
-    16211, 4336, -10232, -19251, -18859, -13382, -10103, -11289, -12925, -10203,
-    -2928, 4054, 5375, 267, -6816, -10094, -6552, 2121, 10275, 12829,
-    10630, 9578, 13290, 18359, 17675, 7667, -7470, -18535, -19701, -14091,
-    -9450, -9436, -11400, -11086, -6775, -138, 4705, 4080, -1592, -7344,
-    -7572, -922, 8075, 12893, 11624, 8829, 9809, 14410, 17284, 13056,
-    1392, -11634, -18236, -16397, -11340, -8981, -10172, -11566, -9517, -3175,
-    4106, 6985, 3402, -3079, -6713, -4376, 2353, 8492, 9998, 7979,
-    7383, 10959, 15820, 16137, 8652, -3771, -13944, -16878, -14226, -11301,
-    -11081, -12203, -11082, -5322, 3154, 8611, 7083, 765, -4483, -4637,
-    -44, 5408, 7536, 6211, 5769, 9443, 14797, 16112, 10069, -1315,
-    -12091, -17085, -16348, -14206, -13754, -13866, -11478, -5260, 2650, 7759,
-    7077, 2168, -2561, -3885, -1366, 3092, 6414, 7197, 7656, 10632,
-    15224, 17444, 14158, 5310, -5731, -13511, -14797, -11878, -9502, -9145,
-    -8227, -4068, 2741, 8339, 8830, 4135, -1936, -5460, -5043, -1536,
-    2791, 5558, 6534, 7800, 10763, 14041, 14174, 7916, -4274, -16212,
-    -20617, -16966, -11595, -9519, -9542, -7677, -2334, 4203, 7731, 5736,
-    -236, -5949, -7630, -3984, 2840, 8142, 8998, 7787, 9159, 13807,
-    17025, 13244, 1733, -11472, -18267, -16309, -10726, -7398, -7113, -6870,
-    -3996, 1510, 6444, 6535, 837, -6768, -11055, -9366, -2813, 4461,
-    8267, 8410, 8740, 12141, 16582, 16574, 8340, -5524, -16793, -19098,
-    -14334, -9476, -8322, -8881, -7355, -2272, 4145, 7424, 4760, -2092,
-    -8418, -10230, -6451, 446, 5847, 7257, 7143, 9783, 15605, 19786,
-    16433, 4679, -9026, -16351, -15336, -11082, -8576, -8167, -7639, -4979,
-    592, 7046, 9633, 5273, -3417, -9937, -9594, -3391, 3265, 6099,
-    6122, 7576, 12412, 17851, 18610, 11310, -1743, -13283, -17415, -14785,
-    -10345, -7811, -7475, -7060, -3633, 3073, 8858, 8704, 2198, -5989,
-    -10251, -8120, -1791, 3919, 6225, 6752, 8787, 13213, 17474, 17426,
-    10652, -645, -10683, -15041, -14023, -11139, -9511, -9542, -9047, -5897,
-    -680, 3797, 4942, 1762, -4215, -8497, -6819, -83, 6277, 8443,
-    7564, 7313, 10174, 15303, 18321, 14541, 4038, -7433, -13522, -12824,
-    -9356, -8075, -10019, -11825, -9736, -3322, 4192, 8034, 5379, -1353,
-    -5804, -4083, 1385, 5521, 6163, 5143, 5832, 10167, 16354, 19437,
-    15505, 5391, -6067, -13815, -16027, -14992, -14420, -15474, -15969, -13218,
-    -6641, 1619, 7423, 7223, 1634, -4300, -5615, -1817, 3450, 6519,
-    7211, 8392, 12280, 17797, 21407, 19514, 10679, -2392, -13480, -17879,
-    -16709, -14629, -14245, -14330, -12131, -6021, 2570, 8951, 8670, 2234,
-    -4851, -7253, -4224, 1048, 5276, 7687, 9615, 12648, 17052, 20674,
-    19467, 11046, -1790, -12871, -18270, -18640, -16622, -14160, -11965, -9496,
-    -5533, -12, 4971, 6620, 3758, -1965, -6627, -6581, -1517, 5265,
-    10045, 11854, 12566, 14339, 16975, 17607, 13139, 3223, -8859, -17935,
-    -20223, -16214, -10395, -7285, -7503, -7748, -4364, 2642, 8583, 8030,
-    876, -6584, -7742, -1881, 6215, 11362, 11960, 10453, 10739, 14206,
-    17651, 15705, 6034, -7644, -18019, -20214, -15679, -10154, -8077, -9041,
-    -9023, -4751, 2589, 7924, 7035, 665, -6203, -8491, -4567, 2895,
-    9113, 11236, 10555, 10425, 12477, 15048, 14420, 7658, -4243, -15786,
-    -20967, -18483, -12470, -8207, -7552, -8178, -6507, -1352, 4672, 6991,
-    3072, -4418, -9009, -6285, 1856, 9604, 12902, 11921, 9746, 9942,
-    13382, 16044, 12010, 331, -12636, -19032, -16628, -9846, -4923, -4617,
-    -6658, -6503, -1813, 4966, 8337, 4914, -2692, -7908, -6365, 668,
-    8365, 12354, 11520, 8891, 9141, 13302, 16547, 12872, 1652, -11292,
-    -18703, -17820, -12153, -7723, -7507, -9564, -9828, -5983, 417, 4679,
-    2904, -3709, -9257, -8485, -1390, 7261, 12296, 12432, 10915, 11806,
-    15518, 18036, 14378, 3391, -9953, -17919, -17044, -11177, -6731, -6381,
-    -8035, -7894, -3766, 2597, 6092, 3133, -3916, -8698, -7023, -172,
-    7113, 10885, 10802, 9751, 10817, 13996, 15330, 10108, -1626, -13449,
-    -18456, -16156, -11515, -8630, -7866, -7546, -5623, -1119, 3930, 5428,
-    1728, -4047, -6965, -4536, 1741, 7811, 10273, 9316, 8457, 10666,
-    14405, 14136, 6147, -6172, -14913, -15923, -12190, -8892, -8078, -8476,
-    -7523, -3345, 2835, 6685, 5100, -168, -4369, -4107, 453, 6063,
-    8882, 8059, 6859, 9047, 14034, 16430, 11265, -125, -10592, -14399,
-    -12536, -9816, -9037, -9529, -9013, -5291, 1647, 8099, 9330, 4524,
-    -2156, -5284, -2483, 3721, 8006, 7629, 5592, 6977, 12498, 17002,
-    14382, 3771, -8933, -16284, -16202, -12819, -10951, -11545, -12015, -9048,
-    -1756, 6405, 9905, 6572, -96, -4364, -3070, 2314, 7235, 8362,
-    6981, 7251, 11079, 15689, 15942, 8862, -2968, -12719, -15609, -13373,
-    -11029, -10759, -10757, -8389, -2826, 4048, 8441, 7706, 3057, -1459,
-    -2453, 484, 4933, 7911, 8668, 9046, 10936, 13909, 15094, 11040,
-    1215, -9842, -16115, -16427, -14698, -13957, -13306, -10777, -6080, -401,
-    4272, 5794, 3418, -1168, -4725, -4501, -403, 4563, 7228, 7787,
-    9083, 12460, 15519, 14036, 6044, -5385, -14077, -16494, -14626, -12545,
-    -11882, -11293, -8393, -2021, 5522, 9159, 6116, -378, -4214, -2454,
-    2627, 6612, 7385, 6884, 8303, 11882, 14414, 12465, 5174, -5029,
-    -13562, -16989, -16051, -14220, -13368, -12378, -9383, -3875, 2630, 7069,
-    7097, 3499, -446, -1829, 146, 4127, 7497, 8454, 7838, 8133,
-    10394, 12438, 10221, 1882, -9047, -16127, -16683, -14011, -12146, -11262,
-    -9285, -5174, 513, 6013, 8726, 7099, 2614, -1084, -1120, 2494,
-    6985, 9250, 8850, 8290, 9916, 12826, 13066, 7210, -3545, -13349,
-    -17033, -14952, -11390, -9405, -8642, -6785, -2054, 4396, 8357, 6717,
-    1510, -2097, -1284, 2564, 6317, 7917, 7780, 8355, 11238, 14296,
-    12936, 4972, -6279, -14456, -16002, -13209, -10892, -10769, -10347, -6751,
-    -276, 5500, 6564, 2365, -2892, -4141, -547, 4407, 7114, 6954,
-    6459, 9068, 14870, 18328, 13111, 56, -12329, -16498, -13209, -9350,
-    -9713, -12201, -11140, -4362, 4041, 7823, 4531, -2424, -6764, -4693,
-    1885, 7588, 9083, 8074, 9035, 14202, 20123, 19634, 9207, -5797,
-    -15649, -16118, -11589, -8639, -9148, -9962, -7351, -1247, 4215, 4475,
-    -914, -7660, -10328, -6515, 1432, 8272, 10540, 10040, 11599, 16577,
-    19702, 14098, -291, -14986, -21044, -17814, -12060, -9638, -10300, -9937,
-    -5575, 1544, 6389, 4470, -3020, -9370, -8588, -868, 8145, 12718,
-    12148, 11299, 14945, 20942, 21103, 10472, -5918, -17553, -18949, -13953,
-    -9977, -10062, -11374, -9797, -4352, 2061, 4824, 1308, -6000, -10655,
-    -7915, 810, 9596, 13588, 13110, 12824, 16240, 20568, 18612, 7038,
-    -8748, -19431, -20509, -15356, -10783, -10443, -11958, -10128, -3176, 4457,
-    6203, 297, -7732, -9930, -3594, 6114, 11771, 11608, 10786, 14522,
-    20956, 22238, 13264, -1783, -13242, -15950, -13391, -11864, -13113, -13747,
-    -10087, -2454, 4578, 6062, 1520, -4353, -6288, -3098, 2299, 6331,
-    7916, 9145, 12799, 18408, 21304, 16845, 5550, -6803, -14334, -15826,
-    -14462, -13625, -13613, -12068, -6857, 1188, 7740, 8043, 1833, -5467,
-    -7707, -3693, 2679, 6890, 7789, 8226, 11817, 17921, 20442, 13680,
-    -737, -14544, -20563, -18633, -14096, -11653, -11096, -8658, -2032, 6261,
-    10606, 7424, -1103, -8367, -8905, -2987, 4358, 8504, 9225, 10088,
-    14020, 18941, 18476, 8583, -6822, -18591, -20784, -15371, -9018, -6366,
-    -6252, -3920, 2930, 10625, 12766, 6783, -3244, -9814, -8000, 474,
-    8631, 10823, 8432, 7988, 12931, 18291, 15237, 1326, -15263, -23220,
-    -19227, -10245, -5292, -6556, -8569, -4988, 4022, 11168, 9374, -457,
-    -9939, -11198, -3756, 5733, 9942, 7867, 5577, 8781, 15065, 15842,
-    6435, -7926, -17324, -17090, -11280, -6883, -6350, -6583, -3901, 1716,
-    6898, 7990, 4200, -1310, -3749, -975, 4561, 8414, 8596, 7412,
-    8416, 11171, 10435, 2480, -9028, -16292, -16051, -12210, -9915, -9743,
-    -8519, -4083, 1929, 5653, 4750, 680, -2404, -1185, 3693, 8022,
-    8499, 6663, 6809, 9869, 11417, 6708, -3496, -13141, -16614, -13893,
-    -9757, -8086, -8053, -6497, -2520, 1682, 3516, 2276, -423, -1601,
-    864, 6114, 10834, 12424, 11435, 10418, 10313, 8779, 3119, -5630,
-    -13053, -15741, -14004, -10449, -7395, -5564, -4018, -1351, 2245, 4417,
-    3028, -771, -2611, 967, 8205, 13241, 12688, 9786, 10007, 13250,
-    13086, 4602, -8698, -17656, -17123, -11284, -8134, -9935, -11407, -7106,
-    1742, 8448, 7617, 485, -5808, -4730, 3056, 10252, 10937, 7284,
-    6771, 12614, 18686, 15784, 2460, -12595, -19657, -17482, -12691, -11370,
-    -12975, -12096, -5152, 4957, 11025, 8560, 478, -5460, -3908, 3242,
-    9264, 10057, 8576, 10664, 16921, 20776, 15434, 1566, -12842, -19887,
-    -18438, -13656, -10680, -9664, -7045, -713, 6775, 10120, 6520, -881,
-    -5456, -3433, 2813, 8095, 10056, 10814, 13379, 17061, 16953, 8779,
-    -5582, -18460, -23114, -19774, -14415, -11868, -11087, -7761, -825, 5335,
-    5710, 401, -5381, -6304, -1343, 5867, 10551, 11269, 11138, 13773,
-    17830, 16986, 6811, -8766, -19840, -20344, -14078, -9507, -9887, -10794,
-    -6943, 992, 7066, 6288, -348, -6470, -5980, 1210, 9076, 11733,
-    9768, 9201, 13523, 18170, 15014, 2250, -12469, -19826, -18188, -13759,
-    -12444, -13579, -12126, -5623, 2462, 6293, 3583, -2322, -5618, -3076,
-    3359, 8698, 10037, 9509, 11330, 15986, 18594, 13853, 2116, -10300,
-    -16933, -16784, -14032, -12754, -12698, -10376, -3850, 4145, 8223, 5621,
-    -726, -4736, -2763, 3439, 9046, 11067, 10998, 12588, 16766, 19251,
-    14383, 1750, -12054, -19292, -18298, -13984, -11496, -10786, -8079, -1573,
-    5646, 8449, 4809, -1821, -5136, -1605, 6077, 11792, 12711, 12064,
-    14025, 17001, 14628, 3988, -9557, -17624, -17654, -14281, -12390, -11556,
-    -8354, -2149, 3384, 4208, 252, -4234, -4357, 948, 7729, 11018,
-    10501, 10913, 15267, 18994, 14054, -459, -14988, -19304, -13917, -8617,
-    -10039, -14111, -12347, -3201, 5677, 6173, -1416, -8788, -7924, 1281,
-    11204, 14401, 11474, 9995, 14760, 20664, 17748, 3368, -13311, -20581,
-    -16397, -9171, -7091, -9504, -9731, -4209, 3253, 5861, 1184, -6117,
-    -8666, -3538, 5068, 10674, 11587, 11923, 15219, 18560, 15250, 3367,
-    -10695, -18669, -18748, -15684, -13822, -12619, -9171, -3062, 2492, 3799,
-    381, -4299, -5681, -2131, 3553, 7246, 8448, 10908, 16887, 22047,
-    18981, 6355, -8062, -15205, -14132, -11645, -13001, -15487, -12537, -2781,
-    7287, 9941, 4184, -3469, -5600, -955, 4964, 6445, 4299, 4856,
-    11753, 20062, 20472, 9520, -5922, -15510, -15825, -12399, -11835, -14069,
-    -13445, -6353, 3749, 9459, 7155, 672, -3109, -1416, 2632, 4785,
-    4784, 6066, 10676, 15501, 14855, 6948, -3611, -10575, -12247, -11855,
-    -12371, -12616, -9369, -2472, 4004, 6060, 3703, 162, -1296, 516,
-    4005, 5982, 5292, 4975, 8506, 13890, 14261, 5778, -6706, -14049,
-    -12771, -8326, -7435, -9721, -9481, -3904, 3624, 7617, 5562, -281,
-    -4462, -2760, 3548, 8681, 8725, 6195, 6722, 11104, 12765, 5416,
-    -7952, -17349, -17165, -11593, -7866, -7672, -6999, -2396, 4351, 7654,
-    4205, -2784, -6503, -3564, 3035, 7829, 8772, 8851, 11493, 14753,
-    12293, 1405, -12202, -19819, -18650, -13484, -10101, -8782, -5317, 2012,
-    8735, 9080, 2881, -4415, -7235, -3874, 3022, 8570, 10184, 10576,
-    13748, 17878, 15765, 3891, -11610, -20462, -18880, -12457, -8308, -7047,
-    -4372, 1747, 8378, 10902, 6934, -1480, -8004, -6722, 1387, 8948,
-    10810, 9742, 11375, 15429, 15153, 5802, -8668, -19125, -20531, -15861,
-    -11218, -9211, -7563, -2957, 4139, 8490, 5326, -2917, -7614, -3533,
-    4826, 9241, 8375, 8477, 13377, 17934, 14077, 1302, -11952, -17260,
-    -14349, -9737, -8668, -9690, -7391, 174, 7958, 8863, 2096, -4941,
-    -4466, 2922, 9480, 10108, 7942, 8880, 12943, 13648, 5835, -7332,
-    -16610, -16506, -11187, -8390, -9281, -8330, -2506, 4010, 5293, 896,
-    -3777, -3413, 1676, 6432, 7453, 6874, 8712, 12739, 13671, 6842,
-    -5444, -14624, -14963, -10342, -8451, -10094, -9349, -3259, 3945, 6353,
-    2666, -2839, -4214, 380, 6680, 9437, 8479, 7922, 10341, 13093,
-    10478, 427, -11248, -16273, -13626, -9639, -8442, -7549, -3577, 2329,
-    5961, 4631, 86, -2770, -1037, 3159, 6221, 7716, 9633, 12809,
-    15224, 12952, 4012, -7543, -14333, -13977, -11195, -10470, -10644, -7908,
-    -1157, 6083, 8050, 2705, -4458, -5632, 211, 6741, 8606, 7250,
-    8015, 12849, 16662, 12313, -275, -12724, -17268, -14459, -10512, -9655,
-    -10297, -7625, -199, 6494, 5885, -643, -4813, -1774, 4842, 8752,
-    8465, 7944, 11042, 15654, 14707, 4788, -8034, -14298, -11921, -7552,
-    -7513, -10276, -9205, -1836, 5744, 5767, -1153, -6228, -2955, 5797,
-    12009, 11599, 8334, 8887, 13919, 15762, 7577, -6716, -15955, -14795,
-    -8971, -6923, -9727, -11170, -6517, 797, 2803, -2877, -9354, -8639,
-    -951, 6656, 9296, 9107, 11153, 15842, 16951, 8789, -5324, -15090,
-    -14673, -8897, -6294, -8603, -9719, -4431, 3860, 6070, -1465, -11277,
-    -12741, -4162, 6223, 10417, 8936, 8750, 14156, 20334, 17674, 3642,
-    -12395, -18921, -14557, -7683, -5729, -7829, -7663, -2050, 4206, 3534,
-    -4454, -11502, -10380, -2664, 4787, 8169, 9489, 12323, 16147, 15790,
-    7630, -4676, -13191, -14016, -10382, -7838, -8047, -7417, -2236, 4745,
-    5920, -991, -8516, -8468, -1575, 5185, 7388, 6664, 7706, 12533,
-    16580, 12626, 369, -11402, -14495, -9967, -5245, -5088, -7021, -5312,
-    919, 5551, 3317, -2981, -6320, -3695, 2357, 7670, 9998, 10738,
-    12622, 14199, 10281, 319, -8885, -11786, -10289, -9000, -8754, -6833,
-    -1462, 4485, 5094, -1060, -7169, -5974, 1204, 7259, 8388, 7202,
-    8692, 14019, 17238, 10853, -3622, -15368, -16772, -11300, -7069, -7158,
-    -7851, -4239, 2802, 6167, 1463, -5997, -7458, -1409, 6298, 10458,
-    11196, 12083, 14606, 14479, 6524, -6308, -14565, -14301, -11026, -10216,
-    -10186, -6372, 1487, 8079, 7560, 359, -5912, -4488, 2880, 8658,
-    8786, 6966, 9350, 15420, 16576, 6892, -7321, -14489, -12399, -8929,
-    -9463, -10873, -8211, -1716, 3870, 4297, 56, -3502, -1455, 4963,
-    9661, 9265, 7230, 8341, 10709, 7448, -2923, -12643, -14353, -10503,
-    -8742, -10750, -10823, -5111, 2166, 3617, -2076, -8060, -6723, 1982,
-    10578, 12550, 9908, 10211, 15463, 17571, 8470, -7850, -18626, -17073,
-    -9303, -5518, -7543, -7910, -1092, 7781, 8770, 42, -9458, -10282,
-    -2190, 6744, 9349, 7410, 8843, 15456, 18160, 8913, -7146, -17506,
-    -17012, -11510, -8681, -9253, -7700, -660, 7178, 8142, 1409, -5805,
-    -6438, -470, 5829, 7099, 5760, 8518, 14491, 13845, 2337, -10883,
-    -15444, -12298, -9079, -9058, -8930, -4343, 4166, 10209, 8000, -249,
-    -6169, -4260, 2979, 8396, 8128, 6258, 8847, 13347, 10591, -1207,
-    -12734, -16203, -13684, -10749, -8788, -5542, 694, 7927, 10909, 6845,
-    -89, -3094, -314, 4466, 6972, 6704, 7016, 10090, 11912, 6370,
-    -5291, -14793, -17163, -15039, -12456, -9663, -4821, 2105, 7774, 8118,
-    3500, -668, -172, 3492, 6254, 6732, 7241, 10392, 14355, 12684,
-    1960, -11874, -19363, -18303, -14103, -11229, -9015, -5084, 666, 5631,
-    6858, 4013, -16, -1646, 585, 5434, 10540, 14445, 16494, 14967,
-    8070, -2051, -9847, -12860, -14107, -16031, -15947, -10092, 284, 9070,
-    10862, 5834, -548, -2666, 382, 5021, 7738, 8821, 11085, 14796,
-    15605, 9608, -984, -10170, -14964, -16852, -17491, -16003, -10757, -2589,
-    4356, 5967, 2755, -557, -622, 1247, 1876, 549, -39, 3351,
-    10403, 16337, 16289, 10006, 1166, -6572, -11684, -14411, -15566, -15328,
-    -13227, -9204, -3686, 2689, 7888, 8591, 3982, -1997, -4284, -1488,
-    3699, 7332, 7536, 6583, 8559, 13544, 15960, 10428, -2030, -14595,
-    -20591, -18788, -13498, -9642, -8196, -6738, -3069, 2479, 6990, 6955,
-    1833, -4542, -7275, -4525, 1957, 8603, 12144, 12060, 11003, 11137,
-    10757, 6259, -3166, -13867, -20333, -19573, -13729, -7963, -5268, -4234,
-    -2144, 1114, 3001, 1550, -2021, -4217, -2644, 2091, 7644, 11934,
-    14039, 14357, 13710, 11608, 6442, -1746, -10117, -15492, -16764, -14724,
-    -11176, -8201, -6550, -4717, -1130, 2813, 3561, -51, -4289, -3936,
-    1956, 9004, 12403, 11799, 10929, 13060, 16827, 16581, 8098, -5668,
-    -16371, -18769, -15671, -13373, -13998, -13982, -9298, -770, 6156, 6764,
-    1808, -3451, -4592, -1648, 2350, 5307, 7916, 11934, 17314, 21523,
-    21435, 15489, 4534, -8281, -18561, -22990, -21544, -17215, -13184, -10000,
-    -5569, 1499, 8477, 9953, 3867, -4981, -8958, -4720, 4299, 11756,
-    14277, 14167, 16120, 20676, 22169, 14826, -13, -14501, -21581, -20471,
-    -15653, -11896, -10335, -8617, -4257, 2214, 7096, 6612, 1015, -4605,
-    -4875, 515, 7055, 10396, 10032, 9032, 10894, 15217, 16404, 9181,
-    -4351, -15823, -19163, -16101, -13057, -13966, -16227, -13793, -4781, 5107,
-    8333, 3665, -2896, -4628, -449, 4917, 6805, 5967, 6938, 11735,
-    17268, 18726, 13801, 4155, -5963, -13121, -16881, -18096, -16693, -12882,
-    -8388, -4403, -374, 3588, 5332, 3134, -1813, -5810, -5157, 699,
-    8110, 12723, 14100, 15187, 17331, 17531, 11414, -1146, -14103, -20356,
-    -18816, -14581, -12268, -11477, -8891, -2882, 4002, 6537, 2065, -5483,
-    -8810, -4800, 2926, 8802, 10853, 11515, 14072, 18410, 20310, 15425,
-    3945, -8902, -16819, -17351, -13509, -10371, -9924, -9739, -6544, -315,
-    5143, 5537, 505, -5333, -6553, -2003, 4708, 9178, 10226, 10525,
-    13311, 18126, 20486, 16332, 6215, -5129, -12681, -14701, -13365, -12185,
-    -12609, -12937, -10301, -3915, 3162, 6226, 3666, -1423, -4694, -4014,
-    259, 5850, 9572, 10472, 11466, 15350, 20077, 20274, 12855, 47,
-    -12254, -18828, -18837, -15653, -13085, -12084, -10544, -5938, 1022, 5771,
-    4590, -923, -5852, -6805, -3305, 2995, 8925, 12215, 14000, 16474,
-    18635, 17057, 10050, -707, -11347, -17783, -18248, -14490, -9783, -6262,
-    -4164, -2256, 694, 3741, 4201, 1089, -3456, -6250, -4935, 924,
-    8500, 13191, 13378, 11953, 12136, 13561, 12804, 6720, -3929, -13768,
-    -17401, -14779, -10433, -8269, -8568, -8668, -5572, 490, 5027, 3777,
-    -2143, -7255, -7206, -2304, 3440, 6271, 6313, 7118, 11310, 17235,
-    19854, 14818, 2930, -9157, -14608, -13066, -10001, -9959, -12338, -12962,
-    -8246, 963, 8721, 8875, 1617, -6123, -7425, -1682, 5763, 9429,
-    8727, 7563, 9718, 14922, 18697, 15856, 5492, -7049, -14571, -14675,
-    -11041, -8740, -9657, -11689, -11017, -5837, 1254, 5270, 3703, -972,
-    -3638, -1195, 4688, 9324, 9659, 7140, 6001, 8895, 13774, 15106,
-    9223, -1382, -10181, -12950, -11079, -9143, -10106, -12348, -11290, -4852,
-    3238, 7025, 4559, -695, -3794, -2543, 1345, 4479, 5358, 5683,
-    8036, 12708, 16834, 16434, 9945, 69, -8469, -12891, -13556, -12394,
-    -11198, -10370, -8534, -4425, 731, 3977, 3484, -154, -4434, -6026,
-    -2973, 3168, 8417, 10197, 9689, 10278, 13543, 16644, 14565, 5657,
-    -5962, -14124, -15934, -13459, -11196, -11749, -13310, -11754, -5499, 2291,
-    6362, 4085, -1860, -5552, -3529, 1918, 6017, 6982, 7027, 9105,
-    13730, 18054, 17672, 10554, -518, -10208, -15251, -16332, -15896, -15097,
-    -13238, -9571, -4510, 867, 5057, 5987, 2839, -1739, -3402, -517,
-    4686, 8987, 10870, 11243, 12546, 15985, 18883, 16323, 6556, -6069,
-    -14643, -16159, -13793, -12502, -13421, -13683, -10602, -4358, 2466, 6436,
-    5437, 873, -3030, -2988, 745, 5270, 7733, 7711, 7601, 10019,
-    14531, 17593, 15564, 7502, -4009, -14254, -19500, -19403, -16336, -12889,
-    -10188, -7550, -3383, 2680, 8341, 10043, 6160, -999, -6227, -5303,
-    1184, 8352, 11769, 11224, 10069, 11656, 15732, 17556, 11878, -941,
-    -13897, -19593, -16979, -11450, -8981, -10613, -12303, -9628, -2319, 5460,
-    8685, 5645, -497, -4362, -3032, 1924, 6684, 8523, 7554, 6568,
-    8748, 14091, 18142, 15428, 4726, -9015, -18297, -19400, -15384, -12342,
-    -12970, -14498, -12412, -5339, 3382, 8427, 7132, 1778, -2623, -2586,
-    1431, 6014, 8241, 8485, 9356, 12128, 15259, 15961, 12045, 3351,
-    -7064, -14388, -16291, -14790, -13204, -12573, -11572, -8656, -3739, 1533,
-    4825, 4675, 1619, -1634, -1802, 1916, 6772, 9470, 9493, 8828,
-    9794, 13297, 17189, 16500, 8038, -5036, -15400, -18438, -15695, -12127,
-    -11166, -12138, -11696, -7458, -277, 6255, 7983, 3303, -4444, -8834,
-    -6027, 1967, 9849, 13741, 13699, 13011, 14743, 17978, 17965, 10790,
-    -2297, -15227, -21721, -20308, -15080, -11123, -9738, -8714, -5844, -974,
-    4015, 6116, 3456, -2152, -5871, -3988, 2738, 9908, 13502, 13327,
-    12667, 14492, 18083, 19243, 13826, 1876, -11181, -18478, -17792, -13305,
-    -10966, -12663, -14900, -12521, -4010, 6218, 11231, 7940, -39, -5921,
-    -5655, -467, 5310, 8146, 7613, 6214, 7356, 12281, 17810, 17913,
-    9180, -5083, -17103, -21301, -18541, -14130, -12279, -12673, -11845, -7112,
-    728, 7716, 9606, 5483, -961, -4391, -2467, 2652, 7086, 8791,
-    8660, 9048, 11394, 14548, 15064, 9888, -286, -10626, -16199, -16417,
-    -14638, -13788, -13713, -12458, -8624, -2573, 3388, 6171, 4474, 344,
-    -2402, -1383, 2696, 6997, 8926, 8227, 7313, 9147, 13820, 17101,
-    13746, 3146, -9228, -16897, -17987, -15334, -12651, -11689, -11681, -10132,
-    -5060, 2286, 7521, 7005, 1645, -3695, -4636, -823, 4728, 8904,
-    10656, 10955, 11701, 14034, 16551, 15683, 9052, -1658, -11799, -17442,
-    -17808, -14926, -11736, -10003, -9168, -7103, -2544, 2947, 5902, 4309,
-    -129, -3503, -3146, 693, 5810, 9780, 11373, 11412, 12119, 14677,
-    17302, 16353, 9689, -1048, -11410, -17360, -17944, -15323, -12553, -11259,
-    -10857, -9414, -5414, 531, 5405, 5898, 1648, -3670, -5218, -1328,
-    5199, 10091, 11415, 10504, 10024, 11630, 14633, 15986, 12182, 2524,
-    -9230, -17359, -18832, -15411, -11347, -9527, -9760, -9844, -7689, -2888,
-    2749, 6084, 4993, 610, -3063, -2493, 2316, 8192, 11875, 12455,
-    11373, 10919, 12455, 14922, 14782, 8715, -2544, -13593, -18761, -17157,
-    -12742, -9830, -9504, -10028, -9138, -5593, -26, 4779, 5527, 1612,
-    -3576, -5423, -2178, 3929, 9041, 10658, 9225, 7853, 9777, 14579,
-    17176, 12285, 439, -11710, -17710, -16977, -13773, -11948, -11907, -11762,
-    -9665, -5024, 1046, 5850, 6669, 3134, -2049, -5060, -3757, 1040,
-    6414, 9553, 9961, 9878, 12001, 16228, 18893, 15809, 6308, -5786,
-    -15118, -18717, -17484, -14561, -12535, -11748, -10606, -7270, -1498, 4579,
-    7577, 5521, -49, -4906, -5566, -2015, 2954, 6633, 8375, 9390,
-    11328, 14693, 17707, 16894, 10014, -1084, -11306, -16529, -16649, -14443,
-    -12425, -11272, -10200, -7743, -2856, 3368, 7361, 5975, 191, -5122,
-    -5780, -1987, 2781, 5688, 6646, 7396, 9608, 13543, 17390, 17743,
-    11988, 1188, -9704, -15420, -14610, -10565, -7864, -8372, -10126, -9558,
-    -4858, 2099, 6759, 5459, -1041, -7511, -8491, -3115, 4347, 8756,
-    8657, 6807, 7006, 10641, 15447, 16891, 11549, 477, -10651, -15892,
-    -14119, -9501, -6886, -7383, -8512, -7572, -4109, 142, 2629, 1584,
-    -2562, -6975, -8229, -4928, 1269, 7087, 10086, 10288, 9949, 11420,
-    14468, 15731, 11644, 2315, -7895, -13994, -14376, -11327, -8248, -6828,
-    -6437, -5393, -2609, 1440, 4868, 5537, 2624, -2399, -6262, -5927,
-    -949, 5879, 10607, 11367, 9840, 9498, 12177, 15992, 16515, 10478,
-    -948, -12421, -18438, -17573, -12987, -9108, -8092, -8972, -9089, -6113,
-    121, 6686, 9029, 4795, -3365, -9436, -9023, -2803, 4675, 9081,
-    9383, 7931, 8170, 11739, 16811, 18977, 14445, 3356, -9631, -18382,
-    -19760, -15714, -11033, -8950, -8902, -8183, -5007, 264, 5853, 9435,
-    8818, 3414, -4238, -9328, -8273, -1666, 6292, 11178, 11498, 9474,
-    9097, 12501, 17236, 17510, 9338, -5039, -18270, -23790, -20797, -13914,
-    -8670, -7280, -7858, -6860, -2391, 4106, 8859, 8573, 2974, -4728,
-    -9851, -9376, -3914, 3113, 8306, 10584, 11204, 12110, 14235, 16567,
-    16317, 10710, -195, -12287, -19906, -20268, -15452, -10081, -7329, -6946,
-    -6346, -3275, 1967, 6395, 6712, 2368, -3728, -7641, -7314, -3282,
-    2481, 7712, 10657, 11190, 11317, 13389, 17032, 18416, 13545, 2557,
-    -9564, -16823, -16978, -12876, -9409, -9118, -10469, -10025, -6076, -238,
-    4071, 4415, 959, -3884, -7074, -6668, -2772, 2708, 7310, 9502,
-    9645, 9760, 11893, 15907, 18668, 16081, 6777, -5897, -15871, -18883,
-    -15646, -10871, -9102, -10976, -13088, -11389, -5028, 2706, 7004, 5368,
-    -418, -5663, -6323, -1948, 4380, 8908, 10182, 9595, 9666, 11997,
-    16177, 19650, 18814, 11599, -85, -10956, -16347, -15849, -12900, -11089,
-    -11263, -11788, -10651, -7072, -1836, 3167, 5814, 4833, 780, -3754,
-    -5318, -2004, 4576, 10082, 11161, 8748, 7233, 9957, 15562, 18829,
-    15105, 4318, -8693, -17713, -19762, -16963, -14003, -13662, -14800, -14273,
-    -10173, -3225, 3951, 8345, 8094, 3799, -1452, -4071, -2510, 1901,
-    6373, 8780, 9019, 9003, 11151, 15903, 20315, 19713, 11606, -1665,
-    -14209, -20797, -20491, -16786, -14240, -14439, -14883, -11825, -4256, 4838,
-    10846, 10924, 5672, -1468, -6224, -5966, -1348, 4304, 7698, 8087,
-    7514, 8880, 13424, 19120, 21212, 15458, 2282, -12268, -20852, -20889,
-    -16231, -12768, -12840, -13972, -12255, -6257, 1933, 8469, 10325, 7108,
-    1288, -3307, -3961, -746, 3936, 7474, 8865, 8893, 9073, 10554,
-    13380, 15995, 15546, 9755, -606, -11284, -17465, -17615, -14377, -11662,
-    -11103, -11309, -9969, -6168, -870, 4113, 7201, 7508, 5101, 1299,
-    -1560, -1411, 1934, 6428, 9334, 9408, 7822, 7118, 9028, 12715,
-    14856, 11970, 3459, -7374, -15646, -18504, -16778, -13600, -11810, -12159,
-    -12960, -11287, -5469, 2790, 9137, 10148, 6302, 1237, -1648, -1497,
-    534, 2994, 5014, 6286, 6974, 7721, 9309, 11905, 14372, 14369,
-    9744, 594, -9895, -17274, -19124, -16716, -13403, -11482, -10583, -8700,
-    -4434, 1668, 7492, 10771, 10300, 6342, 537, -4417, -5799, -2698,
-    2866, 7337, 8731, 8275, 8778, 11598, 15299, 16748, 13232, 4238,
-    -7722, -18014, -22635, -20945, -15815, -11038, -8595, -7952, -7126, -4262,
-    946, 6491, 8945, 6105, -706, -7132, -8913, -4952, 2244, 8724,
-    11852, 11697, 10423, 10417, 12458, 14961, 14775, 9339, -1011, -12464,
-    -19896, -20438, -15454, -9287, -5980, -6610, -8873, -8910, -4315, 3542,
-    9936, 10279, 4057, -4414, -9221, -7190, 176, 8164, 12182, 10781,
-    6677, 4874, 8597, 15929, 20509, 16561, 4154, -10323, -19231, -19653,
-    -14912, -10792, -10500, -12739, -13687, -10505, -3562, 3902, 8159, 7574,
-    3462, -1227, -3968, -3754, -1013, 2914, 6426, 8559, 9638, 10868,
-    13040, 15602, 16867, 14945, 8788, -861, -11136, -18207, -19754, -16737,
-    -12541, -10108, -9691, -9206, -6535, -1516, 3974, 7526, 7728, 4706,
-    -100, -4314, -5323, -1781, 4926, 11102, 13500, 12131, 10180, 10867,
-    14147, 16353, 13212, 3708, -8539, -17781, -20537, -17974, -14146, -12079,
-    -11653, -10878, -8385, -4376, 141, 4116, 6392, 5812, 2264, -2313,
-    -4633, -2449, 3422, 9580, 12725, 12166, 9969, 8938, 10296, 12714,
-    13111, 8752, -483, -11347, -19052, -20618, -16916, -11654, -8415, -8313,
-    -9667, -9372, -5119, 2553, 9903, 12346, 8243, 741, -4405, -3348,
-    2967, 9869, 12786, 10673, 6584, 5121, 8583, 14665, 17735, 13162,
-    1376, -11921, -19938, -19939, -14882, -10328, -9661, -11818, -12913, -9740,
-    -2254, 6367, 11713, 10939, 4757, -2768, -6770, -4811, 1481, 7632,
-    9660, 7251, 4193, 5161, 11089, 17400, 17424, 8374, -5727, -17151,
-    -20695, -17323, -12315, -10240, -11408, -12382, -9434, -1853, 7300, 13263,
-    12854, 6709, -1039, -5491, -4229, 1172, 6511, 8250, 6342, 4327,
-    6237, 12535, 18757, 18746, 10064, -3507, -14961, -19669, -18299, -14935,
-    -13107, -13377, -13626, -10974, -4112, 5067, 11997, 12549, 6539, -1722,
-    -6681, -5669, -357, 5176, 7668, 6783, 5082, 5974, 10763, 16848,
-    19016, 13440, 1212, -11939, -19736, -19770, -14656, -9440, -7702, -9200,
-    -10390, -7359, 654, 9840, 14168, 10187, 302, -8646, -10528, -4466,
-    4876, 11174, 11226, 7117, 4289, 6936, 14122, 19875, 17704, 6187,
-    -9169, -19800, -20664, -13922, -6582, -4393, -7392, -10638, -8921, -1247,
-    8302, 13591, 10949, 1988, -7320, -10829, -6626, 1755, 8332, 9410,
-    6271, 3749, 5919, 12317, 17812, 16572, 7087, -6095, -15789, -17887,
-    -14192, -9916, -8615, -9515, -9256, -5620, 513, 6193, 8710, 7127,
-    2444, -3024, -6636, -6605, -2987, 2252, 6491, 8338, 8707, 9878,
-    13017, 16346, 16116, 9946, -566, -10732, -16403, -16800, -14097, -10850,
-    -8169, -5834, -3275, -143, 3425, 6460, 7237, 4465, -1128, -6548,
-    -8358, -5206, 1131, 7078, 9907, 9727, 9179, 10840, 14289, 15687,
-    10924, -198, -12895, -20903, -21409, -16747, -11640, -9095, -8677, -7916,
-    -4848, 337, 5273, 6905, 3819, -2164, -6874, -6931, -2428, 3485,
-    7630, 9286, 9925, 11110, 13009, 14509, 14065, 10412, 3273, -5905,
-    -14069, -18196, -17412, -13583, -9691, -7532, -6767, -5816, -3486, 2,
-    3094, 3922, 1719, -2290, -5359, -4995, -758, 5369, 10380, 12342,
-    11647, 10511, 10996, 12967, 13712, 9969, 971, -10173, -18358, -20240,
-    -16658, -11588, -8699, -8551, -8696, -6293, -904, 4853, 7318, 4875,
-    -478, -4525, -4106, 498, 6134, 9610, 10213, 9824, 10836, 13773,
-    16523, 15761, 9581, -651, -10818, -16822, -17433, -14755, -11948, -10447,
-    -9216, -6404, -1498, 4005, 7659, 7740, 4400, -248, -3203, -2409,
-    1735, 6603, 9448, 9751, 9541, 11182, 14605, 16705, 13737, 4743,
-    -7053, -16274, -19246, -16506, -11922, -9304, -9421, -9797, -7235, -927,
-    6354, 9986, 7102, -618, -7517, -8076, -1497, 7436, 12503, 11603,
-    8401, 8335, 12892, 17809, 16897, 7744, -5944, -17180, -20954, -17544,
-    -11564, -7903, -7944, -9021, -7379, -1926, 4585, 7896, 5866, 174,
-    -5047, -6155, -2240, 4557, 10562, 13064, 12258, 10972, 11884, 14458,
-    14837, 9370, -1414, -12505, -18347, -17269, -12292, -7968, -6602, -7119,
-    -6893, -4366, -327, 2757, 2646, -824, -5222, -6974, -4007, 2490,
-    8866, 11942, 11545, 10280, 10681, 12418, 12319, 7336, -2252, -12421,
-    -18300, -17867, -13253, -8626, -6671, -6737, -6069, -2812, 1984, 5129,
-    4135, -370, -4866, -5652, -1745, 4525, 9629, 11673, 11549, 11604,
-    13173, 15091, 14406, 8792, -1138, -11593, -17985, -18298, -14567, -10956,
-    -10009, -10538, -9174, -4050, 2933, 7426, 6309, 479, -5599, -7233,
-    -3078, 3895, 8967, 9720, 8042, 8075, 11886, 16988, 18252, 12466,
-    1252, -10202, -17130, -18249, -15744, -12853, -11339, -10570, -8519, -3810,
-    2678, 7983, 9089, 5339, -790, -5307, -5446, -1416, 4085, 8076,
-    9496, 9733, 11021, 13965, 16439, 15092, 8344, -1912, -11539, -17145,
-    -18086, -16005, -12956, -10049, -7372, -4522, -1112, 2721, 5868, 6552,
-    3750, -1319, -5406, -5509, -1335, 4475, 8703, 10255, 10662, 12006,
-    14365, 15275, 11766, 3189, -7705, -16438, -19901, -18334, -14619, -11618,
-    -9914, -7851, -3677, 2241, 7181, 8101, 4272, -1787, -5991, -5711,
-    -1635, 3147, 6033, 7114, 8665, 12379, 17040, 18981, 15083, 5628,
-    -5562, -13823, -16814, -15587, -13007, -11195, -10151, -8355, -4505, 1087,
-    6367, 8721, 6783, 1704, -3172, -4427, -1087, 4577, 8977, 10326,
-    10030, 10850, 13562, 15534, 12909, 4430, -6794, -15431, -18074, -15649,
-    -12012, -10237, -10048, -8668, -4082, 2443, 7027, 6497, 1380, -4231,
-    -5937, -2569, 3106, 7112, 7894, 7519, 9299, 14039, 18466, 17566,
-    9033, -4103, -15256, -19239, -16207, -11071, -8855, -10194, -11122, -7315,
-    1218, 9494, 11638, 6064, -2910, -8435, -6546, 946, 8401, 11297,
-    9875, 8363, 10524, 15585, 18408, 13959, 2110, -11697, -20602, -21549,
-    -17004, -11995, -9618, -9047, -7345, -2851, 3018, 6914, 6390, 2013,
-    -2929, -4870, -2579, 2168, 6433, 8722, 9938, 11798, 14391, 15429,
-    12088, 3809, -6565, -14491, -16980, -14738, -11320, -9872, -10262, -9376,
-    -4577, 2886, 8200, 7241, 819, -5502, -6217, -786, 6104, 9168,
-    7496, 5121, 6775, 12902, 18615, 17684, 8148, -5418, -15222, -16530,
-    -11437, -6606, -6904, -10883, -12467, -7307, 2410, 9494, 8286, 3,
-    -8182, -9438, -3100, 5223, 9136, 7298, 4231, 5478, 11798, 17963,
-    17333, 7974, -5366, -15137, -17032, -12847, -8027, -6600, -8053, -8514,
-    -4783, 2380, 8440, 8634, 2124, -6753, -11498, -8560, -224, 7435,
-    9906, 8011, 6582, 9288, 14622, 16957, 11732, -76, -12313, -18466,
-    -16675, -10620, -5811, -4764, -5368, -3675, 1705, 7829, 9970, 6077,
-    -1121, -6317, -6016, -1109, 4469, 7409, 7577, 7441, 9249, 12596,
-    14428, 11503, 3326, -6896, -14316, -16040, -13234, -9765, -8547, -8999,
-    -8043, -3587, 2950, 7539, 6978, 1725, -4307, -6737, -4023, 1505,
-    5721, 6239, 4466, 4171, 7596, 12674, 14319, 8989, -1672, -11753,
-    -15906, -13669, -9309, -7514, -9078, -10509, -7776, -569, 6918, 9484,
-    5562, -1229, -5145, -3215, 2476, 7146, 7891, 6077, 5460, 8097,
-    12081, 13141, 8489, -610, -9718, -14696, -14752, -12544, -11351, -11944,
-    -12046, -8901, -2465, 3992, 6580, 4228, -346, -3000, -1558, 2747,
-    6772, 8271, 7616, 7123, 8662, 11553, 12629, 8765, -35, -9860,
-    -15601, -15114, -10963, -7877, -8195, -9755, -8384, -2497, 4832, 8458,
-    5921, -142, -4173, -2408, 4044, 10384, 12459, 10381, 8129, 9317,
-    13069, 14243, 8310, -3657, -15104, -19552, -16248, -10263, -7132, -7709,
-    -8307, -5323, 831, 6263, 7402, 4138, -247, -1771, 1233, 6867,
-    11195, 11655, 9486, 8430, 10386, 12535, 9720, 223, -11405, -18118,
-    -17041, -11846, -8430, -8870, -10106, -8068, -2243, 3889, 6283, 3908,
-    -441, -2347, 740, 7223, 12395, 12596, 8944, 6419, 8428, 12424,
-    11935, 3480, -9075, -17808, -18250, -13125, -8734, -8452, -10196, -9607,
-    -4811, 1926, 6432, 6164, 2234, -1347, -749, 4412, 10495, 13071,
-    11269, 8636, 9118, 12282, 13251, 7794, -2897, -12972, -17331, -15855,
-    -12420, -10469, -10070, -8900, -5287, -27, 4307, 5445, 3122, -591,
-    -2602, -1039, 3205, 7212, 8733, 8286, 8290, 9920, 11141, 8400,
-    493, -9526, -16611, -17972, -15076, -11594, -9708, -8498, -5657, -410,
-    5317, 8403, 7168, 2925, -801, -860, 3046, 8064, 10653, 9845,
-    8087, 8433, 10728, 11068, 5655, -4751, -14752, -19029, -17033, -12782,
-    -10312, -9856, -8573, -4406, 1404, 5520, 5695, 2724, -296, -406,
-    3028, 7853, 10887, 10736, 9132, 8979, 10691, 10909, 5786, -4297,
-    -14072, -18096, -15936, -12024, -10465, -10795, -9301, -3934, 2962, 6888,
-    5517, 701, -3269, -2998, 1745, 8087, 12232, 12491, 10756, 10596,
-    13159, 15070, 11297, 616, -12155, -20029, -20013, -15201, -10932, -9522,
-    -8965, -6168, -648, 4916, 7133, 4696, -545, -4656, -4135, 1510,
-    9093, 14093, 14486, 12415, 11652, 13184, 13659, 8696, -2203, -14331,
-    -21495, -21122, -15860, -10575, -8041, -7281, -5520, -1438, 3300, 5425,
-    3089, -2036, -5571, -3832, 2895, 10386, 14185, 13658, 12190, 13051,
-    15235, 14017, 6024, -6527, -17192, -21008, -18590, -14565, -12467, -11708,
-    -9343, -4069, 1986, 5184, 3734, -646, -4004, -3202, 1618, 7249,
-    10433, 11094, 12240, 16045, 20208, 19299, 10493, -2532, -12433, -15136,
-    -13232, -12161, -13771, -14661, -10772, -2602, 4760, 6422, 2107, -3808,
-    -6116, -2899, 3225, 7651, 8152, 7167, 9228, 15401, 20690, 18232,
-    6642, -7569, -15827, -15587, -11910, -11078, -13734, -14990, -10646, -2182,
-    4555, 4937, -381, -6243, -7356, -2487, 4786, 9447, 9798, 9013,
-    11370, 16722, 19554, 14486, 2518, -9189, -14116, -12285, -8997, -8460,
-    -9759, -9052, -4601, 1119, 3880, 1632, -3706, -7719, -6863, -1310,
-    5167, 8651, 8897, 9278, 12311, 15742, 14291, 5723, -5790, -13343,
-    -14015, -11012, -9187, -9578, -9109, -5032, 1426, 5982, 5260, -194,
-    -6184, -7967, -3959, 2826, 7367, 7527, 6344, 8470, 14045, 17233,
-    12092, -373, -12276, -16459, -13237, -8942, -8451, -10330, -9437, -3261,
-    5027, 9478, 6835, -469, -6184, -5388, 1248, 8044, 9822, 7261,
-    6108, 10313, 16494, 16646, 6864, -7624, -17154, -17067, -11576, -8245,
-    -9767, -11927, -9118, -793, 7710, 10198, 5311, -2196, -5534, -1750,
-    5792, 10837, 10518, 8071, 8696, 12885, 14969, 9191, -3306, -14751,
-    -18304, -14564, -9968, -9360, -11213, -10303, -4155, 3897, 7876, 4919,
-    -1946, -6317, -3850, 4071, 11689, 14214, 12228, 10565, 12473, 15298,
-    12879, 2550, -10988, -19593, -19364, -13790, -9256, -8329, -8136, -4836,
-    1433, 6472, 6299, 1118, -4704, -6178, -1606, 6226, 12517, 14646,
-    14292, 15043, 17584, 17859, 11052, -2428, -15887, -22092, -19872, -14378,
-    -11051, -10312, -8565, -3472, 2898, 6149, 3934, -1932, -7049, -7740,
-    -3519, 2849, 7815, 10228, 12114, 15612, 19113, 17638, 8146, -5946,
-    -16879, -19666, -16397, -12981, -12421, -12318, -8753, -1368, 5917, 8544,
-    5146, -1536, -6669, -6608, -1466, 5092, 9254, 10727, 12446, 16148,
-    19030, 16142, 6200, -6204, -14879, -17708, -17234, -16314, -14776, -10794,
-    -4343, 1859, 4633, 2939, -1491, -5364, -5884, -2706, 1751, 4710,
-    6254, 9322, 15473, 21257, 20562, 11255, -1668, -10711, -13165, -12633,
-    -13499, -15453, -14420, -8090, 738, 6441, 5612, -87, -5428, -5907,
-    -1432, 3759, 5397, 3905, 4198, 9807, 17557, 19652, 11864, -1270,
-    -10613, -11545, -7839, -6331, -9010, -11455, -8649, -1097, 5388, 5562,
-    -9, -5479, -5353, 297, 6226, 7731, 5779, 5713, 10551, 16423,
-    15948, 6403, -6505, -13879, -12333, -6746, -4395, -7195, -10248, -7746,
-    347, 7722, 7793, 412, -7517, -8487, -1637, 6670, 9786, 7720,
-    6280, 9438, 14001, 13038, 4022, -7898, -15117, -14954, -11108, -8571,
-    -8424, -7821, -4085, 1936, 6361, 5822, 821, -4187, -4514, 394,
-    6473, 9430, 9291, 9618, 12162, 13743, 9711, -39, -10082, -14907,
-    -14204, -11900, -10812, -9746, -6022, 343, 5915, 7079, 3491, -1526,
-    -3737, -1395, 3510, 7368, 8573, 8926, 10915, 13805, 13535, 7209,
-    -2990, -11472, -14818, -14663, -14632, -15449, -14267, -8771, -847, 4535,
-    3944, -1179, -5650, -4996, 700, 7073, 9852, 9218, 9333, 12998,
-    17331, 16074, 6674, -6010, -14140, -14661, -11538, -10260, -11506, -11242,
-    -6411, 842, 5031, 2827, -3567, -8225, -6587, 651, 8328, 11817,
-    11559, 12135, 16251, 20292, 17358, 5204, -9978, -18956, -18338, -13022,
-    -9840, -10160, -9713, -4922, 2145, 5686, 2350, -5027, -9800, -7486,
-    349, 7910, 10981, 10912, 12384, 17040, 20280, 15631, 2417, -12125,
-    -19307, -17151, -11326, -8263, -8545, -7663, -2426, 4644, 7617, 3356,
-    -4906, -10187, -8012, -306, 6942, 9940, 10644, 13453, 18634, 20492,
-    13313, -1342, -14822, -19513, -15967, -11141, -10212, -11419, -9232, -1486,
-    7579, 11247, 6781, -1864, -7409, -5519, 1641, 7937, 9531, 8467,
-    9479, 13462, 15475, 10207, -1287, -11854, -15536, -13365, -11076, -11971,
-    -13539, -11230, -4245, 3279, 6390, 3917, -716, -2626, 454, 6459,
-    11029, 11651, 9872, 8997, 9645, 8579, 2724, -6341, -13281, -14577,
-    -12069, -10167, -10436, -10272, -6881, -1230, 2720, 2204, -1626, -4840,
-    -4040, 1125, 7821, 12226, 12686, 11207, 11330, 13946, 15589, 11730,
-    1861, -9334, -16143, -16681, -13490, -10168, -8302, -7307, -5983, -3655,
-    -561, 2043, 2479, 268, -2674, -3229, 0, 5233, 9348, 10956,
-    11227, 11835, 12717, 12045, 8063, 773, -7754, -14401, -16815, -15083,
-    -11802, -9888, -9785, -9070, -5288, 856, 5605, 5667, 1499, -3020,
-    -4018, -722, 4383, 8003, 8732, 7916, 8163, 10725, 13917, 14141,
-    8912, -699, -10557, -16499, -17201, -14480, -11160, -8730, -6711, -3857,
-    191, 4218, 6183, 4798, 695, -3754, -5906, -4494, -268, 4766,
-    8821, 11317, 12706, 13390, 12773, 9486, 2783, -6102, -14124, -18297,
-    -17769, -14224, -10247, -7162, -4344, -559, 4019, 7182, 6355, 1256,
-    -5004, -7911, -5248, 923, 6192, 7984, 7830, 9256, 13422, 17150,
-    15573, 6889, -5453, -15230, -18233, -15155, -10300, -7563, -7271, -6529,
-    -2611, 3789, 8645, 8130, 2320, -4576, -7744, -5612, -499, 4098,
-    6609, 8049, 10220, 13518, 16218, 15558, 9814, 34, -9984, -15952,
-    -16144, -12597, -9080, -7556, -6650, -3682, 1893, 7283, 8609, 4435,
-    -2656, -7850, -7702, -2663, 3515, 7066, 7465, 7614, 10489, 15409,
-    17927, 13805, 3246, -8842, -16768, -18273, -15316, -11462, -8855, -7175,
-    -4713, -316, 5155, 8943, 8314, 3083, -3554, -7135, -5415, 25,
-    5516, 8532, 9382, 10161, 12317, 14931, 15027, 9830, -456, -11724,
-    -18418, -17914, -12764, -8154, -6821, -6722, -3953, 2406, 8863, 10843,
-    7061, 566, -4046, -4221, -825, 3224, 5572, 6244, 7208, 9926,
-    13178, 13591, 8707, -424, -9889, -16107, -18205, -17516, -15542, -12834,
-    -9330, -5057, -409, 3782, 6242, 5851, 2918, -321, -1233, 912,
-    4388, 6866, 7689, 8206, 9915, 12440, 13429, 10405, 2945, -6415,
-    -13534, -15715, -13883, -11454, -10839, -11115, -9312, -4068, 2323, 5912,
-    4887, 1034, -2122, -2150, 794, 4570, 7016, 7591, 7492, 8360,
-    10473, 11982, 10406, 5085, -2182, -8764, -12925, -14314, -13532, -11563,
-    -9426, -7751, -6164, -3618, -11, 2977, 3455, 1496, -754, -1086,
-    866, 3703, 6015, 7605, 9033, 10659, 12280, 13041, 11607, 7115,
-    331, -6345, -10473, -11442, -10635, -9624, -8603, -6832, -3979, -598,
-    2300, 3732, 2991, 86, -3562, -5351, -3477, 1131, 5567, 7766,
-    8280, 9315, 12139, 15433, 16254, 12549, 4767, -4299, -10960, -12926,
-    -11008, -8261, -7186, -7734, -7751, -5324, -943, 2790, 3514, 831,
-    -3687, -7336, -7647, -4035, 1693, 6642, 8986, 9474, 10667, 13958,
-    17442, 17237, 10886, -172, -10991, -16503, -15450, -11065, -7936, -8128,
-    -9619, -8389, -2739, 4468, 8228, 5761, -1208, -7607, -8834, -4435,
-    1987, 6395, 7593, 7708, 9934, 14993, 19666, 19473, 12589, 1172,
-    -9997, -16341, -16516, -13108, -10046, -9358, -9794, -8024, -2139, 5470,
-    9728, 7633, 873, -5733, -7900, -4866, 486, 4488, 5635, 5294,
-    6332, 10422, 15651, 17287, 11907, 849, -10559, -17184, -17788, -15059,
-    -12454, -11324, -10537, -7939, -2325, 5104, 10906, 11569, 6563, -443,
-    -4295, -2962, 1034, 3839, 4084, 3644, 5337, 9883, 14951, 17057,
-    13901, 5506, -5268, -13718, -16667, -14938, -11885, -10071, -9431, -7855,
-    -3729, 1957, 6564, 8104, 5932, 877, -4239, -5976, -3208, 1933,
-    5996, 7114, 6735, 7952, 11475, 14384, 13214, 7019, -2160, -10507,
-    -14759, -14363, -11298, -8249, -6905, -6742, -5500, -2003, 2150, 4322,
-    3222, -313, -3782, -4686, -2337, 2246, 7332, 10847, 11637, 10949,
-    11033, 12307, 12831, 9884, 2301, -7373, -14099, -14974, -11535, -7520,
-    -5923, -7125, -8474, -7062, -3180, 345, 1220, -882, -4015, -4805,
-    -1599, 3806, 8627, 11590, 12861, 13469, 14258, 14293, 11779, 6591,
-    89, -6504, -11908, -14690, -14537, -12447, -9847, -8089, -7415, -6383,
-    -3990, -1570, -1063, -2507, -4116, -3782, -595, 4237, 8392, 10584,
-    11231, 11613, 12846, 14609, 14562, 10273, 2056, -6733, -12408, -13862,
-    -12876, -11705, -10892, -9664, -7548, -4795, -1774, 1210, 3376, 3385,
-    762, -2660, -3877, -1511, 3225, 7999, 11064, 12146, 12308, 12752,
-    13662, 13939, 11512, 4825, -4798, -13207, -16982, -16146, -13118, -10163,
-    -7987, -5986, -3620, -1146, 1134, 3020, 3431, 1110, -3103, -6148,
-    -5330, -590, 5377, 9176, 9522, 8044, 7350, 8818, 11555, 12456,
-    8279, -913, -10800, -16050, -14647, -9409, -5364, -5192, -7245, -7968,
-    -5317, 43, 5403, 7655, 5519, 661, -3405, -3686, 68, 4982,
-    7560, 6810, 4533, 3357, 4968, 8908, 12312, 11751, 5927, -3225,
-    -11501, -15060, -13461, -9878, -7767, -8011, -9049, -8335, -4162, 2404,
-    7735, 8510, 4301, -1976, -5691, -4028, 1304, 5863, 6785, 4614,
-    2221, 2754, 7030, 12194, 13878, 9729, 952, -8317, -13496, -13119,
-    -9754, -6924, -6252, -7281, -8041, -6131, -990, 5053, 8432, 6774,
-    875, -4892, -5771, -1103, 5402, 9428, 9171, 6258, 4586, 6848,
-    11637, 14641, 12227, 4140, -5818, -12298, -13095, -10678, -8687, -8505,
-    -9106, -8471, -5374, -682, 3484, 5490, 4523, 882, -3207, -4833,
-    -2973, 1186, 5640, 8491, 9046, 8631, 9210, 11316, 13595, 13318,
-    7972, -1782, -11457, -16519, -15982, -12181, -8533, -7193, -7430, -6694,
-    -3543, 1238, 5492, 6655, 3515, -1928, -5744, -5457, -1379, 4314,
-    8884, 10792, 10842, 10894, 11895, 13360, 13435, 9696, 1661, -7757,
-    -14484, -16385, -14106, -10251, -7603, -6895, -6476, -4372, -104, 4873,
-    7627, 5877, 659, -4108, -5048, -1781, 3295, 6935, 7586, 6556,
-    6398, 8453, 11799, 13599, 10868, 3200, -6333, -13603, -16473, -15724,
-    -13796, -12542, -11875, -10538, -7560, -2822, 2610, 6427, 6544, 3070,
-    -1508, -3971, -2606, 1405, 5155, 6811, 6804, 6875, 8732, 12522,
-    15670, 14417, 7248, -3438, -12721, -16480, -14671, -11219, -9870, -10839,
-    -11651, -9686, -4057, 3330, 8631, 8899, 4214, -2331, -6240, -4662,
-    1045, 6568, 8544, 6862, 4152, 3794, 7315, 12752, 15731, 12543,
-    3037, -8628, -16617, -17811, -13957, -9648, -8276, -9548, -10502, -8504,
-    -3142, 3705, 8760, 9329, 5430, -330, -4583, -4870, -1193, 3697,
-    6882, 7695, 7168, 7042, 9189, 13392, 16319, 14588, 7570, -2746,
-    -12289, -16789, -15621, -11935, -8619, -6804, -6609, -6359, -3646, 1308,
-    6002, 8309, 6644, 875, -5512, -7977, -5429, 227, 6171, 9249,
-    8642, 7598, 9336, 13424, 17269, 17625, 11767, 905, -9733, -15936,
-    -16947, -14202, -10822, -9763, -10580, -10564, -8249, -3603, 2327, 6605,
-    6482, 2316, -3237, -7000, -6301, -1356, 4272, 7496, 8096, 7577,
-    8142, 11261, 15426, 17185, 14338, 6799, -3337, -11827, -15388, -14584,
-    -12057, -10051, -9903, -10816, -9925, -5619, 942, 7313, 10293, 7422,
-    467, -5382, -6510, -2797, 3325, 7817, 8093, 5908, 4897, 6903,
-    11708, 16857, 17753, 11600, 562, -10508, -17317, -17766, -13579, -9349,
-    -8189, -9638, -11213, -9907, -4062, 4143, 9666, 8907, 2390, -5718,
-    -10108, -7984, -1100, 6026, 9604, 8856, 6235, 5456, 8572, 14178,
-    17897, 15420, 6259, -5694, -15171, -18565, -15748, -10341, -6739, -6389,
-    -7754, -8179, -5166, 1259, 7339, 9126, 5981, -205, -6130, -7916,
-    -4398, 1697, 7185, 10290, 10242, 8655, 8876, 11625, 14285, 14115,
-    9220, -654, -11915, -19336, -20753, -17144, -11055, -6460, -5858, -7271,
-    -7040, -3497, 2908, 9225, 10709, 5539, -2936, -9530, -10201, -3877,
-    5566, 11901, 12415, 9121, 6093, 7142, 12500, 17240, 15828, 7039,
-    -6042, -17606, -21968, -18399, -11516, -6271, -4981, -6983, -8353, -5177,
-    1848, 8580, 11228, 7732, -399, -7572, -9110, -5132, 1508, 7277,
-    9143, 7741, 6962, 8922, 12574, 15662, 14975, 8440, -1487, -10108,
-    -14843, -15184, -12349, -9642, -9111, -9308, -8277, -5323, -381, 4568,
-    6092, 3417, -1226, -5395, -6756, -4133, 356, 3742, 5415, 5847,
-    5946, 7727, 11510, 14593, 14738, 11346, 4370, -3969, -9845, -12096,
-    -11865, -9960, -8124, -8251, -9007, -8114, -5657, -1963, 2518, 4972,
-    3633, 486, -2582, -4647, -3525, 981, 5562, 8481, 10182, 10158,
-    9360, 10630, 13414, 14717, 13789, 10106, 2689, -5684, -11047, -13272,
-    -13045, -10291, -7688, -7703, -8488, -8323, -7573, -5007, -394, 2630,
-    2157, -252, -3955, -7480, -6955, -2074, 3589, 8469, 11728, 11515,
-    9620, 9853, 11742, 13142, 13479, 10427, 2226, -7336, -13847, -16603,
-    -15074, -10005, -6218, -6409, -8015, -9005, -8421, -4155, 2274, 5592,
-    4278, 354, -4815, -8079, -5681, 566, 6266, 10166, 11566, 10018,
-    8911, 10980, 13841, 14918, 13417, 7538, -2096, -10592, -15175, -16556,
-    -14967, -12065, -11376, -12619, -12636, -10708, -6857, -812, 4394, 5330,
-    2992, -566, -4349, -5651, -2872, 1388, 5040, 8212, 9865, 9964,
-    11283, 14286, 16516, 16977, 14663, 7611, -2362, -10831, -16213, -18230,
-    -16406, -13397, -12463, -12531, -11470, -8927, -3794, 3682, 9120, 9318,
-    5383, -831, -6547, -7373, -2637, 3724, 8852, 11628, 11297, 10195,
-    11990, 16106, 19254, 19154, 13712, 2794, -9013, -16803, -19463, -17685,
-    -13658, -11338, -11891, -12485, -10952, -6756, -73, 6046, 7560, 4445,
-    -699, -5609, -7229, -3792, 2032, 7051, 10668, 12215, 11771, 12107,
-    14178, 15512, 14965, 12336, 6023, -2932, -10424, -15033, -17198, -15946,
-    -12573, -10668, -10133, -8878, -7333, -5150, -724, 3657, 4646, 3193,
-    803, -2373, -3501, -27, 5439, 9868, 13066, 13945, 12094, 11045,
-    12850, 14892, 14987, 12326, 5265, -4965, -13273, -16969, -17074, -14644,
-    -11627, -11003, -12401, -12573, -10131, -5507, 413, 4873, 4875, 936,
-    -3879, -6837, -6016, -1252, 4891, 9285, 10750, 10105, 9368, 10501,
-    13685, 16997, 17463, 12650, 2839, -8530, -17323, -20753, -18295, -12846,
-    -9051, -8845, -10645, -11901, -9887, -3243, 4955, 9414, 7961, 1753,
-    -6322, -11115, -8539, -546, 7584, 12541, 12941, 9688, 7559, 10392,
-    15962, 19656, 18729, 11566, -622, -12007, -17736, -18285, -15852, -12332,
-    -10722, -12005, -12895, -10919, -7161, -2745, 1465, 3129, 1694, -151,
-    -1122, -2200, -2787, -1556, 979, 4604, 9877, 14799, 16339, 14921,
-    12858, 11062, 10234, 10676, 9683, 4164, -4764, -13525, -19403, -20059,
-    -14862, -7807, -4231, -5253, -8555, -11159, -9518, -2156, 6753, 11095,
-    8956, 2263, -5497, -9219, -5491, 3008, 10691, 14648, 14231, 10199,
-    6481, 7111, 11083, 14604, 15391, 11639, 2528, -8276, -15505, -17903,
-    -16597, -12482, -8524, -8180, -10244, -11173, -10017, -6450, 106, 6546,
-    8336, 5510, 569, -5078, -8375, -5767, 996, 7273, 11365, 12542,
-    9900, 6550, 7015, 10575, 13885, 15446, 13039, 4672, -6170, -13947,
-    -17277, -16455, -11701, -6805, -6210, -8771, -10848, -10925, -7494, -8,
-    7138, 8961, 5783, 281, -5348, -7505, -3840, 2772, 8177, 11102,
-    11054, 8259, 6074, 7680, 11961, 15923, 17337, 14031, 5592, -4466,
-    -11940, -15589, -15941, -13935, -11688, -11235, -12261, -13098, -12707, -10196,
-    -4810, 1992, 6695, 7080, 3611, -1879, -6370, -6288, -1095, 5659,
-    10440, 11977, 10151, 7042, 6998, 11543, 17280, 20356, 18416, 9908,
-    -2813, -13218, -17499, -16942, -13683, -10499, -11222, -15372, -17735, -15520,
-    -9453, -468, 7985, 10373, 6308, 391, -4425, -6338, -3166, 3063,
-    7433, 9188, 10045, 9715, 9274, 11544, 15402, 17479, 17194, 13893,
-    5782, -4754, -12764, -16970, -18049, -16072, -13605, -13910, -15600, -15512,
-    -13195, -8580, -1689, 4329, 6274, 4959, 2374, -350, -1111, 1370,
-    5080, 7813, 9493, 10170, 9933, 10165, 11627, 13266, 14088, 13636,
-    11038, 5873, -952, -8034, -14063, -17882, -18968, -17820, -15795, -14262,
-    -13418, -12274, -9595, -4366, 3006, 9426, 11370, 8371, 2710, -2241,
-    -2855, 1690, 7575, 10728, 10581, 8378, 6400, 7926, 13106, 17743,
-    18505, 14596, 5701, -5881, -15014, -19475, -20713, -19632, -17616, -17210,
-    -17465, -15017, -9929, -3934, 2671, 7852, 8784, 6714, 3950, 321,
-    -2728, -2261, 895, 4502, 8583, 11894, 12384, 12096, 13656, 15579,
-    16207, 15050, 9640, -673, -11319, -18356, -21205, -19343, -14220, -10571,
-    -10093, -10019, -8606, -5152, 1272, 8026, 10359, 7751, 2820, -2239,
-    -4305, -1130, 4720, 9382, 11881, 12134, 10759, 10481, 12418, 14179,
-    13776, 10509, 3613, -5495, -13344, -18223, -19852, -17955, -14344, -11845,
-    -10704, -9891, -8734, -5564, 50, 4991, 6642, 5215, 1397, -2636,
-    -2896, 1245, 6713, 11555, 14187, 12637, 9063, 7945, 9604, 12022,
-    13724, 11087, 1795, -9380, -16430, -18240, -15117, -8998, -5828, -8161,
-    -11405, -12077, -9982, -4065, 3607, 6855, 4414, 231, -3820, -5761,
-    -2061, 5097, 9733, 10889, 10005, 6937, 4578, 6545, 10152, 11353,
-    10225, 6170, -1792, -9820, -13981, -14965, -13285, -9040, -5988, -6755,
-    -8716, -9307, -7888, -3199, 3499, 7413, 6388, 2205, -2990, -6136,
-    -4043, 2168, 8292, 11429, 10302, 5967, 2839, 4333, 9306, 14226,
-    15011, 8820, -2085, -11823, -16680, -15870, -10722, -5795, -4914, -6650,
-    -8069, -7788, -3981, 2878, 7739, 7591, 4207, -958, -5979, -6637,
-    -2777, 1280, 4490, 7629, 8809, 8573, 10290, 12815, 13322, 12883,
-    10883, 4177, -5007, -11971, -16427, -17825, -14138, -8738, -6338, -5542,
-    -4542, -4412, -3211, 1006, 4369, 3903, 1470, -2352, -7020, -7897,
-    -3092, 3293, 8497, 11933, 11784, 9306, 9202, 11912, 13959, 13645,
-    9749, 1397, -7762, -12789, -13219, -10825, -7350, -5775, -7307, -9027,
-    -8275, -4975, 110, 4669, 5569, 2853, -843, -3456, -3189, 538,
-    5043, 7491, 7689, 6110, 4148, 4900, 8855, 12766, 14274, 12247,
-    5571, -3377, -9856, -12806, -13546, -12296, -11065, -12575, -14862, -14545,
-    -11669, -6286, 1574, 7622, 8112, 5174, 1571, -1685, -1835, 1872,
-    4988, 5060, 4074, 2743, 1849, 4789, 11337, 16582, 17979, 14999,
-    6378, -5111, -13143, -15867, -15484, -13370, -11871, -13430, -15340, -13230,
-    -7319, 241, 7703, 11491, 9285, 3771, -1469, -4821, -4560, -582,
-    3603, 5251, 5000, 4384, 5288, 9486, 15199, 17695, 14191, 5298,
-    -5965, -14811, -17873, -16153, -12893, -10622, -10357, -10647, -8551, -3294,
-    3097, 8022, 9129, 5777, 754, -2402, -2609, -218, 3503, 5886,
-    5862, 5492, 6518, 9120, 13169, 16390, 14718, 7486, -1946, -10177,
-    -14384, -13231, -9946, -9128, -10742, -11879, -10616, -5649, 2100, 7930,
-    8587, 5658, 1520, -2252, -3233, -795, 2542, 5178, 6987, 6985,
-    5771, 6575, 10378, 14569, 16308, 13145, 4007, -7497, -15424, -17472,
-    -15129, -11020, -8386, -8775, -9773, -8224, -3650, 2684, 8375, 10004,
-    6210, -581, -6563, -8633, -5435, 1016, 6443, 8249, 7120, 5773,
-    7141, 11720, 16218, 16228, 9831, -1199, -12082, -17856, -17231, -13011,
-    -9055, -7694, -8329, -7767, -3621, 2969, 8819, 11109, 8559, 2698,
-    -2801, -5360, -4618, -1233, 3016, 5760, 6506, 6706, 7635, 9931,
-    13102, 14345, 10709, 2478, -7464, -15781, -19548, -18098, -13974, -10126,
-    -7682, -6678, -6087, -3840, 731, 5792, 8874, 8117, 3099, -3531,
-    -7257, -5594, 435, 7464, 11417, 10426, 6868, 4938, 6713, 10826,
-    13182, 9587, -215, -11663, -19084, -19498, -14155, -7768, -4822, -5816,
-    -7733, -7131, -2479, 4517, 9718, 10013, 5668, -406, -4322, -3402,
-    1458, 6516, 8581, 7080, 4197, 3636, 7215, 12427, 14564, 10570,
-    1043, -9615, -15870, -15722, -11990, -9018, -9350, -12126, -13378, -9685,
-    -1873, 5995, 9948, 8196, 2512, -2544, -3601, -776, 3686, 6866,
-    6686, 4206, 2805, 4606, 9300, 14656, 16823, 13026, 4647, -4377,
-    -10756, -12749, -11192, -9534, -10068, -11665, -12216, -10387, -5736, -55,
-    3536, 4196, 3231, 1510, -74, -253, 885, 2616, 5078, 7597,
-    8560, 8261, 8425, 9536, 11114, 12063, 10032, 3937, -3761, -9857,
-    -13060, -13357, -12040, -11344, -11647, -11253, -9307, -6172, -2316, 1043,
-    2509, 2242, 1112, -359, -994, 477, 3590, 6834, 9049, 9632,
-    9390, 10293, 12563, 13733, 11213, 4336, -4851, -12035, -14173, -12509,
-    -10433, -10059, -11324, -11938, -9110, -3178, 2486, 5179, 4044, -172,
-    -4324, -4903, -1550, 3788, 8935, 11450, 10693, 9840, 11983, 16176,
-    19149, 17429, 8831, -3909, -13847, -16862, -14438, -10309, -8327, -10270,
-    -12873, -11203, -4905, 2573, 7660, 7329, 1306, -5908, -9336, -7771,
-    -2314, 4490, 8548, 8297, 6983, 8244, 12659, 18129, 20040, 14075,
-    1798, -9989, -15928, -15363, -11398, -8884, -10181, -12465, -11551, -6531,
-    526, 6399, 8117, 5215, 120, -4190, -5548, -3038, 1828, 5835,
-    7043, 6299, 6420, 9889, 15747, 19275, 16165, 6394, -5685, -14055,
-    -15521, -12600, -10501, -11841, -15247, -16877, -13033, -4061, 5007, 9225,
-    7240, 829, -5618, -7152, -2872, 3549, 8085, 8511, 5166, 2293,
-    4701, 11839, 18456, 19559, 12747, -30, -12058, -17513, -16619, -12995,
-    -9828, -9319, -10960, -11121, -7577, -1731, 4207, 8045, 7289, 2195,
-    -3405, -6087, -4607, 814, 7455, 11248, 11295, 10307, 10721, 12988,
-    15438, 14245, 6778, -4525, -14195, -18582, -17491, -13523, -10330, -9299,
-    -8377, -5246, -162, 4657, 6713, 4661, -314, -4871, -5960, -2897,
-    2483, 7114, 8810, 8172, 8327, 11845, 17466, 20406, 16308, 5013,
-    -8724, -18028, -18988, -13900, -8647, -7167, -8997, -10545, -8050, -1219,
-    5787, 8290, 5124, -1500, -7638, -9240, -5039, 2279, 8882, 12374,
-    12184, 10215, 9991, 12624, 15107, 13620, 6716, -3846, -13308, -16890,
-    -14284, -9348, -5628, -4245, -4424, -3971, -1190, 2763, 5171, 4594,
-    1173, -3665, -6847, -5657, -630, 5242, 9265, 10199, 8883, 8128,
-    9764, 12034, 11480, 6313, -2542, -11700, -16798, -16141, -12425, -9522,
-    -8828, -9107, -7919, -3567, 2527, 6453, 5903, 2074, -2313, -4734,
-    -3689, -68, 3414, 5025, 5007, 4631, 5853, 9912, 14717, 15815,
-    10765, 1152, -8808, -14670, -14873, -12224, -10617, -10823, -10822, -8568,
-    -3498, 2806, 7256, 7900, 5375, 1456, -2191, -4029, -3397, -1139,
-    1460, 3772, 5766, 7845, 10375, 12518, 12223, 8127, 1047, -6611,
-    -12523, -15626, -16242, -15214, -12797, -8681, -3324, 1509, 4214, 4636,
-    3542, 1791, 180, -851, -1152, -237, 2035, 4479, 6104, 7820,
-    10793, 14210, 15599, 12289, 3525, -7281, -14395, -15190, -11867, -8266,
-    -7047, -8209, -8644, -5268, 1157, 7092, 9426, 6634, -6, -5819,
-    -6443, -1779, 4981, 10070, 11080, 9263, 8751, 11337, 14094, 12878,
-    5955, -4684, -13703, -16360, -13201, -8795, -6653, -7022, -7583, -5386,
-    -170, 4599, 5405, 2014, -3046, -6265, -5102, -115, 5499, 8960,
-    9709, 9208, 9866, 12649, 15208, 13621, 6092, -5145, -14882, -18523,
-    -15792, -10580, -7087, -6644, -7389, -6318, -2347, 2556, 5414, 4510,
-    224, -4711, -6549, -3558, 2707, 8941, 12165, 11896, 10993, 12457,
-    15462, 16178, 11550, 1704, -9445, -16415, -16944, -13589, -10183, -8761,
-    -9105, -8847, -5465, 420, 5408, 6627, 3341, -2538, -6547, -5171,
-    435, 6026, 8329, 6979, 4867, 6058, 11036, 15339, 14083, 6170,
-    -5258, -14504, -17208, -14208, -10127, -8471, -9412, -10488, -8403, -2237,
-    4867, 8504, 6714, 974, -4511, -5251, -386, 6340, 10163, 9184,
-    5672, 4408, 8146, 14051, 15958, 10162, -1312, -12095, -16320, -13534,
-    -8617, -6578, -8243, -10415, -9055, -3093, 4171, 7922, 5864, -416,
-    -6548, -7995, -3505, 3743, 8941, 9399, 6439, 4533, 7232, 12997,
-    16121, 12026, 1227, -10850, -17723, -17037, -12107, -7934, -6746, -7295,
-    -6688, -3022, 2525, 6589, 6641, 2604, -3286, -7252, -6312, -929,
-    5496, 9611, 10399, 9702, 10470, 13259, 15018, 12199, 4285, -5732,
-    -13359, -15705, -13598, -10232, -7920, -6782, -5573, -2987, 900, 4141,
-    4481, 1316, -3815, -7841, -7777, -3064, 3785, 9308, 11705, 11843,
-    12163, 13948, 15355, 12890, 5034, -5808, -14689, -17706, -15046, -10491,
-    -7649, -6955, -6157, -3163, 1517, 4869, 4098, -711, -6548, -9651,
-    -7967, -2416, 3955, 8440, 10582, 11982, 14263, 16808, 16553, 10755,
-    220, -10544, -16623, -16452, -12695, -9313, -7762, -6324, -2852, 2443,
-    6790, 7192, 3185, -2566, -6338, -5945, -1922, 3121, 6637, 8328,
-    10103, 13601, 17753, 18865, 13627, 2756, -8612, -14946, -14835, -11501,
-    -9245, -9430, -9686, -6959, -1096, 4812, 7129, 4453, -1481, -6954,
-    -8654, -5679, 145, 5610, 8429, 9010, 9799, 12358, 15164, 14585,
-    8248, -2252, -12023, -16590, -15200, -10711, -6737, -4881, -4156, -2632,
-    382, 3571, 4640, 2166, -2938, -7524, -8262, -4176, 2559, 8358,
-    11123, 11797, 12848, 15067, 16160, 12756, 3900, -7241, -15306, -16878,
-    -13093, -8238, -5890, -6136, -6070, -3000, 2470, 6499, 5312, -1232,
-    -8934, -12120, -8114, 427, 7690, 9697, 7594, 6244, 9252, 14891,
-    17068, 10942, -2057, -14742, -19864, -15928, -8023, -3004, -3532, -6423,
-    -6383, -1273, 5778, 9083, 5513, -2509, -8820, -8544, -2031, 5630,
-    9205, 7952, 5833, 7040, 11339, 13953, 10224, 524, -9590, -14306,
-    -12553, -8192, -5746, -6184, -6693, -4196, 1157, 5998, 6850, 3165,
-    -2175, -5030, -3185, 1945, 6613, 7945, 6370, 5146, 7043, 11065,
-    12802, 8546, -863, -10339, -14768, -13247, -9280, -6904, -6919, -6950,
-    -4582, -27, 4057, 5093, 2822, -717, -2956, -2415, 675, 4753,
-    8052, 9751, 10281, 10609, 10954, 10050, 6108, -1069, -9184, -14899,
-    -16289, -14150, -10974, -8465, -6218, -2955, 1455, 5468, 6975, 5020,
-    829, -2896, -3798, -1114, 4035, 9141, 11910, 12131, 11630, 12170,
-    13380, 12505, 6643, -3909, -14810, -20932, -20382, -15401, -10061, -6975,
-    -5572, -3522, 288, 4579, 6836, 5124, -201, -5884, -7716, -3875,
-    3533, 9999, 12114, 10557, 9240, 10667, 12750, 10919, 2951, -8412,
-    -17340, -19763, -16643, -12174, -9338, -7844, -5527, -994, 4513, 7612,
-    5703, -389, -6557, -8068, -3193, 4834, 10311, 10508, 8195, 8351,
-    12559, 16672, 14423, 4038, -9158, -17425, -17415, -12204, -7562, -6615,
-    -7625, -6679, -2222, 3398, 6184, 3796, -2388, -7864, -8432, -3649,
-    3145, 8004, 9706, 10360, 12402, 14910, 13963, 7097, -3448, -12269,
-    -15349, -13317, -10213, -8946, -8566, -6223, -912, 5045, 7737, 5106,
-    -812, -5317, -4940, -145, 5228, 7341, 6073, 5214, 8132, 13509,
-    15966, 11064, 18, -10596, -14640, -11921, -7455, -5891, -7330, -7951,
-    -4356, 2433, 7599, 7163, 1504, -5024, -7195, -2908, 4773, 10392,
-    11202, 9194, 8690, 11891, 15801, 14389, 5139, -7617, -16618, -17832,
-    -13126, -8131, -6807, -7694, -6531, -1685, 4344, 7353, 4642, -2241,
-    -7910, -7869, -2364, 4711, 9237, 9889, 9383, 11345, 15123, 15870,
-    10030, -924, -11457, -16011, -13785, -9415, -7524, -7952, -7356, -3446,
-    2716, 7010, 5632, -597, -6599, -7817, -3562, 3150, 7967, 9026,
-    8768, 10523, 13993, 15367, 11097, 1399, -9075, -14730, -14022, -10213,
-    -7314, -6463, -5793, -2858, 2403, 6922, 7123, 2259, -4689, -8941,
-    -7408, -1229, 5304, 8646, 8887, 8982, 10948, 12866, 10567, 2463,
-    -8264, -16268, -18382, -15893, -12603, -10399, -7798, -3078, 2934, 7430,
-    7717, 3478, -2177, -5134, -3883, 115, 4321, 6738, 7674, 9761,
-    14180, 17972, 16737, 8816, -3171, -13477, -17403, -15715, -13050, -12049,
-    -11372, -8390, -1952, 5836, 10218, 8196, 1748, -4404, -6456, -3265,
-    2684, 6871, 7439, 7007, 9003, 13814, 18014, 16441, 7024, -5883,
-    -15115, -17344, -14752, -11683, -10709, -10612, -8135, -2442, 3427, 5885,
-    4007, -235, -3477, -3388, -549, 2630, 4722, 6291, 8687, 12237,
-    15115, 14312, 8583, 193, -6818, -10008, -10107, -9549, -9665, -9436,
-    -7006, -2243, 2417, 3975, 1746, -2001, -4106, -2959, 425, 3345,
-    4102, 3864, 5206, 9067, 13463, 14628, 9959, 980, -7348, -11173,
-    -10781, -9223, -9117, -10215, -9455, -4549, 2590, 7399, 6943, 1980,
-    -3689, -5832, -3460, 425, 2468, 2031, 890, 1671, 5726, 11170,
-    14181, 12494, 6518, -1683, -9173, -13655, -15105, -14824, -13616, -11777,
-    -9277, -5554, -662, 3930, 6752, 7317, 5519, 1786, -2352, -5021,
-    -4906, -1675, 3211, 6870, 7688, 6995, 7364, 9808, 12498, 11752,
-    5194, -5382, -14796, -18416, -15471, -9275, -4609, -4086, -6111, -6376,
-    -1994, 5432, 10890, 10157, 3379, -4697, -8241, -5213, 1104, 5639,
-    5814, 2791, 279, 1753, 7112, 12422, 13373, 8202, -1431, -10752,
-    -14960, -13593, -10263, -8365, -8805, -10140, -9430, -5075, 1009, 5749,
-    7630, 6106, 1797, -2312, -3167, -653, 3195, 5803, 5211, 2742,
-    2792, 7416, 13597, 16603, 13313, 3828, -7324, -14026, -14136, -10300,
-    -6604, -6351, -9852, -12866, -10464, -2641, 5924, 9976, 6941, -834,
-    -7137, -7493, -2731, 3366, 7376, 7718, 5768, 4981, 7441, 11983,
-    15280, 13781, 6207, -4483, -12869, -15501, -13152, -9408, -7623, -8464,
-    -9806, -8926, -4845, 846, 4978, 4985, 751, -5008, -8019, -5460,
-    1247, 7545, 9929, 8502, 6447, 7548, 12441, 17055, 16301, 8665,
-    -3146, -13799, -18015, -14883, -8991, -5659, -6553, -9572, -10361, -5633,
-    2595, 8315, 7703, 1658, -5940, -9987, -7397, -397, 5922, 8620,
-    7859, 6120, 7335, 12835, 18493, 18773, 11780, -340, -12509, -18976,
-    -18024, -13122, -8514, -6362, -6885, -7726, -5271, 1036, 7773, 10827,
-    7831, -242, -8261, -10641, -6523, 496, 6153, 7956, 6691, 6082,
-    8831, 13542, 16218, 13264, 3861, -8290, -16750, -17634, -12497, -6246,
-    -3232, -4042, -5141, -2718, 3177, 8923, 10581, 6727, -367, -6163,
-    -7311, -3729, 2009, 6452, 7577, 6397, 5676, 6998, 9501, 10587,
-    7740, 820, -7435, -13552, -15345, -12519, -6947, -1851, 544, 337,
-    -703, -403, 2018, 4623, 4444, 656, -4704, -8313, -7518, -2423,
-    3728, 7284, 7040, 4580, 3094, 5040, 9281, 11379, 7726, -1154,
-    -10822, -15713, -13346, -6677, -1266, -355, -3118, -5994, -5273, -232,
-    6005, 9341, 7688, 1830, -4739, -7760, -5746, -893, 3524, 5368,
-    4535, 3241, 4072, 7287, 11124, 13418, 11928, 5540, -3807, -12223,
-    -16625, -15912, -11648, -7748, -6918, -7849, -7379, -3702, 2675, 8630,
-    9951, 5508, -1412, -6443, -6922, -2838, 2578, 5252, 4691, 4009,
-    6012, 11079, 16862, 18944, 14456, 5238, -4390, -11346, -14423, -14245,
-    -13025, -12191, -11124, -9073, -6057, -1935, 2921, 6884, 8479, 7152,
-    2840, -3051, -7233, -6987, -2266, 4663, 10339, 12082, 10589, 9488,
-    11543, 15921, 18650, 15325, 4814, -8896, -19278, -22049, -17867, -11322,
-    -7240, -7071, -8342, -7341, -2457, 4246, 8575, 7719, 2317, -4307,
-    -8196, -7162, -2305, 3376, 7722, 10126, 11118, 12173, 14240, 16236,
-    16254, 13131, 6351, -3135, -11977, -16770, -16723, -13201, -8913, -7094,
-    -8438, -9904, -8411, -3748, 2054, 5545, 3793, -1955, -6756, -6870,
-    -2039, 5348, 11111, 12153, 9887, 8379, 9850, 13685, 17235, 16722,
-    10452, 1041, -7318, -12105, -12745, -10691, -8933, -9202, -10623, -11480,
-    -10411, -6746, -1704, 1911, 2197, -613, -4569, -6666, -4711, 579,
-    6189, 9266, 8952, 7085, 6996, 10360, 15349, 17928, 14634, 5264,
-    -6210, -14294, -16011, -12470, -7686, -5809, -7841, -10919, -11271, -7286,
-    -402, 5541, 6830, 3015, -2959, -7214, -6939, -1911, 4916, 9738,
-    10858, 9081, 6926, 7397, 11211, 15480, 16219, 11191, 1021, -10268,
-    -17161, -17120, -12277, -6968, -5018, -7447, -11059, -11122, -6047, 1652,
-    7587, 8057, 2905, -3713, -6913, -4890, 688, 6125, 8147, 6754,
-    4933, 5487, 9062, 13844, 16196, 13392, 6004, -3167, -10979, -14892,
-    -14649, -12574, -10766, -9639, -8907, -7409, -3580, 1877, 6159, 7431,
-    5339, 574, -4033, -5213, -2811, 1030, 4551, 6414, 6436, 6847,
-    9599, 13569, 16250, 15606, 10334, 1508, -7213, -12864, -14814, -13749,
-    -11471, -9987, -9399, -8480, -6562, -3351, 798, 3991, 4564, 2692,
-    -822, -4645, -6267, -4356, -198, 4467, 8242, 9599, 8857, 8551,
-    10098, 12681, 14699, 13806, 8054, -1300, -10530, -16441, -17388, -14103,
-    -9998, -8065, -8452, -9658, -9314, -5200, 1482, 6527, 7263, 3536,
-    -3274, -8986, -9011, -3688, 3158, 8766, 11153, 9805, 8367, 10725,
-    15745, 19924, 20480, 14723, 2980, -9136, -16318, -17658, -14314, -9154,
-    -6725, -8230, -10182, -9639, -5958, 399, 6234, 7027, 2244, -4684,
-    -10059, -10734, -5595, 2271, 8391, 10749, 9655, 7425, 7544, 10854,
-    14739, 16457, 13943, 6202, -3900, -11558, -15114, -15119, -12090, -8663,
-    -8044, -9345, -9837, -8814, -5617, 281, 5976, 7768, 5367, 330,
-    -5059, -7053, -3736, 2568, 8402, 11227, 9884, 6851, 6516, 9809,
-    14370, 17318, 14943, 5553, -6410, -14895, -18020, -16112, -10843, -6987,
-    -7550, -9666, -9880, -7523, -2222, 4498, 7845, 5541, 63, -5765,
-    -9262, -7301, -628, 6105, 10000, 10597, 8210, 5820, 7265, 11905,
-    15733, 15697, 10106, -369, -11031, -16769, -16423, -12147, -7570, -6009,
-    -7644, -9785, -9847, -6415, -227, 4984, 6220, 4155, 252, -4142,
-    -5825, -3138, 1188, 4871, 8016, 9465, 8690, 8836, 11723, 15025,
-    16667, 15389, 9095, -1257, -10742, -16028, -16750, -13682, -9955, -9015,
-    -9962, -9919, -7921, -3340, 3148, 7187, 5975, 1975, -2294, -5802,
-    -5788, -1407, 3435, 6394, 8681, 10016, 10035, 11375, 14709, 16815,
-    15900, 11859, 3780, -6631, -14421, -17183, -15994, -12303, -8810, -8635,
-    -10721, -11131, -8301, -3001, 3231, 7089, 5702, 609, -3997, -5564,
-    -3629, 1029, 6100, 8908, 8943, 8165, 8504, 10115, 12344, 14428,
-    14373, 10089, 2534, -5294, -11629, -15177, -14513, -11169, -8865, -8573,
-    -8753, -8429, -6338, -1366, 4230, 6773, 5483, 1559, -3183, -5541,
-    -3753, 50, 3460, 5722, 5751, 3981, 3748, 6315, 9473, 12058,
-    13159, 9724, 1463, -7265, -13573, -17064, -16392, -12311, -9355, -9354,
-    -9692, -8675, -5707, 386, 7583, 10909, 8843, 3657, -2515, -6884,
-    -6449, -2363, 1657, 4475, 6245, 6378, 6336, 8683, 12474, 14991,
-    15490, 13008, 5704, -4724, -13605, -18528, -19346, -16023, -10791, -7886,
-    -8261, -8883, -7418, -3437, 2713, 8443, 9634, 5315, -1454, -7206,
-    -9460, -6819, -761, 5107, 8667, 9803, 8925, 7731, 8650, 11700,
-    14712, 15976, 13781, 6478, -4120, -13207, -17926, -18185, -14581, -9640,
-    -7400, -8428, -9332, -7887, -4157, 1593, 7505, 9849, 7400, 2575,
-    -2343, -5982, -6401, -3028, 1994, 6503, 9603, 10549, 9809, 9830,
-    12079, 15334, 17362, 15617, 8083, -3538, -14034, -19586, -19586, -15110,
-    -9480, -7071, -8249, -9368, -8238, -4893, 582, 6125, 7803, 4980,
-    534, -3718, -6561, -5691, -1121, 4080, 7982, 10067, 9496, 7503,
-    7428, 10122, 13668, 16203, 15181, 8412, -1728, -10345, -15409, -16750,
-    -14386, -11114, -10492, -11619, -11638, -10369, -7887, -3142, 2317, 5241,
-    5227, 3529, 305, -3275, -4268, -1555, 2979, 6978, 9011, 8661,
-    7167, 7207, 10669, 16237, 19816, 18030, 10781, 506, -9168, -14615,
-    -14889, -12856, -11891, -12827, -14591, -15408, -13393, -8138, -1483, 3934,
-    6253, 5136, 1804, -2001, -4694, -4712, -1746, 2311, 5510, 7403,
-    7862, 7446, 8408, 11906, 15904, 17760, 15929, 9459, -408, -9805,
-    -15743, -17557, -15613, -12029, -9955, -9886, -10160, -9975, -8072, -2739,
-    3979, 7762, 7640, 4642, -899, -6018, -5957, -942, 4733, 8936,
-    10986, 9710, 6960, 7159, 11172, 15692, 17725, 15688, 8782, -1502,
-    -11182, -16689, -17463, -15505, -12894, -10760, -10168, -11060, -10737, -6982,
-    -1216, 4241, 8285, 8846, 4351, -2302, -6528, -6890, -3789, 2001,
-    7507, 9535, 8695, 7845, 8721, 11820, 16082, 18342, 15872, 8685,
-    -1141, -10370, -15809, -16698, -14792, -12125, -10236, -9906, -10099, -8849,
-    -5445, -621, 4098, 6771, 6320, 3249, -1059, -4435, -4710, -2088,
-    1440, 4886, 7518, 8001, 7443, 8945, 12506, 15547, 17116, 16264,
-    10551, 809, -8202, -13956, -17038, -17213, -14728, -12467, -12103, -11779,
-    -9933, -7246, -4095, -76, 3788, 5477, 4652, 2601, -153, -3518,
-    -5550, -4057, 50, 4427, 8414, 11340, 11588, 10148, 10223, 12154,
-    13664, 13726, 11591, 5647, -3099, -10784, -15223, -16594, -15120, -11961,
-    -9653, -9179, -9323, -8954, -7336, -3719, 1261, 5480, 7285, 6253,
-    2836, -1352, -3942, -3482, -346, 3937, 7762, 9968, 10174, 9349,
-    9382, 11013, 13073, 14207, 13410, 9216, 1487, -6873, -12889, -16054,
-    -16332, -13741, -10715, -10007, -10736, -10586, -9311, -6836, -2299, 2773,
-    5138, 4338, 2239, -465, -3229, -3863, -1336, 2479, 5865, 8744,
-    10437, 9897, 8491, 8842, 11149, 13634, 15053, 13981, 8419, -934,
-    -9962, -15473, -17176, -15549, -11862, -9187, -9359, -10571, -10486, -8742,
-    -5284, -234, 4256, 5745, 4372, 1501, -2138, -5100, -5152, -2021,
-    2386, 6431, 9058, 9154, 7222, 6062, 7750, 11499, 15145, 16450,
-    13164, 4884, -5213, -12856, -16199, -15673, -12707, -9916, -9704, -11495,
-    -12558, -11306, -7689, -2101, 3758, 7034, 6543, 3571, -339, -3887,
-    -5139, -3076, 857, 4618, 7359, 8582, 8136, 7613, 9054, 12259,
-    15344, 16744, 15005, 8964, -110, -8783, -14669, -17260, -16469, -13264,
-    -10341, -9422, -9509, -9182, -7940, -4863, 478, 5800, 8050, 6725,
-    2982, -2049, -6058, -6051, -1950, 3307, 7555, 10203, 10556, 9035,
-    8397, 10481, 13735, 15868, 15870, 12502, 4842, -4917, -12837, -17146,
-    -18050, -15783, -11767, -9003, -8745, -9228, -8667, -6681, -2980, 2093,
-    6216, 7010, 4594, 715, -3047, -5120, -4038, -12, 4862, 8486,
-    9999, 9562, 8261, 8020, 10224, 14141, 17190, 16658, 11256, 1958,
-    -8122, -15287, -17353, -14840, -10586, -7846, -7911, -9601, -10852, -9941,
-    -5972, -48, 4739, 6153, 4504, 890, -3688, -7019, -6842, -3605,
-    656, 4949, 8321, 8972, 7143, 5972, 7540, 11010, 14928, 17684,
-    16336, 9113, -1451, -10865, -16729, -18511, -16259, -11893, -8959, -8941,
-    -10043, -10418, -9785, -7600, -3111, 2260, 5684, 6138, 4323, 503,
-    -4510, -7768, -6793, -2378, 3292, 8837, 12501, 12391, 9590, 7759,
-    8837, 11971, 15792, 18437, 16765, 9090, -2235, -12870, -19675, -21213,
-    -17708, -11798, -7570, -7465, -10456, -13430, -13731, -10225, -3330, 4502,
-    9406, 9170, 5063, -414, -5513, -8131, -6224, -746, 4969, 9083,
-    11360, 10929, 8029, 6054, 7951, 12664, 17476, 20428, 19067, 11427,
-    -248, -10638, -16502, -17762, -15246, -10931, -8326, -9304, -12001, -13438,
-    -12279, -8411, -2294, 4291, 8544, 8806, 5865, 1594, -2753, -5844,
-    -5650, -1879, 2782, 6109, 8346, 9383, 8399, 7267, 9017, 13035,
-    16563, 18626, 18150, 12611, 2429, -7999, -15419, -19267, -19019, -15105,
-    -10862, -9499, -10667, -11961, -11703, -9201, -4216, 2335, 7750, 9248,
-    6710, 2147, -3047, -7609, -8771, -5152, 671, 5711, 9364, 10859,
-    9237, 6992, 8124, 12612, 17373, 20342, 19697, 13100, 1596, -9507,
-    -16030, -17868, -16323, -12759, -9850, -9901, -11750, -12310, -10410, -6714,
-    -1750, 3452, 6774, 7015, 4888, 1500, -2283, -5185, -5906, -4106,
-    -677, 2803, 5391, 7279, 8514, 8942, 9746, 11999, 14172, 14505,
-    13513, 10942, 4792, -4068, -11820, -16804, -19186, -17809, -12958, -8482,
-    -7021, -7333, -7794, -7776, -5864, -1092, 4688, 8300, 8232, 5085,
-    95, -5338, -8717, -7475, -2241, 3614, 8194, 11129, 11021, 8104,
-    6554, 9073, 13375, 16807, 18360, 15628, 6997, -4064, -12569, -16995,
-    -17539, -14457, -10201, -8277, -9137, -10467, -10590, -9073, -5553, -289,
-    4784, 7234, 6382, 3345, -708, -4671, -6665, -5401, -1711, 2670,
-    6464, 8558, 8560, 7730, 7862, 9734, 12853, 15480, 15447, 11835,
-    5148, -3298, -10942, -15135, -15801, -14585, -12238, -9528, -8122, -7966,
-    -7075, -4976, -2695, -55, 3308, 5874, 6078, 4326, 1579, -1934,
-    -5387, -6637, -4419, -138, 4009, 7188, 8707, 7703, 5946, 6767,
-    9983, 12591, 13350, 11559, 5259, -4307, -12005, -15488, -16265, -14637,
-    -10591, -6914, -5650, -5483, -5248, -4951, -3326, 703, 5483, 8432,
-    8163, 4236, -2326, -8383, -10394, -7001, -209, 5866, 8333, 7347,
-    4818, 3290, 5269, 10716, 16066, 17450, 13313, 4267, -6630, -14678,
-    -17225, -15278, -11236, -7490, -6099, -7037, -7971, -6846, -3159, 2473,
-    7983, 10507, 8908, 4453, -873, -5147, -6542, -4575, -844, 2535,
-    4639, 5458, 5440, 6124, 9136, 13509, 16394, 16576, 14141, 8231,
-    -649, -8952, -14309, -17260, -17548, -14739, -11472, -9911, -8443, -6131,
-    -4223, -1726, 2907, 7028, 7573, 5486, 2107, -2569, -6474, -6853,
-    -4192, -407, 3600, 6621, 7635, 7803, 8930, 11304, 14152, 16102,
-    15439, 11282, 3955, -5010, -12586, -16254, -16354, -14360, -11015, -7829,
-    -6595, -6563, -5730, -3731, -728, 3310, 6591, 6601, 3406, -1178,
-    -5793, -8725, -7895, -3351, 2408, 6827, 8630, 7878, 6247, 6417,
-    9709, 14433, 17240, 15706, 9252, -759, -10722, -16630, -17270, -14240,
-    -9918, -7001, -7194, -8945, -9429, -7940, -4474, 1293, 7068, 9027,
-    6634, 1787, -4044, -8110, -7275, -2760, 1732, 5147, 7306, 6989,
-    5632, 6804, 10712, 14634, 16897, 16386, 11900, 4329, -3715, -10225,
-    -14029, -14788, -13455, -11383, -9702, -9212, -9200, -8059, -5692, -2531,
-    1965, 6580, 8056, 5794, 1992, -2241, -5670, -5355, -968, 3912,
-    6776, 7606, 6606, 5198, 6352, 10755, 15626, 17837, 15620, 8709,
-    -932, -9829, -15201, -16223, -14186, -11574, -10152, -10216, -11097, -11148,
-    -8558, -3373, 2487, 6995, 8601, 6545, 1841, -3017, -5478, -4107,
-    288, 5114, 8434, 9670, 8668, 6706, 6623, 9501, 13589, 16708,
-    16572, 10892, 647, -9693, -16602, -18905, -16449, -11205, -7134, -6451,
-    -8118, -9616, -8516, -4257, 1134, 5389, 7181, 5351, 695, -3416,
-    -5197, -5200, -2782, 2139, 6400, 8192, 9122, 9236, 7630, 6848,
-    8744, 10419, 9624, 7126, 2261, -5629, -13265, -17345, -17981, -15638,
-    -10842, -6343, -4305, -4052, -4546, -4781, -2861, 1160, 4494, 5363,
-    3787, 56, -3839, -4579, -1576, 3044, 7854, 11751, 12972, 11718,
-    10501, 10413, 10356, 9602, 7803, 3663, -3316, -10870, -16018, -17881,
-    -17069, -14383, -11469, -10084, -9699, -8400, -5735, -2249, 1673, 4501,
-    4414, 2143, -255, -1787, -1345, 1967, 6481, 9963, 12103, 12427,
-    10694, 9770, 11853, 14446, 14998, 13342, 7798, -2290, -11843, -16225,
-    -16642, -14710, -10872, -8775, -11040, -14083, -14347, -12191, -7082, 1009,
-    7161, 7364, 3697, -806, -4429, -4014, 1588, 8499, 13166, 14933,
-    13238, 9519, 8522, 12034, 16727, 19692, 19324, 13275, 2271, -8448,
-    -15191, -17806, -16330, -12290, -10185, -12072, -14970, -16058, -14786, -10290,
-    -3045, 2851, 4105, 1791, -1867, -5350, -5935, -1738, 4858, 10187,
-    13174, 13818, 12486, 11762, 13858, 17106, 18842, 18126, 13641, 4735,
-    -5291, -12504, -16400, -17154, -14620, -11467, -10548, -10727, -10523, -10525,
-    -9360, -5156, -674, 676, -144, -2044, -5468, -7722, -5389, 10,
-    5647, 11192, 15192, 15679, 14769, 15203, 15887, 15831, 15625, 13213,
-    6225, -2887, -10332, -14987, -15956, -13012, -9450, -8115, -7821, -7555,
-    -7934, -7429, -4532, -1928, -2314, -4491, -7114, -9867, -10414, -6979,
-    -1769, 3085, 7965, 11886, 13135, 13537, 15515, 17731, 18242, 16794,
-    12200, 3892, -4760, -10252, -12597, -12195, -8992, -5580, -4844, -5991,
-    -7097, -7421, -5589, -1243, 2265, 1908, -1432, -6076, -10792, -12541,
-    -8963, -2000, 4818, 9446, 10577, 8804, 7791, 10030, 13790, 16411,
-    16445, 12362, 4050, -5127, -11318, -13382, -11904, -8384, -5530, -5037,
-    -5774, -6068, -5532, -3767, -580, 2232, 2478, 294, -3008, -6589,
-    -8876, -7971, -4278, 220, 4480, 7705, 8973, 9366, 10785, 12582,
-    13120, 12342, 9695, 3878, -3599, -9423, -12259, -11866, -8323, -4411,
-    -3382, -4462, -5206, -4899, -2711, 1684, 5085, 4193, -130, -5525,
-    -9916, -10141, -5183, 1188, 5408, 7271, 7145, 6019, 6575, 9421,
-    12040, 12702, 10462, 3786, -5862, -13423, -15732, -13299, -8121, -3525,
-    -2400, -3738, -4664, -4167, -2002, 1724, 4528, 3685, -335, -5204,
-    -8572, -8313, -4463, 479, 4823, 8249, 9979, 10038, 10096, 10917,
-    11607, 10933, 7321, 187, -7957, -13678, -15690, -14167, -10262, -6529,
-    -4510, -3313, -1910, 178, 3560, 7210, 8548, 6622, 2251, -3343,
-    -7479, -7331, -3384, 1953, 7053, 10148, 10245, 9433, 10079, 11942,
-    13977, 14417, 10078, 619, -9782, -17415, -20767, -18973, -13985, -10100,
-    -8529, -7630, -6698, -4454, 794, 6804, 9644, 8794, 5056, -688,
-    -4548, -3223, 1004, 4681, 6940, 6905, 5104, 5411, 9275, 13550,
-    15915, 15025, 8509, -2122, -10845, -14587, -14341, -11405, -8705, -9656,
-    -12746, -13948, -12137, -7007, 1522, 9331, 11300, 7430, 861, -4985,
-    -5935, -696, 6477, 11077, 11774, 8428, 3065, 459, 3049, 8765,
-    14053, 14920, 8470, -3049, -13595, -18766, -17266, -10916, -4876, -3427,
-    -6090, -9900, -11661, -8451, -897, 6172, 8795, 6085, -762, -7453,
-    -8896, -4772, 1712, 8141, 11920, 11133, 8441, 7862, 9691, 12607,
-    14732, 12016, 3148, -7001, -13916, -16845, -15301, -10579, -7231, -6857,
-    -6868, -6271, -4748, -352, 5476, 7965, 5953, 1207, -5131, -9637,
-    -8152, -2379, 3022, 6650, 8154, 7251, 6901, 9678, 13487, 15790,
-    15770, 11564, 2990, -5777, -11408, -13932, -13483, -10970, -9205, -8974,
-    -8507, -7097, -4553, -447, 3270, 3876, 1878, -650, -2535, -2621,
-    -861, 792, 1541, 2332, 3230, 4418, 7069, 10486, 12551, 12612,
-    10216, 4844, -1156, -4638, -5662, -5491, -4960, -6035, -9111, -10872,
-    -9359, -6063, -1922, 2194, 3633, 2010, -45, -1557, -2344, -689,
-    2856, 5227, 6031, 6385, 5617, 4525, 5774, 8802, 10838, 10827,
-    7682, 556, -7315, -11679, -12378, -11002, -8659, -7570, -8704, -9402,
-    -7594, -4125, 63, 3796, 4596, 1898, -1947, -4719, -4841, -1353,
-    3823, 7209, 7831, 7037, 6518, 8020, 11567, 14153, 12679, 6450,
-    -3057, -11990, -16029, -14942, -12322, -11012, -11666, -13072, -12120, -7085,
-    -251, 5356, 8346, 7479, 3150, -981, -2090, -522, 2905, 6808,
-    8391, 7374, 6748, 7942, 10299, 13204, 14035, 9091, -650, -10226,
-    -16192, -17097, -13360, -9372, -9646, -13009, -15292, -14052, -8234, 857,
-    8089, 9328, 5509, -323, -5035, -4831, 1452, 9962, 15972, 17366,
-    14176, 9152, 7046, 9695, 13913, 15046, 10081, -922, -13551, -21371,
-    -21376, -15822, -9433, -6212, -7255, -10091, -10852, -7467, -1006, 5114,
-    7378, 4651, -948, -5258, -4644, 1294, 9428, 15703, 17504, 14757,
-    10694, 9877, 13437, 17633, 17401, 9907, -3402, -16322, -22223, -19997,
-    -13730, -8271, -7099, -10552, -14277, -13161, -6775, 1441, 7462, 7833,
-    2224, -4764, -7973, -6035, 23, 7857, 13275, 13824, 11861, 10945,
-    12258, 15229, 17219, 14014, 4860, -5763, -13365, -16549, -15742, -13240,
-    -12199, -12654, -11828, -8588, -3784, 1666, 5774, 6040, 2779, -1421,
-    -4719, -5745, -3339, 1352, 5612, 8191, 9305, 9687, 11155, 14878,
-    18494, 17932, 11661, 1604, -8386, -14476, -15535, -13882, -12358, -11795,
-    -11439, -10026, -6577, -1528, 3091, 5085, 3576, -469, -4751, -6927,
-    -5776, -1841, 2642, 5365, 6012, 6257, 8097, 12259, 16800, 17627,
-    12351, 2950, -6313, -11868, -12196, -9105, -6705, -7069, -8720, -9433,
-    -7669, -2808, 3127, 6450, 5735, 2046, -3136, -7228, -7159, -2982,
-    2454, 6915, 9016, 8297, 7150, 8540, 11652, 13292, 11351, 5042,
-    -4167, -11778, -14441, -13233, -10731, -8549, -7796, -7830, -6083, -1747,
-    3139, 6462, 6803, 3464, -1711, -5299, -5697, -3239, 1113, 5279,
-    7211, 7349, 7736, 9670, 12997, 15507, 13712, 6507, -3280, -11613,
-    -15698, -15004, -11841, -9375, -8635, -8736, -8225, -5404, -74, 5200,
-    7645, 6462, 2194, -3028, -5706, -4207, 55, 5023, 8668, 9286,
-    8065, 8270, 10765, 13525, 13996, 9595, -202, -11169, -17844, -18658,
-    -15206, -10270, -7347, -7516, -7840, -5724, -1580, 3252, 6730, 6050,
-    1255, -4051, -6751, -5607, -698, 5254, 8549, 8971, 9197, 10970,
-    14278, 17104, 15357, 6978, -4749, -14389, -18547, -16938, -12672, -10171,
-    -10605, -11353, -9758, -5019, 1624, 6815, 7648, 4504, -101, -3542,
-    -3622, -164, 4326, 7390, 8444, 8198, 8565, 11249, 14650, 14899,
-    10190, 1920, -6561, -11319, -11129, -9046, -8260, -8807, -9254, -7998,
-    -3768, 1941, 5366, 4718, 979, -3974, -7089, -5541, -365, 4771,
-    7629, 7745, 6223, 6361, 10133, 14669, 15448, 10499, 696, -10025,
-    -15987, -15080, -10582, -6678, -5451, -6742, -7503, -4106, 2923, 9322,
-    11359, 7547, -621, -8158, -10171, -6135, 902, 6954, 8788, 6621,
-    4672, 6641, 11952, 16695, 16184, 8179, -4237, -14644, -18744, -16671,
-    -11651, -7782, -6938, -7238, -5747, -1567, 3993, 8187, 8264, 4096,
-    -1484, -5288, -5506, -2251, 2084, 4743, 5395, 5725, 7265, 10427,
-    13626, 13478, 7953, -1344, -10694, -16483, -16836, -13270, -9508, -7597,
-    -6779, -5446, -2372, 2336, 6416, 7356, 4886, 444, -3973, -5957,
-    -4317, -509, 3188, 5720, 7128, 8418, 10836, 13566, 13736, 9581,
-    2002, -6346, -12172, -13607, -12084, -10535, -10135, -9975, -8356, -3917,
-    2604, 7996, 9336, 6280, 689, -4301, -5702, -3074, 1110, 4007,
-    4449, 3405, 3581, 7104, 12687, 16171, 13988, 5816, -4870, -12672,
-    -14328, -11298, -7803, -6918, -8474, -9511, -6909, -563, 6203, 9465,
-    7527, 1786, -4132, -6673, -4743, -88, 4295, 6122, 5296, 4076,
-    5158, 9039, 13178, 13727, 8541, -735, -9494, -13580, -12298, -8400,
-    -5407, -4750, -5075, -4012, -586, 3851, 6733, 6290, 2826, -1561,
-    -4298, -3788, -364, 3893, 6667, 7108, 6356, 6534, 8762, 11554,
-    11529, 6409, -2587, -11309, -15572, -14149, -9602, -5946, -5119, -5774,
-    -5176, -1879, 2921, 6093, 5017, -101, -6265, -9751, -8377, -2846,
-    3594, 7575, 8326, 7980, 9254, 12726, 15754, 14182, 6053, -6005,
-    -16385, -20586, -18143, -12417, -7730, -5997, -5635, -3626, 1377, 7625,
-    11390, 9780, 3256, -4292, -8234, -6525, -1047, 4115, 6123, 5674,
-    5972, 9229, 13974, 15822, 11258, 1017, -10133, -17007, -17735, -14602,
-    -11532, -10573, -10532, -8727, -3715, 3338, 9234, 10832, 7444, 1547,
-    -2976, -3452, -22, 4561, 7058, 6553, 5227, 5953, 9127, 11960,
-    10822, 4486, -4547, -11882, -14678, -13551, -11224, -9604, -8393, -6158,
-    -2160, 2724, 6373, 6966, 4620, 1349, -553, 89, 2837, 5806,
-    7135, 6966, 7350, 9878, 13751, 15845, 12649, 3455, -7953, -15946,
-    -17689, -14803, -11206, -9838, -10439, -9940, -5686, 1632, 8427, 10980,
-    7989, 1641, -3653, -4552, -1136, 3797, 7211, 7931, 7441, 8543,
-    12316, 16372, 16613, 10730, 179, -10616, -17178, -18112, -15751, -13469,
-    -12567, -11883, -9510, -4561, 1769, 6483, 7007, 3542, -978, -3056,
-    -1025, 3655, 7521, 8366, 7296, 7298, 10185, 14578, 16319, 11884,
-    2254, -7415, -12301, -11605, -8519, -7230, -9103, -11485, -10798, -6176,
-    147, 4495, 3930, -1188, -6846, -8681, -5190, 1905, 8675, 11322,
-    9725, 7699, 8605, 12076, 14867, 13081, 4921, -6594, -15193, -17054,
-    -13572, -8760, -5905, -5789, -6229, -4349, -73, 3866, 4905, 2254,
-    -2857, -7099, -7148, -3011, 2226, 5774, 7044, 7567, 9890, 14528,
-    17831, 15249, 6400, -4650, -12652, -14189, -10283, -6231, -6295, -9308,
-    -11013, -8424, -1319, 7171, 11550, 8670, 944, -6390, -9109, -5540,
-    2080, 8352, 9558, 6889, 4174, 4466, 8133, 11852, 10846, 3767,
-    -6013, -13815, -16721, -14754, -10636, -7126, -4578, -2249, -183, 1521,
-    2956, 3340, 2075, 334, -403, -28, 1059, 2450, 3293, 3648,
-    5386, 9458, 13612, 14485, 10379, 1771, -8254, -14532, -14149, -9885,
-    -6861, -7088, -8982, -9716, -6816, -263, 6540, 9863, 8608, 3573,
-    -3082, -7428, -6553, -1600, 3985, 7318, 6909, 3962, 2243, 4087,
-    8312, 12381, 13307, 8263, -1675, -11177, -16215, -16374, -12559, -7185,
-    -4158, -4786, -6634, -7191, -5140, -67, 5664, 7924, 5373, 27,
-    -5437, -8217, -6354, -1163, 3940, 6709, 6597, 4590, 3353, 4843,
-    8141, 10904, 10973, 6743, -1176, -9370, -14387, -14895, -11536, -6777,
-    -3731, -3557, -4964, -5862, -4458, -275, 4878, 7995, 7054, 2353,
-    -3229, -6057, -4682, -199, 5143, 8393, 7815, 5518, 5079, 7278,
-    10723, 13573, 12960, 7129, -1512, -8995, -13332, -13898, -11417, -8659,
-    -7476, -7030, -6378, -5069, -1987, 2494, 5658, 5674, 2591, -2636,
-    -7073, -7311, -3657, 1008, 4951, 6982, 6379, 5188, 6233, 9609,
-    13717, 16174, 13532, 4988, -5360, -12967, -15866, -13641, -8546, -5296,
-    -5943, -8321, -9686, -8016, -2559, 4055, 7844, 7398, 3167, -3130,
-    -7184, -5653, -190, 5630, 9346, 8991, 5405, 3211, 5064, 9183,
-    13142, 14238, 9238, -827, -10459, -15930, -16550, -12846, -8141, -6631,
-    -8198, -10026, -10395, -7571, -1112, 4995, 6632, 4304, 236, -3573,
-    -4162, -609, 4169, 7668, 9165, 7967, 5559, 5519, 8235, 10931,
-    11936, 10026, 3908, -4481, -11183, -14345, -13664, -9819, -5994, -5110,
-    -6573, -8394, -8646, -5171, 1364, 6739, 8019, 5174, -454, -5007,
-    -4161, 1309, 7238, 11249, 11845, 8370, 4358, 4237, 7796, 12244,
-    14627, 11302, 1921, -8313, -14872, -16940, -14368, -9085, -5926, -6459,
-    -7823, -8266, -6973, -2433, 3699, 7355, 7434, 4513, -1077, -5737,
-    -4940, 219, 5739, 9767, 10854, 8621, 6687, 8041, 11024, 13331,
-    13416, 8688, -793, -10427, -16413, -17774, -14532, -9296, -6269, -6137,
-    -6775, -6757, -4309, 1385, 6734, 7879, 5504, 1476, -2955, -4755,
-    -1982, 3084, 7738, 10725, 10647, 8496, 8099, 10369, 12773, 13781,
-    12002, 5502, -4023, -12165, -16723, -17001, -12948, -7763, -5262, -5358,
-    -6571, -8031, -7244, -2631, 2967, 6153, 5825, 1304, -5634, -9392,
-    -7010, -1121, 5267, 10246, 11291, 8529, 5928, 6126, 8551, 11782,
-    13480, 10859, 3796, -4948, -11997, -14726, -13117, -10086, -8053, -7350,
-    -7893, -8765, -7834, -4549, -422, 3293, 5290, 4191, 1030, -1720,
-    -3184, -3020, -613, 2832, 5375, 6836, 7358, 6970, 7315, 9384,
-    11421, 11971, 10577, 5671, -2454, -9750, -13682, -14990, -13899, -11196,
-    -9732, -9685, -8401, -6012, -3795, -325, 4077, 5754, 4171, 2028,
-    -272, -2907, -3681, -1681, 1566, 5176, 8161, 8959, 8797, 10249,
-    12598, 13827, 13791, 11715, 6069, -1712, -8594, -13348, -15149, -13371,
-    -10524, -9747, -9879, -8231, -5292, -2252, 1688, 6111, 8181, 6723,
-    3370, -384, -3404, -3716, -811, 2966, 5660, 7338, 7903, 7415,
-    7959, 10957, 14326, 15297, 13009, 7188, -1542, -10105, -15318, -16557,
-    -14764, -11722, -9897, -9926, -9945, -8591, -5619, -673, 4910, 7892,
-    7056, 3720, -1002, -5140, -5419, -1701, 2713, 6200, 8754, 9110,
-    7602, 7618, 10365, 13396, 14890, 13693, 7744, -2179, -11236, -16097,
-    -17016, -14752, -10850, -8483, -8605, -8782, -7348, -4303, 599, 5987,
-    8350, 6705, 3444, -18, -3184, -4014, -1640, 1837, 5005, 7835,
-    9033, 8302, 8438, 10632, 12543, 12982, 12005, 7485, -1358, -10350,
-    -15616, -17403, -16539, -13627, -11225, -10885, -10664, -8948, -6127, -1873,
-    3751, 7865, 7884, 4596, 201, -3293, -3892, -1185, 2883, 6159,
-    7520, 6784, 5522, 6355, 9950, 14273, 16702, 15280, 9162, -306,
-    -9710, -15650, -16756, -14329, -11329, -9982, -10230, -10535, -9363, -5756,
-    106, 6181, 9477, 8556, 4502, -614, -4763, -5894, -3392, 643,
-    3732, 5355, 5701, 5108, 5507, 8549, 12605, 14907, 14352, 10109,
-    1841, -7530, -13782, -15616, -14177, -11301, -9350, -9027, -8369, -6453,
-    -4250, -1158, 3574, 7291, 7314, 4564, 595, -3695, -5745, -3692,
-    366, 3693, 5830, 6473, 5574, 5355, 7710, 11410, 14383, 15388,
-    12808, 5905, -2860, -9736, -12944, -12812, -10761, -8950, -8832, -9443,
-    -8718, -6426, -3824, -1005, 2449, 4965, 4768, 2872, 811, -1837,
-    -4611, -4997, -2447, 861, 3692, 5933, 6808, 6552, 7155, 9455,
-    12246, 14148, 13827, 9977, 2926, -5152, -11758, -14976, -14514, -12303,
-    -10423, -9148, -8085, -7321, -6509, -4598, -1018, 3321, 6146, 5531,
-    1760, -3263, -7449, -8632, -5784, -714, 4001, 7610, 9513, 8789,
-    7391, 8818, 12824, 16289, 17680, 16179, 10210, 705, -8189, -13393,
-    -14385, -11803, -8069, -6566, -7720, -9030, -9159, -8123, -4995, 217,
-    4521, 5290, 3161, -349, -4431, -7076, -5994, -2089, 1850, 4942,
-    7181, 7521, 6584, 7381, 10672, 13988, 15891, 16028, 12249, 3505,
-    -6449, -12870, -14813, -13740, -11299, -9558, -9619, -10101, -9398, -7506,
-    -4325, 463, 5043, 6586, 4915, 1987, -1189, -4169, -5458, -4130,
-    -1160, 2479, 6431, 9206, 9467, 8832, 9731, 11838, 13788, 15241,
-    14443, 8430, -1821, -11215, -16458, -17690, -15595, -11682, -9094, -9113,
-    -9593, -8769, -6873, -3642, 1301, 5926, 7493, 5677, 1634, -3414,
-    -7079, -6749, -2781, 2112, 6079, 8158, 7565, 5710, 5932, 9213,
-    13264, 15937, 15880, 11273, 2172, -7623, -14077, -16111, -14378, -10440,
-    -7335, -7222, -8683, -8947, -7231, -3885, 1055, 6260, 8762, 7180,
-    3053, -1699, -5773, -7120, -4406, 418, 4297, 6428, 6992, 5934,
-    5114, 7188, 11351, 14625, 15998, 14925, 9530, 538, -7599, -11980,
-    -13106, -11930, -9782, -9019, -10084, -10857, -10176, -8343, -4985, -238,
-    3733, 5045, 3875, 1131, -2191, -4485, -4509, -2532, 466, 3814,
-    6907, 8997, 9877, 10341, 11401, 13301, 15439, 16381, 13888, 6734,
-    -3076, -11578, -16142, -16388, -13532, -10182, -8739, -9164, -9882, -9822,
-    -7922, -3159, 3037, 7146, 7396, 4778, 719, -3269, -4819, -2688,
-    1487, 5483, 8649, 10417, 9756, 7871, 7981, 10980, 14669, 17274,
-    17546, 12939, 2805, -8567, -16290, -19427, -19065, -16405, -13896, -13569,
-    -14271, -13833, -12011, -8984, -4022, 2467, 7928, 9752, 7544, 3191,
-    -1142, -4312, -5128, -2477, 2170, 5740, 7673, 9233, 9921, 9177,
-    9017, 10827, 12969, 13810, 12955, 9215, 1859, -6994, -14332, -18650,
-    -19298, -16459, -12212, -9164, -8234, -8647, -8917, -7615, -4235, 625,
-    5709, 9147, 9234, 5978, 958, -4032, -7112, -6724, -3337, 998,
-    5028, 8048, 8715, 7265, 6816, 9342, 13031, 15677, 16649, 14244,
-    6366, -4930, -14394, -19159, -19475, -16029, -10745, -7369, -7474, -8606,
-    -8303, -6552, -3413, 1754, 7593, 10566, 8863, 4355, -295, -4111,
-    -6015, -4004, 1186, 5404, 6747, 7250, 7501, 6152, 5129, 7661,
-    12039, 14460, 14718, 13030, 7069, -2669, -11119, -15208, -15919, -14052,
-    -10284, -7471, -7558, -8712, -8484, -6451, -2707, 2536, 7543, 10018,
-    9201, 5759, 891, -3709, -6307, -6264, -4283, -1471, 1532, 4331,
-    6114, 6376, 6266, 7564, 10258, 12871, 14358, 13553, 8666, 137,
-    -8262, -13424, -15224, -14140, -10731, -7483, -6605, -6768, -5845, -4425,
-    -3282, -1007, 2849, 5878, 6184, 4471, 1735, -2073, -6054, -7659,
-    -5595, -1674, 1955, 5359, 8510, 9605, 8588, 8552, 10908, 13529,
-    14974, 15131, 11968, 3832, -6134, -13142, -15940, -15404, -12130, -8097,
-    -6365, -7405, -8950, -9322, -8170, -5217, -907, 2786, 3998, 2618,
-    -364, -3852, -6321, -6175, -3425, 292, 3888, 7238, 9429, 9228,
-    7619, 7298, 9452, 12925, 15912, 16587, 13092, 5088, -4910, -13062,
-    -16989, -16725, -13864, -10681, -9130, -9357, -9703, -8733, -6233, -2197,
-    3041, 7603, 9220, 7513, 3531, -1653, -6244, -7648, -5026, -386,
-    3846, 6699, 7843, 7203, 5990, 6202, 8433, 11509, 14061, 14753,
-    11702, 4202, -5287, -12915, -16586, -16277, -13057, -9036, -6545, -6428,
-    -7785, -8828, -7637, -3483, 2241, 7188, 9551, 8377, 4060, -1378,
-    -5654, -7398, -6098, -2603, 920, 3188, 4585, 5194, 4889, 5207,
-    7706, 11323, 14214, 16038, 16127, 12566, 5174, -3327, -10105, -14049,
-    -15020, -13424, -10643, -8486, -7794, -7899, -7703, -6810, -5101, -2136,
-    1810, 5092, 6295, 5432, 2919, -915, -4854, -7092, -6788, -4236,
-    -100, 4511, 8091, 9591, 8987, 7422, 7004, 9137, 12790, 15595,
-    15922, 12678, 5256, -4526, -12863, -17530, -18629, -16478, -12230, -8950,
-    -8467, -9180, -9236, -8626, -6929, -2995, 2433, 6970, 9037, 8228,
-    4859, 290, -3701, -5775, -4919, -1296, 2999, 6109, 8089, 8967,
-    8197, 7239, 8716, 12303, 15282, 16538, 16177, 12845, 5426, -3942,
-    -11553, -15681, -16702, -15369, -12721, -10442, -9521, -9124, -8060, -6485,
-    -4811, -2168, 2025, 6014, 7311, 5507, 1876, -2482, -6491, -8461,
-    -7319, -3697, 959, 5455, 8777, 10250, 10197, 9802, 10156, 11532,
-    13334, 14586, 14245, 11002, 4041, -5134, -13119, -17653, -18573, -16150,
-    -11544, -7988, -7786, -9213, -9417, -8047, -5537, -1198, 4457, 8572,
-    8945, 6127, 1978, -2153, -5450, -6824, -5269, -1470, 2321, 4982,
-    7175, 8714, 8432, 7257, 7686, 9898, 11854, 12629, 12254, 9481,
-    3106, -5304, -12496, -16622, -17631, -15725, -11522, -7278, -5580, -6428,
-    -7415, -6927, -5212, -2512, 1367, 5381, 7319, 6079, 2526, -1901,
-    -6060, -8512, -7715, -3664, 1616, 5959, 8550, 9345, 8661, 7906,
-    8900, 11795, 14909, 16601, 15909, 11914, 4478, -4426, -11686, -15458,
-    -15803, -13603, -10192, -7465, -6751, -7547, -8289, -7947, -6175, -2809,
-    1674, 5670, 7285, 5725, 1758, -2984, -6781, -7963, -5468, -254,
-    4870, 7917, 9032, 8803, 7632, 7128, 9157, 13018, 16054, 16690,
-    14640, 9469, 1500, -6986, -13283, -16218, -16057, -13842, -11194, -9601,
-    -9393, -9730, -9484, -8021, -5370, -1878, 2017, 5392, 6816, 5589,
-    2646, -543, -3181, -4472, -3252, 310, 4178, 6869, 8602, 9354,
-    8562, 7459, 8500, 11770, 14868, 16187, 15403, 11664, 4550, -3950,
-    -10888, -14903, -16086, -14976, -12753, -10905, -10051, -9851, -9721, -9063,
-    -7592, -5604, -3177, 86, 3512, 5141, 4204, 1928, -786, -3987,
-    -6617, -6702, -3946, 152, 4450, 8397, 10902, 10996, 9279, 7620,
-    7675, 9817, 12958, 15307, 15346, 11998, 4890, -4472, -12792, -17539,
-    -18585, -16827, -13099, -9140, -7252, -7879, -9271, -9868, -9240, -6982,
-    -2807, 2319, 6491, 8094, 6530, 2647, -1618, -4776, -6280, -5474,
-    -2095, 2183, 5238, 7120, 8623, 8789, 7069, 5893, 7630, 11099,
-    13942, 15706, 16021, 12862, 5317, -4157, -12003, -16331, -16970, -14780,
-    -11492, -9010, -8374, -9321, -10364, -9843, -7565, -4590, -1183, 3092,
-    7061, 8382, 6736, 3950, 960, -2478, -5275, -5301, -2325, 1723,
-    5350, 8355, 10299, 10182, 8259, 6819, 7957, 11167, 14306, 16113,
-    16009, 12455, 4476, -5499, -13241, -16956, -17525, -15646, -11779, -8012,
-    -6774, -7939, -9327, -9504, -8381, -5881, -1770, 3249, 7267, 8340,
-    6114, 2122, -1893, -5300, -7432, -6698, -2719, 2218, 5855, 8203,
-    9453, 8628, 6354, 5723, 8281, 12009, 14567, 15543, 14597, 10457,
-    3074, -5218, -11687, -15230, -16118, -14858, -12132, -9322, -8005, -8445,
-    -9190, -8741, -7049, -4606, -1049, 3683, 7673, 8686, 6932, 4122,
-    859, -2743, -5140, -4596, -1566, 1981, 4947, 7415, 9124, 9182,
-    7798, 7038, 8480, 11109, 13054, 13907, 13417, 9911, 2538, -6498,
-    -13993, -18551, -20073, -18477, -14608, -10905, -9352, -9506, -9681, -9053,
-    -7453, -4368, 308, 5311, 8774, 9493, 7405, 3553, -579, -3921,
-    -5647, -4970, -2150, 1307, 4356, 7024, 8957, 9295, 8413, 8031,
-    9205, 11445, 13688, 14951, 14085, 10042, 2879, -5785, -13416, -17823,
-    -18374, -16135, -12689, -9382, -7614, -8082, -9389, -9348, -7587, -4900,
-    -1248, 3093, 6136, 6328, 4416, 1777, -1116, -3790, -5157, -4434,
-    -1866, 1581, 5024, 7935, 9568, 9187, 7577, 6928, 8363, 10930,
-    13313, 14802, 14303, 10256, 2560, -6267, -12972, -16235, -16550, -14579,
-    -11469, -9379, -9329, -9879, -9463, -7982, -5317, -1093, 3607, 6726,
-    7315, 5649, 2292, -1798, -5108, -6203, -4472, -661, 3493, 6626,
-    8282, 8324, 7287, 7029, 9066, 12609, 15754, 17420, 16440, 10943,
-    1174, -9044, -15950, -18809, -18164, -14657, -10675, -9122, -9789, -10319,
-    -9869, -8587, -5603, -629, 4503, 7652, 7927, 5427, 1120, -3430,
-    -6743, -7425, -4702, 285, 5231, 8662, 9965, 8963, 6957, 6315,
-    8157, 11720, 15454, 17506, 16158, 10666, 1695, -8284, -15522, -17746,
-    -15889, -12251, -8747, -7066, -7719, -8998, -9040, -7663, -4911, -293,
-    5314, 9330, 9879, 7245, 2920, -1731, -5570, -7143, -5382, -1135,
-    3390, 6829, 8733, 8448, 6384, 5184, 6962, 10721, 14383, 16960,
-    16853, 11432, 1034, -9706, -16803, -20003, -19810, -16058, -10804, -7735,
-    -7581, -8051, -7807, -6751, -3973, 1140, 7044, 11131, 11602, 8160,
-    2128, -4210, -8614, -9341, -6051, -655, 4190, 7193, 8167, 7401,
-    6302, 6810, 9590, 13664, 17080, 17643, 14313, 7761, -817, -9724,
-    -16060, -17921, -16681, -14765, -12962, -11531, -11035, -10733, -8968, -5674,
-    -2179, 1040, 4210, 6501, 6401, 3765, 107, -3174, -5542, -6312,
-    -4802, -1764, 1247, 3928, 6659, 8672, 9270, 9789, 11752, 14250,
-    15423, 14955, 12927, 8194, 456, -7825, -13823, -16883, -17200, -14772,
-    -11146, -8949, -8442, -7672, -6103, -4620, -2777, 397, 3960, 6158,
-    6454, 4809, 1130, -3425, -6536, -6667, -3817, 1137, 6596, 10472,
-    11478, 10044, 7753, 6373, 7279, 10634, 14609, 16187, 13385, 6479,
-    -2631, -11331, -16828, -17488, -14264, -9940, -6830, -5835, -6968, -9258,
-    -10600, -9335, -5785, -1194, 3719, 7851, 9080, 6515, 1954, -2283,
-    -5132, -5681, -3071, 1520, 5386, 7239, 7466, 6233, 4056, 3202,
-    5701, 10707, 15627, 18369, 17220, 10901, 671, -9387, -15640, -17285,
-    -15373, -11585, -8239, -7175, -7939, -8487, -7495, -4707, -70, 5618,
-    10071, 11183, 8704, 3580, -2837, -8328, -10440, -8638, -4594, -103,
-    3882, 6409, 6874, 6485, 7441, 10257, 13422, 15420, 15151, 11069,
-    2621, -7709, -16042, -20287, -20260, -16489, -10858, -6439, -4779, -4798,
-    -4946, -4466, -2547, 1272, 5629, 8058, 7112, 2923, -3155, -8510,
-    -10339, -7819, -2379, 3978, 9303, 11654, 10573, 8099, 6861, 7910,
-    10884, 14424, 15897, 12709, 4735, -5341, -13881, -18117, -17335, -13261,
-    -9051, -7320, -8522, -10860, -12019, -10894, -7401, -2011, 3438, 6256,
-    5549, 2804, -419, -3184, -4030, -1937, 1916, 5478, 7934, 8992,
-    8069, 6022, 5464, 7552, 10586, 12799, 13572, 11529, 5445, -2630,
-    -8942, -12092, -12561, -10668, -7839, -6698, -7904, -9674, -10406, -9258,
-    -5762, -794, 3761, 6478, 6294, 2975, -1396, -3930, -3656, -919,
-    3615, 7956, 9859, 9318, 7740, 6176, 5849, 7777, 11150, 13986,
-    14463, 11024, 3654, -5028, -11963, -15634, -15334, -11504, -6933, -4702,
-    -5334, -7355, -8990, -8721, -5933, -1406, 3217, 6059, 5756, 2499,
-    -2143, -6202, -7599, -5096, 96, 5253, 8839, 10655, 10374, 8322,
-    6668, 7378, 9723, 11688, 12509, 11624, 7195, -1178, -10230, -16158,
-    -17690, -15096, -9944, -5739, -4803, -5819, -6885, -7486, -6481, -2762,
-    2306, 6433, 8176, 6274, 1194, -3681, -5882, -5767, -3373, 1468,
-    6393, 8863, 9058, 7847, 6013, 5761, 8509, 12523, 15204, 14856,
-    10188, 1675, -7808, -15538, -19925, -19918, -16486, -12590, -9970, -8487,
-    -7933, -7557, -5757, -2165, 2085, 5989, 8488, 8315, 5348, 614,
-    -4513, -7899, -7521, -3656, 1633, 6561, 9737, 10274, 9203, 8787,
-    9945, 11996, 14180, 15355, 13271, 6630, -2677, -11233, -16858, -18453,
-    -15794, -11191, -8169, -7429, -7234, -6863, -6176, -4141, -695, 2748,
-    5239, 5828, 3253, -1389, -5181, -7130, -7302, -4454, 1210, 6548,
-    9395, 10015, 8871, 7027, 6794, 8971, 11818, 13392, 12371, 7709,
-    -70, -8221, -13485, -14286, -11758, -8666, -6981, -7011, -8005, -8320,
-    -6409, -2566, 1587, 4565, 4967, 2422, -1032, -3101, -3494, -2297,
-    515, 3134, 3662, 3189, 3686, 5280, 7737, 11030, 13688, 13887,
-    11398, 6578, -167, -6842, -10582, -10618, -8810, -7509, -7989, -10172,
-    -12555, -12822, -9806, -4581, 1098, 5944, 8097, 6018, 1213, -3075,
-    -5299, -4985, -1589, 3477, 7314, 8774, 8013, 5157, 2364, 2990,
-    7089, 11795, 14815, 14056, 7644, -2786, -12435, -17645, -17580, -13705,
-    -9220, -6731, -6306, -6762, -7046, -6133, -3594, -20, 3412, 4979,
-    3590, 667, -1405, -1916, -916, 1640, 4640, 6866, 8575, 9822,
-    10283, 11251, 13576, 15204, 14233, 10800, 4721, -3708, -11402, -15395,
-    -15681, -13419, -10132, -8144, -8312, -9105, -9000, -7105, -2728, 2933,
-    6857, 7040, 3454, -2532, -8089, -10281, -8081, -2399, 4306, 8826,
-    9868, 8860, 7498, 7122, 9369, 14103, 18463, 19573, 15858, 6902,
-    -4915, -14812, -19501, -18775, -14315, -9277, -6786, -7280, -8982, -10049,
-    -8912, -4784, 1184, 6549, 8934, 6986, 1673, -4136, -7945, -8147,
-    -4054, 2488, 8125, 11297, 11908, 10050, 7749, 8006, 10856, 14102,
-    15881, 13654, 5527, -5738, -14970, -19648, -19430, -15211, -10513, -8659,
-    -8997, -9490, -9415, -7667, -3370, 1570, 4413, 4462, 2285, -1069,
-    -3783, -4437, -2784, 838, 5246, 8459, 9491, 9180, 9157, 10566,
-    13067, 15183, 15769, 13842, 8127, -657, -8986, -14007, -15446, -14060,
-    -11348, -9458, -9059, -9252, -9481, -8885, -5904, -954, 3386, 5500,
-    5168, 2391, -1566, -4206, -4151, -1561, 2907, 7719, 10700, 10892,
-    9147, 7269, 7247, 10060, 14467, 17433, 15820, 8321, -3174, -14249,
-    -20575, -20406, -15558, -10127, -7299, -7453, -9256, -10951, -10509, -6604,
-    -11, 6524, 9717, 7678, 1524, -5146, -8665, -7258, -1766, 4994,
-    10193, 12240, 10830, 7654, 6157, 8408, 13207, 17710, 18658, 13362,
-    2687, -8706, -16618, -19263, -16419, -10570, -6323, -5676, -6970, -8376,
-    -8237, -4479, 2143, 7505, 8718, 5732, -317, -6441, -8552, -5794,
-    -818, 4189, 7885, 8609, 6872, 5992, 7716, 10572, 12836, 13128,
-    9314, 1087, -7978, -13946, -15807, -14238, -10876, -8743, -9260, -10066,
-    -8841, -5984, -1801, 3614, 7363, 6417, 2053, -2705, -6284, -6919,
-    -3437, 1898, 6050, 8315, 8295, 6095, 4964, 7763, 12633, 16177,
-    16393, 11235, 725, -10345, -17065, -18565, -15642, -10095, -6099, -6281,
-    -8556, -10071, -9655, -5945, 890, 6883, 8443, 5857, 750, -5109,
-    -8417, -6781, -1570, 4442, 9362, 11328, 9689, 7034, 6583, 8816,
-    12254, 14565, 12584, 5197, -4245, -11396, -14806, -14786, -12315, -9895,
-    -9314, -9216, -8045, -6358, -4105, -476, 2739, 3032, 1307, -361,
-    -1742, -2113, -29, 3286, 5526, 6967, 8218, 8245, 7799, 9464,
-    12826, 14830, 13955, 9879, 2447, -5878, -10909, -11486, -9648, -7356,
-    -6204, -7231, -8952, -8973, -7236, -4531, -735, 2784, 3324, 770,
-    -2786, -6064, -7597, -5410, -349, 4577, 8206, 10371, 10223, 9033,
-    9793, 12353, 14120, 14109, 11539, 4754, -4806, -12660, -16307, -15878,
-    -12248, -7944, -5886, -5926, -6229, -5990, -4141, 112, 4418, 5642,
-    3705, -237, -5204, -8453, -7488, -3521, 1167, 5866, 9092, 9246,
-    8326, 9433, 12158, 14685, 16296, 15020, 8428, -1682, -10474, -15344,
-    -16155, -13364, -9305, -7408, -8005, -8508, -7416, -4629, -71, 4724,
-    6721, 4938, 1008, -3240, -5910, -5291, -2224, 812, 2979, 4344,
-    4509, 4671, 7037, 11065, 14344, 15539, 13144, 5785, -3830, -10624,
-    -12900, -11896, -8819, -6157, -6937, -10303, -12459, -11404, -7000, 244,
-    7325, 9794, 6507, 343, -5101, -7176, -4739, 848, 6596, 10008,
-    9892, 6952, 4196, 4637, 8351, 12994, 15725, 13738, 5854, -5127,
-    -14149, -18073, -16562, -11308, -6382, -5609, -8098, -9984, -9583, -6940,
-    -1873, 3633, 5788, 3962, 600, -2783, -4944, -3745, 693, 5512,
-    8556, 9064, 7348, 5931, 7330, 10702, 13471, 13493, 8798, -98,
-    -8745, -13380, -13715, -10587, -6289, -4892, -7059, -9040, -8885, -7339,
-    -4155, 89, 2458, 1854, -176, -2676, -4484, -3369, 871, 6143,
-    10683, 13105, 12818, 11449, 10554, 9686, 8550, 6964, 3339, -2278,
-    -6921, -9161, -9941, -9346, -7694, -6749, -6550, -5473, -3699, -2362,
-    -1554, -1608, -3070, -5421, -7892, -9321, -7675, -2783, 3026, 8171,
-    11663, 12015, 10513, 10672, 12640, 14115, 14386, 11938, 4318, -6150,
-    -13924, -16937, -15759, -11108, -5893, -3286, -2774, -2743, -2693, -1287,
-    1687, 3391, 2428, 15, -3743, -7833, -8466, -4841, -89, 4630,
-    9019, 10685, 10085, 11042, 13532, 14447, 13321, 10064, 3157, -5582,
-    -11623, -13418, -12153, -9299, -6986, -6368, -6095, -4907, -2600, 1050,
-    4590, 5266, 2915, -776, -4958, -7699, -6473, -2356, 1852, 5569,
-    8066, 7913, 6792, 7489, 9438, 10651, 9643, 4652, -3494, -10364,
-    -13243, -12607, -9320, -5975, -5977, -7912, -7838, -5584, -1856, 4040,
-    9075, 8700, 4252, -537, -4715, -6177, -2241, 4289, 8646, 10052,
-    8786, 5202, 2856, 4582, 8333, 11038, 10477, 4415, -5440, -13472,
-    -17115, -16978, -13068, -7890, -5978, -6810, -6912, -6336, -5067, -929,
-    4220, 6064, 4952, 3019, 228, -1650, 317, 4831, 8673, 10807,
-    10751, 8743, 7101, 6883, 6787, 6146, 4187, -526, -6540, -10682,
-    -12505, -12504, -10385, -8012, -7589, -7662, -6442, -4579, -2062, 1294,
-    3347, 2807, 963, -1240, -2757, -1619, 1831, 5605, 9313, 11978,
-    11728, 10336, 10716, 11518, 10876, 9356, 5695, -1525, -8879, -12714,
-    -13608, -12240, -8900, -6583, -7040, -7871, -7164, -4931, -1028, 2938,
-    3996, 2054, -1225, -4894, -6569, -4047, 696, 5083, 9056, 11240,
-    10015, 8349, 9546, 12114, 13716, 13210, 8234, -1367, -10533, -14759,
-    -14166, -10813, -7364, -6436, -7681, -8341, -6708, -2627, 2574, 5844,
-    5301, 1976, -2554, -6485, -6915, -3008, 2561, 7284, 10100, 10309,
-    9276, 10124, 13361, 16163, 15544, 9853, -16, -9835, -15303, -15427,
-    -11895, -7949, -6826, -8290, -8948, -6798, -2282, 3269, 6975, 5685,
-    8, -6199, -9713, -8923, -3931, 2487, 6695, 7348, 5859, 5114,
-    7424, 12051, 15570, 14836, 8728, -971, -9636, -13506, -13079, -10956,
-    -8944, -8365, -9267, -9186, -6012, -842, 3773, 6005, 4820, 690,
-    -3824, -5714, -3676, 1107, 5851, 8320, 8203, 6846, 6637, 9253,
-    13022, 13892, 9656, 1407, -7902, -14407, -15374, -12012, -8208, -6566,
-    -7136, -8354, -8044, -5054, -359, 3756, 5051, 2717, -1647, -5289,
-    -6231, -3532, 2110, 7709, 10599, 11059, 10729, 10817, 12103, 13460,
-    11664, 5424, -2864, -10087, -14035, -13736, -11024, -9006, -8139, -7004,
-    -5176, -2471, 1217, 4064, 4102, 2040, -588, -3202, -4564, -3314,
-    -303, 2746, 5566, 8337, 10668, 12572, 14247, 14633, 12069, 6552,
-    149, -4995, -8059, -9149, -9186, -9870, -11600, -12161, -9487, -4144,
-    1949, 6617, 7281, 3127, -3058, -7391, -7774, -3989, 2210, 7188,
-    8117, 5535, 2631, 2755, 7009, 13096, 16695, 14322, 5690, -5438,
-    -13548, -15731, -13075, -8536, -5292, -5208, -6885, -7222, -5160, -1622,
-    2295, 4762, 3944, 722, -2233, -3476, -2508, 915, 5262, 8026,
-    8869, 9400, 10465, 11627, 11932, 9809, 4048, -3900, -10224, -12400,
-    -11176, -8670, -6683, -6639, -8055, -7798, -3945, 1548, 5966, 7893,
-    5848, 43, -5556, -7341, -5405, -878, 4881, 8638, 8505, 6957,
-    6957, 8704, 11175, 12296, 8905, 517, -9083, -15627, -17260, -14632,
-    -10527, -7920, -7370, -7160, -5164, -586, 4781, 7919, 7461, 3823,
-    -1580, -5617, -5440, -1808, 2812, 7187, 9856, 9638, 8817, 10376,
-    13241, 14606, 13167, 7696, -1916, -11686, -16890, -17162, -15039, -12542,
-    -10970, -10582, -9572, -5779, 250, 5283, 6655, 4474, 461, -3352,
-    -4478, -1778, 2386, 5050, 6073, 6120, 5419, 6007, 9647, 13978,
-    15741, 14387, 9459, 656, -8499, -13718, -14991, -13944, -11169, -8758,
-    -9194, -11239, -11930, -10452, -7013, -1815, 3317, 5854, 5127, 2116,
-    -1860, -5167, -6060, -3770, 823, 5780, 9314, 10216, 8169, 5009,
-    3966, 6137, 9791, 12920, 13292, 8280, -1342, -10647, -16084, -17547,
-    -15202, -10009, -5743, -5191, -6790, -8026, -8261, -6696, -2202, 3643,
-    7146, 6691, 3552, -858, -5217, -6877, -4304, 197, 3676, 5877,
-    6897, 6172, 5409, 7038, 10001, 11934, 12388, 10402, 4406, -3698,
-    -10159, -13981, -15426, -14091, -11563, -10617, -10861, -9979, -7578, -4192,
-    257, 4638, 6711, 6081, 4391, 2744, 1145, 100, 460, 1655,
-    2351, 2680, 3318, 3659, 3775, 5464, 8867, 11833, 13291, 12807,
-    8869, 2061, -4066, -7826, -9950, -10132, -8752, -8628, -10542, -11950,
-    -11778, -10788, -8170, -3238, 1853, 4733, 5370, 4349, 1627, -1796,
-    -3225, -1038, 3033, 6331, 8206, 8379, 6085, 3307, 3720, 7110,
-    10404, 12479, 12474, 8209, 712, -5802, -9656, -11329, -10296, -7680,
-    -6841, -8358, -9957, -10691, -10131, -6958, -1978, 1774, 3007, 2433,
-    505, -1933, -2909, -1276, 2125, 5786, 8706, 10109, 9474, 7934,
-    8089, 10805, 14097, 15940, 15034, 9703, 562, -7957, -12612, -13987,
-    -12863, -9917, -8184, -9599, -11865, -12675, -12025, -9179, -3577, 2048,
-    4610, 4100, 1485, -2570, -5864, -5751, -2246, 2581, 7227, 10850,
-    12205, 10802, 8661, 8558, 10807, 13936, 16763, 17006, 11431, 681,
-    -10072, -16855, -18794, -15878, -10233, -6594, -7173, -9568, -10941, -9921,
-    -5654, 675, 5494, 6418, 3819, -880, -5540, -7335, -5021, -134,
-    4822, 8122, 9022, 7981, 7070, 8695, 12988, 17454, 19501, 17690,
-    11275, 1570, -7499, -13027, -15158, -14563, -12038, -10065, -10066, -10182,
-    -9051, -7524, -5339, -1652, 1785, 3110, 3173, 2443, -318, -4404,
-    -6900, -6372, -3272, 1888, 7899, 12111, 12748, 11117, 10082, 10912,
-    12954, 15147, 15613, 11626, 2996, -6682, -13977, -17549, -16414, -11184,
-    -5804, -3684, -4477, -6574, -8518, -7881, -3493, 2241, 6137, 6866,
-    4211, -782, -5338, -7162, -5951, -2398, 2159, 5805, 7503, 7655,
-    7158, 7106, 8483, 11165, 13867, 14920, 12899, 7581, 239, -7390,
-    -13524, -16472, -16126, -14086, -11636, -9579, -9014, -9609, -9289, -7195,
-    -3922, 492, 5083, 7077, 5626, 2673, -659, -3786, -4370, -1282,
-    2998, 6142, 8153, 8780, 7451, 5807, 6333, 9026, 11867, 13379,
-    12938, 9648, 3114, -4696, -10648, -13738, -14743, -13556, -10421, -7869,
-    -7601, -8155, -8170, -7894, -6537, -2893, 1660, 4652, 5270, 3527,
-    -311, -4467, -6437, -4972, -386, 5573, 10265, 12058, 11190, 8909,
-    7202, 8020, 11106, 14039, 14582, 11484, 4538, -4340, -11879, -16006,
-    -16358, -13580, -9555, -6527, -5264, -5200, -5466, -4983, -2976, 306,
-    3963, 6648, 6825, 4249, 135, -4346, -7607, -7188, -2730, 2997,
-    7774, 11001, 11475, 9033, 6909, 8012, 11378, 14746, 16670, 15035,
-    8075, -2364, -11735, -16912, -17660, -15080, -10829, -7509, -7185, -8768,
-    -9254, -7744, -5274, -1898, 2134, 4539, 4143, 2673, 1123, -1215,
-    -3389, -3307, -1075, 1955, 5440, 8825, 10533, 9930, 8282, 7386,
-    8131, 10115, 12088, 12342, 8945, 1384, -7732, -14498, -16911, -15041,
-    -10262, -5707, -4583, -6949, -10156, -11728, -10243, -5442, 950, 5999,
-    7812, 6461, 3270, -167, -2468, -2461, 130, 3875, 7033, 9279,
-    10420, 9514, 7289, 6336, 7411, 8945, 10101, 10453, 8048, 1776,
-    -5967, -11871, -15027, -15920, -14650, -12017, -10171, -10139, -10370, -9329,
-    -7386, -4760, -724, 3806, 6390, 6286, 4367, 1092, -2321, -3227,
-    -660, 3545, 7470, 10018, 10084, 7885, 5856, 6183, 8728, 11982,
-    14347, 14084, 9656, 1432, -7531, -13831, -16388, -15683, -12310, -8218,
-    -6478, -7627, -9084, -9008, -7385, -3934, 1244, 5849, 7217, 5066,
-    932, -3651, -7221, -7892, -4587, 1196, 6460, 9708, 11083, 10444,
-    8274, 7046, 8430, 11026, 12996, 13860, 12489, 7280, -746, -8266,
-    -13107, -15031, -14071, -10663, -6950, -5469, -6221, -7066, -7012, -6455,
-    -4745, -1210, 2335, 3771, 3538, 2482, 53, -3257, -5322, -5081,
-    -2898, 933, 5622, 9469, 11292, 10947, 8955, 6892, 6694, 8639,
-    11233, 12804, 12024, 7898, 796, -6889, -12198, -13948, -13100, -10896,
-    -8107, -6222, -6745, -8739, -9748, -9034, -7195, -3862, 1045, 5236,
-    6120, 3801, 181, -3379, -5870, -5601, -1757, 3501, 6867, 7593,
-    7100, 6008, 4652, 4911, 7887, 11369, 12640, 11619, 8982, 4223,
-    -2202, -7721, -10610, -11702, -11877, -10647, -8414, -7097, -7185, -7070,
-    -6071, -4923, -3220, 35, 3733, 5722, 5600, 4080, 1415, -1641,
-    -3302, -2505, 53, 2916, 5014, 6032, 6198, 5898, 5754, 6651,
-    8709, 10685, 11366, 10707, 8767, 4959, -475, -5776, -9604, -12183,
-    -13630, -13183, -11105, -9193, -8348, -7726, -6758, -5747, -4306, -1512,
-    2197, 4990, 5607, 4359, 2195, -342, -2679, -3524, -2117, 310,
-    2147, 3649, 5555, 7004, 7269, 7657, 9274, 10967, 11472, 11263,
-    10486, 7579, 1907, -4435, -9258, -12518, -14375, -13835, -11197, -8951,
-    -8431, -8384, -7779, -6921, -5396, -2188, 1988, 4967, 5547, 4054,
-    1217, -2183, -4912, -5498, -3412, 178, 3568, 6148, 7957, 8559,
-    8003, 7833, 9267, 11457, 12961, 13320, 11900, 7381, 31, -7476,
-    -12819, -15604, -15715, -12938, -8927, -6530, -6547, -7597, -8658, -9066,
-    -7228, -2327, 3718, 8044, 9328, 7505, 3050, -2295, -5737, -5447,
-    -1846, 3162, 7586, 10025, 9877, 7702, 5409, 5214, 7777, 11699,
-    14950, 15994, 13602, 7260, -1483, -9442, -14359, -16028, -14889, -11511,
-    -7761, -6144, -7190, -9153, -10362, -10084, -7521, -2316, 3868, 8068,
-    8514, 5559, 681, -4333, -7458, -6938, -2633, 3328, 8078, 10272,
-    10222, 8506, 6155, 5424, 7897, 12158, 15416, 16388, 14583, 8925,
-    -146, -9252, -15219, -17628, -16948, -13271, -8262, -5069, -4942, -6452,
-    -8111, -9049, -7830, -3687, 1684, 5781, 7601, 6963, 3735, -814,
-    -4144, -4978, -3884, -1371, 2316, 5915, 7962, 8555, 8667, 8550,
-    8231, 8481, 9851, 11563, 12340, 11630, 9303, 5016, -1145, -7810,
-    -13059, -15965, -16750, -15748, -13274, -10463, -8851, -8763, -9121, -8944,
-    -7914, -5661, -1936, 2395, 5695, 6848, 5636, 2489, -1415, -4452,
-    -5439, -4004, -517, 3697, 6903, 8384, 8594, 8025, 7334, 7987,
-    10701, 13904, 15592, 15423, 13260, 8000, 9, -7752, -13007, -16034,
-    -17192, -15850, -12825, -10551, -9990, -10033, -9915, -9547, -8117, -4915,
-    -859, 2529, 4579, 4866, 2942, -433, -3423, -4868, -4563, -2351,
-    1403, 5166, 7608, 8820, 9280, 9057, 8848, 10004, 12560, 14834,
-    15574, 14846, 12409, 7356, 217, -6488, -10879, -13301, -14427, -13773,
-    -11445, -9363, -8965, -9304, -8994, -8229, -7297, -5145, -1253, 2869,
-    5582, 6718, 6316, 3903, 69, -3134, -4167, -2975, -73, 3824,
-    7417, 9357, 9155, 7346, 5404, 5221, 7510, 11072, 14286, 16078,
-    14882, 9087, -221, -9226, -15092, -17590, -16984, -13458, -9036, -6883,
-    -7956, -10471, -12468, -12801, -10372, -4822, 2202, 8007, 10759, 9931,
-    5989, 487, -4339, -6730, -6080, -2961, 1084, 4355, 6106, 6510,
-    5842, 4732, 4764, 7218, 11248, 14690, 16413, 16337, 13675, 7467,
-    -1002, -8509, -13158, -15448, -15805, -13616, -9617, -6631, -6377, -7593,
-    -8463, -8646, -7738, -4416, 1206, 6493, 8976, 8353, 5206, 61,
-    -5445, -8655, -8151, -4688, 209, 5212, 8884, 9967, 8383, 5538,
-    3571, 4113, 7176, 11250, 14538, 15562, 12891, 5989, -3230, -11277,
-    -15947, -17173, -15474, -11576, -7406, -5288, -5745, -7400, -8773, -8962,
-    -7191, -3261, 1644, 5601, 7308, 6467, 3429, -817, -4609, -6214,
-    -4865, -1263, 3010, 6612, 8867, 9396, 8181, 6298, 5617, 7052,
-    9635, 11855, 13104, 13074, 10719, 5258, -2097, -8784, -13278, -15679,
-    -16070, -14075, -10511, -7692, -7046, -7715, -8286, -8446, -8096, -6445,
-    -3159, 719, 3900, 5866, 6311, 4784, 1524, -2207, -5006, -5921,
-    -4413, -639, 4153, 8157, 10086, 9701, 7695, 5363, 4102, 4839,
-    7643, 11519, 14591, 15015, 12054, 6220, -1261, -8720, -14285, -16772,
-    -16391, -14273, -11587, -9326, -8252, -8398, -8921, -8864, -7806, -5648,
-    -2334, 1764, 5527, 7695, 7744, 5908, 2550, -1886, -6224, -8626,
-    -7928, -4620, -115, 4468, 8313, 10382, 10029, 8141, 6758, 7261,
-    9405, 12153, 14660, 15981, 14629, 9549, 1583, -6784, -13321, -17133,
-    -18097, -16377, -12971, -9770, -8194, -8066, -8220, -7787, -6525, -4406,
-    -1519, 1676, 4379, 5830, 5670, 4053, 1525, -1217, -3493, -4669,
-    -4298, -2405, 413, 3368, 5963, 8032, 9383, 9767, 9364, 8997,
-    9521, 11041, 12912, 14236, 14045, 11354, 5776, -1680, -8881, -13913,
-    -16056, -15569, -13197, -10160, -7957, -7399, -7922, -8308, -7887, -6612,
-    -4342, -940, 2932, 5947, 7250, 6887, 5006, 1513, -2991, -6672,
-    -7712, -5892, -2367, 1774, 5868, 8890, 9652, 8291, 6609, 6291,
-    7476, 9518, 12120, 14734, 15633, 12943, 6629, -1311, -8525, -13542,
-    -15670, -14820, -11942, -8995, -7718, -8308, -9543, -10097, -9449, -7678,
-    -4973, -1637, 1717, 4312, 5528, 5074, 3039, -117, -3633, -6506,
-    -7623, -6250, -2704, 1632, 5267, 7504, 8389, 8169, 7303, 6825,
-    7922, 10740, 13978, 15996, 15949, 13550, 8510, 1184, -6591, -12414,
-    -15141, -15207, -13492, -10860, -8546, -7739, -8389, -9144, -8722, -6894,
-    -4092, -750, 2617, 5156, 6151, 5705, 4422, 2424, -566, -3965,
-    -6157, -6153, -4515, -2005, 1473, 5655, 8942, 10051, 9739, 9580,
-    9903, 10250, 10983, 12738, 14582, 14184, 10060, 2868, -5457, -13035,
-    -18356, -20202, -18219, -13701, -9219, -6906, -7035, -8311, -9253, -8989,
-    -7065, -3338, 1540, 5960, 8255, 7883, 5547, 2329, -944, -3615,
-    -5022, -4727, -2809, 108, 3128, 5587, 7380, 8584, 8958, 8421,
-    7808, 8239, 9728, 11284, 12296, 12788, 12376, 10129, 5736, 49,
-    -5680, -10539, -13969, -15624, -15409, -13649, -11209, -9155, -8037, -7692,
-    -7774, -7924, -7422, -5468, -2023, 2163, 6148, 8804, 8873, 6097,
-    1881, -2045, -5047, -6934, -6986, -4821, -1475, 1570, 3911, 5919,
-    7480, 7973, 7367, 6630, 6909, 8489, 10674, 12583, 13746, 13635,
-    11074, 5083, -3466, -11843, -17551, -19881, -19192, -15826, -10756, -6385,
-    -5018, -6545, -8754, -9814, -9312, -7197, -3342, 1564, 5899, 8280,
-    8324, 6395, 3287, -24, -2835, -4793, -5459, -4370, -1727, 1553,
-    4611, 7036, 8582, 9027, 8405, 7254, 6661, 7679, 10206, 12850,
-    14355, 14502, 13040, 8977, 2104, -5703, -11971, -15732, -17241, -16602,
-    -13960, -10513, -8088, -7640, -8624, -9722, -9862, -8600, -5863, -1746,
-    3160, 7494, 9747, 9304, 6696, 3020, -602, -3301, -4688, -4799,
-    -3701, -1504, 1224, 3682, 5676, 7542, 9017, 9207, 8209, 7725,
-    9096, 11544, 13397, 14172, 14058, 12137, 7064, -529, -8030, -13425,
-    -16529, -17586, -16357, -13163, -9600, -7348, -6804, -7207, -7610, -7408,
-    -6289, -4084, -832, 2996, 6468, 8565, 8636, 6657, 3308, -311,
-    -3346, -5398, -5918, -4181, -503, 3366, 6030, 7780, 9206, 9629,
-    8438, 6997, 7358, 9529, 11696, 12813, 13247, 12853, 10194, 4425,
-    -3100, -9964, -14785, -17418, -17679, -15260, -11057, -7356, -5926, -6562,
-    -7890, -8856, -8872, -7401, -4309, -310, 3519, 6414, 7852, 7409,
-    5218, 2172, -796, -3337, -5160, -5434, -3506, -28, 3464, 6085,
-    7884, 8679, 7830, 5670, 4062, 4676, 7260, 10249, 12440, 13298,
-    12155, 8257, 1869, -5292, -11164, -14699, -16005, -15521, -13655, -11149,
-    -9116, -8300, -8527, -8989, -8861, -7686, -5525, -2744, 465, 4017,
-    7143, 8371, 6952, 3821, 469, -2531, -5063, -6188, -4750, -1188,
-    2519, 5053, 6828, 8424, 9152, 8272, 6846, 6939, 9103, 11891,
-    13831, 14529, 13563, 9803, 2883, -5428, -12351, -16272, -17214, -15755,
-    -12551, -8874, -6480, -6316, -7709, -9116, -9317, -7721, -4240, 462,
-    4896, 7567, 7884, 6056, 2557, -1746, -5305, -6628, -5453, -2708,
-    663, 4210, 7306, 8909, 8585, 7288, 6467, 6691, 7681, 9306,
-    11574, 13568, 13337, 9458, 2451, -5600, -12530, -16962, -18245, -16380,
-    -12351, -8101, -5554, -5329, -6497, -7638, -7932, -7145, -5024, -1382,
-    3075, 6585, 7512, 5698, 2298, -1513, -5090, -7596, -7740, -4969,
-    -471, 3798, 6868, 8854, 9704, 9002, 7206, 6037, 6915, 9487,
-    12187, 13725, 13405, 10493, 4481, -3701, -11551, -16665, -18271, -16966,
-    -13693, -9585, -6191, -4746, -5096, -5916, -6036, -5073, -2958, 316,
-    4190, 7417, 8883, 8316, 6004, 2341, -1900, -5183, -5915, -3752,
-    142, 4264, 7737, 10050, 10619, 9408, 7628, 6988, 8150, 10456,
-    13000, 15132, 15776, 13327, 7103, -1388, -9302, -14563, -16842, -16733,
-    -14845, -12039, -9796, -9312, -10208, -10861, -10169, -8348, -5848, -2457,
-    1864, 5941, 8113, 7846, 5899, 3104, -202, -3419, -5202, -4467,
-    -1616, 1796, 4553, 6422, 7438, 7430, 6705, 6470, 7777, 10332,
-    12883, 14435, 14444, 12269, 7439, 617, -6366, -11749, -14806, -15658,
-    -14705, -12651, -10673, -9854, -10220, -10699, -10243, -8658, -6177, -2801,
-    1314, 5186, 7485, 7677, 6150, 3397, -185, -3659, -5523, -4873,
-    -2290, 749, 3207, 4939, 6054, 6411, 6108, 5994, 7048, 9268,
-    11709, 13515, 14207, 12990, 8838, 1859, -6050, -12517, -16361, -17647,
-    -16713, -13979, -10569, -8145, -7585, -8120, -8259, -7301, -5454, -2808,
-    763, 4578, 7073, 7346, 6022, 4074, 1627, -1316, -3739, -4256,
-    -2654, 68, 3030, 5972, 8456, 9540, 8826, 7339, 6698, 7584,
-    9495, 11702, 13535, 13738, 10755, 4376, -3530, -10514, -15242, -17392,
-    -16904, -14334, -11382, -9858, -10036, -10617, -10266, -8621, -5890, -2266,
-    1839, 5407, 7309, 7229, 5744, 3486, 789, -1729, -2917, -1994,
-    598, 3649, 6179, 7732, 8129, 7553, 6733, 6656, 7959, 10513,
-    13295, 14650, 13098, 8231, 967, -6851, -13123, -16248, -15885, -13127,
-    -9802, -7437, -6674, -7268, -8371, -8885, -7857, -4957, -811, 3240,
-    5928, 6616, 5216, 2095, -1663, -4441, -5094, -3605, -583, 3321,
-    7112, 9330, 9134, 7309, 5655, 5468, 6959, 9690, 12775, 14635,
-    13395, 8263, 471, -7467, -13424, -16422, -16286, -13537, -9793, -7246,
-    -6996, -8243, -9414, -9499, -8038, -4774, -153, 4278, 6770, 6605,
-    4243, 641, -3102, -5780, -6383, -4655, -1257, 2646, 5921, 7743,
-    7759, 6400, 4991, 5069, 7282, 10931, 14417, 15873, 13802, 7984,
-    -34, -7816, -13489, -16229, -15919, -13241, -9919, -7857, -7714, -8667,
-    -9456, -9164, -7211, -3468, 1263, 5329, 7234, 6621, 4202, 981,
-    -2131, -4134, -4089, -1899, 1443, 4688, 7088, 8202, 7780, 6417,
-    5666, 6738, 9428, 12697, 15547, 16749, 14678, 8644, 163, -7898,
-    -13405, -15762, -15232, -12505, -9053, -6883, -7065, -8648, -9614, -8798,
-    -6366, -2754, 1712, 5971, 8227, 7528, 4654, 1015, -2487, -5072,
-    -5635, -3621, 130, 4036, 6898, 8155, 7744, 6353, 5417, 6198,
-    8753, 11935, 14245, 14497, 11910, 6284, -1420, -9011, -14245, -16233,
-    -15453, -12860, -9652, -7436, -7318, -8624, -9440, -8520, -5987, -2376,
-    1847, 5721, 7836, 7452, 5084, 1831, -1341, -3575, -4007, -2248,
-    1093, 4647, 7177, 8209, 7873, 6608, 5322, 5319, 7321, 10595,
-    13411, 14160, 11816, 6132, -1751, -9342, -14322, -15990, -14960, -12204,
-    -8991, -6939, -7006, -8524, -9821, -9671, -7799, -4418, -6, 4379,
-    7178, 7282, 4938, 1449, -1951, -4524, -5522, -4220, -867, 3091,
-    6202, 7923, 8253, 7391, 6165, 5895, 7215, 9519, 11698, 12685,
-    11266, 6525, -881, -8570, -14091, -16485, -16136, -13830, -10575, -7908,
-    -7351, -9099, -11738, -13728, -14742, -15038, -14304, -12280, -10053, -9276,
-    -10115, -11248, -11830, -12133, -12167, -11177, -8919, -6301, -4292, -3021,
-    -2315, -2249, -2637, -2542, -1020, 1761, 4664, 6807, 8153, 8792,
-    8455, 7327, 6601, 7307, 9054, 10787, 12218, 13502, 14119, 13444,
-    12125, 11548, 12048, 12739, 13034, 13224, 13478, 13272, 12192, 10652,
-    9400, 8613, 7912, 7134, 6560, 6229, 5596, 4320, 2885, 1883,
-    1182, 462, 8, 159, 387, -213, -1823, -3911, -6010, -7831,
-    -8996, -9272, -8903, -8383, -8081, -8251, -9060, -10367, -11661, -12351,
-    -12162, -11344, -10526, -10232, -10542, -11273, -12195, -12926, -13028, -12488,
-    -11739, -11032, -10248, -9479, -9141, -9294, -9373, -8816, -7531, -5735,
-    -3795, -2187, -1199, -714, -557, -751, -1168, -1270, -562, 887,
-    2615, 4231, 5605, 6752, 7641, 8169, 8397, 8647, 9113, 9584,
-    9880, 10225, 10747, 11031, 10732, 10235, 10124, 10364, 10524, 10424,
-    10092, 9477, 8605, 7715, 6988, 6431, 6141, 6284, 6719, 6919,
-    6427, 5279, 3962, 2937, 2213, 1531, 941, 738, 746, 290,
-    -839, -2043, -2818, -3316, -3700, -3725, -3411, -3422, -4301, -5776,
-    -7188, -8239, -9067, -9830, -10419, -10582, -10332, -10078, -10175, -10511,
-    -10769, -10843, -10690, -10152, -9272, -8423, -7817, -7294, -6832, -6719,
-    -6954, -6994, -6353, -5065, -3481, -1948, -737, 19, 349, 364,
-    308, 572, 1384, 2566, 3877, 5298, 6617, 7232, 6924, 6414,
-    6573, 7414, 8362, 9112, 9692, 9953, 9549, 8429, 7087, 6204,
-    6074, 6459, 7077, 7925, 8840, 9168, 8520, 7486, 6845, 6456,
-    5770, 5049, 5033, 5630, 5920, 5391, 4389, 3375, 2381, 1300,
-    321, -164, -30, 371, 580, 459, -10, -1051, -2684, -4271,
-    -5121, -5329, -5426, -5546, -5600, -5875, -6663, -7621, -8216, -8501,
-    -8812, -9036, -8846, -8450, -8450, -8992, -9520, -9536, -9296, -9471,
-    -10108, -10366, -9574, -8122, -6763, -5457, -3728, -1771, -233, 921,
-    2390, 4489, 6897, 9312, 11703, 13983, 15884, 17111, 17523, 17334,
-    17038, 16862, 16502, 15665, 14538, 13438, 12327, 10919, 9014, 6660,
-    4172, 1878, -297, -2692, -5252, -7521, -9456, -11629, -14362, -17218,
-    -19619, -21448, -22748, -23333, -23052, -22141, -21008, -19840, -18551, -16972,
-    -15043, -12891, -10611, -8018, -4929, -1641, 1301, 3760, 5939, 7863,
-    9409, 10623, 11582, 12273, 12812, 13325, 13537, 13117, 12326, 11694,
-    11276, 10821, 10299, 9733, 8845, 7313, 5140, 2635, 196, -1974,
-    -3980, -5887, -7420, -8401, -9204, -10235, -11163, -11283, -10496, -9393,
-    -8341, -7029, -5118, -2872, -749, 1263, 3462, 5873, 8246, 10385,
-    12270, 14034, 15746, 17080, 17594, 17421, 17082, 16686, 16025, 15277,
-    14809, 14545, 14046, 12846, 10619, 7573, 4463, 1634, -1343, -4585,
-    -7389, -9366, -11093, -13151, -15316, -17006, -18013, -18617, -19161, -19561,
-    -19409, -18662, -17766, -16934, -15847, -14256, -12390, -10559, -8691, -6451,
-    -3745, -906, 1712, 4087, 6327, 8402, 10204, 11583, 12402, 12866,
-    13434, 14030, 13997, 13213, 12384, 11867, 11139, 9751, 7982, 6339,
-    4914, 3360, 1401, -633, -2149, -3274, -4752, -6630, -8116, -8982,
-    -9904, -11082, -11754, -11434, -10580, -9727, -8771, -7435, -5870, -4484,
-    -3354, -2066, -163, 2359, 5135, 7876, 10514, 12945, 14930, 16346,
-    17286, 17841, 18020, 17931, 17740, 17364, 16561, 15357, 13975, 12345,
-    10218, 7742, 5282, 2738, -233, -3404, -6140, -8323, -10409, -12604,
-    -14544, -15844, -16600, -17237, -17927, -18242, -17648, -16326, -14988, -13860,
-    -12544, -10933, -9428, -8141, -6641, -4648, -2340, 5, 2224, 4215,
-    5952, 7369, 8236, 8486, 8529, 8810, 9220, 9382, 9342, 9487,
-    9822, 9781, 8855, 7160, 5236, 3461, 1775, -46, -1949, -3561,
-    -4737, -5906, -7515, -9321, -10733, -11569, -11940, -11772, -11014, -9926,
-    -8774, -7655, -6682, -5824, -4754, -3276, -1458, 905, 4144, 7850,
-    11036, 13257, 14827, 16059, 16878, 17015, 16282, 14815, 13002, 11006,
-    8679, 5988, 3117, 181, -2743, -5466, -7852, -9921, -11640, -12810,
-    -13196, -12795, -12001, -11199, -10139, -8250, -5510, -2361, 899, 3975,
-    6438, 8313, 10018, 11487, 12237, 12185, 11528, 10236, 8285, 5751,
-    2554, -1143, -4662, -7628, -10317, -12760, -14599, -15888, -16822, -16994,
-    -16068, -14537, -12914, -10930, -8119, -4558, -842, 2341, 4773, 6872,
-    8949, 10685, 11748, 12299, 12524, 12322, 11580, 10231, 8181, 5526,
-    2534, -585, -3604, -6279, -8645, -10756, -12222, -12630, -12128, -11070,
-    -9613, -7838, -5591, -2450, 1448, 5195, 8279, 11025, 13548, 15420,
-    16456, 16765, 16265, 14960, 13258, 11428, 9268, 6550, 3368, 77,
-    -2881, -5379, -7742, -10087, -11824, -12387, -12003, -11206, -10084, -8460,
-    -6352, -3874, -1051, 1947, 4675, 6863, 8805, 10920, 13025, 14441,
-    14740, 14008, 12470, 10260, 7506, 4352, 925, -2597, -5995, -9097,
-    -11854, -14347, -16604, -18248, -18611, -17528, -15681, -13743, -11515, -8374,
-    -4351, -229, 3357, 6444, 9264, 11718, 13523, 14572, 14885, 14387,
-    12927, 10501, 7415, 4129, 836, -2546, -5781, -8260, -9869, -11243,
-    -12763, -13944, -14129, -13193, -11445, -9324, -7072, -4450, -1167, 2411,
-    5604, 8273, 10653, 12694, 14237, 15364, 16033, 15871, 14705, 12804,
-    10449, 7655, 4387, 802, -2731, -5853, -8517, -10891, -12915, -14270,
-    -14751, -14332, -13002, -10955, -8693, -6501, -4032, -857, 2738, 5988,
-    8581, 10883, 13074, 14633, 15082, 14672, 13784, 12204, 9705, 6756,
-    3880, 861, -2637, -6187, -9064, -11227, -13195, -15168, -16644, -16942,
-    -15963, -14268, -12298, -9888, -6868, -3598, -465, 2553, 5424, 7854,
-    9807, 11489, 12778, 13383, 13363, 12824, 11535, 9411, 6810, 3953,
-    700, -2857, -6192, -8861, -10887, -12589, -14075, -14885, -14417, -12811,
-    -10843, -8843, -6400, -3267, 187, 3561, 6799, 9853, 12391, 14075,
-    14946, 15304, 15170, 14246, 12477, 10127, 7194, 3431, -986, -5450,
-    -9523, -12933, -15206, -15901, -15032, -12885, -9616, -5261, -142, 4846,
-    8708, 11281, 13165, 14470, 14526, 13174, 11202, 9011, 6014, 1930,
-    -2440, -6315, -9811, -13069, -15287, -15480, -13745, -10965, -7569, -3419,
-    1198, 5351, 8389, 10516, 12156, 13139, 12944, 11515, 9208, 5968,
-    1459, -3812, -8592, -12266, -15062, -16854, -17071, -15694, -13214, -9823,
-    -5567, -951, 3287, 6727, 9338, 11205, 12190, 12002, 10751, 8880,
-    6332, 2708, -1594, -5513, -8566, -10906, -12434, -12812, -11984, -10140,
-    -7509, -4221, -240, 4137, 7971, 10665, 12605, 14030, 14395, 13469,
-    11621, 8807, 4797, 107, -4534, -8886, -12590, -15037, -16050, -15681,
-    -13808, -10640, -6641, -1874, 3348, 7862, 10999, 13278, 14869, 15126,
-    14049, 12307, 9908, 6422, 2028, -2630, -6966, -10539, -13274, -15173,
-    -15702, -14474, -12108, -9190, -5386, -687, 3919, 7782, 11003, 13378,
-    14401, 14087, 12747, 10490, 7312, 3141, -1882, -6896, -11004, -14303,
-    -17009, -18405, -17924, -16040, -13065, -8669, -3158, 2354, 7178, 11184,
-    14154, 15830, 16099, 14929, 12612, 9650, 6116, 1928, -2352, -6012,
-    -9027, -11473, -12903, -13059, -12264, -10647, -7889, -3959, 520, 4661,
-    7856, 10050, 11450, 12010, 11577, 10320, 8420, 5690, 2097, -1762,
-    -5207, -8054, -10336, -11854, -12243, -11321, -9268, -6379, -2769, 1391,
-    5506, 8903, 11424, 13172, 13956, 13508, 11960, 9649, 6652, 2921,
-    -1279, -5362, -8858, -11607, -13489, -14233, -13694, -12029, -9396, -5785,
-    -1377, 3189, 7178, 10221, 12295, 13362, 13296, 12172, 10299, 7759,
-    4318, 81, -4220, -7928, -10981, -13403, -14785, -14682, -13184, -10740,
-    -7631, -3904, 228, 4236, 7630, 10267, 12154, 13107, 12844, 11308,
-    8699, 5230, 1060, -3457, -7693, -11108, -13509, -14821, -14958, -14047,
-    -12279, -9485, -5483, -724, 3990, 8180, 11584, 13850, 14742, 14301,
-    12761, 10433, 7396, 3436, -1185, -5449, -8720, -11254, -13030, -13325,
-    -11789, -8748, -4524, 517, 5667, 10235, 13663, 15399, 15325, 13716,
-    10495, 5621, 14, -5225, -9756, -13154, -14595, -13962, -11704, -7846,
-    -2732, 2267, 6097, 8694, 9994, 9822, 8350, 5533, 1300, -3346,
-    -7227, -10314, -12499, -12750, -10878, -7865, -3980, 966, 6082, 10227,
-    13088, 14394, 13921, 12157, 9220, 4531, -1290, -6578, -10854, -14352,
-    -16334, -16183, -14348, -10979, -6007, -499, 4380, 8519, 11550, 12635,
-    11932, 9893, 6169, 1138, -3672, -7587, -10563, -11610, -10188, -7400,
-    -3918, 555, 5228, 8664, 10700, 11627, 11197, 9536, 6826, 2557,
-    -2831, -7582, -11156, -14209, -16061, -15523, -13042, -9323, -4126, 1983,
-    7497, 11797, 14776, 15883, 15107, 12931, 9141, 3861, -1474, -5896,
-    -9492, -11730, -11887, -10500, -8068, -4181, 629, 4784, 7774, 9921,
-    10867, 10165, 7887, 4024, -982, -5782, -9563, -12332, -13453, -12209,
-    -9194, -5132, 58, 5792, 10655, 14044, 15978, 16166, 14653, 11777,
-    7272, 1240, -4933, -10171, -14445, -17360, -18228, -17170, -14328, -9452,
-    -3282, 2746, 8098, 12509, 15116, 15605, 14265, 10757, 5128, -1009,
-    -6280, -10570, -13410, -14003, -12721, -10218, -6340, -1489, 3023, 6585,
-    9193, 10490, 10428, 9289, 6626, 2301, -2268, -5920, -8927, -11138,
-    -11572, -10227, -7715, -3872, 1207, 6304, 10418, 13289, 14630, 14316,
-    12495, 8958, 3794, -1803, -6815, -11128, -14198, -15082, -13960, -11559,
-    -7858, -3017, 1915, 6179, 9606, 11814, 12457, 11506, 8760, 4355,
-    -633, -5299, -9448, -12464, -13524, -12786, -10584, -6564, -1073, 4419,
-    9023, 12585, 14544, 14460, 12628, 9156, 4095, -1526, -6591, -10899,
-    -14064, -15191, -14258, -11818, -7786, -2364, 3116, 7595, 10882, 12609,
-    12467, 10877, 8032, 3694, -1366, -5703, -8965, -11416, -12568, -11923,
-    -9785, -6408, -1841, 3196, 7718, 11320, 13703, 14298, 12937, 9944,
-    5631, 546, -4320, -8273, -11121, -12530, -12114, -10040, -6706, -2269,
-    2761, 7152, 9924, 11034, 10617, 8353, 4184, -1023, -6037, -9954,
-    -12136, -12104, -9747, -5363, 336, 6123, 10715, 13468, 14104, 12225,
-    7902, 2123, -4017, -9736, -13940, -15453, -13991, -10022, -4215, 2185,
-    7513, 10869, 12189, 11301, 8145, 3473, -1617, -6161, -9101, -9717,
-    -8206, -4988, -261, 5107, 9573, 12282, 13205, 12094, 8640, 3334,
-    -2749, -8527, -12937, -15144, -14800, -11829, -6558, -226, 5540, 9803,
-    12185, 12230, 9762, 5355, -26, -5392, -9670, -11975, -11953, -9660,
-    -5453, -221, 4727, 8277, 9942, 9757, 7890, 4458, -159, -5036,
-    -9071, -11525, -12005, -10277, -6488, -1410, 3799, 8068, 10760, 11669,
-    10686, 7698, 3014, -2420, -7479, -11274, -13077, -12315, -8869, -3317,
-    3039, 8533, 11921, 12868, 11507, 7983, 2807, -2929, -8142, -12122,
-    -14182, -13619, -10344, -5123, 834, 6255, 10057, 11688, 11159, 8669,
-    4537, -496, -5332, -8974, -10825, -10672, -8572, -4757, 219, 5252,
-    9084, 11134, 11427, 9791, 5995, 667, -4847, -9478, -12558, -13381,
-    -11508, -7297, -1685, 4239, 9333, 12631, 13650, 12314, 8868, 4026,
-    -1173, -5789, -9062, -10376, -9471, -6528, -2068, 2927, 7143, 9687,
-    10443, 9434, 6454, 1691, -3887, -9037, -12740, -14221, -13044, -9373,
-    -3951, 2175, 7861, 12077, 14199, 14069, 11764, 7521, 1994, -3728,
-    -8545, -11649, -12452, -10644, -6527, -1089, 4331, 8526, 10791, 10939,
-    8972, 5049, -163, -5616, -10405, -13728, -14644, -12642, -8178, -2220,
-    4174, 9698, 13136, 14061, 12614, 8948, 3556, -2403, -7661, -11308,
-    -12699, -11511, -7955, -2726, 3036, 7955, 11082, 12135, 10965, 7549,
-    2551, -2914, -7936, -11654, -13107, -11913, -8534, -3684, 1874, 7097,
-    10944, 12779, 12318, 9591, 5050, -511, -5991, -10137, -12136, -11831,
-    -9260, -4737, 598, 5358, 8851, 10737, 10507, 8106, 4212, -498,
-    -5475, -9800, -12447, -12817, -10715, -6465, -1043, 4447, 9086, 11915,
-    12378, 10842, 7774, 3193, -2269, -7102, -10250, -11317, -9688, -5204,
-    778, 6386, 10424, 11961, 10241, 5605, -531, -6521, -10782, -12099,
-    -10211, -5653, 554, 6656, 10711, 11869, 10199, 5778, -659, -7060,
-    -11450, -13088, -11707, -7252, -827, 5569, 10435, 12932, 12312, 8379,
-    2152, -4509, -9772, -12346, -11671, -7911, -2026, 4189, 8812, 10882,
-    10346, 7235, 1890, -4261, -9305, -12085, -12193, -9374, -3986, 2376,
-    7670, 10682, 11060, 8690, 3910, -1924, -6974, -10004, -10472, -8055,
-    -3059, 3004, 8211, 11495, 12548, 10940, 6348, -376, -7204, -12186,
-    -14309, -13199, -8897, -2453, 4011, 8600, 10592, 9832, 6214, 468,
-    -5491, -9790, -11551, -10410, -6261, -17, 6348, 11071, 13345, 12753,
-    8981, 2650, -4329, -9911, -13014, -13182, -10074, -4180, 2574, 7953,
-    10828, 10963, 8183, 2770, -3778, -9327, -12367, -12321, -9130, -3390,
-    3278, 8851, 12078, 12581, 10116, 4821, -1823, -7540, -10944, -11725,
-    -9577, -4510, 1952, 7493, 10873, 11967, 10495, 6204, 43, -6065,
-    -10521, -12464, -11333, -6992, -416, 6299, 11110, 13088, 12147, 8352,
-    2369, -3967, -8728, -11167, -11088, -8053, -2535, 3382, 7841, 10480,
-    11010, 8394, 2628, -4289, -10030, -13282, -13280, -9662, -3288, 3735,
-    9167, 11674, 11080, 7840, 2588, -3483, -8485, -11036, -10997, -8424,
-    -3225, 3420, 9121, 12421, 13170, 10934, 5415, -1814, -8216, -12449,
-    -14083, -12442, -7459, -670, 5769, 10337, 12171, 10857, 6563, 193,
-    -6510, -11426, -13176, -11534, -6814, 13, 6777, 11235, 12686, 11343,
-    7140, 688, -5903, -10691, -13129, -12836, -9157, -2879, 3530, 8096,
-    10245, 9677, 6181, 619, -5239, -9800, -12031, -11412, -8069, -2721,
-    3412, 8656, 11607, 11873, 9491, 4439, -2255, -8240, -11798, -12672,
-    -10577, -5267, 1670, 7569, 11194, 12446, 10727, 5887, -458, -6304,
-    -10614, -12583, -11342, -6983, -730, 5715, 10507, 12344, 11195, 7628,
-    2165, -3915, -8603, -10790, -10423, -7245, -1484, 4819, 9317, 11245,
-    10433, 6398, -63, -6369, -10280, -10948, -8056, -2054, 4954, 10227,
-    12030, 9820, 4155, -3007, -9079, -12203, -11492, -7018, -361, 5971,
-    10176, 11305, 8648, 2731, -3906, -8603, -10234, -8424, -3287, 3349,
-    8712, 11344, 10910, 6979, 226, -6612, -10812, -11305, -7965, -1605,
-    5324, 10175, 11782, 9799, 4377, -2648, -8453, -11335, -10630, -6100,
-    795, 7036, 10653, 11151, 7941, 1331, -5945, -10870, -12326, -10012,
-    -4056, 3460, 9457, 12365, 11722, 7101, -436, -7914, -12794, -13960,
-    -10927, -4563, 2426, 7658, 10233, 9370, 4626, -2299, -8502, -12117,
-    -12109, -7903, -902, 5781, 9974, 10995, 8352, 2456, -4336, -9377,
-    -11344, -9656, -4513, 2104, 7563, 10488, 10287, 6484, 49, -6386,
-    -10653, -11825, -9388, -3855, 2493, 7333, 9701, 8987, 4797, -1446,
-    -6934, -9710, -9078, -5029, 1006, 6362, 9238, 9224, 6058, 158,
-    -6274, -10690, -11855, -9314, -3374, 3782, 9243, 11679, 10890, 6613,
-    -242, -6992, -11288, -12226, -9403, -3297, 3814, 9371, 12153, 11484,
-    6995, 62, -6532, -10647, -11163, -7669, -1414, 4944, 9470, 11338,
-    9670, 4416, -2325, -7858, -10695, -10005, -5590, 829, 6520, 10006,
-    10793, 8201, 2566, -3839, -8510, -10061, -7881, -2563, 3567, 8019,
-    9639, 8025, 3340, -2752, -7800, -10274, -9499, -5275, 1088, 7008,
-    10746, 11750, 9354, 3491, -3873, -9999, -13219, -12641, -8016, -856,
-    6066, 10701, 11978, 9212, 2972, -4357, -10023, -12187, -10095, -4580,
-    1907, 6974, 9446, 8692, 4610, -1354, -6819, -10105, -10270, -6807,
-    -736, 5364, 9398, 10590, 8500, 3241, -3410, -8851, -11327, -10105,
-    -5325, 1434, 7642, 11314, 11434, 7732, 1232, -5714, -10741, -12321,
-    -9807, -3980, 2847, 8375, 11382, 11070, 7042, 471, -6176, -10786,
-    -12083, -9428, -3597, 3026, 8041, 10140, 8734, 3993, -2496, -8287,
-    -11351, -10622, -6242, 156, 6180, 9936, 10328, 7038, 1087, -5269,
-    -9810, -11062, -8301, -2171, 4932, 10190, 11848, 9292, 3029, -4713,
-    -10584, -12079, -8687, -1733, 6012, 11249, 11838, 7823, 981, -6012,
-    -10383, -10412, -6252, 324, 6610, 9804, 8420, 3288, -3122, -8163,
-    -9795, -7187, -1431, 4833, 8948, 9310, 5615, -852, -7334, -10918,
-    -10084, -5171, 1908, 8256, 11122, 9241, 3405, -3927, -9623, -11272,
-    -8353, -2298, 4360, 8925, 9493, 5876, -291, -6433, -9992, -9200,
-    -4006, 3425, 9673, 11886, 9040, 2211, -5805, -11612, -12825, -9133,
-    -2199, 5190, 10181, 10898, 7185, 683, -5818, -9538, -8935, -4388,
-    2042, 7494, 9476, 7023, 1274, -5130, -9443, -9931, -6349, -56,
-    6358, 10183, 9848, 5454, -1398, -8050, -11668, -10600, -5300, 1967,
-    8218, 10913, 8919, 3051, -4225, -9902, -11700, -8961, -2885, 4001,
-    8858, 9622, 5929, -563, -6931, -10432, -9609, -4706, 2297, 8328,
-    10725, 8569, 2789, -4403, -10097, -11700, -8341, -1426, 6130, 11170,
-    11482, 6863, -604, -7543, -10905, -9247, -3310, 4328, 10429, 12417,
-    9323, 2335, -5504, -10795, -11437, -7264, 72, 7504, 11759, 11131,
-    6186, -933, -7395, -10478, -8841, -3385, 3358, 8598, 10251, 7591,
-    1675, -5051, -9856, -10781, -7406, -1151, 5346, 9452, 9491, 5345,
-    -1251, -7415, -10636, -9708, -4820, 2307, 8630, 11258, 9091, 3056,
-    -4518, -10505, -12144, -8613, -1467, 6352, 11720, 12359, 7902, 236,
-    -7402, -11865, -11334, -6152, 1328, 7976, 11134, 9418, 3424, -4217,
-    -10167, -12036, -9081, -2385, 5163, 10074, 10275, 5965, -1010, -7854,
-    -11578, -10424, -4922, 2529, 8804, 11138, 8317, 1499, -6307, -11697,
-    -12284, -7780, -258, 6931, 10816, 9853, 4471, -2848, -8750, -10862,
-    -8606, -2916, 3990, 9151, 10356, 7286, 1263, -5412, -9983, -10368,
-    -6466, -133, 5971, 9425, 8863, 4637, -1365, -6682, -9185, -7801,
-    -3110, 2859, 7702, 9522, 7472, 2315, -3702, -8103, -9294, -6738,
-    -1151, 5246, 9610, 10037, 6273, -353, -7081, -10625, -9049, -2972,
-    4844, 10723, 11627, 6852, -1332, -8879, -12034, -9130, -1576, 6683,
-    11382, 10205, 3726, -4847, -11010, -11420, -5947, 2500, 9735, 12135,
-    8361, 400, -7446, -11209, -9223, -2559, 5436, 10596, 10233, 4615,
-    -3430, -9961, -11665, -7573, 270, 7957, 11719, 9657, 2811, -5175,
-    -10118, -9624, -4066, 3704, 9551, 10278, 5639, -1733, -8091, -10291,
-    -7142, -278, 6556, 9803, 7970, 2061, -4900, -9164, -8358, -2943,
-    4172, 9223, 9398, 4391, -3233, -9500, -11182, -7321, 199, 7361,
-    10253, 7367, 171, -7815, -12533, -11387, -4940, 3411, 9545, 10552,
-    5856, -2279, -9607, -12275, -8960, -1323, 6850, 11351, 9809, 3127,
-    -5125, -10697, -10735, -5263, 2731, 9030, 10500, 6456, -1064, -8119,
-    -10964, -8267, -1618, 5584, 9652, 8294, 2144, -5407, -10292, -9952,
-    -4412, 3596, 9781, 10728, 5969, -1914, -8819, -11166, -7764, -488,
-    6876, 10670, 9010, 2664, -5171, -10528, -10768, -5724, 2270, 9216,
-    11407, 7701, 153, -7349, -11026, -8900, -1992, 5986, 10784, 9981,
-    4006, -4145, -10234, -10970, -5906, 2356, 9594, 12042, 8350, 408,
-    -7679, -11804, -9848, -2760, 5745, 11181, 10875, 5229, -2771, -9019,
-    -10250, -5899, 1566, 8240, 10834, 8059, 1239, -6106, -10080, -8599,
-    -2445, 5196, 10288, 10049, 4552, -3307, -9419, -10572, -6124, 1588,
-    8529, 11152, 8101, 813, -7021, -11268, -9691, -3181, 4884, 10378,
-    10373, 4762, -3472, -9926, -11245, -6762, 1270, 8742, 11752, 8727,
-    1243, -6883, -11543, -10396, -4074, 4165, 10134, 10785, 5743, -2396,
-    -9372, -11563, -7835, -15, 7989, 12068, 10122, 3268, -4872, -10168,
-    -9984, -4441, 3540, 9713, 10831, 6368, -1323, -8264, -10864, -7792,
-    -685, 6758, 10727, 9227, 3050, -4665, -10065, -10472, -5664, 1964,
-    8507, 10557, 7031, -306, -7771, -11567, -9725, -3265, 4304, 8975,
-    8392, 2949, -4474, -9952, -10543, -5877, 1686, 8315, 10583, 7194,
-    -204, -7705, -11171, -8544, -1148, 6839, 10739, 8253, 978, -6526,
-    -9503, -5983, 1807, 8777, 10327, 5370, -3062, -9753, -10467, -4644,
-    4124, 10368, 10214, 3709, -5280, -11299, -10544, -3258, 6341, 12590,
-    11700, 4017, -6036, -12526, -11631, -3944, 5935, 12115, 10933, 3292,
-    -5932, -11118, -9384, -2106, 6082, 10136, 7768, 837, -6103, -8831,
-    -5907, 609, 6440, 7817, 3955, -2525, -7391, -7441, -2547, 4129,
-    8162, 6804, 732, -6379, -10014, -7619, -424, 7241, 10726, 7851,
-    120, -8020, -11702, -8720, -949, 6985, 10552, 7843, 676, -6429,
-    -9130, -6006, 732, 6748, 8194, 4144, -2708, -7822, -7819, -2597,
-    4556, 8887, 7269, 440, -7433, -11452, -8902, -888, 8068, 12640,
-    10064, 1788, -7552, -12749, -10874, -3089, 5928, 10922, 9235, 2183,
-    -5834, -9935, -7798, -1099, 5752, 8484, 5508, -1116, -6921, -7967,
-    -3499, 3666, 8952, 8769, 2845, -5325, -10644, -9744, -3020, 5690,
-    11268, 10328, 3445, -5162, -10346, -9100, -2198, 6223, 11074, 9502,
-    2659, -5170, -9249, -7211, -543, 6322, 8934, 5689, -1303, -7588,
-    -9076, -4672, 2937, 9053, 9963, 5111, -2601, -8479, -8928, -3790,
-    3633, 8762, 8479, 2953, -4388, -8957, -7955, -2127, 4791, 8374,
-    6231, -375, -7227, -9872, -6503, 883, 7646, 9362, 4735, -3455,
-    -10128, -11095, -5609, 3163, 10020, 10920, 5448, -3048, -9549, -10277,
-    -4868, 3403, 9606, 10122, 4735, -3309, -9200, -9408, -3889, 3852,
-    8961, 8248, 2182, -5335, -9400, -7285, -251, 7249, 10399, 7064,
-    -816, -8390, -10948, -6879, 1351, 8710, 10629, 5806, -2922, -10283,
-    -11774, -6409, 2660, 9991, 11136, 5397, -3724, -10692, -11348, -5484,
-    3042, 8800, 8284, 2073, -5704, -10089, -8389, -1777, 5559, 9112,
-    6834, 307, -6309, -8843, -5666, 1288, 7683, 9423, 5203, -2594,
-    -9225, -10457, -5255, 3416, 10311, 11189, 5628, -2653, -8313, -7971,
-    -2290, 4742, 8551, 6782, 516, -6716, -11353, -11970, -9750, -7162,
-    -6103, -6964, -9004, -11227, -12900, -13586, -13089, -11507, -9282, -7116,
-    -5745, -5601, -6539, -7865, -8747, -8698, -7826, -6710, -5999, -6004,
-    -6564, -7287, -7879, -8232, -8250, -7791, -6878, -5878, -5271, -5218,
-    -5467, -5697, -5800, -5764, -5529, -5124, -4824, -4915, -5340, -5755,
-    -5937, -5958, -5932, -5803, -5507, -5196, -5103, -5208, -5231, -4980,
-    -4565, -4240, -4140, -4237, -4463, -4771, -5109, -5378, -5449, -5242,
-    -4831, -4445, -4306, -4471, -4842, -5268, -5550, -5415, -4710, -3703,
-    -3020, -3108, -3806, -4564, -4983, -4976, -4530, -3640, -2570, -1879,
-    -1947, -2566, -3179, -3416, -3247, -2727, -1913, -1058, -629, -908,
-    -1655, -2308, -2459, -2079, -1381, -642, -140, -86, -477, -1044,
-    -1395, -1270, -725, -124, 119, -119, -600, -983, -1132, -1100,
-    -926, -620, -327, -287, -535, -792, -793, -595, -404, -226,
-    71, 401, 449, 106, -328, -520, -502, -506, -559, -468,
-    -194, 21, -17, -201, -259, -65, 298, 662, 838, 658,
-    100, -583, -997, -902, -400, 159, 429, 302, -29, -236,
-    -150, 112, 356, 539, 699, 731, 441, -124, -608, -706,
-    -472, -149, 156, 452, 640, 575, 356, 291, 522, 854,
-    1074, 1232, 1454, 1630, 1520, 1125, 719, 523, 516, 623,
-    875, 1293, 1728, 1956, 1880, 1591, 1287, 1202, 1497, 2093,
-    2642, 2775, 2400, 1712, 994, 487, 381, 729, 1340, 1881,
-    2139, 2101, 1808, 1299, 777, 607, 976, 1635, 2140, 2288,
-    2176, 1903, 1449, 883, 458, 393, 680, 1166, 1694, 2069,
-    2043, 1534, 809, 291, 183, 388, 738, 1121, 1384, 1331,
-    916, 352, -56, -137, 137, 696, 1329, 1706, 1599, 1097,
-    503, 68, -93, 87, 604, 1221, 1533, 1307, 700, 101,
-    -183, -70, 340, 825, 1127, 1143, 998, 877, 827, 844,
-    1083, 1800, 3028, 4438, 5609, 6390, 6966, 7663, 8740, 10238,
-    11922, 13402, 14446, 15161, 15788, 16386, 16826, 17101, 17453, 18122,
-    19047, 19905, 20406, 20490, 20305, 20083, 19997, 20055, 20119, 20069,
-    19930, 19779, 19551, 19072, 18299, 17456, 16858, 16610, 16522, 16271,
-    15649, 14685, 13588, 12566, 11668, 10816, 9985, 9276, 8732, 8145,
-    7142, 5533, 3530, 1601, 117, -857, -1505, -2050, -2607, -3189,
-    -3833, -4661, -5752, -6935, -7770, -7866, -7281, -6565, -6361, -6908,
-    -7886, -8728, -9073, -8965, -8683, -8400, -8056, -7525, -6872, -6375,
-    -6259, -6425, -6456, -5912, -4667, -3012, -1457, -402, 64, 127,
-    79, 218, 799, 1938, 3473, 4991, 6070, 6560, 6659, 6732,
-    7074, 7772, 8697, 9622, 10382, 10948, 11328, 11465, 11311, 11018,
-    10911, 11201, 11738, 12124, 12072, 11606, 10976, 10435, 10099, 9931,
-    9828, 9732, 9654, 9547, 9218, 8464, 7339, 6185, 5341, 4842,
-    4454, 3945, 3262, 2496, 1786, 1199, 654, -46, -1001, -2056,
-    -2954, -3641, -4292, -5015, -5682, -6147, -6502, -6978, -7638, -8306,
-    -8785, -9023, -9083, -9078, -9132, -9280, -9367, -9185, -8763, -8392,
-    -8268, -8226, -7964, -7435, -6872, -6467, -6201, -5978, -5770, -5589,
-    -5430, -5283, -5069, -4559, -3534, -2134, -879, -173, 147, 617,
-    1557, 2833, 4122, 5219, 6062, 6657, 7070, 7360, 7475, 7345,
-    7129, 7175, 7625, 8181, 8448, 8378, 8211, 8085, 7926, 7687,
-    7448, 7250, 7042, 6834, 6690, 6488, 5958, 5098, 4345, 4086,
-    4152, 4066, 3669, 3206, 2808, 2262, 1386, 341, -595, -1356,
-    -2021, -2613, -3186, -3953, -5071, -6344, -7364, -7935, -8170, -8197,
-    -8031, -7754, -7619, -7834, -8397, -9158, -9893, -10293, -10144, -9628,
-    -9232, -9191, -9221, -8998, -8646, -8448, -8250, -7609, -6484, -5361,
-    -4598, -4058, -3566, -3290, -3345, -3351, -2853, -2002, -1361, -1080,
-    -743, -87, 620, 1129, 1736, 2929, 4693, 6507, 7922, 8877,
-    9502, 9915, 10222, 10519, 10793, 10946, 10884, 10505, 9689, 8475,
-    7160, 5989, 4793, 3205, 1195, -957, -3244, -6001, -9213, -12200,
-    -14377, -15994, -17628, -19187, -20071, -20227, -20348, -20798, -20995, -20282,
-    -18905, -17583, -16400, -14802, -12571, -10146, -7857, -5409, -2456, 726,
-    3534, 5775, 7773, 9819, 11854, 13698, 15314, 16750, 17940, 18658,
-    18670, 18024, 17169, 16604, 16295, 15651, 14256, 12385, 10499, 8504,
-    6014, 3255, 1014, -455, -1875, -3874, -6045, -7610, -8623, -9741,
-    -10936, -11347, -10593, -9438, -8719, -8201, -7110, -5387, -3670, -2190,
-    -435, 1899, 4264, 5922, 6860, 7655, 8650, 9654, 10390, 10898,
-    11384, 11854, 12016, 11573, 10584, 9477, 8551, 7551, 5960, 3728,
-    1366, -851, -3342, -6489, -9798, -12392, -14193, -15912, -17810, -19221,
-    -19662, -19716, -20155, -20662, -20258, -18836, -17379, -16506, -15635, -13999,
-    -11794, -9697, -7692, -5147, -1956, 1118, 3391, 5019, 6584, 8295,
-    9949, 11436, 12890, 14320, 15381, 15634, 15007, 13970, 13172, 12813,
-    12422, 11411, 9789, 8011, 6198, 3974, 1244, -1358, -3226, -4625,
-    -6222, -7956, -9098, -9483, -9884, -10813, -11606, -11339, -10179, -9080,
-    -8370, -7436, -5852, -4013, -2375, -671, 1580, 4163, 6360, 7928,
-    9312, 10850, 12273, 13154, 13504, 13684, 13914, 14047, 13772, 12942,
-    11721, 10390, 9015, 7382, 5332, 3063, 875, -1302, -3815, -6614,
-    -9109, -10930, -12452, -14177, -15947, -17267, -18179, -19176, -20275, -20789,
-    -20284, -19248, -18394, -17640, -16317, -14196, -11684, -9030, -6002, -2554,
-    746, 3290, 5063, 6463, 7710, 8734, 9522, 10266, 11118, 11971,
-    12603, 12905, 12883, 12588, 12121, 11554, 10784, 9646, 8149, 6377,
-    4214, 1514, -1479, -4216, -6387, -8144, -9682, -10878, -11540, -11834,
-    -12128, -12409, -12247, -11464, -10417, -9407, -8255, -6732, -4999, -3329,
-    -1678, 181, 2265, 4331, 6206, 7961, 9669, 11168, 12259, 13008,
-    13548, 13766, 13489, 12782, 11767, 10376, 8507, 6215, 3583, 626,
-    -2603, -5906, -8990, -11632, -13791, -15451, -16425, -16569, -16064, -15144,
-    -13714, -11553, -8692, -5338, -1687, 1991, 5347, 8105, 10142, 11449,
-    12075, 12041, 11371, 10223, 8713, 6668, 3898, 592, -2893, -6364,
-    -9611, -12281, -14177, -15380, -15983, -15961, -15256, -13887, -12042, -9902,
-    -7280, -3852, 151, 4020, 7334, 10115, 12355, 13954, 14920, 15292,
-    15116, 14511, 13475, 11825, 9535, 6769, 3580, 71, -3328, -6221,
-    -8588, -10508, -11947, -12859, -13066, -12281, -10598, -8460, -5979, -2911,
-    678, 4300, 7492, 10033, 11964, 13488, 14567, 14860, 14302, 13221,
-    11755, 9758, 7277, 4506, 1454, -1875, -5244, -8313, -10806, -12623,
-    -13977, -15085, -15714, -15499, -14556, -13270, -11697, -9561, -6648, -3099,
-    507, 3568, 6023, 8139, 9861, 10891, 11175, 10854, 10009, 8695,
-    6918, 4564, 1594, -1880, -5712, -9500, -12550, -14543, -15842, -16746,
-    -17051, -16534, -15259, -13419, -11252, -8823, -5784, -1929, 2192, 5805,
-    8676, 10921, 12641, 13972, 14899, 15137, 14613, 13606, 12168, 10132,
-    7623, 4833, 1669, -1746, -4814, -7165, -8987, -10513, -11708, -12321,
-    -11978, -10621, -8746, -6688, -4097, -707, 3024, 6464, 9316, 11451,
-    12872, 13807, 14388, 14475, 13932, 12766, 11062, 9007, 6742, 4130,
-    1064, -2157, -5126, -7719, -9957, -11844, -13380, -14411, -14621, -13920,
-    -12587, -10926, -8959, -6419, -3046, 896, 4617, 7591, 9936, 11795,
-    13001, 13460, 13212, 12188, 10428, 8224, 5746, 2912, -335, -3913,
-    -7496, -10438, -12372, -13706, -14870, -15570, -15443, -14691, -13546, -11948,
-    -9943, -7605, -4754, -1378, 2054, 5059, 7437, 9222, 10758, 12380,
-    13747, 14185, 13651, 12506, 10713, 8101, 4880, 1311, -2463, -6050,
-    -8973, -11194, -12931, -14190, -14783, -14481, -13179, -11146, -8804, -6178,
-    -3064, 359, 3683, 6742, 9457, 11597, 13082, 14127, 14838, 14969,
-    14213, 12614, 10578, 8333, 5557, 1943, -2110, -5875, -9047, -11629,
-    -13455, -14246, -13843, -12214, -9475, -5886, -1780, 2342, 5946, 8895,
-    11296, 12819, 12901, 11573, 9271, 6135, 2234, -2020, -6219, -10098,
-    -13185, -15004, -15576, -15179, -13933, -11843, -8804, -4730, -120, 4085,
-    7511, 10334, 12299, 12861, 12109, 10462, 7887, 4300, 148, -3988,
-    -7816, -11157, -13783, -15346, -15371, -13756, -11049, -7738, -3766, 738,
-    5061, 8678, 11626, 13875, 15110, 15166, 14059, 11721, 8154, 3685,
-    -1087, -5524, -9189, -11919, -13594, -13997, -13112, -11186, -8348, -4569,
-    -133, 4295, 8177, 11322, 13610, 14800, 14721, 13535, 11543, 8733,
-    4920, 436, -3918, -7692, -10931, -13483, -14858, -14795, -13407, -10883,
-    -7428, -3329, 1016, 5084, 8454, 11081, 12952, 13693, 13065, 11404,
-    8974, 5590, 1387, -2872, -6625, -9792, -12217, -13627, -13997, -13394,
-    -11775, -9185, -5770, -1718, 2467, 6113, 9001, 11182, 12312, 12047,
-    10712, 8696, 5832, 2049, -2111, -6094, -9666, -12533, -14344, -14977,
-    -14408, -12611, -9727, -5973, -1589, 2879, 6761, 9892, 12405, 13980,
-    14114, 12886, 10698, 7657, 3803, -464, -4589, -8179, -10998, -12852,
-    -13549, -13002, -11431, -9169, -6197, -2323, 2141, 6389, 9790, 12173,
-    13559, 13965, 13389, 11853, 9457, 6322, 2582, -1414, -5172, -8458,
-    -11215, -13089, -13674, -13024, -11361, -8667, -5063, -1052, 2926, 6622,
-    9718, 11969, 13304, 13584, 12739, 10959, 8203, 4186, -648, -5149,
-    -8758, -11648, -13671, -14437, -14054, -12798, -10649, -7653, -4006, 181,
-    4483, 8105, 10722, 12469, 13115, 12365, 10559, 8034, 4606, 421,
-    -3790, -7575, -10798, -13101, -14269, -14521, -13846, -11923, -8819, -4978,
-    -796, 3254, 6748, 9687, 12037, 13261, 13064, 11823, 9785, 6792,
-    3020, -913, -4533, -7629, -10099, -11893, -12803, -12537, -11158, -8881,
-    -5580, -1262, 3356, 7452, 10676, 12863, 13880, 13803, 12674, 10466,
-    7484, 4110, 357, -3632, -7279, -10224, -12379, -13344, -12791, -10939,
-    -7890, -3535, 1442, 5846, 9190, 11440, 12243, 11437, 9301, 5930,
-    1525, -3079, -7200, -10631, -12728, -12728, -10925, -7968, -3799, 1351,
-    6284, 10056, 12463, 13276, 12399, 10198, 6759, 1992, -3302, -7939,
-    -11500, -13777, -14200, -12662, -9623, -5286, 6, 5171, 9274, 12085,
-    13324, 12656, 10326, 6721, 1968, -3408, -8411, -12316, -14660, -15051,
-    -13592, -10688, -6393, -923, 4690, 9378, 12706, 14436, 14389, 12644,
-    9235, 4286, -1361, -6618, -10953, -13938, -14945, -13881, -11135, -6887,
-    -1606, 3542, 7722, 10805, 12545, 12743, 11712, 9465, 5588, 566,
-    -4329, -8421, -11421, -12783, -12416, -10676, -7351, -2396, 2918, 7251,
-    10389, 12228, 12360, 10957, 8328, 4274, -789, -5530, -9241, -11943,
-    -13228, -12733, -10814, -7577, -2833, 2568, 7194, 10478, 12351, 12572,
-    11275, 8757, 4743, -685, -6237, -10650, -13571, -14814, -14196, -11949,
-    -8267, -3248, 2247, 6956, 10343, 12352, 12781, 11640, 9136, 5210,
-    91, -5243, -9875, -13321, -15076, -14878, -12977, -9436, -4225, 1807,
-    7335, 11637, 14350, 15157, 14227, 11775, 7507, 1739, -4072, -8816,
-    -12277, -14125, -14041, -12294, -8988, -4039, 1611, 6534, 10323, 12987,
-    14081, 13599, 11994, 8991, 4322, -997, -5793, -9767, -12508, -13397,
-    -12544, -10106, -5710, 81, 5514, 9549, 12192, 13247, 12542, 10381,
-    6729, 1538, -4025, -8469, -11453, -13067, -13032, -11418, -8595, -4514,
-    597, 5655, 9751, 12615, 13926, 13501, 11650, 8422, 3601, -2180,
-    -7608, -11805, -14349, -14964, -13750, -10867, -6266, -551, 4865, 9045,
-    11863, 13211, 12998, 11362, 8206, 3549, -1743, -6673, -10863, -13817,
-    -14815, -13889, -11466, -7514, -2353, 2853, 7214, 10381, 11865, 11591,
-    10182, 7681, 3621, -1328, -5799, -9376, -12105, -13531, -13372, -11638,
-    -8008, -2757, 2608, 7008, 10486, 12734, 13022, 11505, 8731, 4746,
-    -15, -4466, -8027, -10560, -11633, -11203, -9779, -7209, -3013, 2065,
-    6574, 9845, 11730, 11968, 10476, 7241, 2220, -3753, -8947, -12199,
-    -13274, -11940, -8110, -2528, 3597, 9055, 12660, 13735, 12338, 8721,
-    3419, -2229, -6828, -9860, -11179, -10443, -7586, -3075, 2208, 6916,
-    9898, 11082, 10723, 8392, 3895, -1771, -7290, -11709, -14124, -13976,
-    -11383, -6599, -202, 6155, 10772, 13261, 13646, 11430, 6714, 712,
-    -5327, -10385, -13339, -13648, -11494, -6987, -703, 5478, 9823, 12166,
-    12727, 11101, 7245, 1963, -3700, -8495, -11203, -11573, -9991, -6431,
-    -1138, 4439, 8798, 11496, 12412, 11196, 7823, 2794, -3008, -8256,
-    -11743, -13097, -12256, -8916, -3396, 2807, 8043, 11473, 12923, 12422,
-    9908, 5365, -504, -6185, -10409, -12714, -12855, -10592, -6258, -892,
-    4181, 7874, 9818, 10144, 8596, 4750, -716, -6131, -10215, -12446,
-    -12488, -10230, -5955, -254, 5704, 10377, 13003, 13710, 12282, 8274,
-    2350, -3922, -9319, -13012, -14251, -12763, -8796, -2954, 3375, 8359,
-    11221, 12268, 11375, 7995, 2542, -3584, -9014, -12702, -13992, -12820,
-    -9363, -3925, 2343, 7645, 10964, 12329, 11699, 8783, 3914, -1792,
-    -7015, -10678, -12242, -11663, -8967, -4359, 1183, 6166, 9628, 11424,
-    11536, 9676, 5725, 325, -5178, -9512, -12035, -12448, -10451, -6108,
-    -293, 5541, 10024, 12420, 12652, 10754, 6695, 1056, -4775, -9547,
-    -12676, -13686, -12031, -7746, -1715, 4635, 9786, 12832, 13761, 12623,
-    9052, 3306, -3098, -8476, -11916, -13013, -11628, -8082, -3017, 2678,
-    7746, 11090, 12417, 11760, 8931, 4174, -1380, -6510, -10490, -12711,
-    -12552, -9811, -4935, 990, 6459, 10279, 12119, 11989, 9638, 5059,
-    -826, -6563, -10978, -13409, -13496, -11147, -6694, -994, 4725, 9317,
-    12118, 12859, 11306, 7365, 1648, -4441, -9457, -12507, -13091, -10990,
-    -6592, -952, 4676, 9206, 11907, 12560, 11193, 7787, 2687, -2963,
-    -7835, -11130, -12360, -11134, -7613, -2632, 2793, 7660, 11019, 12347,
-    11544, 8569, 3704, -1996, -7240, -11184, -13172, -12514, -9075, -3638,
-    2443, 7634, 10584, 10674, 8063, 3239, -2916, -8807, -12606, -13187,
-    -10437, -5084, 1450, 7394, 11221, 12047, 9724, 4889, -1152, -6806,
-    -10627, -11612, -9449, -4749, 1095, 6505, 10219, 11367, 9528, 5070,
-    -827, -6681, -11089, -12894, -11559, -7424, -1449, 4984, 10126, 12494,
-    11650, 8046, 2521, -3597, -8611, -11228, -10905, -7649, -2212, 3837,
-    8881, 11783, 11696, 8319, 2477, -4244, -10204, -13793, -13773, -10156,
-    -4177, 2583, 8532, 12116, 12439, 9599, 4352, -1989, -7564, -10759,
-    -10937, -8191, -3084, 3118, 8674, 12113, 12608, 10018, 5009, -1141,
-    -7039, -11368, -12969, -11288, -6753, -598, 5544, 10028, 11634, 9985,
-    5662, -33, -5586, -9682, -11349, -10096, -6169, -548, 5359, 10036,
-    12252, 11482, 7883, 2123, -4437, -9880, -12668, -12294, -9004, -3586,
-    2565, 7864, 11073, 11364, 8558, 3515, -2341, -7775, -11557, -12353,
-    -9652, -4291, 2161, 7953, 11407, 11613, 8774, 3656, -2625, -8371,
-    -11894, -12405, -9876, -4755, 1681, 7526, 11239, 12048, 9745, 4832,
-    -1454, -7634, -12199, -13718, -11587, -6572, -170, 6154, 10985, 13023,
-    11603, 7045, 623, -5725, -10146, -11602, -9916, -5502, 616, 6843,
-    11475, 13299, 11924, 7779, 1854, -4529, -9833, -12674, -12361, -9033,
-    -3514, 2792, 8215, 11354, 11398, 8303, 2991, -2986, -8177, -11422,
-    -11743, -8860, -3633, 2418, 7754, 11010, 11360, 8856, 4137, -1795,
-    -7382, -10962, -11716, -9665, -5153, 941, 6995, 11312, 12746, 10833,
-    6079, -51, -5974, -10478, -12447, -11111, -6792, -791, 5319, 9975,
-    11888, 10617, 6620, 842, -5322, -10129, -12180, -10948, -6705, -538,
-    5727, 10268, 12030, 10773, 6857, 1188, -4930, -10056, -12856, -12511,
-    -9125, -3631, 2640, 8229, 11710, 12040, 8966, 3285, -3333, -9007,
-    -12282, -12370, -9230, -3660, 2886, 8712, 12257, 12556, 9632, 4342,
-    -2062, -8087, -12191, -13330, -11257, -6403, 72, 6357, 10676, 11949,
-    9853, 4879, -1537, -7447, -11077, -11188, -7498, -1177, 5543, 10483,
-    12159, 9994, 4642, -2075, -7947, -11099, -10461, -6271, -111, 5926,
-    10030, 10921, 8175, 2602, -3975, -9395, -11740, -10006, -4713, 2250,
-    8480, 11899, 11360, 7055, 441, -6315, -10989, -11927, -8726, -2525,
-    4465, 9899, 12083, 10382, 5302, -1621, -8153, -12045, -11885, -7693,
-    -958, 5951, 10709, 11791, 8832, 2790, -4217, -9709, -11872, -10107,
-    -5069, 1550, 7578, 11117, 11065, 7383, 1260, -5195, -9792, -11003,
-    -8347, -2675, 3966, 9225, 11425, 9943, 5251, -1143, -7113, -10622,
-    -10371, -6363, -89, 6124, 10233, 11052, 8303, 2702, -3997, -9493,
-    -11821, -10162, -5196, 1226, 6951, 10243, 10101, 6449, 326, -6300,
-    -11241, -12878, -10666, -5281, 1544, 7535, 10650, 9819, 5312, -1317,
-    -7743, -11679, -11680, -7649, -977, 5886, 10490, 11440, 8674, 3146,
-    -3463, -9065, -11781, -10623, -5916, 707, 6923, 10705, 10925, 7427,
-    1130, -5913, -11165, -12740, -10141, -4333, 2664, 8548, 11494, 10558,
-    5928, -890, -7492, -11614, -11982, -8552, -2458, 4268, 9366, 11114,
-    8894, 3445, -3326, -9061, -11768, -10452, -5483, 1407, 7772, 11465,
-    11378, 7639, 1430, -5309, -10329, -11797, -9145, -3406, 3286, 8670,
-    11144, 10113, 5942, -144, -6188, -10045, -10344, -7101, -1488, 4719,
-    9602, 11574, 9866, 4813, -2046, -8298, -11626, -10852, -6264, 606,
-    7384, 11637, 11924, 8281, 2003, -4787, -9782, -11343, -9041, -3672,
-    2944, 8530, 11295, 10537, 6530, 379, -5994, -10340, -11031, -7759,
-    -1700, 4904, 9716, 11215, 8976, 3622, -3152, -8983, -11814, -10750,
-    -6274, 30, 6097, 10062, 10705, 7713, 1932, -4717, -9925, -11876,
-    -9867, -4562, 2218, 8167, 11275, 10488, 6088, -400, -6785, -10910,
-    -11341, -7943, -1974, 4475, 9281, 10921, 8909, 3891, -2597, -8474,
-    -11644, -10863, -6414, 104, 6520, 10772, 11504, 8496, 2671, -4147,
-    -9619, -11714, -9681, -4342, 2390, 8141, 10780, 9255, 4058, -2937,
-    -9012, -11564, -9380, -3349, 3981, 9530, 10899, 7436, 592, -6784,
-    -11673, -11999, -7528, -133, 7008, 10878, 9902, 4594, -2650, -8686,
-    -11040, -8801, -2843, 4457, 10083, 11650, 8453, 1804, -5461, -10231,
-    -10548, -6398, 435, 7137, 10925, 10160, 5062, -2295, -8782, -11547,
-    -9356, -3171, 4339, 9989, 11400, 7956, 1047, -6471, -11411, -11589,
-    -6874, 676, 7748, 11291, 9871, 4237, -3105, -9050, -11148, -8539,
-    -2325, 4823, 9784, 10369, 6324, -544, -7215, -10860, -10040, -5165,
-    1779, 7994, 10934, 9330, 3763, -3495, -9397, -11456, -8855, -2725,
-    4417, 9696, 10960, 7628, 980, -6277, -11066, -11267, -6755, 507,
-    7405, 11077, 10083, 4913, -2280, -8568, -11364, -9461, -3618, 3645,
-    9143, 10498, 7213, 820, -5892, -10118, -10156, -5994, 698, 7161,
-    10617, 9498, 4223, -2930, -8858, -11034, -8606, -2657, 4333, 9497,
-    10673, 7280, 647, -6463, -11012, -11043, -6584, 408, 6976, 10430,
-    9385, 4244, -2930, -9142, -11626, -9103, -2539, 5136, 10382, 10788,
-    6245, -1090, -7919, -11347, -10063, -4725, 2441, 8575, 11278, 9515,
-    4011, -3016, -8700, -10657, -7977, -1675, 5641, 10830, 11600, 7603,
-    614, -6293, -10187, -9554, -4837, 1900, 7901, 10771, 9358, 4216,
-    -2545, -8065, -9964, -7436, -1631, 4893, 9349, 9888, 6291, 4,
-    -6412, -10260, -9816, -5170, 1693, 7726, 10241, 8159, 2442, -4434,
-    -9597, -10932, -7890, -1692, 5097, 9598, 9885, 5911, -455, -6350,
-    -9268, -8103, -3468, 2705, 7947, 10123, 8241, 2949, -3588, -8567,
-    -9849, -6992, -1391, 4486, 8259, 8551, 5365, -20, -5496, -8834,
-    -8576, -4762, 971, 6099, 8401, 6958, 2453, -3259, -7938, -9749,
-    -7885, -2927, 3216, 7966, 9193, 6276, 467, -5694, -9585, -9640,
-    -5917, 47, 5884, 9263, 8761, 4478, -1902, -7722, -10457, -8835,
-    -3437, 3513, 9061, 10744, 7670, 1001, -6431, -11296, -11293, -6308,
-    1419, 8295, 11070, 8437, 1717, -5721, -10097, -9125, -3263, 4437,
-    9886, 10140, 5009, -2816, -9201, -10755, -6587, 1248, 8783, 12118,
-    9411, 1900, -6608, -11658, -10527, -3766, 5045, 11251, 11640, 6116,
-    -2370, -9455, -11583, -7726, 163, 8100, 11996, 9735, 2358, -6361,
-    -11849, -11195, -4749, 4083, 10704, 11748, 6756, -1696, -9355, -12390,
-    -9266, -1515, 6972, 11871, 10649, 3922, -4814, -11005, -11409, -5786,
-    2972, 10328, 12415, 8057, -554, -8921, -12588, -9550, -1391, 7555,
-    12559, 11040, 3879, -5147, -11383, -11654, -5814, 3215, 10889, 13303,
-    9205, 704, -7794, -11928, -9703, -2505, 5749, 10753, 10028, 4079,
-    -3987, -10058, -11035, -6372, 1602, 8788, 11387, 7917, 55, -8199,
-    -12612, -10919, -3987, 4646, 10564, 10690, 4863, -4013, -11393, -13422,
-    -8995, -388, 7945, 11746, 9185, 1750, -6617, -11580, -10585, -4121,
-    4516, 10865, 11575, 6212, -2439, -9820, -12057, -8037, 56, 7988,
-    11713, 9373, 2126, -6465, -12143, -11987, -5917, 3114, 10507, 12385,
-    7741, -960, -9132, -12593, -9789, -2466, 5453, 9996, 9092, 3447,
-    -3938, -9289, -9891, -5430, 1815, 8092, 10096, 6719, -313, -7317,
-    -10585, -8348, -1739, 5791, 10296, 9417, 3634, -4014, -9565, -10210,
-    -5710, 1581, 7996, 10402, 7715, 1368, -5421, -9235, -8153, -2755,
-    4140, 8921, 9088, 4588, -2167, -7603, -8876, -5336, 1165, 7244,
-    9717, 7246, 1063, -5621, -9286, -7961, -2304, 4748, 9543, 9625,
-    4989, -1958, -7639, -9113, -5577, 1183, 7655, 10404, 7922, 1483,
-    -5523, -9435, -8285, -2781, 4161, 8988, 9284, 4913, -1949, -7860,
-    -9776, -6623, 54, 6792, 10007, 7943, 1647, -5599, -10070, -9541,
-    -4380, 2722, 8166, 9231, 5424, -1262, -7352, -9676, -7049, -903,
-    5501, 8829, 7407, 2031, -4510, -8847, -8696, -4007, 2914, 8475,
-    9623, 5573, -1609, -8046, -10190, -6837, 210, 7200, 10492, 8437,
-    2123, -5243, -9929, -9494, -4079, 3506, 9100, 9430, 4101, -3937,
-    -9970, -10317, -4661, 3642, 9562, 9483, 3433, -4920, -10518, -9991,
-    -3685, 4567, 9792, 8877, 2424, -5662, -10576, -9506, -3278, 4228,
-    8496, 7113, 1199, -5348, -8312, -5792, 609, 6821, 8913, 5626,
-    -830, -6241, -7142, -3051, 3276, 7677, 7266, 2245, -4260, -8182,
-    -7042, -1494, 5038, 8443, 6478, 251, -6359, -9082, -5994, 1129,
-    7811, 9664, 5221, -3014, -10029, -11383, -6015, 3004, 10268, 11309,
-    5378, -4012, -11162, -11648, -5076, 4621, 11543, 11415, 4210, -5791,
-    -12565, -11958, -4209, 6127, 12860, 11869, 3649, -6898, -13386, -11850,
-    -3222, 7227, 13161, 11093, 2470, -7354, -12507, -10141, -1985, 6912,
-    11319, 8873, 1316, -6693, -10414, -7804, -655, 6566, 9471, 6415,
-    -549, -7021, -9036, -5523, 1109, 6588, 7527, 3532, -2641, -6953,
-    -6698, -2213, 3428, 6487, 5001, 11, -5187, -7227, -4815, 492,
-    5313, 6566, 3376, -2355, -7064, -7683, -3611, 2755, 7368, 7070,
-    1744, -5412, -9829, -8524, -2121, 5491, 9619, 7724, 955, -6624,
-    -10524, -8466, -1666, 5880, 9702, 7479, 522, -6863, -9954, -6638,
-    1053, 8105, 9772, 4791, -3664, -10025, -9972, -3254, 6143, 12488,
-    11794, 4197, -6085, -13124, -12622, -4456, 7028, 15280, 15277, 6620,
-    -5956, -15206, -15666, -6998, 5770, 15280, 16227, 8385, -3490, -12630,
-    -14168, -7739, 2604, 10890, 12646, 7316, -1616, -8830, -10374, -5958,
-    1086, 6119, 6227, 1977, -3256, -5792, -4154, 110, 3754, 4186,
-    1211, -2956, -5250, -3798, 831, 5893, 8080, 5585, -587, -6953,
-    -9514, -6306, 1117, 8376, 10901, 6886, -1436, -9100, -11474, -7117,
-    1373, 8981, 11262, 6918, -1505, -9120, -11540, -7458, 549, 7552,
-    9290, 4848, -2783, -8669, -9135, -4068, 3172, 8032, 7630, 2386,
-    -4405, -8625, -7724, -2198, 4614, 8396, 6498, -162, -7349, -10110,
-    -6218, 2007, 9079, 10148, 4470, -4144, -10229, -10624, -6437, -1698,
-    -108, -2558, -7141, -11125, -12942, -12740, -11552, -10239, -9141, -8380,
-    -8142, -8545, -9338, -9934, -9852, -9142, -8339, -7972, -8115, -8401,
-    -8422, -8103, -7713, -7562, -7721, -7993, -8086, -7800, -7117, -6200,
-    -5356, -4936, -5144, -5872, -6713, -7206, -7144, -6672, -6094, -5591,
-    -5161, -4798, -4681, -5076, -6001, -7002, -7363, -6644, -5094, -3567,
-    -2950, -3586, -5102, -6698, -7596, -7360, -6011, -4030, -2262, -1616,
-    -2560, -4693, -6815, -7601, -6501, -4159, -2001, -1267, -2233, -4150,
-    -5847, -6462, -5805, -4271, -2558, -1393, -1294, -2332, -3979, -5280,
-    -5373, -4075, -2079, -538, -323, -1477, -3247, -4592, -4784, -3718,
-    -1890, -145, 668, 83, -1672, -3676, -4734, -4099, -2006, 392,
-    1724, 1263, -638, -2843, -4142, -3911, -2327, -171, 1564, 2070,
-    1053, -1067, -3250, -4289, -3506, -1222, 1345, 2798, 2404, 509,
-    -1755, -3195, -3184, -1845, 155, 1948, 2747, 2105, 144, -2325,
-    -4054, -3984, -1961, 1012, 3268, 3494, 1584, -1285, -3419, -3656,
-    -1993, 537, 2559, 3101, 2006, -127, -2303, -3551, -3297, -1622,
-    705, 2537, 2923, 1657, -555, -2469, -3008, -1876, 312, 2420,
-    3424, 2905, 1182, -896, -2342, -2435, -1057, 1188, 3189, 3871,
-    2813, 556, -1645, -2533, -1598, 610, 2850, 3935, 3384, 1605,
-    -411, -1644, -1525, -147, 1833, 3495, 4050, 3222, 1413, -466,
-    -1443, -982, 706, 2745, 4055, 3950, 2498, 477, -1028, -1186,
-    129, 2259, 4115, 4770, 3919, 2029, 95, -873, -391, 1273,
-    3244, 4472, 4258, 2657, 494, -1066, -1167, 237, 2346, 3963,
-    4200, 3001, 1106, -443, -907, -172, 1283, 2696, 3387, 3035,
-    1801, 259, -828, -887, 127, 1641, 2767, 2867, 1956, 648,
-    -293, -435, 149, 1036, 1783, 2164, 2155, 1796, 1158, 437,
-    -30, 50, 719, 1663, 2357, 2377, 1691, 680, -109, -267,
-    301, 1335, 2334, 2812, 2553, 1705, 715, 138, 331, 1195,
-    2222, 2838, 2740, 1996, 996, 270, 194, 773, 1675, 2449,
-    2731, 2392, 1631, 898, 621, 940, 1661, 2394, 2762, 2598,
-    2027, 1388, 1029, 1113, 1550, 2054, 2327, 2240, 1883, 1479,
-    1236, 1240, 1419, 1629, 1776, 1849, 1854, 1779, 1634, 1492,
-    1448, 1534, 1677, 1755, 1691, 1521, 1371, 1365, 1498, 1608,
-    1532, 1287, 1056, 998, 1131, 1365, 1571, 1617, 1451, 1152,
-    877, 760, 890, 1280, 1766, 2045, 1903, 1415, 894, 664,
-    862, 1357, 1840, 2044, 1891, 1452, 872, 365, 166, 407,
-    1014, 1710, 2110, 1944, 1303, 630, 378, 695, 1406, 2178,
-    2654, 2588, 1980, 1092, 319, 43, 451, 1347, 2169, 2358,
-    1788, 856, 167, 105, 618, 1339, 1908, 2178, 2154, 1850,
-    1279, 590, 123, 245, 1029, 2068, 2687, 2444, 1487, 433,
-    -85, 173, 984, 1871, 2413, 2403, 1850, 950, 69, -358,
-    -46, 914, 2014, 2595, 2306, 1368, 392, -63, 189, 939,
-    1752, 2222, 2165, 1628, 815, 46, -306, -28, 748, 1610,
-    2118, 2034, 1431, 666, 157, 136, 595, 1363, 2121, 2450,
-    2090, 1188, 236, -237, 26, 848, 1687, 2022, 1752, 1180,
-    657, 347, 266, 389, 697, 1148, 1595, 1767, 1462, 796,
-    166, -52, 258, 958, 1727, 2220, 2235, 1777, 1005, 226,
-    -120, 292, 1326, 2361, 2724, 2167, 1013, -61, -444, 36,
-    1028, 1953, 2395, 2256, 1659, 840, 135, -89, 344, 1240,
-    2104, 2443, 2038, 1072, 50, -475, -255, 539, 1487, 2152,
-    2212, 1582, 510, -480, -862, -389, 712, 1812, 2251, 1785,
-    711, -376, -919, -658, 213, 1163, 1701, 1645, 1050, 134,
-    -683, -936, -484, 386, 1241, 1714, 1561, 796, -188, -846,
-    -855, -229, 769, 1684, 1995, 1471, 399, -599, -981, -565,
-    395, 1356, 1818, 1599, 864, -11, -585, -542, 124, 1094,
-    1890, 2103, 1595, 636, -208, -469, -92, 625, 1310, 1688,
-    1615, 1113, 397, -194, -363, 10, 797, 1621, 2009, 1709,
-    935, 220, -20, 250, 802, 1335, 1582, 1424, 967, 453,
-    77, -37, 188, 687, 1195, 1433, 1339, 1040, 718, 523,
-    513, 634, 821, 1069, 1322, 1393, 1134, 616, 96, -147,
-    60, 640, 1219, 1414, 1159, 676, 214, -58, -25, 302,
-    746, 1086, 1173, 937, 437, -63, -248, -6, 514, 1053,
-    1377, 1346, 984, 467, 6, -207, -35, 490, 1072, 1320,
-    1040, 371, -323, -667, -494, 48, 623, 943, 909, 578,
-    96, -334, -493, -249, 323, 907, 1120, 813, 187, -361,
-    -517, -232, 266, 660, 778, 666, 440, 158, -140, -348,
-    -316, 19, 521, 888, 871, 484, -12, -313, -243, 162,
-    657, 937, 882, 591, 198, -188, -406, -316, 5, 323,
-    474, 430, 213, -68, -217, -117, 147, 425, 635, 725,
-    643, 408, 128, -73, -100, 80, 353, 516, 469, 269,
-    31, -122, -73, 180, 459, 602, 613, 537, 362, 137,
-    29, 115, 278, 379, 399, 367, 305, 282, 363, 491,
-    525, 433, 331, 338, 440, 542, 579, 547, 467, 366,
-    297, 312, 403, 524, 645, 734, 726, 586, 385, 260,
-    301, 497, 747, 906, 871, 645, 326, 60, 7, 225,
-    585, 867, 951, 827, 522, 155, -33, 104, 448, 765,
-    908, 791, 376, -167, -503, -461, -155, 216, 508, 568,
-    308, -132, -487, -582, -391, 14, 446, 648, 502, 122,
-    -271, -488, -421, -113, 231, 421, 405, 232, -32, -285,
-    -403, -347, -163, 95, 354, 465, 311, -53, -415, -562,
-    -415, -50, 332, 522, 421, 103, -254, -488, -513, -318,
-    41, 416, 588, 420, -16, -484, -725, -589, -130, 383,
-    640, 515, 117, -341, -638, -602, -240, 232, 555, 584,
-    301, -184, -619, -737, -494, -64, 336, 540, 434, 58,
-    -362, -583, -510, -190, 233, 540, 541, 244, -164, -473,
-    -538, -333, 22, 326, 443, 355, 100, -220, -432, -403,
-    -168, 136, 372, 417, 216, -120, -368, -389, -217, 36,
-    260, 354, 271, 67, -143, -258, -229, -72, 132, 279,
-    285, 127, -115, -289, -280, -123, 71, 220, 271, 194,
-    31, -102, -143, -116, -48, 60, 166, 179, 66, -100,
-    -213, -208, -89, 75, 195, 206, 108, -29, -110, -98,
-    -39, 15, 68, 114, 97, 7, -81, -110, -90, -36,
-    53, 128, 117, 27, -56, -88, -73, -24, 33, 58,
-    39, 0, -41, -77, -84, -60, -31, -3, 30, 27,
-    -51, -142, -148, -78, -12, 31, 59, 36, -42, -94,
-    -73, -29, -4, 29, 67, 54, -13, -66, -59, -16,
-    31, 70, 78, 48, 2, -38, -68, -78, -61, -21,
-    23, 50, 37, -8, -49, -50, -20, 17, 49, 67,
-    60, 34, 8, -1, 10, 40, 66, 71, 65, 55,
-    30, -8, -35, -39, -31, -6, 36, 56, 22, -20,
-    -21, 0, 6, 15, 38, 38, 9, -7, -9, -27,
-    -44, -17, 27, 32, 8, -4, -11, -27, -24, 4,
-    20, 5, -10, -10, -13, -18, -15, -16, -29, -38,
-    -23, 3, 22, 22, 1, -26, -37, -24, -8, 1,
-    9, 13, 5, -4, -5, -1, 1, 7, 11, 5,
-    -4, -8, -9, -14, -20, -29, -32, -14, 18, 31,
-    13, -1, 0, -1, -5, 7, 20, 3, -19, -10,
-    9, 4, -8, 2, 14, 7, 4, 21, 29, 16,
-    9, 22, 32, 28, 22, 15, 0, -16, -21, -15,
-    -4, 6, 8, 2, -4, -7, -12, -12, -1, 17,
-    31, 37, 30, 4, -31, -50, -42, -20, 0, 2,
-    -12, -23, -13, 4, 14, 19, 25, 21, 3, -10,
-    -16, -31, -41, -22, 2, -4, -26, -27, -13, -6,
-    6, 35, 48, 31, 15, 16, 10, -1, 6, 27,
-    27, 11, 11, 24, 28, 28, 36, 38, 25, 15,
-    18, 24, 27, 30, 32, 26, 17, 14, 13, 4,
-    -14, -36, -47, -37, -14, 0, -4, -16, -20, -11,
-    1, 7, 3, -3, -7, -7, -2, 8, 15, 12,
-    7, 5, -4, -18, -14, 4, 7, -8, -10, 8,
-    18, 14, 20, 30, 22, 1, -5, -4, -9, -4,
-    19, 34, 17, -12, -23, -13, 3, 18, 21, 12,
-    -1, -13, -23, -26, -15, 2, 13, 17, 15, 2,
-    -14, -18, -4, 6, 7, 11, 22, 22, 8, -5,
-    -7, -3, -1, 0, 3, 3, -1, -5, 0, 17,
-    31, 31, 24, 17, 5, -10, -14, -3, 3, -1,
-    -3, 3, 1, -16, -30, -24, -11, -5, -7, -11,
-    -16, -17, -7, 12, 28, 29, 21, 14, 8, 0,
-    -3, 3, 16, 23, 19, 12, 8, 9, 11, 10,
-    3, -4, -8, -11, -14, -13, -7, -6, -9, -8,
-    -4, -10, -23, -25, -17, -18, -24, -17, -4, -5,
-    -11, 0, 17, 21, 18, 25, 34, 30, 22, 20,
-    15, 8, 12, 27, 34, 29, 24, 19, 7, -5,
-    -10, -12, -13, -1, 20, 28, 19, 12, 15, 12,
-    3, 7, 21, 20, 4, -2, 2, 0, -6, 5,
-    23, 23, 11, 12, 19, 12, 2, 11, 25, 23,
-    11, 6, 3, -4, -9, -9, -12, -18, -12, 2,
-    10, 12, 18, 24, 22, 21, 23, 15, 0, -1,
-    10, 13, 3, 0, 8, 3, -12, -14, 0, 6,
-    3, 9, 18, 11, -3, -2, 8, 9, 2, 5,
-    8, -3, -19, -16, -2, 6, 12, 20, 24, 19,
-    14, 9, -1, -12, -9, 0, 3, 1, 1, -3,
-    -14, -22, -19, -22, -31, -31, -18, -13, -21, -21,
-    -9, -5, -7, -2, 9, 11, 2, 0, 3, 2,
-    0, 2, 9, 11, 11, 14, 16, 11, 5, 4,
-    7, 10, 7, -1, -9, -8, 0, 7, 9, 8,
-    5, -3, -16, -24, -21, -11, -3, 0, -1, -5,
-    -9, -6, 8, 18, 12, 3, 4, 8, 4, 0,
-    8, 18, 19, 14, 10, 3, -7, -13, -8, 0,
-    0, -1, -1, 0, 1, 2, 6, 12, 13, 5,
-    -4, -5, -4, -6, -8, 0, 9, 10, 4, 0,
-    -6, -10, -8, 0, 8, 12, 13, 11, 4, -2,
-    -6, -4, 6, 18, 18, 2, -8, -4, 2, 3,
-    5, 12, 10, 0, -5, -3, -7, -13, -9, 0,
-    -2, -11, -8, 3, 8, 6, 4, 2, -2, -6,
-    -3, 0, 2, 2, 1, -2, -6, -6, -1, 4,
-    2, -3, -7, -3, 8, 20, 24, 21, 15, 14,
-    15, 14, 9, 6, 4, 1, 0, 2, 5, 1,
-    -2, -1, -2, -7, -6, 0, 0, -6, -7, -1,
-    0, -2, -1, 0, -9, -19, -18, -12, -11, -8,
-    -1, 0, -7, -8, 1, 9, 9, 8, 9, 5,
-    0, -3, -5, -7, -7, -2, 1, 0, -5, -6,
-    -1, 7, 15, 16, 10, 3, -3, -7, -6, -2,
-    0, 1, 2, 1, -1, -3, -1, 1, 5, 9,
-    11, 8, 6, 5, 2, -1, 0, 1, -1, -6,
-    -6, -4, -7, -8, -3, 0, -3, -4, 0, 2,
-    -2, -5, -2, 0, 0, 1, 1, -4, -12, -13,
-    -7, -1, 1, 2, 2, 1, 0, 0, 0, 0,
-    0, -1, -1, 0, -1, -4, -6, -6, -6, -3,
-    3, 7, 5, -1, -5, -6, -2, 3, 6, 5,
-    1, 1, 1, 2, 4, 6, 3, 0, 0, 1,
-    2, 3, 5, 3, -2, -3, 1, 4, 3, 3,
-    4, 3, 2, 2, 2, 0, 0, 1, 3, 1,
-    0, 0, 3, 4, 5, 6, 5, 3, 2, 0,
-    0, -1, -2, -4, -4, -4, -4, -3, -1, 0,
-    -2, -3, -2, -1, -1, -3, -3, -2, -1, 0,
-    0, -1, -1, 0, 0, 0, -1, -2, -2, -2,
-    -1, -1, -1, -1, -1, -1, -1, -1, 0, -1,
-    -2, -3, -1, 0, 1, 1, 0, -1, 0, 0,
-    2, 2, 2, 1, 0, 0, 1, 0, 0, 1,
-    1, 0, 0, 1, 1, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0
+static const uint8_t sound_low_battery_data[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x99, 0x90,
+    0x10, 0x11, 0x00, 0x00, 0x01, 0x00, 0x01, 0x90, 0x09, 0x90, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x09, 0x09, 0x19, 0x00, 0x01, 0x09, 0x90, 0x10, 0x01, 0x01, 0x00, 0x09, 0x00,
+    0x10, 0x00, 0x99, 0x99, 0x19, 0x21, 0x22, 0x11, 0x99, 0x09, 0x90, 0xa9, 0xba, 0xac, 0x19, 0x32,
+    0x43, 0x11, 0x11, 0x11, 0x21, 0x91, 0xbb, 0xcb, 0x0a, 0x32, 0x33, 0x02, 0x99, 0x99, 0x21, 0x01,
+    0x05, 0x00, 0x00, 0x00, 0xbb, 0xac, 0x00, 0x22, 0x11, 0x90, 0x1a, 0x32, 0x34, 0x13, 0xa9, 0xab,
+    0x9a, 0xa9, 0xb9, 0xbd, 0x89, 0x41, 0x34, 0x15, 0x01, 0x99, 0x8a, 0xbb, 0xbd, 0xbd, 0xaa, 0x31,
+    0x35, 0x33, 0x14, 0x11, 0x22, 0x23, 0xba, 0xdd, 0xab, 0x99, 0x18, 0x99, 0xbc, 0x1a, 0x35, 0x35,
+    0x14, 0x01, 0x08, 0x11, 0x99, 0xdc, 0xcc, 0xaa, 0x18, 0x53, 0x22, 0x11, 0x28, 0x33, 0x14, 0xa9,
+    0xde, 0xbb, 0x08, 0x01, 0xba, 0xc9, 0x2b, 0x13, 0x66, 0x13, 0x18, 0x11, 0x22, 0x52, 0x93, 0xdf,
+    0x9a, 0x9a, 0x18, 0x22, 0xa9, 0x42, 0x10, 0x27, 0x11, 0xc0, 0xbc, 0x9c, 0x30, 0x00, 0x11, 0x99,
+    0x38, 0x77, 0x81, 0x90, 0x9a, 0x89, 0x81, 0x21, 0xd9, 0xb9, 0xaf, 0x21, 0x11, 0xa8, 0x21, 0x28,
+    0x37, 0x43, 0xfb, 0x9b, 0x08, 0x15, 0x0a, 0x25, 0xaa, 0x11, 0x02, 0xfb, 0x30, 0xfa, 0x1b, 0x03,
+    0x80, 0x38, 0xc3, 0x6b, 0x95, 0x8a, 0xa9, 0x40, 0x80, 0x92, 0x3a, 0xf3, 0x1b, 0x88, 0x81, 0x59,
+    0xd2, 0x8b, 0x88, 0x35, 0x02, 0x99, 0xc8, 0x7b, 0xd2, 0x1b, 0x23, 0xc9, 0x39, 0xd8, 0x48, 0x12,
+    0x83, 0x9d, 0xb0, 0x2c, 0x86, 0x30, 0x92, 0x8b, 0x8a, 0x25, 0x51, 0xe8, 0x8b, 0xc9, 0x38, 0x34,
+    0xa1, 0xab, 0xbb, 0x63, 0x03, 0x00, 0xd2, 0x9f, 0x11, 0x08, 0x01, 0x02, 0xdb, 0x38, 0x07, 0x09,
+    0x90, 0x0a, 0xa9, 0x21, 0x29, 0x05, 0x48, 0xb1, 0x9f, 0x20, 0x80, 0xb9, 0x59, 0xf8, 0x3a, 0x83,
+    0x00, 0x12, 0xdd, 0x18, 0x11, 0x24, 0xa1, 0xaf, 0x11, 0x9a, 0x34, 0x80, 0x90, 0x89, 0x21, 0x85,
+    0x3b, 0xf3, 0x0d, 0x00, 0x10, 0x88, 0x02, 0xae, 0x22, 0xa8, 0x52, 0xc1, 0x1a, 0x05, 0xab, 0x10,
+    0x88, 0x52, 0xb8, 0x30, 0x88, 0x91, 0x0d, 0xc8, 0x89, 0xab, 0x43, 0x21, 0xd0, 0x48, 0x91, 0x98,
+    0x97, 0xff, 0x1d, 0x00, 0x21, 0x08, 0x17, 0xbf, 0x33, 0xdd, 0x41, 0x80, 0x00, 0x9b, 0x23, 0xca,
+    0x20, 0xa3, 0x8f, 0x44, 0xa8, 0x8a, 0x08, 0x00, 0x41, 0x98, 0x91, 0x9f, 0xc8, 0x48, 0x82, 0x41,
+    0xb8, 0x08, 0x88, 0x50, 0x92, 0x09, 0xac, 0x94, 0x9f, 0xa0, 0x72, 0x01, 0x91, 0x19, 0xe0, 0x18,
+    0x48, 0xe2, 0x75, 0x17, 0x8a, 0x43, 0x81, 0x30, 0xc3, 0xef, 0x09, 0x81, 0x18, 0x22, 0xa0, 0x8b,
+    0x43, 0x01, 0x38, 0xa3, 0xff, 0x0a, 0x01, 0x08, 0x23, 0xa1, 0x8c, 0x42, 0x82, 0x28, 0xa3, 0xff,
+    0x09, 0x00, 0x00, 0x21, 0x90, 0x9b, 0x52, 0x01, 0x28, 0x92, 0xef, 0x09, 0x01, 0x08, 0x31, 0x90,
+    0x9c, 0x31, 0x83, 0x20, 0x94, 0xef, 0x89, 0x01, 0x10, 0x21, 0xa0, 0x9a, 0x51, 0x02, 0x20, 0xb2,
+    0xdf, 0x0a, 0x01, 0x00, 0x42, 0x91, 0x9b, 0x62, 0x81, 0x10, 0x92, 0xdf, 0x89, 0x01, 0x00, 0x32,
+    0xa1, 0x9c, 0x51, 0x01, 0x28, 0x83, 0xef, 0x0a, 0x01, 0x80, 0x32, 0x91, 0xac, 0x41, 0x01, 0x18,
+    0x03, 0xdf, 0x8a, 0x11, 0x80, 0x32, 0x81, 0x9c, 0x40, 0x03, 0x18, 0x12, 0xdf, 0x8b, 0x11, 0x00,
+    0x33, 0x92, 0x9d, 0x31, 0x13, 0x28, 0x94, 0xef, 0x0a, 0x10, 0x08, 0x32, 0xa2, 0xac, 0x41, 0x12,
+    0x18, 0x14, 0xde, 0x8b, 0x11, 0x80, 0x32, 0x92, 0xcb, 0x38, 0x34, 0x00, 0x42, 0xf9, 0x9f, 0x18,
+    0x81, 0x10, 0x12, 0xb9, 0x1a, 0x34, 0x81, 0x30, 0xc2, 0xef, 0x09, 0x11, 0x18, 0x21, 0x90, 0x9b,
+    0x51, 0x02, 0x18, 0x13, 0xee, 0x8a, 0x10, 0x80, 0x31, 0x02, 0xca, 0x29, 0x15, 0x80, 0x41, 0xd8,
+    0xae, 0x10, 0x80, 0x18, 0x33, 0xc8, 0x0b, 0x34, 0x91, 0x30, 0x94, 0xdf, 0x0a, 0x11, 0x09, 0x32,
+    0xa3, 0xbc, 0x51, 0x12, 0x08, 0x32, 0xfb, 0x9e, 0x10, 0x80, 0x30, 0x12, 0xb9, 0x0b, 0x35, 0x81,
+    0x8a, 0x23, 0x45, 0x00, 0x22, 0xfc, 0x9d, 0x01, 0x80, 0x30, 0x04, 0xba, 0x29, 0x33, 0x81, 0x42,
+    0xe1, 0xaf, 0x19, 0x01, 0x19, 0x34, 0xb8, 0x8b, 0x43, 0x82, 0x38, 0x84, 0xdf, 0x8a, 0x01, 0x08,
+    0x42, 0x82, 0xab, 0x30, 0x14, 0x88, 0x33, 0xf9, 0xaf, 0x10, 0x80, 0x10, 0x23, 0xb9, 0x2a, 0x34,
+    0x80, 0x32, 0xe2, 0xbf, 0x09, 0x01, 0x18, 0x33, 0xa1, 0x9c, 0x53, 0x82, 0x10, 0x03, 0xdf, 0x9b,
+    0x10, 0x80, 0x31, 0x23, 0xc9, 0x1a, 0x45, 0x81, 0x18, 0xa2, 0xef, 0x0a, 0x01, 0x80, 0x31, 0x82,
+    0xb9, 0x38, 0x26, 0x80, 0x20, 0xd0, 0xbf, 0x08, 0x01, 0x00, 0x32, 0x92, 0xbc, 0x41, 0x24, 0x88,
+    0x22, 0xf9, 0x9f, 0x08, 0x81, 0x18, 0x32, 0xa0, 0x8c, 0x52, 0x02, 0x08, 0x03, 0xfc, 0xab, 0x10,
+    0x00, 0x30, 0x23, 0xc9, 0x8b, 0x54, 0x82, 0x10, 0x93, 0xcf, 0x8b, 0x10, 0x80, 0x41, 0x12, 0xca,
+    0x1a, 0x35, 0x81, 0x20, 0xa2, 0xef, 0x0a, 0x01, 0x80, 0x31, 0x02, 0xdb, 0x18, 0x15, 0x81, 0x20,
+    0xc2, 0xbf, 0x09, 0x11, 0x19, 0x42, 0x91, 0x9c, 0x30, 0x03, 0x10, 0x24, 0xf9, 0xae, 0x18, 0x81,
+    0x28, 0x32, 0xb8, 0x9b, 0x44, 0x02, 0x28, 0x14, 0xfc, 0x9b, 0x10, 0x80, 0x20, 0x14, 0xa9, 0x1b,
+    0x35, 0x82, 0x20, 0x94, 0xdf, 0x8a, 0x01, 0x80, 0x21, 0x02, 0xc9, 0x2a, 0x35, 0x81, 0x40, 0xb1,
+    0xdf, 0x09, 0x01, 0x08, 0x31, 0x82, 0xcb, 0x28, 0x25, 0x80, 0x31, 0xa1, 0xff, 0x89, 0x01, 0x08,
+    0x20, 0x03, 0xca, 0x19, 0x25, 0x81, 0x29, 0x83, 0xdf, 0x8a, 0x11, 0x80, 0x28, 0x32, 0xc8, 0x8a,
+    0x54, 0x81, 0x09, 0x22, 0xfb, 0xac, 0x20, 0x80, 0x08, 0x43, 0x91, 0x9c, 0x31, 0x04, 0x88, 0x32,
+    0xf0, 0xbd, 0x08, 0x01, 0x19, 0x53, 0x82, 0xbb, 0x38, 0x14, 0x09, 0x52, 0xc1, 0xbf, 0x09, 0x81,
+    0xd6, 0xc9, 0x4a, 0x00, 0x21, 0x24, 0xa8, 0x9a, 0x41, 0x11, 0x38, 0x14, 0xfa, 0xad, 0x08, 0x01,
+    0x10, 0x24, 0xa0, 0x9c, 0x28, 0x23, 0x10, 0x33, 0xf0, 0xcf, 0x19, 0x01, 0x00, 0x32, 0x81, 0xbc,
+    0x28, 0x25, 0x80, 0x30, 0xb2, 0xff, 0x09, 0x01, 0x80, 0x21, 0x82, 0xcb, 0x09, 0x53, 0x01, 0x28,
+    0x83, 0xee, 0x9a, 0x21, 0x80, 0x20, 0x23, 0xca, 0x8c, 0x41, 0x12, 0x28, 0x33, 0xfa, 0xaf, 0x10,
+    0x00, 0x18, 0x22, 0xa1, 0xad, 0x20, 0x04, 0x00, 0x33, 0xd0, 0xbf, 0x08, 0x11, 0x08, 0x41, 0x82,
+    0xcb, 0x1a, 0x33, 0x02, 0x41, 0x83, 0xee, 0x9b, 0x10, 0x00, 0x10, 0x33, 0xa0, 0xbd, 0x51, 0x13,
+    0x88, 0x42, 0xb2, 0xdf, 0x89, 0x01, 0x88, 0x30, 0x24, 0xc9, 0x1a, 0x23, 0x90, 0x31, 0x17, 0xea,
+    0xbb, 0x08, 0x90, 0x10, 0x54, 0x82, 0xba, 0x28, 0x23, 0x01, 0x54, 0x81, 0xde, 0x9b, 0x00, 0x00,
+    0x30, 0x25, 0xb0, 0x8c, 0x21, 0x12, 0x21, 0x24, 0xf8, 0xbd, 0x89, 0x01, 0x01, 0x32, 0x13, 0xda,
+    0x8a, 0x34, 0x13, 0x10, 0x12, 0xfd, 0xad, 0x18, 0x02, 0x80, 0x41, 0x82, 0xcb, 0x28, 0x25, 0x88,
+    0x10, 0x92, 0xdf, 0x8a, 0x11, 0x00, 0x28, 0x33, 0xc8, 0x9c, 0x42, 0x13, 0x88, 0x21, 0xf8, 0xbd,
+    0x09, 0x22, 0x08, 0x30, 0x14, 0xda, 0x1a, 0x25, 0x92, 0x88, 0x22, 0xfb, 0x9e, 0x10, 0x01, 0x88,
+    0x32, 0x91, 0xad, 0x40, 0x23, 0x99, 0x30, 0xb2, 0xff, 0x09, 0x10, 0x80, 0x18, 0x13, 0xc8, 0x0a,
+    0x44, 0x01, 0x88, 0x22, 0xfb, 0xad, 0x10, 0x82, 0x88, 0x32, 0xa2, 0xbc, 0x51, 0x23, 0x88, 0x20,
+    0xd1, 0xbf, 0x1a, 0x11, 0x00, 0x30, 0x13, 0xdb, 0x2a, 0x44, 0x81, 0x29, 0x82, 0xdf, 0x8a, 0x01,
+    0x00, 0x20, 0x33, 0xc9, 0x0b, 0x34, 0x82, 0x29, 0x16, 0xfb, 0x8d, 0x00, 0x80, 0x10, 0x33, 0xb1,
+    0x94, 0xf7, 0x45, 0x00, 0x2a, 0x25, 0x98, 0x51, 0x92, 0xcf, 0x0a, 0x10, 0x88, 0x41, 0x13, 0xc9,
+    0x09, 0x33, 0x90, 0x30, 0x05, 0xde, 0x8b, 0x10, 0x80, 0x31, 0x24, 0xb8, 0x8b, 0x42, 0x02, 0x20,
+    0x13, 0xfe, 0x9c, 0x08, 0x00, 0x21, 0x23, 0xa1, 0xbb, 0x58, 0x14, 0x00, 0x23, 0xf9, 0xaf, 0x08,
+    0x81, 0x10, 0x33, 0x92, 0x9d, 0x30, 0x02, 0x18, 0x23, 0xfa, 0xaf, 0x88, 0x01, 0x28, 0x42, 0x01,
+    0xaa, 0x18, 0x33, 0x80, 0x30, 0xb2, 0xff, 0x0e, 0x00, 0x00, 0x21, 0x12, 0xa9, 0x8a, 0x33, 0x82,
+    0x28, 0x03, 0xff, 0x9c, 0x10, 0x00, 0x21, 0x33, 0xc9, 0x0a, 0x33, 0x81, 0x40, 0xa3, 0xff, 0x8a,
+    0x10, 0x08, 0x31, 0x04, 0xba, 0x28, 0x23, 0x80, 0x72, 0xb2, 0xdf, 0x08, 0x00, 0x88, 0x33, 0xa2,
+    0x9c, 0x40, 0x12, 0x19, 0x43, 0xf8, 0xad, 0x10, 0x80, 0x00, 0x32, 0xa8, 0x9c, 0x51, 0x13, 0x08,
+    0x23, 0xfc, 0x9d, 0x10, 0x81, 0x28, 0x22, 0xb9, 0x0c, 0x44, 0x81, 0x28, 0x02, 0xcf, 0x8b, 0x11,
+    0x80, 0x20, 0x13, 0xca, 0x2b, 0x36, 0x01, 0x28, 0x92, 0xff, 0x89, 0x01, 0x80, 0x20, 0x12, 0xbb,
+    0x39, 0x17, 0x80, 0x21, 0xc0, 0xaf, 0x08, 0x80, 0x10, 0x32, 0xa0, 0x9b, 0x42, 0x12, 0x21, 0x16,
+    0xfa, 0x9c, 0x08, 0x80, 0x20, 0x24, 0xb0, 0x8c, 0x31, 0x12, 0x38, 0x15, 0xfc, 0xab, 0x20, 0x00,
+    0x30, 0x24, 0xd9, 0x8a, 0x33, 0x01, 0x21, 0x84, 0xdf, 0x8a, 0x11, 0x81, 0x21, 0x04, 0xda, 0x1a,
+    0x33, 0x91, 0x38, 0xa3, 0xff, 0x0a, 0x12, 0x88, 0x31, 0x82, 0xbd, 0x38, 0x14, 0x98, 0x31, 0xd0,
+    0xae, 0x28, 0x81, 0x10, 0x22, 0xa0, 0xab, 0x52, 0x02, 0x08, 0x82, 0xff, 0x89, 0x01, 0x00, 0x31,
+    0x81, 0xaa, 0x41, 0x03, 0x0a, 0x13, 0xfd, 0x8d, 0x10, 0x00, 0x20, 0x11, 0xa8, 0x18, 0x35, 0x80,
+    0xb2, 0x28, 0x43, 0x00, 0x98, 0xed, 0x8b, 0x10, 0x12, 0x20, 0x13, 0xc9, 0x39, 0x37, 0x98, 0x28,
+    0xf0, 0xae, 0x10, 0x91, 0x28, 0x24, 0xb8, 0x0b, 0x35, 0xa0, 0x30, 0x94, 0xdf, 0x09, 0x81, 0x80,
+    0x42, 0x92, 0xab, 0x31, 0x03, 0x18, 0x25, 0xfb, 0x9e, 0x10, 0x00, 0x20, 0x12, 0xc9, 0x09, 0x23,
+    0x01, 0x22, 0xf0, 0xaf, 0x19, 0x01, 0x00, 0x23, 0xa0, 0x8c, 0x43, 0x82, 0x10, 0x83, 0xff, 0x0a,
+    0x01, 0x80, 0x21, 0x02, 0xbb, 0x58, 0x13, 0x89, 0x33, 0xfa, 0x9f, 0x00, 0x80, 0x20, 0x22, 0xb9,
+    0x19, 0x24, 0x81, 0x31, 0xc2, 0xdf, 0x0a, 0x00, 0x00, 0x43, 0x91, 0x9b, 0x40, 0x13, 0x18, 0x13,
+    0xfc, 0x9e, 0x00, 0x00, 0x21, 0x12, 0xba, 0x29, 0x25, 0x00, 0x20, 0xf9, 0xae, 0x00, 0x00, 0x21,
+    0x02, 0xb9, 0x30, 0x15, 0x80, 0x33, 0xfc, 0x8e, 0x10, 0x98, 0x21, 0x03, 0xcb, 0x40, 0x13, 0x89,
+    0x42, 0xf9, 0x9c, 0x20, 0x90, 0x10, 0x13, 0xca, 0x39, 0x24, 0x00, 0x21, 0xfa, 0x9e, 0x18, 0x80,
+    0x21, 0x02, 0xa9, 0x29, 0x24, 0x10, 0x25, 0xf9, 0x9d, 0x00, 0x88, 0x40, 0x03, 0xba, 0x28, 0x03,
+    0x09, 0x45, 0xd0, 0xad, 0x00, 0x80, 0x38, 0x24, 0xa9, 0x1a, 0x02, 0x10, 0x43, 0xe8, 0xad, 0x08,
+    0x88, 0x41, 0x13, 0xa9, 0x19, 0x13, 0x88, 0x64, 0xe0, 0xac, 0x10, 0x80, 0x38, 0x14, 0xb8, 0x1b,
+    0x25, 0x90, 0x48, 0xd0, 0xae, 0x28, 0x81, 0x20, 0x23, 0xda, 0x19, 0x33, 0x00, 0x32, 0xfb, 0xbf,
+    0x10, 0x01, 0x31, 0x03, 0xbc, 0x19, 0x25, 0x00, 0x31, 0xfa, 0xae, 0x20, 0x00, 0x11, 0x03, 0xc9,
+    0x0b, 0x34, 0x81, 0x30, 0xf8, 0xad, 0x18, 0x01, 0x20, 0x23, 0xda, 0x2a, 0x24, 0x88, 0x33, 0xfb,
+    0x9e, 0x01, 0x80, 0x21, 0x03, 0xcb, 0x30, 0x03, 0x19, 0x12, 0xef, 0x0a, 0x01, 0x08, 0x23, 0xb1,
+    0x3f, 0xf1, 0x46, 0x00, 0x30, 0x13, 0x18, 0x05, 0xee, 0x0a, 0x01, 0x88, 0x43, 0x90, 0x8b, 0x43,
+    0x81, 0x18, 0xa2, 0xff, 0x19, 0x00, 0x10, 0x12, 0xa8, 0x09, 0x23, 0x11, 0x23, 0xfa, 0xbf, 0x00,
+    0x80, 0x41, 0x03, 0xbb, 0x49, 0x04, 0x08, 0x23, 0xfb, 0x8f, 0x00, 0x80, 0x21, 0x82, 0xaa, 0x41,
+    0x01, 0x18, 0x83, 0xef, 0x09, 0x01, 0x09, 0x33, 0xb8, 0x2b, 0x26, 0xa0, 0x30, 0xd0, 0xaf, 0x10,
+    0x91, 0x28, 0x12, 0xbb, 0x50, 0x13, 0x10, 0x03, 0xdf, 0x0b, 0x02, 0x88, 0x42, 0xb0, 0x8d, 0x43,
+    0x81, 0x20, 0x93, 0xef, 0x08, 0x01, 0x88, 0x12, 0xa8, 0x0b, 0x34, 0x01, 0x31, 0xe8, 0xbd, 0x10,
+    0x00, 0x38, 0x04, 0xbc, 0x30, 0x14, 0x08, 0x32, 0xfb, 0x8e, 0x10, 0x80, 0x20, 0x92, 0xab, 0x42,
+    0x22, 0x10, 0xb0, 0xef, 0x08, 0x80, 0x21, 0x02, 0xcb, 0x40, 0x03, 0x19, 0x33, 0xfe, 0x8a, 0x11,
+    0x08, 0x21, 0xb2, 0x8c, 0x43, 0x02, 0x10, 0xe8, 0xad, 0x18, 0x80, 0x42, 0x02, 0xac, 0x30, 0x84,
+    0x18, 0x13, 0xdf, 0x0a, 0x81, 0x18, 0x23, 0xa0, 0x1a, 0x34, 0x98, 0x11, 0xfb, 0x8f, 0x01, 0x09,
+    0x32, 0xb0, 0x0b, 0x36, 0x91, 0x20, 0xe1, 0xae, 0x10, 0x81, 0x38, 0x03, 0xcc, 0x38, 0x04, 0x08,
+    0x13, 0xed, 0x8a, 0x02, 0x08, 0x33, 0xb0, 0x8c, 0x33, 0x80, 0x52, 0xf8, 0x9c, 0x01, 0x80, 0x32,
+    0x93, 0xbc, 0x41, 0x82, 0x18, 0xa3, 0xef, 0x08, 0x00, 0x21, 0x12, 0xc9, 0x19, 0x13, 0x08, 0x12,
+    0xfd, 0x8b, 0x10, 0x21, 0x33, 0xb0, 0x0b, 0x23, 0x00, 0x35, 0xf9, 0xbf, 0x10, 0x10, 0x21, 0x02,
+    0xa9, 0x19, 0x44, 0x02, 0xd8, 0xbd, 0x89, 0x08, 0x63, 0x03, 0xaa, 0x19, 0x23, 0x10, 0x04, 0xed,
+    0x9b, 0x88, 0x20, 0x25, 0x91, 0x0a, 0x00, 0x88, 0x73, 0x02, 0xeb, 0xaa, 0x89, 0x00, 0x33, 0x25,
+    0x8f, 0x21, 0x47, 0x00, 0xca, 0x29, 0x32, 0x88, 0x42, 0xd2, 0xcf, 0x09, 0x11, 0x00, 0x31, 0x82,
+    0xcb, 0x19, 0x35, 0x01, 0x09, 0xb8, 0xef, 0x09, 0x21, 0x00, 0x11, 0x80, 0x9a, 0x31, 0x35, 0x81,
+    0x98, 0xed, 0xab, 0x18, 0x21, 0x20, 0x42, 0xb0, 0x0c, 0x45, 0x81, 0x18, 0x02, 0xdf, 0x8b, 0x10,
+    0x08, 0x51, 0x02, 0xaa, 0x18, 0x22, 0x41, 0x33, 0xe0, 0xbe, 0xab, 0x20, 0x12, 0x42, 0x04, 0xcb,
+    0x19, 0x25, 0x81, 0x21, 0xc0, 0xcf, 0x09, 0x01, 0x00, 0x22, 0x01, 0xbb, 0x48, 0x14, 0x88, 0x21,
+    0xe1, 0xbe, 0x19, 0x81, 0x19, 0x35, 0xa1, 0x8b, 0x32, 0x81, 0x40, 0x14, 0xfb, 0xac, 0x88, 0x10,
+    0x12, 0x32, 0x90, 0xac, 0x50, 0x24, 0x00, 0x01, 0xed, 0x9c, 0x10, 0x00, 0x30, 0x13, 0xcb, 0x2a,
+    0x25, 0x01, 0x21, 0xb1, 0xef, 0x0a, 0x10, 0x80, 0x21, 0x83, 0xca, 0x28, 0x24, 0x81, 0x32, 0xc2,
+    0xcf, 0x8a, 0x00, 0x88, 0x41, 0x13, 0xb9, 0x0a, 0x44, 0x11, 0x20, 0x04, 0xde, 0x9c, 0x00, 0x00,
+    0x11, 0x23, 0xb8, 0x8b, 0x62, 0x13, 0x11, 0x92, 0xcf, 0x9c, 0x18, 0x11, 0x11, 0x11, 0xa0, 0xbb,
+    0x71, 0x14, 0x80, 0x18, 0xd8, 0xbd, 0x09, 0x12, 0x88, 0x52, 0x82, 0xac, 0x38, 0x14, 0x00, 0x52,
+    0xa1, 0xdf, 0x09, 0x81, 0x88, 0x42, 0x02, 0xcb, 0x28, 0x14, 0x88, 0x21, 0x92, 0xdf, 0x89, 0x01,
+    0x88, 0x20, 0x23, 0xb8, 0x1a, 0x26, 0xa0, 0x28, 0x04, 0xfc, 0x9a, 0x01, 0x98, 0x31, 0x15, 0xb8,
+    0x09, 0x22, 0x01, 0x52, 0x83, 0xde, 0x9b, 0x08, 0x00, 0x31, 0x33, 0xc8, 0x9b, 0x72, 0x03, 0x08,
+    0x23, 0xfa, 0xae, 0x08, 0x81, 0x08, 0x43, 0x92, 0xab, 0x41, 0x02, 0x10, 0x34, 0xe8, 0xae, 0x8a,
+    0x00, 0x20, 0x33, 0x12, 0xcb, 0x29, 0x35, 0x00, 0x31, 0xb3, 0xff, 0x8b, 0x00, 0x88, 0x32, 0x23,
+    0x3d, 0x15, 0x45, 0x00, 0xbb, 0x30, 0x15, 0x80, 0x42, 0x92, 0xef, 0xaa, 0x10, 0x01, 0x21, 0x43,
+    0xa0, 0xbc, 0x31, 0x15, 0x90, 0x31, 0xd1, 0xbf, 0x1a, 0x11, 0x89, 0x41, 0x14, 0xb9, 0x1a, 0x42,
+    0x80, 0x18, 0x25, 0xfa, 0xac, 0x08, 0x81, 0x18, 0x53, 0x82, 0x9b, 0x28, 0x13, 0x10, 0x32, 0xd1,
+    0xdf, 0x8a, 0x00, 0x00, 0x31, 0x23, 0xa8, 0x0b, 0x44, 0x82, 0x18, 0x53, 0xf8, 0xae, 0x19, 0x00,
+    0x80, 0x32, 0x04, 0xca, 0x1a, 0x35, 0x81, 0x00, 0x82, 0xfd, 0x9b, 0x10, 0x01, 0x10, 0x32, 0xa1,
+    0xac, 0x51, 0x14, 0x08, 0x20, 0xb0, 0xff, 0x09, 0x10, 0x89, 0x21, 0x14, 0xb8, 0x8a, 0x33, 0x81,
+    0x08, 0x44, 0xe0, 0xae, 0x19, 0x10, 0x08, 0x41, 0x12, 0xba, 0x09, 0x24, 0x81, 0x10, 0x03, 0xee,
+    0x9c, 0x00, 0x80, 0x20, 0x43, 0x91, 0xaa, 0x31, 0x14, 0x98, 0x52, 0xb2, 0xef, 0x8a, 0x01, 0x00,
+    0x20, 0x24, 0xb8, 0x8b, 0x43, 0x12, 0x00, 0x22, 0xf9, 0xaf, 0x0a, 0x01, 0x01, 0x20, 0x14, 0xa9,
+    0x0a, 0x43, 0x13, 0x18, 0x32, 0xf9, 0xcf, 0x89, 0x01, 0x00, 0x20, 0x33, 0xb0, 0x8d, 0x42, 0x03,
+    0x88, 0x21, 0xc1, 0xef, 0x0a, 0x10, 0x00, 0x18, 0x32, 0x92, 0xbb, 0x41, 0x25, 0x90, 0x00, 0x02,
+    0xef, 0x9b, 0x10, 0x01, 0x08, 0x42, 0x02, 0xca, 0x29, 0x25, 0x91, 0x18, 0x33, 0xfd, 0xac, 0x10,
+    0x00, 0x18, 0x32, 0x03, 0xcb, 0x1a, 0x34, 0x02, 0x20, 0x24, 0xfb, 0xaf, 0x09, 0x10, 0x00, 0x21,
+    0x14, 0xb9, 0x0b, 0x42, 0x12, 0x11, 0x33, 0xf8, 0xbf, 0x0a, 0x10, 0x00, 0x21, 0x15, 0xb8, 0x8b,
+    0x33, 0x03, 0x21, 0x45, 0xc8, 0xcf, 0x09, 0x01, 0x90, 0x20, 0x24, 0xc8, 0x8b, 0x53, 0x01, 0x09,
+    0x32, 0xd1, 0xbe, 0x0a, 0x12, 0x88, 0x20, 0x23, 0xc9, 0x9b, 0x73, 0x13, 0x80, 0x21, 0xb0, 0xff,
+    0x56, 0xc9, 0x50, 0x00, 0x18, 0x00, 0x00, 0x11, 0x02, 0xba, 0x0b, 0x54, 0x02, 0x88, 0x32, 0xe0,
+    0xbf, 0x09, 0x11, 0x80, 0x10, 0x34, 0xb1, 0xbd, 0x30, 0x25, 0x88, 0x10, 0x14, 0xfb, 0xac, 0x18,
+    0x01, 0x00, 0x31, 0x23, 0xc8, 0x9e, 0x20, 0x24, 0x90, 0x28, 0x03, 0xef, 0x9a, 0x20, 0x01, 0x08,
+    0x32, 0x83, 0xcc, 0x0a, 0x52, 0x02, 0x00, 0x21, 0xd8, 0xce, 0x0a, 0x21, 0x00, 0x10, 0x23, 0xb0,
+    0xad, 0x20, 0x34, 0x02, 0x10, 0x14, 0xfd, 0xab, 0x18, 0x01, 0x08, 0x42, 0x02, 0xca, 0x0a, 0x43,
+    0x23, 0x08, 0x42, 0xa2, 0xff, 0x8b, 0x20, 0x90, 0x08, 0x53, 0x81, 0xab, 0x38, 0x24, 0x81, 0x28,
+    0x43, 0xe9, 0xbe, 0x89, 0x01, 0x80, 0x20, 0x24, 0x81, 0xca, 0x29, 0x26, 0x90, 0x28, 0x14, 0xfa,
+    0xad, 0x08, 0x01, 0x88, 0x32, 0x24, 0xa8, 0x9b, 0x40, 0x13, 0x00, 0x61, 0x82, 0xee, 0x9b, 0x10,
+    0x80, 0x10, 0x63, 0x01, 0xba, 0x89, 0x42, 0x01, 0x18, 0x53, 0xb0, 0xef, 0x09, 0x10, 0x88, 0x20,
+    0x23, 0x91, 0xbb, 0x28, 0x24, 0x81, 0x10, 0x33, 0xf9, 0xcf, 0x09, 0x10, 0x08, 0x20, 0x32, 0x02,
+    0xba, 0x0b, 0x44, 0x02, 0x99, 0x52, 0xb2, 0xff, 0x8a, 0x10, 0x80, 0x00, 0x43, 0x03, 0xba, 0x0a,
+    0x21, 0x12, 0x01, 0x42, 0x03, 0xff, 0xac, 0x18, 0x01, 0x10, 0x32, 0x24, 0xb8, 0xbc, 0x28, 0x34,
+    0x81, 0x20, 0x14, 0xfb, 0xbf, 0x08, 0x11, 0x81, 0x20, 0x42, 0x90, 0xbc, 0x39, 0x25, 0x82, 0x88,
+    0x12, 0xe0, 0xbe, 0x0b, 0x31, 0x81, 0x09, 0x73, 0x02, 0xcb, 0x1a, 0x53, 0x81, 0x8a, 0x42, 0xa2,
+    0xcf, 0x8a, 0x11, 0x90, 0x28, 0x43, 0x82, 0xba, 0x0a, 0x42, 0x22, 0x10, 0x32, 0xa1, 0xff, 0xac,
+    0x08, 0x02, 0x00, 0x31, 0x14, 0xa0, 0xbb, 0x39, 0x37, 0x81, 0x09, 0x13, 0xfb, 0xaf, 0x19, 0x10,
+    0x7b, 0xd2, 0x4b, 0x00, 0x00, 0x22, 0x12, 0xa8, 0x9c, 0x51, 0x23, 0x98, 0x19, 0x02, 0xfd, 0xbc,
+    0x18, 0x22, 0x88, 0x20, 0x36, 0xa1, 0xac, 0x30, 0x14, 0xb8, 0x28, 0x15, 0xfa, 0x9d, 0x18, 0x01,
+    0x09, 0x31, 0x24, 0xb8, 0x9c, 0x30, 0x14, 0xa9, 0x50, 0x83, 0xed, 0x8b, 0x11, 0x80, 0x18, 0x44,
+    0x01, 0xbb, 0x0a, 0x24, 0x91, 0x19, 0x35, 0xe0, 0xbd, 0x09, 0x01, 0x08, 0x41, 0x24, 0xb0, 0x9c,
+    0x20, 0x13, 0x98, 0x50, 0x13, 0xfc, 0x9c, 0x18, 0x11, 0x98, 0x32, 0x16, 0xc9, 0x8b, 0x42, 0x02,
+    0x9a, 0x41, 0x93, 0xcf, 0x8a, 0x22, 0x90, 0x19, 0x53, 0x92, 0xbc, 0x29, 0x43, 0x90, 0x09, 0x34,
+    0xe8, 0xad, 0x18, 0x01, 0x88, 0x32, 0x22, 0xb9, 0xad, 0x20, 0x24, 0x01, 0x21, 0x03, 0xef, 0xab,
+    0x18, 0x11, 0x21, 0x31, 0x02, 0xea, 0x9b, 0x52, 0x23, 0x88, 0x31, 0xd1, 0xdf, 0x0a, 0x11, 0x00,
+    0x10, 0x32, 0x90, 0xad, 0x38, 0x24, 0x01, 0x10, 0x81, 0xec, 0xad, 0x0a, 0x12, 0x01, 0x20, 0x32,
+    0xa0, 0xbc, 0x50, 0x35, 0x80, 0x08, 0x11, 0xfc, 0xad, 0x19, 0x12, 0x08, 0x31, 0x14, 0xc9, 0x0a,
+    0x43, 0x02, 0x08, 0x23, 0xf8, 0xbe, 0x8a, 0x11, 0x10, 0x31, 0x24, 0xb0, 0xbb, 0x41, 0x24, 0x80,
+    0x41, 0xb2, 0xff, 0x9a, 0x11, 0x00, 0x18, 0x43, 0x91, 0xbc, 0x48, 0x24, 0xa8, 0x20, 0x83, 0xdf,
+    0x9a, 0x11, 0x01, 0x08, 0x42, 0x81, 0xac, 0x28, 0x34, 0x81, 0x08, 0x82, 0xfd, 0x9c, 0x10, 0x11,
+    0x88, 0x21, 0x82, 0xba, 0x3a, 0x37, 0x82, 0x09, 0x01, 0xfd, 0xab, 0x20, 0x11, 0x00, 0x41, 0x92,
+    0xbb, 0x49, 0x35, 0x81, 0x00, 0x82, 0xdf, 0xbb, 0x10, 0x02, 0x08, 0x44, 0x82, 0xdb, 0x28, 0x24,
+    0x90, 0x20, 0x04, 0xec, 0x9c, 0x08, 0x01, 0x00, 0x33, 0x13, 0xdb, 0x8a, 0x43, 0x02, 0x10, 0x22,
+    0xf4, 0x3a, 0x40, 0x00, 0xef, 0xaa, 0x18, 0x11, 0x11, 0x22, 0x02, 0xda, 0x0b, 0x53, 0x03, 0x10,
+    0x02, 0xfc, 0xad, 0x09, 0x11, 0x01, 0x42, 0x02, 0xca, 0x0a, 0x42, 0x11, 0x30, 0x14, 0xfb, 0xad,
+    0x09, 0x01, 0x00, 0x42, 0x12, 0xb9, 0x9b, 0x53, 0x13, 0x08, 0x13, 0xfa, 0xbf, 0x19, 0x01, 0x18,
+    0x42, 0x82, 0xbb, 0x29, 0x25, 0x00, 0x41, 0x83, 0xef, 0x9a, 0x20, 0x80, 0x18, 0x25, 0xa1, 0xac,
+    0x40, 0x12, 0x88, 0x30, 0xb2, 0xff, 0x89, 0x01, 0x81, 0x20, 0x12, 0xa8, 0x9a, 0x31, 0x14, 0x11,
+    0x02, 0xfb, 0xaf, 0x08, 0x01, 0x08, 0x42, 0x93, 0xcb, 0x38, 0x24, 0x99, 0x41, 0x83, 0xdf, 0x8a,
+    0x21, 0x98, 0x28, 0x25, 0xb8, 0x8c, 0x42, 0x81, 0x09, 0x43, 0xd8, 0xad, 0x19, 0x02, 0x88, 0x41,
+    0x03, 0xcc, 0x1a, 0x34, 0x91, 0x18, 0x13, 0xfc, 0xab, 0x20, 0x02, 0x18, 0x43, 0xb1, 0xbc, 0x30,
+    0x14, 0x80, 0x22, 0xb2, 0xff, 0x8a, 0x01, 0x00, 0x20, 0x33, 0xc8, 0xab, 0x42, 0x03, 0x89, 0x63,
+    0xc1, 0xbe, 0x09, 0x02, 0x98, 0x52, 0x13, 0xca, 0x1a, 0x33, 0xa1, 0x38, 0x14, 0xed, 0xab, 0x18,
+    0x80, 0x20, 0x35, 0xa2, 0xab, 0x51, 0x12, 0x88, 0x31, 0xd1, 0xdf, 0x09, 0x01, 0x90, 0x31, 0x24,
+    0xc9, 0x1a, 0x34, 0x91, 0x1a, 0x13, 0xdf, 0x9c, 0x21, 0x00, 0x18, 0x23, 0xa1, 0x9b, 0x62, 0x02,
+    0x99, 0x12, 0xfa, 0xaf, 0x10, 0x81, 0x18, 0x32, 0x91, 0xaa, 0x63, 0x02, 0xaa, 0x32, 0xf8, 0xaf,
+    0x10, 0x81, 0x08, 0x32, 0x82, 0xba, 0x41, 0x14, 0x99, 0x20, 0xd0, 0xbf, 0x09, 0x01, 0x00, 0x32,
+    0x04, 0xb9, 0x19, 0x34, 0x81, 0x10, 0xc2, 0xff, 0x8a, 0x11, 0x00, 0x31, 0x13, 0xb8, 0x8b, 0x44,
+    0x92, 0x09, 0x02, 0xef, 0x9b, 0x20, 0x81, 0x21, 0x24, 0xa0, 0x8a, 0x53, 0x82, 0x89, 0x02, 0xef,
+    0x08, 0xc9, 0x4d, 0x00, 0x09, 0x02, 0x08, 0x53, 0x81, 0xaa, 0x38, 0x25, 0x90, 0x28, 0xb1, 0xff,
+    0x0a, 0x10, 0x00, 0x21, 0x12, 0xb9, 0x0b, 0x45, 0x02, 0x89, 0x01, 0xfc, 0xac, 0x10, 0x02, 0x10,
+    0x31, 0x91, 0xac, 0x51, 0x14, 0x88, 0x10, 0xe9, 0xbd, 0x19, 0x01, 0x10, 0x33, 0x82, 0xac, 0x40,
+    0x14, 0x10, 0x42, 0xe9, 0xae, 0x08, 0x80, 0x18, 0x24, 0xa1, 0x9b, 0x42, 0x02, 0x18, 0x35, 0xf9,
+    0xad, 0x10, 0x88, 0x18, 0x24, 0x98, 0x8b, 0x52, 0x82, 0x18, 0x23, 0xfc, 0xab, 0x01, 0x80, 0x20,
+    0x14, 0xb9, 0x0b, 0x45, 0x01, 0x28, 0x92, 0xcf, 0x8a, 0x10, 0x08, 0x42, 0x82, 0xcb, 0x29, 0x25,
+    0x88, 0x41, 0xb1, 0xcf, 0x19, 0x81, 0x08, 0x52, 0x91, 0xab, 0x40, 0x03, 0x89, 0x52, 0xe0, 0x9d,
+    0x18, 0x81, 0x19, 0x43, 0xa1, 0xab, 0x52, 0x82, 0x09, 0x12, 0xfc, 0x8c, 0x01, 0x80, 0x20, 0x14,
+    0xb9, 0x1a, 0x35, 0x91, 0x18, 0x91, 0xef, 0x0a, 0x11, 0x80, 0x31, 0x82, 0xbb, 0x38, 0x36, 0x81,
+    0x10, 0xe0, 0xce, 0x19, 0x01, 0x00, 0x22, 0x81, 0xac, 0x28, 0x34, 0x10, 0x32, 0xf9, 0xaf, 0x08,
+    0x01, 0x18, 0x23, 0x91, 0xac, 0x20, 0x24, 0x10, 0x22, 0xfa, 0xae, 0x88, 0x00, 0x22, 0x13, 0xa9,
+    0x8b, 0x43, 0x12, 0x62, 0x83, 0xde, 0x8a, 0x88, 0x08, 0x43, 0x02, 0xbb, 0x38, 0x04, 0x08, 0x54,
+    0xc1, 0xae, 0x00, 0x80, 0x19, 0x33, 0xb0, 0x0c, 0x43, 0x80, 0x48, 0x83, 0xcf, 0x0a, 0x11, 0x99,
+    0x51, 0x02, 0xcb, 0x38, 0x14, 0x89, 0x31, 0xf8, 0xac, 0x10, 0x00, 0x28, 0x33, 0xc8, 0x0b, 0x53,
+    0x01, 0x10, 0xb1, 0xef, 0x09, 0x00, 0x10, 0x23, 0xa1, 0x9c, 0x32, 0x12, 0x10, 0x03, 0xff, 0x9a,
+    0x08, 0x08, 0x43, 0x02, 0xbb, 0x41, 0x14, 0x88, 0x33, 0xf9, 0xae, 0x00, 0x80, 0x10, 0x14, 0xa9,
+    0xdf, 0xdf, 0x48, 0x00, 0x40, 0x14, 0x08, 0x22, 0xfa, 0xad, 0x10, 0x00, 0x28, 0x13, 0xca, 0x1a,
+    0x25, 0x01, 0x30, 0xb1, 0xef, 0x09, 0x01, 0x08, 0x22, 0x91, 0x9d, 0x30, 0x23, 0x10, 0x13, 0xfe,
+    0x8b, 0x10, 0x80, 0x31, 0x14, 0xca, 0x1a, 0x33, 0x80, 0x21, 0xd2, 0xbf, 0x19, 0x80, 0x18, 0x53,
+    0x91, 0x9a, 0x42, 0x02, 0x89, 0x80, 0xde, 0x9a, 0x11, 0x08, 0x42, 0x82, 0xab, 0x60, 0x33, 0x90,
+    0x20, 0xc1, 0xef, 0x89, 0x01, 0x81, 0x01, 0x21, 0x98, 0x8a, 0x53, 0x13, 0x18, 0x80, 0xed, 0xac,
+    0x09, 0x12, 0x08, 0x53, 0x02, 0xbb, 0x28, 0x25, 0x91, 0x20, 0x04, 0xde, 0x9c, 0x08, 0x11, 0x11,
+    0x32, 0x91, 0xdb, 0x19, 0x53, 0x12, 0x01, 0xb8, 0xdf, 0xaa, 0x10, 0x22, 0x21, 0x14, 0xb8, 0x9e,
+    0x41, 0x02, 0x00, 0x23, 0xf9, 0xbd, 0x08, 0x02, 0x00, 0x42, 0x82, 0xdb, 0x19, 0x32, 0x11, 0x22,
+    0x83, 0xef, 0xab, 0x10, 0x11, 0x10, 0x34, 0xb0, 0xad, 0x38, 0x24, 0x80, 0x42, 0xa1, 0xef, 0x89,
+    0x10, 0x00, 0x21, 0x12, 0xb0, 0x9d, 0x30, 0x23, 0x00, 0x22, 0xe0, 0xcf, 0x09, 0x11, 0x00, 0x31,
+    0x13, 0xda, 0x8a, 0x22, 0x02, 0x30, 0x03, 0xfe, 0xab, 0x09, 0x11, 0x22, 0x24, 0x01, 0xba, 0x29,
+    0x34, 0x00, 0x42, 0xc1, 0xef, 0x8a, 0x01, 0x80, 0x21, 0x24, 0xb8, 0x89, 0x32, 0x03, 0x18, 0x23,
+    0xfb, 0xbf, 0x8a, 0x10, 0x11, 0x21, 0x33, 0xa0, 0x8b, 0x53, 0x23, 0x32, 0x13, 0xfb, 0xdf, 0x0a,
+    0x08, 0x01, 0x22, 0x12, 0xb8, 0xac, 0x62, 0x13, 0x00, 0x43, 0xc0, 0xce, 0x9a, 0x11, 0x80, 0x28,
+    0x33, 0xb1, 0xae, 0x38, 0x35, 0x01, 0x31, 0x83, 0xff, 0xaa, 0x10, 0x01, 0x19, 0x52, 0x91, 0xbb,
+    0x39, 0x25, 0x00, 0x31, 0x04, 0xde, 0x9b, 0x18, 0x01, 0x08, 0x44, 0x81, 0xac, 0x19, 0x23, 0x81,
+    0xbc, 0x18, 0x43, 0x00, 0x53, 0xc1, 0xce, 0x89, 0x01, 0x00, 0x21, 0x25, 0xa8, 0xab, 0x21, 0x82,
+    0x10, 0x45, 0xa1, 0xcf, 0x8a, 0x10, 0x00, 0x20, 0x24, 0x90, 0xcb, 0x29, 0x24, 0x00, 0x30, 0x93,
+    0xdf, 0xab, 0x10, 0x11, 0x00, 0x33, 0x92, 0xbc, 0x39, 0x46, 0x02, 0x88, 0x01, 0xfb, 0x9f, 0x18,
+    0x01, 0x98, 0x21, 0x02, 0xaa, 0x38, 0x36, 0x11, 0x00, 0xb0, 0xce, 0xac, 0x89, 0x21, 0x01, 0x20,
+    0x03, 0xaa, 0x60, 0x25, 0x02, 0x10, 0x01, 0xee, 0x9c, 0x09, 0x10, 0x10, 0x21, 0x22, 0xb0, 0x9c,
+    0x62, 0x23, 0x81, 0x10, 0xb0, 0xff, 0x9b, 0x10, 0x01, 0x11, 0x12, 0x01, 0xca, 0x1b, 0x45, 0x02,
+    0x89, 0x31, 0xd0, 0xcf, 0x09, 0x21, 0x88, 0x18, 0x24, 0xa2, 0xbb, 0x48, 0x14, 0xa8, 0x18, 0x34,
+    0xe8, 0xbe, 0x19, 0x11, 0x88, 0x30, 0x35, 0xb0, 0xac, 0x40, 0x03, 0xa9, 0x40, 0x14, 0xfb, 0x9c,
+    0x10, 0x00, 0x88, 0x31, 0x15, 0xc8, 0x9a, 0x53, 0x01, 0x8a, 0x31, 0x92, 0xdf, 0x8a, 0x01, 0x80,
+    0x10, 0x33, 0x92, 0xdb, 0x19, 0x34, 0x02, 0x00, 0x32, 0xf8, 0xcf, 0x09, 0x11, 0x80, 0x10, 0x33,
+    0xa0, 0xad, 0x20, 0x25, 0x01, 0x18, 0x81, 0xfc, 0xac, 0x08, 0x12, 0x80, 0x31, 0x24, 0xc9, 0x9b,
+    0x43, 0x03, 0x09, 0x42, 0xb1, 0xef, 0x9a, 0x00, 0x00, 0x11, 0x43, 0x02, 0xca, 0x09, 0x43, 0x81,
+    0x10, 0x34, 0xf9, 0xae, 0x09, 0x01, 0x88, 0x31, 0x25, 0xb0, 0x9c, 0x30, 0x14, 0x99, 0x38, 0x24,
+    0xfa, 0xae, 0x00, 0x01, 0x08, 0x30, 0x33, 0xa0, 0xad, 0x28, 0x14, 0x81, 0x28, 0x24, 0xf9, 0xbd,
+    0x09, 0x11, 0x01, 0x28, 0x43, 0x91, 0xdc, 0x08, 0x43, 0x81, 0x18, 0x33, 0xe0, 0xbe, 0x8a, 0x11,
+    0x80, 0x18, 0x34, 0x03, 0xbc, 0x0b, 0x44, 0x02, 0x08, 0x43, 0xa1, 0xdf, 0x8b, 0x18, 0x81, 0x08,
+    0x0d, 0xea, 0x45, 0x00, 0x44, 0x91, 0xbc, 0x28, 0x24, 0xa0, 0x18, 0x44, 0xc0, 0xbe, 0x0a, 0x11,
+    0x91, 0x08, 0x54, 0x01, 0xcb, 0x1a, 0x43, 0x01, 0x8a, 0x42, 0x92, 0xcf, 0x8b, 0x20, 0x01, 0x88,
+    0x42, 0x13, 0xda, 0x8b, 0x42, 0x13, 0x90, 0x20, 0x02, 0xfe, 0xbb, 0x18, 0x23, 0x90, 0x20, 0x36,
+    0xb0, 0xbd, 0x30, 0x25, 0x90, 0x1a, 0x33, 0xf9, 0xbd, 0x19, 0x22, 0x90, 0x28, 0x34, 0xa1, 0xbd,
+    0x29, 0x34, 0x91, 0x18, 0x33, 0xf9, 0xbd, 0x89, 0x11, 0x80, 0x20, 0x44, 0x90, 0xbb, 0x29, 0x25,
+    0x81, 0x20, 0x24, 0xc0, 0xce, 0x9a, 0x18, 0x81, 0x18, 0x41, 0x14, 0xa9, 0xaa, 0x51, 0x14, 0x01,
+    0x08, 0x13, 0xe8, 0xce, 0x8a, 0x10, 0x81, 0x08, 0x20, 0x24, 0xa8, 0xbc, 0x51, 0x34, 0x82, 0x09,
+    0x11, 0xc0, 0xef, 0x99, 0x20, 0x81, 0x88, 0x20, 0x25, 0xa9, 0xab, 0x61, 0x13, 0x91, 0x18, 0x03,
+    0xf9, 0xae, 0x99, 0x11, 0x88, 0x10, 0x52, 0x03, 0xb9, 0x8b, 0x52, 0x32, 0x01, 0x31, 0x03, 0xfc,
+    0xaf, 0x8a, 0x10, 0x00, 0x10, 0x63, 0x02, 0xba, 0x8c, 0x33, 0x14, 0x88, 0x31, 0x83, 0xfe, 0xab,
+    0x09, 0x02, 0x80, 0x30, 0x35, 0x90, 0xac, 0x29, 0x34, 0x12, 0x08, 0x12, 0xb8, 0xff, 0xaa, 0x08,
+    0x11, 0x00, 0x11, 0x43, 0x80, 0xba, 0x49, 0x35, 0x12, 0x8a, 0x21, 0xc0, 0xff, 0x8a, 0x18, 0x00,
+    0x88, 0x31, 0x24, 0xb0, 0xab, 0x50, 0x24, 0x81, 0x19, 0x33, 0xe0, 0xbf, 0x9b, 0x30, 0x01, 0x89,
+    0x51, 0x15, 0xb8, 0x9c, 0x40, 0x14, 0x90, 0x19, 0x23, 0xd8, 0xaf, 0x89, 0x10, 0x80, 0x18, 0x22,
+    0x03, 0xa8, 0x98, 0x18, 0x44, 0x35, 0x91, 0xa9, 0x08, 0xf9, 0xaf, 0x8a, 0x32, 0x81, 0xa9, 0x61,
+    0x14, 0xb8, 0x9c, 0x51, 0x12, 0xa0, 0x89, 0x23, 0xb0, 0xdf, 0x8a, 0x10, 0x01, 0x89, 0x21, 0x35,
+    0x90, 0x20, 0x47, 0x00, 0xb9, 0x9c, 0x41, 0x14, 0x90, 0x09, 0x22, 0xa1, 0xff, 0x99, 0x10, 0x01,
+    0x98, 0x28, 0x35, 0x90, 0xcb, 0x18, 0x34, 0x01, 0x9a, 0x31, 0x14, 0xfb, 0xad, 0x89, 0x01, 0x80,
+    0x88, 0x42, 0x25, 0xa0, 0xbb, 0x48, 0x25, 0x80, 0x8a, 0x34, 0x92, 0xdf, 0x8b, 0x18, 0x81, 0x99,
+    0x31, 0x36, 0xa1, 0xab, 0x29, 0x25, 0x10, 0x88, 0x41, 0x81, 0xfb, 0xad, 0x8a, 0x11, 0x98, 0x10,
+    0x44, 0x03, 0x98, 0x8a, 0x32, 0x23, 0x80, 0x20, 0x23, 0xf9, 0xde, 0xbb, 0x8a, 0x11, 0x01, 0x21,
+    0x47, 0x03, 0xb9, 0x8c, 0x43, 0x01, 0x99, 0x50, 0x03, 0xfb, 0xad, 0x89, 0x10, 0x08, 0x30, 0x34,
+    0x03, 0xa9, 0xab, 0x30, 0x44, 0x03, 0x18, 0x02, 0xf9, 0xcf, 0x9a, 0x11, 0x82, 0x00, 0x42, 0x14,
+    0xb9, 0x9b, 0x52, 0x22, 0x88, 0x18, 0x82, 0xfc, 0xbc, 0x8a, 0x20, 0x11, 0x10, 0x62, 0x12, 0xb8,
+    0x8b, 0x44, 0x23, 0xb9, 0x18, 0x23, 0xfc, 0xaf, 0x08, 0x12, 0x99, 0x18, 0x34, 0x92, 0xbb, 0x39,
+    0x27, 0x80, 0x99, 0x21, 0x91, 0xfc, 0xab, 0x08, 0x23, 0x99, 0x18, 0x55, 0x82, 0xbb, 0x1a, 0x36,
+    0x81, 0xab, 0x51, 0x03, 0xed, 0xaa, 0x20, 0x02, 0x89, 0x20, 0x25, 0xa0, 0xac, 0x28, 0x23, 0x13,
+    0x28, 0x03, 0xb8, 0xff, 0x9d, 0x18, 0x02, 0x00, 0x00, 0x23, 0xa8, 0xdb, 0x38, 0x36, 0x01, 0x0a,
+    0x21, 0xc8, 0xcf, 0x89, 0x20, 0x80, 0x09, 0x42, 0x03, 0xba, 0x0a, 0x54, 0x01, 0xa9, 0x41, 0x13,
+    0xf9, 0xae, 0x88, 0x00, 0x98, 0x28, 0x54, 0x02, 0xa9, 0x0a, 0x32, 0x88, 0x99, 0x74, 0x12, 0xea,
+    0xac, 0x09, 0x00, 0x98, 0x41, 0x25, 0x92, 0xab, 0x8a, 0x43, 0x00, 0x08, 0x54, 0xa1, 0xce, 0x9b,
+    0x11, 0x00, 0x18, 0x34, 0x13, 0xcb, 0x0a, 0x41, 0x01, 0x08, 0x53, 0x92, 0xcf, 0xab, 0x20, 0x90,
+    0x99, 0xd1, 0x45, 0x00, 0x40, 0x25, 0x90, 0xaa, 0x29, 0x32, 0x81, 0x19, 0x36, 0xb1, 0xff, 0x8a,
+    0x10, 0x81, 0x18, 0x32, 0x04, 0xca, 0x9b, 0x52, 0x02, 0x88, 0x40, 0x02, 0xed, 0x9b, 0x28, 0x01,
+    0x80, 0x43, 0x13, 0xc9, 0x9c, 0x20, 0x23, 0x80, 0x21, 0x14, 0xfc, 0xbc, 0x09, 0x12, 0x01, 0x20,
+    0x53, 0x82, 0xcc, 0x1a, 0x53, 0x82, 0x9a, 0x31, 0xb1, 0xff, 0x89, 0x21, 0x00, 0x09, 0x32, 0x03,
+    0xdb, 0x09, 0x42, 0x91, 0x8a, 0x53, 0xb1, 0xcf, 0x89, 0x11, 0x90, 0x29, 0x35, 0x92, 0xbb, 0x28,
+    0x33, 0xa8, 0x29, 0x37, 0xb2, 0xcf, 0x9a, 0x01, 0x88, 0x18, 0x53, 0x82, 0x98, 0x09, 0x11, 0x33,
+    0x81, 0x20, 0x23, 0xfd, 0xbf, 0x09, 0x00, 0x08, 0x21, 0x24, 0x81, 0x99, 0x18, 0x35, 0x02, 0x18,
+    0x14, 0xfb, 0xbf, 0x09, 0x01, 0x09, 0x51, 0x22, 0xa9, 0x8b, 0x62, 0x13, 0x98, 0x42, 0xa2, 0xef,
+    0x8a, 0x10, 0x80, 0x19, 0x43, 0x82, 0xdb, 0x19, 0x42, 0x01, 0x19, 0x43, 0xc0, 0xbf, 0x09, 0x01,
+    0x98, 0x30, 0x34, 0xa1, 0xbb, 0x29, 0x25, 0x81, 0x48, 0x34, 0xfb, 0xad, 0x18, 0x80, 0x99, 0x52,
+    0x23, 0xb9, 0x9b, 0x53, 0x02, 0xaa, 0x62, 0x03, 0xec, 0x9b, 0x00, 0x01, 0x88, 0x32, 0x24, 0xb8,
+    0xac, 0x41, 0x24, 0x88, 0x10, 0x92, 0xdf, 0x9b, 0x10, 0x01, 0x20, 0x33, 0xa2, 0xbd, 0x28, 0x35,
+    0x91, 0x30, 0x16, 0xfa, 0xad, 0x10, 0x01, 0x98, 0x31, 0x04, 0xb9, 0x9b, 0x53, 0x23, 0x88, 0x28,
+    0xa2, 0xef, 0x9a, 0x20, 0x11, 0x08, 0x21, 0x82, 0xdb, 0x1a, 0x44, 0x02, 0x89, 0x21, 0xe8, 0xcd,
+    0x89, 0x12, 0x08, 0x30, 0x24, 0xa8, 0x9c, 0x30, 0x13, 0x80, 0x61, 0x04, 0xfb, 0xac, 0x00, 0x00,
+    0x18, 0x43, 0x83, 0xb9, 0xaa, 0x21, 0x23, 0x33, 0x25, 0xe8, 0xbe, 0xab, 0x00, 0x41, 0x43, 0x01,
+    0xd6, 0x0d, 0x44, 0x00, 0x99, 0x88, 0x30, 0x23, 0x62, 0x13, 0xfc, 0x9e, 0x08, 0x01, 0x08, 0x41,
+    0x12, 0xc9, 0x8b, 0x43, 0x03, 0x89, 0x22, 0xf8, 0xae, 0x19, 0x11, 0x88, 0x31, 0x03, 0xda, 0x09,
+    0x53, 0x02, 0x08, 0x22, 0xf9, 0xaf, 0x08, 0x11, 0x80, 0x20, 0x12, 0xb8, 0x9c, 0x62, 0x22, 0x88,
+    0x21, 0xc0, 0xcf, 0x8a, 0x11, 0x00, 0x28, 0x24, 0xa0, 0xbb, 0x51, 0x13, 0xa8, 0x51, 0x93, 0xcf,
+    0x8b, 0x20, 0x80, 0x18, 0x44, 0x81, 0xcb, 0x38, 0x24, 0xa8, 0x39, 0x14, 0xfc, 0x9b, 0x11, 0x91,
+    0x19, 0x53, 0x92, 0xcb, 0x28, 0x34, 0x98, 0x29, 0x24, 0xfb, 0x9e, 0x10, 0x81, 0x80, 0x22, 0x82,
+    0xca, 0x0a, 0x34, 0x03, 0x08, 0x22, 0xfb, 0xaf, 0x08, 0x01, 0x01, 0x11, 0x02, 0xca, 0x0b, 0x73,
+    0x12, 0x08, 0x01, 0xf9, 0xbc, 0x08, 0x12, 0x00, 0x31, 0x93, 0xcc, 0x1a, 0x44, 0x12, 0x10, 0x82,
+    0xfd, 0x9b, 0x18, 0x11, 0x20, 0x33, 0xb8, 0xad, 0x30, 0x24, 0x11, 0x43, 0xd0, 0xbf, 0x0a, 0x01,
+    0x80, 0x41, 0x13, 0xca, 0x8b, 0x42, 0x23, 0x00, 0x22, 0xf8, 0xbe, 0x09, 0x21, 0x00, 0x21, 0x02,
+    0xda, 0x8b, 0x73, 0x12, 0x00, 0x01, 0xfa, 0xbc, 0x18, 0x12, 0x08, 0x41, 0x82, 0xbd, 0x2a, 0x26,
+    0x80, 0x18, 0x13, 0xfc, 0xab, 0x31, 0x82, 0x89, 0x43, 0x91, 0xbd, 0x30, 0x15, 0x98, 0x20, 0xb2,
+    0xbf, 0x0a, 0x12, 0x88, 0x42, 0x03, 0xcb, 0x1a, 0x34, 0x91, 0x29, 0x14, 0xfc, 0x9c, 0x10, 0x81,
+    0x10, 0x23, 0x90, 0xab, 0x40, 0x24, 0x11, 0x08, 0xe8, 0xce, 0x8a, 0x11, 0x11, 0x32, 0x23, 0xda,
+    0x9a, 0x62, 0x22, 0x80, 0x00, 0xf8, 0xcd, 0x89, 0x12, 0x11, 0x20, 0x13, 0xd9, 0x8b, 0x62, 0x12,
+    0x89, 0x11, 0xf9, 0xbc, 0x08, 0x12, 0x10, 0x43, 0x91, 0xbc, 0x49, 0x24, 0x90, 0x20, 0x93, 0xff,
+    0xef, 0xbb, 0x52, 0x00, 0x00, 0x01, 0x08, 0x21, 0x80, 0xbb, 0x38, 0x25, 0x01, 0x11, 0xe8, 0xae,
+    0x19, 0x10, 0x18, 0x33, 0xa2, 0xad, 0x30, 0x14, 0x89, 0x52, 0xb1, 0xcf, 0x09, 0x02, 0x88, 0x41,
+    0x82, 0xca, 0x29, 0x25, 0x90, 0x28, 0x93, 0xdf, 0x8a, 0x11, 0x80, 0x21, 0x23, 0xda, 0x0b, 0x53,
+    0x82, 0x00, 0x03, 0xed, 0xab, 0x11, 0x81, 0x20, 0x34, 0xc9, 0x9b, 0x53, 0x02, 0x10, 0x12, 0xfc,
+    0x9c, 0x10, 0x00, 0x10, 0x23, 0xb0, 0xae, 0x31, 0x14, 0x80, 0x21, 0xfa, 0xad, 0x08, 0x11, 0x21,
+    0x33, 0xb8, 0xac, 0x31, 0x23, 0x21, 0x36, 0xf9, 0xbd, 0x09, 0x01, 0x10, 0x34, 0x92, 0xdb, 0x18,
+    0x23, 0x00, 0x41, 0x93, 0xef, 0x8a, 0x10, 0x80, 0x21, 0x13, 0xb9, 0x0a, 0x32, 0x22, 0x53, 0x93,
+    0xdf, 0x9a, 0x08, 0x08, 0x41, 0x03, 0xb9, 0x1a, 0x24, 0x81, 0x51, 0x04, 0xfb, 0x9c, 0x00, 0x88,
+    0x30, 0x25, 0xa8, 0x9c, 0x31, 0x81, 0x09, 0x54, 0x81, 0xdc, 0x9b, 0x88, 0x10, 0x22, 0x34, 0x02,
+    0xc9, 0xab, 0x48, 0x24, 0x81, 0x38, 0x93, 0xff, 0x8c, 0x20, 0x01, 0x88, 0x42, 0x82, 0xdb, 0x19,
+    0x23, 0x98, 0x1a, 0x35, 0xc0, 0xbe, 0x09, 0x11, 0x88, 0x30, 0x34, 0x92, 0xbc, 0x28, 0x33, 0xb8,
+    0x78, 0x15, 0xe9, 0xac, 0x10, 0x01, 0x9a, 0x51, 0x23, 0xd9, 0x8a, 0x32, 0x02, 0x89, 0x42, 0x92,
+    0xcf, 0x9b, 0x11, 0x81, 0x08, 0x52, 0x02, 0xcb, 0x2a, 0x35, 0x91, 0x19, 0x34, 0xe9, 0xcd, 0x08,
+    0x02, 0x90, 0x28, 0x34, 0xb8, 0x9d, 0x40, 0x12, 0x88, 0x40, 0x83, 0xfc, 0xab, 0x20, 0x11, 0x88,
+    0x31, 0x15, 0xd9, 0x8b, 0x41, 0x02, 0x88, 0x32, 0xb2, 0xef, 0x0a, 0x11, 0x81, 0x18, 0x33, 0xb1,
+    0xbd, 0x28, 0x24, 0x80, 0x08, 0x12, 0xfb, 0xad, 0x19, 0x33, 0x81, 0x88, 0x32, 0xc8, 0xae, 0x31,
+    0x90, 0x0e, 0x44, 0x00, 0x02, 0x9a, 0x61, 0xb1, 0xcf, 0x09, 0x23, 0x90, 0x0a, 0x34, 0x92, 0xcc,
+    0x09, 0x33, 0x81, 0x19, 0x53, 0x91, 0xde, 0xab, 0x20, 0x02, 0x88, 0x63, 0x03, 0xda, 0x8a, 0x32,
+    0x82, 0x18, 0x36, 0xb1, 0xbf, 0x9b, 0x00, 0x00, 0x21, 0x34, 0x13, 0xd9, 0xac, 0x30, 0x35, 0x80,
+    0x18, 0x23, 0xfb, 0xbf, 0x19, 0x12, 0x90, 0x21, 0x33, 0xc8, 0xac, 0x30, 0x24, 0x01, 0x11, 0x82,
+    0xfb, 0xbe, 0x09, 0x11, 0x81, 0x19, 0x53, 0x81, 0xbc, 0x30, 0x26, 0x90, 0x08, 0x23, 0xe8, 0xad,
+    0x8a, 0x01, 0x90, 0x08, 0x53, 0x02, 0xba, 0x2a, 0x45, 0x82, 0x09, 0x52, 0xb2, 0xdf, 0x8a, 0x21,
+    0x90, 0x09, 0x42, 0x03, 0xca, 0x8a, 0x34, 0x13, 0xa9, 0x40, 0x03, 0xfc, 0xad, 0x10, 0x02, 0x99,
+    0x38, 0x25, 0xb0, 0xab, 0x41, 0x04, 0x98, 0x30, 0x23, 0xfa, 0xbd, 0x09, 0x10, 0x00, 0x21, 0x25,
+    0x90, 0xcb, 0x18, 0x33, 0x82, 0x40, 0x24, 0xe8, 0xcd, 0x8a, 0x10, 0x00, 0x10, 0x42, 0x02, 0xba,
+    0xab, 0x62, 0x33, 0x81, 0x18, 0x24, 0xf9, 0xbe, 0x8a, 0x21, 0x00, 0x09, 0x73, 0x82, 0xc9, 0x8a,
+    0x43, 0x13, 0x89, 0x41, 0x03, 0xfd, 0xab, 0x18, 0x12, 0x89, 0x10, 0x25, 0xa0, 0xbc, 0x38, 0x26,
+    0x91, 0x88, 0x22, 0x91, 0xcf, 0x9b, 0x10, 0x01, 0x88, 0x20, 0x36, 0x90, 0xcb, 0x29, 0x35, 0x91,
+    0x89, 0x42, 0x92, 0xef, 0x8a, 0x10, 0x01, 0x89, 0x31, 0x14, 0xc8, 0xaa, 0x41, 0x14, 0x90, 0x19,
+    0x33, 0xd8, 0xbf, 0x8a, 0x22, 0x80, 0x89, 0x62, 0x02, 0xa9, 0x8b, 0x41, 0x23, 0x81, 0x48, 0x13,
+    0xf9, 0xbf, 0x89, 0x11, 0x80, 0x10, 0x53, 0x81, 0xba, 0x0a, 0x53, 0x12, 0x81, 0x41, 0x92, 0xfc,
+    0xad, 0x08, 0x11, 0x88, 0x28, 0x53, 0x81, 0xbb, 0x29, 0x34, 0x83, 0x08, 0x31, 0x83, 0xff, 0xab,
+    0xb7, 0xc4, 0x49, 0x00, 0x10, 0x01, 0x08, 0x51, 0x23, 0xb9, 0xac, 0x32, 0x23, 0xa0, 0x48, 0x24,
+    0xc1, 0xef, 0x99, 0x10, 0x81, 0x00, 0x41, 0x14, 0xb8, 0xac, 0x20, 0x23, 0x01, 0x28, 0x25, 0xb0,
+    0xef, 0x9a, 0x18, 0x21, 0x88, 0x30, 0x44, 0xa0, 0xbc, 0x19, 0x34, 0x12, 0x98, 0x30, 0x23, 0xfb,
+    0xcf, 0x09, 0x20, 0x80, 0x00, 0x32, 0x14, 0xc9, 0xaa, 0x28, 0x34, 0x12, 0x09, 0x42, 0xa2, 0xff,
+    0x9b, 0x28, 0x11, 0x88, 0x20, 0x43, 0xa1, 0xbb, 0x0a, 0x45, 0x12, 0x98, 0x38, 0x33, 0xf9, 0xbf,
+    0x8a, 0x11, 0x80, 0x18, 0x41, 0x14, 0x90, 0xba, 0x39, 0x35, 0x81, 0x89, 0x64, 0x92, 0xdd, 0x9b,
+    0x18, 0x90, 0x88, 0x41, 0x24, 0x81, 0xba, 0x89, 0x43, 0x13, 0x80, 0x51, 0x14, 0xf9, 0xcc, 0x99,
+    0x11, 0x00, 0x08, 0x41, 0x24, 0xa8, 0xcb, 0x30, 0x24, 0x81, 0x0a, 0x53, 0x91, 0xde, 0xab, 0x08,
+    0x11, 0x80, 0x20, 0x26, 0x02, 0xda, 0x8a, 0x32, 0x05, 0x88, 0x30, 0x23, 0xfb, 0xbd, 0x8a, 0x10,
+    0x01, 0x18, 0x52, 0x13, 0xa8, 0xac, 0x28, 0x43, 0x02, 0x28, 0x34, 0x92, 0xff, 0xab, 0x88, 0x11,
+    0x08, 0x21, 0x42, 0x12, 0xa8, 0xca, 0x1a, 0x45, 0x22, 0x90, 0x28, 0x82, 0xfb, 0xbf, 0x89, 0x10,
+    0x01, 0x08, 0x31, 0x35, 0x91, 0xcb, 0x0a, 0x53, 0x13, 0x90, 0x20, 0x22, 0xf9, 0xbf, 0x9a, 0x18,
+    0x11, 0x09, 0x21, 0x45, 0x81, 0x9a, 0x8b, 0x43, 0x33, 0x82, 0x0a, 0x44, 0x91, 0xff, 0x9b, 0x19,
+    0x11, 0x90, 0x10, 0x52, 0x12, 0xa9, 0xab, 0x48, 0x34, 0x02, 0x9a, 0x62, 0x03, 0xfb, 0xae, 0x09,
+    0x11, 0x88, 0x19, 0x42, 0x14, 0x98, 0xab, 0x29, 0x34, 0x12, 0x89, 0x52, 0x13, 0xfa, 0xbe, 0x9a,
+    0x20, 0x01, 0x08, 0x21, 0x36, 0x91, 0xda, 0x0a, 0x42, 0x13, 0x90, 0x28, 0x23, 0xd0, 0xdf, 0x9a,
+    0x7e, 0xb9, 0x4b, 0x00, 0x20, 0x81, 0x80, 0x31, 0x34, 0xa0, 0xcb, 0x09, 0x44, 0x12, 0x98, 0x20,
+    0x34, 0xf8, 0xcd, 0x8a, 0x20, 0x81, 0x98, 0x21, 0x35, 0x90, 0xca, 0x0a, 0x42, 0x33, 0xa0, 0x29,
+    0x35, 0xa3, 0xff, 0x9a, 0x19, 0x11, 0x88, 0x00, 0x31, 0x24, 0x90, 0xdb, 0x0a, 0x34, 0x15, 0xa0,
+    0x19, 0x42, 0x91, 0xdf, 0x9b, 0x19, 0x13, 0x90, 0x8a, 0x53, 0x15, 0xa0, 0xba, 0x09, 0x44, 0x02,
+    0xa0, 0x19, 0x44, 0x81, 0xde, 0x9b, 0x08, 0x12, 0xa8, 0x08, 0x53, 0x14, 0x90, 0xbb, 0x0a, 0x53,
+    0x12, 0x91, 0x18, 0x35, 0x81, 0xee, 0xac, 0x88, 0x21, 0x80, 0x88, 0x32, 0x26, 0x90, 0xca, 0x8a,
+    0x42, 0x23, 0x91, 0x1a, 0x35, 0x93, 0xfe, 0x9b, 0x08, 0x11, 0x88, 0x08, 0x33, 0x24, 0x90, 0xcb,
+    0x8a, 0x41, 0x23, 0x12, 0x10, 0x24, 0x90, 0xfc, 0xaf, 0x8a, 0x20, 0x02, 0x08, 0x18, 0x35, 0x02,
+    0xda, 0xab, 0x50, 0x23, 0x02, 0x9b, 0x43, 0x13, 0xfa, 0xbf, 0x88, 0x20, 0x80, 0x08, 0x20, 0x34,
+    0x81, 0xca, 0x9b, 0x41, 0x33, 0x02, 0x09, 0x52, 0x83, 0xfc, 0xad, 0x89, 0x10, 0x01, 0x00, 0x21,
+    0x42, 0x02, 0xba, 0xbd, 0x28, 0x35, 0x13, 0xa9, 0x51, 0x12, 0xfa, 0xaf, 0x09, 0x10, 0x02, 0x08,
+    0x10, 0x43, 0x82, 0xfb, 0x8b, 0x41, 0x13, 0x98, 0x19, 0x35, 0xb1, 0xcf, 0x8b, 0x20, 0x01, 0x88,
+    0x30, 0x35, 0x91, 0xcb, 0x9b, 0x32, 0x23, 0x81, 0x51, 0x34, 0xa8, 0xdf, 0xab, 0x89, 0x12, 0x11,
+    0x21, 0x52, 0x03, 0xba, 0xbd, 0x28, 0x34, 0x03, 0x10, 0x43, 0x82, 0xee, 0xbc, 0x89, 0x21, 0x11,
+    0x08, 0x32, 0x34, 0xb8, 0xbe, 0x1a, 0x44, 0x12, 0x98, 0x30, 0x25, 0xe9, 0xbd, 0x8a, 0x21, 0x81,
+    0x88, 0x30, 0x36, 0x91, 0xbc, 0x0b, 0x34, 0x22, 0x98, 0x41, 0x24, 0xd8, 0xcd, 0x9a, 0x08, 0x11,
+    0x04, 0xdc, 0x45, 0x00, 0x00, 0x22, 0x35, 0x90, 0xdb, 0x0a, 0x53, 0x01, 0x98, 0x41, 0x14, 0xe9,
+    0xbc, 0x9a, 0x11, 0x81, 0x88, 0x53, 0x24, 0x91, 0xbc, 0x19, 0x43, 0x03, 0xa8, 0x48, 0x24, 0xd8,
+    0xbf, 0x9a, 0x21, 0x02, 0x99, 0x31, 0x25, 0x91, 0xac, 0x89, 0x52, 0x13, 0x00, 0x8a, 0x22, 0xc9,
+    0xee, 0xab, 0x18, 0x33, 0x01, 0x88, 0x52, 0x12, 0xc9, 0x8c, 0x42, 0x24, 0x80, 0x09, 0x88, 0xea,
+    0xcd, 0x8a, 0x10, 0x11, 0x10, 0x32, 0x24, 0xa0, 0xab, 0x60, 0x24, 0x82, 0x99, 0x33, 0xa0, 0xff,
+    0x9d, 0x00, 0x01, 0xa8, 0x10, 0x53, 0x83, 0xb9, 0x0a, 0x54, 0x02, 0xa8, 0x39, 0x33, 0xf8, 0xbe,
+    0x99, 0x10, 0x81, 0x8a, 0x40, 0x34, 0x90, 0xaa, 0x38, 0x27, 0x01, 0x88, 0x31, 0x91, 0xfc, 0xad,
+    0x09, 0x10, 0x00, 0x08, 0x30, 0x04, 0x98, 0xab, 0x72, 0x33, 0x83, 0x08, 0x00, 0xb8, 0xff, 0x9b,
+    0x18, 0x02, 0x08, 0x08, 0x32, 0xa8, 0xac, 0x48, 0x35, 0x24, 0x00, 0x21, 0x90, 0xde, 0xac, 0x09,
+    0x21, 0x80, 0x09, 0x41, 0x83, 0xdb, 0x8c, 0x52, 0x33, 0x90, 0x18, 0x14, 0xc0, 0xce, 0x8a, 0x10,
+    0x82, 0x08, 0x10, 0x32, 0xb0, 0xcc, 0x1a, 0x44, 0x23, 0x01, 0x21, 0x80, 0xed, 0xad, 0x09, 0x31,
+    0x90, 0x08, 0x52, 0x82, 0xcc, 0x8a, 0x34, 0x13, 0x90, 0x30, 0x03, 0xfb, 0xbf, 0x19, 0x22, 0x80,
+    0x09, 0x32, 0x93, 0xcd, 0x0a, 0x43, 0x33, 0x01, 0x18, 0x80, 0xfe, 0xbb, 0x08, 0x23, 0x01, 0x21,
+    0x34, 0xa1, 0xdd, 0x0a, 0x42, 0x23, 0x88, 0x20, 0x02, 0xfe, 0xac, 0x08, 0x12, 0x00, 0x10, 0x34,
+    0x81, 0xda, 0x1a, 0x32, 0x01, 0x0a, 0x35, 0x82, 0xef, 0x9a, 0x00, 0x81, 0x89, 0x40, 0x25, 0xa1,
+    0xbb, 0x48, 0x14, 0x90, 0xab, 0x52, 0x12, 0xdd, 0xab, 0x30, 0x12, 0xb9, 0x28, 0x36, 0x91, 0xbc,
+    0x40, 0xdd, 0x47, 0x00, 0x42, 0x23, 0xa8, 0x28, 0x22, 0xfb, 0xaf, 0x08, 0x11, 0x80, 0x00, 0x43,
+    0x91, 0xdb, 0x0a, 0x34, 0x11, 0x88, 0x32, 0x82, 0xfd, 0xab, 0x09, 0x01, 0x00, 0x21, 0x24, 0xa1,
+    0xab, 0x20, 0x03, 0x12, 0x73, 0x24, 0xa8, 0xcf, 0x99, 0x00, 0xb8, 0x19, 0x34, 0x14, 0xa9, 0x89,
+    0x61, 0x11, 0x90, 0x29, 0x24, 0xd0, 0xcf, 0x89, 0x10, 0x80, 0x18, 0x33, 0x04, 0xca, 0x0a, 0x63,
+    0x02, 0x89, 0x32, 0x92, 0xff, 0x9a, 0x00, 0x81, 0x09, 0x53, 0x22, 0xb8, 0x8b, 0x31, 0x14, 0x89,
+    0x31, 0x13, 0xff, 0x9c, 0x18, 0x01, 0x8a, 0x30, 0x27, 0x90, 0x9b, 0x38, 0x26, 0x90, 0x9a, 0x21,
+    0xc1, 0xbf, 0x0b, 0x22, 0x81, 0x89, 0x52, 0x13, 0xba, 0x0b, 0x55, 0x12, 0xa9, 0x28, 0x83, 0xef,
+    0x9b, 0x20, 0x02, 0xa9, 0x40, 0x33, 0xb0, 0x9d, 0x31, 0x25, 0x88, 0x08, 0x12, 0xfa, 0xad, 0x09,
+    0x01, 0x08, 0x31, 0x24, 0xa8, 0xab, 0x28, 0x35, 0x02, 0x10, 0x35, 0xf8, 0xbd, 0x89, 0x00, 0x00,
+    0x20, 0x24, 0x81, 0xac, 0x1a, 0x53, 0x01, 0x20, 0x34, 0xe1, 0xbd, 0x0b, 0x11, 0x98, 0x28, 0x44,
+    0x82, 0xcb, 0x8a, 0x53, 0x13, 0x98, 0x31, 0xb2, 0xef, 0x8b, 0x10, 0x00, 0x10, 0x33, 0x03, 0xfb,
+    0x0a, 0x31, 0x23, 0x80, 0x43, 0x92, 0xff, 0x9a, 0x18, 0x01, 0x08, 0x41, 0x13, 0xb9, 0x9c, 0x40,
+    0x23, 0x80, 0x38, 0x03, 0xfe, 0x9d, 0x18, 0x11, 0x88, 0x21, 0x23, 0xc8, 0xab, 0x41, 0x24, 0x00,
+    0x21, 0xa3, 0xff, 0x9b, 0x20, 0x80, 0x00, 0x42, 0x03, 0xba, 0x8a, 0x53, 0x02, 0x08, 0x42, 0xd0,
+    0xbe, 0x0a, 0x01, 0x88, 0x31, 0x25, 0xb8, 0xac, 0x41, 0x14, 0x90, 0x20, 0x14, 0xdd, 0xac, 0x20,
+    0x01, 0x88, 0x42, 0x04, 0xd9, 0x8b, 0x41, 0x12, 0x99, 0x41, 0x82, 0xed, 0x9a, 0x10, 0x01, 0x00,
+    0xe1, 0xf9, 0x47, 0x00, 0x23, 0xb0, 0xad, 0x20, 0x23, 0x00, 0x41, 0x83, 0xdf, 0x9c, 0x18, 0x11,
+    0x00, 0x32, 0x03, 0xca, 0x9c, 0x31, 0x33, 0x11, 0x43, 0xe0, 0xbe, 0x8b, 0x10, 0x80, 0x41, 0x35,
+    0xa0, 0xcb, 0x18, 0x23, 0x90, 0x40, 0x26, 0xe9, 0xac, 0x08, 0x01, 0x88, 0x51, 0x13, 0xb9, 0x9c,
+    0x31, 0x13, 0x89, 0x50, 0x03, 0xed, 0xab, 0x20, 0x82, 0x00, 0x43, 0x82, 0xdb, 0x89, 0x43, 0x02,
+    0x09, 0x32, 0xf0, 0xaf, 0x1a, 0x21, 0x08, 0x10, 0x24, 0xb9, 0x9e, 0x30, 0x24, 0x80, 0x30, 0x92,
+    0xef, 0x8b, 0x20, 0x01, 0x10, 0x42, 0x92, 0xcc, 0x09, 0x33, 0x00, 0x38, 0x14, 0xfc, 0xab, 0x18,
+    0x01, 0x18, 0x53, 0x13, 0xca, 0x0b, 0x32, 0x82, 0x09, 0x24, 0xf8, 0xae, 0x88, 0x01, 0x11, 0x32,
+    0x02, 0xc9, 0x09, 0x33, 0x81, 0x31, 0x27, 0xfb, 0x9f, 0x08, 0x01, 0x08, 0x31, 0x04, 0xc8, 0x8a,
+    0x22, 0x02, 0x00, 0x43, 0xd0, 0xbf, 0x8a, 0x11, 0x80, 0x31, 0x34, 0xa0, 0x9c, 0x41, 0x02, 0x88,
+    0x52, 0xb1, 0xcf, 0x0a, 0x01, 0x98, 0x20, 0x25, 0xb8, 0x9b, 0x62, 0x13, 0x89, 0x20, 0x92, 0xef,
+    0x8a, 0x11, 0x81, 0x18, 0x22, 0xa1, 0xbc, 0x30, 0x34, 0x00, 0x53, 0xa2, 0xdf, 0x8a, 0x11, 0x98,
+    0x18, 0x54, 0x91, 0xbb, 0x29, 0x34, 0x90, 0x89, 0x33, 0xf8, 0xae, 0x08, 0x11, 0x11, 0x11, 0x00,
+    0x99, 0x08, 0x11, 0x01, 0x73, 0x04, 0xfb, 0x9d, 0x28, 0x00, 0x89, 0x42, 0x23, 0xb9, 0xad, 0x30,
+    0x14, 0x98, 0x19, 0x34, 0xd0, 0xbe, 0x0a, 0x31, 0x81, 0x89, 0x42, 0x14, 0xc9, 0xab, 0x41, 0x14,
+    0x98, 0x18, 0x23, 0xe0, 0xcd, 0x89, 0x21, 0x82, 0x98, 0x41, 0x14, 0xb8, 0x9d, 0x30, 0x24, 0xa8,
+    0x10, 0x33, 0xf8, 0xae, 0x0a, 0x20, 0x80, 0x01, 0x42, 0x02, 0xdb, 0x0b, 0x52, 0x12, 0x98, 0x31,
+    0x95, 0x35, 0x40, 0x00, 0xa2, 0xff, 0x8b, 0x20, 0x81, 0x99, 0x41, 0x23, 0xb0, 0x9e, 0x30, 0x33,
+    0xb8, 0x2a, 0x44, 0xc0, 0xbf, 0x89, 0x21, 0x80, 0x89, 0x52, 0x04, 0xa9, 0x8a, 0x33, 0x23, 0xb9,
+    0x48, 0x13, 0xfa, 0xbf, 0x88, 0x22, 0x90, 0x09, 0x62, 0x03, 0xba, 0x0c, 0x34, 0x02, 0xba, 0x48,
+    0x23, 0xfb, 0x9f, 0x08, 0x11, 0x88, 0x00, 0x42, 0x01, 0xba, 0x0c, 0x34, 0x02, 0x99, 0x30, 0x83,
+    0xfe, 0xab, 0x29, 0x12, 0x80, 0x28, 0x35, 0xa1, 0xcb, 0x29, 0x35, 0x01, 0x8a, 0x32, 0xa1, 0xff,
+    0x9b, 0x28, 0x12, 0x88, 0x09, 0x44, 0x81, 0xea, 0x19, 0x42, 0x02, 0x99, 0x28, 0x12, 0xfa, 0xad,
+    0x19, 0x01, 0x80, 0x08, 0x33, 0x14, 0xb8, 0xab, 0x40, 0x24, 0x11, 0x19, 0x33, 0xb1, 0xff, 0x9e,
+    0x08, 0x01, 0x00, 0x11, 0x32, 0x91, 0xaa, 0x8b, 0x62, 0x33, 0x80, 0x32, 0x82, 0xfc, 0xaf, 0x8a,
+    0x11, 0x80, 0x21, 0x32, 0x24, 0xb9, 0xbc, 0x38, 0x25, 0x01, 0x08, 0x44, 0xa0, 0xee, 0x9b, 0x08,
+    0x11, 0x08, 0x21, 0x44, 0x92, 0xba, 0x8c, 0x43, 0x22, 0x90, 0x48, 0x22, 0xf9, 0xaf, 0x0a, 0x10,
+    0x01, 0x08, 0x42, 0x13, 0xa9, 0xbb, 0x28, 0x25, 0x13, 0x88, 0x33, 0xa1, 0xff, 0x9e, 0x08, 0x10,
+    0x80, 0x11, 0x42, 0x02, 0xca, 0x89, 0x31, 0x13, 0x98, 0x60, 0x23, 0xf9, 0xbd, 0x8a, 0x11, 0x00,
+    0x08, 0x63, 0x13, 0xa8, 0xbc, 0x28, 0x23, 0x02, 0x09, 0x45, 0x81, 0xfc, 0xbb, 0x08, 0x11, 0x00,
+    0x21, 0x53, 0x83, 0xca, 0xab, 0x42, 0x23, 0x80, 0x38, 0x26, 0xb1, 0xdf, 0x9b, 0x10, 0x00, 0x08,
+    0x31, 0x42, 0x82, 0xaa, 0xcb, 0x38, 0x25, 0x03, 0x18, 0x53, 0x82, 0xfd, 0xac, 0x09, 0x10, 0x10,
+    0x00, 0x41, 0x33, 0xc9, 0xbc, 0x39, 0x35, 0x22, 0x99, 0x42, 0x04, 0xe9, 0xbd, 0x8a, 0x11, 0x81,
+    0xba, 0xdc, 0x44, 0x00, 0x18, 0x62, 0x02, 0xa9, 0x9c, 0x30, 0x24, 0x01, 0x08, 0x34, 0x82, 0xfd,
+    0x9d, 0x88, 0x01, 0x80, 0x10, 0x32, 0x04, 0xb8, 0xba, 0x19, 0x44, 0x33, 0x90, 0x31, 0x23, 0xf9,
+    0xff, 0x89, 0x10, 0x81, 0x08, 0x11, 0x23, 0x91, 0xdb, 0x0a, 0x33, 0x14, 0x98, 0x30, 0x25, 0xc8,
+    0xcf, 0x8a, 0x10, 0x82, 0x88, 0x21, 0x34, 0x92, 0xbc, 0x9b, 0x62, 0x12, 0x80, 0x29, 0x25, 0x91,
+    0xed, 0xab, 0x08, 0x01, 0x88, 0x10, 0x34, 0x04, 0xa8, 0xbb, 0x20, 0x44, 0x23, 0x01, 0x31, 0x14,
+    0xfc, 0xaf, 0x0a, 0x11, 0x80, 0x08, 0x40, 0x14, 0x90, 0xab, 0x19, 0x34, 0x23, 0xa9, 0x40, 0x25,
+    0xc8, 0xdf, 0x8a, 0x18, 0x00, 0x08, 0x11, 0x53, 0x03, 0xa9, 0xbb, 0x28, 0x35, 0x11, 0x80, 0x28,
+    0x13, 0xf9, 0xcf, 0x9a, 0x18, 0x12, 0x80, 0x00, 0x53, 0x33, 0xb8, 0xcc, 0x0a, 0x42, 0x23, 0x90,
+    0x38, 0x25, 0xb1, 0xff, 0x9b, 0x10, 0x21, 0x88, 0x18, 0x42, 0x23, 0xb9, 0xad, 0x19, 0x25, 0x00,
+    0x90, 0x28, 0x15, 0x90, 0xee, 0x9a, 0x08, 0x12, 0x88, 0x10, 0x52, 0x13, 0xa8, 0xad, 0x0a, 0x21,
+    0x33, 0x02, 0x28, 0x44, 0x81, 0xef, 0xab, 0x08, 0x21, 0x80, 0x11, 0x30, 0x34, 0xa0, 0xeb, 0x9b,
+    0x42, 0x33, 0x13, 0x09, 0x34, 0x02, 0xfe, 0xad, 0x09, 0x21, 0x80, 0x09, 0x20, 0x34, 0x90, 0xca,
+    0x0a, 0x52, 0x23, 0x02, 0x8a, 0x53, 0x13, 0xfd, 0xbc, 0x09, 0x11, 0x00, 0x08, 0x32, 0x26, 0x91,
+    0xcb, 0x9b, 0x42, 0x23, 0x81, 0x09, 0x52, 0x12, 0xfc, 0xad, 0x09, 0x11, 0x01, 0x89, 0x31, 0x35,
+    0x81, 0xbc, 0x9b, 0x40, 0x22, 0x01, 0x00, 0x63, 0x22, 0xc8, 0xcf, 0xaa, 0x18, 0x11, 0x80, 0x00,
+    0x32, 0x34, 0x81, 0xeb, 0xab, 0x30, 0x35, 0x04, 0x98, 0x28, 0x25, 0xb0, 0xef, 0x9a, 0x08, 0x12,
+    0xed, 0xde, 0x48, 0x00, 0x08, 0x18, 0x43, 0x13, 0xb8, 0xbc, 0x1a, 0x34, 0x23, 0x91, 0x39, 0x36,
+    0x81, 0xfd, 0xac, 0x89, 0x10, 0x01, 0x18, 0x11, 0x52, 0x03, 0xb9, 0xbd, 0x09, 0x44, 0x23, 0x81,
+    0x08, 0x21, 0x82, 0xfe, 0xbc, 0x8a, 0x31, 0x82, 0x09, 0x21, 0x45, 0x02, 0xba, 0xac, 0x19, 0x34,
+    0x22, 0x01, 0x1a, 0x33, 0x81, 0xff, 0xbc, 0x8a, 0x21, 0x13, 0x98, 0x20, 0x53, 0x14, 0xb9, 0xbc,
+    0x0a, 0x54, 0x22, 0x80, 0x08, 0x43, 0x81, 0xed, 0xbc, 0x89, 0x21, 0x01, 0x88, 0x10, 0x44, 0x13,
+    0xba, 0xae, 0x18, 0x25, 0x02, 0x90, 0x28, 0x24, 0xa1, 0xcf, 0xac, 0x09, 0x10, 0x01, 0x08, 0x30,
+    0x34, 0x13, 0xb9, 0xad, 0x2a, 0x44, 0x22, 0x80, 0x19, 0x35, 0x92, 0xee, 0xac, 0x8a, 0x01, 0x01,
+    0x00, 0x10, 0x22, 0x35, 0x91, 0xca, 0xbb, 0x48, 0x45, 0x22, 0x98, 0x89, 0x43, 0x02, 0xfd, 0xac,
+    0x8a, 0x11, 0x12, 0x98, 0x08, 0x52, 0x24, 0x91, 0xcb, 0x9a, 0x40, 0x33, 0x11, 0xa0, 0x29, 0x27,
+    0x01, 0xfb, 0xaf, 0x88, 0x10, 0x01, 0x89, 0x10, 0x32, 0x34, 0x90, 0xca, 0xab, 0x48, 0x34, 0x22,
+    0xa8, 0x2a, 0x35, 0x82, 0xfd, 0xad, 0x89, 0x20, 0x02, 0x89, 0x18, 0x42, 0x24, 0xa1, 0xcb, 0x9b,
+    0x40, 0x25, 0x11, 0x99, 0x39, 0x34, 0x90, 0xfd, 0xbb, 0x8a, 0x11, 0x12, 0x88, 0x10, 0x63, 0x24,
+    0x90, 0xba, 0xac, 0x40, 0x23, 0x23, 0x98, 0x29, 0x25, 0x81, 0xfe, 0xbc, 0x8a, 0x11, 0x12, 0x80,
+    0x10, 0x63, 0x33, 0xa0, 0xbc, 0x9b, 0x40, 0x33, 0x23, 0xa1, 0x28, 0x35, 0x92, 0xff, 0xac, 0x0a,
+    0x20, 0x11, 0x88, 0x28, 0x42, 0x24, 0x98, 0xba, 0xab, 0x41, 0x44, 0x22, 0xa8, 0x29, 0x34, 0x82,
+    0xff, 0xbb, 0x89, 0x21, 0x81, 0x80, 0x22, 0x45, 0x02, 0xb9, 0xbc, 0x18, 0x44, 0x12, 0x90, 0x28,
+    0x41, 0x31, 0x3e, 0x00, 0x24, 0xf9, 0xbf, 0x99, 0x10, 0x11, 0x88, 0x00, 0x43, 0x14, 0x90, 0xbc,
+    0x8a, 0x52, 0x33, 0x80, 0x8a, 0x42, 0x24, 0xe9, 0xbe, 0x8b, 0x20, 0x11, 0x98, 0x10, 0x52, 0x34,
+    0x98, 0xbc, 0x9a, 0x41, 0x24, 0x81, 0x99, 0x51, 0x23, 0xe8, 0xbf, 0x8a, 0x28, 0x12, 0x08, 0x18,
+    0x42, 0x15, 0xa0, 0xdb, 0x8a, 0x32, 0x14, 0x80, 0x08, 0x52, 0x02, 0xfa, 0xbc, 0x8b, 0x10, 0x10,
+    0x00, 0x31, 0x34, 0x32, 0xb8, 0xae, 0x8a, 0x31, 0x34, 0x23, 0x01, 0x34, 0x92, 0xfb, 0xdf, 0x8a,
+    0x18, 0x11, 0x00, 0x10, 0x31, 0x23, 0xa0, 0xcd, 0x0b, 0x62, 0x23, 0x91, 0x9a, 0x41, 0x14, 0xfb,
+    0xbc, 0x8a, 0x21, 0x02, 0xa8, 0x08, 0x44, 0x24, 0x90, 0xac, 0x8a, 0x42, 0x23, 0x98, 0x9a, 0x64,
+    0x23, 0xd9, 0xbf, 0x89, 0x10, 0x11, 0x88, 0x20, 0x53, 0x03, 0xd9, 0xbb, 0x1a, 0x34, 0x22, 0x80,
+    0x31, 0x24, 0xd8, 0xdf, 0x9a, 0x10, 0x12, 0x81, 0x00, 0x31, 0x33, 0xd9, 0xbd, 0x29, 0x44, 0x12,
+    0x98, 0x09, 0x33, 0xc2, 0xdf, 0x9b, 0x20, 0x11, 0x99, 0x08, 0x53, 0x23, 0xa8, 0xbb, 0x28, 0x35,
+    0x12, 0xa9, 0x38, 0x35, 0xb0, 0xff, 0x9a, 0x18, 0x01, 0x98, 0x08, 0x53, 0x23, 0xb8, 0xac, 0x30,
+    0x35, 0x81, 0xa9, 0x38, 0x25, 0xc0, 0xcf, 0xaa, 0x20, 0x12, 0x98, 0x09, 0x52, 0x23, 0xb0, 0xae,
+    0x29, 0x44, 0x11, 0x98, 0x09, 0x13, 0x91, 0xfe, 0xbb, 0x18, 0x23, 0x80, 0x89, 0x41, 0x34, 0x91,
+    0xbd, 0x89, 0x52, 0x23, 0x98, 0x89, 0x63, 0x82, 0xfc, 0xbb, 0x89, 0x12, 0x02, 0x00, 0x41, 0x43,
+    0x01, 0xcb, 0xac, 0x38, 0x35, 0x02, 0x89, 0x21, 0x13, 0xfb, 0xcf, 0x89, 0x20, 0x01, 0x08, 0x10,
+    0x32, 0x02, 0xeb, 0x9a, 0x38, 0x45, 0x01, 0x99, 0x10, 0x23, 0xf9, 0xbd, 0x8a, 0x11, 0x01, 0x09,
+    0xf7, 0xe6, 0x41, 0x00, 0x34, 0x02, 0xca, 0x8a, 0x41, 0x03, 0x19, 0x42, 0x25, 0xb0, 0xde, 0xab,
+    0x18, 0x81, 0xaa, 0x48, 0x45, 0x12, 0xb9, 0x9c, 0x30, 0x34, 0x91, 0xba, 0x50, 0x15, 0xd8, 0xbd,
+    0x0a, 0x21, 0x01, 0x88, 0x21, 0x43, 0x91, 0xbb, 0x18, 0x44, 0x22, 0x11, 0x41, 0x92, 0xee, 0xbd,
+    0x89, 0x21, 0x81, 0x88, 0x42, 0x25, 0xa8, 0xcc, 0x08, 0x34, 0x12, 0x89, 0x28, 0x44, 0xa0, 0xdf,
+    0x9a, 0x28, 0x11, 0x88, 0x19, 0x52, 0x12, 0xc8, 0xab, 0x38, 0x35, 0x02, 0xa9, 0x30, 0x23, 0xfb,
+    0xcf, 0x89, 0x12, 0x80, 0x80, 0x21, 0x23, 0xa0, 0xbb, 0x28, 0x45, 0x03, 0x08, 0x31, 0x13, 0xfb,
+    0xdf, 0x89, 0x00, 0x01, 0x88, 0x20, 0x24, 0x81, 0xba, 0x8a, 0x63, 0x14, 0x90, 0x89, 0x43, 0x93,
+    0xff, 0xaa, 0x10, 0x02, 0x90, 0x08, 0x42, 0x14, 0xb9, 0xac, 0x31, 0x25, 0x91, 0x8a, 0x41, 0x03,
+    0xfc, 0xac, 0x18, 0x21, 0x88, 0x08, 0x42, 0x03, 0xd9, 0x9b, 0x32, 0x24, 0x90, 0x29, 0x22, 0xd0,
+    0xcf, 0x8a, 0x10, 0x81, 0x18, 0x32, 0x25, 0xb8, 0xac, 0x28, 0x25, 0x82, 0x8a, 0x62, 0x82, 0xfb,
+    0xad, 0x18, 0x12, 0x88, 0x09, 0x52, 0x12, 0xb9, 0xac, 0x31, 0x25, 0x91, 0x89, 0x31, 0xa2, 0xef,
+    0x9a, 0x00, 0x01, 0x18, 0x20, 0x32, 0xa0, 0xa9, 0x38, 0x26, 0x21, 0x88, 0x62, 0x92, 0xed, 0x9c,
+    0x08, 0x01, 0x98, 0x10, 0x42, 0x12, 0xcb, 0xaa, 0x63, 0x33, 0x81, 0x19, 0x23, 0xc8, 0xff, 0x9a,
+    0x10, 0x11, 0x80, 0x18, 0x43, 0x90, 0xcb, 0x0a, 0x53, 0x23, 0x90, 0x31, 0x23, 0xfa, 0xcf, 0x89,
+    0x11, 0x80, 0x00, 0x31, 0x04, 0xb8, 0xbb, 0x31, 0x33, 0x82, 0x50, 0x35, 0xb1, 0xef, 0x8a, 0x18,
+    0x81, 0x99, 0x30, 0x36, 0x91, 0xac, 0x19, 0x53, 0x01, 0x9a, 0x38, 0x24, 0xf9, 0xad, 0x09, 0x12,
+    0x17, 0xea, 0x49, 0x00, 0x89, 0x28, 0x43, 0x91, 0xba, 0x09, 0x45, 0x01, 0x89, 0x40, 0x82, 0xfc,
+    0x9c, 0x00, 0x02, 0x89, 0x18, 0x42, 0x81, 0xa9, 0x1a, 0x45, 0x23, 0x98, 0x89, 0xa9, 0xed, 0x9a,
+    0x08, 0x01, 0x00, 0x22, 0x00, 0xda, 0xab, 0x73, 0x35, 0x02, 0x89, 0x12, 0xb0, 0xff, 0x8b, 0x10,
+    0x12, 0x00, 0x18, 0x21, 0xa9, 0xcc, 0x38, 0x44, 0x12, 0x08, 0x12, 0xc9, 0xcf, 0x8a, 0x10, 0x01,
+    0x18, 0x41, 0x02, 0xba, 0xad, 0x41, 0x33, 0x82, 0x09, 0x13, 0xf9, 0xbf, 0x09, 0x12, 0x90, 0x28,
+    0x63, 0x02, 0xcb, 0x9a, 0x63, 0x02, 0x99, 0x1a, 0x23, 0xe8, 0xbe, 0x09, 0x31, 0x80, 0x00, 0x40,
+    0x04, 0x98, 0x9a, 0x51, 0x13, 0xa0, 0x89, 0x88, 0xfb, 0xae, 0x88, 0x21, 0x80, 0x11, 0x43, 0x81,
+    0xaa, 0x1a, 0x46, 0x23, 0x98, 0x10, 0xa9, 0xef, 0xab, 0x18, 0x21, 0x88, 0x20, 0x35, 0x90, 0xbc,
+    0x29, 0x36, 0x13, 0x99, 0x31, 0x92, 0xff, 0xab, 0x10, 0x02, 0x88, 0x40, 0x23, 0xb8, 0xbc, 0x48,
+    0x34, 0x02, 0x19, 0x33, 0xf8, 0xbf, 0x0a, 0x11, 0x80, 0x18, 0x53, 0x92, 0xdb, 0x89, 0x53, 0x01,
+    0x88, 0x41, 0x92, 0xec, 0x9b, 0x00, 0x01, 0x88, 0x42, 0x23, 0xc9, 0x9b, 0x42, 0x14, 0x90, 0x38,
+    0x04, 0xfc, 0xbb, 0x18, 0x12, 0x88, 0x38, 0x44, 0x90, 0xac, 0x28, 0x35, 0x02, 0x88, 0x11, 0xf9,
+    0xae, 0x0a, 0x11, 0x00, 0x21, 0x32, 0xa8, 0xbb, 0x2a, 0x45, 0x32, 0x23, 0x12, 0xfd, 0xbb, 0x9a,
+    0x80, 0x8a, 0x73, 0x24, 0xa0, 0x9d, 0x28, 0x43, 0xa0, 0x89, 0x44, 0xa2, 0xdd, 0x8b, 0x11, 0x01,
+    0x09, 0x21, 0x23, 0xc8, 0x9a, 0x41, 0x24, 0x10, 0x10, 0xb0, 0xff, 0x8a, 0x00, 0x01, 0x09, 0x52,
+    0x12, 0xc9, 0x8c, 0x21, 0x24, 0x88, 0x18, 0x12, 0xfc, 0xac, 0x08, 0x12, 0x80, 0x31, 0x15, 0xb0,
+    0xd4, 0xf9, 0x44, 0x00, 0x0b, 0x53, 0x22, 0x88, 0x31, 0xa2, 0xff, 0x9b, 0x08, 0x11, 0x08, 0x43,
+    0x13, 0xba, 0x9b, 0x53, 0x02, 0x80, 0x50, 0x14, 0xd9, 0xcd, 0x89, 0x18, 0x01, 0x89, 0x30, 0x35,
+    0x81, 0xca, 0x8a, 0x51, 0x33, 0xa0, 0x8b, 0x52, 0x83, 0xfd, 0xab, 0x08, 0x23, 0x90, 0x88, 0x41,
+    0x25, 0xa8, 0xcb, 0x18, 0x24, 0x11, 0x89, 0x32, 0x02, 0xfa, 0xbf, 0x99, 0x11, 0x80, 0x20, 0x43,
+    0x14, 0x98, 0x9a, 0x09, 0x02, 0x10, 0x00, 0x74, 0x12, 0xc8, 0xbf, 0x99, 0x18, 0x98, 0x09, 0x31,
+    0x46, 0x01, 0xa8, 0x9b, 0x52, 0x13, 0xb0, 0x0b, 0x35, 0x02, 0xee, 0xaa, 0x08, 0x01, 0x98, 0x19,
+    0x63, 0x12, 0xa8, 0x8a, 0x51, 0x33, 0x91, 0x89, 0x35, 0x92, 0xff, 0xaa, 0x08, 0x11, 0x98, 0x09,
+    0x53, 0x13, 0xa0, 0xac, 0x38, 0x35, 0x03, 0xa8, 0x28, 0x25, 0xe0, 0xbf, 0x8a, 0x21, 0x81, 0x89,
+    0x30, 0x26, 0x90, 0xbb, 0x19, 0x35, 0x02, 0x89, 0x51, 0x23, 0xea, 0xae, 0x9a, 0x10, 0x81, 0x00,
+    0x11, 0x43, 0x00, 0xb8, 0xad, 0x30, 0x36, 0x03, 0x89, 0x20, 0x03, 0xfe, 0xac, 0x09, 0x32, 0x80,
+    0x99, 0x40, 0x24, 0xa0, 0xcb, 0x19, 0x42, 0x13, 0x88, 0x10, 0x43, 0xa1, 0xef, 0xba, 0x09, 0x11,
+    0x01, 0x88, 0x42, 0x34, 0x91, 0xca, 0x8b, 0x34, 0x23, 0xa1, 0x1a, 0x44, 0x82, 0xfd, 0xbb, 0x8a,
+    0x21, 0x01, 0x08, 0x28, 0x55, 0x11, 0xba, 0x9c, 0x41, 0x25, 0x81, 0x99, 0x30, 0x03, 0xfc, 0xad,
+    0x0a, 0x11, 0x02, 0x80, 0x10, 0x24, 0x83, 0xda, 0xac, 0x40, 0x24, 0x02, 0x9a, 0x30, 0x14, 0xf9,
+    0xae, 0x0a, 0x20, 0x81, 0x88, 0x11, 0x33, 0x83, 0xaa, 0xbb, 0x40, 0x35, 0x24, 0xa8, 0x19, 0x33,
+    0xf0, 0xdf, 0x8a, 0x20, 0x02, 0xa9, 0x08, 0x54, 0x02, 0xa8, 0x9a, 0x28, 0x24, 0x12, 0xa9, 0x19,
+    0xf1, 0x22, 0x3c, 0x00, 0x02, 0xfd, 0x9e, 0x89, 0x10, 0x00, 0x18, 0x21, 0x34, 0x83, 0xca, 0x9b,
+    0x63, 0x23, 0xa8, 0x0a, 0x53, 0x82, 0xfd, 0xbb, 0x88, 0x22, 0x81, 0x89, 0x32, 0x27, 0x91, 0xcb,
+    0x8a, 0x52, 0x23, 0x81, 0x9a, 0x32, 0x12, 0xfa, 0xbf, 0x8a, 0x10, 0x12, 0x98, 0x00, 0x42, 0x13,
+    0x90, 0xcc, 0x0a, 0x53, 0x34, 0x81, 0xaa, 0x20, 0x33, 0xf9, 0xbf, 0x9a, 0x10, 0x12, 0xa8, 0x08,
+    0x42, 0x26, 0x90, 0xbb, 0x0a, 0x54, 0x02, 0x88, 0x09, 0x53, 0x91, 0xdb, 0xae, 0x89, 0x08, 0x02,
+    0x80, 0x11, 0x52, 0x23, 0xa0, 0xbc, 0x0a, 0x35, 0x12, 0x80, 0x18, 0x44, 0x80, 0xdc, 0xbe, 0x9a,
+    0x09, 0x12, 0x01, 0x11, 0x52, 0x25, 0x90, 0xba, 0x9b, 0x52, 0x12, 0x23, 0x00, 0x24, 0x81, 0xf9,
+    0xcf, 0x9a, 0x09, 0x12, 0x00, 0x00, 0x42, 0x34, 0x90, 0xbc, 0x8b, 0x53, 0x33, 0x02, 0x09, 0x42,
+    0x02, 0xfa, 0xcf, 0x9a, 0x10, 0x12, 0x88, 0x09, 0x51, 0x25, 0x90, 0xca, 0x0a, 0x42, 0x13, 0xa0,
+    0x8a, 0x53, 0x13, 0xfb, 0xbd, 0x8a, 0x20, 0x02, 0x98, 0x09, 0x72, 0x33, 0xa8, 0xdb, 0x0a, 0x53,
+    0x13, 0x98, 0x99, 0x52, 0x12, 0xda, 0xce, 0x99, 0x10, 0x22, 0x88, 0x89, 0x40, 0x24, 0x81, 0xca,
+    0x8b, 0x21, 0x34, 0x02, 0x80, 0x08, 0x32, 0xa2, 0xee, 0xcd, 0x9a, 0x08, 0x21, 0x01, 0x08, 0x30,
+    0x36, 0x13, 0xc9, 0xac, 0x18, 0x53, 0x13, 0x88, 0x08, 0x44, 0x01, 0xfb, 0xbd, 0x9a, 0x19, 0x21,
+    0x80, 0x00, 0x41, 0x25, 0x01, 0xc9, 0x9a, 0x38, 0x35, 0x12, 0x00, 0x18, 0x25, 0x91, 0xec, 0xae,
+    0x9a, 0x08, 0x11, 0x80, 0x00, 0x31, 0x45, 0x12, 0xa8, 0xad, 0x19, 0x43, 0x14, 0x98, 0x8a, 0x53,
+    0x23, 0xf9, 0xbe, 0x9a, 0x20, 0x12, 0x99, 0x0a, 0x62, 0x34, 0x81, 0xca, 0x9b, 0x20, 0x33, 0x02,
+    0xd2, 0x16, 0x3e, 0x00, 0x89, 0x64, 0x12, 0xb0, 0xcf, 0xab, 0x09, 0x30, 0x02, 0x99, 0x10, 0x64,
+    0x23, 0xa9, 0xcc, 0x0a, 0x42, 0x33, 0x90, 0xaa, 0x40, 0x34, 0xb1, 0xef, 0xaa, 0x18, 0x21, 0x81,
+    0x89, 0x18, 0x44, 0x03, 0xa8, 0xad, 0x19, 0x43, 0x23, 0x90, 0x9a, 0x42, 0x13, 0xc0, 0xef, 0xaa,
+    0x88, 0x20, 0x02, 0x88, 0x08, 0x42, 0x34, 0x02, 0xca, 0xac, 0x19, 0x45, 0x12, 0xa0, 0x9a, 0x40,
+    0x34, 0xb0, 0xcf, 0xac, 0x08, 0x10, 0x11, 0x88, 0x00, 0x42, 0x34, 0x82, 0xc9, 0xad, 0x0a, 0x43,
+    0x24, 0x82, 0x9a, 0x30, 0x43, 0x91, 0xef, 0xbb, 0x89, 0x11, 0x12, 0x80, 0x10, 0x42, 0x43, 0x81,
+    0xba, 0xac, 0x09, 0x52, 0x24, 0x12, 0x91, 0x18, 0x42, 0x02, 0xfe, 0xbc, 0x8b, 0x28, 0x12, 0x80,
+    0x08, 0x32, 0x45, 0x13, 0xa8, 0xcd, 0x8b, 0x41, 0x43, 0x02, 0x99, 0x18, 0x42, 0x13, 0xfc, 0xad,
+    0x9a, 0x10, 0x02, 0x88, 0x08, 0x32, 0x34, 0x23, 0xb9, 0xcd, 0x9b, 0x42, 0x25, 0x02, 0x90, 0x18,
+    0x44, 0x82, 0xeb, 0xbe, 0xaa, 0x10, 0x11, 0x81, 0x09, 0x42, 0x43, 0x03, 0x98, 0xdb, 0xbb, 0x20,
+    0x44, 0x25, 0x81, 0x08, 0x00, 0x23, 0xf8, 0xbf, 0xac, 0x18, 0x22, 0x81, 0x98, 0x20, 0x44, 0x23,
+    0xa8, 0xcb, 0x9b, 0x20, 0x25, 0x23, 0x01, 0x98, 0x21, 0x24, 0x80, 0xfe, 0xbc, 0xba, 0x88, 0x22,
+    0x12, 0x80, 0x18, 0x73, 0x34, 0x83, 0xdb, 0xab, 0x0a, 0x42, 0x33, 0x22, 0x91, 0x09, 0x44, 0x23,
+    0xe8, 0xdf, 0xab, 0x09, 0x32, 0x12, 0xa9, 0x08, 0x52, 0x25, 0x01, 0xb9, 0xbb, 0x8a, 0x41, 0x34,
+    0x23, 0x80, 0x9a, 0x62, 0x23, 0xa0, 0xff, 0xbb, 0x99, 0x20, 0x22, 0x88, 0x89, 0x42, 0x45, 0x22,
+    0xa8, 0xbc, 0x9a, 0x10, 0x42, 0x23, 0x23, 0xa0, 0x38, 0x26, 0x01, 0xfc, 0xbe, 0xaa, 0x08, 0x32,
+    0x4c, 0xe3, 0x43, 0x00, 0x80, 0x08, 0x31, 0x54, 0x22, 0xa0, 0xcc, 0x9a, 0x29, 0x44, 0x12, 0x01,
+    0x99, 0x30, 0x14, 0x80, 0xfd, 0xbd, 0x9a, 0x10, 0x23, 0x81, 0x99, 0x10, 0x45, 0x23, 0x81, 0xca,
+    0xbb, 0x8a, 0x72, 0x23, 0x01, 0xb8, 0x1a, 0x54, 0x02, 0xd9, 0xbe, 0x9c, 0x08, 0x20, 0x01, 0x88,
+    0x10, 0x43, 0x53, 0x13, 0xba, 0xad, 0x8b, 0x51, 0x23, 0x12, 0x91, 0x0a, 0x44, 0x03, 0xf9, 0xce,
+    0x9a, 0x08, 0x21, 0x82, 0x98, 0x18, 0x54, 0x13, 0x90, 0xdb, 0x9a, 0x21, 0x34, 0x22, 0x98, 0x09,
+    0x31, 0x35, 0xf8, 0xce, 0xaa, 0x18, 0x22, 0x01, 0x98, 0x18, 0x52, 0x24, 0xa1, 0xcb, 0xab, 0x38,
+    0x36, 0x22, 0x80, 0x9a, 0x41, 0x23, 0xd8, 0xdf, 0x9b, 0x09, 0x22, 0x12, 0x88, 0x18, 0x52, 0x33,
+    0x81, 0xdb, 0xbc, 0x28, 0x44, 0x22, 0x90, 0x8a, 0x41, 0x23, 0xc1, 0xef, 0x9b, 0x09, 0x20, 0x81,
+    0x88, 0x20, 0x42, 0x44, 0x81, 0xb9, 0xbb, 0x1a, 0x44, 0x22, 0x01, 0x89, 0x52, 0x23, 0xc0, 0xdf,
+    0xab, 0x8a, 0x20, 0x01, 0x88, 0x20, 0x44, 0x34, 0x01, 0xb9, 0xbd, 0x09, 0x43, 0x22, 0x01, 0x88,
+    0x52, 0x33, 0xa1, 0xff, 0xac, 0x8a, 0x10, 0x22, 0x80, 0x08, 0x32, 0x35, 0x83, 0xa9, 0xbc, 0x9b,
+    0x53, 0x43, 0x12, 0xa8, 0x29, 0x53, 0x02, 0xfd, 0xad, 0x9a, 0x10, 0x02, 0x80, 0x10, 0x43, 0x34,
+    0x81, 0xa9, 0xac, 0x09, 0x44, 0x12, 0x80, 0x09, 0x42, 0x15, 0xea, 0xbe, 0x9b, 0x10, 0x22, 0x80,
+    0x89, 0x41, 0x44, 0x02, 0xb9, 0xbc, 0x28, 0x53, 0x23, 0xa0, 0x8a, 0x52, 0x14, 0xe9, 0xcd, 0x9a,
+    0x10, 0x12, 0x90, 0x09, 0x31, 0x36, 0x01, 0xca, 0xba, 0x28, 0x44, 0x12, 0x90, 0x0a, 0x63, 0x13,
+    0xfa, 0xcc, 0x9a, 0x10, 0x12, 0x88, 0x08, 0x41, 0x34, 0x81, 0xba, 0xac, 0x20, 0x35, 0x02, 0x98,
+    0x22, 0x16, 0x3d, 0x00, 0x41, 0x25, 0xa1, 0xdf, 0xab, 0x09, 0x21, 0x01, 0x99, 0x21, 0x35, 0x14,
+    0xa8, 0xac, 0x9a, 0x52, 0x23, 0x81, 0x99, 0x41, 0x24, 0xb0, 0xef, 0xab, 0x08, 0x21, 0x81, 0x98,
+    0x21, 0x35, 0x23, 0xa8, 0xad, 0x8a, 0x51, 0x23, 0x81, 0xa9, 0x30, 0x36, 0xb1, 0xef, 0xab, 0x08,
+    0x21, 0x81, 0x98, 0x28, 0x54, 0x22, 0xa0, 0xcb, 0x8a, 0x31, 0x26, 0x01, 0x99, 0x10, 0x33, 0xb2,
+    0xff, 0xac, 0x09, 0x11, 0x82, 0x99, 0x8a, 0x08, 0x33, 0x90, 0x8a, 0x09, 0x72, 0x24, 0x11, 0x90,
+    0x30, 0x37, 0x22, 0x80, 0x99, 0x41, 0x33, 0x13, 0xca, 0x19, 0x02, 0x01, 0xe8, 0xbc, 0xa9, 0xaa,
+    0xa9, 0xce, 0x9a, 0x99, 0x00, 0xfa, 0xbc, 0xab, 0x08, 0x01, 0xa8, 0xbd, 0x0a, 0x33, 0x91, 0xcc,
+    0x8a, 0x32, 0x34, 0x23, 0x89, 0x74, 0x35, 0x23, 0x00, 0x98, 0x20, 0x46, 0x33, 0x22, 0x11, 0x20,
+    0x11, 0x22, 0xa2, 0x8c, 0x11, 0xb8, 0xde, 0xbb, 0x9a, 0x20, 0xb1, 0xef, 0x9a, 0x9a, 0x09, 0xd9,
+    0xab, 0x9a, 0x28, 0xd8, 0xbe, 0xaa, 0xa9, 0x08, 0x81, 0x99, 0x08, 0x64, 0x32, 0x21, 0x80, 0x48,
+    0x47, 0x33, 0x11, 0x80, 0x40, 0x34, 0x25, 0x92, 0x09, 0x33, 0x33, 0x90, 0xcf, 0x8a, 0x21, 0x33,
+    0xb1, 0xad, 0xb9, 0x8b, 0x14, 0xdb, 0xbc, 0xcb, 0x09, 0x01, 0xa8, 0xde, 0xab, 0x88, 0x08, 0xb9,
+    0xac, 0x99, 0x19, 0x82, 0xbc, 0x10, 0xe9, 0x59, 0x45, 0x42, 0x24, 0x22, 0x35, 0x34, 0x33, 0x02,
+    0x88, 0x88, 0xcb, 0xbb, 0xcd, 0xbd, 0xbb, 0xbd, 0xba, 0xdb, 0xbb, 0xab, 0x08, 0x31, 0x33, 0x45,
+    0x34, 0x44, 0x43, 0x22, 0x22, 0x12, 0x10, 0x01, 0xa9, 0x99, 0xaa, 0xda, 0xdd, 0xbc, 0xbb, 0xbb,
+    0x9a, 0xab, 0x28, 0x34, 0x45, 0x25, 0x33, 0x25, 0x33, 0x32, 0x12, 0x88, 0xa9, 0xaa, 0xa8, 0xfe,
+    0x95, 0x1d, 0x3e, 0x00, 0xbc, 0xdb, 0xaa, 0xa9, 0xab, 0x8a, 0x89, 0x28, 0x32, 0x63, 0x34, 0x34,
+    0x35, 0x24, 0x32, 0x22, 0x11, 0x11, 0xa8, 0xaa, 0xea, 0xbc, 0xbb, 0xcd, 0x9a, 0xbb, 0xab, 0xba,
+    0x1a, 0x43, 0x53, 0x34, 0x32, 0x46, 0x43, 0x33, 0x23, 0x11, 0x80, 0x98, 0xca, 0xcc, 0xcc, 0xbb,
+    0xbd, 0xbb, 0xbb, 0x9c, 0x99, 0x89, 0x31, 0x24, 0x53, 0x23, 0x34, 0x45, 0x22, 0x23, 0x01, 0x18,
+    0x00, 0x00, 0x81, 0xfc, 0xbb, 0xbc, 0xcb, 0xaa, 0xcb, 0xaa, 0x08, 0x41, 0x23, 0x33, 0x54, 0x44,
+    0x54, 0x22, 0x11, 0x81, 0xa8, 0xcb, 0xbc, 0xcc, 0xba, 0xab, 0x9b, 0x08, 0x21, 0x62, 0x44, 0x24,
+    0x22, 0x22, 0x00, 0xa9, 0xdc, 0xbc, 0xac, 0xab, 0xaa, 0x09, 0x31, 0x43, 0x46, 0x33, 0x32, 0x22,
+    0x02, 0x00, 0xba, 0xce, 0xbc, 0xac, 0xab, 0x8a, 0x11, 0x43, 0x73, 0x43, 0x22, 0x13, 0x01, 0xa8,
+    0xca, 0xdb, 0xbc, 0xbb, 0xbb, 0x9a, 0x20, 0x42, 0x35, 0x35, 0x33, 0x32, 0x24, 0x90, 0xdb, 0xbc,
+    0xbd, 0xbb, 0xac, 0xaa, 0x28, 0x42, 0x53, 0x44, 0x32, 0x22, 0x02, 0x80, 0xca, 0xcc, 0xcb, 0xab,
+    0xa9, 0xa9, 0x10, 0x53, 0x43, 0x44, 0x23, 0x32, 0x21, 0x00, 0xbb, 0xce, 0xcb, 0xac, 0xaa, 0xaa,
+    0x08, 0x42, 0x33, 0x35, 0x35, 0x32, 0x22, 0x80, 0xba, 0xcd, 0xcb, 0xbc, 0xab, 0xaa, 0x8a, 0x31,
+    0x35, 0x35, 0x34, 0x33, 0x22, 0x02, 0x90, 0xdb, 0xbd, 0xcc, 0xab, 0xaa, 0x8a, 0x30, 0x43, 0x35,
+    0x35, 0x33, 0x23, 0x01, 0xa8, 0xeb, 0xcc, 0xbc, 0xbb, 0x8a, 0x30, 0x45, 0x34, 0x23, 0x11, 0x90,
+    0xbb, 0xcd, 0xbc, 0xba, 0x8a, 0x42, 0x53, 0x34, 0x21, 0x11, 0xa8, 0xda, 0xdc, 0xaa, 0x9a, 0x00,
+    0x33, 0x45, 0x23, 0x12, 0x81, 0xb9, 0xeb, 0xbc, 0xaa, 0x89, 0x21, 0x44, 0x34, 0x33, 0x12, 0x90,
+    0x65, 0x2d, 0x3c, 0x00, 0xec, 0xcb, 0xab, 0x8a, 0x28, 0x44, 0x34, 0x33, 0x21, 0x90, 0xbb, 0xdd,
+    0xcb, 0xaa, 0x89, 0x21, 0x34, 0x45, 0x22, 0x11, 0x98, 0xbb, 0xce, 0xab, 0xaa, 0x09, 0x32, 0x46,
+    0x33, 0x23, 0x82, 0xa9, 0xcc, 0xdb, 0xaa, 0x8a, 0x08, 0x32, 0x46, 0x22, 0x12, 0x80, 0xa9, 0xdc,
+    0xbb, 0xaa, 0x8a, 0x31, 0x45, 0x44, 0x12, 0x11, 0xa8, 0xca, 0xcc, 0xab, 0x9b, 0x19, 0x32, 0x46,
+    0x33, 0x23, 0x00, 0xb9, 0xcc, 0xbd, 0xab, 0xaa, 0x20, 0x53, 0x44, 0x32, 0x22, 0x00, 0xca, 0xcc,
+    0xac, 0x9b, 0x89, 0x21, 0x63, 0x34, 0x23, 0x12, 0xa8, 0xcb, 0xcd, 0xba, 0xa9, 0x10, 0x63, 0x34,
+    0x23, 0x81, 0xb9, 0xce, 0xab, 0x9a, 0x20, 0x44, 0x33, 0x02, 0xa0, 0xdb, 0xbc, 0xaa, 0x28, 0x34,
+    0x36, 0x22, 0x81, 0xb9, 0xce, 0xab, 0x9a, 0x28, 0x53, 0x34, 0x13, 0x81, 0xca, 0xcc, 0xaa, 0x18,
+    0x32, 0x35, 0x23, 0x80, 0xba, 0xde, 0xaa, 0x9a, 0x20, 0x44, 0x34, 0x22, 0x91, 0xc9, 0xcc, 0xaa,
+    0x89, 0x21, 0x44, 0x22, 0x02, 0xa8, 0xcd, 0xbb, 0x8a, 0x31, 0x64, 0x33, 0x12, 0x98, 0xda, 0xbd,
+    0xba, 0x8a, 0x21, 0x45, 0x33, 0x23, 0x90, 0xfb, 0xbb, 0x9a, 0x19, 0x42, 0x34, 0x22, 0x81, 0xb9,
+    0xcd, 0xab, 0x8a, 0x22, 0x55, 0x23, 0x12, 0x98, 0xdc, 0xbb, 0xbb, 0x18, 0x42, 0x35, 0x33, 0x02,
+    0xb9, 0xbe, 0xbc, 0x8a, 0x20, 0x54, 0x33, 0x13, 0x98, 0xcc, 0xbc, 0xab, 0x19, 0x42, 0x35, 0x23,
+    0x82, 0xb9, 0xbe, 0xbb, 0x99, 0x20, 0x45, 0x24, 0x22, 0x90, 0xcb, 0xbd, 0xaa, 0x09, 0x32, 0x36,
+    0x23, 0x81, 0xda, 0xcc, 0x8a, 0x18, 0x44, 0x23, 0x02, 0xc9, 0xcc, 0xab, 0x08, 0x53, 0x43, 0x01,
+    0x98, 0xbc, 0xab, 0x18, 0x63, 0x33, 0x02, 0xb9, 0xce, 0xba, 0x09, 0x42, 0x25, 0x12, 0xa0, 0xcb,
+    0xf0, 0xea, 0x45, 0x00, 0x9b, 0x28, 0x54, 0x22, 0x81, 0xb9, 0xcc, 0x9b, 0x18, 0x44, 0x33, 0x12,
+    0xb9, 0xbe, 0xac, 0x09, 0x53, 0x24, 0x02, 0xb8, 0xcc, 0xab, 0x09, 0x43, 0x25, 0x12, 0xa8, 0xcb,
+    0xac, 0x09, 0x32, 0x35, 0x13, 0x90, 0xcd, 0xbb, 0x8a, 0x41, 0x35, 0x23, 0x80, 0xdb, 0xcb, 0x8a,
+    0x20, 0x44, 0x22, 0x90, 0xda, 0xcb, 0x9a, 0x21, 0x45, 0x23, 0x81, 0xc9, 0xbc, 0xaa, 0x18, 0x63,
+    0x23, 0x01, 0xc9, 0xbc, 0xab, 0x29, 0x54, 0x24, 0x01, 0xa8, 0xcc, 0xaa, 0x08, 0x52, 0x33, 0x11,
+    0xb9, 0xbd, 0xac, 0x19, 0x43, 0x34, 0x12, 0xb0, 0xdc, 0xab, 0x09, 0x42, 0x24, 0x13, 0xa8, 0xcc,
+    0xbb, 0x8a, 0x52, 0x34, 0x23, 0x90, 0xdb, 0xbc, 0x8a, 0x41, 0x34, 0x13, 0xc9, 0xbd, 0x8a, 0x31,
+    0x35, 0x12, 0xb9, 0xbe, 0x8b, 0x40, 0x34, 0x12, 0xa8, 0xcd, 0x9a, 0x20, 0x34, 0x13, 0xa8, 0xcd,
+    0x9a, 0x28, 0x63, 0x12, 0x90, 0xdb, 0x9a, 0x18, 0x34, 0x14, 0x91, 0xeb, 0xab, 0x09, 0x53, 0x23,
+    0x81, 0xcb, 0xac, 0x09, 0x63, 0x32, 0x81, 0xcb, 0xad, 0x09, 0x31, 0x25, 0x01, 0xc9, 0xac, 0x89,
+    0x42, 0x24, 0x01, 0xc9, 0xcb, 0x89, 0x31, 0x35, 0x01, 0xb8, 0xbd, 0x9b, 0x40, 0x44, 0x02, 0xa8,
+    0xbc, 0x9b, 0x38, 0x35, 0x23, 0xa0, 0xce, 0xaa, 0x20, 0x44, 0x12, 0x98, 0xbc, 0x9b, 0x28, 0x45,
+    0x22, 0x90, 0xdc, 0xaa, 0x08, 0x53, 0x23, 0x80, 0xdb, 0xbb, 0x18, 0x63, 0x23, 0x80, 0xdb, 0xbb,
+    0x09, 0x53, 0x33, 0x81, 0xdb, 0xbb, 0x09, 0x62, 0x33, 0x02, 0xda, 0xbc, 0x89, 0x31, 0x36, 0x01,
+    0xb8, 0xbd, 0x9a, 0x31, 0x35, 0x13, 0xb8, 0xcd, 0x9a, 0x20, 0x44, 0x12, 0xa9, 0xbd, 0x8a, 0x42,
+    0x25, 0x90, 0xcb, 0x9b, 0x20, 0x35, 0x12, 0xca, 0xac, 0x19, 0x53, 0x13, 0xa8, 0xcd, 0x89, 0x41,
+    0xcc, 0x14, 0x49, 0x00, 0x02, 0xc8, 0xbb, 0x0a, 0x44, 0x23, 0xa0, 0xcd, 0x8a, 0x31, 0x25, 0x81,
+    0xda, 0xab, 0x18, 0x44, 0x02, 0xb0, 0xbc, 0x0a, 0x62, 0x22, 0x90, 0xdb, 0x9a, 0x31, 0x34, 0x82,
+    0xdb, 0x9c, 0x29, 0x43, 0x22, 0xb8, 0xae, 0x09, 0x42, 0x13, 0xa0, 0xcd, 0x99, 0x41, 0x33, 0x92,
+    0xea, 0xab, 0x18, 0x44, 0x13, 0xb8, 0xbd, 0x89, 0x42, 0x33, 0x91, 0xbd, 0x9c, 0x30, 0x34, 0x02,
+    0xca, 0xad, 0x18, 0x43, 0x12, 0xb9, 0xbd, 0x09, 0x63, 0x22, 0x90, 0xcc, 0x9b, 0x30, 0x44, 0x02,
+    0xc9, 0xbb, 0x19, 0x44, 0x12, 0xb8, 0xbc, 0x8a, 0x53, 0x24, 0x90, 0xbc, 0xab, 0x41, 0x34, 0x02,
+    0xea, 0xab, 0x19, 0x44, 0x22, 0xa8, 0xbd, 0x8a, 0x41, 0x24, 0x80, 0xcb, 0xab, 0x40, 0x53, 0x01,
+    0xba, 0x9d, 0x29, 0x53, 0x12, 0xba, 0xae, 0x18, 0x34, 0x02, 0xca, 0x9c, 0x28, 0x24, 0x92, 0xcb,
+    0x9a, 0x51, 0x23, 0xb0, 0xbd, 0x1a, 0x53, 0x13, 0xc8, 0xbc, 0x18, 0x34, 0x02, 0xca, 0x9c, 0x20,
+    0x26, 0x80, 0xbc, 0x8b, 0x42, 0x24, 0xa0, 0xac, 0x0a, 0x52, 0x12, 0xc9, 0xab, 0x28, 0x35, 0x82,
+    0xdb, 0xab, 0x31, 0x35, 0x81, 0xcc, 0x8b, 0x41, 0x33, 0xb0, 0xcc, 0x0a, 0x53, 0x03, 0xc8, 0xbb,
+    0x29, 0x45, 0x82, 0xca, 0x9b, 0x40, 0x24, 0xa1, 0xbc, 0x0b, 0x52, 0x23, 0xb8, 0xcc, 0x09, 0x43,
+    0x03, 0xc9, 0xac, 0x28, 0x34, 0x02, 0xdb, 0x9b, 0x30, 0x35, 0x91, 0xcc, 0x9a, 0x42, 0x24, 0xa0,
+    0xcc, 0x09, 0x32, 0x14, 0xc8, 0xbb, 0x29, 0x44, 0x02, 0xca, 0x9c, 0x30, 0x34, 0x90, 0xcc, 0x8a,
+    0x52, 0x22, 0xb8, 0xbc, 0x18, 0x53, 0x02, 0xc9, 0xbb, 0x20, 0x35, 0x01, 0xdb, 0x9a, 0x30, 0x25,
+    0x91, 0xbc, 0x9a, 0x42, 0x34, 0xa8, 0xbd, 0x1a, 0x44, 0x03, 0xdb, 0x9b, 0x41, 0x14, 0xa8, 0xad,
+    0x64, 0xd3, 0x4b, 0x00, 0x32, 0x13, 0xd9, 0xab, 0x31, 0x25, 0xa8, 0xad, 0x18, 0x34, 0x92, 0xbc,
+    0x0b, 0x63, 0x02, 0xca, 0x9a, 0x41, 0x13, 0xc8, 0xab, 0x30, 0x35, 0xb8, 0xbd, 0x28, 0x44, 0x91,
+    0xbc, 0x0a, 0x34, 0x13, 0xeb, 0x9a, 0x41, 0x23, 0xc8, 0xac, 0x20, 0x24, 0xa1, 0xbc, 0x19, 0x34,
+    0x82, 0xcc, 0x0a, 0x52, 0x03, 0xcb, 0x9b, 0x42, 0x14, 0xb8, 0xad, 0x20, 0x34, 0x90, 0xad, 0x1a,
+    0x53, 0x01, 0xcb, 0x8a, 0x52, 0x12, 0xc9, 0x9c, 0x21, 0x24, 0xa8, 0xac, 0x29, 0x25, 0x91, 0xbc,
+    0x09, 0x34, 0x02, 0xeb, 0x8a, 0x42, 0x12, 0xc9, 0xab, 0x40, 0x24, 0xb0, 0xad, 0x28, 0x34, 0xa1,
+    0xbc, 0x0a, 0x63, 0x02, 0xca, 0x9b, 0x42, 0x14, 0xb8, 0xac, 0x38, 0x34, 0xa0, 0xbd, 0x18, 0x34,
+    0x92, 0xeb, 0x0a, 0x32, 0x14, 0xca, 0xab, 0x31, 0x16, 0xb0, 0xbb, 0x38, 0x35, 0x91, 0xcd, 0x19,
+    0x43, 0x92, 0xbc, 0x29, 0x34, 0xa0, 0xbd, 0x38, 0x25, 0xb0, 0xad, 0x30, 0x34, 0xc8, 0x9c, 0x38,
+    0x24, 0xb8, 0xac, 0x40, 0x13, 0xb9, 0x9c, 0x41, 0x03, 0xca, 0x8a, 0x43, 0x82, 0xcc, 0x19, 0x53,
+    0x91, 0xbc, 0x19, 0x44, 0x91, 0xcb, 0x29, 0x33, 0xb1, 0xad, 0x38, 0x25, 0xc9, 0xab, 0x51, 0x14,
+    0xb9, 0xac, 0x31, 0x15, 0xb8, 0xab, 0x41, 0x13, 0xd9, 0x8a, 0x42, 0x83, 0xcc, 0x0a, 0x34, 0x93,
+    0xeb, 0x09, 0x42, 0x92, 0xca, 0x1a, 0x43, 0xa1, 0xcb, 0x39, 0x34, 0xa0, 0xae, 0x38, 0x33, 0xb8,
+    0xae, 0x30, 0x14, 0xc8, 0x9b, 0x42, 0x13, 0xdb, 0x8b, 0x53, 0x03, 0xcb, 0x8b, 0x53, 0x02, 0xcb,
+    0x8a, 0x53, 0x82, 0xcb, 0x1a, 0x34, 0x91, 0xbd, 0x29, 0x44, 0xa0, 0xac, 0x39, 0x34, 0xb0, 0xad,
+    0x28, 0x25, 0xb8, 0xab, 0x41, 0x23, 0xc9, 0x9c, 0x32, 0x14, 0xcb, 0x9b, 0x63, 0x83, 0xca, 0x0a,
+    0x0e, 0xf7, 0x48, 0x00, 0x23, 0xd8, 0xab, 0x18, 0x02, 0xa8, 0x9a, 0x19, 0x32, 0x14, 0x90, 0x9b,
+    0x20, 0x22, 0xa0, 0xab, 0x0a, 0x72, 0x23, 0x88, 0x89, 0x10, 0x22, 0xc8, 0x9b, 0x08, 0x41, 0x12,
+    0x89, 0x54, 0x12, 0xa9, 0xdb, 0x8a, 0x42, 0x14, 0xc9, 0xbb, 0x71, 0x16, 0xa0, 0xab, 0x20, 0x45,
+    0x82, 0xaa, 0x09, 0x53, 0x23, 0xc9, 0x8b, 0x42, 0x33, 0xa0, 0x9d, 0x30, 0x14, 0xb9, 0x8b, 0x28,
+    0x33, 0xb0, 0x8c, 0x33, 0x63, 0x03, 0xdc, 0x09, 0x88, 0x31, 0x93, 0x9a, 0x64, 0x13, 0xf9, 0x9c,
+    0x20, 0x23, 0xa9, 0x1a, 0x32, 0x22, 0xe1, 0xbd, 0x29, 0x23, 0x14, 0xa8, 0x39, 0x25, 0x31, 0xa2,
+    0xce, 0x09, 0x30, 0x44, 0x81, 0xba, 0x49, 0x36, 0xa0, 0xcd, 0x8a, 0x32, 0x23, 0xa8, 0xbd, 0x39,
+    0x35, 0x80, 0xba, 0xbd, 0x28, 0x34, 0x83, 0xdc, 0x8b, 0x21, 0x23, 0xc8, 0xad, 0x28, 0x34, 0x93,
+    0xcc, 0x8a, 0x40, 0x14, 0xb9, 0xac, 0x21, 0x14, 0x90, 0x88, 0x38, 0x77, 0x24, 0x12, 0x41, 0x53,
+    0x23, 0x11, 0x12, 0x10, 0x43, 0x23, 0x90, 0x89, 0x00, 0x88, 0xaa, 0xfd, 0xab, 0x89, 0xc9, 0xdc,
+    0xab, 0xbb, 0xab, 0xea, 0xcd, 0xbb, 0x9a, 0x99, 0xaa, 0xcb, 0xac, 0x28, 0x02, 0xda, 0x9a, 0x00,
+    0x21, 0x53, 0x02, 0x09, 0x73, 0x27, 0x02, 0x80, 0x20, 0x53, 0x14, 0x01, 0x00, 0x32, 0x33, 0x13,
+    0x91, 0x99, 0x52, 0x82, 0xdb, 0xab, 0x98, 0x88, 0xb9, 0xff, 0xab, 0x99, 0xba, 0xcb, 0xaa, 0xeb,
+    0xbb, 0xba, 0xbb, 0xaa, 0xdb, 0xbb, 0x89, 0x80, 0x99, 0x52, 0x13, 0x20, 0x37, 0x12, 0x12, 0x21,
+    0x21, 0x67, 0x35, 0x11, 0x31, 0x35, 0x23, 0x12, 0x01, 0x98, 0x30, 0x14, 0x98, 0x99, 0xaa, 0xaa,
+    0xab, 0xfc, 0xbe, 0x88, 0x98, 0xab, 0xec, 0xcb, 0xaa, 0xaa, 0xeb, 0xcb, 0x89, 0x18, 0x00, 0xb8,
+    0x3a, 0xdc, 0x2f, 0x00, 0x9c, 0x20, 0x83, 0x10, 0x23, 0x72, 0x27, 0x22, 0x11, 0x88, 0x43, 0x13,
+    0x42, 0x33, 0x73, 0x36, 0x13, 0x02, 0x01, 0x01, 0x98, 0xdc, 0xac, 0xdb, 0xbc, 0xcc, 0xac, 0x9b,
+    0xaa, 0x89, 0x88, 0x18, 0x34, 0x43, 0x45, 0x33, 0x35, 0x24, 0x31, 0x32, 0x22, 0x12, 0x90, 0x9b,
+    0xa9, 0xce, 0xbc, 0xcc, 0xaa, 0xba, 0xac, 0xa9, 0x8a, 0x22, 0x12, 0x54, 0x33, 0x54, 0x23, 0x11,
+    0x21, 0x12, 0x11, 0x90, 0xcc, 0xba, 0xce, 0xbc, 0xdb, 0xac, 0xa9, 0x9a, 0x88, 0x98, 0x40, 0x22,
+    0x42, 0x44, 0x43, 0x34, 0x22, 0x32, 0x23, 0x43, 0x11, 0xaa, 0x9a, 0xb9, 0xbf, 0xcc, 0xbc, 0xaa,
+    0xba, 0x8a, 0xa9, 0x0a, 0x34, 0x32, 0x46, 0x33, 0x35, 0x24, 0x21, 0x13, 0x00, 0x01, 0xb9, 0xcc,
+    0xbc, 0xbd, 0xbc, 0xcc, 0xaa, 0xaa, 0xab, 0xa9, 0x9a, 0x31, 0x23, 0x56, 0x34, 0x35, 0x33, 0x22,
+    0x12, 0x12, 0x12, 0x12, 0x98, 0xb9, 0xcc, 0xcd, 0xdc, 0xbb, 0xab, 0xaa, 0x89, 0x98, 0x21, 0x43,
+    0x63, 0x33, 0x44, 0x33, 0x24, 0x33, 0x22, 0x01, 0xa9, 0xcc, 0xcd, 0xbc, 0xcc, 0xba, 0x9a, 0x89,
+    0x10, 0x53, 0x44, 0x43, 0x33, 0x12, 0x00, 0xa9, 0xcb, 0xcd, 0xcb, 0xab, 0x9a, 0x88, 0x21, 0x34,
+    0x45, 0x34, 0x23, 0x22, 0x01, 0x98, 0xc9, 0xcc, 0xdb, 0xbb, 0xaa, 0x8a, 0x18, 0x43, 0x54, 0x43,
+    0x23, 0x12, 0x82, 0xa8, 0xca, 0xbd, 0xbc, 0xbc, 0xab, 0x99, 0x09, 0x22, 0x44, 0x54, 0x33, 0x32,
+    0x12, 0x80, 0xaa, 0xdc, 0xbc, 0xbd, 0xaa, 0x99, 0x08, 0x32, 0x44, 0x44, 0x24, 0x22, 0x12, 0x00,
+    0xa8, 0xca, 0xbc, 0xbd, 0xbb, 0xaa, 0x8a, 0x30, 0x44, 0x44, 0x34, 0x23, 0x11, 0x81, 0xa8, 0xbc,
+    0xbd, 0xbd, 0xbb, 0xba, 0xaa, 0x28, 0x52, 0x53, 0x54, 0x22, 0x22, 0x01, 0x98, 0xbb, 0xcd, 0xcb,
+    0xb8, 0xe2, 0x41, 0x00, 0xab, 0x99, 0x09, 0x21, 0x53, 0x34, 0x45, 0x22, 0x11, 0x22, 0x90, 0xc9,
+    0xcc, 0xbc, 0xac, 0xa9, 0x89, 0x10, 0x43, 0x44, 0x33, 0x34, 0x12, 0x11, 0x98, 0xda, 0xcb, 0xcd,
+    0xba, 0x9a, 0x19, 0x41, 0x44, 0x24, 0x12, 0x01, 0xb9, 0xcc, 0xbc, 0xab, 0x8a, 0x20, 0x52, 0x35,
+    0x33, 0x23, 0x90, 0xca, 0xbd, 0xbc, 0xbb, 0x09, 0x41, 0x44, 0x24, 0x23, 0x12, 0x98, 0xdb, 0xcc,
+    0xab, 0xaa, 0x18, 0x42, 0x44, 0x33, 0x23, 0x00, 0xb9, 0xdc, 0xbc, 0xbb, 0x9a, 0x28, 0x63, 0x53,
+    0x32, 0x21, 0x80, 0xba, 0xcd, 0xbb, 0x9c, 0x89, 0x20, 0x53, 0x34, 0x33, 0x12, 0x98, 0xdb, 0xbd,
+    0xac, 0xaa, 0x18, 0x41, 0x44, 0x33, 0x23, 0x01, 0xb9, 0xcd, 0xbc, 0xab, 0x99, 0x11, 0x53, 0x44,
+    0x33, 0x12, 0x90, 0xc9, 0xbc, 0xad, 0xab, 0x8a, 0x21, 0x63, 0x24, 0x33, 0x12, 0x90, 0xda, 0xcc,
+    0xbb, 0x9b, 0x09, 0x22, 0x45, 0x34, 0x23, 0x01, 0xa8, 0xcc, 0xbc, 0xac, 0x99, 0x08, 0x52, 0x43,
+    0x33, 0x23, 0x01, 0xba, 0xdd, 0xbb, 0xab, 0x9a, 0x20, 0x54, 0x44, 0x22, 0x02, 0x90, 0xca, 0xbc,
+    0xbc, 0xaa, 0x19, 0x42, 0x45, 0x23, 0x02, 0xa8, 0xdc, 0xbb, 0xaa, 0x20, 0x53, 0x35, 0x22, 0x90,
+    0xc9, 0xcc, 0xab, 0x89, 0x31, 0x54, 0x33, 0x11, 0xa8, 0xcc, 0xbc, 0xaa, 0x18, 0x53, 0x34, 0x23,
+    0x01, 0xba, 0xce, 0xab, 0x8a, 0x30, 0x44, 0x33, 0x13, 0x90, 0xdb, 0xcc, 0xaa, 0x88, 0x32, 0x45,
+    0x22, 0x01, 0xa9, 0xbd, 0xac, 0x9a, 0x20, 0x63, 0x43, 0x02, 0x90, 0xc9, 0xbd, 0xaa, 0x08, 0x41,
+    0x44, 0x22, 0x01, 0xa9, 0xcc, 0xcb, 0x8a, 0x18, 0x34, 0x35, 0x13, 0x80, 0xca, 0xbd, 0xab, 0x09,
+    0x31, 0x36, 0x33, 0x02, 0xa0, 0xfb, 0xbb, 0xab, 0x08, 0x53, 0x35, 0x12, 0x81, 0xca, 0xcc, 0x9a,
+    0xf5, 0xcc, 0x45, 0x00, 0x00, 0x42, 0x34, 0x22, 0x81, 0xba, 0xce, 0xab, 0x89, 0x20, 0x45, 0x23,
+    0x02, 0x98, 0xdb, 0xac, 0xab, 0x08, 0x42, 0x35, 0x23, 0x81, 0xb9, 0xcd, 0xab, 0x9a, 0x10, 0x45,
+    0x43, 0x12, 0x88, 0xcb, 0xcb, 0xab, 0x08, 0x31, 0x36, 0x24, 0x01, 0xb9, 0xbe, 0x9c, 0x19, 0x52,
+    0x43, 0x01, 0xa8, 0xbc, 0xab, 0x09, 0x53, 0x24, 0x12, 0xa8, 0xbd, 0xad, 0x09, 0x41, 0x34, 0x12,
+    0x90, 0xcc, 0xbb, 0x0a, 0x41, 0x35, 0x12, 0x90, 0xdb, 0xbb, 0x8a, 0x41, 0x44, 0x12, 0x80, 0xcb,
+    0xbc, 0x9a, 0x30, 0x36, 0x23, 0x81, 0xda, 0xbc, 0x9a, 0x28, 0x63, 0x23, 0x00, 0xb9, 0xcd, 0x9a,
+    0x10, 0x63, 0x23, 0x01, 0xc8, 0xbc, 0xab, 0x19, 0x63, 0x33, 0x02, 0xb8, 0xcd, 0xab, 0x08, 0x53,
+    0x43, 0x11, 0xa8, 0xcc, 0xaa, 0x09, 0x42, 0x34, 0x12, 0x98, 0xcc, 0xac, 0x89, 0x41, 0x34, 0x22,
+    0x98, 0xcc, 0xbb, 0x9a, 0x41, 0x45, 0x12, 0x80, 0xda, 0xbb, 0x99, 0x31, 0x44, 0x23, 0x81, 0xcb,
+    0xbd, 0x9a, 0x20, 0x44, 0x14, 0x81, 0xb9, 0xbd, 0x9b, 0x10, 0x44, 0x24, 0x01, 0xa9, 0xbd, 0xab,
+    0x18, 0x44, 0x24, 0x01, 0xa9, 0xcc, 0xaa, 0x19, 0x43, 0x34, 0x02, 0xa8, 0xcd, 0xab, 0x09, 0x53,
+    0x24, 0x01, 0xc9, 0xac, 0x8a, 0x41, 0x34, 0x02, 0xba, 0xbd, 0x8a, 0x41, 0x34, 0x02, 0xc9, 0xbc,
+    0x9a, 0x40, 0x34, 0x23, 0xa9, 0xcd, 0x9a, 0x28, 0x44, 0x12, 0xa0, 0xcc, 0xab, 0x20, 0x44, 0x23,
+    0x98, 0xcc, 0xaa, 0x28, 0x34, 0x24, 0xa0, 0xbc, 0xac, 0x19, 0x53, 0x33, 0x91, 0xcc, 0xab, 0x19,
+    0x53, 0x24, 0x81, 0xcb, 0xac, 0x0a, 0x42, 0x24, 0x82, 0xc9, 0xcb, 0x8a, 0x42, 0x24, 0x02, 0xca,
+    0xcb, 0x8a, 0x32, 0x26, 0x02, 0xb9, 0xbd, 0x9a, 0x41, 0x34, 0x12, 0xc8, 0xdb, 0x8a, 0x21, 0x44,
+    0xd3, 0x2c, 0x49, 0x00, 0x80, 0xba, 0xad, 0x09, 0x41, 0x43, 0x81, 0xc9, 0xbb, 0x0a, 0x42, 0x25,
+    0x02, 0xba, 0xbd, 0x8a, 0x41, 0x34, 0x03, 0xc9, 0xbc, 0x9b, 0x31, 0x36, 0x12, 0xb8, 0xbd, 0x9b,
+    0x40, 0x34, 0x13, 0xb9, 0xcd, 0x9a, 0x38, 0x63, 0x22, 0x98, 0xcc, 0x9a, 0x28, 0x53, 0x23, 0x98,
+    0xcc, 0xab, 0x18, 0x63, 0x22, 0x91, 0xdb, 0xab, 0x20, 0x35, 0x03, 0xc9, 0xbc, 0x09, 0x52, 0x23,
+    0xa0, 0xcc, 0x9a, 0x40, 0x24, 0x82, 0xda, 0xab, 0x28, 0x44, 0x12, 0xb9, 0xcc, 0x89, 0x42, 0x14,
+    0xa1, 0xcb, 0x8b, 0x30, 0x35, 0x82, 0xca, 0xac, 0x29, 0x34, 0x13, 0xc8, 0xbc, 0x8a, 0x53, 0x14,
+    0x90, 0xdb, 0x9a, 0x21, 0x25, 0x82, 0xca, 0xac, 0x18, 0x43, 0x14, 0xb8, 0xbc, 0x0a, 0x52, 0x14,
+    0x90, 0xbb, 0x9c, 0x30, 0x35, 0x82, 0xca, 0xad, 0x18, 0x43, 0x13, 0xb8, 0xbd, 0x8a, 0x52, 0x33,
+    0xa1, 0xcc, 0x9b, 0x31, 0x35, 0x82, 0xca, 0xbc, 0x18, 0x44, 0x12, 0xb8, 0xbc, 0x8a, 0x52, 0x33,
+    0x91, 0xcc, 0x9c, 0x20, 0x25, 0x02, 0xca, 0xbb, 0x18, 0x44, 0x22, 0xb8, 0xcc, 0x8a, 0x42, 0x33,
+    0xa1, 0xcc, 0x9c, 0x21, 0x34, 0x01, 0xd9, 0xbb, 0x18, 0x63, 0x13, 0xb8, 0xbc, 0x8b, 0x53, 0x33,
+    0xa1, 0xcc, 0xab, 0x40, 0x34, 0x02, 0xca, 0xbc, 0x19, 0x44, 0x12, 0xb8, 0xbd, 0x19, 0x34, 0x13,
+    0xda, 0xac, 0x20, 0x34, 0x92, 0xdb, 0x9a, 0x31, 0x35, 0xa0, 0xbc, 0x0b, 0x52, 0x23, 0xb8, 0xbd,
+    0x1a, 0x35, 0x03, 0xca, 0x9d, 0x28, 0x34, 0x81, 0xdb, 0x9a, 0x31, 0x25, 0x98, 0xbc, 0x09, 0x52,
+    0x13, 0xb9, 0xad, 0x19, 0x34, 0x03, 0xda, 0xbb, 0x20, 0x36, 0x81, 0xcb, 0x9b, 0x40, 0x34, 0xa0,
+    0xbc, 0x8a, 0x53, 0x23, 0xc8, 0xac, 0x19, 0x53, 0x02, 0xc9, 0x9c, 0x28, 0x34, 0x81, 0xdb, 0x9a,
+    0x71, 0xdc, 0x47, 0x00, 0x34, 0x02, 0xda, 0xab, 0x31, 0x25, 0x81, 0xdb, 0x9a, 0x41, 0x33, 0xa0,
+    0xae, 0x0a, 0x42, 0x13, 0xb8, 0xbd, 0x18, 0x34, 0x03, 0xdb, 0x9c, 0x20, 0x34, 0x91, 0xbc, 0x9b,
+    0x52, 0x24, 0xa8, 0xac, 0x1a, 0x52, 0x12, 0xc8, 0xbb, 0x29, 0x35, 0x02, 0xcb, 0xbb, 0x30, 0x36,
+    0x91, 0xdb, 0x9a, 0x41, 0x33, 0xa1, 0xbe, 0x0a, 0x52, 0x13, 0xa8, 0xbd, 0x09, 0x44, 0x12, 0xca,
+    0xbb, 0x48, 0x34, 0x91, 0xcc, 0x09, 0x52, 0x82, 0xca, 0x9a, 0x52, 0x12, 0xc8, 0x9c, 0x30, 0x24,
+    0xa8, 0xbc, 0x18, 0x35, 0x91, 0xbc, 0x8a, 0x44, 0x02, 0xca, 0x9b, 0x41, 0x24, 0xb8, 0xad, 0x20,
+    0x24, 0xa1, 0xcc, 0x19, 0x34, 0x81, 0xdb, 0x0a, 0x42, 0x03, 0xd9, 0x9b, 0x31, 0x24, 0xb8, 0xbc,
+    0x38, 0x44, 0xa1, 0xbc, 0x1a, 0x34, 0x03, 0xfb, 0x8a, 0x41, 0x22, 0xb9, 0x9d, 0x20, 0x24, 0xa0,
+    0xbc, 0x29, 0x44, 0x91, 0xcb, 0x8a, 0x53, 0x03, 0xca, 0xab, 0x41, 0x14, 0xa8, 0xbb, 0x38, 0x35,
+    0xa1, 0xbd, 0x19, 0x63, 0x81, 0xca, 0x8a, 0x42, 0x13, 0xc9, 0xab, 0x30, 0x16, 0xa0, 0xac, 0x28,
+    0x43, 0x91, 0xbc, 0x0a, 0x44, 0x02, 0xcb, 0x9b, 0x62, 0x12, 0xb9, 0xac, 0x30, 0x25, 0xa0, 0xad,
+    0x18, 0x43, 0x92, 0xcc, 0x09, 0x42, 0x02, 0xca, 0x8b, 0x41, 0x23, 0xc8, 0xac, 0x38, 0x25, 0xa0,
+    0xbc, 0x29, 0x35, 0x91, 0xdb, 0x0a, 0x52, 0x02, 0xcb, 0x0b, 0x53, 0x02, 0xdb, 0x0a, 0x43, 0x82,
+    0xbc, 0x0a, 0x34, 0x82, 0xbc, 0x2a, 0x34, 0xa1, 0xcc, 0x28, 0x24, 0xa8, 0x9d, 0x30, 0x14, 0xb9,
+    0x9d, 0x41, 0x13, 0xea, 0x8a, 0x42, 0x03, 0xdb, 0x8a, 0x43, 0x83, 0xdb, 0x8a, 0x34, 0x82, 0xeb,
+    0x09, 0x42, 0x82, 0xbc, 0x09, 0x34, 0x91, 0xcb, 0x19, 0x43, 0x91, 0xbc, 0x18, 0x34, 0xa0, 0xac,
+    0xd6, 0xe5, 0x46, 0x00, 0x33, 0x92, 0xcc, 0x29, 0x43, 0xa1, 0xad, 0x28, 0x25, 0xb8, 0xad, 0x31,
+    0x15, 0xb8, 0x9d, 0x21, 0x14, 0xc8, 0x9b, 0x42, 0x13, 0xdb, 0x0b, 0x63, 0x01, 0xcb, 0x8a, 0x44,
+    0x82, 0xcb, 0x8b, 0x44, 0x02, 0xcb, 0x8a, 0x42, 0x02, 0xc9, 0x9a, 0x32, 0x02, 0xca, 0x19, 0x32,
+    0xb0, 0x9c, 0x41, 0x14, 0xd9, 0x8c, 0x41, 0x13, 0xda, 0x9b, 0x52, 0x03, 0xca, 0x9b, 0x52, 0x12,
+    0xca, 0x8a, 0x42, 0x02, 0xcb, 0x0a, 0x53, 0x81, 0xbc, 0x29, 0x35, 0xb0, 0xad, 0x28, 0x12, 0xaa,
+    0x9b, 0x18, 0x11, 0x81, 0x98, 0x88, 0x12, 0x81, 0x09, 0x11, 0x91, 0x89, 0x61, 0x34, 0x92, 0xbc,
+    0x0a, 0x42, 0x22, 0x02, 0xfa, 0x9c, 0x62, 0x13, 0xc9, 0x9c, 0x30, 0x35, 0xa1, 0xbd, 0x29, 0x35,
+    0x90, 0xac, 0x19, 0x43, 0x02, 0xda, 0x0a, 0x52, 0x02, 0xca, 0x8a, 0x52, 0x12, 0xc8, 0xab, 0x51,
+    0x14, 0xb8, 0x9c, 0x38, 0x34, 0xa0, 0xcc, 0x19, 0x44, 0x81, 0xbb, 0x8a, 0x43, 0x14, 0xc9, 0xac,
+    0x30, 0x35, 0xa8, 0xad, 0x28, 0x24, 0x90, 0xcb, 0x09, 0x52, 0x02, 0xba, 0x8c, 0x41, 0x14, 0xa9,
+    0xac, 0x20, 0x34, 0xa1, 0xbd, 0x29, 0x34, 0x92, 0xbc, 0x0a, 0x53, 0x03, 0xc9, 0x9c, 0x30, 0x15,
+    0xb0, 0xbb, 0x38, 0x36, 0x90, 0xbc, 0x1a, 0x44, 0x81, 0xda, 0x8a, 0x43, 0x02, 0xca, 0x8b, 0x31,
+    0x14, 0xb8, 0xad, 0x20, 0x24, 0xa0, 0xac, 0x18, 0x23, 0x82, 0xb9, 0xac, 0x30, 0x26, 0xb0, 0xbc,
+    0x28, 0x35, 0x92, 0xbc, 0x0a, 0x44, 0x82, 0xcb, 0x0b, 0x52, 0x12, 0xc9, 0x9a, 0x41, 0x22, 0xa9,
+    0xac, 0x30, 0x23, 0xb9, 0xbb, 0x20, 0x23, 0x00, 0xb9, 0x9c, 0x42, 0x91, 0xbc, 0x38, 0xa3, 0xcf,
+    0x29, 0x24, 0xb1, 0xbd, 0x19, 0x56, 0x91, 0xcb, 0x19, 0x34, 0x91, 0xcc, 0x9b, 0x52, 0x33, 0xd9,
+    0x76, 0x02, 0x30, 0x00, 0x29, 0x44, 0x01, 0xdb, 0x9b, 0x42, 0x04, 0xca, 0x8a, 0x32, 0x13, 0x98,
+    0xcc, 0x0a, 0x64, 0x81, 0xcb, 0x09, 0x43, 0x01, 0xda, 0x9a, 0x40, 0x14, 0xb8, 0x9c, 0x21, 0x23,
+    0xa8, 0xbd, 0x19, 0x44, 0x81, 0xca, 0x0a, 0x42, 0x23, 0xea, 0x9b, 0x40, 0x13, 0xb9, 0xaa, 0x18,
+    0x42, 0x13, 0xeb, 0x9b, 0x51, 0x24, 0xa8, 0xbc, 0x2a, 0x37, 0x90, 0xad, 0x19, 0x43, 0x81, 0xba,
+    0x9b, 0x52, 0x14, 0xca, 0xab, 0x31, 0x25, 0xb0, 0xcc, 0x29, 0x34, 0x91, 0xbd, 0x09, 0x24, 0x82,
+    0xca, 0x9b, 0x42, 0x14, 0xb8, 0xbc, 0x30, 0x35, 0x90, 0xbd, 0x19, 0x34, 0x81, 0xcb, 0x0b, 0x63,
+    0x02, 0xc9, 0x8b, 0x31, 0x23, 0xb8, 0xbd, 0x28, 0x35, 0x92, 0xbd, 0x18, 0x42, 0x91, 0xbb, 0x9a,
+    0x52, 0x13, 0xa8, 0xab, 0x28, 0x42, 0x13, 0xfc, 0x9b, 0x41, 0x14, 0xc9, 0x9a, 0x38, 0x33, 0xa0,
+    0xbe, 0x19, 0x35, 0x82, 0xda, 0x9b, 0x51, 0x13, 0xda, 0xab, 0x41, 0x13, 0xa8, 0xcb, 0x29, 0x35,
+    0xa1, 0xbd, 0x28, 0x33, 0x91, 0xba, 0xac, 0x40, 0x35, 0xb8, 0xad, 0x30, 0x15, 0x98, 0xcb, 0x09,
+    0x33, 0x81, 0xcb, 0x19, 0x34, 0x12, 0xc9, 0xac, 0x38, 0x24, 0xc8, 0x9b, 0x40, 0x14, 0x90, 0xca,
+    0x19, 0x13, 0x80, 0x99, 0x43, 0xa0, 0x0c, 0x33, 0x92, 0xcc, 0x1a, 0x53, 0x33, 0xd8, 0xad, 0x40,
+    0x24, 0xb8, 0xaf, 0x28, 0x34, 0x90, 0xcc, 0x19, 0x43, 0x91, 0xcd, 0x0a, 0x32, 0x03, 0xeb, 0x9a,
+    0x42, 0x23, 0xd9, 0xaa, 0x30, 0x14, 0xa0, 0xbb, 0x1a, 0x53, 0x13, 0xea, 0xab, 0x42, 0x24, 0xb9,
+    0xac, 0x28, 0x44, 0x91, 0xbd, 0x1a, 0x35, 0x92, 0xdb, 0x0a, 0x43, 0x02, 0xda, 0x8b, 0x32, 0x14,
+    0xc8, 0xab, 0x31, 0x25, 0xb0, 0xbc, 0x28, 0x34, 0x91, 0xdb, 0x0a, 0x43, 0x02, 0xda, 0x8a, 0x32,
+    0x04, 0x01, 0x25, 0x00, 0x91, 0xcb, 0x0a, 0x43, 0x83, 0xeb, 0x0a, 0x32, 0x13, 0xca, 0x9a, 0x20,
+    0x33, 0xd1, 0xad, 0x30, 0x24, 0xb0, 0xbb, 0x20, 0x32, 0x92, 0xcd, 0x08, 0x42, 0x82, 0xbc, 0x19,
+    0x32, 0x91, 0xca, 0x8a, 0x22, 0x33, 0xf8, 0x8f, 0x22, 0x11, 0xc8, 0x1a, 0x21, 0x31, 0xe9, 0x0a,
+    0x32, 0x02, 0xca, 0xab, 0x18, 0x44, 0x92, 0xbc, 0x20, 0x24, 0x92, 0xba, 0x19, 0x35, 0x90, 0xc9,
+    0xad, 0x08, 0x63, 0xa1, 0x8c, 0x02, 0x30, 0xc8, 0x89, 0xba, 0x55, 0xa0, 0x89, 0x89, 0x14, 0xa9,
+    0x90, 0x08, 0xb8, 0x4a, 0x26, 0xb0, 0x9d, 0x21, 0x21, 0x90, 0x8a, 0x01, 0x13, 0xcb, 0x89, 0xba,
+    0x8f, 0x65, 0xa1, 0x89, 0x90, 0x32, 0xcc, 0x31, 0xb8, 0x23, 0x8a, 0x25, 0xab, 0x24, 0xa9, 0xda,
+    0x9c, 0x22, 0x12, 0xaa, 0xa9, 0x60, 0x35, 0x91, 0xcf, 0x1a, 0x22, 0xa0, 0x2a, 0x14, 0x11, 0xd8,
+    0x9a, 0x9c, 0x63, 0xb8, 0x28, 0x31, 0x16, 0xb9, 0x90, 0x2a, 0x85, 0x0b, 0x03, 0x20, 0xc0, 0x1b,
+    0x12, 0x01, 0xfb, 0x88, 0xeb, 0x9c, 0x51, 0x81, 0x99, 0x22, 0x91, 0x99, 0x28, 0x33, 0xb9, 0xe9,
+    0x1c, 0x14, 0x8c, 0x24, 0x19, 0xa2, 0x9e, 0x90, 0x51, 0xb2, 0x9d, 0x21, 0x03, 0xba, 0xbb, 0x38,
+    0x27, 0x91, 0xda, 0x38, 0x82, 0x31, 0xd0, 0x0b, 0x01, 0x10, 0xa0, 0x3b, 0x57, 0x98, 0xb9, 0x9b,
+    0x23, 0x99, 0x93, 0xcf, 0x31, 0x91, 0x99, 0x49, 0x36, 0xa0, 0xa9, 0x9a, 0x53, 0x81, 0xaa, 0x01,
+    0xc8, 0xab, 0xb9, 0x31, 0xa2, 0x31, 0xfb, 0x29, 0xa8, 0x53, 0xa8, 0x44, 0x91, 0x32, 0xb9, 0xa9,
+    0x3b, 0x37, 0x9a, 0xd9, 0x9a, 0x89, 0x64, 0x91, 0x09, 0xb8, 0x51, 0xc8, 0x19, 0x98, 0x53, 0xb0,
+    0x20, 0xba, 0x63, 0xb8, 0x8a, 0xab, 0x90, 0x3b, 0x27, 0x11, 0x92, 0x00, 0xdc, 0x38, 0xc1, 0x28,
+    0x03, 0x00, 0x04, 0x00, 0x8d, 0x23, 0x28, 0xb3, 0x0f, 0x02, 0x1a, 0xd1, 0x0c, 0x23, 0x22, 0xa2,
+    0xaa, 0xbe, 0x30, 0x92, 0xb0, 0xaf, 0x91, 0x8a, 0x15, 0x0a, 0x14, 0x29, 0x04, 0x9b, 0x92, 0x19,
+    0x15, 0x18, 0xb1, 0x8d, 0x11, 0xd9, 0x0b, 0x43, 0x80, 0xd9, 0x9d, 0x30, 0x13, 0x99, 0x3a, 0x37,
+    0xaa, 0x10, 0xa9, 0x34, 0xb1, 0xca, 0xac, 0x32, 0x90, 0x19, 0x11, 0x33, 0xd2, 0x9b, 0x91, 0x49,
+    0x04, 0x9b, 0xab, 0x51, 0x23, 0x90, 0xbc, 0x19, 0x37, 0xd8, 0x1a, 0x01, 0x20, 0xb9, 0x1b, 0xbb,
+    0x61, 0xb8, 0x41, 0x81, 0x89, 0xaa, 0x22, 0x11, 0xa9, 0x0b, 0x33, 0xb0, 0x2b, 0x37, 0x80, 0x8a,
+    0x80, 0xaa, 0xb9, 0x19, 0xb3, 0x1a, 0xb9, 0x30, 0xb1, 0x39, 0x91, 0x11, 0xcd, 0x20, 0x10, 0x03,
+    0x8c, 0x34, 0x90, 0xa1, 0xbb, 0xa9, 0x30, 0x93, 0x9b, 0x53, 0x03, 0xbb, 0xbb, 0x30, 0x11, 0x01,
+    0xa9, 0x21, 0x33, 0x91, 0x9a, 0xaa, 0x11, 0xb9, 0x19, 0x9a, 0x33, 0x9a, 0x13, 0xaa, 0x12, 0x11,
+    0xb0, 0x9d, 0x23, 0x01, 0x90, 0x09, 0x00, 0x90, 0x10, 0xa9, 0x99, 0x20, 0x33, 0xb0, 0xab, 0x33,
+    0x93, 0x0b, 0x10, 0x21, 0xaa, 0x10, 0x11, 0x91, 0x9b, 0x22, 0x09, 0x91, 0x09, 0x90, 0x19, 0x91,
+    0x09, 0x12, 0x11, 0x99, 0xa9, 0x90, 0x99, 0x09, 0x10, 0x11, 0x99, 0x11, 0x90, 0x19, 0x11, 0x90,
+    0x10, 0x00, 0x99, 0x00, 0x01, 0x00, 0x00, 0x00, 0x91, 0x99, 0x11, 0x11, 0x99, 0x01, 0x11, 0x90,
+    0x09, 0x91, 0x10, 0x90, 0x10, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00,
 };
 
-const size_t sound_low_battery_len = 27586;
-const uint32_t sound_low_battery_sample_rate = 16000;
+const audio_adpcm_clip_t sound_low_battery_adpcm = {
+    .data = sound_low_battery_data,
+    .data_len = sizeof(sound_low_battery_data),
+    .samples = 27586,
+    .sample_rate = 16000,
+    .block_align = 256,
+};
@@ -1,2526 +1,827 @@
 /**
  * @file weee_hahaha_16k.c
- * @brief Embedded audio - "weee" sound
+ * @brief Embedded audio - "weee sound" (IMA-ADPCM)
  *
- * Converted from weee.mp3
+ * Generated by tools/gen_adpcm_asset.py from the 16-bit PCM array in
+ * 37a0295:components/app_mibuddy/weee_hahaha_16k.c (converted from weee.mp3)
  * Sample rate: 16000 Hz
  * Channels: 1 (mono)
- * Bits: 16-bit signed PCM
+ * Format: IMA-ADPCM, 256-byte blocks
  * Duration: ~1.6 seconds
+ * Size: 12710 bytes (16-bit PCM: 50138 bytes)
+ * SNR vs source: 22.0 dB
+ *
+ * Command (in components/audio_play):
+ *   python3 tools/gen_adpcm_asset.py 37a0295:components/app_mibuddy/weee_hahaha_16k.c weee_hahaha_16k \
+ *       --brief 'weee sound' > ../app_mibuddy/weee_hahaha_16k.c
  */
 
 #include <stddef.h>
 #include <stdint.h>
+#include "audio_adpcm.h"
 
-const int16_t weee_hahaha_16k[] = {
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    1, 0, 0, 0, -1, 0, -1, 0, 0, -1,
-    0, 0, 0, 0, 0, -1, -1, 0, 0, 0,
-    0, 1, 0, 1, 0, 0, 0, -1, 0, 0,
-    0, 0, 0, 0, 0, -1, 0, -1, 0, -1,
-    0, 0, 0, 0, -1, 2, 0, 0, -2, 1,
-    0, 0, 0, 2, -1, 3, 14, 3, 8, -1,
-    8, 11, 2, -1, 6, 2, -4, -4, -15, -10,
-    -12, -14, -23, -10, -4, -15, -18, 0, -6, -1,
-    -2, 4, 21, -3, 10, 9, 9, 6, 0, 8,
-    13, 7, 7, 3, 14, 14, 3, 11, 5, 18,
-    0, 3, 5, 4, 0, 11, -7, -3, 0, -19,
-    -6, -22, -9, -20, -12, -12, -18, -14, -2, -14,
-    -6, -3, -1, -1, -10, 10, -4, -11, 6, -8,
-    -3, 8, -9, 13, 3, 16, 6, 17, 21, 9,
-    16, 16, 1, 14, -2, 7, 0, -16, 9, -24,
-    -6, -15, -22, -21, -18, -27, -28, -22, -20, -29,
-    -14, -9, -14, -2, -3, -2, 10, 8, 12, 14,
-    14, 25, 13, 18, 21, 27, 11, 27, 4, 12,
-    20, -3, 2, 0, -4, -19, -20, -15, -26, -38,
-    -31, -44, -31, -46, -36, -41, -27, -11, -28, -3,
-    3, 14, 22, 18, 27, 38, 42, 22, 27, 47,
-    21, 21, 15, 11, 12, -1, -17, -5, -8, -12,
-    -24, -17, -16, -27, -21, -35, -27, -30, -30, -37,
-    -28, -26, -23, -21, -11, -12, -1, 13, 6, 25,
-    29, 28, 42, 38, 42, 37, 44, 39, 15, 31,
-    17, 5, -8, -19, -16, -23, -42, -35, -42, -32,
-    -43, -54, -31, -39, -40, -41, -28, -21, -21, -20,
-    -12, 0, 4, 0, 13, 28, 19, 21, 33, 33,
-    33, 24, 30, 26, 15, 12, -1, 8, -10, -12,
-    -26, -23, -26, -45, -36, -51, -40, -48, -43, -41,
-    -31, -20, -28, -2, 3, 1, 16, 13, 26, 23,
-    29, 31, 37, 35, 36, 37, 31, 31, 17, 22,
-    10, 5, -7, -1, -5, -24, -19, -31, -30, -45,
-    -57, -43, -64, -57, -65, -48, -52, -45, -36, -35,
-    -3, -5, -4, 20, 26, 32, 38, 35, 62, 44,
-    52, 47, 50, 52, 32, 32, 10, 8, -4, -31,
-    -25, -54, -50, -62, -64, -78, -58, -69, -57, -47,
-    -47, -20, -24, 0, 2, 33, 24, 41, 47, 62,
-    57, 55, 53, 49, 48, 21, 18, 31, -17, -3,
-    -32, -26, -48, -62, -39, -76, -42, -83, -50, -51,
-    -42, -55, -33, -5, -21, -14, 6, 20, 12, 30,
-    17, 35, 53, 23, 34, 46, 42, 24, 22, 37,
-    0, 12, -11, -13, -31, -34, -55, -53, -49, -73,
-    -56, -62, -46, -62, -30, -18, -18, -2, 18, 17,
-    50, 30, 44, 78, 51, 55, 41, 64, 33, 23,
-    22, -3, 4, -36, -46, -36, -63, -55, -91, -71,
-    -64, -78, -72, -62, -36, -38, -30, 3, 18, 37,
-    54, 59, 91, 97, 91, 103, 104, 93, 79, 52,
-    57, 17, -12, -44, -44, -91, -131, -131, -144, -141,
-    -176, -146, -122, -106, -91, -58, 10, 31, 61, 83,
-    157, 175, 167, 194, 220, 228, 176, 175, 154, 125,
-    49, 17, -48, -79, -153, -219, -233, -278, -295, -335,
-    -300, -288, -269, -219, -154, -84, -26, 51, 131, 214,
-    271, 355, 389, 437, 452, 419, 441, 344, 297, 188,
-    107, -20, -148, -261, -371, -453, -564, -591, -633, -601,
-    -627, -525, -456, -359, -204, -80, 96, 237, 413, 541,
-    680, 781, 866, 876, 891, 821, 671, 561, 319, 149,
-    -119, -341, -501, -758, -866, -999, -1050, -1038, -1041, -934,
-    -812, -627, -419, -255, 66, 297, 513, 769, 921, 1139,
-    1222, 1298, 1284, 1161, 1057, 815, 461, 225, -78, -382,
-    -655, -962, -1056, -1215, -1290, -1333, -1198, -1028, -983, -716,
-    -467, -175, 125, 349, 634, 929, 1084, 1178, 1310, 1339,
-    1338, 1127, 971, 698, 405, 156, -267, -511, -756, -857,
-    -1210, -1284, -1140, -1189, -1125, -975, -751, -523, -266, -87,
-    200, 563, 782, 824, 1061, 1241, 1265, 1156, 1112, 1068,
-    810, 477, 188, -48, -328, -665, -989, -988, -1137, -1324,
-    -1296, -1088, -1018, -936, -618, -415, -99, 195, 356, 725,
-    1003, 1099, 1211, 1366, 1432, 1224, 1152, 959, 693, 329,
-    -4, -326, -649, -969, -1198, -1344, -1447, -1416, -1471, -1193,
-    -1090, -870, -534, -239, 91, 387, 763, 1004, 1244, 1445,
-    1488, 1612, 1552, 1338, 1203, 918, 543, 91, -233, -580,
-    -1022, -1352, -1406, -1615, -1711, -1606, -1464, -1279, -1068, -716,
-    -434, -6, 363, 611, 1049, 1330, 1453, 1661, 1728, 1711,
-    1575, 1394, 1111, 675, 326, -136, -567, -970, -1309, -1478,
-    -1729, -1807, -1757, -1575, -1472, -1222, -867, -482, -136, 240,
-    661, 1012, 1394, 1474, 1746, 1844, 1840, 1668, 1490, 1342,
-    790, 373, -15, -481, -971, -1354, -1530, -1800, -1906, -1904,
-    -1799, -1519, -1370, -1029, -643, -140, 214, 551, 1032, 1441,
-    1628, 1737, 1998, 1986, 1879, 1646, 1426, 986, 550, 73,
-    -493, -836, -1311, -1628, -1873, -1966, -2012, -1910, -1705, -1483,
-    -1104, -736, -318, 162, 558, 970, 1392, 1656, 1845, 1948,
-    2088, 1903, 1726, 1424, 1018, 564, 74, -428, -957, -1231,
-    -1577, -1877, -1981, -1918, -1852, -1712, -1451, -1059, -717, -248,
-    142, 562, 1044, 1386, 1607, 1819, 1995, 2024, 1864, 1664,
-    1423, 979, 565, 0, -385, -891, -1279, -1542, -1869, -1928,
-    -1918, -1867, -1694, -1508, -1085, -741, -362, 146, 464, 1078,
-    1323, 1609, 1836, 2032, 2126, 1852, 1755, 1519, 1053, 560,
-    70, -356, -854, -1326, -1551, -1894, -1923, -2010, -1895, -1840,
-    -1440, -1123, -843, -318, 102, 700, 910, 1406, 1708, 1990,
-    2026, 2107, 1992, 1819, 1497, 911, 534, 69, -507, -1192,
-    -1337, -1670, -2054, -2130, -2092, -1886, -1734, -1515, -1079, -574,
-    -33, 257, 725, 1387, 1670, 1840, 2044, 2225, 2262, 1973,
-    1635, 1194, 903, 308, -571, -860, -1236, -1671, -2176, -2183,
-    -2193, -2088, -1936, -1777, -1242, -791, -282, 3, 677, 1188,
-    1644, 1821, 2080, 2341, 2354, 2195, 1814, 1546, 1146, 550,
-    -208, -636, -1105, -1507, -2017, -2186, -2217, -2095, -2105, -1915,
-    -1404, -1044, -580, -175, 442, 910, 1425, 1697, 1942, 2272,
-    2359, 2184, 2008, 1760, 1327, 713, 209, -397, -896, -1365,
-    -1810, -2034, -2220, -2168, -2158, -1917, -1602, -1278, -840, -267,
-    135, 683, 1115, 1665, 1859, 2076, 2303, 2250, 2206, 1804,
-    1432, 1054, 480, -240, -770, -1210, -1561, -2150, -2150, -2339,
-    -2171, -2021, -1889, -1391, -1027, -346, -63, 564, 1129, 1573,
-    1973, 2123, 2357, 2477, 2364, 2035, 1538, 1201, 694, -129,
-    -800, -1172, -1577, -2105, -2423, -2446, -2267, -2200, -2101, -1610,
-    -1083, -546, -147, 379, 1097, 1607, 1921, 2095, 2489, 2568,
-    2382, 2062, 1697, 1350, 666, -12, -570, -1074, -1561, -1935,
-    -2224, -2355, -2218, -2112, -1982, -1580, -1160, -632, -154, 280,
-    912, 1361, 1851, 1925, 2260, 2423, 2312, 2078, 1532, 1364,
-    710, 16, -580, -1059, -1402, -1915, -2216, -2296, -2167, -2016,
-    -2040, -1526, -1103, -604, -191, 287, 943, 1429, 1886, 1923,
-    2350, 2529, 2357, 2055, 1624, 1379, 700, -52, -634, -1179,
-    -1353, -2103, -2328, -2346, -2164, -2139, -2123, -1426, -1098, -489,
-    -133, 408, 1109, 1679, 1914, 2082, 2508, 2672, 2326, 1974,
-    1616, 1343, 460, -284, -860, -1254, -1642, -2417, -2433, -2432,
-    -2205, -2283, -1994, -1333, -856, -350, 90, 680, 1493, 1790,
-    2065, 2229, 2636, 2598, 2163, 1898, 1392, 1114, 92, -490,
-    -1132, -1362, -1867, -2468, -2335, -2302, -2110, -2112, -1617, -1146,
-    -623, -52, 280, 879, 1552, 1886, 1945, 2299, 2492, 2359,
-    1996, 1643, 1310, 671, -25, -722, -1218, -1521, -2054, -2466,
-    -2351, -2243, -2122, -1994, -1441, -1012, -361, 80, 439, 1230,
-    1742, 2007, 2060, 2507, 2539, 2353, 1876, 1492, 1175, 356,
-    -354, -1076, -1400, -1699, -2460, -2505, -2400, -2190, -2137, -1802,
-    -1241, -713, 26, 227, 898, 1569, 2055, 2087, 2303, 2601,
-    2467, 2199, 1655, 1279, 751, -22, -752, -1530, -1527, -2156,
-    -2702, -2534, -2408, -2139, -2149, -1449, -1027, -293, 206, 575,
-    1369, 1894, 2228, 2303, 2541, 2681, 2398, 2053, 1422, 1046,
-    388, -457, -1211, -1682, -1834, -2625, -2732, -2615, -2305, -2224,
-    -1818, -1271, -569, 120, 469, 1081, 1860, 2311, 2345, 2615,
-    2757, 2687, 2206, 1719, 1114, 655, -278, -1102, -1786, -1958,
-    -2500, -3046, -2856, -2582, -2314, -2138, -1434, -845, 66, 508,
-    968, 1715, 2473, 2564, 2587, 2890, 2946, 2505, 1914, 1338,
-    822, 91, -872, -1709, -2075, -2271, -3110, -3130, -2870, -2481,
-    -2369, -1796, -1194, -377, 439, 842, 1462, 2314, 2812, 2768,
-    2950, 3093, 2963, 2300, 1712, 1010, 411, -496, -1529, -2159,
-    -2291, -2963, -3357, -3181, -2801, -2586, -2161, -1484, -854, 199,
-    690, 1291, 2103, 2821, 2979, 3056, 3242, 3263, 2698, 2083,
-    1344, 741, -101, -1279, -2029, -2427, -2767, -3600, -3558, -3143,
-    -2872, -2526, -2011, -1114, -101, 609, 1150, 1965, 3007, 3249,
-    3218, 3515, 3584, 3281, 2359, 1699, 1054, 202, -994, -2076,
-    -2438, -2899, -3615, -3941, -3665, -3171, -2900, -2440, -1603, -493,
-    492, 954, 1845, 2864, 3511, 3520, 3647, 3883, 3708, 2863,
-    2015, 1325, 577, -669, -1953, -2397, -2995, -3590, -4175, -3876,
-    -3551, -3145, -2695, -1996, -846, 252, 799, 1643, 2743, 3458,
-    3635, 3747, 4057, 3913, 3312, 2303, 1725, 843, -213, -1669,
-    -2279, -2819, -3486, -4169, -4119, -3769, -3383, -3008, -2467, -1284,
-    -141, 566, 1241, 2456, 3334, 3689, 3722, 4084, 4083, 3712,
-    2584, 1990, 1147, 191, -1348, -2165, -2616, -3407, -4068, -4266,
-    -3911, -3633, -3145, -2796, -1629, -393, 338, 1031, 2258, 3269,
-    3758, 3785, 4238, 4310, 3975, 2909, 2167, 1495, 441, -1113,
-    -2093, -2524, -3320, -4141, -4403, -4074, -3793, -3280, -3011, -1885,
-    -599, 302, 875, 2022, 3211, 3752, 3819, 4156, 4354, 4127,
-    3090, 2303, 1619, 670, -794, -2020, -2370, -3186, -4014, -4440,
-    -4112, -3788, -3484, -3120, -2168, -810, 58, 633, 1798, 3063,
-    3681, 3752, 4152, 4465, 4269, 3236, 2429, 1813, 834, -692,
-    -1913, -2376, -3059, -3983, -4482, -4161, -3776, -3497, -3168, -2225,
-    -841, 132, 605, 1699, 3042, 3749, 3706, 4012, 4504, 4280,
-    3142, 2383, 1802, 899, -778, -1874, -2394, -3016, -3892, -4544,
-    -4072, -3680, -3374, -3229, -2216, -725, 39, 547, 1619, 3075,
-    3702, 3609, 4094, 4507, 4308, 3090, 2487, 1924, 858, -726,
-    -1752, -2218, -3001, -3903, -4368, -4002, -3649, -3467, -3245, -2169,
-    -766, -72, 423, 1731, 2963, 3589, 3513, 4038, 4438, 4116,
-    3043, 2349, 1824, 779, -819, -1781, -2326, -2958, -3860, -4352,
-    -3889, -3547, -3282, -3121, -1987, -582, 86, 641, 1863, 3104,
-    3675, 3565, 4048, 4383, 4040, 2909, 2201, 1695, 578, -1032,
-    -1936, -2376, -3075, -4035, -4322, -3904, -3531, -3320, -3059, -1778,
-    -501, 204, 681, 2052, 3286, 3649, 3626, 4093, 4498, 3847,
-    2729, 2172, 1515, 365, -1270, -1956, -2585, -3240, -4019, -4426,
-    -3851, -3495, -3179, -2940, -1689, -223, 280, 953, 2135, 3442,
-    3830, 3589, 4175, 4339, 3830, 2607, 1862, 1387, 154, -1409,
-    -2189, -2765, -3197, -4203, -4386, -3809, -3295, -3051, -2836, -1270,
-    -44, 523, 1160, 2432, 3621, 3852, 3691, 4213, 4298, 3591,
-    2401, 1680, 1084, -259, -1687, -2449, -2943, -3433, -4290, -4357,
-    -3738, -3196, -2988, -2654, -968, 213, 629, 1484, 2704, 3868,
-    3890, 3887, 4354, 4183, 3546, 2161, 1624, 809, -628, -1838,
-    -2754, -3017, -3745, -4452, -4247, -3779, -3119, -3018, -2374, -695,
-    269, 942, 1607, 3095, 4027, 3903, 4108, 4332, 4254, 3306,
-    2081, 1470, 546, -766, -2116, -2895, -3080, -3868, -4499, -4312,
-    -3543, -3075, -2977, -2131, -474, 473, 1008, 1797, 3235, 4122,
-    3849, 4091, 4319, 4143, 3019, 1855, 1326, 284, -1084, -2322,
-    -2996, -3192, -4092, -4500, -4173, -3400, -2972, -2974, -1646, -175,
-    584, 1180, 2150, 3638, 4097, 3948, 4285, 4353, 4040, 2729,
-    1752, 1179, -141, -1296, -2625, -3109, -3412, -4259, -4455, -4223,
-    -3271, -2975, -2859, -1375, -27, 807, 1373, 2427, 3907, 4070,
-    4141, 4296, 4288, 3927, 2483, 1634, 838, -368, -1597, -2900,
-    -3125, -3684, -4419, -4464, -4072, -3184, -3052, -2559, -951, 260,
-    1014, 1614, 2981, 4213, 4070, 4323, 4424, 4340, 3582, 2152,
-    1469, 414, -773, -2133, -3276, -3346, -4129, -4710, -4590, -3898,
-    -3127, -3188, -2103, -444, 582, 1244, 2113, 3658, 4418, 4283,
-    4563, 4526, 4245, 3197, 1795, 1124, -160, -1296, -2723, -3512,
-    -3610, -4511, -4638, -4412, -3570, -2981, -2817, -1304, 72, 970,
-    1702, 2718, 4189, 4396, 4397, 4640, 4321, 3896, 2515, 1497,
-    578, -816, -1746, -3361, -3589, -4005, -4749, -4641, -4322, -3183,
-    -3117, -2368, -673, 481, 1416, 2071, 3474, 4487, 4408, 4658,
-    4488, 4256, 3448, 1942, 1139, -205, -1095, -2578, -3650, -3629,
-    -4381, -4659, -4668, -3644, -2985, -2867, -1488, -10, 1024, 1826,
-    2637, 4147, 4450, 4592, 4592, 4312, 3961, 2628, 1558, 361,
-    -663, -1812, -3311, -3747, -3974, -4619, -4703, -4259, -3148, -2960,
-    -2266, -739, 580, 1471, 2148, 3383, 4414, 4550, 4660, 4427,
-    4201, 3489, 2014, 991, -288, -996, -2680, -3740, -3794, -4311,
-    -4791, -4718, -3662, -2988, -2851, -1514, -23, 1042, 1884, 2687,
-    4166, 4555, 4758, 4643, 4366, 4080, 2740, 1484, 346, -689,
-    -1836, -3469, -3813, -4170, -4704, -4901, -4483, -3256, -3031, -2332,
-    -761, 710, 1663, 2353, 3652, 4721, 4818, 4942, 4559, 4358,
-    3557, 2039, 845, -340, -1228, -2976, -4026, -4016, -4704, -5092,
-    -4845, -3843, -3070, -2871, -1294, 200, 1432, 2130, 3155, 4524,
-    4928, 4937, 4759, 4497, 3928, 2560, 1116, 44, -1127, -2334,
-    -3940, -4142, -4497, -4968, -5100, -4256, -3124, -2998, -1912, -180,
-    1168, 1857, 2844, 4182, 4931, 4927, 4921, 4552, 4224, 3104,
-    1510, 411, -639, -1799, -3567, -4149, -4201, -4849, -5109, -4699,
-    -3406, -2842, -2448, -963, 803, 1812, 2326, 3493, 4792, 5028,
-    4774, 4602, 4324, 3644, 2079, 703, -346, -1258, -2796, -4204,
-    -4194, -4397, -5011, -5029, -3890, -2848, -2644, -1590, 189, 1499,
-    2263, 2940, 4272, 5085, 4899, 4716, 4318, 4074, 2753, 1167,
-    120, -964, -2049, -3803, -4352, -4291, -4863, -5107, -4554, -3202,
-    -2645, -2349, -490, 999, 2015, 2574, 3670, 5058, 4978, 4945,
-    4416, 4328, 3499, 1741, 501, -653, -1428, -3172, -4419, -4218,
-    -4636, -5020, -5004, -3744, -2756, -2628, -1167, 361, 1813, 2379,
-    3313, 4680, 5112, 5096, 4706, 4418, 3954, 2427, 973, -242,
-    -1160, -2495, -4284, -4361, -4596, -5015, -5346, -4387, -2976, -2763,
-    -1952, -184, 1456, 2360, 2853, 4268, 5292, 5328, 5008, 4358,
-    4439, 3182, 1428, -19, -922, -1815, -3993, -4686, -4503, -4981,
-    -5294, -5039, -3312, -2718, -2331, -628, 1001, 2382, 2687, 3857,
-    5222, 5355, 5192, 4529, 4428, 3797, 1761, 403, -767, -1446,
-    -3423, -4872, -4416, -4826, -5279, -5325, -3845, -2673, -2642, -1333,
-    532, 1958, 2685, 3231, 4872, 5449, 5302, 4753, 4371, 4300,
-    2473, 820, -351, -1114, -2593, -4507, -4604, -4552, -5143, -5404,
-    -4556, -2980, -2619, -2052, -180, 1568, 2520, 2931, 4302, 5407,
-    5403, 4918, 4433, 4269, 3099, 1231, -183, -959, -2060, -3988,
-    -4759, -4370, -4793, -5379, -4819, -3164, -2516, -2334, -725, 1204,
-    2376, 2703, 3718, 5122, 5525, 5065, 4351, 4377, 3689, 1796,
-    154, -749, -1470, -3413, -4690, -4526, -4678, -5221, -5300, -3751,
-    -2678, -2631, -1332, 526, 2110, 2442, 3301, 4878, 5431, 5365,
-    4556, 4606, 4204, 2449, 781, -422, -976, -2808, -4564, -4481,
-    -4710, -5095, -5579, -4400, -2860, -2868, -1861, -239, 1797, 2419,
-    2785, 4559, 5399, 5611, 4747, 4565, 4594, 2999, 1284, -308,
-    -812, -2185, -4399, -4755, -4643, -4952, -5542, -4944, -3022, -2786,
-    -2093, -535, 1329, 2589, 2798, 4163, 5277, 5697, 5119, 4371,
-    4508, 3504, 1498, -57, -921, -1711, -3920, -4858, -4588, -4803,
-    -5256, -5297, -3487, -2509, -2387, -1038, 897, 2500, 2703, 3555,
-    5098, 5515, 5284, 4411, 4313, 3895, 2076, 258, -871, -1330,
-    -3133, -4826, -4556, -4612, -5057, -5352, -4033, -2547, -2526, -1319,
-    242, 2075, 2756, 3083, 4668, 5347, 5482, 4497, 4250, 4177,
-    2595, 819, -536, -1020, -2381, -4440, -4596, -4494, -4860, -5369,
-    -4644, -2749, -2668, -1917, -330, 1588, 2548, 2843, 4204, 5163,
-    5537, 4886, 4167, 4313, 3244, 1351, -255, -908, -1704, -3871,
-    -4673, -4439, -4593, -5160, -4994, -3312, -2447, -2232, -903, 922,
-    2425, 2708, 3566, 4890, 5372, 5086, 4290, 4046, 3750, 1938,
-    152, -759, -1367, -2980, -4733, -4335, -4403, -4977, -5165, -3788,
-    -2440, -2468, -1441, 533, 1970, 2705, 3186, 4508, 5431, 5238,
-    4519, 3963, 4083, 2484, 537, -688, -1102, -2464, -4488, -4535,
-    -4375, -4868, -5264, -4372, -2781, -2634, -1799, -139, 1604, 2543,
-    2960, 4323, 5098, 5619, 4752, 4161, 4230, 3116, 1062, -398,
-    -889, -2006, -4129, -4680, -4393, -4853, -5228, -4853, -2986, -2644,
-    -2012, -537, 1324, 2588, 2865, 4078, 5092, 5633, 5029, 4140,
-    4211, 3464, 1451, -320, -1023, -1686, -3954, -4901, -4557, -4760,
-    -5171, -5186, -3349, -2542, -2186, -741, 906, 2693, 2842, 3999,
-    4974, 5713, 5370, 4250, 4273, 3545, 1874, -215, -938, -1664,
-    -3458, -4920, -4502, -4758, -5024, -5234, -3646, -2544, -2311, -992,
-    496, 2422, 2723, 3735, 4689, 5472, 5494, 4382, 4009, 3803,
-    2249, 290, -977, -1198, -2872, -4634, -4467, -4518, -4752, -5299,
-    -3984, -2608, -2478, -1316, 155, 2047, 2825, 3227, 4713, 5197,
-    5596, 4567, 3990, 4089, 2487, 760, -872, -1067, -2476, -4628,
-    -4518, -4532, -4848, -5304, -4507, -2616, -2624, -1557, -141, 1696,
-    2857, 2968, 4375, 5060, 5697, 4706, 3935, 4068, 3038, 1004,
-    -547, -1069, -1866, -4010, -4717, -4232, -4596, -4939, -4851, -2920,
-    -2407, -1974, -673, 1099, 2561, 2807, 3721, 4787, 5515, 4991,
-    3937, 3965, 3629, 1588, -226, -917, -1431, -3547, -4668, -4292,
-    -4558, -4963, -5004, -3362, -2593, -2249, -922, 714, 2416, 2718,
-    3719, 4789, 5544, 5327, 4104, 4124, 3639, 1998, -108, -1004,
-    -1254, -3244, -4696, -4420, -4515, -4855, -5286, -3581, -2573, -2404,
-    -986, 414, 2385, 2618, 3608, 4635, 5311, 5453, 4066, 4080,
-    3734, 2288, 212, -1005, -992, -2926, -4675, -4414, -4377, -4707,
-    -5294, -3859, -2458, -2390, -1263, 85, 2136, 2684, 3167, 4391,
-    5132, 5554, 4237, 3957, 3876, 2624, 591, -948, -1006, -2437,
-    -4376, -4565, -4317, -4521, -5186, -4340, -2545, -2412, -1495, -332,
-    1720, 2725, 2925, 4106, 4952, 5579, 4525, 3843, 3940, 2934,
-    1052, -654, -1117, -1891, -4112, -4435, -4469, -4488, -5015, -4625,
-    -2727, -2584, -1737, -464, 1367, 2586, 2780, 4015, 4901, 5508,
-    4813, 3883, 4211, 3303, 1467, -365, -861, -1553, -3807, -4511,
-    -4233, -4514, -5062, -4947, -2991, -2720, -2314, -747, 814, 2384,
-    2339, 3744, 4663, 5296, 4887, 3906, 4238, 3480, 1767, -28,
-    -570, -1244, -3362, -4488, -4013, -4365, -4954, -5117, -3304, -2522,
-    -2443, -1221, 492, 2263, 2328, 3367, 4511, 5403, 5044, 4233,
-    4210, 3894, 2335, 307, -424, -1032, -2738, -4457, -4231, -4196,
-    -4834, -5311, -3964, -2597, -2584, -1720, -39, 1873, 2382, 2985,
-    4197, 5222, 5334, 4391, 4154, 4119, 2887, 863, -374, -768,
-    -2182, -4154, -4313, -4096, -4738, -5227, -4293, -2761, -2738, -1949,
-    -413, 1369, 2357, 2600, 4014, 4915, 5445, 4433, 4016, 4253,
-    3051, 1235, -291, -573, -1776, -3878, -4351, -4160, -4614, -5135,
-    -4835, -2913, -2818, -2139, -770, 1043, 2401, 2432, 4011, 4693,
-    5461, 4837, 4094, 4274, 3318, 1737, -63, -735, -1311, -3661,
-    -4307, -4195, -4445, -5034, -5024, -2930, -2827, -2204, -935, 765,
-    2253, 2402, 3639, 4500, 5343, 4950, 3931, 4247, 3503, 1922,
-    130, -613, -1185, -3243, -4242, -4081, -4231, -4751, -5002, -3393,
-    -2540, -2370, -1370, 206, 2026, 2276, 3006, 4241, 5008, 4936,
-    3934, 3977, 3728, 2234, 615, -489, -741, -2544, -3947, -3904,
-    -3934, -4462, -4814, -3736, -2510, -2451, -1572, -131, 1545, 2305,
-    2604, 4080, 4721, 5093, 4051, 3983, 3922, 2666, 847, -338,
-    -723, -2066, -3968, -4179, -3921, -4589, -4994, -4373, -2695, -2771,
-    -1961, -575, 1212, 2240, 2555, 3795, 4748, 5356, 4432, 3928,
-    4115, 3190, 1325, -229, -558, -1591, -3588, -4168, -3968, -4277,
-    -4892, -4537, -2955, -2632, -2091, -877, 958, 2215, 2342, 3732,
-    4500, 5304, 4537, 3953, 4049, 3190, 1773, -218, -663, -1381,
-    -3294, -4326, -4141, -4181, -4708, -4885, -3113, -2623, -2114, -1031,
-    616, 2198, 2291, 3562, 4279, 5151, 4744, 3933, 3977, 3398,
-    1985, 186, -691, -1071, -2937, -4182, -4023, -4144, -4570, -4930,
-    -3283, -2563, -2409, -1208, 307, 1912, 2187, 3163, 4206, 4827,
-    4861, 3853, 3867, 3512, 2256, 484, -524, -867, -2500, -4074,
-    -3911, -4077, -4529, -4857, -3589, -2462, -2560, -1307, 71, 1853,
-    2160, 2878, 4152, 4792, 4842, 3986, 3873, 3764, 2427, 750,
-    -467, -789, -2102, -4093, -3961, -4077, -4318, -5000, -4106, -2455,
-    -2660, -1706, -481, 1567, 2236, 2387, 3989, 4698, 5263, 4117,
-    3905, 4184, 2851, 1170, -356, -533, -1630, -3798, -4057, -3950,
-    -4178, -4962, -4635, -2621, -2719, -2125, -870, 1071, 2172, 2180,
-    3580, 4526, 5041, 4351, 3763, 4012, 3225, 1540, 64, -511,
-    -1013, -3267, -4117, -3825, -4100, -4814, -4888, -3023, -2557, -2318,
-    -1155, 680, 2142, 2218, 3157, 4452, 5020, 4613, 3682, 4017,
-    3446, 1863, 47, -603, -895, -3015, -4108, -3991, -3791, -4537,
-    -4947, -3365, -2327, -2378, -1415, 256, 2197, 2252, 2912, 4352,
-    5027, 4976, 3646, 4042, 3659, 2087, 335, -734, -824, -2696,
-    -4174, -3980, -4086, -4323, -5091, -3617, -2392, -2560, -1362, -170,
-    2012, 2177, 2791, 4184, 4902, 5132, 3877, 3971, 3966, 2524,
-    716, -604, -632, -2176, -4207, -3996, -4116, -4245, -5198, -3950,
-    -2517, -2652, -1593, -386, 1696, 2186, 2691, 4044, 4761, 5128,
-    4083, 3801, 3946, 2530, 943, -670, -696, -2017, -4101, -4041,
-    -4176, -4206, -5228, -4140, -2499, -2696, -1615, -460, 1721, 2264,
-    2596, 4152, 4627, 5233, 4121, 3940, 3890, 2648, 1208, -524,
-    -678, -1820, -3933, -3903, -4087, -4196, -5037, -4216, -2393, -2794,
-    -1745, -626, 1502, 2115, 2382, 3884, 4575, 5080, 4313, 3594,
-    3984, 2865, 1245, -475, -820, -1417, -3952, -3985, -4093, -4026,
-    -4865, -4441, -2339, -2527, -1911, -464, 1199, 2358, 2187, 3809,
-    4507, 4949, 4410, 3471, 4120, 2734, 1531, -412, -789, -1295,
-    -3654, -4093, -4000, -3937, -4745, -4665, -2426, -2530, -2062, -755,
-    1005, 2369, 1960, 3704, 4352, 4927, 4359, 3591, 3996, 2862,
-    1736, -245, -767, -1059, -3446, -3894, -3924, -3855, -4614, -4678,
-    -2561, -2615, -2174, -938, 841, 2107, 1893, 3498, 4319, 4804,
-    4535, 3529, 4096, 3062, 1875, -83, -490, -840, -3244, -3823,
-    -3895, -3739, -4701, -4756, -2753, -2554, -2365, -1137, 609, 1979,
-    1821, 3335, 4143, 4958, 4558, 3605, 4149, 3208, 2055, 23,
-    -561, -893, -3090, -4028, -3922, -3959, -4570, -4904, -2841, -2564,
-    -2353, -939, 464, 2134, 1964, 3379, 4323, 4867, 4632, 3729,
-    3991, 3278, 1923, 192, -726, -994, -3033, -4141, -3801, -4240,
-    -4505, -4916, -3005, -2635, -2515, -950, 424, 2065, 1963, 3423,
-    4446, 4834, 4698, 3761, 4075, 3303, 1891, 282, -748, -856,
-    -3063, -4014, -3823, -4131, -4505, -4979, -2985, -2536, -2442, -1005,
-    504, 2176, 2082, 3215, 4395, 4762, 4798, 3632, 3940, 3525,
-    2032, 282, -743, -726, -2819, -4118, -3955, -4092, -4489, -5051,
-    -3157, -2511, -2446, -1102, 305, 2063, 2029, 3189, 4222, 4849,
-    4749, 3763, 3935, 3524, 2093, 329, -609, -728, -2623, -4152,
-    -3781, -3975, -4368, -5065, -3219, -2399, -2603, -1385, 241, 2004,
-    1937, 2890, 4245, 4869, 4750, 3750, 3910, 3624, 2251, 398,
-    -747, -652, -2544, -4085, -4088, -3974, -4328, -5047, -3376, -2609,
-    -2509, -1285, 173, 1898, 1876, 3194, 4236, 4788, 4940, 3898,
-    4096, 3636, 2428, 527, -547, -625, -2486, -4045, -3887, -4066,
-    -4375, -5138, -3280, -2676, -2752, -1192, 46, 1802, 1784, 3133,
-    4201, 4847, 4833, 3867, 3969, 3577, 2270, 396, -709, -678,
-    -2563, -3806, -3796, -4037, -4241, -4963, -3079, -2858, -2535, -1205,
-    57, 1749, 1621, 3225, 4091, 4728, 4709, 3786, 4301, 3408,
-    2299, 409, -456, -659, -2788, -3755, -3704, -3899, -4431, -5058,
-    -2838, -2775, -2630, -1192, 192, 2052, 1439, 3286, 4006, 4776,
-    4417, 3608, 4085, 3368, 2048, 223, -469, -461, -2827, -3822,
-    -3425, -3906, -4239, -5109, -2518, -2976, -2437, -1277, 394, 1909,
-    1522, 3363, 4100, 4985, 4426, 3772, 4103, 3537, 1942, 109,
-    -504, -503, -3077, -3654, -3885, -3806, -4582, -4779, -2614, -3182,
-    -2090, -1220, 817, 1594, 1747, 3639, 4012, 4917, 4188, 3876,
-    4033, 3074, 1915, -112, -268, -917, -3187, -3517, -3807, -3768,
-    -4613, -4420, -2449, -3194, -2009, -1053, 926, 1705, 1844, 3928,
-    4067, 4992, 4035, 3950, 3978, 2820, 1578, -160, -399, -1512,
-    -3490, -3454, -4048, -3927, -4732, -4077, -2435, -3196, -1756, -866,
-    1185, 1486, 2094, 3868, 4266, 4937, 3988, 4055, 4079, 2794,
-    1540, -245, -315, -1563, -3479, -3344, -4136, -3868, -5042, -3630,
-    -2531, -3360, -1519, -479, 1485, 1315, 2416, 4186, 4258, 4707,
-    3747, 4136, 3737, 2371, 1187, -671, -268, -1922, -3513, -3314,
-    -3981, -3623, -4962, -3109, -2657, -2892, -1358, -351, 1716, 1188,
-    2766, 4092, 4417, 4574, 3556, 4107, 3319, 2025, 511, -689,
-    -356, -2641, -3418, -3584, -3920, -3924, -4831, -2651, -2976, -2499,
-    -1002, 269, 1881, 1266, 3535, 4001, 4549, 4344, 3349, 4169,
-    2804, 2030, -40, -495, -677, -3088, -3140, -3761, -3589, -4167,
-    -4373, -2142, -3191, -2010, -870, 831, 1693, 1474, 3811, 3967,
-    4655, 3755, 3514, 3874, 2407, 1444, -221, -473, -1250, -3272,
-    -2921, -3877, -3673, -4466, -3705, -2265, -3265, -1496, -621, 1350,
-    1274, 2074, 3932, 4019, 4549, 3448, 3967, 3763, 2297, 1204,
-    -396, -77, -1811, -3378, -3002, -3880, -3615, -4804, -3086, -2459,
-    -3239, -1150, -416, 1607, 1088, 2533, 4038, 4011, 4538, 3220,
-    3976, 3354, 2090, 599, -728, -258, -2517, -3437, -3343, -3932,
-    -3710, -4721, -2281, -2783, -2534, -753, 332, 1842, 1145, 3324,
-    4087, 4270, 4070, 3149, 4062, 2837, 1645, 194, -576, -509,
-    -3326, -2923, -3610, -3595, -4168, -4164, -1990, -3189, -1927, -605,
-    931, 1509, 1533, 3794, 3994, 4226, 3597, 3332, 3963, 2106,
-    1303, -368, -280, -1481, -3377, -2740, -3813, -3601, -4499, -3182,
-    -2173, -3317, -1225, -338, 1470, 1195, 2325, 4109, 4049, 4355,
-    3115, 3906, 3364, 1982, 382, -478, -416, -2294, -3356, -3034,
-    -3639, -3759, -4214, -2292, -2556, -2610, -797, 420, 1561, 1162,
-    3069, 3832, 4153, 3640, 3166, 3551, 2771, 1324, -44, -519,
-    -824, -2851, -3032, -3326, -3571, -3987, -3525, -1990, -2892, -1699,
-    -267, 1189, 1221, 1801, 3477, 3918, 3863, 3204, 3310, 3446,
-    2093, 627, -400, -194, -1693, -3219, -2865, -3261, -3488, -4277,
-    -2395, -2215, -2638, -1109, 417, 1521, 1117, 2654, 3759, 4010,
-    3591, 3010, 3443, 2768, 1440, -104, -430, -676, -2653, -3168,
-    -3186, -3293, -3900, -3567, -2083, -2582, -1774, -421, 1028, 1379,
-    1826, 3450, 3800, 4183, 3264, 3127, 3278, 2238, 775, -785,
-    -353, -1672, -3084, -3253, -3345, -3409, -4024, -2640, -2390, -2199,
-    -1035, 420, 1289, 1589, 2958, 3589, 4009, 3777, 3258, 3115,
-    2532, 1565, -363, -764, -1101, -2587, -3170, -3560, -3241, -3932,
-    -3341, -2179, -2496, -1468, -377, 1267, 1341, 1978, 3549, 3618,
-    4160, 3132, 3215, 2922, 2090, 650, -859, -515, -1616, -2896,
-    -3178, -3158, -3197, -3848, -2537, -2146, -2233, -962, 219, 1485,
-    1078, 2768, 3392, 3744, 3658, 2864, 3150, 2333, 1609, -280,
-    -828, -632, -2383, -2843, -3343, -3021, -3543, -3372, -1769, -2559,
-    -1288, -241, 1357, 1402, 1825, 3568, 3384, 3819, 3072, 2814,
-    2555, 1765, 588, -1039, -742, -1609, -2848, -3158, -3258, -3084,
-    -3553, -2222, -2175, -1926, -460, 615, 1450, 1362, 3015, 3435,
-    3581, 3477, 2796, 2765, 2112, 1248, -637, -871, -1069, -2618,
-    -3214, -3119, -2941, -3654, -2934, -1754, -2144, -1258, 129, 1362,
-    1480, 2230, 3561, 3584, 3676, 3199, 2757, 2438, 1641, 186,
-    -1139, -1057, -1967, -3076, -3232, -3184, -3273, -3253, -2001, -2072,
-    -1572, -182, 1238, 1417, 1960, 3304, 3598, 3505, 3252, 2917,
-    2111, 1843, 606, -1006, -1341, -1636, -2825, -3503, -3247, -3056,
-    -3604, -2403, -1669, -1724, -715, 865, 1990, 1487, 2953, 3825,
-    3789, 3498, 3027, 2815, 1827, 1348, -510, -1383, -1497, -2481,
-    -3095, -3726, -3140, -3528, -3151, -1715, -2027, -1093, 121, 1819,
-    1831, 2031, 3903, 3702, 3865, 2945, 2805, 2184, 1223, 327,
-    -1763, -1490, -2206, -3089, -3637, -3636, -2992, -3471, -2020, -1665,
-    -1455, 156, 1397, 2352, 1998, 3629, 4203, 3784, 3452, 2682,
-    2395, 1228, 492, -1220, -2007, -2165, -2881, -3558, -3748, -3258,
-    -3201, -2415, -1632, -1493, -360, 1236, 2193, 1987, 3185, 4223,
-    3877, 3558, 2840, 2685, 1439, 854, -934, -1832, -2019, -3026,
-    -3292, -4095, -3182, -3546, -2902, -1525, -1573, -587, 576, 2437,
-    2180, 2553, 4295, 4053, 3943, 2742, 2819, 2036, 701, -242,
-    -2027, -1842, -2982, -3343, -3833, -3750, -3041, -3317, -1744, -1521,
-    -855, 445, 1778, 2629, 2407, 4158, 4256, 3986, 3336, 2767,
-    2302, 838, -80, -1739, -2348, -2803, -3447, -3992, -3962, -3514,
-    -3342, -2227, -1465, -1107, 189, 1717, 2824, 2520, 3878, 4568,
-    4402, 3428, 3059, 2737, 1139, 275, -1501, -2007, -2970, -3339,
-    -3864, -4133, -3600, -3583, -2371, -1657, -1378, -114, 1322, 2755,
-    2404, 3557, 4583, 4401, 3804, 2795, 3023, 1338, 380, -1361,
-    -2051, -2527, -3650, -3708, -4250, -3646, -3723, -2764, -1669, -1477,
-    -251, 1097, 2590, 2901, 3176, 4703, 4469, 4200, 3143, 2800,
-    2065, 456, -894, -2283, -2398, -3447, -3983, -4418, -3933, -3589,
-    -3142, -2029, -1376, -528, 1037, 2186, 2994, 3354, 4528, 4889,
-    4236, 3524, 2785, 2066, 673, -972, -2069, -2678, -3377, -3843,
-    -4408, -3976, -3862, -2921, -2142, -1533, -532, 1033, 2410, 2785,
-    3349, 4552, 4806, 4254, 3280, 3149, 2165, 914, -1003, -1974,
-    -2565, -3564, -3891, -4729, -3896, -4142, -3164, -2139, -1616, -532,
-    784, 2461, 2954, 3329, 4775, 4844, 4803, 3368, 3342, 2258,
-    989, -567, -2367, -2278, -3587, -3767, -4787, -4038, -3975, -3564,
-    -2189, -1846, -691, 596, 2204, 3121, 3139, 4699, 4901, 4809,
-    3544, 3094, 2681, 917, -423, -2150, -2626, -3491, -4127, -4782,
-    -4578, -4187, -3398, -2407, -1700, -784, 899, 2278, 3006, 3441,
-    4677, 5078, 4785, 3773, 3399, 2576, 1314, -380, -1979, -2507,
-    -3509, -3885, -4927, -4424, -4293, -3328, -2539, -1771, -608, 662,
-    2407, 2887, 3515, 4503, 5035, 4766, 3432, 3167, 2333, 1186,
-    -696, -2029, -2531, -3572, -3921, -4855, -4222, -4262, -3167, -2398,
-    -1695, -580, 654, 2384, 2794, 3481, 4523, 5061, 4835, 3568,
-    3310, 2547, 1300, -525, -2069, -2424, -3539, -4062, -4893, -4413,
-    -4168, -3461, -2452, -1644, -763, 673, 2380, 2913, 3496, 4479,
-    5260, 4736, 3601, 3173, 2405, 1349, -983, -1924, -2723, -3339,
-    -4099, -4933, -4193, -4253, -3086, -2602, -1445, -550, 784, 2509,
-    2824, 3611, 4475, 5079, 4687, 3412, 3412, 2082, 1292, -979,
-    -2078, -2828, -3636, -3720, -5003, -4151, -4042, -2818, -2316, -1653,
-    -131, 967, 2488, 2827, 3553, 4691, 4627, 4517, 3139, 3179,
-    1913, 886, -969, -1972, -2781, -3462, -3761, -4608, -4100, -4074,
-    -2702, -2363, -1529, -389, 1063, 2459, 2858, 3544, 4667, 4780,
-    4498, 3193, 3076, 2031, 681, -1179, -2158, -2800, -3501, -4180,
-    -4547, -4146, -3865, -2825, -2254, -1289, -273, 1246, 2476, 3138,
-    3688, 4789, 4730, 4416, 3308, 2998, 2066, 394, -1128, -2297,
-    -2935, -3501, -4410, -4394, -4371, -3530, -2713, -2250, -1032, -198,
-    1691, 2278, 3150, 3897, 4646, 4748, 3789, 3580, 2826, 1954,
-    73, -1219, -2068, -3335, -3640, -4631, -4256, -4557, -3541, -2527,
-    -2120, -946, 77, 1962, 2519, 3207, 4305, 4884, 4781, 3828,
-    3373, 2729, 1550, -314, -1574, -2382, -3090, -3914, -4678, -4319,
-    -4347, -3381, -2849, -1778, -743, 446, 2146, 2759, 3765, 4356,
-    4960, 4733, 3763, 3317, 2281, 1371, -859, -1840, -2890, -3348,
-    -4095, -4883, -4266, -4224, -2903, -2577, -1497, -259, 1107, 2508,
-    2983, 4086, 4806, 4964, 4342, 3516, 3010, 1870, 302, -1224,
-    -2122, -3222, -3609, -4423, -4381, -4450, -3805, -2702, -2247, -1138,
-    50, 1757, 2523, 3232, 4161, 4916, 4788, 3947, 3455, 2585,
-    1590, -258, -1487, -2533, -3519, -3710, -4882, -4205, -4410, -3210,
-    -2455, -1806, -144, 507, 2413, 2747, 3502, 4436, 4648, 4659,
-    3377, 3267, 2437, 1022, -755, -1909, -2556, -3560, -4085, -4593,
-    -4223, -4099, -3013, -2517, -1499, -499, 1049, 2398, 2816, 3872,
-    4692, 5064, 4301, 3630, 2977, 2037, 363, -1302, -2212, -3301,
-    -3565, -4468, -4460, -4217, -3600, -2498, -2280, -767, 294, 1829,
-    2611, 3256, 4454, 4717, 4637, 3769, 3147, 2414, 1107, -451,
-    -1730, -2608, -3211, -3787, -4384, -4220, -4165, -2950, -2366, -1830,
-    -498, 705, 2208, 2581, 3568, 4474, 4708, 4340, 3537, 3123,
-    2080, 661, -920, -1939, -2809, -3349, -4240, -4369, -4334, -3890,
-    -2672, -2401, -1062, -38, 1586, 2646, 3136, 4199, 4689, 4850,
-    3857, 3222, 2482, 1391, -305, -1674, -2609, -3304, -3691, -4404,
-    -4232, -4187, -2915, -2416, -1861, -312, 726, 2260, 2608, 3620,
-    4628, 4555, 4563, 3520, 3102, 1869, 572, -928, -2302, -3052,
-    -3565, -3883, -4301, -4190, -3481, -2551, -2259, -1060, 71, 1458,
-    2266, 3043, 4024, 4586, 4412, 3994, 3156, 2555, 1404, -299,
-    -1458, -2816, -2922, -3717, -4373, -4093, -3956, -2725, -2642, -1689,
-    -385, 712, 2090, 2505, 3702, 4210, 4650, 4265, 3431, 2956,
-    1986, 389, -774, -2102, -2846, -3236, -4275, -4101, -4235, -3347,
-    -2397, -2250, -829, 221, 1773, 2345, 3048, 4004, 4303, 4236,
-    3488, 2899, 2123, 809, -621, -1616, -2986, -2862, -3701, -3940,
-    -3948, -3507, -2165, -2387, -1176, -91, 1202, 2151, 2496, 3640,
-    3974, 4057, 3684, 3059, 2464, 1710, 99, -971, -2127, -2679,
-    -3223, -4162, -3647, -3754, -2696, -2470, -1565, -418, 279, 1783,
-    2114, 3122, 3719, 4126, 3959, 3107, 2754, 2046, 562, -797,
-    -1893, -2701, -2906, -3764, -3689, -3861, -2931, -2158, -1994, -931,
-    127, 1517, 1807, 2731, 3731, 4130, 3716, 3303, 3025, 2098,
-    781, -591, -1254, -2523, -2822, -3449, -3670, -3647, -3483, -2246,
-    -2301, -1010, -247, 1012, 2066, 2520, 3522, 3903, 3881, 3469,
-    2810, 2320, 1294, -263, -1264, -2096, -2631, -3411, -3671, -3479,
-    -3217, -2307, -2081, -1111, -252, 595, 1822, 2070, 3084, 3519,
-    3706, 3283, 2970, 2228, 1657, -122, -909, -1819, -2783, -2780,
-    -3836, -3298, -3573, -2480, -1986, -1640, -577, 510, 1857, 1998,
-    2874, 3815, 4002, 3491, 2827, 2519, 1946, -73, -742, -1938,
-    -2604, -2958, -3863, -3537, -3697, -2455, -1905, -1327, -345, 812,
-    1776, 2435, 2843, 3630, 3675, 3617, 2652, 2067, 1443, 90,
-    -1031, -2290, -2403, -2960, -3385, -3656, -3211, -2772, -1756, -1586,
-    -446, 524, 1637, 2324, 2586, 3579, 4047, 3599, 2900, 2649,
-    1888, 216, -1085, -1782, -2764, -3235, -4091, -3353, -3635, -2670,
-    -1949, -1516, -144, 620, 2018, 2280, 3003, 3467, 3925, 3354,
-    2836, 2154, 1304, 211, -1349, -1995, -2769, -2914, -3569, -3448,
-    -3169, -2306, -1871, -1563, -203, 743, 1729, 2156, 2982, 3811,
-    3829, 3287, 2995, 2229, 1636, 126, -1181, -1996, -3184, -2997,
-    -3996, -3595, -3627, -2652, -1761, -1654, -183, 593, 2103, 2640,
-    3248, 4165, 4163, 3817, 3205, 2219, 1695, -399, -1275, -2407,
-    -3008, -3362, -4155, -3508, -3447, -2365, -1956, -1406, -41, 772,
-    1727, 2372, 3222, 4116, 3781, 3510, 3184, 2216, 1371, -367,
-    -1297, -2213, -3098, -3094, -4149, -3650, -3413, -2374, -1891, -1453,
-    198, 1217, 2144, 2659, 3312, 4194, 4052, 3605, 2895, 2192,
-    1428, -306, -1320, -2182, -2868, -3550, -4054, -3833, -3455, -2976,
-    -1949, -1471, -69, 903, 2015, 2929, 3232, 4297, 4289, 3651,
-    3084, 2192, 1694, -301, -1787, -2089, -3068, -3232, -4584, -3796,
-    -3437, -2770, -2049, -1381, 316, 916, 2295, 2894, 3609, 4233,
-    4360, 3740, 3042, 2136, 1625, -523, -1725, -2296, -3120, -3397,
-    -4567, -3701, -3639, -2825, -2096, -1339, 156, 1051, 2433, 3114,
-    3633, 4454, 4241, 3780, 2916, 2171, 1392, -779, -1620, -2816,
-    -3051, -3819, -4530, -3959, -3680, -2343, -2340, -996, 354, 1607,
-    2677, 3101, 4288, 4516, 4318, 3496, 2885, 2063, 856, -886,
-    -1708, -2515, -3226, -3610, -4175, -3627, -3588, -2561, -2039, -1105,
-    54, 1184, 2372, 2838, 3729, 4355, 4368, 3542, 2838, 2398,
-    1192, -837, -1991, -2730, -3161, -4189, -4549, -3853, -3323, -2544,
-    -2078, -666, 708, 1711, 2797, 3451, 4227, 4548, 4319, 3606,
-    2910, 1856, 895, -938, -1709, -2858, -3599, -3881, -4568, -3785,
-    -3719, -2324, -2004, -1028, 534, 1548, 2814, 3026, 4206, 4839,
-    4147, 3688, 2486, 2328, 270, -1398, -2268, -3115, -3171, -4566,
-    -4077, -3801, -2636, -2200, -1704, -185, 900, 2078, 2617, 3504,
-    4143, 4431, 3941, 3304, 2328, 1766, 249, -1339, -2303, -3009,
-    -2963, -4334, -4134, -3875, -2677, -2586, -2044, -315, 871, 1996,
-    2466, 3835, 4461, 4555, 3835, 3344, 2441, 1561, -525, -1545,
-    -2586, -2822, -3432, -4202, -3814, -3630, -2336, -2512, -1365, -290,
-    1266, 2307, 2812, 3691, 4485, 4595, 3873, 2759, 2436, 1424,
-    -687, -1765, -2888, -2623, -4292, -4286, -4067, -3104, -2403, -2410,
-    -616, 312, 1853, 2343, 3233, 3719, 4274, 3944, 3366, 2130,
-    1806, 497, -1117, -1891, -2601, -2489, -3812, -3537, -3287, -2521,
-    -2175, -1746, -605, 376, 1363, 2395, 2784, 3672, 4060, 4095,
-    3226, 2177, 2160, 87, -1187, -2617, -2175, -2707, -4112, -3649,
-    -3205, -1935, -2699, -1821, -477, 726, 1525, 2227, 3331, 3861,
-    4255, 3595, 3102, 2002, 1749, -254, -1407, -2412, -2345, -3103,
-    -4024, -3733, -3066, -2252, -2498, -1287, -368, 1397, 1885, 2916,
-    3610, 4375, 4341, 3479, 2618, 2018, 707, -792, -1845, -2375,
-    -2297, -3680, -3387, -3439, -2185, -2263, -2144, -772, 130, 1320,
-    1448, 2391, 3404, 3852, 3581, 3201, 2590, 2394, 341, -666,
-    -1888, -2126, -2597, -4001, -3569, -3728, -2573, -2718, -1847, -815,
-    531, 1897, 2730, 3268, 4291, 4418, 3862, 2831, 2215, 1323,
-    -879, -1809, -2645, -2229, -3598, -3663, -3254, -2046, -2025, -2078,
-    -724, 342, 1274, 1474, 2486, 3260, 3837, 3348, 3050, 2182,
-    2094, 468, -692, -1993, -2045, -2012, -3448, -3442, -3228, -1985,
-    -2706, -2060, -1013, 309, 1130, 2172, 3025, 4074, 4491, 4203,
-    3183, 2165, 1772, -564, -1537, -3287, -2287, -3342, -3756, -3404,
-    -2434, -1245, -2024, -750, 6, 1262, 1477, 1873, 2736, 3336,
-    3027, 2580, 2248, 2148, 622, -468, -1295, -1588, -2041, -2908,
-    -3089, -3086, -2128, -2388, -1930, -1447, 136, 1098, 1904, 2546,
-    3694, 4536, 3564, 3071, 2103, 2034, -514, -1455, -2331, -2308,
-    -2875, -3958, -2999, -2684, -1534, -2147, -855, 9, 1330, 1678,
-    2172, 2967, 3487, 3266, 2326, 1961, 1643, 218, -1048, -1599,
-    -1881, -1667, -2921, -2322, -2915, -1336, -2006, -1757, -1280, -139,
-    1151, 1276, 2442, 3353, 4322, 3323, 2975, 2242, 1774, -851,
-    -1471, -2317, -1873, -3188, -3305, -2921, -2129, -1588, -2008, -589,
-    -213, 1296, 1407, 2550, 2739, 3573, 3151, 2575, 1369, 1560,
-    -45, -1227, -2178, -1619, -1546, -3163, -2730, -2531, -923, -2570,
-    -1687, -838, 912, 969, 1845, 3183, 3841, 3578, 3021, 2516,
-    1867, 508, -1263, -1767, -2436, -1638, -3053, -2418, -2649, -936,
-    -1343, -1603, -1129, 205, 1084, 1254, 2150, 3112, 3674, 2899,
-    2569, 1646, 1470, -954, -1547, -2586, -1577, -3140, -3198, -3067,
-    -1723, -1510, -1998, -821, 205, 1639, 1700, 2871, 3360, 3923,
-    2974, 3032, 1329, 1562, -1113, -1083, -2558, -1505, -2199, -2967,
-    -2177, -2197, -543, -2428, -990, -1163, 912, 714, 1762, 2740,
-    3504, 3293, 3010, 2007, 1677, -442, -994, -2330, -2302, -1772,
-    -3146, -2172, -3049, -211, -1917, -1281, -1174, 1050, 1583, 1436,
-    2908, 3804, 3872, 2711, 2622, 1807, 316, -1655, -1851, -2460,
-    -1884, -3340, -2322, -2548, -1154, -1260, -1639, -821, -365, 1479,
-    1216, 2095, 2952, 3247, 3069, 1698, 1656, 706, -1078, -1699,
-    -2061, -730, -2881, -2079, -2202, -567, -1098, -1837, -802, -655,
-    1250, 790, 2413, 2988, 3721, 3585, 2478, 1771, 768, -1011,
-    -1905, -3070, -1619, -2732, -2186, -2475, -1412, -448, -1738, -682,
-    -1013, 1314, 698, 1895, 2675, 3216, 3240, 2181, 1909, 1123,
-    -553, -1387, -2423, -1190, -2041, -2196, -2181, -1476, -348, -1983,
-    -817, -790, 884, 769, 1896, 2854, 3010, 2909, 2547, 1581,
-    830, -1170, -1359, -2514, -1647, -1505, -2032, -1498, -1833, 79,
-    -2156, -1058, -1291, 251, 935, 1401, 3179, 3216, 3791, 2689,
-    1926, 1238, -878, -1600, -2850, -1798, -1823, -2177, -1595, -1568,
-    68, -1848, -716, -1047, 97, 811, 1234, 2774, 2659, 3239,
-    2549, 1722, 934, -1072, -1633, -2496, -1962, -1622, -2058, -1434,
-    -1307, 288, -1058, -585, -690, 561, 1224, 1401, 2563, 2756,
-    3049, 2525, 1683, 1028, -728, -1406, -2488, -2166, -1475, -2475,
-    -2065, -2055, -68, -1428, -1343, -873, 457, 1516, 1301, 2980,
-    2909, 3041, 2392, 1570, 847, -1416, -1365, -2509, -1339, -1476,
-    -2042, -1287, -1378, 666, -1637, -951, -1059, 474, 1610, 1135,
-    3396, 2915, 3687, 2328, 1626, 396, -1770, -2029, -3128, -1542,
-    -2123, -1902, -1696, -937, 107, -1653, -1213, -1127, 188, 1126,
-    1086, 3335, 3043, 3482, 2802, 1516, 824, -1674, -1512, -2972,
-    -1338, -1593, -1639, -1305, -741, 658, -1783, -989, -1158, 709,
-    914, 1256, 3747, 2771, 3639, 2221, 1822, -12, -2236, -2142,
-    -3210, -1270, -2043, -1662, -1503, -432, 343, -2129, -1442, -1169,
-    740, 868, 1636, 4163, 2979, 3595, 2212, 1845, -327, -2490,
-    -1649, -2557, -659, -1963, -996, -1027, -375, 287, -2295, -1177,
-    -1302, 1077, 990, 1774, 3870, 2707, 3752, 1933, 1348, -1308,
-    -2586, -2087, -2858, -1195, -2032, -994, -1174, 331, -6, -2336,
-    -1402, -774, 1102, 567, 2331, 4010, 3275, 3678, 1924, 1022,
-    -1806, -2371, -2572, -2599, -1078, -1163, -524, -531, 1002, -318,
-    -2253, -1530, -388, 788, 725, 2974, 3891, 3147, 3313, 1778,
-    315, -2696, -2748, -2815, -2067, -1266, -1557, -418, 39, 756,
-    -1392, -2238, -1407, -321, 557, 1344, 3346, 3896, 3724, 3074,
-    1521, -736, -2475, -3236, -2870, -1642, -1104, -897, -163, 1093,
-    456, -1697, -1937, -1015, 165, 621, 2230, 3806, 3820, 3619,
-    2092, 810, -2022, -2765, -3508, -2075, -920, -1005, -410, -120,
-    1300, -940, -2351, -2024, -837, 427, 1028, 3432, 3697, 3433,
-    3239, 1276, -760, -3342, -2612, -3482, -1934, -417, -232, -136,
-    -82, 1923, -1712, -2794, -1964, 129, 809, 1443, 4801, 4269,
-    3898, 2801, 1139, -2133, -3947, -3109, -2919, -1283, 190, 534,
-    15, 796, 918, -2936, -3443, -1737, 700, 813, 2635, 5460,
-    3939, 3270, 1280, -94, -3820, -4481, -3157, -1788, 13, -33,
-    591, 681, 997, -1108, -3716, -2592, -783, 1426, 1849, 4226,
-    5188, 4357, 2911, 221, -2067, -4527, -4028, -3439, -446, 419,
-    558, 502, 1537, 382, -3317, -3912, -2480, -18, 1198, 3582,
-    5532, 5112, 4129, 1634, -889, -4275, -4870, -4104, -1693, 875,
-    893, 1548, 1132, 1355, -1834, -3992, -3853, -1556, 1219, 2582,
-    5023, 5528, 4681, 2511, -210, -3011, -4978, -4600, -3292, 243,
-    1515, 1033, 789, 1131, -84, -3852, -4362, -2814, 215, 2222,
-    4184, 5834, 5162, 3418, 803, -1988, -4570, -5120, -3745, -410,
-    2104, 2110, 1350, 1097, 564, -2589, -5271, -4026, -984, 2130,
-    3531, 6117, 6114, 3814, 1607, -1503, -4050, -6169, -4108, -1917,
-    1710, 2459, 1925, 1227, 157, -1563, -4981, -5018, -2680, 1288,
-    3589, 5332, 6527, 4928, 2401, -488, -3416, -5744, -4920, -2449,
-    426, 2999, 2896, 1664, -243, -720, -3731, -5862, -4336, 159,
-    3268, 4799, 6850, 5974, 3125, 9, -2313, -5656, -5702, -3661,
-    -237, 2774, 3754, 2600, -98, -1069, -2788, -5253, -5680, -2004,
-    3009, 5001, 6579, 6921, 4204, 847, -2085, -4350, -6200, -4548,
-    -1396, 2191, 4155, 3024, 602, -1398, -2530, -4743, -6060, -3426,
-    1401, 5116, 6206, 7092, 4743, 1451, -1347, -3935, -5243, -5519,
-    -1677, 1273, 4455, 3433, 1106, -1479, -2691, -3727, -5843, -4419,
-    -39, 5131, 6406, 6641, 5424, 2103, -833, -3541, -4896, -5219,
-    -2851, 869, 3771, 4626, 1156, -1200, -3257, -3649, -5383, -4818,
-    -1139, 4092, 6972, 6552, 5597, 2535, -484, -3389, -4116, -4435,
-    -2732, 57, 3422, 4269, 2105, -1306, -3483, -4150, -4336, -4385,
-    -2062, 2834, 6259, 6654, 5432, 3173, -348, -2685, -3668, -4063,
-    -3329, -244, 2669, 4161, 2726, -265, -3499, -4582, -4331, -4242,
-    -2724, 1330, 6070, 7175, 5486, 3376, 396, -2383, -3905, -3484,
-    -2608, -486, 2160, 3932, 3520, -283, -3425, -5196, -4097, -3537,
-    -2338, 631, 4824, 6865, 5182, 3250, 341, -2058, -2922, -2458,
-    -1975, -788, 1642, 2908, 2900, 357, -3290, -5287, -4322, -2332,
-    -2094, -185, 3428, 6152, 5047, 2966, 597, -1777, -2318, -1809,
-    -1400, -746, 1319, 2480, 2268, 999, -2160, -5237, -4745, -2394,
-    -1460, -852, 2151, 5268, 5497, 3145, 1322, -1025, -2197, -1833,
-    -1048, -417, 788, 1862, 2129, 1530, -1597, -4535, -4962, -2559,
-    -1109, -631, 1032, 3980, 4841, 3101, 1289, -68, -1752, -1415,
-    -313, 167, -334, 944, 1404, 1162, -520, -3132, -4347, -3594,
-    -693, -677, -199, 1559, 4634, 3589, 2096, 794, -603, -1225,
-    -862, 215, -410, 78, 959, 1444, 400, -1844, -3931, -3873,
-    -1861, -272, -167, 620, 3073, 4516, 2605, 1067, -221, -1109,
-    -812, 126, -134, -315, 748, 1299, 770, -1340, -3094, -4002,
-    -2618, -423, -211, -169, 1984, 4193, 3368, 1302, 247, -728,
-    -743, -280, 110, -451, 160, 783, 1112, -24, -2676, -3774,
-    -3259, -717, -76, -94, 915, 3346, 4106, 2026, 639, -624,
-    -645, -587, 9, -286, -519, 589, 866, 791, -1820, -3533,
-    -3835, -1540, 244, -184, 487, 2440, 4513, 2464, 927, -317,
-    -1161, -719, 267, 483, -679, 126, 720, 663, -1519, -3441,
-    -3666, -2453, -68, 665, 461, 1303, 3667, 3538, 1336, -114,
-    -709, -293, -3, 114, -213, -477, 328, 1059, 14, -2652,
-    -4184, -2998, -628, 148, -180, 1055, 3064, 4069, 2608, 899,
-    -731, -1163, -90, 273, -655, -763, 572, 888, 463, -1718,
-    -3444, -3950, -1702, 285, 115, -162, 2079, 4267, 3033, 1255,
-    133, -348, -421, 288, -154, -1151, -637, 473, 957, -474,
-    -2837, -3736, -2299, -94, 142, -489, 855, 3706, 3789, 2145,
-    462, -675, -539, 504, -52, -1199, -935, 470, 908, -194,
-    -2219, -3943, -3193, -881, 780, -75, 617, 2830, 4329, 2419,
-    536, -259, -845, 62, 748, 41, -747, -104, 376, 562,
-    -1928, -4012, -3733, -1489, 794, 748, 76, 1706, 3770, 3118,
-    1249, -314, -684, -157, 633, -12, -1048, -726, 134, 985,
-    -442, -3441, -4220, -2379, 154, 704, 233, 928, 3657, 3981,
-    2217, 55, -1244, -547, 814, 514, -1294, -699, -18, 1006,
-    -238, -2657, -4254, -3050, -249, 1067, 326, -98, 3042, 4245,
-    2935, 334, -729, -699, 829, 682, -1371, -1199, -631, 933,
-    172, -1986, -4405, -3519, -920, 893, 481, -294, 2325, 3896,
-    3610, 1080, -147, -565, 917, 1087, -804, -1351, -1130, 66,
-    788, -535, -3999, -4343, -1437, 816, -61, -771, 1507, 4068,
-    4048, 2369, 243, -1228, -75, 1285, -372, -1678, -757, 370,
-    1031, -339, -3688, -5254, -2904, 261, 985, -114, 1020, 3705,
-    4300, 2387, 419, -1051, 40, 1625, 778, -946, -1146, -631,
-    50, 42, -2451, -4664, -3775, -318, 926, 66, -362, 2305,
-    4179, 3570, 1636, -52, -486, 1058, 1138, -1078, -1799, -876,
-    652, 810, -1139, -4243, -4481, -2443, 422, 570, -256, 1473,
-    4641, 4243, 1817, -269, -857, 577, 1239, 301, -1059, -804,
-    -71, 511, -1154, -3668, -4819, -2649, 472, 1059, 87, 432,
-    3136, 4072, 2441, 615, -171, 315, 1696, 1058, -1289, -1322,
-    -1124, -46, 105, -2174, -4613, -3699, -494, 1126, -147, -810,
-    2401, 4194, 3775, 1805, -71, -827, 1121, 1526, -755, -1543,
-    -699, 285, 382, -1459, -4671, -5042, -1702, 1572, 848, -654,
-    1618, 4121, 3469, 1693, 137, -542, 866, 2176, 140, -1615,
-    -1437, -275, 175, -877, -3600, -4792, -2378, 1134, 1116, -915,
-    273, 3667, 4506, 2401, 535, -483, 271, 1730, 877, -1747,
-    -1542, -403, 990, -293, -3358, -5188, -3225, 59, 1564, -24,
-    -396, 3255, 4530, 2953, 145, -758, -172, 2031, 1079, -905,
-    -1801, -890, 841, 223, -3003, -5545, -3638, 159, 1852, -56,
-    -119, 2430, 4328, 3274, 902, -759, 44, 2093, 1461, -966,
-    -1094, -798, -487, 363, -1435, -5147, -5008, -626, 1695, 235,
-    -728, 1899, 3479, 3165, 2042, -144, -896, 1851, 2753, -446,
-    -1870, -1414, -388, 451, -536, -3979, -5164, -1719, 1544, 556,
-    -1492, 652, 3584, 4180, 2976, 398, -1352, 768, 2402, -169,
-    -2031, -903, 319, 605, -301, -3440, -5893, -3243, 816, 1486,
-    -330, 412, 3391, 3878, 2377, 357, -1115, 210, 2699, 951,
-    -918, -1051, -1017, 215, 390, -2706, -5715, -3747, 514, 1805,
-    -237, -163, 2194, 3758, 3669, 952, -1522, -661, 2474, 1584,
-    -1093, -1222, -534, -11, 535, -1449, -5233, -4782, -780, 2168,
-    778, -567, 1479, 3941, 3571, 1402, -796, -979, 1599, 2056,
-    -306, -1607, -1496, -171, 1227, -927, -4936, -5086, -1272, 1752,
-    979, -876, 524, 3446, 4271, 2303, -468, -834, 1662, 2213,
-    -697, -1848, -1346, -352, 1317, 200, -4154, -5388, -1673, 1120,
-    671, -918, 671, 3206, 4094, 2839, 142, -1492, 727, 2749,
-    -326, -2174, -1315, 167, 822, -177, -3875, -5376, -2718, 825,
-    1328, -557, 404, 2993, 4294, 2768, 433, -1286, 740, 2777,
-    448, -1851, -622, -355, -113, 469, -2495, -6193, -4281, 1262,
-    2314, -516, -445, 2938, 3510, 2773, 1070, -937, -905, 2713,
-    1999, -1330, -1798, -906, 213, 502, -1942, -5707, -4280, 188,
-    2442, -68, -514, 1682, 3939, 3592, 1591, -798, -935, 2290,
-    2118, -1440, -2163, -700, 324, 1094, -1528, -4999, -4984, -934,
-    1910, 692, -910, 1379, 3972, 3980, 2006, -359, -1255, 1040,
-    2092, -791, -1666, -883, 399, 865, -973, -4786, -5200, -1715,
-    1889, 1370, -749, 1065, 3723, 3737, 1771, -37, -1121, 1176,
-    2399, -335, -2012, -1268, -370, 653, -234, -4256, -5705, -1994,
-    2148, 1401, -1149, 624, 3454, 3562, 2534, 464, -1363, 975,
-    3002, -157, -2266, -936, -189, 144, -130, -3246, -5763, -2934,
-    1732, 1823, -921, 175, 3072, 3397, 2529, 873, -862, 54,
-    2630, 778, -1896, -1575, -281, 617, 306, -2811, -5736, -3674,
-    737, 2187, -397, -441, 2475, 4039, 2968, 937, -1165, -521,
-    2680, 1286, -1832, -1249, 11, 152, 170, -1966, -5205, -4603,
-    249, 2658, -234, -820, 2426, 3766, 2489, 1194, -588, -878,
-    2134, 1969, -1525, -1883, -299, 648, 285, -2112, -4784, -4267,
-    -85, 2263, 246, -913, 1738, 3817, 3032, 1044, -560, -651,
-    2097, 2415, -1510, -2340, -604, 789, 258, -1905, -4721, -4508,
-    -539, 2356, 687, -1162, 1453, 3674, 3029, 1103, 21, -506,
-    1760, 2039, -773, -1791, -1132, 200, 954, -912, -4882, -5180,
-    -641, 2389, 105, -725, 1372, 3173, 3079, 1980, -241, -1529,
-    1529, 3244, -978, -2836, -512, 454, 529, -871, -3774, -5650,
-    -1911, 2569, 1348, -1515, 800, 3686, 3375, 1874, -149, -1158,
-    1004, 3180, -124, -2425, -1067, 440, 537, -636, -3679, -5678,
-    -2190, 2293, 1583, -1440, 311, 3372, 3358, 1661, 402, -733,
-    460, 2975, 682, -2270, -1488, 320, 668, -514, -3461, -5038,
-    -2404, 1623, 1513, -948, -53, 3104, 3577, 1893, 451, -1124,
-    198, 3245, 761, -2599, -1128, 213, 668, -258, -3180, -5365,
-    -2948, 1972, 1870, -1445, -39, 3204, 3001, 2051, 598, -1042,
-    433, 3539, 941, -3014, -1258, 463, 469, -250, -2676, -5505,
-    -3270, 1779, 2201, -1334, -563, 2964, 3641, 2385, 598, -750,
-    -362, 2942, 2015, -2058, -1719, 8, 226, 44, -2232, -5152,
-    -4068, 817, 2791, -512, -1164, 2468, 3560, 2185, 1070, -605,
-    -765, 2947, 2219, -2265, -2015, 155, 560, 28, -2102, -4764,
-    -4464, 622, 3083, -582, -1150, 2323, 3426, 2370, 1202, -208,
-    -196, 2018, 2365, -1810, -2000, 142, 147, -24, -1261, -4800,
-    -4920, 201, 2835, -276, -1466, 2343, 3219, 1948, 1622, 348,
-    -1449, 1797, 3627, -1358, -2654, 97, 605, -377, -1900, -3986,
-    -4514, -899, 3198, 864, -1922, 1070, 3437, 2790, 1369, 119,
-    -605, 1673, 2592, -1103, -2267, -28, 698, 73, -1544, -4058,
-    -4756, -690, 2886, 94, -1879, 1342, 3613, 2683, 1697, 326,
-    -1069, 1090, 3032, -1169, -2409, -15, 434, 712, -964, -4676,
-    -5308, -962, 3053, 632, -2106, 957, 3202, 3154, 2290, 43,
-    -1168, 1441, 3195, -834, -2676, -14, 610, 354, -805, -3516,
-    -5298, -1971, 2784, 1225, -2066, 561, 3165, 2407, 1791, 1254,
-    -783, -182, 3364, 460, -3119, -1351, 843, 1093, -511, -3653,
-    -4941, -2567, 1873, 1930, -1578, -209, 3130, 3417, 2509, 566,
-    -1636, 224, 3328, 938, -2680, -1089, 833, 503, -371, -3017,
-    -5834, -3027, 2612, 2073, -2062, -644, 3321, 3226, 2006, 791,
-    -1414, -543, 3798, 1532, -3288, -1320, 798, 418, -218, -2930,
-    -5607, -2983, 2303, 2432, -1969, -854, 3342, 3534, 2247, 1051,
-    -1069, -449, 3645, 2195, -2943, -2172, 780, 808, -314, -2608,
-    -5189, -3740, 1510, 2685, -1522, -1504, 2767, 3390, 2182, 1302,
-    -632, -558, 3006, 2268, -2962, -2229, 1176, 418, -849, -1482,
-    -4580, -4741, 597, 3074, -1096, -1925, 2711, 4057, 2124, 1114,
-    78, -982, 2296, 3177, -1894, -2684, 581, 760, -121, -2052,
-    -4713, -4751, 2, 3252, -323, -2063, 2140, 3614, 2143, 1257,
-    -203, -771, 2112, 3533, -879, -2796, -207, 686, -531, -1489,
-    -4107, -4730, -366, 2865, 235, -2025, 616, 3246, 2813, 1792,
-    91, -1263, 2001, 3832, -1289, -3208, 490, 640, -500, -527,
-    -3225, -5439, -1761, 2959, 914, -2588, 616, 3691, 2832, 1945,
-    427, -1189, 754, 3333, 239, -2895, -710, 986, 326, -778,
-    -3503, -5265, -2161, 2099, 1418, -1491, -270, 2950, 3433, 1866,
-    210, -1288, 240, 3503, 1204, -2403, -1051, 549, 338, -318,
-    -3342, -5890, -2444, 3231, 2357, -2238, -985, 2756, 3373, 2117,
-    384, -1060, 365, 3708, 1017, -3247, -1004, 1043, -23, -451,
-    -2816, -5666, -2915, 2517, 2281, -2190, -1113, 2570, 3179, 2462,
-    1139, -890, -303, 3420, 1618, -3073, -1517, 1189, 638, 26,
-    -3068, -5663, -2762, 1979, 2100, -1970, -1234, 2675, 3392, 2539,
-    961, -1158, -88, 3312, 1672, -2514, -1727, 583, 756, 20,
-    -2171, -5582, -4122, 1397, 2647, -1348, -1618, 1928, 3220, 2612,
-    1215, -604, -522, 3072, 2456, -2295, -1902, 1282, 172, -485,
-    -1202, -4546, -4591, 325, 2909, -673, -2075, 1424, 3004, 2596,
-    2007, -353, -917, 2278, 2763, -1810, -1821, 686, 426, -46,
-    -778, -4493, -5679, -327, 3459, -41, -2489, 1151, 2879, 2493,
-    1888, 161, -1118, 1460, 3393, -58, -2815, -451, 1020, 671,
-    -813, -4097, -5068, -1246, 2664, 1132, -2147, -353, 2703, 3269,
-    2385, -420, -737, 1499, 2816, -109, -1969, -630, 181, 102,
-    286, -2764, -6193, -2425, 2676, 1521, -2112, -647, 2137, 3047,
-    2790, 518, -1630, 650, 3692, 832, -2583, -487, 627, -251,
-    281, -1867, -6092, -3819, 2526, 2717, -1821, -1353, 1932, 2649,
-    2698, 1331, -933, -419, 3484, 2508, -2169, -1984, 389, 316,
-    206, -1302, -4951, -4455, 1034, 2865, -1245, -2241, 1337, 2877,
-    2840, 1848, -478, -1021, 2268, 3390, -1574, -3198, 671, 1160,
-    -337, -1046, -3784, -5095, -1069, 3234, 603, -2830, -151, 3790,
-    3029, 1357, 28, -704, 1487, 3265, -92, -2101, -465, 203,
-    402, -202, -3222, -5633, -1668, 2927, 1281, -2156, -385, 2056,
-    2813, 2454, 830, -936, 461, 3340, 1052, -2745, -994, 821,
-    -29, -513, -2196, -4601, -3784, 1260, 2674, -1173, -2389, 1581,
-    3095, 2263, 1762, 426, -288, 2061, 2249, -1109, -1902, -308,
-    563, 288, -599, -3865, -4895, -542, 2965, 30, -2360, 30,
-    2829, 2969, 1964, 918, -488, 818, 2571, 196, -2135, -928,
-    134, 436, -299, -2918, -5307, -2874, 2268, 2098, -2250, -1708,
-    2213, 3529, 2890, 1195, -772, 427, 2789, 1622, -1522, -1393,
-    200, 65, 169, -1055, -4509, -5220, 288, 3308, -397, -2891,
-    609, 3597, 2907, 1427, 433, -344, 1011, 2611, -53, -2427,
-    -573, 605, -247, -755, -2937, -4907, -2405, 2257, 1862, -2379,
-    -1462, 2958, 3610, 2478, 993, -148, 415, 2035, 1520, -1210,
-    -1823, -60, 585, -379, -1747, -4126, -4026, 188, 2641, -701,
-    -2295, 1227, 3739, 2801, 1658, 104, -972, 1342, 2917, -832,
-    -2624, 432, 685, -918, -1277, -2473, -5049, -2314, 3168, 2092,
-    -2975, -629, 3916, 3253, 1468, 1112, -57, -75, 2468, 1625,
-    -1759, -1899, 227, 23, -259, -1712, -4706, -4235, 1361, 3113,
-    -1302, -2352, 1839, 3278, 2527, 1942, -289, -1038, 1981, 3069,
-    -1580, -2819, -145, 789, -215, -813, -3457, -5047, -1202, 3344,
-    882, -3175, 492, 3743, 2936, 1998, 902, -1157, 622, 2763,
-    790, -2447, -1149, 1070, -130, -988, -2020, -4578, -3550, 1613,
-    2740, -1155, -2060, 2020, 3369, 2212, 1482, -162, -718, 2320,
-    2244, -1412, -2224, -89, 333, -505, -945, -3331, -4841, -740,
-    3564, 578, -2877, 119, 3196, 3019, 2327, 885, -873, 560,
-    2715, 987, -2322, -1574, 446, -126, -291, -1612, -4624, -4028,
-    1315, 2960, -1212, -2034, 1864, 3114, 2514, 2017, -115, -1130,
-    1622, 2894, -550, -2830, -581, 424, -363, -452, -2624, -5375,
-    -2013, 3568, 1492, -2895, -661, 3492, 3393, 2183, 1022, -631,
-    275, 2554, 1186, -2443, -1571, 796, 53, -325, -1429, -4561,
-    -4334, 810, 3005, -811, -2310, 1572, 3593, 2627, 1992, 159,
-    -1078, 1010, 2616, -585, -2705, -58, 603, -642, -708, -2214,
-    -5620, -2336, 3359, 1640, -2495, -697, 2950, 3120, 2522, 1750,
-    -342, -636, 2023, 1462, -1508, -1697, 112, -334, -755, -728,
-    -3305, -4885, -676, 3347, 508, -2711, 436, 3590, 3116, 2425,
-    711, -1173, 273, 2844, 165, -2875, -267, 783, -1117, -886,
-    -1245, -4620, -3720, 1993, 2725, -1917, -1421, 2722, 3066, 2358,
-    2132, -73, -1233, 1917, 2584, -1569, -2665, 543, 117, -1546,
-    -282, -1727, -5266, -2132, 3354, 1717, -3017, -529, 3274, 2970,
-    2433, 1779, -487, -933, 2247, 1335, -2721, -1717, 1292, -675,
-    -872, -346, -3416, -5185, -307, 3534, -68, -2350, 1137, 3591,
-    2719, 2355, 420, -1185, 738, 2201, -259, -1992, -113, 829,
-    -796, -801, -1330, -4631, -3476, 1566, 2738, -1115, -1610, 1951,
-    2929, 2303, 2065, -163, -1177, 1573, 2031, -958, -1860, 286,
-    -249, -1116, -281, -2021, -4932, -2050, 2904, 1529, -2338, -874,
-    2575, 3153, 2415, 1627, -823, -690, 2208, 1744, -2207, -1692,
-    1415, -183, -1335, -36, -2311, -5721, -945, 3486, 517, -3028,
-    858, 3305, 2282, 1850, 1275, -975, -527, 2524, 1062, -2109,
-    -868, 1173, -1034, -811, -555, -3331, -4522, 453, 3206, -453,
-    -2353, 1166, 3071, 2339, 2353, 517, -1420, 637, 2259, -171,
-    -1701, 61, -46, -816, 175, -1354, -5084, -3341, 2337, 2121,
-    -1844, -1493, 2079, 2790, 2735, 1817, -640, -1288, 1490, 2325,
-    -910, -1518, 462, -138, -655, -143, -2418, -5004, -1914, 2379,
-    1562, -2037, -636, 2244, 2661, 2733, 1281, -828, -570, 2223,
-    1407, -1815, -1520, 1246, -182, -1154, -265, -3052, -4506, -323,
-    2931, -72, -2556, 450, 2987, 2616, 2169, 1174, -1228, -9,
-    2066, 534, -1682, -417, 457, -606, -162, -1138, -4040, -3712,
-    1201, 2318, -1197, -1734, 1918, 2586, 2116, 2257, 491, -1014,
-    740, 1635, -217, -1201, 630, -141, -1957, -77, -592, -4301,
-    -3784, 1505, 2294, -1207, -1705, 1864, 2491, 2300, 2518, -70,
-    -1644, 758, 2416, -592, -1698, 540, 98, -1138, 269, -1627,
-    -5408, -2491, 2611, 1869, -2270, -1105, 2513, 2946, 2646, 1606,
-    -972, -1234, 1564, 1850, -723, -831, 424, -850, -857, 723,
-    -2567, -5496, -1243, 2812, 770, -2251, -57, 2509, 2785, 2573,
-    741, -1906, -182, 2545, 822, -1441, -75, 396, -1240, -288,
-    -273, -3764, -4253, 600, 2684, -771, -2014, 1096, 2617, 2857,
-    2501, 154, -1350, 452, 2274, 477, -1884, -119, 1044, -1158,
-    -563, -719, -4423, -3599, 859, 2337, -1327, -2005, 1736, 3115,
-    2065, 2373, 110, -2059, 644, 2594, 261, -1384, 550, -303,
-    -1371, -69, -1124, -5139, -2742, 2049, 1595, -1730, -1015, 1852,
-    2605, 2744, 1851, -903, -1281, 1739, 2481, -94, -1324, 223,
-    -689, -774, 463, -1838, -5090, -2225, 2421, 1289, -2245, -1014,
-    2208, 2743, 2643, 1373, -1125, -879, 1949, 1806, -1022, -1215,
-    347, -387, -314, 311, -3574, -4875, -872, 1996, 109, -1922,
-    57, 2161, 3024, 2916, 661, -1814, 99, 2636, 1540, -1499,
-    -729, 822, -265, 21, -580, -4198, -4307, 586, 2393, -336,
-    -2338, 203, 2832, 2841, 2703, 152, -1749, 793, 2328, 426,
-    -1307, -217, -269, -912, 268, -826, -4861, -4044, 815, 1923,
-    -777, -1743, 610, 2554, 3211, 2496, 45, -1752, 815, 2695,
-    853, -1133, 38, -84, -1084, 234, -605, -4763, -3918, 1646,
-    2256, -1296, -1746, 1256, 2632, 3088, 2184, -792, -1591, 1409,
-    2407, -132, -1214, 40, -947, -955, 752, -1859, -5736, -2324,
-    2062, 1316, -1656, -1392, 1987, 2732, 3097, 2086, -1310, -1443,
-    2398, 2990, -943, -1705, 790, -79, -726, 243, -2614, -5380,
-    -1302, 3325, 773, -3204, -372, 3186, 2441, 2229, 1459, -1813,
-    -777, 2991, 1996, -1786, -1685, 556, -114, -551, -307, -3981,
-    -5006, 396, 2949, -251, -2970, 76, 3152, 2972, 2477, 449,
-    -1408, 583, 2685, 819, -1589, -259, 388, -635, 371, -547,
-    -5107, -4161, 1457, 2803, -974, -2499, 919, 2993, 2787, 2158,
-    -471, -1604, 1363, 2700, 50, -2088, -71, 501, -610, -284,
-    -1492, -4881, -3134, 1791, 2230, -1714, -1979, 1768, 2862, 2720,
-    2223, -380, -1637, 1396, 2728, -488, -2173, 796, 599, -928,
-    -400, -2233, -4963, -1952, 2364, 1563, -2314, -1512, 2709, 3073,
-    2358, 1209, -1038, -881, 1532, 1692, -178, -1037, -138, -217,
-    -16, -330, -3772, -4801, 18, 2508, 225, -1851, -4, 2474,
-    2740, 2878, 812, -1866, -243, 2852, 1560, -1462, -1241, 259,
-    -383, -197, -547, -4337, -4442, 599, 2967, -380, -2893, 513,
-    3504, 3025, 2062, 392, -2090, 173, 3393, 516, -2341, 59,
-    1048, -1193, -689, -506, -4284, -4449, 1477, 2941, -1411, -2085,
-    1613, 3156, 2602, 2334, -366, -1841, 1026, 2830, 122, -1980,
-    121, 321, -880, -175, -1848, -5290, -2214, 2439, 1437, -2181,
-    -1358, 1884, 2916, 2893, 1927, -1044, -1165, 2017, 1932, -809,
-    -1181, -5, -376, 85, 166, -2833, -5031, -623, 2450, 136,
-    -2479, -139, 2599, 3013, 2785, 1003, -1318, -379, 2166, 1261,
-    -1413, -768, 781, -789, -483, -190, -3644, -5125, 106, 2894,
-    -88, -2449, 217, 2537, 2601, 2746, 1132, -1872, -318, 3170,
-    1140, -2299, -673, 681, -1216, -593, -55, -3562, -4527, 476,
-    2325, -791, -1857, 1096, 2369, 2804, 3157, 1037, -1837, -7,
-    2475, 1067, -1528, -847, 462, -658, -290, -541, -4374, -4651,
-    888, 2398, -470, -2206, 863, 2989, 3024, 2445, -69, -1823,
-    493, 2851, 577, -1698, -480, 200, -821, -6, -978, -4854,
-    -4098, 1811, 2803, -1362, -2305, 1159, 3391, 2800, 2092, -332,
-    -1666, 1581, 2846, -526, -1719, 377, -382, -763, 524, -1667,
-    -5310, -2452, 2806, 1500, -2626, -1221, 2350, 2736, 3090, 1687,
-    -1480, -1192, 1922, 2429, -853, -1909, 487, -105, -989, 45,
-    -2595, -5027, -1410, 2580, 1075, -2362, -929, 2509, 2973, 2581,
-    1510, -1465, -843, 2016, 2584, -669, -1881, 162, -79, -610,
-    -69, -2546, -5013, -1158, 2520, 861, -2306, -752, 2797, 3255,
-    2013, 1024, -1356, -430, 2294, 1657, -914, -752, -58, -365,
-    -293, -606, -2742, -4754, -609, 2842, -233, -2610, 240, 2578,
-    2933, 2043, 1184, -1638, -821, 2867, 1974, -1792, -865, 1023,
-    -1009, -835, 375, -2661, -5467, -560, 3140, -6, -2885, 765,
-    2749, 2070, 2540, 1240, -1806, -211, 2980, 1777, -2069, -983,
-    1172, -658, -534, -164, -3439, -4747, 98, 2409, -306, -2765,
-    669, 3041, 2041, 1709, 924, -1765, 233, 2529, 1058, -1557,
-    -447, 686, -614, -88, -190, -3597, -4732, 1124, 2719, -932,
-    -2436, 1376, 2373, 2371, 2228, 514, -2049, 506, 3256, 1047,
-    -1957, -541, 849, -1117, -228, -525, -3286, -4266, 776, 2412,
-    -1459, -2903, 1370, 2785, 1972, 2231, 628, -2167, 277, 3446,
-    797, -2391, -130, 1050, -869, 0, -110, -4089, -4553, 1484,
-    2379, -1677, -2310, 1923, 2511, 2368, 2164, -52, -1889, 971,
-    3076, 649, -1206, -178, -50, -1188, 105, -554, -3787, -4317,
-    453, 2002, -698, -2207, 394, 2585, 2636, 2062, 142, -1104,
-    1109, 2563, 991, -1350, -574, 212, -461, 161, -581, -3398,
-    -4269, -181, 1917, -701, -2361, 899, 2909, 2495, 2139, 906,
-    -1598, -380, 2948, 1804, -1423, -849, 845, -902, -936, -310,
-    -3189, -5170, -600, 3067, -411, -2801, 919, 3224, 2028, 1863,
-    953, -925, 209, 3225, 1583, -1913, -676, 1138, -553, -1308,
-    -480, -2954, -4533, -338, 2512, -1016, -2686, 914, 3035, 1887,
-    2196, 1255, -1643, 181, 3298, 1535, -2068, -740, 944, -327,
-    -789, -457, -3435, -4801, -127, 2321, -758, -2464, 694, 2949,
-    2564, 2112, 731, -1138, 537, 3012, 1590, -1538, -590, 722,
-    -297, -738, -913, -3647, -4309, 20, 2263, -1156, -2641, 648,
-    2660, 2446, 1881, 459, -1597, 1014, 3383, 1397, -1654, -630,
-    638, -478, -773, -556, -3368, -4364, 165, 2300, -865, -2809,
-    504, 2891, 2313, 2392, 1115, -1430, 339, 3198, 1658, -2049,
-    -193, 933, -936, -884, 295, -3741, -5357, 62, 2346, -1186,
-    -2869, 1378, 2298, 1855, 2297, 1018, -2090, 985, 3903, 1083,
-    -2433, 234, 1492, -1115, -834, -223, -2664, -5145, -138, 2334,
-    -988, -2673, 1186, 2505, 1746, 2053, 1462, -1631, 183, 3525,
-    1854, -1956, -603, 1020, -858, -745, 57, -2859, -5424, -53,
-    2466, -717, -3119, 832, 2305, 1972, 2079, 1448, -1535, -68,
-    3104, 1774, -1935, -1015, 1508, -473, -1066, -198, -2475, -5367,
-    -774, 2697, 81, -2844, 421, 2608, 2249, 1824, 1433, -1692,
-    15, 3490, 1905, -2093, -817, 1124, -276, -583, -545, -2893,
-    -4791, 45, 2382, -5, -3009, 110, 2138, 2429, 2260, 1261,
-    -1707, -180, 3025, 1910, -1374, -1359, 371, -484, -159, -134,
-    -2827, -5427, -689, 2431, 353, -2595, -200, 2158, 2961, 2406,
-    968, -1074, 160, 2638, 1956, -762, -1424, 468, -187, -719,
-    -782, -1840, -4705, -1958, 1829, 1340, -2576, -1248, 2379, 2925,
-    2191, 1463, -862, -655, 2918, 2536, -1323, -1967, 689, -200,
-    -1029, -196, -1260, -5393, -2117, 2484, 866, -2852, -1121, 2538,
-    3010, 2227, 2017, -484, -1025, 2480, 2461, -638, -1797, 567,
-    -611, -1072, -215, -826, -4945, -3422, 1632, 1674, -1609, -1581,
-    1439, 2637, 2660, 2098, -328, -1248, 2658, 2691, -490, -2120,
-    680, 11, -1557, -540, -199, -3813, -4092, 982, 2020, -1483,
-    -1858, 1515, 2246, 2366, 2568, 818, -1953, 1129, 3283, 661,
-    -2878, -89, 950, -1355, -595, 14, -3719, -5147, 1063, 2883,
-    -1725, -2757, 2065, 2768, 1688, 2503, 1455, -1906, 321, 3646,
-    1531, -2518, -663, 1166, -1610, -1249, 230, -2526, -5040, -1383,
-    2613, 292, -2744, 307, 2444, 2232, 2560, 1841, -1349, 105,
-    3031, 1878, -1881, -1090, 848, -598, -909, -93, -2669, -5199,
-    -845, 2056, -110, -2642, -16, 2458, 2394, 2387, 2083, -1297,
-    -478, 3009, 2992, -1057, -2020, 753, 9, -1403, -306, -1614,
-    -5525, -2395, 2255, 1145, -3312, -1177, 2193, 2681, 2090, 2741,
-    -137, -1017, 2502, 3288, -344, -2165, 612, 404, -759, -950,
-    -772, -5101, -3532, 1158, 1575, -2424, -2069, 1945, 2835, 1857,
-    2203, 367, -981, 2190, 3172, 290, -2290, 511, 508, -257,
-    -669, -1674, -4738, -3030, 1011, 1030, -2121, -1747, 1152, 2637,
-    2853, 2161, 356, -608, 2173, 2429, 730, -1218, 151, -162,
-    -791, -255, -542, -4069, -4875, -563, 1154, -650, -1813, 149,
-    1954, 2660, 3099, 1281, -1356, 786, 3525, 1765, -1665, -547,
-    1151, -780, -723, 85, -2620, -5549, -1799, 2318, -503, -2548,
-    -160, 1992, 2267, 2940, 2117, -1035, -481, 3418, 2403, -1322,
-    -1623, 941, 375, -762, -708, -2258, -5071, -2823, 1814, 590,
-    -2455, -1425, 1951, 2378, 2457, 2336, 505, -1019, 1993, 3179,
-    46, -1741, 449, 503, -1103, -341, -695, -4099, -4457, 572,
-    1425, -1371, -1779, 889, 2212, 2526, 3023, 638, -1421, 1547,
-    3279, 711, -1728, -199, 574, -1017, -779, -395, -2883, -4787,
-    -1552, 1266, -187, -1571, -298, 1803, 2455, 2889, 2142, -685,
-    -40, 2829, 2534, -777, -1204, 1074, -498, -1863, -156, -732,
-    -4398, -3876, 991, 800, -1546, -971, 1021, 1784, 2477, 3122,
-    170, -1461, 1930, 3316, 312, -2139, -360, 787, -731, -745,
-    -1223, -3999, -3972, 560, 1423, -1602, -1784, 1171, 2490, 2227,
-    2806, 1457, -1196, 1068, 3201, 1106, -1160, -167, 609, -1030,
-    -936, -110, -2598, -5121, -1623, 1491, -73, -1848, -343, 1492,
-    1855, 2893, 2449, -722, -414, 2640, 2264, -952, -1268, 770,
-    -359, -1028, -183, -1428, -4496, -3118, 749, 577, -1271, -1092,
-    1139, 2466, 2708, 2432, 332, -609, 1686, 2647, 526, -1682,
-    136, 774, -830, -890, -893, -3357, -4515, -426, 1139, -1095,
-    -1389, 655, 1445, 2124, 3238, 1606, -1302, 860, 3159, 1419,
-    -1315, -978, 866, -510, -1049, -287, -1905, -4797, -2163, 1019,
-    -41, -1893, -329, 1744, 2001, 2910, 2861, -598, -814, 2757,
-    2409, -305, -1238, 410, -123, -681, -708, -1593, -4038, -3324,
-    -305, 624, -709, -1351, 541, 2078, 2495, 2657, 1182, -667,
-    1033, 2394, 1595, -809, -321, -235, -1150, 8, -344, -3775,
-    -4811, -687, 1435, -288, -1792, -762, 1505, 3263, 3475, 1207,
-    -1002, 670, 2675, 1739, -274, -869, 448, -104, -850, -433,
-    -2338, -4595, -2439, 705, 176, -1099, -946, 1032, 2189, 2860,
-    2416, -21, -287, 1623, 2170, 1106, -694, -653, -112, -883,
-    -763, -849, -3257, -4609, -913, 1349, -119, -2050, -130, 2351,
-    2587, 2993, 1497, -908, 612, 2696, 1893, -335, -1480, 307,
-    171, -506, -892, -2764, -4705, -2305, 1055, 662, -1652, -1310,
-    2173, 2568, 2025, 2302, -193, -758, 2577, 3038, -599, -1443,
-    639, -320, -1834, 132, -760, -5251, -3720, 1300, 876, -1769,
-    -889, 814, 1906, 2700, 3460, 594, -1236, 1617, 3206, 788,
-    -1461, 215, 1111, -1597, -1566, 128, -2732, -5298, -1568, 1896,
-    -310, -1995, 296, 1970, 1625, 3038, 2050, -1100, -241, 3282,
-    2328, -1001, -979, 788, -439, -1242, -306, -2197, -4702, -2484,
-    930, 459, -1352, -860, 1266, 2369, 2852, 2496, -216, -715,
-    2356, 2955, 174, -1621, 388, -58, -1109, -13, -624, -5348,
-    -4732, 1082, 1911, -1934, -2109, 1461, 1732, 2209, 3401, 1188,
-    -1960, 1185, 4287, 1385, -2594, -173, 1452, -1509, -1347, 217,
-    -2799, -5674, -1408, 1889, -570, -2214, 405, 2030, 1456, 3121,
-    3188, -745, -384, 3029, 2673, -927, -1365, 927, -211, -1423,
-    -263, -1737, -4908, -2993, 515, 221, -1349, -730, 977, 1882,
-    2963, 3174, 220, -1085, 2117, 2872, 527, -889, 357, -9,
-    -1527, -590, -707, -3650, -4823, -866, 784, -26, -1064, -568,
-    1394, 2394, 3484, 1890, -759, 496, 2991, 1901, -464, -1295,
-    409, -555, -881, 52, -2465, -5278, -2881, 1099, 402, -1170,
-    -1275, 1065, 2401, 3134, 2850, -217, -620, 2438, 2439, 527,
-    -570, 218, -248, -1520, -552, -989, -4257, -4359, -143, 848,
-    -313, -1309, -110, 1601, 2695, 3427, 1380, -1084, 1362, 3400,
-    1214, -1198, -713, 906, -1224, -947, -205, -2753, -5135, -2080,
-    1042, -482, -1616, -175, 1911, 2081, 3174, 2623, -353, -266,
-    2870, 2493, -35, -1214, 448, 231, -1111, -885, -2278, -4508,
-    -3135, -108, 681, -696, -1476, 653, 2406, 3063, 2384, 710,
-    -617, 1878, 2588, 1259, -1122, -225, 303, -1536, -777, -803,
-    -3701, -4972, -734, 831, -540, -1740, 555, 1615, 2700, 3562,
-    1747, -1166, 667, 3623, 1858, -942, -875, 1105, -721, -1731,
-    -556, -1904, -5474, -3028, 837, 801, -1925, -724, 1821, 2026,
-    2248, 3123, 639, -981, 2260, 3404, 566, -2554, 614, 880,
-    -1538, -1856, -822, -3427, -4302, -830, 917, -620, -1691, 912,
-    1971, 2577, 2843, 2082, -763, 784, 2780, 1777, -1026, -714,
-    655, -699, -1096, -1119, -2948, -5338, -1596, 1457, -222, -2305,
-    209, 1847, 2375, 2774, 2598, -646, -480, 2954, 2974, -413,
-    -1835, 1097, -527, -1574, -638, -1205, -5145, -3858, 898, 1522,
-    -1741, -1548, 1342, 2354, 2732, 3214, 809, -1608, 1988, 3716,
-    1112, -2396, -609, 1209, -1131, -1563, -475, -3062, -5301, -1600,
-    1807, -221, -2106, 223, 2407, 2007, 2854, 2537, -812, -253,
-    3132, 2619, -1024, -1366, 1125, -358, -1623, -554, -1872, -4803,
-    -2760, 1175, 100, -1766, -683, 1876, 1799, 2550, 3123, 26,
-    -660, 2729, 2296, -385, -1615, 710, 528, -1764, -722, -1199,
-    -4348, -4364, -18, 865, -881, -1887, 913, 2339, 2259, 3339,
-    1688, -1451, 761, 3372, 2056, -1208, -627, 1595, -1107, -1630,
-    -593, -2471, -4988, -1278, 1035, -316, -1596, -273, 1531, 1720,
-    3273, 3070, -1208, -337, 3224, 2211, -618, -1629, 898, -784,
-    -1293, -228, -1421, -5113, -3395, 656, 608, -1287, -913, 1138,
-    1909, 3075, 3244, 629, -1563, 2191, 3206, 1339, -2131, -159,
-    1009, -1352, -1193, -666, -3248, -4877, -320, 1171, -804, -2133,
-    723, 1652, 1931, 3364, 2298, -1482, 766, 3162, 1100, -1238,
-    -795, 1379, -1431, -1631, -102, -1888, -5018, -1854, 669, -627,
-    -1610, 328, 1643, 1734, 3389, 3155, -641, -835, 3200, 2314,
-    -416, -1133, 572, -211, -607, -295, -2213, -5034, -2970, 889,
-    401, -1615, -1033, 1078, 2065, 2850, 2692, 377, -1048, 1967,
-    3093, 888, -1824, -818, 392, -749, -651, -850, -3916, -4381,
-    -140, 1356, -1020, -1858, 385, 2194, 2801, 3372, 1723, -877,
-    734, 3015, 1962, -1378, -1321, 798, -153, -1363, -310, -2302,
-    -5124, -2807, 1562, 440, -2522, -292, 2147, 1756, 2207, 3402,
-    -99, -1203, 2093, 3051, -399, -1663, 764, 135, -1751, -908,
-    -687, -3983, -3713, -88, 1376, -1094, -1394, 1573, 2329, 2639,
-    2699, 1137, -883, 1143, 2887, 1855, -1727, -987, 552, -950,
-    -716, -971, -3460, -5058, -877, 1338, -100, -2283, -26, 2214,
-    2582, 2767, 1843, -816, 429, 2959, 1889, -1194, -1166, 561,
-    -865, -501, -364, -3064, -5444, -743, 1219, 49, -1838, -324,
-    1611, 2911, 3487, 1752, -680, 98, 2701, 1740, 507, -1483,
-    -31, -240, -711, -1310, -2258, -4352, -2815, 923, 810, -1928,
-    -1360, 1850, 2679, 2533, 2439, 645, -1013, 1925, 3217, 399,
-    -2629, -71, 761, -1067, -1233, -720, -4459, -4515, 839, 1601,
-    -1583, -2108, 1289, 2819, 2558, 3137, 1206, -1932, 952, 3828,
-    1299, -2142, -342, 727, -778, -1628, -603, -3315, -4936, -745,
-    1696, -208, -2093, 149, 2173, 2245, 2700, 2482, -1208, -112,
-    3504, 2920, -1619, -2186, 1184, -34, -1680, -742, -1527, -5230,
-    -2601, 1972, 549, -2817, -649, 2776, 2571, 2097, 2644, 284,
-    -1455, 2083, 3457, -5, -2987, 856, 640, -1224, -1102, -1439,
-    -5464, -3539, 2125, 1334, -2411, -1953, 2507, 2205, 2943, 2521,
-    630, -1356, 2665, 3268, -107, -2162, 687, 444, -1631, -1048,
-    -1002, -3630, -3986, 849, 735, -1529, -2232, 1825, 2262, 2755,
-    2525, 1373, -1538, 1137, 3489, 1582, -2355, -1434, 913, -848,
-    -669, -812, -2887, -5653, -867, 1968, 262, -2448, 114, 2349,
-    3006, 2742, 1838, -1410, 121, 3518, 2287, -1702, -1567, 1111,
-    -945, -817, -146, -2662, -5895, -638, 2628, 42, -3211, -174,
-    2118, 2186, 3239, 2351, -866, -479, 3057, 2579, -940, -2619,
-    483, 406, -999, -1047, -989, -4039, -3422, 204, 1367, -1570,
-    -1688, 2055, 2713, 2206, 2430, 831, -1091, 1387, 2999, 922,
-    -2651, 131, 959, -1305, -973, -724, -3876, -4606, 683, 1816,
-    -1334, -2138, 1310, 2301, 2080, 2822, 1370, -1578, 1276, 3504,
-    1021, -1950, -565, 893, -888, -1212, -669, -2784, -4695, -759,
-    1073, -232, -2322, 21, 2373, 2667, 2694, 1913, -349, 123,
-    2441, 2392, -723, -1937, 1076, -6, -1578, -944, -874, -4820,
-    -3307, 1194, 1075, -2249, -1319, 2071, 2749, 2274, 2424, 25,
-    -1038, 2348, 2519, 472, -1936, 226, -129, -707, -514, -1248,
-    -5001, -3297, 1520, 909, -1939, -1579, 1690, 2149, 2841, 2672,
-    319, -1629, 2862, 3628, 86, -2867, 157, 1151, -181, -1269,
-    -1339, -3891, -4421, 815, 1630, -1672, -2907, 1147, 2841, 2778,
-    1829, 1242, -1351, 1351, 3555, 1130, -2803, -246, 1935, -670,
-    -1377, -882, -3459, -4471, 659, 1778, -2278, -3207, 1875, 2791,
-    2050, 2063, 1796, -928, 1059, 2891, 1771, -1393, -760, 600,
-    -478, -848, -900, -2302, -4689, -1680, 1233, 44, -2664, -470,
-    1943, 3264, 2278, 1795, -910, 329, 2736, 2356, -811, -1688,
-    742, 158, -718, -782, -1825, -5203, -2221, 1145, 757, -2454,
-    -787, 1967, 2827, 1941, 2231, 143, -604, 2406, 2646, 353,
-    -2049, 455, -16, -607, -462, -1227, -4658, -2962, 678, 975,
-    -1753, -1518, 1039, 2234, 3298, 2705, 357, -1826, 1976, 2910,
-    965, -2177, -555, 140, -165, -254, -1484, -4496, -4462, 596,
-    1462, -1239, -2420, 837, 2495, 3632, 2257, 1209, -1205, 1165,
-    3411, 1553, -1529, -914, 918, -493, -651, -1496, -3011, -4672,
-    -357, 1122, -815, -2440, 653, 2209, 2525, 2504, 1850, -443,
-    -118, 3080, 1741, -594, -1604, 593, -750, -934, -901, -2223,
-    -5164, -1743, 1147, -344, -2232, -498, 2357, 2753, 2982, 1916,
-    273, -608, 3059, 2806, -225, -2463, 738, 452, -716, -1276,
-    -1879, -4214, -3272, 621, 755, -1751, -1712, 2301, 2404, 2390,
-    1833, 1580, -625, 1348, 2447, 1169, -1897, -90, 702, -1308,
-    -1460, -1268, -3027, -4783, -921, 1073, -232, -1936, 893, 1706,
-    2755, 2928, 2130, -574, 641, 2650, 2364, -812, -1694, 1004,
-    -75, -891, -1417, -2768, -4713, -1292, 918, 230, -2659, -825,
-    2126, 3025, 2691, 2208, 139, -414, 2469, 2493, -130, -2643,
-    646, 640, -773, -1629, -1917, -4655, -3439, 1075, 843, -2319,
-    -1769, 2400, 2705, 2231, 2129, 1539, -397, 1875, 2864, 1171,
-    -1672, -377, 940, -857, -1350, -1279, -3052, -4470, -704, 929,
-    -452, -2227, 86, 2072, 2905, 2737, 1530, -540, 571, 2606,
-    1904, -582, -1589, 596, -62, -760, -1500, -2765, -4866, -1596,
-    1007, -32, -2112, -371, 2233, 2137, 2632, 2153, 682, -368,
-    2426, 2295, 407, -1250, 497, -353, -1542, -577, -705, -4342,
-    -4270, 317, 558, -1017, -1584, 1419, 1776, 2719, 2821, 1240,
-    -1184, 1329, 3208, 1253, -1765, -497, 1505, -1376, -1823, -539,
-    -2339, -5067, -1262, 1162, -309, -2368, 1215, 1895, 1379, 2720,
-    3126, -586, -958, 3210, 3034, -989, -2380, 1444, -385, -1680,
-    -851, -1105, -5057, -3068, 1274, 1182, -2390, -1086, 1966, 1758,
-    2764, 2895, 1213, -1561, 1758, 3298, 807, -3044, -7, 1105,
-    -999, -1162, -1005, -3531, -4677, 141, 1324, -1194, -2019, 1700,
-    2051, 2136, 2466, 2150, -977, 362, 2788, 2085, -1383, -1389,
-    958, -822, -1094, -944, -2051, -5195, -1601, 1394, 700, -2365,
-    -511, 1866, 2837, 2511, 1994, -286, -290, 2811, 2043, -149,
-    -2040, 664, -331, -624, -1072, -1335, -4671, -3077, 685, 976,
-    -999, -1379, 1138, 1988, 3109, 2632, 902, -1608, 1832, 3152,
-    935, -2418, -153, 962, -1014, -1832, -852, -3153, -4861, -11,
-    1087, -829, -2043, 1406, 1882, 2040, 2611, 2238, -1290, 293,
-    3130, 2028, -1097, -800, 777, -1091, -780, -857, -2644, -5207,
-    -464, 1069, -136, -2255, 220, 1592, 2097, 2773, 2126, -48,
-    -197, 3291, 2239, -521, -2118, 937, -84, -1105, -1386, -1302,
-    -4447, -3014, 513, 628, -1990, -1483, 1732, 2269, 2403, 2020,
-    1438, -686, 1672, 2898, 1297, -1880, -286, 898, -326, -1717,
-    -1185, -2512, -4061, -1332, 796, -287, -2100, 572, 2020, 1481,
-    1807, 2791, 62, -222, 2421, 2715, -464, -1475, 425, -321,
-    -1052, -394, -1628, -4915, -3102, 886, 683, -1854, -1261, 1227,
-    2439, 2603, 2267, 650, -565, 1583, 2679, 1260, -1382, 248,
-    566, -1204, -1271, -1282, -3016, -4154, -648, 671, -623, -1970,
-    957, 1917, 1910, 2422, 2046, 17, 132, 3007, 2301, -789,
-    -1288, 580, -927, -1488, -900, -1415, -4608, -2736, 593, 331,
-    -1874, -555, 1547, 2072, 3016, 3105, 171, -1214, 2633, 3135,
-    -38, -2003, 550, -281, -747, -791, -1280, -5354, -3937, 1174,
-    913, -1418, -1614, 1712, 1713, 2620, 2913, 1174, -1266, 1781,
-    3630, 1065, -2038, -518, 1031, -1215, -1658, -763, -2382, -4918,
-    -1267, 1260, -308, -2388, 581, 1853, 1809, 3242, 2922, -975,
-    -519, 3376, 2291, -1255, -1225, 1065, -1204, -970, 240, -2035,
-    -6193, -1938, 1624, -46, -2108, -225, 1716, 1659, 3478, 2995,
-    -269, -1085, 2663, 3375, 654, -2279, 261, 104, -1435, -1313,
-    -1250, -3880, -4428, 88, 1382, -1363, -2170, 1206, 2079, 2406,
-    3397, 2043, -1033, 844, 3645, 1668, -1326, -740, 861, -1138,
-    -1524, -788, -2346, -5130, -2543, 871, 0, -1392, -77, 1601,
-    1516, 3265, 3363, -61, -786, 3120, 3358, 81, -2035, 451,
-    -5, -1497, -1241, -1474, -4125, -3973, -102, 547, -1013, -1797,
-    1240, 1642, 2649, 3143, 2006, -761, 997, 3032, 1463, -1142,
-    -772, 976, -1291, -1580, -643, -2448, -5317, -1696, 1163, -397,
-    -1804, 140, 1864, 1994, 2872, 2977, -378, -554, 3176, 3212,
-    -581, -1829, 844, -23, -1843, -1037, -996, -4622, -3514, 653,
-    594, -2121, -1199, 1610, 1342, 2265, 3615, 1926, -895, 1315,
-    3217, 1304, -1299, -786, 729, -920, -1361, -1016, -2299, -4873,
-    -2333, 855, -92, -1813, -391, 2120, 2247, 3231, 2515, -247,
-    -749, 2706, 3118, -273, -1498, 601, 4, -1845, -1134, -1663,
-    -4458, -2952, 302, 349, -1191, -1001, 1343, 1730, 3303, 3009,
-    704, -869, 1972, 3501, 947, -1904, -697, 1027, -859, -1649,
-    -1342, -2829, -5288, -1452, 973, -293, -1336, 422, 1657, 1901,
-    3492, 2696, -413, -292, 2839, 2781, -265, -1722, 491, -510,
-    -1260, -811, -2284, -4810, -2715, 1040, 367, -1790, -1153, 1702,
-    1848, 3254, 3479, 792, -841, 2150, 3110, 549, -2061, -949,
-    705, -632, -1006, -1460, -3665, -4590, -842, 560, -494, -2049,
-    354, 2614, 2942, 2588, 2143, 241, 48, 2492, 2402, -492,
-    -2032, 1115, 287, -1623, -1777, -1577, -4408, -3148, 257, 558,
-    -1233, -826, 1864, 1864, 2566, 3435, 1058, -1452, 1560, 3633,
-    1173, -2440, -320, 863, -1135, -1574, -956, -3619, -4568, -857,
-    767, -484, -1613, 627, 2006, 2153, 3208, 2602, -98, -17,
-    2400, 2974, -1041, -2227, 1094, 737, -2053, -1708, -1679, -4317,
-    -2995, 681, 356, -2098, -659, 2646, 2020, 1757, 3205, 1654,
-    -1103, 1318, 3893, 827, -2270, 376, 1257, -3036, -2262, -121,
-    -1599, -4993, -2290, 805, -604, -829, 1295, 1313, 615, 3584,
-    4285, 23, -1340, 2711, 3053, -905, -2122, 1055, -771, -1488,
-    284, -1566, -6249, -3401, 1825, 649, -1785, -786, 1796, 1365,
-    3564, 3470, -67, -1703, 2130, 3707, 665, -1845, 249, 180,
-    -1989, -1299, -454, -3107, -4913, -965, 1088, -276, -1612, 857,
-    1483, 1719, 3197, 2814, -194, 168, 2777, 2183, -693, -1538,
-    822, -78, -1798, -1439, -1210, -3459, -3879, -414, 787, -1170,
-    -739, 1330, 1501, 2031, 3356, 1623, -1388, 640, 3755, 1581,
-    -1943, -223, 677, -1859, -1049, -330, -3017, -4919, -810, 1478,
-    -645, -1392, 468, 1308, 1870, 3891, 2498, -708, 128, 3401,
-    2486, -1024, -2121, 602, -111, -1445, -885, -1756, -4532, -3576,
-    398, 503, -1770, -1235, 1939, 1728, 2389, 3539, 1397, -1441,
-    1318, 3607, 1237, -1841, -3, 1559, -1913, -2241, -596, -2753,
-    -4891, -1177, 1036, -755, -1870, 993, 2170, 1717, 2865, 2750,
-    47, 149, 3345, 2702, -1143, -1493, 1280, -414, -2716, -894,
-    -898, -4974, -3992, 645, 602, -2006, -724, 1896, 1559, 2338,
-    3902, 1537, -1247, 1755, 4224, 615, -2443, 546, 1244, -2626,
-    -1915, -90, -2766, -5558, -1237, 1333, -1164, -1410, 1073, 1226,
-    1674, 3989, 3004, -567, -363, 3629, 2428, -809, -1678, 658,
-    -691, -1731, -634, -1429, -4788, -3637, 198, 129, -765, -620,
-    1214, 1428, 3216, 3339, 1271, -789, 1608, 3010, 1197, -1601,
-    -329, 594, -1528, -1467, -754, -2714, -5175, -1210, 1105, -18,
-    -2134, 471, 1747, 2101, 3253, 2844, -525, -239, 3228, 2407,
-    -520, -1638, 1042, -791, -1765, -791, -1020, -4918, -3833, 442,
-    943, -1281, -1179, 1259, 1618, 2837, 3158, 1413, -1078, 1680,
-    3452, 978, -1805, -216, 845, -1546, -1854, -672, -2239, -4881,
-    -1691, 783, -413, -1541, 313, 1748, 1621, 3045, 3175, 74,
-    -431, 3125, 2456, -534, -1104, 1057, -493, -2042, -1093, -920,
-    -4023, -4043, -210, 124, -911, -1040, 1166, 1413, 2447, 3374,
-    2193, -1113, 906, 3084, 1816, -1041, -790, 205, -1198, -902,
-    -789, -2369, -5517, -2178, 658, 374, -1480, -468, 1331, 2539,
-    3161, 2782, 89, -520, 3101, 3363, -393, -2362, 959, 893,
-    -1989, -2378, -676, -3184, -4708, -873, 818, -1373, -1137, 1414,
-    1559, 1416, 4016, 3089, -1353, -226, 3760, 2566, -1483, -858,
-    680, -920, -1081, -646, -3162, -5180, -1746, 1273, -747, -1708,
-    260, 1853, 1655, 2838, 2807, 722, 64, 2313, 2205, 265,
-    -1391, 181, -188, -2106, -865, -853, -3498, -5106, -783, 556,
-    -459, -1609, 1200, 1996, 1962, 3163, 2781, -153, 375, 2797,
-    1878, -313, -1327, 1117, -1078, -1916, -1173, -1089, -4872, -3495,
-    456, 895, -1477, -1034, 1559, 1959, 2961, 3531, 1405, -1227,
-    1669, 3128, 1246, -2272, -181, 154, -1521, -1575, -931, -3378,
-    -4670, -928, 984, -686, -1568, 928, 1611, 2245, 3501, 3270,
-    -442, -178, 2748, 2872, -938, -1999, 351, -102, -1971, -1491,
-    -1358, -4236, -4109, 265, 858, -1580, -671, 2121, 1829, 2027,
-    3983, 2074, -845, 746, 3589, 1358, -1319, -803, 678, -1989,
-    -1693, -702, -1942, -4816, -2755, 823, 697, -1069, -755, 1741,
-    1536, 3340, 3655, 1128, -1493, 2071, 3275, 500, -2639, -229,
-    416, -1414, -1267, -1395, -3705, -4753, -188, 621, -964, -1500,
-    1347, 1509, 2488, 3930, 2603, -1309, 66, 3465, 2398, -1002,
-    -1470, 352, -1113, -650, -666, -2425, -4986, -2407, 197, 373,
-    -1037, -550, 1324, 1968, 2912, 3023, 1311, -658, 1353, 2480,
-    962, -1834, -372, 700, -1547, -1773, -628, -2436, -4886, -1822,
-    1116, -350, -1447, 1096, 1937, 1772, 3455, 2872, -539, -735,
-    3382, 2541, -1484, -1305, 1636, -341, -3093, -1219, -731, -3557,
-    -4228, -262, 595, -958, -354, 1539, 946, 1950, 4466, 2513,
-    -1740, 285, 4150, 1679, -2119, -1313, 869, -1102, -1567, -985,
-    -2559, -4865, -2130, 842, -105, -1553, 330, 2055, 1511, 3246,
-    3712, 678, -1333, 2100, 3166, 288, -1890, 69, -20, -1322,
-    -1091, -1996, -4092, -3857, 4, 613, -1008, -1489, 1609, 2117,
-    2063, 2868, 2352, 77, 805, 2823, 1426, -1159, -1001, 157,
-    -1284, -984, -510, -2389, -5416, -2671, 321, 519, -1106, -329,
-    1207, 2324, 3718, 3257, 504, -353, 2062, 1435, 939, 16,
-    -15, -1372, -1144, -859, -1599, -3715, -4020, -1651, 509, 725,
-    -1386, -195, 1678, 3390, 3157, 2304, -106, 684, 2390, 2164,
-    -582, -1479, -214, -874, -1101, -836, -1497, -4867, -3954, -538,
-    876, -1007, -849, 1154, 2498, 2986, 4057, 1251, -1049, 1652,
-    3049, 1078, -1517, 279, 718, -1443, -2485, -915, -2292, -4726,
-    -2341, 854, -240, -1856, -9, 2504, 1831, 2566, 3755, 566,
-    -773, 2494, 3184, -724, -1963, 1105, 92, -3009, -1008, -291,
-    -3665, -5041, -1110, 546, -810, -493, 1420, 1345, 2459, 4058,
-    2446, -616, 239, 3180, 1996, -869, -1335, 961, -795, -2535,
-    -1539, -1201, -4501, -3655, 407, 417, -1504, -541, 2072, 1723,
-    2715, 3889, 1654, -1527, 1539, 3724, 839, -2572, -256, 789,
-    -1475, -1562, -1203, -3202, -5070, -936, 879, -590, -1747, 1240,
-    2038, 2078, 3366, 3207, 5, -582, 3036, 2484, -684, -1868,
-    1163, -819, -2388, -1087, -937, -4555, -4323, 236, 307, -1488,
-    -192, 2296, 1204, 1944, 3992, 2604, -1200, 1140, 3631, 848,
-    -2174, -86, 844, -1987, -2028, -339, -2333, -5331, -2140, 642,
-    -472, -1184, 986, 1793, 1406, 3529, 4058, 490, -847, 2107,
-    2852, 371, -990, -298, -637, -1809, -596, -1444, -3953, -4274,
-    -1102, 613, -471, -833, 816, 1769, 2450, 3500, 2444, -325,
-    133, 3261, 1988, -1589, -1826, 1319, -544, -2354, -1446, -1488,
-    -5020, -3329, 1355, 158, -2346, 210, 2870, 1626, 2427, 4019,
-    1573, -1101, 1992, 3232, 310, -1553, 743, -148, -2374, -1851,
-    -241, -2878, -4974, -1887, 196, -349, -613, 1007, 1398, 1874,
-    3567, 3223, 109, -221, 2763, 2375, -482, -1401, 419, -547,
-    -2440, -1220, -1339, -3606, -4839, -603, 741, -674, -477, 1677,
-    1477, 2584, 4154, 2461, -1095, 425, 4046, 1354, -1801, -584,
-    959, -2103, -1559, -678, -2556, -5437, -2086, 751, -613, -1342,
-    1283, 1948, 1015, 3430, 3794, 786, -824, 2232, 2630, 163,
-    -1457, 568, -414, -2771, -1754, -269, -2782, -5406, -1923, 266,
-    -182, 122, 1342, 1153, 1392, 4217, 3368, -206, -464, 2987,
-    2527, -828, -1493, 848, 80, -2566, -1707, -1956, -3656, -3661,
-    -57, 233, -1431, -357, 2235, 1813, 1750, 3434, 2671, -331,
-    431, 3471, 1411, -1694, -477, 1266, -2263, -2707, -851, -1236,
-    -4481, -4085, -269, 90, -354, 823, 1857, 767, 2630, 4425,
-    1596, -1156, 1494, 3818, 412, -1766, 445, 180, -2217, -1672,
-    -613, -3481, -4918, -919, 590, -1283, -948, 1832, 1624, 1346,
-    3776, 3486, 7, -536, 2819, 2216, -836, -736, 1289, -797,
-    -3031, -1352, -1298, -3441, -4712, -1028, -32, -467, 307, 1835,
-    1173, 1413, 4195, 2815, -204, 400, 3850, 1531, -1439, -910,
-    1467, -1777, -2196, -705, -2558, -4743, -2489, 225, -1181, -1477,
-    942, 2547, 747, 3326, 3976, 947, -1132, 2223, 2964, 183,
-    -1298, 873, -462, -2207, -1045, -947, -3613, -5255, -1229, 205,
-    -673, -514, 1760, 827, 1619, 3879, 3631, -327, -84, 3189,
-    2501, -950, -918, 1014, -629, -2150, -1322, -1217, -4270, -3814,
-    -644, 9, -1658, -105, 1864, 1418, 1604, 3973, 2584, -717,
-    642, 3107, 1577, -880, -403, 241, -1014, -1443, -894, -2595,
-    -4447, -2933, -48, -602, -1032, 699, 2036, 983, 2256, 3809,
-    1615, -64, 1409, 2737, 588, -844, 451, 521, -2218, -1743,
-    -681, -2739, -5028, -2324, 206, -824, -1013, 1110, 1535, 749,
-    3143, 3749, 833, -742, 2719, 2928, -209, -1237, 954, -122,
-    -1696, -1648, -1621, -3473, -4034, -769, -162, -1246, -803, 1925,
-    1335, 2022, 3324, 2762, -321, 179, 3179, 2178, -601, -754,
-    353, -1470, -1490, -744, -1983, -5012, -3322, 142, -411, -1164,
-    179, 1589, 1413, 2731, 3676, 2064, -550, 1206, 3062, 1311,
-    -1040, -35, 429, -2084, -1789, -737, -1986, -5297, -2905, 216,
-    -152, -1138, 1147, 1571, 1246, 3053, 3442, 1199, -239, 2441,
-    2191, 287, -620, 357, -647, -1871, -1989, -1366, -3167, -4376,
-    -1971, -580, -346, -134, 900, 1135, 2249, 3786, 3778, 451,
-    -69, 2536, 2623, 229, -967, -115, -822, -1454, -1370, -2275,
-    -4725, -3957, -361, 62, -1618, -582, 1777, 2294, 2657, 3331,
-    2056, 140, 1551, 3103, 955, -879, -659, 558, -1019, -2593,
-    -2069, -2121, -3905, -3601, -1064, -288, -294, 133, 1909, 1450,
-    2809, 4212, 2784, -563, 969, 3114, 1892, -983, -1108, 616,
-    -1252, -2267, -2022, -2252, -4586, -2589, -560, -242, -1276, 820,
-    2211, 1572, 2633, 3896, 1821, -318, 1989, 2676, 584, -1817,
-    -142, -74, -1485, -1884, -2031, -3658, -4232, -2063, -354, -583,
-    -357, 1447, 1952, 2199, 3625, 3502, 924, 150, 2770, 2836,
-    -179, -1248, 399, -921, -2365, -1273, -1835, -4126, -4167, -1203,
-    -629, -990, 224, 1544, 1040, 2548, 4121, 2798, 300, 794,
-    2272, 1319, -451, -257, 433, -1428, -2593, -1458, -1889, -3904,
-    -3688, -1319, -396, -311, 671, 1646, 1299, 2678, 4682, 2253,
-    -556, 1031, 3374, 1297, -733, -479, 78, -1852, -1735, -1291,
-    -2650, -4813, -3139, -451, -479, -366, 644, 1172, 1167, 3321,
-    4048, 2064, -647, 1180, 3011, 1603, -1165, -737, -438, -1692,
-    -1376, -1216, -3115, -4989, -2439, 104, -433, -807, 1005, 1424,
-    1748, 3724, 3483, 970, 544, 2429, 2199, 370, -513, 268,
-    -101, -2135, -2031, -1976, -2960, -3882, -2002, -1051, -976, -157,
-    1215, 1194, 1453, 3781, 3288, 1202, 127, 2275, 2159, 744,
-    -916, -251, -891, -1650, -1026, -1602, -3821, -4692, -1517, -171,
-    -308, -861, 1048, 1350, 2391, 3693, 2756, 339, 720, 2795,
-    2080, -69, -375, 504, -1295, -1927, -1551, -1724, -3657, -3977,
-    -1744, -700, -442, 31, 728, 1139, 2341, 3782, 2958, 391,
-    793, 2764, 1753, -350, -369, 482, -1340, -1887, -1284, -1736,
-    -3829, -3810, -1721, -478, -152, 254, 935, 887, 2484, 3998,
-    2614, -173, 1138, 2615, 1923, -202, -534, -57, -1198, -1782,
-    -1522, -2012, -3716, -3149, -1200, -403, -835, 201, 1190, 1261,
-    2435, 3960, 2331, -255, 1044, 2939, 1399, -941, -291, 446,
-    -1781, -2127, -1158, -1930, -4300, -3132, -305, -384, -995, 784,
-    1471, 644, 2752, 4058, 2313, -427, 1428, 3081, 1593, -1359,
-    -881, -81, -1306, -1861, -1117, -2073, -4930, -3240, -64, -127,
-    -1065, 407, 1709, 1664, 2541, 3994, 1929, -260, 1344, 3030,
-    1001, -1007, -5, 567, -2540, -2551, -1355, -1637, -3807, -2931,
-    -745, -994, -57, 1319, 1118, 493, 3200, 3973, 2309, -61,
-    1234, 2177, 1301, -661, -716, 75, -1549, -2099, -1787, -2117,
-    -4195, -3227, -96, -42, -671, 425, 1921, 1426, 2294, 3874,
-    2337, -186, 1730, 3204, 939, -960, -1009, -94, -1657, -1492,
-    -1516, -2326, -4453, -2941, -705, -558, -152, 672, 1311, 1438,
-    2815, 3763, 2386, -201, 1212, 2544, 1546, -523, -687, -251,
-    -2279, -2314, -904, -1820, -4078, -3641, -295, -22, -498, 492,
-    1626, 1194, 2817, 4286, 2437, -162, 951, 2385, 996, -369,
-    -797, -183, -2093, -1970, -1704, -1720, -3845, -3877, -1024, 415,
-    -276, 69, 1959, 1862, 2489, 3817, 3080, -91, 1165, 2740,
-    732, -974, -70, 169, -2379, -2341, -1108, -1964, -3696, -3705,
-    -1138, -489, -223, 904, 1414, 1424, 2458, 4060, 2886, 62,
-    885, 3009, 931, -996, -353, 564, -2178, -2933, -910, -1717,
-    -3869, -3876, -1058, -49, -330, 136, 1425, 1446, 2634, 4254,
-    3104, 501, 476, 2622, 1375, -514, -933, 530, -1410, -2928,
-    -1515, -1413, -3621, -4542, -1600, -182, -183, 199, 1558, 1236,
-    2135, 4135, 3915, 539, 235, 2268, 2155, -79, -1315, 147,
-    -1107, -2558, -1761, -1089, -3741, -4350, -1682, 377, -656, -313,
-    1799, 1688, 1898, 3700, 3416, 323, 862, 2646, 1284, -511,
-    29, 463, -2162, -3200, -1146, -845, -3171, -4748, -2147, -382,
-    152, 786, 1045, 840, 2202, 4301, 3686, 683, 419, 2501,
-    1832, 236, -1208, -74, -464, -2028, -2640, -1838, -2302, -4231,
-    -2521, -172, -280, -368, 1801, 1865, 878, 2851, 4610, 1677,
-    -506, 2034, 2163, 333, -868, 193, -1104, -2682, -1680, -1625,
-    -1969, -4588, -3192, 12, 228, -522, 959, 1904, 1580, 2579,
-    4403, 2708, -531, 1105, 2462, 727, -1190, 279, -48, -2954,
-    -2526, -683, -1485, -4394, -4010, -770, -60, 261, 1246, 1455,
-    1230, 2452, 4599, 2436, -589, 1311, 2719, 778, -576, -152,
-    355, -2088, -2550, -1573, -1796, -3517, -3470, -790, -865, -223,
-    788, 1458, 1407, 2454, 3763, 2998, 701, 680, 1803, 1126,
-    -402, -1076, 498, -963, -2731, -1963, -1083, -3205, -5441, -1574,
-    1153, -617, -61, 1992, 1677, 1278, 4030, 4024, 507, 138,
-    2887, 1954, -1079, -751, 916, -1194, -3237, -1552, -787, -2503,
-    -4915, -2525, -495, -346, 377, 1619, 1572, 1552, 3605, 3968,
-    921, -277, 2051, 2389, 172, -1447, 232, -64, -2769, -2645,
-    -1171, -2024, -4025, -2694, -97, -1168, -361, 2110, 2510, 612,
-    2692, 5092, 2147, -433, 889, 2596, 657, -805, -315, -186,
-    -2697, -2568, -1168, -1339, -4242, -4218, -498, 321, -363, 445,
-    2073, 1457, 2196, 4458, 3074, 271, 602, 2027, 1107, -1045,
-    -926, 675, -963, -3336, -2316, -1003, -2648, -4938, -1113, 525,
-    -309, 384, 2700, 1602, 883, 4864, 3912, -183, -375, 3810,
-    1124, -1794, -801, 958, -1943, -3102, -1403, -1621, -3232, -4260,
-    -978, -848, -691, 796, 2356, 1145, 1454, 4279, 4190, 588,
-    -181, 2135, 1612, -215, -408, 155, -1172, -2735, -1959, -1437,
-    -2266, -4409, -2660, 157, 183, 201, 1189, 2320, 586, 3132,
-    4630, 2286, -989, 1446, 2663, 91, -1682, -350, -47, -2823,
-    -1920, -1362, -1747, -5010, -2718, -109, -587, -583, 2086, 2518,
-    663, 2606, 4993, 2279, -874, 1304, 2407, 994, -450, 6,
-    -904, -2644, -2185, -870, -1674, -3844, -3751, -518, -372, -554,
-    958, 2626, 1077, 1360, 4359, 3468, 180, 150, 1808, 895,
-    -504, -365, 468, -2399, -2872, -1296, -889, -3720, -4617, -1214,
-    705, -372, 278, 1909, 1980, 1569, 3677, 3850, 813, 230,
-    2081, 2180, -923, -1452, 73, -429, -3163, -1875, -501, -2150,
-    -5375, -2520, 401, -512, -215, 2147, 2493, 400, 3086, 4553,
-    1207, -627, 1686, 2024, 43, -1047, 174, -471, -2625, -2790,
-    -1296, -965, -3683, -3688, 332, 129, -577, 1113, 2893, 1220,
-    1946, 5034, 2970, -715, -80, 2606, 242, -981, -588, 189,
-    -2250, -2495, -1481, -1307, -3816, -4562, -397, 308, -226, 574,
-    2590, 1318, 1528, 3933, 3913, 51, -387, 2401, 1931, -1243,
-    -1205, 644, -1671, -2831, -966, -752, -3672, -4624, -877, 612,
-    -1023, 125, 2762, 2098, 876, 3579, 3626, 536, -288, 2059,
-    1587, -850, -794, 356, -1376, -3426, -1713, -323, -2049, -4955,
-    -2515, 152, 292, 204, 1390, 1766, 1328, 3828, 4854, 968,
-    -816, 1852, 1843, 171, -922, -198, -791, -1903, -2248, -1859,
-    -1701, -3471, -3567, -716, 93, -179, 1089, 1917, 1421, 2065,
-    4568, 2795, -294, -3, 2321, 1091, -1304, -1012, 142, -1748,
-    -2848, -1432, -678, -3186, -4934, -606, 850, -347, 291, 2822,
-    1689, 1350, 4162, 4349, 330, -573, 2197, 1554, -932, -1285,
-    563, -1704, -3316, -1651, -826, -2753, -4378, -2340, -189, -123,
-    903, 1719, 1285, 1321, 4015, 4384, 1012, -317, 1270, 1787,
-    337, -1050, -1213, -667, -2091, -1878, -1813, -1851, -3982, -2891,
-    374, -103, -376, 1084, 2887, 1598, 2636, 4297, 2580, -55,
-    1017, 1508, 175, -680, -347, -396, -3208, -2795, -1359, -908,
-    -3460, -4563, -1261, 931, 144, 609, 1660, 1336, 2503, 4533,
-    3615, 71, 278, 2078, 1649, -923, -1343, -125, -1371, -2581,
-    -1914, -1383, -2124, -4723, -2409, 337, 118, 621, 1471, 1860,
-    1103, 3565, 4625, 1432, -515, 1354, 2021, 304, -1007, -733,
-    -1553, -2157, -2007, -1157, -1936, -4290, -3497, -119, 630, -234,
-    1011, 2134, 1871, 2005, 4761, 2798, -54, 588, 2058, 899,
-    -736, -260, -162, -3428, -3445, -718, -454, -3558, -5167, -722,
-    220, 290, 588, 2105, 746, 1664, 4907, 3833, 73, 427,
-    2005, 815, -303, -375, -75, -2032, -2665, -2371, -927, -1799,
-    -3753, -3619, -132, 732, 581, 1120, 1578, 1336, 2897, 4893,
-    2310, -325, 490, 2184, 814, -1456, -998, -75, -2190, -2974,
-    -1617, -486, -3867, -4021, -504, 325, -517, 989, 3057, 1206,
-    1103, 4430, 3867, -54, 349, 1987, 1003, -951, -661, -504,
-    -2234, -2848, -929, -887, -3159, -4319, -1478, 206, -30, 373,
-    1679, 2002, 1344, 3921, 4190, 1045, -339, 1498, 1634, 478,
-    -841, -658, -1581, -2769, -2200, -632, -1033, -4762, -3792, 393,
-    886, -223, 620, 2002, 1283, 2364, 4984, 2483, -413, 679,
-    1736, 313, -517, -152, -800, -2878, -2591, -970, -606, -3067,
-    -4485, -1705, 666, 1053, 781, 1015, 1534, 2163, 4035, 3519,
-    655, 87, 1432, 1360, -674, -1151, -61, -1036, -3409, -2493,
-    -559, -1199, -4303, -2939, -72, 516, 910, 1569, 1726, 780,
-    3242, 4867, 1796, -896, 639, 2122, 1089, -519, -1097, -1270,
-    -2358, -2488, -1173, -737, -3493, -4160, -350, 972, 128, 619,
-    1946, 1414, 1819, 4374, 3301, 318, -134, 1311, 662, -785,
-    -479, -4, -2255, -3254, -1483, -571, -2700, -4593, -1689, 522,
-    301, 681, 2312, 1491, 1213, 3609, 4132, 870, -137, 1551,
-    1566, -483, -919, 411, -1212, -3244, -2386, -437, -1470, -3918,
-    -3153, 218, 275, 245, 1584, 1911, 988, 2528, 4398, 1990,
-    -154, 437, 1868, 139, -1021, -128, -461, -2753, -2535, -926,
-    -870, -3125, -4448, -968, 746, 582, 785, 1744, 1415, 1887,
-    4098, 3407, -128, -416, 2193, 1560, -888, -1028, 172, -1445,
-    -2948, -1674, -779, -2612, -3879, -1516, 59, -205, 762, 1745,
-    1678, 1102, 3212, 4288, 1505, -450, 681, 1445, -40, -636,
-    -53, -1352, -2982, -1305, -501, -2057, -4508, -2970, 41, 147,
-    420, 1529, 1325, 1259, 3035, 3818, 1658, 77, 1032, 1317,
-    615, -443, -337, -563, -1985, -2867, -925, -591, -2870, -4427,
-    -1333, 871, 96, 619, 2015, 1752, 1165, 3811, 3622, 701,
-    -624, 1586, 1469, -734, -914, 598, -1425, -3397, -1843, -104,
-    -1572, -4453, -3110, 87, 505, 560, 1669, 1467, 1042, 2639,
-    4904, 1599, -1074, 484, 2633, 85, -1087, -344, 0, -2266,
-    -2159, -284, -1631, -3821, -3342, -48, 21, 392, 639, 2242,
-    812, 1995, 4053, 3152, -416, 69, 1866, 942, -806, -778,
-    136, -1760, -2229, -1577, -353, -2829, -4083, -2588, 472, 319,
-    836, 1471, 1515, 806, 3027, 4413, 1301, -625, 681, 2053,
-    22, -123, -457, -1086, -2819, -1694, -377, -882, -3731, -3633,
-    -623, 371, 346, 728, 2065, 868, 2026, 4673, 3134, -855,
-    -229, 2056, 897, -952, -332, 209, -1980, -2866, -1253, -570,
-    -2872, -4076, -1722, 419, 385, 654, 1579, 1273, 1052, 3655,
-    4386, 1084, -725, 676, 2213, 160, -1111, -176, -650, -2700,
-    -2221, -406, -1093, -4246, -3674, 273, 369, -160, 1552, 2214,
-    236, 1878, 4977, 2634, -938, 254, 2166, 862, -909, -495,
-    -587, -2003, -2265, -866, -874, -3156, -4296, -1367, 581, 61,
-    685, 2008, 1586, 874, 3742, 3999, 851, -953, 1217, 1724,
-    126, -733, -31, -1239, -2757, -1729, -687, -1549, -4229, -3024,
-    -200, 711, 207, 1221, 1762, 1356, 2282, 4320, 2436, -584,
-    -15, 1752, 1021, -338, -190, -353, -2472, -2705, -364, -546,
-    -3525, -4337, -780, 703, 176, 403, 1806, 1354, 1586, 3862,
-    3544, 19, -688, 1635, 1865, -449, -1049, -84, -901, -2601,
-    -1700, -451, -2208, -4423, -2549, 556, -70, 47, 1486, 1960,
-    728, 2593, 4529, 1931, -740, 217, 2388, 755, -818, -328,
-    -277, -2408, -2429, -100, -812, -3812, -4239, -357, 637, 26,
-    834, 1686, 957, 1627, 4213, 3046, 236, -328, 1173, 1060,
-    -313, -295, -528, -1837, -2476, -776, -575, -2783, -4267, -2211,
-    416, 440, 433, 1157, 1871, 1410, 2945, 3916, 1598, -584,
-    597, 2020, 718, -810, -476, -897, -2213, -1745, -379, -1228,
-    -4021, -3438, -220, 657, -317, 823, 1628, 1416, 1964, 3748,
-    2626, -387, -118, 1219, 949, -549, 58, -305, -2406, -2984,
-    -479, 293, -3007, -4491, -1813, 962, 471, 834, 1314, 1310,
-    1386, 3820, 4166, 933, -429, 378, 964, 108, -65, -314,
-    -836, -2586, -1669, -558, -1629, -4106, -2946, -113, 481, 448,
-    1165, 1736, 945, 2090, 3781, 2289, -337, 404, 1152, 325,
-    -676, -467, -582, -1528, -2359, -715, -297, -2601, -4531, -1288,
-    1222, 542, 630, 1910, 1623, 1187, 3408, 3219, 413, -782,
-    1215, 1238, -136, -587, -442, -1673, -2653, -1367, 60, -1662,
-    -3985, -2857, 8, 488, 428, 1190, 1775, 1367, 2219, 3610,
-    1917, -347, 70, 1174, 471, -482, -218, -628, -1858, -2051,
-    -878, -811, -2569, -3400, -1288, 916, 416, 593, 1363, 1669,
-    1740, 3436, 2949, 411, -253, 770, 704, -406, -248, -336,
-    -1662, -2355, -1114, -218, -2346, -4517, -2567, 456, 848, 563,
-    896, 1100, 1371, 2925, 4032, 1630, -598, 284, 1439, 311,
-    -770, -109, -280, -2363, -2319, -168, -248, -3514, -3909, -1165,
-    303, 796, 1399, 1691, 820, 1638, 3906, 3334, -80, -605,
-    1054, 1141, 30, -853, -557, -1758, -2463, -1052, -200, -2285,
-    -4118, -2113, -252, 426, 387, 1518, 1471, 1487, 2940, 3824,
-    1808, -237, -43, 374, 999, 31, -554, -1302, -1884, -2308,
-    -513, -172, -3321, -4614, -889, 1280, 354, 361, 1647, 1535,
-    1271, 3849, 3744, 430, -1077, 1064, 983, -455, -607, 303,
-    -1615, -2923, -1324, 279, -1818, -4477, -2498, 91, 379, 354,
-    1616, 1535, 1375, 2765, 3900, 1511, -279, 374, 1289, 317,
-    -340, -167, -808, -1878, -1788, -961, -786, -2804, -3849, -1461,
-    924, 575, 129, 1270, 1531, 1648, 3318, 3825, 390, -1246,
-    511, 2286, -241, -885, -138, -1256, -2635, -981, 26, -2382,
-    -4473, -2644, 616, 195, 249, 1016, 1358, 947, 2919, 3735,
-    1848, -213, 196, 1005, 793, -4, -352, -545, -1800, -2151,
-    -680, -456, -3217, -3962, -1502, 768, 347, 498, 1422, 1400,
-    1372, 3757, 3306, 237, -654, 815, 1474, 329, -560, -751,
-    -998, -2085, -1037, -245, -1932, -4566, -2801, 485, 1098, -125,
-    786, 1835, 1209, 2250, 3714, 1953, -599, 181, 1470, 838,
-    -523, -635, -772, -1720, -2353, -516, -181, -3124, -4443, -1384,
-    919, 668, 412, 1430, 1442, 1426, 3527, 3382, -68, -885,
-    1407, 1517, -63, -345, -825, -1510, -1853, -1276, -502, -1694,
-    -3410, -2627, -362, 691, 697, 572, 1802, 1363, 2151, 3715,
-    2637, -876, -699, 1552, 1178, -484, -535, -412, -2649, -2124,
-    -75, -144, -3936, -4071, -611, 1027, 247, 418, 1349, 906,
-    1701, 3452, 3369, 129, -615, 1105, 1202, -523, -278, 145,
-    -1344, -2591, -1639, -283, -1584, -3502, -2851, -569, 743, 1084,
-    978, 1022, 1118, 2453, 3768, 2173, -513, 36, 1589, 1162,
-    -935, -687, -534, -1676, -1777, -397, -786, -3426, -3670, -1143,
-    919, 265, 549, 1142, 1007, 1363, 3448, 3102, 369, -512,
-    826, 1136, 257, -328, -425, -1237, -2516, -1463, 71, -1196,
-    -3991, -3249, -276, 1180, 521, 737, 1298, 1025, 2127, 4067,
-    2164, -745, 13, 1958, 763, -781, 11, -88, -1896, -2548,
-    -604, -558, -2671, -3671, -1689, 247, 596, 372, 886, 1155,
-    1392, 3100, 3415, 623, -630, 893, 1523, 457, -600, -504,
-    -855, -1793, -1854, -280, -995, -3858, -3382, 100, 1289, -33,
-    324, 1383, 1070, 1799, 3645, 2727, -352, -546, 1456, 1098,
-    -670, -507, 180, -1481, -2974, -922, 672, -2042, -4722, -2331,
-    569, 986, 796, 1278, 820, 713, 2953, 3714, 1267, -784,
-    214, 1618, 798, -858, -657, -593, -1579, -1961, -179, -689,
-    -3497, -3559, -390, 852, -23, 798, 1561, 1206, 1326, 3272,
-    2554, -129, -463, 1322, 1305, -275, -261, -164, -1638, -2517,
-    -890, 177, -1901, -3952, -2244, 200, 910, 526, 778, 751,
-    1097, 3047, 3688, 1148, -770, 332, 1405, 482, -440, -427,
-    -473, -1609, -2018, -507, -441, -2848, -3700, -884, 443, 407,
-    486, 1471, 982, 1287, 3391, 3122, 121, -916, 1141, 1748,
-    -213, -1267, 3, -577, -2433, -1485, 471, -1891, -4321, -2521,
-    351, 466, 264, 1214, 1025, 744, 2808, 4245, 1637, -1145,
-    -51, 1884, 1275, -613, -441, -345, -1758, -2025, -635, -469,
-    -2983, -3808, -1302, 847, 155, 264, 1517, 901, 975, 3423,
-    3662, 679, -982, 652, 1627, 150, -834, -227, -543, -2018,
-    -1807, -339, -1112, -3810, -3242, -1, 879, 291, 917, 1312,
-    898, 2037, 3920, 2501, -70, -197, 1319, 773, -371, -349,
-    -596, -1265, -2140, -1501, -327, -1804, -4382, -2983, 553, 1501,
-    582, 683, 1008, 1132, 2732, 3981, 1294, -1214, 416, 2188,
-    319, -1050, -87, -388, -2390, -1990, -231, -881, -3334, -2841,
-    -817, 27, 695, 1211, 1444, 763, 2011, 3544, 2896, -228,
-    -194, 1603, 1107, -642, -559, -265, -1375, -2100, -1408, -368,
-    -2075, -3871, -2517, 32, 706, 745, 830, 990, 1191, 2916,
-    3830, 1264, -625, 557, 1543, 628, -360, -472, -940, -1546,
-    -1897, -850, -744, -2707, -3408, -1459, 562, 801, 907, 801,
-    1159, 1762, 3436, 3072, 348, -706, 999, 1596, -75, -709,
-    -610, -1248, -2148, -1254, -174, -1359, -4241, -3237, 152, 1487,
-    352, 233, 1240, 1496, 2173, 3418, 2281, -216, -100, 1309,
-    923, -359, -115, -163, -1772, -2736, -763, 178, -1971, -4241,
-    -2439, 464, 1364, 578, 534, 991, 988, 2915, 3683, 1159,
-    -1125, 644, 1956, 92, -1132, 86, -121, -2492, -2113, -173,
-    -696, -3587, -3034, -919, 438, 901, 970, 699, 767, 2082,
-    3474, 2848, -171, -106, 1532, 1439, -411, -457, -244, -1332,
-    -2273, -1111, 42, -2199, -3966, -2275, -289, 453, 856, 1024,
-    625, 983, 2791, 3813, 1515, -514, 352, 1668, 1025, -342,
-    -290, -920, -1892, -1911, -381, -739, -2994, -3823, -1219, 727,
-    346, 280, 1187, 1209, 1331, 3275, 3260, 654, -578, 1190,
-    1843, -57, -873, -166, -880, -2061, -1485, -447, -1601, -3500,
-    -2743, -417, 405, 174, 809, 1325, 1046, 1907, 3671, 2350,
-    -239, -161, 1797, 1093, -628, -122, -224, -1886, -1995, -114,
-    -781, -3164, -3729, -1244, 233, 684, 697, 529, 562, 1675,
-    3250, 2710, 1096, -47, 531, 1158, 595, -568, -484, -578,
-    -2184, -1869, 146, -678, -4194, -3390, -412, 685, 371, 763,
-    1165, 596, 1723, 3581, 2926, -114, -119, 1243, 1517, -276,
-    -552, 117, -945, -2587, -1250, 418, -1931, -3978, -2444, 193,
-    480, 385, 973, 866, 748, 2771, 3551, 869, -559, 748,
-    1688, 469, -569, -380, -491, -1379, -1866, -809, -654, -2569,
-    -3579, -1194, 649, 448, 225, 1105, 1024, 1407, 3384, 3318,
-    80, -947, 1404, 1972, 28, -854, -375, -902, -1761, -1286,
-    -103, -1667, -3934, -2893, 120, 855, 16, 315, 1289, 1246,
-    1821, 3542, 2283, -529, -296, 1728, 1031, -587, -413, -334,
-    -1565, -2235, -477, -270, -2529, -3897, -1730, 301, 927, 677,
-    646, 847, 1547, 3404, 3220, 856, -774, 858, 1816, 751,
-    -1045, -843, -384, -1445, -1927, -857, -789, -3135, -3301, -641,
-    1109, -107, 94, 1570, 1347, 1443, 3323, 2743, -262, -456,
-    1464, 1258, -617, -677, -225, -1357, -2189, -937, -414, -1907,
-    -3706, -2351, -36, 1267, 578, 574, 782, 1522, 2491, 3397,
-    2063, -600, 0, 1724, 1644, -1011, -962, -590, -785, -2303,
-    -765, -107, -2569, -4239, -1493, 1021, 351, 386, 950, 1274,
-    668, 2644, 3399, 1073, -1212, 565, 1877, 502, -911, -695,
-    -739, -1819, -1486, -150, -1013, -3521, -3128, -236, 969, 198,
-    412, 1401, 1248, 1442, 3353, 2510, -41, -173, 1536, 899,
-    -279, -414, -281, -1243, -2167, -1137, -216, -1448, -3879, -2469,
-    -11, 1129, 236, 549, 930, 1235, 2165, 3469, 1977, -946,
-    -159, 1734, 1568, -701, -849, -772, -854, -1830, -813, -417,
-    -2374, -3906, -1580, 1069, 594, 13, 785, 1504, 706, 2487,
-    3610, 1263, -1277, 590, 2194, 391, -1128, -536, -390, -1738,
-    -1114, -325, -1250, -3666, -2978, -424, 678, 20, 369, 1259,
-    943, 1551, 2713, 2724, 441, -120, 1134, 1766, -115, -761,
-    -639, -1018, -1568, -1048, -316, -1457, -3878, -3361, -155, 1216,
-    491, 181, 1006, 1145, 1907, 3205, 2471, -688, -383, 1965,
-    1997, -412, -898, -586, -1027, -1686, -827, -391, -2301, -3323,
-    -1954, -64, 260, 332, 757, 1273, 1106, 2137, 3166, 1428,
-    -775, 78, 1883, 1132, -493, -469, -580, -1776, -1695, -155,
-    -945, -3157, -3241, -972, 602, 229, 154, 950, 1109, 1257,
-    2984, 2786, 489, -265, 1232, 1518, 103, -232, -41, -485,
-    -1883, -1691, -575, -1024, -3238, -2900, -456, 570, 148, 488,
-    1170, 644, 1570, 3407, 2474, -522, -368, 2045, 1448, -1048,
-    -749, 390, -926, -2125, -797, -662, -2789, -3598, -1050, 368,
-    110, 92, 1248, 910, 602, 2543, 3375, 1188, -468, 1020,
-    1651, 615, -616, -303, -690, -1339, -1471, -594, -1039, -3018,
-    -3472, -1264, 749, 715, 156, 460, 1051, 1623, 2804, 2708,
-    417, -614, 1400, 1886, 186, -894, -378, -725, -1473, -1390,
-    -466, -1454, -3350, -2817, -719, 881, 514, 771, 934, 960,
-    1495, 3301, 2423, -266, -323, 1760, 1680, -710, -613, -350,
-    -1018, -2149, -731, -306, -2148, -3861, -2074, 235, 475, 238,
-    836, 1263, 977, 2459, 3162, 1508, -879, 255, 2209, 1289,
-    -1068, -651, -397, -1398, -1846, -476, -938, -3102, -3200, -880,
-    473, 165, 316, 870, 1303, 1297, 3088, 2698, 455, -617,
-    1175, 1641, 318, -900, -501, -512, -2103, -1600, -106, -1169,
-    -3916, -2591, 228, 884, -252, 353, 1352, 1178, 2055, 3548,
-    2234, -566, -281, 1790, 1618, -688, -1377, -270, -622, -2218,
-    -1556, -411, -2123, -3740, -1605, 554, 535, -40, 974, 1120,
-    1007, 2590, 3609, 1289, -607, 767, 1664, 678, -650, -658,
-    -757, -1221, -1873, -933, -771, -2731, -3372, -953, 1009, 302,
-    -23, 1282, 1414, 1046, 2824, 3537, 679, -1005, 866, 1981,
-    -62, -1240, -391, -525, -1696, -1857, -541, -1428, -3573, -2779,
-    165, 835, 56, 557, 1227, 1081, 1577, 3461, 2321, 19,
-    47, 1627, 914, -640, -412, -263, -1242, -1751, -634, -976,
-    -2259, -3452, -1954, -28, 739, 309, 771, 897, 894, 2231,
-    3260, 1547, -264, 501, 1347, 867, -409, -822, -579, -667,
-    -1725, -983, -734, -2369, -3976, -1702, 1007, 1042, -328, 813,
-    1580, 1053, 2175, 3173, 1291, -895, 965, 2304, 514, -1438,
-    -395, -231, -1393, -1665, -252, -1033, -3564, -3015, -686, 451,
-    258, 430, 925, 1120, 1345, 2943, 2607, 139, -288, 1176,
-    1844, 311, -1090, -889, -433, -1563, -1424, -473, -1373, -3501,
-    -2999, -101, 1196, 175, 85, 1404, 1153, 1554, 3148, 2474,
-    -341, -194, 1676, 1597, -341, -853, -494, -865, -1852, -1234,
-    -309, -1905, -3895, -2494, 378, 965, 450, 478, 1142, 1001,
-    2106, 3361, 2066, -686, -24, 1974, 1315, -532, -1121, -486,
-    -960, -1610, -1239, -569, -2373, -3626, -1951, 523, 1008, 101,
-    801, 1373, 1337, 1969, 3336, 1565, -499, 317, 1781, 862,
-    -469, -552, -857, -1443, -1798, -555, -634, -2912, -3934, -1330,
-    925, 825, -60, 685, 1210, 1404, 2507, 3267, 919, -967,
-    539, 2208, 690, -1120, -347, -296, -1748, -2214, 252, -450,
-    -3677, -3942, -234, 1150, 285, 211, 851, 886, 1263, 3298,
-    2973, 314, -738, 1404, 1641, -156, -590, -5, -852, -2063,
-    -1237, -238, -1332, -3488, -3276, -770, 1130, 720, 197, 470,
-    831, 1793, 3202, 2599, 99, -435, 1757, 1721, -588, -727,
-    150, -312, -1920, -1294, -215, -1760, -4081, -2266, 154, 522,
-    138, 683, 844, 396, 1932, 3377, 2125, -409, 231, 1903,
-    1259, -754, -589, -85, -817, -1679, -837, -556, -2736, -3960,
-    -1778, 472, 767, 192, 246, 805, 1318, 2486, 3008, 1632,
-    -302, 711, 2119, 1041, -470, -482, -539, -865, -1248, -1121,
-    -927, -2906, -3875, -1764, 678, 731, -141, 280, 773, 1181,
-    2533, 3214, 1060, -361, 707, 1958, 833, -534, -580, -657,
-    -1279, -1205, -316, -1095, -3432, -3608, -881, 1069, 485, -129,
-    724, 1061, 1699, 2831, 2800, 792, -49, 1046, 1887, 240,
-    -670, -410, -725, -1416, -1347, -594, -1475, -3420, -3763, -951,
-    1349, 632, -518, 433, 1195, 1747, 3041, 2708, 476, -247,
-    1477, 2099, 142, -949, -494, -538, -1415, -1093, -360, -1761,
-    -3959, -3082, -126, 970, 258, 55, 554, 769, 2038, 3541,
-    2277, 36, -17, 1774, 1817, -108, -938, -341, -701, -1664,
-    -893, -265, -2166, -4365, -2663, 223, 807, -115, 321, 830,
-    599, 2067, 3582, 2125, -24, 204, 1798, 1676, -256, -885,
-    -198, -716, -1492, -812, -477, -2535, -4313, -2388, 328, 809,
-    -85, 365, 861, 817, 2162, 3374, 1770, -43, 502, 1674,
-    1513, 3, -856, -700, -788, -1328, -784, -564, -2871, -4089,
-    -1972, 427, 622, -149, 441, 1076, 1109, 2151, 3112, 1575,
-    -180, 804, 2293, 997, -620, -489, -653, -1233, -1305, -410,
-    -962, -3387, -3683, -1321, 480, 275, -230, 430, 1133, 1590,
-    2937, 3016, 673, -577, 1048, 2390, 877, -553, -447, -667,
-    -1487, -1300, -470, -1462, -3522, -3243, -795, 517, 2, 69,
-    739, 733, 1569, 3251, 2926, 758, -320, 1083, 2041, 350,
-    -528, -34, -497, -1848, -1373, -334, -1575, -3822, -2953, -331,
-    332, -63, 432, 696, 710, 1854, 2987, 2623, 733, 172,
-    1211, 1173, 76, -222, -203, -469, -1565, -1488, -572, -1529,
-    -3794, -3154, -330, 968, 245, -28, 846, 1089, 1667, 3051,
-    2511, 153, 4, 1548, 1630, -211, -779, -87, -395, -1485,
-    -1214, -486, -1909, -3958, -2926, -155, 1049, 272, 121, 705,
-    794, 1941, 3147, 2108, -18, -75, 1880, 1722, -420, -640,
-    -516, -763, -775, -660, -937, -2545, -3845, -1944, 319, 238,
-    -30, 870, 1075, 730, 1811, 2995, 1797, -149, 594, 1833,
-    1096, -161, -380, -593, -949, -1314, -680, -701, -2588, -3710,
-    -2053, -80, 411, -6, 266, 1202, 1240, 1786, 2594, 1874,
-    195, 465, 1857, 1283, -621, -485, -109, -785, -1297, -733,
-    -942, -2869, -3571, -1408, 273, 82, -105, 591, 938, 976,
-    2019, 2631, 1601, -61, 555, 1992, 1265, -596, -534, -218,
-    -822, -1558, -818, -673, -2750, -3901, -1608, 493, 306, 47,
-    382, 822, 1204, 2267, 2785, 1531, 9, 604, 1897, 1181,
-    -552, -237, -267, -1080, -1331, -632, -740, -2757, -3972, -1551,
-    505, 319, 255, 446, 595, 826, 2305, 3075, 1373, -361,
-    709, 2053, 928, -517, -229, -445, -1258, -1325, -677, -978,
-    -2615, -3701, -1949, 481, 556, -74, 652, 1036, 1090, 2040,
-    2869, 1674, -114, 383, 2012, 1373, -515, -492, -351, -1194,
-    -1505, -394, -872, -3088, -3663, -1340, 356, 318, 234, 593,
-    548, 1277, 2295, 2834, 1544, -134, 385, 1569, 1363, -142,
-    -776, -784, -824, -1810, -793, -300, -2802, -4275, -1667, 855,
-    561, 144, 647, 712, 981, 2476, 3294, 1694, -230, 351,
-    1321, 1272, 303, -545, -1039, -1019, -1257, -880, -944, -2588,
-    -3468, -2122, 28, 754, 489, 366, 783, 1188, 1958, 2798,
-    2081, -98, 95, 1646, 1134, -299, -406, -186, -1116, -1605,
-    -928, -612, -2515, -3623, -1836, 349, 781, 215, 352, 819,
-    1348, 2103, 2961, 1758, -284, 416, 1624, 1060, -319, -596,
-    -527, -1129, -1388, -803, -722, -2787, -3818, -1845, 377, 684,
-    272, 438, 604, 1038, 2304, 3204, 1535, -146, 412, 1635,
-    1171, -330, -639, -384, -838, -1525, -1006, -579, -2279, -3997,
-    -2037, 406, 712, 366, 512, 716, 920, 2145, 3261, 1792,
-    -175, 434, 1642, 829, -312, -471, -406, -810, -1313, -1132,
-    -1111, -2236, -3696, -2028, 27, 1005, 464, 195, 601, 1242,
-    2026, 2870, 2180, 66, 301, 1447, 1377, -278, -604, -652,
-    -687, -1275, -1147, -882, -2110, -3812, -2590, 84, 1161, 400,
-    -124, 688, 1265, 1719, 2744, 2539, 262, -21, 1247, 1666,
-    -103, -787, -710, -364, -1374, -1266, -594, -1943, -3804, -2706,
-    20, 913, 581, -44, 616, 1049, 1869, 2770, 2611, 381,
-    -129, 1352, 1679, 206, -689, -753, -715, -1013, -1136, -909,
-    -1780, -3417, -3074, -843, 870, 960, 319, 195, 839, 1652,
-    2469, 2891, 971, -303, 720, 1867, 665, -706, -1003, -447,
-    -716, -1254, -1051, -1412, -2986, -3238, -1238, 841, 924, 183,
-    370, 879, 1298, 2302, 2938, 1121, -219, 502, 1905, 781,
-    -506, -871, -786, -1179, -941, -600, -1350, -3111, -3274, -1099,
-    421, 733, 434, 402, 676, 1490, 2079, 2947, 1591, -160,
-    117, 1782, 1288, -387, -818, -544, -899, -1439, -815, -834,
-    -2842, -3709, -1407, 423, 643, 295, 139, 711, 1365, 2040,
-    2948, 1479, -113, 186, 1612, 1370, 15, -690, -733, -956,
-    -1289, -1034, -815, -2146, -3638, -2242, 129, 1185, 284, -199,
-    572, 1614, 1859, 2918, 2304, 57, -357, 1587, 1887, -53,
-    -515, -311, -869, -1664, -1172, -655, -1910, -3599, -2524, -253,
-    918, 528, -142, 70, 1402, 1860, 2809, 2619, 656, -507,
-    652, 2161, 662, -839, -668, -223, -1528, -1678, -777, -1423,
-    -3514, -2835, -463, 675, 656, 204, 93, 814, 1919, 2689,
-    2855, 1214, -49, 479, 1617, 805, -220, -664, -644, -894,
-    -1544, -1433, -1208, -2656, -3437, -1590, 758, 1258, 116, -376,
-    537, 1672, 2169, 3271, 1860, -189, -213, 1672, 1458, -295,
-    -726, -643, -704, -1470, -1116, -850, -2321, -3896, -1781, 568,
-    1218, 610, -191, 226, 1227, 2036, 2994, 2619, 398, -415,
-    965, 1757, 158, -904, -764, -602, -1424, -1507, -651, -1676,
-    -3786, -2853, -129, 1179, 781, -74, 48, 973, 1790, 2672,
-    2841, 969, -145, 397, 1556, 943, -568, -933, -615, -964,
-    -1596, -835, -956, -3114, -3528, -836, 1225, 991, 58, 31,
-    870, 1420, 2385, 3110, 1450, -292, 153, 1721, 1139, -429,
-    -995, -624, -1036, -1627, -951, -529, -2483, -3833, -1576, 678,
-    1062, 238, 168, 391, 1348, 2269, 3057, 1743, -137, -57,
-    1195, 1418, 62, -747, -878, -827, -1254, -1205, -818, -1494,
-    -3318, -2548, -181, 1215, 801, 56, 162, 1333, 1937, 2621,
-    2615, 468, -671, 688, 1819, 364, -631, -662, -677, -1411,
-    -1326, -648, -1234, -3088, -2819, -680, 669, 844, 442, 149,
-    587, 1678, 2431, 2825, 1329, -438, 251, 1801, 782, -562,
-    -586, -592, -1149, -1381, -892, -689, -2556, -3140, -1463, 49,
-    1145, 796, -144, 204, 1640, 2044, 2823, 1761, -77, -469,
-    1309, 1788, 64, -1075, -782, -575, -1526, -1221, -368, -1654,
-    -3721, -1979, 87, 1034, 755, 301, -34, 1011, 2078, 2933,
-    2147, 217, -67, 591, 1563, 701, -644, -1248, -427, -1282,
-    -1565, -584, -772, -3309, -3127, -546, 1127, 1047, 132, 117,
-    661, 1765, 2396, 2748, 815, -237, 208, 1632, 1084, -337,
-    -935, -854, -984, -1387, -888, -801, -2073, -3186, -1570, 580,
-    1314, 406, -157, 468, 1559, 2047, 2635, 1754, -106, -364,
-    1279, 1601, -197, -1031, -516, -730, -1636, -1013, -440, -1943,
-    -3238, -1759, 45, 714, 711, 211, 134, 960, 2038, 2693,
-    2127, 429, -243, 615, 1573, 799, -755, -939, -633, -1020,
-    -1418, -561, -877, -2864, -2942, -656, 697, 759, 404, -36,
-    675, 1531, 2145, 2442, 1382, -194, -211, 1373, 1492, -280,
-    -950, -481, -996, -1586, -991, -378, -1775, -3338, -1801, 174,
-    841, 578, 5, 139, 1274, 2126, 2621, 2052, 141, -187,
-    834, 1683, 542, -662, -574, -709, -1313, -1553, -705, -813,
-    -2445, -3044, -939, 800, 821, 93, -125, 625, 1647, 2510,
-    2559, 854, -466, 227, 1538, 1226, -305, -383, -530, -1155,
-    -1645, -1012, -458, -1641, -3088, -1852, 138, 1095, 748, -146,
-    -98, 1233, 2160, 2612, 2102, 61, -310, 536, 1788, 481,
-    -468, -732, -405, -1186, -2008, -782, -585, -2600, -3055, -418,
-    664, 670, 84, 21, 472, 1588, 2500, 2692, 655, -193,
-    265, 1259, 1437, 243, -1007, -970, -287, -1457, -1277, -471,
-    -1638, -3380, -1561, 464, 925, 77, -62, 353, 1200, 1753,
-    2660, 1799, -137, -354, 811, 1956, 391, -630, -982, -467,
-    -1214, -1328, -581, -992, -3058, -2573, -86, 1021, 622, -333,
-    44, 1078, 1527, 2198, 2696, 633, -607, 229, 1862, 1122,
-    -395, -753, -695, -943, -1247, -924, -524, -2045, -3193, -1329,
-    798, 1008, 107, -344, 209, 1399, 2009, 2613, 1210, -498,
-    -125, 1411, 1452, 0, -579, -521, -747, -1203, -1031, -435,
-    -1347, -3009, -2150, -130, 1007, 819, 95, -417, 847, 2037,
-    2458, 1932, 342, -330, 252, 1633, 1006, -583, -746, -294,
-    -793, -1618, -900, -421, -2366, -2928, -882, 718, 882, 445,
-    -226, 199, 1491, 2023, 2372, 1317, -321, -419, 1165, 1525,
-    -151, -634, -484, -734, -1206, -953, -530, -1671, -2881, -1879,
-    25, 1073, 720, -162, -166, 1189, 1810, 2284, 2102, 106,
-    -573, 396, 1770, 558, -584, -682, -470, -1001, -1230, -549,
-    -997, -2737, -2553, -206, 628, 645, 105, -99, 456, 1627,
-    2131, 2343, 836, -261, 181, 1157, 1221, -66, -654, -790,
-    -439, -1147, -1281, -529, -1331, -3107, -2014, 537, 1001, 83,
-    -190, 218, 980, 1770, 2604, 1967, -339, -636, 900, 1787,
-    237, -713, -719, -356, -971, -1266, -402, -694, -2678, -2804,
-    -420, 834, 911, 99, 39, 343, 1496, 2475, 2539, 422,
-    -541, 221, 1590, 1335, -490, -884, -756, -466, -1126, -974,
-    -449, -1579, -3289, -1723, 716, 1018, 217, -83, 196, 901,
-    1815, 2586, 1653, -348, -470, 989, 1565, 210, -647, -816,
-    -534, -849, -1146, -454, -834, -2681, -2473, -212, 982, 824,
-    -54, -64, 621, 1358, 2204, 2334, 341, -482, 131, 1333,
-    1058, -473, -618, -614, -748, -1475, -576, -171, -1885, -3399,
-    -1008, 790, 649, 547, 87, 38, 764, 2052, 2585, 1397,
-    -500, -174, 707, 1446, 498, -578, -980, -251, -1024, -1325,
-    -45, -819, -3046, -2462, 399, 1071, 393, -143, 129, 520,
-    1318, 2127, 2212, 183, -555, 146, 1547, 723, -503, -589,
-    -422, -849, -1337, -396, -582, -2020, -2731, -733, 659, 1026,
-    40, -178, 486, 1060, 1676, 2531, 1123, -607, -192, 1188,
-    1431, -264, -602, -549, -453, -1074, -947, -415, -1402, -2709,
-    -1703, 227, 801, 334, -107, 218, 929, 1220, 2108, 2005,
-    142, -650, 364, 1891, 504, -896, -519, -63, -1106, -1286,
-    -147, -690, -2632, -2526, -36, 550, 571, 420, -132, 68,
-    1528, 2133, 1971, 568, -342, 140, 1060, 1335, -371, -875,
-    -531, -234, -1336, -1081, -324, -1405, -2772, -1435, 649, 790,
-    302, -15, 225, 829, 1622, 2405, 1692, -442, -488, 688,
-    1583, 165, -621, -647, -313, -1016, -1302, -331, -695, -2562,
-    -2459, 277, 785, 411, -74, 266, 566, 1286, 2011, 2381,
-    418, -473, 228, 1040, 999, -362, -598, -485, -586, -1508,
-    -829, -267, -1531, -2909, -1397, 517, 1075, 329, -233, 325,
-    1059, 1538, 2476, 1791, -392, -519, 855, 1612, -39, -658,
-    -463, -495, -1216, -1230, -280, -838, -2595, -2319, 27, 825,
-    509, 49, 80, 458, 1207, 2366, 2320, 147, -658, 548,
-    1094, 582, -210, -405, -528, -818, -1406, -822, -246, -1620,
-    -2801, -1263, 728, 1145, 252, -361, 132, 1165, 1943, 2416,
-    1374, -447, -343, 847, 1555, -190, -879, -147, -173, -1369,
-    -1433, -346, -859, -2580, -2194, -46, 820, 497, -86, -218,
-    623, 1439, 2303, 2280, 379, -547, 220, 1426, 873, -422,
-    -598, 28, -783, -1434, -897, -201, -1739, -2731, -1009, 621,
-    741, -8, -107, 77, 1051, 1828, 2598, 1311, -512, -456,
-    915, 1465, 65, -669, -298, -373, -1320, -1332, -280, -913,
-    -2661, -2010, -76, 915, 376, -88, -95, 726, 1363, 2327,
-    2384, 300, -818, 214, 1709, 845, -464, -720, 24, -931,
-    -1500, -460, -184, -2157, -2541, -791, 301, 694, 241, 40,
-    -58, 1094, 1988, 2294, 1110, -317, -492, 765, 1573, 163,
-    -955, -566, -241, -1168, -1301, -234, -859, -2648, -1926, -17,
-    751, 426, 109, 55, 679, 1556, 2274, 2069, 288, -479,
-    36, 1424, 874, -341, -658, -298, -743, -1381, -647, -276,
-    -1736, -2852, -792, 634, 778, 19, -118, 123, 976, 1909,
-    2545, 1264, -564, -407, 749, 1391, 199, -673, -579, -376,
-    -1023, -1085, -251, -906, -2798, -2011, 274, 1033, 252, -7,
-    -134, 596, 1580, 2421, 2141, 146, -607, 226, 1480, 730,
-    -250, -644, -457, -809, -1169, -509, -565, -1868, -2752, -1109,
-    566, 958, 99, -402, 100, 1103, 2040, 2355, 1365, -633,
-    -296, 922, 1589, 365, -672, -788, -398, -716, -1063, -217,
-    -988, -2505, -2244, 77, 948, 395, -272, 51, 694, 1317,
-    2297, 2121, 115, -533, 411, 1231, 853, 55, -745, -897,
-    -556, -1014, -777, -323, -1634, -2937, -1248, 487, 956, -27,
-    -375, 446, 1147, 1687, 2468, 1324, -522, -377, 909, 1853,
-    353, -644, -548, -498, -1181, -802, -78, -1057, -2523, -1965,
-    -41, 470, 296, -306, 59, 844, 1428, 2045, 2076, 300,
-    -751, 205, 1449, 1051, -179, -437, -578, -822, -1215, -611,
-    -422, -1551, -2549, -1326, 341, 570, 35, -449, 167, 1398,
-    1881, 2152, 1309, -101, -465, 818, 1765, 429, -500, -101,
-    -99, -1504, -1233, -249, -506, -2274, -2353, -462, 483, 344,
-    10, -370, 278, 1559, 2126, 2383, 405, -716, -64, 1698,
-    1213, -209, -445, -160, -679, -1560, -715, -267, -1172, -2708,
-    -1576, -134, 463, 504, -18, -328, 973, 1838, 2456, 1724,
-    -202, -412, 580, 1849, 622, -163, -465, -307, -1141, -1368,
-    -287, -336, -1984, -2825, -693, 481, 648, -118, -280, 279,
-    1278, 1903, 2368, 813, -550, 39, 1122, 1363, -234, -307,
-    -425, -76, -1608, -1339, -112, -597, -2555, -2268, 53, 555,
-    466, -158, 80, 450, 1541, 2298, 2115, -212, -426, 509,
-    1580, 680, -145, -219, -377, -788, -1575, -523, -391, -1202,
-    -2711, -1399, 328, 768, 126, -242, 65, 958, 1655, 2444,
-    1379, -635, -386, 1174, 1857, -8, -445, -247, -94, -1208,
-    -1285, -322, -514, -2049, -2463, -396, 398, 600, 139, -281,
-    284, 1466, 1959, 2017, 411, -405, 15, 1488, 1410, -344,
-    -504, -173, -250, -1668, -1035, -323, -781, -2707, -1893, 61,
-    753, 220, -348, 76, 796, 1509, 2171, 2147, -299, -436,
-    839, 1948, 250, -262, -309, -202, -863, -1423, -503, -611,
-    -1544, -2860, -1041, 218, 774, -87, -221, -29, 1058, 2137,
-    2253, 897, -385, 250, 964, 1673, 195, -488, -540, 49,
-    -1202, -1254, -52, -797, -2737, -2296, 182, 435, 365, -93,
-    -178, 113, 1723, 2378, 1657, 191, -89, 378, 1306, 1241,
-    -366, -751, -222, -178, -1295, -1036, -455, -1125, -2923, -1570,
-    321, 695, -81, -307, 103, 789, 1739, 2291, 1583, -127,
-    -34, 711, 1527, 467, -157, -429, -263, -609, -1128, -774,
-    -380, -1582, -2875, -1084, 652, 857, -280, -617, 153, 1230,
-    1949, 2027, 973, -574, 161, 1114, 1146, 15, -198, -289,
-    -759, -802, -895, -315, -779, -2113, -2539, -200, 900, 691,
-    -519, -486, 751, 1622, 1997, 1731, 678, -514, 316, 1367,
-    1312, -342, -516, -234, -533, -1420, -749, 25, -1351, -2991,
-    -1585, 519, 451, -153, -382, 18, 662, 1727, 2142, 1517,
-    -197, -179, 601, 1606, 724, -313, -534, -313, -528, -1161,
-    -587, -352, -1492, -2660, -740, 428, 456, -257, -240, 167,
-    1044, 2003, 2059, 942, -493, 114, 1105, 1336, 132, -210,
-    -559, -543, -665, -973, -608, -640, -1820, -2546, -539, 601,
-    494, -546, -512, 616, 1454, 1946, 1872, 507, -424, 320,
-    1462, 1259, -265, -563, 5, -234, -1415, -771, -73, -1090,
-    -2661, -1469, -28, 327, 115, -125, -261, 477, 1816, 2253,
-    1438, -91, 43, 423, 1371, 835, -23, -754, -246, -492,
-    -1140, -791, -398, -1278, -2865, -1135, 391, 371, -145, -102,
-    -75, 850, 1999, 2083, 930, -78, 64, 724, 1407, 662,
-    -254, -537, -314, -850, -1155, -357, -353, -1984, -2644, -638,
-    726, 341, -278, -320, 244, 1161, 2147, 2025, 468, -562,
-    127, 1304, 1348, -5, -542, -155, -432, -1447, -629, 73,
-    -1178, -2582, -1727, 55, 157, 375, -149, -278, 285, 1888,
-    2097, 1533, 352, -360, 338, 1667, 1238, -361, -348, -281,
-    -642, -1509, -194, -277, -1651, -2952, -1024, 214, 15, -8,
-    -139, -157, 633, 2260, 1901, 1024, -251, 64, 684, 1842,
-    579, -568, -402, -84, -1002, -1190, 31, -548, -2338, -2576,
-    -231, 228, 143, -127, -40, 180, 1238, 2275, 2030, 455,
-    -297, 389, 1129, 1354, 263, -583, -578, -347, -1188, -897,
-    -194, -993, -2698, -2058, 277, 481, -310, -411, 84, 635,
-    1618, 2150, 1548, 69, -379, 714, 1594, 921, -174, -406,
-    -477, -558, -1003, -659, -375, -1273, -2549, -1330, 554, 377,
-    -388, -462, 294, 943, 1953, 2254, 1045, -649, -241, 1041,
-    1566, 503, -546, -522, -291, -965, -1089, -256, -692, -2010,
-    -2262, -236, 324, 148, -300, -4, 231, 1303, 2216, 2001,
-    433, -763, 433, 1209, 1379, -208, -157, -353, -384, -1399,
-    -927, 26, -1079, -2337, -1816, 384, 100, 40, -396, 76,
-    448, 1740, 2181, 1448, 170, -525, 421, 1360, 1211, -405,
-    -477, -112, -664, -1714, -513, 218, -1614, -2792, -919, 656,
-    115, -299, 21, 143, 682, 2010, 2312, 849, -452, 53,
-    453, 1199, 701, -105, -437, -613, -1007, -1164, -183, -536,
-    -1830, -2408, -334, 570, 54, -84, -101, 386, 1228, 2087,
-    1819, 524, -330, 59, 909, 1251, 280, -378, -419, -333,
-    -1354, -888, -84, -823, -2389, -1707, 153, 244, 98, -212,
-    148, 419, 1582, 1916, 1458, 212, -205, 220, 1145, 1197,
-    -96, -520, -360, -393, -1358, -698, -206, -1153, -2592, -1354,
-    430, 321, -97, -195, 174, 654, 1730, 2107, 1262, -229,
-    -277, 821, 1349, 471, -316, -185, -224, -1012, -943, -326,
-    -641, -1737, -2158, -685, 269, 496, -130, -317, 140, 1171,
-    1921, 1864, 786, -565, 154, 1066, 1240, -31, -340, -175,
-    -360, -1147, -864, -102, -869, -2170, -1868, 26, 410, 391,
-    -325, -126, 247, 1527, 1862, 1803, 466, -598, 200, 1184,
-    1129, -320, -145, -355, -501, -1393, -391, -226, -1469, -2363,
-    -1008, 450, 206, -140, -289, 235, 508, 1597, 1911, 1387,
-    -254, -284, 527, 1370, 473, -240, -104, -333, -1091, -1112,
-    146, -692, -2174, -1977, 121, 279, 168, 55, -240, 18,
-    1341, 2014, 1634, 553, -159, 21, 715, 1334, 81, -289,
-    -198, -303, -1522, -756, -95, -1063, -2558, -1621, 440, 241,
-    292, -267, -311, 186, 1864, 2009, 1405, 44, -171, 354,
-    962, 929, -49, -54, -255, -618, -1408, -101, -374, -1551,
-    -2359, -688, 513, 369, 151, -408, -211, 817, 2141, 1873,
-    841, -472, -184, 734, 1314, 325, -157, -257, -217, -1269,
-    -1078, -42, -665, -2093, -2067, 2, 342, 151, -204, -141,
-    146, 1261, 2062, 1553, 478, -390, 66, 986, 1336, 290,
-    -327, -134, -375, -1076, -846, 78, -822, -2424, -1791, 384,
-    493, -171, -362, -2, 513, 1341, 1974, 1319, -252, -467,
-    469, 1218, 846, -49, -152, -222, -737, -1428, -177, -8,
-    -1470, -2740, -751, 500, 301, 203, -210, -192, 714, 2139,
-    1917, 944, -509, -128, 717, 1447, 527, -300, -13, -88,
-    -1189, -1259, 84, -435, -2068, -2301, -350, 313, 299, 124,
-    -227, -226, 1228, 2236, 1740, 232, -319, 141, 585, 1225,
-    333, -268, -307, -92, -1459, -851, 13, -717, -2349, -1726,
-    181, 312, 291, -81, 27, 153, 1762, 1995, 1500, -105,
-    -263, 310, 1221, 787, -226, -15, -264, -805, -1363, -101,
-    -549, -1514, -2335, -787, 199, 186, 1, -88, -14, 605,
-    2073, 1896, 903, -326, 29, 531, 1282, 580, -170, -348,
-    -294, -924, -971, -75, -625, -2110, -1990, 74, 304, -27,
-    -86, 169, 83, 1182, 1923, 1799, 366, -305, 96, 759,
-    1203, 260, 0, -480, -491, -1160, -842, -317, -731, -2138,
-    -1911, 241, 476, -13, -341, 98, 546, 1219, 2077, 1733,
-    167, -623, 446, 1238, 914, 55, -55, -219, -1001, -1038,
-    -482, -433, -1397, -2001, -965, -69, 182, 245, 52, -274,
-    681, 1834, 1912, 1064, -379, -160, 571, 1507, 536, -138,
-    -308, -402, -1069, -961, -194, -1042, -1707, -1538, -283, -123,
-    218, 146, 45, 144, 1260, 1833, 1702, 643, -193, 52,
-    787, 1274, 297, -132, -432, -552, -1385, -721, -316, -1073,
-    -2195, -1483, 218, 225, -1, -309, 157, 586, 1605, 1761,
-    1431, 107, -306, 454, 1027, 811, 1, 110, -529, -941,
-    -1146, -450, -515, -1346, -1936, -869, 135, 141, 283, -78,
-    32, 921, 1749, 1825, 994, -250, -356, 728, 1517, 432,
-    -504, -156, -281, -1318, -889, -164, -848, -1969, -1337, -386,
-    -107, 11, 286, 145, 79, 1180, 1769, 1764, 366, -249,
-    -145, 1030, 1387, 264, -551, -248, -378, -1336, -511, -218,
-    -1195, -2227, -725, 48, -125, 56, 382, 24, 267, 1668,
-    1687, 1207, -76, -67, -74, 1173, 992, 0, -270, -197,
-    -628, -1507, -483, -130, -1098, -2498, -825, 317, 131, 207,
-    133, -169, 581, 1781, 1832, 879, -511, -178, 676, 1363,
-    709, -344, -218, -137, -825, -1017, -441, -410, -1361, -1737,
-    -545, 1, 172, 225, 95, 48, 872, 1688, 1666, 501,
-    -589, -164, 856, 1591, 113, -453, -26, -321, -1574, -860,
-    312, -1029, -2148, -1284, 61, -184, 24, 325, -50, 203,
-    1478, 2010, 1278, -166, -286, 402, 1202, 1145, 169, -409,
-    -105, -517, -1336, -757, -135, -902, -2170, -1053, -131, 106,
-    80, 189, -172, 523, 1684, 2030, 1030, -520, -315, 523,
-    1456, 681, -45, -329, -220, -1044, -1183, -435, -420, -1532,
-    -1970, -452, 1, 37, 227, 205, -80, 1111, 1965, 1779,
-    650, -310, -91, 740, 1677, 338, -465, 120, -244, -1476,
-    -1143, -106, -861, -2083, -1527, -106, -95, -144, 83, 210,
-    240, 996, 1879, 1687, 209, -639, 237, 1223, 1182, 20,
-    -59, -57, -621, -1387, -661, -204, -1216, -2043, -1044, -13,
-    -30, 169, 71, 111, 546, 1669, 1748, 1194, -117, -97,
-    330, 1314, 878, -67, -63, -169, -829, -1621, -600, -314,
-    -1212, -2210, -780, -260, -44, 390, 155, -71, 644, 1876,
-    1846, 897, -437, -34, 924, 1394, 416, -282, 219, -304,
-    -1156, -1362, -445, -403, -1574, -1796, -585, 23, 69, 118,
-    122, 286, 928, 1866, 1752, 421, -429, 159, 920, 1382,
-    93, -386, -180, -288, -1215, -1095, -364, -776, -1964, -1580,
-    -6, 5, -103, 13, 495, 434, 1137, 1898, 1657, -2,
-    -220, 284, 1082, 967, 80, -105, -180, -687, -1458, -565,
-    -215, -1085, -2320, -942, 0, -70, 63, 157, 94, 468,
-    1774, 1688, 1165, -103, -138, 326, 1140, 727, -314, 36,
-    -100, -990, -1610, -357, -88, -1458, -2208, -640, 26, -60,
-    278, 261, 69, 724, 1912, 1922, 726, -341, -59, 635,
-    1249, 445, -98, -151, -351, -1184, -1221, -465, -444, -1613,
-    -1876, -409, -22, 74, 203, 187, 161, 1106, 1853, 1654,
-    432, -334, 176, 918, 969, 55, -39, 109, -577, -1547,
-    -941, -161, -821, -1872, -1222, -342, -149, 251, 302, 195,
-    373, 1413, 1748, 1375, 3, -165, 348, 975, 711, -75,
-    39, -197, -854, -1446, -487, -405, -1060, -1974, -877, -204,
-    -44, 134, 174, 334, 629, 1461, 1858, 1203, -357, -164,
-    604, 1264, 334, -16, 130, -187, -1348, -1047, -297, -464,
-    -1539, -1945, -611, -213, 30, 222, 244, -78, 1063, 1664,
-    1502, 675, 31, 88, 359, 1056, 684, -41, -298, -355,
-    -990, -1158, -218, -382, -1827, -1832, -224, 48, -151, 294,
-    263, 362, 902, 1757, 1445, 467, -278, 146, 926, 973,
-    117, -364, 115, -550, -1421, -928, 22, -834, -1932, -1325,
-    -222, -159, 99, 327, 242, 384, 1106, 1811, 1437, 196,
-    -217, 180, 856, 1089, 49, -421, -115, -382, -1421, -862,
-    -139, -743, -1970, -1079, -170, -166, 144, 454, 293, 332,
-    1341, 1646, 1346, 88, -92, 28, 914, 833, 4, -215,
-    -344, -798, -1225, -456, -456, -1162, -1927, -631, -111, -166,
-    146, 423, 360, 664, 1565, 1349, 1000, 79, 44, 290,
-    1138, 563, -212, -35, -224, -1157, -1366, -195, -435, -1554,
-    -1991, -377, -14, -264, 266, 455, 180, 617, 1717, 1717,
-    615, -211, 182, 795, 900, 353, -123, 52, -311, -1409,
-    -1189, -213, -372, -1792, -1473, -379, -302, -10, 590, 292,
-    -30, 1063, 1735, 1538, 379, -52, 294, 823, 896, 379,
-    18, -344, -758, -1160, -874, -388, -690, -1733, -1425, -539,
-    -56, 134, 292, -7, 377, 1280, 1706, 1248, 249, 18,
-    277, 1228, 837, -26, -48, 175, -892, -1424, -476, -237,
-    -1001, -1796, -1039, -474, -323, 324, 438, 53, 334, 1402,
-    1653, 1031, 92, -11, 476, 1011, 899, -89, -31, -67,
-    -948, -1433, -468, -217, -1306, -1806, -875, -520, -278, 498,
-    354, -4, 517, 1626, 1513, 932, 121, 79, 419, 1226,
-    868, -63, -79, -292, -686, -1328, -457, -326, -1309, -1849,
-    -621, -236, -390, 417, 367, 192, 492, 1587, 1361, 655,
-    158, 239, 482, 918, 698, -70, -39, -452, -983, -1179,
-    -384, -272, -1328, -1862, -599, -76, -137, 193, 209, 384,
-    737, 1633, 1340, 538, -68, 387, 751, 1019, 490, -243,
-    -83, -417, -914, -1159, -226, -357, -1485, -1802, -607, -65,
-    -81, 133, 254, 320, 803, 1521, 1340, 545, -65, 209,
-    779, 1195, 263, -223, -17, -180, -1323, -983, 22, -538,
-    -1711, -1494, -381, -536, 10, 364, 132, 130, 1168, 1574,
-    1067, 351, 144, 248, 916, 1272, 245, -374, -22, -176,
-    -1138, -1036, -151, -393, -1797, -1517, -562, -355, -96, 382,
-    304, 44, 827, 1604, 1264, 334, 44, 412, 934, 1192,
-    161, -149, -26, -103, -1186, -1165, -147, -367, -1669, -1628,
-    -404, -333, -37, 262, 341, 103, 954, 1412, 1278, 279,
-    27, 355, 1231, 1083, -54, -264, 287, -162, -1424, -1016,
-    -203, -495, -1725, -1151, -714, -596, 88, 604, 160, 77,
-    969, 1521, 1069, 413, -5, 345, 1214, 1208, -50, -241,
-    219, -449, -1173, -808, -73, -971, -1622, -1120, -549, -534,
-    210, 382, 49, 279, 1086, 1386, 905, 452, 139, 407,
-    1149, 918, -83, -112, 106, -483, -1219, -708, -225, -840,
-    -1748, -1123, -503, -354, 105, 308, 142, 401, 1105, 1504,
-    904, 228, 181, 498, 1116, 934, 49, -257, -47, -515,
-    -1042, -769, -73, -851, -1962, -1445, -308, -63, 160, 173,
-    187, 307, 1100, 1612, 886, 15, 184, 645, 939, 905,
-    -9, -132, -294, -297, -1130, -759, -193, -829, -1818, -1284,
-    -362, -161, 432, 192, 153, 317, 1315, 1371, 999, 208,
-    -23, 560, 1269, 733, -314, 127, -65, -790, -1206, -337,
-    -325, -1230, -1644, -879, -586, -244, 473, 215, 12, 509,
-    1407, 1294, 816, 299, 153, 496, 1139, 631, -221, 85,
-    26, -908, -1253, -531, -125, -1117, -1895, -1028, -275, -102,
-    282, 262, -64, 443, 1441, 1532, 694, 89, 286, 686,
-    1078, 695, -52, -191, -60, -564, -1078, -769, -448, -803,
-    -1739, -1149, -222, 110, 35, 59, 270, 555, 1125, 1446,
-    961, -63, 142, 752, 1040, 533, -18, -71, -239, -807,
-    -1045, -513, -603, -954, -1556, -1089, -461, 14, 276, 89,
-    160, 682, 1320, 1298, 867, 54, 167, 758, 1376, 547,
-    -259, -102, 18, -749, -1059, -619, -480, -1056, -1496, -920,
-    -419, -290, 183, 369, 125, 638, 1017, 1355, 765, 212,
-    -80, 812, 1270, 596, -371, -56, 96, -830, -1181, -667,
-    -181, -1188, -1590, -1079, -198, -190, 237, 230, 135, 478,
-    1280, 1568, 778, 42, 40, 699, 1381, 905, -352, -285,
-    158, -489, -1464, -765, -113, -854, -1873, -1126, -340, -224,
-    88, 503, 50, 202, 1210, 1575, 831, 65, 118, 564,
-    1290, 845, -87, -226, 87, -604, -1194, -903, -144, -659,
-    -1719, -1423, -317, -89, 167, 354, 152, 300, 1063, 1621,
-    980, -40, 53, 724, 1198, 870, -119, -134, -85, -519,
-    -1245, -746, -320, -658, -1797, -1390, -406, -134, 181, 275,
-    108, 147, 1261, 1427, 1007, 18, 265, 665, 1092, 995,
-    -77, -212, -60, -315, -1341, -855, -237, -475, -1681, -1590,
-    -520, -232, 231, 382, 96, -86, 1118, 1585, 940, 219,
-    291, 648, 1018, 898, 79, -219, -72, -395, -1092, -852,
-    -241, -600, -1523, -1535, -695, -73, 218, 367, -81, 122,
-    1037, 1388, 985, 403, 267, 555, 1099, 914, -55, -337,
-    1, -251, -1069, -885, -253, -623, -1645, -1463, -551, -242,
-    275, 335, -36, 0, 895, 1372, 1203, 553, 179, 485,
-    996, 1109, -16, -213, 43, -286, -986, -955, -360, -507,
-    -1350, -1755, -789, -233, 236, 286, -86, -193, 644, 1460,
-    1362, 666, 78, 504, 771, 1138, 368, -197, -133, -54,
-    -771, -1023, -531, -448, -1120, -1734, -951, -258, 358, 107,
-    -113, -186, 714, 1314, 1323, 768, 117, 347, 902, 1084,
-    338, 9, -18, -167, -846, -1079, -459, -296, -1067, -1848,
-    -1135, -133, 152, 188, -111, -226, 390, 1542, 1309, 753,
-    188, 357, 634, 1159, 780, -214, -239, -51, -430, -1281,
-    -616, -211, -889, -1938, -1133, -177, 78, 96, 76, -39,
-    262, 1288, 1514, 874, 166, 357, 614, 1007, 992, -57,
-    -362, -209, -334, -1057, -958, -229, -658, -1710, -1543, -216,
-    -13, 203, -107, 93, 209, 1046, 1516, 1044, 372, 1,
-    631, 1027, 1054, -321, -216, -5, -278, -1037, -909, -283,
-    -612, -1407, -1568, -519, -123, 349, 183, -110, 36, 1036,
-    1572, 988, 345, 166, 478, 839, 1121, 79, -466, -1,
-    -186, -952, -983, -461, -562, -1194, -1451, -746, -234, 270,
-    261, -21, 41, 801, 1474, 1223, 551, 196, 301, 779,
-    1174, 259, -359, -111, -213, -802, -1021, -592, -418, -1086,
-    -1709, -930, -9, 157, 183, -37, 97, 643, 1419, 1319,
-    771, 85, 295, 679, 1096, 659, -373, -199, -132, -473,
-    -1260, -789, -430, -669, -1694, -1307, -208, 147, 218, -18,
-    58, 331, 1273, 1384, 894, 212, 235, 586, 1040, 934,
-    -175, -356, -147, -319, -915, -979, -468, -626, -1422, -1515,
-    -376, 77, 185, 113, 38, 306, 1068, 1417, 1059, 348,
-    121, 593, 976, 996, -68, -248, -96, -422, -1080, -748,
-    -500, -651, -1250, -1532, -698, -134, 331, 81, 44, 100,
-    989, 1326, 1188, 512, 45, 586, 916, 1021, 78, -175,
-    -120, -398, -831, -936, -494, -509, -947, -1598, -952, -188,
-    191, 303, -75, 141, 738, 1499, 1043, 646, 170, 478,
-    679, 1036, 623, -426, -197, -236, -617, -1202, -500, -388,
-    -712, -1667, -1128, -214, 97, 131, 144, 167, 346, 1234,
-    1285, 854, 7, 460, 668, 941, 525, -145, -297, -265,
-    -428, -976, -835, -351, -443, -1422, -1406, -388, 158, 258,
-    282, 52, 254, 1036, 1421, 844, 325, 208, 561, 733,
-    1020, -107, -631, -127, -270, -867, -1140, -293, -399, -1041,
-    -1583, -603, -50, 301, 383, 155, 56, 746, 1485, 1123,
-    519, 0, 409, 687, 1029, 160, -515, -297, -145, -646,
-    -1062, -656, -308, -748, -1519, -916, -198, 340, 410, 165,
-    -53, 502, 1328, 1281, 662, 130, 270, 500, 1065, 512,
-    -515, -415, -109, -496, -1071, -767, -264, -579, -1387, -1173,
-    -195, 127, 401, 360, 59, 290, 1070, 1432, 869, 188,
-    170, 452, 833, 763, -185, -390, -270, -470, -961, -941,
-    -369, -390, -1216, -1343, -479, 205, 200, 258, 152, 279,
-    906, 1283, 1142, 306, 175, 437, 804, 778, 47, -368,
-    -177, -449, -833, -1062, -572, -238, -958, -1552, -838, 41,
-    221, 342, 136, 151, 643, 1419, 1164, 603, 116, 424,
-    670, 980, 376, -482, -264, -243, -584, -1095, -659, -401,
-    -633, -1418, -1043, -351, 217, 447, 206, 18, 470, 1117,
-    1173, 860, 258, 273, 466, 1004, 592, -185, -354, -203,
-    -442, -940, -894, -380, -408, -1313, -1352, -337, 177, 248,
-    308, 88, 182, 898, 1375, 1005, 253, 172, 551, 752,
-    772, -86, -297, -198, -324, -847, -1065, -435, -377, -949,
-    -1446, -643, -83, 276, 327, 131, 61, 685, 1224, 1125,
-    623, 23, 389, 700, 900, 116, -224, -60, -265, -741,
-    -931, -657, -338, -640, -1258, -980, -179, 203, 237, 121,
-    99, 517, 1000, 1199, 773, 167, 168, 710, 765, 426,
-    -313, -94, -215, -463, -925, -834, -389, -463, -1145, -1279,
-    -245, 56, 376, 111, 157, 210, 917, 1157, 975, 279,
-    139, 524, 801, 838, -158, -334, -272, -295, -837, -881,
-    -462, -338, -1065, -1289, -517, -8, 243, 381, 83, 125,
-    765, 1158, 969, 485, 241, 278, 618, 964, 273, -536,
-    -210, -298, -659, -1057, -519, -290, -829, -1362, -781, -12,
-    191, 371, 150, 211, 460, 1045, 1084, 766, 169, 284,
-    493, 820, 460, -343, -264, -320, -504, -943, -788, -318,
-    -468, -1258, -1087, -214, 157, 389, 307, 102, 234, 884,
-    1183, 841, 294, 216, 328, 690, 789, -180, -453, -196,
-    -282, -704, -883, -407, -344, -987, -1187, -462, 81, 308,
-    336, 63, 223, 618, 1097, 957, 469, 82, 221, 566,
-    853, 50, -519, -191, -280, -546, -938, -470, -300, -731,
-    -1270, -598, -67, 218, 403, 184, 35, 454, 1084, 1042,
-    532, 158, 290, 411, 818, 340, -378, -326, -170, -460,
-    -789, -753, -190, -441, -1104, -997, -178, 200, 242, 230,
-    160, 372, 701, 1132, 734, 127, 64, 535, 660, 446,
-    -265, -219, -244, -476, -671, -827, -373, -246, -784, -1234,
-    -368, 176, 377, 250, 143, 220, 654, 1089, 1003, 290,
-    17, 314, 575, 644, -54, -296, -254, -419, -635, -672,
-    -532, -278, -764, -1083, -660, 32, 417, 323, 15, 129,
-    601, 987, 1005, 470, 90, 152, 497, 728, 210, -443,
-    -100, -317, -631, -834, -495, -200, -561, -1090, -787, -112,
-    193, 463, 150, 34, 393, 952, 992, 664, 111, 100,
-    287, 826, 471, -366, -312, -163, -504, -922, -615, -272,
-    -429, -986, -889, -327, 134, 335, 262, 66, 355, 778,
-    1053, 753, 288, 158, 363, 633, 617, -159, -358, -83,
-    -455, -670, -813, -347, -352, -810, -1007, -521, -82, 328,
-    397, 32, 128, 643, 1035, 821, 432, 131, 249, 453,
-    722, 92, -372, -214, -337, -589, -797, -459, -296, -606,
-    -1044, -710, -41, 255, 409, 175, 136, 448, 942, 940,
-    529, 224, 139, 308, 633, 470, -429, -366, -188, -498,
-    -855, -626, -178, -509, -1068, -746, -143, 54, 395, 310,
-    50, 247, 930, 1035, 648, 233, 176, 261, 553, 615,
-    -220, -435, -206, -270, -673, -810, -338, -344, -876, -857,
-    -276, -26, 183, 398, 167, 101, 642, 1071, 757, 300,
-    234, 134, 342, 716, 121, -461, -323, -263, -530, -778,
-    -492, -189, -653, -1052, -521, 57, 220, 293, 212, 142,
-    480, 921, 876, 456, 50, 258, 373, 581, 321, -329,
-    -310, -319, -402, -723, -652, -238, -409, -919, -795, -202,
-    214, 335, 294, 96, 285, 818, 948, 640, 158, 36,
-    262, 593, 462, -248, -299, -284, -445, -617, -624, -305,
-    -380, -744, -820, -197, 0, 252, 359, 253, 222, 608,
-    903, 684, 311, 106, 225, 296, 615, -53, -393, -252,
-    -326, -593, -729, -257, -243, -712, -963, -432, 2, 273,
-    411, 192, 34, 506, 886, 724, 437, 142, 180, 164,
-    604, 320, -399, -365, -216, -335, -690, -405, -145, -519,
-    -1031, -517, 88, 58, 275, 326, 73, 272, 738, 821,
-    495, 94, 182, 182, 488, 379, -284, -252, -175, -397,
-    -631, -525, -163, -339, -850, -799, -180, 175, 246, 249,
-    85, 186, 599, 879, 668, 195, 77, 170, 371, 558,
-    -70, -329, -192, -245, -552, -595, -276, -248, -666, -855,
-    -338, 17, 189, 314, 155, 54, 497, 764, 786, 300,
-    35, 162, 299, 536, 136, -319, -184, -210, -549, -603,
-    -306, -142, -560, -901, -410, 50, 34, 304, 282, 82,
-    295, 739, 867, 411, 1, 120, 233, 495, 360, -256,
-    -287, -247, -333, -664, -470, -164, -319, -802, -711, -119,
-    42, 225, 273, 128, 202, 656, 764, 509, 97, 168,
-    228, 294, 516, -8, -296, -277, -315, -428, -521, -212,
-    -125, -685, -904, -232, 7, 155, 333, 167, 145, 403,
-    767, 583, 167, 47, 298, 286, 461, 35, -270, -144,
-    -312, -433, -555, -204, -162, -456, -862, -518, -47, 198,
-    355, 165, 64, 279, 704, 657, 413, 94, 90, 213,
-    492, 322, -304, -191, -204, -297, -478, -393, -177, -326,
-    -734, -662, -120, 60, 315, 170, 82, 162, 542, 736,
-    472, 126, 95, 198, 321, 478, -139, -240, -216, -230,
-    -379, -419, -204, -257, -607, -729, -219, 61, 190, 191,
-    161, 116, 357, 664, 613, 190, 37, 171, 248, 460,
-    79, -304, -172, -201, -394, -491, -135, -147, -663, -742,
-    -243, -52, 46, 309, 210, 33, 285, 686, 610, 239,
-    72, 195, 167, 371, 236, -157, -211, -230, -326, -414,
-    -312, -92, -375, -766, -481, -97, 108, 272, 265, 60,
-    185, 528, 673, 346, 77, 111, 141, 368, 326, -138,
-    -267, -202, -295, -384, -364, -163, -262, -626, -639, -166,
-    114, 246, 283, 108, 147, 436, 654, 528, 101, 88,
-    147, 257, 380, -55, -285, -188, -184, -406, -442, -211,
-    -160, -587, -659, -285, -24, 142, 342, 202, 22, 342,
-    638, 596, 224, 86, 131, 159, 433, 138, -316, -180,
-    -131, -382, -482, -231, -143, -428, -700, -387, -63, 78,
-    294, 296, 81, 228, 555, 675, 331, 95, 216, 161,
-    329, 248, -212, -318, -157, -273, -518, -396, -128, -379,
-    -615, -508, -205, -10, 303, 367, 55, 160, 536, 649,
-    448, 188, 152, 229, 211, 426, -57, -316, -251, -203,
-    -390, -546, -176, -194, -550, -692, -206, -36, 159, 304,
-    155, 39, 397, 677, 529, 308, 94, 177, 198, 410,
-    81, -296, -215, -180, -312, -549, -325, -113, -341, -712,
-    -421, -58, 98, 276, 207, 56, 195, 583, 656, 440,
-    64, 195, 171, 370, 340, -240, -207, -151, -242, -509,
-    -367, -151, -247, -589, -558, -197, 26, 225, 218, 8,
-    61, 484, 625, 524, 153, 48, 180, 284, 411, -28,
-    -280, -145, -205, -328, -468, -196, -108, -436, -608, -298,
-    -42, 127, 276, 101, 46, 316, 568, 498, 263, 68,
-    213, 187, 409, 182, -289, -209, -99, -211, -522, -301,
-    -101, -278, -621, -430, -89, -9, 195, 220, 14, 99,
-    473, 537, 383, 74, 154, 191, 274, 373, -114, -277,
-    -171, -76, -318, -429, -125, -162, -523, -545, -152, 46,
-    80, 175, 113, 88, 297, 527, 502, 134, 59, 240,
-    238, 359, 100, -266, -194, -106, -208, -447, -232, -125,
-    -388, -599, -255, -51, -8, 221, 132, 6, 191, 529,
-    459, 303, 89, 156, 125, 335, 283, -167, -164, -163,
-    -143, -403, -323, -130, -246, -552, -429, -72, 12, 148,
-    177, 41, 89, 421, 509, 391, 110, 118, 109, 193,
-    392, 12, -244, -160, -101, -310, -410, -170, -100, -473,
-    -529, -153, -9, 46, 164, 153, 46, 255, 487, 439,
-    171, 79, 188, 120, 335, 171, -209, -164, -131, -212,
-    -366, -215, -129, -270, -515, -346, -46, 58, 171, 105,
-    97, 202, 377, 420, 325, 98, 90, 118, 228, 255,
-    -124, -148, -117, -188, -298, -333, -145, -163, -438, -443,
-    -127, 50, 120, 192, 91, 88, 270, 430, 421, 149,
-    88, 69, 142, 298, 48, -211, -96, -143, -251, -344,
-    -192, -126, -327, -432, -252, 28, 117, 192, 83, 99,
-    201, 419, 421, 289, 44, 85, 55, 245, 222, -181,
-    -155, -165, -173, -412, -253, -85, -185, -483, -344, -86,
-    40, 143, 168, 121, 101, 343, 464, 364, 23, 61,
-    113, 202, 253, -22, -206, -160, -121, -184, -363, -169,
-    -81, -362, -425, -163, 28, 69, 236, 107, 101, 205,
-    426, 397, 177, 40, 72, 115, 248, 114, -199, -125,
-    -185, -176, -338, -250, -115, -241, -451, -332, -25, 113,
-    155, 86, 103, 198, 332, 403, 334, 103, 53, 79,
-    276, 236, -134, -168, -94, -160, -287, -294, -120, -167,
-    -435, -420, -150, 42, 108, 156, 49, 82, 283, 429,
-    344, 134, 61, 65, 187, 287, 101, -187, -141, -143,
-    -193, -346, -198, -75, -306, -470, -261, 27, 86, 128,
-    92, 120, 194, 398, 386, 226, 51, 142, 122, 233,
-    160, -106, -175, -132, -130, -316, -303, -138, -135, -502,
-    -364, -61, 74, 89, 118, 106, 103, 292, 422, 322,
-    85, 93, 128, 168, 255, -29, -198, -101, -57, -231,
-    -349, -119, -116, -363, -426, -135, -9, 83, 134, 86,
-    87, 163, 371, 328, 195, 51, 77, 121, 233, 125,
-    -173, -108, -89, -137, -315, -188, -68, -211, -459, -261,
-    7, 31, 105, 90, 65, 114, 312, 353, 269, 58,
-    78, 63, 193, 238, -45, -169, -84, -68, -230, -269,
-    -119, -79, -341, -389, -163, -4, 78, 108, 50, 55,
-    221, 337, 277, 144, 23, 68, 104, 274, 117, -138,
-    -111, -65, -118, -312, -129, -66, -204, -406, -218, -50,
-    12, 126, 96, 77, 94, 326, 305, 209, 17, 67,
-    72, 180, 247, -59, -125, -112, -78, -256, -226, -72,
-    -98, -362, -350, -107, -1, 91, 103, 60, 52, 235,
-    307, 246, 93, 61, 65, 109, 265, 94, -199, -96,
-    4, -155, -300, -108, -3, -248, -405, -205, 7, 20,
-    137, 83, 0, 107, 303, 295, 144, 52, 73, 91,
-    151, 196, -99, -131, -61, -50, -171, -260, -103, -86,
-    -247, -346, -131, 45, 103, 80, 57, 82, 171, 273,
-    265, 120, 1, 68, 142, 170, 51, -130, -84, -56,
-    -91, -224, -177, -55, -177, -292, -207, 9, 57, 93,
-    44, 39, 133, 221, 275, 154, 47, 48, 74, 130,
-    139, -57, -135, -78, -84, -137, -250, -80, -74, -259,
-    -319, -54, 92, 44, 63, 45, 105, 145, 284, 232,
-    80, -12, 114, 122, 166, 18, -129, -81, -57, -94,
-    -254, -149, -19, -145, -344, -186, -15, 58, 73, 89,
-    38, 104, 233, 262, 134, 37, 62, 72, 131, 149,
-    -63, -144, -37, -52, -166, -238, -86, -60, -225, -289,
-    -99, 22, 98, 89, 58, 62, 159, 249, 220, 98,
-    29, 69, 79, 135, 34, -97, -89, -28, -94, -249,
-    -205, -18, -105, -296, -215, -2, 79, 73, 75, 54,
-    108, 207, 250, 147, 42, 39, 75, 129, 130, -62,
-    -113, -46, -64, -151, -242, -78, -23, -199, -311, -117,
-    32, 67, 81, 71, 48, 118, 258, 223, 69, -20,
-    82, 99, 147, 47, -97, -86, -42, -72, -197, -141,
-    -16, -102, -277, -206, -18, 58, 75, 83, 23, 76,
-    194, 251, 141, 17, 10, 81, 108, 138, -45, -131,
-    -54, -53, -110, -211, -72, -57, -156, -277, -115, 26,
-    90, 53, 39, 80, 134, 209, 161, 129, 6, 25,
-    79, 168, 54, -101, -94, -59, -69, -169, -123, -31,
-    -99, -246, -201, 2, 60, 57, 43, 66, 90, 162,
-    202, 135, 44, 12, 63, 93, 130, -69, -106, -66,
-    -58, -114, -172, -57, -46, -183, -260, -67, 44, 67,
-    61, 54, 53, 132, 218, 179, 80, 13, 40, 77,
-    137, 32, -122, -54, -44, -72, -161, -133, -38, -104,
-    -229, -197, -1, 30, 81, 72, 37, 59, 171, 209,
-    153, 20, 2, 90, 91, 95, -44, -67, -41, -44,
-    -130, -187, -60, -32, -154, -234, -107, 37, 85, 75,
-    32, 53, 103, 200, 176, 91, 10, 45, 62, 112,
-    60, -101, -80, -42, -43, -206, -149, -34, -59, -230,
-    -198, -14, 57, 54, 47, 62, 85, 149, 184, 165,
-    40, 14, 48, 99, 131, -3, -102, -51, -51, -112,
-    -167, -57, -39, -147, -238, -85, 10, 17, 60, 62,
-    55, 101, 183, 138, 87, 23, 49, 24, 113, 84,
-    -79, -80, -19, -66, -167, -91, -16, -103, -206, -136,
-    -34, 22, 64, 51, 39, 92, 130, 140, 130, 74,
-    16, 38, 79, 111, -37, -75, -17, -51, -104, -144,
-    -58, -41, -141, -217, -72, 13, 42, 35, 34, 58,
-    110, 133, 133, 103, 24, 39, 56, 99, 52, -62,
-    -46, -19, -61, -134, -132, -32, -65, -170, -184, -50,
-    33, 65, 29, 30, 56, 119, 155, 137, 59, 10,
-    48, 69, 115, 1, -60, -60, -35, -64, -139, -99,
-    -25, -85, -195, -135, 14, 51, 42, 41, 29, 71,
-    157, 154, 87, 17, 26, 48, 88, 89, -52, -82,
-    -54, -21, -117, -120, -37, -46, -150, -164, -43, 10,
-    36, 62, 45, 37, 111, 140, 117, 45, 23, 40,
-    55, 100, 38, -77, -65, -16, -53, -147, -65, -10,
-    -98, -196, -103, 34, 18, 34, 30, 43, 55, 121,
-    132, 84, 18, 37, 40, 67, 92, -38, -66, -32,
-    -23, -102, -106, -44, -42, -132, -161, -37, 22, 42,
-    38, 9, 40, 99, 131, 101, 76, 9, 19, 63,
-    99, 28, -62, -37, -31, -50, -114, -73, -45, -56,
-    -157, -112, -17, 29, 42, 11, 36, 45, 95, 137,
-    97, 26, 13, 41, 70, 81, -2, -50, -48, -22,
-    -44, -115, -64, -32, -78, -150, -59, -1, 39, 24,
-    21, 31, 65, 117, 95, 70, 18, 25, 26, 92,
-    52, -53, -49, -14, -39, -84, -79, -45, -48, -112,
-    -113, -37, 16, 36, 30, 19, 41, 84, 105, 90,
-    49, 8, 35, 48, 78, 20, -59, -49, -15, -26,
-    -96, -58, -20, -68, -148, -74, 12, 17, 19, 27,
-    32, 42, 91, 102, 55, 8, 26, 33, 53, 64,
-    -28, -50, -23, -4, -78, -101, -14, -21, -104, -125,
-    -24, 14, 22, 26, 32, 22, 68, 96, 84, 50,
-    1, 18, 46, 72, 19, -55, -36, -14, -27, -75,
-    -72, -30, -37, -114, -97, 3, 26, 14, 15, 47,
-    39, 63, 87, 79, 21, 6, 32, 40, 58, -1,
-    -47, -31, -9, -48, -85, -50, -13, -65, -116, -47,
-    2, 26, 30, 31, 17, 49, 80, 83, 58, 14,
-    8, 29, 61, 35, -34, -43, -12, -35, -52, -73,
-    -42, -35, -67, -93, -43, 11, 31, 33, 26, 39,
-    42, 80, 84, 45, 0, 25, 39, 47, 13, -39,
-    -21, -21, -31, -69, -54, -30, -43, -94, -77, -6,
-    23, 37, 13, 16, 41, 73, 80, 59, 15, 3,
-    32, 43, 48, -16, -44, -26, -8, -45, -80, -35,
-    -20, -60, -111, -40, 16, 19, 22, 21, 27, 55,
-    77, 66, 49, 6, 13, 41, 53, 21, -38, -21,
-    -14, -27, -63, -50, -28, -42, -88, -87, -9, 19,
-    21, 4, 24, 34, 60, 69, 65, 20, 0, 33,
-    48, 43, -9, -21, -12, -21, -36, -54, -50, -23,
-    -44, -96, -65, 2, 25, 8, 15, 21, 36, 58,
-    69, 51, 15, 6, 28, 44, 38, -7, -32, -12,
-    -15, -36, -68, -37, -23, -56, -88, -35, 12, 14,
-    6, 18, 29, 39, 62, 58, 44, 13, 10, 28,
-    48, 32, -15, -30, -12, -20, -55, -54, -13, -25,
-    -85, -74, -10, 1, 2, 21, 23, 22, 37, 63,
-    50, 18, 17, 28, 31, 36, 14, -21, -15, -10,
-    -25, -48, -34, -17, -48, -79, -55, -1, 14, 11,
-    11, 14, 33, 47, 50, 41, 23, 14, 30, 36,
-    25, -6, -14, -8, -14, -20, -56, -43, -16, -43,
-    -80, -47, 13, 12, -5, 9, 18, 36, 52, 50,
-    35, 16, 9, 33, 37, 23, -12, -14, -4, -11,
-    -25, -58, -36, -4, -40, -83, -31, 15, 6, -3,
-    16, 21, 29, 46, 49, 24, 5, 15, 34, 31,
-    15, -13, -17, -6, -10, -33, -47, -19, -14, -55,
-    -68, -15, 20, 8, 1, 12, 20, 32, 48, 43,
-    15, 10, 19, 33, 29, 11, -23, -17, -5, -10,
-    -42, -40, -9, -36, -67, -45, 5, 7, 2, 8,
-    10, 17, 39, 52, 33, 13, 11, 23, 27, 27,
-    0, -29, 1, 0, -26, -45, -25, -16, -39, -53,
-    -25, 1, -1, 12, 8, 6, 24, 45, 38, 25,
-    13, 2, 22, 34, 24, -15, -18, -2, -10, -24,
-    -39, -20, -13, -34, -55, -18, 8, 0, 2, 17,
-    19, 16, 38, 38, 19, 8, 16, 22, 22, 16,
-    -14, -19, -6, 0, -30, -35, -7, -18, -57, -45,
-    0, 5, -3, 4, 15, 11, 24, 33, 29, 12,
-    8, 18, 24, 21, 6, -17, -10, 5, -7, -33,
-    -24, -9, -21, -44, -31, -2, 4, 1, 9, 9,
-    10, 25, 35, 27, 8, 7, 14, 20, 15, 1,
-    -16, -5, 2, -9, -35, -28, -7, -20, -45, -30,
-    2, 3, -1, 9, 6, 8, 29, 37, 19, 5,
-    6, 13, 22, 21, 2, -17, -2, 3, -11, -34,
-    -13, -6, -25, -35, -19, -1, 2, 3, 4, 7,
-    13, 23, 24, 19, 5, 1, 12, 24, 16, -4,
-    -14, -6, -2, -11, -21, -13, -13, -26, -32, -12,
-    0, 4, 2, 3, 11, 14, 17, 20, 22, 5,
-    2, 13, 20, 9, -9, -4, -2, -6, -15, -18,
-    -14, -8, -21, -33, -9, 0, 6, 1, 9, 6,
-    13, 22, 21, 16, -1, 6, 14, 18, 3, -6,
-    -6, -2, -5, -19, -16, -6, -12, -27, -23, -7,
-    3, 5, 4, 4, 8, 14, 21, 14, 9, 4,
-    8, 14, 12, 4, -9, -1, -4, -9, -20, -10,
-    -5, -12, -26, -23, 0, 4, 4, 1, 6, 6,
-    15, 19, 13, 11, 3, 6, 9, 12, 0, -6,
-    0, -1, -14, -18, -7, -3, -16, -27, -12, -3,
-    1, 3, 5, 0, 9, 17, 15, 13, 9, 1,
-    7, 14, 12, 0, -6, 0, -1, -9, -20, -6,
-    -4, -14, -24, -11, 0, 1, -3, 1, 8, 6,
-    11, 15, 12, 4, 4, 8, 12, 10, -5, -5,
-    2, -2, -15, -12, 0, -6, -19, -21, -5, 0,
-    0, 0, 2, 5, 7, 11, 13, 8, 3, 6,
-    12, 7, 4, -1, -2, 0, 0, -10, -15, 0,
-    -3, -19, -21, -3, 0, 0, 0, 1, 3, 7,
-    10, 10, 10, 2, 4, 9, 11, 2, -5, 0,
-    3, -3, -13, -7, -1, -7, -18, -12, -3, 0,
-    0, 0, 1, 3, 9, 9, 11, 5, 1, 4,
-    9, 9, 0, -1, -1, 0, -5, -9, -6, -3,
-    -5, -16, -11, -1, 1, -1, 0, 1, 4, 6,
-    8, 9, 5, 0, 3, 9, 7, 0, -2, 0,
-    0, -6, -8, -2, -3, -8, -12, -7, -1, 0,
-    0, 2, 2, 3, 6, 7, 5, 4, 0, 4,
-    7, 5, 0, -1, 0, -1, -3, -8, -2, -4,
-    -8, -11, -5, -1, -1, 0, 0, 1, 3, 6,
-    6, 5, 4, 1, 4, 7, 5, -1, 0, 0,
-    -1, -4, -3, -2, -5, -7, -9, -4, 0, 0,
-    -2, 0, 1, 2, 4, 5, 3, 2, 2, 3,
-    5, 2, 0, 0, 2, 0, -5, -4, 0, 0,
-    -7, -8, -2, 0, 0, 0, 2, 0, 0, 4,
-    5, 2, 0, 0, 3, 4, 1, 0, 0, 0,
-    0, -4, -2, 0, -2, -6, -4, -1, 0, 0,
-    0, 0, 0, 2, 3, 3, 1, 0, 0, 2,
-    4, 1, -2, 0, 1, -1, -3, -1, 0, -2,
-    -4, -3, 0, 0, 0, 0, 0, 1, 1, 2,
-    2, 1, 0, 0, 2, 1, 0, 0, 0, 0,
-    -1, -2, 0, 0, -1, -3, -2, 0, 0, 0,
-    0, 0, 0, 1, 2, 1, 0, 0, 0, 1,
-    0, 0, 0, 0, 0, 0, -1, -1, 0, 0,
-    -3, -1, 0, 0, 0, 0, 0, 0, 1, 1,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, -1, 0, 0, -1, -2, 0, 0, 0, 0,
-    0, 0, 0, 1, 1, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
-    -1, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0
+static const uint8_t weee_hahaha_16k_data[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x09, 0x00, 0x00,
+    0x00, 0x10, 0x09, 0x90, 0x91, 0x01, 0x19, 0x00, 0x00, 0x09, 0x01, 0x00, 0x91, 0x91, 0x00, 0x19,
+    0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x00, 0x90, 0x92, 0x99, 0x01, 0x00, 0x91, 0x72, 0x1a, 0x3b,
+    0xb1, 0x4a, 0xaa, 0xf0, 0x91, 0xb8, 0x15, 0x9b, 0x96, 0x81, 0x51, 0x1c, 0x80, 0x98, 0x12, 0x0a,
+    0x5a, 0xb8, 0xa2, 0xd5, 0x00, 0x90, 0xd3, 0x10, 0x2d, 0x3b, 0x1a, 0xa0, 0x51, 0x2b, 0x01, 0xb0,
+    0x0a, 0x00, 0x02, 0x00, 0x9e, 0xb4, 0x31, 0x4d, 0x29, 0x2a, 0xb1, 0x01, 0x3d, 0x1d, 0xb9, 0xd6,
+    0x92, 0x88, 0x90, 0x00, 0xa1, 0x13, 0x49, 0x08, 0x83, 0x11, 0x60, 0x1b, 0x21, 0x3f, 0x1d, 0xc1,
+    0x00, 0xb9, 0x00, 0xbb, 0xd2, 0xc3, 0x92, 0x34, 0x5c, 0x11, 0x81, 0x31, 0xd0, 0x40, 0x0c, 0x89,
+    0xa8, 0x2c, 0x88, 0x2b, 0xb0, 0xe2, 0x92, 0xa0, 0x13, 0x01, 0x85, 0x63, 0x49, 0x81, 0x93, 0xa1,
+    0xa3, 0x2f, 0xbb, 0xcb, 0xa1, 0x1e, 0x29, 0xab, 0x97, 0x80, 0x12, 0x08, 0x32, 0x91, 0x44, 0x1a,
+    0x03, 0xb0, 0xa2, 0x9e, 0x3c, 0x8e, 0x0a, 0xd8, 0xb2, 0xa2, 0x11, 0x33, 0x7b, 0x82, 0x83, 0x94,
+    0x02, 0x81, 0x00, 0x0b, 0x0f, 0xab, 0x2b, 0xfa, 0xa0, 0xd0, 0x3a, 0x1d, 0x39, 0x29, 0x01, 0x17,
+    0x48, 0x01, 0x81, 0xa5, 0x91, 0x00, 0x0c, 0x8d, 0xd9, 0xc1, 0x90, 0x98, 0xa3, 0x22, 0x68, 0x38,
+    0x51, 0x29, 0x21, 0x98, 0x90, 0xf8, 0x29, 0x0f, 0x0a, 0x9a, 0xd3, 0xc3, 0x02, 0x90, 0x33, 0x1a,
+    0x24, 0x3a, 0x4a, 0xe3, 0x11, 0xa8, 0x28, 0x1f, 0x0b, 0x8a, 0x8b, 0xd1, 0x92, 0xb3, 0x17, 0x18,
+    0x83, 0xa5, 0x51, 0x0a, 0x3a, 0x9c, 0xb0, 0xe0, 0x08, 0x0a, 0x2c, 0x90, 0x10, 0x04, 0x60, 0x21,
+    0x01, 0x05, 0x18, 0x98, 0xca, 0xe0, 0xba, 0xd0, 0x8b, 0x88, 0x3b, 0x33, 0x62, 0x17, 0x01, 0x05,
+    0x18, 0x02, 0x0c, 0xa9, 0x9e, 0x9b, 0xbc, 0xa8, 0xa9, 0x12, 0x51, 0x35, 0x52, 0x33, 0x42, 0x21,
+    0xa1, 0xf1, 0xc9, 0xba, 0xad, 0xab, 0x9b, 0x19, 0x59, 0x42, 0x25, 0x34, 0x33, 0x33, 0x02, 0xb1,
+    0xaf, 0xae, 0xac, 0xba, 0xaa, 0x09, 0x20, 0x44, 0x24, 0x26, 0x32, 0x22, 0x11, 0xb0, 0xea, 0xad,
+    0xcb, 0xba, 0xa9, 0x89, 0x32, 0x61, 0x43, 0x24, 0x42, 0x11, 0x01, 0xb8, 0xea, 0xbb, 0xad, 0x9a,
+    0x46, 0xfb, 0x27, 0x00, 0x18, 0x08, 0x43, 0x34, 0x52, 0x14, 0x30, 0x01, 0x89, 0xd8, 0xad, 0xba,
+    0xbc, 0xa0, 0x0a, 0x13, 0x71, 0x32, 0x23, 0x26, 0x10, 0x11, 0x9b, 0xda, 0xbc, 0xac, 0xbb, 0x99,
+    0x90, 0x15, 0x43, 0x34, 0x43, 0x32, 0x02, 0x81, 0x9c, 0xcd, 0xac, 0xbb, 0x8c, 0x99, 0x21, 0x22,
+    0x26, 0x25, 0x41, 0x11, 0x11, 0x98, 0xca, 0xad, 0xac, 0xbb, 0xa9, 0x19, 0x12, 0x44, 0x34, 0x34,
+    0x43, 0x20, 0x81, 0xaa, 0xf9, 0xac, 0xcb, 0x9a, 0x99, 0x10, 0x22, 0x44, 0x25, 0x32, 0x13, 0x31,
+    0x98, 0xcb, 0xcd, 0xdb, 0xaa, 0xaa, 0x88, 0x21, 0x52, 0x43, 0x24, 0x43, 0x11, 0x01, 0xa9, 0xeb,
+    0xcb, 0xcb, 0xa9, 0x9a, 0x10, 0x31, 0x35, 0x34, 0x34, 0x23, 0x21, 0xa0, 0xbb, 0xcf, 0x9c, 0xbb,
+    0xb9, 0x08, 0x20, 0x62, 0x42, 0x33, 0x15, 0x12, 0x02, 0x9a, 0xeb, 0xcb, 0xbb, 0x9c, 0x0b, 0x19,
+    0x50, 0x32, 0x25, 0x05, 0x23, 0x01, 0x90, 0xb9, 0xaf, 0xbb, 0x9d, 0xa9, 0x08, 0x11, 0x42, 0x35,
+    0x32, 0x15, 0x11, 0x01, 0xca, 0xab, 0xde, 0x99, 0xaa, 0x80, 0x10, 0x51, 0x42, 0x41, 0x32, 0x20,
+    0x01, 0xc9, 0xba, 0xce, 0xaa, 0xba, 0x88, 0x00, 0x61, 0x32, 0x62, 0x22, 0x11, 0x02, 0x99, 0xda,
+    0xbc, 0xbc, 0xba, 0x99, 0x08, 0x33, 0x54, 0x24, 0x24, 0x13, 0x21, 0x88, 0xbc, 0xdc, 0xac, 0x9a,
+    0x0c, 0x19, 0x10, 0x24, 0x15, 0x43, 0x12, 0x11, 0x91, 0xda, 0xca, 0xad, 0xaa, 0xaa, 0x18, 0x10,
+    0x35, 0x24, 0x44, 0x12, 0x30, 0x90, 0xbb, 0xfb, 0xac, 0xaa, 0x9a, 0x08, 0x01, 0x34, 0x35, 0x52,
+    0x32, 0x10, 0x81, 0xda, 0xd9, 0xbb, 0xab, 0x9c, 0x08, 0x81, 0x35, 0x43, 0x43, 0x33, 0x30, 0x91,
+    0xdb, 0xea, 0xac, 0x9a, 0x8c, 0x18, 0x08, 0x15, 0x14, 0x42, 0x03, 0x21, 0xa1, 0xbb, 0xfa, 0xad,
+    0x1a, 0xfb, 0x33, 0x00, 0xb9, 0x08, 0x81, 0x51, 0x32, 0x42, 0x14, 0x11, 0x82, 0x9b, 0x9d, 0xaf,
+    0x8a, 0xaa, 0x00, 0x00, 0x43, 0x34, 0x41, 0x14, 0x10, 0x81, 0xab, 0xeb, 0xbc, 0xaa, 0xab, 0x10,
+    0x10, 0x27, 0x33, 0x62, 0x02, 0x20, 0x90, 0xbb, 0xfb, 0xcb, 0x99, 0x0c, 0x00, 0x20, 0x43, 0x05,
+    0x33, 0x83, 0x12, 0xa8, 0xae, 0xdb, 0xcb, 0xb0, 0x1b, 0x20, 0x68, 0x32, 0x23, 0x25, 0x01, 0x02,
+    0xaa, 0xae, 0xdb, 0xab, 0xd8, 0x08, 0x01, 0x42, 0x43, 0x31, 0x24, 0x10, 0x80, 0xcb, 0xac, 0xbe,
+    0x8a, 0xba, 0x11, 0x11, 0x36, 0x24, 0x41, 0x03, 0x10, 0xb0, 0xcc, 0xca, 0xbc, 0x99, 0x8c, 0x21,
+    0x30, 0x54, 0x13, 0x43, 0x82, 0x10, 0xc9, 0xcb, 0xdb, 0xac, 0xa8, 0x09, 0x12, 0x52, 0x62, 0x11,
+    0x33, 0x00, 0x00, 0xbc, 0xac, 0xdc, 0x9a, 0xa9, 0x28, 0x11, 0x63, 0x24, 0x31, 0x05, 0x18, 0x90,
+    0xac, 0xcb, 0xbc, 0xa9, 0xaa, 0x31, 0x31, 0x37, 0x14, 0x43, 0x82, 0x10, 0xc9, 0xbb, 0xdc, 0x8c,
+    0x9a, 0x09, 0x11, 0x42, 0x35, 0x31, 0x24, 0x00, 0x91, 0xea, 0xaa, 0xdc, 0x99, 0xa9, 0x10, 0x11,
+    0x63, 0x23, 0x42, 0x13, 0x18, 0xa0, 0xae, 0xca, 0x9d, 0x99, 0x8a, 0x01, 0x12, 0x36, 0x32, 0x34,
+    0x01, 0x02, 0xea, 0xaa, 0xdc, 0x8a, 0xaa, 0x08, 0x21, 0x51, 0x25, 0x31, 0x23, 0x10, 0x90, 0xae,
+    0xba, 0xaf, 0xa8, 0x9a, 0x11, 0x11, 0x54, 0x12, 0x34, 0x01, 0x11, 0xd8, 0xaa, 0xdc, 0x9a, 0xb9,
+    0x19, 0x11, 0x51, 0x25, 0x21, 0x15, 0x18, 0x91, 0xbb, 0xca, 0xaf, 0x98, 0x9a, 0x11, 0x00, 0x45,
+    0x11, 0x53, 0x81, 0x11, 0xc9, 0x99, 0xdc, 0x99, 0xb9, 0x19, 0x01, 0x51, 0x24, 0x41, 0x13, 0x28,
+    0x91, 0xad, 0xc9, 0xad, 0x99, 0x9a, 0x11, 0x10, 0x55, 0x11, 0x24, 0x82, 0x11, 0xd9, 0x9a, 0xcc,
+    0x70, 0xf8, 0x38, 0x00, 0x99, 0x8b, 0x11, 0x01, 0x37, 0x11, 0x25, 0x00, 0x11, 0xca, 0xaa, 0xdc,
+    0x99, 0xaa, 0x18, 0x11, 0x61, 0x14, 0x41, 0x03, 0x18, 0xa1, 0xad, 0xc9, 0x9d, 0x89, 0x8b, 0x12,
+    0x01, 0x37, 0x11, 0x43, 0x80, 0x01, 0xda, 0x9a, 0xbd, 0x9a, 0xb9, 0x20, 0x12, 0x71, 0x05, 0x32,
+    0x02, 0x28, 0xb8, 0x9e, 0xda, 0xaa, 0xa8, 0x0a, 0x22, 0x30, 0x47, 0x11, 0x14, 0x00, 0x80, 0xdb,
+    0xa9, 0xcc, 0x89, 0x9a, 0x20, 0x02, 0x73, 0x13, 0x42, 0x82, 0x10, 0xc9, 0x9c, 0xdb, 0x9b, 0xb8,
+    0x19, 0x23, 0x78, 0x14, 0x31, 0x14, 0x08, 0x90, 0xad, 0xc9, 0xcb, 0x89, 0x8a, 0x40, 0x00, 0x36,
+    0x11, 0x53, 0x80, 0x00, 0xd9, 0x9a, 0xac, 0x8c, 0x99, 0x18, 0x03, 0x72, 0x22, 0x41, 0x83, 0x00,
+    0xb8, 0x9e, 0xbb, 0xbc, 0xb0, 0x09, 0x42, 0x48, 0x26, 0x21, 0x23, 0x18, 0x98, 0xec, 0xb9, 0xca,
+    0x8a, 0x8a, 0x31, 0x02, 0x47, 0x11, 0x42, 0x00, 0x90, 0xc9, 0xbb, 0xbc, 0x8d, 0xa8, 0x00, 0x04,
+    0x62, 0x12, 0x32, 0x83, 0x91, 0xc8, 0x9e, 0xab, 0xbc, 0xa0, 0x88, 0x24, 0x50, 0x24, 0x21, 0x04,
+    0x00, 0x89, 0xbd, 0xbb, 0xcc, 0x89, 0x89, 0x41, 0x20, 0x36, 0x12, 0x33, 0x00, 0x98, 0xfb, 0xcb,
+    0xc9, 0x8a, 0x99, 0x30, 0x03, 0x46, 0x12, 0x42, 0x01, 0x98, 0xd8, 0xbb, 0xcb, 0x8d, 0x98, 0x08,
+    0x04, 0x52, 0x23, 0x41, 0x02, 0x90, 0xb8, 0xaf, 0xaa, 0xac, 0x98, 0x09, 0x24, 0x50, 0x43, 0x21,
+    0x13, 0x90, 0xa8, 0xbf, 0xba, 0xdb, 0x88, 0x89, 0x42, 0x30, 0x26, 0x22, 0x23, 0x08, 0x9a, 0xdd,
+    0xaa, 0xdb, 0x09, 0x99, 0x41, 0x11, 0x54, 0x11, 0x32, 0x80, 0x98, 0xfa, 0xaa, 0xca, 0x0b, 0xa8,
+    0x40, 0x12, 0x73, 0x12, 0x31, 0x82, 0x98, 0xd9, 0x9d, 0xab, 0x9c, 0xa0, 0x28, 0x14, 0x71, 0x12,
+    0x0e, 0x0a, 0x3a, 0x00, 0x32, 0x88, 0x89, 0xfa, 0xaa, 0xc9, 0x0a, 0x99, 0x40, 0x02, 0x35, 0x13,
+    0x43, 0x00, 0x99, 0xe9, 0xbb, 0xcb, 0x0d, 0x98, 0x28, 0x04, 0x52, 0x13, 0x41, 0x82, 0xa8, 0xc0,
+    0xbd, 0xa9, 0x8e, 0x88, 0x08, 0x14, 0x40, 0x33, 0x30, 0x03, 0xa8, 0xb8, 0xdf, 0x99, 0xac, 0x91,
+    0x88, 0x24, 0x48, 0x24, 0x11, 0x23, 0xa8, 0x09, 0xcf, 0x99, 0xcb, 0x08, 0x89, 0x42, 0x11, 0x35,
+    0x12, 0x33, 0x98, 0x99, 0xed, 0x9a, 0xcb, 0x09, 0x98, 0x51, 0x01, 0x44, 0x02, 0x32, 0x91, 0x8a,
+    0xfa, 0x9c, 0xb9, 0x0b, 0x98, 0x68, 0x82, 0x53, 0x12, 0x41, 0x00, 0x0a, 0xd9, 0xac, 0xc8, 0x0b,
+    0x98, 0x49, 0x03, 0x52, 0x05, 0x30, 0x02, 0x8a, 0xd8, 0xcb, 0xb8, 0x8d, 0x88, 0x19, 0x05, 0x31,
+    0x15, 0x30, 0x12, 0x9a, 0xb8, 0xbf, 0x99, 0x9e, 0x80, 0x88, 0x24, 0x38, 0x25, 0x10, 0x13, 0xa8,
+    0x98, 0xbf, 0x9a, 0xbc, 0x80, 0x98, 0x44, 0x20, 0x44, 0x01, 0x13, 0xa0, 0x09, 0xbf, 0x9a, 0xdb,
+    0x08, 0x98, 0x61, 0x18, 0x43, 0x02, 0x22, 0x91, 0x1b, 0xec, 0x9b, 0xd9, 0x09, 0x98, 0x50, 0x01,
+    0x52, 0x02, 0x31, 0x91, 0x8a, 0xe9, 0x9c, 0xb9, 0x0c, 0x98, 0x48, 0x03, 0x72, 0x02, 0x21, 0x82,
+    0x9a, 0xe0, 0xbb, 0xc8, 0x8c, 0x80, 0x29, 0x05, 0x41, 0x23, 0x40, 0x11, 0xaa, 0xb0, 0xbf, 0xa9,
+    0x8d, 0x90, 0x08, 0x05, 0x31, 0x15, 0x21, 0x11, 0xa9, 0xb0, 0xbf, 0x99, 0x9e, 0x00, 0x09, 0x23,
+    0x41, 0x53, 0x20, 0x12, 0xb9, 0xa0, 0xbf, 0xa9, 0xac, 0x80, 0x98, 0x25, 0x40, 0x43, 0x20, 0x22,
+    0xc0, 0x98, 0xdc, 0x8a, 0xbc, 0x00, 0xa8, 0x34, 0x30, 0x45, 0x01, 0x13, 0xa0, 0x0a, 0xce, 0x8a,
+    0xdb, 0x80, 0x98, 0x52, 0x28, 0x43, 0x02, 0x13, 0xb2, 0x0a, 0xfc, 0x9a, 0xd9, 0x19, 0x98, 0x50,
+    0x99, 0xf6, 0x3c, 0x00, 0x20, 0x24, 0x10, 0x22, 0xaa, 0x88, 0xcf, 0x98, 0xab, 0x80, 0x09, 0x15,
+    0x31, 0x44, 0x20, 0x22, 0xc8, 0x90, 0xdd, 0x89, 0xbb, 0x81, 0x99, 0x16, 0x30, 0x53, 0x20, 0x12,
+    0xc0, 0x90, 0xdc, 0x0a, 0xac, 0x80, 0x98, 0x24, 0x30, 0x44, 0x11, 0x22, 0xc1, 0x09, 0xdc, 0x0b,
+    0xdb, 0x08, 0xa0, 0x52, 0x10, 0x52, 0x01, 0x22, 0xb1, 0x09, 0xdc, 0x9b, 0xe9, 0x88, 0x90, 0x41,
+    0x10, 0x53, 0x02, 0x22, 0xa1, 0x1b, 0xfb, 0x8c, 0xc9, 0x09, 0x98, 0x50, 0x00, 0x24, 0x83, 0x14,
+    0x81, 0x1b, 0xea, 0x8c, 0xc9, 0x09, 0x98, 0x58, 0x81, 0x43, 0x03, 0x22, 0x93, 0x0b, 0xf9, 0x9c,
+    0xc9, 0x8a, 0x90, 0x49, 0x83, 0x53, 0x04, 0x31, 0x82, 0x8a, 0xd8, 0xad, 0xb8, 0x8d, 0x80, 0x29,
+    0x84, 0x42, 0x33, 0x40, 0x11, 0x9a, 0xc0, 0xae, 0xa9, 0x8d, 0x90, 0x08, 0x85, 0x31, 0x34, 0x48,
+    0x11, 0xa9, 0xb1, 0xbe, 0x99, 0x9e, 0x80, 0x09, 0x85, 0x21, 0x24, 0x30, 0x21, 0xb9, 0xa1, 0xbf,
+    0x9a, 0x9d, 0x08, 0x99, 0x15, 0x20, 0x44, 0x10, 0x13, 0xa8, 0x88, 0xbe, 0x8b, 0xad, 0x08, 0x99,
+    0x43, 0x20, 0x45, 0x01, 0x14, 0xa0, 0x88, 0xfb, 0x99, 0xca, 0x08, 0x99, 0x52, 0x18, 0x34, 0x02,
+    0x33, 0xb1, 0x09, 0xfc, 0x8b, 0xca, 0x09, 0xa8, 0x51, 0x10, 0x53, 0x02, 0x23, 0xa2, 0x0a, 0xfb,
+    0x9c, 0xd8, 0x09, 0x88, 0x48, 0x01, 0x43, 0x03, 0x13, 0x93, 0x0b, 0xfb, 0x9c, 0xc9, 0x8a, 0x90,
+    0x69, 0x81, 0x33, 0x04, 0x32, 0x01, 0x8b, 0xe9, 0xac, 0xc9, 0x0b, 0x98, 0x48, 0x83, 0x44, 0x04,
+    0x31, 0x82, 0x8a, 0xe8, 0xac, 0xb8, 0x0d, 0x88, 0x29, 0x84, 0x42, 0x05, 0x30, 0x11, 0x9a, 0xd1,
+    0xac, 0xb8, 0x8d, 0x88, 0x09, 0x86, 0x21, 0x24, 0x38, 0x12, 0xa9, 0xb1, 0xbf, 0x99, 0x9d, 0x80,
+    0x32, 0xed, 0x38, 0x00, 0x58, 0x10, 0x42, 0x83, 0x32, 0x92, 0x1b, 0xfb, 0x9c, 0xc8, 0x0a, 0x90,
+    0x49, 0x02, 0x62, 0x03, 0x31, 0x01, 0x0c, 0xd8, 0x9c, 0xc8, 0x8a, 0x80, 0x4a, 0x83, 0x33, 0x07,
+    0x31, 0x01, 0x8b, 0xd0, 0xac, 0xc8, 0x8b, 0x80, 0x4b, 0x84, 0x32, 0x06, 0x21, 0x02, 0x8b, 0xd0,
+    0xdb, 0xb0, 0x0c, 0x88, 0x3a, 0x84, 0x33, 0x07, 0x21, 0x10, 0x8a, 0xb8, 0xcd, 0xa8, 0x0d, 0x88,
+    0x2a, 0x85, 0x21, 0x15, 0x30, 0x01, 0xa9, 0xc1, 0xbd, 0x98, 0x0f, 0x88, 0x19, 0x84, 0x21, 0x14,
+    0x30, 0x11, 0xb9, 0xd2, 0xeb, 0x88, 0x8d, 0x08, 0x09, 0x04, 0x30, 0x24, 0x48, 0x01, 0xa8, 0xc1,
+    0xdb, 0x89, 0x8e, 0x80, 0x09, 0x84, 0x21, 0x24, 0x30, 0x12, 0xc8, 0xb1, 0xdc, 0x89, 0x9d, 0x80,
+    0x89, 0x05, 0x20, 0x34, 0x38, 0x22, 0xb9, 0xc2, 0xec, 0x98, 0x9c, 0x80, 0x89, 0x05, 0x30, 0x43,
+    0x48, 0x11, 0xa8, 0xa0, 0xdc, 0x8a, 0xac, 0x90, 0x98, 0x07, 0x20, 0x42, 0x38, 0x02, 0xa8, 0xb1,
+    0xcd, 0x8a, 0x9e, 0x80, 0x98, 0x05, 0x20, 0x43, 0x38, 0x12, 0xb8, 0x90, 0xce, 0x0a, 0xad, 0x80,
+    0x98, 0x15, 0x38, 0x43, 0x20, 0x13, 0xb8, 0x90, 0xcf, 0x89, 0xac, 0x80, 0xa8, 0x25, 0x28, 0x44,
+    0x28, 0x22, 0xb8, 0x80, 0xce, 0x89, 0xac, 0x08, 0xa8, 0x15, 0x20, 0x44, 0x28, 0x12, 0xa0, 0xa0,
+    0xec, 0x0a, 0xbc, 0x80, 0xa8, 0x06, 0x30, 0x42, 0x20, 0x22, 0xb8, 0x90, 0xed, 0x89, 0xbb, 0x80,
+    0xa8, 0x06, 0x30, 0x53, 0x48, 0x11, 0xa8, 0xa1, 0xfb, 0x89, 0x9c, 0x80, 0x99, 0x05, 0x30, 0x43,
+    0x59, 0x01, 0x98, 0xa1, 0xcc, 0x09, 0x9e, 0x80, 0xa8, 0x86, 0x10, 0x23, 0x48, 0x11, 0x99, 0x91,
+    0xcd, 0x09, 0x8e, 0x08, 0x89, 0x94, 0x12, 0x15, 0x38, 0x11, 0x89, 0xb0, 0xec, 0x88, 0x8d, 0x08,
+    0xfb, 0xed, 0x3b, 0x00, 0x40, 0x29, 0x41, 0x01, 0x04, 0xa2, 0x08, 0xcb, 0x8d, 0xca, 0x90, 0xa0,
+    0x42, 0x39, 0x63, 0x10, 0x04, 0xa1, 0x80, 0xcb, 0x0d, 0xda, 0x90, 0xa0, 0x23, 0x59, 0x42, 0x28,
+    0x03, 0xb1, 0x91, 0xbd, 0x0d, 0xcb, 0x90, 0xc1, 0x04, 0x48, 0x41, 0x28, 0x12, 0xb0, 0xa1, 0xcc,
+    0x1b, 0x9f, 0x90, 0x90, 0x84, 0x21, 0x43, 0x69, 0x00, 0xa0, 0xa1, 0xda, 0x88, 0x0e, 0x09, 0x88,
+    0xa4, 0x22, 0x14, 0x58, 0x00, 0x89, 0xc1, 0xc9, 0x98, 0x0c, 0x89, 0x29, 0xa4, 0x24, 0x84, 0x42,
+    0x10, 0x1b, 0xd8, 0xba, 0xd0, 0x1b, 0x0a, 0x5b, 0x91, 0x15, 0x94, 0x23, 0x10, 0x2c, 0xc9, 0xbb,
+    0xe1, 0x89, 0x08, 0x6a, 0x08, 0x22, 0x93, 0x16, 0x08, 0x2a, 0xbb, 0x9c, 0xf8, 0x90, 0x90, 0x58,
+    0x19, 0x32, 0x01, 0x05, 0x90, 0x18, 0x9d, 0x0c, 0xca, 0xa1, 0xa0, 0x33, 0x7b, 0x31, 0x28, 0x04,
+    0xb0, 0x92, 0xbd, 0x0a, 0xad, 0x90, 0x98, 0x87, 0x38, 0x32, 0x59, 0x01, 0x89, 0xa0, 0xbc, 0x99,
+    0x8f, 0x88, 0x08, 0xa4, 0x43, 0x83, 0x51, 0x81, 0x89, 0xc0, 0xbb, 0xd0, 0x1c, 0x89, 0x6a, 0x90,
+    0x33, 0x93, 0x34, 0x90, 0x1a, 0xda, 0x8d, 0xd8, 0x88, 0x90, 0x40, 0x29, 0x43, 0x10, 0x05, 0xa1,
+    0x08, 0xdb, 0x1c, 0xbb, 0x88, 0xa8, 0x06, 0x30, 0x24, 0x40, 0x01, 0x98, 0xa8, 0xfc, 0x88, 0x9b,
+    0x08, 0x2a, 0x94, 0x24, 0x05, 0x31, 0x10, 0x0b, 0xb9, 0xbf, 0xa0, 0x8c, 0x08, 0x5a, 0x80, 0x34,
+    0x93, 0x15, 0x00, 0x0a, 0xba, 0x9f, 0xc0, 0x89, 0x90, 0x50, 0x29, 0x43, 0x10, 0x84, 0xa1, 0x88,
+    0xdb, 0x0d, 0xb9, 0x88, 0x90, 0x85, 0x41, 0x23, 0x68, 0x00, 0x98, 0x98, 0xfb, 0x88, 0x9b, 0x18,
+    0x2a, 0x94, 0x53, 0x03, 0x52, 0x08, 0x99, 0xb8, 0xbe, 0xb0, 0x8b, 0x08, 0x78, 0x18, 0x34, 0x10,
+    0xe8, 0x0c, 0x35, 0x00, 0x81, 0x99, 0x8c, 0xdd, 0x88, 0x9b, 0x00, 0x49, 0x82, 0x54, 0x92, 0x24,
+    0x88, 0x99, 0x9b, 0xaf, 0xa8, 0xa9, 0x92, 0x61, 0x28, 0x63, 0x08, 0x84, 0xa0, 0xa0, 0xba, 0x0f,
+    0x99, 0x89, 0x92, 0x14, 0x50, 0x22, 0x48, 0x81, 0xa9, 0xc9, 0xea, 0x89, 0xa9, 0x18, 0x30, 0x03,
+    0x46, 0x82, 0x43, 0x89, 0x9a, 0xac, 0x9e, 0xa8, 0xa9, 0x93, 0x62, 0x38, 0x63, 0x08, 0x84, 0xa8,
+    0x98, 0xac, 0x0c, 0x8b, 0x89, 0x82, 0x07, 0x31, 0x23, 0x68, 0x90, 0x99, 0xc9, 0xda, 0x89, 0x9a,
+    0x10, 0x50, 0x11, 0x44, 0x82, 0x23, 0xb9, 0x99, 0xaf, 0x8c, 0x9a, 0x98, 0x82, 0x15, 0x31, 0x35,
+    0x38, 0x83, 0xca, 0xe0, 0xca, 0x89, 0x8b, 0x29, 0x48, 0x03, 0x35, 0x14, 0x40, 0x88, 0x9b, 0xea,
+    0xbb, 0xa8, 0x9a, 0x12, 0x61, 0x22, 0x35, 0x11, 0x04, 0xa9, 0xab, 0xce, 0x8a, 0x9a, 0x19, 0x40,
+    0x22, 0x73, 0x12, 0x31, 0xa0, 0x8b, 0xcc, 0xad, 0xa9, 0xa8, 0x82, 0x43, 0x42, 0x44, 0x01, 0x84,
+    0xc0, 0xb0, 0xcb, 0x0c, 0x8b, 0x1a, 0x10, 0x15, 0x43, 0x24, 0x48, 0x80, 0x9b, 0xe9, 0xca, 0xa8,
+    0x99, 0x10, 0x42, 0x31, 0x26, 0x02, 0x13, 0xc8, 0xb8, 0xdc, 0x9b, 0x8a, 0x1b, 0x40, 0x32, 0x44,
+    0x14, 0x21, 0x81, 0x8d, 0xba, 0xae, 0xa8, 0xa9, 0x01, 0x33, 0x53, 0x44, 0x11, 0x22, 0xc9, 0xb8,
+    0xdc, 0x8b, 0x9a, 0x2b, 0x20, 0x25, 0x52, 0x14, 0x30, 0x91, 0x9b, 0xcb, 0xaf, 0x99, 0xa9, 0x82,
+    0x14, 0x23, 0x45, 0x10, 0x12, 0xc8, 0xb8, 0xfb, 0x9a, 0x09, 0x2b, 0x48, 0x21, 0x34, 0x04, 0x32,
+    0x88, 0x0d, 0xac, 0x9d, 0xa9, 0xa8, 0x01, 0x05, 0x32, 0x35, 0x10, 0x84, 0xb8, 0xc8, 0xcc, 0x9a,
+    0x99, 0x19, 0x31, 0x43, 0x44, 0x23, 0x41, 0x88, 0x8c, 0xeb, 0xab, 0x99, 0x0b, 0x30, 0x23, 0x26,
+    0x9b, 0x06, 0x35, 0x00, 0x22, 0x33, 0xd0, 0xb8, 0xfb, 0x9c, 0x8a, 0x0a, 0x38, 0x13, 0x35, 0x06,
+    0x31, 0x00, 0x9b, 0xca, 0xae, 0x99, 0xaa, 0x81, 0x14, 0x33, 0x45, 0x21, 0x21, 0xc8, 0xb9, 0xfa,
+    0xaa, 0x99, 0x1a, 0x50, 0x30, 0x43, 0x04, 0x13, 0x90, 0xab, 0xec, 0x9b, 0x8b, 0x8a, 0x20, 0x24,
+    0x34, 0x16, 0x21, 0x82, 0xaa, 0xcb, 0xae, 0xaa, 0xb8, 0x81, 0x15, 0x52, 0x51, 0x10, 0x01, 0xb0,
+    0xb8, 0xcd, 0x9a, 0x9a, 0x19, 0x40, 0x31, 0x54, 0x03, 0x23, 0xa0, 0xba, 0xec, 0x9c, 0x8a, 0x0a,
+    0x20, 0x13, 0x26, 0x24, 0x31, 0x80, 0xab, 0xeb, 0xac, 0x9a, 0x9a, 0x00, 0x15, 0x42, 0x53, 0x20,
+    0x03, 0xb9, 0xc9, 0xcd, 0xa9, 0xa9, 0x08, 0x51, 0x40, 0x42, 0x12, 0x12, 0xc1, 0xa9, 0xdc, 0xaa,
+    0x99, 0x0a, 0x50, 0x11, 0x25, 0x13, 0x23, 0x80, 0x9c, 0xbd, 0xbc, 0x9a, 0xa8, 0x30, 0x14, 0x35,
+    0x24, 0x32, 0x81, 0xc9, 0xda, 0xad, 0x8a, 0x9a, 0x00, 0x85, 0x43, 0x33, 0x41, 0x11, 0xb8, 0xda,
+    0xad, 0xab, 0xb8, 0x80, 0x53, 0x50, 0x42, 0x11, 0x12, 0xb8, 0xc9, 0xcc, 0xba, 0xa8, 0x88, 0x62,
+    0x38, 0x53, 0x02, 0x13, 0x90, 0xab, 0xfc, 0xaa, 0x99, 0x1a, 0x48, 0x30, 0x15, 0x14, 0x12, 0x81,
+    0x9b, 0xfb, 0xbb, 0x8a, 0x0b, 0x48, 0x12, 0x35, 0x05, 0x32, 0xa1, 0x89, 0xcd, 0xab, 0x8c, 0x8a,
+    0x00, 0x85, 0x24, 0x43, 0x30, 0x81, 0xa9, 0xda, 0x9e, 0x9a, 0x8a, 0x10, 0x13, 0x34, 0x44, 0x30,
+    0x11, 0x9a, 0xac, 0xaf, 0xaa, 0xc0, 0x81, 0x23, 0x41, 0x63, 0x10, 0x03, 0xaa, 0xb8, 0xaf, 0x9b,
+    0xa9, 0x80, 0x16, 0x21, 0x24, 0x12, 0x02, 0xd8, 0xa9, 0xbd, 0x8b, 0x9a, 0x29, 0x62, 0x40, 0x42,
+    0x01, 0x23, 0xaa, 0xc9, 0xaf, 0xb9, 0xb8, 0x93, 0x33, 0x72, 0x32, 0x20, 0x12, 0xaa, 0xbc, 0xdd,
+    0x35, 0xf8, 0x39, 0x00, 0x89, 0x0a, 0x31, 0x11, 0x26, 0x13, 0x32, 0xa0, 0xd9, 0xea, 0xab, 0x0b,
+    0x1b, 0x40, 0x03, 0x17, 0x04, 0x21, 0x90, 0xc9, 0xe9, 0xa9, 0x99, 0x2a, 0x30, 0x12, 0x17, 0x22,
+    0x22, 0x98, 0xc9, 0xfb, 0x9a, 0x8a, 0x2b, 0x40, 0x11, 0x17, 0x02, 0x22, 0x98, 0xab, 0xfb, 0xaa,
+    0x9a, 0x1a, 0x21, 0x24, 0x26, 0x32, 0x40, 0x98, 0xba, 0xfa, 0x8c, 0x8a, 0x2b, 0x21, 0x22, 0x17,
+    0x13, 0x21, 0x98, 0xbb, 0xfb, 0x9c, 0x99, 0x3b, 0x38, 0x23, 0x27, 0x13, 0x31, 0x99, 0xcb, 0xfa,
+    0xab, 0xa8, 0x19, 0x51, 0x48, 0x33, 0x13, 0x04, 0xb8, 0xba, 0xce, 0x9a, 0x8a, 0x2a, 0x58, 0x31,
+    0x53, 0x13, 0x22, 0xc0, 0x9a, 0xed, 0x8a, 0xa9, 0x18, 0x31, 0x51, 0x33, 0x23, 0x13, 0xc8, 0xcb,
+    0xec, 0xa9, 0x89, 0x2a, 0x50, 0x30, 0x24, 0x03, 0x14, 0xa9, 0x8c, 0xbe, 0xa9, 0xc0, 0x01, 0x13,
+    0x51, 0x32, 0x31, 0x12, 0xba, 0x9d, 0xbe, 0xaa, 0xd0, 0x10, 0x02, 0x62, 0x22, 0x31, 0x01, 0x9a,
+    0xbc, 0xaf, 0x8a, 0x99, 0x00, 0x85, 0x23, 0x25, 0x21, 0x02, 0xda, 0xb8, 0x9f, 0x89, 0x0b, 0x20,
+    0x02, 0x16, 0x04, 0x11, 0x81, 0xba, 0xd9, 0x9c, 0x0a, 0x1c, 0x20, 0x10, 0x25, 0x33, 0x31, 0x01,
+    0xbd, 0xf8, 0xbb, 0x91, 0x0c, 0x41, 0x2a, 0x34, 0x21, 0x23, 0xa1, 0xea, 0xf8, 0x99, 0x98, 0x1a,
+    0x21, 0x48, 0x62, 0x20, 0x21, 0xa8, 0x9b, 0xcd, 0x9a, 0xc0, 0x00, 0x83, 0x50, 0x42, 0x20, 0x12,
+    0x98, 0x8b, 0xcf, 0x8a, 0xb9, 0x91, 0x84, 0x33, 0x45, 0x11, 0x02, 0xb9, 0xca, 0xaf, 0x19, 0x8b,
+    0x31, 0x80, 0x26, 0x02, 0x22, 0x92, 0xc9, 0xf8, 0xaa, 0x88, 0x0c, 0x30, 0x2a, 0x44, 0x32, 0x42,
+    0x91, 0xcb, 0xf9, 0xba, 0xa2, 0x19, 0x33, 0x4a, 0x52, 0x10, 0x12, 0xa8, 0x89, 0xbf, 0x8a, 0xb9,
+    0xef, 0xf3, 0x33, 0x00, 0x30, 0x28, 0x72, 0x24, 0x31, 0xb2, 0xc9, 0xf8, 0x9b, 0x98, 0x2a, 0x41,
+    0x4a, 0x42, 0x10, 0x22, 0xb9, 0x99, 0xbf, 0x99, 0xd1, 0x91, 0x95, 0x10, 0x42, 0x20, 0x33, 0x8c,
+    0xaa, 0xaf, 0x09, 0x8b, 0x21, 0x92, 0x06, 0x04, 0x02, 0x82, 0xda, 0xc0, 0xab, 0x01, 0x1e, 0x30,
+    0x2c, 0x51, 0x28, 0x13, 0x99, 0xa9, 0xdd, 0x98, 0xb1, 0x81, 0x96, 0x18, 0x23, 0x30, 0x23, 0xab,
+    0x8c, 0xbf, 0x3b, 0x0d, 0x38, 0x91, 0x33, 0x06, 0x12, 0xa1, 0xe8, 0xf0, 0xa0, 0x81, 0x19, 0x48,
+    0x2b, 0x58, 0x28, 0x21, 0x98, 0x9a, 0x9f, 0x0a, 0xc1, 0xa2, 0x97, 0x00, 0x03, 0x38, 0x01, 0x0b,
+    0xdb, 0x8d, 0x18, 0x2b, 0x38, 0x88, 0x22, 0x07, 0x12, 0x81, 0x8d, 0xda, 0x89, 0xe3, 0x81, 0x93,
+    0x29, 0x60, 0x28, 0x11, 0xa8, 0xba, 0xae, 0x3a, 0x1a, 0x38, 0xc4, 0x82, 0x87, 0x11, 0x81, 0x8a,
+    0xda, 0xaa, 0xa3, 0x08, 0x52, 0x2d, 0x40, 0x28, 0x02, 0x98, 0xab, 0x9f, 0x2a, 0xa0, 0x92, 0xc7,
+    0x82, 0x12, 0x41, 0x18, 0xaa, 0xea, 0xa9, 0x82, 0x18, 0x50, 0x2c, 0x39, 0x11, 0x85, 0x91, 0xba,
+    0x8f, 0x09, 0x80, 0x01, 0xb5, 0x81, 0x14, 0x30, 0x10, 0xba, 0xfb, 0xba, 0x21, 0x1c, 0x78, 0x0a,
+    0x21, 0x82, 0x85, 0x90, 0x9a, 0x8f, 0x19, 0x90, 0x01, 0xc5, 0x81, 0x23, 0x69, 0x18, 0x9b, 0xda,
+    0xa8, 0x93, 0x01, 0x41, 0x0d, 0x30, 0x82, 0x87, 0x90, 0x9a, 0x0d, 0x2a, 0x08, 0x10, 0xe4, 0x81,
+    0x03, 0x50, 0x19, 0x8a, 0xcc, 0xa0, 0x94, 0x00, 0x12, 0x1e, 0x38, 0x10, 0x96, 0xa0, 0xb8, 0x1d,
+    0x39, 0x1a, 0x10, 0xf2, 0x81, 0x84, 0x31, 0x2a, 0x8c, 0x9e, 0x80, 0x92, 0x01, 0x82, 0x1e, 0x31,
+    0x49, 0xa3, 0xc1, 0xea, 0x88, 0x20, 0x18, 0x48, 0xca, 0x11, 0x83, 0x16, 0x09, 0xbb, 0x8f, 0x00,
+    0x0e, 0xfb, 0x3d, 0x00, 0x28, 0x10, 0x9d, 0x21, 0x21, 0x14, 0x98, 0xdc, 0x9a, 0x20, 0x01, 0x32,
+    0xf9, 0x18, 0x02, 0x34, 0x88, 0xcb, 0x8f, 0x29, 0x01, 0x00, 0xd3, 0x0a, 0x32, 0x61, 0x80, 0xc8,
+    0xcb, 0x90, 0x33, 0x80, 0x60, 0x9e, 0x21, 0x10, 0x85, 0x98, 0xda, 0x1a, 0x20, 0x11, 0x19, 0xf0,
+    0x19, 0x84, 0x42, 0x99, 0xaa, 0x8e, 0x11, 0x82, 0x81, 0xc0, 0x1c, 0x33, 0x41, 0x91, 0xea, 0xbb,
+    0x01, 0x15, 0x80, 0x91, 0x8f, 0x21, 0x31, 0x93, 0xd9, 0xdb, 0x08, 0x33, 0x00, 0x08, 0xaf, 0x20,
+    0x14, 0x03, 0xb9, 0xbd, 0x0a, 0x71, 0x81, 0x08, 0xca, 0x18, 0x24, 0x22, 0xa9, 0xbd, 0x9b, 0x62,
+    0x02, 0x89, 0xd8, 0x2b, 0x53, 0x31, 0xb8, 0xdb, 0xba, 0x33, 0x06, 0x88, 0xa9, 0x8d, 0x43, 0x22,
+    0xa1, 0xdb, 0xbb, 0x31, 0x35, 0x98, 0x8b, 0xae, 0x52, 0x22, 0x81, 0xbc, 0xca, 0x20, 0x24, 0x91,
+    0x9b, 0xcb, 0x68, 0x14, 0x01, 0xca, 0xaa, 0x2a, 0x44, 0x91, 0xaa, 0xb9, 0x4a, 0x37, 0x00, 0xba,
+    0xab, 0x8a, 0x36, 0x93, 0xbb, 0xa9, 0x2b, 0x77, 0x00, 0x99, 0xaa, 0x09, 0x32, 0x04, 0xbb, 0x9a,
+    0x0a, 0x57, 0x82, 0xa9, 0xba, 0x88, 0x41, 0x14, 0xca, 0x9a, 0x80, 0x73, 0x03, 0xa9, 0x9c, 0x89,
+    0x40, 0x23, 0xca, 0x8c, 0x08, 0x62, 0x04, 0x99, 0xab, 0x0a, 0x31, 0x24, 0xe8, 0x9b, 0x01, 0x51,
+    0x14, 0xa9, 0xab, 0x09, 0x11, 0x15, 0xc0, 0x9d, 0x20, 0x20, 0x35, 0xa9, 0xcb, 0x08, 0x01, 0x14,
+    0xa8, 0xbe, 0x30, 0x01, 0x36, 0xb0, 0xca, 0x09, 0x11, 0x12, 0x90, 0xcf, 0x38, 0x01, 0x52, 0xa1,
+    0xaa, 0x1b, 0x11, 0x39, 0x81, 0xde, 0x19, 0x04, 0x20, 0x96, 0x99, 0x8a, 0x10, 0x08, 0x12, 0xfb,
+    0x0b, 0x33, 0x10, 0x17, 0xaa, 0x9a, 0x20, 0x88, 0x13, 0xf9, 0x9c, 0x42, 0x80, 0x34, 0xb9, 0xaa,
+    0x19, 0xfd, 0x38, 0x00, 0x01, 0x29, 0x11, 0xfc, 0x1b, 0x05, 0x10, 0x14, 0xbb, 0x0a, 0x28, 0x89,
+    0x04, 0xf8, 0x9b, 0x25, 0x08, 0x34, 0xbb, 0xaa, 0x21, 0xc1, 0x12, 0xf8, 0x8b, 0x52, 0x81, 0x51,
+    0xb8, 0x9a, 0x01, 0x90, 0x28, 0xc3, 0xbf, 0x42, 0x91, 0x42, 0xa1, 0xbb, 0x39, 0xa0, 0x58, 0x90,
+    0xaf, 0x38, 0x84, 0x58, 0x92, 0x9b, 0x89, 0x92, 0x2b, 0x23, 0xee, 0x29, 0x04, 0x29, 0x05, 0xba,
+    0x09, 0x81, 0x0b, 0x14, 0xeb, 0x1a, 0x24, 0x19, 0x25, 0xbb, 0x99, 0x12, 0xaa, 0x22, 0xf0, 0x0f,
+    0x32, 0x98, 0x33, 0xb9, 0x8c, 0x20, 0xb9, 0x21, 0xe3, 0x8f, 0x41, 0x80, 0x40, 0xa0, 0xab, 0x21,
+    0xc8, 0x11, 0xb2, 0xaf, 0x42, 0x81, 0x58, 0x91, 0x9c, 0x20, 0xc8, 0x10, 0x92, 0xbd, 0x41, 0x83,
+    0x59, 0x01, 0xac, 0x28, 0xb0, 0x09, 0x23, 0xfc, 0x39, 0x94, 0x38, 0x84, 0xba, 0x2b, 0xc3, 0x2a,
+    0x12, 0xfb, 0x3c, 0x04, 0x19, 0x04, 0xba, 0x2a, 0xa3, 0x9b, 0x12, 0xf0, 0x1d, 0x14, 0x89, 0x24,
+    0xb8, 0x9a, 0x03, 0x9d, 0x31, 0xd0, 0x8d, 0x33, 0x90, 0x63, 0xb8, 0x9a, 0x03, 0xb9, 0x20, 0xd1,
+    0xad, 0x44, 0x90, 0x40, 0xa1, 0x9a, 0x20, 0xd9, 0x08, 0x02, 0xcd, 0x41, 0x92, 0x59, 0x82, 0xab,
+    0x39, 0xd1, 0x19, 0x82, 0xdc, 0x48, 0x83, 0x4a, 0x82, 0xba, 0x28, 0xd3, 0x0b, 0x12, 0xfa, 0x39,
+    0x85, 0x1a, 0x05, 0xa9, 0x09, 0x92, 0x0c, 0x21, 0xea, 0x2a, 0x15, 0x89, 0x14, 0xc9, 0x08, 0xa3,
+    0xaa, 0x32, 0xf9, 0x2c, 0x14, 0x89, 0x23, 0xc9, 0x1a, 0x83, 0x8d, 0x00, 0xb1, 0x8f, 0x15, 0x98,
+    0x22, 0x98, 0x9b, 0x15, 0x9d, 0x10, 0x91, 0x9d, 0x34, 0xa9, 0x42, 0x90, 0xab, 0x23, 0xbc, 0x22,
+    0xa0, 0xbf, 0x63, 0x90, 0x30, 0x90, 0xab, 0x42, 0xba, 0x88, 0x03, 0xdf, 0x42, 0x90, 0x38, 0x01,
+    0xb8, 0x03, 0x3d, 0x00, 0x1b, 0x95, 0x8b, 0x11, 0xc0, 0x0f, 0x33, 0x99, 0x42, 0xb8, 0x8b, 0x05,
+    0xab, 0x20, 0xd3, 0x0e, 0x33, 0xa9, 0x42, 0xa0, 0x8c, 0x13, 0x9d, 0x10, 0xa3, 0x9f, 0x33, 0xa8,
+    0x32, 0x91, 0x9e, 0x32, 0x9d, 0x10, 0x91, 0x9e, 0x42, 0x90, 0x30, 0xa2, 0xac, 0x33, 0xcc, 0x82,
+    0x10, 0xdd, 0x61, 0x90, 0x28, 0x80, 0xa9, 0x40, 0xc8, 0x08, 0x01, 0xdb, 0x51, 0xa1, 0x10, 0x83,
+    0xbb, 0x68, 0xb8, 0x29, 0x11, 0xcd, 0x58, 0x92, 0x29, 0x83, 0xca, 0x28, 0xd2, 0x08, 0x11, 0xfb,
+    0x38, 0x84, 0x1a, 0x03, 0xab, 0x49, 0xc1, 0x1a, 0x11, 0xf9, 0x4a, 0x83, 0x1a, 0x04, 0xb9, 0x3a,
+    0xd4, 0x2a, 0x00, 0xd8, 0x3a, 0x06, 0x0a, 0x03, 0xa9, 0x1a, 0xa4, 0x0c, 0x11, 0xe8, 0x2b, 0x16,
+    0x8a, 0x23, 0xb9, 0x1b, 0x96, 0x0c, 0x01, 0xb0, 0x0d, 0x16, 0x8a, 0x13, 0x99, 0x8a, 0x84, 0x8c,
+    0x02, 0xb8, 0x0d, 0x16, 0x99, 0x23, 0xa9, 0x8a, 0x05, 0x9d, 0x12, 0xb8, 0x0c, 0x25, 0xa9, 0x33,
+    0xb8, 0x8a, 0x04, 0x9d, 0x20, 0xb1, 0x9f, 0x25, 0x99, 0x22, 0x98, 0xab, 0x16, 0xac, 0x12, 0xa0,
+    0xac, 0x45, 0xa9, 0x32, 0x98, 0x9b, 0x43, 0xad, 0x21, 0x98, 0xad, 0x54, 0xa8, 0x21, 0xa0, 0x99,
+    0x32, 0xcc, 0x21, 0xa0, 0xad, 0x44, 0xb0, 0x41, 0xa0, 0xa9, 0x42, 0xdb, 0x11, 0x91, 0xad, 0x63,
+    0xa8, 0x31, 0x98, 0xa9, 0x52, 0xcb, 0x21, 0x88, 0xbc, 0x73, 0xb0, 0x31, 0x90, 0x9a, 0x50, 0xd9,
+    0x10, 0x80, 0xca, 0x61, 0xa1, 0x38, 0x90, 0xa9, 0x60, 0xd8, 0x10, 0x80, 0xba, 0x70, 0xa1, 0x38,
+    0x80, 0xa9, 0x30, 0xf0, 0x28, 0x88, 0xc9, 0x68, 0xa2, 0x39, 0x91, 0xa8, 0x5a, 0xe2, 0x29, 0x80,
+    0xb9, 0x58, 0xa4, 0x3a, 0x82, 0x9a, 0x49, 0xe1, 0x18, 0x91, 0xc9, 0x58, 0xb3, 0x39, 0x93, 0xa9,
+    0xd3, 0xfb, 0x3b, 0x00, 0x24, 0x8f, 0x01, 0x90, 0x8d, 0x34, 0xaa, 0x23, 0x98, 0x9b, 0x34, 0x9f,
+    0x02, 0x98, 0xab, 0x55, 0xa9, 0x22, 0x98, 0xa8, 0x60, 0xbb, 0x22, 0xa0, 0x9d, 0x53, 0xb0, 0x31,
+    0x80, 0xcb, 0x52, 0xca, 0x21, 0x98, 0xbc, 0x73, 0xb0, 0x31, 0x90, 0xb9, 0x71, 0xc9, 0x11, 0x88,
+    0xba, 0x73, 0xb0, 0x30, 0x90, 0xa9, 0x70, 0xc9, 0x20, 0x90, 0xaa, 0x71, 0xa0, 0x38, 0x80, 0x99,
+    0x58, 0xe8, 0x20, 0x98, 0xa8, 0x68, 0xa1, 0x49, 0xa1, 0x88, 0x39, 0xf1, 0x28, 0x90, 0xb9, 0x60,
+    0xb2, 0x49, 0x91, 0x99, 0x48, 0xd1, 0x29, 0x90, 0xb8, 0x79, 0xa2, 0x3a, 0x82, 0xa9, 0x59, 0xf2,
+    0x29, 0x80, 0xa8, 0x4a, 0x94, 0x3b, 0x93, 0xa8, 0x3a, 0xc4, 0x2c, 0x92, 0xc9, 0x4a, 0x85, 0x0a,
+    0x13, 0xaa, 0x2a, 0xa6, 0x1c, 0x01, 0xc9, 0x4a, 0x86, 0x0b, 0x03, 0x99, 0x19, 0xa5, 0x1d, 0x92,
+    0xa8, 0x3b, 0x07, 0x0b, 0x03, 0x98, 0x0a, 0x95, 0x1d, 0x81, 0xb8, 0x4b, 0x05, 0x0b, 0x13, 0xa9,
+    0x1a, 0x96, 0x0d, 0x02, 0xa9, 0x1c, 0x06, 0x8a, 0x13, 0xa8, 0x89, 0x85, 0x0d, 0x82, 0x89, 0x8c,
+    0x16, 0x9a, 0x13, 0x88, 0x9a, 0x05, 0x8d, 0x82, 0x88, 0x9c, 0x26, 0xaa, 0x13, 0x90, 0xa9, 0x24,
+    0xad, 0x12, 0x98, 0x9d, 0x25, 0xb8, 0x31, 0x91, 0x8c, 0x13, 0xac, 0x11, 0x80, 0xce, 0x63, 0xa8,
+    0x20, 0x81, 0xba, 0x53, 0xcb, 0x12, 0x09, 0xfa, 0x51, 0xb0, 0x20, 0x00, 0xa9, 0x50, 0xd8, 0x10,
+    0x80, 0xc9, 0x50, 0xb1, 0x38, 0x81, 0xb8, 0x48, 0xe1, 0x39, 0x90, 0xb9, 0x69, 0xa3, 0x3b, 0x84,
+    0x9a, 0x38, 0xe2, 0x19, 0x00, 0xd8, 0x5b, 0x94, 0x1a, 0x02, 0x98, 0x2b, 0xa5, 0x1d, 0x81, 0xa8,
+    0x1b, 0x17, 0x8b, 0x14, 0x89, 0x89, 0x02, 0x8d, 0x11, 0x98, 0x9e, 0x25, 0x9a, 0x22, 0x90, 0xa9,
+    0x32, 0x03, 0x3b, 0x00, 0xd3, 0x2b, 0x01, 0xd9, 0x3c, 0x87, 0x0a, 0x03, 0x98, 0x1a, 0xa3, 0x0d,
+    0x01, 0x98, 0x8f, 0x25, 0x9b, 0x32, 0x98, 0x99, 0x22, 0xbd, 0x13, 0x99, 0xcc, 0x64, 0xb8, 0x40,
+    0x80, 0x99, 0x20, 0xb9, 0x39, 0xa1, 0xeb, 0x60, 0xb2, 0x49, 0x92, 0x99, 0x4a, 0xe2, 0x39, 0x98,
+    0x98, 0x3c, 0x87, 0x1b, 0x84, 0x89, 0x09, 0x93, 0x0d, 0x01, 0xa8, 0x0c, 0x17, 0x8b, 0x13, 0x88,
+    0x9b, 0x15, 0x8e, 0x11, 0x89, 0xaa, 0x45, 0xaa, 0x32, 0x98, 0xa9, 0x32, 0xeb, 0x21, 0x99, 0xd9,
+    0x71, 0xa0, 0x38, 0x91, 0x99, 0x48, 0xd8, 0x28, 0x90, 0xb8, 0x7a, 0xa3, 0x3b, 0x03, 0xa9, 0x3b,
+    0xb4, 0x0e, 0x82, 0x98, 0x0e, 0x16, 0x8b, 0x13, 0x89, 0x9a, 0x14, 0xac, 0x12, 0x09, 0xcc, 0x64,
+    0xb9, 0x32, 0x98, 0x99, 0x31, 0xea, 0x20, 0x88, 0xd9, 0x60, 0xb1, 0x38, 0x81, 0x99, 0x3a, 0xd2,
+    0x3a, 0x90, 0xb8, 0x3f, 0x86, 0x1b, 0x83, 0x88, 0x8a, 0x83, 0x8d, 0x82, 0x88, 0xad, 0x27, 0xaa,
+    0x33, 0x98, 0xaa, 0x42, 0xbc, 0x13, 0x0b, 0xf8, 0x70, 0xb0, 0x30, 0x80, 0xa8, 0x49, 0xd0, 0x28,
+    0x98, 0x91, 0x3d, 0x95, 0x2b, 0x83, 0x88, 0x8b, 0x95, 0x1d, 0xa2, 0x00, 0xac, 0x36, 0xab, 0x33,
+    0x89, 0xaa, 0x23, 0xad, 0x13, 0x8b, 0xf8, 0x70, 0xa0, 0x28, 0x81, 0xa8, 0x39, 0xd1, 0x39, 0x99,
+    0xb2, 0x3e, 0x96, 0x1a, 0x12, 0x89, 0x8b, 0x85, 0x0d, 0xa3, 0x18, 0xdb, 0x35, 0xba, 0x23, 0x88,
+    0xb9, 0x60, 0xb9, 0x21, 0x0b, 0xe0, 0x69, 0xb2, 0x39, 0x92, 0xa0, 0x3b, 0xd3, 0x3a, 0x98, 0xc2,
+    0x1e, 0x87, 0x0a, 0x02, 0x90, 0x8a, 0x13, 0x8d, 0x92, 0x18, 0xbc, 0x54, 0xb8, 0x31, 0x00, 0xca,
+    0x40, 0xd8, 0x30, 0x8a, 0xc0, 0x59, 0xb3, 0x3a, 0x83, 0x98, 0x1d, 0xa3, 0x2c, 0xa1, 0xa1, 0x0f,
+    0xb1, 0x04, 0x3f, 0x00, 0xd1, 0x48, 0x80, 0xa0, 0x2a, 0xa1, 0x4a, 0xb9, 0x83, 0x8f, 0x07, 0x8a,
+    0x12, 0x88, 0xaa, 0x33, 0x9d, 0x82, 0x29, 0xfb, 0x52, 0xb8, 0x31, 0x80, 0xb9, 0x48, 0xc0, 0x10,
+    0x0a, 0xe2, 0x5b, 0x93, 0x2b, 0x03, 0xb8, 0x2c, 0xa4, 0x2b, 0xb0, 0x02, 0x9f, 0x16, 0x9a, 0x13,
+    0x80, 0xbb, 0x43, 0xcb, 0x13, 0x1c, 0xf8, 0x40, 0xb1, 0x48, 0x80, 0xb0, 0x4a, 0xa1, 0x3a, 0xa9,
+    0xa2, 0x1f, 0x86, 0x0a, 0x03, 0x88, 0x8c, 0x04, 0xaa, 0x92, 0x10, 0xdc, 0x53, 0xb8, 0x31, 0x80,
+    0xc9, 0x40, 0xb8, 0x28, 0x09, 0xf1, 0x4a, 0xa3, 0x2a, 0x13, 0xd0, 0x3b, 0x94, 0x1d, 0x91, 0x90,
+    0x0e, 0x24, 0x9b, 0x32, 0x80, 0xac, 0x23, 0xbb, 0x82, 0x39, 0xfb, 0x7a, 0xb2, 0x28, 0x12, 0xc9,
+    0x4a, 0xa2, 0x1b, 0xa0, 0xa3, 0x8f, 0x07, 0x8a, 0x12, 0x90, 0x9b, 0x05, 0x9a, 0x91, 0x30, 0xce,
+    0x43, 0xa8, 0x48, 0x00, 0xc9, 0x40, 0xc0, 0x28, 0x89, 0xc1, 0x5b, 0x94, 0x2b, 0x93, 0x90, 0x1c,
+    0x84, 0x0d, 0x81, 0x08, 0x9c, 0x16, 0x9a, 0x32, 0x88, 0xba, 0x33, 0xcb, 0x11, 0x19, 0xf9, 0x79,
+    0xb1, 0x28, 0x82, 0xb8, 0x49, 0xb1, 0x3b, 0xa1, 0xb0, 0x1f, 0x07, 0x8b, 0x13, 0x88, 0x9b, 0x24,
+    0x9d, 0x83, 0x09, 0xcb, 0x54, 0xb8, 0x40, 0x90, 0xa8, 0x38, 0xb0, 0x29, 0x08, 0xf9, 0x7a, 0x91,
+    0x19, 0x02, 0xb0, 0x2c, 0x94, 0x0c, 0x81, 0x80, 0x0f, 0x14, 0xaa, 0x33, 0x89, 0xca, 0x43, 0xbb,
+    0x13, 0x0c, 0xe0, 0x68, 0xb1, 0x38, 0x91, 0xb0, 0x4a, 0xb2, 0x3b, 0xa0, 0xb1, 0x2f, 0x86, 0x1b,
+    0x12, 0x88, 0x8c, 0x84, 0x0b, 0x81, 0x80, 0xbd, 0x27, 0xaa, 0x32, 0x80, 0xca, 0x31, 0xc9, 0x21,
+    0x0b, 0xf1, 0x6a, 0xa2, 0x2a, 0x02, 0x98, 0x1c, 0x94, 0x1c, 0xa1, 0x01, 0x9d, 0x16, 0x9a, 0x03,
+    0xf4, 0x0a, 0x41, 0x00, 0xa0, 0x2b, 0xa3, 0x0c, 0xa2, 0x81, 0x9f, 0x07, 0x99, 0x12, 0x80, 0x9b,
+    0x42, 0xab, 0x11, 0x1a, 0xf9, 0x78, 0xa0, 0x28, 0x82, 0xa9, 0x49, 0xc1, 0x29, 0x98, 0xb2, 0x2f,
+    0x85, 0x1b, 0x02, 0x90, 0x0c, 0x03, 0x9c, 0x83, 0x19, 0xad, 0x54, 0xb9, 0x41, 0x80, 0xb9, 0x40,
+    0xc0, 0x29, 0x90, 0xc1, 0x5b, 0x94, 0x1b, 0x04, 0x89, 0x1b, 0x94, 0x0b, 0x91, 0x80, 0xbd, 0x37,
+    0xab, 0x33, 0x90, 0xd9, 0x50, 0xc8, 0x20, 0x0a, 0xc1, 0x6b, 0xa2, 0x3a, 0x82, 0xa0, 0x2c, 0x94,
+    0x1d, 0x91, 0x18, 0x9d, 0x15, 0xa9, 0x23, 0x89, 0xc8, 0x32, 0xca, 0x11, 0x1a, 0xf8, 0x79, 0x90,
+    0x29, 0x81, 0xa0, 0x2a, 0xa4, 0x1c, 0xa1, 0x81, 0x9c, 0x17, 0x8b, 0x13, 0x08, 0xca, 0x43, 0xcb,
+    0x12, 0x1a, 0xe8, 0x68, 0xa0, 0x38, 0x80, 0xa8, 0x4a, 0xb2, 0x1a, 0x90, 0x92, 0x9f, 0x16, 0x9a,
+    0x22, 0x90, 0x9a, 0x23, 0xda, 0x10, 0x08, 0xe9, 0x69, 0xa1, 0x39, 0x83, 0x99, 0x1d, 0x95, 0x0b,
+    0xa2, 0x00, 0xad, 0x36, 0xab, 0x14, 0x88, 0xa9, 0x51, 0xc9, 0x11, 0x99, 0xc1, 0x59, 0xb2, 0x49,
+    0x92, 0x90, 0x2c, 0xa4, 0x1c, 0x91, 0x08, 0x9d, 0x16, 0x9a, 0x23, 0x88, 0xaa, 0x42, 0xda, 0x11,
+    0x89, 0xd8, 0x68, 0xa1, 0x39, 0x82, 0x99, 0x4c, 0xa2, 0x1c, 0x91, 0x08, 0x9d, 0x16, 0xaa, 0x14,
+    0x08, 0xb9, 0x42, 0xd9, 0x11, 0x0a, 0xe1, 0x59, 0xa1, 0x39, 0x81, 0xa0, 0x4b, 0xb3, 0x2d, 0xb1,
+    0x10, 0xbc, 0x17, 0x9a, 0x04, 0x08, 0xb8, 0x51, 0xc9, 0x11, 0x0a, 0xb0, 0x7c, 0xa1, 0x39, 0x00,
+    0x88, 0x1b, 0x95, 0x0c, 0xa3, 0x19, 0xcb, 0x26, 0xaa, 0x23, 0x88, 0xd8, 0x42, 0xd9, 0x11, 0x89,
+    0xb0, 0x7a, 0x91, 0x2a, 0x02, 0x98, 0x1c, 0x95, 0x0b, 0x81, 0x80, 0xbd, 0x17, 0x99, 0x21, 0x80,
+    0xc8, 0x03, 0x3f, 0x00, 0x1a, 0x94, 0x9b, 0x93, 0x88, 0xfa, 0x53, 0xc8, 0x31, 0x90, 0xb8, 0x60,
+    0xc8, 0x28, 0x98, 0x91, 0x2e, 0x84, 0x1b, 0x03, 0x88, 0x9b, 0x06, 0x8c, 0x92, 0x08, 0xf8, 0x41,
+    0xa8, 0x20, 0x01, 0xc8, 0x48, 0xb0, 0x3a, 0xa8, 0x01, 0x8f, 0x15, 0x8b, 0x13, 0x08, 0xda, 0x14,
+    0xca, 0x12, 0x0a, 0xe1, 0x69, 0xb1, 0x38, 0x80, 0x90, 0x2b, 0xa5, 0x1c, 0xb2, 0x20, 0xbc, 0x35,
+    0xba, 0x14, 0x80, 0xc8, 0x41, 0xc9, 0x20, 0x89, 0xb0, 0x6c, 0xa2, 0x2a, 0x83, 0x80, 0x0d, 0x04,
+    0x8d, 0x82, 0x09, 0xd9, 0x43, 0xc8, 0x31, 0x88, 0xc1, 0x48, 0xc0, 0x29, 0x90, 0x08, 0x1f, 0x03,
+    0x0b, 0x04, 0x08, 0xaa, 0x05, 0xab, 0x03, 0x99, 0xf9, 0x51, 0xa8, 0x30, 0x01, 0xa9, 0x5a, 0xa0,
+    0x1a, 0x98, 0x81, 0xaf, 0x16, 0x99, 0x12, 0x01, 0xca, 0x42, 0xca, 0x11, 0x0a, 0xd1, 0x4b, 0xa5,
+    0x29, 0x01, 0x91, 0x0d, 0x95, 0x8a, 0x82, 0x89, 0xca, 0x73, 0xa9, 0x31, 0x80, 0xb0, 0x49, 0xd2,
+    0x29, 0xa8, 0x81, 0x8e, 0x06, 0x8a, 0x12, 0x00, 0xba, 0x24, 0xcb, 0x02, 0x0a, 0xd1, 0x4a, 0x93,
+    0x2a, 0x13, 0x91, 0x0f, 0x84, 0x8c, 0x92, 0x2a, 0xf8, 0x40, 0xa0, 0x20, 0x10, 0xc0, 0x5a, 0xb1,
+    0x2b, 0xa1, 0x80, 0x0e, 0x05, 0x8a, 0x13, 0x00, 0xca, 0x33, 0xbc, 0x21, 0x8b, 0xf2, 0x5b, 0xa3,
+    0x19, 0x02, 0x92, 0x0e, 0x84, 0x8c, 0x92, 0x18, 0xda, 0x51, 0x98, 0x20, 0x01, 0xb8, 0x49, 0xb1,
+    0x2d, 0xa1, 0x88, 0x9d, 0x16, 0x0a, 0x02, 0x11, 0xea, 0x32, 0xca, 0x20, 0x8a, 0xb1, 0x3f, 0x93,
+    0x2a, 0x03, 0x01, 0x9f, 0x85, 0x9a, 0x92, 0x08, 0xd9, 0x41, 0x90, 0x28, 0x12, 0xb8, 0x3c, 0x93,
+    0x0f, 0x90, 0x81, 0x8f, 0x14, 0x99, 0x21, 0x02, 0xac, 0x32, 0xba, 0x39, 0x9a, 0xf1, 0x3c, 0x85,
+    0xb5, 0xfb, 0x40, 0x00, 0x20, 0x11, 0xc9, 0x38, 0x90, 0x0c, 0x90, 0x80, 0xaf, 0x26, 0xa9, 0x22,
+    0x00, 0xca, 0x32, 0xc9, 0x29, 0x90, 0xd9, 0x5b, 0x84, 0x8a, 0x06, 0x88, 0x8a, 0x04, 0x9c, 0x82,
+    0x2a, 0xf9, 0x41, 0xa8, 0x11, 0x01, 0xc1, 0x4a, 0xb1, 0x2a, 0xd1, 0x20, 0xad, 0x34, 0x9a, 0x22,
+    0x28, 0xea, 0x41, 0xb9, 0x28, 0x99, 0xb1, 0x3d, 0x85, 0x0a, 0x23, 0x80, 0x8e, 0x04, 0xab, 0x93,
+    0x29, 0xf9, 0x79, 0xa0, 0x38, 0x08, 0xa1, 0x4b, 0xb3, 0x2e, 0xb1, 0x10, 0xcb, 0x25, 0x9a, 0x22,
+    0x28, 0xe8, 0x30, 0xc8, 0x28, 0x99, 0xa1, 0x2e, 0x03, 0x0a, 0x13, 0x02, 0x9f, 0x13, 0xab, 0x92,
+    0x2b, 0xf0, 0x6a, 0x91, 0x08, 0x12, 0xa1, 0x1d, 0x94, 0x9b, 0x93, 0x29, 0xbe, 0x63, 0x98, 0x28,
+    0x02, 0xd8, 0x48, 0x98, 0x09, 0xa8, 0x92, 0x8f, 0x05, 0x98, 0x21, 0x01, 0xbb, 0x34, 0xbc, 0x21,
+    0x0c, 0xc1, 0x4c, 0xa3, 0x29, 0x03, 0x81, 0x0f, 0x83, 0xab, 0x83, 0x0b, 0xdb, 0x62, 0x90, 0x39,
+    0x13, 0xc9, 0x5a, 0xa1, 0x1c, 0xa0, 0x81, 0x9e, 0x15, 0x99, 0x13, 0x11, 0xdb, 0x42, 0xba, 0x38,
+    0x9b, 0xb2, 0x1f, 0x86, 0x1a, 0x02, 0x10, 0xac, 0x05, 0xba, 0x03, 0x8b, 0xd1, 0x59, 0xa2, 0x49,
+    0x01, 0x90, 0x1c, 0x93, 0x0d, 0x91, 0x09, 0xeb, 0x25, 0xa9, 0x13, 0x01, 0xe8, 0x30, 0xd0, 0x39,
+    0x99, 0x91, 0x1e, 0x04, 0x8a, 0x13, 0x00, 0xcb, 0x15, 0xca, 0x21, 0x8b, 0xc1, 0x6b, 0xa3, 0x3a,
+    0x82, 0x81, 0x0e, 0x84, 0x8c, 0x92, 0x19, 0xc9, 0x52, 0x99, 0x31, 0x18, 0xd0, 0x59, 0xb8, 0x28,
+    0xb8, 0x92, 0x8e, 0x06, 0x89, 0x12, 0x18, 0xca, 0x42, 0xc9, 0x20, 0x8b, 0xb1, 0x5c, 0x92, 0x19,
+    0x03, 0x82, 0x8f, 0x84, 0x9b, 0xa3, 0x18, 0xf9, 0x41, 0x98, 0x20, 0x10, 0xc0, 0x6b, 0x90, 0x2b,
+    0xf1, 0x03, 0x3f, 0x00, 0x0b, 0xd1, 0x59, 0x91, 0x39, 0x00, 0x92, 0x1f, 0x92, 0x0b, 0xc3, 0x28,
+    0xda, 0x33, 0x9a, 0x33, 0x48, 0xf8, 0x48, 0xb8, 0x28, 0x89, 0xb0, 0x2d, 0x85, 0x09, 0x12, 0x81,
+    0xac, 0x15, 0xbb, 0x21, 0x0a, 0xf8, 0x58, 0xa1, 0x39, 0x11, 0xa0, 0x2d, 0xa3, 0x0d, 0x92, 0x19,
+    0xcc, 0x63, 0xa9, 0x22, 0x08, 0xe2, 0x38, 0xc0, 0x28, 0xa9, 0x01, 0x0d, 0x14, 0x8a, 0x13, 0x00,
+    0xcb, 0x33, 0xf9, 0x28, 0x0a, 0xc8, 0x7a, 0x91, 0x29, 0x02, 0x90, 0x1d, 0x93, 0x8c, 0x92, 0x80,
+    0xbd, 0x17, 0xa8, 0x21, 0x01, 0xba, 0x41, 0x99, 0x2c, 0x88, 0xa9, 0x3d, 0x06, 0x0b, 0x14, 0x88,
+    0xba, 0x16, 0xcb, 0x12, 0x8a, 0xe1, 0x68, 0xa0, 0x28, 0x01, 0xa0, 0x3c, 0xb3, 0x2d, 0x90, 0x19,
+    0xbb, 0x27, 0xa9, 0x22, 0x00, 0xf0, 0x40, 0xc8, 0x28, 0x98, 0x80, 0x2d, 0x94, 0x2a, 0x83, 0x08,
+    0xbb, 0x17, 0xbb, 0x84, 0x89, 0xd8, 0x61, 0xa8, 0x30, 0x18, 0xa8, 0x5a, 0xb0, 0x3a, 0xa8, 0x00,
+    0x8d, 0x87, 0x89, 0x03, 0x81, 0xd9, 0x23, 0xda, 0x20, 0x89, 0xb0, 0x6d, 0x91, 0x29, 0x01, 0x90,
+    0x1c, 0x94, 0x0c, 0xa2, 0x00, 0xeb, 0x25, 0xaa, 0x22, 0x00, 0xc8, 0x40, 0xc8, 0x39, 0x98, 0x08,
+    0x0d, 0x05, 0x8a, 0x04, 0x08, 0xb9, 0x14, 0xda, 0x12, 0x0b, 0xd0, 0x68, 0xa0, 0x38, 0x81, 0xa1,
+    0x3c, 0xc3, 0x1b, 0xb2, 0x18, 0xcc, 0x16, 0x99, 0x32, 0x80, 0xc9, 0x31, 0xe8, 0x49, 0x99, 0x00,
+    0x1e, 0x84, 0x0a, 0x13, 0x09, 0x9b, 0x86, 0xb9, 0x82, 0x08, 0xf9, 0x51, 0xa8, 0x30, 0x00, 0xb8,
+    0x7b, 0xb1, 0x3b, 0x91, 0x0a, 0x8d, 0x07, 0x8a, 0x13, 0x88, 0xb9, 0x24, 0xdb, 0x22, 0x8b, 0xc0,
+    0x79, 0xb1, 0x59, 0x80, 0x80, 0x1a, 0x92, 0x0c, 0xa2, 0x08, 0xda, 0x34, 0xc9, 0x32, 0x92, 0xd9,
+    0x49, 0x01, 0x3f, 0x00, 0x83, 0x8d, 0x82, 0x89, 0xe9, 0x33, 0xc8, 0x32, 0x90, 0xc1, 0x59, 0xb0,
+    0x4b, 0x98, 0x90, 0x1e, 0x04, 0x8a, 0x23, 0x91, 0xbc, 0x16, 0xba, 0x11, 0x88, 0xea, 0x60, 0xa0,
+    0x38, 0x11, 0x9a, 0x4b, 0xb3, 0x0d, 0x92, 0x98, 0xca, 0x17, 0x99, 0x22, 0x80, 0xc8, 0x50, 0xb9,
+    0x28, 0x89, 0xa8, 0x4e, 0xa3, 0x2a, 0x04, 0x90, 0xaa, 0x07, 0xbb, 0x84, 0x98, 0xb8, 0x71, 0xb0,
+    0x40, 0x80, 0x88, 0x2a, 0xa2, 0x2e, 0xa0, 0x08, 0xbb, 0x27, 0xa9, 0x14, 0x00, 0xc9, 0x31, 0xd8,
+    0x39, 0x99, 0xa8, 0x5d, 0x82, 0x2c, 0x13, 0x98, 0x8b, 0x05, 0xbc, 0x04, 0x8a, 0xd8, 0x61, 0xa8,
+    0x40, 0x80, 0x88, 0x2a, 0xa1, 0x1c, 0xb2, 0x88, 0xcb, 0x27, 0x9a, 0x32, 0x81, 0xca, 0x32, 0xd9,
+    0x39, 0x99, 0xb9, 0x6d, 0x92, 0x2a, 0x84, 0x91, 0x9a, 0x85, 0xaa, 0x92, 0x2a, 0xf8, 0x79, 0x88,
+    0x28, 0x10, 0x98, 0x3c, 0xb2, 0x1c, 0xd3, 0x18, 0xca, 0x25, 0xa9, 0x04, 0x18, 0xd0, 0x48, 0xb8,
+    0x49, 0x99, 0x00, 0x1e, 0x84, 0x0a, 0x83, 0x01, 0xca, 0x14, 0xcb, 0x13, 0x8b, 0xc0, 0x79, 0xa1,
+    0x38, 0x80, 0x80, 0x1c, 0x83, 0x8e, 0xa3, 0x08, 0xda, 0x34, 0xb9, 0x32, 0x81, 0xd8, 0x40, 0xa9,
+    0x5b, 0x89, 0x88, 0x1d, 0x05, 0x8a, 0x03, 0x81, 0xda, 0x14, 0xca, 0x12, 0x9a, 0xb1, 0x7b, 0xa2,
+    0x49, 0x00, 0x80, 0x1d, 0x93, 0x0c, 0xb2, 0x00, 0xdb, 0x16, 0x99, 0x12, 0x10, 0xb9, 0x78, 0xb8,
+    0x39, 0x99, 0x08, 0x1f, 0x03, 0x0b, 0x05, 0x80, 0xa9, 0x23, 0xfb, 0x11, 0x99, 0xa0, 0x5a, 0xa3,
+    0x4a, 0x82, 0x10, 0x8d, 0x04, 0x8d, 0x81, 0x19, 0xea, 0x42, 0xa8, 0x30, 0x01, 0xb8, 0x5a, 0xa1,
+    0x2c, 0xb0, 0x08, 0xac, 0x17, 0x99, 0x04, 0x00, 0xb8, 0x50, 0xd8, 0x28, 0x8a, 0x80, 0x2e, 0x83,
+    0xae, 0xf8, 0x3e, 0x00, 0x31, 0x11, 0xf0, 0x49, 0xb0, 0x3a, 0x98, 0x90, 0x1f, 0x85, 0x89, 0x83,
+    0x01, 0xca, 0x14, 0xca, 0x21, 0x8b, 0xa1, 0x4d, 0xa3, 0x4a, 0x81, 0x82, 0x0f, 0x83, 0x0c, 0xa1,
+    0x10, 0xfa, 0x23, 0x99, 0x21, 0x20, 0xd9, 0x48, 0xa0, 0x2c, 0xa0, 0x00, 0x8d, 0x06, 0x8a, 0x13,
+    0x00, 0xd9, 0x32, 0xca, 0x20, 0x8b, 0xb1, 0x3d, 0x85, 0x2a, 0x82, 0x02, 0x8f, 0x04, 0xab, 0x82,
+    0x89, 0xd0, 0x50, 0x90, 0x49, 0x10, 0xa0, 0x2b, 0xa4, 0x0d, 0xb2, 0x28, 0xeb, 0x24, 0x99, 0x22,
+    0x10, 0xe8, 0x48, 0xc0, 0x39, 0xa9, 0x81, 0x1e, 0x84, 0x1a, 0x83, 0x11, 0xda, 0x22, 0xca, 0x20,
+    0x9a, 0xb1, 0x3e, 0x95, 0x19, 0x03, 0x91, 0x8d, 0x05, 0x9c, 0x82, 0x1a, 0xc9, 0x42, 0xa0, 0x40,
+    0x20, 0xc8, 0x4a, 0xc2, 0x1b, 0xa2, 0x09, 0xeb, 0x25, 0x99, 0x12, 0x30, 0xf9, 0x30, 0xb8, 0x3a,
+    0x99, 0xb0, 0x3e, 0x85, 0x0a, 0x84, 0x02, 0xac, 0x14, 0xbb, 0x21, 0x8a, 0xd9, 0x79, 0x91, 0x29,
+    0x03, 0x98, 0x8b, 0x05, 0x9d, 0x83, 0x8b, 0xd0, 0x51, 0xa0, 0x40, 0x18, 0xb0, 0x4c, 0xb2, 0x2c,
+    0xb1, 0x18, 0x9d, 0x15, 0x89, 0x22, 0x28, 0xd9, 0x48, 0xd0, 0x39, 0xb8, 0x00, 0x1c, 0x86, 0x1a,
+    0x84, 0x18, 0xba, 0x43, 0xbc, 0x13, 0x0f, 0x92, 0x2b, 0x93, 0x38, 0x90, 0x06, 0x9d, 0x04, 0x9b,
+    0xa3, 0x28, 0xfb, 0x42, 0x99, 0x20, 0x38, 0xd8, 0x49, 0xb1, 0x2a, 0xa8, 0x10, 0xac, 0x16, 0xa8,
+    0x13, 0x38, 0xe9, 0x30, 0xc8, 0x39, 0xa9, 0x00, 0x8d, 0x15, 0x0a, 0x03, 0x30, 0xdc, 0x42, 0xca,
+    0x11, 0x1b, 0xc0, 0x6a, 0x91, 0x18, 0x01, 0xa3, 0x1e, 0x93, 0x9c, 0x83, 0x0a, 0xd9, 0x61, 0x98,
+    0x30, 0x18, 0xb1, 0x3d, 0xc3, 0x2b, 0xe2, 0x28, 0xba, 0x25, 0x9a, 0x14, 0x18, 0xc8, 0x40, 0xc9,
+    0x2b, 0xfa, 0x41, 0x00, 0xa3, 0x3b, 0xf8, 0x40, 0xa0, 0x21, 0x08, 0xb2, 0x3c, 0xd3, 0x3b, 0xd1,
+    0x20, 0xbb, 0x25, 0x8a, 0x03, 0x40, 0xd9, 0x58, 0xa9, 0x28, 0x8a, 0x91, 0x1e, 0x84, 0x88, 0x02,
+    0x02, 0xac, 0x23, 0xdb, 0x11, 0x0b, 0xd1, 0x6b, 0x92, 0x3a, 0x02, 0x81, 0x0f, 0x83, 0x9c, 0xa3,
+    0x29, 0xf8, 0x40, 0xa0, 0x20, 0x10, 0xa0, 0x4c, 0xa1, 0x1c, 0xb1, 0x28, 0xea, 0x24, 0x99, 0x12,
+    0x20, 0xe8, 0x48, 0xb8, 0x28, 0xaa, 0x01, 0x8e, 0x05, 0x09, 0x02, 0x11, 0xf9, 0x12, 0xb9, 0x10,
+    0x0a, 0xb0, 0x3f, 0x03, 0x1b, 0x23, 0x92, 0x8f, 0x04, 0xac, 0x84, 0x0b, 0xb1, 0x6a, 0x91, 0x38,
+    0x80, 0x94, 0x0e, 0x94, 0x0b, 0xa2, 0x00, 0xac, 0x34, 0x9a, 0x33, 0x28, 0xd8, 0x49, 0xb0, 0x3b,
+    0xc9, 0x02, 0x9f, 0x15, 0x99, 0x13, 0x28, 0xd9, 0x30, 0xc8, 0x49, 0x8b, 0x00, 0x1f, 0x03, 0x0a,
+    0x03, 0x02, 0xcc, 0x14, 0xda, 0x02, 0x0a, 0xb0, 0x7a, 0x91, 0x39, 0x10, 0x81, 0x0e, 0x83, 0x8d,
+    0x82, 0x1b, 0xc8, 0x60, 0xa0, 0x31, 0x88, 0xb3, 0x2d, 0xb3, 0x0c, 0xc2, 0x10, 0xda, 0x52, 0x98,
+    0x30, 0x28, 0xc0, 0x4c, 0xb1, 0x3b, 0xa0, 0x08, 0x9d, 0x07, 0x89, 0x03, 0x20, 0xea, 0x31, 0xc9,
+    0x28, 0x09, 0xa8, 0x3d, 0x03, 0x0a, 0x14, 0x01, 0xbc, 0x14, 0xea, 0x11, 0x8a, 0xb1, 0x4d, 0x93,
+    0x39, 0x01, 0x93, 0x9f, 0x85, 0x8b, 0xa3, 0x2b, 0xd1, 0x69, 0x90, 0x20, 0x08, 0xa4, 0x1d, 0xa3,
+    0x0c, 0x92, 0x19, 0xca, 0x34, 0xa9, 0x23, 0x38, 0xf1, 0x4a, 0xb1, 0x2b, 0xa0, 0x90, 0x0d, 0x06,
+    0x89, 0x13, 0x18, 0xd8, 0x21, 0xca, 0x10, 0x0a, 0xd1, 0x3d, 0x84, 0x19, 0x11, 0x93, 0x9d, 0x83,
+    0x99, 0xb8, 0x01, 0xfa, 0x48, 0x03, 0x1c, 0x33, 0x98, 0x1e, 0x82, 0x9d, 0x92, 0x08, 0xf9, 0x40,
+    0x6c, 0x03, 0x42, 0x00, 0x89, 0x12, 0x11, 0xbc, 0x14, 0xca, 0x02, 0x9b, 0xa2, 0x3e, 0x94, 0x29,
+    0x83, 0x30, 0x9f, 0x13, 0x8e, 0x92, 0x1a, 0xc1, 0x49, 0x91, 0x30, 0x18, 0xb3, 0x1f, 0x93, 0x8c,
+    0xa2, 0x1a, 0xe0, 0x41, 0xa0, 0x31, 0x18, 0xc2, 0x3d, 0xb2, 0x2d, 0xb1, 0x18, 0xac, 0x16, 0x89,
+    0x03, 0x10, 0xe0, 0x48, 0xb8, 0x39, 0xaa, 0x82, 0x0f, 0x04, 0x1a, 0x93, 0x21, 0xea, 0x22, 0xcb,
+    0x12, 0x0c, 0xa1, 0x4c, 0x92, 0x38, 0x80, 0x04, 0x9e, 0x13, 0xab, 0x81, 0x2a, 0xe9, 0x48, 0x92,
+    0x28, 0x12, 0xb2, 0x0f, 0x94, 0x8c, 0x93, 0x1b, 0xf0, 0x41, 0xa8, 0x32, 0x1a, 0xc2, 0x4b, 0xb1,
+    0x3a, 0xc9, 0x30, 0xad, 0x24, 0x88, 0x02, 0x30, 0xf8, 0x38, 0xc8, 0x28, 0xb9, 0x82, 0xad, 0x17,
+    0x09, 0x82, 0x11, 0xda, 0x41, 0xca, 0x11, 0x0b, 0xa1, 0x4d, 0x92, 0x38, 0x90, 0x04, 0xac, 0x04,
+    0xab, 0x93, 0x1c, 0xc2, 0x4c, 0x82, 0x10, 0x08, 0x85, 0x8d, 0x83, 0x8c, 0x93, 0x0b, 0xb0, 0x78,
+    0x90, 0x31, 0x88, 0x93, 0x0f, 0xa4, 0x1b, 0xc2, 0x28, 0xc9, 0x50, 0x80, 0x01, 0x39, 0xd3, 0x3b,
+    0xd3, 0x2a, 0xb8, 0x20, 0x9e, 0x15, 0x0a, 0x83, 0x48, 0xd8, 0x38, 0xb8, 0x38, 0xcb, 0x02, 0x9c,
+    0x06, 0x18, 0x81, 0x40, 0xd9, 0x40, 0xba, 0x21, 0x8c, 0xa1, 0x4b, 0x93, 0x48, 0xb2, 0x05, 0xac,
+    0x04, 0xaa, 0xa3, 0x1a, 0xe0, 0x6a, 0x91, 0x20, 0x19, 0x83, 0x0f, 0x82, 0x8b, 0x92, 0x1a, 0xe8,
+    0x40, 0x90, 0x21, 0x08, 0x94, 0x1e, 0x92, 0x0b, 0xa1, 0x08, 0xcb, 0x72, 0x88, 0x21, 0x29, 0xc2,
+    0x3b, 0xc2, 0x3b, 0xe8, 0x10, 0xcb, 0x34, 0x89, 0x13, 0x6a, 0xc0, 0x49, 0xc0, 0x28, 0xa9, 0x80,
+    0x9a, 0x06, 0x08, 0x94, 0x11, 0xd8, 0x40, 0xb9, 0x18, 0x8a, 0xa1, 0x1f, 0x84, 0x18, 0x82, 0x12,
+    0x10, 0x08, 0x3a, 0x00, 0x2d, 0xa2, 0x1c, 0xc0, 0x10, 0xea, 0x42, 0x98, 0x03, 0x38, 0xc0, 0x4a,
+    0xa8, 0x2a, 0xba, 0x10, 0xae, 0x25, 0x08, 0x02, 0x32, 0xf0, 0x4a, 0xb0, 0x1a, 0x89, 0xa8, 0x1e,
+    0x06, 0x1a, 0x03, 0x10, 0xca, 0x32, 0xad, 0x20, 0xbb, 0x81, 0x0c, 0x16, 0x08, 0x83, 0x33, 0xfc,
+    0x21, 0xc9, 0x10, 0x9a, 0x80, 0x3c, 0x03, 0x5a, 0x92, 0x32, 0xbd, 0x04, 0xcb, 0x02, 0x8b, 0xb8,
+    0x69, 0x82, 0x31, 0x01, 0x84, 0x9e, 0x04, 0x8d, 0x91, 0x1a, 0xc8, 0x58, 0x80, 0x12, 0x28, 0xa3,
+    0x0e, 0x92, 0x0b, 0xd1, 0x19, 0xc8, 0x40, 0x01, 0x12, 0x38, 0xc6, 0x2b, 0xb3, 0x0c, 0xc1, 0x00,
+    0xcb, 0x53, 0x08, 0x11, 0x58, 0xb1, 0x2d, 0xa2, 0x0c, 0xa0, 0x00, 0xbc, 0x35, 0x88, 0x03, 0x41,
+    0xd8, 0x28, 0xb8, 0x19, 0xd9, 0x08, 0xaa, 0x25, 0x28, 0x03, 0x70, 0xb8, 0x5a, 0xa8, 0x1b, 0x99,
+    0x91, 0x9f, 0x15, 0x90, 0x03, 0x31, 0xea, 0x30, 0xb9, 0x29, 0x9c, 0x80, 0x9c, 0x16, 0x00, 0x01,
+    0x33, 0xfa, 0x20, 0xb9, 0x28, 0x8d, 0x80, 0x8c, 0x24, 0x00, 0x01, 0x34, 0xfb, 0x21, 0xb9, 0x08,
+    0x9a, 0x90, 0x1d, 0x14, 0x28, 0x02, 0x63, 0xeb, 0x31, 0xca, 0x01, 0x8b, 0x91, 0x1e, 0x04, 0x39,
+    0x90, 0x24, 0xdb, 0x22, 0xda, 0x10, 0x8a, 0xa1, 0x2e, 0x84, 0x18, 0x82, 0x31, 0xcc, 0x32, 0xbc,
+    0x02, 0x0e, 0x81, 0x1b, 0x83, 0x32, 0x98, 0x17, 0xca, 0x21, 0xba, 0x28, 0x9c, 0x80, 0x1e, 0x86,
+    0x18, 0x92, 0x31, 0xdb, 0x23, 0xbc, 0x10, 0x0b, 0x98, 0x2f, 0x03, 0x10, 0x01, 0x33, 0xfc, 0x21,
+    0xb9, 0x08, 0x8c, 0xa3, 0x0d, 0x06, 0x18, 0x91, 0x23, 0xeb, 0x21, 0xaa, 0x08, 0x8b, 0x81, 0x0f,
+    0x24, 0x09, 0x03, 0x30, 0xf9, 0x20, 0xbb, 0x02, 0x8e, 0x92, 0x0b, 0x15, 0x10, 0x81, 0x52, 0xea,
+    0x75, 0x03, 0x40, 0x00, 0xa2, 0x1b, 0xd1, 0x28, 0xb9, 0x50, 0x81, 0x30, 0x28, 0xa4, 0x0e, 0x92,
+    0x8b, 0xc2, 0x2a, 0xd0, 0x59, 0x01, 0x20, 0x18, 0x84, 0x8e, 0x82, 0x9b, 0xa2, 0x2b, 0xf1, 0x49,
+    0x92, 0x40, 0x08, 0x93, 0x0e, 0x92, 0x1b, 0xd0, 0x39, 0xc0, 0x4a, 0x02, 0x01, 0x38, 0x95, 0x8d,
+    0x93, 0xba, 0x82, 0x8c, 0x91, 0x3d, 0x04, 0x48, 0xa0, 0x34, 0xae, 0x03, 0x9b, 0xa1, 0x1a, 0x80,
+    0x1f, 0x85, 0x28, 0x80, 0x32, 0xfb, 0x11, 0xaa, 0x82, 0x0d, 0x92, 0x0c, 0x05, 0x10, 0x08, 0x41,
+    0xdb, 0x12, 0xaa, 0x01, 0x8d, 0x81, 0x0b, 0x86, 0x11, 0x00, 0x22, 0xe9, 0x28, 0xb9, 0x49, 0xbb,
+    0x21, 0xce, 0x16, 0x19, 0x81, 0x48, 0xc8, 0x38, 0xb9, 0x20, 0xac, 0x12, 0xdb, 0x33, 0x10, 0x02,
+    0x68, 0xd0, 0x39, 0xc0, 0x3a, 0xd8, 0x28, 0xb9, 0x62, 0x09, 0x04, 0x2a, 0xc3, 0x1b, 0xc3, 0x09,
+    0xd0, 0x28, 0xd8, 0x50, 0x80, 0x20, 0x08, 0xa4, 0x0c, 0x92, 0x8b, 0xb3, 0x1e, 0xb2, 0x6c, 0x81,
+    0x20, 0x89, 0x85, 0x0d, 0xa3, 0x1b, 0xb1, 0x3a, 0xb8, 0x7a, 0x00, 0x31, 0x0a, 0x05, 0x8e, 0x82,
+    0x8a, 0xa1, 0x1a, 0x90, 0x2d, 0x05, 0x18, 0xb2, 0x25, 0xbc, 0x22, 0xac, 0x82, 0x1c, 0x80, 0x2f,
+    0x82, 0x30, 0xa0, 0x43, 0xcc, 0x12, 0xa9, 0x90, 0x1c, 0xa2, 0x0c, 0x06, 0x28, 0xb2, 0x51, 0xc9,
+    0x28, 0xa9, 0x10, 0x8e, 0x02, 0x8d, 0x14, 0x08, 0x82, 0x48, 0xd0, 0x18, 0xc0, 0x18, 0xc8, 0x21,
+    0xdb, 0x43, 0x09, 0x03, 0x5b, 0xc1, 0x3a, 0xb0, 0x19, 0xd8, 0x28, 0xe1, 0x40, 0x90, 0x22, 0x1a,
+    0xa5, 0x0d, 0xb3, 0x09, 0xc1, 0x18, 0xc0, 0x79, 0x80, 0x20, 0x09, 0x03, 0x8f, 0x82, 0x0b, 0xb2,
+    0x29, 0xd0, 0x59, 0x91, 0x31, 0xa8, 0x85, 0x9b, 0x83, 0x0d, 0xb1, 0x3b, 0xc3, 0x3e, 0x83, 0x10,
+    0xe6, 0x06, 0x3b, 0x00, 0x48, 0xf2, 0x29, 0x98, 0x09, 0x98, 0x19, 0xd0, 0x50, 0x80, 0x12, 0x19,
+    0xa6, 0x0c, 0x92, 0x0b, 0xc2, 0x29, 0xd1, 0x7b, 0x91, 0x21, 0x89, 0x03, 0x9e, 0x83, 0x8b, 0xb2,
+    0x3b, 0xd2, 0x3a, 0x04, 0x12, 0x09, 0x07, 0x9c, 0x01, 0xa9, 0x08, 0x1b, 0x08, 0x1f, 0x85, 0x28,
+    0x92, 0x31, 0xfb, 0x01, 0x99, 0x80, 0x0d, 0x02, 0xac, 0x26, 0x09, 0x81, 0x32, 0xfa, 0x10, 0xb8,
+    0x28, 0xaa, 0x11, 0xf9, 0x42, 0x08, 0x01, 0x59, 0xc1, 0x2a, 0xa0, 0x0a, 0x99, 0x20, 0xfa, 0x60,
+    0x80, 0x11, 0x08, 0xb4, 0x1c, 0x91, 0x0a, 0xf0, 0x38, 0xc0, 0x59, 0x00, 0x10, 0x09, 0x95, 0x0c,
+    0x81, 0x89, 0xb0, 0x09, 0x93, 0x0e, 0x06, 0x00, 0x80, 0x32, 0xbd, 0x21, 0xca, 0x20, 0x9c, 0x22,
+    0x8f, 0x04, 0x18, 0xa2, 0x58, 0xc8, 0x10, 0xa9, 0x00, 0x8b, 0x03, 0x9e, 0x24, 0x08, 0x02, 0x69,
+    0xc0, 0x2a, 0x90, 0x0a, 0xaa, 0x41, 0xf8, 0x50, 0x90, 0x20, 0x19, 0xb4, 0x1c, 0xa1, 0x08, 0xc9,
+    0x30, 0xd0, 0x4a, 0x03, 0x80, 0x11, 0x84, 0x9e, 0x82, 0x8b, 0xa2, 0x1e, 0x93, 0x1e, 0x13, 0x00,
+    0xa0, 0x25, 0xbc, 0x21, 0xb9, 0x88, 0x0b, 0x13, 0xaf, 0x17, 0x09, 0x81, 0x40, 0xc9, 0x28, 0xa9,
+    0x10, 0xac, 0x23, 0xad, 0x34, 0x08, 0x93, 0x58, 0xe1, 0x29, 0xa8, 0x18, 0xca, 0x31, 0xe9, 0x41,
+    0x80, 0x11, 0x3a, 0xd3, 0x1b, 0xb2, 0x1a, 0xf8, 0x20, 0xc0, 0x6a, 0x81, 0x10, 0x08, 0x94, 0x8d,
+    0x83, 0x0c, 0xa1, 0x2a, 0xb1, 0x6b, 0x82, 0x11, 0x90, 0x15, 0xad, 0x11, 0x9a, 0xb1, 0x4b, 0xb1,
+    0x2f, 0x84, 0x10, 0x08, 0x13, 0xad, 0x11, 0xb9, 0x80, 0xac, 0x06, 0xac, 0x25, 0x19, 0x81, 0x48,
+    0xc8, 0x4a, 0xb8, 0x38, 0xac, 0x32, 0xeb, 0x41, 0x00, 0x81, 0x28, 0xc5, 0x1b, 0xb3, 0x1a, 0xd0,
+    0x91, 0xf7, 0x3d, 0x00, 0xa3, 0x0c, 0x05, 0x00, 0xa2, 0x41, 0xe9, 0x20, 0xa9, 0x18, 0x8b, 0x21,
+    0xae, 0x53, 0x18, 0x00, 0x49, 0xe2, 0x19, 0xb1, 0x80, 0xb9, 0x32, 0xf9, 0x48, 0x81, 0x11, 0x29,
+    0xa5, 0x0e, 0x92, 0x0a, 0xb1, 0x3a, 0xd1, 0x4a, 0x03, 0x10, 0x88, 0x07, 0xac, 0x22, 0xab, 0x81,
+    0x1d, 0x92, 0x0e, 0x05, 0x18, 0xa0, 0x42, 0xda, 0x11, 0xa9, 0x81, 0x8a, 0x02, 0x9e, 0x24, 0x18,
+    0x81, 0x69, 0xc0, 0x3a, 0xa0, 0x19, 0xca, 0x22, 0xea, 0x41, 0x91, 0x02, 0x18, 0xb5, 0x0d, 0x82,
+    0x0a, 0xc8, 0x48, 0xc8, 0x59, 0x81, 0x10, 0x08, 0x84, 0x8e, 0x02, 0x8b, 0x91, 0x2b, 0xc2, 0x3c,
+    0x85, 0x28, 0xa1, 0x43, 0xcc, 0x21, 0xaa, 0x81, 0x8c, 0x95, 0x8c, 0x05, 0x18, 0x80, 0x41, 0xca,
+    0x28, 0xa8, 0x80, 0x9b, 0x04, 0xad, 0x63, 0x08, 0x10, 0x28, 0xd2, 0x1b, 0xb3, 0x1b, 0xc9, 0x31,
+    0xfa, 0x50, 0x80, 0x11, 0x08, 0xa3, 0x0f, 0x81, 0x1a, 0xc8, 0x59, 0xc0, 0x39, 0x83, 0x10, 0x08,
+    0x06, 0x9d, 0x01, 0x89, 0x88, 0x1b, 0xb3, 0x1f, 0x04, 0x00, 0x91, 0x32, 0xfb, 0x01, 0x99, 0x80,
+    0xa9, 0x04, 0xbd, 0x26, 0x08, 0x81, 0x38, 0xe8, 0x39, 0xa8, 0x08, 0xab, 0x43, 0xcc, 0x51, 0x00,
+    0x01, 0x18, 0xc3, 0x0c, 0x92, 0x0a, 0xb9, 0x48, 0xd8, 0x49, 0x95, 0x10, 0x00, 0x83, 0x8f, 0x81,
+    0x0a, 0xb0, 0x39, 0xf2, 0x3b, 0x05, 0x08, 0x00, 0x23, 0xcd, 0x21, 0xaa, 0x81, 0x8c, 0x85, 0x8d,
+    0x23, 0x10, 0xa0, 0x52, 0xf8, 0x18, 0x90, 0x88, 0x99, 0x13, 0xad, 0x33, 0x81, 0x83, 0x40, 0xe2,
+    0x0b, 0x10, 0x9a, 0xa9, 0x79, 0xe0, 0x49, 0x82, 0x18, 0x80, 0x84, 0x9d, 0x02, 0x8a, 0xb1, 0x4b,
+    0xd3, 0x2c, 0x04, 0x18, 0x80, 0x22, 0xad, 0x10, 0x99, 0x90, 0x8b, 0x03, 0xaf, 0x35, 0x88, 0x02,
+    0x70, 0x06, 0x38, 0x00, 0x04, 0x9f, 0x21, 0x9b, 0x91, 0x4b, 0xd1, 0x2a, 0x85, 0x00, 0x91, 0x14,
+    0xcb, 0x10, 0x98, 0x88, 0x9b, 0x05, 0x8f, 0x32, 0x08, 0x01, 0x68, 0xd8, 0x18, 0x90, 0x89, 0x98,
+    0x12, 0xec, 0x42, 0x90, 0x11, 0x18, 0xc3, 0x1c, 0x81, 0x0b, 0xb8, 0x69, 0xe0, 0x49, 0x82, 0x18,
+    0x80, 0x84, 0x8e, 0x82, 0x89, 0x98, 0x18, 0xb1, 0x1c, 0x16, 0x08, 0x81, 0x41, 0xfa, 0x38, 0xa8,
+    0x08, 0x0c, 0x03, 0x8f, 0x23, 0x09, 0x81, 0x31, 0xf8, 0x29, 0xa0, 0x18, 0xab, 0x32, 0xcc, 0x51,
+    0x01, 0x80, 0x30, 0xc3, 0x0f, 0x82, 0x0b, 0xa0, 0x38, 0xf9, 0x48, 0x92, 0x10, 0x18, 0x84, 0x8e,
+    0x01, 0x99, 0xa0, 0x2a, 0xa4, 0x0f, 0x14, 0x88, 0x81, 0x31, 0xeb, 0x30, 0xaa, 0x81, 0xab, 0x05,
+    0x9c, 0x43, 0x80, 0x10, 0x40, 0xf0, 0x29, 0x90, 0x89, 0xa8, 0x40, 0xea, 0x50, 0x91, 0x10, 0x08,
+    0x94, 0x8d, 0x82, 0x0a, 0xb0, 0x4a, 0xe3, 0x3b, 0x04, 0x18, 0x09, 0x14, 0xbc, 0x21, 0xb9, 0x00,
+    0x9b, 0x86, 0x0f, 0x13, 0x19, 0x81, 0x40, 0xd9, 0x28, 0xa8, 0x08, 0xab, 0x15, 0xbc, 0x53, 0x91,
+    0x00, 0x50, 0xc0, 0x1a, 0x91, 0x0a, 0xb8, 0x69, 0xd8, 0x59, 0x81, 0x10, 0x08, 0x84, 0x9d, 0x12,
+    0xab, 0x93, 0x1d, 0xb4, 0x2c, 0x04, 0x18, 0x88, 0x24, 0xbd, 0x31, 0xb9, 0x00, 0x8c, 0x03, 0x8f,
+    0x33, 0x09, 0x92, 0x78, 0xc0, 0x2a, 0xa1, 0x19, 0xb9, 0x31, 0xfa, 0x50, 0x80, 0x01, 0x18, 0xa4,
+    0x0d, 0x81, 0x0a, 0x98, 0x1a, 0xc3, 0x1f, 0x15, 0x09, 0x08, 0x22, 0xbd, 0x32, 0xab, 0x81, 0x0d,
+    0x83, 0x0e, 0x13, 0x10, 0x90, 0x42, 0xf9, 0x28, 0xa8, 0x08, 0xa9, 0x22, 0xbd, 0x63, 0x00, 0x80,
+    0x40, 0xd1, 0x1a, 0x91, 0x89, 0x99, 0x39, 0xf0, 0x49, 0x03, 0x08, 0x10, 0x85, 0x9e, 0x12, 0x9b,
+    0x9e, 0xfd, 0x3a, 0x00, 0x99, 0x31, 0xfb, 0x50, 0x91, 0x10, 0x00, 0xb3, 0x8d, 0x93, 0x0a, 0xc8,
+    0x5a, 0xc1, 0x3b, 0x15, 0x09, 0x00, 0x14, 0xbd, 0x22, 0xab, 0x82, 0x0e, 0x83, 0x0e, 0x22, 0x00,
+    0x88, 0x33, 0xf9, 0x28, 0xb8, 0x08, 0xaa, 0x43, 0xae, 0x32, 0x11, 0x90, 0x51, 0xd2, 0x1b, 0x92,
+    0x0b, 0xb9, 0x68, 0xe8, 0x49, 0x82, 0x10, 0x08, 0x84, 0x9d, 0x12, 0x9b, 0xa1, 0x2b, 0xc3, 0x1d,
+    0x15, 0x08, 0x81, 0x42, 0xeb, 0x20, 0xb8, 0x00, 0x8c, 0x94, 0x9c, 0x15, 0x00, 0x08, 0x32, 0xc9,
+    0x1a, 0xa1, 0x0b, 0xf8, 0x40, 0xf9, 0x30, 0x81, 0x00, 0x28, 0x93, 0x8f, 0x02, 0x8b, 0xa1, 0x3b,
+    0xd4, 0x3b, 0x04, 0x18, 0x08, 0x14, 0xad, 0x12, 0xaa, 0x80, 0x9a, 0x03, 0xaf, 0x25, 0x80, 0x81,
+    0x51, 0xe8, 0x39, 0xa0, 0x09, 0x99, 0x30, 0xdc, 0x51, 0x91, 0x10, 0x00, 0xa4, 0x0d, 0x82, 0x0b,
+    0xa8, 0x5a, 0xd0, 0x39, 0x13, 0x88, 0x11, 0x86, 0xbc, 0x23, 0xda, 0x10, 0x9a, 0x02, 0x8f, 0x24,
+    0x89, 0x83, 0x48, 0xe8, 0x28, 0xa8, 0x18, 0xaa, 0x13, 0xcc, 0x52, 0x92, 0x08, 0x22, 0xc2, 0x0e,
+    0x02, 0x0d, 0x80, 0x2a, 0xd1, 0x4a, 0x83, 0x18, 0x90, 0x14, 0xcc, 0x22, 0xba, 0x00, 0x1b, 0xa4,
+    0x0f, 0x14, 0x09, 0x82, 0x40, 0xca, 0x38, 0xa9, 0x08, 0xbb, 0x24, 0xec, 0x42, 0x91, 0x00, 0x20,
+    0xc3, 0x0e, 0x83, 0x0c, 0x08, 0x2a, 0xc0, 0x5b, 0x84, 0x19, 0x91, 0x23, 0xbe, 0x23, 0xbb, 0x01,
+    0x1b, 0xb2, 0x0f, 0x15, 0x09, 0x92, 0x31, 0xf0, 0x18, 0xb1, 0x89, 0x98, 0x21, 0xfc, 0x50, 0x81,
+    0x08, 0x10, 0x92, 0x0f, 0x02, 0x9b, 0x80, 0x29, 0xd0, 0x29, 0x04, 0x00, 0x81, 0x33, 0xce, 0x31,
+    0xc9, 0x80, 0x0a, 0xa3, 0x0f, 0x33, 0x09, 0x01, 0x50, 0xd8, 0x39, 0xb0, 0x09, 0xd8, 0x20, 0xf8,
+    0xac, 0xf4, 0x3e, 0x00, 0x13, 0x08, 0x91, 0x52, 0xe9, 0x20, 0xc8, 0x10, 0xa9, 0x02, 0x9c, 0x15,
+    0x08, 0x92, 0x58, 0xc1, 0x2a, 0xa1, 0x1b, 0x99, 0x28, 0xf9, 0x59, 0x02, 0x19, 0x10, 0x83, 0x9f,
+    0x03, 0xab, 0x81, 0x0a, 0xc3, 0x0e, 0x15, 0x08, 0x00, 0x41, 0xda, 0x38, 0xd0, 0x00, 0xa9, 0x03,
+    0xbc, 0x44, 0x80, 0x10, 0x49, 0xc1, 0x2c, 0x92, 0x0c, 0xa0, 0x38, 0xe9, 0x48, 0x82, 0x18, 0x81,
+    0x85, 0x9d, 0x03, 0xaa, 0x80, 0x1b, 0xa4, 0x1f, 0x04, 0x09, 0x82, 0x31, 0xfb, 0x20, 0xc0, 0x18,
+    0xb8, 0x21, 0xbc, 0x35, 0x88, 0x01, 0x48, 0xd2, 0x2b, 0xa2, 0x8b, 0x98, 0x4a, 0xf0, 0x59, 0x92,
+    0x28, 0x80, 0x23, 0xaf, 0x12, 0xab, 0x82, 0x0b, 0xa3, 0x0f, 0x06, 0x08, 0x80, 0x31, 0xda, 0x20,
+    0xb9, 0x00, 0x9a, 0x93, 0xcc, 0x44, 0x91, 0x01, 0x48, 0xc2, 0x1c, 0x81, 0x9b, 0x81, 0x2c, 0xd0,
+    0x5c, 0x03, 0x1a, 0x92, 0x32, 0xbe, 0x23, 0xbc, 0x02, 0x8b, 0xa4, 0x0e, 0x14, 0x08, 0x00, 0x31,
+    0xf8, 0x18, 0xa1, 0x0b, 0xb1, 0x30, 0xfb, 0x50, 0x92, 0x28, 0x08, 0x94, 0x0e, 0x82, 0x8b, 0x80,
+    0x1a, 0xd2, 0x2c, 0x06, 0x88, 0x81, 0x22, 0xfa, 0x20, 0xa8, 0x19, 0x99, 0x11, 0xad, 0x63, 0x90,
+    0x11, 0x18, 0xc3, 0x1d, 0x92, 0x8a, 0xa8, 0x38, 0xf0, 0x6b, 0x82, 0x08, 0x81, 0x22, 0xae, 0x22,
+    0xca, 0x01, 0x8b, 0x85, 0x8e, 0x14, 0x09, 0x00, 0x30, 0xd8, 0x39, 0xa8, 0x19, 0xba, 0x32, 0xfb,
+    0x58, 0x82, 0x08, 0x20, 0x93, 0x9f, 0x03, 0x8c, 0x81, 0x1b, 0xc2, 0x3d, 0x13, 0x19, 0x90, 0x25,
+    0xea, 0x30, 0xc9, 0x10, 0xa9, 0x02, 0x9e, 0x43, 0x90, 0x10, 0x30, 0xc1, 0x2d, 0xa2, 0x8b, 0x90,
+    0x09, 0xf1, 0x4a, 0x04, 0x09, 0x01, 0x13, 0xae, 0x22, 0xba, 0x88, 0x89, 0xa4, 0x9f, 0x25, 0x98,
+    0xd4, 0x02, 0x3c, 0x00, 0x10, 0x82, 0x9d, 0x12, 0xab, 0x80, 0x0a, 0xb2, 0x9f, 0x36, 0x99, 0x11,
+    0x31, 0xf8, 0x39, 0xb0, 0x1a, 0xa8, 0x21, 0xdd, 0x51, 0x81, 0x08, 0x20, 0xb3, 0x8d, 0x03, 0xac,
+    0x81, 0x2a, 0xe1, 0x2c, 0x05, 0x08, 0x80, 0x33, 0xeb, 0x20, 0xc0, 0x19, 0xa8, 0x11, 0xbe, 0x44,
+    0x90, 0x10, 0x28, 0xc3, 0x0b, 0x83, 0xac, 0x80, 0x19, 0xf1, 0x4c, 0x83, 0x08, 0x01, 0x22, 0xcc,
+    0x31, 0xca, 0x08, 0x0a, 0x92, 0x9f, 0x34, 0x98, 0x21, 0x40, 0xe0, 0x3a, 0xb2, 0x0b, 0xa8, 0x20,
+    0xfb, 0x58, 0x92, 0x10, 0x10, 0x84, 0x9d, 0x12, 0xab, 0x91, 0x1c, 0xb2, 0x0f, 0x05, 0x18, 0x80,
+    0x22, 0xd8, 0x29, 0xb0, 0x88, 0xc8, 0x30, 0xfb, 0x50, 0x81, 0x18, 0x10, 0x93, 0x8f, 0x02, 0x9b,
+    0x81, 0x0a, 0xd2, 0x1d, 0x15, 0x88, 0x81, 0x22, 0xda, 0x48, 0xb8, 0x88, 0x08, 0x88, 0xae, 0x44,
+    0x88, 0x82, 0x38, 0xb2, 0x1e, 0x92, 0x8b, 0x98, 0x29, 0xf0, 0x4b, 0x13, 0x19, 0x02, 0x31, 0xfa,
+    0x48, 0xc9, 0x00, 0x99, 0x81, 0x9e, 0x34, 0x88, 0x01, 0x30, 0xb1, 0x1e, 0xa3, 0x0d, 0x90, 0x2a,
+    0xf0, 0x4a, 0x83, 0x18, 0x10, 0x12, 0xcc, 0x31, 0xd9, 0x80, 0x89, 0x81, 0xaf, 0x25, 0x08, 0x08,
+    0x30, 0xc2, 0x2c, 0xa2, 0x0b, 0xb8, 0x20, 0xf9, 0x3a, 0x07, 0x19, 0x00, 0x11, 0xda, 0x31, 0xd9,
+    0x80, 0x89, 0x92, 0x8e, 0x24, 0x08, 0x80, 0x22, 0xc1, 0x1c, 0x82, 0x9c, 0x08, 0x3b, 0xf2, 0x3d,
+    0x84, 0x08, 0x00, 0x13, 0xdb, 0x20, 0xa8, 0x9a, 0x80, 0x81, 0xaf, 0x63, 0x00, 0x08, 0x11, 0xa2,
+    0x0f, 0x82, 0x8b, 0xa0, 0x29, 0xf1, 0x3a, 0x05, 0x08, 0x10, 0x21, 0xfb, 0x11, 0xb8, 0x08, 0x99,
+    0x02, 0xaf, 0x34, 0x80, 0x00, 0x40, 0xd2, 0x1b, 0x93, 0x8c, 0x90, 0x19, 0xf1, 0x4b, 0x04, 0x88,
+    0xcc, 0x02, 0x3b, 0x00, 0x20, 0xb2, 0x1d, 0xa2, 0x8a, 0x98, 0x09, 0xd0, 0x4d, 0x23, 0x89, 0x20,
+    0x32, 0xfa, 0x28, 0xc8, 0x88, 0xa0, 0x10, 0xcd, 0x72, 0x91, 0x18, 0x00, 0x82, 0x8d, 0x02, 0xab,
+    0x10, 0x8b, 0xe3, 0x2c, 0x15, 0x98, 0x11, 0x22, 0xf8, 0x39, 0xb0, 0x0a, 0x88, 0x08, 0xfb, 0x50,
+    0x02, 0x09, 0x11, 0x12, 0xae, 0x31, 0xbb, 0x29, 0xa9, 0x91, 0x9f, 0x45, 0x88, 0x18, 0x21, 0xd1,
+    0x2b, 0xb3, 0x9b, 0x98, 0x11, 0xfb, 0x7a, 0x02, 0x09, 0x10, 0x21, 0xeb, 0x30, 0xc8, 0x19, 0x99,
+    0x82, 0x9f, 0x24, 0x80, 0x18, 0x21, 0xc2, 0x0c, 0x83, 0x9c, 0x88, 0x19, 0xd0, 0x3c, 0x16, 0x89,
+    0x21, 0x20, 0xf9, 0x38, 0xc0, 0x88, 0xa8, 0x11, 0xdb, 0x52, 0x92, 0x09, 0x13, 0x83, 0xaf, 0x32,
+    0xcb, 0x10, 0x8b, 0xa2, 0x1f, 0x14, 0x90, 0x10, 0x22, 0xd0, 0x1b, 0xa3, 0x9b, 0x98, 0x0a, 0xf1,
+    0x6b, 0x04, 0x99, 0x22, 0x21, 0xdc, 0x30, 0xc8, 0x08, 0xa8, 0x01, 0xcc, 0x44, 0x91, 0x19, 0x21,
+    0x82, 0x9f, 0x12, 0xab, 0x00, 0x8a, 0xc3, 0x1f, 0x24, 0x89, 0x28, 0x21, 0xd0, 0x1a, 0x92, 0x9c,
+    0x91, 0x3a, 0xf8, 0x6a, 0x02, 0x0a, 0x11, 0x12, 0xcc, 0x30, 0xb9, 0x19, 0xa9, 0x22, 0xcf, 0x34,
+    0x90, 0x18, 0x31, 0xd2, 0x0c, 0x02, 0xab, 0x80, 0x09, 0xb1, 0x0f, 0x17, 0x98, 0x20, 0x11, 0xd8,
+    0x2a, 0xc3, 0x89, 0xa0, 0x20, 0xfa, 0x40, 0x02, 0x89, 0x21, 0x12, 0xcd, 0x31, 0xca, 0x80, 0x89,
+    0x01, 0x9f, 0x24, 0x81, 0x09, 0x13, 0xc3, 0x9d, 0x14, 0x9c, 0x00, 0x0a, 0xb2, 0x2f, 0x04, 0x90,
+    0x28, 0x22, 0xea, 0x18, 0x91, 0x9b, 0xb2, 0x38, 0xf8, 0x69, 0x82, 0x89, 0x21, 0x11, 0x9e, 0x30,
+    0xb9, 0x89, 0x98, 0x02, 0xbe, 0x45, 0x91, 0x19, 0x12, 0xa1, 0x8f, 0x03, 0x9c, 0x81, 0x1a, 0xc1,
+    0x5a, 0xf3, 0x37, 0x00, 0x34, 0x82, 0x89, 0x43, 0xa2, 0x9e, 0x31, 0xda, 0x08, 0x98, 0x82, 0x8f,
+    0x24, 0x90, 0x18, 0x22, 0xb0, 0x0f, 0x83, 0x9c, 0x91, 0x19, 0xd2, 0x3c, 0x14, 0x98, 0x30, 0x12,
+    0xfa, 0x28, 0xa1, 0x8b, 0x98, 0x39, 0xf8, 0x6a, 0x02, 0x89, 0x21, 0x02, 0xbd, 0x41, 0xc8, 0x08,
+    0x8a, 0x11, 0xeb, 0x52, 0x81, 0x89, 0x23, 0x91, 0x8f, 0x21, 0xaa, 0x19, 0xba, 0x14, 0x9f, 0x15,
+    0x88, 0x00, 0x12, 0xd0, 0x09, 0x02, 0xbb, 0x20, 0x0d, 0xb2, 0x3e, 0x14, 0x0a, 0x20, 0x31, 0xfb,
+    0x28, 0xb2, 0x8b, 0xb1, 0x20, 0xf9, 0x68, 0x81, 0x09, 0x12, 0x11, 0xae, 0x41, 0xb9, 0x88, 0x88,
+    0x10, 0xbd, 0x45, 0x90, 0x19, 0x13, 0xc1, 0x0c, 0x84, 0x9b, 0x80, 0x09, 0xc2, 0x2e, 0x24, 0xa8,
+    0x38, 0x13, 0xea, 0x19, 0x93, 0x8d, 0x91, 0x2a, 0xf1, 0x49, 0x02, 0x98, 0x30, 0x02, 0xeb, 0x48,
+    0xc0, 0x08, 0x98, 0x10, 0xdb, 0x52, 0x92, 0x89, 0x14, 0x91, 0x9d, 0x32, 0xbb, 0x08, 0x8a, 0xa3,
+    0x9f, 0x17, 0x88, 0x18, 0x12, 0xc0, 0x1b, 0x83, 0x9c, 0x08, 0x8a, 0xc3, 0x2f, 0x05, 0x89, 0x11,
+    0x21, 0xf9, 0x28, 0xb1, 0x89, 0xa1, 0x28, 0xf8, 0x69, 0x81, 0x88, 0x20, 0x02, 0x9e, 0x21, 0xc8,
+    0x08, 0x90, 0x28, 0xcc, 0x63, 0x90, 0x08, 0x21, 0xa1, 0x8e, 0x13, 0xab, 0x18, 0x99, 0xa3, 0x8f,
+    0x16, 0x98, 0x10, 0x21, 0xe0, 0x19, 0x92, 0x8b, 0x80, 0x4b, 0xe1, 0x5b, 0x02, 0x88, 0x18, 0x23,
+    0xdc, 0x20, 0xa1, 0x8b, 0xb2, 0x69, 0xda, 0x60, 0x80, 0x08, 0x10, 0x01, 0x9d, 0x21, 0xb9, 0x00,
+    0xa9, 0x84, 0xad, 0x26, 0xa0, 0x18, 0x21, 0xd2, 0x0b, 0x04, 0x8c, 0x08, 0x09, 0xb1, 0x2d, 0x06,
+    0x88, 0x10, 0x30, 0xf8, 0x29, 0xa2, 0x0b, 0xb1, 0x48, 0xf9, 0x40, 0x00, 0x98, 0x40, 0x81, 0xbb,
+    0x8c, 0x00, 0x36, 0x00, 0x12, 0x9e, 0x01, 0x1b, 0xc2, 0x3c, 0x06, 0x89, 0x10, 0x21, 0xf9, 0x28,
+    0xa1, 0x0a, 0xa0, 0x38, 0xf9, 0x68, 0x80, 0x08, 0x10, 0x02, 0x9d, 0x11, 0xb8, 0x08, 0xc8, 0x22,
+    0xbd, 0x44, 0x91, 0x19, 0x12, 0xb3, 0x9f, 0x13, 0x9c, 0x00, 0x8a, 0x93, 0x0f, 0x15, 0x89, 0x00,
+    0x31, 0xf0, 0x29, 0x80, 0x8a, 0x88, 0x19, 0xe2, 0x4a, 0x04, 0x99, 0x21, 0x12, 0xdc, 0x20, 0xc1,
+    0x19, 0xb0, 0x38, 0xf9, 0x50, 0x91, 0x88, 0x12, 0x02, 0xae, 0x22, 0xb9, 0x18, 0xaa, 0x41, 0xae,
+    0x34, 0xa0, 0x00, 0x32, 0xd2, 0x0d, 0x12, 0xab, 0x81, 0x0c, 0xa3, 0x1f, 0x14, 0x98, 0x28, 0x32,
+    0xf8, 0x2a, 0xa3, 0x9b, 0xb2, 0x5a, 0xe0, 0x38, 0x02, 0x88, 0x48, 0x02, 0xcc, 0x48, 0xb1, 0x1b,
+    0xc1, 0x48, 0xda, 0x41, 0x81, 0x88, 0x22, 0x92, 0x9f, 0x31, 0xb9, 0x19, 0xb9, 0x23, 0xbf, 0x26,
+    0x98, 0x00, 0x21, 0xc2, 0x0d, 0x12, 0x9b, 0x18, 0x8a, 0xb3, 0x0f, 0x16, 0x89, 0x18, 0x13, 0xe8,
+    0x19, 0xa3, 0x9a, 0x90, 0x39, 0xe8, 0x6b, 0x03, 0x8a, 0x30, 0x13, 0xec, 0x20, 0xb1, 0x8a, 0x91,
+    0x49, 0xdb, 0x70, 0x91, 0x08, 0x10, 0x83, 0x9e, 0x12, 0x99, 0x8a, 0xa1, 0x21, 0xaf, 0x53, 0x90,
+    0x29, 0x12, 0xc2, 0x0d, 0x22, 0xac, 0x00, 0x1a, 0xb2, 0x1e, 0x05, 0x88, 0x20, 0x21, 0xf8, 0x19,
+    0x93, 0x8b, 0x98, 0x29, 0xe1, 0x4b, 0x04, 0x89, 0x41, 0x01, 0xda, 0x49, 0xb1, 0x1a, 0xd0, 0x20,
+    0xd8, 0x48, 0x82, 0x98, 0x32, 0x12, 0xbf, 0x41, 0xb8, 0x08, 0xb9, 0x23, 0xdc, 0x42, 0x81, 0x89,
+    0x24, 0xa1, 0x8f, 0x22, 0xaa, 0x08, 0x8b, 0x84, 0xad, 0x16, 0x90, 0x18, 0x12, 0xd1, 0x1a, 0x02,
+    0x0d, 0x08, 0x0c, 0x93, 0x0e, 0x05, 0x88, 0x00, 0x12, 0xe8, 0x18, 0xa2, 0x89, 0x98, 0x4a, 0xb0,
+    0x69, 0xf5, 0x33, 0x00, 0x45, 0x91, 0x19, 0x22, 0xc3, 0x0f, 0x12, 0x8c, 0x00, 0x0b, 0x82, 0x9d,
+    0x16, 0x88, 0x08, 0x13, 0xe0, 0x19, 0x83, 0x8d, 0x81, 0x1b, 0x92, 0x1f, 0x13, 0x99, 0x21, 0x22,
+    0xf8, 0x29, 0xc2, 0x09, 0xa0, 0x39, 0xc8, 0x4d, 0x03, 0x89, 0x30, 0x04, 0xad, 0x11, 0xd2, 0x09,
+    0xc1, 0x30, 0xfa, 0x40, 0x00, 0x09, 0x30, 0xa1, 0x8c, 0x21, 0xe0, 0x08, 0xb0, 0x11, 0xfa, 0x42,
+    0x90, 0x18, 0x21, 0xa1, 0x0e, 0x21, 0x9b, 0x09, 0x99, 0x21, 0xbf, 0x35, 0xa0, 0x29, 0x23, 0xc0,
+    0x1d, 0x02, 0x9b, 0x98, 0x88, 0xa3, 0xaf, 0x27, 0xa8, 0x20, 0x12, 0xb9, 0x2d, 0x83, 0x8d, 0x80,
+    0x2b, 0xe3, 0x3c, 0x84, 0x88, 0x20, 0x12, 0xea, 0x28, 0xa2, 0x8b, 0x80, 0x3b, 0xf1, 0x6b, 0x82,
+    0x89, 0x21, 0x03, 0xdc, 0x21, 0xb0, 0x98, 0x88, 0x29, 0xf8, 0x6a, 0x82, 0x0a, 0x23, 0x81, 0xad,
+    0x32, 0xe8, 0x18, 0xb9, 0x22, 0xdc, 0x33, 0x80, 0x88, 0x62, 0xa1, 0x0d, 0x11, 0xa9, 0x2a, 0xa9,
+    0x21, 0xed, 0x43, 0x88, 0x08, 0x42, 0xc0, 0x0a, 0x22, 0xbb, 0x19, 0x9b, 0x85, 0x9f, 0x34, 0x99,
+    0x10, 0x33, 0xf8, 0x1a, 0x03, 0x9c, 0x91, 0x3b, 0xd2, 0x2c, 0x04, 0x90, 0x28, 0x05, 0xb9, 0x2a,
+    0x95, 0x0c, 0x88, 0x5b, 0xb8, 0x4c, 0x02, 0x88, 0x20, 0x85, 0xca, 0x11, 0xc3, 0x0b, 0xb1, 0x58,
+    0xda, 0x58, 0x81, 0x88, 0x21, 0x93, 0x9d, 0x21, 0xc0, 0x0a, 0xb0, 0x31, 0xfc, 0x51, 0x90, 0x18,
+    0x20, 0x91, 0x8d, 0x22, 0xba, 0x88, 0x98, 0x11, 0xed, 0x53, 0x98, 0x28, 0x31, 0xc0, 0x0d, 0x13,
+    0xab, 0x18, 0x8b, 0x94, 0x8e, 0x15, 0x98, 0x10, 0x32, 0xe8, 0x2a, 0x02, 0x0d, 0x09, 0x1b, 0xb4,
+    0x1c, 0x86, 0x90, 0x01, 0x13, 0xca, 0x3a, 0x83, 0x8f, 0x91, 0x4b, 0xd1, 0x4a, 0x82, 0x19, 0x18,
+    0xda, 0x07, 0x36, 0x00, 0xc0, 0x1b, 0x21, 0xba, 0x89, 0x9a, 0x97, 0x9c, 0x16, 0x88, 0x18, 0x32,
+    0xc9, 0x1b, 0x13, 0xac, 0x08, 0x1d, 0xb3, 0x1f, 0x04, 0x88, 0x10, 0x13, 0xe9, 0x08, 0x83, 0x9c,
+    0x00, 0x2c, 0xb1, 0x2e, 0x85, 0x88, 0x11, 0x12, 0xea, 0x38, 0xb1, 0x0a, 0xc0, 0x20, 0xd9, 0x59,
+    0x02, 0x89, 0x41, 0x82, 0xcc, 0x22, 0xc0, 0x09, 0xb8, 0x41, 0xeb, 0x41, 0x81, 0x09, 0x50, 0x00,
+    0xac, 0x31, 0xd8, 0x80, 0xa8, 0x03, 0xad, 0x34, 0x88, 0x29, 0x51, 0xa1, 0x8e, 0x22, 0xab, 0x91,
+    0x0b, 0xa6, 0x0d, 0x05, 0x88, 0x08, 0x14, 0xa9, 0x0a, 0x22, 0x9d, 0x80, 0x2c, 0xb2, 0x2f, 0x84,
+    0x90, 0x18, 0x05, 0xb9, 0x18, 0x01, 0x8c, 0x98, 0x6b, 0xb8, 0x6b, 0x82, 0x98, 0x40, 0x83, 0xbc,
+    0x21, 0xc2, 0x89, 0xd0, 0x40, 0xca, 0x50, 0x80, 0x08, 0x30, 0x92, 0xac, 0x31, 0xd1, 0x09, 0xa9,
+    0x50, 0xeb, 0x51, 0x90, 0x08, 0x21, 0xa2, 0x8e, 0x12, 0xa8, 0x88, 0xaa, 0x05, 0xbd, 0x16, 0x08,
+    0x09, 0x32, 0xb8, 0x1d, 0x12, 0xba, 0x81, 0x8d, 0x95, 0x8c, 0x14, 0x80, 0x09, 0x34, 0xca, 0x19,
+    0x21, 0x9c, 0x08, 0x1d, 0xb3, 0x1e, 0x04, 0x90, 0x00, 0x05, 0xc9, 0x18, 0x82, 0x0b, 0xa9, 0x6a,
+    0xa9, 0x6b, 0x82, 0x88, 0x20, 0x86, 0xba, 0x20, 0xa2, 0x9b, 0xb0, 0x68, 0xea, 0x50, 0x80, 0x08,
+    0x20, 0x83, 0x9e, 0x20, 0xb1, 0xa8, 0xa8, 0x21, 0xfa, 0x78, 0x80, 0x08, 0x11, 0x82, 0x9e, 0x12,
+    0xa8, 0x88, 0x0b, 0x02, 0x9e, 0x33, 0x01, 0xa9, 0x46, 0xb0, 0x0d, 0x22, 0xaa, 0x89, 0x0a, 0xc4,
+    0x0a, 0x06, 0x00, 0x08, 0x24, 0xd8, 0x1a, 0x12, 0x9c, 0x89, 0x3b, 0xd2, 0x2c, 0x06, 0x98, 0x11,
+    0x04, 0xd9, 0x18, 0x92, 0x0a, 0x9b, 0x49, 0xc8, 0x5a, 0x83, 0x90, 0x50, 0x02, 0xeb, 0x38, 0xc3,
+    0x08, 0xfe, 0x36, 0x00, 0x81, 0x1c, 0xa2, 0x1c, 0x04, 0x00, 0x08, 0x15, 0xe0, 0x09, 0x13, 0xac,
+    0x81, 0x3b, 0xc0, 0x5c, 0x81, 0x10, 0x19, 0x85, 0xc8, 0x08, 0x83, 0x9b, 0xa0, 0x4d, 0xc1, 0x4c,
+    0x82, 0x80, 0x28, 0x84, 0xda, 0x20, 0xa2, 0x0b, 0xb0, 0x39, 0xf0, 0x49, 0x11, 0x88, 0x48, 0x83,
+    0xbd, 0x41, 0xd2, 0x09, 0xc8, 0x32, 0xbc, 0x52, 0x08, 0x90, 0x41, 0xa1, 0x8d, 0x22, 0xb8, 0x1a,
+    0xca, 0x32, 0xdc, 0x33, 0x80, 0x90, 0x73, 0xb1, 0x0d, 0x22, 0xaa, 0x09, 0x8b, 0x03, 0x9f, 0x05,
+    0x00, 0x90, 0x24, 0xc8, 0x0a, 0x33, 0x9e, 0x91, 0x1c, 0xb3, 0x1c, 0x85, 0x00, 0x00, 0x32, 0xf8,
+    0x2a, 0x02, 0x0c, 0x98, 0x3b, 0xc1, 0x4b, 0x03, 0x80, 0x20, 0x07, 0xca, 0x28, 0xa3, 0x8b, 0xc8,
+    0x5b, 0xc1, 0x5b, 0x01, 0x81, 0x39, 0x85, 0xda, 0x21, 0xb1, 0x1a, 0xba, 0x59, 0xd0, 0x38, 0x02,
+    0x08, 0x40, 0x84, 0xad, 0x21, 0xe2, 0x08, 0xb8, 0x20, 0xd9, 0x51, 0x80, 0x10, 0x28, 0x83, 0x9f,
+    0x21, 0xb8, 0x88, 0xca, 0x14, 0xbc, 0x34, 0x08, 0x80, 0x71, 0x98, 0x8b, 0x22, 0xd9, 0x81, 0xbb,
+    0x06, 0xbb, 0x16, 0x18, 0x88, 0x42, 0xb8, 0x0c, 0x22, 0xab, 0x90, 0x0d, 0x83, 0x8e, 0x14, 0x00,
+    0x88, 0x24, 0xd8, 0x1a, 0x03, 0x8c, 0xb0, 0x2c, 0xb3, 0x2d, 0x13, 0x01, 0x08, 0x17, 0xd9, 0x18,
+    0x92, 0x0b, 0xb8, 0x5c, 0xa0, 0x3c, 0x03, 0x00, 0x10, 0x25, 0xfb, 0x28, 0xb2, 0x09, 0xd9, 0x30,
+    0xd8, 0x49, 0x01, 0x00, 0x59, 0x81, 0xaa, 0x18, 0xa4, 0x9b, 0xc0, 0x69, 0xd8, 0x48, 0x91, 0x01,
+    0x28, 0x93, 0xbc, 0x32, 0xd0, 0x19, 0xcb, 0x42, 0xcb, 0x51, 0x18, 0x80, 0x30, 0x93, 0x9f, 0x21,
+    0xc0, 0x19, 0xc9, 0x31, 0xea, 0x22, 0x10, 0x80, 0x50, 0x91, 0x8d, 0x20, 0xc0, 0x88, 0x9a, 0x03,
+    0x76, 0xfb, 0x2e, 0x00, 0x6d, 0x81, 0x10, 0x18, 0x94, 0xb9, 0x18, 0xa5, 0x0b, 0xe8, 0x48, 0xc8,
+    0x48, 0x80, 0x11, 0x19, 0x85, 0xab, 0x21, 0xa0, 0x1b, 0xfa, 0x48, 0xd8, 0x30, 0x00, 0x92, 0x59,
+    0x82, 0x9c, 0x20, 0xa0, 0x9a, 0xab, 0x42, 0xfa, 0x30, 0x12, 0x90, 0x62, 0x91, 0x8d, 0x40, 0xb9,
+    0x00, 0x9d, 0x03, 0xbb, 0x24, 0x30, 0xa0, 0x72, 0xa1, 0x8c, 0x12, 0xc8, 0x08, 0x9d, 0x13, 0x9d,
+    0x13, 0x40, 0x98, 0x52, 0xa8, 0x0b, 0x41, 0xd9, 0x90, 0xb9, 0x05, 0x9c, 0x14, 0x39, 0x88, 0x61,
+    0xa8, 0x0a, 0x11, 0xc8, 0xa8, 0x9a, 0x05, 0xad, 0x15, 0x18, 0x00, 0x41, 0xb9, 0x2a, 0x21, 0xcc,
+    0xa1, 0xaa, 0x87, 0x8c, 0x23, 0x18, 0x00, 0x42, 0xd8, 0x1a, 0x22, 0x9d, 0x80, 0x0e, 0x93, 0x0d,
+    0x83, 0x12, 0x88, 0x15, 0xb9, 0x09, 0x14, 0xad, 0x81, 0x0c, 0x93, 0x0f, 0x03, 0x10, 0x90, 0x43,
+    0xc9, 0x19, 0x03, 0x9d, 0x80, 0x8d, 0x84, 0x0d, 0x03, 0x10, 0x88, 0x14, 0xc8, 0x19, 0x84, 0x8d,
+    0x91, 0x1d, 0x92, 0x2c, 0x81, 0x23, 0x8a, 0x25, 0xba, 0x19, 0x86, 0x9c, 0xb2, 0x1a, 0xc3, 0x2b,
+    0x03, 0x05, 0x19, 0x15, 0xaa, 0x1a, 0x85, 0x8d, 0xb1, 0x2b, 0xc3, 0x2c, 0x03, 0x12, 0x18, 0x16,
+    0xca, 0x28, 0x93, 0x9e, 0xa1, 0x2b, 0xc4, 0x1d, 0x04, 0x00, 0x08, 0x14, 0xca, 0x20, 0x00, 0x8d,
+    0x08, 0x1c, 0xb2, 0x2d, 0x03, 0x93, 0x18, 0x07, 0xb9, 0x39, 0xb3, 0x1e, 0xb8, 0x49, 0xc8, 0x39,
+    0x11, 0x94, 0x28, 0x86, 0xa9, 0x29, 0xb3, 0x1d, 0xd8, 0x39, 0xd1, 0x3a, 0x03, 0x82, 0x4a, 0x05,
+    0xbb, 0x21, 0xb2, 0x8d, 0xb0, 0x2b, 0xb2, 0x1f, 0x15, 0x88, 0x11, 0x23, 0xfb, 0x20, 0xb1, 0x8a,
+    0xc8, 0x39, 0xb8, 0x3c, 0x34, 0x91, 0x50, 0x84, 0xda, 0x30, 0xd3, 0x0b, 0xb0, 0x3a, 0xc0, 0x3a,
+    0x5d, 0xfe, 0x2c, 0x00, 0x31, 0xb2, 0x26, 0xc2, 0xab, 0x17, 0xca, 0x01, 0x9c, 0x12, 0x9c, 0x32,
+    0x20, 0x90, 0x63, 0xc1, 0x0b, 0x43, 0xfa, 0x10, 0xba, 0x32, 0xdb, 0x32, 0x18, 0xa2, 0x70, 0xb1,
+    0x0a, 0x41, 0xba, 0x29, 0xbc, 0x42, 0xea, 0x31, 0x10, 0x90, 0x41, 0xb2, 0x0d, 0x22, 0xe9, 0x80,
+    0xb9, 0x22, 0xfa, 0x31, 0x10, 0x80, 0x78, 0x90, 0x1b, 0x11, 0xd8, 0x08, 0xc9, 0x31, 0xe9, 0x30,
+    0x20, 0x90, 0x79, 0xa1, 0x89, 0x11, 0xc8, 0x19, 0xba, 0x41, 0xda, 0x48, 0x12, 0xa0, 0x51, 0x91,
+    0x8b, 0x41, 0xe9, 0x08, 0xc8, 0x30, 0xda, 0x40, 0x20, 0xa0, 0x50, 0x81, 0x9b, 0x31, 0xf0, 0x19,
+    0xb9, 0x30, 0xd9, 0x49, 0x22, 0x98, 0x58, 0x83, 0xbb, 0x12, 0xe3, 0x0b, 0xc0, 0x39, 0xd0, 0x3a,
+    0x34, 0x99, 0x68, 0x02, 0xbb, 0x31, 0xd1, 0x0a, 0xc9, 0x49, 0xc0, 0x3c, 0x04, 0x90, 0x38, 0x87,
+    0x9a, 0x10, 0xa2, 0x0d, 0x90, 0x2c, 0xb2, 0x2e, 0x03, 0x80, 0x28, 0x15, 0xbb, 0x11, 0x82, 0x9f,
+    0x80, 0x0b, 0xa4, 0x0d, 0x05, 0x80, 0x00, 0x23, 0xba, 0x4a, 0x82, 0x8f, 0x90, 0x0a, 0xa3, 0x8d,
+    0x15, 0x81, 0x09, 0x25, 0xba, 0x18, 0x12, 0x9f, 0x91, 0x0b, 0x82, 0x9c, 0x24, 0x83, 0x09, 0x35,
+    0xc9, 0x09, 0x23, 0xaf, 0x81, 0x8b, 0x02, 0xbc, 0x54, 0x00, 0x09, 0x43, 0xa8, 0x0c, 0x22, 0xfa,
+    0x00, 0xb9, 0x21, 0xe9, 0x41, 0x81, 0x08, 0x50, 0x90, 0x8b, 0x22, 0xf8, 0x08, 0xb8, 0x20, 0xc9,
+    0x68, 0x01, 0x88, 0x41, 0x91, 0x8c, 0x12, 0xf0, 0x08, 0xa9, 0x11, 0xc8, 0x59, 0x21, 0x89, 0x50,
+    0x81, 0xab, 0x13, 0xf1, 0x09, 0x99, 0x28, 0xb8, 0x4c, 0x23, 0xa0, 0x51, 0x94, 0xba, 0x12, 0xb2,
+    0x8f, 0xa0, 0x4b, 0x90, 0x1e, 0x04, 0x00, 0x18, 0x04, 0xca, 0x11, 0xa1, 0x8c, 0x88, 0x1c, 0x82,
+    0x72, 0xfa, 0x2c, 0x00, 0x70, 0x02, 0x90, 0x51, 0xa1, 0x8b, 0x12, 0xf1, 0x2b, 0xb8, 0x59, 0xb8,
+    0x5a, 0x12, 0x90, 0x58, 0xa3, 0xab, 0x22, 0xf2, 0x1b, 0xa0, 0x2a, 0xb2, 0x2e, 0x24, 0x90, 0x39,
+    0x86, 0xaa, 0x10, 0xb3, 0x8f, 0x91, 0x2b, 0x92, 0x0e, 0x14, 0x81, 0x19, 0x14, 0xca, 0x10, 0x81,
+    0x8e, 0x90, 0x8a, 0x84, 0x8c, 0x34, 0x08, 0x08, 0x24, 0xd9, 0x18, 0x01, 0xad, 0x91, 0xaa, 0x24,
+    0xbd, 0x34, 0x01, 0x09, 0x63, 0xa9, 0x1a, 0x21, 0xec, 0x81, 0xa9, 0x12, 0xd9, 0x31, 0x23, 0x9a,
+    0x44, 0xa0, 0x0c, 0x31, 0xeb, 0x08, 0xb9, 0x40, 0xe8, 0x48, 0x02, 0x88, 0x30, 0xa3, 0x8e, 0x02,
+    0xd0, 0x09, 0xa8, 0x49, 0xc0, 0x4a, 0x13, 0x90, 0x58, 0x82, 0xcb, 0x22, 0xe1, 0x09, 0xa9, 0x29,
+    0xa2, 0x1e, 0x15, 0x88, 0x20, 0x12, 0xda, 0x38, 0xa0, 0x1e, 0x99, 0x0a, 0x83, 0x8e, 0x15, 0x91,
+    0x00, 0x14, 0xc9, 0x28, 0x01, 0x9f, 0x00, 0x0b, 0x02, 0x9d, 0x24, 0x01, 0x09, 0x24, 0xb9, 0x0a,
+    0x33, 0xcf, 0x81, 0xaa, 0x04, 0xba, 0x63, 0x10, 0x09, 0x41, 0xa0, 0x0c, 0x21, 0xfa, 0x80, 0xa8,
+    0x30, 0xd9, 0x50, 0x11, 0x98, 0x40, 0x91, 0x8c, 0x21, 0xf0, 0x19, 0xa8, 0x28, 0xc0, 0x59, 0x02,
+    0x90, 0x30, 0x93, 0xbc, 0x31, 0xf3, 0x1c, 0x98, 0x29, 0xb1, 0x4c, 0x13, 0x91, 0x49, 0x84, 0xab,
+    0x10, 0xc4, 0x0d, 0x90, 0x0a, 0x94, 0x0c, 0x15, 0x80, 0x18, 0x32, 0xdb, 0x38, 0xa1, 0x0e, 0x98,
+    0x99, 0x04, 0xac, 0x16, 0x81, 0x08, 0x32, 0xd9, 0x19, 0x02, 0x9e, 0x90, 0x09, 0x20, 0xac, 0x63,
+    0x82, 0x1a, 0x33, 0xd8, 0x0a, 0x22, 0xcd, 0x91, 0x99, 0x22, 0xeb, 0x42, 0x21, 0x9a, 0x53, 0xa0,
+    0x8c, 0x41, 0xda, 0x00, 0xaa, 0x22, 0xd9, 0x40, 0x12, 0x98, 0x42, 0xb2, 0x8c, 0x21, 0xf8, 0x19,
+    0x39, 0xfe, 0x2e, 0x00, 0x89, 0x83, 0x9c, 0x34, 0x12, 0x1c, 0x24, 0xb9, 0x1b, 0x32, 0xbf, 0x80,
+    0x9a, 0x13, 0xeb, 0x62, 0x01, 0x09, 0x41, 0xa8, 0x8a, 0x31, 0xfa, 0x19, 0xba, 0x42, 0xda, 0x32,
+    0x21, 0xa8, 0x72, 0xa0, 0x8a, 0x21, 0xf0, 0x09, 0xa8, 0x38, 0xc8, 0x40, 0x21, 0xa1, 0x68, 0x92,
+    0x8c, 0x18, 0xd3, 0x0b, 0xa0, 0x3a, 0xe3, 0x4a, 0x13, 0x80, 0x49, 0x83, 0xbc, 0x02, 0xb2, 0x8f,
+    0x88, 0x0a, 0x94, 0x1d, 0x33, 0x81, 0x19, 0x07, 0xb9, 0x19, 0x93, 0x8f, 0x90, 0x09, 0x82, 0x8c,
+    0x06, 0x11, 0x09, 0x23, 0xca, 0x09, 0x31, 0xbf, 0x81, 0x9a, 0x05, 0x9c, 0x33, 0x12, 0x9a, 0x26,
+    0xa9, 0x0a, 0x58, 0xea, 0x00, 0xb8, 0x22, 0xdb, 0x53, 0x18, 0xa0, 0x32, 0xc1, 0x1b, 0x38, 0xf9,
+    0x08, 0xa9, 0x31, 0xea, 0x50, 0x01, 0x90, 0x30, 0xa3, 0x9d, 0x11, 0xf2, 0x09, 0x98, 0x28, 0xc0,
+    0x49, 0x13, 0x90, 0x69, 0x01, 0x9c, 0x10, 0xc2, 0x1c, 0xa8, 0x28, 0xd2, 0x5b, 0x02, 0x01, 0x2a,
+    0x05, 0xcb, 0x01, 0x92, 0x8e, 0x80, 0x2b, 0x92, 0x0e, 0x05, 0x01, 0x09, 0x04, 0xba, 0x01, 0x20,
+    0x9f, 0x08, 0x89, 0x12, 0x9f, 0x14, 0x10, 0x09, 0x32, 0xca, 0x29, 0x10, 0xbd, 0x91, 0x99, 0x05,
+    0xdb, 0x52, 0x01, 0x89, 0x42, 0xa8, 0x0b, 0x31, 0xfa, 0x88, 0xa8, 0x21, 0xda, 0x60, 0x11, 0x89,
+    0x40, 0xa1, 0x8b, 0x11, 0xf2, 0x0a, 0x98, 0x38, 0xd9, 0x69, 0x11, 0x08, 0x28, 0x83, 0x9e, 0x01,
+    0xc2, 0x1b, 0xa8, 0x59, 0xd8, 0x48, 0x01, 0x92, 0x29, 0x85, 0xab, 0x01, 0xa2, 0x8e, 0x88, 0x19,
+    0xd3, 0x2c, 0x14, 0x82, 0x1a, 0x15, 0xbb, 0x00, 0x93, 0x9f, 0x80, 0x09, 0x92, 0x8e, 0x25, 0x00,
+    0x09, 0x23, 0xf9, 0x80, 0x11, 0x9d, 0x00, 0x8a, 0x03, 0x8e, 0x23, 0x21, 0xa9, 0x44, 0xc8, 0x09,
+    0x9f, 0x00, 0x28, 0x00, 0xc3, 0x1c, 0xb0, 0x28, 0xc1, 0x4b, 0x23, 0x83, 0x2b, 0x16, 0xac, 0x81,
+    0x92, 0x9f, 0x81, 0x0a, 0xb3, 0x2b, 0x25, 0x04, 0x1b, 0x15, 0xba, 0x18, 0x38, 0xbf, 0x00, 0x9a,
+    0x85, 0x8c, 0x14, 0x12, 0x9a, 0x25, 0xa9, 0x0a, 0x40, 0xbd, 0x00, 0xb9, 0x43, 0xdb, 0x42, 0x21,
+    0x99, 0x61, 0x90, 0x1c, 0x28, 0xf8, 0x08, 0x98, 0x20, 0xb9, 0x40, 0x23, 0xb8, 0x71, 0x91, 0x9b,
+    0x11, 0xf2, 0x1a, 0x98, 0x39, 0xd1, 0x39, 0x23, 0xa1, 0x69, 0x82, 0xbb, 0x02, 0xc4, 0x0e, 0x91,
+    0x2b, 0xa2, 0x2d, 0x13, 0x83, 0x1b, 0x17, 0xba, 0x01, 0x11, 0xaf, 0x01, 0x9a, 0x84, 0x0d, 0x23,
+    0x18, 0x88, 0x43, 0xe8, 0x18, 0x10, 0xeb, 0x10, 0xa9, 0x12, 0xac, 0x15, 0x20, 0xa8, 0x53, 0xa8,
+    0x0a, 0x48, 0xf8, 0x08, 0xa8, 0x11, 0xc9, 0x51, 0x10, 0x90, 0x50, 0x90, 0x0b, 0x18, 0xe4, 0x1a,
+    0xa0, 0x39, 0xe0, 0x48, 0x01, 0x00, 0x29, 0x94, 0x9b, 0x92, 0xb4, 0x0e, 0x90, 0x2a, 0xa1, 0x2c,
+    0x15, 0x81, 0x28, 0x03, 0xea, 0x00, 0x01, 0x8f, 0x90, 0x89, 0x83, 0x8d, 0x15, 0x01, 0x89, 0x33,
+    0xe8, 0x88, 0x21, 0xcc, 0x81, 0xa9, 0x13, 0xac, 0x44, 0x01, 0x09, 0x42, 0xb0, 0x0d, 0x38, 0xf8,
+    0x08, 0xb8, 0x22, 0xe9, 0x31, 0x12, 0x90, 0x58, 0xa2, 0x0e, 0x10, 0xc0, 0x1a, 0x90, 0x4b, 0xd1,
+    0x38, 0x12, 0xa2, 0x38, 0x85, 0xac, 0x10, 0xb2, 0x0f, 0x88, 0x1a, 0xb3, 0x2d, 0x15, 0x91, 0x10,
+    0x12, 0xe9, 0x08, 0x83, 0x9f, 0x81, 0x0a, 0x82, 0x0e, 0x23, 0x01, 0x09, 0x24, 0xc9, 0x89, 0x23,
+    0xdd, 0x00, 0xa9, 0x32, 0xad, 0x53, 0x00, 0x08, 0x41, 0xa8, 0x1c, 0x10, 0xe9, 0x08, 0xb8, 0x30,
+    0xf0, 0x40, 0x01, 0x08, 0x38, 0xa3, 0x0e, 0x00, 0xd1, 0x1a, 0xb0, 0x5a, 0xc0, 0x59, 0x01, 0x80,
+    0x57, 0x00, 0x25, 0x00, 0x31, 0xa9, 0x1b, 0x30, 0xfb, 0x08, 0xb9, 0x32, 0xdc, 0x43, 0x10, 0x88,
+    0x41, 0xa1, 0x0d, 0x38, 0xf0, 0x19, 0xb0, 0x38, 0xe0, 0x38, 0x12, 0x90, 0x30, 0x93, 0xbc, 0x11,
+    0xb6, 0x0e, 0x80, 0x3b, 0xb1, 0x3c, 0x04, 0x82, 0x08, 0x87, 0xb9, 0x81, 0x22, 0x9f, 0x00, 0x0b,
+    0x83, 0x0f, 0x22, 0x00, 0x88, 0x14, 0xb9, 0x88, 0x51, 0xfb, 0x10, 0xa9, 0x13, 0xad, 0x33, 0x20,
+    0x99, 0x62, 0xa8, 0x89, 0x20, 0xf1, 0x09, 0xa0, 0x4a, 0xb0, 0x6b, 0x12, 0x88, 0x20, 0x82, 0xbc,
+    0x22, 0xc0, 0x1e, 0x90, 0x1b, 0xb3, 0x2c, 0x07, 0x80, 0x28, 0x12, 0xbb, 0x18, 0x02, 0xbf, 0x81,
+    0xc9, 0x85, 0x9b, 0x17, 0x08, 0x18, 0x30, 0xc9, 0x3a, 0x10, 0xbd, 0x01, 0xd8, 0x22, 0xdb, 0x33,
+    0x82, 0xa1, 0x52, 0xb0, 0x1b, 0x20, 0xf0, 0x2c, 0xa8, 0x5a, 0xc0, 0x38, 0x22, 0x88, 0x48, 0x92,
+    0x9c, 0x00, 0xc2, 0x0c, 0xa1, 0x1e, 0x94, 0x1c, 0x14, 0x08, 0x08, 0x13, 0xcb, 0x18, 0x82, 0x9f,
+    0x81, 0xaa, 0x15, 0xac, 0x24, 0x81, 0x90, 0x42, 0xd8, 0x29, 0x10, 0xcb, 0x18, 0xc8, 0x41, 0xda,
+    0x41, 0x01, 0x98, 0x31, 0xc2, 0x8b, 0x12, 0xf1, 0x1a, 0xa0, 0x4a, 0xb0, 0x5c, 0x12, 0x88, 0x11,
+    0x92, 0xe9, 0x10, 0xc3, 0x0c, 0x80, 0x2b, 0xb3, 0x1e, 0x15, 0x08, 0x00, 0x12, 0xca, 0x29, 0x11,
+    0xaf, 0x81, 0xa9, 0x04, 0xac, 0x26, 0x80, 0x08, 0x22, 0xc9, 0x1a, 0x21, 0xec, 0x01, 0xa9, 0x31,
+    0xea, 0x41, 0x01, 0x90, 0x40, 0xa1, 0x8c, 0x02, 0xe0, 0x08, 0xa8, 0x5a, 0xb0, 0x4a, 0x14, 0x98,
+    0x20, 0x83, 0xbc, 0x11, 0xb2, 0x8f, 0x00, 0x1e, 0x82, 0x0d, 0x14, 0x08, 0x00, 0x11, 0xd8, 0x08,
+    0x02, 0xad, 0x81, 0xa9, 0x04, 0xac, 0x25, 0x00, 0x80, 0x32, 0xaa, 0x1b, 0x7a, 0xe9, 0x10, 0xb9,
+    0xa5, 0xff, 0x1d, 0x00, 0xb2, 0x2b, 0x15, 0x81, 0x38, 0x01, 0xb8, 0x1d, 0x12, 0xaf, 0x92, 0xaa,
+    0x14, 0xad, 0x25, 0x80, 0x00, 0x02, 0xa0, 0x0c, 0x21, 0xfb, 0x00, 0xb9, 0x50, 0xc9, 0x58, 0x02,
+    0x09, 0x30, 0x91, 0x9c, 0x11, 0xf2, 0x89, 0x80, 0x1b, 0xa4, 0x1d, 0x15, 0x88, 0x10, 0x83, 0xbb,
+    0x10, 0x02, 0xbf, 0x11, 0x8d, 0x83, 0x8c, 0x15, 0x10, 0x88, 0x13, 0xc9, 0x19, 0x30, 0xfc, 0x10,
+    0xc9, 0x13, 0xcb, 0x53, 0x08, 0x00, 0x20, 0xa0, 0x0b, 0x20, 0xf2, 0x1b, 0xd0, 0x20, 0xc8, 0x69,
+    0x01, 0x90, 0x21, 0x91, 0xc9, 0x20, 0xd2, 0x1c, 0x90, 0x2b, 0x81, 0x1f, 0x23, 0x90, 0x01, 0x33,
+    0xeb, 0x18, 0x11, 0xae, 0x10, 0xd9, 0x12, 0xca, 0x24, 0x92, 0x00, 0x41, 0x99, 0x0c, 0x40, 0xea,
+    0x00, 0xa8, 0x10, 0xc0, 0x58, 0x02, 0x88, 0x31, 0x91, 0xcb, 0x12, 0xe2, 0x0d, 0x81, 0x2b, 0xc2,
+    0x3c, 0x05, 0x08, 0x00, 0x03, 0xcb, 0x01, 0x02, 0xaf, 0x11, 0x9c, 0x85, 0x9b, 0x15, 0x00, 0x88,
+    0x13, 0xb8, 0x1b, 0x32, 0xcf, 0x01, 0xb8, 0x30, 0xf8, 0x50, 0x80, 0x10, 0x08, 0x81, 0x9b, 0x02,
+    0xe1, 0x1b, 0xc2, 0x2a, 0xc3, 0x4c, 0x03, 0x00, 0x39, 0x02, 0xea, 0x18, 0xa3, 0x8f, 0x91, 0xa8,
+    0x03, 0xbb, 0x36, 0x01, 0x08, 0x40, 0xc0, 0x2b, 0x01, 0xdc, 0x81, 0xb8, 0x21, 0xf9, 0x41, 0x02,
+    0x89, 0x32, 0xa0, 0x9d, 0x03, 0xf1, 0x1a, 0xb1, 0x3a, 0xd2, 0x6b, 0x02, 0x08, 0x20, 0x91, 0xd9,
+    0x30, 0xb0, 0x0e, 0x91, 0x1b, 0x92, 0x0e, 0x15, 0x90, 0x11, 0x02, 0xd8, 0x39, 0x91, 0x9d, 0x91,
+    0xa9, 0x31, 0xfb, 0x61, 0x91, 0x00, 0x11, 0x90, 0x9b, 0x13, 0xf8, 0x2a, 0xa8, 0x3c, 0xb1, 0x5c,
+    0x03, 0x08, 0x11, 0x93, 0xd9, 0x28, 0xa2, 0x9f, 0x81, 0x0c, 0x83, 0x0f, 0x13, 0x18, 0x00, 0x21,
+    0x32, 0x00, 0x0f, 0x00, 0x0c, 0x81, 0xc1, 0x0c, 0xa1, 0x2b, 0xe3, 0x3b, 0x16, 0x08, 0x28, 0x01,
+    0xa9, 0x29, 0xa1, 0x9f, 0x81, 0xe9, 0x21, 0xda, 0x53, 0x88, 0x10, 0x11, 0xa0, 0x9a, 0x04, 0xea,
+    0x18, 0xa8, 0x2c, 0xc4, 0x5b, 0x82, 0x18, 0x10, 0x01, 0xbb, 0x32, 0xb8, 0x8f, 0x81, 0xbb, 0x15,
+    0x9e, 0x25, 0x89, 0x01, 0x20, 0xc8, 0x18, 0x81, 0xea, 0x10, 0xc8, 0x30, 0xcb, 0x62, 0x80, 0x00,
+    0x20, 0xa1, 0x0b, 0x02, 0xf0, 0x4b, 0xb8, 0x3a, 0xc1, 0x49, 0x83, 0x92, 0x38, 0x95, 0xb9, 0x5a,
+    0x91, 0x8f, 0x81, 0x9a, 0x12, 0xcb, 0x35, 0x09, 0x82, 0x48, 0xb0, 0x2b, 0x81, 0xf9, 0x19, 0xd1,
+    0x49, 0xd9, 0x41, 0x90, 0x01, 0x10, 0x91, 0x9a, 0x12, 0xc8, 0x1d, 0xa2, 0x1d, 0xa2, 0x2c, 0x14,
+    0x29, 0x08, 0x23, 0xea, 0x10, 0x91, 0xdb, 0x12, 0xea, 0x30, 0xd9, 0x42, 0x88, 0x81, 0x40, 0xb1,
+    0x0b, 0x12, 0xe0, 0x2b, 0xb1, 0x3d, 0xc2, 0x29, 0x04, 0x80, 0x11, 0x02, 0xd9, 0x39, 0xa4, 0xad,
+    0x02, 0xaa, 0x02, 0x9d, 0x25, 0x81, 0x20, 0x10, 0x11, 0x9f, 0x13, 0xeb, 0x01, 0xa9, 0x18, 0xc2,
+    0x7b, 0x01, 0x18, 0x18, 0x82, 0xda, 0x21, 0xd1, 0x89, 0x91, 0x0c, 0xa3, 0x1d, 0x33, 0x00, 0x18,
+    0x33, 0xac, 0x3a, 0x03, 0xdd, 0x92, 0xc9, 0x13, 0xda, 0x61, 0x00, 0x19, 0x20, 0x90, 0xb9, 0x21,
+    0xf1, 0x2a, 0xc8, 0x39, 0xc1, 0x4b, 0x13, 0x10, 0x4a, 0x93, 0x99, 0x2d, 0x93, 0x9e, 0x01, 0xdb,
+    0x04, 0xba, 0x24, 0x90, 0x31, 0x39, 0xa1, 0x0d, 0x21, 0xf9, 0x29, 0xc9, 0x31, 0xd9, 0x58, 0x00,
+    0x00, 0x00, 0x11, 0xaa, 0x32, 0xab, 0x9b, 0x01, 0x9e, 0x84, 0x8d, 0x04, 0x80, 0x00, 0x11, 0x08,
+    0x1c, 0x02, 0xbc, 0x13, 0xcc, 0x22, 0xdb, 0x32, 0x01, 0x00, 0x41, 0x00, 0xbb, 0x31, 0xd1, 0x09,
+    0x00, 0x00, 0x02, 0x00, 0xaa, 0x23, 0xf9, 0x21, 0x80, 0x00, 0x11, 0x11, 0xbb, 0x41, 0xb9, 0x19,
+    0xb1, 0x3b, 0xb1, 0x3b, 0x23, 0x10, 0x11, 0x12, 0x99, 0x2b, 0x92, 0xab, 0x91, 0xb9, 0x93, 0xbb,
+    0x33, 0x11, 0x11, 0x31, 0x90, 0xa9, 0x22, 0xc9, 0x00, 0xb9, 0x11, 0x9a, 0x3a, 0x13, 0x19, 0x11,
+    0x11, 0x99, 0x10, 0x91, 0x0a, 0x91, 0x0b, 0x03, 0x8c, 0x13, 0x00, 0x91, 0x30, 0xa1, 0x99, 0x12,
+    0x9a, 0x00, 0xb0, 0x21, 0xb9, 0x21, 0x01, 0x00, 0x10, 0x11, 0x99, 0x19, 0xa2, 0x1a, 0x91, 0x19,
+    0x91, 0x1a, 0x02, 0x00, 0x10, 0x10, 0x90, 0x09, 0x01, 0x09, 0x00, 0x99, 0x11, 0x99, 0x10, 0x01,
+    0x00, 0x10, 0x91, 0x09, 0x10, 0x09, 0x00, 0x00, 0x09, 0x01, 0x1a, 0x11, 0x00, 0x00, 0x01, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x90, 0x01, 0x99, 0x11, 0x00, 0x00, 0x10, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x19, 0x00, 0x19, 0x00, 0x00, 0x00, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
-const size_t weee_hahaha_16k_len = 25069;
-const int weee_hahaha_16k_sample_rate = 16000;
+const audio_adpcm_clip_t weee_hahaha_16k_adpcm = {
+    .data = weee_hahaha_16k_data,
+    .data_len = sizeof(weee_hahaha_16k_data),
+    .samples = 25069,
+    .sample_rate = 16000,
+    .block_align = 256,
+};
@@ -10,11 +10,9 @@
 
 
 #include "lvgl_music_list.h"
-#include <demos/music/assets/spectrum_1.h>
-#include <demos/music/assets/spectrum_2.h>
-#include <demos/music/assets/spectrum_3.h>
 #include "bsp_board.h"
 #include "audio_driver.h"
+#include "audio_spectrum.h"
 
 /*********************
  *      DEFINES
@@ -28,16 +26,17 @@
     #define BAR_COLOR1_STOP     160
     #define BAR_COLOR2_STOP     200
     #define BAR_REST_RADIUS     165
+    #define BAR_AMPL_MAX        80      /*Bar growth at a full-scale band level*/
 #else
     #define BAR_COLOR1_STOP     80
     #define BAR_COLOR2_STOP     100
     #define BAR_REST_RADIUS     82
+    #define BAR_AMPL_MAX        40
 #endif
 #define BAR_COLOR3_STOP     (LV_MAX(LV_HOR_RES, LV_VER_RES) / 3)
 #define BAR_CNT             20
 #define DEG_STEP            (180/BAR_CNT)
-#define BAND_CNT            4
-#define BAR_PER_BAND_CNT    (BAR_CNT / BAND_CNT)
+#define SPECTRUM_POLL_MS    LV_DEF_REFR_PERIOD
 
 /**********************
  *      TYPEDEFS
@@ -54,7 +53,7 @@ static lv_obj_t * create_spectrum_obj(lv_obj_t * parent);
 static lv_obj_t * create_ctrl_box(lv_obj_t * parent);
 static lv_obj_t * create_handle(lv_obj_t * parent);
 
-static void spectrum_anim_cb(void * a, int32_t v);
+static void spectrum_timer_cb(lv_timer_t * t);
 static void start_anim_cb(void * var, int32_t v);
 static void del_counter_timer_cb(lv_event_t * e);
 static void spectrum_draw_event_cb(lv_event_t * e);
@@ -82,10 +81,9 @@ static lv_obj_t * genre_label;
 static lv_obj_t * time_obj;
 static lv_obj_t * album_image_obj;
 static lv_obj_t * slider_obj;
-static uint32_t spectrum_i = 0;
-static uint32_t spectrum_i_pause = 0;
-static uint32_t bar_ofs = 0;
-static uint32_t bar_rot = 0;
+static uint8_t spectrum_levels[BAR_CNT];    /*Live band levels from audio_spectrum, 0..255*/
+static uint32_t spectrum_seq;
+static lv_timer_t  * spectrum_timer;
 static uint32_t time_act;
 static lv_timer_t  * stop_start_anim_timer;
 static lv_timer_t  * sec_counter_timer;
@@ -95,8 +93,6 @@ static uint32_t track_id;
 static bool start_anim;
 static int32_t start_anim_values[40];
 static lv_obj_t * play_obj;
-static const uint16_t (* spectrum)[4];
-static uint32_t spectrum_len;
 static const uint16_t rnd_array[30] = {994, 285, 553, 11, 792, 707, 966, 641, 852, 827, 44, 352, 146, 581, 490, 80, 729, 58, 695, 940, 724, 561, 124, 653, 27, 292, 557, 506, 382, 199};
 
 
@@ -192,6 +188,11 @@ lv_obj_t * lv_demo_music_main_create(lv_obj_t * parent)
     sec_counter_timer = lv_timer_create(timer_cb, 1000, NULL);
     lv_timer_pause(sec_counter_timer);
 
+    /*Live spectrum of the music output, one band per bar*/
+    audio_spectrum_start(BAR_CNT);
+    spectrum_seq = 0;
+    spectrum_timer = lv_timer_create(spectrum_timer_cb, SPECTRUM_POLL_MS, NULL);
+
     /*Animate in the content after the intro time*/
     lv_anim_t a;
 
@@ -297,16 +298,7 @@ void lv_demo_music_play(uint32_t id)
 void lv_demo_music_resume(void)
 {
  
-    spectrum_i = spectrum_i_pause;
-    // lv_anim_t a;
-    // lv_anim_init(&a);
-    // lv_anim_set_values(&a, spectrum_i, spectrum_len - 1);
-    // lv_anim_set_exec_cb(&a, spectrum_anim_cb);
-    // lv_anim_set_var(&a, spectrum_obj);
-    // lv_anim_set_duration(&a, ((spectrum_len - spectrum_i) * 1000) / 30);
-    // lv_anim_set_reverse_duration(&a, 0);
-    // lv_anim_set_completed_cb(&a, spectrum_end_cb);
-    // lv_anim_start(&a);
+    /*The bars follow the live spectrum, they start moving with the audio*/
 
     if(sec_counter_timer) lv_timer_resume(sec_counter_timer);
     lv_slider_set_range(slider_obj, 0, lvgl_music_get_track_length(track_id));
@@ -333,10 +325,7 @@ void lv_demo_music_resume(void)
 void lv_demo_music_pause(void)
 {
 
-    spectrum_i_pause = spectrum_i;
-    spectrum_i = 0;
-    //lv_anim_delete(spectrum_obj, spectrum_anim_cb);
-    //lv_obj_invalidate(spectrum_obj);
+    /*The bars decay to rest on their own once the audio stops*/
     //lv_image_set_scale(album_image_obj, LV_SCALE_NONE);
     //if(sec_counter_timer) lv_timer_pause(sec_counter_timer);
     lv_obj_remove_state(play_obj, LV_STATE_CHECKED);
@@ -676,9 +665,7 @@ static lv_obj_t * create_handle(lv_obj_t * parent)
 
 static void track_load(uint32_t id)
 {
-    spectrum_i = 0;
     time_act = 0;
-    spectrum_i_pause = 0;
     lv_slider_set_value(slider_obj, 0, LV_ANIM_OFF);
     lv_label_set_text(time_obj, "0:00");
 
@@ -811,58 +798,18 @@ static void spectrum_draw_event_cb(lv_event_t * e)
         lv_draw_triangle_dsc_init(&draw_dsc);
         draw_dsc.bg_opa = LV_OPA_COVER;
 
-        uint16_t r[64];
         uint32_t i;
-
-        for(i = 0; i < BAR_CNT; i++) {
-            r[i] = BAR_REST_RADIUS;
-        }
-
-        uint32_t s;
-        for(s = 0; s < 4; s++) {
-            uint32_t f;
-            uint32_t band_w = 0;    /*Real number of bars in this band.*/
-            switch(s) {
-                case 0:
-                    band_w = 20;
-                    break;
-                case 1:
-                    band_w = 8;
-                    break;
-                case 2:
-                    band_w = 4;
-                    break;
-                case 3:
-                    band_w = 2;
-                    break;
-            }
-
-            /* Add "side bars" with cosine characteristic.*/
-            for(f = 0; f < band_w; f++) {
-                uint32_t ampl_main = spectrum[spectrum_i][s];
-                int32_t ampl_mod = get_cos(f * 360 / band_w + 180, 180) + 180;
-                int32_t t = BAR_PER_BAND_CNT * s - band_w / 2 + f;
-                if(t < 0) t = BAR_CNT + t;
-                if(t >= BAR_CNT) t = t - BAR_CNT;
-                r[t] += (ampl_main * ampl_mod) >> 9;
-            }
-        }
-
-        const int32_t amax = 20;
-        int32_t animv = spectrum_i - 0;
-        if(animv > amax) animv = amax;
         for(i = 0; i < BAR_CNT; i++) {
             uint32_t deg_space = 1;
             uint32_t deg = i * DEG_STEP + 90;
-            uint32_t j = (i + bar_rot + rnd_array[bar_ofs % 10]) % BAR_CNT;
-            uint32_t k = (i + bar_rot + rnd_array[(bar_ofs + 1) % 10]) % BAR_CNT;
 
+            /*Bar i shows band i (bass at the bottom), mirrored on both sides*/
             uint32_t v;
             if(start_anim) {
                 v = BAR_REST_RADIUS + start_anim_values[i];
             }
             else {
-                v = (r[k] * animv + r[j] * (amax - animv)) / amax;
+                v = BAR_REST_RADIUS + ((spectrum_levels[i] * BAR_AMPL_MAX) >> 8);
             }
 
             if(v < BAR_COLOR1_STOP) draw_dsc.bg_color = BAR_COLOR1;
@@ -897,38 +844,29 @@ static void spectrum_draw_event_cb(lv_event_t * e)
     }
     else if(code == LV_EVENT_DELETE) {
         lv_anim_delete(NULL, start_anim_cb);
-        lv_anim_delete(NULL, spectrum_anim_cb);
+        if(spectrum_timer) {
+            lv_timer_delete(spectrum_timer);
+            spectrum_timer = NULL;
+        }
+        audio_spectrum_stop();
         if(start_anim && stop_start_anim_timer) lv_timer_delete(stop_start_anim_timer);
     }
 }
 
-static void spectrum_anim_cb(void * a, int32_t v)
+static void spectrum_timer_cb(lv_timer_t * t)
 {
-    lv_obj_t * obj = a;
-    if(start_anim) {
-        lv_obj_invalidate(obj);
-        return;
-    }
+    LV_UNUSED(t);
+    if(start_anim) return;
 
-    spectrum_i = v;
-    lv_obj_invalidate(obj);
-
-    static uint32_t bass_cnt = 0;
-    static int32_t last_bass = -1000;
-    static int32_t dir = 1;
-    if(spectrum[spectrum_i][0] > 12) {
-        if(spectrum_i - last_bass > 5) {
-            bass_cnt++;
-            last_bass = spectrum_i;
-            if(bass_cnt >= 2) {
-                bass_cnt = 0;
-                bar_ofs++;
-            }
-        }
-    }
-    if(spectrum[spectrum_i][0] < 4) bar_rot += dir;
+    uint32_t seq = audio_spectrum_read(spectrum_levels, BAR_CNT);
+    if(seq == spectrum_seq) return;     /*Nothing new, skip the redraw*/
+    spectrum_seq = seq;
+
+    lv_obj_invalidate(spectrum_obj);
 
-    lv_image_set_scale(album_image_obj, LV_SCALE_NONE + spectrum[spectrum_i][0]);
+    /*Pulse the cover with the two lowest bands*/
+    uint32_t bass = (spectrum_levels[0] + spectrum_levels[1]) / 2;
+    lv_image_set_scale(album_image_obj, LV_SCALE_NONE + (bass >> 3));
 }
 
 static void start_anim_cb(void * var, int32_t v)
@@ -950,18 +888,12 @@ static lv_obj_t * album_image_create(lv_obj_t * parent)
     switch(track_id) {
         case 2:
             lv_image_set_src(img, &img_lv_demo_music_cover_3);
-            spectrum = spectrum_3;
-            spectrum_len = sizeof(spectrum_3) / sizeof(spectrum_3[0]);
             break;
         case 1:
             lv_image_set_src(img, &img_lv_demo_music_cover_2);
-            spectrum = spectrum_2;
-            spectrum_len = sizeof(spectrum_2) / sizeof(spectrum_2[0]);
             break;
         case 0:
             lv_image_set_src(img, &img_lv_demo_music_cover_1);
-            spectrum = spectrum_1;
-            spectrum_len = sizeof(spectrum_1) / sizeof(spectrum_1[0]);
             break;
     }
     lv_image_set_antialias(img, false);
@@ -4,23 +4,27 @@
  *
  * This application provides audio recording functionality:
  * - Record audio from I2S microphone
- * - Save as WAV file to SD card
+ * - Stream it as a WAV file to SD card (audio_recorder)
  * - Automatic playback after recording completes
  *
  * Recording Parameters:
- * - Format: PCM WAV
- * - Sample rate: 16kHz
- * - Bit depth: 32-bit
- * - Channels: Stereo (2)
- * - Duration: 5 seconds
+ * - Capture: 16kHz, 32-bit stereo from the ES7210
+ * - Stored: 16-bit mono PCM WAV (both microphones mixed, 32 KB/s)
+ * - Duration: until "stop" is pressed (capped at EXAMPLE_RECORD_MAX_SEC)
+ * - Pre-roll: the EXAMPLE_RECORD_PREROLL_MS before "start rec" is included
+ *   (captured to RAM while the app is open, paused in power save)
  * - Output: /sdcard/Recordings/RECORD.WAV
  *
- * The recording runs in a separate FreeRTOS task to avoid blocking the UI.
+ * Capture and SD writes run in the recorder's own tasks; a small UI task
+ * here only shows progress and stops the recording. Closing the app asks
+ * that task to exit and waits for it, so the recording is always collected
+ * by the task that started it.
  */
 
 #include "lvgl_app_rec.hpp"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "lvgl.h"
 #include "esp_brookesia.hpp"
 #include "private/esp_brookesia_utils.h"
@@ -28,6 +32,8 @@
 #include "app_rec.h"
 #include "bsp_board.h"
 #include "audio_driver.h"
+#include "audio_recorder.h"
+#include "power_manager.h"
 #include <sys/stat.h>
 
 static const char *TAG = "app_rec";
@@ -44,72 +50,16 @@ static const char *TAG = "app_rec";
 #define EXAMPLE_I2S_TDM_SLOT_MASK  (I2S_TDM_SLOT0 | I2S_TDM_SLOT1 | I2S_TDM_SLOT2 | I2S_TDM_SLOT3)
 
 /* SD card and recording output configuration */
-#define EXAMPLE_RECORD_TIME_SEC    (5)              /**< Recording duration in seconds */
+#define EXAMPLE_RECORD_FORMAT      (AUDIO_RECORDER_FORMAT_PCM16_MONO)  /**< Stored format (4x less SD traffic) */
+#define EXAMPLE_RECORD_MAX_SEC     (600)            /**< Safety cap on recording length */
+#define EXAMPLE_RECORD_POLL_MS     (200)            /**< Progress label refresh period */
+#define EXAMPLE_RECORD_PREROLL_MS  (1000)           /**< Audio kept from before the tap */
+#define EXAMPLE_RECORD_JOIN_MS     (6000)           /**< Task exit budget on close (recorder flush included) */
+#define EXAMPLE_UI_LOCK_MS         (50)             /**< LVGL lock wait for a progress update */
 #define EXAMPLE_SD_MOUNT_POINT     "/sdcard"        /**< SD card mount point */
 #define EXAMPLE_RECORDINGS_DIR     "/Recordings"    /**< Recordings directory */
 #define EXAMPLE_RECORD_FILE_PATH   "/Recordings/RECORD.WAV"  /**< Output file path */
 
-/*===========================================================================
- * WAV File Format Structures
- *===========================================================================*/
-
-/**
- * @brief WAV file header structure
- *
- * Standard PCM WAV header with RIFF descriptor, format chunk, and data chunk.
- * Used to write proper WAV files that can be played by standard audio software.
- */
-typedef struct {
-    struct {
-        char chunk_id[4];       /**< "RIFF" in ASCII */
-        uint32_t chunk_size;    /**< Size of file minus 8 bytes */
-        char chunk_format[4];   /**< "WAVE" in ASCII */
-    } descriptor_chunk;         /**< RIFF header */
-    struct {
-        char subchunk_id[4];    /**< "fmt " in ASCII (note the space) */
-        uint32_t subchunk_size; /**< Size of fmt chunk (16 for PCM) */
-        uint16_t audio_format;  /**< Audio format (1 = PCM) */
-        uint16_t num_of_channels; /**< Number of channels (1=mono, 2=stereo) */
-        uint32_t sample_rate;   /**< Sample rate (e.g., 16000) */
-        uint32_t byte_rate;     /**< Bytes per second */
-        uint16_t block_align;   /**< Bytes per sample frame */
-        uint16_t bits_per_sample; /**< Bits per sample (8, 16, 32) */
-    } fmt_chunk;                /**< Format specification chunk */
-    struct {
-        char subchunk_id[4];    /**< "data" in ASCII */
-        uint32_t subchunk_size; /**< Size of audio data */
-        int16_t data[0];        /**< Audio samples (flexible array) */
-    } data_chunk;               /**< Audio data chunk */
-} wav_header_t;
-
-/**
- * @brief Default header for PCM format WAV files
- *
- */
-#define WAV_HEADER_PCM_DEFAULT(wav_sample_size, wav_sample_bits, wav_sample_rate, wav_channel_num) { \
-    .descriptor_chunk = { \
-        .chunk_id = {'R', 'I', 'F', 'F'}, \
-        .chunk_size = (wav_sample_size) + sizeof(wav_header_t) - 8, \
-        .chunk_format = {'W', 'A', 'V', 'E'} \
-    }, \
-    .fmt_chunk = { \
-        .subchunk_id = {'f', 'm', 't', ' '}, \
-        .subchunk_size = 16, /* 16 for PCM */ \
-        .audio_format = 1, /* 1 for PCM */ \
-        .num_of_channels = (wav_channel_num), \
-        .sample_rate = (wav_sample_rate), \
-        .byte_rate = (wav_sample_bits) * (wav_sample_rate) * (wav_channel_num) / 8, \
-        .block_align = (wav_sample_bits) * (wav_channel_num) / 8, \
-        .bits_per_sample = (wav_sample_bits)\
-    }, \
-    .data_chunk = { \
-        .subchunk_id = {'d', 'a', 't', 'a'}, \
-        .subchunk_size = (wav_sample_size) \
-    } \
-}
-
-
-
 using namespace std;
 using namespace esp_brookesia::gui;
 
@@ -119,12 +69,14 @@ using namespace esp_brookesia::gui;
 
 static lv_timer_t * auto_step_timer = NULL; /**< Unused timer (reserved) */
 static lv_obj_t *labels[8];                 /**< Unused label array (reserved) */
-static bsp_handles_t *handles;              /**< BSP handles for I2S access */
 static void example1_increase_lvgl_tick(lv_timer_t * t);
 static lv_obj_t * btn1;                     /**< Start recording button */
-static TaskHandle_t task_handle = NULL;     /**< Recording task handle */
+static TaskHandle_t task_handle = NULL;     /**< Recording task, until joined */
+static SemaphoreHandle_t task_done = NULL;  /**< Given by the recording task as it exits */
 static lv_obj_t * msg_content_label = NULL; /**< Recording progress label */
 static lv_obj_t * rec_msg;                  /**< Recording message box */
+static volatile bool rec_stop_req = false;  /**< Set by the stop/close buttons */
+static volatile bool rec_exit_req = false;  /**< Set when the app closes: no playback, exit */
 
 /*===========================================================================
  * Constructors/Destructor
@@ -163,27 +115,53 @@ PhoneRecConf::~PhoneRecConf()
  *===========================================================================*/
 
 /**
- * @brief Record audio to WAV file on SD card
+ * @brief Take the shared SPI bus for SD access (bulk file I/O class)
  *
- * Records audio from I2S microphone for EXAMPLE_RECORD_TIME_SEC seconds
- * and saves as WAV file. Shows progress in UI and plays back after completion.
- *
- * @param i2s_rx_chan I2S receive channel handle
- * @return ESP_OK on success
+ * The arbiter bounds each wait; the recorder cannot drop data, so it keeps
+ * retrying and just logs when the display or audio hold the bus for long.
  */
-static esp_err_t record_wav(i2s_chan_handle_t i2s_rx_chan)
+static void rec_bus_acquire(void)
 {
-    esp_err_t ret = ESP_OK;
-    ESP_RETURN_ON_FALSE(i2s_rx_chan, ESP_FAIL, TAG, "invalid i2s channel handle pointer");
-    
+    while (bsp_spi_bus_acquire(BSP_SPI_CLIENT_FILE, BSP_SPI_BUS_WAIT_DEFAULT) != ESP_OK) {
+        ESP_LOGW(TAG, "SPI bus busy, retrying");
+    }
+}
 
-    uint32_t byte_rate = EXAMPLE_I2S_SAMPLE_RATE * EXAMPLE_I2S_CHAN_NUM * EXAMPLE_I2S_SAMPLE_BITS / 8;
-    uint32_t wav_size = byte_rate * EXAMPLE_RECORD_TIME_SEC;
+/**
+ * @brief Recording format shared by the pre-roll and the recordings
+ */
+static audio_recorder_config_t rec_config(void)
+{
+    audio_recorder_config_t cfg = AUDIO_RECORDER_DEFAULT_CONFIG(EXAMPLE_SD_MOUNT_POINT EXAMPLE_RECORD_FILE_PATH);
+    cfg.sample_rate = EXAMPLE_I2S_SAMPLE_RATE;
+    cfg.channels = EXAMPLE_I2S_CHAN_NUM;
+    cfg.bits_per_sample = EXAMPLE_I2S_SAMPLE_BITS;
+    cfg.max_duration_ms = EXAMPLE_RECORD_MAX_SEC * 1000;
+    cfg.format = EXAMPLE_RECORD_FORMAT;
+    cfg.mono_source = AUDIO_RECORDER_MONO_MIX;
+    return cfg;
+}
 
-    const wav_header_t wav_header =
-        WAV_HEADER_PCM_DEFAULT(wav_size, EXAMPLE_I2S_SAMPLE_BITS, EXAMPLE_I2S_SAMPLE_RATE, EXAMPLE_I2S_CHAN_NUM);
+/**
+ * @brief Pause the pre-roll capture while the screen is off or asleep
+ */
+static void rec_power_state_cb(power_state_t old_state, power_state_t new_state)
+{
+    audio_recorder_preroll_suspend(new_state != POWER_STATE_ACTIVE);
+}
 
-    lvgl_port_lock(0);
+/**
+ * @brief Record audio to WAV file on SD card
+ *
+ * Starts the streaming recorder and shows its progress until the user
+ * presses stop (or EXAMPLE_RECORD_MAX_SEC is reached), then closes the
+ * file and plays it back.
+ *
+ * @return ESP_OK on success
+ */
+static esp_err_t record_wav(void)
+{
+    rec_bus_acquire();
 
     /* Create Recordings directory if it doesn't exist */
     struct stat st;
@@ -191,65 +169,99 @@ static esp_err_t record_wav(i2s_chan_handle_t i2s_rx_chan)
         ESP_LOGI(TAG, "Creating directory %s", EXAMPLE_RECORDINGS_DIR);
         mkdir(EXAMPLE_SD_MOUNT_POINT EXAMPLE_RECORDINGS_DIR, 0755);
     }
+    bsp_spi_bus_release(BSP_SPI_CLIENT_FILE);
+
+    audio_recorder_config_t cfg = rec_config();
 
     ESP_LOGI(TAG, "Opening file %s", EXAMPLE_RECORD_FILE_PATH);
-    FILE *f = fopen(EXAMPLE_SD_MOUNT_POINT EXAMPLE_RECORD_FILE_PATH, "w");
-    ESP_RETURN_ON_FALSE(f, ESP_FAIL, TAG, "error while opening wav file");
-
-    /* Write wav header */
-    fwrite(&wav_header, sizeof(wav_header_t), 1, f);
-    lvgl_port_unlock();
-
-    /* Start recording */
-    size_t wav_written = 0;
-    static int16_t i2s_readraw_buff[4096];
-
-    i2s_channel_enable(i2s_rx_chan);
-    while (wav_written < wav_size) {
-        if (wav_written % byte_rate < sizeof(i2s_readraw_buff)) {
-            lvgl_port_lock(0);
-            lv_label_set_text_fmt(msg_content_label,"Recording: %"PRIu32"/%ds",wav_written / byte_rate + 1, (int)EXAMPLE_RECORD_TIME_SEC);
+    esp_err_t ret = audio_recorder_start(&cfg);
+    ESP_RETURN_ON_ERROR(ret, TAG, "error while starting recorder");
+
+    audio_recorder_stats_t stats;
+    while (!rec_stop_req && audio_recorder_is_recording()) {
+        audio_recorder_get_stats(&stats);
+        /* Bounded wait: close() holds the LVGL lock while it joins this task */
+        if (!rec_exit_req && lvgl_port_lock(EXAMPLE_UI_LOCK_MS)) {
+            if (msg_content_label != NULL) {
+                lv_label_set_text_fmt(msg_content_label, "Recording: %"PRIu32"s\nDropped: %"PRIu32,
+                                      stats.duration_ms / 1000, stats.dropped_frames);
+            }
             lvgl_port_unlock();
-            //ESP_LOGI(TAG, "Recording: %"PRIu32"/%ds", wav_written / byte_rate + 1, (int)EXAMPLE_RECORD_TIME_SEC);
         }
-        size_t bytes_read = 0;
-        /* Read RAW samples from ES7210 */
-        i2s_channel_read(i2s_rx_chan, i2s_readraw_buff, sizeof(i2s_readraw_buff), &bytes_read,pdMS_TO_TICKS(1000));
-        /* Write the samples to the WAV file */
-        lvgl_port_lock(0);
-        fwrite(i2s_readraw_buff, bytes_read, 1, f);
-        lvgl_port_unlock();
-        wav_written += bytes_read;
+        vTaskDelay(pdMS_TO_TICKS(EXAMPLE_RECORD_POLL_MS));
     }
 
-    
-
-    
-    lvgl_port_lock(0);
-    fclose(f);
-    lvgl_port_unlock();
+    ret = audio_recorder_stop();
+    audio_recorder_get_stats(&stats);
+    ESP_LOGI(TAG, "Recorded %"PRIu32" ms (%"PRIu32" ms pre-roll, started in %"PRIu32" us: %s), "
+             "%"PRIu32" dropped frames (%"PRIu32" ring drops, %"PRIu32" DMA overflows), "
+             "%"PRIu32" writes, max write %"PRIu32" us, max ring level %"PRIu32"/%"PRIu32,
+             stats.duration_ms, stats.preroll_ms, stats.start_latency_us,
+             stats.start_late ? "FAIL" : "pass",
+             stats.dropped_frames, stats.ring_drops, stats.dma_overflows,
+             stats.block_writes, stats.max_write_us, stats.max_level_bytes, stats.capacity_bytes);
+    ESP_RETURN_ON_ERROR(ret, TAG, "error while closing wav file");
+
+    if (rec_exit_req) {
+        return ESP_OK;      /* App closing: audio is being shut down */
+    }
     Audio_Play_Music("file:///sdcard/Recordings/RECORD.WAV");
-    
-    //Audio_Play_Music("file://sdcard/1.wav");
 
-    return ret;
+    return ESP_OK;
 }
 
 
 /**
  * @brief Recording task function (FreeRTOS task)
  *
- * Runs in background to avoid blocking UI during recording.
+ * Runs in background to avoid blocking UI during recording. Signals
+ * task_done as its last action; whoever takes it owns task_handle again.
  *
  * @param arg Unused task argument
  */
 static void rec_test_task(void *arg)
 {
-    record_wav(handles->i2s_rx_handle);
-    task_handle = NULL;
+    record_wav();
+    xSemaphoreGive(task_done);
     vTaskDelete(NULL);
 }
 
+/**
+ * @brief Wait for the recording task to exit
+ *
+ * @param wait_ms How long to wait
+ * @return true if no task is left running
+ */
+static bool rec_task_join(uint32_t wait_ms)
+{
+    if (task_handle == NULL) {
+        return true;
+    }
+    if (xSemaphoreTake(task_done, pdMS_TO_TICKS(wait_ms)) != pdTRUE) {
+        return false;
+    }
+    task_handle = NULL;
+    return true;
+}
+
+/**
+ * @brief Stop/close button handler of the recording message box
+ *
+ * Asks the recording task to finish. The close button also deletes the
+ * message box, so the progress label is forgotten here (LVGL context).
+ *
+ * @param e LVGL event
+ */
+static void rec_stop_event_handler(lv_event_t * e)
+{
+    if (lv_event_get_code(e) == LV_EVENT_CLICKED) {
+        rec_stop_req = true;
+        if (lv_event_get_user_data(e) != NULL) {
+            msg_content_label = NULL;
+        }
+    }
+}
+
 /**
  * @brief Create and show recording progress message box
  *
@@ -257,6 +269,10 @@ static void rec_test_task(void *arg)
  */
 static void lv_create_wifi_msgbox(void)
 {
+    if (!rec_task_join(0)) {
+        return;     /* The previous recording is still being closed */
+    }
+
     rec_msg = lv_msgbox_create(NULL);
     lv_obj_set_style_clip_corner(rec_msg, true, 0);
 
@@ -266,6 +282,9 @@ static void lv_create_wifi_msgbox(void)
     lv_obj_set_size(rec_msg, 200, 200);
 
     lv_obj_t * exit_but = lv_msgbox_add_close_button(rec_msg);
+    lv_obj_add_event_cb(exit_but, rec_stop_event_handler, LV_EVENT_CLICKED, exit_but);
+    lv_obj_t * stop_but = lv_msgbox_add_footer_button(rec_msg, "stop");
+    lv_obj_add_event_cb(stop_but, rec_stop_event_handler, LV_EVENT_CLICKED, NULL);
 
     /* setting's content*/
     lv_obj_t * content = lv_msgbox_get_content(rec_msg);
@@ -276,7 +295,12 @@ static void lv_create_wifi_msgbox(void)
     msg_content_label = lv_label_create(content);
     lv_label_set_text(msg_content_label, "Recording");
     lv_obj_center(msg_content_label);
-    xTaskCreate(rec_test_task, "rec_test_task", 1024 * 6, NULL, 4, &task_handle);
+    rec_stop_req = false;
+    rec_exit_req = false;
+    if (xTaskCreate(rec_test_task, "rec_test_task", 1024 * 4, NULL, 4, &task_handle) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create recording task");
+        task_handle = NULL;
+    }
 }
 
 /**
@@ -380,8 +404,18 @@ bool PhoneRecConf::run(void)
     /* Initialize audio for playback after recording */
     Audio_Play_Init();
 
-    /* Get BSP handles for I2S access */
-    handles = bsp_display_get_handles();
+    if (task_done == NULL) {
+        task_done = xSemaphoreCreateBinary();
+        ESP_BROOKESIA_CHECK_NULL_RETURN(task_done, false, "Create task semaphore failed");
+    }
+
+    /* Capture into RAM from now on, so a recording includes the moment
+     * before the tap; paused while the screen is off */
+    audio_recorder_config_t cfg = rec_config();
+    if (audio_recorder_preroll_enable(&cfg, EXAMPLE_RECORD_PREROLL_MS) != ESP_OK) {
+        ESP_LOGW(TAG, "Pre-roll unavailable, recordings start at the tap");
+    }
+    power_manager_register_callback(rec_power_state_cb);
 
     /* Create recording button UI */
     lv_example_rec();
@@ -422,11 +456,16 @@ bool PhoneRecConf::close(void)
     lv_obj_remove_event_cb(btn1, event_handler);
     btn1 = NULL;
 
-    /* Stop recording task if still running */
-    if (task_handle != NULL) {
-        vTaskDelete(task_handle);
-        task_handle = NULL;
+    /* Ask the recording task to close the WAV file and exit, then wait */
+    rec_stop_req = true;
+    rec_exit_req = true;
+    msg_content_label = NULL;
+    if (!rec_task_join(EXAMPLE_RECORD_JOIN_MS)) {
+        ESP_LOGE(TAG, "Recording task did not exit");
     }
+    audio_recorder_stop();      /* No-op once the task has collected the recording */
+    power_manager_register_callback(NULL);
+    audio_recorder_preroll_disable();
 
     /* Notify core and cleanup audio */
     ESP_BROOKESIA_CHECK_FALSE_RETURN(notifyCoreClosed(), false, "Notify core closed failed");
@@ -0,0 +1,488 @@
+/**
+ * @file audio_adpcm.c
+ * @brief IMA-ADPCM streaming decoder and encoder
+ *
+ * Standard IMA/DVI step tables. Decoding touches only the encoded bytes
+ * and a few words of state, so it runs directly from flash. The encoder
+ * reconstructs every sample with the decoder's own step function, so both
+ * sides track the same predictor.
+ */
+
+#include "audio_adpcm.h"
+#include "esp_log.h"
+#include "sdkconfig.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if CONFIG_APP_SELF_TEST
+#include "audio_resampler.h"
+#include "esp_audio_simple_dec.h"
+#if CONFIG_IDF_TARGET_LINUX
+#include <time.h>
+#else
+#include "esp_cpu.h"
+#endif
+#endif
+
+static const int16_t s_step_table[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int8_t s_index_table[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+/**
+ * @brief Apply one 4-bit code to a predictor / step index pair
+ */
+static inline int16_t expand_nibble(int32_t *predictor, int32_t *step_index, uint8_t code)
+{
+    int32_t step = s_step_table[*step_index];
+    int32_t diff = step >> 3;
+    if (code & 4) diff += step;
+    if (code & 2) diff += step >> 1;
+    if (code & 1) diff += step >> 2;
+
+    int32_t pred = *predictor + ((code & 8) ? -diff : diff);
+    if (pred > INT16_MAX) pred = INT16_MAX;
+    if (pred < INT16_MIN) pred = INT16_MIN;
+    *predictor = pred;
+
+    int32_t idx = *step_index + s_index_table[code];
+    if (idx < 0) idx = 0;
+    if (idx > 88) idx = 88;
+    *step_index = idx;
+
+    return (int16_t)pred;
+}
+
+/**
+ * @brief Expand one 4-bit code
+ */
+static inline int16_t decode_nibble(audio_adpcm_decoder_t *dec, uint8_t code)
+{
+    return expand_nibble(&dec->predictor, &dec->step_index, code);
+}
+
+/**
+ * @brief Quantize one sample against the current predictor
+ */
+static inline uint8_t encode_nibble(audio_adpcm_encoder_t *enc, int16_t sample)
+{
+    int32_t step = s_step_table[enc->step_index];
+    int32_t diff = sample - enc->predictor;
+    uint8_t code = 0;
+
+    if (diff < 0) {
+        code = 8;
+        diff = -diff;
+    }
+    if (diff >= step) {
+        code |= 4;
+        diff -= step;
+    }
+    step >>= 1;
+    if (diff >= step) {
+        code |= 2;
+        diff -= step;
+    }
+    step >>= 1;
+    if (diff >= step) {
+        code |= 1;
+    }
+
+    expand_nibble(&enc->predictor, &enc->step_index, code);
+    return code;
+}
+
+void audio_adpcm_decoder_init(audio_adpcm_decoder_t *dec, const audio_adpcm_clip_t *clip)
+{
+    dec->clip = clip;
+    dec->block_samples = (uint16_t)AUDIO_ADPCM_BLOCK_SAMPLES(clip->block_align);
+    audio_adpcm_decoder_rewind(dec);
+}
+
+void audio_adpcm_decoder_rewind(audio_adpcm_decoder_t *dec)
+{
+    dec->sample = 0;
+    dec->block_off = 0;
+    dec->in_block = 0;
+    dec->predictor = 0;
+    dec->step_index = 0;
+}
+
+size_t audio_adpcm_decode(audio_adpcm_decoder_t *dec, int16_t *out, size_t max_samples)
+{
+    const audio_adpcm_clip_t *clip = dec->clip;
+    size_t n = 0;
+
+    while (n < max_samples && dec->sample < clip->samples) {
+        if (dec->in_block == dec->block_samples) {
+            dec->block_off += clip->block_align;
+            dec->in_block = 0;
+        }
+        if (dec->block_off + AUDIO_ADPCM_BLOCK_HEADER > clip->data_len) {
+            break;  /* Truncated clip */
+        }
+
+        const uint8_t *blk = &clip->data[dec->block_off];
+
+        if (dec->in_block == 0) {
+            /* Block header resynchronises the predictor */
+            dec->predictor = (int16_t)(blk[0] | (blk[1] << 8));
+            dec->step_index = blk[2] > 88 ? 88 : blk[2];
+            out[n++] = (int16_t)dec->predictor;
+            dec->in_block = 1;
+            dec->sample++;
+            continue;
+        }
+
+        /* Codes for samples 1.. of the block, two per byte, low nibble first */
+        const uint8_t *codes = blk + AUDIO_ADPCM_BLOCK_HEADER;
+        while (n < max_samples && dec->in_block < dec->block_samples &&
+               dec->sample < clip->samples) {
+            unsigned k = dec->in_block - 1;
+            size_t byte = dec->block_off + AUDIO_ADPCM_BLOCK_HEADER + (k >> 1);
+            if (byte >= clip->data_len) {
+                return n;   /* Truncated clip */
+            }
+            uint8_t b = codes[k >> 1];
+            out[n++] = decode_nibble(dec, (k & 1) ? (b >> 4) : (b & 0x0F));
+            dec->in_block++;
+            dec->sample++;
+        }
+    }
+    return n;
+}
+
+void audio_adpcm_encoder_init(audio_adpcm_encoder_t *enc, uint16_t block_align)
+{
+    if (block_align > AUDIO_ADPCM_MAX_BLOCK_ALIGN) {
+        block_align = AUDIO_ADPCM_MAX_BLOCK_ALIGN;
+    }
+    if (block_align <= AUDIO_ADPCM_BLOCK_HEADER) {
+        block_align = AUDIO_ADPCM_BLOCK_HEADER + 1;
+    }
+    enc->block_align = block_align;
+    enc->block_samples = (uint16_t)AUDIO_ADPCM_BLOCK_SAMPLES(block_align);
+    enc->in_block = 0;
+    enc->predictor = 0;
+    enc->step_index = 0;
+}
+
+const uint8_t *audio_adpcm_encode_block(audio_adpcm_encoder_t *enc, const int16_t *in,
+                                        size_t samples, size_t *consumed)
+{
+    size_t n = 0;
+
+    while (n < samples) {
+        if (enc->in_block == 0) {
+            /* First sample goes into the header verbatim; the step index
+             * carries over from the previous block */
+            enc->predictor = in[n];
+            enc->block[0] = (uint8_t)(in[n] & 0xFF);
+            enc->block[1] = (uint8_t)((uint16_t)in[n] >> 8);
+            enc->block[2] = (uint8_t)enc->step_index;
+            enc->block[3] = 0;
+            enc->in_block = 1;
+            n++;
+        } else {
+            /* Codes for samples 1.., two per byte, low nibble first */
+            uint8_t *codes = enc->block + AUDIO_ADPCM_BLOCK_HEADER;
+            while (n < samples && enc->in_block < enc->block_samples) {
+                unsigned k = enc->in_block - 1;
+                uint8_t code = encode_nibble(enc, in[n++]);
+                if (k & 1) {
+                    codes[k >> 1] |= (uint8_t)(code << 4);
+                } else {
+                    codes[k >> 1] = code;
+                }
+                enc->in_block++;
+            }
+        }
+
+        if (enc->in_block == enc->block_samples) {
+            enc->in_block = 0;
+            *consumed = n;
+            return enc->block;
+        }
+    }
+
+    *consumed = n;
+    return NULL;
+}
+
+const uint8_t *audio_adpcm_encoder_flush(audio_adpcm_encoder_t *enc, size_t *samples)
+{
+    *samples = enc->in_block;
+    if (enc->in_block == 0) {
+        return NULL;
+    }
+
+    /* Zero the codes after the last sample (a pending low nibble already
+     * leaves its high half clear) */
+    size_t used = AUDIO_ADPCM_BLOCK_HEADER + enc->in_block / 2;
+    memset(enc->block + used, 0, enc->block_align - used);
+    enc->in_block = 0;
+    return enc->block;
+}
+
+#if CONFIG_APP_SELF_TEST
+/*===========================================================================
+ * Benchmark (CONFIG_APP_SELF_TEST)
+ *===========================================================================*/
+
+static const char *TAG = "audio adpcm";
+
+#define BENCH_RATE          16000   /**< Source rate of the embedded clips */
+#define BENCH_OUT_RATE      44100
+#define BENCH_SRC_SAMPLES   4096    /**< Test clip, looped */
+#define BENCH_BLOCK_ALIGN   256     /**< As tools/gen_adpcm_asset.py */
+#define BENCH_SLICE         64      /**< Samples per decode, as the mixer */
+#define BENCH_OUT_FRAMES    256     /**< Resampled frames per call, as the mixer */
+#define BENCH_MP3_OUT       4608    /**< Initial MP3 output buffer (one stereo frame) */
+
+static inline uint32_t bench_now(void)
+{
+#if CONFIG_IDF_TARGET_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+#else
+    return esp_cpu_get_cycle_count();
+#endif
+}
+
+/**
+ * @brief Encode @p pcm into a clip whose blocks live in one allocation
+ */
+static uint8_t *bench_encode(const int16_t *pcm, size_t samples, audio_adpcm_clip_t *clip)
+{
+    size_t block_samples = AUDIO_ADPCM_BLOCK_SAMPLES(BENCH_BLOCK_ALIGN);
+    size_t blocks = (samples + block_samples - 1) / block_samples;
+    uint8_t *data = malloc(blocks * BENCH_BLOCK_ALIGN);
+    if (data == NULL) {
+        return NULL;
+    }
+
+    audio_adpcm_encoder_t *enc = malloc(sizeof(*enc));
+    if (enc == NULL) {
+        free(data);
+        return NULL;
+    }
+    audio_adpcm_encoder_init(enc, BENCH_BLOCK_ALIGN);
+    size_t len = 0;
+    size_t pos = 0;
+    while (pos < samples) {
+        size_t used;
+        const uint8_t *block = audio_adpcm_encode_block(enc, &pcm[pos], samples - pos, &used);
+        pos += used;
+        if (block != NULL) {
+            memcpy(&data[len], block, BENCH_BLOCK_ALIGN);
+            len += BENCH_BLOCK_ALIGN;
+        }
+    }
+    size_t tail;
+    const uint8_t *block = audio_adpcm_encoder_flush(enc, &tail);
+    if (block != NULL) {
+        memcpy(&data[len], block, BENCH_BLOCK_ALIGN);
+        len += BENCH_BLOCK_ALIGN;
+    }
+    free(enc);
+
+    *clip = (audio_adpcm_clip_t){
+        .data = data,
+        .data_len = len,
+        .samples = samples,
+        .sample_rate = BENCH_RATE,
+        .block_align = BENCH_BLOCK_ALIGN,
+    };
+    return data;
+}
+
+/**
+ * @brief Next slice of the looped clip: decoded ADPCM, or straight PCM
+ */
+static size_t bench_source(audio_adpcm_decoder_t *dec, const int16_t *pcm, size_t *pos,
+                           int16_t *slice, const int16_t **src)
+{
+    if (dec != NULL) {
+        size_t n = audio_adpcm_decode(dec, slice, BENCH_SLICE);
+        if (n == 0) {
+            audio_adpcm_decoder_rewind(dec);
+            n = audio_adpcm_decode(dec, slice, BENCH_SLICE);
+        }
+        *src = slice;
+        return n;
+    }
+    if (*pos >= BENCH_SRC_SAMPLES) {
+        *pos = 0;
+    }
+    size_t n = BENCH_SRC_SAMPLES - *pos < BENCH_SLICE ? BENCH_SRC_SAMPLES - *pos : BENCH_SLICE;
+    *src = &pcm[*pos];
+    *pos += n;
+    return n;
+}
+
+/**
+ * @brief Produce @p frames 44.1 kHz frames the way a mixer voice does
+ */
+static void bench_voice(audio_adpcm_decoder_t *dec, const int16_t *pcm, int16_t *slice,
+                        int16_t *out, uint32_t frames)
+{
+    audio_resampler_t rs;
+    audio_resampler_init(&rs, BENCH_RATE, BENCH_OUT_RATE, 1);
+    size_t pos = 0;
+    const int16_t *src = NULL;
+    size_t avail = 0;
+    uint32_t done = 0;
+
+    while (done < frames) {
+        if (avail == 0) {
+            avail = bench_source(dec, pcm, &pos, slice, &src);
+        }
+        uint32_t want = frames - done < BENCH_OUT_FRAMES ? frames - done : BENCH_OUT_FRAMES;
+        size_t used = 0;
+        done += (uint32_t)audio_resampler_process(&rs, src, avail, &used, out, want);
+        src += used;
+        avail -= used;
+    }
+}
+
+/**
+ * @brief Decode an MP3 buffer once, returning the 16-bit samples produced
+ */
+static uint32_t bench_mp3(const uint8_t *mp3, size_t mp3_len, uint32_t *cost)
+{
+    esp_audio_simple_dec_cfg_t cfg = { .dec_type = ESP_AUDIO_SIMPLE_DEC_TYPE_MP3 };
+    esp_audio_simple_dec_handle_t dec = NULL;
+    uint32_t cap = BENCH_MP3_OUT;
+    uint8_t *buf = malloc(cap);
+    if (buf == NULL || esp_audio_simple_dec_open(&cfg, &dec) != ESP_AUDIO_ERR_OK) {
+        free(buf);
+        return 0;
+    }
+
+    esp_audio_simple_dec_raw_t raw = { .buffer = (uint8_t *)mp3, .len = mp3_len, .eos = true };
+    uint64_t bytes = 0;
+    uint32_t t0 = bench_now();
+    while (raw.len > 0) {
+        esp_audio_simple_dec_out_t frame = { .buffer = buf, .len = cap };
+        esp_audio_err_t ret = esp_audio_simple_dec_process(dec, &raw, &frame);
+        if (ret == ESP_AUDIO_ERR_BUFF_NOT_ENOUGH) {
+            uint8_t *bigger = realloc(buf, frame.needed_size);
+            if (bigger == NULL) {
+                break;
+            }
+            buf = bigger;
+            cap = frame.needed_size;
+            continue;
+        }
+        if (ret != ESP_AUDIO_ERR_OK || (raw.consumed == 0 && frame.decoded_size == 0)) {
+            break;
+        }
+        bytes += frame.decoded_size;
+        raw.buffer += raw.consumed;
+        raw.len -= raw.consumed;
+    }
+    *cost = bench_now() - t0;
+
+    esp_audio_simple_dec_close(dec);
+    free(buf);
+    return (uint32_t)(bytes / sizeof(int16_t));
+}
+
+esp_err_t audio_adpcm_benchmark(uint32_t samples, const uint8_t *mp3, size_t mp3_len,
+                                audio_adpcm_bench_t *bench)
+{
+    if (bench == NULL || samples == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(bench, 0, sizeof(*bench));
+
+    int16_t *pcm = malloc(BENCH_SRC_SAMPLES * sizeof(int16_t));
+    int16_t *slice = malloc(BENCH_SLICE * sizeof(int16_t));
+    int16_t *out = malloc(BENCH_OUT_FRAMES * sizeof(int16_t));
+    audio_adpcm_decoder_t *dec = malloc(sizeof(*dec));
+    audio_adpcm_clip_t clip;
+    uint8_t *data = NULL;
+    esp_err_t err = ESP_ERR_NO_MEM;
+    if (pcm == NULL || slice == NULL || out == NULL || dec == NULL) {
+        goto out;
+    }
+
+    /* Two tones plus noise: step sizes move like in real speech/effects */
+    uint32_t seed = 1;
+    for (int i = 0; i < BENCH_SRC_SAMPLES; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        int32_t tri = (i * 64) % 16384 - 8192;
+        int32_t sq = (i / 40) & 1 ? 6000 : -6000;
+        pcm[i] = (int16_t)(tri + sq + (int32_t)(seed >> 22) - 512);
+    }
+    data = bench_encode(pcm, BENCH_SRC_SAMPLES, &clip);
+    if (data == NULL) {
+        goto out;
+    }
+    audio_adpcm_decoder_init(dec, &clip);
+
+    /* Per source sample */
+    uint32_t t0 = bench_now();
+    for (uint32_t done = 0; done < samples;) {
+        const int16_t *src;
+        size_t pos = 0;
+        done += (uint32_t)bench_source(dec, NULL, &pos, slice, &src);
+    }
+    bench->adpcm_decode = (bench_now() - t0) / samples;
+
+    t0 = bench_now();
+    for (uint32_t done = 0; done < samples; done += BENCH_SLICE) {
+        size_t off = done % BENCH_SRC_SAMPLES;
+        size_t n = BENCH_SRC_SAMPLES - off < BENCH_SLICE ? BENCH_SRC_SAMPLES - off : BENCH_SLICE;
+        memcpy(slice, &pcm[off], n * sizeof(int16_t));
+    }
+    bench->pcm_copy = (bench_now() - t0) / samples;
+
+    /* Per output frame at 44.1 kHz */
+    uint32_t frames = (uint32_t)((uint64_t)samples * BENCH_OUT_RATE / BENCH_RATE);
+    audio_adpcm_decoder_rewind(dec);
+    t0 = bench_now();
+    bench_voice(dec, pcm, slice, out, frames);
+    bench->adpcm_voice = (bench_now() - t0) / frames;
+
+    t0 = bench_now();
+    bench_voice(NULL, pcm, slice, out, frames);
+    bench->pcm_voice = (bench_now() - t0) / frames;
+
+    if (mp3 != NULL && mp3_len > 0) {
+        uint32_t cost = 0;
+        uint32_t n = bench_mp3(mp3, mp3_len, &cost);
+        bench->mp3_decode = n > 0 ? cost / n : 0;
+    }
+
+    bench->flash_ratio_pct = (uint32_t)(clip.data_len * 100 / (BENCH_SRC_SAMPLES * sizeof(int16_t)));
+    err = ESP_OK;
+
+    ESP_LOGI(TAG, "Per sample: ADPCM decode %lu, PCM copy %lu, MP3 decode %lu; "
+             "per 44.1 kHz frame: ADPCM voice %lu, PCM voice %lu; size %lu%% of PCM",
+             (unsigned long)bench->adpcm_decode, (unsigned long)bench->pcm_copy,
+             (unsigned long)bench->mp3_decode, (unsigned long)bench->adpcm_voice,
+             (unsigned long)bench->pcm_voice, (unsigned long)bench->flash_ratio_pct);
+
+out:
+    free(data);
+    free(dec);
+    free(out);
+    free(slice);
+    free(pcm);
+    return err;
+}
+#endif /* CONFIG_APP_SELF_TEST */
@@ -0,0 +1,121 @@
+/**
+ * @file audio_backend.c
+ * @brief Output / capture backend selection
+ *
+ * The default backends come from Kconfig: the board codecs, or the host
+ * file backends when CONFIG_AUDIO_BACKEND_HOST is set (Linux builds).
+ */
+
+#include "audio_backend.h"
+#include "esp_log.h"
+#include "sdkconfig.h"
+
+static const char *TAG = "audio backend";
+
+#if CONFIG_AUDIO_HOST_REALTIME
+#define HOST_REALTIME   true
+#else
+#define HOST_REALTIME   false
+#endif
+
+static const audio_out_backend_t *s_out = NULL;
+static const audio_in_backend_t *s_in = NULL;
+
+/*===========================================================================
+ * Defaults
+ *===========================================================================*/
+
+static const audio_out_backend_t *default_output(void)
+{
+#if CONFIG_AUDIO_BACKEND_HOST
+    const char *path = CONFIG_AUDIO_HOST_OUT_PATH;
+    return audio_backend_host_output(path[0] ? path : NULL, HOST_REALTIME);
+#else
+    return audio_backend_codec_output();
+#endif
+}
+
+static const audio_in_backend_t *default_input(void)
+{
+#if CONFIG_AUDIO_BACKEND_HOST
+    const char *path = CONFIG_AUDIO_HOST_IN_PATH;
+    return audio_backend_host_input(path[0] ? path : NULL, 16000, 2, 32, HOST_REALTIME);
+#else
+    return audio_backend_codec_input();
+#endif
+}
+
+/*===========================================================================
+ * Public API
+ *===========================================================================*/
+
+esp_err_t audio_backend_set_output(const audio_out_backend_t *backend)
+{
+    if (backend == NULL) {
+        backend = default_output();
+    }
+    if (backend == NULL || backend->write == NULL || backend->set_power == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (backend == s_out) {
+        return ESP_OK;
+    }
+
+    if (backend->init != NULL) {
+        esp_err_t ret = backend->init(backend->ctx);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Output %s: init failed: %s", backend->name, esp_err_to_name(ret));
+            return ret;
+        }
+    }
+    if (s_out != NULL && s_out->deinit != NULL) {
+        s_out->deinit(s_out->ctx);
+    }
+    s_out = backend;
+    ESP_LOGI(TAG, "Output: %s", backend->name);
+    return ESP_OK;
+}
+
+const audio_out_backend_t *audio_backend_get_output(void)
+{
+    if (s_out == NULL) {
+        audio_backend_set_output(NULL);
+    }
+    return s_out;
+}
+
+void audio_backend_release_output(void)
+{
+    if (s_out == NULL) {
+        return;
+    }
+    uint32_t settle_ms;
+    s_out->set_power(s_out->ctx, AUDIO_POWER_OFF, 0, &settle_ms);
+    if (s_out->deinit != NULL) {
+        s_out->deinit(s_out->ctx);
+    }
+    s_out = NULL;
+}
+
+esp_err_t audio_backend_set_input(const audio_in_backend_t *backend)
+{
+    if (backend == NULL) {
+        backend = default_input();
+    }
+    if (backend == NULL || backend->read == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (backend != s_in) {
+        s_in = backend;
+        ESP_LOGI(TAG, "Input: %s", backend->name);
+    }
+    return ESP_OK;
+}
+
+const audio_in_backend_t *audio_backend_get_input(void)
+{
+    if (s_in == NULL) {
+        audio_backend_set_input(NULL);
+    }
+    return s_in;
+}
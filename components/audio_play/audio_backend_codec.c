@@ -0,0 +1,215 @@
+/**
+ * @file audio_backend_codec.c
+ * @brief Board codec backends: ES8311 output, ES7210 capture
+ *
+ * Thin wrappers over the BSP: esp_audio_play() already serializes writers
+ * and widens 16-bit PCM to the 32-bit I2S slots, so the output side adds
+ * only the PA pin and the ordering of power steps (amp off before the codec
+ * is muted or suspended, on after it is running). The capture side owns the I2S RX overflow counter the
+ * recorder reports.
+ */
+
+#include "audio_backend.h"
+#include "sdkconfig.h"
+
+#if CONFIG_IDF_TARGET_LINUX
+
+const audio_out_backend_t *audio_backend_codec_output(void)
+{
+    return NULL;
+}
+
+const audio_in_backend_t *audio_backend_codec_input(void)
+{
+    return NULL;
+}
+
+#else
+
+#include "bsp_board.h"
+#include "driver/gpio.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include <stdatomic.h>
+
+static const char *TAG = "audio codec";
+
+#define CODEC_PA_GPIO       GPIO_NUM_0      /**< Speaker amplifier enable */
+#define CODEC_DRAIN_BYTES   512             /**< Chunk used to discard stale RX data */
+#define CODEC_START_SETTLE_MS   10          /**< ES8311 start-up after resume (DAC ramp) */
+#define CODEC_PA_SETTLE_MS      20          /**< Amp enable until pop-free output */
+
+static audio_power_level_t s_level = AUDIO_POWER_OFF;
+
+/*===========================================================================
+ * ES8311 Output
+ *===========================================================================*/
+
+static esp_err_t codec_out_init(void *ctx)
+{
+    gpio_config_t pa_cfg = {
+        .mode = GPIO_MODE_OUTPUT,
+        .pin_bit_mask = 1ULL << CODEC_PA_GPIO,
+    };
+    esp_err_t ret = gpio_config(&pa_cfg);
+    gpio_set_level(CODEC_PA_GPIO, 0);   /* Start with the amp off */
+    s_level = AUDIO_POWER_OFF;
+    return ret;
+}
+
+static void codec_out_deinit(void *ctx)
+{
+    gpio_set_level(CODEC_PA_GPIO, 0);
+    gpio_reset_pin(CODEC_PA_GPIO);
+}
+
+static esp_err_t codec_out_write(void *ctx, const int16_t *pcm, size_t bytes, uint32_t timeout_ms)
+{
+    return esp_audio_play(pcm, (int)bytes, pdMS_TO_TICKS(timeout_ms));
+}
+
+static esp_err_t codec_out_set_power(void *ctx, audio_power_level_t level, int volume, uint32_t *settle_ms)
+{
+    static const esp_audio_power_t codec_level[] = {
+        [AUDIO_POWER_OFF] = ESP_AUDIO_POWER_OFF,
+        [AUDIO_POWER_STANDBY] = ESP_AUDIO_POWER_STANDBY,
+        [AUDIO_POWER_ACTIVE] = ESP_AUDIO_POWER_ON,
+    };
+    audio_power_level_t prev = s_level;
+
+    *settle_ms = 0;
+    if (level < AUDIO_POWER_ACTIVE && prev == AUDIO_POWER_ACTIVE) {
+        gpio_set_level(CODEC_PA_GPIO, 0);   /* Amp off first: no pop as the DAC mutes */
+    }
+    esp_err_t ret = esp_audio_set_power(codec_level[level], volume);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Codec power %d failed: %s", (int)level, esp_err_to_name(ret));
+        return ret;
+    }
+    if (level > AUDIO_POWER_OFF && prev == AUDIO_POWER_OFF) {
+        *settle_ms += CODEC_START_SETTLE_MS;
+    }
+    if (level == AUDIO_POWER_ACTIVE && prev != AUDIO_POWER_ACTIVE) {
+        esp_audio_reset_log_flag();
+        gpio_set_level(CODEC_PA_GPIO, 1);
+        *settle_ms += CODEC_PA_SETTLE_MS;
+    }
+    s_level = level;
+    return ESP_OK;
+}
+
+static const audio_out_backend_t s_codec_out = {
+    .name = "es8311",
+    .init = codec_out_init,
+    .deinit = codec_out_deinit,
+    .write = codec_out_write,
+    .set_power = codec_out_set_power,
+};
+
+const audio_out_backend_t *audio_backend_codec_output(void)
+{
+    return &s_codec_out;
+}
+
+/*===========================================================================
+ * ES7210 Capture
+ *===========================================================================*/
+
+static i2s_chan_handle_t s_rx = NULL;
+static i2s_chan_handle_t s_hooked_rx = NULL;    /**< Channel the overflow callback is registered on */
+static atomic_bool s_counting;
+static volatile uint32_t s_ovf_events;
+static volatile uint32_t s_ovf_bytes;
+
+static IRAM_ATTR bool on_recv_q_ovf(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx)
+{
+    /* The channel runs between sessions too; only count while capturing */
+    if (atomic_load_explicit(&s_counting, memory_order_relaxed)) {
+        s_ovf_events++;
+        s_ovf_bytes += event->size;
+    }
+    return false;
+}
+
+/**
+ * @brief Register the DMA overflow callback (once per channel)
+ *
+ * The driver only accepts callbacks on a disabled channel, so RX is briefly
+ * stopped. Failure only loses the overflow counter, not the audio.
+ */
+static void hook_dma_overflow(i2s_chan_handle_t rx)
+{
+    if (rx == s_hooked_rx) {
+        return;
+    }
+    i2s_event_callbacks_t cbs = {
+        .on_recv_q_ovf = on_recv_q_ovf,
+    };
+    i2s_channel_disable(rx);
+    esp_err_t ret = i2s_channel_register_event_callback(rx, &cbs, NULL);
+    i2s_channel_enable(rx);
+    if (ret == ESP_OK) {
+        s_hooked_rx = rx;
+    } else {
+        ESP_LOGW(TAG, "DMA overflow callback not registered: %s", esp_err_to_name(ret));
+    }
+}
+
+static esp_err_t codec_in_start(void *ctx)
+{
+    s_rx = bsp_display_get_handles()->i2s_rx_handle;
+    if (s_rx == NULL) {
+        ESP_LOGE(TAG, "I2S RX channel not initialized");
+        return ESP_ERR_INVALID_STATE;
+    }
+    hook_dma_overflow(s_rx);
+
+    /* Discard audio queued in DMA since the last session */
+    uint8_t scratch[CODEC_DRAIN_BYTES];
+    size_t got;
+    do {
+        got = 0;
+        i2s_channel_read(s_rx, scratch, sizeof(scratch), &got, 0);
+    } while (got == sizeof(scratch));
+
+    s_ovf_events = 0;
+    s_ovf_bytes = 0;
+    atomic_store(&s_counting, true);
+    return ESP_OK;
+}
+
+static void codec_in_stop(void *ctx)
+{
+    atomic_store(&s_counting, false);
+}
+
+static esp_err_t codec_in_read(void *ctx, void *buf, size_t bytes, size_t *got, uint32_t timeout_ms)
+{
+    if (s_rx == NULL) {
+        *got = 0;
+        return ESP_ERR_INVALID_STATE;
+    }
+    return i2s_channel_read(s_rx, buf, bytes, got, pdMS_TO_TICKS(timeout_ms));
+}
+
+static void codec_in_get_overflows(void *ctx, uint32_t *events, uint32_t *bytes)
+{
+    *events = s_ovf_events;
+    *bytes = s_ovf_bytes;
+}
+
+static const audio_in_backend_t s_codec_in = {
+    .name = "es7210",
+    .start = codec_in_start,
+    .stop = codec_in_stop,
+    .read = codec_in_read,
+    .get_overflows = codec_in_get_overflows,
+};
+
+const audio_in_backend_t *audio_backend_codec_input(void)
+{
+    return &s_codec_in;
+}
+
+#endif /* CONFIG_IDF_TARGET_LINUX */
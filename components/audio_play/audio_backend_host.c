@@ -0,0 +1,397 @@
+/**
+ * @file audio_backend_host.c
+ * @brief Host backends: WAV/null sink and WAV/silence source
+ *
+ * Plain stdio plus esp_timer and FreeRTOS delays, all of which exist on
+ * the ESP-IDF Linux target, so the audio pipeline can run without the
+ * board. Both sides keep a virtual sample clock: in non-realtime mode
+ * reads and writes complete at once (deterministic, as fast as the
+ * pipeline allows); in realtime mode they wait until the wall clock
+ * catches up with the audio, keeping HOST_LEAD_US queued like the DMA.
+ */
+
+#include "audio_backend.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char *TAG = "audio host";
+
+#define HOST_LEAD_US        24000   /**< Audio allowed ahead of the wall clock (~2 I2S blocks) */
+#define HOST_PATH_MAX       128
+
+/** 44-byte canonical PCM WAV header */
+typedef struct __attribute__((packed)) {
+    char riff[4];
+    uint32_t riff_size;
+    char wave[4];
+    char fmt[4];
+    uint32_t fmt_size;
+    uint16_t format;
+    uint16_t channels;
+    uint32_t sample_rate;
+    uint32_t byte_rate;
+    uint16_t block_align;
+    uint16_t bits;
+    char data[4];
+    uint32_t data_size;
+} host_wav_header_t;
+
+/*===========================================================================
+ * Module State
+ *===========================================================================*/
+
+typedef struct {
+    char path[HOST_PATH_MAX];
+    FILE *file;
+    bool realtime;
+    uint64_t data_bytes;
+    int64_t t0;                 /**< Wall clock at the first write, 0 = not started */
+    audio_power_level_t level;  /**< Mock codec/amp state */
+    int volume;
+    SemaphoreHandle_t lock;     /**< Serializes write() */
+} host_sink_t;
+
+typedef struct {
+    char path[HOST_PATH_MAX];
+    FILE *file;
+    bool realtime;
+    long data_start;            /**< File offset of the sample data (loop point) */
+    uint16_t src_channels;
+    uint32_t sample_rate;
+    uint8_t channels;
+    uint8_t bits;
+    int64_t t0;                 /**< Wall clock at start(), 0 = not started */
+} host_source_t;
+
+static host_sink_t s_sink;
+static host_source_t s_src;
+static audio_host_stats_t s_stats;
+
+/*===========================================================================
+ * Helpers
+ *===========================================================================*/
+
+static void fill_header(host_wav_header_t *h, uint32_t rate, uint16_t channels, uint16_t bits, uint32_t data_bytes)
+{
+    memcpy(h->riff, "RIFF", 4);
+    h->riff_size = 36 + data_bytes;
+    memcpy(h->wave, "WAVE", 4);
+    memcpy(h->fmt, "fmt ", 4);
+    h->fmt_size = 16;
+    h->format = 1;
+    h->channels = channels;
+    h->sample_rate = rate;
+    h->block_align = channels * bits / 8;
+    h->byte_rate = rate * h->block_align;
+    h->bits = bits;
+    memcpy(h->data, "data", 4);
+    h->data_size = data_bytes;
+}
+
+/**
+ * @brief Wait until the wall clock is within HOST_LEAD_US of @p audio_us
+ */
+static void pace(int64_t t0, uint64_t audio_us)
+{
+    int64_t ahead = (int64_t)audio_us - (esp_timer_get_time() - t0) - HOST_LEAD_US;
+    if (ahead > 0) {
+        TickType_t ticks = pdMS_TO_TICKS(ahead / 1000);
+        vTaskDelay(ticks > 0 ? ticks : 1);
+    }
+}
+
+/*===========================================================================
+ * Sink
+ *===========================================================================*/
+
+static esp_err_t sink_init(void *ctx)
+{
+    host_sink_t *s = ctx;
+    if (s->lock == NULL) {
+        s->lock = xSemaphoreCreateMutex();
+        if (s->lock == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    s->data_bytes = 0;
+    s->t0 = 0;
+    if (s->path[0] == '\0') {
+        return ESP_OK;      /* Null sink */
+    }
+
+    s->file = fopen(s->path, "wb");
+    if (s->file == NULL) {
+        ESP_LOGE(TAG, "Cannot create %s", s->path);
+        return ESP_ERR_NOT_FOUND;
+    }
+    host_wav_header_t h;
+    fill_header(&h, AUDIO_BACKEND_OUT_RATE, AUDIO_BACKEND_OUT_CHANNELS, 16, 0);
+    fwrite(&h, sizeof(h), 1, s->file);
+    return ESP_OK;
+}
+
+static void sink_deinit(void *ctx)
+{
+    host_sink_t *s = ctx;
+    if (s->file == NULL) {
+        return;
+    }
+    host_wav_header_t h;
+    fill_header(&h, AUDIO_BACKEND_OUT_RATE, AUDIO_BACKEND_OUT_CHANNELS, 16, (uint32_t)s->data_bytes);
+    fseek(s->file, 0, SEEK_SET);
+    fwrite(&h, sizeof(h), 1, s->file);
+    fclose(s->file);
+    s->file = NULL;
+    ESP_LOGI(TAG, "Closed %s: %llu bytes", s->path, (unsigned long long)s->data_bytes);
+}
+
+static esp_err_t sink_write(void *ctx, const int16_t *pcm, size_t bytes, uint32_t timeout_ms)
+{
+    host_sink_t *s = ctx;
+    if (xSemaphoreTake(s->lock, pdMS_TO_TICKS(timeout_ms)) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    int64_t t_in = esp_timer_get_time();
+    if (s->t0 == 0) {
+        s->t0 = t_in;
+        s_stats.first_write_us = t_in;
+    }
+
+    esp_err_t ret = ESP_OK;
+    if (s->file != NULL && fwrite(pcm, 1, bytes, s->file) != bytes) {
+        ret = ESP_FAIL;
+    }
+    s->data_bytes += bytes;
+
+    uint32_t frames = (uint32_t)(bytes / (AUDIO_BACKEND_OUT_CHANNELS * sizeof(int16_t)));
+    s_stats.out_frames += frames;
+    s_stats.out_writes++;
+    s_stats.out_audio_us = s_stats.out_frames * 1000000ULL / AUDIO_BACKEND_OUT_RATE;
+    if (s->realtime) {
+        pace(s->t0, s_stats.out_audio_us);
+    }
+    s_stats.last_write_us = esp_timer_get_time();
+    s_stats.out_busy_us += (uint64_t)(s_stats.last_write_us - t_in);
+
+    xSemaphoreGive(s->lock);
+    return ret;
+}
+
+/**
+ * @brief Mock codec/amp power
+ *
+ * The file holds the stream sent to the DAC, so power and volume (analog
+ * on the board too) only update the counters, letting the power manager's
+ * transitions be checked without hardware. Settle times mirror the codec
+ * backend so start-up latency is measured the same way.
+ */
+static esp_err_t sink_set_power(void *ctx, audio_power_level_t level, int volume, uint32_t *settle_ms)
+{
+    host_sink_t *s = ctx;
+    *settle_ms = 0;
+    if (level > AUDIO_POWER_OFF && s->level == AUDIO_POWER_OFF) {
+        *settle_ms += 10;
+    }
+    if (level == AUDIO_POWER_ACTIVE && s->level != AUDIO_POWER_ACTIVE) {
+        *settle_ms += 20;
+    }
+    if (level != s->level || (level != AUDIO_POWER_OFF && volume != s->volume)) {
+        s_stats.power_changes++;
+    }
+    s->level = level;
+    if (level != AUDIO_POWER_OFF) {
+        s->volume = volume;
+    }
+    return ESP_OK;
+}
+
+static const audio_out_backend_t s_sink_backend = {
+    .name = "host sink",
+    .init = sink_init,
+    .deinit = sink_deinit,
+    .write = sink_write,
+    .set_power = sink_set_power,
+    .ctx = &s_sink,
+};
+
+/*===========================================================================
+ * Source
+ *===========================================================================*/
+
+/**
+ * @brief Open a 16-bit PCM WAV and seek to its samples
+ */
+static bool source_open(host_source_t *s)
+{
+    s->file = fopen(s->path, "rb");
+    if (s->file == NULL) {
+        return false;
+    }
+
+    char id[4];
+    uint32_t size;
+    uint16_t fmt[8];
+    bool have_fmt = false;
+    if (fread(id, 1, 4, s->file) != 4 || memcmp(id, "RIFF", 4) != 0 ||
+        fseek(s->file, 8, SEEK_SET) != 0) {
+        goto fail;
+    }
+    while (fread(id, 1, 4, s->file) == 4 && fread(&size, 4, 1, s->file) == 1) {
+        if (memcmp(id, "fmt ", 4) == 0 && size >= 16) {
+            if (fread(fmt, 1, 16, s->file) != 16) {
+                goto fail;
+            }
+            fseek(s->file, (long)(size - 16 + (size & 1)), SEEK_CUR);
+            have_fmt = true;
+        } else if (memcmp(id, "data", 4) == 0) {
+            /* fmt: format, channels, rate(2), byte rate(2), align, bits */
+            if (!have_fmt || fmt[0] != 1 || fmt[7] != 16 || fmt[1] == 0) {
+                goto fail;
+            }
+            s->src_channels = fmt[1];
+            uint32_t rate = fmt[2] | ((uint32_t)fmt[3] << 16);
+            if (rate != s->sample_rate) {
+                ESP_LOGW(TAG, "%s is %lu Hz, delivered as %lu Hz", s->path,
+                         (unsigned long)rate, (unsigned long)s->sample_rate);
+            }
+            s->data_start = ftell(s->file);
+            return true;
+        } else {
+            fseek(s->file, (long)(size + (size & 1)), SEEK_CUR);
+        }
+    }
+
+fail:
+    ESP_LOGW(TAG, "%s is not a 16-bit PCM WAV", s->path);
+    fclose(s->file);
+    s->file = NULL;
+    return false;
+}
+
+static esp_err_t source_start(void *ctx)
+{
+    host_source_t *s = ctx;
+    if (s->file == NULL && s->path[0] != '\0' && !source_open(s)) {
+        ESP_LOGW(TAG, "Falling back to silence");
+        s->path[0] = '\0';
+    }
+    s->t0 = esp_timer_get_time();
+    return ESP_OK;
+}
+
+static void source_stop(void *ctx)
+{
+    ((host_source_t *)ctx)->t0 = 0;
+}
+
+static esp_err_t source_read(void *ctx, void *buf, size_t bytes, size_t *got, uint32_t timeout_ms)
+{
+    host_source_t *s = ctx;
+    uint32_t frame = (uint32_t)s->channels * s->bits / 8;
+    uint32_t frames = (uint32_t)(bytes / frame);
+    uint8_t *dst = buf;
+
+    if (s->t0 == 0) {
+        s->t0 = esp_timer_get_time();
+    }
+
+    for (uint32_t i = 0; i < frames; i++) {
+        int16_t in[8] = {0};
+        if (s->file != NULL) {
+            uint16_t n = s->src_channels < 8 ? s->src_channels : 8;
+            if (fread(in, sizeof(int16_t), n, s->file) != n) {
+                fseek(s->file, s->data_start, SEEK_SET);    /* Loop */
+                if (fread(in, sizeof(int16_t), n, s->file) != n) {
+                    memset(in, 0, sizeof(in));
+                }
+            }
+            if (s->src_channels > n) {
+                fseek(s->file, (long)(s->src_channels - n) * 2, SEEK_CUR);
+            }
+        }
+        for (uint32_t c = 0; c < s->channels; c++) {
+            int16_t v = in[c < s->src_channels ? c : 0];
+            if (s->bits == 32) {
+                int32_t w = (int32_t)((uint32_t)(uint16_t)v << 16);
+                memcpy(dst, &w, sizeof(w));
+                dst += sizeof(w);
+            } else {
+                memcpy(dst, &v, sizeof(v));
+                dst += sizeof(v);
+            }
+        }
+    }
+
+    *got = (size_t)frames * frame;
+    s_stats.in_frames += frames;
+    s_stats.in_audio_us = s_stats.in_frames * 1000000ULL / s->sample_rate;
+    if (s->realtime) {
+        /* Like DMA: data exists only once the wall clock has reached it */
+        int64_t early = (int64_t)s_stats.in_audio_us - (esp_timer_get_time() - s->t0);
+        if (early > 0) {
+            TickType_t ticks = pdMS_TO_TICKS(early / 1000);
+            vTaskDelay(ticks > 0 ? ticks : 1);
+        }
+    }
+    return ESP_OK;
+}
+
+static const audio_in_backend_t s_source_backend = {
+    .name = "host source",
+    .start = source_start,
+    .stop = source_stop,
+    .read = source_read,
+    .ctx = &s_src,
+};
+
+/*===========================================================================
+ * Public API
+ *===========================================================================*/
+
+const audio_out_backend_t *audio_backend_host_output(const char *path, bool realtime)
+{
+    if (s_sink.file != NULL) {
+        ESP_LOGW(TAG, "Sink %s still open, reusing it", s_sink.path);
+        return &s_sink_backend;
+    }
+    strlcpy(s_sink.path, path != NULL ? path : "", sizeof(s_sink.path));
+    s_sink.realtime = realtime;
+    return &s_sink_backend;
+}
+
+const audio_in_backend_t *audio_backend_host_input(const char *path, uint32_t sample_rate,
+                                                   uint8_t channels, uint8_t bits, bool realtime)
+{
+    if (s_src.file != NULL) {
+        fclose(s_src.file);
+        s_src.file = NULL;
+    }
+    strlcpy(s_src.path, path != NULL ? path : "", sizeof(s_src.path));
+    s_src.sample_rate = sample_rate > 0 ? sample_rate : 16000;
+    s_src.channels = channels == 1 ? 1 : 2;
+    s_src.bits = bits == 16 ? 16 : 32;
+    s_src.realtime = realtime;
+    s_src.t0 = 0;
+    return &s_source_backend;
+}
+
+void audio_backend_host_get_stats(audio_host_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    *stats = s_stats;
+    stats->power_level = (uint8_t)s_sink.level;
+    stats->volume = (uint8_t)s_sink.volume;
+}
+
+void audio_backend_host_reset_stats(void)
+{
+    memset(&s_stats, 0, sizeof(s_stats));
+}
@@ -0,0 +1,748 @@
+/**
+ * @file audio_clip_cache.c
+ * @brief LRU cache of decoded sound-effect files
+ *
+ * Architecture:
+ * - Slots: CLIP_SLOTS entries keyed by absolute path. A slot is queued,
+ *   loading, ready (PCM in RAM) or rejected (too big / undecodable, kept so
+ *   the file is not retried on every play).
+ * - Loader Task: CONFIG_AUDIO_CLIP_CACHE_TASK_PRIORITY. Reads the file in
+ *   CLIP_READ_BYTES chunks (SPI bus held per chunk only) and decodes it
+ *   with the esp_audio_codec simple decoder straight into a growing PCM
+ *   buffer. Pinned paths are loaded first.
+ * - Budget: CONFIG_AUDIO_CLIP_CACHE_KB of decoded PCM, cut at init to a
+ *   quarter of the free heap if that is less. Before a clip is
+ *   inserted, least-recently-played entries are evicted until it fits;
+ *   pinned entries and entries still referenced by the mixer are skipped.
+ *   A decode stops as soon as it outgrows what those entries leave free.
+ * - References: every voice started on an entry holds one. It is taken
+ *   before the PLAY command is posted and dropped by the mixer's release
+ *   callback when the voice ends, is stopped or stolen, or the command is
+ *   dropped, so the mixer never reads freed memory.
+ * - Memory: PSRAM when the board has it, internal RAM otherwise.
+ *
+ * Play requests only take the slot mutex and queue a mixer voice, so they
+ * are safe from the LVGL task.
+ */
+
+#include "audio_clip_cache.h"
+#include "audio_mixer.h"
+#include "bsp_board.h"
+#include "esp_audio_simple_dec.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "sdkconfig.h"
+#include <inttypes.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+static const char *TAG = "audio clip";
+
+/*===========================================================================
+ * Configuration
+ *===========================================================================*/
+
+#define CLIP_BUDGET_BYTES   ((uint32_t)CONFIG_AUDIO_CLIP_CACHE_KB * 1024)
+#define CLIP_HEAP_SHARE     4       /**< Budget is at most 1/4 of the free heap at init */
+#define CLIP_SLOTS          12      /**< Cached + queued + rejected paths */
+#define CLIP_READ_BYTES     4096    /**< Compressed bytes per fread() */
+#define CLIP_PCM_START      (16 * 1024) /**< Initial PCM buffer, doubled as needed */
+#define CLIP_TASK_STACK     3072
+#define CLIP_TASK_PRIO      CONFIG_AUDIO_CLIP_CACHE_TASK_PRIORITY
+
+#if CONFIG_SPIRAM
+#define CLIP_MEM_CAPS       (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+#else
+#define CLIP_MEM_CAPS       (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+#endif
+
+/*===========================================================================
+ * Types
+ *===========================================================================*/
+
+typedef enum {
+    CLIP_EMPTY = 0,     /**< Slot free */
+    CLIP_QUEUED,        /**< Waiting for the loader */
+    CLIP_LOADING,       /**< Being decoded (slot owned by the loader) */
+    CLIP_READY,         /**< PCM in RAM */
+    CLIP_REJECTED,      /**< Too big or undecodable; not retried (see retry) */
+} clip_state_t;
+
+typedef struct {
+    clip_state_t state;
+    char path[AUDIO_CLIP_CACHE_PATH_MAX];
+    int16_t *pcm;
+    uint32_t bytes;             /**< PCM bytes */
+    uint32_t frames;
+    uint32_t sample_rate;
+    uint8_t channels;
+    uint32_t last_use;          /**< s_clock at the last play (LRU order) */
+    atomic_int refs;            /**< Mixer voices using pcm (taken under s_lock, dropped by the mixer) */
+    bool retry;                 /**< Rejected only for lack of free room; reload on next play */
+} clip_entry_t;
+
+/**
+ * @brief Result of decoding one file
+ */
+typedef struct {
+    int16_t *pcm;
+    uint32_t bytes;
+    uint32_t sample_rate;
+    uint8_t channels;
+} clip_pcm_t;
+
+/*===========================================================================
+ * Module State
+ *===========================================================================*/
+
+static clip_entry_t s_slots[CLIP_SLOTS];
+static char s_pins[AUDIO_CLIP_CACHE_MAX_PINS][AUDIO_CLIP_CACHE_PATH_MAX];
+static size_t s_pin_count;
+static uint32_t s_clock;                    /**< Bumped on every play */
+static uint32_t s_used_bytes;
+static uint32_t s_budget_bytes;             /**< CLIP_BUDGET_BYTES, or less if the heap is short */
+
+static SemaphoreHandle_t s_lock = NULL;     /**< Guards everything above and s_stats */
+static TaskHandle_t s_task = NULL;
+static volatile bool s_running = false;
+
+static audio_clip_cache_stats_t s_stats;
+
+/*===========================================================================
+ * Helpers (call with s_lock held)
+ *===========================================================================*/
+
+static bool is_pinned(const clip_entry_t *e)
+{
+    for (size_t i = 0; i < s_pin_count; i++) {
+        if (strcmp(s_pins[i], e->path) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool is_evictable(const clip_entry_t *e)
+{
+    if (e->state != CLIP_READY && e->state != CLIP_REJECTED) {
+        return false;
+    }
+    if (is_pinned(e)) {
+        return false;
+    }
+    return atomic_load_explicit(&e->refs, memory_order_acquire) == 0;
+}
+
+static clip_entry_t *find_entry(const char *path)
+{
+    for (int i = 0; i < CLIP_SLOTS; i++) {
+        if (s_slots[i].state != CLIP_EMPTY && strcmp(s_slots[i].path, path) == 0) {
+            return &s_slots[i];
+        }
+    }
+    return NULL;
+}
+
+static void free_entry(clip_entry_t *e)
+{
+    if (e->pcm != NULL) {
+        heap_caps_free(e->pcm);
+        s_used_bytes -= e->bytes;
+    }
+    memset(e, 0, sizeof(*e));
+}
+
+/**
+ * @brief Least recently played evictable entry, optionally ready ones only
+ */
+static clip_entry_t *lru_victim(bool ready_only, const clip_entry_t *keep)
+{
+    clip_entry_t *victim = NULL;
+    for (int i = 0; i < CLIP_SLOTS; i++) {
+        clip_entry_t *e = &s_slots[i];
+        if (e == keep || !is_evictable(e) || (ready_only && e->state != CLIP_READY)) {
+            continue;
+        }
+        if (victim == NULL || (int32_t)(e->last_use - victim->last_use) < 0) {
+            victim = e;
+        }
+    }
+    return victim;
+}
+
+static void evict(clip_entry_t *e)
+{
+    ESP_LOGD(TAG, "Evict %s (%"PRIu32" bytes)", e->path, e->bytes);
+    if (e->state == CLIP_READY) {
+        s_stats.evictions++;
+    }
+    free_entry(e);
+}
+
+/**
+ * @brief Find or create the entry for @p path, queueing it for the loader
+ * @return Entry, or NULL if every slot is busy or pinned
+ */
+static clip_entry_t *lookup_or_queue(const char *path, bool *queued)
+{
+    *queued = false;
+    clip_entry_t *e = find_entry(path);
+    if (e != NULL) {
+        if (e->state == CLIP_REJECTED && e->retry) {
+            e->state = CLIP_QUEUED;
+            e->retry = false;
+            *queued = true;
+        }
+        return e;
+    }
+
+    for (int i = 0; i < CLIP_SLOTS && e == NULL; i++) {
+        if (s_slots[i].state == CLIP_EMPTY) {
+            e = &s_slots[i];
+        }
+    }
+    if (e == NULL) {
+        e = lru_victim(false, NULL);
+        if (e == NULL) {
+            return NULL;
+        }
+        evict(e);
+    }
+
+    strlcpy(e->path, path, sizeof(e->path));
+    e->state = CLIP_QUEUED;
+    e->last_use = s_clock;
+    *queued = true;
+    return e;
+}
+
+/**
+ * @brief PCM bytes held by entries that cannot be evicted
+ */
+static uint32_t held_bytes(void)
+{
+    uint32_t held = 0;
+    for (int i = 0; i < CLIP_SLOTS; i++) {
+        if (s_slots[i].state == CLIP_READY && !is_evictable(&s_slots[i])) {
+            held += s_slots[i].bytes;
+        }
+    }
+    return held;
+}
+
+/**
+ * @brief Next queued entry, pinned paths first; marks it loading
+ */
+static clip_entry_t *take_queued(void)
+{
+    clip_entry_t *pick = NULL;
+    for (int i = 0; i < CLIP_SLOTS; i++) {
+        clip_entry_t *e = &s_slots[i];
+        if (e->state != CLIP_QUEUED) {
+            continue;
+        }
+        if (is_pinned(e)) {
+            pick = e;
+            break;
+        }
+        if (pick == NULL) {
+            pick = e;
+        }
+    }
+    if (pick != NULL) {
+        pick->state = CLIP_LOADING;
+    }
+    return pick;
+}
+
+/**
+ * @brief Mixer release callback (mixer task, no lock taken)
+ */
+static void clip_released(void *ctx)
+{
+    clip_entry_t *e = ctx;
+    atomic_fetch_sub_explicit(&e->refs, 1, memory_order_release);
+}
+
+/*===========================================================================
+ * Decoding (loader task, no lock held)
+ *===========================================================================*/
+
+static esp_audio_simple_dec_type_t dec_type_for(const char *path)
+{
+    const char *ext = strrchr(path, '.');
+    if (ext == NULL) {
+        return ESP_AUDIO_SIMPLE_DEC_TYPE_NONE;
+    }
+    if (strcasecmp(ext, ".mp3") == 0) {
+        return ESP_AUDIO_SIMPLE_DEC_TYPE_MP3;
+    }
+    if (strcasecmp(ext, ".wav") == 0) {
+        return ESP_AUDIO_SIMPLE_DEC_TYPE_WAV;
+    }
+    if (strcasecmp(ext, ".aac") == 0) {
+        return ESP_AUDIO_SIMPLE_DEC_TYPE_AAC;
+    }
+    if (strcasecmp(ext, ".flac") == 0) {
+        return ESP_AUDIO_SIMPLE_DEC_TYPE_FLAC;
+    }
+    return ESP_AUDIO_SIMPLE_DEC_TYPE_NONE;
+}
+
+static void *clip_realloc(void *p, size_t size)
+{
+    void *q = heap_caps_realloc(p, size, CLIP_MEM_CAPS);
+#if CONFIG_SPIRAM
+    if (q == NULL) {
+        q = heap_caps_realloc(p, size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+#endif
+    return q;
+}
+
+/**
+ * @brief Grow the PCM buffer to at least @p need bytes, at most @p limit
+ */
+static bool grow_pcm(clip_pcm_t *out, uint32_t *cap, uint32_t need, uint32_t limit)
+{
+    uint32_t size = *cap ? *cap : CLIP_PCM_START;
+    while (size < need) {
+        size *= 2;
+    }
+    if (size > limit) {
+        size = limit;
+    }
+    int16_t *p = clip_realloc(out->pcm, size);
+    if (p == NULL) {
+        return false;
+    }
+    out->pcm = p;
+    *cap = size;
+    return true;
+}
+
+static size_t read_chunk(FILE *f, uint8_t *dst)
+{
+    if (bsp_spi_bus_acquire(BSP_SPI_CLIENT_FILE, BSP_SPI_BUS_WAIT_DEFAULT) != ESP_OK) {
+        return 0;
+    }
+    size_t n = fread(dst, 1, CLIP_READ_BYTES, f);
+    bsp_spi_bus_release(BSP_SPI_CLIENT_FILE);
+    return n;
+}
+
+/**
+ * @brief Decode a whole file to 16-bit PCM
+ * @param limit Largest PCM size accepted
+ * @return ESP_OK, ESP_ERR_INVALID_SIZE if the PCM exceeds @p limit,
+ *         ESP_ERR_NOT_FOUND / ESP_ERR_NOT_SUPPORTED / ESP_FAIL otherwise
+ */
+static esp_err_t decode_file(const char *path, uint32_t limit, clip_pcm_t *out, uint32_t *file_bytes)
+{
+    memset(out, 0, sizeof(*out));
+    *file_bytes = 0;
+
+    esp_audio_simple_dec_cfg_t cfg = { .dec_type = dec_type_for(path) };
+    if (cfg.dec_type == ESP_AUDIO_SIMPLE_DEC_TYPE_NONE) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    if (limit == 0) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    if (bsp_spi_bus_acquire(BSP_SPI_CLIENT_FILE, BSP_SPI_BUS_WAIT_DEFAULT) != ESP_OK) {
+        return ESP_ERR_TIMEOUT;
+    }
+    FILE *f = fopen(path, "rb");
+    bsp_spi_bus_release(BSP_SPI_CLIENT_FILE);
+    if (f == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    setvbuf(f, NULL, _IONBF, 0);
+
+    uint8_t *in = heap_caps_malloc(CLIP_READ_BYTES, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    esp_audio_simple_dec_handle_t dec = NULL;
+    esp_err_t err = ESP_OK;
+    uint32_t cap = 0;
+    if (in == NULL || !grow_pcm(out, &cap, limit < CLIP_PCM_START ? limit : CLIP_PCM_START, limit)) {
+        err = ESP_ERR_NO_MEM;
+    } else if (esp_audio_simple_dec_open(&cfg, &dec) != ESP_AUDIO_ERR_OK) {
+        err = ESP_FAIL;
+    }
+
+    bool eos = false;
+    while (err == ESP_OK && !eos) {
+        size_t n = read_chunk(f, in);
+        *file_bytes += n;
+        eos = n < CLIP_READ_BYTES;
+
+        esp_audio_simple_dec_raw_t raw = { .buffer = in, .len = n, .eos = eos };
+        while (err == ESP_OK) {
+            esp_audio_simple_dec_out_t frame = {
+                .buffer = (uint8_t *)out->pcm + out->bytes,
+                .len = cap - out->bytes,
+            };
+            esp_audio_err_t ret = esp_audio_simple_dec_process(dec, &raw, &frame);
+            if (ret == ESP_AUDIO_ERR_BUFF_NOT_ENOUGH) {
+                uint32_t need = out->bytes + frame.needed_size;
+                if (need > limit) {
+                    err = ESP_ERR_INVALID_SIZE;
+                } else if (!grow_pcm(out, &cap, need, limit)) {
+                    err = ESP_ERR_NO_MEM;
+                }
+                continue;
+            }
+            if (ret != ESP_AUDIO_ERR_OK) {
+                err = ESP_FAIL;
+                break;
+            }
+            out->bytes += frame.decoded_size;
+            raw.buffer += raw.consumed;
+            raw.len -= raw.consumed;
+            if (raw.len == 0 || (raw.consumed == 0 && frame.decoded_size == 0)) {
+                break;      /* Needs the next chunk */
+            }
+        }
+    }
+
+    if (err == ESP_OK) {
+        esp_audio_simple_dec_info_t info = {0};
+        if (esp_audio_simple_dec_get_info(dec, &info) != ESP_AUDIO_ERR_OK ||
+            info.bits_per_sample != 16 || info.channel < 1 || info.channel > 2 ||
+            out->bytes < info.channel * sizeof(int16_t)) {
+            err = ESP_ERR_NOT_SUPPORTED;
+        } else {
+            out->sample_rate = info.sample_rate;
+            out->channels = info.channel;
+            int16_t *fit = clip_realloc(out->pcm, out->bytes);     /* Give back the doubling slack */
+            if (fit != NULL) {
+                out->pcm = fit;
+            }
+        }
+    }
+
+    if (dec != NULL) {
+        esp_audio_simple_dec_close(dec);
+    }
+    heap_caps_free(in);
+    if (bsp_spi_bus_acquire(BSP_SPI_CLIENT_FILE, BSP_SPI_BUS_WAIT_DEFAULT) == ESP_OK) {
+        fclose(f);
+        bsp_spi_bus_release(BSP_SPI_CLIENT_FILE);
+    } else {
+        fclose(f);      /* Read-only: nothing to flush */
+    }
+
+    if (err != ESP_OK) {
+        heap_caps_free(out->pcm);
+        out->pcm = NULL;
+    }
+    return err;
+}
+
+/*===========================================================================
+ * Loader Task
+ *===========================================================================*/
+
+/**
+ * @brief Store a decoded clip, evicting LRU entries until it fits
+ */
+static void insert_locked(clip_entry_t *e, clip_pcm_t *clip)
+{
+    while (s_used_bytes + clip->bytes > s_budget_bytes) {
+        clip_entry_t *victim = lru_victim(true, e);
+        if (victim == NULL) {
+            break;
+        }
+        evict(victim);
+    }
+    if (s_used_bytes + clip->bytes > s_budget_bytes) {
+        /* Everything left is pinned or playing */
+        ESP_LOGW(TAG, "%s: no room (%"PRIu32" of %"PRIu32" bytes held)",
+                 e->path, s_used_bytes, s_budget_bytes);
+        heap_caps_free(clip->pcm);
+        clip->pcm = NULL;
+        e->state = CLIP_REJECTED;
+        e->retry = true;
+        return;
+    }
+
+    e->pcm = clip->pcm;
+    e->bytes = clip->bytes;
+    e->channels = clip->channels;
+    e->sample_rate = clip->sample_rate;
+    e->frames = clip->bytes / (clip->channels * sizeof(int16_t));
+    e->state = CLIP_READY;
+    s_used_bytes += clip->bytes;
+    if (s_used_bytes > s_stats.peak_bytes) {
+        s_stats.peak_bytes = s_used_bytes;
+    }
+    s_stats.loads++;
+}
+
+static void loader_task(void *pvParameters)
+{
+    char path[AUDIO_CLIP_CACHE_PATH_MAX];
+
+    while (s_running) {
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        clip_entry_t *e = take_queued();
+        uint32_t limit = 0;
+        if (e != NULL) {
+            strlcpy(path, e->path, sizeof(path));
+            limit = s_budget_bytes - held_bytes();
+        }
+        xSemaphoreGive(s_lock);
+
+        if (e == NULL) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);    /* Woken by play/prefetch/pin/deinit */
+            continue;
+        }
+
+        int64_t t0 = esp_timer_get_time();
+        clip_pcm_t clip;
+        uint32_t file_bytes;
+        esp_err_t err = decode_file(path, limit, &clip, &file_bytes);
+        uint32_t us = (uint32_t)(esp_timer_get_time() - t0);
+
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        s_stats.sd_bytes_read += file_bytes;
+        if (us > s_stats.max_load_us) {
+            s_stats.max_load_us = us;
+        }
+        if (err == ESP_OK) {
+            insert_locked(e, &clip);
+            if (e->state == CLIP_READY) {
+                ESP_LOGI(TAG, "Cached %s: %"PRIu32" Hz, %d ch, %"PRIu32" bytes in %"PRIu32" ms",
+                         path, clip.sample_rate, clip.channels, clip.bytes, us / 1000);
+            }
+        } else if (err == ESP_ERR_INVALID_SIZE && limit < s_budget_bytes) {
+            /* Might fit once pinned or playing clips are released */
+            e->state = CLIP_REJECTED;
+            e->retry = true;
+        } else {
+            e->state = CLIP_REJECTED;
+            if (err == ESP_ERR_INVALID_SIZE) {
+                s_stats.rejected++;
+                ESP_LOGW(TAG, "%s exceeds the %"PRIu32" KB cache budget", path, s_budget_bytes / 1024);
+            } else {
+                s_stats.load_errors++;
+                ESP_LOGW(TAG, "Cannot cache %s: %s", path, esp_err_to_name(err));
+            }
+        }
+        xSemaphoreGive(s_lock);
+    }
+
+    s_task = NULL;
+    vTaskDelete(NULL);
+}
+
+/*===========================================================================
+ * Public API
+ *===========================================================================*/
+
+esp_err_t audio_clip_cache_init(void)
+{
+    if (s_task != NULL || CLIP_BUDGET_BYTES == 0) {
+        return ESP_OK;
+    }
+    if (s_lock == NULL) {
+        s_lock = xSemaphoreCreateMutex();
+        if (s_lock == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    /* Clips deinit left to playing voices are freed here once released */
+    for (int i = 0; i < CLIP_SLOTS; i++) {
+        if (atomic_load_explicit(&s_slots[i].refs, memory_order_acquire) != 0) {
+            ESP_LOGE(TAG, "%s still playing, cache not restarted", s_slots[i].path);
+            return ESP_ERR_INVALID_STATE;
+        }
+        free_entry(&s_slots[i]);
+    }
+    s_pin_count = 0;
+    s_used_bytes = 0;
+    memset(&s_stats, 0, sizeof(s_stats));
+
+    s_budget_bytes = CLIP_BUDGET_BYTES;
+    uint32_t heap_share = (uint32_t)(heap_caps_get_free_size(CLIP_MEM_CAPS) / CLIP_HEAP_SHARE);
+    if (s_budget_bytes > heap_share) {
+        ESP_LOGW(TAG, "Only %"PRIu32" KB free, budget cut to %"PRIu32" KB",
+                 heap_share * CLIP_HEAP_SHARE / 1024, heap_share / 1024);
+        s_budget_bytes = heap_share;
+    }
+
+    s_running = true;
+    if (xTaskCreate(loader_task, "audio_clip_ld", CLIP_TASK_STACK, NULL,
+                    CLIP_TASK_PRIO, &s_task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create loader task");
+        s_running = false;
+        s_task = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Clip cache: %"PRIu32" KB budget, %d slots", s_budget_bytes / 1024, CLIP_SLOTS);
+    return ESP_OK;
+}
+
+void audio_clip_cache_deinit(void)
+{
+    if (s_task != NULL) {
+        s_running = false;
+        xTaskNotifyGive(s_task);
+        /* A load in progress finishes first */
+        for (int i = 0; i < 500 && s_task != NULL; i++) {
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+        if (s_task != NULL) {
+            ESP_LOGE(TAG, "Loader did not stop, cache left allocated");
+            return;
+        }
+    }
+    if (s_lock == NULL) {
+        return;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    for (int i = 0; i < CLIP_SLOTS; i++) {
+        if (atomic_load_explicit(&s_slots[i].refs, memory_order_acquire) != 0) {
+            ESP_LOGE(TAG, "%s still playing, left allocated", s_slots[i].path);
+            continue;
+        }
+        free_entry(&s_slots[i]);
+    }
+    s_pin_count = 0;
+    xSemaphoreGive(s_lock);
+}
+
+esp_err_t audio_clip_cache_play(const char *path, bool loop, audio_voice_t *voice)
+{
+    if (voice != NULL) {
+        *voice = AUDIO_VOICE_INVALID;
+    }
+    if (path == NULL || strlen(path) >= AUDIO_CLIP_CACHE_PATH_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_task == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    bool queued;
+    clip_entry_t *e = lookup_or_queue(path, &queued);
+    if (e == NULL || e->state != CLIP_READY) {
+        s_stats.misses++;
+        xSemaphoreGive(s_lock);
+        if (queued) {
+            xTaskNotifyGive(s_task);
+        }
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    s_stats.hits++;
+    e->last_use = ++s_clock;
+    /* Referenced under the lock, before the command exists, so the loader
+     * cannot evict the clip first; audio_mixer_play() only queues it */
+    atomic_fetch_add_explicit(&e->refs, 1, memory_order_relaxed);
+    audio_voice_t v = audio_mixer_play(e->pcm, e->frames, e->sample_rate, e->channels, loop,
+                                       clip_released, e);
+    if (v == AUDIO_VOICE_INVALID) {
+        atomic_fetch_sub_explicit(&e->refs, 1, memory_order_relaxed);   /* No callback will come */
+    }
+    xSemaphoreGive(s_lock);
+
+    if (voice != NULL) {
+        *voice = v;
+    }
+    return v != AUDIO_VOICE_INVALID ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t audio_clip_cache_prefetch(const char *path)
+{
+    if (path == NULL || strlen(path) >= AUDIO_CLIP_CACHE_PATH_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_task == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    bool queued;
+    clip_entry_t *e = lookup_or_queue(path, &queued);
+    xSemaphoreGive(s_lock);
+    if (queued) {
+        xTaskNotifyGive(s_task);
+    }
+    return e != NULL ? ESP_OK : ESP_ERR_NO_MEM;
+}
+
+esp_err_t audio_clip_cache_set_pinned(const char *const *paths, size_t n)
+{
+    if (n > AUDIO_CLIP_CACHE_MAX_PINS || (n > 0 && paths == NULL)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_task == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    bool wake = false;
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    s_pin_count = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (paths[i] != NULL && strlen(paths[i]) < AUDIO_CLIP_CACHE_PATH_MAX) {
+            strlcpy(s_pins[s_pin_count++], paths[i], AUDIO_CLIP_CACHE_PATH_MAX);
+        }
+    }
+    for (size_t i = 0; i < s_pin_count; i++) {
+        bool queued;
+        lookup_or_queue(s_pins[i], &queued);
+        wake |= queued;
+    }
+    xSemaphoreGive(s_lock);
+
+    if (wake) {
+        xTaskNotifyGive(s_task);
+    }
+    return ESP_OK;
+}
+
+void audio_clip_cache_get_stats(audio_clip_cache_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    memset(stats, 0, sizeof(*stats));
+    stats->budget_bytes = s_budget_bytes;
+    if (s_lock == NULL) {
+        return;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    *stats = s_stats;
+    stats->budget_bytes = s_budget_bytes;
+    stats->used_bytes = s_used_bytes;
+    for (int i = 0; i < CLIP_SLOTS; i++) {
+        if (s_slots[i].state == CLIP_READY) {
+            stats->entries++;
+            stats->pinned += is_pinned(&s_slots[i]);
+        }
+    }
+    xSemaphoreGive(s_lock);
+}
+
+void audio_clip_cache_reset_stats(void)
+{
+    if (s_lock == NULL) {
+        return;
+    }
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.peak_bytes = s_used_bytes;
+    xSemaphoreGive(s_lock);
+}
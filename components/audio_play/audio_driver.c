@@ -10,19 +10,49 @@
  * - Command Queue: Receives playback commands from other tasks
  * - Player Task: Processes commands and controls the audio pipeline
  * - Audio Pipeline: ESP Audio Simple Player handles decoding and output
- * - Power Amplifier: GPIO0 controls speaker amplifier enable
+ * - Sound Mixer: Embedded PCM clips are mixed in their own task (audio_mixer.c)
+ * - SD Stream: A reader task prefetches the music file in large chunks
+ *   (audio_sd_stream.c); the decoder only copies from RAM
+ * - Net Stream: http(s):// URLs are read through net_api into an adaptive
+ *   jitter buffer with prebuffer/rebuffer thresholds (audio_net_stream.c)
+ * - Output Ring: Decoded PCM goes into a lock-free ring drained by a
+ *   high-priority I2S writer task (audio_i2s_writer.c)
+ * - Playlist: Queued tracks are pre-opened and pre-buffered by the SD
+ *   stream while the current one plays. Same-format MP3s are spliced into
+ *   the running decoder; anything else restarts the pipeline on data that
+ *   is already in RAM. Every transition's time-to-first-sample is measured.
+ * - Telemetry: decode time, I2S write time, ring levels, underrun lengths,
+ *   command latency and TTFS feed fixed-bucket histograms
+ *   (audio_telemetry.c)
+ * - Output Backend: all PCM, volume and amp control goes through
+ *   audio_backend.h - the ES8311 codec (PA on GPIO0) on the board, a
+ *   WAV/null sink in host builds
+ * - Power: music and mixer claim the output; codec and amp step down
+ *   active -> standby -> off on hold timers and can be pre-warmed
+ *   (audio_power.c)
+ * - Clip Cache: SD sound-effect files decoded once into RAM and replayed
+ *   through the mixer (audio_clip_cache.c)
  *
  * Supported formats: WAV, MP3 (via ESP Audio Simple Player codecs)
  */
 
 #include "audio_driver.h"
+#include "audio_mixer.h"
+#include "audio_sd_stream.h"
+#include "audio_net_stream.h"
+#include "audio_i2s_writer.h"
+#include "audio_telemetry.h"
+#include "audio_backend.h"
+#include "audio_clip_cache.h"
+#include "audio_power.h"
 #include "string.h"
 #include "errno.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
 #include "bsp_board.h"
-#include "driver/gpio.h"
+#include "esp_timer.h"
+#include <stdatomic.h>
 
 static const char *TAG = "audio play";
 
@@ -33,7 +63,6 @@ static const char *TAG = "audio play";
 static uint8_t Volume = CONFIG_AUDIO_DEFAULT_VOLUME;  /**< Current volume level (0-100), from Kconfig */
 static esp_asp_handle_t handle = NULL;       /**< Audio Simple Player handle */
 static TaskHandle_t xHandle;                 /**< Player task handle */
-static FILE *audio_file = NULL;              /**< Current audio file handle for SPI-safe reading */
 
 /**
  * @brief Player command types
@@ -43,6 +72,11 @@ typedef enum {
     CMD_STOP,       /**< Stop playback */
     CMD_PAUSE,      /**< Pause playback */
     CMD_RESUME,     /**< Resume paused playback */
+    CMD_APPEND,     /**< Add a file to the playlist */
+    CMD_NEXT,       /**< Skip to the next playlist track */
+    CMD_CLEAR,      /**< Empty the playlist */
+    CMD_TRACK_END,  /**< Decoder finished the current file (from the event callback) */
+    CMD_SPLICED,    /**< Decoder reached a spliced next file (from the input callback) */
     CMD_DEINIT      /**< Deinitialize and exit task */
 } player_cmd_t;
 
@@ -51,37 +85,241 @@ typedef enum {
  */
 typedef struct {
     player_cmd_t cmd;   /**< Command type */
-    char url[128];      /**< File URL (for CMD_PLAY), e.g., "file://sdcard/music.mp3" */
+    char url[128];      /**< File URL (CMD_PLAY/CMD_APPEND), e.g., "file://sdcard/music.mp3" */
+    int64_t stamp;      /**< esp_timer time of the request, start of the TTFS measurement */
+    uint32_t tag;       /**< SD stream tag (CMD_SPLICED) */
 } player_queue_t;
 
 #define QUEUE_LENGTH 5  /**< Maximum queued commands */
+#define PLAYLIST_LEN 8  /**< Maximum queued playlist tracks */
 
 static QueueHandle_t cmd_queue = NULL;  /**< Command queue handle */
 static bool audio_initialized = false;   /**< Initialization flag to prevent double init */
 
+/* Playlist - owned by the player task */
+static char s_playlist[PLAYLIST_LEN][128];
+static uint8_t s_pl_head = 0;
+static uint8_t s_pl_count = 0;
+static uint32_t s_prefetch_tag = 0;     /**< SD stream tag of the prefetched playlist head, 0 = none */
+static uint32_t s_next_tag = 1;
+static bool s_net_input;                /**< Current track comes from audio_net_stream.c */
+
+/* Time to first sample - armed by the player/input side, fired by the output callback */
+static atomic_bool s_ttfs_armed;
+static int64_t s_ttfs_t0;
+static audio_transition_stats_t s_transition_stats;
+
+/* Decode time - decoder task only; the input callback's (SD wait) time is excluded */
+static int64_t s_decode_t0;             /**< End of the previous output callback */
+static uint32_t s_decode_in_us;         /**< Time spent in the input callback since then */
+static atomic_bool s_decode_resync;     /**< Skip one sample (pipeline restarted or paused) */
+
 /*===========================================================================
- * Power Amplifier Control
- * GPIO0 enables/disables the speaker amplifier to save power and reduce noise
+ * Track Transitions
  *===========================================================================*/
 
 /**
- * @brief Enable power amplifier (speaker on)
+ * @brief Start a time-to-first-sample measurement
+ *
+ * @param t0 Time the transition was requested
+ * @param reused true if the running decoder carries on (no pipeline restart)
+ */
+static void ttfs_arm(int64_t t0, bool reused)
+{
+    if (reused) {
+        s_transition_stats.decoder_reuses++;
+    } else {
+        s_transition_stats.pipeline_restarts++;
+    }
+    s_ttfs_t0 = t0;
+    atomic_store_explicit(&s_decode_resync, true, memory_order_relaxed);
+    atomic_store_explicit(&s_ttfs_armed, true, memory_order_release);
+}
+
+/**
+ * @brief Record the first sample of a new track (output callback)
+ */
+static void ttfs_fire(void)
+{
+    uint32_t us = (uint32_t)(esp_timer_get_time() - s_ttfs_t0);
+    s_transition_stats.transitions++;
+    s_transition_stats.last_ttfs_us = us;
+    s_transition_stats.total_ttfs_us += us;
+    if (us > s_transition_stats.max_ttfs_us) {
+        s_transition_stats.max_ttfs_us = us;
+    }
+    audio_telemetry_record(AUDIO_METRIC_TTFS_US, us);
+}
+
+/**
+ * @brief Strip the "file://" prefix -> "/sdcard/..."
+ */
+static const char *url_to_path(const char *url)
+{
+    return strncmp(url, "file://", 7) == 0 ? url + 7 : url;
+}
+
+/**
+ * @brief Stop the pipeline if it is playing (avoids the NULL pipeline error)
+ */
+static void pipeline_stop_if_active(void)
+{
+    esp_asp_state_t state;
+    if (handle != NULL && esp_audio_simple_player_get_state(handle, &state) == ESP_GMF_ERR_OK) {
+        if (state == ESP_ASP_STATE_RUNNING || state == ESP_ASP_STATE_PAUSED) {
+            esp_audio_simple_player_stop(handle);
+        }
+    }
+}
+
+static bool pipeline_is_active(void)
+{
+    esp_asp_state_t state;
+    return handle != NULL && esp_audio_simple_player_get_state(handle, &state) == ESP_GMF_ERR_OK &&
+           (state == ESP_ASP_STATE_RUNNING || state == ESP_ASP_STATE_PAUSED);
+}
+
+/**
+ * @brief Remove the playlist head into @p url
+ */
+static void playlist_pop(char *url, size_t len)
+{
+    strlcpy(url, s_playlist[s_pl_head], len);
+    s_pl_head = (s_pl_head + 1) % PLAYLIST_LEN;
+    s_pl_count--;
+    s_prefetch_tag = 0;
+}
+
+/**
+ * @brief Hand the playlist head to the SD stream for prefetch (once)
+ *
+ * Network URLs are not prefetched; they connect when they start.
+ */
+static void playlist_prefetch(void)
+{
+    if (s_pl_count == 0 || s_prefetch_tag != 0 ||
+        audio_net_stream_is_url(s_playlist[s_pl_head])) {
+        return;
+    }
+    uint32_t tag = s_next_tag++;
+    if (tag == 0) {
+        tag = s_next_tag++;     /* 0 means "none" */
+    }
+    if (audio_sd_stream_queue_next(url_to_path(s_playlist[s_pl_head]), tag) == ESP_OK) {
+        s_prefetch_tag = tag;
+    }
+}
+
+/**
+ * @brief (Re)start the pipeline on a file
+ *
+ * @param url File URL, also used for decoder selection (MP3/WAV by extension)
+ * @param prefetched Take the file the SD stream already opened and buffered
+ * @param cut Interrupting a track: drop its buffered PCM. false at a
+ *            natural track end, so the previous tail plays out.
+ * @param t0 Request time for the TTFS measurement
+ * @return false if the file could not be opened
  */
-static void Audio_PA_EN(void)
+static bool start_track(const char *url, bool prefetched, bool cut, int64_t t0)
 {
-    gpio_set_level(GPIO_NUM_0, 1);
+    pipeline_stop_if_active();
+    if (cut) {
+        audio_i2s_writer_flush();       /* Drop the previous track's tail */
+    }
+
+    /* The read-ahead task owns all SD access (LCD and SD share SPI2 bus).
+     * Opening closes the previous file. A network URL connects here, so an
+     * unreachable server is skipped like a missing file. */
+    esp_err_t err;
+    s_net_input = audio_net_stream_is_url(url);
+    if (s_net_input) {
+        audio_sd_stream_close();
+        err = audio_net_stream_open(url);
+    } else {
+        audio_net_stream_close();
+        err = prefetched ? audio_sd_stream_open_next()
+                         : audio_sd_stream_open(url_to_path(url));
+    }
+    if (err != ESP_OK) {
+        /* Silently skip - file may not exist, this is expected */
+        ESP_LOGD(TAG, "Audio file not found: %s", url);
+        audio_power_release(AUDIO_POWER_CLIENT_MUSIC);  /* Pipeline stopped; hold covers a tail */
+        return false;
+    }
+
+    /* Wake the codec first; its settle time overlaps decoder start-up */
+    audio_power_acquire(AUDIO_POWER_CLIENT_MUSIC);
+    ttfs_arm(t0, false);
+    esp_audio_simple_player_run(handle, url, NULL);
+    return true;
 }
 
 /**
- * @brief Disable power amplifier (speaker off)
+ * @brief Start the first playable playlist track
+ * @return false if the playlist ran out
  */
-static void Audio_PA_DIS(void)
+static bool playlist_start_next(bool cut, int64_t t0)
 {
-    gpio_set_level(GPIO_NUM_0, 0);
+    char url[128];
+    while (s_pl_count > 0) {
+        bool prefetched = s_prefetch_tag != 0;
+        playlist_pop(url, sizeof(url));
+        if (start_track(url, prefetched, cut, t0)) {
+            ESP_LOGI(TAG, "Next track: %s", url);
+            playlist_prefetch();
+            return true;
+        }
+    }
+    return false;
 }
 
+/**
+ * @brief Skip to the next track without tearing down the pipeline
+ *
+ * Only when the prefetched file has the current MP3 format: the decoder is
+ * parked, its input swapped to the pre-buffered file and the old PCM
+ * dropped, then it carries on.
+ *
+ * @return false if the caller has to restart the pipeline instead
+ */
+static bool playlist_skip_in_place(int64_t t0)
+{
+    esp_asp_state_t state;
+    if (s_prefetch_tag == 0 || handle == NULL || s_net_input ||
+        esp_audio_simple_player_get_state(handle, &state) != ESP_GMF_ERR_OK ||
+        state != ESP_ASP_STATE_RUNNING || !audio_sd_stream_next_can_splice()) {
+        return false;
+    }
 
+    esp_audio_simple_player_pause(handle);
+    if (audio_sd_stream_open_next() != ESP_OK) {
+        esp_audio_simple_player_resume(handle);
+        s_prefetch_tag = 0;
+        return false;
+    }
+    audio_i2s_writer_flush();
+    ttfs_arm(t0, true);
+    esp_audio_simple_player_resume(handle);
+
+    char url[128];
+    playlist_pop(url, sizeof(url));
+    ESP_LOGI(TAG, "Skip to: %s", url);
+    playlist_prefetch();
+    return true;
+}
 
+/**
+ * @brief Last track done - play out the ring, close file and release the output
+ */
+static void playback_finished(void)
+{
+    ESP_LOGI(TAG, "Playback finished");
+    audio_i2s_writer_idle();
+    audio_i2s_writer_wait_drained(200);
+    audio_sd_stream_close();
+    audio_net_stream_close();
+    audio_power_release(AUDIO_POWER_CLIENT_MUSIC);
+}
 
 /*===========================================================================
  * Player Task
@@ -103,53 +341,21 @@ void player_task(void *pvParameters)
     while (1) {
         /* Block until a command is received */
         if (xQueueReceive(cmd_queue, &msg, portMAX_DELAY)) {
+            if (msg.stamp != 0) {
+                audio_telemetry_record(AUDIO_METRIC_CMD_WAIT_US,
+                                       (uint32_t)(esp_timer_get_time() - msg.stamp));
+            }
             switch (msg.cmd) {
 
                 case CMD_PLAY: {
-                    /* Start playing a new file */
+                    /* Start playing a new file (the playlist stays queued behind it) */
                     ESP_LOGD(TAG, "Play: %s", msg.url);
 
                     if (handle == NULL) {
                         ESP_LOGD(TAG, "Audio player not initialized");
                         break;
                     }
-
-                    Audio_PA_DIS();                              /* Disable amp during transition */
-
-                    /* Only stop if currently playing to avoid NULL pipeline error */
-                    esp_asp_state_t state;
-                    if (esp_audio_simple_player_get_state(handle, &state) == ESP_GMF_ERR_OK) {
-                        if (state == ESP_ASP_STATE_RUNNING || state == ESP_ASP_STATE_PAUSED) {
-                            esp_audio_simple_player_stop(handle);
-                        }
-                    }
-
-                    /* Close previous file if still open */
-                    if (audio_file != NULL) {
-                        fclose(audio_file);
-                        audio_file = NULL;
-                    }
-
-                    /* Convert file:// URL to filesystem path and open file ourselves
-                     * for SPI-synchronized reading (LCD and SD share SPI2 bus) */
-                    const char *file_path = msg.url;
-                    if (strncmp(file_path, "file://", 7) == 0) {
-                        file_path = msg.url + 7;  /* Skip "file://" prefix -> "/sdcard/..." */
-                    }
-
-                    lvgl_port_lock(0);  /* Lock during file open (uses SD SPI) */
-                    audio_file = fopen(file_path, "rb");
-                    lvgl_port_unlock();
-
-                    if (audio_file == NULL) {
-                        /* Silently skip - file may not exist, this is expected */
-                        ESP_LOGD(TAG, "Audio file not found: %s", file_path);
-                        break;
-                    }
-
-                    /* URL still needed for decoder type detection (MP3/WAV based on extension) */
-                    esp_audio_simple_player_run(handle, msg.url, NULL);
-                    Audio_PA_EN();                               /* Enable amp for playback */
+                    start_track(msg.url, false, true, msg.stamp);
                     break;
                 }
 
@@ -157,60 +363,116 @@ void player_task(void *pvParameters)
                     /* Stop playback completely */
                     ESP_LOGD(TAG, "Stop");
 
-                    /* Only stop if currently playing to avoid NULL pipeline error */
-                    if (handle != NULL) {
-                        esp_asp_state_t state;
-                        if (esp_audio_simple_player_get_state(handle, &state) == ESP_GMF_ERR_OK) {
-                            if (state == ESP_ASP_STATE_RUNNING || state == ESP_ASP_STATE_PAUSED) {
-                                esp_audio_simple_player_stop(handle);
-                            }
-                        }
-                    }
-                    /* Close audio file */
-                    if (audio_file != NULL) {
-                        fclose(audio_file);
-                        audio_file = NULL;
-                    }
-                    Audio_PA_DIS();  /* Disable amp to save power */
+                    pipeline_stop_if_active();
+                    /* Drop buffered PCM and close audio file or stream */
+                    audio_i2s_writer_flush();
+                    audio_sd_stream_close();
+                    audio_net_stream_close();
+                    audio_power_release(AUDIO_POWER_CLIENT_MUSIC);
                     break;
                 }
 
                 case CMD_PAUSE:
                     /* Pause current playback (can resume later) */
                     ESP_LOGD(TAG, "Pause");
-                    Audio_PA_DIS();  /* Disable amp during pause */
                     if (handle != NULL) {
                         esp_audio_simple_player_pause(handle);
                     }
+                    audio_power_release(AUDIO_POWER_CLIENT_MUSIC);
+                    audio_i2s_writer_idle();
+                    atomic_store_explicit(&s_decode_resync, true, memory_order_relaxed);
                     break;
 
                 case CMD_RESUME:
                     /* Resume paused playback */
                     ESP_LOGD(TAG, "Resume");
-                    if (handle != NULL) {
+                    atomic_store_explicit(&s_decode_resync, true, memory_order_relaxed);
+                    if (handle != NULL && pipeline_is_active()) {
+                        audio_power_acquire(AUDIO_POWER_CLIENT_MUSIC);
                         esp_audio_simple_player_resume(handle);
                     }
-                    Audio_PA_EN();  /* Re-enable amp */
                     break;
 
-                case CMD_DEINIT:
-                    /* Cleanup and exit task */
-                    gpio_set_level(GPIO_NUM_0, 0);
-                    ESP_ERROR_CHECK(gpio_reset_pin(GPIO_NUM_0));
-                    /* Close audio file if open */
-                    if (audio_file != NULL) {
-                        fclose(audio_file);
-                        audio_file = NULL;
+                case CMD_APPEND:
+                    /* Queue behind the current track, or start now if idle */
+                    if (s_pl_count == PLAYLIST_LEN) {
+                        ESP_LOGW(TAG, "Playlist full, dropping %s", msg.url);
+                        break;
                     }
+                    strlcpy(s_playlist[(s_pl_head + s_pl_count) % PLAYLIST_LEN], msg.url,
+                            sizeof(s_playlist[0]));
+                    s_pl_count++;
+                    if (handle != NULL && !pipeline_is_active()) {
+                        playlist_start_next(true, msg.stamp);
+                    } else {
+                        playlist_prefetch();
+                    }
+                    break;
+
+                case CMD_NEXT:
+                    /* Skip the current track */
+                    if (s_pl_count == 0 || handle == NULL) {
+                        ESP_LOGD(TAG, "Playlist empty");
+                        break;
+                    }
+                    if (!playlist_skip_in_place(msg.stamp)) {
+                        playlist_start_next(true, msg.stamp);
+                    }
+                    break;
+
+                case CMD_CLEAR:
+                    s_pl_count = 0;
+                    if (s_prefetch_tag != 0) {
+                        audio_sd_stream_cancel_next();
+                        s_prefetch_tag = 0;
+                    }
+                    break;
+
+                case CMD_TRACK_END:
+                    /* Current file fully decoded: restart on the next one while
+                     * the output ring plays the tail */
+                    if (pipeline_is_active()) {
+                        break;  /* Stale - a newer CMD_PLAY already started a track */
+                    }
+                    audio_i2s_writer_idle();
+                    if (!playlist_start_next(false, msg.stamp)) {
+                        playback_finished();
+                    }
+                    break;
+
+                case CMD_SPLICED:
+                    /* The decoder moved on to the prefetched file by itself */
+                    if (msg.tag == s_prefetch_tag && s_pl_count > 0) {
+                        char url[128];
+                        playlist_pop(url, sizeof(url));
+                        ESP_LOGI(TAG, "Gapless: %s", url);
+                        playlist_prefetch();
+                    }
+                    break;
+
+                case CMD_DEINIT: {
+                    /* Cleanup and exit task */
+                    esp_err_t mixer_err = audio_mixer_deinit();
+                    audio_clip_cache_deinit();         /* No voice reads cached clips any more */
+                    audio_power_deinit();              /* Amp off, codec suspended */
+                    audio_backend_release_output();    /* PA pin released */
                     if (handle != NULL) {
                         esp_audio_simple_player_destroy(handle);
                         handle = NULL;
                     }
+                    /* Close audio file or stream if open, stop the reader and writer tasks */
+                    audio_sd_stream_deinit();
+                    audio_net_stream_close();
+                    if (mixer_err == ESP_OK) {
+                        audio_i2s_writer_deinit();     /* Nothing pushes effects any more */
+                    }
+                    audio_telemetry_deinit();
                     vQueueDelete(cmd_queue);
                     cmd_queue = NULL;
                     audio_initialized = false;
                     vTaskDelete(NULL);  /* Delete this task */
                     break;
+                }
 
                 default:
                     ESP_LOGD(TAG, "Unknown command");
@@ -246,7 +508,8 @@ void player_task(void *pvParameters)
  * @brief Output data callback for audio pipeline
  *
  * Called by ESP Audio Simple Player when decoded audio data is ready.
- * Sends the audio samples to the I2S output.
+ * Queues the samples on the output ring; the I2S writer task does the
+ * actual write. I2S shares nothing with LVGL, so no lock is taken here.
  *
  * @param data Audio sample buffer
  * @param data_size Buffer size in bytes
@@ -255,9 +518,21 @@ void player_task(void *pvParameters)
  */
 static int out_data_callback(uint8_t *data, int data_size, void *ctx)
 {
-    lvgl_port_lock(0);  /* Acquire LVGL mutex (coordinates with display updates) */
-    esp_audio_play((int16_t*)data, data_size, 500 / portTICK_PERIOD_MS);
-    lvgl_port_unlock();
+#if CONFIG_AUDIO_TELEMETRY
+    if (!atomic_exchange_explicit(&s_decode_resync, false, memory_order_relaxed) && s_decode_t0 != 0) {
+        int64_t busy = esp_timer_get_time() - s_decode_t0 - s_decode_in_us;
+        audio_telemetry_record(AUDIO_METRIC_DECODE_US, busy > 0 ? (uint32_t)busy : 0);
+    }
+#endif
+    if (atomic_load_explicit(&s_ttfs_armed, memory_order_acquire)) {
+        atomic_store_explicit(&s_ttfs_armed, false, memory_order_relaxed);
+        ttfs_fire();
+    }
+    audio_i2s_writer_push(data, data_size);
+#if CONFIG_AUDIO_TELEMETRY
+    s_decode_t0 = esp_timer_get_time();
+    s_decode_in_us = 0;
+#endif
     return 0;
 }
 
@@ -265,23 +540,34 @@ static int out_data_callback(uint8_t *data, int data_size, void *ctx)
  * @brief Input data callback for audio pipeline (file reading)
  *
  * Called by ESP Audio Simple Player to read audio data from file.
- * Uses LVGL port lock to synchronize with LCD SPI operations since
- * both LCD and SD card share the same SPI2 bus.
+ * Copies from the read-ahead ring filled by the SD stream task (or the
+ * network jitter buffer for http(s) tracks), so no SPI access (and no
+ * LVGL lock) happens on this path. When the data crosses into a spliced
+ * next file the player task is told, so it can advance the playlist.
  *
  * @param data Buffer to fill with audio data
  * @param data_size Number of bytes to read
- * @param ctx Unused (we use static audio_file)
+ * @param ctx Unused
  * @return Number of bytes read, 0 on EOF or error
  */
 static int in_data_callback(uint8_t *data, int data_size, void *ctx)
 {
-    if (audio_file == NULL) {
-        return 0;  /* No file open */
-    }
-    lvgl_port_lock(0);  /* Acquire LVGL mutex to prevent SPI bus conflict with LCD */
-    int ret = fread(data, 1, data_size, audio_file);
-    lvgl_port_unlock();
+#if CONFIG_AUDIO_TELEMETRY
+    int64_t t0 = esp_timer_get_time();
+#endif
+    int ret = s_net_input ? audio_net_stream_read(data, data_size)
+                          : audio_sd_stream_read(data, data_size);
+#if CONFIG_AUDIO_TELEMETRY
+    s_decode_in_us += (uint32_t)(esp_timer_get_time() - t0);
+#endif
     ESP_LOGD(TAG, "%s-%d,rd size:%d", __func__, __LINE__, ret);
+
+    uint32_t tag;
+    if (audio_sd_stream_take_boundary(&tag)) {
+        ttfs_arm(esp_timer_get_time(), true);
+        player_queue_t msg = { .cmd = CMD_SPLICED, .stamp = esp_timer_get_time(), .tag = tag };
+        xQueueSend(cmd_queue, &msg, 0);     /* Never block the decoder */
+    }
     return ret;
 }
 
@@ -304,6 +590,12 @@ static int mock_event_callback(esp_asp_event_pkt_t *event, void *ctx)
         memcpy(&info, event->payload, event->payload_size);
         ESP_LOGI(TAG, "Get info, rate:%d, channels:%d, bits:%d, bitrate=%d",
                  info.sample_rate, info.channels, info.bits, info.bitrate);
+        if (s_net_input) {
+            audio_net_stream_set_bitrate((uint32_t)info.bitrate);  /* ms thresholds -> bytes */
+        }
+#if !CONFIG_ESP_AUDIO_SIMPLE_PLAYER_CH_CVT_EN
+        audio_i2s_writer_set_music_channels(info.channels);   /* Blocks arrive as decoded */
+#endif
     }
     else if (event->type == ESP_ASP_EVENT_TYPE_STATE) {
         /* Playback state changed */
@@ -313,13 +605,13 @@ static int mock_event_callback(esp_asp_event_pkt_t *event, void *ctx)
         ESP_LOGI(TAG, "Get State, %d,%s", st, esp_audio_simple_player_state_to_str(st));
 
         if (st == ESP_ASP_STATE_FINISHED) {
-            /* Playback completed - close file and disable amplifier */
-            ESP_LOGI(TAG, "Playback finished");
-            if (audio_file != NULL) {
-                fclose(audio_file);
-                audio_file = NULL;
+            /* File done - the player task moves on to the next playlist track
+             * or shuts down. The player may be blocked on this pipeline, so
+             * never wait on a full queue here. */
+            player_queue_t msg = { .cmd = CMD_TRACK_END, .stamp = esp_timer_get_time() };
+            if (cmd_queue == NULL || xQueueSend(cmd_queue, &msg, 0) != pdTRUE) {
+                playback_finished();
             }
-            Audio_PA_DIS();
         }
     }
     return 0;
@@ -340,10 +632,11 @@ static void pipeline_init(void)
     esp_log_level_set("*", ESP_LOG_INFO);
 
     /* Configure audio pipeline with custom input callback for SPI-safe file reading.
-     * Both LCD and SD card share SPI2 bus, so we handle file reading ourselves
-     * with proper LVGL mutex synchronization to prevent bus conflicts. */
+     * Both LCD and SD card share SPI2 bus, so file reading is done by the
+     * read-ahead task (audio_sd_stream.c) in large bursts through the
+     * BSP SPI bus arbiter. */
     esp_asp_cfg_t cfg = {
-        .in.cb = in_data_callback,   /* Custom file reader with SPI synchronization */
+        .in.cb = in_data_callback,   /* Copies from the SD read-ahead ring */
         .in.user_ctx = NULL,
         .out.cb = out_data_callback, /* Output to I2S via BSP */
         .out.user_ctx = NULL,
@@ -397,7 +690,8 @@ esp_gmf_err_t Audio_Play_Music(const char* url)
     player_queue_t msg;
     memset(&msg, 0, sizeof(msg));
     msg.cmd = CMD_PLAY;
-    memcpy(msg.url, url, strlen(url));
+    msg.stamp = esp_timer_get_time();
+    strlcpy(msg.url, url, sizeof(msg.url));
     xQueueSend(cmd_queue, &msg, portMAX_DELAY);
     return ESP_GMF_ERR_OK;
 }
@@ -415,7 +709,9 @@ esp_gmf_err_t Audio_Stop_Play(void)
         return ESP_GMF_ERR_OK;  /* Not initialized yet, nothing to stop */
     }
     player_queue_t msg;
+    memset(&msg, 0, sizeof(msg));
     msg.cmd = CMD_STOP;
+    msg.stamp = esp_timer_get_time();
     xQueueSend(cmd_queue, &msg, portMAX_DELAY);
     return ESP_GMF_ERR_OK;
 }
@@ -433,7 +729,9 @@ esp_gmf_err_t Audio_Resume_Play(void)
         return ESP_GMF_ERR_OK;
     }
     player_queue_t msg;
+    memset(&msg, 0, sizeof(msg));
     msg.cmd = CMD_RESUME;
+    msg.stamp = esp_timer_get_time();
     xQueueSend(cmd_queue, &msg, portMAX_DELAY);
     return ESP_GMF_ERR_OK;
 }
@@ -451,7 +749,68 @@ esp_gmf_err_t Audio_Pause_Play(void)
         return ESP_GMF_ERR_OK;
     }
     player_queue_t msg;
+    memset(&msg, 0, sizeof(msg));
     msg.cmd = CMD_PAUSE;
+    msg.stamp = esp_timer_get_time();
+    xQueueSend(cmd_queue, &msg, portMAX_DELAY);
+    return ESP_GMF_ERR_OK;
+}
+
+/**
+ * @brief Append a track to the playlist
+ *
+ * Plays immediately if the player is idle, otherwise after the current
+ * track (pre-buffered, gapless for same-format MP3s).
+ *
+ * @param url File URL (e.g., "file:///sdcard/Music/song.mp3")
+ * @return ESP_GMF_ERR_OK on success
+ */
+esp_gmf_err_t Audio_Queue_Append(const char *url)
+{
+    if (cmd_queue == NULL || url == NULL) {
+        return ESP_GMF_ERR_INVALID_ARG;
+    }
+    player_queue_t msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.cmd = CMD_APPEND;
+    msg.stamp = esp_timer_get_time();
+    strlcpy(msg.url, url, sizeof(msg.url));
+    xQueueSend(cmd_queue, &msg, portMAX_DELAY);
+    return ESP_GMF_ERR_OK;
+}
+
+/**
+ * @brief Skip to the next playlist track
+ *
+ * @return ESP_GMF_ERR_OK on success
+ */
+esp_gmf_err_t Audio_Next(void)
+{
+    if (cmd_queue == NULL) {
+        return ESP_GMF_ERR_OK;
+    }
+    player_queue_t msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.cmd = CMD_NEXT;
+    msg.stamp = esp_timer_get_time();
+    xQueueSend(cmd_queue, &msg, portMAX_DELAY);
+    return ESP_GMF_ERR_OK;
+}
+
+/**
+ * @brief Drop every queued playlist track
+ *
+ * @return ESP_GMF_ERR_OK on success
+ */
+esp_gmf_err_t Audio_Queue_Clear(void)
+{
+    if (cmd_queue == NULL) {
+        return ESP_GMF_ERR_OK;
+    }
+    player_queue_t msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.cmd = CMD_CLEAR;
+    msg.stamp = esp_timer_get_time();
     xQueueSend(cmd_queue, &msg, portMAX_DELAY);
     return ESP_GMF_ERR_OK;
 }
@@ -502,19 +861,44 @@ void Audio_Play_Init(void)
         return;
     }
 
-    /* Configure GPIO0 as output for power amplifier control */
-    gpio_config_t bk_gpio_config = {
-        .mode = GPIO_MODE_OUTPUT,
-        .pin_bit_mask = 1ULL << GPIO_NUM_0
-    };
-    ESP_ERROR_CHECK(gpio_config(&bk_gpio_config));
+    /* Install the output backend (codec: PA pin configured, amp off) */
+    if (audio_backend_get_output() == NULL) {
+        ESP_LOGE(TAG, "No audio output backend");
+        vQueueDelete(cmd_queue);
+        cmd_queue = NULL;
+        return;
+    }
+
+    /* Codec to standby; it suspends itself once the standby hold expires */
+    audio_power_set_volume(Volume);
+    if (audio_power_init() != ESP_OK) {
+        ESP_LOGW(TAG, "Power manager unavailable, output stays as booted");
+    }
 
-    /* Start with amplifier disabled */
-    gpio_set_level(GPIO_NUM_0, 0);
+    /* Start SD read-ahead task before the decoder can ask for data */
+    if (audio_sd_stream_init() != ESP_OK) {
+        ESP_LOGW(TAG, "SD read-ahead unavailable, music playback disabled");
+    }
+
+    /* Histograms and the periodic summary, before any stage can record */
+    audio_telemetry_init();
+
+    /* Start I2S writer before the decoder can produce output */
+    if (audio_i2s_writer_init() != ESP_OK) {
+        ESP_LOGW(TAG, "I2S writer unavailable, music playback disabled");
+    }
 
     /* Initialize audio pipeline and start player task */
     pipeline_init();
-    xTaskCreate(player_task, "player_task", 2048, NULL, 5, &xHandle);
+    xTaskCreate(player_task, "player_task", 3072, NULL, 5, &xHandle);
+
+    /* Start sound-effect mixer (embedded PCM clips) */
+    audio_mixer_init();
+
+    /* Decoded SD sound effects, played through the mixer */
+    if (audio_clip_cache_init() != ESP_OK) {
+        ESP_LOGW(TAG, "Sound-effect cache unavailable, SD effects will stream");
+    }
 
     audio_initialized = true;
 
@@ -532,7 +916,9 @@ void Audio_Play_Init(void)
 void Audio_Play_Deinit(void)
 {
     player_queue_t msg;
+    memset(&msg, 0, sizeof(msg));
     msg.cmd = CMD_DEINIT;
+    msg.stamp = esp_timer_get_time();
     xQueueSend(cmd_queue, &msg, portMAX_DELAY);
 }
 
@@ -551,7 +937,7 @@ void Volume_Adjustment(uint8_t Vol)
         printf("Audio: Volume value out of range. Please enter 0 to %d\r\n", Volume_MAX);
     }
     else {
-        esp_audio_set_play_vol(Vol);
+        audio_power_set_volume(Vol);
         Volume = Vol;
     }
 }
@@ -568,138 +954,270 @@ uint8_t get_audio_volume(void)
 
 /*===========================================================================
  * Embedded PCM Playback
+ * Clips are handed to the mixer task (audio_mixer.c), which resamples them
+ * to 44.1kHz and owns the I2S writes, so callers never block.
  *===========================================================================*/
 
-/** Target sample rate for codec */
-#define TARGET_SAMPLE_RATE  44100
-
-/** Chunk size for PCM output (in samples) */
-#define PCM_CHUNK_SAMPLES   512
-
 /**
  * @brief Play embedded PCM audio data directly
  *
- * Plays raw PCM samples from memory with sample rate conversion.
- * This function is synchronous - it blocks until playback is complete.
+ * Queues the clip on a mixer voice and returns immediately.
  *
  * @param pcm_data Pointer to 16-bit PCM sample array
- * @param samples Number of samples
+ * @param samples Number of samples (frames)
  * @param sample_rate Source sample rate in Hz
  * @param channels Number of channels (1=mono, 2=stereo)
- * @param loop If true, loop continuously (NOT YET IMPLEMENTED)
- * @return ESP_GMF_ERR_OK on success
+ * @param loop If true, loop until stopped with Audio_Stop_Voice()
+ * @return Voice handle, or AUDIO_VOICE_INVALID on failure
  */
-esp_gmf_err_t Audio_Play_PCM(const int16_t *pcm_data, size_t samples,
-                              uint32_t sample_rate, uint8_t channels, bool loop)
+audio_voice_t Audio_Play_PCM(const int16_t *pcm_data, size_t samples,
+                             uint32_t sample_rate, uint8_t channels, bool loop)
 {
     if (!pcm_data || samples == 0) {
         ESP_LOGE(TAG, "Invalid PCM data");
-        return ESP_GMF_ERR_INVALID_ARG;
+        return AUDIO_VOICE_INVALID;
     }
 
-    ESP_LOGI(TAG, "Playing embedded PCM: %zu samples @ %lu Hz, %d ch",
-             samples, (unsigned long)sample_rate, channels);
+    ESP_LOGD(TAG, "Queue embedded PCM: %zu samples @ %lu Hz, %d ch, loop=%d",
+             samples, (unsigned long)sample_rate, channels, loop);
 
-    /* Reset logging flag to get detailed debug output */
-    esp_audio_reset_log_flag();
+    return audio_mixer_play(pcm_data, samples, sample_rate, channels, loop, NULL, NULL);
+}
 
-    /* Prepare codec for direct PCM playback (re-open, set volume, unmute) */
-    esp_err_t prep_ret = esp_audio_prepare_for_pcm();
-    if (prep_ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to prepare codec for PCM: %s", esp_err_to_name(prep_ret));
-        return ESP_GMF_ERR_FAIL;
+/**
+ * @brief Play an embedded IMA-ADPCM clip
+ *
+ * @param clip Mono ADPCM clip descriptor
+ * @param loop If true, loop until stopped with Audio_Stop_Voice()
+ * @return Voice handle, or AUDIO_VOICE_INVALID on failure
+ */
+audio_voice_t Audio_Play_ADPCM(const audio_adpcm_clip_t *clip, bool loop)
+{
+    if (!clip || !clip->data || clip->samples == 0) {
+        ESP_LOGE(TAG, "Invalid ADPCM clip");
+        return AUDIO_VOICE_INVALID;
     }
 
-    /* Restore user-set volume (esp_audio_prepare_for_pcm sets hardcoded PLAYER_VOLUME) */
-    esp_audio_set_play_vol(Volume);
-    ESP_LOGI(TAG, "Volume set to user level: %d", Volume);
+    ESP_LOGD(TAG, "Queue embedded ADPCM: %zu samples (%zu bytes) @ %lu Hz, loop=%d",
+             clip->samples, clip->data_len, (unsigned long)clip->sample_rate, loop);
+
+    return audio_mixer_play_adpcm(clip, loop);
+}
+
+/**
+ * @brief Stop a voice started with Audio_Play_PCM()
+ *
+ * @param voice Voice handle
+ * @return ESP_GMF_ERR_OK if the stop was queued
+ */
+esp_gmf_err_t Audio_Stop_Voice(audio_voice_t voice)
+{
+    if (voice == AUDIO_VOICE_INVALID) {
+        return ESP_GMF_ERR_INVALID_ARG;
+    }
+    return audio_mixer_stop(voice) ? ESP_GMF_ERR_OK : ESP_GMF_ERR_FAIL;
+}
+
+/**
+ * @brief Stop every voice started with Audio_Play_PCM()
+ */
+void Audio_Stop_All_Voices(void)
+{
+    audio_mixer_stop_all();
+}
 
-    /* Enable power amplifier and wait for it to stabilize */
-    Audio_PA_EN();
-    ESP_LOGI(TAG, "PA enabled (GPIO0=1)");
+/**
+ * @brief Check whether a voice is still playing
+ *
+ * @param voice Voice handle
+ * @return true while the clip is queued or playing
+ */
+bool Audio_Voice_Is_Active(audio_voice_t voice)
+{
+    return audio_mixer_is_active(voice);
+}
 
-    vTaskDelay(pdMS_TO_TICKS(20));  /* 20ms for amp and codec startup */
+/*===========================================================================
+ * Public API - SD Stream Statistics
+ *===========================================================================*/
 
-    /* Calculate resampling ratio */
-    float ratio = (float)TARGET_SAMPLE_RATE / (float)sample_rate;
-    size_t output_samples = (size_t)(samples * ratio);
+/**
+ * @brief Get SD read-ahead stream counters
+ *
+ * @param stats Output snapshot
+ */
+void Audio_Get_Stream_Stats(audio_stream_stats_t *stats)
+{
+    audio_sd_stream_get_stats(stats);
+}
 
-    /* Allocate output buffer for stereo samples */
-    int16_t *out_buf = malloc(PCM_CHUNK_SAMPLES * 2 * sizeof(int16_t));
-    if (!out_buf) {
-        ESP_LOGE(TAG, "Failed to allocate PCM buffer");
-        Audio_PA_DIS();
-        return ESP_GMF_ERR_MEMORY_LACK;
-    }
+/**
+ * @brief Reset SD read-ahead stream counters
+ */
+void Audio_Reset_Stream_Stats(void)
+{
+    audio_sd_stream_reset_stats();
+}
 
-    /* Process in chunks with linear interpolation resampling */
-    size_t out_idx = 0;
-    while (out_idx < output_samples) {
-        size_t chunk_size = PCM_CHUNK_SAMPLES;
-        if (out_idx + chunk_size > output_samples) {
-            chunk_size = output_samples - out_idx;
-        }
+/*===========================================================================
+ * Public API - Net Stream Statistics
+ *===========================================================================*/
 
-        /* Fill output buffer with resampled stereo data */
-        for (size_t i = 0; i < chunk_size; i++) {
-            /* Calculate source sample position (fractional) */
-            float src_pos = (float)(out_idx + i) / ratio;
-            size_t src_idx = (size_t)src_pos;
-            float frac = src_pos - (float)src_idx;
-
-            /* Clamp to valid range */
-            if (src_idx >= samples - 1) {
-                src_idx = samples - 2;
-                frac = 1.0f;
-            }
+/**
+ * @brief Get HTTP stream counters
+ *
+ * @param stats Output snapshot
+ */
+void Audio_Get_Net_Stream_Stats(audio_net_stream_stats_t *stats)
+{
+    audio_net_stream_get_stats(stats);
+}
 
-            /* Linear interpolation */
-            int16_t sample;
-            if (channels == 1) {
-                /* Mono input */
-                int32_t s0 = pcm_data[src_idx];
-                int32_t s1 = pcm_data[src_idx + 1];
-                sample = (int16_t)(s0 + (int32_t)(frac * (float)(s1 - s0)));
-            } else {
-                /* Stereo input - just use left channel for now */
-                int32_t s0 = pcm_data[src_idx * 2];
-                int32_t s1 = pcm_data[(src_idx + 1) * 2];
-                sample = (int16_t)(s0 + (int32_t)(frac * (float)(s1 - s0)));
-            }
+/**
+ * @brief Reset HTTP stream counters
+ */
+void Audio_Reset_Net_Stream_Stats(void)
+{
+    audio_net_stream_reset_stats();
+}
 
-            /* Output as stereo (duplicate to both channels) */
-            out_buf[i * 2] = sample;      /* Left */
-            out_buf[i * 2 + 1] = sample;  /* Right */
-        }
+/*===========================================================================
+ * Public API - Output Statistics
+ *===========================================================================*/
 
-        /* Send to codec */
-        esp_err_t play_ret = esp_audio_play(out_buf, chunk_size * 2 * sizeof(int16_t), 100 / portTICK_PERIOD_MS);
-        if (out_idx == 0) {
-            /* Log first chunk details */
-            ESP_LOGI(TAG, "First chunk: samples[0-3]=%d,%d,%d,%d ret=%d",
-                     out_buf[0], out_buf[1], out_buf[2], out_buf[3], play_ret);
-        }
-        out_idx += chunk_size;
+/**
+ * @brief Get decoder output ring / I2S writer counters
+ *
+ * @param stats Output snapshot
+ */
+void Audio_Get_Output_Stats(audio_output_stats_t *stats)
+{
+    audio_i2s_writer_get_stats(stats);
+}
+
+/**
+ * @brief Reset decoder output ring / I2S writer counters
+ */
+void Audio_Reset_Output_Stats(void)
+{
+    audio_i2s_writer_reset_stats();
+}
+
+/*===========================================================================
+ * Public API - Mixer Statistics
+ *===========================================================================*/
+
+/**
+ * @brief Get sound-effect mixer counters
+ */
+void Audio_Get_Mixer_Stats(audio_mixer_stats_t *stats)
+{
+    audio_mixer_get_stats(stats);
+}
+
+/**
+ * @brief Reset sound-effect mixer counters
+ */
+void Audio_Reset_Mixer_Stats(void)
+{
+    audio_mixer_reset_stats();
+}
+
+/*===========================================================================
+ * Public API - Transition Statistics
+ *===========================================================================*/
+
+/**
+ * @brief Get track transition timings
+ *
+ * @param stats Output snapshot
+ */
+void Audio_Get_Transition_Stats(audio_transition_stats_t *stats)
+{
+    if (stats != NULL) {
+        *stats = s_transition_stats;
     }
+}
+
+/**
+ * @brief Reset track transition timings
+ */
+void Audio_Reset_Transition_Stats(void)
+{
+    memset(&s_transition_stats, 0, sizeof(s_transition_stats));
+}
+
+/**
+ * @brief Snapshot one pipeline metric histogram
+ *
+ * @param metric Metric to read
+ * @param[out] hist Receives the histogram
+ */
+void Audio_Get_Histogram(audio_metric_t metric, audio_histogram_t *hist)
+{
+    audio_telemetry_get(metric, hist);
+}
 
-    /* Send silence to flush the DMA buffer and ensure all audio reaches the speaker */
-    memset(out_buf, 0, PCM_CHUNK_SAMPLES * 2 * sizeof(int16_t));
-    esp_audio_play(out_buf, PCM_CHUNK_SAMPLES * 2 * sizeof(int16_t), 100 / portTICK_PERIOD_MS);
-    esp_audio_play(out_buf, PCM_CHUNK_SAMPLES * 2 * sizeof(int16_t), 100 / portTICK_PERIOD_MS);
-    ESP_LOGI(TAG, "Sent silence to flush DMA buffer");
+/**
+ * @brief Upper edge (exclusive) of a histogram bucket
+ */
+uint32_t Audio_Histogram_Bucket_Limit(audio_metric_t metric, int bucket)
+{
+    return audio_telemetry_bucket_limit(metric, bucket);
+}
 
-    free(out_buf);
+/**
+ * @brief Percentile estimate (bucket resolution, capped at the maximum)
+ */
+uint32_t Audio_Histogram_Percentile(audio_metric_t metric, const audio_histogram_t *hist, uint8_t percent)
+{
+    return audio_telemetry_percentile(metric, hist, percent);
+}
 
-    /* Wait for I2S DMA buffer to finish outputting before disabling PA.
-     * At 44.1kHz stereo 32-bit, the I2S buffer can hold a few ms of audio.
-     * Add 100ms delay to ensure last samples reach the speaker. */
-    ESP_LOGI(TAG, "Waiting for I2S DMA to finish...");
-    vTaskDelay(pdMS_TO_TICKS(100));
+/**
+ * @brief Clear every pipeline metric histogram
+ */
+void Audio_Reset_Histograms(void)
+{
+    audio_telemetry_reset();
+}
 
-    /* Disable power amplifier after playback */
-    Audio_PA_DIS();
-    ESP_LOGI(TAG, "PA disabled (GPIO0=0)");
+/**
+ * @brief Log a one-line summary of every metric that has samples
+ */
+void Audio_Log_Telemetry(void)
+{
+    audio_telemetry_log();
+}
 
-    ESP_LOGI(TAG, "Embedded PCM playback complete");
-    return ESP_GMF_ERR_OK;
-}
\ No newline at end of file
+/*===========================================================================
+ * Public API - Output Power
+ *===========================================================================*/
+
+/**
+ * @brief Power up codec and amplifier ahead of an expected sound
+ *
+ * @param hold_ms Time to stay active (0 = Kconfig active hold)
+ */
+void Audio_Prewarm(uint32_t hold_ms)
+{
+    audio_power_prewarm(hold_ms);
+}
+
+/**
+ * @brief Get output power state counters
+ *
+ * @param stats Output snapshot
+ */
+void Audio_Get_Power_Stats(audio_power_stats_t *stats)
+{
+    audio_power_get_stats(stats);
+}
+
+/**
+ * @brief Reset output power state counters
+ */
+void Audio_Reset_Power_Stats(void)
+{
+    audio_power_reset_stats();
+}
@@ -0,0 +1,269 @@
+/**
+ * @file audio_fft.c
+ * @brief 256-point Q15 radix-4 FFT (decimation in frequency)
+ *
+ * Twiddles and the window come from one 129-entry quarter-wave sine table
+ * (1/512 turn resolution), so nothing is computed at run time and the
+ * kernel needs no FPU. Each stage writes its branches in bit-reversed
+ * slot order, so a plain 8-bit bit reversal restores natural order.
+ *
+ * audio_fft_benchmark() at the end (CONFIG_APP_SELF_TEST) times the kernel
+ * and checks it against a double-precision DFT; it is the only part that
+ * uses ESP-IDF.
+ */
+
+#include "audio_fft.h"
+#include "sdkconfig.h"
+
+#if CONFIG_APP_SELF_TEST
+#include "audio_spectrum.h"
+#include "esp_log.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#if CONFIG_IDF_TARGET_LINUX
+#include <time.h>
+#else
+#include "esp_cpu.h"
+#endif
+#endif
+
+/** sin(k * pi/256) in Q15, k = 0..128 */
+static const int16_t s_quarter_sin[129] = {
+        0,   402,   804,  1206,  1608,  2009,  2411,  2811,
+     3212,  3612,  4011,  4410,  4808,  5205,  5602,  5998,
+     6393,  6787,  7180,  7571,  7962,  8351,  8740,  9127,
+     9512,  9896, 10279, 10660, 11039, 11417, 11793, 12167,
+    12540, 12910, 13279, 13646, 14010, 14373, 14733, 15091,
+    15447, 15800, 16151, 16500, 16846, 17190, 17531, 17869,
+    18205, 18538, 18868, 19195, 19520, 19841, 20160, 20475,
+    20788, 21097, 21403, 21706, 22006, 22302, 22595, 22884,
+    23170, 23453, 23732, 24008, 24279, 24548, 24812, 25073,
+    25330, 25583, 25833, 26078, 26320, 26557, 26791, 27020,
+    27246, 27467, 27684, 27897, 28106, 28311, 28511, 28707,
+    28899, 29086, 29269, 29448, 29622, 29792, 29957, 30118,
+    30274, 30425, 30572, 30715, 30853, 30986, 31114, 31238,
+    31357, 31471, 31581, 31686, 31786, 31881, 31972, 32058,
+    32138, 32214, 32286, 32352, 32413, 32470, 32522, 32568,
+    32610, 32647, 32679, 32706, 32729, 32746, 32758, 32766,
+    32767,
+};
+
+/*===========================================================================
+ * Helpers
+ *===========================================================================*/
+
+/**
+ * @brief sin(2*pi * i / 512) in Q15
+ */
+static inline int32_t sin512(uint32_t i)
+{
+    uint32_t r = i & 127;
+    switch ((i >> 7) & 3) {
+        case 0:  return s_quarter_sin[r];
+        case 1:  return s_quarter_sin[128 - r];
+        case 2:  return -s_quarter_sin[r];
+        default: return -s_quarter_sin[128 - r];
+    }
+}
+
+static inline int32_t cos512(uint32_t i)
+{
+    return sin512(i + 128);
+}
+
+static inline int16_t sat16(int32_t v)
+{
+    return v > INT16_MAX ? INT16_MAX : (v < INT16_MIN ? INT16_MIN : (int16_t)v);
+}
+
+/**
+ * @brief out = (re + j*im) * (c - j*s), Q15 twiddle, rounded
+ */
+static inline void twiddle(audio_fft_cpx_t *out, int32_t re, int32_t im, int32_t c, int32_t s)
+{
+    out->re = sat16((re * c + im * s + (1 << 14)) >> 15);
+    out->im = sat16((im * c - re * s + (1 << 14)) >> 15);
+}
+
+static inline uint32_t bit_reverse8(uint32_t v)
+{
+    v = ((v & 0xF0) >> 4) | ((v & 0x0F) << 4);
+    v = ((v & 0xCC) >> 2) | ((v & 0x33) << 2);
+    v = ((v & 0xAA) >> 1) | ((v & 0x55) << 1);
+    return v;
+}
+
+/*===========================================================================
+ * Public API
+ *===========================================================================*/
+
+void audio_fft_window_hann(const int16_t *in, audio_fft_cpx_t *out)
+{
+    /* w[n] = sin^2(pi * n / N) */
+    for (uint32_t n = 0; n < AUDIO_FFT_N; n++) {
+        int32_t s = sin512(n);
+        int32_t w = (s * s) >> 15;
+        out[n].re = (int16_t)((in[n] * w) >> 15);
+        out[n].im = 0;
+    }
+}
+
+void audio_fft_q15(audio_fft_cpx_t *x)
+{
+    for (uint32_t n2 = AUDIO_FFT_N; n2 > 1; n2 >>= 2) {
+        uint32_t n1 = n2 >> 2;
+        uint32_t step = 2 * (AUDIO_FFT_N / n2);     /* Twiddle step in 1/512 turns */
+
+        for (uint32_t j = 0; j < n1; j++) {
+            uint32_t a1 = j * step;
+            int32_t c1 = cos512(a1), s1 = sin512(a1);
+            int32_t c2 = cos512(2 * a1), s2 = sin512(2 * a1);
+            int32_t c3 = cos512(3 * a1), s3 = sin512(3 * a1);
+
+            for (uint32_t i = j; i < AUDIO_FFT_N; i += n2) {
+                audio_fft_cpx_t *p0 = &x[i];
+                audio_fft_cpx_t *p1 = p0 + n1;
+                audio_fft_cpx_t *p2 = p1 + n1;
+                audio_fft_cpx_t *p3 = p2 + n1;
+
+                int32_t ar = p0->re >> 2, ai = p0->im >> 2;
+                int32_t br = p1->re >> 2, bi = p1->im >> 2;
+                int32_t cr = p2->re >> 2, ci = p2->im >> 2;
+                int32_t dr = p3->re >> 2, di = p3->im >> 2;
+
+                int32_t t0r = ar + cr, t0i = ai + ci;
+                int32_t t1r = ar - cr, t1i = ai - ci;
+                int32_t t2r = br + dr, t2i = bi + di;
+                int32_t t3r = br - dr, t3i = bi - di;
+
+                p0->re = sat16(t0r + t2r);
+                p0->im = sat16(t0i + t2i);
+                /* Slots 1 and 2 swapped: binary bit-reversed output order */
+                twiddle(p1, t0r - t2r, t0i - t2i, c2, s2);          /* X[4k+2] */
+                twiddle(p2, t1r + t3i, t1i - t3r, c1, s1);          /* X[4k+1] */
+                twiddle(p3, t1r - t3i, t1i + t3r, c3, s3);          /* X[4k+3] */
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < AUDIO_FFT_N; i++) {
+        uint32_t r = bit_reverse8(i);
+        if (r > i) {
+            audio_fft_cpx_t t = x[i];
+            x[i] = x[r];
+            x[r] = t;
+        }
+    }
+}
+
+#if CONFIG_APP_SELF_TEST
+/*===========================================================================
+ * Benchmark (CONFIG_APP_SELF_TEST)
+ *===========================================================================*/
+
+static const char *TAG = "audio fft";
+
+#define BENCH_TONE_BIN      17      /**< Test tone, between two band edges */
+#define BENCH_MAX_ERR_LSB   16      /**< Pass bound against the reference DFT */
+
+static inline uint32_t bench_now(void)
+{
+#if CONFIG_IDF_TARGET_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+#else
+    return esp_cpu_get_cycle_count();
+#endif
+}
+
+/**
+ * @brief Largest difference between @p x and the exact DFT of @p in / N
+ */
+static uint32_t reference_error(const audio_fft_cpx_t *in, const audio_fft_cpx_t *x)
+{
+    double c[AUDIO_FFT_N], s[AUDIO_FFT_N];
+    for (uint32_t n = 0; n < AUDIO_FFT_N; n++) {
+        c[n] = cos(2.0 * M_PI * n / AUDIO_FFT_N);
+        s[n] = sin(2.0 * M_PI * n / AUDIO_FFT_N);
+    }
+
+    double worst = 0.0;
+    for (uint32_t k = 0; k < AUDIO_FFT_N; k++) {
+        double re = 0.0, im = 0.0;
+        for (uint32_t n = 0; n < AUDIO_FFT_N; n++) {
+            uint32_t a = (k * n) & (AUDIO_FFT_N - 1);
+            re += in[n].re * c[a] + in[n].im * s[a];
+            im += in[n].im * c[a] - in[n].re * s[a];
+        }
+        double dr = fabs(re / AUDIO_FFT_N - x[k].re);
+        double di = fabs(im / AUDIO_FFT_N - x[k].im);
+        worst = dr > worst ? dr : worst;
+        worst = di > worst ? di : worst;
+    }
+    return (uint32_t)lrint(worst);
+}
+
+esp_err_t audio_fft_benchmark(uint32_t frames, audio_fft_bench_t *bench)
+{
+    if (bench == NULL || frames == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    int16_t *pcm = malloc(AUDIO_FFT_N * sizeof(int16_t));
+    audio_fft_cpx_t *in = malloc(AUDIO_FFT_N * sizeof(audio_fft_cpx_t));
+    audio_fft_cpx_t *x = malloc(AUDIO_FFT_N * sizeof(audio_fft_cpx_t));
+    if (pcm == NULL || in == NULL || x == NULL) {
+        free(pcm);
+        free(in);
+        free(x);
+        return ESP_ERR_NO_MEM;
+    }
+
+    /* Half-scale tone plus 1/16-scale noise */
+    uint32_t seed = 1;
+    for (uint32_t n = 0; n < AUDIO_FFT_N; n++) {
+        seed = seed * 1664525u + 1013904223u;
+        pcm[n] = (int16_t)(16384.0 * sin(2.0 * M_PI * BENCH_TONE_BIN * n / AUDIO_FFT_N)
+                           + (int16_t)(seed >> 16) / 16);
+    }
+
+    uint32_t window = 0, fft = 0;
+    for (uint32_t f = 0; f < frames; f++) {
+        uint32_t t0 = bench_now();
+        audio_fft_window_hann(pcm, in);
+        uint32_t t1 = bench_now();
+        for (uint32_t n = 0; n < AUDIO_FFT_N; n++) {
+            x[n] = in[n];
+        }
+        uint32_t t2 = bench_now();
+        audio_fft_q15(x);
+        uint32_t t3 = bench_now();
+        window += t1 - t0;
+        fft += t3 - t2;
+    }
+    bench->window = window / frames;
+    bench->fft = fft / frames;
+
+    uint32_t peak = 0, peak_power = 0;
+    for (uint32_t k = 1; k < AUDIO_FFT_N / 2; k++) {
+        uint32_t power = (uint32_t)(x[k].re * x[k].re) + (uint32_t)(x[k].im * x[k].im);
+        if (power > peak_power) {
+            peak_power = power;
+            peak = k;
+        }
+    }
+    bench->peak_bin = peak;
+    bench->max_err_lsb = reference_error(in, x);
+
+    free(pcm);
+    free(in);
+    free(x);
+
+    bool ok = bench->peak_bin == BENCH_TONE_BIN && bench->max_err_lsb <= BENCH_MAX_ERR_LSB;
+    ESP_LOGI(TAG, "Per frame: window %lu, FFT %lu; peak bin %lu, max error %lu LSB: %s",
+             (unsigned long)bench->window, (unsigned long)bench->fft, (unsigned long)bench->peak_bin,
+             (unsigned long)bench->max_err_lsb, ok ? "pass" : "FAIL");
+    return ok ? ESP_OK : ESP_FAIL;
+}
+#endif /* CONFIG_APP_SELF_TEST */
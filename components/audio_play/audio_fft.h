@@ -0,0 +1,47 @@
+/**
+ * @file audio_fft.h
+ * @brief 256-point Q15 radix-4 FFT for the spectrum analyzer (internal to audio_play)
+ *
+ * Plain C with no ESP-IDF dependencies, so the kernel also builds on the
+ * host. 256 = 4^4, so the transform is four pure radix-4 stages. Every
+ * butterfly scales its inputs by 1/4, which keeps all intermediates in
+ * int16 range: the output is the DFT divided by 256.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AUDIO_FFT_N     256     /**< Transform length */
+
+/**
+ * @brief One Q15 complex sample
+ */
+typedef struct {
+    int16_t re;
+    int16_t im;
+} audio_fft_cpx_t;
+
+/**
+ * @brief Apply a Hann window to real samples and load them as complex input
+ *
+ * @param in AUDIO_FFT_N real samples
+ * @param[out] out AUDIO_FFT_N complex samples (imaginary parts zero)
+ */
+void audio_fft_window_hann(const int16_t *in, audio_fft_cpx_t *out);
+
+/**
+ * @brief Forward FFT in place, natural-order output scaled by 1/AUDIO_FFT_N
+ *
+ * A full-scale Hann-windowed sine lands at about 8192 in its bin.
+ *
+ * @param x AUDIO_FFT_N complex samples
+ */
+void audio_fft_q15(audio_fft_cpx_t *x);
+
+#ifdef __cplusplus
+}
+#endif
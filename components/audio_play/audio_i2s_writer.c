@@ -0,0 +1,515 @@
+/**
+ * @file audio_i2s_writer.c
+ * @brief Decoder output ring drained by a dedicated I2S writer task
+ *
+ * out_data_callback() used to call esp_audio_play() inside the LVGL mutex,
+ * so a long UI frame stalled the decoder and the I2S DMA ran dry (audible
+ * clicks). I2S output never touches LVGL or the SPI bus; this module takes
+ * the lock off the path entirely.
+ *
+ * Architecture:
+ * - PCM Ring: CONFIG_AUDIO_PCM_RING_KB bytes, single producer (decoder
+ *   callback) / single consumer (writer task). Free-running byte counters
+ *   are C11 atomics - no lock on either side.
+ * - Writer Task: CONFIG_AUDIO_I2S_WRITER_TASK_PRIORITY, above LVGL and the
+ *   decoder. Hands up to WRITER_BLOCK_BYTES straight from the ring to the
+ *   output backend (esp_audio_play() on the board, no extra copy) and
+ *   blocks there while DMA is full.
+ * - Backpressure: a full ring makes the decoder wait on a semaphore the
+ *   writer gives after every block; only a wait longer than
+ *   WRITER_PUSH_WAIT_MS drops data (overrun).
+ * - Write Errors: a block the backend rejects stays in the ring and is
+ *   retried after WRITER_RETRY_MS; it is counted and logged, never
+ *   silently skipped. Stop and flush still cut the retries short.
+ * - Underruns: the ring running dry while the decoder is still streaming.
+ *   Pause/end-of-track mark the producer idle so the tail is not counted.
+ * - Effects: the mixer task pushes its rendered chunks into a second,
+ *   smaller ring (WRITER_FX_BYTES). The writer adds them into each music
+ *   block in place (saturating) or, with no music queued, writes them on
+ *   their own. This task is the only one that writes to the output backend,
+ *   so music and effects are summed rather than interleaved block by block.
+ */
+
+#include "audio_i2s_writer.h"
+#include "audio_telemetry.h"
+#include "audio_spectrum_tap.h"
+#include "audio_backend.h"
+#include "bsp_board.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <stdatomic.h>
+#include <string.h>
+
+static const char *TAG = "audio i2s";
+
+/*===========================================================================
+ * Configuration
+ *===========================================================================*/
+
+#define WRITER_RING_BYTES   (CONFIG_AUDIO_PCM_RING_KB * 1024)
+#define WRITER_BLOCK_BYTES  2048    /**< Max bytes per esp_audio_play() (~11.6ms stereo 44.1kHz) */
+#define WRITER_PUSH_WAIT_MS 500     /**< Decoder gives up on a full ring after this long */
+#define WRITER_PLAY_WAIT_MS 100     /**< Per-try wait for DMA space */
+#define WRITER_RETRY_MS     20      /**< Pause before retrying a block the backend rejected */
+#define WRITER_FX_BYTES     4096    /**< Effects ring, four mixer chunks (~23ms) */
+#define WRITER_TASK_STACK   3072
+#define WRITER_TASK_PRIO    CONFIG_AUDIO_I2S_WRITER_TASK_PRIORITY
+
+_Static_assert((WRITER_RING_BYTES & (WRITER_RING_BYTES - 1)) == 0,
+               "CONFIG_AUDIO_PCM_RING_KB must be a power of two");
+_Static_assert(WRITER_BLOCK_BYTES <= WRITER_RING_BYTES,
+               "Ring must hold at least one writer block");
+_Static_assert((WRITER_FX_BYTES & (WRITER_FX_BYTES - 1)) == 0,
+               "WRITER_FX_BYTES must be a power of two");
+
+/*===========================================================================
+ * Module State
+ *===========================================================================*/
+
+static uint8_t *s_ring = NULL;
+static atomic_uint s_wr;                    /**< Bytes pushed (decoder only writes) */
+static atomic_uint s_rd;                    /**< Bytes written to I2S (writer only writes) */
+static atomic_bool s_streaming;             /**< Decoder is producing; empty ring = underrun */
+static atomic_bool s_flush_req;             /**< Writer drops buffered data, then clears */
+
+static uint8_t *s_fx = NULL;                /**< Effects ring, whole stereo frames */
+static atomic_uint s_fx_wr;                 /**< Bytes pushed (mixer only writes) */
+static atomic_uint s_fx_rd;                 /**< Bytes mixed or written (writer only writes) */
+static atomic_uint s_music_channels = 2;    /**< Channels of the decoder's blocks */
+
+static SemaphoreHandle_t s_space_sem = NULL;  /**< Given by the writer after each block */
+static SemaphoreHandle_t s_fx_space_sem = NULL;  /**< Given by the writer after consuming effects */
+static TaskHandle_t s_task = NULL;
+static volatile bool s_running = false;
+
+static audio_output_stats_t s_stats;
+static uint32_t s_error_streak;             /**< Failed writes since the last good one */
+
+/*===========================================================================
+ * Helpers
+ *===========================================================================*/
+
+static inline uint32_t ring_level(void)
+{
+    return atomic_load_explicit(&s_wr, memory_order_acquire) -
+           atomic_load_explicit(&s_rd, memory_order_acquire);
+}
+
+static inline uint32_t fx_level(void)
+{
+    return atomic_load_explicit(&s_fx_wr, memory_order_acquire) -
+           atomic_load_explicit(&s_fx_rd, memory_order_relaxed);
+}
+
+static void fx_consume(uint32_t bytes)
+{
+    atomic_fetch_add_explicit(&s_fx_rd, bytes, memory_order_release);
+    xSemaphoreGive(s_fx_space_sem);
+}
+
+static inline int16_t sat16(int32_t s)
+{
+    if (s > INT16_MAX) s = INT16_MAX;
+    if (s < INT16_MIN) s = INT16_MIN;
+    return (int16_t)s;
+}
+
+/**
+ * @brief Add queued effects into a music block in place, saturating
+ *
+ * Effects are consumed in whole stereo frames, one per music frame. Mono
+ * music (decoder output without channel conversion) gets the average of
+ * left and right, so effects keep their speed.
+ */
+static void mix_effects(int16_t *pcm, uint32_t len)
+{
+    bool mono = atomic_load_explicit(&s_music_channels, memory_order_relaxed) == 1;
+    uint32_t frames = len / (mono ? sizeof(int16_t) : 2 * sizeof(int16_t));
+    uint32_t fx_frames = fx_level() / (2 * sizeof(int16_t));
+    if (frames > fx_frames) {
+        frames = fx_frames;
+    }
+    if (frames == 0) {
+        return;
+    }
+
+    const int16_t *fx = (const int16_t *)s_fx;
+    uint32_t idx = atomic_load_explicit(&s_fx_rd, memory_order_relaxed) / sizeof(int16_t);
+    const uint32_t mask = WRITER_FX_BYTES / sizeof(int16_t) - 1;
+    for (uint32_t f = 0; f < frames; f++) {
+        int32_t l = fx[(idx + 2 * f) & mask];
+        int32_t r = fx[(idx + 2 * f + 1) & mask];
+        if (mono) {
+            pcm[f] = sat16(pcm[f] + (l + r) / 2);
+        } else {
+            pcm[2 * f] = sat16(pcm[2 * f] + l);
+            pcm[2 * f + 1] = sat16(pcm[2 * f + 1] + r);
+        }
+    }
+    fx_consume(frames * 2 * sizeof(int16_t));
+}
+
+/**
+ * @brief Hand one contiguous block to I2S, retrying while DMA is full
+ * @return ESP_OK once written, ESP_ERR_TIMEOUT if a stop or flush ended the
+ *         wait, or the backend's error (block not played)
+ */
+static esp_err_t write_block(const uint8_t *src, uint32_t len)
+{
+    const audio_out_backend_t *out = audio_backend_get_output();
+    int64_t t0 = esp_timer_get_time();
+    esp_err_t ret;
+    do {
+        ret = out->write(out->ctx, (const int16_t *)src, len, WRITER_PLAY_WAIT_MS);
+    } while (ret == ESP_ERR_TIMEOUT && s_running &&
+             !atomic_load_explicit(&s_flush_req, memory_order_relaxed));
+    uint32_t us = (uint32_t)(esp_timer_get_time() - t0);
+    audio_telemetry_record(AUDIO_METRIC_I2S_WRITE_US, us);
+
+    if (ret != ESP_OK) {
+        if (ret != ESP_ERR_TIMEOUT) {
+            s_stats.write_errors++;
+            if (s_error_streak++ == 0) {
+                ESP_LOGW(TAG, "Output write of %lu bytes failed: %s, retrying",
+                         (unsigned long)len, esp_err_to_name(ret));
+            }
+        }
+        return ret;
+    }
+    if (s_error_streak > 0) {
+        ESP_LOGI(TAG, "Output recovered after %lu failed writes", (unsigned long)s_error_streak);
+        s_error_streak = 0;
+    }
+
+    s_stats.i2s_writes++;
+    s_stats.bytes_out += len;
+    if (us > s_stats.max_write_us) {
+        s_stats.max_write_us = us;
+    }
+    return ESP_OK;
+}
+
+/*===========================================================================
+ * Writer Task
+ *===========================================================================*/
+
+static void writer_task(void *pvParameters)
+{
+    bool primed = false;    /**< At least one block written since the stream (re)started */
+    bool starved = false;   /**< Current dry spell already counted */
+    int64_t starved_at = 0; /**< Start of the current dry spell */
+    uint32_t pending = 0;   /**< Bytes at s_rd already tapped and mixed, waiting for a retry */
+
+    while (s_running) {
+        if (atomic_load_explicit(&s_flush_req, memory_order_acquire)) {
+            atomic_store_explicit(&s_rd, atomic_load_explicit(&s_wr, memory_order_acquire),
+                                  memory_order_release);
+            primed = false;
+            starved = false;
+            pending = 0;
+            atomic_store_explicit(&s_flush_req, false, memory_order_release);
+            xSemaphoreGive(s_space_sem);
+        }
+
+        uint32_t rd = atomic_load_explicit(&s_rd, memory_order_relaxed);
+        uint32_t level = atomic_load_explicit(&s_wr, memory_order_acquire) - rd;
+
+        if (level == 0) {
+            if (atomic_load_explicit(&s_streaming, memory_order_relaxed)) {
+                if (primed && !starved) {
+                    s_stats.underruns++;
+                    starved = true;
+                    starved_at = esp_timer_get_time();
+                }
+            } else {
+                primed = false;
+                starved = false;    /* Tail of the stream, not a gap */
+            }
+
+            /* No music queued: effects go out on their own */
+            uint32_t fx_len = fx_level();
+            if (fx_len > 0) {
+                uint32_t fx_off = atomic_load_explicit(&s_fx_rd, memory_order_relaxed) &
+                                  (WRITER_FX_BYTES - 1);
+                if (fx_len > WRITER_BLOCK_BYTES) {
+                    fx_len = WRITER_BLOCK_BYTES;
+                }
+                if (fx_len > WRITER_FX_BYTES - fx_off) {
+                    fx_len = WRITER_FX_BYTES - fx_off;
+                }
+                if (write_block(&s_fx[fx_off], fx_len) == ESP_OK) {
+                    fx_consume(fx_len);
+                } else if (s_running) {
+                    vTaskDelay(pdMS_TO_TICKS(WRITER_RETRY_MS));
+                }
+                continue;
+            }
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        /* Largest contiguous block up to WRITER_BLOCK_BYTES, whole samples only */
+        uint32_t off = rd & (WRITER_RING_BYTES - 1);
+        uint32_t len = level;
+        if (len > WRITER_BLOCK_BYTES) {
+            len = WRITER_BLOCK_BYTES;
+        }
+        if (len > WRITER_RING_BYTES - off) {
+            len = WRITER_RING_BYTES - off;
+        }
+        len &= ~1u;
+        if (pending > 0) {
+            len = pending;  /* Retry exactly what was mixed last time */
+        }
+        if (len == 0) {
+            len = 1;        /* Stray odd byte - drop it */
+        } else {
+            if (pending == 0) {
+                if (starved) {
+                    audio_telemetry_record(AUDIO_METRIC_UNDERRUN_US,
+                                           (uint32_t)(esp_timer_get_time() - starved_at));
+                }
+                audio_spectrum_tap((const int16_t *)&s_ring[off], len / (2 * sizeof(int16_t)));
+                mix_effects((int16_t *)&s_ring[off], len);
+            }
+            if (write_block(&s_ring[off], len) != ESP_OK) {
+                /* Keep the block; a flush or stop drops it */
+                pending = len;
+                if (s_running) {
+                    vTaskDelay(pdMS_TO_TICKS(WRITER_RETRY_MS));
+                }
+                continue;
+            }
+            pending = 0;
+        }
+
+        atomic_store_explicit(&s_rd, rd + len, memory_order_release);
+        xSemaphoreGive(s_space_sem);
+        primed = true;
+        starved = false;
+    }
+
+    s_task = NULL;
+    vTaskDelete(NULL);
+}
+
+/*===========================================================================
+ * Public API
+ *===========================================================================*/
+
+esp_err_t audio_i2s_writer_init(void)
+{
+    if (s_task != NULL) {
+        return ESP_OK;
+    }
+
+    s_ring = heap_caps_malloc(WRITER_RING_BYTES, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    s_fx = heap_caps_malloc(WRITER_FX_BYTES, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    s_space_sem = xSemaphoreCreateBinary();
+    s_fx_space_sem = xSemaphoreCreateBinary();
+    if (s_ring == NULL || s_fx == NULL || s_space_sem == NULL || s_fx_space_sem == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate %d KB output ring", CONFIG_AUDIO_PCM_RING_KB);
+        audio_i2s_writer_deinit();
+        return ESP_ERR_NO_MEM;
+    }
+
+    atomic_store(&s_wr, 0);
+    atomic_store(&s_rd, 0);
+    atomic_store(&s_fx_wr, 0);
+    atomic_store(&s_fx_rd, 0);
+    atomic_store(&s_streaming, false);
+    atomic_store(&s_flush_req, false);
+    audio_i2s_writer_reset_stats();
+
+    s_running = true;
+    if (xTaskCreate(writer_task, "audio_i2s_wr", WRITER_TASK_STACK, NULL,
+                    WRITER_TASK_PRIO, &s_task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create writer task");
+        s_running = false;
+        s_task = NULL;
+        audio_i2s_writer_deinit();
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Output ring: %d KB, %d-byte I2S blocks", CONFIG_AUDIO_PCM_RING_KB, WRITER_BLOCK_BYTES);
+    return ESP_OK;
+}
+
+void audio_i2s_writer_deinit(void)
+{
+    if (s_task != NULL) {
+        s_running = false;
+        xTaskNotifyGive(s_task);
+        for (int i = 0; i < 50 && s_task != NULL; i++) {
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+        if (s_task != NULL) {
+            ESP_LOGE(TAG, "Writer did not stop, buffers left allocated");
+            return;
+        }
+    }
+
+    if (s_space_sem != NULL) {
+        vSemaphoreDelete(s_space_sem);
+        s_space_sem = NULL;
+    }
+    if (s_fx_space_sem != NULL) {
+        vSemaphoreDelete(s_fx_space_sem);
+        s_fx_space_sem = NULL;
+    }
+    if (s_ring != NULL) {
+        heap_caps_free(s_ring);
+        s_ring = NULL;
+    }
+    if (s_fx != NULL) {
+        heap_caps_free(s_fx);
+        s_fx = NULL;
+    }
+}
+
+int audio_i2s_writer_push(const uint8_t *data, int size)
+{
+    if (s_task == NULL || data == NULL || size <= 0) {
+        return 0;
+    }
+
+    atomic_store_explicit(&s_streaming, true, memory_order_relaxed);
+    s_stats.bytes_in += (uint32_t)size;
+
+    int64_t deadline = 0;
+    int pushed = 0;
+    while (pushed < size) {
+        uint32_t wr = atomic_load_explicit(&s_wr, memory_order_relaxed);
+        uint32_t space = WRITER_RING_BYTES - (wr - atomic_load_explicit(&s_rd, memory_order_acquire));
+
+        if (space == 0) {
+            /* Ring full - let the writer drain a block */
+            int64_t now = esp_timer_get_time();
+            if (deadline == 0) {
+                deadline = now + (int64_t)WRITER_PUSH_WAIT_MS * 1000;
+            }
+            if (now >= deadline || !s_running) {
+                s_stats.overruns++;
+                s_stats.dropped_bytes += (uint32_t)(size - pushed);
+                break;
+            }
+            xSemaphoreTake(s_space_sem, pdMS_TO_TICKS((deadline - now) / 1000) + 1);
+            s_stats.producer_wait_us += (uint32_t)(esp_timer_get_time() - now);
+            continue;
+        }
+
+        uint32_t n = (uint32_t)(size - pushed) < space ? (uint32_t)(size - pushed) : space;
+        uint32_t off = wr & (WRITER_RING_BYTES - 1);
+        uint32_t first = n < WRITER_RING_BYTES - off ? n : WRITER_RING_BYTES - off;
+        memcpy(&s_ring[off], data + pushed, first);
+        memcpy(s_ring, data + pushed + first, n - first);
+        atomic_store_explicit(&s_wr, wr + n, memory_order_release);
+        pushed += (int)n;
+
+        xTaskNotifyGive(s_task);
+    }
+
+    uint32_t level = ring_level();
+    if (level > s_stats.max_level_bytes) {
+        s_stats.max_level_bytes = level;
+    }
+    audio_telemetry_record(AUDIO_METRIC_OUT_RING_PCT, level * 100 / WRITER_RING_BYTES);
+    return pushed;
+}
+
+size_t audio_i2s_writer_push_effects(const int16_t *pcm, size_t bytes, uint32_t timeout_ms)
+{
+    if (s_task == NULL || pcm == NULL) {
+        return 0;
+    }
+    bytes &= ~(size_t)3;    /* Whole stereo frames */
+
+    const uint8_t *src = (const uint8_t *)pcm;
+    int64_t deadline = esp_timer_get_time() + (int64_t)timeout_ms * 1000;
+    size_t pushed = 0;
+    while (pushed < bytes) {
+        uint32_t wr = atomic_load_explicit(&s_fx_wr, memory_order_relaxed);
+        uint32_t space = WRITER_FX_BYTES - (wr - atomic_load_explicit(&s_fx_rd, memory_order_acquire));
+
+        if (space == 0) {
+            int64_t now = esp_timer_get_time();
+            if (now >= deadline || !s_running) {
+                break;
+            }
+            xSemaphoreTake(s_fx_space_sem, pdMS_TO_TICKS((deadline - now) / 1000) + 1);
+            continue;
+        }
+
+        uint32_t n = (uint32_t)(bytes - pushed) < space ? (uint32_t)(bytes - pushed) : space;
+        uint32_t off = wr & (WRITER_FX_BYTES - 1);
+        uint32_t first = n < WRITER_FX_BYTES - off ? n : WRITER_FX_BYTES - off;
+        memcpy(&s_fx[off], src + pushed, first);
+        memcpy(s_fx, src + pushed + first, n - first);
+        atomic_store_explicit(&s_fx_wr, wr + n, memory_order_release);
+        pushed += n;
+
+        xTaskNotifyGive(s_task);
+    }
+    return pushed;
+}
+
+void audio_i2s_writer_set_music_channels(uint8_t channels)
+{
+    atomic_store_explicit(&s_music_channels, channels == 1 ? 1 : 2, memory_order_relaxed);
+}
+
+void audio_i2s_writer_idle(void)
+{
+    atomic_store_explicit(&s_streaming, false, memory_order_relaxed);
+    if (s_task != NULL) {
+        xTaskNotifyGive(s_task);
+    }
+}
+
+void audio_i2s_writer_flush(void)
+{
+    if (s_task == NULL) {
+        return;
+    }
+    atomic_store_explicit(&s_streaming, false, memory_order_relaxed);
+    atomic_store_explicit(&s_flush_req, true, memory_order_release);
+    xTaskNotifyGive(s_task);
+
+    /* The writer finishes at most one in-flight block first */
+    for (int i = 0; i < 50 && atomic_load_explicit(&s_flush_req, memory_order_acquire); i++) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+}
+
+bool audio_i2s_writer_wait_drained(uint32_t timeout_ms)
+{
+    if (s_task == NULL) {
+        return true;
+    }
+    for (uint32_t waited = 0; ring_level() > 0; waited += 10) {
+        if (waited >= timeout_ms) {
+            return false;
+        }
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    return true;
+}
+
+void audio_i2s_writer_get_stats(audio_output_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    *stats = s_stats;
+    stats->level_bytes = ring_level();
+    stats->capacity_bytes = WRITER_RING_BYTES;
+}
+
+void audio_i2s_writer_reset_stats(void)
+{
+    memset(&s_stats, 0, sizeof(s_stats));
+}
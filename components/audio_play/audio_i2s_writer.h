@@ -0,0 +1,103 @@
+/**
+ * @file audio_i2s_writer.h
+ * @brief Decoder output ring and I2S writer task (internal to audio_play)
+ *
+ * The music decoder pushes PCM into a lock-free single-producer /
+ * single-consumer ring; a high-priority writer task drains it into
+ * esp_audio_play(). The decoder never blocks on I2S, LVGL or the mixer.
+ * The mixer pushes its effect chunks into a second ring, which the writer
+ * sums into the music, so the writer task is the output's only writer.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "audio_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Allocate the ring and start the writer task
+ * @return ESP_OK on success (or if already running)
+ */
+esp_err_t audio_i2s_writer_init(void);
+
+/**
+ * @brief Stop the writer task and free the ring
+ */
+void audio_i2s_writer_deinit(void);
+
+/**
+ * @brief Queue decoded PCM for output (producer side, decoder task only)
+ *
+ * Copies into the ring, waiting for space while the writer drains it.
+ * Whatever still does not fit after a bounded wait is dropped and counted
+ * as an overrun.
+ *
+ * @param data 16-bit PCM bytes
+ * @param size Number of bytes
+ * @return Bytes queued
+ */
+int audio_i2s_writer_push(const uint8_t *data, int size);
+
+/**
+ * @brief Queue mixed sound effects for output (mixer task only)
+ *
+ * The writer adds them into the music being played, or writes them on
+ * their own while no music is queued. Waits while the effects ring is full.
+ *
+ * @param pcm 16-bit stereo PCM at AUDIO_BACKEND_OUT_RATE
+ * @param bytes Number of bytes (whole stereo frames)
+ * @param timeout_ms Longest wait for space
+ * @return Bytes queued (less than @p bytes on timeout or while stopping)
+ */
+size_t audio_i2s_writer_push_effects(const int16_t *pcm, size_t bytes, uint32_t timeout_ms);
+
+/**
+ * @brief Set the channel count of the decoder's blocks (from its music info)
+ *
+ * Effects are stereo; with mono music they are mixed in as the average of
+ * left and right. Default 2.
+ */
+void audio_i2s_writer_set_music_channels(uint8_t channels);
+
+/**
+ * @brief Tell the writer the producer stopped on purpose (pause, end of track)
+ *
+ * Buffered audio is still played out, but the ring running dry is no longer
+ * counted as an underrun. The next push resumes normal accounting.
+ */
+void audio_i2s_writer_idle(void);
+
+/**
+ * @brief Discard buffered audio (stop, track change)
+ *
+ * Must only be called while the decoder is not pushing. Returns once the
+ * writer has dropped the data (bounded wait).
+ */
+void audio_i2s_writer_flush(void);
+
+/**
+ * @brief Wait until the ring has been handed to I2S
+ * @param timeout_ms Maximum wait
+ * @return true if the ring is empty
+ */
+bool audio_i2s_writer_wait_drained(uint32_t timeout_ms);
+
+/**
+ * @brief Snapshot the output counters
+ */
+void audio_i2s_writer_get_stats(audio_output_stats_t *stats);
+
+/**
+ * @brief Clear the output counters
+ */
+void audio_i2s_writer_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
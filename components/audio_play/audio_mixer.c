@@ -0,0 +1,810 @@
+/**
+ * @file audio_mixer.c
+ * @brief Non-blocking sound-effect mixer for embedded PCM clips
+ *
+ * Audio_Play_PCM() used to resample and push the whole clip to I2S from the
+ * caller's context, which froze the LVGL thread for the length of the clip.
+ * This module moves that work to a dedicated task.
+ *
+ * Architecture:
+ * - Command Ring: bounded lock-free MPSC ring (C11 atomics). Producers only
+ *   wake the mixer with a task notification. PLAY commands take a short
+ *   mutex so voice ids enter the ring in the order they are assigned.
+ * - Voice Slots: CONFIG_AUDIO_MIXER_VOICES clips can play at once. When all
+ *   slots are busy the oldest voice is stolen.
+ * - Mixer Task: fixed-point polyphase resampler per voice (audio_resampler.c),
+ *   summed into a 32-bit accumulator and saturated to 16-bit stereo.
+ * - ADPCM Voices: IMA-ADPCM clips are decoded straight from flash in
+ *   MIXER_ADPCM_SLICE-sample slices into a per-voice scratch buffer that
+ *   feeds the resampler, so compressed clips never need a full PCM copy.
+ * - Output: chunks go to the I2S writer's effects ring
+ *   (audio_i2s_writer_push_effects()), which sums them into the music, so
+ *   only the writer task writes to the backend.
+ * - Output Session: the output is claimed from the power manager
+ *   (audio_power.c) when the first voice starts, waiting only if the codec
+ *   was not already active, and released after a silence flush once the
+ *   last voice ends.
+ */
+
+#include "audio_mixer.h"
+#include "audio_adpcm.h"
+#include "audio_driver.h"
+#include "audio_resampler.h"
+#include "audio_i2s_writer.h"
+#include "audio_power.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include <stdatomic.h>
+#include <string.h>
+
+static const char *TAG = "audio mixer";
+
+/*===========================================================================
+ * Configuration
+ *===========================================================================*/
+
+#define MIXER_VOICES        CONFIG_AUDIO_MIXER_VOICES  /**< Simultaneous voices */
+#define MIXER_CMD_RING_LEN  16      /**< Command ring slots (power of two) */
+#define MIXER_OUT_RATE      44100   /**< Codec sample rate */
+#define MIXER_CHUNK_FRAMES  256     /**< Stereo frames rendered per push (~5.8ms) */
+#define MIXER_PUSH_WAIT_MS  100     /**< Longest wait for room in the writer's effects ring */
+#define MIXER_PUSH_TRIES    3       /**< Waits per chunk before the rest is dropped */
+#define MIXER_ADPCM_SLICE   64      /**< Samples decoded per ADPCM refill */
+#define MIXER_TASK_STACK    3072
+#define MIXER_TASK_PRIO     CONFIG_AUDIO_MIXER_TASK_PRIORITY
+
+_Static_assert((MIXER_CMD_RING_LEN & (MIXER_CMD_RING_LEN - 1)) == 0,
+               "MIXER_CMD_RING_LEN must be a power of two");
+
+/*===========================================================================
+ * Types
+ *===========================================================================*/
+
+/**
+ * @brief Mixer command types
+ */
+typedef enum {
+    MIXER_CMD_PLAY,     /**< Start a clip on a free voice */
+    MIXER_CMD_STOP,     /**< Stop one voice by id */
+    MIXER_CMD_STOP_ALL  /**< Stop every voice */
+} mixer_cmd_type_t;
+
+/**
+ * @brief Mixer command message
+ */
+typedef struct {
+    mixer_cmd_type_t type;
+    uint32_t voice;             /**< Voice id (PLAY assigns, STOP targets) */
+    const int16_t *data;        /**< PCM frames (PLAY only, NULL for ADPCM) */
+    const audio_adpcm_clip_t *adpcm;  /**< Compressed clip (PLAY only, NULL for PCM) */
+    size_t frames;              /**< Frame count (PLAY only) */
+    uint32_t sample_rate;       /**< Source rate in Hz (PLAY only) */
+    uint8_t channels;           /**< 1 or 2 (PLAY only) */
+    bool loop;                  /**< Loop flag (PLAY only) */
+    audio_mixer_done_cb_t done; /**< Called once the clip is released (PLAY only, may be NULL) */
+    void *done_ctx;
+} mixer_cmd_t;
+
+/**
+ * @brief Ring cell - sequence number guards ownership (Vyukov bounded queue)
+ */
+typedef struct {
+    atomic_uint seq;
+    mixer_cmd_t cmd;
+} mixer_cell_t;
+
+/**
+ * @brief Voice slot (owned exclusively by the mixer task)
+ */
+typedef struct {
+    bool busy;
+    const int16_t *data;        /**< PCM source, NULL for ADPCM voices */
+    size_t frames;
+    size_t pos;                 /**< Next source frame fed to the resampler */
+    uint8_t channels;
+    bool loop;
+    audio_mixer_done_cb_t done; /**< Owner's release callback, NULL if none */
+    void *done_ctx;
+    audio_resampler_t rs;       /**< Streaming rate converter to MIXER_OUT_RATE */
+    /* ADPCM source (mono) */
+    const audio_adpcm_clip_t *adpcm;
+    audio_adpcm_decoder_t dec;
+    int16_t slice[MIXER_ADPCM_SLICE];
+    uint16_t slice_len;         /**< Decoded samples in slice */
+    uint16_t slice_pos;         /**< Next slice sample fed to the resampler */
+} mixer_voice_t;
+
+/*===========================================================================
+ * Module State
+ *===========================================================================*/
+
+static mixer_cell_t s_ring[MIXER_CMD_RING_LEN];
+static atomic_uint s_ring_head;             /**< Next slot to claim (producers) */
+static unsigned s_ring_tail;                /**< Next slot to read (mixer task only) */
+
+static mixer_voice_t s_voices[MIXER_VOICES];
+static atomic_uint s_voice_ids[MIXER_VOICES];  /**< 0 = slot free; readable from any task */
+static uint32_t s_next_voice_id = 1;         /**< Guarded by s_play_lock */
+static atomic_uint s_last_consumed_id;       /**< Latest PLAY id the mixer has seen */
+static SemaphoreHandle_t s_play_lock = NULL; /**< Id assignment + push of PLAY commands */
+
+static int32_t s_accum[MIXER_CHUNK_FRAMES * 2];
+static int16_t s_voice_buf[MIXER_CHUNK_FRAMES * 2];  /**< One voice, resampled */
+static int16_t s_out[MIXER_CHUNK_FRAMES * 2];
+
+static TaskHandle_t s_task = NULL;
+static volatile bool s_running = false;
+
+static audio_mixer_stats_t s_stats;         /**< Written by the mixer task only */
+
+/*===========================================================================
+ * Lock-free Command Ring
+ *===========================================================================*/
+
+static void ring_reset(void)
+{
+    for (unsigned i = 0; i < MIXER_CMD_RING_LEN; i++) {
+        atomic_store_explicit(&s_ring[i].seq, i, memory_order_relaxed);
+    }
+    atomic_store_explicit(&s_ring_head, 0, memory_order_relaxed);
+    s_ring_tail = 0;
+}
+
+/**
+ * @brief Push a command (any task, never blocks)
+ * @return false if the ring is full
+ */
+static bool ring_push(const mixer_cmd_t *cmd)
+{
+    unsigned pos = atomic_load_explicit(&s_ring_head, memory_order_relaxed);
+    mixer_cell_t *cell;
+
+    for (;;) {
+        cell = &s_ring[pos & (MIXER_CMD_RING_LEN - 1)];
+        unsigned seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+        int diff = (int)(seq - pos);
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&s_ring_head, &pos, pos + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;   /* Full */
+        } else {
+            pos = atomic_load_explicit(&s_ring_head, memory_order_relaxed);
+        }
+    }
+
+    cell->cmd = *cmd;
+    atomic_store_explicit(&cell->seq, pos + 1, memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Pop a command (mixer task only)
+ * @return false if the ring is empty
+ */
+static bool ring_pop(mixer_cmd_t *out)
+{
+    mixer_cell_t *cell = &s_ring[s_ring_tail & (MIXER_CMD_RING_LEN - 1)];
+    unsigned seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+    if ((int)(seq - (s_ring_tail + 1)) < 0) {
+        return false;   /* Empty */
+    }
+    *out = cell->cmd;
+    atomic_store_explicit(&cell->seq, s_ring_tail + MIXER_CMD_RING_LEN, memory_order_release);
+    s_ring_tail++;
+    return true;
+}
+
+/**
+ * @brief Push a command and wake the mixer
+ */
+static bool post_cmd(const mixer_cmd_t *cmd)
+{
+    if (!s_running || s_task == NULL) {
+        return false;
+    }
+    if (!ring_push(cmd)) {
+        return false;
+    }
+    xTaskNotifyGive(s_task);
+    return true;
+}
+
+/*===========================================================================
+ * Voice Management (mixer task only)
+ *===========================================================================*/
+
+static void voice_release(int slot)
+{
+    mixer_voice_t *v = &s_voices[slot];
+    audio_mixer_done_cb_t done = v->busy ? v->done : NULL;
+
+    v->busy = false;
+    v->data = NULL;
+    v->adpcm = NULL;
+    v->done = NULL;
+    if (done != NULL) {
+        done(v->done_ctx);      /* The mixer no longer reads the clip */
+    }
+    /* After the callback, so an owner that sees the id inactive has
+     * already been released */
+    atomic_store_explicit(&s_voice_ids[slot], 0, memory_order_release);
+}
+
+static int active_voice_count(void)
+{
+    int n = 0;
+    for (int i = 0; i < MIXER_VOICES; i++) {
+        if (s_voices[i].busy) {
+            n++;
+        }
+    }
+    return n;
+}
+
+static void voice_start(const mixer_cmd_t *cmd)
+{
+    /* Prefer a free slot, otherwise steal the oldest voice */
+    int slot = -1;
+    uint32_t oldest_id = 0;
+    int oldest_slot = -1;
+    for (int i = 0; i < MIXER_VOICES; i++) {
+        uint32_t id = atomic_load_explicit(&s_voice_ids[i], memory_order_relaxed);
+        if (id == 0) {
+            slot = i;
+            break;
+        }
+        /* Ids wrap; compare by distance like audio_mixer_is_active() */
+        if (oldest_slot < 0 || (int32_t)(id - oldest_id) < 0) {
+            oldest_id = id;
+            oldest_slot = i;
+        }
+    }
+    if (slot < 0) {
+        ESP_LOGD(TAG, "All voices busy, stealing voice %lu", (unsigned long)oldest_id);
+        slot = oldest_slot;
+        voice_release(slot);
+        s_stats.steals++;
+    }
+
+    mixer_voice_t *v = &s_voices[slot];
+    v->data = cmd->data;
+    v->adpcm = cmd->adpcm;
+    v->frames = cmd->frames;
+    v->channels = cmd->channels;
+    v->loop = cmd->loop;
+    v->done = cmd->done;
+    v->done_ctx = cmd->done_ctx;
+    v->pos = 0;
+    v->slice_len = 0;
+    v->slice_pos = 0;
+    if (v->adpcm != NULL) {
+        audio_adpcm_decoder_init(&v->dec, v->adpcm);
+    }
+    v->busy = true;
+    audio_resampler_init(&v->rs, cmd->sample_rate, MIXER_OUT_RATE, cmd->channels);
+    atomic_store_explicit(&s_voice_ids[slot], cmd->voice, memory_order_release);
+}
+
+static void handle_cmd(const mixer_cmd_t *cmd)
+{
+    switch (cmd->type) {
+        case MIXER_CMD_PLAY:
+            atomic_store_explicit(&s_last_consumed_id, cmd->voice, memory_order_release);
+            voice_start(cmd);
+            break;
+
+        case MIXER_CMD_STOP:
+            for (int i = 0; i < MIXER_VOICES; i++) {
+                if (atomic_load_explicit(&s_voice_ids[i], memory_order_relaxed) == cmd->voice) {
+                    voice_release(i);
+                }
+            }
+            break;
+
+        case MIXER_CMD_STOP_ALL:
+            for (int i = 0; i < MIXER_VOICES; i++) {
+                voice_release(i);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+static void drain_commands(void)
+{
+    mixer_cmd_t cmd;
+    while (ring_pop(&cmd)) {
+        handle_cmd(&cmd);
+    }
+}
+
+/*===========================================================================
+ * Rendering (mixer task only)
+ *===========================================================================*/
+
+/**
+ * @brief Get the next run of source frames for a voice
+ *
+ * PCM voices expose the rest of the clip; ADPCM voices refill their slice
+ * buffer from the decoder once the previous slice is consumed.
+ *
+ * @return Frames available at *src, 0 at end of clip
+ */
+static size_t voice_source(mixer_voice_t *v, const int16_t **src)
+{
+    if (v->adpcm == NULL) {
+        *src = &v->data[v->pos * v->channels];
+        return v->frames - v->pos;
+    }
+
+    if (v->slice_pos >= v->slice_len) {
+        v->slice_len = (uint16_t)audio_adpcm_decode(&v->dec, v->slice, MIXER_ADPCM_SLICE);
+        v->slice_pos = 0;
+    }
+    *src = &v->slice[v->slice_pos];
+    return v->slice_len - v->slice_pos;
+}
+
+static void voice_consume(mixer_voice_t *v, size_t used)
+{
+    if (v->adpcm == NULL) {
+        v->pos += used;
+    } else {
+        v->slice_pos += (uint16_t)used;
+    }
+}
+
+static void voice_rewind(mixer_voice_t *v)
+{
+    v->pos = 0;
+    if (v->adpcm != NULL) {
+        audio_adpcm_decoder_rewind(&v->dec);
+        v->slice_len = 0;
+        v->slice_pos = 0;
+    }
+}
+
+/**
+ * @brief Resample one voice and add it into the accumulator
+ *
+ * The resampler keeps its history across a loop restart, so looping clips
+ * wrap without a click.
+ *
+ * @return false if the voice ended inside this chunk
+ */
+static bool voice_mix(mixer_voice_t *v, int32_t *acc, int frames)
+{
+    int done = 0;
+    bool rewound = false;
+
+    while (done < frames) {
+        const int16_t *src;
+        size_t avail = voice_source(v, &src);
+        if (avail == 0) {
+            if (!v->loop || rewound) {
+                return false;   /* Clip ended (filter tail is dropped) */
+            }
+            voice_rewind(v);
+            rewound = true;     /* Guards against an empty looping clip */
+            continue;
+        }
+
+        size_t used = 0;
+        size_t n = audio_resampler_process(&v->rs, src, avail, &used,
+                                           s_voice_buf, (size_t)(frames - done));
+        voice_consume(v, used);
+        if (used > 0) {
+            rewound = false;
+        }
+
+        int32_t *a = &acc[done * 2];
+        if (v->channels == 2) {
+            for (size_t i = 0; i < n * 2; i++) {
+                a[i] += s_voice_buf[i];
+            }
+        } else {
+            for (size_t i = 0; i < n; i++) {
+                a[i * 2] += s_voice_buf[i];
+                a[i * 2 + 1] += s_voice_buf[i];
+            }
+        }
+        done += (int)n;
+
+        if (n == 0 && used == 0) {
+            break;  /* No progress possible */
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Render one chunk of all active voices into s_out
+ */
+static void render_chunk(void)
+{
+    memset(s_accum, 0, sizeof(s_accum));
+
+    for (int i = 0; i < MIXER_VOICES; i++) {
+        if (!s_voices[i].busy) {
+            continue;
+        }
+        if (!voice_mix(&s_voices[i], s_accum, MIXER_CHUNK_FRAMES)) {
+            voice_release(i);
+        }
+    }
+
+    for (int i = 0; i < MIXER_CHUNK_FRAMES * 2; i++) {
+        int32_t s = s_accum[i];
+        if (s > INT16_MAX) s = INT16_MAX;
+        if (s < INT16_MIN) s = INT16_MIN;
+        s_out[i] = (int16_t)s;
+    }
+}
+
+/*===========================================================================
+ * Output Session
+ *===========================================================================*/
+
+/**
+ * @brief Hand s_out to the writer, holding the rest of it while the ring is full
+ *
+ * Each try waits up to MIXER_PUSH_WAIT_MS; whatever is left after
+ * MIXER_PUSH_TRIES (or once the mixer is stopping) is dropped and counted.
+ */
+static void output_write(void)
+{
+    size_t done = 0;
+    for (int tries = 0; done < sizeof(s_out); tries++) {
+        done += audio_i2s_writer_push_effects(&s_out[done / sizeof(int16_t)],
+                                              sizeof(s_out) - done, MIXER_PUSH_WAIT_MS);
+        if (done == sizeof(s_out)) {
+            break;
+        }
+        s_stats.push_timeouts++;
+        if (tries + 1 >= MIXER_PUSH_TRIES || !s_running) {
+            s_stats.dropped_bytes += sizeof(s_out) - done;
+            break;
+        }
+    }
+    s_stats.chunks++;
+}
+
+static void output_open(void)
+{
+    /* Zero on a hot start (output held active or pre-warmed) */
+    uint32_t settle_ms = audio_power_acquire(AUDIO_POWER_CLIENT_MIXER);
+    if (settle_ms > 0) {
+        vTaskDelay(pdMS_TO_TICKS(settle_ms));
+    }
+}
+
+static void output_close(void)
+{
+    /* The active hold keeps the amp on while the writer drains the chunks */
+    audio_power_release(AUDIO_POWER_CLIENT_MIXER);
+}
+
+static void flush_silence(void)
+{
+    memset(s_out, 0, sizeof(s_out));
+    output_write();
+    output_write();
+}
+
+/*===========================================================================
+ * Mixer Task
+ *===========================================================================*/
+
+static void mixer_task(void *pvParameters)
+{
+    bool open = false;
+
+    while (s_running) {
+        drain_commands();
+
+        if (active_voice_count() == 0) {
+            if (open) {
+                /* Last voice ended - flush DMA; the power manager keeps
+                 * the output active for a while, so a new voice starts hot */
+                flush_silence();
+                output_close();
+                open = false;
+            }
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        if (!open) {
+            output_open();
+            open = true;
+        }
+
+        render_chunk();
+        output_write();
+    }
+
+    for (int i = 0; i < MIXER_VOICES; i++) {
+        voice_release(i);
+    }
+    if (open) {
+        output_close();
+    }
+
+    /* PLAY commands still queued are dropped; their owners get the
+     * callback all the same. post_play() sees s_running false once it has
+     * the lock, so nothing is pushed after this drain. */
+    xSemaphoreTake(s_play_lock, portMAX_DELAY);
+    mixer_cmd_t cmd;
+    while (ring_pop(&cmd)) {
+        if (cmd.type == MIXER_CMD_PLAY && cmd.done != NULL) {
+            cmd.done(cmd.done_ctx);
+        }
+    }
+    s_task = NULL;
+    xSemaphoreGive(s_play_lock);
+    vTaskDelete(NULL);
+}
+
+/*===========================================================================
+ * Public API
+ *===========================================================================*/
+
+esp_err_t audio_mixer_init(void)
+{
+    if (s_task != NULL) {
+        return ESP_OK;
+    }
+    if (s_play_lock == NULL) {
+        s_play_lock = xSemaphoreCreateMutex();
+        if (s_play_lock == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    ring_reset();
+    for (int i = 0; i < MIXER_VOICES; i++) {
+        s_voices[i].busy = false;
+        atomic_store_explicit(&s_voice_ids[i], 0, memory_order_relaxed);
+    }
+
+    s_running = true;
+    if (xTaskCreate(mixer_task, "audio_mixer", MIXER_TASK_STACK, NULL,
+                    MIXER_TASK_PRIO, &s_task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create mixer task");
+        s_running = false;
+        s_task = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Mixer started: %d voices, %d-frame chunks", MIXER_VOICES, MIXER_CHUNK_FRAMES);
+    return ESP_OK;
+}
+
+esp_err_t audio_mixer_deinit(void)
+{
+    if (s_task == NULL) {
+        return ESP_OK;
+    }
+    s_running = false;
+    xTaskNotifyGive(s_task);
+
+    /* Wait (bounded) for the task to finish its current chunk and exit */
+    for (int i = 0; i < 50 && s_task != NULL; i++) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    if (s_task != NULL) {
+        ESP_LOGE(TAG, "Mixer task did not stop");
+        return ESP_ERR_TIMEOUT;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Assign a voice id and queue a PLAY command
+ *
+ * Both happen under s_play_lock, so PLAY ids reach the mixer in increasing
+ * order and audio_mixer_is_active() can tell a queued id from a finished
+ * one. The lock is held for a ring push only.
+ */
+static uint32_t post_play(mixer_cmd_t *cmd)
+{
+    if (s_play_lock == NULL) {
+        return 0;
+    }
+
+    xSemaphoreTake(s_play_lock, portMAX_DELAY);
+    uint32_t id = s_next_voice_id++;
+    if (id == 0) {
+        id = s_next_voice_id++;     /* Wrapped - 0 is reserved for "invalid" */
+    }
+    cmd->type = MIXER_CMD_PLAY;
+    cmd->voice = id;
+    bool queued = post_cmd(cmd);
+    xSemaphoreGive(s_play_lock);
+
+    if (!queued) {
+        ESP_LOGW(TAG, "Command ring full, dropping clip");
+        return 0;
+    }
+    return id;
+}
+
+uint32_t audio_mixer_play(const int16_t *pcm_data, size_t frames,
+                          uint32_t sample_rate, uint8_t channels, bool loop,
+                          audio_mixer_done_cb_t done, void *done_ctx)
+{
+    if (pcm_data == NULL || frames == 0 || sample_rate == 0 ||
+        (channels != 1 && channels != 2)) {
+        return 0;
+    }
+
+    mixer_cmd_t cmd = {
+        .data = pcm_data,
+        .frames = frames,
+        .sample_rate = sample_rate,
+        .channels = channels,
+        .loop = loop,
+        .done = done,
+        .done_ctx = done_ctx,
+    };
+    return post_play(&cmd);
+}
+
+uint32_t audio_mixer_play_adpcm(const audio_adpcm_clip_t *clip, bool loop)
+{
+    if (clip == NULL || clip->data == NULL || clip->samples == 0 ||
+        clip->sample_rate == 0 || clip->block_align <= AUDIO_ADPCM_BLOCK_HEADER) {
+        return 0;
+    }
+
+    mixer_cmd_t cmd = {
+        .adpcm = clip,
+        .frames = clip->samples,
+        .sample_rate = clip->sample_rate,
+        .channels = 1,
+        .loop = loop,
+    };
+    return post_play(&cmd);
+}
+
+bool audio_mixer_stop(uint32_t voice)
+{
+    if (voice == 0) {
+        return false;
+    }
+    mixer_cmd_t cmd = { .type = MIXER_CMD_STOP, .voice = voice };
+    return post_cmd(&cmd);
+}
+
+void audio_mixer_stop_all(void)
+{
+    mixer_cmd_t cmd = { .type = MIXER_CMD_STOP_ALL };
+    post_cmd(&cmd);
+}
+
+bool audio_mixer_is_active(uint32_t voice)
+{
+    if (voice == 0) {
+        return false;
+    }
+    /* Queued but not yet picked up by the mixer (ids are consumed in order) */
+    uint32_t last = atomic_load_explicit(&s_last_consumed_id, memory_order_acquire);
+    if ((int32_t)(voice - last) > 0) {
+        return s_running;
+    }
+    for (int i = 0; i < MIXER_VOICES; i++) {
+        if (atomic_load_explicit(&s_voice_ids[i], memory_order_acquire) == voice) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void audio_mixer_get_stats(audio_mixer_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    *stats = s_stats;
+}
+
+void audio_mixer_reset_stats(void)
+{
+    memset(&s_stats, 0, sizeof(s_stats));
+}
+
+#if CONFIG_APP_SELF_TEST
+/*===========================================================================
+ * Self Test (CONFIG_APP_SELF_TEST)
+ *===========================================================================*/
+
+#define CHECK_ROUNDS        3       /**< Bursts of posts */
+#define CHECK_BURST         8       /**< PLAY commands per burst (fits the ring) */
+#define CHECK_AVG_POST_US   50      /**< Pass bound, average enqueue */
+#define CHECK_MAX_POST_US   1000    /**< Pass bound, slowest enqueue */
+#define CHECK_STOP_WAIT_MS  200     /**< Time allowed for STOP_ALL to land */
+
+static atomic_uint s_check_done;            /**< Release callbacks seen by audio_mixer_check() */
+
+static void check_done(void *ctx)
+{
+    atomic_fetch_add_explicit(&s_check_done, 1, memory_order_relaxed);
+}
+
+esp_err_t audio_mixer_check(audio_mixer_check_t *result)
+{
+    if (result == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *result = (audio_mixer_check_t){0};
+    if (s_task == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    static const int16_t silence[MIXER_CHUNK_FRAMES];
+    uint32_t ids[CHECK_BURST];
+    uint32_t prev = 0;
+    uint64_t total_us = 0;
+    atomic_store_explicit(&s_check_done, 0, memory_order_relaxed);
+
+    for (int round = 0; round < CHECK_ROUNDS; round++) {
+        /* Post above the mixer's priority, so the time is the enqueue itself
+         * and not the mixing it wakes up */
+        UBaseType_t prio = uxTaskPriorityGet(NULL);
+        vTaskPrioritySet(NULL, prio > MIXER_TASK_PRIO ? prio : MIXER_TASK_PRIO + 1);
+        for (int i = 0; i < CHECK_BURST; i++) {
+            int64_t t0 = esp_timer_get_time();
+            ids[i] = audio_mixer_play(silence, MIXER_CHUNK_FRAMES, MIXER_OUT_RATE, 1, true,
+                                      check_done, NULL);
+            uint32_t us = (uint32_t)(esp_timer_get_time() - t0);
+
+            total_us += us;
+            result->posts++;
+            if (us > result->max_post_us) {
+                result->max_post_us = us;
+            }
+            /* Increasing ids, each reported active while still queued */
+            if (ids[i] == 0 || (prev != 0 && (int32_t)(ids[i] - prev) <= 0) ||
+                !audio_mixer_is_active(ids[i])) {
+                result->id_errors++;
+            }
+            prev = ids[i];
+        }
+        vTaskPrioritySet(NULL, prio);
+
+        audio_mixer_stop_all();
+        int active = CHECK_BURST;
+        for (int waited = 0; waited <= CHECK_STOP_WAIT_MS && active > 0; waited += 10) {
+            vTaskDelay(pdMS_TO_TICKS(10));
+            active = 0;
+            for (int i = 0; i < CHECK_BURST; i++) {
+                active += audio_mixer_is_active(ids[i]);
+            }
+        }
+        result->id_errors += (uint32_t)active;
+    }
+
+    /* Stolen and stopped voices alike: one release per post */
+    uint32_t done = atomic_load_explicit(&s_check_done, memory_order_relaxed);
+    result->done_errors = done > result->posts ? done - result->posts : result->posts - done;
+
+    result->avg_post_us = (uint32_t)(total_us / result->posts);
+    bool ok = result->id_errors == 0 && result->done_errors == 0 && result->avg_post_us <= CHECK_AVG_POST_US &&
+              result->max_post_us <= CHECK_MAX_POST_US;
+
+    ESP_LOGI(TAG, "Enqueue: %lu posts, avg %lu us, max %lu us, id errors %lu, release errors %lu",
+             (unsigned long)result->posts, (unsigned long)result->avg_post_us,
+             (unsigned long)result->max_post_us, (unsigned long)result->id_errors,
+             (unsigned long)result->done_errors);
+    return ok ? ESP_OK : ESP_FAIL;
+}
+#endif /* CONFIG_APP_SELF_TEST */
@@ -0,0 +1,107 @@
+/**
+ * @file audio_mixer.h
+ * @brief Sound-effect mixer (internal to the audio_play component)
+ *
+ * The mixer owns a dedicated FreeRTOS task with a fixed number of voice
+ * slots. Callers (usually the LVGL thread) post commands through a
+ * lock-free ring and return immediately; the mixer task resamples, mixes
+ * and hands the result to the I2S writer, which sums it into the music.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "audio_adpcm.h"
+#include "audio_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Create the mixer task and command ring
+ * @return ESP_OK on success (or if already running)
+ */
+esp_err_t audio_mixer_init(void);
+
+/**
+ * @brief Stop all voices and delete the mixer task
+ *
+ * @return ESP_OK, or ESP_ERR_TIMEOUT if the task is still running; the
+ *         output it pushes to must then stay allocated
+ */
+esp_err_t audio_mixer_deinit(void);
+
+/**
+ * @brief Called from the mixer task once it is done with a clip
+ *
+ * Fires exactly once per accepted PLAY: when the voice ends, is stopped or
+ * stolen, or when the queued command is dropped at deinit. Must not block
+ * and must not post mixer commands.
+ */
+typedef void (*audio_mixer_done_cb_t)(void *ctx);
+
+/**
+ * @brief Queue a PCM clip on a free voice
+ *
+ * Never blocks. The clip data must stay valid until the voice ends
+ * (embedded flash arrays satisfy this), or until @p done is called for
+ * data that can be freed.
+ *
+ * @param pcm_data    16-bit PCM frames (interleaved if stereo)
+ * @param frames      Number of frames (samples per channel)
+ * @param sample_rate Source sample rate in Hz
+ * @param channels    1 = mono, 2 = stereo
+ * @param loop        Restart from the beginning when the clip ends
+ * @param done        Release callback, or NULL; not called if 0 is returned
+ * @param done_ctx    Passed to @p done
+ * @return Voice id (non-zero), or 0 if the ring is full / mixer not running
+ */
+uint32_t audio_mixer_play(const int16_t *pcm_data, size_t frames,
+                          uint32_t sample_rate, uint8_t channels, bool loop,
+                          audio_mixer_done_cb_t done, void *done_ctx);
+
+/**
+ * @brief Queue an IMA-ADPCM clip on a free voice
+ *
+ * Same rules as audio_mixer_play(); the clip is decoded incrementally from
+ * its original location while it plays.
+ *
+ * @param clip Mono ADPCM clip descriptor (must stay valid while playing)
+ * @param loop Restart from the beginning when the clip ends
+ * @return Voice id (non-zero), or 0 on error
+ */
+uint32_t audio_mixer_play_adpcm(const audio_adpcm_clip_t *clip, bool loop);
+
+/**
+ * @brief Stop one voice
+ * @param voice Voice id returned by audio_mixer_play()
+ * @return true if the stop command was queued
+ */
+bool audio_mixer_stop(uint32_t voice);
+
+/**
+ * @brief Stop every active voice
+ */
+void audio_mixer_stop_all(void);
+
+/**
+ * @brief Check whether a voice is still playing (or about to)
+ */
+bool audio_mixer_is_active(uint32_t voice);
+
+/**
+ * @brief Snapshot the mixer counters
+ */
+void audio_mixer_get_stats(audio_mixer_stats_t *stats);
+
+/**
+ * @brief Clear the mixer counters
+ */
+void audio_mixer_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
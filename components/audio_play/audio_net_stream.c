@@ -0,0 +1,448 @@
+/**
+ * @file audio_net_stream.c
+ * @brief HTTP(S) stream with an adaptive jitter buffer for the music decoder
+ *
+ * The decoder pulls small blocks at the audio bitrate while the network
+ * delivers in bursts with gaps (Wi-Fi retries, server pauses). This module
+ * puts a byte ring between the two and decides when the decoder may start
+ * pulling, so short gaps are absorbed instead of heard.
+ *
+ * Architecture:
+ * - Connection: net_api's streaming client (custom headers, bearer token,
+ *   certificate bundle, redirects). A stream read to the end leaves its
+ *   connection open, so the next track from the same server skips the TCP
+ *   and TLS handshakes.
+ * - Byte Ring: CONFIG_AUDIO_NET_BUFFER_KB, allocated only while a stream is
+ *   open. Single producer / single consumer with free-running C11 atomic
+ *   byte counters, like the SD read-ahead ring.
+ * - Reader: reads straight into the free part of the ring whenever at least
+ *   NET_READ_MIN bytes are free. Unlike the SD reader there is no low
+ *   watermark: with a small LWIP_TCP_WND the sender can only have one
+ *   window in flight, and a reader that pauses lets the window close and
+ *   throughput fall to window / RTT.
+ * - Prebuffer: the decoder's first read waits until
+ *   CONFIG_AUDIO_NET_PREBUFFER_MS of audio is buffered (or the stream
+ *   ends). This is the startup latency traded for stall protection.
+ * - Rebuffer: if the ring runs dry before the end, the decoder waits until
+ *   the rebuffer target is buffered again (a stall). The first stall waits
+ *   for CONFIG_AUDIO_NET_REBUFFER_MS and each further one raises the target
+ *   by half, up to most of the ring; NET_REBUFFER_DECAY_US of
+ *   stall-free playback lowers it again by a quarter, down to
+ *   CONFIG_AUDIO_NET_REBUFFER_MS.
+ * - Reconnect: a dropped or timed-out connection is resumed with a Range
+ *   request at the next byte, up to NET_MAX_RETRIES times with back-off.
+ * - Thresholds are milliseconds of audio, converted to bytes with the
+ *   bitrate the decoder reports (the nominal bitrate until then).
+ */
+
+#include "audio_net_stream.h"
+#include "audio_telemetry.h"
+#include "net_api.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <stdatomic.h>
+#include <string.h>
+
+static const char *TAG = "audio net";
+
+/*===========================================================================
+ * Configuration
+ *===========================================================================*/
+
+#define NET_BUFFER_BYTES        (CONFIG_AUDIO_NET_BUFFER_KB * 1024)
+#define NET_READ_MAX            4096    /**< Largest single socket read */
+#define NET_READ_MIN            1024    /**< Reader waits for at least this much free space */
+#define NET_MAX_RETRIES         3       /**< Consecutive reconnect attempts per drop */
+#define NET_RETRY_BASE_MS       250     /**< First reconnect back-off, doubled per attempt */
+#define NET_DATA_WAIT_MS        500     /**< Decoder re-checks for close while buffering */
+#define NET_REBUFFER_DECAY_US   (30 * 1000000LL)
+#define NET_URL_MAX             256
+#define NET_TASK_STACK          6144    /**< mbedTLS record decryption runs on this stack */
+#define NET_TASK_PRIO           CONFIG_AUDIO_NET_TASK_PRIORITY
+
+_Static_assert((NET_BUFFER_BYTES & (NET_BUFFER_BYTES - 1)) == 0,
+               "Network jitter buffer size must be a power of two");
+
+/*===========================================================================
+ * Module State
+ *===========================================================================*/
+
+static uint8_t *s_ring = NULL;
+static atomic_uint s_wr;                /**< Bytes published (reader only writes) */
+static atomic_uint s_rd;                /**< Bytes consumed (decoder only writes) */
+static atomic_bool s_eof;               /**< Reader finished: end of body or gave up */
+static atomic_bool s_stop;              /**< close() asks the reader to exit */
+static atomic_bool s_reader_parked;     /**< Reader waits for ring space */
+
+/* Reader task only (close() reads them after the task has exited) */
+static char s_url[NET_URL_MAX];
+static size_t s_offset;                 /**< Body bytes received, resume point */
+static bool s_complete;                 /**< Body read to the end */
+static uint64_t s_net_us;               /**< Time spent in network reads */
+
+/* Decoder side only */
+static bool s_buffering;
+static bool s_started;                  /**< Prebuffer done, decoder has had data */
+static uint32_t s_target;               /**< Bytes to buffer before leaving s_buffering */
+static int64_t s_buffer_t0;             /**< Start of the current (pre/re)buffering */
+static int64_t s_last_stall;
+
+static atomic_uint s_bitrate_bps = CONFIG_AUDIO_NET_NOMINAL_KBPS * 1000;
+static uint32_t s_rebuffer_ms = CONFIG_AUDIO_NET_REBUFFER_MS;    /**< Adaptive, kept across streams */
+static int64_t s_open_t0;
+
+static SemaphoreHandle_t s_data_sem = NULL; /**< Given by the reader after each read */
+static SemaphoreHandle_t s_wake_sem = NULL; /**< Wakes a parked or backing-off reader */
+static SemaphoreHandle_t s_done_sem = NULL; /**< Given by the reader as it exits */
+
+static audio_net_stream_stats_t s_stats = { .min_level_bytes = NET_BUFFER_BYTES };
+
+/*===========================================================================
+ * Helpers
+ *===========================================================================*/
+
+static inline uint32_t buffered_bytes(void)
+{
+    return atomic_load_explicit(&s_wr, memory_order_acquire) -
+           atomic_load_explicit(&s_rd, memory_order_acquire);
+}
+
+/**
+ * @brief Milliseconds of audio at the current bitrate -> bytes
+ *
+ * Clamped so the target always fits the ring with room for one read.
+ */
+static uint32_t ms_to_bytes(uint32_t ms)
+{
+    uint64_t bytes = (uint64_t)ms * atomic_load_explicit(&s_bitrate_bps, memory_order_relaxed) / 8000;
+    if (bytes > NET_BUFFER_BYTES - NET_READ_MAX) {
+        bytes = NET_BUFFER_BYTES - NET_READ_MAX;
+    }
+    return bytes > 0 ? (uint32_t)bytes : 1;
+}
+
+/**
+ * @brief Ring length in ms at the current bitrate (rebuffer target ceiling)
+ */
+static uint32_t ring_ms(void)
+{
+    uint32_t bps = atomic_load_explicit(&s_bitrate_bps, memory_order_relaxed);
+    return (uint32_t)((uint64_t)(NET_BUFFER_BYTES - NET_READ_MAX) * 8000 / (bps > 0 ? bps : 1));
+}
+
+/**
+ * @brief Rebuffer target for a stall starting now, raised for the next one
+ *
+ * The target first decays for the stall-free time since the last stall.
+ */
+static uint32_t next_rebuffer_ms(int64_t now)
+{
+    if (s_last_stall != 0) {
+        for (int64_t t = now - s_last_stall; t >= NET_REBUFFER_DECAY_US &&
+             s_rebuffer_ms > CONFIG_AUDIO_NET_REBUFFER_MS; t -= NET_REBUFFER_DECAY_US) {
+            s_rebuffer_ms -= s_rebuffer_ms / 4;
+        }
+        if (s_rebuffer_ms < CONFIG_AUDIO_NET_REBUFFER_MS) {
+            s_rebuffer_ms = CONFIG_AUDIO_NET_REBUFFER_MS;
+        }
+    }
+    s_last_stall = now;
+
+    uint32_t ms = s_rebuffer_ms;
+    uint32_t ceiling = ring_ms();
+    s_rebuffer_ms += s_rebuffer_ms / 2;
+    if (s_rebuffer_ms > ceiling) {
+        s_rebuffer_ms = ceiling;
+    }
+    return ms;
+}
+
+/*===========================================================================
+ * Reader Task
+ *===========================================================================*/
+
+/**
+ * @brief Resume a dropped connection at s_offset
+ *
+ * Sleeps on s_wake_sem between attempts so close() can cut the back-off
+ * short.
+ *
+ * @return false once the retries are used up or close() was called
+ */
+static bool reconnect(int *failures)
+{
+    net_api_stream_close(false);
+    while (!atomic_load(&s_stop) && *failures < NET_MAX_RETRIES) {
+        xSemaphoreTake(s_wake_sem, pdMS_TO_TICKS(NET_RETRY_BASE_MS << *failures));
+        (*failures)++;
+        if (atomic_load(&s_stop)) {
+            break;
+        }
+        ESP_LOGW(TAG, "Connection lost at %u bytes, reconnect %d/%d",
+                 (unsigned)s_offset, *failures, NET_MAX_RETRIES);
+        if (net_api_stream_open(s_url, s_offset, CONFIG_AUDIO_NET_STALL_TIMEOUT_MS, NULL) == ESP_OK) {
+            s_stats.reconnects++;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void reader_task(void *pvParameters)
+{
+    int failures = 0;
+
+    while (!atomic_load(&s_stop)) {
+        unsigned wr = atomic_load_explicit(&s_wr, memory_order_relaxed);
+        uint32_t space = NET_BUFFER_BYTES - (wr - atomic_load_explicit(&s_rd, memory_order_acquire));
+
+        if (space < NET_READ_MIN) {
+            /* Park until the decoder frees space (re-check after announcing
+             * it, the decoder may have just read) */
+            atomic_store(&s_reader_parked, true);
+            if (NET_BUFFER_BYTES - (wr - atomic_load(&s_rd)) < NET_READ_MIN) {
+                xSemaphoreTake(s_wake_sem, portMAX_DELAY);
+            }
+            atomic_store(&s_reader_parked, false);
+            continue;
+        }
+
+        /* Straight into the contiguous free region */
+        uint32_t off = wr & (NET_BUFFER_BYTES - 1);
+        uint32_t n = NET_BUFFER_BYTES - off;
+        if (n > space) {
+            n = space;
+        }
+        if (n > NET_READ_MAX) {
+            n = NET_READ_MAX;
+        }
+
+        int64_t t0 = esp_timer_get_time();
+        int got = net_api_stream_read((char *)&s_ring[off], (int)n);
+        s_net_us += (uint64_t)(esp_timer_get_time() - t0);
+
+        if (got > 0) {
+            atomic_store_explicit(&s_wr, wr + (unsigned)got, memory_order_release);
+            s_offset += (size_t)got;
+            s_stats.bytes_received += (uint64_t)got;
+            failures = 0;
+            xSemaphoreGive(s_data_sem);
+            continue;
+        }
+        if (got == 0) {
+            s_complete = true;      /* End of body */
+            break;
+        }
+        if (!reconnect(&failures)) {
+            if (!atomic_load(&s_stop)) {
+                ESP_LOGE(TAG, "Stream dropped after %u bytes", (unsigned)s_offset);
+                s_stats.failures++;
+            }
+            break;
+        }
+    }
+
+    atomic_store_explicit(&s_eof, true, memory_order_release);
+    xSemaphoreGive(s_data_sem);
+    xSemaphoreGive(s_done_sem);
+    vTaskDelete(NULL);
+}
+
+/*===========================================================================
+ * Public API
+ *===========================================================================*/
+
+bool audio_net_stream_is_url(const char *url)
+{
+    return url != NULL && (strncmp(url, "http://", 7) == 0 || strncmp(url, "https://", 8) == 0);
+}
+
+esp_err_t audio_net_stream_open(const char *url)
+{
+    if (!audio_net_stream_is_url(url) || strlen(url) >= sizeof(s_url)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    audio_net_stream_close();
+    s_open_t0 = esp_timer_get_time();
+
+    net_api_stream_info_t info;
+    esp_err_t err = net_api_stream_open(url, 0, CONFIG_AUDIO_NET_STALL_TIMEOUT_MS, &info);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Cannot open %s (HTTP %d)", url, info.status_code);
+        return err;
+    }
+    s_stats.last_connect_us = (uint32_t)(esp_timer_get_time() - s_open_t0);
+    if (info.reused) {
+        s_stats.reused_connections++;
+    }
+
+    s_ring = heap_caps_malloc(NET_BUFFER_BYTES, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (s_data_sem == NULL) {
+        s_data_sem = xSemaphoreCreateBinary();
+        s_wake_sem = xSemaphoreCreateBinary();
+        s_done_sem = xSemaphoreCreateBinary();
+    }
+    if (s_ring == NULL || s_data_sem == NULL || s_wake_sem == NULL || s_done_sem == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate %d KB jitter buffer", CONFIG_AUDIO_NET_BUFFER_KB);
+        net_api_stream_close(false);
+        heap_caps_free(s_ring);
+        s_ring = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+
+    strlcpy(s_url, url, sizeof(s_url));
+    s_offset = 0;
+    s_complete = false;
+    atomic_store(&s_wr, 0);
+    atomic_store(&s_rd, 0);
+    atomic_store(&s_eof, false);
+    atomic_store(&s_stop, false);
+    atomic_store(&s_reader_parked, false);
+    xSemaphoreTake(s_data_sem, 0);      /* Drop stale signals */
+    xSemaphoreTake(s_wake_sem, 0);
+    xSemaphoreTake(s_done_sem, 0);
+
+    s_buffering = true;
+    s_started = false;
+    s_target = ms_to_bytes(CONFIG_AUDIO_NET_PREBUFFER_MS);
+    s_buffer_t0 = s_open_t0;
+
+    if (xTaskCreate(reader_task, "audio_net_rd", NET_TASK_STACK, NULL,
+                    NET_TASK_PRIO, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create reader task");
+        net_api_stream_close(false);
+        heap_caps_free(s_ring);
+        s_ring = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+
+    s_stats.streams++;
+    ESP_LOGI(TAG, "Streaming %s: %lld bytes, prebuffer %u bytes, connect %u us%s", url,
+             (long long)info.content_length, (unsigned)s_target,
+             (unsigned)s_stats.last_connect_us, info.reused ? " (kept connection)" : "");
+    return ESP_OK;
+}
+
+void audio_net_stream_close(void)
+{
+    if (s_ring == NULL) {
+        return;
+    }
+
+    /* The reader leaves within one receive timeout */
+    atomic_store(&s_stop, true);
+    atomic_store_explicit(&s_eof, true, memory_order_release);
+    xSemaphoreGive(s_wake_sem);
+    xSemaphoreTake(s_done_sem, portMAX_DELAY);
+    xSemaphoreGive(s_data_sem);         /* Wake a decoder blocked in audio_net_stream_read() */
+
+    net_api_stream_close(s_complete);
+    heap_caps_free(s_ring);
+    s_ring = NULL;
+}
+
+int audio_net_stream_read(uint8_t *dst, int size)
+{
+    if (s_ring == NULL || dst == NULL || size <= 0) {
+        return 0;
+    }
+
+    int copied = 0;
+    while (copied < size && !atomic_load(&s_stop)) {
+        bool eof = atomic_load_explicit(&s_eof, memory_order_acquire);
+        uint32_t level = buffered_bytes();      /* After eof: final */
+
+        if (s_buffering) {
+            if (level < s_target && !eof) {
+                xSemaphoreTake(s_data_sem, pdMS_TO_TICKS(NET_DATA_WAIT_MS));
+                continue;
+            }
+            /* Threshold reached (or nothing more coming) */
+            int64_t now = esp_timer_get_time();
+            uint32_t waited = (uint32_t)(now - s_buffer_t0);
+            s_buffering = false;
+            if (!s_started) {
+                s_started = true;
+                s_stats.last_startup_us = (uint32_t)(now - s_open_t0);
+                if (s_stats.last_startup_us > s_stats.max_startup_us) {
+                    s_stats.max_startup_us = s_stats.last_startup_us;
+                }
+            } else {
+                s_stats.stall_us += waited;
+                if (waited > s_stats.max_stall_us) {
+                    s_stats.max_stall_us = waited;
+                }
+                audio_telemetry_record(AUDIO_METRIC_NET_STALL_US, waited);
+            }
+        }
+
+        if (level == 0) {
+            if (eof || copied > 0) {
+                break;  /* End of stream, or hand back what we have */
+            }
+            /* Ran dry mid-stream: stall until the rebuffer target is back */
+            int64_t now = esp_timer_get_time();
+            s_stats.stalls++;
+            s_target = ms_to_bytes(next_rebuffer_ms(now));
+            s_buffering = true;
+            s_buffer_t0 = now;
+            ESP_LOGW(TAG, "Stall at %llu bytes, rebuffering %u bytes",
+                     (unsigned long long)s_stats.bytes_received, (unsigned)s_target);
+            continue;
+        }
+
+        unsigned rd = atomic_load_explicit(&s_rd, memory_order_relaxed);
+        uint32_t off = rd & (NET_BUFFER_BYTES - 1);
+        uint32_t n = NET_BUFFER_BYTES - off;
+        if (n > level) {
+            n = level;
+        }
+        if (n > (uint32_t)(size - copied)) {
+            n = (uint32_t)(size - copied);
+        }
+        memcpy(dst + copied, &s_ring[off], n);
+        copied += (int)n;
+        atomic_store_explicit(&s_rd, rd + n, memory_order_release);
+
+        level -= n;
+        if (level < s_stats.min_level_bytes && !eof) {
+            s_stats.min_level_bytes = level;
+        }
+        if (atomic_exchange(&s_reader_parked, false)) {
+            xSemaphoreGive(s_wake_sem);
+        }
+    }
+    return copied;
+}
+
+void audio_net_stream_set_bitrate(uint32_t bps)
+{
+    atomic_store_explicit(&s_bitrate_bps, bps != 0 ? bps : CONFIG_AUDIO_NET_NOMINAL_KBPS * 1000,
+                          memory_order_relaxed);
+}
+
+void audio_net_stream_get_stats(audio_net_stream_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    *stats = s_stats;
+    stats->throughput_bps = s_net_us > 0 ? (uint32_t)(s_stats.bytes_received * 8000000ULL / s_net_us) : 0;
+    stats->bitrate_bps = atomic_load_explicit(&s_bitrate_bps, memory_order_relaxed);
+    stats->prebuffer_bytes = ms_to_bytes(CONFIG_AUDIO_NET_PREBUFFER_MS);
+    stats->rebuffer_bytes = ms_to_bytes(s_rebuffer_ms);
+    stats->level_bytes = s_ring != NULL ? buffered_bytes() : 0;
+    stats->capacity_bytes = NET_BUFFER_BYTES;
+}
+
+void audio_net_stream_reset_stats(void)
+{
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.min_level_bytes = NET_BUFFER_BYTES;
+    s_net_us = 0;
+}
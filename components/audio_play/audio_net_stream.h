@@ -0,0 +1,84 @@
+/**
+ * @file audio_net_stream.h
+ * @brief HTTP(S) stream for the music decoder (internal to audio_play)
+ *
+ * The network counterpart of audio_sd_stream.h: a reader task pulls the
+ * body of an http:// or https:// URL through net_api's streaming client
+ * into a RAM jitter buffer, and the decoder's input callback only copies
+ * from RAM. Playback starts once the prebuffer threshold is reached and,
+ * after a stall, resumes once the (adaptive) rebuffer threshold is.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "audio_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief True for URLs this stream handles (http:// and https://)
+ */
+bool audio_net_stream_is_url(const char *url);
+
+/**
+ * @brief Connect, allocate the jitter buffer and start the reader task
+ *
+ * Blocks until the response headers are in (bounded by
+ * CONFIG_AUDIO_NET_STALL_TIMEOUT_MS), so an unreachable URL fails here
+ * like a missing file does in audio_sd_stream_open(). Any previous stream
+ * is closed first. Must not be called while the decoder is still pulling
+ * data.
+ *
+ * @param url Stream URL
+ * @return ESP_OK, ESP_ERR_NOT_FOUND if the server has no such file,
+ *         ESP_ERR_NO_MEM, ESP_FAIL if the connection failed
+ */
+esp_err_t audio_net_stream_open(const char *url);
+
+/**
+ * @brief Stop the reader task and free the jitter buffer (no-op if closed)
+ *
+ * A stream that was read to the end keeps its connection for the next one.
+ */
+void audio_net_stream_close(void);
+
+/**
+ * @brief Copy buffered data for the decoder
+ *
+ * Blocks while (pre/re)buffering: at the start until the prebuffer
+ * threshold is reached, and after the buffer ran dry until the rebuffer
+ * threshold is. The latter counts as a stall.
+ *
+ * @param dst Destination buffer
+ * @param size Bytes wanted
+ * @return Bytes copied, 0 at end of stream or on error
+ */
+int audio_net_stream_read(uint8_t *dst, int size);
+
+/**
+ * @brief Tell the stream the decoded bitrate
+ *
+ * Thresholds are configured in milliseconds of audio and converted with
+ * this rate (CONFIG_AUDIO_NET_NOMINAL_KBPS until the decoder reports one).
+ *
+ * @param bps Bits per second, 0 to go back to the nominal rate
+ */
+void audio_net_stream_set_bitrate(uint32_t bps);
+
+/**
+ * @brief Snapshot the stream counters
+ */
+void audio_net_stream_get_stats(audio_net_stream_stats_t *stats);
+
+/**
+ * @brief Clear the stream counters (the adaptive rebuffer target is kept)
+ */
+void audio_net_stream_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,294 @@
+/**
+ * @file audio_power.c
+ * @brief Output codec / amplifier power state machine
+ *
+ * Architecture:
+ * - Levels: OFF (ES8311 suspended), STANDBY (running, DAC muted, amp off),
+ *   ACTIVE (unmuted, amp on). The backend's set_power() moves between any
+ *   two in one batch and writes only registers that change.
+ * - Target: ACTIVE while a client holds the output or a hold/pre-warm has
+ *   not expired, then STANDBY until the standby hold expires, then OFF.
+ *   A one-shot esp_timer fires at the next expiry to step down.
+ * - Settle: waking reports how long the codec and amp need before output
+ *   is audible. It is kept as a deadline, so a client arriving while a
+ *   pre-warm is still settling only waits for the remainder.
+ *
+ * All transitions take s_lock; callers are the player task, the mixer
+ * task, the timer task and (through Audio_Prewarm) the UI.
+ */
+
+#include "audio_power.h"
+#include "audio_backend.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "sdkconfig.h"
+#include <string.h>
+
+static const char *TAG = "audio power";
+
+#define POWER_ACTIVE_HOLD_US    ((int64_t)CONFIG_AUDIO_POWER_ACTIVE_HOLD_MS * 1000)
+#define POWER_STANDBY_HOLD_US   ((int64_t)CONFIG_AUDIO_POWER_STANDBY_HOLD_MS * 1000)
+
+/*===========================================================================
+ * Module State
+ *===========================================================================*/
+
+static SemaphoreHandle_t s_lock = NULL;
+static esp_timer_handle_t s_timer = NULL;
+static uint32_t s_clients;              /**< AUDIO_POWER_CLIENT_* bits */
+static audio_power_level_t s_level = AUDIO_POWER_OFF;
+static int s_volume = CONFIG_AUDIO_DEFAULT_VOLUME;
+static int64_t s_active_until;          /**< Stay ACTIVE until (no client) */
+static int64_t s_standby_until;         /**< Then STANDBY until */
+static int64_t s_ready_at;              /**< Output audible from */
+static int64_t s_level_since;           /**< Entry time of s_level */
+static bool s_prewarmed;                /**< ACTIVE because of a pre-warm, no client since */
+static audio_power_stats_t s_stats;
+
+/*===========================================================================
+ * Transitions (s_lock held)
+ *===========================================================================*/
+
+static void account_level_time(int64_t now)
+{
+    uint64_t us = (uint64_t)(now - s_level_since);
+    switch (s_level) {
+        case AUDIO_POWER_OFF:     s_stats.off_us += us; break;
+        case AUDIO_POWER_STANDBY: s_stats.standby_us += us; break;
+        case AUDIO_POWER_ACTIVE:  s_stats.active_us += us; break;
+    }
+    s_level_since = now;
+}
+
+static void apply_level(audio_power_level_t level, int64_t now)
+{
+    if (level == s_level) {
+        return;
+    }
+    const audio_out_backend_t *out = audio_backend_get_output();
+    uint32_t settle_ms = 0;
+    if (out->set_power(out->ctx, level, s_volume, &settle_ms) != ESP_OK) {
+        return;     /* Retried on the next acquire or timer expiry */
+    }
+    ESP_LOGD(TAG, "Level %d -> %d", (int)s_level, (int)level);
+    account_level_time(now);
+    s_level = level;
+    s_stats.transitions++;
+    if (level == AUDIO_POWER_OFF) {
+        s_prewarmed = false;
+    }
+    int64_t ready = now + (int64_t)settle_ms * 1000;
+    if (ready > s_ready_at) {
+        s_ready_at = ready;
+    }
+}
+
+/**
+ * @brief Move to the level the clients and holds call for, re-arm the timer
+ */
+static void update(int64_t now)
+{
+    audio_power_level_t target;
+    int64_t next = 0;
+
+    if (s_clients != 0 || now < s_active_until) {
+        target = AUDIO_POWER_ACTIVE;
+        next = s_clients != 0 ? 0 : s_active_until;
+    } else if (now < s_standby_until) {
+        target = AUDIO_POWER_STANDBY;
+        next = s_standby_until;
+    } else {
+        target = AUDIO_POWER_OFF;
+    }
+    apply_level(target, now);
+
+    if (s_timer != NULL) {
+        esp_timer_stop(s_timer);
+        if (next != 0) {
+            esp_timer_start_once(s_timer, (uint64_t)(next - now));
+        }
+    }
+}
+
+static void hold_timer_cb(void *arg)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    update(esp_timer_get_time());
+    xSemaphoreGive(s_lock);
+}
+
+/*===========================================================================
+ * Internal API
+ *===========================================================================*/
+
+esp_err_t audio_power_init(void)
+{
+    if (s_timer != NULL) {
+        return ESP_OK;
+    }
+    if (s_lock == NULL) {
+        s_lock = xSemaphoreCreateMutex();
+        if (s_lock == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    const esp_timer_create_args_t args = {
+        .callback = hold_timer_cb,
+        .name = "audio_power",
+    };
+    if (esp_timer_create(&args, &s_timer) != ESP_OK) {
+        s_timer = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    int64_t now = esp_timer_get_time();
+    s_clients = 0;
+    s_level = AUDIO_POWER_OFF;      /* Matches a freshly installed backend */
+    s_level_since = now;
+    s_active_until = 0;
+    s_standby_until = now + POWER_STANDBY_HOLD_US;
+    s_ready_at = 0;
+    s_prewarmed = false;
+    update(now);
+    xSemaphoreGive(s_lock);
+    return ESP_OK;
+}
+
+void audio_power_deinit(void)
+{
+    if (s_timer == NULL) {
+        return;
+    }
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    esp_timer_stop(s_timer);
+    esp_timer_delete(s_timer);
+    s_timer = NULL;
+    s_clients = 0;
+    s_active_until = 0;
+    s_standby_until = 0;
+    apply_level(AUDIO_POWER_OFF, esp_timer_get_time());
+    xSemaphoreGive(s_lock);
+}
+
+uint32_t audio_power_acquire(uint32_t client)
+{
+    if (s_timer == NULL) {
+        return 0;
+    }
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    int64_t now = esp_timer_get_time();
+    bool first = (s_clients & client) == 0;
+
+    if (first) {
+        switch (s_level) {
+            case AUDIO_POWER_OFF:     s_stats.cold_starts++; break;
+            case AUDIO_POWER_STANDBY: s_stats.warm_starts++; break;
+            case AUDIO_POWER_ACTIVE:  s_stats.hot_starts++; break;
+        }
+        if (s_prewarmed) {
+            s_stats.prewarm_hits++;
+            s_prewarmed = false;
+        }
+    }
+    s_clients |= client;
+    update(now);
+
+    uint32_t wait_us = s_ready_at > now ? (uint32_t)(s_ready_at - now) : 0;
+    if (first) {
+        s_stats.settle_wait_us += wait_us;
+        if (wait_us > s_stats.max_settle_us) {
+            s_stats.max_settle_us = wait_us;
+        }
+    }
+    xSemaphoreGive(s_lock);
+    return (wait_us + 999) / 1000;
+}
+
+void audio_power_release(uint32_t client)
+{
+    if (s_timer == NULL) {
+        return;
+    }
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (s_clients & client) {
+        s_clients &= ~client;
+        if (s_clients == 0) {
+            int64_t now = esp_timer_get_time();
+            if (now + POWER_ACTIVE_HOLD_US > s_active_until) {
+                s_active_until = now + POWER_ACTIVE_HOLD_US;
+            }
+            s_standby_until = s_active_until + POWER_STANDBY_HOLD_US;
+            update(now);
+        }
+    }
+    xSemaphoreGive(s_lock);
+}
+
+void audio_power_prewarm(uint32_t hold_ms)
+{
+    if (s_timer == NULL) {
+        return;
+    }
+    int64_t hold_us = hold_ms != 0 ? (int64_t)hold_ms * 1000 : POWER_ACTIVE_HOLD_US;
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    int64_t now = esp_timer_get_time();
+    s_stats.prewarms++;
+    if (now + hold_us > s_active_until) {
+        s_active_until = now + hold_us;
+        s_standby_until = s_active_until + POWER_STANDBY_HOLD_US;
+    }
+    if (s_clients == 0 && s_level != AUDIO_POWER_ACTIVE) {
+        s_prewarmed = true;
+    }
+    update(now);
+    xSemaphoreGive(s_lock);
+}
+
+void audio_power_set_volume(int volume)
+{
+    if (s_lock == NULL) {
+        s_volume = volume;      /* Applied when the codec is first woken */
+        return;
+    }
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (volume != s_volume) {
+        s_volume = volume;
+        if (s_timer != NULL && s_level != AUDIO_POWER_OFF) {
+            const audio_out_backend_t *out = audio_backend_get_output();
+            uint32_t settle_ms;
+            out->set_power(out->ctx, s_level, s_volume, &settle_ms);
+        }
+    }
+    xSemaphoreGive(s_lock);
+}
+
+void audio_power_get_stats(audio_power_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    if (s_lock == NULL) {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    account_level_time(esp_timer_get_time());
+    *stats = s_stats;
+    stats->level = (uint8_t)s_level;
+    xSemaphoreGive(s_lock);
+}
+
+void audio_power_reset_stats(void)
+{
+    if (s_lock == NULL) {
+        return;
+    }
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_level_since = esp_timer_get_time();
+    xSemaphoreGive(s_lock);
+}
@@ -0,0 +1,91 @@
+/**
+ * @file audio_power.h
+ * @brief Output codec / amplifier power states (internal to audio_play)
+ *
+ * The music player and the mixer claim the output while they produce
+ * audio. When the last client lets go the output stays ACTIVE for
+ * CONFIG_AUDIO_POWER_ACTIVE_HOLD_MS (back-to-back sounds start hot), drops
+ * to STANDBY (codec running, DAC muted, amp off) and after
+ * CONFIG_AUDIO_POWER_STANDBY_HOLD_MS to OFF (codec suspended). The
+ * hysteresis keeps bursts of short sounds from toggling the codec.
+ *
+ * audio_power_prewarm() lets a caller that expects a sound soon (the UI
+ * entering a state with sound effects) start the codec ahead of time, so
+ * the first sample does not wait for codec start-up and amp settling.
+ */
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "audio_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AUDIO_POWER_CLIENT_MUSIC    (1u << 0)   /**< Music player (decoder output ring) */
+#define AUDIO_POWER_CLIENT_MIXER    (1u << 1)   /**< Sound-effect mixer */
+
+/**
+ * @brief Create the lock and hold timer, start in STANDBY
+ *
+ * The output backend must be installed. The codec is running after board
+ * init, so it is taken to STANDBY and falls to OFF once the standby hold
+ * expires without a client.
+ *
+ * @return ESP_OK (also if already running), ESP_ERR_NO_MEM
+ */
+esp_err_t audio_power_init(void);
+
+/**
+ * @brief Power the output off and delete the timer
+ */
+void audio_power_deinit(void);
+
+/**
+ * @brief Claim the output (ACTIVE until released)
+ *
+ * Does not block: the caller decides whether to wait for the returned
+ * settle time before its first write.
+ *
+ * @param client AUDIO_POWER_CLIENT_*
+ * @return Milliseconds until output is audible (0 on a hot start)
+ */
+uint32_t audio_power_acquire(uint32_t client);
+
+/**
+ * @brief Release a claim; the output steps down after the hold times
+ * @param client AUDIO_POWER_CLIENT_*
+ */
+void audio_power_release(uint32_t client);
+
+/**
+ * @brief Go ACTIVE now and stay there for at least @p hold_ms
+ *
+ * Non-blocking. A later audio_power_acquire() within the hold is a hot
+ * start and counts as a pre-warm hit.
+ *
+ * @param hold_ms Time to stay ACTIVE without a client (0 = active hold time)
+ */
+void audio_power_prewarm(uint32_t hold_ms);
+
+/**
+ * @brief Set the output volume (0..100)
+ *
+ * Written to the codec now if it is powered, otherwise on the next wake.
+ */
+void audio_power_set_volume(int volume);
+
+/**
+ * @brief Snapshot the power counters (time in the current level included)
+ */
+void audio_power_get_stats(audio_power_stats_t *stats);
+
+/**
+ * @brief Clear the power counters (the current level is kept)
+ */
+void audio_power_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
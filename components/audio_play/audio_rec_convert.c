@@ -0,0 +1,76 @@
+/**
+ * @file audio_rec_convert.c
+ * @brief Capture-side sample-format reduction kernels
+ *
+ * Each output sample is written at a lower address than the input it comes
+ * from, so a forward loop is safe in place. The stereo 32-bit paths - the
+ * recorder's normal input - are unrolled by hand; the rest are rare.
+ */
+
+#include "audio_rec_convert.h"
+#include <string.h>
+
+size_t audio_rec_to_s16(const void *in, size_t frames, uint8_t channels, uint8_t bits, int16_t *out)
+{
+    size_t n = frames * channels;
+
+    if (bits == 16) {
+        if ((const void *)out != in) {
+            memmove(out, in, n * sizeof(int16_t));
+        }
+        return n;
+    }
+
+    const int32_t *src = (const int32_t *)in;
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        int32_t a = src[i], b = src[i + 1], c = src[i + 2], d = src[i + 3];
+        out[i]     = (int16_t)(a >> 16);
+        out[i + 1] = (int16_t)(b >> 16);
+        out[i + 2] = (int16_t)(c >> 16);
+        out[i + 3] = (int16_t)(d >> 16);
+    }
+    for (; i < n; i++) {
+        out[i] = (int16_t)(src[i] >> 16);
+    }
+    return n;
+}
+
+size_t audio_rec_to_s16_mono(const void *in, size_t frames, uint8_t channels, uint8_t bits,
+                             int8_t source, int16_t *out)
+{
+    if (channels == 1) {
+        return audio_rec_to_s16(in, frames, 1, bits, out);
+    }
+    if (source >= (int8_t)channels) {
+        source = AUDIO_REC_MONO_MIX;
+    }
+
+    if (bits == 32) {
+        const int32_t *src = (const int32_t *)in;
+        if (source == AUDIO_REC_MONO_MIX) {
+            /* Halve before adding so the sum cannot overflow */
+            for (size_t i = 0; i < frames; i++) {
+                out[i] = (int16_t)(((src[2 * i] >> 1) + (src[2 * i + 1] >> 1)) >> 16);
+            }
+        } else {
+            src += source;
+            for (size_t i = 0; i < frames; i++) {
+                out[i] = (int16_t)(src[2 * i] >> 16);
+            }
+        }
+    } else {
+        const int16_t *src = (const int16_t *)in;
+        if (source == AUDIO_REC_MONO_MIX) {
+            for (size_t i = 0; i < frames; i++) {
+                out[i] = (int16_t)((src[2 * i] + src[2 * i + 1]) >> 1);
+            }
+        } else {
+            src += source;
+            for (size_t i = 0; i < frames; i++) {
+                out[i] = src[2 * i];
+            }
+        }
+    }
+    return frames;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file audio_rec_convert.h
+ * @brief Capture-side sample-format reduction kernels (internal to audio_play)
+ *
+ * Turn I2S frames (16- or 32-bit, mono or stereo) into 16-bit PCM before
+ * they are buffered and written to the card. Plain C with no ESP-IDF
+ * dependencies, so the kernels also build on the host.
+ *
+ * 32-bit samples keep their top 16 bits. With the ES7210 running 32-bit
+ * stereo these are the two microphone words of esp_get_feed_data()'s
+ * channel map ("RMNM": words 1 and 3); the low halves carry the reference
+ * and an unused slot, so nothing audible is lost.
+ *
+ * All kernels may run in place (@p out == @p in).
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AUDIO_REC_MONO_MIX  (-1)    /**< Mono source: average of all channels */
+
+/**
+ * @brief Reduce to 16-bit, keeping every channel
+ *
+ * @param in Interleaved input frames
+ * @param frames Number of frames
+ * @param channels Input channels (1 or 2)
+ * @param bits Input bits per sample (16 or 32)
+ * @param[out] out 16-bit interleaved output
+ * @return Output samples (frames * channels)
+ */
+size_t audio_rec_to_s16(const void *in, size_t frames, uint8_t channels, uint8_t bits, int16_t *out);
+
+/**
+ * @brief Reduce to 16-bit mono
+ *
+ * @param in Interleaved input frames
+ * @param frames Number of frames
+ * @param channels Input channels (1 or 2)
+ * @param bits Input bits per sample (16 or 32)
+ * @param source Channel to keep, or AUDIO_REC_MONO_MIX
+ * @param[out] out 16-bit mono output
+ * @return Output samples (frames)
+ */
+size_t audio_rec_to_s16_mono(const void *in, size_t frames, uint8_t channels, uint8_t bits,
+                             int8_t source, int16_t *out);
+
+#ifdef __cplusplus
+}
+#endif
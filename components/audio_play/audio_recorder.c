@@ -0,0 +1,1252 @@
+/**
+ * @file audio_recorder.c
+ * @brief Streaming WAV recorder: I2S reader task -> ring -> SD writer task
+ *
+ * The old recorder read 8 KB from I2S and fwrite()'d it from the same task,
+ * so every slow SD write (FAT allocation, card busy, display holding the
+ * bus) stalled the I2S reads and the DMA queue overflowed silently. Here
+ * capture and storage are decoupled.
+ *
+ * Architecture:
+ * - Reader Task: CONFIG_AUDIO_REC_READER_TASK_PRIORITY. Reads I2S into a
+ *   scratch buffer, reduces the sample format in place (audio_rec_convert,
+ *   IMA-ADPCM) and copies the result into the ring. If the ring has no
+ *   room the read is dropped, so the DMA queue is still drained.
+ * - Ring: CONFIG_AUDIO_REC_RING_KB, single producer / single consumer with
+ *   free-running C11 atomic counters. The counters are file offsets (they
+ *   start after the WAV header), so ring positions and file positions
+ *   share the same block alignment.
+ * - Writer Task: CONFIG_AUDIO_REC_WRITER_TASK_PRIORITY. Writes one
+ *   CONFIG_AUDIO_REC_WRITE_BLOCK_KB block at a time, ending on a block
+ *   boundary of the file: with a 16 KB FAT cluster every write after the
+ *   first fills exactly one cluster and FATFS issues multi-sector
+ *   transfers instead of read-modify-write. Only the fwrite() holds the
+ *   SPI bus.
+ * - Loss accounting: ring-full drops are counted by the reader, capture
+ *   overruns (I2S DMA receive-queue overflows) by the input backend.
+ * - Input: audio_backend_get_input() - the ES7210 on the board, a WAV file
+ *   or silence on the host.
+ * - Pre-roll (optional): between recordings a pre-roll task keeps the last
+ *   CONFIG_AUDIO_REC_PREROLL_KB of 16-bit audio in a small overwrite-oldest
+ *   ring. audio_recorder_start() opens the file while it keeps running,
+ *   then stops it, copies the snapshot into the recording ring as the first
+ *   audio of the file and starts the reader on the same, undrained I2S
+ *   queue - no gap, no start-up jitter, and the moment before the tap is
+ *   in the file.
+ * - Locking: start, stop and every pre-roll transition run under one
+ *   recorder mutex, so the power manager suspending the pre-roll cannot
+ *   interleave with a recording being started or collected, and two
+ *   callers of stop() cannot both wait for the writer.
+ *
+ * Stored bytes per second at 16 kHz stereo 32-bit input:
+ *   RAW 128 KB, PCM16 64 KB, PCM16_MONO 32 KB, ADPCM ~8 KB.
+ */
+
+#include "audio_recorder.h"
+#include "audio_rec_convert.h"
+#include "audio_adpcm.h"
+#include "audio_backend.h"
+#include "bsp_board.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <inttypes.h>
+#include <math.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "audio rec";
+
+/*===========================================================================
+ * Configuration
+ *===========================================================================*/
+
+#define REC_RING_BYTES      (CONFIG_AUDIO_REC_RING_KB * 1024)
+#define REC_BLOCK_BYTES     (CONFIG_AUDIO_REC_WRITE_BLOCK_KB * 1024)
+#define REC_READ_BYTES      2048    /**< Bytes per backend read */
+#define REC_READ_WAIT_MS    100     /**< Per-read wait; bounds stop latency */
+#define REC_STOP_WAIT_MS    5000    /**< Flush + header patch budget in stop() */
+#define REC_ADPCM_ALIGN     256     /**< IMA-ADPCM block size (505 samples) */
+#define REC_READER_STACK    2560
+#define REC_WRITER_STACK    4096
+#define REC_PREROLL_BYTES   (CONFIG_AUDIO_REC_PREROLL_KB * 1024)
+#define REC_PREROLL_WAIT_MS (REC_READ_WAIT_MS * 2)  /**< Pre-roll task exit budget */
+#define REC_START_MAX_US    (CONFIG_AUDIO_REC_START_MAX_MS * 1000)
+
+_Static_assert((REC_RING_BYTES & (REC_RING_BYTES - 1)) == 0,
+               "CONFIG_AUDIO_REC_RING_KB must be a power of two");
+_Static_assert((REC_BLOCK_BYTES & (REC_BLOCK_BYTES - 1)) == 0,
+               "CONFIG_AUDIO_REC_WRITE_BLOCK_KB must be a power of two");
+_Static_assert(REC_BLOCK_BYTES * 2 <= REC_RING_BYTES,
+               "Ring must hold at least two write blocks");
+_Static_assert(REC_PREROLL_BYTES <= REC_RING_BYTES / 2,
+               "CONFIG_AUDIO_REC_PREROLL_KB must be at most half the recorder ring");
+_Static_assert(AUDIO_RECORDER_MONO_MIX == AUDIO_REC_MONO_MIX,
+               "Mono mix selectors must agree");
+
+/*===========================================================================
+ * WAV Headers
+ *===========================================================================*/
+
+/**
+ * @brief Canonical 44-byte PCM WAV header
+ */
+typedef struct __attribute__((packed)) {
+    char riff_id[4];            /**< "RIFF" */
+    uint32_t riff_size;         /**< File size minus 8 */
+    char wave_id[4];            /**< "WAVE" */
+    char fmt_id[4];             /**< "fmt " */
+    uint32_t fmt_size;          /**< 16 for PCM */
+    uint16_t audio_format;      /**< 1 = PCM */
+    uint16_t channels;
+    uint32_t sample_rate;
+    uint32_t byte_rate;
+    uint16_t block_align;
+    uint16_t bits_per_sample;
+    char data_id[4];            /**< "data" */
+    uint32_t data_size;         /**< PCM bytes */
+} wav_header_t;
+
+/**
+ * @brief 60-byte IMA-ADPCM WAV header (extended fmt chunk + fact chunk)
+ */
+typedef struct __attribute__((packed)) {
+    char riff_id[4];            /**< "RIFF" */
+    uint32_t riff_size;         /**< File size minus 8 */
+    char wave_id[4];            /**< "WAVE" */
+    char fmt_id[4];             /**< "fmt " */
+    uint32_t fmt_size;          /**< 20 */
+    uint16_t audio_format;      /**< 0x11 = WAVE_FORMAT_DVI_ADPCM */
+    uint16_t channels;
+    uint32_t sample_rate;
+    uint32_t byte_rate;
+    uint16_t block_align;       /**< Bytes per block */
+    uint16_t bits_per_sample;   /**< 4 */
+    uint16_t cb_size;           /**< 2 */
+    uint16_t samples_per_block;
+    char fact_id[4];            /**< "fact" */
+    uint32_t fact_size;         /**< 4 */
+    uint32_t fact_samples;      /**< Decoded sample count */
+    char data_id[4];            /**< "data" */
+    uint32_t data_size;         /**< Encoded bytes (whole blocks) */
+} wav_adpcm_header_t;
+
+typedef union {
+    wav_header_t pcm;
+    wav_adpcm_header_t adpcm;
+} wav_any_header_t;
+
+_Static_assert(sizeof(wav_header_t) == 44, "WAV header must be 44 bytes");
+_Static_assert(sizeof(wav_adpcm_header_t) == 60, "ADPCM WAV header must be 60 bytes");
+
+#define REC_MAX_DATA_BYTES  (UINT32_MAX - sizeof(wav_any_header_t) - REC_BLOCK_BYTES)
+
+/*===========================================================================
+ * Module State
+ *===========================================================================*/
+
+static uint8_t *s_ring = NULL;              /**< REC_RING_BYTES + REC_READ_BYTES scratch */
+static FILE *s_file = NULL;
+static audio_recorder_config_t s_cfg;
+static uint32_t s_in_frame;                 /**< Bytes per I2S frame */
+static uint32_t s_out_align;                /**< Bytes per stored frame (ADPCM: per block) */
+static uint32_t s_data_offset;              /**< WAV header size */
+static uint64_t s_capture_limit;            /**< I2S bytes to read (duration limit) */
+static uint32_t s_end;                      /**< File offset capture must stop at (4 GB cap) */
+static audio_adpcm_encoder_t s_enc;
+static uint32_t s_adpcm_samples;            /**< Samples queued in complete ADPCM blocks */
+
+static atomic_uint s_wr;                    /**< File offset of the next captured byte (reader only writes) */
+static atomic_uint s_rd;                    /**< File offset of the next byte to write (writer only writes) */
+static atomic_bool s_capturing;             /**< Reader running */
+static atomic_bool s_stop_req;              /**< Reader exits at its next read */
+static atomic_bool s_reader_done;           /**< Reader published its last byte */
+
+static TaskHandle_t s_reader_task = NULL;
+static TaskHandle_t s_writer_task = NULL;
+static StaticSemaphore_t s_done_buf;
+static SemaphoreHandle_t s_done = NULL;     /**< Given by the writer once the file is closed */
+static bool s_open = false;                 /**< A recording is started and not yet collected by stop() */
+static esp_err_t s_result = ESP_OK;
+
+static const audio_in_backend_t *s_in = NULL;
+static uint32_t s_ring_drop_bytes;
+
+static audio_recorder_stats_t s_stats;
+static uint32_t s_ovf_base_events;          /**< Overflows counted before a pre-roll handoff */
+static uint32_t s_ovf_base_bytes;
+static bool s_ovf_frozen;                   /**< Capture ended; the input may be reused by the pre-roll */
+static uint32_t s_ovf_final_events;
+static uint32_t s_ovf_final_bytes;
+
+/* Pre-roll - the ring is owned by the pre-roll task while it runs */
+static uint8_t *s_pre_buf = NULL;           /**< s_pre_cap ring + REC_READ_BYTES scratch */
+static uint32_t s_pre_cap;                  /**< Ring bytes (whole 16-bit frames) */
+static uint32_t s_pre_head;                 /**< Next write offset */
+static uint32_t s_pre_fill;                 /**< Valid bytes, oldest at s_pre_head - s_pre_fill */
+static audio_recorder_config_t s_pre_cfg;   /**< Format the ring is captured for */
+static uint8_t s_pre_channels;              /**< 1 for the mono formats, else the input channels */
+static TaskHandle_t s_pre_task = NULL;
+static atomic_bool s_pre_stop;
+static StaticSemaphore_t s_pre_done_buf;
+static SemaphoreHandle_t s_pre_done = NULL; /**< Given by the pre-roll task on exit */
+static bool s_pre_suspended = false;        /**< Power save */
+
+static StaticSemaphore_t s_lock_buf;
+static SemaphoreHandle_t s_lock = NULL;     /**< Serializes start/stop and the pre-roll transitions */
+static atomic_int s_lock_state;             /**< 0 = not created, 1 = being created, 2 = ready */
+
+/*===========================================================================
+ * Helpers
+ *===========================================================================*/
+
+/**
+ * @brief Take the recorder mutex, creating it on first use
+ *
+ * There is no init call, so the first caller creates the mutex; a
+ * concurrent first caller waits until it is ready.
+ */
+static void rec_lock(void)
+{
+    int expected = 0;
+    if (atomic_compare_exchange_strong(&s_lock_state, &expected, 1)) {
+        s_lock = xSemaphoreCreateMutexStatic(&s_lock_buf);
+        atomic_store(&s_lock_state, 2);
+    }
+    while (atomic_load(&s_lock_state) != 2) {
+        vTaskDelay(1);
+    }
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+}
+
+static void rec_unlock(void)
+{
+    xSemaphoreGive(s_lock);
+}
+
+/**
+ * @brief Capture overruns reported by the input backend
+ */
+static void input_overflows(uint32_t *events, uint32_t *bytes)
+{
+    if (s_ovf_frozen) {
+        *events = s_ovf_final_events;
+        *bytes = s_ovf_final_bytes;
+        return;
+    }
+    *events = 0;
+    *bytes = 0;
+    if (s_in != NULL && s_in->get_overflows != NULL) {
+        s_in->get_overflows(s_in->ctx, events, bytes);
+        *events -= s_ovf_base_events;
+        *bytes -= s_ovf_base_bytes;
+    }
+}
+
+/**
+ * @brief Take the SPI bus for file I/O, waiting as long as it takes
+ *
+ * The writer cannot give up on a block, so bounded waits are retried.
+ */
+static void bus_take(void)
+{
+    int64_t t0 = esp_timer_get_time();
+    while (bsp_spi_bus_acquire(BSP_SPI_CLIENT_FILE, BSP_SPI_BUS_WAIT_DEFAULT) != ESP_OK) {
+        ESP_LOGW(TAG, "SPI bus busy, retrying");
+    }
+    s_stats.bus_wait_us += (uint32_t)(esp_timer_get_time() - t0);
+}
+
+static void bus_give(void)
+{
+    bsp_spi_bus_release(BSP_SPI_CLIENT_FILE);
+}
+
+/**
+ * @brief Build the header for the configured format
+ * @return Header size in bytes
+ */
+static size_t fill_header(wav_any_header_t *h, uint32_t data_size, uint32_t samples)
+{
+    if (s_cfg.format == AUDIO_RECORDER_FORMAT_ADPCM) {
+        wav_adpcm_header_t *a = &h->adpcm;
+        memcpy(a->riff_id, "RIFF", 4);
+        a->riff_size = data_size + sizeof(*a) - 8;
+        memcpy(a->wave_id, "WAVE", 4);
+        memcpy(a->fmt_id, "fmt ", 4);
+        a->fmt_size = 20;
+        a->audio_format = 0x11;
+        a->channels = 1;
+        a->sample_rate = s_cfg.sample_rate;
+        a->byte_rate = (uint32_t)((uint64_t)s_cfg.sample_rate * s_enc.block_align / s_enc.block_samples);
+        a->block_align = s_enc.block_align;
+        a->bits_per_sample = 4;
+        a->cb_size = 2;
+        a->samples_per_block = s_enc.block_samples;
+        memcpy(a->fact_id, "fact", 4);
+        a->fact_size = 4;
+        a->fact_samples = samples;
+        memcpy(a->data_id, "data", 4);
+        a->data_size = data_size;
+        return sizeof(*a);
+    }
+
+    wav_header_t *p = &h->pcm;
+    memcpy(p->riff_id, "RIFF", 4);
+    p->riff_size = data_size + sizeof(*p) - 8;
+    memcpy(p->wave_id, "WAVE", 4);
+    memcpy(p->fmt_id, "fmt ", 4);
+    p->fmt_size = 16;
+    p->audio_format = 1;
+    p->channels = s_cfg.format == AUDIO_RECORDER_FORMAT_PCM16_MONO ? 1 : s_cfg.channels;
+    p->sample_rate = s_cfg.sample_rate;
+    p->byte_rate = s_cfg.sample_rate * s_out_align;
+    p->block_align = (uint16_t)s_out_align;
+    p->bits_per_sample = s_cfg.format == AUDIO_RECORDER_FORMAT_RAW ? s_cfg.bits_per_sample : 16;
+    memcpy(p->data_id, "data", 4);
+    p->data_size = data_size;
+    return sizeof(*p);
+}
+
+static inline uint32_t ring_level(void)
+{
+    return atomic_load_explicit(&s_wr, memory_order_acquire) -
+           atomic_load_explicit(&s_rd, memory_order_acquire);
+}
+
+/*===========================================================================
+ * Reader Task
+ *===========================================================================*/
+
+/**
+ * @brief Copy stored-format bytes into the ring (caller checked the space)
+ */
+static void ring_push(const uint8_t *src, uint32_t len)
+{
+    uint32_t wr = atomic_load_explicit(&s_wr, memory_order_relaxed);
+    uint32_t off = wr & (REC_RING_BYTES - 1);
+    uint32_t first = len < REC_RING_BYTES - off ? len : REC_RING_BYTES - off;
+    memcpy(&s_ring[off], src, first);
+    memcpy(s_ring, src + first, len - first);
+    atomic_store_explicit(&s_wr, wr + len, memory_order_release);
+
+    if ((wr ^ (wr + len)) & ~(uint32_t)(REC_BLOCK_BYTES - 1)) {
+        xTaskNotifyGive(s_writer_task);     /* Crossed a block boundary */
+    }
+}
+
+/**
+ * @brief Most ring bytes @p frames input frames can produce
+ */
+static uint32_t stored_bytes_max(uint32_t frames)
+{
+    if (s_cfg.format == AUDIO_RECORDER_FORMAT_ADPCM) {
+        return (s_enc.in_block + frames) / s_enc.block_samples * s_enc.block_align;
+    }
+    return frames * s_out_align;
+}
+
+/**
+ * @brief Encode 16-bit mono samples and queue every completed block
+ */
+static void push_adpcm(int16_t *pcm, size_t n)
+{
+    while (n > 0) {
+        size_t used;
+        const uint8_t *blk = audio_adpcm_encode_block(&s_enc, pcm, n, &used);
+        pcm += used;
+        n -= used;
+        if (blk != NULL) {
+            ring_push(blk, s_enc.block_align);
+            s_adpcm_samples += s_enc.block_samples;
+        }
+    }
+}
+
+/**
+ * @brief Reduce @p frames I2S frames at @p buf in place and queue them
+ */
+static void convert_and_push(uint8_t *buf, uint32_t frames)
+{
+    int16_t *pcm = (int16_t *)buf;
+    size_t n;
+
+    switch (s_cfg.format) {
+    case AUDIO_RECORDER_FORMAT_PCM16:
+        n = audio_rec_to_s16(buf, frames, s_cfg.channels, s_cfg.bits_per_sample, pcm);
+        ring_push(buf, n * sizeof(int16_t));
+        break;
+    case AUDIO_RECORDER_FORMAT_PCM16_MONO:
+        n = audio_rec_to_s16_mono(buf, frames, s_cfg.channels, s_cfg.bits_per_sample,
+                                  s_cfg.mono_source, pcm);
+        ring_push(buf, n * sizeof(int16_t));
+        break;
+    case AUDIO_RECORDER_FORMAT_ADPCM:
+        n = audio_rec_to_s16_mono(buf, frames, s_cfg.channels, s_cfg.bits_per_sample,
+                                  s_cfg.mono_source, pcm);
+        push_adpcm(pcm, n);
+        break;
+    default:
+        ring_push(buf, frames * s_in_frame);
+        break;
+    }
+}
+
+static void reader_task(void *pvParameters)
+{
+    uint8_t *buf = s_ring + REC_RING_BYTES;
+    uint32_t carry = 0;     /* Partial frame left at buf[0] by a short read */
+
+    while (!atomic_load_explicit(&s_stop_req, memory_order_relaxed)) {
+        if (s_stats.bytes_captured >= s_capture_limit ||
+            atomic_load_explicit(&s_wr, memory_order_relaxed) >= s_end) {
+            ESP_LOGI(TAG, "Duration limit reached");
+            break;
+        }
+
+        uint32_t len = REC_READ_BYTES - carry;
+        if (len > s_capture_limit - s_stats.bytes_captured) {
+            len = (uint32_t)(s_capture_limit - s_stats.bytes_captured);
+        }
+
+        size_t got = 0;
+        if (s_in->read(s_in->ctx, buf + carry, len, &got, REC_READ_WAIT_MS) != ESP_OK) {
+            s_stats.read_errors++;
+        }
+        s_stats.bytes_captured += got;
+
+        uint32_t have = carry + (uint32_t)got;
+        uint32_t frames = have / s_in_frame;
+        uint32_t whole = frames * s_in_frame;
+        carry = have - whole;
+        if (frames == 0) {
+            continue;
+        }
+
+        if (REC_RING_BYTES - ring_level() < stored_bytes_max(frames)) {
+            /* Writer is behind - drop whole frames, DMA keeps draining */
+            s_stats.ring_drops++;
+            s_ring_drop_bytes += whole;
+        } else {
+            int64_t t0 = esp_timer_get_time();
+            convert_and_push(buf, frames);
+            s_stats.convert_us += (uint32_t)(esp_timer_get_time() - t0);
+
+            uint32_t level = ring_level();
+            if (level > s_stats.max_level_bytes) {
+                s_stats.max_level_bytes = level;
+            }
+        }
+        if (carry > 0) {
+            memmove(buf, buf + whole, carry);
+        }
+    }
+
+    if (s_cfg.format == AUDIO_RECORDER_FORMAT_ADPCM) {
+        /* Close the last, partial block */
+        size_t samples;
+        const uint8_t *blk = audio_adpcm_encoder_flush(&s_enc, &samples);
+        if (blk != NULL && REC_RING_BYTES - ring_level() >= s_enc.block_align) {
+            ring_push(blk, s_enc.block_align);
+            s_adpcm_samples += samples;
+        }
+    }
+
+    input_overflows(&s_ovf_final_events, &s_ovf_final_bytes);
+    s_ovf_frozen = true;
+    if (s_in->stop != NULL) {
+        s_in->stop(s_in->ctx);
+    }
+    atomic_store_explicit(&s_capturing, false, memory_order_relaxed);
+    atomic_store_explicit(&s_reader_done, true, memory_order_release);
+    xTaskNotifyGive(s_writer_task);
+
+    s_reader_task = NULL;
+    vTaskDelete(NULL);
+}
+
+/*===========================================================================
+ * Writer Task
+ *===========================================================================*/
+
+/**
+ * @brief Write [rd, rd + len) from the ring (always contiguous)
+ * @return false on a short write
+ */
+static bool write_block(uint32_t rd, uint32_t len)
+{
+    bus_take();
+    int64_t t0 = esp_timer_get_time();
+    size_t n = fwrite(&s_ring[rd & (REC_RING_BYTES - 1)], 1, len, s_file);
+    uint32_t us = (uint32_t)(esp_timer_get_time() - t0);
+    bus_give();
+
+    s_stats.block_writes++;
+    s_stats.bytes_written += n;
+    if (us > s_stats.max_write_us) {
+        s_stats.max_write_us = us;
+    }
+    return n == len;
+}
+
+/**
+ * @brief Patch the final sizes into the header and close the file
+ */
+static esp_err_t close_file(bool ok)
+{
+    /* A recording cut mid-frame (or mid-block) keeps the tail out of the data chunk */
+    uint32_t data_size = (uint32_t)s_stats.bytes_written;
+    data_size -= data_size % s_out_align;
+
+    uint32_t samples = s_adpcm_samples;
+    if (s_cfg.format == AUDIO_RECORDER_FORMAT_ADPCM) {
+        uint32_t stored = data_size / s_enc.block_align * s_enc.block_samples;
+        if (samples > stored) {
+            samples = stored;   /* Lost blocks after a write error */
+        }
+    }
+
+    wav_any_header_t header;
+    size_t header_size = fill_header(&header, data_size, samples);
+
+    bus_take();
+    bool patched = fseek(s_file, 0, SEEK_SET) == 0 &&
+                   fwrite(&header, header_size, 1, s_file) == 1;
+    int closed = fclose(s_file);
+    bus_give();
+    s_file = NULL;
+
+    if (!patched || closed != 0) {
+        ESP_LOGE(TAG, "Failed to finalize WAV header");
+        return ESP_FAIL;
+    }
+    return ok ? ESP_OK : ESP_FAIL;
+}
+
+static void writer_task(void *pvParameters)
+{
+    bool ok = true;
+
+    for (;;) {
+        bool ending = atomic_load_explicit(&s_reader_done, memory_order_acquire);
+        uint32_t rd = atomic_load_explicit(&s_rd, memory_order_relaxed);
+        uint32_t level = atomic_load_explicit(&s_wr, memory_order_acquire) - rd;
+
+        /* Bytes up to the next block boundary of the file */
+        uint32_t want = REC_BLOCK_BYTES - (rd & (REC_BLOCK_BYTES - 1));
+
+        if (level >= want || (ending && level > 0)) {
+            uint32_t len = level >= want ? want : level;
+            if (ok && !write_block(rd, len)) {
+                ESP_LOGE(TAG, "SD write failed, stopping recording");
+                s_stats.write_errors++;
+                ok = false;
+                atomic_store_explicit(&s_stop_req, true, memory_order_relaxed);
+            }
+            atomic_store_explicit(&s_rd, rd + len, memory_order_release);
+            continue;
+        }
+        if (ending) {
+            break;
+        }
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+
+    /* The reader notifies us on its way out; let it finish first */
+    while (s_reader_task != NULL) {
+        vTaskDelay(1);
+    }
+
+    s_result = close_file(ok);
+    uint32_t ovf_events, ovf_bytes;
+    input_overflows(&ovf_events, &ovf_bytes);
+    ESP_LOGI(TAG, "Closed %s: %"PRIu32" bytes, %"PRIu32" frames dropped",
+             s_cfg.path, (uint32_t)s_stats.bytes_written,
+             (s_ring_drop_bytes + ovf_bytes) / s_in_frame);
+
+    s_writer_task = NULL;
+    xSemaphoreGive(s_done);
+    vTaskDelete(NULL);
+}
+
+/*===========================================================================
+ * Pre-roll
+ *===========================================================================*/
+
+static bool is_mono_format(audio_recorder_format_t format)
+{
+    return format == AUDIO_RECORDER_FORMAT_PCM16_MONO || format == AUDIO_RECORDER_FORMAT_ADPCM;
+}
+
+/**
+ * @brief Append 16-bit frames, overwriting the oldest when full
+ */
+static void preroll_push(const uint8_t *src, uint32_t len)
+{
+    if (len > s_pre_cap) {
+        src += len - s_pre_cap;
+        len = s_pre_cap;
+    }
+    uint32_t first = len < s_pre_cap - s_pre_head ? len : s_pre_cap - s_pre_head;
+    memcpy(&s_pre_buf[s_pre_head], src, first);
+    memcpy(s_pre_buf, src + first, len - first);
+    s_pre_head = (s_pre_head + len) % s_pre_cap;
+    s_pre_fill = s_pre_fill + len < s_pre_cap ? s_pre_fill + len : s_pre_cap;
+}
+
+static void preroll_task(void *pvParameters)
+{
+    uint8_t *buf = s_pre_buf + s_pre_cap;
+    uint32_t frame = (uint32_t)s_pre_cfg.channels * s_pre_cfg.bits_per_sample / 8;
+    uint32_t carry = 0;
+
+    /* Stop only on a frame boundary: the recording reader continues on the
+     * same I2S queue and must start on a whole frame */
+    while (!atomic_load_explicit(&s_pre_stop, memory_order_relaxed) || carry > 0) {
+        size_t got = 0;
+        s_in->read(s_in->ctx, buf + carry, REC_READ_BYTES - carry, &got, REC_READ_WAIT_MS);
+        if (got == 0 && atomic_load_explicit(&s_pre_stop, memory_order_relaxed)) {
+            break;      /* Input stalled; give up the partial frame */
+        }
+        uint32_t have = carry + (uint32_t)got;
+        uint32_t frames = have / frame;
+        uint32_t whole = frames * frame;
+        carry = have - whole;
+        if (frames > 0) {
+            int16_t *pcm = (int16_t *)buf;
+            size_t n = is_mono_format(s_pre_cfg.format)
+                ? audio_rec_to_s16_mono(buf, frames, s_pre_cfg.channels, s_pre_cfg.bits_per_sample,
+                                        s_pre_cfg.mono_source, pcm)
+                : audio_rec_to_s16(buf, frames, s_pre_cfg.channels, s_pre_cfg.bits_per_sample, pcm);
+            preroll_push(buf, n * sizeof(int16_t));
+        }
+        if (carry > 0) {
+            memmove(buf, buf + whole, carry);
+        }
+    }
+
+    s_pre_task = NULL;
+    xSemaphoreGive(s_pre_done);
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief Start filling the pre-roll ring (fresh, input restarted)
+ */
+static esp_err_t preroll_run(void)
+{
+    if (s_pre_buf == NULL || s_pre_task != NULL || s_pre_suspended || s_open) {
+        return ESP_OK;
+    }
+    s_in = audio_backend_get_input();
+    if (s_in == NULL || s_in->read == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_err_t ret = s_in->start != NULL ? s_in->start(s_in->ctx) : ESP_OK;
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    s_pre_head = 0;
+    s_pre_fill = 0;
+    atomic_store(&s_pre_stop, false);
+    xSemaphoreTake(s_pre_done, 0);
+    if (xTaskCreate(preroll_task, "audio_rec_pre", REC_READER_STACK, NULL,
+                    CONFIG_AUDIO_REC_READER_TASK_PRIORITY, &s_pre_task) != pdPASS) {
+        if (s_in->stop != NULL) {
+            s_in->stop(s_in->ctx);
+        }
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Stop the pre-roll task, leaving the ring and the input as they are
+ * @return false if the task did not exit in time
+ */
+static bool preroll_halt(void)
+{
+    if (s_pre_task == NULL) {
+        return true;
+    }
+    atomic_store_explicit(&s_pre_stop, true, memory_order_relaxed);
+    if (xSemaphoreTake(s_pre_done, pdMS_TO_TICKS(REC_PREROLL_WAIT_MS)) != pdTRUE) {
+        ESP_LOGE(TAG, "Pre-roll task did not stop");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief True if the pre-roll ring was captured in @p config's input format
+ */
+static bool preroll_matches(const audio_recorder_config_t *config)
+{
+    return s_pre_task != NULL &&
+           s_pre_cfg.sample_rate == config->sample_rate &&
+           s_pre_cfg.channels == config->channels &&
+           s_pre_cfg.bits_per_sample == config->bits_per_sample &&
+           is_mono_format(s_pre_cfg.format) == is_mono_format(config->format) &&
+           (!is_mono_format(config->format) || s_pre_cfg.mono_source == config->mono_source);
+}
+
+/**
+ * @brief Queue the pre-roll snapshot as the first audio of the recording
+ *
+ * Runs before the reader task starts, so the reader's scratch buffer is
+ * free. RAW 32-bit recordings get the 16-bit words back in the top half
+ * (the low halves, reference and unused slot, are zero for the pre-roll).
+ *
+ * @return Milliseconds of audio queued
+ */
+static uint32_t preroll_to_recording(void)
+{
+    const uint32_t pre_frame = (uint32_t)s_pre_channels * sizeof(int16_t);
+    const uint32_t piece_max = REC_READ_BYTES / 2 / pre_frame * pre_frame;   /* Room to widen 2x */
+    uint8_t *scratch = s_ring + REC_RING_BYTES;
+    uint32_t pos = (s_pre_head + s_pre_cap - s_pre_fill) % s_pre_cap;
+    uint32_t left = s_pre_fill;
+    uint32_t total_frames = 0;
+
+    while (left > 0) {
+        uint32_t len = left < piece_max ? left : piece_max;
+        uint32_t first = len < s_pre_cap - pos ? len : s_pre_cap - pos;
+        memcpy(scratch, &s_pre_buf[pos], first);
+        memcpy(scratch + first, s_pre_buf, len - first);
+        pos = (pos + len) % s_pre_cap;
+        left -= len;
+
+        uint32_t frames = len / pre_frame;
+        int16_t *pcm = (int16_t *)scratch;
+        if (s_cfg.format == AUDIO_RECORDER_FORMAT_ADPCM) {
+            push_adpcm(pcm, frames);
+        } else if (s_cfg.format == AUDIO_RECORDER_FORMAT_RAW && s_cfg.bits_per_sample == 32) {
+            int32_t *wide = (int32_t *)scratch;
+            for (int32_t i = (int32_t)(len / sizeof(int16_t)) - 1; i >= 0; i--) {
+                wide[i] = (int32_t)((uint32_t)(uint16_t)pcm[i] << 16);
+            }
+            ring_push(scratch, len * 2);
+        } else {
+            ring_push(scratch, len);
+        }
+        total_frames += frames;
+    }
+
+    s_stats.bytes_captured += (uint64_t)total_frames * s_in_frame;
+    s_pre_fill = 0;
+    return (uint32_t)((uint64_t)total_frames * 1000 / s_cfg.sample_rate);
+}
+
+/*===========================================================================
+ * Session Control (recorder mutex held)
+ *===========================================================================*/
+
+static bool config_valid(const audio_recorder_config_t *config)
+{
+    return config != NULL &&
+           (config->channels == 1 || config->channels == 2) &&
+           (config->bits_per_sample == 16 || config->bits_per_sample == 32) &&
+           config->sample_rate != 0 &&
+           config->format <= AUDIO_RECORDER_FORMAT_ADPCM &&
+           config->mono_source >= AUDIO_RECORDER_MONO_MIX &&
+           config->mono_source < config->channels;
+}
+
+/**
+ * @brief Collect the open recording; a no-op returning the last result if none
+ */
+static esp_err_t stop_locked(void)
+{
+    if (!s_open) {
+        return s_result;
+    }
+
+    atomic_store_explicit(&s_stop_req, true, memory_order_relaxed);
+    if (xSemaphoreTake(s_done, pdMS_TO_TICKS(REC_STOP_WAIT_MS)) != pdTRUE) {
+        ESP_LOGE(TAG, "Writer did not finish, recording left open");
+        return ESP_ERR_TIMEOUT;
+    }
+    heap_caps_free(s_ring);
+    s_ring = NULL;
+    s_open = false;
+    preroll_run();      /* Armed again for the next recording */
+    return s_result;
+}
+
+static esp_err_t start_locked(const audio_recorder_config_t *config)
+{
+    int64_t t_start = esp_timer_get_time();
+    if (!config_valid(config) || config->path == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_open) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    s_in = audio_backend_get_input();
+    if (s_in == NULL || s_in->read == NULL) {
+        ESP_LOGE(TAG, "No audio input backend");
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (s_done == NULL) {
+        s_done = xSemaphoreCreateBinaryStatic(&s_done_buf);
+    }
+    xSemaphoreTake(s_done, 0);
+
+    s_cfg = *config;
+    s_in_frame = (uint32_t)config->channels * config->bits_per_sample / 8;
+    audio_adpcm_encoder_init(&s_enc, REC_ADPCM_ALIGN);
+    s_adpcm_samples = 0;
+    switch (config->format) {
+    case AUDIO_RECORDER_FORMAT_PCM16:      s_out_align = config->channels * sizeof(int16_t); break;
+    case AUDIO_RECORDER_FORMAT_PCM16_MONO: s_out_align = sizeof(int16_t); break;
+    case AUDIO_RECORDER_FORMAT_ADPCM:      s_out_align = s_enc.block_align; break;
+    default:                               s_out_align = s_in_frame; break;
+    }
+
+    s_capture_limit = UINT64_MAX;
+    if (config->max_duration_ms > 0) {
+        s_capture_limit = (uint64_t)config->max_duration_ms * config->sample_rate / 1000 * s_in_frame;
+    }
+
+    s_ring = heap_caps_malloc(REC_RING_BYTES + REC_READ_BYTES, MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+    if (s_ring == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate %d KB recording ring", CONFIG_AUDIO_REC_RING_KB);
+        return ESP_ERR_NO_MEM;
+    }
+
+    memset(&s_stats, 0, sizeof(s_stats));
+    wav_any_header_t header;
+    s_data_offset = fill_header(&header, 0, 0);    /* Patched with the real sizes on close */
+    s_end = s_data_offset + REC_MAX_DATA_BYTES;
+
+    bus_take();
+    s_file = fopen(config->path, "wb");
+    if (s_file != NULL) {
+        /* Blocks are already cluster sized - skip newlib's stdio buffer */
+        setvbuf(s_file, NULL, _IONBF, 0);
+        if (fwrite(&header, s_data_offset, 1, s_file) != 1) {
+            fclose(s_file);
+            s_file = NULL;
+        }
+    }
+    bus_give();
+    if (s_file == NULL) {
+        ESP_LOGE(TAG, "Cannot create %s", config->path);
+        heap_caps_free(s_ring);
+        s_ring = NULL;
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    /* Pre-roll in the same input format: take over its I2S queue as is.
+     * Otherwise stop it and start the input afresh. */
+    bool handoff = preroll_matches(config);
+    if (!preroll_halt()) {
+        handoff = false;
+    }
+    esp_err_t ret = ESP_OK;
+    s_ovf_frozen = false;
+    s_ovf_base_events = 0;
+    s_ovf_base_bytes = 0;
+    if (handoff) {
+        input_overflows(&s_ovf_base_events, &s_ovf_base_bytes);
+    } else {
+        /* Discards audio queued since the last session and zeroes the overrun count */
+        ret = s_in->start != NULL ? s_in->start(s_in->ctx) : ESP_OK;
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Input %s failed to start: %s", s_in->name, esp_err_to_name(ret));
+        bus_take();
+        fclose(s_file);
+        bus_give();
+        s_file = NULL;
+        heap_caps_free(s_ring);
+        s_ring = NULL;
+        preroll_run();
+        return ret;
+    }
+
+    atomic_store(&s_wr, s_data_offset);
+    atomic_store(&s_rd, s_data_offset);
+    atomic_store(&s_stop_req, false);
+    atomic_store(&s_reader_done, false);
+    s_ring_drop_bytes = 0;
+    s_result = ESP_OK;
+    s_open = true;
+
+    if (xTaskCreate(writer_task, "audio_rec_wr", REC_WRITER_STACK, NULL,
+                    CONFIG_AUDIO_REC_WRITER_TASK_PRIORITY, &s_writer_task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create writer task");
+        if (s_in->stop != NULL) {
+            s_in->stop(s_in->ctx);
+        }
+        bus_take();
+        fclose(s_file);
+        bus_give();
+        s_file = NULL;
+        heap_caps_free(s_ring);
+        s_ring = NULL;
+        s_open = false;
+        preroll_run();
+        return ESP_ERR_NO_MEM;
+    }
+
+    if (handoff) {
+        s_stats.preroll_ms = preroll_to_recording();
+    }
+
+    atomic_store(&s_capturing, true);
+    if (xTaskCreate(reader_task, "audio_rec_rd", REC_READER_STACK, NULL,
+                    CONFIG_AUDIO_REC_READER_TASK_PRIORITY, &s_reader_task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create reader task");
+        /* Let the writer close the (empty) file normally */
+        if (s_in->stop != NULL) {
+            s_in->stop(s_in->ctx);
+        }
+        atomic_store(&s_capturing, false);
+        atomic_store_explicit(&s_reader_done, true, memory_order_release);
+        xTaskNotifyGive(s_writer_task);
+        stop_locked();
+        return ESP_ERR_NO_MEM;
+    }
+
+    s_stats.start_latency_us = (uint32_t)(esp_timer_get_time() - t_start);
+    s_stats.start_late = s_stats.start_latency_us > REC_START_MAX_US;
+    ESP_LOGI(TAG, "Recording %s: %"PRIu32" Hz, %d ch, %d bit, format %d, %d KB ring, %d KB blocks, "
+             "%"PRIu32" ms pre-roll",
+             config->path, config->sample_rate, config->channels, config->bits_per_sample,
+             config->format, CONFIG_AUDIO_REC_RING_KB, CONFIG_AUDIO_REC_WRITE_BLOCK_KB,
+             s_stats.preroll_ms);
+    if (s_stats.start_late) {
+        ESP_LOGW(TAG, "Start latency %"PRIu32" us exceeds the %d ms bound: FAIL",
+                 s_stats.start_latency_us, CONFIG_AUDIO_REC_START_MAX_MS);
+    } else {
+        ESP_LOGI(TAG, "Start latency %"PRIu32" us within the %d ms bound: pass",
+                 s_stats.start_latency_us, CONFIG_AUDIO_REC_START_MAX_MS);
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Stop the pre-roll task and the input it started
+ */
+static void preroll_park(void)
+{
+    bool was_running = s_pre_task != NULL;
+    preroll_halt();
+    if (was_running && !s_open && s_in != NULL && s_in->stop != NULL) {
+        s_in->stop(s_in->ctx);
+    }
+}
+
+static void preroll_disable_locked(void)
+{
+    if (s_pre_buf == NULL) {
+        return;
+    }
+    preroll_park();
+    if (s_pre_task != NULL) {
+        return;     /* Stuck in a read; keep its buffer */
+    }
+    heap_caps_free(s_pre_buf);
+    s_pre_buf = NULL;
+}
+
+static esp_err_t preroll_enable_locked(const audio_recorder_config_t *config, uint32_t ms)
+{
+    if (REC_PREROLL_BYTES == 0) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    if (!config_valid(config) || ms == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    preroll_disable_locked();
+
+    uint8_t channels = is_mono_format(config->format) ? 1 : config->channels;
+    uint32_t frame = channels * sizeof(int16_t);
+    uint64_t bytes = (uint64_t)ms * config->sample_rate / 1000 * frame;
+    if (bytes > REC_PREROLL_BYTES) {
+        ESP_LOGW(TAG, "Pre-roll of %"PRIu32" ms exceeds the %d KB budget, capped at %"PRIu32" ms",
+                 ms, CONFIG_AUDIO_REC_PREROLL_KB,
+                 (uint32_t)((uint64_t)REC_PREROLL_BYTES / frame * 1000 / config->sample_rate));
+        bytes = REC_PREROLL_BYTES;
+    }
+    uint32_t cap = (uint32_t)bytes / frame * frame;
+    if (cap == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (s_pre_done == NULL) {
+        s_pre_done = xSemaphoreCreateBinaryStatic(&s_pre_done_buf);
+    }
+    s_pre_buf = heap_caps_malloc(cap + REC_READ_BYTES, MALLOC_CAP_8BIT);
+    if (s_pre_buf == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate %"PRIu32" byte pre-roll ring", cap);
+        return ESP_ERR_NO_MEM;
+    }
+    s_pre_cfg = *config;
+    s_pre_cfg.path = NULL;
+    s_pre_channels = channels;
+    s_pre_cap = cap;
+
+    esp_err_t ret = preroll_run();
+    if (ret != ESP_OK) {
+        heap_caps_free(s_pre_buf);
+        s_pre_buf = NULL;
+        return ret;
+    }
+    ESP_LOGI(TAG, "Pre-roll: %"PRIu32" ms in %"PRIu32" bytes",
+             (uint32_t)((uint64_t)cap / frame * 1000 / config->sample_rate), cap);
+    return ESP_OK;
+}
+
+/*===========================================================================
+ * Public API
+ *===========================================================================*/
+
+esp_err_t audio_recorder_start(const audio_recorder_config_t *config)
+{
+    rec_lock();
+    esp_err_t ret = start_locked(config);
+    rec_unlock();
+    return ret;
+}
+
+esp_err_t audio_recorder_stop(void)
+{
+    rec_lock();
+    esp_err_t ret = stop_locked();
+    rec_unlock();
+    return ret;
+}
+
+bool audio_recorder_is_recording(void)
+{
+    return atomic_load_explicit(&s_capturing, memory_order_relaxed);
+}
+
+void audio_recorder_get_stats(audio_recorder_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    *stats = s_stats;
+    uint32_t ovf_bytes;
+    input_overflows(&stats->dma_overflows, &ovf_bytes);
+    stats->dropped_frames = s_in_frame ? (s_ring_drop_bytes + ovf_bytes) / s_in_frame : 0;
+    stats->level_bytes = s_ring ? ring_level() : 0;
+    stats->capacity_bytes = REC_RING_BYTES;
+    uint32_t byte_rate = s_cfg.sample_rate * s_in_frame;
+    stats->duration_ms = byte_rate ? (uint32_t)(stats->bytes_captured * 1000 / byte_rate) : 0;
+}
+
+esp_err_t audio_recorder_preroll_enable(const audio_recorder_config_t *config, uint32_t ms)
+{
+    rec_lock();
+    esp_err_t ret = preroll_enable_locked(config, ms);
+    rec_unlock();
+    return ret;
+}
+
+void audio_recorder_preroll_disable(void)
+{
+    rec_lock();
+    preroll_disable_locked();
+    rec_unlock();
+}
+
+void audio_recorder_preroll_suspend(bool suspend)
+{
+    rec_lock();
+    s_pre_suspended = suspend;
+    if (suspend) {
+        preroll_park();
+    } else {
+        preroll_run();
+    }
+    rec_unlock();
+}
+
+#if CONFIG_APP_SELF_TEST
+/*===========================================================================
+ * Verification (CONFIG_APP_SELF_TEST)
+ *===========================================================================*/
+
+#define CHECK_FRAMES        257     /**< Odd, so the unrolled kernels hit their tail */
+#define CHECK_TONE_SAMPLES  2048    /**< ADPCM round trip: 440 Hz at 16 kHz */
+#define CHECK_MIN_SNR_DB    20      /**< ADPCM round trip pass bound (a healthy codec gives ~26) */
+
+/**
+ * @brief Straightforward per-sample reduction the kernels must match
+ */
+static int16_t ref_sample(const void *in, size_t frame, uint8_t channels, uint8_t bits, int source)
+{
+    if (bits == 32) {
+        const int32_t *src = in;
+        if (source >= 0) {
+            return (int16_t)(src[frame * channels + source] >> 16);
+        }
+        int64_t sum = 0;
+        for (int c = 0; c < channels; c++) {
+            sum += src[frame * channels + c];
+        }
+        return (int16_t)((sum / channels) >> 16);
+    }
+    const int16_t *src = in;
+    if (source >= 0) {
+        return src[frame * channels + source];
+    }
+    int32_t sum = 0;
+    for (int c = 0; c < channels; c++) {
+        sum += src[frame * channels + c];
+    }
+    return (int16_t)(sum >> (channels - 1));
+}
+
+/**
+ * @brief Run one kernel out of place and in place, counting mismatches
+ * @param source Channel to keep, AUDIO_REC_MONO_MIX, or -2 for every channel
+ */
+static uint32_t check_kernel(const uint8_t *in, uint8_t *work, int16_t *out,
+                             uint8_t channels, uint8_t bits, int source, uint32_t *max_lsb)
+{
+    size_t in_bytes = CHECK_FRAMES * channels * (bits / 8);
+    uint8_t out_ch = source == -2 ? channels : 1;
+    uint32_t bad = 0;
+
+    for (int pass = 0; pass < 2; pass++) {
+        int16_t *dst = out;
+        const void *src = in;
+        if (pass == 1) {
+            memcpy(work, in, in_bytes);
+            src = work;
+            dst = (int16_t *)work;
+        }
+        size_t n = source == -2
+                 ? audio_rec_to_s16(src, CHECK_FRAMES, channels, bits, dst)
+                 : audio_rec_to_s16_mono(src, CHECK_FRAMES, channels, bits, (int8_t)source, dst);
+        if (n != (size_t)CHECK_FRAMES * out_ch) {
+            return bad + 1;
+        }
+
+        for (size_t f = 0; f < CHECK_FRAMES; f++) {
+            for (int c = 0; c < out_ch; c++) {
+                int16_t want = ref_sample(in, f, channels, bits, source == -2 ? c : source);
+                uint32_t err = (uint32_t)abs(dst[f * out_ch + c] - want);
+                /* 32-bit mixes halve before adding: 1 LSB of rounding */
+                uint32_t allowed = (bits == 32 && source == AUDIO_REC_MONO_MIX) ? 1 : 0;
+                if (err > *max_lsb) {
+                    *max_lsb = err;
+                }
+                bad += err > allowed;
+            }
+        }
+    }
+    return bad;
+}
+
+esp_err_t audio_recorder_check(audio_recorder_check_t *result)
+{
+    if (result == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *result = (audio_recorder_check_t){0};
+
+    const size_t in_bytes = CHECK_FRAMES * 2 * sizeof(int32_t);
+    const size_t blocks = CHECK_TONE_SAMPLES / AUDIO_ADPCM_BLOCK_SAMPLES(REC_ADPCM_ALIGN) + 1;
+    uint8_t *in = heap_caps_malloc(in_bytes, MALLOC_CAP_8BIT);
+    uint8_t *work = heap_caps_malloc(in_bytes, MALLOC_CAP_8BIT);
+    int16_t *out = heap_caps_malloc(CHECK_TONE_SAMPLES * sizeof(int16_t), MALLOC_CAP_8BIT);
+    uint8_t *adpcm = heap_caps_malloc(blocks * REC_ADPCM_ALIGN, MALLOC_CAP_8BIT);
+    int16_t *tone = heap_caps_malloc(CHECK_TONE_SAMPLES * sizeof(int16_t), MALLOC_CAP_8BIT);
+    audio_adpcm_encoder_t *enc = heap_caps_malloc(sizeof(*enc), MALLOC_CAP_8BIT);
+    esp_err_t err = ESP_ERR_NO_MEM;
+    if (in == NULL || work == NULL || out == NULL || adpcm == NULL || tone == NULL || enc == NULL) {
+        goto out;
+    }
+
+    /* Full-scale noise: every bit of every slot matters */
+    uint32_t seed = 1;
+    for (size_t i = 0; i < in_bytes; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        in[i] = (uint8_t)(seed >> 24);
+    }
+
+    static const int sources[] = { -2, AUDIO_REC_MONO_MIX, 0, 1 };
+    for (int bits = 16; bits <= 32; bits += 16) {
+        for (uint8_t ch = 1; ch <= 2; ch++) {
+            for (size_t k = 0; k < sizeof(sources) / sizeof(sources[0]); k++) {
+                if (sources[k] >= ch) {
+                    continue;
+                }
+                result->kernel_errors += check_kernel(in, work, out, ch, (uint8_t)bits,
+                                                      sources[k], &result->kernel_max_lsb);
+                result->kernel_runs += 2;
+            }
+        }
+    }
+
+    /* ADPCM: encode a tone block by block as the recorder does, decode it back */
+    const size_t tone_len = CHECK_TONE_SAMPLES;
+    for (size_t i = 0; i < tone_len; i++) {
+        tone[i] = (int16_t)lrint(8000.0 * sin(2.0 * M_PI * 440.0 * (double)i / 16000.0));
+    }
+    audio_adpcm_encoder_init(enc, REC_ADPCM_ALIGN);
+    size_t len = 0;
+    for (size_t pos = 0; pos < tone_len;) {
+        size_t used;
+        const uint8_t *blk = audio_adpcm_encode_block(enc, &tone[pos], tone_len - pos, &used);
+        pos += used;
+        if (blk != NULL) {
+            memcpy(&adpcm[len], blk, REC_ADPCM_ALIGN);
+            len += REC_ADPCM_ALIGN;
+        }
+    }
+    size_t tail;
+    const uint8_t *blk = audio_adpcm_encoder_flush(enc, &tail);
+    if (blk != NULL) {
+        memcpy(&adpcm[len], blk, REC_ADPCM_ALIGN);
+        len += REC_ADPCM_ALIGN;
+    }
+
+    audio_adpcm_clip_t clip = {
+        .data = adpcm, .data_len = len, .samples = tone_len,
+        .sample_rate = 16000, .block_align = REC_ADPCM_ALIGN,
+    };
+    audio_adpcm_decoder_t dec;
+    audio_adpcm_decoder_init(&dec, &clip);
+    size_t got = audio_adpcm_decode(&dec, out, tone_len);
+
+    double sig = 0.0, noise = 0.0;
+    for (size_t i = 0; i < got; i++) {
+        double d = (double)out[i] - tone[i];
+        sig += (double)tone[i] * tone[i];
+        noise += d * d;
+    }
+    result->adpcm_snr_db = noise > 0.0 ? (int32_t)(10.0 * log10(sig / noise)) : 99;
+    if (got != tone_len) {
+        result->adpcm_snr_db = 0;
+    }
+
+    bool ok = result->kernel_errors == 0 && result->adpcm_snr_db >= CHECK_MIN_SNR_DB;
+    err = ok ? ESP_OK : ESP_FAIL;
+    ESP_LOGI(TAG, "Kernels: %"PRIu32" runs, %"PRIu32" mismatches (max %"PRIu32" LSB); "
+             "ADPCM round trip %"PRId32" dB", result->kernel_runs, result->kernel_errors,
+             result->kernel_max_lsb, result->adpcm_snr_db);
+
+out:
+    heap_caps_free(enc);
+    heap_caps_free(tone);
+    heap_caps_free(adpcm);
+    heap_caps_free(out);
+    heap_caps_free(work);
+    heap_caps_free(in);
+    return err;
+}
+#endif /* CONFIG_APP_SELF_TEST */
@@ -0,0 +1,355 @@
+/**
+ * @file audio_resampler.c
+ * @brief Fixed-point polyphase sample-rate converter
+ *
+ * Output sample n sits at position n*M on the L-times upsampled grid. Its
+ * phase is (n*M) mod L and its newest contributing input is (n*M) / L, so
+ * each output is one TAPS-long dot product of a Q15 sub-filter with the
+ * delay line - the zero-stuffed samples of a naive upsampler are never
+ * touched.
+ *
+ * The delay line is mirrored (every sample is written twice, TAPS apart)
+ * so the filter window is always contiguous and needs no wrap handling.
+ */
+
+#include "audio_resampler.h"
+#include "esp_log.h"
+#include "sdkconfig.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if CONFIG_IDF_TARGET_LINUX
+#include <time.h>
+#else
+#include "esp_cpu.h"
+#endif
+
+static const char *TAG = "audio resampler";
+
+/* Tables from resampler_coeffs.c (generated) */
+extern const int16_t rs_coeffs_441[441 * 8];
+extern const int16_t rs_coeffs_2[2 * 16];
+
+/**
+ * @brief Polyphase table descriptor
+ */
+typedef struct {
+    uint16_t phases;        /**< L */
+    uint8_t taps;           /**< Taps per phase */
+    const int16_t *coeffs;  /**< [phases][taps] */
+} rs_table_t;
+
+static const rs_table_t s_tables[] = {
+    { 441, 8,  rs_coeffs_441 },    /* 8000/16000 -> 44100 */
+    { 2,   16, rs_coeffs_2 },      /* 22050 -> 44100 */
+};
+
+/*===========================================================================
+ * Helpers
+ *===========================================================================*/
+
+static uint32_t gcd_u32(uint32_t a, uint32_t b)
+{
+    while (b != 0) {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+static inline int16_t sat16(int32_t v)
+{
+    if (v > INT16_MAX) return INT16_MAX;
+    if (v < INT16_MIN) return INT16_MIN;
+    return (int16_t)v;
+}
+
+/**
+ * @brief Push one input frame into the mirrored delay line
+ */
+static inline void hist_push(audio_resampler_t *rs, const int16_t *frame)
+{
+    uint8_t p = rs->hist_pos;
+    uint8_t t = rs->taps;
+    for (int c = 0; c < rs->channels; c++) {
+        rs->hist[c][p] = frame[c];
+        rs->hist[c][p + t] = frame[c];
+    }
+    rs->hist_pos = (p + 1 == t) ? 0 : p + 1;
+}
+
+/**
+ * @brief Q15 dot product, result rounded back to 16-bit
+ */
+static inline int16_t fir_dot(const int16_t *x, const int16_t *h, int taps)
+{
+    int32_t acc = 1 << 14;  /* Rounding */
+    int k = 0;
+    for (; k + 4 <= taps; k += 4) {
+        acc += (int32_t)x[k] * h[k];
+        acc += (int32_t)x[k + 1] * h[k + 1];
+        acc += (int32_t)x[k + 2] * h[k + 2];
+        acc += (int32_t)x[k + 3] * h[k + 3];
+    }
+    for (; k < taps; k++) {
+        acc += (int32_t)x[k] * h[k];
+    }
+    return sat16(acc >> 15);
+}
+
+/*===========================================================================
+ * Public API
+ *===========================================================================*/
+
+esp_err_t audio_resampler_init(audio_resampler_t *rs, uint32_t in_rate,
+                               uint32_t out_rate, uint8_t channels)
+{
+    if (rs == NULL || in_rate == 0 || out_rate == 0 || (channels != 1 && channels != 2)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(rs, 0, sizeof(*rs));
+    rs->channels = channels;
+
+    if (in_rate == out_rate) {
+        rs->mode = AUDIO_RESAMPLER_PASSTHROUGH;
+        return ESP_OK;
+    }
+
+    uint32_t g = gcd_u32(in_rate, out_rate);
+    uint32_t L = out_rate / g;
+    uint32_t M = in_rate / g;
+
+    /* Tables are designed for upsampling (cutoff at the source Nyquist) */
+    if (L > M) {
+        for (size_t i = 0; i < sizeof(s_tables) / sizeof(s_tables[0]); i++) {
+            if (s_tables[i].phases == L) {
+                rs->mode = AUDIO_RESAMPLER_POLYPHASE;
+                rs->coeffs = s_tables[i].coeffs;
+                rs->phases = (uint16_t)L;
+                rs->step = (uint16_t)M;
+                rs->taps = s_tables[i].taps;
+                audio_resampler_reset(rs);
+                return ESP_OK;
+            }
+        }
+    }
+
+    rs->mode = AUDIO_RESAMPLER_LINEAR;
+    rs->inc = (uint32_t)(((uint64_t)in_rate << 16) / out_rate);
+    audio_resampler_reset(rs);
+    return ESP_OK;
+}
+
+void audio_resampler_reset(audio_resampler_t *rs)
+{
+    if (rs == NULL) {
+        return;
+    }
+    memset(rs->hist, 0, sizeof(rs->hist));
+    memset(rs->prev, 0, sizeof(rs->prev));
+    memset(rs->next, 0, sizeof(rs->next));
+    rs->hist_pos = 0;
+    rs->phase = 0;
+    rs->frac = 0;
+    rs->need = 1;   /* First output needs the first input frame */
+}
+
+size_t audio_resampler_process(audio_resampler_t *rs,
+                               const int16_t *in, size_t in_frames, size_t *in_used,
+                               int16_t *out, size_t out_frames)
+{
+    const int ch = rs->channels;
+    size_t ip = 0;
+    size_t op = 0;
+
+    switch (rs->mode) {
+        case AUDIO_RESAMPLER_PASSTHROUGH: {
+            size_t n = in_frames < out_frames ? in_frames : out_frames;
+            memcpy(out, in, n * ch * sizeof(int16_t));
+            ip = op = n;
+            break;
+        }
+
+        case AUDIO_RESAMPLER_POLYPHASE: {
+            const int taps = rs->taps;
+            while (op < out_frames) {
+                while (rs->need > 0) {
+                    if (ip >= in_frames) {
+                        goto done;
+                    }
+                    hist_push(rs, &in[ip * ch]);
+                    ip++;
+                    rs->need--;
+                }
+
+                /* Window oldest..newest starts right after the newest write */
+                const int16_t *h = &rs->coeffs[rs->phase * taps];
+                const int w = rs->hist_pos;
+                out[op * ch] = fir_dot(&rs->hist[0][w], h, taps);
+                if (ch == 2) {
+                    out[op * 2 + 1] = fir_dot(&rs->hist[1][w], h, taps);
+                }
+                op++;
+
+                uint32_t next = (uint32_t)rs->phase + rs->step;
+                rs->need = (uint16_t)(next / rs->phases);
+                rs->phase = (uint16_t)(next % rs->phases);
+            }
+            break;
+        }
+
+        case AUDIO_RESAMPLER_LINEAR:
+        default: {
+            while (op < out_frames) {
+                while (rs->need > 0) {
+                    if (ip >= in_frames) {
+                        goto done;
+                    }
+                    for (int c = 0; c < ch; c++) {
+                        rs->prev[c] = rs->next[c];
+                        rs->next[c] = in[ip * ch + c];
+                    }
+                    ip++;
+                    rs->need--;
+                }
+
+                for (int c = 0; c < ch; c++) {
+                    int32_t a = rs->prev[c];
+                    int32_t b = rs->next[c];
+                    out[op * ch + c] = (int16_t)(a + (((b - a) * (int32_t)(rs->frac >> 1)) >> 15));
+                }
+                op++;
+
+                rs->frac += rs->inc;
+                rs->need = (uint16_t)(rs->frac >> 16);
+                rs->frac &= 0xFFFF;
+            }
+            break;
+        }
+    }
+
+done:
+    if (in_used) {
+        *in_used = ip;
+    }
+    return op;
+}
+
+#if CONFIG_APP_SELF_TEST
+/*===========================================================================
+ * Benchmark (CONFIG_APP_SELF_TEST)
+ *===========================================================================*/
+
+#define BENCH_IN_FRAMES     256     /**< Noise block, fed round and round */
+#define BENCH_OUT_FRAMES    128     /**< Output frames per call */
+#define BENCH_OUT_RATE      44100
+
+static inline uint32_t bench_now(void)
+{
+#if CONFIG_IDF_TARGET_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+#else
+    return esp_cpu_get_cycle_count();
+#endif
+}
+
+/**
+ * @brief Streaming conversion of @p frames output frames, looping the input
+ */
+static void bench_stream(audio_resampler_t *rs, const int16_t *in, int16_t *out, uint32_t frames)
+{
+    size_t ip = 0;
+    uint32_t done = 0;
+    while (done < frames) {
+        uint32_t want = frames - done < BENCH_OUT_FRAMES ? frames - done : BENCH_OUT_FRAMES;
+        size_t used = 0;
+        size_t n = audio_resampler_process(rs, &in[ip * rs->channels], BENCH_IN_FRAMES - ip,
+                                           &used, out, want);
+        ip += used;
+        if (ip >= BENCH_IN_FRAMES) {
+            ip = 0;
+        }
+        done += (uint32_t)n;
+    }
+}
+
+/**
+ * @brief The float loop Audio_Play_PCM() used before this module (mono in,
+ *        duplicated to stereo out)
+ */
+static void bench_float_linear(const int16_t *in, int16_t *out, uint32_t frames, uint32_t in_rate)
+{
+    float ratio = (float)BENCH_OUT_RATE / (float)in_rate;
+    uint32_t done = 0;
+    while (done < frames) {
+        uint32_t chunk = frames - done < BENCH_OUT_FRAMES ? frames - done : BENCH_OUT_FRAMES;
+        for (uint32_t i = 0; i < chunk; i++) {
+            float src_pos = (float)(done + i) / ratio;
+            size_t src_idx = (size_t)src_pos;
+            float frac = src_pos - (float)src_idx;
+            src_idx %= BENCH_IN_FRAMES - 1;
+            int32_t s0 = in[src_idx];
+            int32_t s1 = in[src_idx + 1];
+            int16_t sample = (int16_t)(s0 + (int32_t)(frac * (float)(s1 - s0)));
+            out[i * 2] = sample;
+            out[i * 2 + 1] = sample;
+        }
+        done += chunk;
+    }
+}
+
+esp_err_t audio_resampler_benchmark(uint32_t frames,
+                                    audio_resampler_bench_t bench[AUDIO_RESAMPLER_BENCH_RATES])
+{
+    static const uint32_t rates[AUDIO_RESAMPLER_BENCH_RATES] = { 8000, 16000, 22050 };
+
+    if (bench == NULL || frames == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    int16_t *in = malloc(BENCH_IN_FRAMES * 2 * sizeof(int16_t));
+    int16_t *out = malloc(BENCH_OUT_FRAMES * 2 * sizeof(int16_t));
+    if (in == NULL || out == NULL) {
+        free(in);
+        free(out);
+        return ESP_ERR_NO_MEM;
+    }
+
+    uint32_t seed = 1;
+    for (int i = 0; i < BENCH_IN_FRAMES * 2; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        in[i] = (int16_t)(seed >> 17);      /* Half scale: no clipping in the filter */
+    }
+
+    for (int r = 0; r < AUDIO_RESAMPLER_BENCH_RATES; r++) {
+        audio_resampler_t rs;
+        audio_resampler_bench_t *b = &bench[r];
+        b->in_rate = rates[r];
+
+        audio_resampler_init(&rs, rates[r], BENCH_OUT_RATE, 1);
+        uint32_t t0 = bench_now();
+        bench_stream(&rs, in, out, frames);
+        b->polyphase_mono = (bench_now() - t0) / frames;
+
+        audio_resampler_init(&rs, rates[r], BENCH_OUT_RATE, 2);
+        t0 = bench_now();
+        bench_stream(&rs, in, out, frames);
+        b->polyphase_stereo = (bench_now() - t0) / frames;
+
+        t0 = bench_now();
+        bench_float_linear(in, out, frames, rates[r]);
+        b->float_linear = (bench_now() - t0) / frames;
+
+        ESP_LOGI(TAG, "%lu -> %d Hz per output frame: polyphase mono %lu, stereo %lu, float linear %lu",
+                 (unsigned long)b->in_rate, BENCH_OUT_RATE, (unsigned long)b->polyphase_mono,
+                 (unsigned long)b->polyphase_stereo, (unsigned long)b->float_linear);
+    }
+
+    free(in);
+    free(out);
+    return ESP_OK;
+}
+#endif /* CONFIG_APP_SELF_TEST */
@@ -0,0 +1,753 @@
+/**
+ * @file audio_sd_stream.c
+ * @brief Read-ahead SD card stream for the music decoder
+ *
+ * in_data_callback() used to fread() every small decoder pull while holding
+ * the LVGL mutex (SD and LCD share SPI2), so each read stalled the UI and
+ * each UI frame could starve the decoder. This module moves SD access to a
+ * reader task that works in large bursts and takes the bus through the BSP
+ * SPI arbiter (audio class) instead of the LVGL mutex.
+ *
+ * Architecture:
+ * - Chunk Ring: CONFIG_AUDIO_SD_STREAM_CHUNKS slots of
+ *   CONFIG_AUDIO_SD_STREAM_CHUNK_KB each. Every fread() is one full chunk at
+ *   a chunk-aligned file offset, so reads stay sector (and cluster) aligned
+ *   and FATFS can issue multi-sector transfers straight into the slot.
+ * - Single producer / single consumer: the reader task publishes filled
+ *   slots, the decoder callback consumes them. Slot counters are C11
+ *   atomics - no lock on the copy path.
+ * - Watermarks: the reader sleeps until the buffered data drops to the low
+ *   watermark, then refills up to the high watermark (ring full). Each
+ *   chunk read takes the SPI bus once, so SD traffic lands between LCD
+ *   flushes as a few long bursts rather than many short ones.
+ * - Underruns: if the ring runs dry before EOF the decoder blocks on a
+ *   semaphore until the next chunk lands; the wait is counted.
+ * - Next Track: a queued next file is opened and its first chunk loaded
+ *   into a spare head slot between bursts. If it has the same MP3 format
+ *   as the current file, the reader splices it in at EOF - the decoder sees
+ *   one continuous stream and a boundary marker tells the driver where the
+ *   new track starts. Otherwise the driver promotes it with
+ *   audio_sd_stream_open_next(), which needs no SD access at all.
+ * - Head chunks skip a leading ID3v2 tag, so a spliced stream never feeds
+ *   tag bytes to the decoder and later reads stay chunk aligned.
+ */
+
+#include "audio_sd_stream.h"
+#include "audio_telemetry.h"
+#include "bsp_board.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+
+static const char *TAG = "audio stream";
+
+/*===========================================================================
+ * Configuration
+ *===========================================================================*/
+
+#define STREAM_CHUNK_BYTES      (CONFIG_AUDIO_SD_STREAM_CHUNK_KB * 1024)
+#define STREAM_CHUNKS           CONFIG_AUDIO_SD_STREAM_CHUNKS
+#define STREAM_LOW_WATERMARK    CONFIG_AUDIO_SD_STREAM_LOW_WATERMARK  /**< Refill at or below this many chunks */
+#define STREAM_UNDERRUN_WAIT_MS 2000    /**< Give up on a stalled read after this long */
+#define STREAM_PATH_MAX         128
+#define STREAM_TASK_STACK       3072
+#define STREAM_TASK_PRIO        CONFIG_AUDIO_SD_STREAM_TASK_PRIORITY
+
+_Static_assert(STREAM_LOW_WATERMARK < STREAM_CHUNKS,
+               "Low watermark must leave room for at least one refill chunk");
+
+/*===========================================================================
+ * Types
+ *===========================================================================*/
+
+/**
+ * @brief Container format sniffed from a file's first chunk
+ */
+typedef enum {
+    STREAM_CODEC_UNKNOWN,
+    STREAM_CODEC_MP3,
+    STREAM_CODEC_WAV,
+} stream_codec_t;
+
+typedef struct {
+    stream_codec_t codec;
+    uint32_t sample_rate;       /**< MP3 only */
+    uint8_t channels;           /**< MP3 only */
+} stream_fmt_t;
+
+/**
+ * @brief Prefetch state of the queued next file
+ */
+typedef enum {
+    NEXT_NONE,      /**< Nothing queued */
+    NEXT_PENDING,   /**< Path queued, reader has not opened it yet */
+    NEXT_READY,     /**< Open, first chunk in s_head */
+    NEXT_FAILED,    /**< Could not be opened or read */
+} next_state_t;
+
+/*===========================================================================
+ * Module State
+ *===========================================================================*/
+
+static uint8_t *s_ring = NULL;              /**< STREAM_CHUNKS * STREAM_CHUNK_BYTES, then the head slot */
+static uint8_t *s_head = NULL;              /**< First chunk of the next file */
+static uint32_t s_slot_len[STREAM_CHUNKS];  /**< Valid bytes per slot (written by reader) */
+static atomic_uint s_wr;                    /**< Slots published (reader only writes) */
+static atomic_uint s_rd;                    /**< Slots consumed (decoder only writes) */
+static uint32_t s_rd_off;                   /**< Offset into the current read slot (decoder only) */
+static atomic_bool s_eof;                   /**< Reader hit end of file or an error */
+
+/* Guarded by s_file_lock */
+static FILE *s_file = NULL;
+static stream_fmt_t s_cur_fmt;
+static uint32_t s_head_len;
+static bool s_head_pending;                 /**< s_head holds the spliced file's start, not yet published */
+static char s_next_path[STREAM_PATH_MAX];
+static uint32_t s_next_tag;
+static next_state_t s_next_state = NEXT_NONE;
+static FILE *s_next_file = NULL;
+static stream_fmt_t s_next_fmt;
+
+/* Track boundary inside the ring (reader arms, decoder fires) */
+static atomic_bool s_boundary_armed;
+static atomic_uint s_boundary_slot;         /**< Slot counter where the spliced file starts */
+static uint32_t s_boundary_tag;
+static atomic_bool s_boundary_hit;
+static uint32_t s_hit_tag;
+
+static SemaphoreHandle_t s_file_lock = NULL;  /**< Guards file state against open/close during a read */
+static SemaphoreHandle_t s_data_sem = NULL;   /**< Given by the reader after each chunk */
+static TaskHandle_t s_task = NULL;
+static volatile bool s_running = false;
+
+static audio_stream_stats_t s_stats;
+
+/*===========================================================================
+ * Helpers
+ *===========================================================================*/
+
+static inline unsigned filled_slots(void)
+{
+    return atomic_load_explicit(&s_wr, memory_order_acquire) -
+           atomic_load_explicit(&s_rd, memory_order_acquire);
+}
+
+static bool bus_take(void)
+{
+    if (bsp_spi_bus_acquire(BSP_SPI_CLIENT_AUDIO, BSP_SPI_BUS_WAIT_DEFAULT) != ESP_OK) {
+        s_stats.bus_timeouts++;
+        return false;
+    }
+    return true;
+}
+
+static void bus_give(void)
+{
+    bsp_spi_bus_release(BSP_SPI_CLIENT_AUDIO);
+}
+
+/**
+ * @brief Size of a leading ID3v2 tag (header, body and footer), 0 if none
+ */
+static uint32_t id3v2_size(const uint8_t *p, size_t n)
+{
+    if (n < 10 || memcmp(p, "ID3", 3) != 0) {
+        return 0;
+    }
+    uint32_t size = ((uint32_t)(p[6] & 0x7f) << 21) | ((uint32_t)(p[7] & 0x7f) << 14) |
+                    ((uint32_t)(p[8] & 0x7f) << 7) | (uint32_t)(p[9] & 0x7f);
+    return 10 + size + ((p[5] & 0x10) ? 10 : 0);
+}
+
+/**
+ * @brief Identify WAV, or MP3 from its first valid frame header
+ */
+static void parse_format(const uint8_t *p, size_t n, stream_fmt_t *fmt)
+{
+    static const uint32_t mpeg1_rates[3] = { 44100, 48000, 32000 };
+
+    memset(fmt, 0, sizeof(*fmt));
+    if (n >= 12 && memcmp(p, "RIFF", 4) == 0 && memcmp(p + 8, "WAVE", 4) == 0) {
+        fmt->codec = STREAM_CODEC_WAV;
+        return;
+    }
+
+    for (size_t i = 0; i + 4 <= n; i++) {
+        if (p[i] != 0xFF || (p[i + 1] & 0xE0) != 0xE0) {
+            continue;
+        }
+        unsigned version = (p[i + 1] >> 3) & 3;     /* 0: MPEG 2.5, 2: MPEG 2, 3: MPEG 1 */
+        unsigned layer = (p[i + 1] >> 1) & 3;
+        unsigned bitrate = p[i + 2] >> 4;
+        unsigned rate = (p[i + 2] >> 2) & 3;
+        if (version == 1 || layer == 0 || bitrate == 0 || bitrate == 15 || rate == 3) {
+            continue;
+        }
+        fmt->codec = STREAM_CODEC_MP3;
+        fmt->sample_rate = mpeg1_rates[rate] >> (version == 3 ? 0 : version == 2 ? 1 : 2);
+        fmt->channels = (p[i + 3] >> 6) == 3 ? 1 : 2;
+        return;
+    }
+}
+
+/**
+ * @brief True if @p next can follow @p cur in the same decoder instance
+ *
+ * Only MP3 resynchronises frame by frame; the WAV decoder is bound to the
+ * first file's header, so WAV always takes a pipeline restart.
+ */
+static bool fmt_can_splice(const stream_fmt_t *cur, const stream_fmt_t *next)
+{
+    return cur->codec == STREAM_CODEC_MP3 && next->codec == STREAM_CODEC_MP3 &&
+           cur->sample_rate == next->sample_rate && cur->channels == next->channels;
+}
+
+static FILE *open_file(const char *path)
+{
+    if (!bus_take()) {
+        return NULL;
+    }
+    FILE *f = fopen(path, "rb");    /* Directory lookup uses the SD SPI bus */
+    bus_give();
+    if (f != NULL) {
+        /* Chunks are already large and aligned - skip newlib's stdio buffer */
+        setvbuf(f, NULL, _IONBF, 0);
+    }
+    return f;
+}
+
+static void close_file(FILE *f)
+{
+    /* fclose() on a read-only file has nothing to flush, so a bus
+     * timeout here is harmless - close regardless */
+    bool owned = bus_take();
+    fclose(f);
+    if (owned) {
+        bus_give();
+    }
+}
+
+/**
+ * @brief Read a file's first chunk into @p dst, minus any ID3v2 tag
+ *
+ * A tag that fits in the chunk is cut out in RAM; a larger one (cover art)
+ * is skipped with a seek and the read shortened so the following chunk
+ * reads are aligned again.
+ *
+ * @return Bytes in @p dst, 0 on error or empty file
+ */
+static size_t load_head(FILE *f, uint8_t *dst, stream_fmt_t *fmt)
+{
+    if (!bus_take()) {
+        return 0;
+    }
+    size_t n = fread(dst, 1, STREAM_CHUNK_BYTES, f);
+    uint32_t skip = id3v2_size(dst, n);
+    if (skip > 0 && skip < n) {
+        n -= skip;
+        memmove(dst, dst + skip, n);
+    } else if (skip > 0) {
+        n = 0;
+        if (fseek(f, (long)skip, SEEK_SET) == 0) {
+            n = fread(dst, 1, STREAM_CHUNK_BYTES - skip % STREAM_CHUNK_BYTES, f);
+        }
+    }
+    bus_give();
+
+    s_stats.chunk_reads++;
+    s_stats.bytes_read += n;
+    parse_format(dst, n, fmt);
+    return n;
+}
+
+/**
+ * @brief Close the prefetched next file and forget it (call with s_file_lock)
+ */
+static void drop_next_locked(void)
+{
+    if (s_next_file != NULL) {
+        close_file(s_next_file);
+        s_next_file = NULL;
+    }
+    s_next_state = NEXT_NONE;
+}
+
+/**
+ * @brief Empty the ring (call with s_file_lock, decoder not reading)
+ */
+static void reset_ring_locked(void)
+{
+    atomic_store_explicit(&s_wr, 0, memory_order_relaxed);
+    atomic_store_explicit(&s_rd, 0, memory_order_relaxed);
+    s_rd_off = 0;
+    s_head_pending = false;
+    atomic_store_explicit(&s_boundary_armed, false, memory_order_relaxed);
+    atomic_store_explicit(&s_boundary_hit, false, memory_order_relaxed);
+}
+
+/**
+ * @brief Copy a head chunk into the next free slot and publish it (call with s_file_lock)
+ */
+static void publish_head_locked(const uint8_t *src, uint32_t len)
+{
+    unsigned wr = atomic_load_explicit(&s_wr, memory_order_relaxed);
+    uint8_t *dst = &s_ring[(wr % STREAM_CHUNKS) * STREAM_CHUNK_BYTES];
+    if (dst != src) {
+        memcpy(dst, src, len);
+    }
+    s_slot_len[wr % STREAM_CHUNKS] = len;
+    atomic_store_explicit(&s_wr, wr + 1, memory_order_release);
+}
+
+/**
+ * @brief Read one chunk into the next free slot
+ * @return false once the file is exhausted (or no file is open)
+ */
+static bool fill_one_chunk(void)
+{
+    bool more = true;
+
+    xSemaphoreTake(s_file_lock, portMAX_DELAY);
+
+    if (s_head_pending) {
+        /* Spliced file: its first chunk is already in RAM */
+        atomic_store_explicit(&s_boundary_slot, atomic_load_explicit(&s_wr, memory_order_relaxed),
+                              memory_order_relaxed);
+        atomic_store_explicit(&s_boundary_armed, true, memory_order_release);
+        publish_head_locked(s_head, s_head_len);
+        s_head_pending = false;
+        xSemaphoreGive(s_file_lock);
+        xSemaphoreGive(s_data_sem);
+        return true;
+    }
+
+    if (s_file == NULL || atomic_load_explicit(&s_eof, memory_order_relaxed)) {
+        xSemaphoreGive(s_file_lock);
+        return false;
+    }
+
+    unsigned wr = atomic_load_explicit(&s_wr, memory_order_relaxed);
+    unsigned slot = wr % STREAM_CHUNKS;
+    uint8_t *dst = &s_ring[slot * STREAM_CHUNK_BYTES];
+
+    /* One SPI burst per chunk, taken between LCD flushes */
+    int64_t t0 = esp_timer_get_time();
+    if (!bus_take()) {
+        s_stats.bus_wait_us += (uint32_t)(esp_timer_get_time() - t0);
+        xSemaphoreGive(s_file_lock);
+        return true;    /* Bus busy - the burst loop retries */
+    }
+    int64_t t1 = esp_timer_get_time();
+    size_t n = fread(dst, 1, STREAM_CHUNK_BYTES, s_file);
+    bus_give();
+    int64_t t2 = esp_timer_get_time();
+
+    s_stats.chunk_reads++;
+    s_stats.bytes_read += n;
+    s_stats.bus_wait_us += (uint32_t)(t1 - t0);
+    s_stats.bus_hold_us += (uint32_t)(t2 - t1);
+    if ((uint32_t)(t2 - t1) > s_stats.max_read_us) {
+        s_stats.max_read_us = (uint32_t)(t2 - t1);
+    }
+
+    if (n > 0) {
+        s_slot_len[slot] = (uint32_t)n;
+        atomic_store_explicit(&s_wr, wr + 1, memory_order_release);
+    }
+    if (n < STREAM_CHUNK_BYTES) {
+        if (s_next_state == NEXT_READY && fmt_can_splice(&s_cur_fmt, &s_next_fmt)) {
+            /* Gapless: carry on with the next file in the same stream */
+            close_file(s_file);
+            s_file = s_next_file;
+            s_next_file = NULL;
+            s_next_state = NEXT_NONE;
+            s_cur_fmt = s_next_fmt;
+            s_boundary_tag = s_next_tag;
+            s_head_pending = true;
+            s_stats.files++;
+            s_stats.splices++;
+        } else {
+            atomic_store_explicit(&s_eof, true, memory_order_release);
+            more = false;
+        }
+    }
+    xSemaphoreGive(s_file_lock);
+
+    xSemaphoreGive(s_data_sem);
+    return more;
+}
+
+/**
+ * @brief Open the queued next file and load its first chunk into s_head
+ */
+static void prefetch_next(void)
+{
+    xSemaphoreTake(s_file_lock, portMAX_DELAY);
+    if (s_next_state == NEXT_PENDING && !s_head_pending) {
+        FILE *f = open_file(s_next_path);
+        size_t n = f ? load_head(f, s_head, &s_next_fmt) : 0;
+        if (n > 0) {
+            s_next_file = f;
+            s_head_len = (uint32_t)n;
+            s_next_state = NEXT_READY;
+            s_stats.prefetches++;
+        } else {
+            if (f != NULL) {
+                close_file(f);
+            }
+            s_next_state = NEXT_FAILED;
+            ESP_LOGW(TAG, "Cannot prefetch %s", s_next_path);
+        }
+    }
+    xSemaphoreGive(s_file_lock);
+}
+
+/*===========================================================================
+ * Reader Task
+ *===========================================================================*/
+
+static void reader_task(void *pvParameters)
+{
+    while (s_running) {
+        /* Sleep until the decoder drains to the low watermark, a file opens
+         * or a next file is queued */
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (!s_running) {
+            break;
+        }
+        prefetch_next();
+        if (filled_slots() > STREAM_LOW_WATERMARK) {
+            continue;
+        }
+
+        /* Refill burst up to the high watermark (ring full) */
+        s_stats.bursts++;
+        while (s_running && filled_slots() < STREAM_CHUNKS) {
+            if (!fill_one_chunk()) {
+                break;
+            }
+        }
+    }
+
+    s_task = NULL;
+    vTaskDelete(NULL);
+}
+
+/*===========================================================================
+ * Public API
+ *===========================================================================*/
+
+esp_err_t audio_sd_stream_init(void)
+{
+    if (s_task != NULL) {
+        return ESP_OK;
+    }
+
+    /* DMA-capable so SDSPI can transfer straight into the slot. One extra
+     * slot holds the next file's head. */
+    s_ring = heap_caps_aligned_alloc(4, (STREAM_CHUNKS + 1) * STREAM_CHUNK_BYTES,
+                                     MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    if (s_ring == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate %d x %d KB read-ahead ring",
+                 STREAM_CHUNKS + 1, CONFIG_AUDIO_SD_STREAM_CHUNK_KB);
+        return ESP_ERR_NO_MEM;
+    }
+    s_head = &s_ring[STREAM_CHUNKS * STREAM_CHUNK_BYTES];
+
+    s_file_lock = xSemaphoreCreateMutex();
+    s_data_sem = xSemaphoreCreateBinary();
+    if (s_file_lock == NULL || s_data_sem == NULL) {
+        ESP_LOGE(TAG, "Failed to create stream semaphores");
+        audio_sd_stream_deinit();
+        return ESP_ERR_NO_MEM;
+    }
+
+    reset_ring_locked();
+    atomic_store(&s_eof, true);
+    s_next_state = NEXT_NONE;
+    audio_sd_stream_reset_stats();
+
+    s_running = true;
+    if (xTaskCreate(reader_task, "audio_sd_rd", STREAM_TASK_STACK, NULL,
+                    STREAM_TASK_PRIO, &s_task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create reader task");
+        s_running = false;
+        s_task = NULL;
+        audio_sd_stream_deinit();
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Read-ahead ring: %d x %d KB + next-track head, refill at <= %d chunks",
+             STREAM_CHUNKS, CONFIG_AUDIO_SD_STREAM_CHUNK_KB, STREAM_LOW_WATERMARK);
+    return ESP_OK;
+}
+
+void audio_sd_stream_deinit(void)
+{
+    if (s_task != NULL) {
+        s_running = false;
+        xTaskNotifyGive(s_task);
+        for (int i = 0; i < 50 && s_task != NULL; i++) {
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+        if (s_task != NULL) {
+            ESP_LOGE(TAG, "Reader did not stop, buffers left allocated");
+            return;
+        }
+    }
+
+    if (s_file_lock != NULL) {
+        audio_sd_stream_cancel_next();
+        audio_sd_stream_close();
+        vSemaphoreDelete(s_file_lock);
+        s_file_lock = NULL;
+    }
+    if (s_data_sem != NULL) {
+        vSemaphoreDelete(s_data_sem);
+        s_data_sem = NULL;
+    }
+    if (s_ring != NULL) {
+        heap_caps_free(s_ring);
+        s_ring = NULL;
+        s_head = NULL;
+    }
+}
+
+esp_err_t audio_sd_stream_open(const char *path)
+{
+    if (s_task == NULL || path == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    audio_sd_stream_close();
+
+    FILE *f = open_file(path);
+    if (f == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    xSemaphoreTake(s_file_lock, portMAX_DELAY);
+    s_file = f;
+    reset_ring_locked();
+    size_t n = load_head(f, s_ring, &s_cur_fmt);    /* Straight into slot 0 */
+    if (n > 0) {
+        publish_head_locked(s_ring, (uint32_t)n);
+    }
+    atomic_store_explicit(&s_eof, n == 0, memory_order_release);
+    xSemaphoreTake(s_data_sem, 0);  /* Drop a stale "data ready" */
+    xSemaphoreGive(s_file_lock);
+
+    s_stats.files++;
+    xTaskNotifyGive(s_task);    /* Prefetch before the decoder asks */
+    return ESP_OK;
+}
+
+void audio_sd_stream_close(void)
+{
+    if (s_file_lock == NULL) {
+        return;
+    }
+
+    /* Waits for an in-flight chunk read to finish */
+    xSemaphoreTake(s_file_lock, portMAX_DELAY);
+    if (s_file != NULL) {
+        close_file(s_file);
+        s_file = NULL;
+    }
+    atomic_store_explicit(&s_eof, true, memory_order_release);
+    reset_ring_locked();
+    xSemaphoreGive(s_file_lock);
+
+    /* Wake a decoder blocked in audio_sd_stream_read() */
+    if (s_data_sem != NULL) {
+        xSemaphoreGive(s_data_sem);
+    }
+}
+
+esp_err_t audio_sd_stream_queue_next(const char *path, uint32_t tag)
+{
+    if (s_task == NULL || path == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(s_file_lock, portMAX_DELAY);
+    drop_next_locked();
+    strlcpy(s_next_path, path, sizeof(s_next_path));
+    s_next_tag = tag;
+    s_next_state = NEXT_PENDING;
+    xSemaphoreGive(s_file_lock);
+
+    xTaskNotifyGive(s_task);    /* Opened between refill bursts */
+    return ESP_OK;
+}
+
+void audio_sd_stream_cancel_next(void)
+{
+    if (s_file_lock == NULL) {
+        return;
+    }
+    xSemaphoreTake(s_file_lock, portMAX_DELAY);
+    drop_next_locked();
+    xSemaphoreGive(s_file_lock);
+}
+
+bool audio_sd_stream_next_can_splice(void)
+{
+    if (s_file_lock == NULL) {
+        return false;
+    }
+    xSemaphoreTake(s_file_lock, portMAX_DELAY);
+    bool ok = s_next_state == NEXT_READY && fmt_can_splice(&s_cur_fmt, &s_next_fmt);
+    xSemaphoreGive(s_file_lock);
+    return ok;
+}
+
+esp_err_t audio_sd_stream_open_next(void)
+{
+    if (s_task == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(s_file_lock, portMAX_DELAY);
+    if (s_next_state == NEXT_READY) {
+        if (s_file != NULL) {
+            close_file(s_file);
+        }
+        s_file = s_next_file;
+        s_next_file = NULL;
+        s_next_state = NEXT_NONE;
+        s_cur_fmt = s_next_fmt;
+        reset_ring_locked();
+        publish_head_locked(s_head, s_head_len);
+        atomic_store_explicit(&s_eof, false, memory_order_release);
+        xSemaphoreGive(s_file_lock);
+
+        s_stats.files++;
+        xTaskNotifyGive(s_task);
+        xSemaphoreGive(s_data_sem);     /* Wake a decoder parked on an empty ring */
+        return ESP_OK;
+    }
+    if (s_next_state == NEXT_NONE) {
+        xSemaphoreGive(s_file_lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    /* Not loaded yet (or failed) - open it the slow way */
+    char path[STREAM_PATH_MAX];
+    strlcpy(path, s_next_path, sizeof(path));
+    drop_next_locked();
+    xSemaphoreGive(s_file_lock);
+    return audio_sd_stream_open(path);
+}
+
+bool audio_sd_stream_take_boundary(uint32_t *tag)
+{
+    if (!atomic_exchange_explicit(&s_boundary_hit, false, memory_order_acquire)) {
+        return false;
+    }
+    if (tag != NULL) {
+        *tag = s_hit_tag;
+    }
+    return true;
+}
+
+int audio_sd_stream_read(uint8_t *dst, int size)
+{
+    if (s_ring == NULL || dst == NULL || size <= 0) {
+        return 0;
+    }
+
+    int copied = 0;
+    bool stalled = false;
+    uint32_t stall_us = 0;
+    while (copied < size) {
+        unsigned rd = atomic_load_explicit(&s_rd, memory_order_relaxed);
+        unsigned wr = atomic_load_explicit(&s_wr, memory_order_acquire);
+
+        if (rd == wr) {
+            if (atomic_load_explicit(&s_eof, memory_order_acquire) &&
+                atomic_load_explicit(&s_wr, memory_order_acquire) == rd) {
+                break;  /* End of file */
+            }
+            if (copied > 0) {
+                break;  /* Hand back what we have, the decoder will ask again */
+            }
+
+            /* Ring ran dry before EOF */
+            if (!stalled) {
+                s_stats.underruns++;
+                stalled = true;
+            }
+            xTaskNotifyGive(s_task);
+            int64_t t0 = esp_timer_get_time();
+            BaseType_t got = xSemaphoreTake(s_data_sem, pdMS_TO_TICKS(STREAM_UNDERRUN_WAIT_MS));
+            uint32_t waited = (uint32_t)(esp_timer_get_time() - t0);
+            s_stats.underrun_wait_us += waited;
+            stall_us += waited;
+            if (got != pdTRUE) {
+                ESP_LOGW(TAG, "SD read stalled for %d ms", STREAM_UNDERRUN_WAIT_MS);
+                break;
+            }
+            continue;
+        }
+
+        /* Armed first: its acquire orders the slot and tag reads after it */
+        if (s_rd_off == 0 && atomic_load_explicit(&s_boundary_armed, memory_order_acquire) &&
+            rd == atomic_load_explicit(&s_boundary_slot, memory_order_relaxed)) {
+            /* First byte of a spliced file */
+            atomic_store_explicit(&s_boundary_armed, false, memory_order_relaxed);
+            s_hit_tag = s_boundary_tag;
+            atomic_store_explicit(&s_boundary_hit, true, memory_order_release);
+        }
+
+        unsigned slot = rd % STREAM_CHUNKS;
+        uint32_t avail = s_slot_len[slot] - s_rd_off;
+        uint32_t n = (uint32_t)(size - copied) < avail ? (uint32_t)(size - copied) : avail;
+        memcpy(dst + copied, &s_ring[slot * STREAM_CHUNK_BYTES + s_rd_off], n);
+        copied += (int)n;
+        s_rd_off += n;
+
+        if (s_rd_off == s_slot_len[slot]) {
+            /* Slot drained - hand it back and wake the reader at the low watermark */
+            s_rd_off = 0;
+            atomic_store_explicit(&s_rd, rd + 1, memory_order_release);
+            unsigned level = wr - (rd + 1);
+            if (level < s_stats.min_level_chunks) {
+                s_stats.min_level_chunks = level;
+            }
+            audio_telemetry_record(AUDIO_METRIC_SD_RING_PCT, level * 100 / STREAM_CHUNKS);
+            if (level <= STREAM_LOW_WATERMARK &&
+                !atomic_load_explicit(&s_eof, memory_order_relaxed)) {
+                xTaskNotifyGive(s_task);
+            }
+        }
+    }
+
+    if (stalled) {
+        audio_telemetry_record(AUDIO_METRIC_SD_UNDERRUN_US, stall_us);
+    }
+    return copied;
+}
+
+void audio_sd_stream_get_stats(audio_stream_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    *stats = s_stats;
+    stats->level_chunks = filled_slots();
+    stats->capacity_chunks = STREAM_CHUNKS;
+    stats->chunk_bytes = STREAM_CHUNK_BYTES;
+}
+
+void audio_sd_stream_reset_stats(void)
+{
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.min_level_chunks = STREAM_CHUNKS;
+}
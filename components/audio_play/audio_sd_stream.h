@@ -0,0 +1,120 @@
+/**
+ * @file audio_sd_stream.h
+ * @brief Read-ahead SD card stream for the music decoder (internal to audio_play)
+ *
+ * A reader task fills a ring of large, sector-aligned chunks ahead of the
+ * decoder. The decoder's input callback only copies from RAM, so it never
+ * touches the SPI bus that the SD card shares with the LCD. The next track
+ * can be opened and pre-buffered while the current one plays.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "audio_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Allocate the ring and start the reader task
+ * @return ESP_OK on success (or if already running)
+ */
+esp_err_t audio_sd_stream_init(void);
+
+/**
+ * @brief Close any open file, stop the reader task and free the ring
+ */
+void audio_sd_stream_deinit(void);
+
+/**
+ * @brief Open a file and start prefetching it
+ *
+ * Any previously open file is closed first. Must not be called while the
+ * decoder is still pulling data.
+ *
+ * @param path Filesystem path (e.g. "/sdcard/Music/song.mp3")
+ * @return ESP_OK, ESP_ERR_NOT_FOUND if the file cannot be opened,
+ *         ESP_ERR_INVALID_STATE if the stream is not initialized
+ */
+esp_err_t audio_sd_stream_open(const char *path);
+
+/**
+ * @brief Close the current file (no-op if none is open)
+ */
+void audio_sd_stream_close(void);
+
+/**
+ * @brief Queue the file that follows the current one
+ *
+ * The reader opens it and loads its first chunk between refill bursts. If
+ * it is an MP3 with the same sample rate and channel count as the current
+ * file it is spliced in at EOF (no end of stream is seen by the decoder)
+ * and audio_sd_stream_take_boundary() reports @p tag once the decoder
+ * reaches it. Replaces any previously queued file.
+ *
+ * @param path Filesystem path
+ * @param tag Caller's id for this file, echoed by the boundary marker
+ * @return ESP_OK, or ESP_ERR_INVALID_STATE if the stream is not initialized
+ */
+esp_err_t audio_sd_stream_queue_next(const char *path, uint32_t tag);
+
+/**
+ * @brief Forget the queued next file (closes it if already prefetched)
+ */
+void audio_sd_stream_cancel_next(void);
+
+/**
+ * @brief True if the queued next file is prefetched and can share the
+ *        current decoder (same MP3 format)
+ */
+bool audio_sd_stream_next_can_splice(void);
+
+/**
+ * @brief Make the queued next file current, dropping the rest of this one
+ *
+ * Uses the prefetched handle and head chunk when ready, so the decoder has
+ * data immediately; otherwise falls back to audio_sd_stream_open(). Same
+ * calling rules as audio_sd_stream_open().
+ *
+ * @return ESP_OK, ESP_ERR_NOT_FOUND if the file cannot be opened,
+ *         ESP_ERR_INVALID_STATE if nothing is queued
+ */
+esp_err_t audio_sd_stream_open_next(void);
+
+/**
+ * @brief Check (and clear) the spliced-track marker (decoder side)
+ *
+ * @param[out] tag Tag passed to audio_sd_stream_queue_next() for that file
+ * @return true once, after the decoder has read the first byte of a
+ *         spliced file
+ */
+bool audio_sd_stream_take_boundary(uint32_t *tag);
+
+/**
+ * @brief Copy buffered data for the decoder
+ *
+ * Blocks only if the ring is empty and the reader has not reached EOF
+ * (counted as an underrun).
+ *
+ * @param dst Destination buffer
+ * @param size Bytes wanted
+ * @return Bytes copied, 0 at end of file or on error
+ */
+int audio_sd_stream_read(uint8_t *dst, int size);
+
+/**
+ * @brief Snapshot the stream counters
+ */
+void audio_sd_stream_get_stats(audio_stream_stats_t *stats);
+
+/**
+ * @brief Clear the stream counters
+ */
+void audio_sd_stream_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,374 @@
+/**
+ * @file audio_spectrum.c
+ * @brief Spectrum analyzer fed from the I2S writer
+ *
+ * The visualizer used to replay precomputed per-track tables. This module
+ * measures what is actually playing instead.
+ *
+ * Architecture:
+ * - Capture: once per period the analyzer arms a one-shot capture. The I2S
+ *   writer's next blocks fill a 256-frame mono window (L+R average) and the
+ *   analyzer is notified. While not armed the tap is a single atomic load,
+ *   so the writer pays nothing between windows, and the window is at most
+ *   one writer block older than the audio reaching the DMA.
+ * - Analysis: Hann window, 256-point Q15 radix-4 FFT (audio_fft.c), power
+ *   summed over log-spaced bin ranges, integer log2 -> 0..255 over 60 dB.
+ *   Levels rise immediately and fall by a fixed step per period.
+ * - Publishing: two level buffers and one atomic word holding the sequence
+ *   number and the front buffer index. The analyzer only writes the back
+ *   buffer; a reader retries only if two spectra were published during its
+ *   copy, so it never waits on the (lower-priority) analyzer.
+ * - Idle: without audio the capture times out, levels decay to zero and
+ *   nothing more is published, so the UI stops redrawing.
+ */
+
+#include "audio_spectrum.h"
+#include "audio_spectrum_tap.h"
+#include "audio_fft.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdatomic.h>
+#include <string.h>
+
+static const char *TAG = "audio spectrum";
+
+#if CONFIG_AUDIO_SPECTRUM
+
+/*===========================================================================
+ * Configuration
+ *===========================================================================*/
+
+#define SPECTRUM_PERIOD_MS      CONFIG_AUDIO_SPECTRUM_PERIOD_MS
+#define SPECTRUM_TASK_STACK     2560
+#define SPECTRUM_TASK_PRIO      CONFIG_AUDIO_SPECTRUM_TASK_PRIORITY
+#define SPECTRUM_TOP_BIN        (AUDIO_FFT_N / 2)   /**< Bins 1..127 are folded into bands */
+
+#define LEVEL_FLOOR_Q3          (6 * 8)     /**< log2(power) * 8 of a -60 dBFS sine */
+#define LEVEL_RANGE_Q3          (20 * 8)    /**< 20 power octaves = 60 dB */
+#define LEVEL_DECAY_MS          600         /**< Full scale to zero */
+#define LEVEL_DECAY_STEP        ((255 * SPECTRUM_PERIOD_MS + LEVEL_DECAY_MS - 1) / LEVEL_DECAY_MS)
+
+enum {
+    CAP_IDLE = 0,       /**< Tap ignores audio */
+    CAP_ARMED,          /**< Tap fills the window */
+    CAP_FULL,           /**< Window ready for the analyzer */
+};
+
+/*===========================================================================
+ * Module State
+ *===========================================================================*/
+
+typedef struct {
+    int16_t window[AUDIO_FFT_N];        /**< Captured mono frames */
+    audio_fft_cpx_t fft[AUDIO_FFT_N];   /**< FFT work buffer */
+} spectrum_buf_t;
+
+static spectrum_buf_t *s_buf = NULL;
+static uint32_t s_cap_pos;                  /**< Frames captured (tap only, while armed) */
+static atomic_int s_cap_state;
+
+static uint8_t s_levels[2][AUDIO_SPECTRUM_MAX_BANDS];
+static atomic_uint s_pub;                   /**< (sequence << 1) | front buffer index */
+static uint8_t s_edges[AUDIO_SPECTRUM_MAX_BANDS + 1];   /**< First bin of each band, then SPECTRUM_TOP_BIN */
+static uint8_t s_bands = 0;                 /**< Band count the edges were built for */
+static volatile uint8_t s_req_bands = 0;    /**< Band count asked for by audio_spectrum_start() */
+
+static TaskHandle_t s_task = NULL;
+static volatile bool s_running = false;
+static audio_spectrum_stats_t s_stats;
+
+/*===========================================================================
+ * Helpers
+ *===========================================================================*/
+
+/**
+ * @brief Log-spaced band edges over bins 1..SPECTRUM_TOP_BIN
+ *
+ * edge[b] = 128^(b/bands), with 2^f approximated by 1 + f*(0.6565 + 0.3435f)
+ * (< 0.3% error). Bands that would be narrower than one bin are widened.
+ */
+static void build_edges(uint8_t bands)
+{
+    s_edges[0] = 1;
+    for (uint32_t b = 1; b < bands; b++) {
+        uint32_t ip = 7 * b / bands;
+        uint32_t fq = ((7 * b % bands) << 16) / bands;          /* Q16 fraction */
+        uint32_t m = 65536 + ((fq * (43024 + ((22512 * fq) >> 16))) >> 16);
+        uint32_t e = ((m << ip) + 32768) >> 16;
+
+        if (e <= s_edges[b - 1]) {
+            e = s_edges[b - 1] + 1;
+        }
+        if (e > SPECTRUM_TOP_BIN - (bands - b)) {
+            e = SPECTRUM_TOP_BIN - (bands - b);
+        }
+        s_edges[b] = (uint8_t)e;
+    }
+    s_edges[bands] = SPECTRUM_TOP_BIN;
+    s_bands = bands;
+}
+
+/**
+ * @brief Band power -> 0..255 level (3-bit fractional log2)
+ */
+static uint8_t level_of(uint64_t power)
+{
+    if (power == 0) {
+        return 0;
+    }
+    int msb = 63 - __builtin_clzll(power);
+    uint32_t frac = msb >= 3 ? (uint32_t)(power >> (msb - 3)) & 7 : (uint32_t)(power << (3 - msb)) & 7;
+    int32_t q3 = msb * 8 + (int32_t)frac - LEVEL_FLOOR_Q3;
+    if (q3 <= 0) {
+        return 0;
+    }
+    if (q3 >= LEVEL_RANGE_Q3) {
+        return 255;
+    }
+    return (uint8_t)(q3 * 255 / LEVEL_RANGE_Q3);
+}
+
+/**
+ * @brief Decay the front levels, merge @p fresh (may be NULL) and publish
+ */
+static void publish(const uint8_t *fresh)
+{
+    uint32_t pub = atomic_load_explicit(&s_pub, memory_order_relaxed);
+    const uint8_t *front = s_levels[pub & 1];
+    uint8_t *back = s_levels[(pub & 1) ^ 1];
+    bool changed = false;
+
+    for (uint32_t b = 0; b < AUDIO_SPECTRUM_MAX_BANDS; b++) {
+        uint8_t v = 0;
+        if (b < s_bands) {
+            v = front[b] > LEVEL_DECAY_STEP ? front[b] - LEVEL_DECAY_STEP : 0;
+            if (fresh != NULL && fresh[b] > v) {
+                v = fresh[b];
+            }
+        }
+        back[b] = v;
+        changed |= v != front[b];
+    }
+
+    if (changed) {
+        atomic_store_explicit(&s_pub, (((pub >> 1) + 1) << 1) | ((pub & 1) ^ 1), memory_order_release);
+    }
+}
+
+/**
+ * @brief Window, FFT and fold the captured frames into band levels
+ */
+static void analyze(uint8_t *levels)
+{
+    audio_fft_window_hann(s_buf->window, s_buf->fft);
+    audio_fft_q15(s_buf->fft);
+
+    for (uint32_t b = 0; b < s_bands; b++) {
+        uint64_t power = 0;
+        for (uint32_t k = s_edges[b]; k < s_edges[b + 1]; k++) {
+            int32_t re = s_buf->fft[k].re;
+            int32_t im = s_buf->fft[k].im;
+            power += (uint32_t)(re * re) + (uint32_t)(im * im);
+        }
+        levels[b] = level_of(power);
+    }
+}
+
+/*===========================================================================
+ * Analyzer Task
+ *===========================================================================*/
+
+static void spectrum_task(void *pvParameters)
+{
+    const TickType_t period = pdMS_TO_TICKS(SPECTRUM_PERIOD_MS) > 0 ? pdMS_TO_TICKS(SPECTRUM_PERIOD_MS) : 1;
+    TickType_t last = xTaskGetTickCount();
+    uint8_t levels[AUDIO_SPECTRUM_MAX_BANDS];
+
+    while (s_running) {
+        if (s_req_bands != s_bands) {
+            build_edges(s_req_bands);
+        }
+
+        s_cap_pos = 0;
+        atomic_store_explicit(&s_cap_state, CAP_ARMED, memory_order_release);
+        ulTaskNotifyTake(pdTRUE, period);
+
+        int state = CAP_ARMED;
+        if (atomic_compare_exchange_strong(&s_cap_state, &state, CAP_IDLE)) {
+            /* No audio this period */
+            s_stats.idle_periods++;
+            publish(NULL);
+        } else if (state == CAP_FULL) {
+            int64_t t0 = esp_timer_get_time();
+            analyze(levels);
+            atomic_store_explicit(&s_cap_state, CAP_IDLE, memory_order_relaxed);
+            publish(levels);
+            uint32_t us = (uint32_t)(esp_timer_get_time() - t0);
+
+            s_stats.frames++;
+            s_stats.last_us = us;
+            s_stats.total_us += us;
+            if (us > s_stats.max_us) {
+                s_stats.max_us = us;
+            }
+        }
+
+        xTaskDelayUntil(&last, period);
+    }
+
+    s_task = NULL;
+    vTaskDelete(NULL);
+}
+
+/*===========================================================================
+ * Tap (I2S writer task)
+ *===========================================================================*/
+
+void audio_spectrum_tap(const int16_t *pcm, uint32_t frames)
+{
+    if (atomic_load_explicit(&s_cap_state, memory_order_acquire) != CAP_ARMED) {
+        return;
+    }
+
+    uint32_t pos = s_cap_pos;
+    uint32_t n = AUDIO_FFT_N - pos;
+    if (n > frames) {
+        n = frames;
+    }
+    int16_t *dst = &s_buf->window[pos];
+    for (uint32_t i = 0; i < n; i++) {
+        dst[i] = (int16_t)(((int32_t)pcm[2 * i] + pcm[2 * i + 1]) >> 1);
+    }
+    s_cap_pos = pos + n;
+
+    if (s_cap_pos == AUDIO_FFT_N) {
+        atomic_store_explicit(&s_cap_state, CAP_FULL, memory_order_release);
+        TaskHandle_t task = s_task;
+        if (task != NULL) {
+            xTaskNotifyGive(task);
+        }
+    }
+}
+
+/*===========================================================================
+ * Public API
+ *===========================================================================*/
+
+esp_err_t audio_spectrum_start(uint8_t bands)
+{
+    if (bands == 0 || bands > AUDIO_SPECTRUM_MAX_BANDS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    s_req_bands = bands;
+    if (s_task != NULL) {
+        return ESP_OK;
+    }
+
+    s_buf = heap_caps_malloc(sizeof(spectrum_buf_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (s_buf == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate analyzer buffers");
+        return ESP_ERR_NO_MEM;
+    }
+
+    atomic_store(&s_cap_state, CAP_IDLE);
+    memset(&s_stats, 0, sizeof(s_stats));
+    build_edges(bands);
+
+    s_running = true;
+    if (xTaskCreate(spectrum_task, "audio_spectrum", SPECTRUM_TASK_STACK, NULL,
+                    SPECTRUM_TASK_PRIO, &s_task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create analyzer task");
+        s_running = false;
+        s_task = NULL;
+        heap_caps_free(s_buf);
+        s_buf = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Analyzer: %d-point FFT, %u bands every %d ms",
+             AUDIO_FFT_N, bands, SPECTRUM_PERIOD_MS);
+    return ESP_OK;
+}
+
+void audio_spectrum_stop(void)
+{
+    if (s_task == NULL) {
+        return;
+    }
+
+    s_running = false;
+    atomic_store_explicit(&s_cap_state, CAP_IDLE, memory_order_release);
+    xTaskNotifyGive(s_task);
+    for (int i = 0; i < 50 && s_task != NULL; i++) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+
+    /* Publish silence so a later reader does not show stale bars */
+    s_bands = 0;
+    publish(NULL);
+
+    heap_caps_free(s_buf);
+    s_buf = NULL;
+}
+
+uint32_t audio_spectrum_read(uint8_t *levels, uint8_t bands)
+{
+    if (levels == NULL || bands == 0) {
+        return 0;
+    }
+    uint32_t n = bands < AUDIO_SPECTRUM_MAX_BANDS ? bands : AUDIO_SPECTRUM_MAX_BANDS;
+    uint32_t pub = 0;
+
+    for (int tries = 0; tries < 4; tries++) {
+        pub = atomic_load_explicit(&s_pub, memory_order_acquire);
+        memcpy(levels, s_levels[pub & 1], n);
+        atomic_thread_fence(memory_order_acquire);
+        uint32_t again = atomic_load_explicit(&s_pub, memory_order_relaxed);
+        if ((again >> 1) - (pub >> 1) <= 1) {
+            break;  /* The buffer we read was not rewritten */
+        }
+    }
+
+    memset(levels + n, 0, bands - n);
+    return pub >> 1;
+}
+
+void audio_spectrum_get_stats(audio_spectrum_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    *stats = s_stats;
+}
+
+#else /* !CONFIG_AUDIO_SPECTRUM */
+
+esp_err_t audio_spectrum_start(uint8_t bands)
+{
+    ESP_LOGW(TAG, "Spectrum analyzer disabled (CONFIG_AUDIO_SPECTRUM)");
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+void audio_spectrum_stop(void)
+{
+}
+
+uint32_t audio_spectrum_read(uint8_t *levels, uint8_t bands)
+{
+    if (levels != NULL) {
+        memset(levels, 0, bands);
+    }
+    return 0;
+}
+
+void audio_spectrum_get_stats(audio_spectrum_stats_t *stats)
+{
+    if (stats != NULL) {
+        memset(stats, 0, sizeof(*stats));
+    }
+}
+
+#endif /* CONFIG_AUDIO_SPECTRUM */
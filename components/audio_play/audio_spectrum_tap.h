@@ -0,0 +1,35 @@
+/**
+ * @file audio_spectrum_tap.h
+ * @brief PCM tap feeding the spectrum analyzer (internal to audio_play)
+ */
+#pragma once
+
+#include <stdint.h>
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if CONFIG_AUDIO_SPECTRUM
+/**
+ * @brief Offer interleaved stereo 16-bit PCM about to be played
+ *
+ * Copies nothing unless the analyzer has asked for a window. Must be
+ * called from a single task (the I2S writer).
+ *
+ * @param pcm Interleaved L/R samples
+ * @param frames Number of stereo frames
+ */
+void audio_spectrum_tap(const int16_t *pcm, uint32_t frames);
+#else
+static inline void audio_spectrum_tap(const int16_t *pcm, uint32_t frames)
+{
+    (void)pcm;
+    (void)frames;
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,187 @@
+/**
+ * @file audio_telemetry.c
+ * @brief Pipeline metric histograms and periodic summary
+ *
+ * Fixed buckets keep recording O(1): a time sample costs one count-leading-
+ * zeros and five increments, a few hundred nanoseconds per decoded frame
+ * including the esp_timer reads around it - far below 1% CPU at the rates
+ * the pipeline produces samples (tens per second per metric).
+ */
+
+#include "audio_telemetry.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <inttypes.h>
+#include <string.h>
+
+static const char *TAG = "audio telem";
+
+#define TIME_SHIFT  4       /**< Bucket 0 of time metrics covers 0..15 us */
+
+static audio_histogram_t s_hist[AUDIO_METRIC_MAX];
+static bool s_cleared = false;
+static esp_timer_handle_t s_log_timer = NULL;
+
+static const char *const s_names[AUDIO_METRIC_MAX] = {
+    [AUDIO_METRIC_DECODE_US]      = "decode_us",
+    [AUDIO_METRIC_I2S_WRITE_US]   = "i2s_write_us",
+    [AUDIO_METRIC_OUT_RING_PCT]   = "out_ring_pct",
+    [AUDIO_METRIC_SD_RING_PCT]    = "sd_ring_pct",
+    [AUDIO_METRIC_UNDERRUN_US]    = "underrun_us",
+    [AUDIO_METRIC_SD_UNDERRUN_US] = "sd_underrun_us",
+    [AUDIO_METRIC_CMD_WAIT_US]    = "cmd_wait_us",
+    [AUDIO_METRIC_TTFS_US]        = "ttfs_us",
+    [AUDIO_METRIC_NET_STALL_US]   = "net_stall_us",
+};
+
+/*===========================================================================
+ * Helpers
+ *===========================================================================*/
+
+static inline bool is_percent(audio_metric_t metric)
+{
+    return metric == AUDIO_METRIC_OUT_RING_PCT || metric == AUDIO_METRIC_SD_RING_PCT;
+}
+
+static inline int bucket_of(audio_metric_t metric, uint32_t value)
+{
+    int b;
+    if (is_percent(metric)) {
+        b = (int)(value * AUDIO_HIST_BUCKETS / 100);
+    } else {
+        uint32_t x = value >> TIME_SHIFT;
+        b = x ? 32 - __builtin_clz(x) : 0;
+    }
+    return b < AUDIO_HIST_BUCKETS ? b : AUDIO_HIST_BUCKETS - 1;
+}
+
+#if CONFIG_AUDIO_TELEMETRY && CONFIG_AUDIO_TELEMETRY_LOG_PERIOD_S > 0
+static void log_timer_cb(void *arg)
+{
+    audio_telemetry_log();
+}
+#endif
+
+/*===========================================================================
+ * Internal API
+ *===========================================================================*/
+
+void audio_telemetry_init(void)
+{
+    if (!s_cleared) {
+        audio_telemetry_reset();
+        s_cleared = true;
+    }
+
+#if CONFIG_AUDIO_TELEMETRY && CONFIG_AUDIO_TELEMETRY_LOG_PERIOD_S > 0
+    if (s_log_timer == NULL) {
+        const esp_timer_create_args_t args = {
+            .callback = log_timer_cb,
+            .name = "audio_telem",
+        };
+        if (esp_timer_create(&args, &s_log_timer) == ESP_OK) {
+            esp_timer_start_periodic(s_log_timer, (uint64_t)CONFIG_AUDIO_TELEMETRY_LOG_PERIOD_S * 1000000);
+        }
+    }
+#endif
+}
+
+void audio_telemetry_deinit(void)
+{
+    if (s_log_timer != NULL) {
+        esp_timer_stop(s_log_timer);
+        esp_timer_delete(s_log_timer);
+        s_log_timer = NULL;
+    }
+}
+
+#if CONFIG_AUDIO_TELEMETRY
+void audio_telemetry_record(audio_metric_t metric, uint32_t value)
+{
+    if ((unsigned)metric >= AUDIO_METRIC_MAX) {
+        return;
+    }
+    audio_histogram_t *h = &s_hist[metric];
+    h->count++;
+    h->sum += value;
+    if (value < h->min) {
+        h->min = value;
+    }
+    if (value > h->max) {
+        h->max = value;
+    }
+    h->buckets[bucket_of(metric, value)]++;
+}
+#endif
+
+void audio_telemetry_get(audio_metric_t metric, audio_histogram_t *hist)
+{
+    if (hist == NULL) {
+        return;
+    }
+    if ((unsigned)metric >= AUDIO_METRIC_MAX) {
+        memset(hist, 0, sizeof(*hist));
+        hist->min = UINT32_MAX;
+        return;
+    }
+    *hist = s_hist[metric];
+}
+
+uint32_t audio_telemetry_bucket_limit(audio_metric_t metric, int bucket)
+{
+    if (bucket < 0) {
+        return 0;
+    }
+    if (bucket >= AUDIO_HIST_BUCKETS - 1) {
+        return UINT32_MAX;
+    }
+    if (is_percent(metric)) {
+        /* Smallest value that maps to the next bucket */
+        return ((uint32_t)(bucket + 1) * 100 + AUDIO_HIST_BUCKETS - 1) / AUDIO_HIST_BUCKETS;
+    }
+    return (uint32_t)1 << (TIME_SHIFT + bucket);
+}
+
+uint32_t audio_telemetry_percentile(audio_metric_t metric, const audio_histogram_t *hist, uint8_t percent)
+{
+    if (hist == NULL || hist->count == 0) {
+        return 0;
+    }
+    if (percent > 100) {
+        percent = 100;
+    }
+
+    uint32_t target = (uint32_t)(((uint64_t)hist->count * percent + 99) / 100);
+    uint32_t seen = 0;
+    for (int b = 0; b < AUDIO_HIST_BUCKETS; b++) {
+        seen += hist->buckets[b];
+        if (seen >= target && seen > 0) {
+            uint32_t limit = audio_telemetry_bucket_limit(metric, b);
+            return limit < hist->max ? limit : hist->max;
+        }
+    }
+    return hist->max;
+}
+
+void audio_telemetry_reset(void)
+{
+    memset(s_hist, 0, sizeof(s_hist));
+    for (int i = 0; i < AUDIO_METRIC_MAX; i++) {
+        s_hist[i].min = UINT32_MAX;
+    }
+}
+
+void audio_telemetry_log(void)
+{
+    for (int i = 0; i < AUDIO_METRIC_MAX; i++) {
+        audio_histogram_t h = s_hist[i];
+        if (h.count == 0) {
+            continue;
+        }
+        ESP_LOGI(TAG, "%-14s n=%-6"PRIu32" avg=%-6"PRIu32" p50=%-6"PRIu32" p99=%-6"PRIu32" min=%-6"PRIu32" max=%"PRIu32,
+                 s_names[i], h.count, (uint32_t)(h.sum / h.count),
+                 audio_telemetry_percentile((audio_metric_t)i, &h, 50),
+                 audio_telemetry_percentile((audio_metric_t)i, &h, 99),
+                 h.min, h.max);
+    }
+}
@@ -0,0 +1,69 @@
+/**
+ * @file audio_telemetry.h
+ * @brief Pipeline metric histograms (internal to audio_play)
+ *
+ * Each metric is recorded by a single task (decoder, I2S writer, player),
+ * so recording is a handful of plain increments with no locking. With
+ * CONFIG_AUDIO_TELEMETRY disabled audio_telemetry_record() compiles away.
+ */
+#pragma once
+
+#include <stdint.h>
+#include "sdkconfig.h"
+#include "audio_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Clear the histograms (first call only) and start the periodic summary
+ */
+void audio_telemetry_init(void);
+
+/**
+ * @brief Stop the periodic summary (histograms are kept)
+ */
+void audio_telemetry_deinit(void);
+
+#if CONFIG_AUDIO_TELEMETRY
+/**
+ * @brief Add one sample to a metric (owning task only)
+ */
+void audio_telemetry_record(audio_metric_t metric, uint32_t value);
+#else
+static inline void audio_telemetry_record(audio_metric_t metric, uint32_t value)
+{
+    (void)metric;
+    (void)value;
+}
+#endif
+
+/**
+ * @brief Snapshot one histogram
+ */
+void audio_telemetry_get(audio_metric_t metric, audio_histogram_t *hist);
+
+/**
+ * @brief Upper edge (exclusive) of a bucket, UINT32_MAX for the last one
+ */
+uint32_t audio_telemetry_bucket_limit(audio_metric_t metric, int bucket);
+
+/**
+ * @brief Percentile estimate from a histogram snapshot
+ */
+uint32_t audio_telemetry_percentile(audio_metric_t metric, const audio_histogram_t *hist, uint8_t percent);
+
+/**
+ * @brief Clear every histogram
+ */
+void audio_telemetry_reset(void);
+
+/**
+ * @brief Log one summary line per metric that has samples
+ */
+void audio_telemetry_log(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,171 @@
+/**
+ * @file audio_adpcm.h
+ * @brief IMA-ADPCM (4:1) clip format and streaming decoder
+ *
+ * Clips use the same block layout as mono IMA-ADPCM WAV files
+ * (WAVE_FORMAT_DVI_ADPCM): every block starts with a 4-byte header
+ * (int16 predictor, uint8 step index, uint8 reserved) followed by packed
+ * 4-bit codes, low nibble first. The header sample is the first sample of
+ * the block.
+ *
+ * Decoding is incremental - callers pull any number of samples at a time
+ * straight from flash, so a clip never has to be expanded in RAM.
+ *
+ * Embedded clips are generated by tools/gen_adpcm_asset.py. The streaming
+ * encoder produces the same block layout on the device (recordings).
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AUDIO_ADPCM_BLOCK_HEADER     4      /**< Bytes of header per block */
+#define AUDIO_ADPCM_MAX_BLOCK_ALIGN  512    /**< Largest block the encoder can build */
+
+/**
+ * @brief Samples held by one block of @p block_align bytes (mono)
+ */
+#define AUDIO_ADPCM_BLOCK_SAMPLES(block_align) \
+    ((((block_align) - AUDIO_ADPCM_BLOCK_HEADER) * 2) + 1)
+
+/**
+ * @brief Embedded IMA-ADPCM clip descriptor (mono)
+ */
+typedef struct {
+    const uint8_t *data;        /**< Encoded blocks */
+    size_t data_len;            /**< Encoded size in bytes */
+    size_t samples;             /**< Decoded sample count */
+    uint32_t sample_rate;       /**< Sample rate in Hz */
+    uint16_t block_align;       /**< Bytes per block (header included) */
+} audio_adpcm_clip_t;
+
+/**
+ * @brief Streaming decoder state
+ */
+typedef struct {
+    const audio_adpcm_clip_t *clip;
+    size_t sample;              /**< Next sample index in the clip */
+    size_t block_off;           /**< Byte offset of the current block */
+    uint16_t in_block;          /**< Next sample index inside the current block */
+    uint16_t block_samples;     /**< Samples per full block */
+    int32_t predictor;
+    int32_t step_index;
+} audio_adpcm_decoder_t;
+
+/**
+ * @brief Bind a decoder to a clip and rewind it
+ */
+void audio_adpcm_decoder_init(audio_adpcm_decoder_t *dec, const audio_adpcm_clip_t *clip);
+
+/**
+ * @brief Restart decoding from the first sample
+ */
+void audio_adpcm_decoder_rewind(audio_adpcm_decoder_t *dec);
+
+/**
+ * @brief Decode up to @p max_samples samples
+ *
+ * @param dec Decoder state
+ * @param[out] out Destination buffer
+ * @param max_samples Capacity of @p out
+ * @return Samples written, 0 at end of clip
+ */
+size_t audio_adpcm_decode(audio_adpcm_decoder_t *dec, int16_t *out, size_t max_samples);
+
+/**
+ * @brief Streaming encoder state (mono)
+ *
+ * Holds the block being built, so callers can feed any number of samples
+ * at a time and get whole blocks back.
+ */
+typedef struct {
+    uint8_t block[AUDIO_ADPCM_MAX_BLOCK_ALIGN];
+    uint16_t block_align;       /**< Bytes per block (header included) */
+    uint16_t block_samples;     /**< Samples per full block */
+    uint16_t in_block;          /**< Samples already in the current block */
+    int32_t predictor;
+    int32_t step_index;
+} audio_adpcm_encoder_t;
+
+/**
+ * @brief Reset an encoder
+ *
+ * @param enc Encoder state
+ * @param block_align Bytes per block, at most AUDIO_ADPCM_MAX_BLOCK_ALIGN
+ *                    (256 is the usual choice up to 16 kHz)
+ */
+void audio_adpcm_encoder_init(audio_adpcm_encoder_t *enc, uint16_t block_align);
+
+/**
+ * @brief Encode samples until the current block is full
+ *
+ * Call repeatedly, advancing @p in by @p consumed, until all input is used.
+ *
+ * @param enc Encoder state
+ * @param in 16-bit mono samples
+ * @param samples Number of samples in @p in
+ * @param[out] consumed Samples taken from @p in
+ * @return The completed block (block_align bytes, valid until the next
+ *         call), or NULL if the input ran out first
+ */
+const uint8_t *audio_adpcm_encode_block(audio_adpcm_encoder_t *enc, const int16_t *in,
+                                        size_t samples, size_t *consumed);
+
+/**
+ * @brief Close the partial block at the end of a stream
+ *
+ * Unused codes are zero-filled, so the block still has block_align bytes;
+ * a WAV "fact" chunk carries the real sample count.
+ *
+ * @param enc Encoder state
+ * @param[out] samples Samples held by the returned block
+ * @return The padded block, or NULL if the current block is empty
+ */
+const uint8_t *audio_adpcm_encoder_flush(audio_adpcm_encoder_t *enc, size_t *samples);
+
+#if CONFIG_APP_SELF_TEST
+/*===========================================================================
+ * Benchmark (CONFIG_APP_SELF_TEST)
+ *===========================================================================*/
+
+/**
+ * @brief Decode cost, CPU cycles on the device (nanoseconds in a
+ *        linux-target build)
+ */
+typedef struct {
+    uint32_t adpcm_decode;      /**< Per sample, audio_adpcm_decode() in 64-sample slices */
+    uint32_t pcm_copy;          /**< Per sample, copying raw PCM slices (the embedded PCM path) */
+    uint32_t mp3_decode;        /**< Per sample, esp_audio_simple_dec MP3 (0 = no MP3 given) */
+    uint32_t adpcm_voice;       /**< Per 44.1 kHz frame, ADPCM decode + resample from 16 kHz */
+    uint32_t pcm_voice;         /**< Per 44.1 kHz frame, resample from 16 kHz PCM */
+    uint32_t flash_ratio_pct;   /**< Encoded size as a percentage of the PCM size */
+} audio_adpcm_bench_t;
+
+/**
+ * @brief Time ADPCM decoding against the PCM and MP3 paths
+ *
+ * Encodes a 16 kHz test clip and decodes it in mixer-sized slices, alone
+ * and through the resampler as a mixer voice does, next to the same work
+ * on the raw PCM. An MP3 buffer (e.g. one of the SD card sounds read into
+ * RAM) is decoded once with the decoders registered by the music player.
+ * Allocates ~12 KB while running (plus the MP3 decoder).
+ *
+ * @param samples 16 kHz samples per measurement (e.g. 16000)
+ * @param mp3 MP3 data, or NULL to skip the MP3 measurement
+ * @param mp3_len Bytes of @p mp3
+ * @param bench Results
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, ESP_ERR_NO_MEM
+ */
+esp_err_t audio_adpcm_benchmark(uint32_t samples, const uint8_t *mp3, size_t mp3_len,
+                                audio_adpcm_bench_t *bench);
+#endif /* CONFIG_APP_SELF_TEST */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,205 @@
+/**
+ * @file audio_backend.h
+ * @brief Pluggable audio output / capture backends
+ *
+ * Every PCM write (made by the I2S writer task, which sums music and sound
+ * effects), power/volume change and microphone read in audio_play goes
+ * through the backend installed here, never straight to esp_codec_dev or I2S. The board codecs
+ * (ES8311 out, ES7210 in) are one implementation; the host backends write
+ * a WAV file (or discard the audio) and read a WAV file (or silence) with
+ * a virtual sample clock, so playback, resampling, mixing and recording
+ * can run and be timed in a Linux build.
+ *
+ * The output format is fixed by the mixer and decoder: AUDIO_BACKEND_OUT_RATE
+ * Hz, stereo, 16-bit interleaved.
+ *
+ * Usage (host benchmark):
+ *   audio_backend_set_output(audio_backend_host_output("/tmp/out.wav", false));
+ *   Audio_Play_Init();
+ *   ...
+ *   audio_host_stats_t st;
+ *   audio_backend_host_get_stats(&st);    // frames / busy_us -> samples per second
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AUDIO_BACKEND_OUT_RATE      44100   /**< Output sample rate (Hz) */
+#define AUDIO_BACKEND_OUT_CHANNELS  2       /**< Output channels (interleaved 16-bit) */
+
+/**
+ * @brief Output power levels (driven by audio_power.c)
+ */
+typedef enum {
+    AUDIO_POWER_OFF = 0,        /**< Codec suspended, amp off */
+    AUDIO_POWER_STANDBY,        /**< Codec running, DAC muted, amp off */
+    AUDIO_POWER_ACTIVE,         /**< DAC unmuted, amp on */
+} audio_power_level_t;
+
+/**
+ * @brief Audio output backend
+ *
+ * write() is called by the I2S writer task only; the backend still
+ * serializes it against reconfiguration. set_power() is only called by the power
+ * manager, under its lock. Optional operations may be NULL.
+ */
+typedef struct {
+    const char *name;
+    esp_err_t (*init)(void *ctx);       /**< Optional: installed (claim pins, open files) */
+    void (*deinit)(void *ctx);          /**< Optional: replaced or driver deinitialized */
+    /**
+     * @brief Play 16-bit stereo PCM; blocks while the device is full
+     * @return ESP_OK, ESP_ERR_TIMEOUT if the device stayed busy
+     *         for @p timeout_ms (nothing written), ESP_FAIL on error
+     */
+    esp_err_t (*write)(void *ctx, const int16_t *pcm, size_t bytes, uint32_t timeout_ms);
+    /**
+     * @brief Move to @p level with @p volume (0..100) in one batch
+     *
+     * Only what differs from the device's current state is written.
+     *
+     * @param[out] settle_ms Time before output is audible after this call
+     *             (codec start-up, amp pop suppression); 0 if ready
+     */
+    esp_err_t (*set_power)(void *ctx, audio_power_level_t level, int volume, uint32_t *settle_ms);
+    void *ctx;
+} audio_out_backend_t;
+
+/**
+ * @brief Audio capture backend
+ *
+ * Frames are delivered in the device's own format (the ES7210 runs 16 kHz,
+ * 2 channels, 32 bits). Optional operations may be NULL.
+ */
+typedef struct {
+    const char *name;
+    esp_err_t (*start)(void *ctx);      /**< Optional: begin a session, discard stale audio */
+    void (*stop)(void *ctx);            /**< Optional: end the session */
+    /**
+     * @brief Read up to @p bytes; waits at most @p timeout_ms for data
+     * @param[out] got Bytes actually read
+     */
+    esp_err_t (*read)(void *ctx, void *buf, size_t bytes, size_t *got, uint32_t timeout_ms);
+    /** Optional: data lost because nobody read in time since start() */
+    void (*get_overflows)(void *ctx, uint32_t *events, uint32_t *bytes);
+    void *ctx;
+} audio_in_backend_t;
+
+/**
+ * @brief Host backend counters
+ *
+ * busy_us is wall time spent inside the backend, audio_us the duration of
+ * the audio moved. In non-realtime mode frames * 1e6 / (elapsed wall time)
+ * is the pipeline's throughput in frames per second.
+ */
+typedef struct {
+    uint64_t out_frames;        /**< Frames written */
+    uint32_t out_writes;        /**< write() calls */
+    uint64_t out_busy_us;       /**< Wall time spent in write() */
+    uint64_t out_audio_us;      /**< Duration of the audio written */
+    uint64_t in_frames;         /**< Frames read */
+    uint64_t in_audio_us;       /**< Duration of the audio read */
+    int64_t first_write_us;     /**< esp_timer time of the first write, 0 if none */
+    int64_t last_write_us;      /**< esp_timer time of the last write */
+    uint32_t power_changes;     /**< set_power() calls that changed the level or volume (mock codec) */
+    uint8_t power_level;        /**< Last audio_power_level_t set */
+    uint8_t volume;             /**< Last volume set */
+} audio_host_stats_t;
+
+/*===========================================================================
+ * Selection
+ *===========================================================================*/
+
+/**
+ * @brief Install the output backend
+ *
+ * The previous backend is deinitialized. Call before Audio_Play_Init() or
+ * while nothing is playing.
+ *
+ * @param backend Backend to use, NULL for the Kconfig default
+ * @return ESP_OK, or the new backend's init() error (the old one stays)
+ */
+esp_err_t audio_backend_set_output(const audio_out_backend_t *backend);
+
+/**
+ * @brief Current output backend (installs the default on first use)
+ */
+const audio_out_backend_t *audio_backend_get_output(void);
+
+/**
+ * @brief Deinitialize and drop the output backend (amp off, pins released)
+ *
+ * The next audio_backend_get_output() installs the default again.
+ */
+void audio_backend_release_output(void);
+
+/**
+ * @brief Install the capture backend (NULL for the Kconfig default)
+ *
+ * Call while no recording is running.
+ */
+esp_err_t audio_backend_set_input(const audio_in_backend_t *backend);
+
+/**
+ * @brief Current capture backend (installs the default on first use)
+ */
+const audio_in_backend_t *audio_backend_get_input(void);
+
+/*===========================================================================
+ * Built-in Backends
+ *===========================================================================*/
+
+/**
+ * @brief ES8311 DAC through esp_audio_play(), PA on GPIO0
+ * @return NULL in builds without the board codec
+ */
+const audio_out_backend_t *audio_backend_codec_output(void);
+
+/**
+ * @brief ES7210 ADC through the BSP I2S RX channel
+ * @return NULL in builds without the board codec
+ */
+const audio_in_backend_t *audio_backend_codec_input(void);
+
+/**
+ * @brief WAV file sink (path) or null sink (NULL)
+ *
+ * With @p realtime false every write returns at once and only a virtual
+ * clock advances, so runs are deterministic and as fast as the pipeline.
+ * With @p realtime true writes are paced like the I2S DMA.
+ *
+ * @return Backend for audio_backend_set_output()
+ */
+const audio_out_backend_t *audio_backend_host_output(const char *path, bool realtime);
+
+/**
+ * @brief WAV file source (path) or silence (NULL), looped
+ *
+ * Frames are converted to @p channels x @p bits so the recorder sees the
+ * same layout as from the board ADC. Pacing as for the sink.
+ *
+ * @return Backend for audio_backend_set_input()
+ */
+const audio_in_backend_t *audio_backend_host_input(const char *path, uint32_t sample_rate,
+                                                   uint8_t channels, uint8_t bits, bool realtime);
+
+/**
+ * @brief Snapshot the host backend counters
+ */
+void audio_backend_host_get_stats(audio_host_stats_t *stats);
+
+/**
+ * @brief Clear the host backend counters
+ */
+void audio_backend_host_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
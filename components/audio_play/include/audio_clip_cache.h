@@ -0,0 +1,133 @@
+/**
+ * @file audio_clip_cache.h
+ * @brief RAM cache of decoded sound-effect files, keyed by path
+ *
+ * Short sounds that live on the SD card (MP3 or WAV) are decoded once into
+ * 16-bit PCM and kept in RAM, so replaying them is a mixer voice started
+ * from memory: no FAT lookup, no SPI traffic, no decoder pipeline. Entries
+ * are evicted least-recently-used first when the byte budget
+ * (CONFIG_AUDIO_CLIP_CACHE_KB) would be exceeded. Pinned entries and
+ * entries a mixer voice still references (playing, or queued to play) are
+ * never evicted.
+ *
+ * Files are decoded by a background loader task; a miss returns at once
+ * and the clip is ready for the next request.
+ *
+ * Usage:
+ *   const char *pins[] = { "/sdcard/Sounds/happy_loop.mp3" };
+ *   audio_clip_cache_set_pinned(pins, 1);           // loads in the background
+ *   ...
+ *   audio_voice_t voice;
+ *   if (audio_clip_cache_play("/sdcard/Sounds/happy_loop.mp3", true, &voice) != ESP_OK) {
+ *       Audio_Play_Music("file:///sdcard/Sounds/happy_loop.mp3");    // miss: stream it this time
+ *   }
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "audio_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AUDIO_CLIP_CACHE_MAX_PINS   4   /**< Paths audio_clip_cache_set_pinned() accepts */
+#define AUDIO_CLIP_CACHE_PATH_MAX   96  /**< Longest path (including terminator) */
+
+/**
+ * @brief Cache counters
+ *
+ * hits + misses counts audio_clip_cache_play() calls. A file that does not
+ * fit the budget (or cannot be decoded) is remembered as rejected, so later
+ * requests count as misses without retrying the load.
+ */
+typedef struct {
+    uint32_t hits;              /**< Plays served from RAM */
+    uint32_t misses;            /**< Plays that found no decoded clip */
+    uint32_t loads;             /**< Files decoded into the cache */
+    uint32_t load_errors;       /**< Files that could not be opened or decoded */
+    uint32_t rejected;          /**< Files larger than the budget allows */
+    uint32_t evictions;         /**< Entries dropped to make room */
+    uint32_t max_load_us;       /**< Longest load (read + decode) */
+    uint64_t sd_bytes_read;     /**< Compressed bytes read from the card */
+    uint32_t entries;           /**< Clips currently cached */
+    uint32_t pinned;            /**< Of which pinned */
+    uint32_t used_bytes;        /**< PCM bytes currently cached */
+    uint32_t peak_bytes;        /**< Highest used_bytes seen */
+    uint32_t budget_bytes;      /**< Byte budget */
+} audio_clip_cache_stats_t;
+
+/**
+ * @brief Start the loader task
+ *
+ * Called by Audio_Play_Init(). Memory is only allocated as clips are
+ * loaded, up to CONFIG_AUDIO_CLIP_CACHE_KB or a quarter of the free heap,
+ * whichever is less. Decoding relies on the decoders registered by the
+ * music player.
+ *
+ * @return ESP_OK (also if already running), ESP_ERR_INVALID_STATE while a
+ *         voice still plays a clip left by audio_clip_cache_deinit(),
+ *         ESP_ERR_NO_MEM
+ */
+esp_err_t audio_clip_cache_init(void);
+
+/**
+ * @brief Stop the loader task and free every clip
+ *
+ * Voices still playing a cached clip should have been stopped (the mixer
+ * is shut down first by Audio_Play_Deinit()). A clip still referenced is
+ * left allocated and freed by the next audio_clip_cache_init().
+ */
+void audio_clip_cache_deinit(void);
+
+/**
+ * @brief Play a cached clip on a mixer voice
+ *
+ * On a miss the file is queued for loading and nothing is played.
+ *
+ * @param path Absolute file path, the cache key (e.g. "/sdcard/Sounds/beep.mp3")
+ * @param loop Loop until the voice is stopped
+ * @param[out] voice Mixer voice playing the clip (may be NULL)
+ * @return ESP_OK on a hit, ESP_ERR_NOT_FOUND on a miss,
+ *         ESP_FAIL if the mixer did not accept the clip,
+ *         ESP_ERR_INVALID_STATE if the cache is not running
+ */
+esp_err_t audio_clip_cache_play(const char *path, bool loop, audio_voice_t *voice);
+
+/**
+ * @brief Queue a file for loading without playing it
+ * @return ESP_OK if cached or queued, ESP_ERR_INVALID_STATE if not running
+ */
+esp_err_t audio_clip_cache_prefetch(const char *path);
+
+/**
+ * @brief Replace the set of pinned paths
+ *
+ * Pinned clips are never evicted and are loaded in the background if not
+ * cached yet. Clips pinned before but not in @p paths become ordinary LRU
+ * entries again. Pass n = 0 to unpin everything.
+ *
+ * @param paths Absolute file paths (NULL entries are skipped)
+ * @param n Number of paths, at most AUDIO_CLIP_CACHE_MAX_PINS
+ * @return ESP_OK, ESP_ERR_INVALID_ARG if n is too large
+ */
+esp_err_t audio_clip_cache_set_pinned(const char *const *paths, size_t n);
+
+/**
+ * @brief Snapshot the cache counters
+ */
+void audio_clip_cache_get_stats(audio_clip_cache_stats_t *stats);
+
+/**
+ * @brief Clear the event counters (hits, misses, loads, ...)
+ *
+ * Occupancy (entries, used_bytes) is kept; peak_bytes restarts from it.
+ */
+void audio_clip_cache_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
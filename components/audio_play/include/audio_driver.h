@@ -1,5 +1,6 @@
 #pragma once
 
+#include "sdkconfig.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
@@ -13,6 +14,7 @@
 #include "esp_gmf_io.h"
 #include "esp_gmf_io_embed_flash.h"
 #include "esp_gmf_audio_dec.h"
+#include "audio_adpcm.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -20,6 +22,166 @@ extern "C" {
 
 #define Volume_MAX  100
 
+/**
+ * @brief Handle for a clip started with Audio_Play_PCM()
+ */
+typedef uint32_t audio_voice_t;
+
+#define AUDIO_VOICE_INVALID  0  /**< Returned when a clip could not be queued */
+
+/**
+ * @brief Counters of the SD read-ahead stream feeding the music decoder
+ */
+typedef struct {
+    uint32_t files;             /**< Files opened (including spliced ones) */
+    uint32_t prefetches;        /**< Next-track files opened and pre-buffered */
+    uint32_t splices;           /**< Next tracks joined to the running stream (gapless) */
+    uint32_t bursts;            /**< Refill bursts (low -> high watermark) */
+    uint32_t chunk_reads;       /**< Chunk-sized fread() calls */
+    uint64_t bytes_read;        /**< Bytes read from the card */
+    uint32_t underruns;         /**< Decoder reads that found the ring empty before EOF */
+    uint32_t underrun_wait_us;  /**< Total time the decoder waited on an empty ring */
+    uint32_t bus_wait_us;       /**< Total time the reader waited for the SPI bus */
+    uint32_t bus_hold_us;       /**< Total time the reader held the SPI bus */
+    uint32_t bus_timeouts;      /**< Bus acquires that hit the wait bound */
+    uint32_t max_read_us;       /**< Longest single chunk read */
+    uint32_t min_level_chunks;  /**< Lowest fill level seen by the decoder */
+    uint32_t level_chunks;      /**< Current fill level */
+    uint32_t capacity_chunks;   /**< Ring size (high watermark) */
+    uint32_t chunk_bytes;       /**< Bytes per chunk */
+} audio_stream_stats_t;
+
+/**
+ * @brief Counters of the HTTP stream feeding the music decoder
+ *
+ * stalls stays at zero during glitch-free playback. throughput_bps is
+ * measured over the time the reader spent waiting on the network (not on
+ * buffer space), so it is the rate the link can deliver, not the bitrate.
+ */
+typedef struct {
+    uint32_t streams;           /**< Streams opened */
+    uint32_t reused_connections;/**< Streams sent on a kept-alive connection (no handshake) */
+    uint32_t reconnects;        /**< Dropped connections resumed with a Range request */
+    uint32_t failures;          /**< Streams cut short because reconnecting failed */
+    uint64_t bytes_received;    /**< Body bytes received */
+    uint32_t throughput_bps;    /**< Received bits per second of network time */
+    uint32_t last_connect_us;   /**< Open to response headers, latest stream */
+    uint32_t last_startup_us;   /**< Open to prebuffer complete (decoder gets data), latest stream */
+    uint32_t max_startup_us;    /**< Worst startup */
+    uint32_t stalls;            /**< Jitter buffer ran dry before the end of a stream */
+    uint64_t stall_us;          /**< Total time spent rebuffering */
+    uint32_t max_stall_us;      /**< Longest single stall */
+    uint32_t prebuffer_bytes;   /**< Start threshold at the current bitrate */
+    uint32_t rebuffer_bytes;    /**< Adaptive threshold the next stall will wait for */
+    uint32_t min_level_bytes;   /**< Lowest fill level seen while playing */
+    uint32_t level_bytes;       /**< Current fill level */
+    uint32_t capacity_bytes;    /**< Jitter buffer size */
+    uint32_t bitrate_bps;       /**< Rate used to convert the ms thresholds */
+} audio_net_stream_stats_t;
+
+/**
+ * @brief Counters of the decoder output ring and I2S writer task
+ */
+typedef struct {
+    uint64_t bytes_in;          /**< PCM bytes pushed by the decoder */
+    uint64_t bytes_out;         /**< PCM bytes handed to esp_audio_play() */
+    uint64_t dropped_bytes;     /**< Bytes discarded because the ring stayed full */
+    uint32_t underruns;         /**< Times the ring ran dry while the decoder was streaming */
+    uint32_t overruns;          /**< Decoder pushes that timed out on a full ring */
+    uint32_t producer_wait_us;  /**< Total time the decoder waited for ring space */
+    uint32_t i2s_writes;        /**< esp_audio_play() calls made by the writer */
+    uint32_t write_errors;      /**< Writes the output rejected (block kept and retried) */
+    uint32_t max_write_us;      /**< Longest single esp_audio_play() call */
+    uint32_t max_level_bytes;   /**< Highest fill level seen */
+    uint32_t level_bytes;       /**< Current fill level */
+    uint32_t capacity_bytes;    /**< Ring size */
+} audio_output_stats_t;
+
+/**
+ * @brief Counters of the sound-effect mixer task
+ *
+ * push_timeouts and dropped_bytes stay at zero while the I2S writer keeps
+ * up with the effects.
+ */
+typedef struct {
+    uint32_t chunks;            /**< Chunks rendered and handed to the writer */
+    uint32_t push_timeouts;     /**< Pushes that waited out a full effects ring (rest of the chunk retried) */
+    uint64_t dropped_bytes;     /**< Effect bytes discarded after the last retry */
+    uint32_t steals;            /**< Voices cut short because every slot was busy */
+} audio_mixer_stats_t;
+
+/**
+ * @brief Time-to-first-sample of track transitions
+ *
+ * Measured from the request (Audio_Play_Music, Audio_Next, end of the
+ * previous track, or the decoder reaching a spliced file) to the first
+ * decoded PCM of the new track reaching the output ring.
+ */
+typedef struct {
+    uint32_t transitions;       /**< Transitions measured */
+    uint32_t decoder_reuses;    /**< Handled without a pipeline restart (splice or in-place skip) */
+    uint32_t pipeline_restarts; /**< Needed a pipeline stop/run */
+    uint32_t last_ttfs_us;      /**< Time to first sample of the latest transition */
+    uint32_t max_ttfs_us;       /**< Worst transition */
+    uint64_t total_ttfs_us;     /**< Sum, for the average */
+} audio_transition_stats_t;
+
+/**
+ * @brief Output power state counters
+ *
+ * A start is a client (music or sound-effect mixer) claiming the output:
+ * cold from OFF (codec start-up plus amp settle), warm from STANDBY (amp
+ * settle), hot when already ACTIVE (no wait).
+ */
+typedef struct {
+    uint32_t cold_starts;       /**< Starts that woke a suspended codec */
+    uint32_t warm_starts;       /**< Starts from standby (codec running, muted) */
+    uint32_t hot_starts;        /**< Starts with the output already active */
+    uint32_t prewarms;          /**< Audio_Prewarm() calls */
+    uint32_t prewarm_hits;      /**< Starts made hot by a pre-warm */
+    uint32_t transitions;       /**< Level changes applied to the codec */
+    uint32_t max_settle_us;     /**< Longest wait a start was asked to make */
+    uint64_t settle_wait_us;    /**< Total start waits */
+    uint64_t off_us;            /**< Time spent off */
+    uint64_t standby_us;        /**< Time spent in standby */
+    uint64_t active_us;         /**< Time spent active */
+    uint8_t level;              /**< Current level: 0 off, 1 standby, 2 active */
+} audio_power_stats_t;
+
+/**
+ * @brief Pipeline metrics recorded as histograms (see Audio_Get_Histogram)
+ */
+typedef enum {
+    AUDIO_METRIC_DECODE_US,         /**< Decoder/pipeline processing time per output frame */
+    AUDIO_METRIC_I2S_WRITE_US,      /**< esp_audio_play() blocking time per writer block */
+    AUDIO_METRIC_OUT_RING_PCT,      /**< Output ring fill level (%), sampled per decoder push */
+    AUDIO_METRIC_SD_RING_PCT,       /**< SD read-ahead fill level (%), sampled per drained chunk */
+    AUDIO_METRIC_UNDERRUN_US,       /**< Length of each output ring dry spell while streaming */
+    AUDIO_METRIC_SD_UNDERRUN_US,    /**< Decoder wait on an empty read-ahead ring, per read */
+    AUDIO_METRIC_CMD_WAIT_US,       /**< Player command latency, request to dequeue */
+    AUDIO_METRIC_TTFS_US,           /**< Play/next request to first decoded sample */
+    AUDIO_METRIC_NET_STALL_US,      /**< Length of each network stream stall (rebuffering) */
+    AUDIO_METRIC_MAX,
+} audio_metric_t;
+
+#define AUDIO_HIST_BUCKETS  16      /**< Buckets per histogram */
+
+/**
+ * @brief Fixed-bucket histogram
+ *
+ * Time metrics (_US) use log2 buckets: bucket 0 holds values below 16 us,
+ * bucket i holds [16 << (i - 1), 16 << i) and the last bucket everything
+ * from 262 ms up. Fill levels (_PCT) use 16 linear buckets of 6.25%.
+ * Audio_Histogram_Bucket_Limit() gives the exact edges.
+ */
+typedef struct {
+    uint32_t count;                         /**< Samples recorded */
+    uint32_t min;                           /**< Smallest sample (UINT32_MAX if none) */
+    uint32_t max;                           /**< Largest sample */
+    uint64_t sum;                           /**< Sum, for the average */
+    uint32_t buckets[AUDIO_HIST_BUCKETS];   /**< Samples per bucket */
+} audio_histogram_t;
+
 void Audio_Play_Init(void);
 void Volume_Adjustment(uint8_t Vol);
 uint8_t get_audio_volume(void);
@@ -31,21 +193,242 @@ esp_gmf_err_t Audio_Pause_Play(void);
 esp_asp_state_t Audio_Get_Current_State(void);
 void Audio_Play_Deinit(void);
 
+/**
+ * @brief Append a track to the playlist
+ *
+ * Starts it right away if nothing is playing. Otherwise it plays after the
+ * current track: the file is opened and pre-buffered in the background and,
+ * for MP3s with the same sample rate and channel count, joined to the
+ * running decoder without a gap.
+ *
+ * @param url File URL (e.g., "file:///sdcard/Music/song.mp3"), or an
+ *            http:// / https:// URL streamed through the network jitter
+ *            buffer (no prefetch or gapless splice for those)
+ * @return ESP_GMF_ERR_OK if the request was queued
+ */
+esp_gmf_err_t Audio_Queue_Append(const char *url);
+
+/**
+ * @brief Skip to the next playlist track now
+ *
+ * Reuses the running decoder when the formats match, otherwise restarts
+ * the pipeline on the pre-buffered file. No-op if the playlist is empty.
+ *
+ * @return ESP_GMF_ERR_OK if the request was queued
+ */
+esp_gmf_err_t Audio_Next(void);
+
+/**
+ * @brief Drop every queued playlist track (the current one keeps playing)
+ * @return ESP_GMF_ERR_OK if the request was queued
+ */
+esp_gmf_err_t Audio_Queue_Clear(void);
+
+/**
+ * @brief Get track transition timings
+ * @param[out] stats Filled with a snapshot of the counters
+ */
+void Audio_Get_Transition_Stats(audio_transition_stats_t *stats);
+
+/**
+ * @brief Reset track transition timings
+ */
+void Audio_Reset_Transition_Stats(void);
+
+/**
+ * @brief Power up the output ahead of an expected sound
+ *
+ * Non-blocking. The codec and amplifier go active now and stay so for
+ * @p hold_ms, so a sound started within that time has no start-up delay.
+ * Use it when the UI enters a screen or state that plays sounds.
+ *
+ * @param hold_ms Time to stay active (0 = CONFIG_AUDIO_POWER_ACTIVE_HOLD_MS)
+ */
+void Audio_Prewarm(uint32_t hold_ms);
+
+/**
+ * @brief Get output power state counters
+ * @param[out] stats Filled with a snapshot of the counters
+ */
+void Audio_Get_Power_Stats(audio_power_stats_t *stats);
+
+/**
+ * @brief Reset output power state counters
+ */
+void Audio_Reset_Power_Stats(void);
+
+/**
+ * @brief Get one pipeline metric histogram
+ *
+ * Recording is lock-free; a snapshot taken during playback may be one
+ * sample out of step between fields.
+ *
+ * @param metric Metric to read
+ * @param[out] hist Filled with a snapshot
+ */
+void Audio_Get_Histogram(audio_metric_t metric, audio_histogram_t *hist);
+
+/**
+ * @brief Upper edge (exclusive) of a histogram bucket
+ *
+ * @param metric Metric the histogram belongs to
+ * @param bucket Bucket index
+ * @return Edge in the metric's unit; UINT32_MAX for the last bucket
+ */
+uint32_t Audio_Histogram_Bucket_Limit(audio_metric_t metric, int bucket);
+
+/**
+ * @brief Estimate a percentile from a histogram
+ *
+ * @param metric Metric the histogram belongs to
+ * @param hist Histogram snapshot
+ * @param percent 1-100
+ * @return Upper edge of the bucket holding the percentile (capped at the
+ *         recorded maximum), 0 if the histogram is empty
+ */
+uint32_t Audio_Histogram_Percentile(audio_metric_t metric, const audio_histogram_t *hist, uint8_t percent);
+
+/**
+ * @brief Clear every metric histogram
+ */
+void Audio_Reset_Histograms(void);
+
+/**
+ * @brief Log a one-line summary (count, average, p50, p99, max) per metric
+ *
+ * Also runs every CONFIG_AUDIO_TELEMETRY_LOG_PERIOD_S seconds while audio
+ * is initialized.
+ */
+void Audio_Log_Telemetry(void);
+
 /**
  * @brief Play embedded PCM audio data directly
  *
- * Plays raw PCM samples from memory. Handles sample rate conversion
- * to match the codec's native sample rate (44.1kHz).
+ * Queues raw PCM samples on the sound-effect mixer and returns immediately.
+ * The mixer task handles sample rate conversion to the codec's native
+ * rate (44.1kHz) and the I2S writes. Several clips can overlap.
  *
- * @param pcm_data Pointer to 16-bit PCM sample array
- * @param samples Number of samples (not bytes)
+ * @param pcm_data Pointer to 16-bit PCM sample array (must stay valid while playing)
+ * @param samples Number of samples per channel (frames, not bytes)
  * @param sample_rate Source sample rate in Hz (e.g., 8000, 22050, 44100)
  * @param channels Number of channels (1=mono, 2=stereo)
- * @param loop If true, loop the audio continuously
- * @return ESP_GMF_ERR_OK on success
+ * @param loop If true, loop the audio until Audio_Stop_Voice() is called
+ * @return Voice handle, or AUDIO_VOICE_INVALID if the clip was not queued
+ */
+audio_voice_t Audio_Play_PCM(const int16_t *pcm_data, size_t samples,
+                             uint32_t sample_rate, uint8_t channels, bool loop);
+
+/**
+ * @brief Play an embedded IMA-ADPCM clip
+ *
+ * Like Audio_Play_PCM(), but the clip stays compressed in flash and is
+ * decoded block by block by the mixer task while it plays.
+ *
+ * @param clip Mono ADPCM clip (see audio_adpcm.h; must stay valid while playing)
+ * @param loop If true, loop the audio until Audio_Stop_Voice() is called
+ * @return Voice handle, or AUDIO_VOICE_INVALID if the clip was not queued
  */
-esp_gmf_err_t Audio_Play_PCM(const int16_t *pcm_data, size_t samples,
-                              uint32_t sample_rate, uint8_t channels, bool loop);
+audio_voice_t Audio_Play_ADPCM(const audio_adpcm_clip_t *clip, bool loop);
+
+/**
+ * @brief Stop a clip started with Audio_Play_PCM()
+ * @param voice Voice handle
+ * @return ESP_GMF_ERR_OK if the stop request was queued
+ */
+esp_gmf_err_t Audio_Stop_Voice(audio_voice_t voice);
+
+/**
+ * @brief Stop every clip started with Audio_Play_PCM()
+ */
+void Audio_Stop_All_Voices(void);
+
+/**
+ * @brief Check whether a clip is still queued or playing
+ * @param voice Voice handle
+ * @return true while active
+ */
+bool Audio_Voice_Is_Active(audio_voice_t voice);
+
+/**
+ * @brief Get SD read-ahead stream counters (music playback)
+ * @param[out] stats Filled with a snapshot of the counters
+ */
+void Audio_Get_Stream_Stats(audio_stream_stats_t *stats);
+
+/**
+ * @brief Reset SD read-ahead stream counters
+ */
+void Audio_Reset_Stream_Stats(void);
+
+/**
+ * @brief Get HTTP stream counters (music played from http:// or https:// URLs)
+ * @param[out] stats Filled with a snapshot of the counters
+ */
+void Audio_Get_Net_Stream_Stats(audio_net_stream_stats_t *stats);
+
+/**
+ * @brief Reset HTTP stream counters
+ */
+void Audio_Reset_Net_Stream_Stats(void);
+
+/**
+ * @brief Get decoder output ring / I2S writer counters (music playback)
+ *
+ * underruns and overruns stay at zero during glitch-free playback.
+ *
+ * @param[out] stats Filled with a snapshot of the counters
+ */
+void Audio_Get_Output_Stats(audio_output_stats_t *stats);
+
+/**
+ * @brief Reset decoder output ring / I2S writer counters
+ */
+void Audio_Reset_Output_Stats(void);
+
+/**
+ * @brief Get sound-effect mixer counters
+ * @param[out] stats Filled with a snapshot of the counters
+ */
+void Audio_Get_Mixer_Stats(audio_mixer_stats_t *stats);
+
+/**
+ * @brief Reset sound-effect mixer counters
+ */
+void Audio_Reset_Mixer_Stats(void);
+
+#if CONFIG_APP_SELF_TEST
+/*===========================================================================
+ * Self Test (CONFIG_APP_SELF_TEST)
+ *===========================================================================*/
+
+/**
+ * @brief Result of audio_mixer_check()
+ */
+typedef struct {
+    uint32_t posts;             /**< PLAY commands timed */
+    uint32_t avg_post_us;       /**< Average audio_mixer_play() call */
+    uint32_t max_post_us;       /**< Slowest audio_mixer_play() call */
+    uint32_t id_errors;         /**< Ids out of order, not active while queued, or active after stop */
+    uint32_t done_errors;       /**< Release callbacks missing or repeated */
+} audio_mixer_check_t;
+
+/**
+ * @brief Time the sound-effect mixer's enqueue path and check voice id tracking
+ *
+ * Posts bursts of looping silent clips, timing each enqueue, then stops
+ * them. Every id must be larger than the previous one, report active
+ * while queued and inactive once the stop has landed, and every clip must
+ * get exactly one release callback (stolen or stopped). Needs the mixer
+ * running (Audio_Play_Init()); briefly plays silence.
+ *
+ * @param result Timings and error count
+ * @return ESP_OK if the average enqueue is within 50 us, the slowest within
+ *         1 ms and no id or release error was seen; ESP_FAIL otherwise;
+ *         ESP_ERR_INVALID_STATE if the mixer is not running
+ */
+esp_err_t audio_mixer_check(audio_mixer_check_t *result);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
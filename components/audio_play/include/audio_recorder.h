@@ -0,0 +1,230 @@
+/**
+ * @file audio_recorder.h
+ * @brief Streaming WAV recorder (I2S microphone -> SD card)
+ *
+ * Owns the I2S RX channel while recording. A reader task drains the I2S DMA
+ * into a RAM ring; a separate writer task empties the ring to the SD card in
+ * FAT-cluster-sized blocks, taking the shared SPI bus only for the write
+ * itself. A slow card write therefore never stalls the I2S reads, and
+ * recordings can run for any length of time.
+ *
+ * Samples can be reduced on the fly (16-bit, mono, IMA-ADPCM) before they
+ * are buffered, which cuts the SD bandwidth - and the time the card holds
+ * the SPI bus shared with the display - by 2x to 16x.
+ *
+ * The WAV header is written with empty sizes when the file is opened and
+ * patched with the final RIFF/data sizes when the recording is closed.
+ *
+ * With a pre-roll enabled, the microphone is captured into a small RAM ring
+ * between recordings. A recording then starts with that ring's contents
+ * (the audio just before the tap) followed seamlessly by the live stream,
+ * instead of with whatever arrives after the file has been created.
+ *
+ * Usage:
+ *   audio_recorder_config_t cfg = AUDIO_RECORDER_DEFAULT_CONFIG("/sdcard/Recordings/REC.WAV");
+ *   audio_recorder_start(&cfg);
+ *   ...
+ *   audio_recorder_stop();          // flushes, patches the header, closes
+ *
+ * Pre-roll (same config as the recordings that will follow):
+ *   audio_recorder_preroll_enable(&cfg, 500);       // keep the last 500 ms
+ *   ...
+ *   audio_recorder_start(&cfg);                     // file starts 500 ms before this call
+ *
+ * Start, stop and the pre-roll calls may be made from different tasks
+ * (e.g. a UI task and the power manager); they are serialized internally.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Format stored in the WAV file
+ *
+ * 16-bit reduction keeps the top half of 32-bit samples. With the ES7210
+ * running 32-bit stereo, those are the microphone words of
+ * esp_get_feed_data()'s channel map; the low halves hold the playback
+ * reference and an unused slot.
+ */
+typedef enum {
+    AUDIO_RECORDER_FORMAT_RAW = 0,      /**< I2S frames as read */
+    AUDIO_RECORDER_FORMAT_PCM16,        /**< 16-bit PCM, every channel */
+    AUDIO_RECORDER_FORMAT_PCM16_MONO,   /**< 16-bit PCM, mono (see mono_source) */
+    AUDIO_RECORDER_FORMAT_ADPCM,        /**< 4-bit IMA-ADPCM, mono (see mono_source) */
+} audio_recorder_format_t;
+
+#define AUDIO_RECORDER_MONO_MIX  (-1)   /**< mono_source: average of both channels */
+
+/**
+ * @brief Recording parameters
+ *
+ * sample_rate, channels and bits_per_sample describe the I2S RX channel;
+ * format selects what is stored.
+ */
+typedef struct {
+    const char *path;           /**< Output file (directory must exist) */
+    uint32_t sample_rate;       /**< Hz, written to the WAV header */
+    uint8_t channels;           /**< I2S channels, 1 or 2 */
+    uint8_t bits_per_sample;    /**< I2S bits per sample, 16 or 32 */
+    uint32_t max_duration_ms;   /**< Stop automatically after this long, 0 = until audio_recorder_stop() */
+    audio_recorder_format_t format; /**< Stored format */
+    int8_t mono_source;         /**< Channel kept by the mono formats, or AUDIO_RECORDER_MONO_MIX */
+} audio_recorder_config_t;
+
+/**
+ * @brief 16 kHz stereo 32-bit stored as is, no duration limit
+ *        (ES7210 default format)
+ */
+#define AUDIO_RECORDER_DEFAULT_CONFIG(file) { \
+    .path = (file), \
+    .sample_rate = 16000, \
+    .channels = 2, \
+    .bits_per_sample = 32, \
+    .max_duration_ms = 0, \
+    .format = AUDIO_RECORDER_FORMAT_RAW, \
+    .mono_source = AUDIO_RECORDER_MONO_MIX, \
+}
+
+/**
+ * @brief Counters of the current (or last) recording
+ *
+ * dropped_frames stays at zero when no audio was lost. It is the sum of
+ * frames the reader had to discard because the ring was full and frames
+ * the I2S driver overwrote because the reader fell behind (DMA overflow).
+ */
+typedef struct {
+    uint64_t bytes_captured;    /**< PCM bytes read from I2S */
+    uint64_t bytes_written;     /**< Audio bytes written to the file (after format reduction) */
+    uint32_t dropped_frames;    /**< Frames lost in total (see above) */
+    uint32_t ring_drops;        /**< I2S reads discarded because the ring was full */
+    uint32_t dma_overflows;     /**< I2S DMA receive-queue overflows */
+    uint32_t read_errors;       /**< I2S reads that failed or timed out */
+    uint32_t write_errors;      /**< Short SD writes (card full or removed) */
+    uint32_t block_writes;      /**< fwrite() calls issued by the writer */
+    uint32_t max_write_us;      /**< Longest single block write, bus wait excluded */
+    uint32_t convert_us;        /**< Total time spent reducing and queueing captured audio */
+    uint32_t bus_wait_us;       /**< Total time the writer waited for the SPI bus */
+    uint32_t max_level_bytes;   /**< Highest ring fill level seen */
+    uint32_t level_bytes;       /**< Current ring fill level */
+    uint32_t capacity_bytes;    /**< Ring size */
+    uint32_t duration_ms;       /**< Audio captured so far (pre-roll included) */
+    uint32_t preroll_ms;        /**< Audio from before audio_recorder_start() at the head of the file */
+    uint32_t start_latency_us;  /**< audio_recorder_start() call to capture running */
+    bool start_late;            /**< start_latency_us exceeded CONFIG_AUDIO_REC_START_MAX_MS */
+} audio_recorder_stats_t;
+
+/**
+ * @brief Open the output file and start recording
+ *
+ * Allocates the ring and starts the reader and writer tasks. Returns as
+ * soon as capture is running.
+ *
+ * @param config Recording parameters
+ * @return ESP_OK, ESP_ERR_INVALID_ARG for an unsupported format,
+ *         ESP_ERR_INVALID_STATE if a recording is still open,
+ *         ESP_ERR_NOT_FOUND if the file cannot be created,
+ *         ESP_ERR_NO_MEM if the ring or tasks cannot be allocated
+ */
+esp_err_t audio_recorder_start(const audio_recorder_config_t *config);
+
+/**
+ * @brief Stop recording and close the file
+ *
+ * Stops capture, waits for the writer to flush the ring, patches the WAV
+ * header and closes the file. Also collects a recording that already ended
+ * on its own (max_duration_ms or a write error). Safe to call more than
+ * once, or from two tasks at a time: only the first call waits for the
+ * writer, later ones return the same result.
+ *
+ * @return ESP_OK if the file is complete, ESP_FAIL if a write failed,
+ *         ESP_ERR_TIMEOUT if the writer did not finish in time
+ */
+esp_err_t audio_recorder_stop(void);
+
+/**
+ * @brief True while audio is being captured
+ *
+ * Turns false once capture ends (stop, duration limit or write error),
+ * possibly before the file has been closed.
+ */
+bool audio_recorder_is_recording(void);
+
+/**
+ * @brief Snapshot the recording counters
+ */
+void audio_recorder_get_stats(audio_recorder_stats_t *stats);
+
+/**
+ * @brief Keep the last @p ms of microphone audio in RAM between recordings
+ *
+ * Starts a capture task that fills an overwrite-oldest ring of 16-bit
+ * samples (mono for the mono formats), sized for @p ms and capped by
+ * CONFIG_AUDIO_REC_PREROLL_KB. A later audio_recorder_start() with the
+ * same sample rate, channels, bits and mono/stereo choice takes over the
+ * running capture and writes the ring first; other configs record without
+ * pre-roll. The task pauses while a recording runs and resumes after
+ * audio_recorder_stop().
+ *
+ * @param config Format of the recordings to come (path is ignored)
+ * @param ms Pre-roll length
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, ESP_ERR_NO_MEM,
+ *         ESP_ERR_NOT_SUPPORTED if CONFIG_AUDIO_REC_PREROLL_KB is 0
+ */
+esp_err_t audio_recorder_preroll_enable(const audio_recorder_config_t *config, uint32_t ms);
+
+/**
+ * @brief Stop the pre-roll capture and free its ring
+ */
+void audio_recorder_preroll_disable(void);
+
+/**
+ * @brief Pause the pre-roll capture for power save (or resume it)
+ *
+ * The ring is kept but restarts empty on resume. Call on screen-off and
+ * light sleep; a recording started while suspended has no pre-roll. Waits
+ * for a start() or stop() in progress on another task.
+ *
+ * @param suspend true to pause, false to resume
+ */
+void audio_recorder_preroll_suspend(bool suspend);
+
+#if CONFIG_APP_SELF_TEST
+/*===========================================================================
+ * Verification (CONFIG_APP_SELF_TEST)
+ *===========================================================================*/
+
+/**
+ * @brief Result of audio_recorder_check()
+ */
+typedef struct {
+    uint32_t kernel_runs;       /**< Format/channel/source combinations, in and out of place */
+    uint32_t kernel_errors;     /**< Samples that differ from the reference */
+    uint32_t kernel_max_lsb;    /**< Largest difference seen (32-bit mixes may round by 1) */
+    int32_t adpcm_snr_db;       /**< 440 Hz tone through the recorder's ADPCM encoder and back */
+} audio_recorder_check_t;
+
+/**
+ * @brief Compare the format-reduction kernels with a per-sample reference
+ *
+ * Runs 16- and 32-bit, mono and stereo noise through every reduction
+ * (all channels, mix, each channel pick), out of place and in place, and
+ * round-trips a tone through IMA-ADPCM with the recorder's block size.
+ * Does not touch the microphone.
+ *
+ * @param result Mismatch counts and ADPCM signal-to-noise ratio
+ * @return ESP_OK if every sample matches and the round trip reaches 20 dB,
+ *         ESP_FAIL otherwise, ESP_ERR_NO_MEM
+ */
+esp_err_t audio_recorder_check(audio_recorder_check_t *result);
+#endif /* CONFIG_APP_SELF_TEST */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,148 @@
+/**
+ * @file audio_resampler.h
+ * @brief Fixed-point polyphase sample-rate converter (streaming)
+ *
+ * Converts 16-bit mono or interleaved stereo PCM between two rates using
+ * Q15 polyphase FIR tables generated at build time
+ * (tools/gen_resampler_coeffs.py). No floating point is used, which matters
+ * on the ESP32-C6 since it has no FPU.
+ *
+ * Ratios with a dedicated table:
+ * - 8000  -> 44100  (L=441, M=80)
+ * - 16000 -> 44100  (L=441, M=160)
+ * - 22050 -> 44100  (L=2,   M=1)
+ *
+ * Equal rates pass through; any other ratio falls back to Q16 linear
+ * interpolation.
+ *
+ * Usage:
+ *   audio_resampler_t rs;
+ *   audio_resampler_init(&rs, 16000, 44100, 1);
+ *   while (have_input) {
+ *       size_t used;
+ *       size_t n = audio_resampler_process(&rs, in, in_frames, &used, out, out_frames);
+ *       in += used * channels; in_frames -= used;
+ *       ...consume n output frames...
+ *   }
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AUDIO_RESAMPLER_MAX_TAPS  16   /**< Longest sub-filter in any table */
+
+/**
+ * @brief Resampler mode (selected by audio_resampler_init)
+ */
+typedef enum {
+    AUDIO_RESAMPLER_PASSTHROUGH,   /**< in_rate == out_rate */
+    AUDIO_RESAMPLER_POLYPHASE,     /**< Table-driven polyphase FIR */
+    AUDIO_RESAMPLER_LINEAR,        /**< Q16 linear interpolation fallback */
+} audio_resampler_mode_t;
+
+/**
+ * @brief Streaming resampler state
+ *
+ * Treat as opaque. Sized statically so it can live inside other
+ * structures (e.g. mixer voices) without allocation.
+ */
+typedef struct {
+    audio_resampler_mode_t mode;
+    uint8_t channels;               /**< 1 or 2 */
+
+    /* Polyphase */
+    const int16_t *coeffs;          /**< [phases][taps], oldest tap first */
+    uint16_t phases;                /**< Interpolation factor L */
+    uint16_t step;                  /**< Decimation factor M */
+    uint8_t taps;                   /**< Taps per phase */
+    uint16_t phase;                 /**< Current phase 0..L-1 */
+    uint16_t need;                  /**< Input frames to consume before next output */
+    uint8_t hist_pos;               /**< Write index into the delay line */
+    int16_t hist[2][AUDIO_RESAMPLER_MAX_TAPS * 2];  /**< Mirrored delay line per channel */
+
+    /* Linear */
+    uint32_t frac;                  /**< Fractional position (Q16) */
+    uint32_t inc;                   /**< Input frames per output frame (Q16) */
+    int16_t prev[2];                /**< Last input frame (interpolation start) */
+    int16_t next[2];                /**< Current input frame (interpolation end) */
+} audio_resampler_t;
+
+/**
+ * @brief Initialize a resampler
+ *
+ * @param rs Resampler state
+ * @param in_rate Source rate in Hz
+ * @param out_rate Destination rate in Hz
+ * @param channels 1 (mono) or 2 (interleaved stereo)
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG on bad parameters
+ */
+esp_err_t audio_resampler_init(audio_resampler_t *rs, uint32_t in_rate,
+                               uint32_t out_rate, uint8_t channels);
+
+/**
+ * @brief Clear filter history (e.g. when a clip restarts)
+ */
+void audio_resampler_reset(audio_resampler_t *rs);
+
+/**
+ * @brief Convert as much input as possible into the output buffer
+ *
+ * Stops when either the input is exhausted or the output is full. Filter
+ * state carries over between calls, so input may be fed in arbitrary
+ * block sizes.
+ *
+ * @param rs Resampler state
+ * @param in Input frames (interleaved if stereo)
+ * @param in_frames Number of input frames available
+ * @param[out] in_used Number of input frames consumed
+ * @param out Output frames (same channel layout as the input)
+ * @param out_frames Capacity of @p out in frames
+ * @return Number of output frames written
+ */
+size_t audio_resampler_process(audio_resampler_t *rs,
+                               const int16_t *in, size_t in_frames, size_t *in_used,
+                               int16_t *out, size_t out_frames);
+
+#if CONFIG_APP_SELF_TEST
+/*===========================================================================
+ * Benchmark (CONFIG_APP_SELF_TEST)
+ *===========================================================================*/
+
+#define AUDIO_RESAMPLER_BENCH_RATES  3  /**< 8000, 16000 and 22050 Hz -> 44100 Hz */
+
+/**
+ * @brief Cost per output frame, CPU cycles on the device (nanoseconds in
+ *        a linux-target build)
+ */
+typedef struct {
+    uint32_t in_rate;               /**< Source rate (Hz) */
+    uint32_t polyphase_mono;        /**< This resampler, mono */
+    uint32_t polyphase_stereo;      /**< This resampler, stereo */
+    uint32_t float_linear;          /**< The old float loop of Audio_Play_PCM() (mono in, stereo out) */
+} audio_resampler_bench_t;
+
+/**
+ * @brief Time the polyphase resampler against the float linear loop it replaced
+ *
+ * Converts a block of noise to 44100 Hz for each table-driven source rate,
+ * streaming it in mixer-sized calls. Allocates 1.5 KB while running.
+ *
+ * @param frames Output frames per measurement (e.g. 44100)
+ * @param bench Results, one per source rate
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, ESP_ERR_NO_MEM
+ */
+esp_err_t audio_resampler_benchmark(uint32_t frames,
+                                    audio_resampler_bench_t bench[AUDIO_RESAMPLER_BENCH_RATES]);
+#endif /* CONFIG_APP_SELF_TEST */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,109 @@
+/**
+ * @file audio_spectrum.h
+ * @brief Real-time spectrum of the music output (for visualizers)
+ *
+ * The I2S writer hands one 256-frame window of the PCM it is about to play
+ * to a low-priority analyzer task once per period. The task runs a Q15
+ * radix-4 FFT, folds bins 1..127 into log-spaced bands and publishes
+ * 0..255 levels (60 dB range, fast attack, ~0.6 s decay). Readers never
+ * block: the result is double-buffered behind one atomic word.
+ *
+ * Usage:
+ *   audio_spectrum_start(20);
+ *   ...
+ *   uint8_t bars[20];
+ *   if (audio_spectrum_read(bars, 20) != last_seq) { redraw }
+ *   ...
+ *   audio_spectrum_stop();
+ */
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AUDIO_SPECTRUM_MAX_BANDS    32  /**< Upper limit for the band count */
+
+/**
+ * @brief Analyzer counters
+ */
+typedef struct {
+    uint32_t frames;            /**< Spectra computed from fresh audio */
+    uint32_t idle_periods;      /**< Periods without audio (levels only decayed) */
+    uint32_t last_us;           /**< Window + FFT + band folding time of the last frame */
+    uint32_t max_us;            /**< Longest frame */
+    uint64_t total_us;          /**< Sum over all frames */
+} audio_spectrum_stats_t;
+
+/**
+ * @brief Start the analyzer task
+ *
+ * Runs every CONFIG_AUDIO_SPECTRUM_PERIOD_MS. Calling it again while
+ * running only changes the band count.
+ *
+ * @param bands Number of output bands, 1..AUDIO_SPECTRUM_MAX_BANDS
+ * @return ESP_OK, ESP_ERR_INVALID_ARG for a bad band count,
+ *         ESP_ERR_NOT_SUPPORTED if CONFIG_AUDIO_SPECTRUM is disabled,
+ *         ESP_ERR_NO_MEM if the task cannot be created
+ */
+esp_err_t audio_spectrum_start(uint8_t bands);
+
+/**
+ * @brief Stop the analyzer task (levels drop to zero)
+ */
+void audio_spectrum_stop(void);
+
+/**
+ * @brief Copy the latest band levels (lock-free, any task)
+ *
+ * @param[out] levels Receives @p bands levels, 0 (silence) .. 255 (full scale)
+ * @param bands Number of levels wanted; bands beyond the analyzer's count read 0
+ * @return Sequence number of the copied spectrum; it changes whenever a
+ *         new one is published, 0 if none has been
+ */
+uint32_t audio_spectrum_read(uint8_t *levels, uint8_t bands);
+
+/**
+ * @brief Snapshot the analyzer counters
+ */
+void audio_spectrum_get_stats(audio_spectrum_stats_t *stats);
+
+#if CONFIG_APP_SELF_TEST
+/*===========================================================================
+ * Benchmark (CONFIG_APP_SELF_TEST)
+ *===========================================================================*/
+
+/**
+ * @brief Cost per 256-point frame, CPU cycles on the device (nanoseconds
+ *        in a linux-target build), and accuracy of the last frame
+ */
+typedef struct {
+    uint32_t window;            /**< Hann window + complex load */
+    uint32_t fft;               /**< Q15 radix-4 transform */
+    uint32_t peak_bin;          /**< Strongest bin of the test signal (17 expected) */
+    uint32_t max_err_lsb;       /**< Worst bin against a double-precision DFT / 256 */
+} audio_fft_bench_t;
+
+/**
+ * @brief Time the analyzer kernel and check it against a reference DFT
+ *
+ * Transforms a half-scale tone in bin 17 plus noise @p frames times, then
+ * compares the fixed-point result with a double-precision DFT of the same
+ * windowed input. Works without the analyzer task (or CONFIG_AUDIO_SPECTRUM).
+ * Allocates 2.5 KB while running.
+ *
+ * @param frames Transforms to time (e.g. 1000)
+ * @param bench Results
+ * @return ESP_OK if the tone lands in its bin and no bin is off by more
+ *         than 16 LSB; ESP_FAIL otherwise; ESP_ERR_INVALID_ARG, ESP_ERR_NO_MEM
+ */
+esp_err_t audio_fft_benchmark(uint32_t frames, audio_fft_bench_t *bench);
+#endif /* CONFIG_APP_SELF_TEST */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,459 @@
+/**
+ * @file resampler_coeffs.c
+ * @brief Q15 polyphase FIR tables for audio_resampler.c
+ *
+ * GENERATED by tools/gen_resampler_coeffs.py - do not edit by hand.
+ */
+
+#include "audio_resampler.h"
+
+/* L=441, 8 taps/phase, Kaiser beta=6.0, cutoff=0.90*pi/L */
+const int16_t rs_coeffs_441[441 * 8] = {
+    457, -1470, 2676, 29467, 2738, -1487, 461, -37,
+    453, -1453, 2615, 29466, 2800, -1505, 465, -37,
+    449, -1435, 2554, 29465, 2862, -1522, 469, -38,
+    445, -1418, 2493, 29464, 2925, -1539, 473, -38,
+    441, -1401, 2432, 29462, 2987, -1557, 477, -39,
+    437, -1384, 2372, 29460, 3050, -1574, 481, -39,
+    433, -1366, 2311, 29457, 3114, -1592, 485, -40,
+    429, -1349, 2251, 29454, 3177, -1609, 489, -40,
+    425, -1332, 2192, 29450, 3241, -1627, 493, -41,
+    421, -1315, 2132, 29446, 3305, -1644, 498, -41,
+    417, -1298, 2073, 29442, 3369, -1662, 502, -42,
+    413, -1281, 2014, 29437, 3433, -1679, 506, -42,
+    409, -1264, 1956, 29431, 3498, -1697, 510, -43,
+    406, -1247, 1897, 29425, 3563, -1715, 514, -43,
+    402, -1230, 1839, 29419, 3628, -1732, 518, -44,
+    398, -1213, 1781, 29412, 3693, -1750, 522, -44,
+    394, -1197, 1724, 29405, 3759, -1767, 526, -45,
+    390, -1180, 1666, 29397, 3825, -1785, 530, -45,
+    386, -1163, 1609, 29389, 3891, -1803, 534, -46,
+    382, -1146, 1552, 29380, 3957, -1820, 538, -46,
+    378, -1130, 1496, 29371, 4024, -1838, 542, -47,
+    374, -1113, 1440, 29362, 4090, -1856, 546, -47,
+    370, -1096, 1384, 29352, 4157, -1873, 550, -48,
+    367, -1080, 1328, 29341, 4225, -1891, 554, -48,
+    363, -1063, 1272, 29330, 4292, -1909, 558, -49,
+    359, -1047, 1217, 29319, 4360, -1927, 562, -49,
+    355, -1030, 1162, 29307, 4427, -1944, 566, -50,
+    351, -1014, 1108, 29295, 4496, -1962, 570, -50,
+    347, -998, 1053, 29282, 4564, -1980, 574, -51,
+    344, -981, 999, 29269, 4632, -1998, 578, -51,
+    340, -965, 945, 29255, 4701, -2015, 582, -52,
+    336, -949, 892, 29241, 4770, -2033, 586, -53,
+    332, -933, 839, 29227, 4839, -2051, 591, -53,
+    328, -917, 786, 29212, 4909, -2068, 595, -54,
+    325, -901, 733, 29197, 4978, -2086, 599, -54,
+    321, -885, 680, 29181, 5048, -2104, 603, -55,
+    317, -869, 628, 29164, 5118, -2122, 607, -55,
+    313, -853, 576, 29148, 5188, -2139, 611, -56,
+    310, -837, 525, 29130, 5259, -2157, 615, -56,
+    306, -821, 474, 29113, 5329, -2175, 619, -57,
+    302, -805, 422, 29095, 5400, -2192, 623, -57,
+    299, -789, 372, 29076, 5471, -2210, 626, -58,
+    295, -774, 321, 29057, 5543, -2228, 630, -58,
+    291, -758, 271, 29038, 5614, -2245, 634, -59,
+    288, -743, 221, 29018, 5686, -2263, 638, -59,
+    284, -727, 171, 28998, 5758, -2281, 642, -60,
+    281, -712, 122, 28977, 5830, -2298, 646, -60,
+    277, -696, 73, 28956, 5902, -2316, 650, -61,
+    273, -681, 24, 28934, 5974, -2333, 654, -62,
+    270, -666, -24, 28912, 6047, -2351, 658, -62,
+    266, -650, -72, 28890, 6120, -2369, 662, -63,
+    263, -635, -120, 28867, 6193, -2386, 666, -63,
+    259, -620, -168, 28843, 6266, -2404, 670, -64,
+    256, -605, -215, 28820, 6339, -2421, 674, -64,
+    252, -590, -262, 28795, 6413, -2438, 677, -65,
+    249, -575, -309, 28771, 6486, -2456, 681, -65,
+    245, -560, -356, 28746, 6560, -2473, 685, -66,
+    242, -545, -402, 28720, 6634, -2491, 689, -66,
+    238, -531, -448, 28694, 6709, -2508, 693, -67,
+    235, -516, -493, 28668, 6783, -2525, 696, -67,
+    231, -501, -539, 28641, 6858, -2543, 700, -68,
+    228, -487, -584, 28614, 6933, -2560, 704, -69,
+    225, -472, -629, 28586, 7008, -2577, 708, -69,
+    221, -458, -673, 28558, 7083, -2594, 712, -70,
+    218, -443, -717, 28529, 7158, -2612, 715, -70,
+    215, -429, -761, 28500, 7233, -2629, 719, -71,
+    211, -415, -805, 28471, 7309, -2646, 723, -71,
+    208, -401, -848, 28441, 7385, -2663, 726, -72,
+    205, -386, -891, 28411, 7461, -2680, 730, -72,
+    201, -372, -934, 28380, 7537, -2697, 734, -73,
+    198, -358, -976, 28349, 7613, -2714, 737, -73,
+    195, -344, -1018, 28318, 7690, -2731, 741, -74,
+    192, -331, -1060, 28286, 7766, -2748, 745, -74,
+    188, -317, -1102, 28254, 7843, -2765, 748, -75,
+    185, -303, -1143, 28221, 7920, -2781, 752, -75,
+    182, -289, -1184, 28188, 7997, -2798, 755, -76,
+    179, -276, -1225, 28154, 8074, -2815, 759, -76,
+    176, -262, -1265, 28120, 8151, -2832, 762, -77,
+    172, -249, -1305, 28086, 8229, -2848, 766, -77,
+    169, -235, -1345, 28051, 8306, -2865, 769, -78,
+    166, -222, -1385, 28016, 8384, -2881, 773, -78,
+    163, -209, -1424, 27980, 8462, -2898, 776, -79,
+    160, -196, -1463, 27944, 8540, -2914, 780, -79,
+    157, -182, -1502, 27907, 8618, -2931, 783, -80,
+    154, -169, -1540, 27871, 8696, -2947, 787, -80,
+    151, -156, -1578, 27833, 8775, -2963, 790, -81,
+    148, -143, -1616, 27796, 8853, -2979, 793, -81,
+    145, -131, -1653, 27758, 8932, -2995, 797, -82,
+    142, -118, -1690, 27719, 9011, -3012, 800, -82,
+    139, -105, -1727, 27680, 9090, -3028, 803, -83,
+    136, -92, -1764, 27641, 9169, -3043, 806, -83,
+    133, -80, -1800, 27601, 9248, -3059, 810, -84,
+    130, -67, -1836, 27561, 9327, -3075, 813, -84,
+    127, -55, -1872, 27521, 9407, -3091, 816, -85,
+    125, -43, -1907, 27480, 9486, -3107, 819, -85,
+    122, -30, -1942, 27439, 9566, -3122, 822, -86,
+    119, -18, -1977, 27397, 9645, -3138, 826, -86,
+    116, -6, -2012, 27355, 9725, -3153, 829, -87,
+    113, 6, -2046, 27312, 9805, -3169, 832, -87,
+    111, 18, -2080, 27270, 9885, -3184, 835, -88,
+    108, 30, -2114, 27226, 9966, -3199, 838, -88,
+    105, 42, -2147, 27183, 10046, -3215, 841, -89,
+    102, 53, -2180, 27139, 10126, -3230, 844, -89,
+    100, 65, -2213, 27095, 10207, -3245, 847, -89,
+    97, 77, -2246, 27050, 10287, -3260, 849, -90,
+    94, 88, -2278, 27005, 10368, -3275, 852, -90,
+    92, 100, -2310, 26959, 10449, -3290, 855, -91,
+    89, 111, -2341, 26913, 10529, -3304, 858, -91,
+    86, 122, -2373, 26867, 10610, -3319, 861, -92,
+    84, 134, -2404, 26820, 10691, -3334, 864, -92,
+    81, 145, -2435, 26773, 10772, -3348, 866, -92,
+    79, 156, -2465, 26726, 10854, -3362, 869, -93,
+    76, 167, -2495, 26678, 10935, -3377, 872, -93,
+    74, 178, -2525, 26630, 11016, -3391, 874, -94,
+    71, 189, -2555, 26582, 11098, -3405, 877, -94,
+    69, 200, -2584, 26533, 11179, -3419, 879, -94,
+    66, 210, -2613, 26484, 11261, -3433, 882, -95,
+    64, 221, -2642, 26434, 11342, -3447, 885, -95,
+    61, 231, -2670, 26384, 11424, -3461, 887, -96,
+    59, 242, -2698, 26334, 11506, -3475, 889, -96,
+    56, 252, -2726, 26283, 11588, -3488, 892, -96,
+    54, 263, -2754, 26232, 11669, -3502, 894, -97,
+    52, 273, -2781, 26181, 11751, -3515, 897, -97,
+    49, 283, -2808, 26129, 11833, -3528, 899, -97,
+    47, 293, -2835, 26077, 11915, -3542, 901, -98,
+    45, 303, -2861, 26025, 11998, -3555, 903, -98,
+    43, 313, -2888, 25972, 12080, -3568, 906, -98,
+    40, 323, -2914, 25919, 12162, -3581, 908, -99,
+    38, 333, -2939, 25866, 12244, -3593, 910, -99,
+    36, 342, -2964, 25812, 12326, -3606, 912, -99,
+    34, 352, -2989, 25758, 12409, -3619, 914, -100,
+    31, 361, -3014, 25703, 12491, -3631, 916, -100,
+    29, 371, -3039, 25648, 12574, -3643, 918, -100,
+    27, 380, -3063, 25593, 12656, -3656, 920, -101,
+    25, 390, -3087, 25538, 12739, -3668, 922, -101,
+    23, 399, -3110, 25482, 12821, -3680, 924, -101,
+    21, 408, -3134, 25426, 12904, -3692, 926, -101,
+    19, 417, -3157, 25369, 12986, -3703, 927, -102,
+    17, 426, -3180, 25313, 13069, -3715, 929, -102,
+    15, 435, -3202, 25256, 13152, -3727, 931, -102,
+    13, 444, -3224, 25198, 13234, -3738, 932, -102,
+    11, 452, -3246, 25140, 13317, -3749, 934, -103,
+    9, 461, -3268, 25082, 13400, -3760, 936, -103,
+    7, 470, -3289, 25024, 13482, -3772, 937, -103,
+    5, 478, -3310, 24965, 13565, -3782, 939, -103,
+    3, 487, -3331, 24906, 13648, -3793, 940, -104,
+    1, 495, -3352, 24847, 13730, -3804, 941, -104,
+    -1, 503, -3372, 24787, 13813, -3815, 943, -104,
+    -3, 511, -3392, 24727, 13896, -3825, 944, -104,
+    -5, 520, -3412, 24667, 13979, -3835, 945, -104,
+    -6, 528, -3431, 24606, 14061, -3845, 947, -104,
+    -8, 536, -3450, 24545, 14144, -3855, 948, -105,
+    -10, 544, -3469, 24484, 14227, -3865, 949, -105,
+    -12, 551, -3488, 24423, 14310, -3875, 950, -105,
+    -14, 559, -3506, 24361, 14392, -3885, 951, -105,
+    -15, 567, -3524, 24299, 14475, -3894, 952, -105,
+    -17, 574, -3542, 24236, 14558, -3903, 953, -105,
+    -19, 582, -3560, 24174, 14641, -3913, 954, -105,
+    -20, 589, -3577, 24111, 14723, -3922, 955, -106,
+    -22, 597, -3594, 24047, 14806, -3931, 956, -106,
+    -24, 604, -3611, 23984, 14889, -3939, 956, -106,
+    -25, 611, -3627, 23920, 14971, -3948, 957, -106,
+    -27, 618, -3644, 23856, 15054, -3957, 958, -106,
+    -29, 625, -3660, 23792, 15136, -3965, 958, -106,
+    -30, 632, -3675, 23727, 15219, -3973, 959, -106,
+    -32, 639, -3691, 23662, 15301, -3981, 959, -106,
+    -33, 646, -3706, 23597, 15384, -3989, 960, -106,
+    -35, 652, -3721, 23531, 15466, -3997, 960, -106,
+    -36, 659, -3736, 23465, 15549, -4004, 961, -106,
+    -38, 666, -3750, 23399, 15631, -4012, 961, -106,
+    -39, 672, -3764, 23333, 15713, -4019, 961, -106,
+    -41, 678, -3778, 23266, 15795, -4026, 961, -106,
+    -42, 685, -3792, 23200, 15878, -4033, 962, -106,
+    -43, 691, -3805, 23133, 15960, -4040, 962, -106,
+    -45, 697, -3818, 23065, 16042, -4046, 962, -106,
+    -46, 703, -3831, 22998, 16124, -4053, 962, -106,
+    -48, 709, -3843, 22930, 16206, -4059, 962, -106,
+    -49, 715, -3856, 22862, 16288, -4065, 962, -106,
+    -50, 721, -3868, 22793, 16370, -4071, 961, -106,
+    -52, 727, -3880, 22725, 16452, -4077, 961, -105,
+    -53, 733, -3891, 22656, 16533, -4083, 961, -105,
+    -54, 738, -3903, 22586, 16615, -4088, 961, -105,
+    -55, 744, -3914, 22517, 16696, -4093, 960, -105,
+    -57, 749, -3924, 22448, 16778, -4099, 960, -105,
+    -58, 755, -3935, 22378, 16859, -4104, 959, -105,
+    -59, 760, -3945, 22308, 16941, -4108, 959, -105,
+    -60, 765, -3955, 22237, 17022, -4113, 958, -104,
+    -61, 771, -3965, 22167, 17103, -4117, 957, -104,
+    -62, 776, -3975, 22096, 17184, -4122, 957, -104,
+    -64, 781, -3984, 22025, 17265, -4126, 956, -104,
+    -65, 786, -3993, 21954, 17346, -4130, 955, -104,
+    -66, 791, -4002, 21882, 17427, -4133, 954, -103,
+    -67, 795, -4011, 21810, 17508, -4137, 953, -103,
+    -68, 800, -4019, 21739, 17589, -4140, 952, -103,
+    -69, 805, -4027, 21666, 17669, -4143, 951, -102,
+    -70, 809, -4035, 21594, 17750, -4146, 950, -102,
+    -71, 814, -4043, 21522, 17830, -4149, 949, -102,
+    -72, 818, -4050, 21449, 17910, -4152, 947, -102,
+    -73, 823, -4057, 21376, 17990, -4154, 946, -101,
+    -74, 827, -4064, 21303, 18070, -4156, 945, -101,
+    -75, 831, -4071, 21229, 18150, -4158, 943, -101,
+    -76, 835, -4077, 21156, 18230, -4160, 942, -100,
+    -77, 839, -4084, 21082, 18310, -4162, 940, -100,
+    -78, 843, -4090, 21008, 18389, -4163, 939, -99,
+    -79, 847, -4095, 20934, 18469, -4165, 937, -99,
+    -79, 851, -4101, 20859, 18548, -4166, 935, -99,
+    -80, 855, -4106, 20785, 18627, -4167, 933, -98,
+    -81, 859, -4111, 20710, 18706, -4167, 931, -98,
+    -82, 862, -4116, 20635, 18785, -4168, 929, -97,
+    -83, 866, -4121, 20560, 18864, -4168, 927, -97,
+    -84, 869, -4125, 20484, 18943, -4168, 925, -96,
+    -84, 873, -4130, 20409, 19021, -4168, 923, -96,
+    -85, 876, -4134, 20333, 19100, -4168, 921, -95,
+    -86, 880, -4137, 20257, 19178, -4167, 919, -95,
+    -87, 883, -4141, 20181, 19256, -4166, 916, -94,
+    -87, 886, -4144, 20105, 19334, -4165, 914, -94,
+    -88, 889, -4147, 20029, 19412, -4164, 911, -93,
+    -89, 892, -4150, 19952, 19489, -4163, 909, -93,
+    -89, 895, -4153, 19875, 19567, -4161, 906, -92,
+    -90, 898, -4155, 19799, 19644, -4159, 903, -91,
+    -91, 901, -4157, 19722, 19722, -4157, 901, -91,
+    -91, 903, -4159, 19644, 19799, -4155, 898, -90,
+    -92, 906, -4161, 19567, 19875, -4153, 895, -89,
+    -93, 909, -4163, 19489, 19952, -4150, 892, -89,
+    -93, 911, -4164, 19412, 20029, -4147, 889, -88,
+    -94, 914, -4165, 19334, 20105, -4144, 886, -87,
+    -94, 916, -4166, 19256, 20181, -4141, 883, -87,
+    -95, 919, -4167, 19178, 20257, -4137, 880, -86,
+    -95, 921, -4168, 19100, 20333, -4134, 876, -85,
+    -96, 923, -4168, 19021, 20409, -4130, 873, -84,
+    -96, 925, -4168, 18943, 20484, -4125, 869, -84,
+    -97, 927, -4168, 18864, 20560, -4121, 866, -83,
+    -97, 929, -4168, 18785, 20635, -4116, 862, -82,
+    -98, 931, -4167, 18706, 20710, -4111, 859, -81,
+    -98, 933, -4167, 18627, 20785, -4106, 855, -80,
+    -99, 935, -4166, 18548, 20859, -4101, 851, -79,
+    -99, 937, -4165, 18469, 20934, -4095, 847, -79,
+    -99, 939, -4163, 18389, 21008, -4090, 843, -78,
+    -100, 940, -4162, 18310, 21082, -4084, 839, -77,
+    -100, 942, -4160, 18230, 21156, -4077, 835, -76,
+    -101, 943, -4158, 18150, 21229, -4071, 831, -75,
+    -101, 945, -4156, 18070, 21303, -4064, 827, -74,
+    -101, 946, -4154, 17990, 21376, -4057, 823, -73,
+    -102, 947, -4152, 17910, 21449, -4050, 818, -72,
+    -102, 949, -4149, 17830, 21522, -4043, 814, -71,
+    -102, 950, -4146, 17750, 21594, -4035, 809, -70,
+    -102, 951, -4143, 17669, 21666, -4027, 805, -69,
+    -103, 952, -4140, 17589, 21739, -4019, 800, -68,
+    -103, 953, -4137, 17508, 21810, -4011, 795, -67,
+    -103, 954, -4133, 17427, 21882, -4002, 791, -66,
+    -104, 955, -4130, 17346, 21954, -3993, 786, -65,
+    -104, 956, -4126, 17265, 22025, -3984, 781, -64,
+    -104, 957, -4122, 17184, 22096, -3975, 776, -62,
+    -104, 957, -4117, 17103, 22167, -3965, 771, -61,
+    -104, 958, -4113, 17022, 22237, -3955, 765, -60,
+    -105, 959, -4108, 16941, 22308, -3945, 760, -59,
+    -105, 959, -4104, 16859, 22378, -3935, 755, -58,
+    -105, 960, -4099, 16778, 22448, -3924, 749, -57,
+    -105, 960, -4093, 16696, 22517, -3914, 744, -55,
+    -105, 961, -4088, 16615, 22586, -3903, 738, -54,
+    -105, 961, -4083, 16533, 22656, -3891, 733, -53,
+    -105, 961, -4077, 16452, 22725, -3880, 727, -52,
+    -106, 961, -4071, 16370, 22793, -3868, 721, -50,
+    -106, 962, -4065, 16288, 22862, -3856, 715, -49,
+    -106, 962, -4059, 16206, 22930, -3843, 709, -48,
+    -106, 962, -4053, 16124, 22998, -3831, 703, -46,
+    -106, 962, -4046, 16042, 23065, -3818, 697, -45,
+    -106, 962, -4040, 15960, 23133, -3805, 691, -43,
+    -106, 962, -4033, 15878, 23200, -3792, 685, -42,
+    -106, 961, -4026, 15795, 23266, -3778, 678, -41,
+    -106, 961, -4019, 15713, 23333, -3764, 672, -39,
+    -106, 961, -4012, 15631, 23399, -3750, 666, -38,
+    -106, 961, -4004, 15549, 23465, -3736, 659, -36,
+    -106, 960, -3997, 15466, 23531, -3721, 652, -35,
+    -106, 960, -3989, 15384, 23597, -3706, 646, -33,
+    -106, 959, -3981, 15301, 23662, -3691, 639, -32,
+    -106, 959, -3973, 15219, 23727, -3675, 632, -30,
+    -106, 958, -3965, 15136, 23792, -3660, 625, -29,
+    -106, 958, -3957, 15054, 23856, -3644, 618, -27,
+    -106, 957, -3948, 14971, 23920, -3627, 611, -25,
+    -106, 956, -3939, 14889, 23984, -3611, 604, -24,
+    -106, 956, -3931, 14806, 24047, -3594, 597, -22,
+    -106, 955, -3922, 14723, 24111, -3577, 589, -20,
+    -105, 954, -3913, 14641, 24174, -3560, 582, -19,
+    -105, 953, -3903, 14558, 24236, -3542, 574, -17,
+    -105, 952, -3894, 14475, 24299, -3524, 567, -15,
+    -105, 951, -3885, 14392, 24361, -3506, 559, -14,
+    -105, 950, -3875, 14310, 24423, -3488, 551, -12,
+    -105, 949, -3865, 14227, 24484, -3469, 544, -10,
+    -105, 948, -3855, 14144, 24545, -3450, 536, -8,
+    -104, 947, -3845, 14061, 24606, -3431, 528, -6,
+    -104, 945, -3835, 13979, 24667, -3412, 520, -5,
+    -104, 944, -3825, 13896, 24727, -3392, 511, -3,
+    -104, 943, -3815, 13813, 24787, -3372, 503, -1,
+    -104, 941, -3804, 13730, 24847, -3352, 495, 1,
+    -104, 940, -3793, 13648, 24906, -3331, 487, 3,
+    -103, 939, -3782, 13565, 24965, -3310, 478, 5,
+    -103, 937, -3772, 13482, 25024, -3289, 470, 7,
+    -103, 936, -3760, 13400, 25082, -3268, 461, 9,
+    -103, 934, -3749, 13317, 25140, -3246, 452, 11,
+    -102, 932, -3738, 13234, 25198, -3224, 444, 13,
+    -102, 931, -3727, 13152, 25256, -3202, 435, 15,
+    -102, 929, -3715, 13069, 25313, -3180, 426, 17,
+    -102, 927, -3703, 12986, 25369, -3157, 417, 19,
+    -101, 926, -3692, 12904, 25426, -3134, 408, 21,
+    -101, 924, -3680, 12821, 25482, -3110, 399, 23,
+    -101, 922, -3668, 12739, 25538, -3087, 390, 25,
+    -101, 920, -3656, 12656, 25593, -3063, 380, 27,
+    -100, 918, -3643, 12574, 25648, -3039, 371, 29,
+    -100, 916, -3631, 12491, 25703, -3014, 361, 31,
+    -100, 914, -3619, 12409, 25758, -2989, 352, 34,
+    -99, 912, -3606, 12326, 25812, -2964, 342, 36,
+    -99, 910, -3593, 12244, 25866, -2939, 333, 38,
+    -99, 908, -3581, 12162, 25919, -2914, 323, 40,
+    -98, 906, -3568, 12080, 25972, -2888, 313, 43,
+    -98, 903, -3555, 11998, 26025, -2861, 303, 45,
+    -98, 901, -3542, 11915, 26077, -2835, 293, 47,
+    -97, 899, -3528, 11833, 26129, -2808, 283, 49,
+    -97, 897, -3515, 11751, 26181, -2781, 273, 52,
+    -97, 894, -3502, 11669, 26232, -2754, 263, 54,
+    -96, 892, -3488, 11588, 26283, -2726, 252, 56,
+    -96, 889, -3475, 11506, 26334, -2698, 242, 59,
+    -96, 887, -3461, 11424, 26384, -2670, 231, 61,
+    -95, 885, -3447, 11342, 26434, -2642, 221, 64,
+    -95, 882, -3433, 11261, 26484, -2613, 210, 66,
+    -94, 879, -3419, 11179, 26533, -2584, 200, 69,
+    -94, 877, -3405, 11098, 26582, -2555, 189, 71,
+    -94, 874, -3391, 11016, 26630, -2525, 178, 74,
+    -93, 872, -3377, 10935, 26678, -2495, 167, 76,
+    -93, 869, -3362, 10854, 26726, -2465, 156, 79,
+    -92, 866, -3348, 10772, 26773, -2435, 145, 81,
+    -92, 864, -3334, 10691, 26820, -2404, 134, 84,
+    -92, 861, -3319, 10610, 26867, -2373, 122, 86,
+    -91, 858, -3304, 10529, 26913, -2341, 111, 89,
+    -91, 855, -3290, 10449, 26959, -2310, 100, 92,
+    -90, 852, -3275, 10368, 27005, -2278, 88, 94,
+    -90, 849, -3260, 10287, 27050, -2246, 77, 97,
+    -89, 847, -3245, 10207, 27095, -2213, 65, 100,
+    -89, 844, -3230, 10126, 27139, -2180, 53, 102,
+    -89, 841, -3215, 10046, 27183, -2147, 42, 105,
+    -88, 838, -3199, 9966, 27226, -2114, 30, 108,
+    -88, 835, -3184, 9885, 27270, -2080, 18, 111,
+    -87, 832, -3169, 9805, 27312, -2046, 6, 113,
+    -87, 829, -3153, 9725, 27355, -2012, -6, 116,
+    -86, 826, -3138, 9645, 27397, -1977, -18, 119,
+    -86, 822, -3122, 9566, 27439, -1942, -30, 122,
+    -85, 819, -3107, 9486, 27480, -1907, -43, 125,
+    -85, 816, -3091, 9407, 27521, -1872, -55, 127,
+    -84, 813, -3075, 9327, 27561, -1836, -67, 130,
+    -84, 810, -3059, 9248, 27601, -1800, -80, 133,
+    -83, 806, -3043, 9169, 27641, -1764, -92, 136,
+    -83, 803, -3028, 9090, 27680, -1727, -105, 139,
+    -82, 800, -3012, 9011, 27719, -1690, -118, 142,
+    -82, 797, -2995, 8932, 27758, -1653, -131, 145,
+    -81, 793, -2979, 8853, 27796, -1616, -143, 148,
+    -81, 790, -2963, 8775, 27833, -1578, -156, 151,
+    -80, 787, -2947, 8696, 27871, -1540, -169, 154,
+    -80, 783, -2931, 8618, 27907, -1502, -182, 157,
+    -79, 780, -2914, 8540, 27944, -1463, -196, 160,
+    -79, 776, -2898, 8462, 27980, -1424, -209, 163,
+    -78, 773, -2881, 8384, 28016, -1385, -222, 166,
+    -78, 769, -2865, 8306, 28051, -1345, -235, 169,
+    -77, 766, -2848, 8229, 28086, -1305, -249, 172,
+    -77, 762, -2832, 8151, 28120, -1265, -262, 176,
+    -76, 759, -2815, 8074, 28154, -1225, -276, 179,
+    -76, 755, -2798, 7997, 28188, -1184, -289, 182,
+    -75, 752, -2781, 7920, 28221, -1143, -303, 185,
+    -75, 748, -2765, 7843, 28254, -1102, -317, 188,
+    -74, 745, -2748, 7766, 28286, -1060, -331, 192,
+    -74, 741, -2731, 7690, 28318, -1018, -344, 195,
+    -73, 737, -2714, 7613, 28349, -976, -358, 198,
+    -73, 734, -2697, 7537, 28380, -934, -372, 201,
+    -72, 730, -2680, 7461, 28411, -891, -386, 205,
+    -72, 726, -2663, 7385, 28441, -848, -401, 208,
+    -71, 723, -2646, 7309, 28471, -805, -415, 211,
+    -71, 719, -2629, 7233, 28500, -761, -429, 215,
+    -70, 715, -2612, 7158, 28529, -717, -443, 218,
+    -70, 712, -2594, 7083, 28558, -673, -458, 221,
+    -69, 708, -2577, 7008, 28586, -629, -472, 225,
+    -69, 704, -2560, 6933, 28614, -584, -487, 228,
+    -68, 700, -2543, 6858, 28641, -539, -501, 231,
+    -67, 696, -2525, 6783, 28668, -493, -516, 235,
+    -67, 693, -2508, 6709, 28694, -448, -531, 238,
+    -66, 689, -2491, 6634, 28720, -402, -545, 242,
+    -66, 685, -2473, 6560, 28746, -356, -560, 245,
+    -65, 681, -2456, 6486, 28771, -309, -575, 249,
+    -65, 677, -2438, 6413, 28795, -262, -590, 252,
+    -64, 674, -2421, 6339, 28820, -215, -605, 256,
+    -64, 670, -2404, 6266, 28843, -168, -620, 259,
+    -63, 666, -2386, 6193, 28867, -120, -635, 263,
+    -63, 662, -2369, 6120, 28890, -72, -650, 266,
+    -62, 658, -2351, 6047, 28912, -24, -666, 270,
+    -62, 654, -2333, 5974, 28934, 24, -681, 273,
+    -61, 650, -2316, 5902, 28956, 73, -696, 277,
+    -60, 646, -2298, 5830, 28977, 122, -712, 281,
+    -60, 642, -2281, 5758, 28998, 171, -727, 284,
+    -59, 638, -2263, 5686, 29018, 221, -743, 288,
+    -59, 634, -2245, 5614, 29038, 271, -758, 291,
+    -58, 630, -2228, 5543, 29057, 321, -774, 295,
+    -58, 626, -2210, 5471, 29076, 372, -789, 299,
+    -57, 623, -2192, 5400, 29095, 422, -805, 302,
+    -57, 619, -2175, 5329, 29113, 474, -821, 306,
+    -56, 615, -2157, 5259, 29130, 525, -837, 310,
+    -56, 611, -2139, 5188, 29148, 576, -853, 313,
+    -55, 607, -2122, 5118, 29164, 628, -869, 317,
+    -55, 603, -2104, 5048, 29181, 680, -885, 321,
+    -54, 599, -2086, 4978, 29197, 733, -901, 325,
+    -54, 595, -2068, 4909, 29212, 786, -917, 328,
+    -53, 591, -2051, 4839, 29227, 839, -933, 332,
+    -53, 586, -2033, 4770, 29241, 892, -949, 336,
+    -52, 582, -2015, 4701, 29255, 945, -965, 340,
+    -51, 578, -1998, 4632, 29269, 999, -981, 344,
+    -51, 574, -1980, 4564, 29282, 1053, -998, 347,
+    -50, 570, -1962, 4496, 29295, 1108, -1014, 351,
+    -50, 566, -1944, 4427, 29307, 1162, -1030, 355,
+    -49, 562, -1927, 4360, 29319, 1217, -1047, 359,
+    -49, 558, -1909, 4292, 29330, 1272, -1063, 363,
+    -48, 554, -1891, 4225, 29341, 1328, -1080, 367,
+    -48, 550, -1873, 4157, 29352, 1384, -1096, 370,
+    -47, 546, -1856, 4090, 29362, 1440, -1113, 374,
+    -47, 542, -1838, 4024, 29371, 1496, -1130, 378,
+    -46, 538, -1820, 3957, 29380, 1552, -1146, 382,
+    -46, 534, -1803, 3891, 29389, 1609, -1163, 386,
+    -45, 530, -1785, 3825, 29397, 1666, -1180, 390,
+    -45, 526, -1767, 3759, 29405, 1724, -1197, 394,
+    -44, 522, -1750, 3693, 29412, 1781, -1213, 398,
+    -44, 518, -1732, 3628, 29419, 1839, -1230, 402,
+    -43, 514, -1715, 3563, 29425, 1897, -1247, 406,
+    -43, 510, -1697, 3498, 29431, 1956, -1264, 409,
+    -42, 506, -1679, 3433, 29437, 2014, -1281, 413,
+    -42, 502, -1662, 3369, 29442, 2073, -1298, 417,
+    -41, 498, -1644, 3305, 29446, 2132, -1315, 421,
+    -41, 493, -1627, 3241, 29450, 2192, -1332, 425,
+    -40, 489, -1609, 3177, 29454, 2251, -1349, 429,
+    -40, 485, -1592, 3114, 29457, 2311, -1366, 433,
+    -39, 481, -1574, 3050, 29460, 2372, -1384, 437,
+    -39, 477, -1557, 2987, 29462, 2432, -1401, 441,
+    -38, 473, -1539, 2925, 29464, 2493, -1418, 445,
+    -38, 469, -1522, 2862, 29465, 2554, -1435, 449,
+    -37, 465, -1505, 2800, 29466, 2615, -1453, 453,
+    -37, 461, -1487, 2738, 29467, 2676, -1470, 457,
+};
+
+/* L=2, 16 taps/phase, Kaiser beta=7.0, cutoff=0.90*pi/L */
+const int16_t rs_coeffs_2[2 * 16] = {
+    27, -117, 279, -447, 413, 275, -2934, 27004, 11502, -4903, 2483, -1150, 435, -117, 15, 1,
+    1, 15, -117, 435, -1150, 2483, -4903, 11502, 27004, -2934, 275, 413, -447, 279, -117, 27,
+};
@@ -0,0 +1,235 @@
+#!/usr/bin/env python3
+"""
+Encode a sound clip as an embedded IMA-ADPCM asset for audio_adpcm.c.
+
+Accepted inputs:
+  *.wav  16-bit PCM WAV (any channel count, downmixed to mono)
+  *.mp3  anything else ffmpeg can read (needs ffmpeg on PATH)
+  *.c    a legacy embedded clip: the first int16_t array in the file, also
+         as <rev>:<path>.c to read it from git history
+
+The output is a C source with the encoded blocks and an
+audio_adpcm_clip_t descriptor named <symbol>_adpcm, ready to be passed to
+MOCHI_SOUND_EMBEDDED_ADPCM() / Audio_Play_ADPCM(). Blocks use the mono
+IMA-ADPCM WAV layout, so flash use is about a quarter of 16-bit PCM.
+
+The header comment records the source and the command, run from
+components/audio_play.
+
+Usage:
+  python3 tools/gen_adpcm_asset.py ../../main/assets/music/is_braking.mp3 \\
+      sound_braking --brief "Braking/caught sound" \\
+      > ../app_mibuddy/sound_braking.c
+  python3 tools/gen_adpcm_asset.py 37a0295:components/app_mibuddy/sound_braking.c \\
+      sound_braking --brief "Braking/caught sound" \\
+      > ../app_mibuddy/sound_braking.c
+"""
+import argparse
+import math
+import os
+import re
+import shlex
+import struct
+import subprocess
+import sys
+import wave
+
+BLOCK_ALIGN = 256
+HEADER = 4
+
+STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+]
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8]
+
+
+def clamp(v, lo, hi):
+    return lo if v < lo else hi if v > hi else v
+
+
+# ---------------------------------------------------------------------------
+# Input
+# ---------------------------------------------------------------------------
+
+def read_wav(path):
+    with wave.open(path, "rb") as w:
+        if w.getsampwidth() != 2:
+            sys.exit(f"{path}: only 16-bit PCM WAV is supported (use ffmpeg)")
+        ch = w.getnchannels()
+        rate = w.getframerate()
+        raw = w.readframes(w.getnframes())
+    pcm = struct.unpack(f"<{len(raw) // 2}h", raw)
+    if ch > 1:
+        pcm = [sum(pcm[i:i + ch]) // ch for i in range(0, len(pcm), ch)]
+    return list(pcm), rate
+
+
+def read_ffmpeg(path, rate):
+    cmd = ["ffmpeg", "-v", "error", "-i", path, "-f", "s16le",
+           "-acodec", "pcm_s16le", "-ac", "1", "-ar", str(rate), "-"]
+    try:
+        raw = subprocess.run(cmd, check=True, stdout=subprocess.PIPE).stdout
+    except FileNotFoundError:
+        sys.exit("ffmpeg not found - convert to WAV first")
+    return list(struct.unpack(f"<{len(raw) // 2}h", raw)), rate
+
+
+def read_c_text(path):
+    """File contents, or <rev>:<path> from git history"""
+    if not os.path.exists(path) and ":" in path:
+        try:
+            return subprocess.run(["git", "show", path], check=True,
+                                  stdout=subprocess.PIPE, text=True).stdout
+        except (FileNotFoundError, subprocess.CalledProcessError):
+            sys.exit(f"{path}: not a file or git object")
+    return open(path).read()
+
+
+def read_c_array(path, text):
+    m = re.search(r"int16_t\s+\w+\s*\[\s*\]\s*=\s*\{(.*?)\};", text, re.S)
+    if not m:
+        sys.exit(f"{path}: no int16_t array found")
+    body = re.sub(r"//[^\n]*|/\*.*?\*/", "", m.group(1), flags=re.S)
+    pcm = [int(v) for v in re.findall(r"-?\d+", body)]
+    rate = re.search(r"sample_rate\s*=\s*(\d+)", text)
+    return pcm, int(rate.group(1)) if rate else None
+
+
+# ---------------------------------------------------------------------------
+# Encoder
+# ---------------------------------------------------------------------------
+
+def encode_sample(sample, pred, index):
+    step = STEP_TABLE[index]
+    diff = sample - pred
+    code = 0
+    if diff < 0:
+        code = 8
+        diff = -diff
+    vpdiff = step >> 3
+    if diff >= step:
+        code |= 4
+        diff -= step
+        vpdiff += step
+    if diff >= step >> 1:
+        code |= 2
+        diff -= step >> 1
+        vpdiff += step >> 1
+    if diff >= step >> 2:
+        code |= 1
+        vpdiff += step >> 2
+    pred = clamp(pred - vpdiff if code & 8 else pred + vpdiff, -32768, 32767)
+    index = clamp(index + INDEX_TABLE[code], 0, 88)
+    return code, pred, index
+
+
+def encode(pcm):
+    per_block = (BLOCK_ALIGN - HEADER) * 2 + 1
+    out = bytearray()
+    index = 0
+    decoded = []
+    for start in range(0, len(pcm), per_block):
+        block = pcm[start:start + per_block]
+        pred = block[0]
+        out += struct.pack("<hBB", pred, index, 0)
+        decoded.append(pred)
+        codes = []
+        for s in block[1:]:
+            code, pred, index = encode_sample(s, pred, index)
+            codes.append(code)
+            decoded.append(pred)
+        if len(codes) & 1:
+            codes.append(0)
+        for i in range(0, len(codes), 2):
+            out.append(codes[i] | (codes[i + 1] << 4))
+    return bytes(out), decoded
+
+
+def snr_db(ref, dec):
+    sig = sum(s * s for s in ref) or 1
+    err = sum((a - b) ** 2 for a, b in zip(ref, dec)) or 1
+    return 10.0 * math.log10(sig / err)
+
+
+# ---------------------------------------------------------------------------
+# Output
+# ---------------------------------------------------------------------------
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("input")
+    ap.add_argument("symbol", help="C symbol prefix, e.g. sound_braking")
+    ap.add_argument("--rate", type=int, default=16000,
+                    help="target rate for ffmpeg inputs (default 16000)")
+    ap.add_argument("--brief", default="Embedded audio")
+    ap.add_argument("--origin", help="source name for the header comment "
+                    "(defaults to the input file name)")
+    args = ap.parse_args()
+
+    ext = os.path.splitext(args.input)[1].lower()
+    source = f"from {args.origin or os.path.basename(args.input)}"
+    if ext == ".wav":
+        pcm, rate = read_wav(args.input)
+    elif ext == ".c":
+        text = read_c_text(args.input)
+        pcm, rate = read_c_array(args.input, text)
+        rate = rate or args.rate
+        # A legacy clip names the recording it was converted from
+        first = re.search(r"Converted from (\S+)", text)
+        source = f"from the 16-bit PCM array in\n * {args.origin or args.input}"
+        if first:
+            source += f" (converted from {first.group(1)})"
+    else:
+        pcm, rate = read_ffmpeg(args.input, args.rate)
+    if not pcm:
+        sys.exit(f"{args.input}: no samples")
+
+    data, decoded = encode(pcm)
+    sym = args.symbol
+    cmd = ["python3", "tools/gen_adpcm_asset.py", args.input, sym]
+    opts = ["--brief", args.brief]
+    if ext not in (".wav", ".c") and args.rate != 16000:
+        opts += ["--rate", str(args.rate)]
+    if args.origin:
+        opts += ["--origin", args.origin]
+    o = sys.stdout
+    o.write("/**\n")
+    o.write(f" * @file {sym}.c\n")
+    o.write(f" * @brief Embedded audio - \"{args.brief}\" (IMA-ADPCM)\n")
+    o.write(" *\n")
+    o.write(f" * Generated by tools/gen_adpcm_asset.py {source}\n")
+    o.write(f" * Sample rate: {rate} Hz\n")
+    o.write(" * Channels: 1 (mono)\n")
+    o.write(f" * Format: IMA-ADPCM, {BLOCK_ALIGN}-byte blocks\n")
+    o.write(f" * Duration: ~{len(pcm) / rate:.1f} seconds\n")
+    o.write(f" * Size: {len(data)} bytes (16-bit PCM: {len(pcm) * 2} bytes)\n")
+    o.write(f" * SNR vs source: {snr_db(pcm, decoded):.1f} dB\n")
+    o.write(" *\n")
+    o.write(" * Command (in components/audio_play):\n")
+    o.write(f" *   {shlex.join(cmd)} \\\n")
+    o.write(f" *       {shlex.join(opts)} > ../app_mibuddy/{sym}.c\n")
+    o.write(" */\n\n")
+    o.write("#include <stddef.h>\n#include <stdint.h>\n#include \"audio_adpcm.h\"\n\n")
+    o.write(f"static const uint8_t {sym}_data[] = {{\n")
+    for i in range(0, len(data), 16):
+        o.write("    " + ", ".join(f"0x{b:02x}" for b in data[i:i + 16]) + ",\n")
+    o.write("};\n\n")
+    o.write(f"const audio_adpcm_clip_t {sym}_adpcm = {{\n")
+    o.write(f"    .data = {sym}_data,\n")
+    o.write(f"    .data_len = sizeof({sym}_data),\n")
+    o.write(f"    .samples = {len(pcm)},\n")
+    o.write(f"    .sample_rate = {rate},\n")
+    o.write(f"    .block_align = {BLOCK_ALIGN},\n")
+    o.write("};\n")
+
+
+if __name__ == "__main__":
+    main()
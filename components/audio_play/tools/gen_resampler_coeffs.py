@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""
+Generate Q15 polyphase FIR tables for audio_resampler.c.
+
+Each table is a Kaiser-windowed sinc low-pass prototype of length
+PHASES * TAPS, cut at the source Nyquist, split into PHASES sub-filters
+of TAPS taps and scaled by PHASES (interpolation gain). Taps are stored
+oldest-sample-first so the resampler can run a plain dot product over
+its delay line.
+
+Usage: python3 tools/gen_resampler_coeffs.py > resampler_coeffs.c
+"""
+import math
+
+# (name, phases L, taps per phase, Kaiser beta, cutoff as fraction of pi/L)
+TABLES = [
+    ("rs_coeffs_441", 441, 8, 6.0, 0.90),   # 8k/16k -> 44.1k (L = 441)
+    ("rs_coeffs_2", 2, 16, 7.0, 0.90),      # 22.05k -> 44.1k (L = 2)
+]
+
+
+def bessel_i0(x):
+    s, t, k = 1.0, 1.0, 1
+    while t > 1e-12 * s:
+        t *= (x / (2.0 * k)) ** 2
+        s += t
+        k += 1
+    return s
+
+
+def design(phases, taps, beta, cutoff):
+    n = phases * taps
+    fc = cutoff / phases            # normalised to the upsampled Nyquist
+    mid = (n - 1) / 2.0
+    h = []
+    for i in range(n):
+        x = i - mid
+        sinc = fc if x == 0 else math.sin(math.pi * fc * x) / (math.pi * x)
+        w = bessel_i0(beta * math.sqrt(1.0 - (2.0 * x / (n - 1)) ** 2)) / bessel_i0(beta)
+        h.append(sinc * w)
+    # Unity DC gain per phase after the *phases interpolation gain
+    total = sum(h)
+    h = [v * phases / total for v in h]
+
+    table = []
+    worst_l1 = 0.0
+    for p in range(phases):
+        row = [0] * taps
+        for k in range(taps):
+            # h[p + k*L] applies to x[i - k]; delay line is oldest first
+            row[taps - 1 - k] = h[p + k * phases]
+        worst_l1 = max(worst_l1, sum(abs(v) for v in row))
+        table.append([max(-32768, min(32767, int(round(v * 32768)))) for v in row])
+    # The resampler accumulates in int32: sum|c| * 32768 * 32768 must fit
+    assert worst_l1 < 1.99, "phase L1 norm %.3f would overflow int32" % worst_l1
+    return table
+
+
+def main():
+    print("/**")
+    print(" * @file resampler_coeffs.c")
+    print(" * @brief Q15 polyphase FIR tables for audio_resampler.c")
+    print(" *")
+    print(" * GENERATED by tools/gen_resampler_coeffs.py - do not edit by hand.")
+    print(" */")
+    print()
+    print('#include "audio_resampler.h"')
+    for name, phases, taps, beta, cutoff in TABLES:
+        table = design(phases, taps, beta, cutoff)
+        print()
+        print("/* L=%d, %d taps/phase, Kaiser beta=%.1f, cutoff=%.2f*pi/L */" % (phases, taps, beta, cutoff))
+        print("const int16_t %s[%d * %d] = {" % (name, phases, taps))
+        for row in table:
+            print("    " + ", ".join("%d" % v for v in row) + ",")
+        print("};")
+
+
+if __name__ == "__main__":
+    main()
@@ -5,6 +5,11 @@
 #include "esp_codec_dev.h"
 #include "esp_codec_dev_defaults.h"
 #include "esp_codec_dev_os.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <string.h>
 
 static const char *TAG = "bsp codec";
 
@@ -26,6 +31,22 @@ static audio_codec_gpio_if_t *play_gpio_if    = NULL;
 static audio_codec_if_t *play_codec_if        = NULL;
 static esp_codec_dev_handle_t play_dev        = NULL;
 
+//16->32 bit staging (allocated once in bsp_codec_dac_init)
+//esp_codec_dev_write() copies into the I2S DMA descriptors before it returns,
+//so one buffer is free again for the next slice - a second gives no overlap
+#define PLAY_STAGE_IN_BYTES     4096                        // 16-bit input bytes per slice
+#define PLAY_STAGE_OUT_BYTES    (PLAY_STAGE_IN_BYTES * 2)   // 32-bit output bytes per slice
+static int32_t *play_stage = NULL;
+static SemaphoreHandle_t play_lock = NULL;                  // esp_audio_play is called from several tasks
+static esp_audio_play_stats_t play_stats = {0};
+
+//es8311 power shadow - lets esp_audio_set_power() skip registers that already hold the value
+#define ES8311_DAC_MUTE_REG     0x31                        // DAC_REG31, bits 5-6 mute the DAC
+#define ES8311_DAC_MUTE_BITS    0x60
+static bool play_suspended = false;                         // codec_if->enable(false) issued
+static int play_mute_reg = -1;                              // Cached DAC_REG31, -1 = not read yet
+static int play_vol_shadow = -1;                            // Volume last written, -1 = unknown
+
 static i2s_chan_handle_t            tx_handle = NULL;        // I2S tx channel handler
 static i2s_chan_handle_t            rx_handle = NULL; 
 static i2c_master_bus_handle_t      i2c_bus= NULL;
@@ -116,6 +137,22 @@ esp_err_t bsp_codec_dac_init(int sample_rate, int channel_format, int bits_per_c
     };
     esp_codec_dev_set_out_vol(play_dev, PLAYER_VOLUME);
     esp_codec_dev_open(play_dev, &fs);
+    play_suspended = false;
+    play_mute_reg = -1;
+    play_vol_shadow = -1;
+
+    // Staging buffers live for the lifetime of the codec - no heap traffic per write
+    if (play_lock == NULL) {
+        play_lock = xSemaphoreCreateMutex();
+    }
+    if (play_stage == NULL) {
+        play_stage = heap_caps_aligned_alloc(4, PLAY_STAGE_OUT_BYTES,
+                                             MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    }
+    if (play_stage == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate play staging buffer");
+        ret_val = ESP_ERR_NO_MEM;
+    }
 
     return ret_val;
 }
@@ -184,6 +221,11 @@ static esp_err_t bsp_codec_dac_deinit()
         play_data_if = NULL;
     }
 
+    if (play_stage) {
+        heap_caps_free(play_stage);
+        play_stage = NULL;
+    }
+
     return ret_val;
 }
 
@@ -194,6 +236,7 @@ esp_err_t esp_audio_set_play_vol(int volume)
         return ESP_FAIL;
     }
     esp_codec_dev_set_out_vol(play_dev, volume);
+    play_vol_shadow = volume;
     return ESP_OK;
 }
 
@@ -243,6 +286,7 @@ esp_err_t esp_audio_unmute(void)
     }
     int ret = esp_codec_dev_set_out_mute(play_dev, false);
     ESP_LOGI(TAG, "Codec unmuted, ret=%d", ret);
+    play_mute_reg = -1;
     return (ret == 0) ? ESP_OK : ESP_FAIL;
 }
 
@@ -269,64 +313,268 @@ esp_err_t esp_audio_prepare_for_pcm(void)
     /* Unmute the DAC output */
     ret = esp_codec_dev_set_out_mute(play_dev, false);
     ESP_LOGI(TAG, "Codec unmuted: ret=%d", ret);
+    play_vol_shadow = PLAYER_VOLUME;
+    play_mute_reg = -1;
 
     return ESP_OK;
 }
 
+/**
+ * @brief Move the ES8311 to a power level and volume in one batch
+ *
+ * The register writes of a transition are issued back to back, and any
+ * register the codec already holds (volume, mute) is skipped: a standby
+ * <-> on switch is a single DAC_REG31 write instead of set_out_vol plus
+ * set_out_mute's read-modify-write.
+ *
+ * OFF suspends the codec (analog and clocks down). Suspend clears the
+ * volume register, so it is rewritten on the way back up; the cached mute
+ * register survives.
+ */
+esp_err_t esp_audio_set_power(esp_audio_power_t level, int volume)
+{
+    int ret = 0;
+    if (!play_dev || !play_codec_if) {
+        ESP_LOGE(TAG, "esp_audio_set_power: play_dev is NULL!");
+        return ESP_FAIL;
+    }
+
+    if (level == ESP_AUDIO_POWER_OFF) {
+        if (!play_suspended) {
+            ret = play_codec_if->enable(play_codec_if, false);
+            play_suspended = true;
+            play_vol_shadow = -1;
+        }
+        return ret == 0 ? ESP_OK : ESP_FAIL;
+    }
+
+    if (play_suspended) {
+        ret |= play_codec_if->enable(play_codec_if, true);
+        play_suspended = false;
+    }
+    if (volume != play_vol_shadow) {
+        ret |= esp_codec_dev_set_out_vol(play_dev, volume);
+        play_vol_shadow = volume;
+    }
+    if (play_mute_reg < 0) {
+        int regv = 0;
+        ret |= play_codec_if->get_reg(play_codec_if, ES8311_DAC_MUTE_REG, &regv);
+        play_mute_reg = regv;
+        play_mute_reg ^= ES8311_DAC_MUTE_BITS;      // Force the first write below
+    }
+    int mute_reg = play_mute_reg & ~ES8311_DAC_MUTE_BITS;
+    if (level == ESP_AUDIO_POWER_STANDBY) {
+        mute_reg |= ES8311_DAC_MUTE_BITS;
+    }
+    if (mute_reg != play_mute_reg) {
+        ret |= play_codec_if->set_reg(play_codec_if, ES8311_DAC_MUTE_REG, mute_reg);
+        play_mute_reg = mute_reg;
+    }
+    return ret == 0 ? ESP_OK : ESP_FAIL;
+}
+
 /* Track first call for logging */
 static bool s_first_audio_play = true;
 
+/**
+ * @brief Widen 16-bit PCM to left-justified 32-bit I2S words
+ *
+ * Reads two samples per 32-bit load and emits both halves with a shift and
+ * a mask, unrolled four words (eight samples) per iteration. Falls back to
+ * a scalar loop for an unaligned source and for the tail.
+ *
+ * @param out Destination, 4-byte aligned, room for @p samples words
+ * @param in Source 16-bit samples
+ * @param samples Number of 16-bit samples
+ */
+static inline void widen_16_to_32(int32_t *out, const int16_t *in, int samples)
+{
+    int i = 0;
+
+    if (((uintptr_t)in & 3) == 0) {
+        const uint32_t *w = (const uint32_t *)in;
+        uint32_t *o = (uint32_t *)out;
+        int words = samples / 2;
+        int j = 0;
+
+        for (; j + 4 <= words; j += 4) {
+            uint32_t w0 = w[j], w1 = w[j + 1], w2 = w[j + 2], w3 = w[j + 3];
+            o[0] = w0 << 16;  o[1] = w0 & 0xFFFF0000u;
+            o[2] = w1 << 16;  o[3] = w1 & 0xFFFF0000u;
+            o[4] = w2 << 16;  o[5] = w2 & 0xFFFF0000u;
+            o[6] = w3 << 16;  o[7] = w3 & 0xFFFF0000u;
+            o += 8;
+        }
+        for (; j < words; j++) {
+            uint32_t w0 = w[j];
+            o[0] = w0 << 16;  o[1] = w0 & 0xFFFF0000u;
+            o += 2;
+        }
+        i = words * 2;
+    }
+
+    for (; i < samples; i++) {
+        out[i] = (int32_t)((uint32_t)(uint16_t)in[i] << 16);
+    }
+}
+
 esp_err_t esp_audio_play(const int16_t* data, int length, uint32_t ticks_to_wait)
 {
-    size_t bytes_write = 0;
     esp_err_t ret = ESP_OK;
     if (!play_dev) {
         ESP_LOGE(TAG, "esp_audio_play: play_dev is NULL!");
         return ESP_FAIL;
     }
 
-    int out_length = length;
-
-    /* Convert 16-bit samples to 32-bit for I2S output */
-    int *data_out = NULL;
-    if (s_bits_per_chan == 32) {
-        out_length = length * 2;
-        data_out = malloc(out_length);
-        if (data_out == NULL) {
-            ESP_LOGE(TAG, "Failed to allocate audio buffer");
-            return ESP_FAIL;
-        }
-        for (int i = 0; i < length / sizeof(int16_t); i++) {
-            data_out[i] = ((int)data[i]) << 16;
-        }
-        /* Log first converted sample for debugging */
-        if (s_first_audio_play && length >= 8) {
-            ESP_LOGI(TAG, "32-bit conv: in[0-3]=%d,%d,%d,%d -> out[0-3]=0x%08X,0x%08X,0x%08X,0x%08X",
-                     data[0], data[1], data[2], data[3],
-                     data_out[0], data_out[1], data_out[2], data_out[3]);
-            ESP_LOGI(TAG, "in_len=%d bytes (%d samples), out_len=%d bytes",
-                     length, length / 2, out_length);
+    if (s_bits_per_chan != 32) {
+        ret = esp_codec_dev_write(play_dev, (void *)data, length);
+        if (s_first_audio_play) {
+            ESP_LOGI(TAG, "esp_codec_dev_write (16-bit): len=%d, ret=%d", length, ret);
+            s_first_audio_play = false;
         }
+        return ret;
     }
 
-    if (data_out != NULL) {
-        ret = esp_codec_dev_write(play_dev, (void *)data_out, out_length);
-        if (s_first_audio_play) {
-            ESP_LOGI(TAG, "esp_codec_dev_write: out_len=%d, ret=%d", out_length, ret);
-            s_first_audio_play = false;
+    if (play_lock == NULL || play_stage == NULL) {
+        ESP_LOGE(TAG, "esp_audio_play: staging buffer not allocated");
+        return ESP_FAIL;
+    }
+    if (xSemaphoreTake(play_lock, ticks_to_wait) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    /* Convert 16-bit samples to 32-bit in slices; the driver has copied each
+     * slice into DMA by the time esp_codec_dev_write() returns */
+    const int16_t *src = data;
+    int remaining = length;
+    while (remaining > 0 && ret == ESP_OK) {
+        int in_bytes = remaining > PLAY_STAGE_IN_BYTES ? PLAY_STAGE_IN_BYTES : remaining;
+        int samples = in_bytes / (int)sizeof(int16_t);
+        int out_bytes = samples * (int)sizeof(int32_t);
+        int32_t *stage = play_stage;
+
+        int64_t t0 = esp_timer_get_time();
+        widen_16_to_32(stage, src, samples);
+        int64_t t1 = esp_timer_get_time();
+
+        /* Log first converted sample for debugging */
+        if (s_first_audio_play && samples >= 4) {
+            ESP_LOGI(TAG, "32-bit conv: in[0-3]=%d,%d,%d,%d -> out[0-3]=0x%08lX,0x%08lX,0x%08lX,0x%08lX",
+                     src[0], src[1], src[2], src[3],
+                     (unsigned long)stage[0], (unsigned long)stage[1],
+                     (unsigned long)stage[2], (unsigned long)stage[3]);
         }
-        free(data_out);
-    } else {
-        ret = esp_codec_dev_write(play_dev, (void *)data, length);
+
+        ret = esp_codec_dev_write(play_dev, (void *)stage, out_bytes);
+        int64_t t2 = esp_timer_get_time();
+
         if (s_first_audio_play) {
-            ESP_LOGI(TAG, "esp_codec_dev_write (16-bit): len=%d, ret=%d", length, ret);
+            ESP_LOGI(TAG, "esp_codec_dev_write: out_len=%d, ret=%d", out_bytes, ret);
             s_first_audio_play = false;
         }
+
+        play_stats.bytes_in += (uint64_t)in_bytes;
+        play_stats.bytes_out += (uint64_t)out_bytes;
+        play_stats.convert_us += (uint64_t)(t1 - t0);
+        play_stats.write_us += (uint64_t)(t2 - t1);
+        play_stats.slices++;
+
+        src += samples;
+        remaining -= in_bytes;
     }
+    play_stats.calls++;
 
+    xSemaphoreGive(play_lock);
     return ret;
 }
 
+#if CONFIG_APP_SELF_TEST
+/* Per-sample reference for esp_audio_widen_benchmark() */
+static void widen_16_to_32_scalar(int32_t *out, const int16_t *in, int samples)
+{
+    for (int i = 0; i < samples; i++) {
+        out[i] = (int32_t)((uint32_t)(uint16_t)in[i] << 16);
+    }
+}
+
+esp_err_t esp_audio_widen_benchmark(uint32_t iterations, esp_audio_widen_bench_t *bench)
+{
+    if (bench == NULL || iterations == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(bench, 0, sizeof(*bench));
+
+    const int samples = PLAY_STAGE_IN_BYTES / (int)sizeof(int16_t);
+    int16_t *in = heap_caps_aligned_alloc(4, PLAY_STAGE_IN_BYTES, MALLOC_CAP_INTERNAL);
+    int32_t *out = heap_caps_aligned_alloc(4, PLAY_STAGE_OUT_BYTES, MALLOC_CAP_INTERNAL);
+    int32_t *ref = heap_caps_aligned_alloc(4, PLAY_STAGE_OUT_BYTES, MALLOC_CAP_INTERNAL);
+    if (in == NULL || out == NULL || ref == NULL) {
+        heap_caps_free(in);
+        heap_caps_free(out);
+        heap_caps_free(ref);
+        return ESP_ERR_NO_MEM;
+    }
+
+    uint32_t seed = 1;
+    for (int i = 0; i < samples; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        in[i] = (int16_t)(seed >> 16);
+    }
+
+    int64_t t0 = esp_timer_get_time();
+    for (uint32_t n = 0; n < iterations; n++) {
+        widen_16_to_32_scalar(ref, in, samples);
+    }
+    int64_t t1 = esp_timer_get_time();
+    for (uint32_t n = 0; n < iterations; n++) {
+        widen_16_to_32(out, in, samples);
+    }
+    int64_t t2 = esp_timer_get_time();
+
+    uint64_t total = (uint64_t)iterations * (uint64_t)samples;
+    bench->scalar_ns_per_sample = (uint32_t)((t1 - t0) * 1000 / total);
+    bench->kernel_ns_per_sample = (uint32_t)((t2 - t1) * 1000 / total);
+    bool match = memcmp(out, ref, PLAY_STAGE_OUT_BYTES) == 0;
+
+    /* Unaligned source takes the scalar path and must still match */
+    widen_16_to_32(out, in + 1, samples - 1);
+    widen_16_to_32_scalar(ref, in + 1, samples - 1);
+    match = match && memcmp(out, ref, (samples - 1) * sizeof(int32_t)) == 0;
+
+    heap_caps_free(in);
+    heap_caps_free(out);
+    heap_caps_free(ref);
+
+    ESP_LOGI(TAG, "Widen 16->32: kernel %lu ns/sample, scalar %lu ns/sample, %s",
+             (unsigned long)bench->kernel_ns_per_sample, (unsigned long)bench->scalar_ns_per_sample,
+             match ? "output matches" : "OUTPUT MISMATCH");
+    return match ? ESP_OK : ESP_FAIL;
+}
+#endif /* CONFIG_APP_SELF_TEST */
+
+void esp_audio_get_play_stats(esp_audio_play_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    if (play_lock && xSemaphoreTake(play_lock, portMAX_DELAY) == pdTRUE) {
+        *stats = play_stats;
+        xSemaphoreGive(play_lock);
+    } else {
+        *stats = play_stats;
+    }
+}
+
+void esp_audio_reset_play_stats(void)
+{
+    if (play_lock && xSemaphoreTake(play_lock, portMAX_DELAY) == pdTRUE) {
+        memset(&play_stats, 0, sizeof(play_stats));
+        xSemaphoreGive(play_lock);
+    } else {
+        memset(&play_stats, 0, sizeof(play_stats));
+    }
+}
+
 /**
  * @brief Reset first-call logging flag for esp_audio_play
  */
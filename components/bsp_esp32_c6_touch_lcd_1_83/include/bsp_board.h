@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include "sdkconfig.h"
 #include "esp_err.h"
 #include "esp_lcd_panel_io.h"
 #include "esp_lcd_touch.h"
@@ -93,8 +94,16 @@ extern "C" {
 #define EXAMPLE_LCD_CMD_BITS        (8)                 /**< Command bit width */
 #define EXAMPLE_LCD_PARAM_BITS      (8)                 /**< Parameter bit width */
 #define EXAMPLE_LCD_BITS_PER_PIXEL  (16)                /**< RGB565 color format */
+#ifdef CONFIG_BSP_LCD_DRAW_BUF_DOUBLE
+#define EXAMPLE_LCD_DRAW_BUFF_DOUBLE (1)                /**< Render next stripe during the flush */
+#else
 #define EXAMPLE_LCD_DRAW_BUFF_DOUBLE (0)                /**< Single buffer mode */
-#define EXAMPLE_LCD_DRAW_BUFF_HEIGHT (30)               /**< Draw buffer height (lines) */
+#endif
+#define EXAMPLE_LCD_DRAW_BUFF_COUNT  (EXAMPLE_LCD_DRAW_BUFF_DOUBLE ? 2 : 1)
+#define EXAMPLE_LCD_DRAW_BUFF_FIT    ((CONFIG_BSP_LCD_DRAW_BUF_KB * 1024) / \
+                                      (EXAMPLE_LCD_DRAW_BUFF_COUNT * EXAMPLE_LCD_H_RES * 2))
+#define EXAMPLE_LCD_DRAW_BUFF_HEIGHT (EXAMPLE_LCD_DRAW_BUFF_FIT < EXAMPLE_LCD_V_RES ? \
+                                      EXAMPLE_LCD_DRAW_BUFF_FIT : EXAMPLE_LCD_V_RES) /**< Stripe height (lines) */
 #define EXAMPLE_LCD_BL_ON_LEVEL     (1)                 /**< Backlight on = HIGH */
 #define Backlight_MAX               100                 /**< Maximum backlight value */
 #define DEFAULT_BACKLIGHT           90                  /**< Default backlight (90%) */
@@ -326,15 +335,66 @@ esp_err_t esp_audio_set_play_vol(int volume);
  */
 esp_err_t esp_audio_get_play_vol(int *volume);
 
+/**
+ * @brief esp_audio_play() conversion/write counters
+ */
+typedef struct {
+    uint64_t calls;         /**< esp_audio_play() invocations */
+    uint64_t slices;        /**< Staging-buffer slices written */
+    uint64_t bytes_in;      /**< 16-bit PCM bytes consumed */
+    uint64_t bytes_out;     /**< 32-bit I2S bytes written */
+    uint64_t convert_us;    /**< Time spent widening 16->32 bit */
+    uint64_t write_us;      /**< Time spent in esp_codec_dev_write() */
+} esp_audio_play_stats_t;
+
 /**
  * @brief Play audio data through I2S
+ *
+ * 16-bit samples are widened into a persistent DMA-capable staging buffer
+ * (no per-call allocation). Safe to call from several tasks.
+ *
  * @param data Audio sample buffer (16-bit PCM)
  * @param length Buffer length in bytes
- * @param ticks_to_wait Timeout in ticks
- * @return ESP_OK on success
+ * @param ticks_to_wait Max ticks to wait for another writer to finish
+ * @return ESP_OK on success, ESP_ERR_TIMEOUT if the output was busy
  */
 esp_err_t esp_audio_play(const int16_t* data, int length, uint32_t ticks_to_wait);
 
+/**
+ * @brief Get esp_audio_play() counters
+ * @param[out] stats Snapshot of the counters
+ */
+void esp_audio_get_play_stats(esp_audio_play_stats_t *stats);
+
+/**
+ * @brief Reset esp_audio_play() counters
+ */
+void esp_audio_reset_play_stats(void);
+
+#if CONFIG_APP_SELF_TEST
+/**
+ * @brief Cost of the esp_audio_play() 16->32 bit widen kernel
+ */
+typedef struct {
+    uint32_t kernel_ns_per_sample;  /**< Word-at-a-time unrolled kernel */
+    uint32_t scalar_ns_per_sample;  /**< One sample per iteration */
+} esp_audio_widen_bench_t;
+
+/**
+ * @brief Time the widen kernel against a per-sample loop
+ *
+ * Widens one staging slice (2048 samples) @p iterations times with each
+ * and checks that both produce the same words, for an aligned and an
+ * unaligned source. Temporarily allocates ~20 KB of internal RAM. Built
+ * with CONFIG_APP_SELF_TEST, which runs it once after boot.
+ *
+ * @param iterations Slices per variant (e.g. 200)
+ * @param bench Results
+ * @return ESP_OK, ESP_FAIL if the outputs differ, ESP_ERR_NO_MEM
+ */
+esp_err_t esp_audio_widen_benchmark(uint32_t iterations, esp_audio_widen_bench_t *bench);
+#endif
+
 /**
  * @brief Ensure DAC output is unmuted before playback
  * @return ESP_OK on success
@@ -351,6 +411,27 @@ esp_err_t esp_audio_unmute(void);
  */
 esp_err_t esp_audio_prepare_for_pcm(void);
 
+/**
+ * @brief Output codec (ES8311) power levels
+ */
+typedef enum {
+    ESP_AUDIO_POWER_OFF = 0,    /**< Codec suspended (lowest current) */
+    ESP_AUDIO_POWER_STANDBY,    /**< Codec running, DAC muted */
+    ESP_AUDIO_POWER_ON,         /**< Codec running, DAC unmuted */
+} esp_audio_power_t;
+
+/**
+ * @brief Apply a power level and volume to the output codec in one batch
+ *
+ * Only registers whose value changes are written. The speaker amplifier
+ * pin is not touched.
+ *
+ * @param level Target level
+ * @param volume Volume 0-100 (ignored for ESP_AUDIO_POWER_OFF)
+ * @return ESP_OK, ESP_FAIL if the codec is not initialized or I2C failed
+ */
+esp_err_t esp_audio_set_power(esp_audio_power_t level, int volume);
+
 /**
  * @brief Reset audio play logging flag
  *
@@ -443,6 +524,81 @@ uint32_t get_sdcard_total_size(void);
 uint16_t Folder_retrieval(const char* directory, const char* fileExtension,
                           char File_Name[][MAX_FILE_NAME_SIZE], uint16_t maxFiles);
 
+/*===========================================================================
+ * SPI2 Bus Arbiter API
+ * LCD and SD card share EXAMPLE_LCD_SPI_NUM. Clients take the bus through
+ * the arbiter instead of the LVGL mutex, so SD traffic never blocks LVGL
+ * rendering - only the next LCD flush.
+ *===========================================================================*/
+
+/**
+ * @brief Bus client classes, highest priority first
+ *
+ * When the bus is released it is handed to the oldest waiter of the
+ * highest-priority class that is waiting.
+ */
+typedef enum {
+    BSP_SPI_CLIENT_DISPLAY = 0,     /**< LCD flush (LVGL) */
+    BSP_SPI_CLIENT_AUDIO,           /**< Audio streaming (music read-ahead) */
+    BSP_SPI_CLIENT_FILE,            /**< Bulk file I/O (recorder, loggers, settings) */
+    BSP_SPI_CLIENT_MAX
+} bsp_spi_client_t;
+
+#define BSP_SPI_BUS_WAIT_DEFAULT    UINT32_MAX  /**< Use the class default wait bound */
+#define BSP_SPI_BUS_WAIT_DISPLAY_MS 100         /**< Default wait bound: display */
+#define BSP_SPI_BUS_WAIT_AUDIO_MS   200         /**< Default wait bound: audio */
+#define BSP_SPI_BUS_WAIT_FILE_MS    1000        /**< Default wait bound: bulk file I/O */
+
+/**
+ * @brief Per-client arbiter statistics
+ */
+typedef struct {
+    uint32_t acquisitions;      /**< Successful acquires */
+    uint32_t contended;         /**< Acquires that had to wait */
+    uint32_t timeouts;          /**< Acquires that gave up */
+    uint64_t wait_us;           /**< Total time spent waiting */
+    uint32_t max_wait_us;       /**< Longest wait */
+    uint64_t hold_us;           /**< Total time holding the bus */
+    uint32_t max_hold_us;       /**< Longest hold */
+} bsp_spi_bus_stats_t;
+
+/**
+ * @brief Take exclusive use of the shared SPI bus
+ *
+ * Not recursive. Must not be called from an ISR.
+ *
+ * @param client Caller's priority class
+ * @param timeout_ms Maximum wait, or BSP_SPI_BUS_WAIT_DEFAULT for the class default
+ * @return ESP_OK when owned, ESP_ERR_TIMEOUT if the wait bound expired,
+ *         ESP_ERR_INVALID_ARG for an unknown client
+ */
+esp_err_t bsp_spi_bus_acquire(bsp_spi_client_t client, uint32_t timeout_ms);
+
+/**
+ * @brief Release the shared SPI bus
+ * @param client Class passed to bsp_spi_bus_acquire()
+ */
+void bsp_spi_bus_release(bsp_spi_client_t client);
+
+/**
+ * @brief Release the shared SPI bus from an ISR (e.g. LCD transfer done)
+ * @param client Class passed to bsp_spi_bus_acquire()
+ * @return true if a higher-priority task was woken
+ */
+bool bsp_spi_bus_release_from_isr(bsp_spi_client_t client);
+
+/**
+ * @brief Get arbiter statistics for one client class
+ * @param client Client class
+ * @param[out] stats Snapshot of the counters
+ */
+void bsp_spi_bus_get_stats(bsp_spi_client_t client, bsp_spi_bus_stats_t *stats);
+
+/**
+ * @brief Reset arbiter statistics for all client classes
+ */
+void bsp_spi_bus_reset_stats(void);
+
 /*===========================================================================
  * IMU Driver API (QMI8658)
  *===========================================================================*/
@@ -486,6 +642,56 @@ esp_err_t set_rtc_time(pcf85063a_datetime_t *time);
  */
 esp_err_t lvgl_driver_init(void);
 
+/**
+ * @brief Display pipeline timing
+ *
+ * A frame is one LVGL refresh that redrew something. Render time is CPU
+ * time spent rendering stripes; wait time is rendering blocked on an SPI
+ * transfer (the overlap double buffering recovers); flush time is SPI
+ * transfer time; idle is the gap between frames. Rates are computed over
+ * the last completed one-second window.
+ */
+typedef struct {
+    uint32_t frames;            /**< Frames since reset */
+    uint32_t flushes;           /**< Stripes sent since reset */
+    uint16_t fps_x10;           /**< Frames per second x10, last window */
+    uint8_t cpu_percent;        /**< Render time share of wall time, last window */
+    uint8_t draw_buf_count;     /**< 1 = single, 2 = double buffered */
+    uint16_t draw_buf_lines;    /**< Stripe height */
+    uint32_t last_render_us;    /**< Latest frame: rendering */
+    uint32_t last_wait_us;      /**< Latest frame: blocked on the SPI transfer */
+    uint32_t last_flush_us;     /**< Latest frame: SPI transfers completed */
+    uint32_t last_idle_us;      /**< Gap before the latest frame */
+    uint32_t max_frame_us;      /**< Longest frame (render + wait) */
+    uint64_t render_us;         /**< Totals since reset */
+    uint64_t wait_us;
+    uint64_t flush_us;
+    uint64_t idle_us;
+} bsp_display_perf_t;
+
+/**
+ * @brief Get display pipeline timing
+ * @param[out] perf Snapshot of the counters
+ */
+void bsp_display_get_perf(bsp_display_perf_t *perf);
+
+/**
+ * @brief Reset display pipeline timing
+ */
+void bsp_display_reset_perf(void);
+
+/**
+ * @brief Run the draw tasks queued on @p layer to completion
+ *
+ * For off-screen layers with their own draw buffer that code then reads
+ * or writes pixel by pixel (sprite and background caches). The same loop
+ * as lv_canvas_finish_layer(), without needing a canvas object. Call from
+ * the LVGL task.
+ *
+ * @param layer Layer (NULL is ignored)
+ */
+void bsp_display_finish_layer(lv_layer_t *layer);
+
 /*===========================================================================
  * WiFi API
  *===========================================================================*/
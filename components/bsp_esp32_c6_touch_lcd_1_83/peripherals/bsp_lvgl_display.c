@@ -1,14 +1,235 @@
 #include "bsp_board.h"
 #include "esp_log.h"
 #include "esp_check.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <string.h>
 
 
 static const char *TAG = "bsp lvgl driver";
 
+#define PERF_WINDOW_US      1000000     /* FPS / CPU averaging window */
+#define FLUSH_WAIT_MS       100         /* Re-check bound while waiting for a transfer */
+
 /* LVGL display and touch */
  lv_display_t *lvgl_disp = NULL;
  lv_indev_t *lvgl_touch_indev = NULL;
 
+/* Set while a flush owns the SPI bus (cleared by the transfer-done ISR) */
+static volatile bool s_flush_owns_bus = false;
+
+/* Set from FLUSH_START until the transfer-done ISR; the LVGL task blocks on
+ * s_flush_done_sem instead of spinning in LVGL's default flush wait */
+static volatile bool s_flush_busy = false;
+static SemaphoreHandle_t s_flush_done_sem;
+static StaticSemaphore_t s_flush_done_buf;
+
+/* Pipeline timing (LVGL task and transfer-done ISR) */
+static portMUX_TYPE s_perf_lock = portMUX_INITIALIZER_UNLOCKED;
+static bsp_display_perf_t s_perf;
+static int64_t s_flush_start_us;        /* Current transfer */
+static int64_t s_refr_start_us;         /* Latest REFR_START (layout runs before rendering) */
+static int64_t s_frame_start_us;        /* Start of the frame being rendered, 0 = none */
+static int64_t s_frame_end_us;          /* REFR_READY of the last rendered frame */
+static int64_t s_wait_start_us;
+static uint32_t s_frame_wait_us;
+static uint32_t s_frame_flush_us;       /* Transfers completed since the last frame started */
+static int64_t s_window_start_us;
+static uint32_t s_window_frames;
+static uint64_t s_window_render_us;
+
+/**
+ * @brief LV_EVENT_FLUSH_START - take the SPI bus before the panel transfer
+ *
+ * SD clients go through the same arbiter, so an SD burst can only delay the
+ * next flush, never LVGL rendering. If the bounded wait expires the flush
+ * proceeds anyway (the SPI driver still serialises transactions) and the
+ * timeout is counted in the arbiter stats.
+ */
+static void flush_start_cb(lv_event_t *e)
+{
+    if (bsp_spi_bus_acquire(BSP_SPI_CLIENT_DISPLAY, BSP_SPI_BUS_WAIT_DEFAULT) == ESP_OK) {
+        s_flush_owns_bus = true;
+    }
+    s_flush_start_us = esp_timer_get_time();
+    s_flush_busy = true;
+}
+
+/**
+ * @brief Block the LVGL task until the transfer in flight is done
+ *
+ * Without this LVGL busy-waits on the flushing flag, which keeps the CPU
+ * at 100 % for the whole SPI transfer. A stale give from a transfer
+ * nobody waited for only costs one extra check of s_flush_busy.
+ */
+static void flush_wait_cb(lv_display_t *disp)
+{
+    while (s_flush_busy) {
+        xSemaphoreTake(s_flush_done_sem, pdMS_TO_TICKS(FLUSH_WAIT_MS));
+    }
+}
+
+/**
+ * @brief Panel IO colour transfer done (ISR) - release the bus, then tell LVGL
+ *
+ * Replaces the esp_lvgl_port callback, which only calls lv_display_flush_ready().
+ */
+static IRAM_ATTR bool flush_io_ready_cb(esp_lcd_panel_io_handle_t panel_io,
+                                        esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
+{
+    bool woken = false;
+    if (s_flush_owns_bus) {
+        s_flush_owns_bus = false;
+        woken = bsp_spi_bus_release_from_isr(BSP_SPI_CLIENT_DISPLAY);
+    }
+
+    uint32_t flush_us = (uint32_t)(esp_timer_get_time() - s_flush_start_us);
+    taskENTER_CRITICAL_ISR(&s_perf_lock);
+    s_perf.flushes++;
+    s_perf.flush_us += flush_us;
+    s_frame_flush_us += flush_us;
+    taskEXIT_CRITICAL_ISR(&s_perf_lock);
+
+    lv_display_flush_ready((lv_display_t *)user_ctx);
+    s_flush_busy = false;
+
+    BaseType_t sem_woken = pdFALSE;
+    xSemaphoreGiveFromISR(s_flush_done_sem, &sem_woken);
+    return woken || sem_woken == pdTRUE;
+}
+
+/*===========================================================================
+ * Pipeline Timing
+ *===========================================================================*/
+
+/**
+ * @brief Frame boundaries and flush waits (display events, LVGL task)
+ *
+ * A frame runs from REFR_START to REFR_READY, but only refreshes that
+ * send RENDER_START (something was invalidated) are counted.
+ */
+static void perf_event_cb(lv_event_t *e)
+{
+    int64_t now = esp_timer_get_time();
+
+    switch (lv_event_get_code(e)) {
+    case LV_EVENT_REFR_START:
+        s_refr_start_us = now;
+        break;
+
+    case LV_EVENT_RENDER_START:
+        taskENTER_CRITICAL(&s_perf_lock);
+        if (s_frame_end_us != 0) {
+            s_perf.last_idle_us = (uint32_t)(s_refr_start_us - s_frame_end_us);
+            s_perf.idle_us += s_perf.last_idle_us;
+        }
+        s_perf.last_flush_us = s_frame_flush_us;
+        s_frame_flush_us = 0;
+        taskEXIT_CRITICAL(&s_perf_lock);
+        s_frame_start_us = s_refr_start_us;
+        s_frame_wait_us = 0;
+        break;
+
+    case LV_EVENT_FLUSH_WAIT_START:
+        s_wait_start_us = now;
+        break;
+
+    case LV_EVENT_FLUSH_WAIT_FINISH:
+        if (s_frame_start_us != 0) {
+            s_frame_wait_us += (uint32_t)(now - s_wait_start_us);
+        }
+        break;
+
+    case LV_EVENT_REFR_READY: {
+        if (s_frame_start_us == 0) break;
+
+        uint32_t frame_us = (uint32_t)(now - s_frame_start_us);
+        uint32_t render_us = frame_us - LV_MIN(s_frame_wait_us, frame_us);
+        s_frame_start_us = 0;
+        s_frame_end_us = now;
+
+        taskENTER_CRITICAL(&s_perf_lock);
+        s_perf.frames++;
+        s_perf.last_render_us = render_us;
+        s_perf.last_wait_us = s_frame_wait_us;
+        s_perf.render_us += render_us;
+        s_perf.wait_us += s_frame_wait_us;
+        if (frame_us > s_perf.max_frame_us) s_perf.max_frame_us = frame_us;
+
+        s_window_frames++;
+        s_window_render_us += render_us;
+        int64_t window_us = now - s_window_start_us;
+        if (window_us >= PERF_WINDOW_US) {
+            s_perf.fps_x10 = (uint16_t)((uint64_t)s_window_frames * 10000000 / window_us);
+            s_perf.cpu_percent = (uint8_t)LV_MIN(s_window_render_us * 100 / window_us, 100);
+            s_window_start_us = now;
+            s_window_frames = 0;
+            s_window_render_us = 0;
+        }
+        taskEXIT_CRITICAL(&s_perf_lock);
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+void bsp_display_get_perf(bsp_display_perf_t *perf)
+{
+    if (perf == NULL) {
+        return;
+    }
+    taskENTER_CRITICAL(&s_perf_lock);
+    *perf = s_perf;
+    /* No frame for two windows: the screen is static */
+    if (esp_timer_get_time() - s_window_start_us >= 2 * PERF_WINDOW_US) {
+        perf->fps_x10 = 0;
+        perf->cpu_percent = 0;
+    }
+    taskEXIT_CRITICAL(&s_perf_lock);
+    perf->draw_buf_count = EXAMPLE_LCD_DRAW_BUFF_COUNT;
+    perf->draw_buf_lines = EXAMPLE_LCD_DRAW_BUFF_HEIGHT;
+}
+
+void bsp_display_reset_perf(void)
+{
+    taskENTER_CRITICAL(&s_perf_lock);
+    memset(&s_perf, 0, sizeof(s_perf));
+    s_frame_flush_us = 0;
+    s_window_start_us = esp_timer_get_time();
+    s_window_frames = 0;
+    s_window_render_us = 0;
+    taskEXIT_CRITICAL(&s_perf_lock);
+}
+
+/*===========================================================================
+ * Off-screen Layers
+ *===========================================================================*/
+
+void bsp_display_finish_layer(lv_layer_t *layer)
+{
+    if (layer == NULL) {
+        return;
+    }
+    lv_display_t *disp = lv_display_get_default();
+
+    /* Same loop as lv_canvas_finish_layer() */
+    while (layer->draw_task_head) {
+        lv_draw_dispatch_wait_for_request();
+        if (!lv_draw_dispatch_layer(disp, layer)) {
+            lv_draw_wait_for_finish();
+            lv_draw_dispatch_request();
+        }
+    }
+}
+
+/*===========================================================================
+ * Initialization
+ *===========================================================================*/
+
 esp_err_t lvgl_driver_init(void)
 {
     esp_lcd_panel_io_handle_t lcd_io;
@@ -30,7 +251,8 @@ esp_err_t lvgl_driver_init(void)
     ESP_RETURN_ON_ERROR(lvgl_port_init(&lvgl_cfg), TAG, "LVGL port initialization failed");
 
     /* Add LCD screen */
-    ESP_LOGD(TAG, "Add LCD screen");
+    ESP_LOGI(TAG, "Add LCD screen: %d x %d-line draw buffer(s)",
+             EXAMPLE_LCD_DRAW_BUFF_COUNT, EXAMPLE_LCD_DRAW_BUFF_HEIGHT);
     const lvgl_port_display_cfg_t disp_cfg = {
         .io_handle = lcd_io,
         .panel_handle = lcd_panel,
@@ -54,6 +276,24 @@ esp_err_t lvgl_driver_init(void)
         }
     };
     lvgl_disp = lvgl_port_add_disp(&disp_cfg);
+    ESP_RETURN_ON_FALSE(lvgl_disp != NULL, ESP_ERR_NO_MEM, TAG, "LVGL display allocation failed");
+    s_flush_done_sem = xSemaphoreCreateBinaryStatic(&s_flush_done_buf);
+    bsp_display_reset_perf();
+
+    /* Arbitrate the SPI bus (shared with the SD card) around every flush */
+    lvgl_port_lock(0);
+    lv_display_add_event_cb(lvgl_disp, flush_start_cb, LV_EVENT_FLUSH_START, NULL);
+    lv_display_set_flush_wait_cb(lvgl_disp, flush_wait_cb);
+    lv_display_add_event_cb(lvgl_disp, perf_event_cb, LV_EVENT_REFR_START, NULL);
+    lv_display_add_event_cb(lvgl_disp, perf_event_cb, LV_EVENT_RENDER_START, NULL);
+    lv_display_add_event_cb(lvgl_disp, perf_event_cb, LV_EVENT_REFR_READY, NULL);
+    lv_display_add_event_cb(lvgl_disp, perf_event_cb, LV_EVENT_FLUSH_WAIT_START, NULL);
+    lv_display_add_event_cb(lvgl_disp, perf_event_cb, LV_EVENT_FLUSH_WAIT_FINISH, NULL);
+    const esp_lcd_panel_io_callbacks_t io_cbs = {
+        .on_color_trans_done = flush_io_ready_cb,
+    };
+    esp_lcd_panel_io_register_event_callbacks(lcd_io, &io_cbs, lvgl_disp);
+    lvgl_port_unlock();
 
     /* Add touch input (for selected screen) */
     const lvgl_port_touch_cfg_t touch_cfg = {
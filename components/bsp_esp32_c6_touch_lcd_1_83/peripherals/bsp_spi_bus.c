@@ -0,0 +1,255 @@
+/**
+ * @file bsp_spi_bus.c
+ * @brief Priority arbiter for the SPI2 bus shared by the LCD and SD card
+ *
+ * Replaces the LVGL mutex as the SD/LCD exclusion mechanism. Waiters queue
+ * per client class (FIFO within a class); a release hands the bus directly
+ * to the oldest waiter of the highest waiting class, so a low-priority
+ * client can never barge in ahead of a queued display flush.
+ *
+ * Each waiter parks on a static binary semaphore on its own stack - no heap
+ * traffic per acquire. State is guarded by a spinlock so the display can
+ * release from the LCD transfer-done ISR.
+ */
+
+#include "bsp_board.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <string.h>
+
+#define BUS_FREE    (-1)
+
+/**
+ * @brief A task blocked in bsp_spi_bus_acquire()
+ */
+typedef struct bus_waiter {
+    struct bus_waiter *next;
+    SemaphoreHandle_t sem;
+    bool granted;               /**< Set (under s_lock) when the bus is handed over */
+} bus_waiter_t;
+
+typedef struct {
+    bus_waiter_t *head;
+    bus_waiter_t *tail;
+} bus_queue_t;
+
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static int s_owner = BUS_FREE;
+static int64_t s_hold_start;
+static bus_queue_t s_queue[BSP_SPI_CLIENT_MAX];
+static bsp_spi_bus_stats_t s_stats[BSP_SPI_CLIENT_MAX];
+
+static const uint32_t s_default_wait_ms[BSP_SPI_CLIENT_MAX] = {
+    [BSP_SPI_CLIENT_DISPLAY] = BSP_SPI_BUS_WAIT_DISPLAY_MS,
+    [BSP_SPI_CLIENT_AUDIO]   = BSP_SPI_BUS_WAIT_AUDIO_MS,
+    [BSP_SPI_CLIENT_FILE]    = BSP_SPI_BUS_WAIT_FILE_MS,
+};
+
+/*===========================================================================
+ * Helpers (call with s_lock held)
+ *===========================================================================*/
+
+static void queue_push(bus_queue_t *q, bus_waiter_t *w)
+{
+    w->next = NULL;
+    if (q->tail) {
+        q->tail->next = w;
+    } else {
+        q->head = w;
+    }
+    q->tail = w;
+}
+
+static void queue_remove(bus_queue_t *q, bus_waiter_t *w)
+{
+    bus_waiter_t *prev = NULL;
+    for (bus_waiter_t *it = q->head; it != NULL; prev = it, it = it->next) {
+        if (it == w) {
+            if (prev) {
+                prev->next = it->next;
+            } else {
+                q->head = it->next;
+            }
+            if (q->tail == it) {
+                q->tail = prev;
+            }
+            return;
+        }
+    }
+}
+
+/**
+ * @brief True if a client of equal or higher priority is already queued
+ */
+static bool queued_at_or_above(bsp_spi_client_t client)
+{
+    for (int c = 0; c <= (int)client; c++) {
+        if (s_queue[c].head != NULL) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static IRAM_ATTR void grant(int client, int64_t now)
+{
+    s_owner = client;
+    s_hold_start = now;
+    s_stats[client].acquisitions++;
+}
+
+/**
+ * @brief Account the hold time and hand the bus to the next waiter
+ * @return Waiter to wake (outside the lock), or NULL if the bus is now free
+ */
+static IRAM_ATTR bus_waiter_t *release_and_pick(bsp_spi_client_t client, int64_t now)
+{
+    if (s_owner != (int)client) {
+        return NULL;    /* Not ours (e.g. display flush that timed out) */
+    }
+
+    uint32_t held = (uint32_t)(now - s_hold_start);
+    s_stats[client].hold_us += held;
+    if (held > s_stats[client].max_hold_us) {
+        s_stats[client].max_hold_us = held;
+    }
+
+    for (int c = 0; c < BSP_SPI_CLIENT_MAX; c++) {
+        bus_waiter_t *w = s_queue[c].head;
+        if (w != NULL) {
+            s_queue[c].head = w->next;
+            if (s_queue[c].head == NULL) {
+                s_queue[c].tail = NULL;
+            }
+            w->granted = true;
+            grant(c, now);
+            return w;
+        }
+    }
+
+    s_owner = BUS_FREE;
+    return NULL;
+}
+
+/*===========================================================================
+ * Public API
+ *===========================================================================*/
+
+esp_err_t bsp_spi_bus_acquire(bsp_spi_client_t client, uint32_t timeout_ms)
+{
+    if (client >= BSP_SPI_CLIENT_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (timeout_ms == BSP_SPI_BUS_WAIT_DEFAULT) {
+        timeout_ms = s_default_wait_ms[client];
+    }
+
+    int64_t t0 = esp_timer_get_time();
+
+    /* Fast path: bus idle and nobody of our class or above is queued */
+    taskENTER_CRITICAL(&s_lock);
+    if (s_owner == BUS_FREE && !queued_at_or_above(client)) {
+        grant(client, t0);
+        taskEXIT_CRITICAL(&s_lock);
+        return ESP_OK;
+    }
+    taskEXIT_CRITICAL(&s_lock);
+
+    StaticSemaphore_t sem_buf;
+    bus_waiter_t w = {
+        .sem = xSemaphoreCreateBinaryStatic(&sem_buf),
+        .granted = false,
+    };
+
+    bool owned = false;
+    taskENTER_CRITICAL(&s_lock);
+    if (s_owner == BUS_FREE && !queued_at_or_above(client)) {
+        grant(client, esp_timer_get_time());    /* Released while we were setting up */
+        owned = true;
+    } else {
+        queue_push(&s_queue[client], &w);
+        s_stats[client].contended++;
+    }
+    taskEXIT_CRITICAL(&s_lock);
+
+    if (!owned) {
+        owned = xSemaphoreTake(w.sem, pdMS_TO_TICKS(timeout_ms)) == pdTRUE;
+    }
+    if (!owned) {
+        taskENTER_CRITICAL(&s_lock);
+        if (w.granted) {
+            owned = true;   /* Handed over just as we timed out */
+        } else {
+            queue_remove(&s_queue[client], &w);
+            s_stats[client].timeouts++;
+        }
+        taskEXIT_CRITICAL(&s_lock);
+        if (owned) {
+            /* The releaser gives right after leaving its critical section;
+             * wait for it so w.sem outlives the give */
+            xSemaphoreTake(w.sem, portMAX_DELAY);
+        }
+    }
+    vSemaphoreDelete(w.sem);
+
+    uint32_t waited = (uint32_t)(esp_timer_get_time() - t0);
+    taskENTER_CRITICAL(&s_lock);
+    s_stats[client].wait_us += waited;
+    if (waited > s_stats[client].max_wait_us) {
+        s_stats[client].max_wait_us = waited;
+    }
+    taskEXIT_CRITICAL(&s_lock);
+
+    return owned ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+void bsp_spi_bus_release(bsp_spi_client_t client)
+{
+    if (client >= BSP_SPI_CLIENT_MAX) {
+        return;
+    }
+
+    taskENTER_CRITICAL(&s_lock);
+    bus_waiter_t *next = release_and_pick(client, esp_timer_get_time());
+    taskEXIT_CRITICAL(&s_lock);
+
+    if (next != NULL) {
+        xSemaphoreGive(next->sem);
+    }
+}
+
+IRAM_ATTR bool bsp_spi_bus_release_from_isr(bsp_spi_client_t client)
+{
+    if (client >= BSP_SPI_CLIENT_MAX) {
+        return false;
+    }
+
+    BaseType_t woken = pdFALSE;
+    taskENTER_CRITICAL_ISR(&s_lock);
+    bus_waiter_t *next = release_and_pick(client, esp_timer_get_time());
+    taskEXIT_CRITICAL_ISR(&s_lock);
+
+    if (next != NULL) {
+        xSemaphoreGiveFromISR(next->sem, &woken);
+    }
+    return woken == pdTRUE;
+}
+
+void bsp_spi_bus_get_stats(bsp_spi_client_t client, bsp_spi_bus_stats_t *stats)
+{
+    if (client >= BSP_SPI_CLIENT_MAX || stats == NULL) {
+        return;
+    }
+    taskENTER_CRITICAL(&s_lock);
+    *stats = s_stats[client];
+    taskEXIT_CRITICAL(&s_lock);
+}
+
+void bsp_spi_bus_reset_stats(void)
+{
+    taskENTER_CRITICAL(&s_lock);
+    memset(s_stats, 0, sizeof(s_stats));
+    taskEXIT_CRITICAL(&s_lock);
+}
@@ -0,0 +1,400 @@
+/**
+ * @file fixed_math.c
+ * @brief Q16.16 fixed-point math
+ *
+ * Tables were generated with:
+ *   sin:  round(sin(i / 256 * pi / 2) * 2^16), i = 0..256
+ *   atan: round(atan(2^-i) * 2^29),            i = 0..17
+ */
+
+#include "fixed_math.h"
+#include "sdkconfig.h"
+#include <stdbool.h>
+
+#if CONFIG_APP_SELF_TEST
+#include <math.h>
+#include "esp_log.h"
+#if CONFIG_IDF_TARGET_LINUX
+#include <time.h>
+#else
+#include "esp_cpu.h"
+#endif
+
+static const char *TAG = "fixed_math";
+#endif
+
+/*===========================================================================
+ * Constants
+ *===========================================================================*/
+
+/* 2^32 / (2 pi) in Q16: Q16 radians -> 32-bit phase (2^32 = one turn) */
+#define RAD_TO_PHASE        683565276LL
+
+#define PHASE_QUARTER       0x40000000u
+
+#define CORDIC_ITERATIONS   18
+#define CORDIC_PI_Q29       1686629713      /* pi in Q29 */
+#define CORDIC_NORM_BITS    28              /* Larger component scaled to [2^28, 2^29) */
+
+/* Reciprocal seed 48/17 - 32/17 d (max error 1/17 for d in [0.5, 1)), Q30 */
+#define RECIP_SEED_A        3031741621u
+#define RECIP_SEED_B        2021161080u
+#define RECIP_ITERATIONS    3
+
+/* Documented bounds, in LSB */
+#define SIN_MAX_LSB         2
+#define ATAN2_MAX_LSB       1
+#define SQRT_MAX_LSB        1
+#define RECIP_MAX_LSB       1
+
+/*===========================================================================
+ * Tables
+ *===========================================================================*/
+
+/* First quadrant of sin, 256 segments (one extra entry for interpolation) */
+static const int32_t s_sin_table[257] = {
+        0,   402,   804,  1206,  1608,  2010,  2412,  2814,
+     3216,  3617,  4019,  4420,  4821,  5222,  5623,  6023,
+     6424,  6824,  7224,  7623,  8022,  8421,  8820,  9218,
+     9616, 10014, 10411, 10808, 11204, 11600, 11996, 12391,
+    12785, 13180, 13573, 13966, 14359, 14751, 15143, 15534,
+    15924, 16314, 16703, 17091, 17479, 17867, 18253, 18639,
+    19024, 19409, 19792, 20175, 20557, 20939, 21320, 21699,
+    22078, 22457, 22834, 23210, 23586, 23961, 24335, 24708,
+    25080, 25451, 25821, 26190, 26558, 26925, 27291, 27656,
+    28020, 28383, 28745, 29106, 29466, 29824, 30182, 30538,
+    30893, 31248, 31600, 31952, 32303, 32652, 33000, 33347,
+    33692, 34037, 34380, 34721, 35062, 35401, 35738, 36075,
+    36410, 36744, 37076, 37407, 37736, 38064, 38391, 38716,
+    39040, 39362, 39683, 40002, 40320, 40636, 40951, 41264,
+    41576, 41886, 42194, 42501, 42806, 43110, 43412, 43713,
+    44011, 44308, 44604, 44898, 45190, 45480, 45769, 46056,
+    46341, 46624, 46906, 47186, 47464, 47741, 48015, 48288,
+    48559, 48828, 49095, 49361, 49624, 49886, 50146, 50404,
+    50660, 50914, 51166, 51417, 51665, 51911, 52156, 52398,
+    52639, 52878, 53114, 53349, 53581, 53812, 54040, 54267,
+    54491, 54714, 54934, 55152, 55368, 55582, 55794, 56004,
+    56212, 56418, 56621, 56823, 57022, 57219, 57414, 57607,
+    57798, 57986, 58172, 58356, 58538, 58718, 58896, 59071,
+    59244, 59415, 59583, 59750, 59914, 60075, 60235, 60392,
+    60547, 60700, 60851, 60999, 61145, 61288, 61429, 61568,
+    61705, 61839, 61971, 62101, 62228, 62353, 62476, 62596,
+    62714, 62830, 62943, 63054, 63162, 63268, 63372, 63473,
+    63572, 63668, 63763, 63854, 63944, 64031, 64115, 64197,
+    64277, 64354, 64429, 64501, 64571, 64639, 64704, 64766,
+    64827, 64884, 64940, 64993, 65043, 65091, 65137, 65180,
+    65220, 65259, 65294, 65328, 65358, 65387, 65413, 65436,
+    65457, 65476, 65492, 65505, 65516, 65525, 65531, 65535,
+    65536,
+};
+
+/* CORDIC rotation angles in Q29 radians */
+static const int32_t s_atan_table[CORDIC_ITERATIONS] = {
+    421657428,  /* atan(2^-0) */
+    248918915,  /* atan(2^-1) */
+    131521918,  /* atan(2^-2) */
+    66762579,   /* atan(2^-3) */
+    33510843,   /* atan(2^-4) */
+    16771758,   /* atan(2^-5) */
+    8387925,    /* atan(2^-6) */
+    4194219,    /* atan(2^-7) */
+    2097141,    /* atan(2^-8) */
+    1048575,    /* atan(2^-9) */
+    524288,     /* atan(2^-10) */
+    262144,     /* atan(2^-11) */
+    131072,     /* atan(2^-12) */
+    65536,      /* atan(2^-13) */
+    32768,      /* atan(2^-14) */
+    16384,      /* atan(2^-15) */
+    8192,       /* atan(2^-16) */
+    4096,       /* atan(2^-17) */
+};
+
+/*===========================================================================
+ * Trigonometry
+ *===========================================================================*/
+
+/**
+ * @brief sin of a 32-bit phase (2^32 = one turn)
+ *
+ * Top 2 bits pick the quadrant, the next 8 the table segment and 16 more
+ * the interpolation weight. Odd quadrants read the table backwards.
+ */
+static fx16_t sin_phase(uint32_t phase) {
+    uint32_t quadrant = phase >> 30;
+    uint32_t u = phase & (PHASE_QUARTER - 1);
+    if (quadrant & 1) u = PHASE_QUARTER - u;    /* 1 .. 2^30 */
+
+    uint32_t idx = u >> 22;
+    int32_t v;
+    if (idx >= 256) {
+        v = s_sin_table[256];
+    } else {
+        int32_t frac = (int32_t)((u >> 6) & 0xFFFF);
+        int32_t a = s_sin_table[idx];
+        int32_t b = s_sin_table[idx + 1];
+        v = a + (((b - a) * frac + 0x8000) >> 16);
+    }
+
+    return (quadrant & 2) ? -v : v;
+}
+
+fx16_t fx_sin_turn(fx16_t turns) {
+    return sin_phase((uint32_t)turns << 16);
+}
+
+fx16_t fx_cos_turn(fx16_t turns) {
+    return sin_phase(((uint32_t)turns << 16) + PHASE_QUARTER);
+}
+
+fx16_t fx_sin(fx16_t rad) {
+    return sin_phase((uint32_t)(((int64_t)rad * RAD_TO_PHASE) >> 16));
+}
+
+fx16_t fx_cos(fx16_t rad) {
+    return sin_phase((uint32_t)(((int64_t)rad * RAD_TO_PHASE) >> 16) + PHASE_QUARTER);
+}
+
+fx16_t fx_atan2(int32_t y, int32_t x) {
+    if (x == 0 && y == 0) return 0;
+
+    /* Scale so the larger component is in [2^28, 2^29): no overflow through
+     * the CORDIC gain (~1.65 * sqrt(2)), and full precision for small vectors */
+    uint32_t ax = x < 0 ? -(uint32_t)x : (uint32_t)x;
+    uint32_t ay = y < 0 ? -(uint32_t)y : (uint32_t)y;
+    int shift = (31 - CORDIC_NORM_BITS) - __builtin_clz(ax > ay ? ax : ay);
+    int64_t xl = x, yl = y;
+    if (shift > 0) {
+        xl >>= shift;
+        yl >>= shift;
+    } else {
+        xl *= (int64_t)1 << -shift;
+        yl *= (int64_t)1 << -shift;
+    }
+    int32_t xs = (int32_t)xl;
+    int32_t ys = (int32_t)yl;
+
+    /* Left half-plane: rotate by pi so CORDIC sees |angle| <= pi / 2 */
+    int32_t z = 0;
+    if (xs < 0) {
+        z = (ys >= 0) ? CORDIC_PI_Q29 : -CORDIC_PI_Q29;
+        xs = -xs;
+        ys = -ys;
+    }
+
+    /* Vectoring: rotate (x, y) onto the x axis, summing the rotations */
+    for (int i = 0; i < CORDIC_ITERATIONS; i++) {
+        int32_t xi = xs >> i;
+        int32_t yi = ys >> i;
+        if (ys > 0) {
+            xs += yi;
+            ys -= xi;
+            z += s_atan_table[i];
+        } else {
+            xs -= yi;
+            ys += xi;
+            z -= s_atan_table[i];
+        }
+    }
+
+    return (z + (1 << 12)) >> 13;   /* Q29 -> Q16, rounded */
+}
+
+/*===========================================================================
+ * Roots and Reciprocal
+ *===========================================================================*/
+
+uint32_t fx_isqrt(uint32_t v) {
+    uint32_t res = 0;
+    uint32_t bit = 1u << 30;
+
+    while (bit > v) bit >>= 2;
+    while (bit != 0) {
+        if (v >= res + bit) {
+            v -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return res;
+}
+
+fx16_t fx_sqrt(fx16_t v) {
+    if (v <= 0) return 0;
+    if (v < (1 << 16)) return (fx16_t)fx_isqrt((uint32_t)v << 16);   /* v < 1.0: fits 32 bits */
+
+    /* sqrt(v * 2^16) needs a 48-bit radicand */
+    uint64_t rem = (uint64_t)v << 16;
+    uint64_t res = 0;
+    uint64_t bit = 1ULL << 46;
+    while (bit > rem) bit >>= 2;
+    while (bit != 0) {
+        if (rem >= res + bit) {
+            rem -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (fx16_t)res;
+}
+
+fx16_t fx_recip(fx16_t x) {
+    bool neg = x < 0;
+    uint32_t a = neg ? -(uint32_t)x : (uint32_t)x;
+    if (a <= 2) return neg ? -FX_MAX : FX_MAX;     /* 2^32 / a does not fit */
+
+    /* d = a normalized to [0.5, 1) in Q32; 1 / x = 2^32 / a = (1 / d) * 2^n */
+    int n = __builtin_clz(a);
+    uint32_t d = a << n;
+
+    /* Linear seed, then Newton-Raphson r = r * (2 - d * r), all Q30 */
+    uint32_t r = RECIP_SEED_A - (uint32_t)(((uint64_t)RECIP_SEED_B * d) >> 32);
+    for (int i = 0; i < RECIP_ITERATIONS; i++) {
+        uint32_t t = (uint32_t)(((uint64_t)d * r) >> 32);
+        r = (uint32_t)(((uint64_t)r * ((2u << 30) - t)) >> 30);
+    }
+
+    /* n <= 30 here; 1 / d in Q30 -> 2^32 / a, rounded */
+    uint32_t res = (n >= 30) ? r : (r + (1u << (29 - n))) >> (30 - n);
+    return neg ? -(fx16_t)res : (fx16_t)res;
+}
+
+#if CONFIG_APP_SELF_TEST
+/*===========================================================================
+ * Verification and Benchmark (CONFIG_APP_SELF_TEST)
+ *===========================================================================*/
+
+static void track(uint32_t *max_lsb, double got, double want) {
+    double err = fabs(got - want);
+    uint32_t lsb = (uint32_t)ceil(err - 1e-9);
+    if (lsb > *max_lsb) *max_lsb = lsb;
+}
+
+/* Deterministic inputs without pulling in esp_random() */
+static uint32_t lcg_next(uint32_t *state) {
+    *state = *state * 1664525u + 1013904223u;
+    return *state;
+}
+
+esp_err_t fx_math_check(fx_math_errors_t *errors) {
+    if (errors == NULL) return ESP_ERR_INVALID_ARG;
+    *errors = (fx_math_errors_t){0};
+    uint32_t seed = 1;
+
+    for (int32_t t = 0; t < FX_ONE; t++) {
+        double a = 2.0 * M_PI * t / FX_ONE;
+        track(&errors->sin_lsb, fx_sin_turn(t), sin(a) * FX_ONE);
+        track(&errors->sin_lsb, fx_cos_turn(t), cos(a) * FX_ONE);
+        track(&errors->sin_lsb, fx_sin_turn(t - 3 * FX_ONE), sin(a) * FX_ONE);
+    }
+
+    for (int32_t r = -8 * FX_PI; r <= 8 * FX_PI; r += 97) {
+        double a = (double)r / FX_ONE;
+        track(&errors->sin_rad_lsb, fx_sin(r), sin(a) * FX_ONE);
+        track(&errors->sin_rad_lsb, fx_cos(r), cos(a) * FX_ONE);
+    }
+
+    for (int k = 0; k <= 30; k += 3) {
+        double m = (double)(1u << k);
+        for (int i = 0; i < 1024; i++) {
+            double a = 2.0 * M_PI * i / 1024 - M_PI;
+            int32_t x = (int32_t)lround(m * cos(a));
+            int32_t y = (int32_t)lround(m * sin(a));
+            if (x == 0 && y == 0) continue;
+            double want = atan2((double)y, (double)x) * FX_ONE;
+            fx16_t got = fx_atan2(y, x);
+            /* +pi and -pi are the same direction */
+            if (fabs(got - want) > FX_PI) want += (want < 0) ? 2.0 * M_PI * FX_ONE : -2.0 * M_PI * FX_ONE;
+            track(&errors->atan2_lsb, got, want);
+        }
+    }
+
+    for (int i = 0; i < 20000; i++) {
+        uint32_t v = (i < 4096) ? (uint32_t)i : lcg_next(&seed) >> (i % 32);
+        uint64_t s = fx_isqrt(v);
+        if (s * s > v || (s + 1) * (s + 1) <= v) errors->isqrt_errors++;
+
+        fx16_t q = (fx16_t)(v >> 1);
+        track(&errors->sqrt_lsb, fx_sqrt(q), sqrt((double)q / FX_ONE) * FX_ONE);
+    }
+
+    for (int i = 0; i < 20000; i++) {
+        /* Log-uniform |x| from 1/256 to 32767 */
+        int32_t x = (int32_t)((lcg_next(&seed) >> (1 + i % 23)) | 0x100);
+        if (i & 1) x = -x;
+        track(&errors->recip_lsb, fx_recip(x), 4294967296.0 / x);
+    }
+
+    bool ok = errors->sin_lsb <= SIN_MAX_LSB && errors->sin_rad_lsb <= SIN_MAX_LSB &&
+              errors->atan2_lsb <= ATAN2_MAX_LSB && errors->sqrt_lsb <= SQRT_MAX_LSB &&
+              errors->isqrt_errors == 0 && errors->recip_lsb <= RECIP_MAX_LSB;
+
+    ESP_LOGI(TAG, "Max error (LSB): sin %lu, sin(rad) %lu, atan2 %lu, sqrt %lu, recip %lu, isqrt misses %lu",
+             (unsigned long)errors->sin_lsb, (unsigned long)errors->sin_rad_lsb,
+             (unsigned long)errors->atan2_lsb, (unsigned long)errors->sqrt_lsb,
+             (unsigned long)errors->recip_lsb, (unsigned long)errors->isqrt_errors);
+    return ok ? ESP_OK : ESP_FAIL;
+}
+
+static inline uint32_t bench_now(void) {
+#if CONFIG_IDF_TARGET_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+#else
+    return esp_cpu_get_cycle_count();
+#endif
+}
+
+#define BENCH_INPUTS    16
+
+void fx_math_benchmark(uint32_t iterations, fx_math_bench_t *bench) {
+    if (bench == NULL || iterations == 0) return;
+
+    /* Varied inputs so neither side gets constant-folded or branch-lucky */
+    fx16_t in_fx[BENCH_INPUTS];
+    float in_f[BENCH_INPUTS];
+    uint32_t seed = 7;
+    for (int i = 0; i < BENCH_INPUTS; i++) {
+        in_fx[i] = (fx16_t)(lcg_next(&seed) >> 9) + FX_ONE / 4;   /* 0.25 .. 64 */
+        in_f[i] = fx_to_float(in_fx[i]);
+    }
+
+    volatile fx16_t sink_fx = 0;
+    volatile float sink_f = 0.0f;
+    uint32_t t0;
+
+#define BENCH(field, expr)                                          \
+    t0 = bench_now();                                               \
+    for (uint32_t n = 0; n < iterations; n++) {                     \
+        uint32_t i = n % BENCH_INPUTS;                              \
+        (void)i;                                                    \
+        expr;                                                       \
+    }                                                               \
+    bench->field = (bench_now() - t0) / iterations
+
+    BENCH(sin_fx,     sink_fx = fx_sin(in_fx[i]));
+    BENCH(sin_libm,   sink_f = sinf(in_f[i]));
+    BENCH(atan2_fx,   sink_fx = fx_atan2(in_fx[i], in_fx[(i + 5) % BENCH_INPUTS] - 8 * FX_ONE));
+    BENCH(atan2_libm, sink_f = atan2f(in_f[i], in_f[(i + 5) % BENCH_INPUTS] - 8.0f));
+    BENCH(sqrt_fx,    sink_fx = fx_sqrt(in_fx[i]));
+    BENCH(sqrt_libm,  sink_f = sqrtf(in_f[i]));
+    BENCH(recip_fx,   sink_fx = fx_recip(in_fx[i]));
+    BENCH(recip_libm, sink_f = 1.0f / in_f[i]);
+
+#undef BENCH
+
+    (void)sink_fx;
+    (void)sink_f;
+
+    ESP_LOGI(TAG, "Per call (fx / libm): sin %lu / %lu, atan2 %lu / %lu, sqrt %lu / %lu, recip %lu / %lu",
+             (unsigned long)bench->sin_fx, (unsigned long)bench->sin_libm,
+             (unsigned long)bench->atan2_fx, (unsigned long)bench->atan2_libm,
+             (unsigned long)bench->sqrt_fx, (unsigned long)bench->sqrt_libm,
+             (unsigned long)bench->recip_fx, (unsigned long)bench->recip_libm);
+}
+#endif /* CONFIG_APP_SELF_TEST */
@@ -0,0 +1,207 @@
+/**
+ * @file fixed_math.h
+ * @brief Q16.16 fixed-point math for animation and sensor code
+ *
+ * The ESP32-C6 has no FPU: every sinf(), atan2f() or sqrtf() is a
+ * soft-float library call costing thousands of cycles. These replacements
+ * use integer arithmetic only (the RV32 M extension multiplies in one
+ * instruction):
+ *
+ * - fx_sin() / fx_cos(): quarter-wave table, 256 segments, linear
+ *   interpolation
+ * - fx_atan2(): CORDIC vectoring, 18 iterations
+ * - fx_isqrt() / fx_sqrt(): bit-by-bit integer square root (exact floor)
+ * - fx_recip(): normalization plus Newton-Raphson
+ *
+ * Values are fx16_t, signed Q16.16 (FX_ONE = 1.0, range +-32768). Angles
+ * are Q16 radians or, cheaper, Q16 turns (FX_ONE = one full turn): a
+ * phase kept in turns wraps by itself, which replaces fmodf(t, 2 * PI).
+ *
+ * Error bounds (1 LSB = 2^-16 ~= 1.5e-5; measured with fx_math_check()
+ * against double-precision libm, all inputs in range):
+ *
+ * | Function        | Max error                                       |
+ * |-----------------|-------------------------------------------------|
+ * | fx_sin_turn/cos | 2 LSB                                           |
+ * | fx_sin/cos      | 2 LSB                                           |
+ * | fx_atan2        | 1 LSB (radians)                                 |
+ * | fx_isqrt        | exact floor                                     |
+ * | fx_sqrt         | < 1 LSB (floor)                                 |
+ * | fx_recip        | 1 LSB for |x| >= 1/256, saturates for |x| <= 2^-15 |
+ *
+ * Usage:
+ *   fx16_t phase = 0;                          // turns
+ *   phase += fx_from_float(BREATH_HZ / FPS);   // per frame, wraps by itself
+ *   int dy = fx_to_int(fx_mul(fx_sin_turn(phase), fx_from_int(AMP)));
+ */
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*===========================================================================
+ * Types and Constants
+ *===========================================================================*/
+
+typedef int32_t fx16_t;                 /**< Signed Q16.16 */
+
+#define FX_SHIFT        16
+#define FX_ONE          ((fx16_t)1 << FX_SHIFT)
+#define FX_HALF         (FX_ONE / 2)
+#define FX_PI           ((fx16_t)205887)    /**< pi in Q16 */
+#define FX_TWO_PI       ((fx16_t)411775)    /**< 2 pi in Q16 */
+#define FX_HALF_PI      ((fx16_t)102944)    /**< pi / 2 in Q16 */
+#define FX_MAX          INT32_MAX
+
+/*===========================================================================
+ * Conversions and Arithmetic
+ *===========================================================================*/
+
+static inline fx16_t fx_from_int(int32_t v) { return (fx16_t)((uint32_t)v << FX_SHIFT); }
+
+/** Truncates toward minus infinity */
+static inline int32_t fx_to_int(fx16_t v) { return v >> FX_SHIFT; }
+
+/** Rounds to nearest */
+static inline int32_t fx_round(fx16_t v) { return (v + FX_HALF) >> FX_SHIFT; }
+
+/** For constants and setup code; costs a soft-float multiply at run time */
+static inline fx16_t fx_from_float(float v) {
+    return (fx16_t)(v * (float)FX_ONE + (v >= 0.0f ? 0.5f : -0.5f));
+}
+
+static inline float fx_to_float(fx16_t v) { return (float)v * (1.0f / (float)FX_ONE); }
+
+/** a * b, truncated; overflows like int32 outside +-32768 */
+static inline fx16_t fx_mul(fx16_t a, fx16_t b) {
+    return (fx16_t)(((int64_t)a * b) >> FX_SHIFT);
+}
+
+/*===========================================================================
+ * Trigonometry
+ *===========================================================================*/
+
+/**
+ * @brief sin of a phase in turns
+ *
+ * @param turns Q16 turns; only the fractional part matters, so any
+ *              value (negative too) wraps correctly
+ * @return sin in Q16, within 2 LSB
+ */
+fx16_t fx_sin_turn(fx16_t turns);
+
+/**
+ * @brief cos of a phase in turns (see fx_sin_turn())
+ */
+fx16_t fx_cos_turn(fx16_t turns);
+
+/**
+ * @brief sin of an angle in radians
+ *
+ * @param rad Q16 radians, any value
+ * @return sin in Q16, within 2 LSB
+ */
+fx16_t fx_sin(fx16_t rad);
+
+/**
+ * @brief cos of an angle in radians (see fx_sin())
+ */
+fx16_t fx_cos(fx16_t rad);
+
+/**
+ * @brief Angle of the vector (x, y)
+ *
+ * x and y share any scale (raw sensor counts work as well as Q16 values).
+ *
+ * @return Q16 radians in [-pi, pi], within 1 LSB; 0 for (0, 0)
+ */
+fx16_t fx_atan2(int32_t y, int32_t x);
+
+/*===========================================================================
+ * Roots and Reciprocal
+ *===========================================================================*/
+
+/**
+ * @brief floor(sqrt(v)) of an integer (e.g. a sum of squared sensor counts)
+ */
+uint32_t fx_isqrt(uint32_t v);
+
+/**
+ * @brief Square root in Q16
+ *
+ * @param v Q16 value; negative values return 0
+ * @return floor of the exact root in Q16, less than 1 LSB low
+ */
+fx16_t fx_sqrt(fx16_t v);
+
+/**
+ * @brief 1 / x in Q16 without a division
+ *
+ * @param x Q16 value
+ * @return 1 / x within 1 LSB; +-FX_MAX when the result does not fit
+ *         (|x| <= 2^-15, including 0)
+ */
+fx16_t fx_recip(fx16_t x);
+
+#if CONFIG_APP_SELF_TEST
+/*===========================================================================
+ * Verification and Benchmark (CONFIG_APP_SELF_TEST)
+ *===========================================================================*/
+
+/**
+ * @brief Largest errors found by fx_math_check(), in LSB (2^-16)
+ */
+typedef struct {
+    uint32_t sin_lsb;           /**< fx_sin_turn() and fx_cos_turn(), every Q16 phase */
+    uint32_t sin_rad_lsb;       /**< fx_sin() and fx_cos(), +-8 pi */
+    uint32_t atan2_lsb;         /**< fx_atan2(), all directions, magnitudes 1 to 2^30 */
+    uint32_t sqrt_lsb;          /**< fx_sqrt() */
+    uint32_t isqrt_errors;      /**< fx_isqrt() results that were not the exact floor */
+    uint32_t recip_lsb;         /**< fx_recip(), |x| from 1/256 to 32767 */
+} fx_math_errors_t;
+
+/**
+ * @brief Compare every function against libm (soft float, slow)
+ *
+ * Sweeps each function over its documented range and records the largest
+ * deviation.
+ *
+ * @param errors Largest errors found
+ * @return ESP_OK if every error is within the documented bound,
+ *         ESP_FAIL otherwise
+ */
+esp_err_t fx_math_check(fx_math_errors_t *errors);
+
+/**
+ * @brief Average cost per call, fixed-point vs. libm float
+ *
+ * CPU cycles on the device (nanoseconds in a linux-target build).
+ */
+typedef struct {
+    uint32_t sin_fx;
+    uint32_t sin_libm;          /**< sinf() */
+    uint32_t atan2_fx;
+    uint32_t atan2_libm;        /**< atan2f() */
+    uint32_t sqrt_fx;
+    uint32_t sqrt_libm;         /**< sqrtf() */
+    uint32_t recip_fx;
+    uint32_t recip_libm;        /**< 1.0f / x */
+} fx_math_bench_t;
+
+/**
+ * @brief Time each function against its libm counterpart
+ *
+ * @param iterations Calls per function (e.g. 1000)
+ * @param bench Averages
+ */
+void fx_math_benchmark(uint32_t iterations, fx_math_bench_t *bench);
+#endif /* CONFIG_APP_SELF_TEST */
+
+#ifdef __cplusplus
+}
+#endif
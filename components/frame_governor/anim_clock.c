@@ -0,0 +1,214 @@
+/**
+ * @file anim_clock.c
+ * @brief Monotonic animation clock driven by esp_timer
+ */
+
+#include "anim_clock.h"
+#include "sdkconfig.h"
+#include <string.h>
+
+#if CONFIG_IDF_TARGET_LINUX
+#include <time.h>
+#else
+#include "esp_timer.h"
+#endif
+
+#if CONFIG_APP_SELF_TEST
+#include "esp_log.h"
+#include <stdlib.h>
+
+static const char *TAG = "anim_clock";
+#endif
+
+/*===========================================================================
+ * Helpers
+ *===========================================================================*/
+
+static int64_t now_us(void) {
+#if CONFIG_IDF_TARGET_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#else
+    return esp_timer_get_time();
+#endif
+}
+
+static void resume_at(anim_clock_t *clk, int64_t now) {
+    if (!clk->paused) return;
+
+    clk->paused = false;
+    clk->last_us = now;
+    clk->timing = true;
+}
+
+/*===========================================================================
+ * Public Functions
+ *===========================================================================*/
+
+void anim_clock_init(anim_clock_t *clk, uint32_t max_gap_ms) {
+    memset(clk, 0, sizeof(*clk));
+    clk->max_gap_us = max_gap_ms * 1000;
+}
+
+uint32_t anim_clock_tick_at(anim_clock_t *clk, int64_t at_us) {
+    clk->step_us = 0;
+    if (clk->paused) return 0;
+
+    if (clk->timing) {
+        int64_t gap = at_us - clk->last_us;
+        if (gap > 0 && gap <= clk->max_gap_us) clk->step_us = (uint32_t)gap;
+    }
+    clk->last_us = at_us;
+    clk->timing = true;
+    clk->time_us += clk->step_us;
+    return clk->step_us;
+}
+
+uint32_t anim_clock_tick(anim_clock_t *clk) {
+    return anim_clock_tick_at(clk, now_us());
+}
+
+void anim_clock_set_ms(anim_clock_t *clk, uint32_t time_ms) {
+    clk->time_us = (int64_t)time_ms * 1000;
+    clk->step_us = 0;
+}
+
+void anim_clock_pause(anim_clock_t *clk) {
+    clk->paused = true;
+    clk->step_us = 0;
+    clk->timing = false;
+}
+
+void anim_clock_resume(anim_clock_t *clk) {
+    resume_at(clk, now_us());
+}
+
+#if CONFIG_APP_SELF_TEST
+/*===========================================================================
+ * Simulated Time (CONFIG_APP_SELF_TEST)
+ *===========================================================================*/
+
+#define SIM_MAX_GAP_MS          1000
+#define SIM_DROP_EVERY          7           /* Every 7th tick is dropped */
+#define SIM_JITTER_PCT          40
+
+#define CHECK_DURATION_US       10000000    /* Simulated run */
+#define CHECK_PAUSE_START_US    3000000
+#define CHECK_PAUSE_END_US      3500000
+#define CHECK_SLEEP_START_US    6000000     /* No ticks, longer than max gap */
+#define CHECK_SLEEP_END_US      8000000
+
+void anim_clock_sim_start(anim_clock_sim_t *sim, anim_clock_t *clk, uint32_t fps,
+                          uint32_t duration_ms) {
+    memset(sim, 0, sizeof(*sim));
+    sim->period_us = 1000000 / (fps > 0 ? fps : 1);
+    sim->end_us = (int64_t)duration_ms * 1000;
+    sim->seed = fps * 2654435761u;
+
+    anim_clock_init(clk, SIM_MAX_GAP_MS);
+    anim_clock_tick_at(clk, 0);
+}
+
+bool anim_clock_sim_tick(anim_clock_sim_t *sim, anim_clock_t *clk) {
+    if (sim->done) return false;
+
+    for (;;) {
+        sim->k++;
+        sim->seed = sim->seed * 1664525u + 1013904223u;
+        int64_t jitter = (int64_t)(sim->seed >> 16) % (2 * SIM_JITTER_PCT + 1) - SIM_JITTER_PCT;
+        int64_t now = sim->k * sim->period_us + sim->period_us * jitter / 100;
+
+        if (now >= sim->end_us) {
+            anim_clock_tick_at(clk, sim->end_us);
+            sim->done = true;
+            return true;
+        }
+        if (sim->k % SIM_DROP_EVERY == 0) continue;
+
+        anim_clock_tick_at(clk, now);
+        return true;
+    }
+}
+
+/*===========================================================================
+ * Verification (CONFIG_APP_SELF_TEST)
+ *===========================================================================*/
+
+/**
+ * @brief Tick @p clk at @p now and update the independent model
+ */
+static void check_tick(anim_clock_t *clk, int64_t now, int64_t *last, int64_t *expected,
+                       anim_clock_errors_t *errors) {
+    anim_clock_tick_at(clk, now);
+    if (now - *last <= (int64_t)SIM_MAX_GAP_MS * 1000) *expected += now - *last;
+    *last = now;
+
+    uint32_t time_err = (uint32_t)llabs(clk->time_us - *expected);
+    if (time_err > errors->time_us) errors->time_us = time_err;
+}
+
+/**
+ * @brief Simulate one tick rate on the anim_clock_sim schedule
+ *
+ * The pause and the sleep are inserted at the same instants for every
+ * rate; a tick planned inside either is not delivered.
+ */
+static void check_rate(uint32_t fps, anim_clock_errors_t *errors) {
+    anim_clock_sim_t sim;
+    anim_clock_t planned;           /* Ticked by the schedule, only for its timestamps */
+    anim_clock_t clk;
+    int64_t expected = 0;           /* Independent model of animation time */
+    int64_t last = 0;
+    bool paused = false;
+    bool pause_done = false;
+    bool slept = false;
+
+    anim_clock_sim_start(&sim, &planned, fps, CHECK_DURATION_US / 1000);
+    anim_clock_init(&clk, SIM_MAX_GAP_MS);
+    anim_clock_tick_at(&clk, 0);
+
+    while (anim_clock_sim_tick(&sim, &planned)) {
+        int64_t now = planned.last_us;
+
+        if (sim.done) {
+            check_tick(&clk, now, &last, &expected, errors);
+            break;
+        }
+
+        if (!pause_done && now >= CHECK_PAUSE_START_US) {
+            check_tick(&clk, CHECK_PAUSE_START_US, &last, &expected, errors);
+            anim_clock_pause(&clk);
+            pause_done = paused = true;
+        }
+        if (paused) {
+            if (now < CHECK_PAUSE_END_US) continue;
+            resume_at(&clk, CHECK_PAUSE_END_US);
+            last = CHECK_PAUSE_END_US;
+            paused = false;
+        }
+
+        if (!slept && now >= CHECK_SLEEP_START_US) {
+            check_tick(&clk, CHECK_SLEEP_START_US, &last, &expected, errors);
+            check_tick(&clk, CHECK_SLEEP_END_US, &last, &expected, errors);
+            slept = true;
+        }
+        if (slept && now < CHECK_SLEEP_END_US) continue;
+
+        check_tick(&clk, now, &last, &expected, errors);
+    }
+}
+
+esp_err_t anim_clock_check(anim_clock_errors_t *errors) {
+    static const uint32_t rates[] = { 10, 20, 30 };
+
+    memset(errors, 0, sizeof(*errors));
+    for (size_t i = 0; i < sizeof(rates) / sizeof(rates[0]); i++) {
+        check_rate(rates[i], errors);
+    }
+
+    bool ok = errors->time_us == 0;
+    ESP_LOGI(TAG, "time %lu us: %s", (unsigned long)errors->time_us, ok ? "ok" : "FAILED");
+    return ok ? ESP_OK : ESP_FAIL;
+}
+#endif /* CONFIG_APP_SELF_TEST */
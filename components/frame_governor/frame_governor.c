@@ -0,0 +1,379 @@
+/**
+ * @file frame_governor.c
+ * @brief Central frame-rate scheduler for LVGL animation timers
+ *
+ * Each client owns one lv_timer whose period the governor rewrites. Rates
+ * drop as soon as the smoothed frame cost exceeds the CPU budget and rise
+ * in small steps after a run of ticks with clear headroom, so a cost near
+ * the limit does not make the rate oscillate.
+ */
+
+#include "frame_governor.h"
+#include "bsp_board.h"
+#include "lvgl.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "sdkconfig.h"
+#include <stdio.h>
+#include <string.h>
+
+#if CONFIG_FRAME_GOV_FEED_WDT
+#include "esp_task_wdt.h"
+#endif
+
+static const char *TAG = "frame_gov";
+
+/*===========================================================================
+ * Constants
+ *===========================================================================*/
+
+#define BATTERY_POLL_MS         5000    /* AXP2101 read over slow I2C, keep it rare */
+#define RAISE_AFTER_TICKS       10      /* Ticks of headroom before stepping up */
+#define RAISE_STEP_FPS          2
+#define RAISE_MARGIN_FPS        2       /* Budget must allow this much more than the current rate */
+
+/*===========================================================================
+ * Types
+ *===========================================================================*/
+
+struct frame_gov_client {
+    frame_gov_client_config_t cfg;
+    lv_timer_t *timer;              /* NULL = free slot */
+    bool paused;
+    anim_clock_t clock;
+    uint32_t disp_frames;           /* bsp_display_perf_t.frames at the last tick */
+    uint16_t raise_ticks;
+    frame_gov_stats_t stats;
+};
+
+/*===========================================================================
+ * Static Variables
+ *===========================================================================*/
+
+static const uint16_t s_hist_bounds_ms[FRAME_GOV_HIST_BUCKETS - 1] = FRAME_GOV_HIST_BOUNDS_MS;
+
+static struct {
+    struct frame_gov_client clients[FRAME_GOV_MAX_CLIENTS];
+    uint8_t count;
+    lv_timer_t *housekeeping;
+    uint32_t housekeeping_ticks;
+    bool low_battery;
+#if CONFIG_FRAME_GOV_FEED_WDT
+    TaskHandle_t wdt_task;          /* Task we subscribed, NULL if none */
+    bool wdt_checked;
+    bool wdt_feeding;               /* LVGL task is subscribed (by us or its owner) */
+#endif
+} s_gov;
+
+/*===========================================================================
+ * Watchdog
+ *===========================================================================*/
+
+/**
+ * @brief Feed the task watchdog from the LVGL task, subscribing it first
+ *
+ * Subscription happens here rather than in frame_gov_register() because
+ * registration may run in another task that holds the LVGL lock.
+ */
+static void wdt_feed(void) {
+#if CONFIG_FRAME_GOV_FEED_WDT
+    if (!s_gov.wdt_checked) {
+        s_gov.wdt_checked = true;
+        esp_err_t err = esp_task_wdt_status(NULL);
+        if (err == ESP_ERR_NOT_FOUND) {
+            err = esp_task_wdt_add(NULL);
+            if (err == ESP_OK) {
+                s_gov.wdt_task = xTaskGetCurrentTaskHandle();
+                ESP_LOGI(TAG, "Task watchdog subscribed");
+            }
+        }
+        if (err != ESP_OK) {
+            ESP_LOGW(TAG, "Task watchdog not available: %s", esp_err_to_name(err));
+        }
+        s_gov.wdt_feeding = (err == ESP_OK);
+    }
+    if (s_gov.wdt_feeding) {
+        esp_task_wdt_reset();
+    }
+#endif
+}
+
+static void wdt_release(void) {
+#if CONFIG_FRAME_GOV_FEED_WDT
+    if (s_gov.wdt_task != NULL) {
+        esp_task_wdt_delete(s_gov.wdt_task);
+        ESP_LOGI(TAG, "Task watchdog released");
+    }
+    s_gov.wdt_task = NULL;
+    s_gov.wdt_checked = false;
+    s_gov.wdt_feeding = false;
+#endif
+}
+
+/*===========================================================================
+ * Rate Control
+ *===========================================================================*/
+
+/**
+ * @brief Highest rate at which @p cost_us per frame fits the CPU budget
+ */
+static uint32_t budget_fps(uint32_t cost_us) {
+    if (cost_us == 0) return UINT8_MAX;
+
+    uint32_t fps = (uint32_t)CONFIG_FRAME_GOV_CPU_BUDGET_PCT * 10000u / cost_us;
+    return LV_MIN(fps, UINT8_MAX);
+}
+
+static uint8_t client_cap(const struct frame_gov_client *c) {
+    uint8_t cap = c->stats.idle ? c->cfg.idle_fps : c->cfg.max_fps;
+    if (s_gov.low_battery) cap = LV_MAX(c->cfg.min_fps, cap / 2);
+    return cap;
+}
+
+static void apply_fps(struct frame_gov_client *c, uint8_t fps) {
+    if (fps == c->stats.fps) return;
+
+    ESP_LOGD(TAG, "%s: %u -> %u FPS (cost %lu us)", c->cfg.name, c->stats.fps, fps,
+             (unsigned long)c->stats.avg_cost_us);
+    c->stats.fps = fps;
+    c->stats.rate_changes++;
+    c->raise_ticks = 0;
+    lv_timer_set_period(c->timer, 1000 / fps);
+}
+
+/**
+ * @brief Pick a new rate from the smoothed cost and the current cap
+ *
+ * @param immediate Jump straight to the target (cap changed) instead of
+ *                  stepping up
+ */
+static void retune(struct frame_gov_client *c, bool immediate) {
+    uint8_t cap = client_cap(c);
+    uint32_t budget = budget_fps(c->stats.avg_cost_us);
+    uint8_t target = (uint8_t)LV_CLAMP(c->cfg.min_fps, LV_MIN(budget, cap), cap);
+
+    c->stats.cap_fps = cap;
+    c->stats.low_battery = s_gov.low_battery;
+
+    if (target < c->stats.fps || immediate) {
+        apply_fps(c, target);
+    } else if (target > c->stats.fps && budget >= (uint32_t)c->stats.fps + RAISE_MARGIN_FPS) {
+        if (++c->raise_ticks >= RAISE_AFTER_TICKS) {
+            apply_fps(c, LV_MIN(target, c->stats.fps + RAISE_STEP_FPS));
+        }
+    } else {
+        c->raise_ticks = 0;
+    }
+}
+
+static void record_cost(struct frame_gov_client *c, uint32_t cost_us) {
+    frame_gov_stats_t *st = &c->stats;
+    uint32_t cost_ms = cost_us / 1000;
+    int bucket = 0;
+
+    while (bucket < FRAME_GOV_HIST_BUCKETS - 1 && cost_ms >= s_hist_bounds_ms[bucket]) bucket++;
+    st->hist[bucket]++;
+
+    if (cost_us > st->max_cost_us) st->max_cost_us = cost_us;
+    st->avg_cost_us = (st->avg_cost_us == 0) ? cost_us : (st->avg_cost_us * 3 + cost_us) / 4;
+}
+
+/*===========================================================================
+ * Timer Callbacks
+ *===========================================================================*/
+
+static void client_timer_cb(lv_timer_t *timer) {
+    struct frame_gov_client *c = lv_timer_get_user_data(timer);
+
+    wdt_feed();
+
+    /* A late tick moves the clock further: the frames in between are skipped */
+    uint32_t step_us = anim_clock_tick(&c->clock);
+    uint32_t period_us = 1000000u / c->stats.fps;
+    if (step_us >= period_us + period_us / 2) {
+        c->stats.skipped += (step_us + period_us / 2) / period_us - 1;
+    }
+
+    /* The refresh since the last tick drew what that tick invalidated */
+    bsp_display_perf_t perf;
+    bsp_display_get_perf(&perf);
+    uint32_t refresh_us = 0;
+    if (perf.frames != c->disp_frames) {
+        refresh_us = perf.last_render_us + perf.last_wait_us;
+        c->disp_frames = perf.frames;
+    }
+
+    c->stats.ticks++;
+    if (c->stats.ticks > 1) {
+        record_cost(c, c->stats.last_cb_us + refresh_us);
+    }
+
+    int64_t start = esp_timer_get_time();
+    c->cfg.cb(&c->clock, c->cfg.user_data);
+    c->stats.last_cb_us = (uint32_t)(esp_timer_get_time() - start);
+
+    /* The callback may have unregistered itself */
+    if (c->timer == timer) {
+        retune(c, false);
+    }
+}
+
+static void housekeeping_timer_cb(lv_timer_t *timer) {
+    wdt_feed();
+
+    if (s_gov.housekeeping_ticks++ % (BATTERY_POLL_MS / FRAME_GOV_HOUSEKEEPING_MS) != 0) return;
+
+    int pct = bsp_battery_get_percent();
+    bool low = CONFIG_FRAME_GOV_LOW_BATTERY_PCT > 0 && pct >= 0 &&
+               pct <= CONFIG_FRAME_GOV_LOW_BATTERY_PCT && !bsp_battery_is_charging();
+    if (low == s_gov.low_battery) return;
+
+    ESP_LOGI(TAG, "Low battery mode %s (%d%%)", low ? "on" : "off", pct);
+    s_gov.low_battery = low;
+    for (int i = 0; i < FRAME_GOV_MAX_CLIENTS; i++) {
+        if (s_gov.clients[i].timer != NULL) retune(&s_gov.clients[i], true);
+    }
+}
+
+/*===========================================================================
+ * Public Functions
+ *===========================================================================*/
+
+frame_gov_handle_t frame_gov_register(const frame_gov_client_config_t *config) {
+    if (config == NULL || config->cb == NULL || config->min_fps == 0 ||
+        config->min_fps > config->max_fps) {
+        ESP_LOGE(TAG, "Invalid client config");
+        return NULL;
+    }
+
+    struct frame_gov_client *c = NULL;
+    for (int i = 0; i < FRAME_GOV_MAX_CLIENTS; i++) {
+        if (s_gov.clients[i].timer == NULL) {
+            c = &s_gov.clients[i];
+            break;
+        }
+    }
+    if (c == NULL) {
+        ESP_LOGE(TAG, "No free client slot for %s", config->name ? config->name : "?");
+        return NULL;
+    }
+
+    if (s_gov.housekeeping == NULL) {
+        s_gov.housekeeping = lv_timer_create(housekeeping_timer_cb, FRAME_GOV_HOUSEKEEPING_MS, NULL);
+        if (s_gov.housekeeping == NULL) return NULL;
+    }
+
+    memset(c, 0, sizeof(*c));
+    c->cfg = *config;
+    if (c->cfg.name == NULL) c->cfg.name = "?";
+    c->cfg.idle_fps = LV_CLAMP(c->cfg.min_fps, c->cfg.idle_fps, c->cfg.max_fps);
+    anim_clock_init(&c->clock, FRAME_GOV_MAX_GAP_MS);
+    c->stats.fps = client_cap(c);
+    c->stats.cap_fps = c->stats.fps;
+    c->stats.low_battery = s_gov.low_battery;
+
+    c->timer = lv_timer_create(client_timer_cb, 1000 / c->stats.fps, c);
+    if (c->timer == NULL) {
+        ESP_LOGE(TAG, "Failed to create timer for %s", c->cfg.name);
+        return NULL;
+    }
+    s_gov.count++;
+
+    ESP_LOGI(TAG, "Registered %s (%u-%u FPS, idle %u)", c->cfg.name, c->cfg.min_fps,
+             c->cfg.max_fps, c->cfg.idle_fps);
+    return c;
+}
+
+void frame_gov_unregister(frame_gov_handle_t client) {
+    if (client == NULL || client->timer == NULL) return;
+
+    ESP_LOGI(TAG, "Unregistered %s", client->cfg.name);
+    lv_timer_delete(client->timer);
+    client->timer = NULL;
+
+    if (--s_gov.count == 0) {
+        lv_timer_delete(s_gov.housekeeping);
+        s_gov.housekeeping = NULL;
+        s_gov.housekeeping_ticks = 0;
+        wdt_release();
+    }
+}
+
+void frame_gov_pause(frame_gov_handle_t client) {
+    if (client == NULL || client->timer == NULL || client->paused) return;
+
+    client->paused = true;
+    anim_clock_pause(&client->clock);
+    lv_timer_pause(client->timer);
+}
+
+void frame_gov_resume(frame_gov_handle_t client) {
+    if (client == NULL || client->timer == NULL || !client->paused) return;
+
+    client->paused = false;
+    anim_clock_resume(&client->clock);
+    lv_timer_resume(client->timer);
+}
+
+void frame_gov_set_time(frame_gov_handle_t client, uint32_t time_ms) {
+    if (client == NULL || client->timer == NULL) return;
+
+    anim_clock_set_ms(&client->clock, time_ms);
+}
+
+void frame_gov_set_idle(frame_gov_handle_t client, bool idle) {
+    if (client == NULL || client->timer == NULL || client->stats.idle == idle) return;
+
+    client->stats.idle = idle;
+    retune(client, true);
+}
+
+esp_err_t frame_gov_get_stats(frame_gov_handle_t client, frame_gov_stats_t *stats) {
+    if (client == NULL || client->timer == NULL || stats == NULL) return ESP_ERR_INVALID_ARG;
+
+    *stats = client->stats;
+    return ESP_OK;
+}
+
+void frame_gov_log_stats(void) {
+    for (int i = 0; i < FRAME_GOV_MAX_CLIENTS; i++) {
+        const struct frame_gov_client *c = &s_gov.clients[i];
+        if (c->timer == NULL) continue;
+
+        const frame_gov_stats_t *st = &c->stats;
+        char hist[FRAME_GOV_HIST_BUCKETS * 16];
+        int len = 0;
+        for (int b = 0; b < FRAME_GOV_HIST_BUCKETS && len < (int)sizeof(hist); b++) {
+            if (b < FRAME_GOV_HIST_BUCKETS - 1) {
+                len += snprintf(hist + len, sizeof(hist) - len, " <%u:%lu", s_hist_bounds_ms[b],
+                                (unsigned long)st->hist[b]);
+            } else {
+                len += snprintf(hist + len, sizeof(hist) - len, " >=%u:%lu", s_hist_bounds_ms[b - 1],
+                                (unsigned long)st->hist[b]);
+            }
+        }
+
+        ESP_LOGI(TAG, "%s: %u FPS (cap %u%s%s%s), %lu ticks, %lu skipped, %lu changes, "
+                 "cost avg %lu max %lu us",
+                 c->cfg.name, st->fps, st->cap_fps, st->idle ? ", idle" : "",
+                 st->low_battery ? ", low battery" : "", c->paused ? ", paused" : "",
+                 (unsigned long)st->ticks, (unsigned long)st->skipped, (unsigned long)st->rate_changes,
+                 (unsigned long)st->avg_cost_us, (unsigned long)st->max_cost_us);
+        ESP_LOGI(TAG, "%s: cost ms%s", c->cfg.name, hist);
+    }
+}
+
+void frame_gov_reset_stats(void) {
+    for (int i = 0; i < FRAME_GOV_MAX_CLIENTS; i++) {
+        frame_gov_stats_t *st = &s_gov.clients[i].stats;
+
+        st->ticks = 0;
+        st->skipped = 0;
+        st->rate_changes = 0;
+        st->avg_cost_us = 0;
+        st->max_cost_us = 0;
+        memset(st->hist, 0, sizeof(st->hist));
+    }
+}
@@ -0,0 +1,175 @@
+/**
+ * @file anim_clock.h
+ * @brief Monotonic animation clock driven by esp_timer
+ *
+ * Animation time advances by the real time between ticks (microsecond
+ * esp_timer deltas), not by a fixed amount per tick. A late or dropped
+ * tick therefore skips frames instead of slowing the motion, and the frame
+ * rate can change without changing how fast anything moves.
+ *
+ * - Paused time does not count
+ * - A gap longer than max_gap_ms (a debugger halt, light sleep) counts as
+ *   a pause too, so animations do not lurch forward after it
+ * - step_us is the advance of the latest tick, for integrating physics
+ *
+ * Not thread safe; each clock belongs to one task (normally the LVGL
+ * task through the frame governor).
+ *
+ * Usage:
+ *   anim_clock_t clk;
+ *   anim_clock_init(&clk, 1000);
+ *   ...per frame:
+ *   anim_clock_tick(&clk);
+ *   float t = anim_clock_sec(&clk);
+ *   y += vy * anim_clock_step_sec(&clk);
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*===========================================================================
+ * Types
+ *===========================================================================*/
+
+typedef struct {
+    int64_t time_us;            /**< Animation time */
+    int64_t last_us;            /**< esp_timer time of the latest tick (if timing) */
+    uint32_t step_us;           /**< Advance of the latest tick */
+    uint32_t max_gap_us;        /**< Longer gaps between ticks count as a pause */
+    bool timing;                /**< last_us is valid */
+    bool paused;
+} anim_clock_t;
+
+/*===========================================================================
+ * Clock
+ *===========================================================================*/
+
+/**
+ * @brief Start a clock at 0
+ *
+ * @param clk Clock
+ * @param max_gap_ms Longest tick gap that counts as animation time
+ */
+void anim_clock_init(anim_clock_t *clk, uint32_t max_gap_ms);
+
+/**
+ * @brief Advance to the current esp_timer time
+ *
+ * The first tick after init or resume only starts timing (step 0).
+ *
+ * @return Advance in microseconds (also kept in step_us)
+ */
+uint32_t anim_clock_tick(anim_clock_t *clk);
+
+/**
+ * @brief Advance to @p at_us (esp_timer microseconds) instead of the current time
+ *
+ * Same rules as anim_clock_tick(); for replaying recorded or simulated
+ * timestamps. Do not mix with anim_clock_tick() on one clock.
+ */
+uint32_t anim_clock_tick_at(anim_clock_t *clk, int64_t at_us);
+
+/**
+ * @brief Move the animation time to @p time_ms (e.g. 0 for a new animation)
+ *
+ * Timing continues from the latest tick; step_us is cleared.
+ */
+void anim_clock_set_ms(anim_clock_t *clk, uint32_t time_ms);
+
+/**
+ * @brief Stop counting time until anim_clock_resume()
+ */
+void anim_clock_pause(anim_clock_t *clk);
+
+/**
+ * @brief Count time again from now
+ */
+void anim_clock_resume(anim_clock_t *clk);
+
+static inline uint32_t anim_clock_ms(const anim_clock_t *clk) {
+    return (uint32_t)(clk->time_us / 1000);
+}
+
+static inline float anim_clock_sec(const anim_clock_t *clk) {
+    return (float)anim_clock_ms(clk) * 0.001f + (float)(clk->time_us % 1000) * 1e-6f;
+}
+
+static inline float anim_clock_step_sec(const anim_clock_t *clk) {
+    return (float)clk->step_us * 1e-6f;
+}
+
+#if CONFIG_APP_SELF_TEST
+/*===========================================================================
+ * Simulated Time (CONFIG_APP_SELF_TEST)
+ *===========================================================================*/
+
+/**
+ * @brief Tick schedule for driving a clock without waiting for real time
+ */
+typedef struct {
+    int64_t period_us;
+    int64_t end_us;
+    uint32_t seed;
+    int k;                      /**< Ticks scheduled so far */
+    bool done;
+} anim_clock_sim_t;
+
+/**
+ * @brief Start @p clk at 0 and plan ticks at @p fps for @p duration_ms
+ *
+ * Ticks land +-40 % off the nominal period and every 7th is dropped, as a
+ * busy LVGL task would deliver them; the last one lands exactly on
+ * @p duration_ms, so runs at different rates end at the same animation
+ * time. Max gap 1 s.
+ */
+void anim_clock_sim_start(anim_clock_sim_t *sim, anim_clock_t *clk, uint32_t fps,
+                          uint32_t duration_ms);
+
+/**
+ * @brief Tick @p clk at the next planned time
+ *
+ * Usage:
+ *   anim_clock_sim_start(&sim, &clk, 20, 10000);
+ *   while (anim_clock_sim_tick(&sim, &clk)) update(&clk);
+ *
+ * @return false once the run is over (@p clk is not ticked then)
+ */
+bool anim_clock_sim_tick(anim_clock_sim_t *sim, anim_clock_t *clk);
+
+/*===========================================================================
+ * Verification (CONFIG_APP_SELF_TEST)
+ *===========================================================================*/
+
+/**
+ * @brief Largest deviation found by anim_clock_check()
+ */
+typedef struct {
+    uint32_t time_us;           /**< Animation time vs. unpaused wall time, any rate */
+} anim_clock_errors_t;
+
+/**
+ * @brief Check that animation time follows wall time at any tick rate
+ *
+ * Drives clocks with simulated timestamps at 10, 20 and 30 FPS, with
+ * +-40 % tick jitter, dropped ticks, a pause and a gap longer than
+ * max_gap_ms, and compares the animation time with a model of the wall
+ * time that should have counted. Whether the animations themselves move
+ * the same at every rate is checked against their real update code by
+ * mochi_anim_check() and gallery_anim_check().
+ *
+ * @param errors Largest deviation found
+ * @return ESP_OK if animation time is exact, ESP_FAIL otherwise
+ */
+esp_err_t anim_clock_check(anim_clock_errors_t *errors);
+#endif /* CONFIG_APP_SELF_TEST */
+
+#ifdef __cplusplus
+}
+#endif
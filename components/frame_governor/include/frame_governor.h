@@ -0,0 +1,179 @@
+/**
+ * @file frame_governor.h
+ * @brief Central frame-rate scheduler for LVGL animation timers
+ *
+ * Animation modules register a tick callback instead of creating their own
+ * fixed-period lv_timer. The governor owns the timers and retunes each
+ * client's rate after every tick:
+ *
+ * - Cost: the client's own callback time plus the render time of the
+ *   display refresh it caused (bsp_display_get_perf()), averaged over a
+ *   few frames
+ * - Budget: the rate is lowered until cost x FPS fits
+ *   CONFIG_FRAME_GOV_CPU_BUDGET_PCT of the CPU, which leaves the idle task
+ *   (and with it the task watchdog) room to run; it is raised again slowly
+ *   once there is headroom
+ * - Caps: a client marked idle runs at its idle rate; on low battery
+ *   (not charging) every cap is halved, never below the client's minimum
+ *
+ * While any client is registered the LVGL task is subscribed to the task
+ * watchdog and fed on every tick and at least every
+ * FRAME_GOV_HOUSEKEEPING_MS, so a stuck render is reported instead of being
+ * hidden behind a longer timer period.
+ *
+ * Each client has an anim_clock_t that the governor advances by the real
+ * time since the previous tick. Animations sample that clock instead of
+ * counting ticks, so a late tick skips frames rather than slowing the
+ * motion, and the rate the governor picks does not change motion speed.
+ *
+ * All functions must be called from the LVGL task (or with the LVGL lock
+ * held).
+ *
+ * Usage:
+ *   static void tick(const anim_clock_t *clk, void *ctx) { draw_at(anim_clock_sec(clk)); }
+ *
+ *   frame_gov_client_config_t cfg = FRAME_GOV_CLIENT_DEFAULT("face", tick, NULL);
+ *   s_client = frame_gov_register(&cfg);
+ *   frame_gov_set_idle(s_client, true);     // breathing only
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "anim_clock.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*===========================================================================
+ * Types and Constants
+ *===========================================================================*/
+
+#define FRAME_GOV_MAX_CLIENTS       4
+#define FRAME_GOV_HOUSEKEEPING_MS   1000    /**< Watchdog feed and battery poll */
+#define FRAME_GOV_MAX_GAP_MS        1000    /**< Longer tick gaps do not advance client clocks */
+
+/** Frame cost histogram bucket upper bounds in ms; the last bucket is open */
+#define FRAME_GOV_HIST_BOUNDS_MS    { 5, 10, 20, 33, 50, 100, 200 }
+#define FRAME_GOV_HIST_BUCKETS      8
+
+/**
+ * @brief Client tick
+ * @param clock Client's animation clock, already advanced to this tick
+ *              (step_us is 0 on the first tick after register)
+ * @param user_data From the client config
+ */
+typedef void (*frame_gov_cb_t)(const anim_clock_t *clock, void *user_data);
+
+/**
+ * @brief Client configuration
+ *
+ * The display refreshes at most every CONFIG_LV_DEF_REFR_PERIOD ms, so a
+ * max_fps above that rate only costs callback time.
+ */
+typedef struct {
+    const char *name;           /**< For logs (not copied) */
+    frame_gov_cb_t cb;
+    void *user_data;
+    uint8_t min_fps;            /**< Never throttled below this */
+    uint8_t max_fps;            /**< Rate with headroom and full activity */
+    uint8_t idle_fps;           /**< Cap while marked idle */
+} frame_gov_client_config_t;
+
+#define FRAME_GOV_CLIENT_DEFAULT(_name, _cb, _user_data) { \
+    .name = (_name),                                        \
+    .cb = (_cb),                                            \
+    .user_data = (_user_data),                              \
+    .min_fps = 8,                                           \
+    .max_fps = 25,                                          \
+    .idle_fps = 12,                                         \
+}
+
+typedef struct frame_gov_client *frame_gov_handle_t;
+
+/**
+ * @brief Per-client counters
+ *
+ * Frame cost is callback time plus the render and flush-wait time of the
+ * display refresh that followed the previous tick.
+ */
+typedef struct {
+    uint32_t ticks;             /**< Callbacks since reset */
+    uint32_t skipped;           /**< Frames skipped by late ticks (clock jumped >= 1.5 periods) */
+    uint32_t rate_changes;      /**< Target FPS adjustments */
+    uint8_t fps;                /**< Current target */
+    uint8_t cap_fps;            /**< Current cap (max, idle or low battery) */
+    bool idle;
+    bool low_battery;
+    uint32_t avg_cost_us;       /**< Smoothed frame cost */
+    uint32_t max_cost_us;
+    uint32_t last_cb_us;
+    uint32_t hist[FRAME_GOV_HIST_BUCKETS];  /**< Frame cost, see FRAME_GOV_HIST_BOUNDS_MS */
+} frame_gov_stats_t;
+
+/*===========================================================================
+ * Clients
+ *===========================================================================*/
+
+/**
+ * @brief Register an animation client and start ticking it at max_fps
+ *
+ * @param config Client configuration (copied; name is kept by pointer)
+ * @return Handle, or NULL if the config is invalid or all slots are taken
+ */
+frame_gov_handle_t frame_gov_register(const frame_gov_client_config_t *config);
+
+/**
+ * @brief Stop ticking and free the slot
+ *
+ * The last client leaving unsubscribes the LVGL task from the watchdog.
+ *
+ * @param client Handle (NULL is ignored)
+ */
+void frame_gov_unregister(frame_gov_handle_t client);
+
+/**
+ * @brief Stop ticking a client without giving up its slot
+ */
+void frame_gov_pause(frame_gov_handle_t client);
+
+/**
+ * @brief Resume a paused client; its clock did not advance while paused
+ */
+void frame_gov_resume(frame_gov_handle_t client);
+
+/**
+ * @brief Move a client's animation clock (e.g. to 0 for a new animation)
+ */
+void frame_gov_set_time(frame_gov_handle_t client, uint32_t time_ms);
+
+/**
+ * @brief Mark a client idle (little motion) so it runs at its idle rate
+ */
+void frame_gov_set_idle(frame_gov_handle_t client, bool idle);
+
+/*===========================================================================
+ * Statistics
+ *===========================================================================*/
+
+/**
+ * @brief Snapshot a client's counters
+ * @return ESP_OK, or ESP_ERR_INVALID_ARG for a NULL handle or output
+ */
+esp_err_t frame_gov_get_stats(frame_gov_handle_t client, frame_gov_stats_t *stats);
+
+/**
+ * @brief Log every registered client's rate, cost and histogram
+ */
+void frame_gov_log_stats(void);
+
+/**
+ * @brief Clear the counters and histograms of every client
+ */
+void frame_gov_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -8,12 +8,14 @@
  * - SSL/TLS support via ESP certificate bundle
  * - Custom header management
  * - Bearer token authentication
+ * - Streaming GET over a persistent (keep-alive) connection
  *
  * Usage:
  *   1. Call net_api_init() once at startup (after WiFi is connected)
  *   2. Use net_api_get/post/put/delete for sync requests
  *   3. Use net_api_*_async for non-blocking requests with callbacks
  *   4. Always call net_api_free_response() after processing response
+ *   5. For large bodies (audio, firmware) use net_api_stream_open/read/close
  *
  * @note Requires WiFi connection before making requests
  * @note SSL/TLS is automatically enabled for https:// URLs
@@ -23,6 +25,7 @@
 
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include "esp_err.h"
 
 #ifdef __cplusplus
@@ -201,6 +204,69 @@ void net_api_set_bearer_token(const char *token);
  */
 void net_api_clear_headers(void);
 
+/* ============================================================================
+ * Streaming (Persistent Connection)
+ * ============================================================================ */
+
+/**
+ * @brief Result of net_api_stream_open()
+ */
+typedef struct {
+    int status_code;          /**< Final HTTP status (after redirects), -1 if no response */
+    int64_t content_length;   /**< Body bytes to come (from the requested offset), -1 if unknown */
+    bool reused;              /**< Request was sent on the connection kept from the previous stream */
+} net_api_stream_info_t;
+
+/**
+ * @brief Start a streaming GET request
+ *
+ * The body is pulled with net_api_stream_read() instead of being buffered.
+ * Custom headers, the bearer token and certificate validation are applied
+ * as for the other requests. Redirects are followed.
+ *
+ * A single stream client is kept between streams: if the previous stream
+ * was read to the end and closed with keep_alive, a request to the same
+ * scheme, host and port goes out on that connection without a new TCP
+ * (and TLS) handshake. If the server has dropped it meanwhile the request
+ * is retried once on a fresh connection.
+ *
+ * @param url Full URL (http:// or https://)
+ * @param offset First body byte wanted. Sent as a Range request; if the
+ *               server ignores it the skipped bytes are read and dropped.
+ * @param timeout_ms Connect/receive timeout, 0 = CONFIG_NET_API_TIMEOUT_MS
+ * @param[out] info Status and length (optional)
+ * @return ESP_OK once headers with a 2xx status are in,
+ *         ESP_ERR_INVALID_STATE if a stream is already open,
+ *         ESP_ERR_NOT_FOUND for a 4xx status, ESP_FAIL otherwise
+ *
+ * @note One stream at a time. Not thread-safe: stream calls must not overlap,
+ *       but open, read and close may come from different tasks.
+ */
+esp_err_t net_api_stream_open(const char *url, size_t offset, int timeout_ms,
+                              net_api_stream_info_t *info);
+
+/**
+ * @brief Read the next part of the stream body
+ *
+ * Blocks until some data arrives or the receive timeout expires.
+ *
+ * @param buf Destination
+ * @param len Maximum bytes
+ * @return Bytes read, 0 at the end of the body, -1 if the connection
+ *         failed or timed out before the end
+ */
+int net_api_stream_read(char *buf, int len);
+
+/**
+ * @brief End the stream
+ *
+ * @param keep_alive Keep the connection for the next stream. Only honored
+ *                   if the body was read completely; otherwise the
+ *                   connection is closed (the rest would have to be
+ *                   drained first).
+ */
+void net_api_stream_close(bool keep_alive);
+
 /* ============================================================================
  * Response Management
  * ============================================================================ */
@@ -35,6 +35,10 @@ static const char *TAG = "net_api";
 #define CONFIG_NET_API_MAX_HEADERS 8
 #endif
 
+#define STREAM_MAX_REDIRECTS  3
+#define STREAM_ORIGIN_MAX     96     /* "scheme://host:port" */
+#define STREAM_SKIP_CHUNK     512
+
 /* ============================================================================
  * Types
  * ============================================================================ */
@@ -63,6 +67,12 @@ static int s_header_count = 0;
 static SemaphoreHandle_t s_header_mutex = NULL;
 static char *s_bearer_token = NULL;
 
+/* Streaming client, kept between streams for connection reuse */
+static esp_http_client_handle_t s_stream_client = NULL;
+static char s_stream_origin[STREAM_ORIGIN_MAX];
+static bool s_stream_open = false;
+static bool s_stream_kept = false;   /* Connection idle and reusable */
+
 /* ============================================================================
  * HTTP Event Handler
  * ============================================================================ */
@@ -224,6 +234,65 @@ static esp_err_t perform_request(const char *url, esp_http_client_method_t metho
     return err;
 }
 
+/**
+ * @brief Copy the "scheme://host[:port]" part of a URL
+ * @return false if the URL has no scheme or the origin does not fit
+ */
+static bool url_origin(const char *url, char *out, size_t out_len)
+{
+    const char *host = strstr(url, "://");
+    if (!host) {
+        return false;
+    }
+    host += 3;
+    size_t len = (size_t)(host - url) + strcspn(host, "/?#");
+    if (len >= out_len) {
+        return false;
+    }
+    memcpy(out, url, len);
+    out[len] = '\0';
+    return true;
+}
+
+static bool is_redirect(int status)
+{
+    return status == 301 || status == 302 || status == 303 ||
+           status == 307 || status == 308;
+}
+
+/**
+ * @brief Send the request on s_stream_client and read the response headers
+ * @return Content length (-1 if unknown), or < -1 on failure
+ */
+static int64_t stream_send(void)
+{
+    if (esp_http_client_open(s_stream_client, 0) != ESP_OK) {
+        return -2;
+    }
+    int64_t len = esp_http_client_fetch_headers(s_stream_client);
+    if (len < 0) {
+        return -2;
+    }
+    return esp_http_client_is_chunked_response(s_stream_client) ? -1 : len;
+}
+
+/**
+ * @brief Read and drop @p count body bytes (server ignored the Range header)
+ */
+static bool stream_skip(size_t count)
+{
+    char buf[STREAM_SKIP_CHUNK];
+    while (count > 0) {
+        int n = esp_http_client_read(s_stream_client, buf,
+                                     count < sizeof(buf) ? (int)count : (int)sizeof(buf));
+        if (n <= 0) {
+            return false;
+        }
+        count -= (size_t)n;
+    }
+    return true;
+}
+
 /* ============================================================================
  * Async Task
  * ============================================================================ */
@@ -331,6 +400,13 @@ void net_api_deinit(void)
 
     net_api_clear_headers();
 
+    if (s_stream_client) {
+        esp_http_client_cleanup(s_stream_client);
+        s_stream_client = NULL;
+        s_stream_open = false;
+        s_stream_kept = false;
+    }
+
     if (s_bearer_token) {
         free(s_bearer_token);
         s_bearer_token = NULL;
@@ -393,6 +469,154 @@ esp_err_t net_api_delete_async(const char *url, net_api_callback_t callback, voi
     return start_async_request(url, HTTP_METHOD_DELETE, NULL, NULL, callback, user_data);
 }
 
+/* Streaming */
+
+esp_err_t net_api_stream_open(const char *url, size_t offset, int timeout_ms,
+                              net_api_stream_info_t *info)
+{
+    net_api_stream_info_t result = { .status_code = -1, .content_length = -1 };
+    if (info) {
+        *info = result;
+    }
+    if (!url) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_stream_open) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    char origin[STREAM_ORIGIN_MAX];
+    if (!url_origin(url, origin, sizeof(origin))) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (timeout_ms <= 0) {
+        timeout_ms = CONFIG_NET_API_TIMEOUT_MS;
+    }
+
+    // Reuse the idle connection only for the same origin
+    bool reuse = s_stream_client && s_stream_kept && strcmp(origin, s_stream_origin) == 0;
+    s_stream_kept = false;
+    if (s_stream_client && !reuse) {
+        esp_http_client_cleanup(s_stream_client);
+        s_stream_client = NULL;
+    }
+    if (!s_stream_client) {
+        esp_http_client_config_t config = {
+            .url = url,
+            .method = HTTP_METHOD_GET,
+            .timeout_ms = timeout_ms,
+            .crt_bundle_attach = esp_crt_bundle_attach,  // Enable SSL cert validation
+            .keep_alive_enable = true,
+        };
+        s_stream_client = esp_http_client_init(&config);
+        if (!s_stream_client) {
+            ESP_LOGE(TAG, "Failed to initialize stream client");
+            return ESP_FAIL;
+        }
+    } else {
+        esp_http_client_set_url(s_stream_client, url);
+        esp_http_client_set_timeout_ms(s_stream_client, timeout_ms);
+    }
+    strlcpy(s_stream_origin, origin, sizeof(s_stream_origin));
+
+    apply_custom_headers(s_stream_client);
+    if (offset > 0) {
+        char range[32];
+        snprintf(range, sizeof(range), "bytes=%u-", (unsigned)offset);
+        esp_http_client_set_header(s_stream_client, "Range", range);
+    } else {
+        esp_http_client_delete_header(s_stream_client, "Range");
+    }
+
+    int64_t len = -2;
+    int status = -1;
+    for (int redirects = 0; ; redirects++) {
+        len = stream_send();
+        if (len < -1 && reuse) {
+            // Server dropped the idle connection - once more on a new one
+            ESP_LOGD(TAG, "Kept connection closed by server, reconnecting");
+            esp_http_client_close(s_stream_client);
+            reuse = false;
+            len = stream_send();
+        }
+        if (len < -1) {
+            break;
+        }
+        status = esp_http_client_get_status_code(s_stream_client);
+        if (!is_redirect(status) || redirects == STREAM_MAX_REDIRECTS) {
+            break;
+        }
+        esp_http_client_flush_response(s_stream_client, NULL);
+        esp_http_client_set_redirection(s_stream_client);
+        reuse = false;
+    }
+
+    // A redirect may have moved the connection to another origin
+    char final_url[256];
+    if (esp_http_client_get_url(s_stream_client, final_url, sizeof(final_url)) != ESP_OK ||
+        !url_origin(final_url, s_stream_origin, sizeof(s_stream_origin))) {
+        s_stream_origin[0] = '\0';
+    }
+
+    result.status_code = status;
+    result.reused = reuse;
+    if (len < -1 || status < 200 || status >= 300) {
+        ESP_LOGE(TAG, "HTTP stream %s -> %d", url, status);
+        esp_http_client_close(s_stream_client);
+        if (info) {
+            *info = result;
+        }
+        return (status >= 400 && status < 500) ? ESP_ERR_NOT_FOUND : ESP_FAIL;
+    }
+
+    if (offset > 0 && status != 206) {
+        // Range ignored: the body starts at byte 0
+        if (!stream_skip(offset)) {
+            ESP_LOGE(TAG, "HTTP stream %s: skip to %u failed", url, (unsigned)offset);
+            esp_http_client_close(s_stream_client);
+            return ESP_FAIL;
+        }
+        if (len >= 0) {
+            len = len > (int64_t)offset ? len - (int64_t)offset : 0;
+        }
+    }
+
+    result.content_length = len;
+    if (info) {
+        *info = result;
+    }
+    s_stream_open = true;
+    ESP_LOGI(TAG, "HTTP stream %s -> %d (%lld bytes%s)", url, status,
+             (long long)len, reuse ? ", reused connection" : "");
+    return ESP_OK;
+}
+
+int net_api_stream_read(char *buf, int len)
+{
+    if (!s_stream_open || !buf || len <= 0) {
+        return -1;
+    }
+    int n = esp_http_client_read(s_stream_client, buf, len);
+    if (n > 0) {
+        return n;
+    }
+    // 0 is only the end of the body if all of it arrived
+    return (n == 0 && esp_http_client_is_complete_data_received(s_stream_client)) ? 0 : -1;
+}
+
+void net_api_stream_close(bool keep_alive)
+{
+    if (!s_stream_open) {
+        return;
+    }
+    s_stream_open = false;
+    s_stream_kept = keep_alive && s_stream_origin[0] != '\0' &&
+                    esp_http_client_is_complete_data_received(s_stream_client);
+    if (!s_stream_kept) {
+        esp_http_client_close(s_stream_client);
+    }
+}
+
 /* Header management */
 
 esp_err_t net_api_set_header(const char *key, const char *value)
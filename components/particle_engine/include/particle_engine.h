@@ -0,0 +1,214 @@
+/**
+ * @file particle_engine.h
+ * @brief Fixed-point particle systems drawn straight into an LVGL layer
+ *
+ * Particles are stored as a struct of arrays (x[], y[], vx[], ...) in Q16
+ * fixed point, so integration is a few tight integer loops per system
+ * instead of float math per particle object. What a system spawns is
+ * described by a const particle_emitter_t: spawn area, velocity ranges,
+ * acceleration, lifetime, size, colors, fading, wobble and twinkle.
+ *
+ * particle_system_draw() is one call per system per draw callback. When
+ * every draw task already queued on the layer has been painted (the usual
+ * case with the software renderer), it writes squares and discs (no
+ * anti-aliasing) directly into the layer's RGB565 buffer, clipped to the
+ * layer's clip area, instead of queuing one LVGL draw task per particle.
+ * It never dispatches the layer itself, so it is safe in a display's
+ * LV_EVENT_DRAW_MAIN. Other color formats, and layers with tasks still
+ * pending, fall back to lv_draw_rect().
+ *
+ * Each system measures its own update + draw cost per particle and caps
+ * the live count so a frame stays within the emitter's budget
+ * (CONFIG_PARTICLE_FRAME_BUDGET_US by default); spawns beyond the cap are
+ * dropped and the excess dies off.
+ *
+ * All functions must be called from the LVGL task (or with the LVGL lock
+ * held). particle_system_update() once per frame, particle_system_draw()
+ * from the draw callback (once per invalidated area and stripe).
+ *
+ * Usage:
+ *   static const particle_emitter_t SNOW = { ... };
+ *   particle_system_init(&s_snow, &SNOW, 64);
+ *   particle_system_fill(&s_snow, 25);
+ *   ...tick:  particle_system_update(&s_snow, clock->step_us);
+ *   ...draw:  particle_system_draw(&s_snow, layer);
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "lvgl.h"
+#include "fixed_math.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*===========================================================================
+ * Types and Constants
+ *===========================================================================*/
+
+#define PARTICLE_MAX_COLORS     6
+#define PARTICLE_MAX_RADIUS     24      /**< Larger disc radii are clamped */
+#define PARTICLE_MIN_LIMIT      8       /**< The budget never caps below this */
+
+typedef enum {
+    PARTICLE_SHAPE_RECT,                /**< size x rect_h pixels, top-left at the position */
+    PARTICLE_SHAPE_DISC,                /**< Radius = size, centered on the position */
+} particle_shape_t;
+
+/**
+ * @brief What a system spawns and how its particles move and look
+ *
+ * Ranges are inclusive; every spawned particle draws its own value.
+ * Positions are layer coordinates, as for lv_draw_rect().
+ */
+typedef struct {
+    /* Spawn */
+    lv_area_t spawn;                    /**< Where respawned particles appear */
+    lv_area_t bounds;                   /**< A particle leaving it dies */
+    bool respawn;                       /**< A dying particle is replaced at once in spawn */
+
+    /* Motion (px/s, px/s^2) */
+    bool radial;                        /**< Random direction, speed_min..max */
+    int16_t vx_min, vx_max;             /**< Not radial */
+    int16_t vy_min, vy_max;
+    uint16_t speed_min, speed_max;      /**< Radial */
+    int16_t ax, ay;                     /**< Acceleration (gravity) */
+    uint16_t life_min_ms, life_max_ms;  /**< 0 = lives until it leaves bounds */
+
+    /* Look */
+    particle_shape_t shape;
+    uint8_t size_min, size_max;         /**< Disc radius, or rect width */
+    uint8_t rect_h;                     /**< Rect height */
+    uint32_t colors[PARTICLE_MAX_COLORS];   /**< 0xRRGGBB, one picked per particle */
+    uint8_t color_count;
+    lv_opa_t opa;
+    bool fade;                          /**< Opacity follows the remaining life */
+    lv_opa_t highlight_opa;             /**< Discs: white highlight of r/3 up-left, 0 = none */
+
+    /* Periodic motion and opacity (each particle: random phase, own frequency) */
+    uint16_t freq_min_mhz, freq_max_mhz;
+    uint8_t wobble_px;                  /**< Horizontal sway amplitude */
+    bool twinkle;                       /**< Opacity swings between 0 and opa */
+
+    uint32_t budget_us;                 /**< Update + draw per frame, 0 = CONFIG_PARTICLE_FRAME_BUDGET_US */
+} particle_emitter_t;
+
+/**
+ * @brief Particle system
+ *
+ * The arrays are public for reading (e.g. to draw per-particle extras);
+ * only the functions below modify them.
+ */
+typedef struct {
+    const particle_emitter_t *emitter;
+    uint16_t capacity;
+    uint16_t count;                     /**< Live particles, [0, count) */
+    uint16_t limit;                     /**< Budget cap, <= capacity */
+
+    fx16_t *x, *y;                      /**< Position, px */
+    fx16_t *vx, *vy;                    /**< Velocity, px/s */
+    uint16_t *life;                     /**< Remaining ms (unused without a lifetime) */
+    uint16_t *life0;                    /**< Lifetime at spawn, 0 = none */
+    uint16_t *phase;                    /**< Wobble/twinkle phase, 1/65536 turn */
+    uint16_t *freq;                     /**< mHz */
+    uint8_t *size;
+    uint8_t *color;                     /**< Index into palette */
+
+    uint16_t palette[PARTICLE_MAX_COLORS];  /**< emitter->colors as native RGB565 */
+    uint32_t seed;
+    uint32_t age_rem_us;                /**< Aging not yet taken from life[] */
+
+    /* Cost accounting */
+    uint16_t frame_count;               /**< count while the last frame was drawn */
+    uint32_t update_us;                 /**< Last update */
+    uint32_t draw_us;                   /**< Draw calls since the last update */
+    uint32_t frame_us;                  /**< Last complete frame (update + draw) */
+    uint32_t ns_per_particle;           /**< Smoothed frame cost per particle */
+    uint32_t dropped;                   /**< Spawns refused by the cap */
+    uint32_t queued_draws;              /**< Draws sent through lv_draw_rect(): layer had pending tasks */
+} particle_system_t;
+
+/*===========================================================================
+ * System
+ *===========================================================================*/
+
+/**
+ * @brief Allocate storage for @p capacity particles (one block, internal RAM)
+ *
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, or ESP_ERR_NO_MEM
+ */
+esp_err_t particle_system_init(particle_system_t *ps, const particle_emitter_t *emitter,
+                               uint16_t capacity);
+
+/**
+ * @brief Free the storage (safe on a zeroed or already freed system)
+ */
+void particle_system_deinit(particle_system_t *ps);
+
+/**
+ * @brief Spawn up to @p n particles anywhere within bounds, lives part-spent
+ *
+ * For a scene that should look as if it had been running (rain mid-fall).
+ */
+void particle_system_fill(particle_system_t *ps, uint16_t n);
+
+/**
+ * @brief Spawn up to @p n particles at (@p x, @p y) (a burst)
+ */
+void particle_system_emit(particle_system_t *ps, uint16_t n, int32_t x, int32_t y);
+
+/**
+ * @brief Kill every particle
+ */
+void particle_system_clear(particle_system_t *ps);
+
+/**
+ * @brief Integrate, age, kill and respawn; retune the budget cap
+ *
+ * @param step_us Time since the previous update (e.g. anim_clock_t.step_us)
+ */
+void particle_system_update(particle_system_t *ps, uint32_t step_us);
+
+/**
+ * @brief Draw every particle into @p layer within its clip area
+ *
+ * Particles appear over everything drawn to the layer before the call and
+ * under everything drawn after it. Queued draw tasks are never run from
+ * here; if any is still pending the particles are queued behind it.
+ */
+void particle_system_draw(particle_system_t *ps, lv_layer_t *layer);
+
+#if CONFIG_APP_SELF_TEST
+/*===========================================================================
+ * Benchmark (CONFIG_APP_SELF_TEST)
+ *===========================================================================*/
+
+#define PARTICLE_BENCH_SIZES    3       /**< 50, 200 and 1000 particles */
+
+typedef struct {
+    uint16_t count;
+    uint32_t update_us;                 /**< Per frame */
+    uint32_t draw_us;                   /**< Per frame, full 240 x 284 screen in 64-line stripes */
+} particle_bench_t;
+
+/**
+ * @brief Time update + draw of a snow-like system at 50, 200 and 1000 particles
+ *
+ * Draws into a 240 x 64 RGB565 stripe buffer, five stripes per frame, the
+ * way a partial-refresh display renders. Microseconds on the device
+ * (CLOCK_MONOTONIC in a linux-target build). The budget cap is disabled.
+ *
+ * @param frames Frames per size (e.g. 50)
+ * @param bench Results, one per size
+ * @return ESP_OK, or ESP_ERR_NO_MEM
+ */
+esp_err_t particle_benchmark(uint32_t frames, particle_bench_t bench[PARTICLE_BENCH_SIZES]);
+#endif /* CONFIG_APP_SELF_TEST */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,588 @@
+/**
+ * @file particle_engine.c
+ * @brief Fixed-point particle systems drawn straight into an LVGL layer
+ */
+
+#include "particle_engine.h"
+#include "src/draw/lv_draw_private.h"     /* lv_draw_task_t state: no public getter in LVGL 9.2 */
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "sdkconfig.h"
+#include <string.h>
+
+#if CONFIG_IDF_TARGET_LINUX
+#include <time.h>
+#else
+#include "esp_timer.h"
+#endif
+
+static const char *TAG = "particles";
+
+/*===========================================================================
+ * Constants
+ *===========================================================================*/
+
+#define RGB565_SPREAD_MASK      0x07E0F81Fu /* G in the high half, R and B in the low */
+#define ALPHA_SHIFT             5           /* Blend weight 0..32 */
+#define COST_MAX_STEP_US        200000      /* Longer updates (first tick, stalls) are not sampled */
+
+/* Half width of each row of a disc, by radius and row offset */
+static uint8_t s_disc_hw[PARTICLE_MAX_RADIUS + 1][PARTICLE_MAX_RADIUS + 1];
+static bool s_disc_ready = false;
+
+/*===========================================================================
+ * Helpers
+ *===========================================================================*/
+
+static int64_t now_us(void) {
+#if CONFIG_IDF_TARGET_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#else
+    return esp_timer_get_time();
+#endif
+}
+
+static uint32_t rand_next(particle_system_t *ps) {
+    uint32_t v = ps->seed;
+    v ^= v << 13;
+    v ^= v >> 17;
+    v ^= v << 5;
+    ps->seed = v;
+    return v;
+}
+
+/** Uniform in [lo, hi] */
+static int32_t rand_range(particle_system_t *ps, int32_t lo, int32_t hi) {
+    if (hi <= lo) return lo;
+    return lo + (int32_t)(rand_next(ps) % (uint32_t)(hi - lo + 1));
+}
+
+/** Uniform Q16 value in [lo, hi] (integer bounds, fractional result) */
+static fx16_t rand_fx(particle_system_t *ps, int32_t lo, int32_t hi) {
+    if (hi <= lo) return fx_from_int(lo);
+    return fx_from_int(lo) + (fx16_t)(rand_next(ps) % ((uint32_t)(hi - lo) << FX_SHIFT));
+}
+
+static void disc_table_init(void) {
+    if (s_disc_ready) return;
+
+    /* Rows of a circle of radius r + 0.5, so small discs are not diamonds */
+    for (int r = 0; r <= PARTICLE_MAX_RADIUS; r++) {
+        for (int dy = 0; dy <= r; dy++) {
+            s_disc_hw[r][dy] = (uint8_t)fx_isqrt((uint32_t)(r * r + r - dy * dy));
+        }
+    }
+    s_disc_ready = true;
+}
+
+/**
+ * @brief Give particle @p i fresh random attributes at (@p x, @p y)
+ */
+static void particle_init(particle_system_t *ps, uint16_t i, fx16_t x, fx16_t y) {
+    const particle_emitter_t *em = ps->emitter;
+
+    ps->x[i] = x;
+    ps->y[i] = y;
+    if (em->radial) {
+        fx16_t turn = (fx16_t)(rand_next(ps) & 0xFFFF);
+        int32_t speed = rand_range(ps, em->speed_min, em->speed_max);
+        ps->vx[i] = speed * fx_cos_turn(turn);
+        ps->vy[i] = speed * fx_sin_turn(turn);
+    } else {
+        ps->vx[i] = rand_fx(ps, em->vx_min, em->vx_max);
+        ps->vy[i] = rand_fx(ps, em->vy_min, em->vy_max);
+    }
+    ps->life0[i] = (uint16_t)rand_range(ps, em->life_min_ms, em->life_max_ms);
+    ps->life[i] = ps->life0[i];
+    ps->phase[i] = (uint16_t)rand_next(ps);
+    ps->freq[i] = (uint16_t)rand_range(ps, em->freq_min_mhz, em->freq_max_mhz);
+    ps->size[i] = (uint8_t)rand_range(ps, em->size_min, em->size_max);
+    ps->color[i] = em->color_count > 1 ? (uint8_t)(rand_next(ps) % em->color_count) : 0;
+}
+
+/**
+ * @brief Append a particle if the cap allows
+ * @return Its index, or -1 (counted as dropped)
+ */
+static int spawn(particle_system_t *ps) {
+    if (ps->count >= ps->limit) {
+        ps->dropped++;
+        return -1;
+    }
+    return ps->count++;
+}
+
+static void spawn_in(particle_system_t *ps, uint16_t i, const lv_area_t *area) {
+    particle_init(ps, i, rand_fx(ps, area->x1, area->x2), rand_fx(ps, area->y1, area->y2));
+}
+
+/**
+ * @brief Remove particle @p i by moving the last one into its slot
+ */
+static void kill(particle_system_t *ps, uint16_t i) {
+    uint16_t last = --ps->count;
+    if (i == last) return;
+
+    ps->x[i] = ps->x[last];
+    ps->y[i] = ps->y[last];
+    ps->vx[i] = ps->vx[last];
+    ps->vy[i] = ps->vy[last];
+    ps->life[i] = ps->life[last];
+    ps->life0[i] = ps->life0[last];
+    ps->phase[i] = ps->phase[last];
+    ps->freq[i] = ps->freq[last];
+    ps->size[i] = ps->size[last];
+    ps->color[i] = ps->color[last];
+}
+
+static bool in_bounds(const lv_area_t *bounds, fx16_t x, fx16_t y) {
+    int32_t px = fx_to_int(x);
+    int32_t py = fx_to_int(y);
+    return px >= bounds->x1 && px <= bounds->x2 && py >= bounds->y1 && py <= bounds->y2;
+}
+
+/**
+ * @brief Fold the last frame's cost into the per-particle average and cap
+ */
+static void budget_update(particle_system_t *ps, uint32_t step_us) {
+    uint32_t frame_us = ps->update_us + ps->draw_us;
+
+    if (ps->draw_us == 0 || ps->frame_count == 0 || step_us > COST_MAX_STEP_US) return;
+
+    ps->frame_us = frame_us;
+    uint32_t sample = (uint32_t)((uint64_t)frame_us * 1000 / ps->frame_count);
+    ps->ns_per_particle = ps->ns_per_particle == 0 ? sample : (ps->ns_per_particle * 3 + sample) / 4;
+
+    uint32_t budget = ps->emitter->budget_us ? ps->emitter->budget_us : CONFIG_PARTICLE_FRAME_BUDGET_US;
+    uint64_t limit = (uint64_t)budget * 1000 / (ps->ns_per_particle ? ps->ns_per_particle : 1);
+    if (limit < PARTICLE_MIN_LIMIT) limit = PARTICLE_MIN_LIMIT;
+    if (limit > ps->capacity) limit = ps->capacity;
+
+    if (limit != ps->limit) {
+        ESP_LOGD(TAG, "Cap %u -> %u (%lu ns per particle)", ps->limit, (unsigned)limit,
+                 (unsigned long)ps->ns_per_particle);
+        ps->limit = (uint16_t)limit;
+    }
+}
+
+/*===========================================================================
+ * Drawing
+ *===========================================================================*/
+
+/**
+ * @brief Blend @p color over pixels [x1, x2] of one row (already clipped)
+ *
+ * R, G and B are spread into one word with guard bits between them so a
+ * single multiply blends all three.
+ */
+static void fill_span(uint16_t *row, int32_t x1, int32_t x2, uint16_t color, uint32_t alpha) {
+    uint16_t *px = row + x1;
+    uint16_t *end = row + x2 + 1;
+
+    if (alpha >= (1u << ALPHA_SHIFT)) {
+        while (px < end) *px++ = color;
+        return;
+    }
+
+    uint32_t fg = (color | ((uint32_t)color << 16)) & RGB565_SPREAD_MASK;
+    for (; px < end; px++) {
+        uint32_t bg = (*px | ((uint32_t)*px << 16)) & RGB565_SPREAD_MASK;
+        uint32_t out = ((((fg - bg) * alpha) >> ALPHA_SHIFT) + bg) & RGB565_SPREAD_MASK;
+        *px = (uint16_t)(out | (out >> 16));
+    }
+}
+
+typedef struct {
+    uint8_t *data;
+    uint32_t stride;
+    lv_area_t buf_area;                 /* Layer coordinates of the buffer */
+    lv_area_t clip;
+} raster_t;
+
+static uint16_t *raster_row(const raster_t *rs, int32_t y) {
+    return (uint16_t *)(rs->data + (uint32_t)(y - rs->buf_area.y1) * rs->stride) - rs->buf_area.x1;
+}
+
+static void raster_rect(const raster_t *rs, int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                        uint16_t color, uint32_t alpha) {
+    if (x1 < rs->clip.x1) x1 = rs->clip.x1;
+    if (x2 > rs->clip.x2) x2 = rs->clip.x2;
+    if (y1 < rs->clip.y1) y1 = rs->clip.y1;
+    if (y2 > rs->clip.y2) y2 = rs->clip.y2;
+    if (x1 > x2) return;
+
+    for (int32_t y = y1; y <= y2; y++) {
+        fill_span(raster_row(rs, y), x1, x2, color, alpha);
+    }
+}
+
+static void raster_disc(const raster_t *rs, int32_t cx, int32_t cy, int32_t r,
+                        uint16_t color, uint32_t alpha) {
+    int32_t y1 = cy - r > rs->clip.y1 ? cy - r : rs->clip.y1;
+    int32_t y2 = cy + r < rs->clip.y2 ? cy + r : rs->clip.y2;
+    if (cx + r < rs->clip.x1 || cx - r > rs->clip.x2) return;
+
+    for (int32_t y = y1; y <= y2; y++) {
+        int32_t dy = y > cy ? y - cy : cy - y;
+        int32_t hw = s_disc_hw[r][dy];
+        int32_t x1 = cx - hw > rs->clip.x1 ? cx - hw : rs->clip.x1;
+        int32_t x2 = cx + hw < rs->clip.x2 ? cx + hw : rs->clip.x2;
+        if (x1 <= x2) fill_span(raster_row(rs, y), x1, x2, color, alpha);
+    }
+}
+
+/**
+ * @brief Opacity of particle @p i after fading and twinkling
+ */
+static lv_opa_t particle_opa(const particle_system_t *ps, uint16_t i) {
+    const particle_emitter_t *em = ps->emitter;
+    uint32_t opa = em->opa;
+
+    if (em->fade && ps->life0[i] != 0) {
+        opa = opa * ps->life[i] / ps->life0[i];
+    }
+    if (em->twinkle) {
+        opa = (opa * (uint32_t)(fx_sin_turn(ps->phase[i]) + FX_ONE)) >> (FX_SHIFT + 1);
+    }
+    return (lv_opa_t)opa;
+}
+
+static int32_t particle_wobble(const particle_system_t *ps, uint16_t i) {
+    int32_t amp = ps->emitter->wobble_px;
+    return amp ? fx_round(amp * fx_sin_turn(ps->phase[i])) : 0;
+}
+
+/**
+ * @brief True if nothing queued on @p layer is still to be painted
+ *
+ * Never dispatches: the layer may be the display's, mid refresh. With the
+ * software renderer and no OS, a task is normally painted as soon as it is
+ * created and only waits in the list to be freed.
+ */
+static bool layer_settled(const lv_layer_t *layer) {
+    for (const lv_draw_task_t *t = layer->draw_task_head; t != NULL; t = t->next) {
+        if (t->state != LV_DRAW_TASK_STATE_READY) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief lv_draw_rect() per particle, for layers that are not RGB565 or
+ *        still have pixels to paint
+ */
+static void draw_fallback(const particle_system_t *ps, lv_layer_t *layer) {
+    const particle_emitter_t *em = ps->emitter;
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+
+    for (uint16_t i = 0; i < ps->count; i++) {
+        int32_t x = fx_to_int(ps->x[i]) + particle_wobble(ps, i);
+        int32_t y = fx_to_int(ps->y[i]);
+        int32_t s = ps->size[i];
+        lv_area_t area;
+
+        dsc.bg_color = lv_color_hex(em->colors[ps->color[i]]);
+        dsc.bg_opa = particle_opa(ps, i);
+        if (dsc.bg_opa <= LV_OPA_MIN) continue;
+
+        if (em->shape == PARTICLE_SHAPE_RECT) {
+            dsc.radius = 0;
+            lv_area_set(&area, x, y, x + s - 1, y + em->rect_h - 1);
+            lv_draw_rect(layer, &dsc, &area);
+            continue;
+        }
+
+        dsc.radius = LV_RADIUS_CIRCLE;
+        lv_area_set(&area, x - s, y - s, x + s, y + s);
+        lv_draw_rect(layer, &dsc, &area);
+        if (em->highlight_opa && s >= 3) {
+            int32_t hx = x - s / 3;
+            int32_t hy = y - s / 3;
+            dsc.bg_color = lv_color_white();
+            dsc.bg_opa = em->highlight_opa;
+            lv_area_set(&area, hx - s / 3, hy - s / 3, hx + s / 3, hy + s / 3);
+            lv_draw_rect(layer, &dsc, &area);
+        }
+    }
+}
+
+static void draw_direct(const particle_system_t *ps, const raster_t *rs) {
+    const particle_emitter_t *em = ps->emitter;
+    int32_t reach = em->shape == PARTICLE_SHAPE_DISC ? em->size_max : 0;
+    int32_t below = em->shape == PARTICLE_SHAPE_DISC ? em->size_max : em->rect_h - 1;
+
+    for (uint16_t i = 0; i < ps->count; i++) {
+        /* Rows first: in a display stripe most particles are above or below */
+        int32_t y = fx_to_int(ps->y[i]);
+        if (y + below < rs->clip.y1 || y - reach > rs->clip.y2) continue;
+
+        lv_opa_t opa = particle_opa(ps, i);
+        uint32_t alpha = ((uint32_t)opa + 4) >> 3;
+        if (alpha == 0) continue;
+
+        int32_t x = fx_to_int(ps->x[i]) + particle_wobble(ps, i);
+        int32_t s = ps->size[i];
+        uint16_t color = ps->palette[ps->color[i]];
+
+        if (em->shape == PARTICLE_SHAPE_RECT) {
+            raster_rect(rs, x, y, x + s - 1, y + em->rect_h - 1, color, alpha);
+            continue;
+        }
+
+        if (s > PARTICLE_MAX_RADIUS) s = PARTICLE_MAX_RADIUS;
+        raster_disc(rs, x, y, s, color, alpha);
+        if (em->highlight_opa && s >= 3) {
+            raster_disc(rs, x - s / 3, y - s / 3, s / 3, 0xFFFF, ((uint32_t)em->highlight_opa + 4) >> 3);
+        }
+    }
+}
+
+/*===========================================================================
+ * Public Functions
+ *===========================================================================*/
+
+esp_err_t particle_system_init(particle_system_t *ps, const particle_emitter_t *emitter,
+                               uint16_t capacity) {
+    if (ps == NULL || emitter == NULL || capacity == 0 || emitter->color_count > PARTICLE_MAX_COLORS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    /* One block, widest arrays first so every array stays aligned */
+    size_t n = capacity;
+    size_t bytes = n * (4 * sizeof(fx16_t) + 4 * sizeof(uint16_t) + 2 * sizeof(uint8_t));
+    uint8_t *block = heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (block == NULL) {
+        ESP_LOGW(TAG, "No memory for %u particles", capacity);
+        return ESP_ERR_NO_MEM;
+    }
+
+    memset(ps, 0, sizeof(*ps));
+    ps->emitter = emitter;
+    ps->capacity = capacity;
+    ps->limit = capacity;
+    ps->seed = (uint32_t)now_us() | 1;
+
+    ps->x = (fx16_t *)block;
+    ps->y = ps->x + n;
+    ps->vx = ps->y + n;
+    ps->vy = ps->vx + n;
+    ps->life = (uint16_t *)(ps->vy + n);
+    ps->life0 = ps->life + n;
+    ps->phase = ps->life0 + n;
+    ps->freq = ps->phase + n;
+    ps->size = (uint8_t *)(ps->freq + n);
+    ps->color = ps->size + n;
+
+    for (int c = 0; c < emitter->color_count; c++) {
+        ps->palette[c] = lv_color_to_u16(lv_color_hex(emitter->colors[c]));
+    }
+    disc_table_init();
+    return ESP_OK;
+}
+
+void particle_system_deinit(particle_system_t *ps) {
+    if (ps == NULL) return;
+
+    heap_caps_free(ps->x);      /* Start of the block */
+    memset(ps, 0, sizeof(*ps));
+}
+
+void particle_system_fill(particle_system_t *ps, uint16_t n) {
+    if (ps == NULL || ps->emitter == NULL) return;
+
+    for (uint16_t k = 0; k < n; k++) {
+        int i = spawn(ps);
+        if (i < 0) return;
+        spawn_in(ps, (uint16_t)i, &ps->emitter->bounds);
+        if (ps->life0[i] != 0) ps->life[i] = (uint16_t)rand_range(ps, 1, ps->life0[i]);
+    }
+}
+
+void particle_system_emit(particle_system_t *ps, uint16_t n, int32_t x, int32_t y) {
+    if (ps == NULL || ps->emitter == NULL) return;
+
+    for (uint16_t k = 0; k < n; k++) {
+        int i = spawn(ps);
+        if (i < 0) return;
+        particle_init(ps, (uint16_t)i, fx_from_int(x), fx_from_int(y));
+    }
+}
+
+void particle_system_clear(particle_system_t *ps) {
+    if (ps == NULL) return;
+    ps->count = 0;
+}
+
+void particle_system_update(particle_system_t *ps, uint32_t step_us) {
+    if (ps == NULL || ps->emitter == NULL) return;
+
+    const particle_emitter_t *em = ps->emitter;
+    int64_t t0 = now_us();
+    budget_update(ps, step_us);
+
+    /* Step in Q16 seconds; aging in whole ms, the rest carried over */
+    fx16_t dt = (fx16_t)(((uint64_t)step_us << FX_SHIFT) / 1000000);
+    ps->age_rem_us += step_us;
+    uint32_t age_ms = ps->age_rem_us / 1000;
+    ps->age_rem_us -= age_ms * 1000;
+    /* Phase advance per mHz, Q16 of 1/65536 turn */
+    uint32_t phase_scale = (uint32_t)(((uint64_t)step_us << 32) / 1000000000ULL);
+    uint16_t n = ps->count;
+
+    /* Batched integration, one attribute per pass */
+    for (uint16_t i = 0; i < n; i++) ps->x[i] += fx_mul(ps->vx[i], dt);
+    for (uint16_t i = 0; i < n; i++) ps->y[i] += fx_mul(ps->vy[i], dt);
+    if (em->ax != 0) {
+        fx16_t dv = em->ax * dt;
+        for (uint16_t i = 0; i < n; i++) ps->vx[i] += dv;
+    }
+    if (em->ay != 0) {
+        fx16_t dv = em->ay * dt;
+        for (uint16_t i = 0; i < n; i++) ps->vy[i] += dv;
+    }
+    if (em->wobble_px != 0 || em->twinkle) {
+        for (uint16_t i = 0; i < n; i++) {
+            ps->phase[i] += (uint16_t)(((uint64_t)ps->freq[i] * phase_scale) >> 16);
+        }
+    }
+
+    /* Age, then kill or respawn; the excess over the cap is not respawned */
+    for (uint16_t i = 0; i < ps->count;) {
+        bool dead = !in_bounds(&em->bounds, ps->x[i], ps->y[i]);
+        if (ps->life0[i] != 0) {
+            if (ps->life[i] <= age_ms) dead = true;
+            else ps->life[i] -= (uint16_t)age_ms;
+        }
+
+        if (!dead) {
+            i++;
+        } else if (em->respawn && ps->count <= ps->limit) {
+            spawn_in(ps, i, &em->spawn);
+            i++;
+        } else {
+            kill(ps, i);
+        }
+    }
+
+    ps->frame_count = ps->count;
+    ps->update_us = (uint32_t)(now_us() - t0);
+    ps->draw_us = 0;
+}
+
+void particle_system_draw(particle_system_t *ps, lv_layer_t *layer) {
+    if (ps == NULL || ps->count == 0 || layer == NULL) return;
+
+    lv_draw_buf_t *buf = layer->draw_buf;
+    if (buf == NULL || buf->data == NULL || layer->color_format != LV_COLOR_FORMAT_RGB565) {
+        draw_fallback(ps, layer);
+        return;
+    }
+    /* Pending tasks paint what lies under the particles; writing now would
+     * put the particles beneath it. Queue them behind those tasks instead. */
+    if (!layer_settled(layer)) {
+        ps->queued_draws++;
+        draw_fallback(ps, layer);
+        return;
+    }
+
+    int64_t t0 = now_us();
+    raster_t rs = {
+        .data = buf->data,
+        .stride = buf->header.stride,
+        .buf_area = layer->buf_area,
+        .clip = layer->_clip_area,
+    };
+    draw_direct(ps, &rs);
+    ps->draw_us += (uint32_t)(now_us() - t0);
+}
+
+#if CONFIG_APP_SELF_TEST
+/*===========================================================================
+ * Benchmark (CONFIG_APP_SELF_TEST)
+ *===========================================================================*/
+
+#define BENCH_WIDTH             240
+#define BENCH_HEIGHT            284
+#define BENCH_STRIPE_H          64
+#define BENCH_STEP_US           40000       /* 25 FPS */
+
+static const particle_emitter_t s_bench_emitter = {
+    .spawn = { 0, -10, BENCH_WIDTH - 1, -1 },
+    .bounds = { -8, -10, BENCH_WIDTH + 7, BENCH_HEIGHT - 1 },
+    .respawn = true,
+    .vy_min = 30, .vy_max = 70,
+    .shape = PARTICLE_SHAPE_DISC,
+    .size_min = 2, .size_max = 5,
+    .colors = { 0xFFFFFF, 0xE3F2FD },
+    .color_count = 2,
+    .opa = LV_OPA_80,
+    .freq_min_mhz = 250, .freq_max_mhz = 400,
+    .wobble_px = 6,
+    .budget_us = UINT32_MAX,
+};
+
+esp_err_t particle_benchmark(uint32_t frames, particle_bench_t bench[PARTICLE_BENCH_SIZES]) {
+    static const uint16_t sizes[PARTICLE_BENCH_SIZES] = { 50, 200, 1000 };
+
+    if (bench == NULL || frames == 0) return ESP_ERR_INVALID_ARG;
+
+    uint32_t stride = BENCH_WIDTH * 2;
+    uint8_t *data = heap_caps_malloc(stride * BENCH_STRIPE_H, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (data == NULL) return ESP_ERR_NO_MEM;
+
+    /* A stripe of the display's partial refresh; no LVGL draw tasks queued */
+    lv_draw_buf_t buf;
+    memset(&buf, 0, sizeof(buf));
+    buf.header.magic = LV_IMAGE_HEADER_MAGIC;
+    buf.header.cf = LV_COLOR_FORMAT_RGB565;
+    buf.header.w = BENCH_WIDTH;
+    buf.header.h = BENCH_STRIPE_H;
+    buf.header.stride = stride;
+    buf.data = data;
+    buf.data_size = stride * BENCH_STRIPE_H;
+
+    lv_layer_t layer;
+    memset(&layer, 0, sizeof(layer));
+    layer.draw_buf = &buf;
+    layer.color_format = LV_COLOR_FORMAT_RGB565;
+
+    esp_err_t err = ESP_OK;
+    for (int s = 0; s < PARTICLE_BENCH_SIZES; s++) {
+        particle_system_t ps;
+        err = particle_system_init(&ps, &s_bench_emitter, sizes[s]);
+        if (err != ESP_OK) break;
+        particle_system_fill(&ps, sizes[s]);
+
+        int64_t update_us = 0;
+        int64_t draw_us = 0;
+        for (uint32_t f = 0; f < frames; f++) {
+            int64_t t0 = now_us();
+            particle_system_update(&ps, BENCH_STEP_US);
+            update_us += now_us() - t0;
+
+            for (int32_t y = 0; y < BENCH_HEIGHT; y += BENCH_STRIPE_H) {
+                int32_t y2 = y + BENCH_STRIPE_H - 1;
+                lv_area_set(&layer.buf_area, 0, y, BENCH_WIDTH - 1, y2);
+                lv_area_set(&layer._clip_area, 0, y, BENCH_WIDTH - 1, y2 < BENCH_HEIGHT ? y2 : BENCH_HEIGHT - 1);
+                memset(data, 0, buf.data_size);     /* The background, not timed */
+                t0 = now_us();
+                particle_system_draw(&ps, &layer);
+                draw_us += now_us() - t0;
+            }
+        }
+
+        bench[s].count = ps.count;
+        bench[s].update_us = (uint32_t)(update_us / frames);
+        bench[s].draw_us = (uint32_t)(draw_us / frames);
+        particle_system_deinit(&ps);
+
+        ESP_LOGI(TAG, "%u particles: update %lu us, draw %lu us per frame", bench[s].count,
+                 (unsigned long)bench[s].update_us, (unsigned long)bench[s].draw_us);
+    }
+
+    heap_caps_free(data);
+    return err;
+}
+#endif /* CONFIG_APP_SELF_TEST */
@@ -33,20 +33,29 @@ static void ensure_mutex_init(void)
 }
 
 /**
- * @brief Take mutex with timeout
+ * @brief Take mutex with timeout, then the shared SPI bus (file I/O class)
  */
 static bool take_mutex(void)
 {
     ensure_mutex_init();
-    return xSemaphoreTake(s_file_mutex, pdMS_TO_TICKS(5000)) == pdTRUE;
+    if (xSemaphoreTake(s_file_mutex, pdMS_TO_TICKS(5000)) != pdTRUE) {
+        return false;
+    }
+    if (bsp_spi_bus_acquire(BSP_SPI_CLIENT_FILE, BSP_SPI_BUS_WAIT_DEFAULT) != ESP_OK) {
+        ESP_LOGW(TAG, "SPI bus busy");
+        xSemaphoreGive(s_file_mutex);
+        return false;
+    }
+    return true;
 }
 
 /**
- * @brief Release mutex
+ * @brief Release the SPI bus and mutex
  */
 static void give_mutex(void)
 {
     if (s_file_mutex != NULL) {
+        bsp_spi_bus_release(BSP_SPI_CLIENT_FILE);
         xSemaphoreGive(s_file_mutex);
     }
 }
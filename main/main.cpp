@@ -39,6 +39,9 @@
 #include "time_sync.h"              /* NTP time sync to RTC */
 #include "sd_logger.h"              /* SD card file logging */
 #include "power_manager.h"          /* Face-down sleep mode */
+#if CONFIG_APP_SELF_TEST
+#include "self_test.h"              /* Component checks and benchmarks */
+#endif
 
 #include "esp_heap_caps.h"
 
@@ -476,6 +479,11 @@ extern "C" void app_main(void)
     /* Release LVGL mutex - UI is now ready and running */
     lvgl_port_unlock();
 
+#if CONFIG_APP_SELF_TEST
+    /* Run the component checks and benchmarks once the UI has settled */
+    self_test_start();
+#endif
+
     /* Note: app_main returns here, but the LVGL task continues running
      * in the background, handling UI updates and touch events.
      * FreeRTOS scheduler manages all tasks automatically.
@@ -0,0 +1,183 @@
+/**
+ * @file self_test.c
+ * @brief Boot-time run of the component self-checks and benchmarks
+ *
+ * Each component keeps its checks next to the code they cover, built only
+ * with CONFIG_APP_SELF_TEST. This task calls all of them once, in order,
+ * and logs a summary:
+ * - ESP_OK counts as passed, ESP_ERR_INVALID_STATE as skipped (the module
+ *   under test is not running), anything else as failed
+ * - Checks that draw or read LVGL state run with the LVGL lock held
+ */
+
+#include "self_test.h"
+#include "audio_driver.h"
+#include "bsp_board.h"
+#include "audio_resampler.h"
+#include "audio_adpcm.h"
+#include "audio_recorder.h"
+#include "audio_spectrum.h"
+#include "mochi_state.h"
+#include "fixed_math.h"
+#include "particle_engine.h"
+#include "anim_clock.h"
+#include "gallery_animations.h"
+#include "esp_log.h"
+#include "esp_lvgl_port.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+static const char *TAG = "self_test";
+
+/*===========================================================================
+ * Configuration
+ *===========================================================================*/
+
+#define SELF_TEST_DELAY_MS      5000    /* Let the UI and audio settle after boot */
+#define SELF_TEST_STACK         6144
+#define SELF_TEST_PRIO          (tskIDLE_PRIORITY + 1)
+
+/*===========================================================================
+ * Tests
+ *===========================================================================*/
+
+typedef esp_err_t (*self_test_fn_t)(void);
+
+static esp_err_t test_audio_mixer(void)
+{
+    audio_mixer_check_t r;
+    return audio_mixer_check(&r);
+}
+
+static esp_err_t test_audio_widen(void)
+{
+    esp_audio_widen_bench_t r;
+    return esp_audio_widen_benchmark(200, &r);
+}
+
+static esp_err_t test_audio_resampler(void)
+{
+    audio_resampler_bench_t r[AUDIO_RESAMPLER_BENCH_RATES];
+    return audio_resampler_benchmark(44100, r);
+}
+
+static esp_err_t test_audio_adpcm(void)
+{
+    audio_adpcm_bench_t r;
+    return audio_adpcm_benchmark(16000, NULL, 0, &r);
+}
+
+static esp_err_t test_audio_recorder(void)
+{
+    audio_recorder_check_t r;
+    return audio_recorder_check(&r);
+}
+
+static esp_err_t test_audio_fft(void)
+{
+    audio_fft_bench_t r;
+    return audio_fft_benchmark(1000, &r);
+}
+
+static esp_err_t test_mochi_face(void)
+{
+    mochi_face_bench_t r;
+    return mochi_face_benchmark(50, &r);
+}
+
+static esp_err_t test_fixed_math(void)
+{
+    fx_math_errors_t errors;
+    fx_math_bench_t bench;
+    esp_err_t ret = fx_math_check(&errors);
+    fx_math_benchmark(1000, &bench);
+    return ret;
+}
+
+static esp_err_t test_particles(void)
+{
+    particle_bench_t bench[PARTICLE_BENCH_SIZES];
+    return particle_benchmark(50, bench);
+}
+
+static esp_err_t test_anim_clock(void)
+{
+    anim_clock_errors_t errors;
+    return anim_clock_check(&errors);
+}
+
+static esp_err_t test_mochi_anim(void)
+{
+    mochi_anim_check_t r;
+    return mochi_anim_check(&r);
+}
+
+static esp_err_t test_gallery_anim(void)
+{
+    gallery_anim_check_t r;
+    return gallery_anim_check(&r);
+}
+
+static const struct {
+    const char *name;
+    self_test_fn_t run;
+    bool lvgl;                          /* Run with the LVGL lock held */
+} s_tests[] = {
+    { "audio_mixer_check", test_audio_mixer, false },
+    { "esp_audio_widen_benchmark", test_audio_widen, false },
+    { "audio_resampler_benchmark", test_audio_resampler, false },
+    { "audio_adpcm_benchmark", test_audio_adpcm, false },
+    { "audio_recorder_check", test_audio_recorder, false },
+    { "audio_fft_benchmark", test_audio_fft, false },
+    { "mochi_face_benchmark", test_mochi_face, true },
+    { "fx_math_check", test_fixed_math, false },
+    { "particle_benchmark", test_particles, true },
+    { "anim_clock_check", test_anim_clock, false },
+    { "mochi_anim_check", test_mochi_anim, true },
+    { "gallery_anim_check", test_gallery_anim, true },
+};
+
+/*===========================================================================
+ * Task
+ *===========================================================================*/
+
+static void self_test_task(void *arg)
+{
+    int passed = 0;
+    int failed = 0;
+    int skipped = 0;
+
+    vTaskDelay(pdMS_TO_TICKS(SELF_TEST_DELAY_MS));
+    ESP_LOGI(TAG, "Running %d checks", (int)(sizeof(s_tests) / sizeof(s_tests[0])));
+
+    for (size_t i = 0; i < sizeof(s_tests) / sizeof(s_tests[0]); i++) {
+        if (s_tests[i].lvgl) {
+            lvgl_port_lock(0);
+        }
+        esp_err_t err = s_tests[i].run();
+        if (s_tests[i].lvgl) {
+            lvgl_port_unlock();
+        }
+
+        if (err == ESP_OK) {
+            passed++;
+            ESP_LOGI(TAG, "%s: pass", s_tests[i].name);
+        } else if (err == ESP_ERR_INVALID_STATE) {
+            skipped++;
+            ESP_LOGW(TAG, "%s: skipped (not running)", s_tests[i].name);
+        } else {
+            failed++;
+            ESP_LOGE(TAG, "%s: FAIL (%s)", s_tests[i].name, esp_err_to_name(err));
+        }
+    }
+
+    ESP_LOGI(TAG, "Done: %d passed, %d failed, %d skipped", passed, failed, skipped);
+    vTaskDelete(NULL);
+}
+
+void self_test_start(void)
+{
+    if (xTaskCreate(self_test_task, "self_test", SELF_TEST_STACK, NULL, SELF_TEST_PRIO, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create self-test task");
+    }
+}
@@ -0,0 +1,23 @@
+/**
+ * @file self_test.h
+ * @brief Boot-time run of the component self-checks and benchmarks
+ *
+ * Only built with CONFIG_APP_SELF_TEST.
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Start the self-test task
+ *
+ * Call once the UI and audio are up. The task waits SELF_TEST_DELAY_MS,
+ * runs every check in turn, logs a summary and deletes itself.
+ */
+void self_test_start(void);
+
+#ifdef __cplusplus
+}
+#endif